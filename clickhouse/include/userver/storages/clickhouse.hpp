@@ -4,6 +4,8 @@
 /// This file is mainly for documentation purposes and inclusion of all headers
 /// that are required for working with ClickHouse µserver component.
 
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/buffered_inserter_component.hpp>
 #include <userver/storages/clickhouse/cluster.hpp>
 #include <userver/storages/clickhouse/component.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
@@ -18,6 +20,7 @@
 ///
 /// @section feature Features
 /// - Connection pooling;
+/// - Buffered inserts;
 /// - Variadic template query parameter passing;
 /// - Query result extraction to C++ types;
 /// - Mapping C++ types to native ClickHouse types.
@@ -25,6 +28,7 @@
 /// @section info More information
 /// - For configuration see components::ClickHouse
 /// - For cluster operations see storages::clickhouse::Cluster
+/// - For buffered inserts see storages::clickhouse::BufferedInserter
 /// - For mapping C++ types to Clickhouse types see @ref clickhouse_io
 ///
 /// ----------
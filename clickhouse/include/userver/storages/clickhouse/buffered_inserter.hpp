@@ -0,0 +1,135 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/storages/clickhouse/fwd.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+namespace impl {
+class BufferedInserterImpl;
+}
+
+/// Buffering and flushing limits of the BufferedInserter
+struct BufferedInserterSettings final {
+  /// Buffered rows count to start a flush at
+  std::size_t max_rows{100'000};
+
+  /// Approximate buffered data size in bytes to start a flush at
+  std::size_t max_bytes{64 * 1024 * 1024};
+
+  /// Buffered data is flushed at least this often
+  std::chrono::milliseconds flush_interval{1000};
+
+  /// Buffered and being flushed rows count limit, inserts wait for
+  /// the buffer space when it is reached
+  std::size_t max_buffered_rows{1'000'000};
+
+  /// How long an insert waits for the buffer space before giving up
+  std::chrono::milliseconds max_wait{100};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief Accumulates inserts into a single table and sends them to the
+/// cluster in big batches from a background task.
+///
+/// Many small inserts are expensive for ClickHouse, as each of them creates
+/// a separate part on the server. BufferedInserter concatenates inserted data
+/// and flushes it when `max_rows` or `max_bytes` is reached
+/// or each `flush_interval`.
+///
+/// Inserts do not wait for the data to be written: the data is lost if its
+/// flush fails, such rows are accounted in the statistics as dropped.
+/// When the buffer is full, inserts wait for a flush for up to `max_wait`,
+/// then drop the data and throw BufferOverflowError.
+///
+/// The remaining data is flushed on destruction.
+///
+/// Usually retrieved from components::ClickHouseBufferedInserter component.
+class BufferedInserter final {
+ public:
+  /// Exception that is thrown if there is no space in the buffer
+  class BufferOverflowError : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+  };
+
+  /// BufferedInserter constructor
+  /// @param cluster cluster to insert into
+  /// @param table_name table to insert into
+  /// @param column_names names of columns of the table
+  /// @param settings buffering and flushing limits
+  BufferedInserter(ClusterPtr cluster, std::string table_name,
+                   std::vector<std::string> column_names,
+                   const BufferedInserterSettings& settings);
+  /// BufferedInserter destructor, flushes the buffered data
+  ~BufferedInserter();
+
+  BufferedInserter(const BufferedInserter&) = delete;
+
+  /// @brief Buffers data for the insertion;
+  /// `T` is expected to be a struct of vectors of same length.
+  /// See @ref clickhouse_io for better understanding of T's requirements.
+  /// @throws BufferOverflowError if there is no space in the buffer
+  template <typename T>
+  void Insert(const T& data);
+
+  /// @brief Buffers data for the insertion;
+  /// `Container` is expected to be an iterable of clickhouse-mapped type.
+  /// See @ref clickhouse_io for better understanding of
+  /// `Container::value_type`'s requirements.
+  /// @throws BufferOverflowError if there is no space in the buffer
+  template <typename Container>
+  void InsertRows(const Container& data);
+
+  /// Sends the buffered data to the cluster and waits for the result
+  void Flush();
+
+  /// Write inserter statistics
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ private:
+  void DoInsert(const impl::InsertionRequest& request);
+
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_name_views_;
+
+  std::unique_ptr<impl::BufferedInserterImpl> impl_;
+};
+
+template <typename T>
+void BufferedInserter::Insert(const T& data) {
+  const auto request =
+      impl::InsertionRequest::Create(table_name_, column_name_views_, data);
+
+  DoInsert(request);
+}
+
+template <typename Container>
+void BufferedInserter::InsertRows(const Container& data) {
+  if (data.empty()) return;
+
+  const auto request = impl::InsertionRequest::CreateFromRows(
+      table_name_, column_name_views_, data);
+
+  DoInsert(request);
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter_component.hpp
+/// @brief @copybrief components::ClickHouseBufferedInserter
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+class BufferedInserter;
+}
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief ClickHouse buffered inserts component
+///
+/// Provides storages::clickhouse::BufferedInserter for a table of
+/// a components::ClickHouse cluster.
+///
+/// ## Static options:
+/// Name                 | Description                                            | Default value
+/// -------------------- | ------------------------------------------------------ | ---------------
+/// clickhouse_component | name of the components::ClickHouse to use              | -
+/// table                | table to insert into                                   | -
+/// columns              | names of the columns of the inserted data              | -
+/// max_rows             | buffered rows count to start a flush at                | 100000
+/// max_bytes            | approximate buffered data size to start a flush at     | 67108864
+/// flush_interval       | buffered data is flushed at least this often           | 1s
+/// max_buffered_rows    | buffered and being flushed rows limit                  | 1000000
+/// max_wait             | how long an insert waits for the buffer space          | 100ms
+
+// clang-format on
+
+class ClickHouseBufferedInserter : public LoggableComponentBase {
+ public:
+  /// Component constructor
+  ClickHouseBufferedInserter(const ComponentConfig&, const ComponentContext&);
+  /// Component destructor
+  ~ClickHouseBufferedInserter() override;
+
+  /// Inserter accessor
+  std::shared_ptr<storages::clickhouse::BufferedInserter> GetInserter() const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<storages::clickhouse::BufferedInserter> inserter_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<ClickHouseBufferedInserter> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -3,13 +3,18 @@
 /// @file userver/storages/clickhouse/cluster.hpp
 /// @brief @copybrief storages::clickhouse::Cluster
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/components/component_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
 
 #include <userver/storages/clickhouse/fwd.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
@@ -26,7 +31,8 @@ class ExecutionResult;
 
 namespace impl {
 struct ClickhouseSettings;
-}
+class BufferedInserterImpl;
+}  // namespace impl
 
 /// @ingroup userver_clients
 ///
@@ -60,6 +66,34 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster
+  /// with args as query parameters, calling `on_block` for each block of the
+  /// result as soon as it is received.
+  ///
+  /// Unlike Execute, does not accumulate the whole result in memory, only
+  /// a single block is kept at once. `on_block` may convert its argument with
+  /// any of ExecutionResult methods. If `on_block` throws, the query is
+  /// cancelled and the exception is rethrown from this method.
+  ///
+  /// @note The execution timeout limits the whole query including the
+  /// callback calls, consider increasing it for huge results.
+  ///
+  /// @snippet storages/tests/execute_chtest.cpp  Sample ExecuteStreamed usage
+  template <typename... Args>
+  void ExecuteStreamed(const Query& query,
+                       const ExecutionResultCallback& on_block,
+                       const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters, calling
+  /// `on_block` for each block of the result as soon as it is received.
+  ///
+  /// See ExecuteStreamed above for the details.
+  template <typename... Args>
+  void ExecuteStreamed(OptionalCommandControl, const Query& query,
+                       const ExecutionResultCallback& on_block,
+                       const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -94,6 +128,12 @@ class Cluster final {
   /// copies of data instead of just 1 copy) due to implementation details, so
   /// consider using less convenient but more performant analogue if performance
   /// is a concern.
+  /// @note If `insert_block_rows` is set in the component config and
+  /// `data` has more rows, the rows are sent in blocks of at most that many
+  /// rows, each block being a separate INSERT with its own timeout. The next
+  /// block is built in a separate task while the current one is being sent.
+  /// The blocks are not inserted atomically: if some block fails, the
+  /// previous ones remain inserted.
   template <typename Container>
   void InsertRows(const std::string& table_name,
                   const std::vector<std::string_view>& column_names,
@@ -111,6 +151,12 @@ class Cluster final {
   /// copies of data instead of just 1 copy) due to implementation details, so
   /// consider using less convenient but more performant analogue if performance
   /// is a concern.
+  /// @note If `insert_block_rows` is set in the component config and
+  /// `data` has more rows, the rows are sent in blocks of at most that many
+  /// rows, each block being a separate INSERT with its own timeout. The next
+  /// block is built in a separate task while the current one is being sent.
+  /// The blocks are not inserted atomically: if some block fails, the
+  /// previous ones remain inserted.
   template <typename Container>
   void InsertRows(OptionalCommandControl, const std::string& table_name,
                   const std::vector<std::string_view>& column_names,
@@ -126,15 +172,28 @@ class Cluster final {
   };
 
  private:
+  friend class impl::BufferedInserterImpl;
+
   void DoInsert(OptionalCommandControl,
                 const impl::InsertionRequest& request) const;
 
+  template <typename Container>
+  void DoInsertRowsInBlocks(OptionalCommandControl optional_cc,
+                            const std::string& table_name,
+                            const std::vector<std::string_view>& column_names,
+                            const Container& data) const;
+
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreamed(OptionalCommandControl, const Query& query,
+                         const ExecutionResultCallback& on_block) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
   mutable std::atomic<std::size_t> current_pool_ind_{0};
+  // 0 means that InsertRows() sends all the rows in a single block
+  std::size_t insert_block_rows_{0};
 };
 
 template <typename T>
@@ -169,12 +228,56 @@ void Cluster::InsertRows(OptionalCommandControl optional_cc,
                          const Container& data) const {
   if (data.empty()) return;
 
+  if (insert_block_rows_ != 0 && data.size() > insert_block_rows_) {
+    DoInsertRowsInBlocks(optional_cc, table_name, column_names, data);
+    return;
+  }
+
   const auto request =
       impl::InsertionRequest::CreateFromRows(table_name, column_names, data);
 
   DoInsert(optional_cc, request);
 }
 
+template <typename Container>
+void Cluster::DoInsertRowsInBlocks(
+    OptionalCommandControl optional_cc, const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const Container& data) const {
+  using Iterator = decltype(std::cbegin(data));
+  using Range = impl::RowsRange<Iterator>;
+
+  std::vector<Range> blocks;
+  blocks.reserve((data.size() + insert_block_rows_ - 1) / insert_block_rows_);
+  auto it = std::cbegin(data);
+  for (std::size_t left = data.size(); left > 0;) {
+    const auto block_rows = std::min(left, insert_block_rows_);
+    blocks.emplace_back(it, block_rows);
+    it = std::next(it, block_rows);
+    left -= block_rows;
+  }
+
+  // the next block is built while the current one is being sent
+  std::optional<impl::InsertionRequest> request{
+      impl::InsertionRequest::CreateFromRows(table_name, column_names,
+                                             blocks.front())};
+  for (std::size_t i = 0; i < blocks.size(); ++i) {
+    engine::TaskWithResult<impl::InsertionRequest> next_request;
+    if (i + 1 < blocks.size()) {
+      next_request = USERVER_NAMESPACE::utils::Async(
+          "clickhouse_build_insert_block",
+          [&table_name, &column_names, &block = blocks[i + 1]] {
+            return impl::InsertionRequest::CreateFromRows(table_name,
+                                                          column_names, block);
+          });
+    }
+
+    DoInsert(optional_cc, *request);
+
+    if (next_request.IsValid()) request.emplace(next_request.Get());
+  }
+}
+
 template <typename... Args>
 ExecutionResult Cluster::Execute(const Query& query,
                                  const Args&... args) const {
@@ -189,6 +292,22 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreamed(const Query& query,
+                              const ExecutionResultCallback& on_block,
+                              const Args&... args) const {
+  ExecuteStreamed(OptionalCommandControl{}, query, on_block, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreamed(OptionalCommandControl optional_cc,
+                              const Query& query,
+                              const ExecutionResultCallback& on_block,
+                              const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreamed(optional_cc, formatted_query, on_block);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
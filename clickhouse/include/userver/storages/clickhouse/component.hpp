@@ -50,7 +50,8 @@ namespace components {
 /// max_pool_size         | maximum number of created connections            | 10
 /// queue_timeout         | client waiting for a free connection time limit  | 1s
 /// use_secure_connection | whether to use TLS for connections               | true
-/// compression           | compression method to use (none / lz4)           | none
+/// compression           | compression method to use (none / lz4 / zstd)    | none
+/// insert_block_rows     | max rows per block sent by InsertRows(), 0 - all | 0
 
 // clang-format on
 
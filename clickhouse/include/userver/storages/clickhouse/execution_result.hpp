@@ -3,6 +3,7 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -61,6 +62,10 @@ class ExecutionResult final {
   impl::BlockWrapperPtr block_;
 };
 
+/// Callback that is called for each received block of a streamed result,
+/// see storages::clickhouse::Cluster::ExecuteStreamed
+using ExecutionResultCallback = std::function<void(ExecutionResult&&)>;
+
 template <typename T>
 T ExecutionResult::As() && {
   UASSERT(block_);
@@ -1,15 +1,19 @@
 #pragma once
 
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/meta_light.hpp>
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
+#include <userver/storages/clickhouse/io/columns/array_column.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 #include <userver/storages/clickhouse/io/columns/common_columns.hpp>
 #include <userver/storages/clickhouse/io/columns/nullable_column.hpp>
@@ -18,10 +22,52 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::clickhouse::impl {
 
+/// Approximate size of the values in memory, used for buffering limits
+template <typename T>
+std::size_t EstimateDataSize(const std::vector<T>& data) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::size_t size = 0;
+    for (const auto& value : data) size += value.size();
+    return size;
+  } else if constexpr (std::is_same_v<T, std::optional<std::string>>) {
+    std::size_t size = data.size();
+    for (const auto& value : data) size += value ? value->size() : 0;
+    return size;
+  } else if constexpr (meta::kIsInstantiationOf<std::vector, T>) {
+    std::size_t size = 0;
+    for (const auto& value : data) size += EstimateDataSize(value);
+    return size;
+  } else {
+    return data.size() * sizeof(T);
+  }
+}
+
+/// A part of the rows container to build a block of a split insert from
+template <typename Iterator>
+class RowsRange final {
+ public:
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+  RowsRange(Iterator begin, std::size_t size) : begin_{begin}, size_{size} {}
+
+  Iterator begin() const { return begin_; }
+  Iterator end() const { return std::next(begin_, size_); }
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const value_type& front() const { return *begin_; }
+
+ private:
+  Iterator begin_;
+  std::size_t size_;
+};
+
 class InsertionRequest final {
  public:
   InsertionRequest(const std::string& table_name,
                    const std::vector<std::string_view>& column_names);
+  InsertionRequest(const std::string& table_name,
+                   const std::vector<std::string_view>& column_names,
+                   std::unique_ptr<impl::BlockWrapper>&& block);
   InsertionRequest(InsertionRequest&&) noexcept;
   ~InsertionRequest();
 
@@ -39,13 +85,16 @@ class InsertionRequest final {
 
   const impl::BlockWrapper& GetBlock() const;
 
+  std::size_t GetDataSize() const;
+
  private:
   template <typename MappedType>
   class ColumnsMapper final {
    public:
     ColumnsMapper(impl::BlockWrapper& block,
-                  const std::vector<std::string_view>& column_names)
-        : block_{block}, column_names_{column_names} {}
+                  const std::vector<std::string_view>& column_names,
+                  std::size_t& data_size)
+        : block_{block}, column_names_{column_names}, data_size_{data_size} {}
 
     template <typename Field, size_t Index>
     void operator()(const Field& field,
@@ -55,11 +104,13 @@ class InsertionRequest final {
 
       io::columns::AppendWrappedColumn(block_, ColumnType::Serialize(field),
                                        column_names_[i], i);
+      data_size_ += EstimateDataSize(field);
     }
 
    private:
     impl::BlockWrapper& block_;
     const std::vector<std::string_view>& column_names_;
+    std::size_t& data_size_;
   };
 
   template <typename MappedType, typename Container>
@@ -67,8 +118,11 @@ class InsertionRequest final {
    public:
     RowsMapper(impl::BlockWrapper& block,
                const std::vector<std::string_view>& column_names,
-               const Container& data)
-        : block_{block}, column_names_{column_names}, data_{data} {}
+               const Container& data, std::size_t& data_size)
+        : block_{block},
+          column_names_{column_names},
+          data_{data},
+          data_size_{data_size} {}
 
     template <typename Field, size_t Index>
     void operator()(const Field&, std::integral_constant<size_t, Index> i) {
@@ -83,18 +137,21 @@ class InsertionRequest final {
 
       io::columns::AppendWrappedColumn(
           block_, ColumnType::Serialize(column_data), column_names_[i], i);
+      data_size_ += EstimateDataSize(column_data);
     }
 
    private:
     impl::BlockWrapper& block_;
     const std::vector<std::string_view>& column_names_;
     const Container& data_;
+    std::size_t& data_size_;
   };
 
   const std::string& table_name_;
   const std::vector<std::string_view>& column_names_;
 
   std::unique_ptr<impl::BlockWrapper> block_;
+  std::size_t data_size_{0};
 };
 
 template <typename T>
@@ -109,7 +166,7 @@ InsertionRequest InsertionRequest::Create(
   InsertionRequest request{table_name, column_names};
   using MappedType = typename io::CppToClickhouse<T>::mapped_type;
   auto mapper = InsertionRequest::ColumnsMapper<MappedType>{
-      *request.block_, request.column_names_};
+      *request.block_, request.column_names_, request.data_size_};
 
   boost::pfr::for_each_field(data, mapper);
   return request;
@@ -129,7 +186,7 @@ InsertionRequest InsertionRequest::CreateFromRows(
   InsertionRequest request{table_name, column_names};
   using MappedType = typename io::CppToClickhouse<T>::mapped_type;
   auto mapper = InsertionRequest::RowsMapper<MappedType, Container>{
-      *request.block_, request.column_names_, data};
+      *request.block_, request.column_names_, data, request.data_size_};
 
   boost::pfr::for_each_field(data.front(), mapper);
   return request;
@@ -29,6 +29,9 @@ class Pool final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+  void ExecuteStreamed(OptionalCommandControl, const Query& query,
+                       const ExecutionResultCallback& on_block) const;
+
   void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
   void WriteStatistics(
@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/array_column.hpp
+/// @brief Array column support
+/// @ingroup userver_clickhouse_types
+
+#include <vector>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// Casts the column to Array and returns it, throws on type mismatch
+ColumnRef GetArrayColumn(const ColumnRef& column);
+
+/// Returns the nested values of array at `ind` of the Array column
+ColumnRef GetArrayValuesAt(const ColumnRef& array, size_t ind);
+
+/// Creates an empty Array column with elements of type of `nested`
+ColumnRef MakeArrayColumn(ColumnRef&& nested);
+
+/// Appends nested values as an array to the Array column
+void AppendArray(const ColumnRef& array, ColumnRef&& values);
+
+/// @brief Represents ClickHouse Array(T) column,
+/// where T is a ClickhouseColumn as well
+template <typename T>
+class ArrayColumn final : public ClickhouseColumn<ArrayColumn<T>> {
+ public:
+  using cpp_type = std::vector<typename T::cpp_type>;
+  using container_type = std::vector<cpp_type>;
+  using iterator_data = IndexedDataHolder<ArrayColumn<T>>;
+
+  ArrayColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+
+  static cpp_type GetAt(const ColumnRef& column, size_t ind);
+};
+
+template <typename T>
+ArrayColumn<T>::ArrayColumn(ColumnRef column)
+    : ClickhouseColumn<ArrayColumn>{GetArrayColumn(column)} {}
+
+template <typename T>
+ColumnRef ArrayColumn<T>::Serialize(const container_type& from) {
+  auto array = MakeArrayColumn(T::Serialize({}));
+  for (const auto& values : from) {
+    AppendArray(array, T::Serialize(values));
+  }
+  return array;
+}
+
+template <typename T>
+typename ArrayColumn<T>::cpp_type ArrayColumn<T>::GetAt(const ColumnRef& column,
+                                                        size_t ind) {
+  const T values{GetArrayValuesAt(column, ind)};
+
+  cpp_type result;
+  result.reserve(values.Size());
+  for (auto it = values.begin(); it != values.end(); ++it) {
+    result.push_back(std::move_if_noexcept(*it));
+  }
+  return result;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
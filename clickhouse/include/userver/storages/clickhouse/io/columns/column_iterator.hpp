@@ -188,6 +188,75 @@ bool ColumnIterator<ColumnType>::DataHolder::operator==(
   return ind_ == other.ind_ && column_.get() == other.column_.get();
 }
 
+/// @brief Iterator data holder for templated columns, that can't specialize
+/// `ColumnIterator<ColumnType>::DataHolder::Get()`.
+///
+/// Such columns define `using iterator_data = IndexedDataHolder<ColumnType>`
+/// and `static cpp_type GetAt(const ColumnRef&, size_t)`.
+template <typename ColumnType>
+class IndexedDataHolder final {
+ public:
+  using IteratorPosition =
+      typename ColumnIterator<ColumnType>::IteratorPosition;
+  using value_type = typename ColumnType::cpp_type;
+
+  IndexedDataHolder() = default;
+  IndexedDataHolder(IteratorPosition iter_position, ColumnRef&& column);
+
+  IndexedDataHolder operator++(int);
+  IndexedDataHolder& operator++();
+  value_type& UpdateValue();
+  bool operator==(const IndexedDataHolder& other) const;
+
+ private:
+  ColumnRef column_;
+  size_t ind_{0};
+
+  std::optional<value_type> current_value_ = std::nullopt;
+};
+
+template <typename ColumnType>
+IndexedDataHolder<ColumnType>::IndexedDataHolder(IteratorPosition iter_position,
+                                                 ColumnRef&& column)
+    : column_{std::move(column)},
+      ind_{iter_position == IteratorPosition::kEnd ? GetColumnSize(column_)
+                                                   : 0} {}
+
+template <typename ColumnType>
+IndexedDataHolder<ColumnType> IndexedDataHolder<ColumnType>::operator++(int) {
+  IndexedDataHolder old{};
+  old.column_ = column_;
+  old.ind_ = ind_++;
+  old.current_value_ = std::move_if_noexcept(current_value_);
+  current_value_.reset();
+
+  return old;
+}
+
+template <typename ColumnType>
+IndexedDataHolder<ColumnType>& IndexedDataHolder<ColumnType>::operator++() {
+  ++ind_;
+  current_value_.reset();
+
+  return *this;
+}
+
+template <typename ColumnType>
+typename IndexedDataHolder<ColumnType>::value_type&
+IndexedDataHolder<ColumnType>::UpdateValue() {
+  UASSERT(ind_ < GetColumnSize(column_));
+  if (!current_value_.has_value()) {
+    current_value_.emplace(ColumnType::GetAt(column_, ind_));
+  }
+  return *current_value_;
+}
+
+template <typename ColumnType>
+bool IndexedDataHolder<ColumnType>::operator==(
+    const IndexedDataHolder& other) const {
+  return ind_ == other.ind_ && column_.get() == other.column_.get();
+}
+
 }  // namespace columns
 
 }  // namespace storages::clickhouse::io
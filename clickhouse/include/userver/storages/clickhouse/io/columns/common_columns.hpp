@@ -1,15 +1,18 @@
 #pragma once
 
 /// @file userver/storages/clickhouse/io/columns/common_columns.hpp
-/// Helper file to include every implemented column (except for Nullable)
+/// Helper file to include every implemented column (except for Nullable and
+/// Array)
 
 #include <userver/storages/clickhouse/io/columns/datetime64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/datetime_column.hpp>
+#include <userver/storages/clickhouse/io/columns/decimal_column.hpp>
 #include <userver/storages/clickhouse/io/columns/float32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/float64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int8_column.hpp>
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
 #include <userver/storages/clickhouse/io/columns/string_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint16_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint32_column.hpp>
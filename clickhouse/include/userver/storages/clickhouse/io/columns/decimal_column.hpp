@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/decimal_column.hpp
+/// @brief Decimal32 and Decimal64 columns support
+/// @ingroup userver_clickhouse_types
+
+#include <cstdint>
+
+#include <userver/decimal64/decimal64.hpp>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// Casts the column to Decimal with `scale`, throws on type mismatch
+ColumnRef GetDecimalColumn(const ColumnRef& column, int scale);
+
+/// Returns the unscaled value at `ind` of the Decimal column
+std::int64_t GetDecimalUnbiasedAt(const ColumnRef& column, size_t ind);
+
+/// Creates Decimal(precision, scale) column from the unscaled values
+ColumnRef MakeDecimalColumn(const std::vector<std::int64_t>& unbiased,
+                            int precision, int scale);
+
+/// @brief Helper class for instantiating Decimal columns, maps to
+/// decimal64::Decimal with the same number of fractional digits
+///
+/// see
+///  - storages::clickhouse::io::columns::Decimal32Column
+///  - storages::clickhouse::io::columns::Decimal64Column
+template <int Precision, int Scale>
+class DecimalColumn final
+    : public ClickhouseColumn<DecimalColumn<Precision, Scale>> {
+ public:
+  static_assert(Precision <= 18, "Decimal128 and wider are not supported");
+  static_assert(0 <= Scale && Scale <= Precision);
+
+  using cpp_type = decimal64::Decimal<Scale>;
+  using container_type = std::vector<cpp_type>;
+  using iterator_data = IndexedDataHolder<DecimalColumn>;
+
+  DecimalColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+
+  static cpp_type GetAt(const ColumnRef& column, size_t ind);
+};
+
+/// @brief Represents ClickHouse Decimal32(S) column
+template <int Scale>
+using Decimal32Column = DecimalColumn<9, Scale>;
+
+/// @brief Represents ClickHouse Decimal64(S) column
+template <int Scale>
+using Decimal64Column = DecimalColumn<18, Scale>;
+
+template <int Precision, int Scale>
+DecimalColumn<Precision, Scale>::DecimalColumn(ColumnRef column)
+    : ClickhouseColumn<DecimalColumn>{GetDecimalColumn(column, Scale)} {}
+
+template <int Precision, int Scale>
+ColumnRef DecimalColumn<Precision, Scale>::Serialize(
+    const container_type& from) {
+  std::vector<std::int64_t> unbiased;
+  unbiased.reserve(from.size());
+  for (const auto& value : from) unbiased.push_back(value.AsUnbiased());
+
+  return MakeDecimalColumn(unbiased, Precision, Scale);
+}
+
+template <int Precision, int Scale>
+typename DecimalColumn<Precision, Scale>::cpp_type
+DecimalColumn<Precision, Scale>::GetAt(const ColumnRef& column, size_t ind) {
+  return cpp_type::FromUnbiased(GetDecimalUnbiasedAt(column, ind));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,33 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp
+/// @brief LowCardinality(String) column support
+/// @ingroup userver_clickhouse_types
+
+#include <string>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents ClickHouse LowCardinality(String) column
+///
+/// The column is transferred as a dictionary of unique values and indices
+/// into it, saving the bandwidth compared to String column. The values are
+/// read straight from the dictionary.
+class LowCardinalityStringColumn final
+    : public ClickhouseColumn<LowCardinalityStringColumn> {
+ public:
+  using cpp_type = std::string;
+  using container_type = std::vector<cpp_type>;
+
+  LowCardinalityStringColumn(ColumnRef column);
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
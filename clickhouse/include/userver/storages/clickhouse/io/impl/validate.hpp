@@ -8,6 +8,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/meta_light.hpp>
 
+#include <userver/storages/clickhouse/io/columns/array_column.hpp>
 #include <userver/storages/clickhouse/io/columns/base_column.hpp>
 #include <userver/storages/clickhouse/io/columns/common_columns.hpp>
 #include <userver/storages/clickhouse/io/columns/nullable_column.hpp>
@@ -39,6 +40,13 @@ struct EnsureInstantiationOfColumn<columns::NullableColumn<T>> {
   }
 };
 
+template <typename T>
+struct EnsureInstantiationOfColumn<columns::ArrayColumn<T>> {
+  ~EnsureInstantiationOfColumn() {
+    [[maybe_unused]] EnsureInstantiationOfColumn<T> nested_validator{};
+  }
+};
+
 template <typename T,
           typename Seq = std::make_index_sequence<std::tuple_size_v<T>>>
 struct TupleColumnsValidate;
@@ -33,6 +33,9 @@ namespace storages::clickhouse::io {
 /// - Nullable @ref storages::clickhouse::io::columns::NullableColumn
 /// - Float32 @ref storages::clickhouse::io::columns::Float32Column
 /// - Float64 @ref storages::clickhouse::io::columns::Float64Column
+/// - Decimal32(S), Decimal64(S) @ref storages::clickhouse::io::columns::DecimalColumn
+/// - LowCardinality(String) @ref storages::clickhouse::io::columns::LowCardinalityStringColumn
+/// - Array @ref storages::clickhouse::io::columns::ArrayColumn
 ///
 /// ## Example usage:
 ///
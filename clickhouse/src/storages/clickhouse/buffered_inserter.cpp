@@ -0,0 +1,33 @@
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <storages/clickhouse/impl/buffered_inserter_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+BufferedInserter::BufferedInserter(ClusterPtr cluster, std::string table_name,
+                                   std::vector<std::string> column_names,
+                                   const BufferedInserterSettings& settings)
+    : table_name_{std::move(table_name)},
+      column_names_{std::move(column_names)},
+      column_name_views_{column_names_.begin(), column_names_.end()},
+      impl_{std::make_unique<impl::BufferedInserterImpl>(
+          std::move(cluster), table_name_, column_name_views_, settings)} {}
+
+BufferedInserter::~BufferedInserter() = default;
+
+void BufferedInserter::Flush() { impl_->Flush(); }
+
+void BufferedInserter::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer = impl_->GetStatistics();
+}
+
+void BufferedInserter::DoInsert(const impl::InsertionRequest& request) {
+  impl_->Append(request);
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
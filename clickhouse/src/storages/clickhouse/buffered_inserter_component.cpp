@@ -0,0 +1,114 @@
+#include <userver/storages/clickhouse/buffered_inserter_component.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+storages::clickhouse::BufferedInserterSettings ParseSettings(
+    const ComponentConfig& config) {
+  storages::clickhouse::BufferedInserterSettings settings;
+  settings.max_rows = config["max_rows"].As<std::size_t>(settings.max_rows);
+  settings.max_bytes = config["max_bytes"].As<std::size_t>(settings.max_bytes);
+  settings.flush_interval =
+      config["flush_interval"].As<std::chrono::milliseconds>(
+          settings.flush_interval);
+  settings.max_buffered_rows =
+      config["max_buffered_rows"].As<std::size_t>(settings.max_buffered_rows);
+  settings.max_wait =
+      config["max_wait"].As<std::chrono::milliseconds>(settings.max_wait);
+  return settings;
+}
+
+}  // namespace
+
+ClickHouseBufferedInserter::ClickHouseBufferedInserter(
+    const ComponentConfig& config, const ComponentContext& context)
+    : LoggableComponentBase{config, context} {
+  auto cluster =
+      context
+          .FindComponent<ClickHouse>(
+              config["clickhouse_component"].As<std::string>())
+          .GetCluster();
+  const auto table = config["table"].As<std::string>();
+
+  inserter_ = std::make_shared<storages::clickhouse::BufferedInserter>(
+      std::move(cluster), table,
+      config["columns"].As<std::vector<std::string>>(), ParseSettings(config));
+
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>();
+  statistics_holder_ = statistics_storage.GetStorage().RegisterWriter(
+      "clickhouse.buffered-inserter",
+      [this](utils::statistics::Writer& writer) {
+        if (inserter_) {
+          inserter_->WriteStatistics(writer);
+        }
+      },
+      {{"clickhouse_table", table}});
+}
+
+ClickHouseBufferedInserter::~ClickHouseBufferedInserter() {
+  statistics_holder_.Unregister();
+}
+
+std::shared_ptr<storages::clickhouse::BufferedInserter>
+ClickHouseBufferedInserter::GetInserter() const {
+  return inserter_;
+}
+
+yaml_config::Schema ClickHouseBufferedInserter::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: ClickHouse buffered inserts component
+additionalProperties: false
+properties:
+    clickhouse_component:
+        type: string
+        description: name of the components::ClickHouse to use
+    table:
+        type: string
+        description: table to insert into
+    columns:
+        type: array
+        description: names of the columns of the inserted data
+        items:
+            type: string
+            description: column name
+    max_rows:
+        type: integer
+        description: buffered rows count to start a flush at
+        defaultDescription: 100000
+    max_bytes:
+        type: integer
+        description: approximate buffered data size to start a flush at
+        defaultDescription: 67108864
+    flush_interval:
+        type: string
+        description: buffered data is flushed at least this often
+        defaultDescription: 1s
+    max_buffered_rows:
+        type: integer
+        description: buffered and being flushed rows limit
+        defaultDescription: 1000000
+    max_wait:
+        type: string
+        description: how long an insert waits for the buffer space
+        defaultDescription: 100ms
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
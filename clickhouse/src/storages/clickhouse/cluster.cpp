@@ -27,7 +27,9 @@ size_t WrappingIncrement(std::atomic<size_t>& value, size_t mod,
 
 Cluster::Cluster(clients::dns::Resolver& resolver,
                  const impl::ClickhouseSettings& settings,
-                 const components::ComponentConfig& config) {
+                 const components::ComponentConfig& config)
+    : insert_block_rows_{
+          config["insert_block_rows"].As<std::size_t>(std::size_t{0})} {
   const auto& endpoints = settings.endpoints;
   const auto& auth_settings = settings.auth_settings;
 
@@ -55,6 +57,12 @@ ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc,
   return GetPool().Execute(optional_cc, query);
 }
 
+void Cluster::DoExecuteStreamed(OptionalCommandControl optional_cc,
+                                const Query& query,
+                                const ExecutionResultCallback& on_block) const {
+  GetPool().ExecuteStreamed(optional_cc, query, on_block);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc,
                        const impl::InsertionRequest& request) const {
   GetPool().Insert(optional_cc, request);
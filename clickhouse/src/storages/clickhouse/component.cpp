@@ -74,8 +74,12 @@ properties:
         defaultDescription: true
     compression:
         type: string
-        description: compression method to use (none / lz4)
+        description: compression method to use (none / lz4 / zstd)
         defaultDescription: none
+    insert_block_rows:
+        type: integer
+        description: max rows in a block sent by InsertRows(), 0 - no limit
+        defaultDescription: 0
 )");
 }
 
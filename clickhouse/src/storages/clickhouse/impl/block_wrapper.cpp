@@ -1,5 +1,7 @@
 #include "block_wrapper.hpp"
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::clickhouse::impl {
@@ -23,6 +25,23 @@ void BlockWrapper::AppendColumn(std::string_view name,
 
 const clickhouse_cpp::Block& BlockWrapper::GetNative() const { return native_; }
 
+std::unique_ptr<BlockWrapper> BlockWrapper::CloneEmpty() const {
+  clickhouse_cpp::Block block{native_.GetColumnCount(), 0};
+  for (clickhouse_cpp::Block::Iterator it{native_}; it.IsValid(); it.Next()) {
+    block.AppendColumn(it.Name(), it.Column()->CloneEmpty());
+  }
+  return std::make_unique<BlockWrapper>(std::move(block));
+}
+
+void BlockWrapper::AppendRows(const BlockWrapper& other) {
+  UINVARIANT(GetColumnsCount() == other.GetColumnsCount(),
+             "An attempt to append a block with different columns");
+  for (size_t i = 0; i < GetColumnsCount(); ++i) {
+    native_[i]->Append(other.native_[i]);
+  }
+  native_.RefreshRowCount();
+}
+
 void BlockWrapperDeleter::operator()(BlockWrapper* ptr) const noexcept {
   std::default_delete<BlockWrapper>{}(ptr);
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 
 #include <storages/clickhouse/impl/wrap_clickhouse_cpp.hpp>
@@ -25,6 +27,12 @@ class BlockWrapper final {
 
   const clickhouse_cpp::Block& GetNative() const;
 
+  /// Creates a block with the same columns and no rows
+  std::unique_ptr<BlockWrapper> CloneEmpty() const;
+
+  /// Appends the rows of a block with the same columns
+  void AppendRows(const BlockWrapper& other);
+
  private:
   clickhouse_cpp::Block native_;
 };
@@ -0,0 +1,119 @@
+#include "buffered_inserter_impl.hpp"
+
+#include <exception>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/clickhouse/stats/statement_timer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+BufferedInserterImpl::BufferedInserterImpl(
+    ClusterPtr cluster, const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const BufferedInserterSettings& settings)
+    : cluster_{std::move(cluster)},
+      table_name_{table_name},
+      column_names_{column_names},
+      settings_{settings} {
+  UINVARIANT(cluster_, "Cluster is required for buffered inserts");
+  flush_task_ = engine::CriticalAsyncNoSpan([this] { FlushLoop(); });
+}
+
+BufferedInserterImpl::~BufferedInserterImpl() {
+  {
+    const std::lock_guard lock{mutex_};
+    is_stopped_ = true;
+  }
+  flush_cv_.NotifyAll();
+  flush_task_.Get();
+}
+
+void BufferedInserterImpl::Append(const InsertionRequest& request) {
+  const auto& block = request.GetBlock();
+  const auto rows_count = block.GetRowsCount();
+  if (!rows_count) return;
+
+  std::unique_lock lock{mutex_};
+  const auto has_space = space_cv_.WaitFor(lock, settings_.max_wait, [&] {
+    const auto rows_total = buffered_rows_ + flushing_rows_;
+    return !rows_total ||
+           rows_total + rows_count <= settings_.max_buffered_rows;
+  });
+  if (!has_space) {
+    lock.unlock();
+    ++statistics_.overflows;
+    statistics_.dropped_rows += rows_count;
+    throw BufferedInserter::BufferOverflowError{
+        "Buffered inserts into '" + table_name_ + "' overflow the buffer"};
+  }
+
+  if (!buffer_) buffer_ = block.CloneEmpty();
+  buffer_->AppendRows(block);
+  buffered_rows_ += rows_count;
+  buffered_bytes_ += request.GetDataSize();
+  statistics_.inserted_rows += rows_count;
+
+  if (IsFlushRequired()) flush_cv_.NotifyOne();
+}
+
+void BufferedInserterImpl::Flush() {
+  std::unique_lock lock{mutex_};
+  FlushLocked(lock);
+}
+
+const stats::BufferedInserterStatistics& BufferedInserterImpl::GetStatistics()
+    const {
+  return statistics_;
+}
+
+void BufferedInserterImpl::FlushLoop() {
+  std::unique_lock lock{mutex_};
+  while (!is_stopped_ && !engine::current_task::ShouldCancel()) {
+    flush_cv_.WaitFor(lock, settings_.flush_interval,
+                      [this] { return is_stopped_ || IsFlushRequired(); });
+    // flushes by time, by limits and the remaining data on stop
+    FlushLocked(lock);
+  }
+}
+
+bool BufferedInserterImpl::IsFlushRequired() const {
+  return buffered_rows_ >= settings_.max_rows ||
+         buffered_bytes_ >= settings_.max_bytes;
+}
+
+void BufferedInserterImpl::FlushLocked(std::unique_lock<engine::Mutex>& lock) {
+  if (!buffer_) return;
+
+  auto block = std::move(buffer_);
+  const auto rows_count = buffered_rows_;
+  buffered_rows_ = 0;
+  buffered_bytes_ = 0;
+  flushing_rows_ += rows_count;
+  lock.unlock();
+
+  try {
+    const stats::StatementTimer timer{statistics_.flushes};
+    const InsertionRequest request{table_name_, column_names_,
+                                   std::move(block)};
+    cluster_->DoInsert(OptionalCommandControl{}, request);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to flush " << rows_count
+                << " buffered rows into '" << table_name_ << "': " << ex;
+    statistics_.dropped_rows += rows_count;
+  }
+
+  lock.lock();
+  flushing_rows_ -= rows_count;
+  space_cv_.NotifyAll();
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <storages/clickhouse/impl/block_wrapper.hpp>
+#include <storages/clickhouse/stats/buffered_inserter_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+class BufferedInserterImpl final {
+ public:
+  BufferedInserterImpl(ClusterPtr cluster, const std::string& table_name,
+                       const std::vector<std::string_view>& column_names,
+                       const BufferedInserterSettings& settings);
+  ~BufferedInserterImpl();
+
+  void Append(const InsertionRequest& request);
+
+  void Flush();
+
+  const stats::BufferedInserterStatistics& GetStatistics() const;
+
+ private:
+  void FlushLoop();
+
+  bool IsFlushRequired() const;
+
+  // Unlocks the mutex for the insertion
+  void FlushLocked(std::unique_lock<engine::Mutex>& lock);
+
+  const ClusterPtr cluster_;
+  const std::string& table_name_;
+  const std::vector<std::string_view>& column_names_;
+  const BufferedInserterSettings settings_;
+
+  engine::Mutex mutex_;
+  // notified when data should be flushed
+  engine::ConditionVariable flush_cv_;
+  // notified when buffer space is freed
+  engine::ConditionVariable space_cv_;
+  std::unique_ptr<BlockWrapper> buffer_;
+  std::size_t buffered_rows_{0};
+  std::size_t buffered_bytes_{0};
+  std::size_t flushing_rows_{0};
+  bool is_stopped_{false};
+
+  stats::BufferedInserterStatistics statistics_;
+
+  engine::TaskWithResult<void> flush_task_;
+};
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
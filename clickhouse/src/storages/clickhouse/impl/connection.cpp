@@ -7,6 +7,7 @@
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/query.hpp>
 #include <userver/tracing/span.hpp>
@@ -50,6 +51,12 @@ engine::Deadline GetDeadline(OptionalCommandControl optional_cc) {
   const auto duration =
       optional_cc.has_value() ? optional_cc->execute : kDefaultExecuteTimeout;
 
+  // A query should not outlive the request it was started for
+  const auto inherited_deadline = server::request::GetTaskInheritedDeadline();
+  if (inherited_deadline.IsReachable() &&
+      inherited_deadline.TimeLeft() < duration) {
+    return inherited_deadline;
+  }
   return engine::Deadline::FromDuration(duration);
 }
 
@@ -104,6 +111,36 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreamed(OptionalCommandControl optional_cc,
+                                 const Query& query,
+                                 const ExecutionResultCallback& on_block) {
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  std::exception_ptr callback_exception;
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([&](const NativeBlock& data) {
+    scope.Reset(scopes::kExec);
+    if (callback_exception) return false;
+    // header and trailing blocks carry no rows
+    if (data.GetRowCount() == 0) return !engine::current_task::ShouldCancel();
+
+    try {
+      auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+      on_block(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+    } catch (const std::exception&) {
+      // cancel the query, the connection stays usable
+      callback_exception = std::current_exception();
+      return false;
+    }
+    return !engine::current_task::ShouldCancel();
+  });
+
+  DoExecute(optional_cc, native_query);
+
+  if (callback_exception) std::rethrow_exception(callback_exception);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
@@ -28,6 +28,9 @@ class Connection final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+  void ExecuteStreamed(OptionalCommandControl, const Query&,
+                       const ExecutionResultCallback& on_block);
+
   void Insert(OptionalCommandControl, const InsertionRequest&);
 
   void Ping();
@@ -16,6 +16,16 @@ InsertionRequest::InsertionRequest(
       block_{std::make_unique<impl::BlockWrapper>(
           impl::clickhouse_cpp::Block{column_names_.size(), 0})} {}
 
+InsertionRequest::InsertionRequest(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    std::unique_ptr<impl::BlockWrapper>&& block)
+    : table_name_{table_name},
+      column_names_{column_names},
+      block_{std::move(block)} {
+  UASSERT(block_);
+}
+
 InsertionRequest::InsertionRequest(InsertionRequest&&) noexcept = default;
 
 InsertionRequest::~InsertionRequest() = default;
@@ -26,6 +36,8 @@ const std::string& InsertionRequest::GetTableName() const {
 
 const impl::BlockWrapper& InsertionRequest::GetBlock() const { return *block_; }
 
+std::size_t InsertionRequest::GetDataSize() const { return data_size_; }
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
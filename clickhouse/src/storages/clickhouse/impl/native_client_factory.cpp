@@ -190,6 +190,8 @@ clickhouse_cpp::CompressionMethod GetCompressionMethod(
       return clickhouse_cpp::CompressionMethod::None;
     case CompressionMethod::kLZ4:
       return clickhouse_cpp::CompressionMethod::LZ4;
+    case CompressionMethod::kZSTD:
+      return clickhouse_cpp::CompressionMethod::ZSTD;
   }
   UINVARIANT(false, "Invalid value of CompressionMethod enum");
 }
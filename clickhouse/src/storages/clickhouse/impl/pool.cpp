@@ -2,6 +2,8 @@
 
 #include <userver/storages/clickhouse/query.hpp>
 
+#include <userver/engine/io/exception.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 
@@ -25,6 +27,14 @@ tracing::Span PrepareExecutionSpan(const std::string& scope,
   return span;
 }
 
+void CheckDeadlineIsExpired(stats::PoolQueryStatistics& stats) {
+  if (server::request::GetTaskInheritedDeadline().IsReached()) {
+    ++stats.deadline_cancelled;
+    // same as for a query that hits its deadline while running
+    throw engine::io::IoTimeout{};
+  }
+}
+
 }  // namespace
 
 Pool::Pool(clients::dns::Resolver& resolver, PoolSettings&& settings)
@@ -36,6 +46,7 @@ Pool::~Pool() = default;
 
 ExecutionResult Pool::Execute(OptionalCommandControl optional_cc,
                               const Query& query) const {
+  CheckDeadlineIsExpired(impl_->GetStatistics().queries);
   auto conn_ptr = impl_->Acquire();
 
   auto span = PrepareExecutionSpan(impl::scopes::kQuery, impl_->GetHostName());
@@ -45,8 +56,22 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc,
   return conn_ptr->Execute(optional_cc, query);
 }
 
+void Pool::ExecuteStreamed(OptionalCommandControl optional_cc,
+                           const Query& query,
+                           const ExecutionResultCallback& on_block) const {
+  CheckDeadlineIsExpired(impl_->GetStatistics().queries);
+  auto conn_ptr = impl_->Acquire();
+
+  auto span = PrepareExecutionSpan(impl::scopes::kQuery, impl_->GetHostName());
+  query.FillSpanTags(span);
+
+  const auto timer = impl_->GetExecuteTimer();
+  conn_ptr->ExecuteStreamed(optional_cc, query, on_block);
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc,
                   const InsertionRequest& request) const {
+  CheckDeadlineIsExpired(impl_->GetStatistics().inserts);
   auto conn_ptr = impl_->Acquire();
 
   auto span = PrepareExecutionSpan(impl::scopes::kInsert, impl_->GetHostName());
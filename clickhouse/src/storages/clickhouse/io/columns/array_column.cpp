@@ -0,0 +1,47 @@
+#include <userver/storages/clickhouse/io/columns/array_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/array.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnArray;
+
+NativeType& AsArray(const ColumnRef& column) {
+  UASSERT(column->As<NativeType>() != nullptr);
+  return static_cast<NativeType&>(*column);
+}
+
+}  // namespace
+
+ColumnRef GetArrayColumn(const ColumnRef& column) {
+  auto array = column->As<NativeType>();
+  if (!array) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Array",
+                    column->Type()->GetName())};
+  }
+  return array;
+}
+
+ColumnRef GetArrayValuesAt(const ColumnRef& array, size_t ind) {
+  return AsArray(array).GetAsColumn(ind);
+}
+
+ColumnRef MakeArrayColumn(ColumnRef&& nested) {
+  return std::make_shared<NativeType>(std::move(nested));
+}
+
+void AppendArray(const ColumnRef& array, ColumnRef&& values) {
+  AsArray(array).AppendAsColumn(values);
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,42 @@
+#include <userver/storages/clickhouse/io/columns/decimal_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/decimal.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnDecimal;
+}
+
+ColumnRef GetDecimalColumn(const ColumnRef& column, int scale) {
+  auto decimal = column->As<NativeType>();
+  if (!decimal || decimal->GetScale() != static_cast<size_t>(scale)) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Decimal(P, {})",
+                    column->Type()->GetName(), scale)};
+  }
+  return decimal;
+}
+
+std::int64_t GetDecimalUnbiasedAt(const ColumnRef& column, size_t ind) {
+  return static_cast<std::int64_t>(impl::NativeGetAt<NativeType>(column, ind));
+}
+
+ColumnRef MakeDecimalColumn(const std::vector<std::int64_t>& unbiased,
+                            int precision, int scale) {
+  auto column = std::make_shared<NativeType>(precision, scale);
+  for (const auto value : unbiased) {
+    column->Append(clickhouse::impl::clickhouse_cpp::Int128{value});
+  }
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
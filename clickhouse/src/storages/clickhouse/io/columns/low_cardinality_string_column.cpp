@@ -0,0 +1,41 @@
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/lowcardinality.h>
+#include <clickhouse/columns/string.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+namespace native = clickhouse::impl::clickhouse_cpp;
+using NativeType = native::ColumnLowCardinality;
+using NativeStringType = native::ColumnLowCardinalityT<native::ColumnString>;
+}  // namespace
+
+LowCardinalityStringColumn::LowCardinalityStringColumn(ColumnRef column)
+    : ClickhouseColumn{
+          impl::GetTypedColumn<LowCardinalityStringColumn, NativeType>(
+              column)} {}
+
+template <>
+LowCardinalityStringColumn::cpp_type
+ColumnIterator<LowCardinalityStringColumn>::DataHolder::Get() const {
+  UASSERT(column_->As<NativeType>() != nullptr);
+  const auto item = static_cast<const NativeType&>(*column_).GetItem(ind_);
+  return std::string{item.get<std::string_view>()};
+}
+
+ColumnRef LowCardinalityStringColumn::Serialize(const container_type& from) {
+  auto column = std::make_shared<NativeStringType>();
+  for (const auto& value : from) {
+    column->Append(std::string_view{value});
+  }
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
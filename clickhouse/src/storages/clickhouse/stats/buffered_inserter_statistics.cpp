@@ -0,0 +1,19 @@
+#include "buffered_inserter_statistics.hpp"
+
+#include <userver/utils/statistics/percentile_format_json.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::stats {
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const BufferedInserterStatistics& stats) {
+  writer["inserted_rows"] = stats.inserted_rows;
+  writer["dropped_rows"] = stats.dropped_rows;
+  writer["overflows"] = stats.overflows;
+  writer["flushes"] = stats.flushes;
+}
+
+}  // namespace storages::clickhouse::stats
+
+USERVER_NAMESPACE_END
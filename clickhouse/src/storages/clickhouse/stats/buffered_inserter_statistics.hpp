@@ -0,0 +1,22 @@
+#pragma once
+
+#include <storages/clickhouse/stats/pool_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::stats {
+
+struct BufferedInserterStatistics final {
+  Counter inserted_rows{};
+  Counter dropped_rows{};
+  Counter overflows{};
+
+  PoolQueryStatistics flushes{};
+};
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const BufferedInserterStatistics& stats);
+
+}  // namespace storages::clickhouse::stats
+
+USERVER_NAMESPACE_END
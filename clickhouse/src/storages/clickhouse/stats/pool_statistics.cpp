@@ -19,6 +19,7 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolQueryStatistics& stats) {
   writer["total"] = stats.total;
   writer["error"] = stats.error;
+  writer["deadline_cancelled"] = stats.deadline_cancelled;
   writer["timings"] = stats.timings;
 }
 
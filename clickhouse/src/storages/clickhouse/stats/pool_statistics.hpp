@@ -27,6 +27,7 @@ struct PoolConnectionStatistics final {
 struct PoolQueryStatistics final {
   Counter total{};
   Counter error{};
+  Counter deadline_cancelled{};
   RecentPeriod timings{};
 };
 
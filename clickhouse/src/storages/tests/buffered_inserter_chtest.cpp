@@ -0,0 +1,162 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Data final {
+  std::vector<uint64_t> ids;
+  std::vector<std::string> values;
+};
+
+struct DataRow final {
+  uint64_t id;
+  std::string value;
+};
+
+struct Count final {
+  std::vector<uint64_t> count;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<Data> final {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<DataRow> final {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<Count> final {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+namespace ch = storages::clickhouse;
+
+ch::ClusterPtr MakeClusterPtr(ClusterWrapper& cluster) {
+  return ch::ClusterPtr{ch::ClusterPtr{}, &*cluster};
+}
+
+uint64_t CountRows(ClusterWrapper& cluster) {
+  return cluster->Execute("SELECT count() FROM buffered_table")
+      .As<Count>()
+      .count.at(0);
+}
+
+// not a temporary table, as flushes may use other connections
+void CreateTable(ClusterWrapper& cluster) {
+  cluster->Execute(
+      "CREATE TABLE IF NOT EXISTS buffered_table "
+      "(id UInt64, value String) ENGINE = Memory");
+  cluster->Execute("TRUNCATE TABLE buffered_table");
+}
+
+}  // namespace
+
+UTEST(BufferedInserter, FlushesByRows) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster);
+
+  ch::BufferedInserterSettings settings;
+  settings.max_rows = 3;
+  settings.flush_interval = std::chrono::hours{1};
+  ch::BufferedInserter inserter{MakeClusterPtr(cluster), "buffered_table",
+                                {"id", "value"}, settings};
+
+  inserter.InsertRows(std::vector<DataRow>{{1, "first"}, {2, "second"}});
+  EXPECT_EQ(CountRows(cluster), 0);
+
+  inserter.Insert(Data{{3, 4}, {"third", "fourth"}});
+  for (int i = 0; i < 100 && CountRows(cluster) != 4; ++i) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(CountRows(cluster), 4);
+}
+
+UTEST(BufferedInserter, FlushesExplicitly) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster);
+
+  ch::BufferedInserterSettings settings;
+  settings.flush_interval = std::chrono::hours{1};
+  ch::BufferedInserter inserter{MakeClusterPtr(cluster), "buffered_table",
+                                {"id", "value"}, settings};
+
+  inserter.Insert(Data{{1, 2}, {"first", "second"}});
+  inserter.InsertRows(std::vector<DataRow>{{3, "third"}});
+  EXPECT_EQ(CountRows(cluster), 0);
+
+  inserter.Flush();
+  EXPECT_EQ(CountRows(cluster), 3);
+}
+
+UTEST(BufferedInserter, FlushesOnDestruction) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster);
+
+  {
+    ch::BufferedInserter inserter{MakeClusterPtr(cluster),
+                                  "buffered_table", {"id", "value"}, {}};
+    inserter.InsertRows(std::vector<DataRow>{{1, "first"}});
+  }
+  EXPECT_EQ(CountRows(cluster), 1);
+}
+
+UTEST(BufferedInserter, Overflow) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster);
+
+  ch::BufferedInserterSettings settings;
+  settings.flush_interval = std::chrono::hours{1};
+  settings.max_buffered_rows = 2;
+  settings.max_wait = std::chrono::milliseconds{10};
+  ch::BufferedInserter inserter{MakeClusterPtr(cluster), "buffered_table",
+                                {"id", "value"}, settings};
+
+  inserter.InsertRows(std::vector<DataRow>{{1, "first"}, {2, "second"}});
+  UEXPECT_THROW(inserter.InsertRows(std::vector<DataRow>{{3, "third"}}),
+                ch::BufferedInserter::BufferOverflowError);
+
+  inserter.Flush();
+  EXPECT_EQ(CountRows(cluster), 2);
+  UEXPECT_NO_THROW(inserter.InsertRows(std::vector<DataRow>{{3, "third"}}));
+}
+
+UTEST(BufferedInserter, FailedFlushDropsRows) {
+  ClusterWrapper cluster{};
+
+  ch::BufferedInserterSettings settings;
+  settings.flush_interval = std::chrono::hours{1};
+  ch::BufferedInserter inserter{MakeClusterPtr(cluster), "tmp_missing_table",
+                                {"id", "value"}, settings};
+
+  inserter.InsertRows(std::vector<DataRow>{{1, "first"}, {2, "second"}});
+  UEXPECT_NO_THROW(inserter.Flush());
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "inserter", [&inserter](utils::statistics::Writer& writer) {
+        inserter.WriteStatistics(writer);
+      });
+  const utils::statistics::Snapshot snapshot{storage, "inserter"};
+  EXPECT_EQ(snapshot.SingleMetric("inserted_rows").AsInt(), 2);
+  EXPECT_EQ(snapshot.SingleMetric("dropped_rows").AsInt(), 2);
+  EXPECT_EQ(snapshot.SingleMetric("flushes.error").AsInt(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4>;
+using Ratio = decimal64::Decimal<2>;
+
+struct DataWithDecimals final {
+  std::vector<Money> money;
+  std::vector<Ratio> ratios;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithDecimals> {
+  using mapped_type =
+      std::tuple<columns::Decimal64Column<4>, columns::Decimal32Column<2>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Decimal, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(money Decimal64(4), ratio Decimal32(2))");
+
+  const DataWithDecimals insert_data{
+      {Money{"123456789.1234"}, Money{"-0.0001"}, Money{0}},
+      {Ratio{"1.5"}, Ratio{"-99.99"}, Ratio{"0.01"}}};
+  cluster->Insert("tmp_table", {"money", "ratio"}, insert_data);
+
+  const auto select_data =
+      cluster->Execute("SELECT money, ratio FROM tmp_table")
+          .As<DataWithDecimals>();
+  EXPECT_EQ(select_data.money, insert_data.money);
+  EXPECT_EQ(select_data.ratios, insert_data.ratios);
+}
+
+UTEST(Decimal, ScaleMismatch) {
+  ClusterWrapper cluster{};
+  EXPECT_THROW(
+      cluster->Execute("SELECT toDecimal64(1, 3), toDecimal32(1, 2)")
+          .As<DataWithDecimals>(),
+      std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
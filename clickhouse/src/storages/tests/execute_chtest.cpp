@@ -121,4 +121,44 @@ UTEST(Execute, IterationMovesFromUnderlying) {
   }
 }
 
+UTEST(Execute, Streamed) {
+  ClusterWrapper cluster{};
+  const storages::clickhouse::Query q{
+      "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+      "FROM numbers(0, 10000) c SETTINGS max_block_size = 1000"};
+
+  /// [Sample ExecuteStreamed usage]
+  std::size_t blocks = 0;
+  std::uint64_t sum = 0;
+  cluster->ExecuteStreamed(q, [&](storages::clickhouse::ExecutionResult&& res) {
+    ++blocks;
+    for (const auto& row : std::move(res).AsRows<RowData>()) {
+      sum += row.number;
+    }
+  });
+  /// [Sample ExecuteStreamed usage]
+
+  EXPECT_GT(blocks, 1);
+  EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+}
+
+UTEST(Execute, StreamedCallbackThrows) {
+  ClusterWrapper cluster{};
+  const storages::clickhouse::Query q{
+      "SELECT c.number FROM system.numbers c SETTINGS max_block_size = 100"};
+
+  std::size_t blocks = 0;
+  UEXPECT_THROW(cluster->ExecuteStreamed(
+                    q,
+                    [&blocks](storages::clickhouse::ExecutionResult&&) {
+                      if (++blocks == 3) throw std::runtime_error{"stop"};
+                    }),
+                std::runtime_error);
+  EXPECT_EQ(blocks, 3);
+
+  // the connection is still usable
+  const auto res = cluster->Execute(common_query).As<Data>();
+  EXPECT_EQ(res.numbers.size(), 10000);
+}
+
 USERVER_NAMESPACE_END
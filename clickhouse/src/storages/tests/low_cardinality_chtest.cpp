@@ -0,0 +1,67 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithLowCardinality final {
+  std::vector<std::string> values;
+};
+
+struct RowWithLowCardinality final {
+  std::string value;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithLowCardinality> {
+  using mapped_type = std::tuple<columns::LowCardinalityStringColumn>;
+};
+
+template <>
+struct CppToClickhouse<RowWithLowCardinality> {
+  using mapped_type = std::tuple<columns::LowCardinalityStringColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(LowCardinality, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value LowCardinality(String))");
+
+  const DataWithLowCardinality insert_data{{"msk", "spb", "msk", "", "msk"}};
+  cluster->Insert("tmp_table", {"value"}, insert_data);
+
+  const auto select_data = cluster->Execute("SELECT value FROM tmp_table")
+                               .As<DataWithLowCardinality>();
+  EXPECT_EQ(select_data.values, insert_data.values);
+}
+
+UTEST(LowCardinality, IterationWorks) {
+  ClusterWrapper cluster{};
+  auto res = cluster
+                 ->Execute(
+                     "SELECT toLowCardinality(toString(c.number % 3)) FROM "
+                     "system.numbers c LIMIT 10")
+                 .AsRows<RowWithLowCardinality>();
+  size_t ind = 0;
+  for (auto it = res.begin(); it != res.end(); ++it, ++ind) {
+    EXPECT_EQ(it->value, std::to_string(ind % 3));
+  }
+  EXPECT_EQ(ind, 10);
+}
+
+USERVER_NAMESPACE_END
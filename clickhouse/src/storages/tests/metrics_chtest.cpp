@@ -1,3 +1,4 @@
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/labels.hpp>
 #include <userver/utils/statistics/testing.hpp>
@@ -59,6 +60,18 @@ UTEST(Metrics, Basic) {
   EXPECT_EQ(insert_stats.SingleMetric("error").AsInt(), 1);
 }
 
+UTEST(Metrics, DeadlineCancelled) {
+  ClusterWrapper cluster{};
+
+  server::request::kTaskInheritedData.Set(server::request::TaskInheritedData{
+      {}, "dummy-method", {}, engine::Deadline::Passed()});
+  EXPECT_ANY_THROW(cluster->Execute("SELECT 1"));
+
+  const auto queries_stats = cluster.GetStatistics("clickhouse.queries");
+  EXPECT_EQ(queries_stats.SingleMetric("deadline_cancelled").AsInt(), 1);
+  EXPECT_EQ(queries_stats.SingleMetric("total").AsInt(), 0);
+}
+
 UTEST(Metrics, ActiveConnections) {
   PoolWrapper pool{};
 
@@ -144,6 +144,25 @@ UTEST(Insert, AsRowsWorks) {
   EXPECT_EQ(result[1], data[1]);
 }
 
+UTEST(Insert, AsRowsInBlocksWorks) {
+  ClusterWrapper cluster{false, {{"localhost", GetClickhousePort()}}, 2};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table (id UInt64, value "
+      "String, count UInt64, tp DateTime64(9))");
+
+  const auto now = std::chrono::system_clock::now();
+  std::vector<SomeDataRow> data;
+  for (std::uint64_t i = 0; i < 5; ++i) {
+    data.push_back({i, std::to_string(i), i * 2, now});
+  }
+  cluster->InsertRows("tmp_table", {"id", "value", "count", "tp"}, data);
+
+  const auto result =
+      cluster->Execute("SELECT id, value, count, tp FROM tmp_table ORDER BY id")
+          .AsContainer<std::vector<SomeDataRow>>();
+  EXPECT_EQ(result, data);
+}
+
 UTEST(Query, AvoidUnexpectedCancellation) {
   ClusterWrapper cluster{};
   cluster->Execute(
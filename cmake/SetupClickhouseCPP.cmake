@@ -15,7 +15,7 @@ endif()
 include(DownloadUsingCPM)
 CPMAddPackage(
     NAME clickhouse-cpp
-    VERSION 2.4.0
+    VERSION 2.5.1
     GITHUB_REPOSITORY ClickHouse/clickhouse-cpp
 )
 
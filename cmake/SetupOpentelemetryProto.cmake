@@ -0,0 +1,20 @@
+set(USERVER_OPENTELEMETRY_PROTO "" CACHE PATH "Path to the folder with opentelemetry proto files")
+
+if (USERVER_OPENTELEMETRY_PROTO)
+  set(opentelemetry-proto_SOURCE_DIR ${USERVER_OPENTELEMETRY_PROTO})
+endif()
+
+if (NOT EXISTS ${opentelemetry-proto_SOURCE_DIR})
+  include(DownloadUsingCPM)
+  CPMAddPackage(
+      NAME opentelemetry-proto
+      VERSION 1.0.0
+      GITHUB_REPOSITORY open-telemetry/opentelemetry-proto
+      GIT_TAG v1.0.0
+      DOWNLOAD_ONLY YES
+  )
+endif()
+
+if (NOT opentelemetry-proto_SOURCE_DIR)
+  message(FATAL_ERROR "Unable to get opentelemetry proto files. They are required for userver-otlp build.")
+endif()
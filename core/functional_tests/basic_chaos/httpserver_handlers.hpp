@@ -5,6 +5,7 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/handlers/json_error_builder.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response_body_stream.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/utest/using_namespace_userver.hpp>
@@ -51,4 +52,21 @@ class HttpServerHandler final : public server::handlers::HttpHandlerBase {
   }
 };
 
+class RequestStreamHandler final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-chaos-request-stream";
+
+  RequestStreamHandler(const components::ComponentConfig& config,
+                       const components::ComponentContext& context)
+      : HttpHandlerBase(config, context) {}
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest& request,
+      server::request::RequestContext&) const override {
+    // The body is left unread for type=skip
+    if (request.GetArg("type") == "skip") return "skipped";
+    return std::to_string(request.GetBodyStream().ReadAll().size());
+  }
+};
+
 }  // namespace chaos
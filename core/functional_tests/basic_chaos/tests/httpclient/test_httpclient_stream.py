@@ -28,6 +28,22 @@ async def test_ok(call, gate, mockserver):
     assert mock.times_called == 1
 
 
+@pytest.mark.config(USERVER_HANDLER_STREAM_API_ENABLED=True)
+async def test_streamed_constant_headers(call, gate, mockserver):
+    body = 'x' * MULTIPLE_CHUNKS_BODY_SIZE
+
+    @mockserver.handler('/test')
+    async def mock(request):
+        return mockserver.make_response(body)
+
+    response = await call()
+    assert response.status == 200
+    assert response.text == body
+    # The constant headers are attached before the streamed headers end
+    assert 'X-YaTaxi-Server-Hostname' in response.headers
+    assert mock.times_called == 1
+
+
 async def test_0_timeout(call, gate, mockserver):
     response = await call(timeout=0)
     assert response.status == 500
@@ -0,0 +1,32 @@
+# Bigger than the body chunks the connection buffers for the handler
+BODY_SIZE = 512 * 1024
+
+
+async def test_body_read(service_client):
+    response = await service_client.post(
+        '/chaos/httpserver/request-stream',
+        params={'type': 'read'},
+        data='x' * BODY_SIZE,
+    )
+    assert response.status == 200
+    assert response.text == str(BODY_SIZE)
+
+
+async def test_body_not_read(service_client):
+    for _ in range(3):
+        response = await service_client.post(
+            '/chaos/httpserver/request-stream',
+            params={'type': 'skip'},
+            data='x' * BODY_SIZE,
+        )
+        assert response.status == 200
+        assert response.text == 'skipped'
+
+    # The unread bodies were discarded, the connections are still usable
+    response = await service_client.post(
+        '/chaos/httpserver/request-stream',
+        params={'type': 'read'},
+        data='y' * BODY_SIZE,
+    )
+    assert response.status == 200
+    assert response.text == str(BODY_SIZE)
@@ -4,6 +4,7 @@
 /// @brief @copybrief baggage::Baggage
 
 #include <algorithm>  // TODO: remove
+#include <atomic>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -85,12 +86,16 @@ class BaggageEntry {
 /// For more details on header check the official site
 /// https://w3c.github.io/baggage/
 ///
+/// The header is parsed on the first access to the entries, an unmodified
+/// valid header is propagated as is.
+///
 /// @see baggage::BaggageManagerComponent
 class Baggage {
  public:
   Baggage(std::string header, std::unordered_set<std::string> allowed_keys);
   Baggage(const Baggage&) noexcept;
   Baggage(Baggage&&) noexcept;
+  ~Baggage();
 
   std::string ToString() const;
 
@@ -122,27 +127,28 @@ class Baggage {
   /// @returns std::nullopt If key, value or properties
   /// don't match with requirements or if allowed_keys
   /// don't contain selected key
-  std::optional<BaggageEntry> TryMakeBaggageEntry(std::string_view entry);
+  std::optional<BaggageEntry> TryMakeBaggageEntry(
+      std::string_view entry) const;
   static std::optional<BaggageEntryProperty> TryMakeBaggageEntryProperty(
       std::string_view property);
 
  private:
-  /// @brief Parse baggage_header and fill entries_
-  void FillEntries();
+  struct ParsedHeader;
+
+  std::optional<BaggageEntry> TryMakeBaggageEntry(
+      std::string_view entry, bool& is_valid_header) const;
 
-  /// @brief Create result_header
-  void CreateResultHeader();
+  /// @brief Parse header_value_ on the first call
+  const ParsedHeader& GetParsedHeader() const;
+
+  /// @brief Discard the parsed header_value_
+  void ResetParsedHeader() noexcept;
 
   std::string header_value_;
   std::unordered_set<std::string> allowed_keys_;
-  std::vector<BaggageEntry> entries_;
-
-  // result header after parsing entities.
-  // empty string if is_valid_header == true
-  std::string result_header_;
 
-  // true if requested header == header for sending
-  bool is_valid_header_ = true;
+  // entries and the header for sending, views into header_value_
+  mutable std::atomic<ParsedHeader*> parsed_header_{nullptr};
 };
 
 /// @brief Parsing function
@@ -3,14 +3,18 @@
 /// @file userver/cache/caching_component_base.hpp
 /// @brief @copybrief components::CachingComponentBase
 
+#include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
 
 #include <userver/cache/cache_update_trait.hpp>
 #include <userver/cache/exceptions.hpp>
+#include <userver/cache/negative_lookup_filter.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/loggable_component_base.hpp>
@@ -69,6 +73,8 @@ namespace components {
 /// testsuite-force-periodic-update | override testsuite-periodic-update-enabled in TestsuiteSupport component config | --
 /// failed-updates-before-expiration | the number of consecutive failed updates for data expiration | --
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
+/// invalidation-channel | name of the cache::InvalidationChannel component, an event from it triggers an update of the cache out of the schedule | --
+/// negative-lookup-filter | maintain GetNegativeLookupFilter() for a map cache | false
 ///
 /// ### Update types
 ///  * `full-and-incremental`: both `update-interval` and `full-update-interval`
@@ -97,6 +103,33 @@ namespace components {
 
 // clang-format on
 
+namespace impl {
+
+bool IsNegativeLookupFilterEnabled(const ComponentConfig& config);
+
+template <typename T>
+using MapHasher = typename T::hasher;
+
+template <typename T, typename = void>
+struct NegativeLookupFilterOf {
+  using type = void;
+};
+
+// The filter uses the hash function of the map or std::hash
+template <typename T>
+struct NegativeLookupFilterOf<
+    T, std::enable_if_t<meta::kIsMap<T> &&
+                        std::is_invocable_v<
+                            const meta::DetectedOr<
+                                std::hash<meta::MapKeyType<T>>, MapHasher, T>&,
+                            const meta::MapKeyType<T>&>>> {
+  using type = cache::NegativeLookupFilter<
+      meta::MapKeyType<T>,
+      meta::DetectedOr<std::hash<meta::MapKeyType<T>>, MapHasher, T>>;
+};
+
+}  // namespace impl
+
 template <typename T>
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class CachingComponentBase : public LoggableComponentBase,
@@ -126,6 +159,19 @@ class CachingComponentBase : public LoggableComponentBase,
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&>&
   GetEventChannel();
 
+  /// cache::NegativeLookupFilter of the keys of a map cache
+  using NegativeLookupFilter = typename impl::NegativeLookupFilterOf<T>::type;
+
+  /// @brief Filter of the keys of the cache, rebuilt on each update.
+  ///
+  /// Lets a cache::LruCacheComponent of the values skip the data source
+  /// lookups of the keys that are definitely absent, while this cache keeps
+  /// just the keys.
+  ///
+  /// @returns nullptr unless the `negative-lookup-filter` static option is
+  /// true and the cache is a map with hashable keys
+  std::shared_ptr<NegativeLookupFilter> GetNegativeLookupFilter() const;
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  protected:
@@ -165,6 +211,12 @@ class CachingComponentBase : public LoggableComponentBase,
   virtual void PreAssignCheck(const T* old_value_ptr,
                               const T* new_value_ptr) const;
 
+  void UpdateNegativeLookupFilter(const T* new_value_ptr);
+
+  static constexpr bool kHasNegativeLookupFilter =
+      !std::is_void_v<NegativeLookupFilter>;
+
+  std::shared_ptr<NegativeLookupFilter> negative_lookup_filter_;
   rcu::Variable<std::shared_ptr<const T>> cache_;
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&> event_channel_;
   utils::impl::WaitTokenStorage wait_token_storage_;
@@ -181,6 +233,17 @@ CachingComponentBase<T>::CachingComponentBase(const ComponentConfig& config,
                        if (ptr) function(ptr);
                      }) {
   const auto initial_config = GetConfig();
+
+  if (impl::IsNegativeLookupFilterEnabled(config)) {
+    if constexpr (kHasNegativeLookupFilter) {
+      negative_lookup_filter_ = std::make_shared<NegativeLookupFilter>();
+    } else {
+      throw std::logic_error(fmt::format(
+          "Cache {} can't have a negative-lookup-filter: {} is not a map with "
+          "hashable keys",
+          Name(), compiler::GetTypeName<T>()));
+    }
+  }
 }
 
 template <typename T>
@@ -218,6 +281,12 @@ CachingComponentBase<T>::GetEventChannel() {
   return event_channel_;
 }
 
+template <typename T>
+std::shared_ptr<typename CachingComponentBase<T>::NegativeLookupFilter>
+CachingComponentBase<T>::GetNegativeLookupFilter() const {
+  return negative_lookup_filter_;
+}
+
 template <typename T>
 utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
   return utils::SharedReadablePtr<T>(cache_.ReadCopy());
@@ -247,6 +316,9 @@ void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
     PreAssignCheck(old_value->get(), new_value.get());
   }
 
+  // before the data, so that the new keys are never rejected
+  UpdateNegativeLookupFilter(new_value.get());
+
   cache_.Assign(new_value);
   event_channel_.SendEvent(new_value);
   OnCacheModified();
@@ -265,7 +337,27 @@ void CachingComponentBase<T>::Emplace(Args&&... args) {
 
 template <typename T>
 void CachingComponentBase<T>::Clear() {
-  cache_.Assign(std::make_unique<const T>());
+  auto empty = std::make_unique<const T>();
+  UpdateNegativeLookupFilter(empty.get());
+  cache_.Assign(std::move(empty));
+}
+
+template <typename T>
+void CachingComponentBase<T>::UpdateNegativeLookupFilter(
+    [[maybe_unused]] const T* new_value_ptr) {
+  if constexpr (kHasNegativeLookupFilter) {
+    if (!negative_lookup_filter_) return;
+
+    if (new_value_ptr) {
+      // Set() gets the whole new contents on incremental updates as well, so
+      // the filter forgets the removed keys
+      negative_lookup_filter_->Rebuild(
+          *new_value_ptr,
+          [](const auto& item) -> const auto& { return item.first; });
+    } else {
+      negative_lookup_filter_->Reset();
+    }
+  }
 }
 
 template <typename T>
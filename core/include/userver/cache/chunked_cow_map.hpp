@@ -0,0 +1,273 @@
+#pragma once
+
+/// @file userver/cache/chunked_cow_map.hpp
+/// @brief @copybrief cache::ChunkedCowMap
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map with cheap copies, designed for caches with incremental
+/// updates
+///
+/// Entries are split between chunks by the hash of the key. Copies of the map
+/// share the chunks, and a chunk is copied only when it is modified through
+/// one of the copies. So the usual incremental update of the cache
+///
+/// @snippet core/src/cache/chunked_cow_map_test.cpp  Incremental update
+///
+/// costs a pointer per chunk for the copy plus a chunk per modified entry,
+/// instead of a copy of the whole cache contents.
+///
+/// The number of chunks grows with the map to keep chunks small, every entry
+/// is rehashed when it does.
+///
+/// Only const iteration is provided, entries are modified by key. Any
+/// modification of the map invalidates its iterators.
+///
+/// @warning Like with any other container, a single instance should not be
+/// modified concurrently. Modifying a copy while the other copies are read
+/// is fine.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class ChunkedCowMap final {
+  using Chunk = std::unordered_map<Key, Value, Hash, Equal>;
+  using ChunkPtr = std::shared_ptr<Chunk>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = typename Chunk::value_type;
+  using size_type = std::size_t;
+
+  class const_iterator;
+  using iterator = const_iterator;
+
+  ChunkedCowMap() { Reset(); }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const_iterator begin() const { return const_iterator{chunks_, 0}; }
+  const_iterator end() const { return const_iterator{chunks_}; }
+
+  const_iterator find(const Key& key) const {
+    const auto index = GetChunkIndex(key);
+    const auto& chunk = *chunks_[index];
+    const auto it = chunk.find(key);
+    if (it == chunk.end()) return end();
+    return const_iterator{chunks_, index, it};
+  }
+
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  /// @throws std::out_of_range if there's no such key
+  const Value& at(const Key& key) const {
+    const auto it = find(key);
+    if (it == end()) throw std::out_of_range{"ChunkedCowMap::at"};
+    return it->second;
+  }
+
+  /// Copies the chunk of the key if it is shared with other copies
+  Value& operator[](const Key& key) {
+    ReserveForInsert();
+    auto& chunk = GetMutableChunk(key);
+    const auto [it, inserted] = chunk.try_emplace(key);
+    if (inserted) ++size_;
+    return it->second;
+  }
+
+  template <typename... Args>
+  std::pair<const_iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    if (const auto it = find(key); it != end()) return {it, false};
+
+    ReserveForInsert();
+    const auto index = GetChunkIndex(key);
+    auto& chunk = GetMutableChunk(index);
+    const auto it = chunk.try_emplace(key, std::forward<Args>(args)...).first;
+    ++size_;
+    return {const_iterator{chunks_, index, it}, true};
+  }
+
+  std::pair<const_iterator, bool> insert(value_type&& value) {
+    return try_emplace(value.first, std::move(value.second));
+  }
+
+  std::pair<const_iterator, bool> insert(const value_type& value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  template <typename V>
+  std::pair<const_iterator, bool> insert_or_assign(const Key& key, V&& value) {
+    ReserveForInsert();
+    const auto index = GetChunkIndex(key);
+    auto& chunk = GetMutableChunk(index);
+    const auto [it, inserted] =
+        chunk.insert_or_assign(key, std::forward<V>(value));
+    if (inserted) ++size_;
+    return {const_iterator{chunks_, index, it}, inserted};
+  }
+
+  /// Doesn't copy the chunk if there's no such key
+  size_type erase(const Key& key) {
+    if (!contains(key)) return 0;
+
+    GetMutableChunk(key).erase(key);
+    --size_;
+    return 1;
+  }
+
+  void clear() { Reset(); }
+
+  void reserve(size_type count) {
+    while (count > chunks_.size() * kMaxAverageChunkSize) Grow();
+  }
+
+ private:
+  static constexpr std::size_t kMinChunkBits = 4;
+  static constexpr std::size_t kMaxAverageChunkSize = 128;
+
+  void Reset() {
+    chunk_bits_ = kMinChunkBits;
+    chunks_ = MakeChunks(std::size_t{1} << chunk_bits_);
+    size_ = 0;
+  }
+
+  static std::vector<ChunkPtr> MakeChunks(std::size_t count) {
+    std::vector<ChunkPtr> chunks;
+    chunks.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      chunks.push_back(std::make_shared<Chunk>());
+    }
+    return chunks;
+  }
+
+  std::size_t GetChunkIndex(const Key& key) const {
+    // Fibonacci hashing, so that chunks and buckets inside of them
+    // don't depend on the same bits of the hash
+    const auto hash = static_cast<std::uint64_t>(Hash{}(key));
+    return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >>
+                                    (64 - chunk_bits_));
+  }
+
+  Chunk& GetMutableChunk(std::size_t index) {
+    auto& chunk = chunks_[index];
+    if (chunk.use_count() != 1) chunk = std::make_shared<Chunk>(*chunk);
+    return *chunk;
+  }
+
+  Chunk& GetMutableChunk(const Key& key) {
+    return GetMutableChunk(GetChunkIndex(key));
+  }
+
+  // Growing beforehand keeps the iterators and references to the inserted
+  // element valid
+  void ReserveForInsert() { reserve(size_ + 1); }
+
+  void Grow() {
+    auto chunks = MakeChunks(chunks_.size() * 2);
+    ++chunk_bits_;
+
+    for (auto& chunk : chunks_) {
+      if (chunk.use_count() == 1) {
+        while (!chunk->empty()) {
+          auto node = chunk->extract(chunk->begin());
+          chunks[GetChunkIndex(node.key())]->insert(std::move(node));
+        }
+      } else {
+        for (const auto& [key, value] : *chunk) {
+          chunks[GetChunkIndex(key)]->emplace(key, value);
+        }
+      }
+    }
+
+    chunks_ = std::move(chunks);
+  }
+
+  std::vector<ChunkPtr> chunks_;
+  std::size_t chunk_bits_{kMinChunkBits};
+  std::size_t size_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+class ChunkedCowMap<Key, Value, Hash, Equal>::const_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = typename Chunk::value_type;
+  using reference = const value_type&;
+  using pointer = const value_type*;
+
+  const_iterator() = default;
+
+  reference operator*() const { return *it_; }
+  pointer operator->() const { return &*it_; }
+
+  const_iterator& operator++() {
+    ++it_;
+    SkipEmptyChunks();
+    return *this;
+  }
+
+  const_iterator operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  bool operator==(const const_iterator& other) const {
+    return index_ == other.index_ && (IsEnd() || it_ == other.it_);
+  }
+
+  bool operator!=(const const_iterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class ChunkedCowMap;
+
+  using ChunkIterator = typename Chunk::const_iterator;
+
+  // end
+  explicit const_iterator(const std::vector<ChunkPtr>& chunks)
+      : chunks_{&chunks}, index_{chunks.size()} {}
+
+  // first element starting from the chunk
+  const_iterator(const std::vector<ChunkPtr>& chunks, std::size_t index)
+      : chunks_{&chunks}, index_{index}, it_{chunks[index]->begin()} {
+    SkipEmptyChunks();
+  }
+
+  const_iterator(const std::vector<ChunkPtr>& chunks, std::size_t index,
+                 ChunkIterator it)
+      : chunks_{&chunks}, index_{index}, it_{it} {}
+
+  bool IsEnd() const { return chunks_ == nullptr || index_ == chunks_->size(); }
+
+  void SkipEmptyChunks() {
+    while (it_ == (*chunks_)[index_]->end()) {
+      if (++index_ == chunks_->size()) return;
+      it_ = (*chunks_)[index_]->begin();
+    }
+  }
+
+  const std::vector<ChunkPtr>* chunks_{nullptr};
+  std::size_t index_{0};
+  ChunkIterator it_{};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
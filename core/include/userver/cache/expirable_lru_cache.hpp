@@ -5,8 +5,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
+#include <userver/cache/impl/weight.hpp>
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
@@ -30,6 +32,11 @@ struct ExpirableValue final {
   std::chrono::steady_clock::time_point update_time;
 };
 
+template <typename Value>
+std::size_t Weight(const ExpirableValue<Value>& value) {
+  return sizeof(value) - sizeof(Value) + impl::GetWeight(value.value);
+}
+
 template <typename Value>
 void Write(dump::Writer& writer, const impl::ExpirableValue<Value>& value) {
   const auto [now, steady_now] = utils::impl::GetGlobalTime();
@@ -75,6 +82,10 @@ class ExpirableLruCache final {
 
   void SetWaySize(size_t way_size);
 
+  /// Limits the total weight of the entries of each way, 0 means no limit.
+  /// See cache::LruMap for the weights.
+  void SetWayMaxWeight(std::size_t way_max_weight);
+
   std::chrono::milliseconds GetMaxLifetime() const noexcept;
 
   void SetMaxLifetime(std::chrono::milliseconds max_lifetime);
@@ -86,6 +97,11 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  /// Sets the policy that decides whether a new value may evict an old one.
+  /// With AdmissionPolicy::kTinyLfu a scan of rarely used keys doesn't evict
+  /// the frequently used ones.
+  void SetAdmissionPolicy(AdmissionPolicy admission_policy);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
@@ -131,6 +147,8 @@ class ExpirableLruCache final {
 
   size_t GetSizeApproximate() const;
 
+  std::size_t GetWeightApproximate() const;
+
   /// Clear cache
   void Invalidate();
 
@@ -181,6 +199,12 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
   lru_.UpdateWaySize(way_size);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWayMaxWeight(
+    std::size_t way_max_weight) {
+  lru_.UpdateWayMaxWeight(way_max_weight);
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::chrono::milliseconds
 ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
@@ -199,6 +223,12 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
   background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetAdmissionPolicy(
+    AdmissionPolicy admission_policy) {
+  lru_.SetAdmissionPolicy(admission_policy);
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
@@ -328,6 +358,12 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
   return lru_.GetSize();
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetWeightApproximate()
+    const {
+  return lru_.GetWeight();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
   lru_.Invalidate();
@@ -437,6 +473,7 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
   writer["current-documents-count"] = cache.GetSizeApproximate();
+  writer["current-bytes"] = cache.GetWeightApproximate();
   writer = cache.GetStatistics();
 }
 
@@ -0,0 +1,109 @@
+#pragma once
+
+/// @file userver/cache/invalidation_channel.hpp
+/// @brief @copybrief cache::InvalidationChannel
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/components/component_fwd.hpp>
+#include <userver/concurrent/async_event_channel.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/formats/serialize/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+enum class InvalidationType {
+  /// Drop the entries with InvalidationEvent::keys
+  kKeys,
+  /// Drop all the entries
+  kAll,
+  /// Run an incremental update of the cache as soon as possible
+  kIncrementalUpdate,
+  /// Run a full update of the cache as soon as possible
+  kFullUpdate,
+};
+
+/// @brief An event of the cache::InvalidationChannel
+struct InvalidationEvent final {
+  /// Name of the cache component to invalidate
+  std::string cache_name;
+  InvalidationType type{InvalidationType::kAll};
+  /// For InvalidationType::kKeys, keys serialized to JSON
+  std::vector<formats::json::Value> keys;
+};
+
+formats::json::Value Serialize(const InvalidationEvent& event,
+                               formats::serialize::To<formats::json::Value>);
+
+InvalidationEvent Parse(const formats::json::Value& value,
+                        formats::parse::To<InvalidationEvent>);
+
+// clang-format off
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base class for the components that deliver cache invalidations
+/// to all the instances of a service
+///
+/// A write to the database on one instance stays unseen by the caches of the
+/// other instances until the next update or the expiration of the entries.
+/// Caches subscribe to an invalidation channel with the `invalidation-channel`
+/// static option, and the writer publishes an InvalidationEvent just after
+/// the write:
+///  * cache::LruCacheComponent drops the keys, or all the entries;
+///  * components::CachingComponentBase runs an update out of the schedule.
+///
+/// This allows to use long TTLs and update intervals without serving stale
+/// data for long.
+///
+/// The events are delivered at most once, including the instance that
+/// published them, so the periodic updates and TTLs are still required to
+/// bound the staleness if an event is lost.
+///
+/// Implementations should deliver the text from SerializeEvent() to all the
+/// instances and pass it to OnMessage() on each of them, see
+/// storages::redis::CacheInvalidationChannel.
+
+// clang-format on
+class InvalidationChannel {
+ public:
+  using EventSource = concurrent::AsyncEventSource<const InvalidationEvent&>;
+
+  explicit InvalidationChannel(std::string name);
+  virtual ~InvalidationChannel();
+
+  /// Sends the event to all the subscribed caches of all the instances
+  virtual void Publish(const InvalidationEvent& event) = 0;
+
+  /// Subscribe to the received events. The events for all the caches are
+  /// delivered, the subscriber filters them by InvalidationEvent::cache_name.
+  EventSource& GetEventSource();
+
+ protected:
+  static std::string SerializeEvent(const InvalidationEvent& event);
+
+  /// Parses the message and delivers it to the subscribers; malformed
+  /// messages are logged and ignored.
+  void OnMessage(std::string_view message);
+
+ private:
+  concurrent::AsyncEventChannel<const InvalidationEvent&> channel_;
+};
+
+namespace impl {
+
+/// Returns the component from the `invalidation-channel` static option, if any
+InvalidationChannel* FindInvalidationChannel(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context);
+
+}  // namespace impl
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -4,17 +4,24 @@
 /// @brief @copybrief cache::LruCacheComponent
 
 #include <functional>
+#include <memory>
+#include <type_traits>
 
 #include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/cache/invalidation_channel.hpp>
 #include <userver/cache/lru_cache_config.hpp>
+#include <userver/cache/negative_lookup_filter.hpp>
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/meta.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/value_builder.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/component_control.hpp>
+#include <userver/utils/meta.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/yaml_config/schema.hpp>
 
@@ -59,9 +66,30 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
+/// max-bytes | max total weight of the items in bytes, see cache::LruMap for the weights; 0 is unlimited | 0
 /// ways | number of ways for associative cache | --
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// background-update | refresh the entries that are accessed after a half of their lifetime in background, without blocking the readers | false
+/// admission-policy | `lru` to always evict the least recently used entry, `tiny-lfu` to admit a new entry only if it is used more frequently than the evicted one (W-TinyLFU), so that scans of rarely used keys don't wash out the frequently used ones | lru
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
+/// invalidation-channel | name of the cache::InvalidationChannel component to receive the invalidations of this cache from | --
+///
+/// ## Invalidation
+/// With the `invalidation-channel` a write on one instance of the service
+/// may drop the stale entries on all the instances, so that the `lifetime`
+/// could be long. Call LruCacheComponent::InvalidateByKeyEverywhere just after
+/// the write. The keys are sent as JSON, so `Key` should be serializable to
+/// and parsable from formats::json::Value, otherwise all the entries are
+/// dropped on the receivers.
+///
+/// ## Negative lookups
+/// If most of the looked up keys are absent in the data source, call
+/// LruCacheComponent::SetNegativeLookupFilter in the constructor, e.g. with
+/// the filter of a components::CachingComponentBase that keeps just the keys.
+/// The keys that are definitely absent get `Value{}` without a DoGetByKey
+/// call, so `Value{}` should mean an absent value, e.g. `std::nullopt`.
+/// The keys of LruCacheComponent::InvalidateByKeyEverywhere are added to the
+/// filter until it is rebuilt.
 ///
 /// ## Example usage:
 ///
@@ -82,6 +110,7 @@ class LruCacheComponent : public components::LoggableComponentBase,
  public:
   using Cache = ExpirableLruCache<Key, Value, Hash, Equal>;
   using CacheWrapper = LruCacheWrapper<Key, Value, Hash, Equal>;
+  using NegativeLookupFilter = cache::NegativeLookupFilter<Key, Hash>;
 
   LruCacheComponent(const components::ComponentConfig&,
                     const components::ComponentContext&);
@@ -90,11 +119,24 @@ class LruCacheComponent : public components::LoggableComponentBase,
 
   CacheWrapper GetCache();
 
+  /// Drops the key from this cache and publishes the invalidation to the
+  /// `invalidation-channel`, if any
+  void InvalidateByKeyEverywhere(const Key& key);
+
+  /// Drops all the entries from this cache and publishes the invalidation to
+  /// the `invalidation-channel`, if any
+  void InvalidateEverywhere();
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  protected:
   virtual Value DoGetByKey(const Key& key) = 0;
 
+  /// @brief Makes the keys that are definitely absent get `Value{}` without
+  /// DoGetByKey.
+  /// @warning Must be called from the constructor of the derived component.
+  void SetNegativeLookupFilter(std::shared_ptr<NegativeLookupFilter> filter);
+
  private:
   void DropCache();
 
@@ -102,11 +144,16 @@ class LruCacheComponent : public components::LoggableComponentBase,
 
   void OnConfigUpdate(const dynamic_config::Snapshot& cfg);
 
+  void OnInvalidation(const InvalidationEvent& event);
+
   void UpdateConfig(const LruCacheConfig& config);
 
   static constexpr bool kCacheIsDumpable =
       dump::kIsDumpable<Key> && dump::kIsDumpable<Value>;
 
+  static constexpr bool kKeyIsParsable =
+      formats::common::impl::kHasParse<formats::json::Value, Key>;
+
   void GetAndWrite(dump::Writer& writer) const override;
   void ReadAndSet(dump::Reader& reader) override;
 
@@ -119,8 +166,11 @@ class LruCacheComponent : public components::LoggableComponentBase,
   std::shared_ptr<dump::Dumper> dumper_;
   const std::shared_ptr<Cache> cache_;
   concurrent::AsyncEventSubscriberScope config_subscription_;
+  InvalidationChannel* const invalidation_channel_;
+  concurrent::AsyncEventSubscriberScope invalidation_subscription_;
   utils::statistics::Entry statistics_holder_;
   std::optional<testsuite::ComponentInvalidatorHolder> invalidator_holder_;
+  std::shared_ptr<NegativeLookupFilter> negative_lookup_filter_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -131,7 +181,8 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize())),
+      invalidation_channel_(impl::FindInvalidationChannel(config, context)) {
   if (impl::IsDumpSupportEnabled(config)) {
     dumper_ = std::make_shared<dump::Dumper>(
         config, context, static_cast<dump::DumpableEntity&>(*this));
@@ -139,8 +190,11 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
     dumper_->ReadDump();
   }
 
+  cache_->SetWayMaxWeight(
+      static_config_.config.GetWayMaxBytes(static_config_.ways));
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
+  cache_->SetAdmissionPolicy(static_config_.config.admission_policy);
 
   if (static_config_.use_dynamic_config) {
     LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -157,15 +211,28 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
   statistics_holder_ = impl::RegisterOnStatisticsStorage(
       context, name_,
-      [this](utils::statistics::Writer& writer) { writer = *cache_; });
+      [this](utils::statistics::Writer& writer) {
+        writer = *cache_;
+        if (negative_lookup_filter_) {
+          writer["negative-lookup-filter"] = *negative_lookup_filter_;
+        }
+      });
 
   invalidator_holder_.emplace(
       impl::FindComponentControl(context), *this,
       &LruCacheComponent<Key, Value, Hash, Equal>::DropCache);
+
+  if (invalidation_channel_) {
+    invalidation_subscription_ =
+        invalidation_channel_->GetEventSource().AddListener(
+            this, "cache." + name_,
+            &LruCacheComponent<Key, Value, Hash, Equal>::OnInvalidation);
+  }
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 LruCacheComponent<Key, Value, Hash, Equal>::~LruCacheComponent() {
+  invalidation_subscription_.Unsubscribe();
   invalidator_holder_.reset();
   statistics_holder_.Unregister();
   config_subscription_.Unsubscribe();
@@ -181,14 +248,84 @@ LruCacheComponent<Key, Value, Hash, Equal>::GetCache() {
   return CacheWrapper(cache_, [this](const Key& key) { return GetByKey(key); });
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::InvalidateByKeyEverywhere(
+    const Key& key) {
+  cache_->InvalidateByKey(key);
+  // the key may have just been inserted
+  if (negative_lookup_filter_) negative_lookup_filter_->Add(key);
+  if (!invalidation_channel_) return;
+
+  InvalidationEvent event{name_, InvalidationType::kKeys, {}};
+  event.keys.push_back(formats::json::ValueBuilder{key}.ExtractValue());
+  invalidation_channel_->Publish(event);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::InvalidateEverywhere() {
+  cache_->Invalidate();
+  if (negative_lookup_filter_) negative_lookup_filter_->Reset();
+  if (!invalidation_channel_) return;
+
+  invalidation_channel_->Publish({name_, InvalidationType::kAll, {}});
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::OnInvalidation(
+    const InvalidationEvent& event) {
+  if (event.cache_name != name_) return;
+
+  if constexpr (kKeyIsParsable) {
+    if (event.type == InvalidationType::kKeys) {
+      try {
+        for (const auto& key : event.keys) {
+          auto parsed_key = key.template As<Key>();
+          cache_->InvalidateByKey(parsed_key);
+          if (negative_lookup_filter_) negative_lookup_filter_->Add(parsed_key);
+        }
+        return;
+      } catch (const std::exception& e) {
+        LOG_WARNING() << "Failed to parse the invalidated keys of LRU cache '"
+                      << name_ << "', dropping all the entries: " << e;
+      }
+    }
+  }
+
+  // updates of the data source make the entries stale
+  cache_->Invalidate();
+  if (negative_lookup_filter_) negative_lookup_filter_->Reset();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::DropCache() {
   cache_->Invalidate();
+  // the filter is rebuilt by its owner
+  if (negative_lookup_filter_) negative_lookup_filter_->Reset();
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value LruCacheComponent<Key, Value, Hash, Equal>::GetByKey(const Key& key) {
-  return DoGetByKey(key);
+  if (negative_lookup_filter_) {
+    if constexpr (std::is_default_constructible_v<Value>) {
+      if (!negative_lookup_filter_->MayContain(key)) return Value{};
+    }
+  }
+
+  auto value = DoGetByKey(key);
+  if constexpr (meta::kIsOptional<Value>) {
+    if (negative_lookup_filter_ && !value) {
+      negative_lookup_filter_->AccountFalsePositive();
+    }
+  }
+  return value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::SetNegativeLookupFilter(
+    std::shared_ptr<NegativeLookupFilter> filter) {
+  static_assert(std::is_default_constructible_v<Value>,
+                "Value{} is returned for the keys rejected by the filter");
+  negative_lookup_filter_ = std::move(filter);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -208,8 +345,10 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(
     const LruCacheConfig& config) {
   cache_->SetWaySize(config.GetWaySize(static_config_.ways));
+  cache_->SetWayMaxWeight(config.GetWayMaxBytes(static_config_.ways));
   cache_->SetMaxLifetime(config.lifetime);
   cache_->SetBackgroundUpdate(config.background_update);
+  cache_->SetAdmissionPolicy(config.admission_policy);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
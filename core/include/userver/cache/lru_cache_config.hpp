@@ -19,6 +19,12 @@ enum class BackgroundUpdateMode {
   kDisabled,
 };
 
+/// Decides whether a new key may evict an old one from a full cache
+enum class AdmissionPolicy {
+  kLru,      ///< Always admit new keys, evicting the least recently used ones
+  kTinyLfu,  ///< W-TinyLFU, admit keys used more frequently than the victim
+};
+
 struct LruCacheConfig final {
   explicit LruCacheConfig(const yaml_config::YamlConfig& config);
   explicit LruCacheConfig(const components::ComponentConfig& config);
@@ -27,9 +33,15 @@ struct LruCacheConfig final {
 
   std::size_t GetWaySize(std::size_t ways) const;
 
+  /// @returns 0 if the weight of the entries is not limited
+  std::size_t GetWayMaxBytes(std::size_t ways) const;
+
   std::size_t size;
+  /// Max total weight of the entries, 0 is unlimited
+  std::size_t max_bytes;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  AdmissionPolicy admission_policy;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value,
@@ -0,0 +1,178 @@
+#pragma once
+
+/// @file userver/cache/negative_lookup_filter.hpp
+/// @brief @copybrief cache::NegativeLookupFilter
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_set>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/filter_bloom.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl {
+
+// The second hash of the double hashing in utils::FilterBloom
+template <typename Hash>
+struct MixedHash {
+  template <typename Key>
+  std::size_t operator()(const Key& key) const {
+    // splitmix64 finalizer, so that the identity hashes of integers
+    // differ from their mixed ones
+    std::uint64_t hash = hash_(key);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<std::size_t>(hash ^ (hash >> 31));
+  }
+
+  Hash hash_{};
+};
+
+}  // namespace impl
+
+/// @brief Thread-safe filter of the keys that may be present in a data
+/// source, tells that a key is definitely absent without a lookup.
+///
+/// Built on utils::FilterBloom, so false positives are possible, but false
+/// negatives are not. Every key passes the filter until the first Rebuild()
+/// and after Reset().
+///
+/// The filter is rebuilt from all the keys of the data source, e.g. on a full
+/// cache update. The keys that appear in between are added one by one with
+/// Add().
+///
+/// @see components::CachingComponentBase::GetNegativeLookupFilter and
+/// cache::LruCacheComponent::SetNegativeLookupFilter
+template <typename Key, typename Hash = std::hash<Key>>
+class NegativeLookupFilter final {
+ public:
+  /// 16 counters per key give about 0.25% of false positives
+  static constexpr std::size_t kDefaultCellsPerKey = 16;
+
+  explicit NegativeLookupFilter(
+      std::size_t cells_per_key = kDefaultCellsPerKey);
+
+  /// @brief Replaces the filter with the one of all the `items`.
+  /// @param get_key returns the key of an item of the `items` range
+  template <typename Range, typename GetKey>
+  void Rebuild(const Range& items, GetKey get_key);
+
+  /// Replaces the filter with the one of all the `keys`
+  template <typename Range>
+  void Rebuild(const Range& keys);
+
+  /// Adds a key that has appeared in the data source after the Rebuild()
+  void Add(const Key& key);
+
+  /// Makes every key pass the filter until the next Rebuild()
+  void Reset();
+
+  /// @returns false if the key is definitely absent in the data source
+  bool MayContain(const Key& key) const;
+
+  /// Call it if a key that has passed the filter is absent in the data source
+  void AccountFalsePositive();
+
+  /// @cond
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const NegativeLookupFilter& filter) {
+    writer["checks"] = filter.checks_;
+    writer["rejected"] = filter.rejected_;
+    writer["false-positives"] = filter.false_positives_;
+  }
+  /// @endcond
+
+ private:
+  using Bloom = utils::FilterBloom<Key, std::uint8_t, Hash,
+                                   impl::MixedHash<Hash>>;
+
+  // Fewer counters make the false positives more frequent than promised
+  static constexpr std::size_t kMinCells = 256;
+
+  const std::size_t cells_per_key_;
+  // Null if every key passes
+  rcu::Variable<std::shared_ptr<const Bloom>> bloom_;
+  // Added after the bloom_ has been built, usually there are just a few
+  rcu::Variable<std::unordered_set<Key, Hash>> added_;
+
+  mutable utils::statistics::RateCounter checks_;
+  mutable utils::statistics::RateCounter rejected_;
+  utils::statistics::RateCounter false_positives_;
+};
+
+template <typename Key, typename Hash>
+NegativeLookupFilter<Key, Hash>::NegativeLookupFilter(
+    std::size_t cells_per_key)
+    : cells_per_key_(std::max<std::size_t>(cells_per_key, 1)) {}
+
+template <typename Key, typename Hash>
+template <typename Range, typename GetKey>
+void NegativeLookupFilter<Key, Hash>::Rebuild(const Range& items,
+                                              GetKey get_key) {
+  const auto size = static_cast<std::size_t>(std::size(items));
+  auto bloom =
+      std::make_shared<Bloom>(std::max(kMinCells, size * cells_per_key_));
+  for (const auto& item : items) bloom->Increment(get_key(item));
+
+  bloom_.Assign(std::move(bloom));
+  added_.Assign({});
+}
+
+template <typename Key, typename Hash>
+template <typename Range>
+void NegativeLookupFilter<Key, Hash>::Rebuild(const Range& keys) {
+  Rebuild(keys, [](const Key& key) -> const Key& { return key; });
+}
+
+template <typename Key, typename Hash>
+void NegativeLookupFilter<Key, Hash>::Add(const Key& key) {
+  {
+    const auto bloom = bloom_.Read();
+    if (!*bloom) return;
+  }
+
+  auto added = added_.StartWrite();
+  added->insert(key);
+  added.Commit();
+}
+
+template <typename Key, typename Hash>
+void NegativeLookupFilter<Key, Hash>::Reset() {
+  bloom_.Assign(nullptr);
+  added_.Assign({});
+}
+
+template <typename Key, typename Hash>
+bool NegativeLookupFilter<Key, Hash>::MayContain(const Key& key) const {
+  const auto bloom = bloom_.Read();
+  if (!*bloom) return true;
+
+  ++checks_;
+  if ((*bloom)->Has(key)) return true;
+
+  const auto added = added_.Read();
+  if (added->count(key)) return true;
+
+  ++rejected_;
+  return false;
+}
+
+template <typename Key, typename Hash>
+void NegativeLookupFilter<Key, Hash>::AccountFalsePositive() {
+  // every key passes a reset filter
+  const auto bloom = bloom_.Read();
+  if (*bloom) ++false_positives_;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,350 @@
+#pragma once
+
+/// @file userver/cache/nway_clock_cache.hpp
+/// @brief @copybrief cache::NWayClockCache
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/cache/chunked_cow_map.hpp>
+#include <userver/dump/dumper.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Sharded cache with the CLOCK (second chance) eviction, a drop-in
+/// replacement for cache::NWayLRU with lock-free hits
+///
+/// A hit in cache::NWayLRU moves the item to the head of the LRU list, so
+/// every Get locks the mutex of the way and the hot ways become the
+/// bottleneck under contention. Here a hit only sets the 'referenced' flag of
+/// the item, and the items of a way are read through an rcu::Variable, so Get
+/// takes no locks at all. Put, InvalidateByKey and the eviction lock the way.
+///
+/// On eviction the clock hand goes over the items of the way, clearing the
+/// 'referenced' flags, and evicts the first item that was not used since
+/// the previous pass of the hand.
+///
+/// Each Put copies a chunk of cache::ChunkedCowMap, so the cache is meant for
+/// workloads where hits dominate.
+///
+/// The keys are looked up inside of a way with a default constructed `Hash`.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class NWayClockCache final {
+ public:
+  NWayClockCache(size_t ways, size_t way_size);
+
+  void Put(const T& key, U value);
+
+  template <typename Validator>
+  std::optional<U> Get(const T& key, Validator validator);
+
+  std::optional<U> Get(const T& key) {
+    return Get(key, [](const U&) { return true; });
+  }
+
+  U GetOr(const T& key, const U& default_value);
+
+  void Invalidate();
+
+  void InvalidateByKey(const T& key);
+
+  /// Iterates over all items. May be slow for big caches.
+  template <typename Function>
+  void VisitAll(Function func) const;
+
+  size_t GetSize() const;
+
+  void UpdateWaySize(size_t way_size);
+
+  void Write(dump::Writer& writer) const;
+  void Read(dump::Reader& reader);
+
+  /// The dump::Dumper will be notified of any cache updates. This method is not
+  /// thread-safe.
+  void SetDumper(std::shared_ptr<dump::Dumper> dumper);
+
+ private:
+  struct Node {
+    Node(const T& key, U&& value) : key(key), value(std::move(value)) {}
+
+    const T key;
+    const U value;
+    std::atomic<bool> referenced{false};
+    // position in Way::clock, guarded by Way::mutex
+    size_t clock_index{0};
+  };
+
+  using NodePtr = std::shared_ptr<Node>;
+  using Map = ChunkedCowMap<T, NodePtr, Hash, Equal>;
+
+  struct Way {
+    mutable engine::Mutex mutex;
+    rcu::Variable<Map> map;
+
+    // guarded by mutex
+    std::vector<NodePtr> clock;
+    size_t hand{0};
+    size_t max_size{1};
+  };
+
+  Way& GetWay(const T& key);
+
+  // The following functions must be called with the way mutex locked
+  static void Erase(Way& way, Map& map, const T& key);
+  static void RemoveFromClock(Way& way, const Node& node);
+  static Node& SelectVictim(Way& way);
+
+  void NotifyDumper();
+
+  utils::FixedArray<Way> caches_;
+  Hash hash_fn_;
+  std::shared_ptr<dump::Dumper> dumper_{nullptr};
+};
+
+template <typename T, typename U, typename Hash, typename Eq>
+NWayClockCache<T, U, Hash, Eq>::NWayClockCache(size_t ways, size_t way_size)
+    : caches_(ways) {
+  if (ways == 0) throw std::logic_error("Ways must be positive");
+
+  UpdateWaySize(way_size);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::Put(const T& key, U value) {
+  auto& way = GetWay(key);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    auto map = way.map.StartWrite();
+    auto node = std::make_shared<Node>(key, std::move(value));
+
+    const auto it = map->find(key);
+    if (it != map->end()) {
+      const auto& old_node = it->second;
+      node->clock_index = old_node->clock_index;
+      node->referenced.store(true, std::memory_order_relaxed);
+      way.clock[node->clock_index] = node;
+    } else if (way.clock.size() < way.max_size) {
+      node->clock_index = way.clock.size();
+      way.clock.push_back(node);
+    } else {
+      // the new item takes the slot of the evicted one
+      auto& victim = SelectVictim(way);
+      node->clock_index = victim.clock_index;
+      map->erase(victim.key);
+      way.clock[node->clock_index] = node;
+      way.hand = (way.hand + 1) % way.clock.size();
+    }
+
+    map->insert_or_assign(key, std::move(node));
+    map.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Validator>
+std::optional<U> NWayClockCache<T, U, Hash, Eq>::Get(const T& key,
+                                                     Validator validator) {
+  auto& way = GetWay(key);
+  NodePtr expired;
+  {
+    const auto map = way.map.Read();
+    const auto it = map->find(key);
+    if (it == map->end()) return std::nullopt;
+
+    // the node is not copied, so that the hits don't contend on its
+    // reference counter
+    auto& node = *it->second;
+    if (validator(node.value)) {
+      // avoid writing to the shared cache line if the flag is already set
+      if (!node.referenced.load(std::memory_order_relaxed)) {
+        node.referenced.store(true, std::memory_order_relaxed);
+      }
+      return node.value;
+    }
+    expired = it->second;
+  }
+
+  std::unique_lock<engine::Mutex> lock(way.mutex);
+  auto map = way.map.StartWrite();
+  const auto it = map->find(key);
+  // the item could have been updated while the mutex was not locked
+  if (it == map->end() || it->second != expired) return std::nullopt;
+
+  Erase(way, *map, key);
+  map.Commit();
+  return std::nullopt;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
+  auto& way = GetWay(key);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    auto map = way.map.StartWrite();
+    if (!map->contains(key)) return;
+
+    Erase(way, *map, key);
+    map.Commit();
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+U NWayClockCache<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
+  auto value = Get(key);
+  return value ? std::move(*value) : default_value;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::Invalidate() {
+  for (auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    way.map.Assign(Map{});
+    way.clock.clear();
+    way.hand = 0;
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+void NWayClockCache<T, U, Hash, Eq>::VisitAll(Function func) const {
+  for (const auto& way : caches_) {
+    const auto map = way.map.Read();
+    for (const auto& [key, node] : *map) func(key, node->value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayClockCache<T, U, Hash, Eq>::GetSize() const {
+  size_t size{0};
+  for (const auto& way : caches_) {
+    const auto map = way.map.Read();
+    size += map->size();
+  }
+  return size;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
+  for (auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    way.max_size = way_size ? way_size : 1;
+    if (way.clock.size() <= way.max_size) continue;
+
+    auto map = way.map.StartWrite();
+    while (way.clock.size() > way.max_size) {
+      Erase(way, *map, SelectVictim(way).key);
+    }
+    map.Commit();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename NWayClockCache<T, U, Hash, Eq>::Way&
+NWayClockCache<T, U, Hash, Eq>::GetWay(const T& key) {
+  auto n = hash_fn_(key) % caches_.size();
+  return caches_[n];
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::Erase(Way& way, Map& map, const T& key) {
+  const auto it = map.find(key);
+  UASSERT(it != map.end());
+  // the key may be stored in the node only, keep the node alive
+  const auto node = it->second;
+  RemoveFromClock(way, *node);
+  map.erase(node->key);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayClockCache<T, U, Hash, Eq>::RemoveFromClock(Way& way,
+                                                     const Node& node) {
+  const auto index = node.clock_index;
+  UASSERT(index < way.clock.size() && way.clock[index].get() == &node);
+
+  if (index + 1 != way.clock.size()) {
+    way.clock[index] = std::move(way.clock.back());
+    way.clock[index]->clock_index = index;
+  }
+  way.clock.pop_back();
+  if (way.hand >= way.clock.size()) way.hand = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename NWayClockCache<T, U, Hash, Eq>::Node&
+NWayClockCache<T, U, Hash, Eq>::SelectVictim(Way& way) {
+  UASSERT(!way.clock.empty());
+
+  // terminates after a full pass at most, as the flags are cleared
+  while (true) {
+    auto& node = *way.clock[way.hand];
+    if (!node.referenced.exchange(false, std::memory_order_relaxed)) {
+      return node;
+    }
+    way.hand = (way.hand + 1) % way.clock.size();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
+  writer.Write(caches_.size());
+
+  for (const Way& way : caches_) {
+    const auto map = way.map.Read();
+    writer.Write(map->size());
+
+    for (const auto& [key, node] : *map) {
+      writer.Write(key);
+      writer.Write(node->value);
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::Read(dump::Reader& reader) {
+  Invalidate();
+
+  const auto ways = reader.Read<std::size_t>();
+  for (std::size_t i = 0; i < ways; ++i) {
+    const auto elements_in_way = reader.Read<std::size_t>();
+    for (std::size_t j = 0; j < elements_in_way; ++j) {
+      auto key = reader.Read<T>();
+      auto value = reader.Read<U>();
+      Put(std::move(key), std::move(value));
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::NotifyDumper() {
+  if (dumper_ != nullptr) {
+    dumper_->OnUpdateCompleted();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayClockCache<T, U, Hash, Equal>::SetDumper(
+    std::shared_ptr<dump::Dumper> dumper) {
+  dumper_ = std::move(dumper);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
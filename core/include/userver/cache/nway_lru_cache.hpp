@@ -2,8 +2,11 @@
 
 #include <functional>
 #include <optional>
+#include <variant>
 #include <vector>
 
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_map.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
@@ -42,8 +45,19 @@ class NWayLRU final {
 
   size_t GetSize() const;
 
+  /// Returns the total weight of the entries, see cache::LruMap for the
+  /// weights
+  std::size_t GetWeight() const;
+
   void UpdateWaySize(size_t way_size);
 
+  /// Limits the total weight of the entries of each way, 0 means no limit
+  void UpdateWayMaxWeight(std::size_t way_max_weight);
+
+  /// Switches the admission policy, keeping the items that fit into the
+  /// cache with the new policy
+  void SetAdmissionPolicy(AdmissionPolicy policy);
+
   void Write(dump::Writer& writer) const;
   void Read(dump::Reader& reader);
 
@@ -52,34 +66,42 @@ class NWayLRU final {
   void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
  private:
+  using Lru = LruMap<T, U, Hash, Equal>;
+  using TinyLfu = impl::TinyLfuBase<T, U, Hash, Equal>;
+  using WayCache = std::variant<Lru, TinyLfu>;
+
   struct Way {
     Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
 
     // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-    Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+    Way(const Hash& hash, const Equal& equal)
+        : cache(std::in_place_type<Lru>, 1, hash, equal) {}
 
     mutable engine::Mutex mutex;
-    LruMap<T, U, Hash, Equal> cache;
+    WayCache cache;
   };
 
   Way& GetWay(const T& key);
 
+  WayCache MakeWayCache(AdmissionPolicy policy, size_t way_size) const;
+
   void NotifyDumper();
 
   std::vector<Way> caches_;
   Hash hash_fn_;
+  Equal equal_fn_;
   std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
                                  const Eq& equal)
-    : caches_(), hash_fn_(hash) {
+    : caches_(), hash_fn_(hash), equal_fn_(equal) {
   caches_.reserve(ways);
   for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
   if (ways == 0) throw std::logic_error("Ways must be positive");
 
-  for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+  UpdateWaySize(way_size);
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -87,7 +109,8 @@ void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
   auto& way = GetWay(key);
   {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Put(key, std::move(value));
+    std::visit([&](auto& cache) { cache.Put(key, std::move(value)); },
+               way.cache);
   }
   NotifyDumper();
 }
@@ -98,11 +121,12 @@ std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
                                               Validator validator) {
   auto& way = GetWay(key);
   std::unique_lock<engine::Mutex> lock(way.mutex);
-  auto* value = way.cache.Get(key);
+  auto* value =
+      std::visit([&](auto& cache) { return cache.Get(key); }, way.cache);
 
   if (value) {
     if (validator(*value)) return *value;
-    way.cache.Erase(key);
+    std::visit([&](auto& cache) { cache.Erase(key); }, way.cache);
   }
 
   return std::nullopt;
@@ -113,7 +137,7 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
   auto& way = GetWay(key);
   {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Erase(key);
+    std::visit([&](auto& cache) { cache.Erase(key); }, way.cache);
   }
   NotifyDumper();
 }
@@ -122,14 +146,16 @@ template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
   auto& way = GetWay(key);
   std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  auto* value =
+      std::visit([&](auto& cache) { return cache.Get(key); }, way.cache);
+  return value ? *value : default_value;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
   for (auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Clear();
+    std::visit([](auto& cache) { cache.Clear(); }, way.cache);
   }
   NotifyDumper();
 }
@@ -139,7 +165,8 @@ template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
   for (const auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.VisitAll(func);
+    std::visit([&func](const auto& cache) { cache.VisitAll(func); },
+               way.cache);
   }
 }
 
@@ -148,17 +175,78 @@ size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   size_t size{0};
   for (const auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    size += way.cache.GetSize();
+    size += std::visit([](const auto& cache) { return cache.GetSize(); },
+                       way.cache);
   }
   return size;
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+std::size_t NWayLRU<T, U, Hash, Eq>::GetWeight() const {
+  std::size_t weight{0};
+  for (const auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    weight += std::visit([](const auto& cache) { return cache.GetWeight(); },
+                         way.cache);
+  }
+  return weight;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
   for (auto& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.SetMaxSize(way_size);
+    std::visit([way_size](auto& cache) { cache.SetMaxSize(way_size); },
+               way.cache);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::UpdateWayMaxWeight(std::size_t way_max_weight) {
+  for (auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::visit(
+        [way_max_weight](auto& cache) { cache.SetMaxWeight(way_max_weight); },
+        way.cache);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetAdmissionPolicy(AdmissionPolicy policy) {
+  for (auto& way : caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    const bool is_tiny_lfu = std::holds_alternative<TinyLfu>(way.cache);
+    if (is_tiny_lfu == (policy == AdmissionPolicy::kTinyLfu)) continue;
+
+    const auto way_size = std::visit(
+        [](const auto& cache) { return cache.GetCapacity(); }, way.cache);
+    const auto way_max_weight = std::visit(
+        [](const auto& cache) { return cache.GetMaxWeight(); }, way.cache);
+    auto new_cache = MakeWayCache(policy, way_size);
+    std::visit(
+        [way_max_weight](auto& cache) { cache.SetMaxWeight(way_max_weight); },
+        new_cache);
+
+    std::visit(
+        [](auto& old_cache, auto& cache) {
+          old_cache.VisitAll([&cache](const T& key, U& value) {
+            cache.Put(key, std::move(value));
+          });
+        },
+        way.cache, new_cache);
+    way.cache = std::move(new_cache);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename NWayLRU<T, U, Hash, Eq>::WayCache
+NWayLRU<T, U, Hash, Eq>::MakeWayCache(AdmissionPolicy policy,
+                                      size_t way_size) const {
+  if (policy == AdmissionPolicy::kTinyLfu) {
+    return WayCache{std::in_place_type<TinyLfu>, way_size, hash_fn_,
+                    equal_fn_};
   }
+  return WayCache{std::in_place_type<Lru>, way_size, hash_fn_, equal_fn_};
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -175,12 +263,16 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
   for (const Way& way : caches_) {
     std::unique_lock<engine::Mutex> lock(way.mutex);
 
-    writer.Write(way.cache.GetSize());
+    std::visit(
+        [&writer](const auto& cache) {
+          writer.Write(cache.GetSize());
 
-    way.cache.VisitAll([&writer](const T& key, const U& value) {
-      writer.Write(key);
-      writer.Write(value);
-    });
+          cache.VisitAll([&writer](const T& key, const U& value) {
+            writer.Write(key);
+            writer.Write(value);
+          });
+        },
+        way.cache);
   }
 }
 
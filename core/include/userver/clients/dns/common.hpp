@@ -3,16 +3,34 @@
 /// @file userver/clients/dns/common.hpp
 /// @brief Common DNS client declarations
 
-#include <boost/container/small_vector.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include <userver/engine/io/sockaddr.hpp>
+#include <userver/utils/small_vector.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 /// DNS client
 namespace clients::dns {
 
-using AddrVector = boost::container::small_vector<engine::io::Sockaddr, 4>;
+using AddrVector = utils::SmallVector<engine::io::Sockaddr, 4>;
+
+/// @brief Service location record, see RFC2782
+struct SrvRecord {
+  /// Domain name of the target host, resolve it with Resolver::Resolve()
+  std::string target;
+  std::uint16_t port{0};
+  /// Targets with lower priority must be tried first
+  std::uint16_t priority{0};
+  /// Relative weight among the targets of the same priority
+  std::uint16_t weight{0};
+};
+
+/// Sorted by priority, targets of the same priority are sorted by weight in
+/// descending order
+using SrvVector = std::vector<SrvRecord>;
 
 }  // namespace clients::dns
 
@@ -23,15 +23,27 @@ namespace clients::dns {
 /// Usually retrieved from clients::dns::Component.
 ///
 /// Combines file-based (/etc/hosts) name resolution with network-based one.
+///
+/// Network replies are cached for their TTL and are refreshed in background
+/// shortly before the expiration when they are still asked for, so the hot
+/// names never wait for the name servers. Stale replies are returned while
+/// the refresh is in progress, failures are cached for `cache-failure-ttl`.
 class Resolver {
  public:
-  struct LookupSourceCounters {
-    utils::statistics::RelaxedCounter<size_t> file{0};
+  struct NetLookupCounters {
     utils::statistics::RelaxedCounter<size_t> cached{0};
     utils::statistics::RelaxedCounter<size_t> cached_stale{0};
     utils::statistics::RelaxedCounter<size_t> cached_failure{0};
     utils::statistics::RelaxedCounter<size_t> network{0};
     utils::statistics::RelaxedCounter<size_t> network_failure{0};
+    /// Background refreshes of the cached replies
+    utils::statistics::RelaxedCounter<size_t> prefetch{0};
+  };
+
+  struct LookupSourceCounters : NetLookupCounters {
+    utils::statistics::RelaxedCounter<size_t> file{0};
+    /// Counters of ResolveSrv()
+    NetLookupCounters srv;
   };
 
   Resolver(engine::TaskProcessor& fs_task_processor,
@@ -51,6 +63,14 @@ class Resolver {
   /// a result within the specified deadline.
   AddrVector Resolve(const std::string& name, engine::Deadline deadline);
 
+  /// Performs a lookup of service location (SRV) records, e.g. for
+  /// `_http._tcp.example.com`. The result is cached just like the addresses the
+  /// service targets resolve into.
+  ///
+  /// @throws clients::dns::NotResolvedException if no records are received
+  /// within the specified deadline.
+  SrvVector ResolveSrv(const std::string& name, engine::Deadline deadline);
+
   /// Returns lookup source counters.
   const LookupSourceCounters& GetLookupSourceCounters() const;
 
@@ -60,12 +80,13 @@ class Resolver {
   /// Resets the network results cache.
   void FlushNetworkCache();
 
-  /// Removes the specified domain name from the network results cache.
+  /// Removes the specified domain or service name from the network results
+  /// cache.
   void FlushNetworkCache(const std::string& name);
 
  private:
   class Impl;
-  constexpr static size_t kSize = 1728;
+  constexpr static size_t kSize = 2432;
   constexpr static size_t kAlignment = 16;
   utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
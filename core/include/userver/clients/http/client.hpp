@@ -7,7 +7,10 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <cstddef>
 #include <memory>
+#include <string_view>
+#include <vector>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -37,6 +40,7 @@ namespace curl {
 class easy;
 class multi;
 class ConnectRateLimiter;
+class share;
 }  // namespace curl
 
 namespace engine::ev {
@@ -53,6 +57,9 @@ class Statistics;
 struct PoolStatistics;
 struct InstanceStatistics;
 class DestinationStatistics;
+class EndpointBalancer;
+class ConcurrencyLimiters;
+class ConnectionPrewarmer;
 
 /// @ingroup userver_clients
 ///
@@ -78,6 +85,16 @@ class Client final {
   /// @note This method is thread-safe despite being non-const.
   Request CreateRequest();
 
+  /// @brief Returns `count` HTTP request builders just like CreateRequest().
+  ///
+  /// Is cheaper than `count` calls to CreateRequest() for the fan-out
+  /// requests: all the missing connection handles are created by a single
+  /// task. The requests could be performed together with
+  /// clients::http::ResponseBatch.
+  ///
+  /// @note This method is thread-safe despite being non-const.
+  std::vector<Request> CreateRequests(std::size_t count);
+
   /// Providing CreateNonSignedRequest() function for the clients::Http alias.
   ///
   /// @note This method is thread-safe despite being non-const.
@@ -100,6 +117,15 @@ class Client final {
   // For internal use only.
   const http::DestinationStatistics& GetDestinationStatistics() const;
 
+  // For internal use only. Opens the connections to the prewarm destinations
+  // of the static config and starts keeping them alive.
+  void StartPrewarm();
+
+  /// @cond
+  // For internal use only, nullptr if the limits are disabled.
+  const ConcurrencyLimiters* GetConcurrencyLimiters() const;
+  /// @endcond
+
   // For internal use only.
   void SetTestsuiteConfig(const TestsuiteConfig& config);
 
@@ -133,6 +159,10 @@ class Client final {
  private:
   void ReinitEasy();
 
+  std::vector<std::shared_ptr<curl::easy>> CloneEasies(std::size_t count);
+  Request MakeRequest(std::shared_ptr<curl::easy>&& easy);
+  void SetUpRequest(Request& request);
+
   InstanceStatistics GetMultiStatistics(size_t n) const;
 
   size_t FindMultiIndex(const curl::multi*) const;
@@ -143,14 +173,23 @@ class Client final {
   void IncPending() noexcept { ++pending_tasks_; }
   void DecPending() noexcept { --pending_tasks_; }
   void PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept;
+  curl::multi* GetStickyMulti(std::string_view host_port) const noexcept;
 
   std::shared_ptr<curl::easy> TryDequeueIdle() noexcept;
 
   std::atomic<std::size_t> pending_tasks_{0};
 
   const impl::DeadlinePropagationConfig deadline_propagation_config_;
+  const bool sticky_destinations_;
 
   std::shared_ptr<DestinationStatistics> destination_statistics_;
+  // nullptr if there are no destinations to prewarm
+  std::unique_ptr<ConnectionPrewarmer> prewarmer_;
+  std::shared_ptr<EndpointBalancer> endpoint_balancer_;
+  // nullptr if disabled
+  std::shared_ptr<ConcurrencyLimiters> concurrency_limiters_;
+  // TLS sessions of all the IO threads, nullptr if disabled
+  std::shared_ptr<curl::share> tls_session_share_;
   std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
   std::vector<Statistics> statistics_;
   std::vector<std::unique_ptr<curl::multi>> multis_;
@@ -38,6 +38,16 @@ namespace components {
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
+/// sticky-destinations | whether to perform all the requests to the same host and port on the same IO thread, so that they reuse the connections of a single connection pool | false
+/// tls-session-cache | whether to share the TLS sessions between the IO threads, so that the new connections to a known host resume the session with an abbreviated handshake | true
+/// concurrency-limit.enabled | whether to adaptively limit the in-flight requests of each destination with metrics | false
+/// concurrency-limit.initial-limit | limit to start with | 20
+/// concurrency-limit.min-limit | the limit never goes below this value | 4
+/// concurrency-limit.max-limit | the limit never goes above this value | 1000
+/// concurrency-limit.queue-timeout-ms | how long a request waits for a free slot, 0 to fail immediately with clients::http::NetworkProblemException | 0
+/// prewarm.destinations | list of objects with the `url` to send the HEAD requests to and the number of `connections` to open before the traffic arrives; the warmness is reported in the `prewarm` metrics of the destination | -
+/// prewarm.timeout | timeout of the prewarm requests, the component start waits for at most that long | 1s
+/// prewarm.keep-alive-interval | how often to repeat the prewarm requests so that the connections are not closed as idle, 0 to only prewarm at start | 30s
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
@@ -0,0 +1,105 @@
+#pragma once
+
+/// @file userver/clients/http/hedging.hpp
+/// @brief @copybrief clients::http::HedgingPolicy
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Client;
+class Request;
+class Response;
+
+/// Settings of clients::http::HedgingPolicy
+struct HedgingSettings {
+  /// Time to wait for a response before sending one more attempt
+  std::chrono::milliseconds delay{50};
+
+  /// If set, the delay is this percentile (e.g. 95) of the recent timings of
+  /// the destination, `delay` is used until there are some
+  std::optional<double> delay_percentile;
+
+  /// Max attempts of a single request that are in flight at the same time
+  std::size_t max_attempts{2};
+
+  /// Hedged attempts that each request of the destination adds to the budget,
+  /// e.g. 0.1 allows hedging for 10% of the requests
+  double budget_ratio{0.1};
+
+  /// Max hedged attempts that could be accumulated in the budget
+  std::size_t max_budget{10};
+};
+
+/// @brief Sends duplicates of slow requests to cut the latency tail.
+///
+/// If no response arrives within the hedging delay, one more attempt of the
+/// request is sent while the previous ones continue. The first response that
+/// is not 5xx wins and the rest of the attempts are cancelled. Unlike
+/// Request::retry() the attempts run concurrently.
+///
+/// Keep one HedgingPolicy per destination: it carries the budget that limits
+/// the hedged attempts to a fraction of the requests, so the hedging can't
+/// cause a storm of requests to an overloaded destination. The instance is
+/// thread-safe.
+///
+/// Each attempt is a new request made by the passed function in the current
+/// task, so the deadline propagation applies to all of them and no attempt is
+/// sent after the deadline is reached. Use Request::load_balancing() to send
+/// the hedged attempts to the other endpoints of the destination.
+///
+/// @code
+/// const auto response = hedging_policy.Perform([&] {
+///   return http_client.CreateRequest()
+///       .get(url)
+///       .timeout(std::chrono::milliseconds{500})
+///       .SetDestinationMetricName("backend")
+///       .load_balancing(clients::http::LoadBalancing::kLeastRequests);
+/// });
+/// @endcode
+class HedgingPolicy final {
+ public:
+  explicit HedgingPolicy(HedgingSettings settings);
+
+  /// `destination` is the name set by Request::SetDestinationMetricName(), its
+  /// timings are used for HedgingSettings::delay_percentile
+  HedgingPolicy(HedgingSettings settings, const Client& client,
+                std::string destination);
+
+  /// @brief Performs the request with hedging
+  /// @returns the first response that is not 5xx, or the last response if
+  /// all the attempts got 5xx
+  /// @throws clients::http::BaseException the error of the last attempt if
+  /// all the attempts failed without a response
+  std::shared_ptr<Response> Perform(
+      const std::function<Request()>& create_request);
+
+  /// Current delay before the next hedged attempt
+  std::chrono::milliseconds GetDelay() const;
+
+ private:
+  HedgingPolicy(HedgingSettings settings, const Client* client,
+                std::string destination);
+
+  void FillBudget() noexcept;
+  bool TryConsumeBudget() noexcept;
+
+  const HedgingSettings settings_;
+  const Client* const client_;
+  const std::string destination_;
+  // In thousandths of an attempt
+  std::atomic<std::int64_t> budget_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
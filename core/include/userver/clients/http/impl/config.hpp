@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -23,11 +25,41 @@ struct DeadlinePropagationConfig {
   bool update_header{true};
 };
 
+// Adaptive limit of the in-flight requests per destination
+struct ConcurrencyLimitConfig final {
+  bool enabled{false};
+  std::size_t initial_limit{20};
+  std::size_t min_limit{4};
+  std::size_t max_limit{1000};
+  // Zero to fail fast once the limit is reached
+  std::chrono::milliseconds queue_timeout{0};
+};
+
+// Destination to open the connections to before the traffic arrives
+struct PrewarmDestination final {
+  std::string url;
+  std::size_t connections{1};
+};
+
+PrewarmDestination Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<PrewarmDestination>);
+
+struct PrewarmConfig final {
+  std::vector<PrewarmDestination> destinations;
+  std::chrono::milliseconds timeout{1000};
+  // Zero to only open the connections at start
+  std::chrono::milliseconds keep_alive_interval{30000};
+};
+
 // Static config
 struct ClientSettings final {
   std::string thread_name_prefix{};
   size_t io_threads{8};
   bool defer_events{false};
+  bool sticky_destinations{false};
+  bool tls_session_cache{true};
+  ConcurrencyLimitConfig concurrency_limit{};
+  PrewarmConfig prewarm{};
   DeadlinePropagationConfig deadline_propagation{};
   const tracing::TracingManagerBase* tracing_manager{nullptr};
   const server::http::HeadersPropagator* headers_propagator{nullptr};
@@ -3,8 +3,11 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -34,8 +37,11 @@ class RequestState;
 class StreamedResponse;
 class ConnectTo;
 class Form;
+class RequestBodyWriter;
 class RequestStats;
 class DestinationStatistics;
+class EndpointBalancer;
+class ConcurrencyLimiters;
 struct TestsuiteConfig;
 
 namespace impl {
@@ -58,6 +64,16 @@ enum class HttpVersion {
   k2PriorKnowledge,  ///< HTTP/2 only (without Upgrade)
 };
 
+/// @brief How to pick one of the resolved addresses of the host, see
+/// Request::load_balancing()
+enum class LoadBalancing {
+  kNone,               ///< let cURL try the addresses in the resolved order
+  kRoundRobin,         ///< the addresses in turn
+  kLeastRequests,      ///< the address with the least requests in flight
+  kPowerOfTwoChoices,  ///< the better of two random addresses by the
+                       ///< requests in flight and the latency EWMA
+};
+
 enum class HttpAuthType {
   kBasic,      ///< "basic"
   kDigest,     ///< "digest"
@@ -157,6 +173,16 @@ class Request final {
   /// data for POST request
   Request& data(std::string data) &;
   Request data(std::string data) &&;
+  /// @brief body for POST/PUT/PATCH request that is sent while the writer
+  /// produces it, chunked if the `size` is unknown.
+  ///
+  /// Call it before the writer is handed to another task. The body is read
+  /// only once, so the request is performed once and is never retried.
+  /// @see clients::http::RequestBodyWriter
+  Request& data_stream(const RequestBodyWriter& writer,
+                       std::optional<std::size_t> size = {}) &;
+  Request data_stream(const RequestBodyWriter& writer,
+                      std::optional<std::size_t> size = {}) &&;
   /// form for POST request
   Request& form(const Form& form) &;
   Request form(const Form& form) &&;
@@ -262,6 +288,20 @@ class Request final {
     return *this;
   }
 
+  /// @brief Balance the requests between the resolved addresses of the URL
+  /// host on the client side instead of relying on an external proxy.
+  ///
+  /// The client keeps the requests in flight and the latencies of each
+  /// address and separate keep-alive connections to each of them. Addresses
+  /// that failed 5 times in a row (network errors or 5xx responses) are not
+  /// picked for 10 seconds. Each retry picks the address anew.
+  ///
+  /// Works only with the DNS resolver of the client (`dns_resolver: async` in
+  /// components::HttpClient), and is ignored for the requests with a proxy or
+  /// with an explicit connect_to().
+  Request& load_balancing(LoadBalancing policy) &;
+  Request load_balancing(LoadBalancing policy) &&;
+
   /// Override log URL. Usefull for "there's a secret in the query".
   /// @warning The query might be logged by other intermediate HTTP agents
   ///          (nginx, L7 balancer, etc.).
@@ -286,6 +326,11 @@ class Request final {
       const impl::DeadlinePropagationConfig& deadline_propagation_config) &;
 
   void SetHeadersPropagator(const server::http::HeadersPropagator*) &;
+
+  void SetEndpointBalancer(std::shared_ptr<EndpointBalancer> balancer) &;
+
+  void SetConcurrencyLimiters(
+      std::shared_ptr<ConcurrencyLimiters> limiters) &;
   /// @endcond
 
   /// Disable auto-decoding of received replies.
@@ -330,6 +375,12 @@ class Request final {
       utils::impl::SourceLocation location =
           utils::impl::SourceLocation::Current());
 
+  /// Same as perform(), but returns the error code instead of throwing,
+  /// see ResponseFuture::TryGet()
+  [[nodiscard]] utils::expected<std::shared_ptr<Response>, std::error_code>
+  TryPerform(utils::impl::SourceLocation location =
+                 utils::impl::SourceLocation::Current());
+
   /// Returns a reference to the original URL of a request
   const std::string& GetUrl() const&;
   const std::string& GetUrl() && = delete;
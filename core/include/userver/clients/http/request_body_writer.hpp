@@ -0,0 +1,79 @@
+#pragma once
+
+/// @file userver/clients/http/request_body_writer.hpp
+/// @brief @copybrief clients::http::RequestBodyWriter
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Request;
+
+namespace impl {
+struct RequestBodyStream;
+}  // namespace impl
+
+/// @brief Producer of an HTTP request body that is sent while it is being
+/// written, see Request::data_stream().
+///
+/// At most `max_buffered_bytes` of the written data wait to be sent, Write()
+/// suspends until the earlier chunks are sent. So the whole body of a huge
+/// upload never sits in memory. Requests with a streamed body are never
+/// retried.
+///
+/// @code
+/// clients::http::RequestBodyWriter writer;
+/// auto future = http_client.CreateRequest()
+///                   .post(url)
+///                   .data_stream(writer)
+///                   .timeout(std::chrono::seconds{10})
+///                   .async_perform();
+/// while (auto chunk = ReadNextChunk()) {
+///   if (!writer.Write(std::move(*chunk))) break;
+/// }
+/// writer.Finish();
+/// auto response = future.Get();
+/// @endcode
+class RequestBodyWriter final {
+ public:
+  static constexpr std::size_t kDefaultMaxBufferedBytes = 1024 * 1024;
+
+  explicit RequestBodyWriter(
+      std::size_t max_buffered_bytes = kDefaultMaxBufferedBytes);
+
+  RequestBodyWriter(RequestBodyWriter&&) noexcept;
+  RequestBodyWriter& operator=(RequestBodyWriter&&) noexcept;
+
+  /// Finishes the body
+  ~RequestBodyWriter();
+
+  /// @brief Waits for the buffer space and hands the chunk to the request.
+  /// @returns false if the request does not read the body anymore or the
+  /// deadline is reached
+  [[nodiscard]] bool Write(std::string chunk, engine::Deadline deadline = {});
+
+  /// @brief Ends the body, nothing could be written afterwards.
+  void Finish();
+
+ private:
+  friend class Request;
+
+  bool Push(std::string&& chunk, engine::Deadline deadline);
+  void Resume();
+
+  std::shared_ptr<impl::RequestBodyStream> stream_;
+  std::optional<concurrent::StringStreamQueue::Producer> producer_;
+  std::size_t max_chunk_size_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
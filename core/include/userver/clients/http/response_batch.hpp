@@ -0,0 +1,72 @@
+#pragma once
+
+/// @file userver/clients/http/response_batch.hpp
+/// @brief @copybrief clients::http::ResponseBatch
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Responses of the requests performed together, returned in the
+/// order of completion.
+///
+/// Suits the fan-out of many requests within a handler, the responses could
+/// be processed while the slower requests are still in flight:
+/// @code
+/// auto requests = http_client.CreateRequests(urls.size());
+/// for (std::size_t i = 0; i < urls.size(); ++i) {
+///   requests[i].get(urls[i]).timeout(kTimeout);
+/// }
+/// clients::http::ResponseBatch batch{requests};
+/// while (auto result = batch.GetNext()) {
+///   Process(urls[result->index], *result->response);
+/// }
+/// @endcode
+class ResponseBatch final {
+ public:
+  struct Result {
+    /// Index of the request in the batch
+    std::size_t index;
+    std::shared_ptr<Response> response;
+  };
+
+  /// Performs all the requests
+  explicit ResponseBatch(std::vector<Request>& requests);
+
+  /// Takes the already performed requests
+  explicit ResponseBatch(std::vector<ResponseFuture>&& futures);
+
+  ResponseBatch(ResponseBatch&&) noexcept = default;
+  ResponseBatch& operator=(ResponseBatch&&) noexcept = default;
+
+  /// @brief Waits for any of the remaining requests.
+  /// @returns std::nullopt once all the responses were returned
+  /// @throws the exception of the completed request just like
+  /// ResponseFuture::Get() does, the request is removed from the batch and the
+  /// rest of the responses could still be retrieved
+  /// @throws clients::http::CancelException if the current task was cancelled
+  std::optional<Result> GetNext();
+
+  /// Number of the requests that were not returned by GetNext() yet
+  std::size_t GetPendingCount() const noexcept;
+
+  /// Cancels all the remaining requests
+  void Cancel();
+
+ private:
+  std::vector<ResponseFuture> futures_;
+  std::vector<std::size_t> indexes_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
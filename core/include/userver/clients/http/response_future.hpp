@@ -5,6 +5,7 @@
 
 #include <future>
 #include <memory>
+#include <system_error>
 #include <type_traits>
 
 #include <userver/clients/http/response.hpp>
@@ -12,6 +13,7 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
+#include <userver/utils/expected.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -41,6 +43,14 @@ class ResponseFuture final {
 
   std::shared_ptr<Response> Get();
 
+  /// @brief Same as Get(), but returns the error code of a failed or timed
+  /// out request instead of throwing. Use it where the errors are frequent,
+  /// e.g. to fail fast on partial outages without the cost of the exceptions.
+  ///
+  /// Errors without a code, e.g. thrown by the plugins, are still thrown.
+  /// @throws CancelException if the current task is cancelled
+  utils::expected<std::shared_ptr<Response>, std::error_code> TryGet();
+
   /// @cond
   /// Internal helper for WaitAny/WaitAll
   engine::impl::ContextAccessor* TryGetContextAccessor() noexcept;
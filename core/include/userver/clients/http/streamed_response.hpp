@@ -12,6 +12,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace formats::json::parser {
+class BaseParser;
+}  // namespace formats::json::parser
+
 namespace clients::http {
 
 class RequestState;
@@ -52,6 +56,28 @@ class StreamedResponse final {
   /// @note may block if the chunk is not obtained yet.
   bool ReadChunk(std::string& output, engine::Deadline);
 
+  /// @brief Feeds the rest of the body into the JSON SAX `parser` while it is
+  /// received, see formats::json::parser.
+  ///
+  /// The body is decoded by the HTTP client and is never kept in memory as a
+  /// whole, so big JSON responses could be parsed into the typed objects
+  /// without keeping both the text and the formats::json::Value.
+  /// @code
+  /// std::vector<int64_t> result;
+  /// formats::json::parser::Int64Parser int_parser;
+  /// formats::json::parser::ArrayParser<int64_t,
+  ///     formats::json::parser::Int64Parser> parser(int_parser);
+  /// formats::json::parser::SubscriberSink<std::vector<int64_t>> sink(result);
+  /// parser.Reset();
+  /// parser.Subscribe(sink);
+  /// stream_response.ReadJson(parser, deadline);
+  /// @endcode
+  /// @throws formats::json::parser::ParseError on invalid JSON or if the body
+  /// is not received completely until the `deadline`
+  /// @note may block while the body is not received yet.
+  void ReadJson(formats::json::parser::BaseParser& parser,
+                engine::Deadline deadline);
+
   /// @cond
   StreamedResponse(engine::Future<void>&& headers_future,
                    Queue::Consumer&& queue_consumer,
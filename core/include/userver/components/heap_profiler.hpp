@@ -0,0 +1,104 @@
+#pragma once
+
+/// @file userver/components/heap_profiler.hpp
+/// @brief @copybrief components::HeapProfiler
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/components/component_fwd.hpp>
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component for continuous jemalloc heap profiling.
+///
+/// Activates the jemalloc allocation sampling at a low rate, periodically
+/// dumps the heap profile into a directory and reports the functions that
+/// hold the most of the sampled memory as metrics.
+///
+/// The service has to be started with `MALLOC_CONF=prof:true,prof_active:false`
+/// environment variable, otherwise the component logs a warning and does
+/// nothing.
+///
+/// The dumps are named `heap.<UTC time>.prof`, the oldest ones are removed
+/// when there are more than `max-dumps` of them. Two dumps show what has
+/// grown in between:
+///
+/// @code
+/// jeprof --base=heap.20240101T100000.prof /path/to/service heap.20240101T110000.prof
+/// @endcode
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// fs-task-processor | Task processor to dump and parse heap profiles on | -
+/// dump-directory | Directory to write the heap profiles into | -
+/// lg-sample | An allocation is sampled every 2^lg-sample bytes on average | 21
+/// dump-interval | Interval between the heap profile dumps | 10m
+/// max-dumps | How many latest heap profiles to keep in the directory | 24
+/// top-sites | How many allocation sites to report as metrics | 10
+///
+/// ## Static configuration example:
+///
+/// @code
+/// heap-profiler:
+///     fs-task-processor: fs-task-processor
+///     dump-directory: /var/cache/service/heap-profiles
+///     dump-interval: 30m
+/// @endcode
+
+// clang-format on
+
+class HeapProfiler final : public LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::HeapProfiler
+  static constexpr std::string_view kName = "heap-profiler";
+
+  HeapProfiler(const ComponentConfig&, const ComponentContext&);
+  ~HeapProfiler() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  struct Site {
+    std::string name;
+    std::uint64_t objects{0};
+    std::uint64_t bytes{0};
+  };
+
+  void DumpProfile();
+  void RemoveOldDumps();
+  void ExtendStatistics(utils::statistics::Writer& writer);
+
+  const std::string dump_directory_;
+  const std::size_t max_dumps_;
+  const std::size_t top_sites_count_;
+  bool is_active_{false};
+
+  rcu::Variable<std::vector<Site>> top_sites_;
+  utils::statistics::RateCounter dumps_;
+  utils::statistics::RateCounter dump_errors_;
+
+  utils::PeriodicTask dump_task_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<HeapProfiler> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
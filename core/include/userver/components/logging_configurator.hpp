@@ -8,11 +8,13 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 struct DynamicDebugConfig;
+struct LogSamplingConfig;
 }
 
 namespace components {
@@ -28,8 +30,21 @@ namespace components {
 ///
 /// ## Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
+/// * @ref USERVER_LOG_SAMPLING
 /// * @ref USERVER_NO_LOG_SPANS
 ///
+/// ## Log sampling
+/// @ref USERVER_LOG_SAMPLING keeps only a part of the messages of the chosen
+/// levels and log locations. The messages that are sampled out are not
+/// formatted at all. Inside of a tracing::Span the decision depends on the
+/// trace id only, so a request is either logged completely or not at all at
+/// the same ratio; other messages are sampled at random. The messages of
+/// the @ref USERVER_LOG_DYNAMIC_DEBUG `force-enabled` locations are never
+/// sampled out.
+///
+/// The count of sampled out messages per location is reported in the
+/// `logger.sampling.sampled_out` metric.
+///
 /// ## Static options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
@@ -56,9 +71,12 @@ class LoggingConfigurator final : public impl::ComponentBase {
 
  private:
   void OnConfigUpdate(const dynamic_config::Snapshot& config);
+  void UpdateLogSampling(const logging::LogSamplingConfig& sampling);
 
   concurrent::AsyncEventSubscriberScope config_subscription_;
   rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+  rcu::Variable<logging::LogSamplingConfig> log_sampling_;
+  utils::statistics::Entry statistics_holder_;
 };
 
 /// }@
@@ -33,11 +33,20 @@ class Manager;
 /// coro_pool.initial_size | amount of coroutines to preallocate on startup | -
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | -
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
+/// coro_pool.local_cache_size | max amount of idle coroutines to keep in a per-thread cache, 0 to disable the caches | 32
+/// coro_pool.stack_reclaim_idle_threshold | return the stack memory of coroutines that were idle for longer than this to the OS, 0 to disable | 0
+/// coro_pool.small_stack_size | size of a coroutine for tasks started with engine::StackSizeClass::kSmall, bytes, 0 to use coro_pool.stack_size | 0
+/// coro_pool.large_stack_size | size of a coroutine for tasks started with engine::StackSizeClass::kLarge, bytes, 0 to use coro_pool.stack_size | 0
+/// coro_pool.stack_usage_sampling_period | measure the max stack usage of every N-th task and report it per task type in metrics, 0 to disable; expensive, for choosing the stack sizes only | 0
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | -
+/// event_thread_pool.cpu_affinity | pin the ev threads to CPUs, see `cpu-affinity` of task processors below | -
+/// event_thread_pool.io_backend | `libev` to perform socket I/O with nonblocking syscalls on readiness, `io_uring` to submit it to the kernel via a per ev thread io_uring (falls back to `libev` if the kernel does not support it) | libev
+/// event_thread_pool.io_uring_entries | size of the io_uring submission queue of each ev thread | 256
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
 /// mlock_debug_info | whether to mlock(2) process debug info to prevent major page faults on unwinding | true
+/// caches_startup_concurrency | max number of caches loading a dump or performing the first update at the same time, 0 for no limit, see @ref scripts/docs/en/userver/caches.md | 0
 ///
 /// ## Static task_processor options:
 /// Name | Description | Default value
@@ -47,6 +56,15 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 10000
+/// task-processor-queue | task queue implementation: 'global-task-queue' shares a single queue between all the workers, 'work-stealing-task-queue' gives each worker a local queue and lets idle workers steal tasks from others | global-task-queue
+/// high-priority-weight | number of engine::TaskPriority::kHigh tasks a worker takes in a row from the 'global-task-queue' before it takes an engine::TaskPriority::kNormal task, so that the normal tasks are not starved | 8
+/// cpu-affinity | optional dictionary of CPU pinning options | empty (disabled)
+/// cpu-affinity.cpus | CPU list to pin the threads to, e.g. "0-15,32-47" | -
+/// cpu-affinity.numa-node | pin the threads to all the CPUs of the NUMA node, conflicts with `cpus` | -
+/// cpu-affinity.pin-each-thread | pin each thread to a single CPU of the set in round-robin manner instead of letting it run on any CPU of the set | false
+/// task-time-accounting | account the time the tasks spend running, in the queue and waiting on mutexes, futures, I/O and sleeps; reported per span name in the `engine.task-processors.span-timings` metrics | false
+/// jemalloc.tcache | enable or disable the jemalloc thread caches of the worker threads | the allocator default
+/// jemalloc.arenas | number of jemalloc arenas not shared with the other threads; the worker threads are spread over them in round-robin manner and the arenas statistics are reported in the `engine.task-processors.jemalloc-arenas` metrics; 0 to use the shared arenas | 0
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -3,6 +3,8 @@
 /// @file userver/components/tcp_acceptor_base.hpp
 /// @brief @copybrief components::TcpAcceptorBase
 
+#include <functional>
+
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -52,6 +54,11 @@ class TcpAcceptorBase : public LoggableComponentBase {
   /// each new socket.
   virtual void ProcessSocket(engine::io::Socket&& sock) = 0;
 
+  /// Runs the function in a new coroutine on `sockets_task_processor`. The
+  /// coroutine is cancelled along with the ones running ProcessSocket when
+  /// the component is stopping.
+  void DetachSocketTask(std::function<void()> function);
+
  private:
   TcpAcceptorBase(const ComponentConfig& config,
                   const ComponentContext& context,
@@ -0,0 +1,164 @@
+#pragma once
+
+/// @file userver/components/tcp_connections_acceptor_base.hpp
+/// @brief @copybrief components::TcpConnectionsAcceptorBase
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <userver/components/tcp_acceptor_base.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+class Poller;
+}  // namespace engine::io
+
+namespace components {
+
+namespace impl {
+class TcpBufferPool;
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_base_classes userver_components
+///
+/// @brief Component for serving many long-lived TCP connections.
+///
+/// Unlike components::TcpAcceptorBase, a connection does not hold a coroutine
+/// for its whole lifetime. The data is read in a coroutine while it keeps
+/// arriving, a connection that has been idle for `keep-warm-timeout` is
+/// parked: its coroutine and read buffer are released, and a single task
+/// waits for the data on all the parked connections at once.
+///
+/// The data is sent by Connection::SendAll, which may be called from any task
+/// concurrently with the reads.
+///
+/// Read and write buffers come from a pool of the `buffer-sizes` size
+/// classes, see Connection::AcquireBuffer.
+///
+/// ## Static options:
+/// All the options of components::TcpAcceptorBase and
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// buffer-sizes | size classes of the pooled buffers, in bytes | [4096, 65536]
+/// max-pooled-buffers | how many free buffers of each size class to keep | 1024
+/// read-buffer-size | size of the buffer to read the data into | 4096
+/// keep-warm-timeout | how long to keep the coroutine of an idle connection before parking it | 100ms
+
+// clang-format on
+class TcpConnectionsAcceptorBase : public TcpAcceptorBase {
+ public:
+  /// Buffer from the pool, returned there on destruction
+  class Buffer final {
+   public:
+    Buffer(Buffer&&) noexcept;
+    Buffer& operator=(Buffer&&) noexcept;
+    ~Buffer();
+
+    char* Data() noexcept { return data_.get(); }
+    std::size_t Size() const noexcept { return size_; }
+
+   private:
+    friend class impl::TcpBufferPool;
+
+    Buffer(std::unique_ptr<char[]> data, std::size_t size,
+           impl::TcpBufferPool& pool) noexcept;
+
+    std::unique_ptr<char[]> data_;
+    std::size_t size_;
+    impl::TcpBufferPool* pool_;
+  };
+
+  /// Accepted TCP connection
+  class Connection final {
+   public:
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    ~Connection();
+
+    /// Unique id of the connection within the component
+    std::uint64_t Id() const noexcept { return id_; }
+
+    /// @brief Sends the data, may be called concurrently from any tasks.
+    /// @returns false if the connection is closed or the peer has closed it
+    bool SendAll(const void* buf, std::size_t len, engine::Deadline deadline);
+
+    /// @brief Acquires a buffer of at least `size` bytes from the pool.
+    /// @note The buffers larger than the largest size class are not pooled.
+    Buffer AcquireBuffer(std::size_t size);
+
+    /// @brief Closes the connection, the pending and future SendAll calls
+    /// fail and ProcessData is not called any more.
+    void Close() noexcept;
+
+    bool IsClosed() const noexcept { return is_closed_; }
+
+   private:
+    friend class TcpConnectionsAcceptorBase;
+
+    Connection(engine::io::Socket&& socket, std::uint64_t id,
+               impl::TcpBufferPool& pool);
+
+    // called by the reading coroutine only
+    void DoClose() noexcept;
+
+    engine::io::Socket socket_;
+    const std::uint64_t id_;
+    impl::TcpBufferPool& pool_;
+    engine::Mutex write_mutex_;
+    std::atomic<bool> is_closed_{false};
+  };
+
+  TcpConnectionsAcceptorBase(const ComponentConfig&, const ComponentContext&);
+  ~TcpConnectionsAcceptorBase() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Called once for each accepted connection before any ProcessData.
+  virtual void OnConnectionOpened(
+      const std::shared_ptr<Connection>& connection);
+
+  /// @brief Override this function to process the data read from the
+  /// connection.
+  /// @returns false to close the connection
+  /// @warning The function is called concurrently from multiple threads for
+  /// different connections, but never concurrently for the same one.
+  virtual bool ProcessData(const std::shared_ptr<Connection>& connection,
+                           std::string_view data) = 0;
+
+  /// Called once the connection is closed.
+  virtual void OnConnectionClosed(const Connection& connection) noexcept;
+
+ private:
+  void ProcessSocket(engine::io::Socket&& sock) final;
+
+  void ServeConnection(std::shared_ptr<Connection> connection);
+  void Park(std::shared_ptr<Connection> connection);
+  void KeepParking();
+
+  const std::size_t read_buffer_size_;
+  const std::chrono::milliseconds keep_warm_timeout_;
+  const std::unique_ptr<impl::TcpBufferPool> buffer_pool_;
+
+  const std::unique_ptr<engine::io::Poller> poller_;
+  concurrent::Variable<std::vector<std::shared_ptr<Connection>>>
+      connections_to_park_;
+  std::atomic<bool> is_parking_started_{false};
+  std::atomic<std::uint64_t> last_connection_id_{0};
+};
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,11 @@
 /// @file userver/concurrent/async_event_channel.hpp
 /// @brief @copybrief concurrent::AsyncEventChannel
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <typeindex>
@@ -14,18 +18,60 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/concurrent/variable.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace concurrent {
 
+/// @brief Delivery settings of the events of concurrent::AsyncEventChannel
+struct AsyncEventChannelSettings final {
+  /// Max number of listeners that handle an event concurrently, 0 starts all
+  /// the listeners at once
+  std::size_t max_parallelism{0};
+
+  /// A listener that handles an event for longer is reported to logs each
+  /// `warn_timeout`
+  std::chrono::milliseconds warn_timeout{std::chrono::seconds{30}};
+};
+
 namespace impl {
 
-void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task);
+void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task,
+                 std::chrono::milliseconds warn_timeout);
+
+/// Time spent by the listeners of a channel on handling the events, by the
+/// listener name. Different listeners may have the same name, their
+/// statistics are aggregated while at least one of them is subscribed.
+class ListenersStatistics final {
+ public:
+  void Add(std::string_view listener_name);
+
+  void Account(std::string_view listener_name,
+               std::chrono::steady_clock::duration handling_time);
+
+  void Remove(std::string_view listener_name) noexcept;
+
+  void Write(utils::statistics::Writer& writer,
+             std::string_view channel_name) const;
+
+ private:
+  struct Timings final {
+    std::size_t listeners{0};
+    std::uint64_t events{0};
+    std::chrono::steady_clock::duration total{};
+    std::chrono::steady_clock::duration last{};
+  };
+
+  concurrent::Variable<std::unordered_map<std::string, Timings>, std::mutex>
+      timings_;
+};
 
 [[noreturn]] void ReportAlreadySubscribed(std::string_view channel_name,
                                           std::string_view listener_name);
@@ -135,29 +181,62 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
   /// Strict FIFO serialization is guaranteed, i.e. only after this event is
   /// processed a new event may be delivered for the subscribers, same
   /// listener/subscriber is never called concurrently.
+  ///
+  /// Different listeners handle the event concurrently, at most
+  /// AsyncEventChannelSettings::max_parallelism of them at a time.
   void SendEvent(Args... args) const {
     std::lock_guard lock(event_mutex_);
     auto data = data_.Lock();
     auto& listeners = data->listeners;
+    if (listeners.empty()) return;
+
+    engine::Semaphore parallelism{settings_.max_parallelism != 0
+                                      ? settings_.max_parallelism
+                                      : listeners.size()};
 
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(listeners.size());
 
     for (const auto& [_, listener] : listeners) {
-      tasks.push_back(utils::Async(
-          listener.task_name,
-          [&, &callback = listener.callback] { callback(args...); }));
+      tasks.push_back(
+          utils::Async(listener.task_name, [&, &listener = listener] {
+            const std::shared_lock slot(parallelism);
+            const auto start = std::chrono::steady_clock::now();
+            const utils::FastScopeGuard account([&]() noexcept {
+              try {
+                statistics_.Account(listener.name,
+                                    std::chrono::steady_clock::now() - start);
+              } catch (const std::exception&) {
+                // statistics are not worth failing the listener
+              }
+            });
+            listener.callback(args...);
+          }));
     }
 
     std::size_t i = 0;
     for (const auto& [_, listener] : listeners) {
-      impl::WaitForTask(listener.name, tasks[i++]);
+      impl::WaitForTask(listener.name, tasks[i++], settings_.warn_timeout);
     }
   }
 
+  /// Changes the delivery settings, the event that is being sent (if any) is
+  /// delivered with the old ones
+  void SetSettings(const AsyncEventChannelSettings& settings) {
+    std::lock_guard lock(event_mutex_);
+    settings_ = settings;
+  }
+
   /// @returns the name of this event channel
   const std::string& Name() const noexcept { return name_; }
 
+  /// @brief Writes the count and the duration of the event handling by each
+  /// listener, labeled by the channel and the listener names
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const AsyncEventChannel& channel) {
+    channel.statistics_.Write(writer, channel.name_);
+  }
+
  private:
   struct Listener final {
     std::string name;
@@ -193,6 +272,7 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
             iter->second.name);
       }
     }
+    statistics_.Remove(iter->second.name);
     listeners.erase(iter);
   }
 
@@ -201,15 +281,21 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
     auto data = data_.Lock();
     auto& listeners = data->listeners;
     auto task_name = impl::MakeAsyncChannelName(name_, name);
+    statistics_.Add(name);
     const auto [iterator, success] = listeners.emplace(
         id, Listener{std::string{name}, std::move(func), std::move(task_name)});
-    if (!success) impl::ReportAlreadySubscribed(Name(), name);
+    if (!success) {
+      statistics_.Remove(name);
+      impl::ReportAlreadySubscribed(Name(), name);
+    }
     return AsyncEventSubscriberScope(*this, id);
   }
 
   const std::string name_;
   concurrent::Variable<ListenersData> data_;
   mutable engine::Mutex event_mutex_;
+  AsyncEventChannelSettings settings_;
+  mutable impl::ListenersStatistics statistics_;
 };
 
 }  // namespace concurrent
@@ -0,0 +1,79 @@
+#pragma once
+
+/// @file userver/concurrent/background_job_queue.hpp
+/// @brief @copybrief concurrent::BackgroundJobQueue
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Runs jobs in a fixed set of long-living background tasks that pull
+/// the jobs from a bounded queue.
+///
+/// A cheaper alternative to concurrent::BackgroundTaskStorage for lots of
+/// small jobs, e.g. a job per request: no task, coroutine or tracing::Span is
+/// created for a job, and the number of concurrently running and waiting jobs
+/// is limited.
+///
+/// The jobs are not run in any particular order. An exception that escapes a
+/// job is logged. engine::TaskInheritedVariable instances are not inherited
+/// from the caller.
+///
+/// Like concurrent::BackgroundTaskStorage, the queue cancels and waits for the
+/// running jobs on CancelAndWait or destruction, the jobs that have not
+/// started yet are dropped. You must guarantee that the resources used by the
+/// jobs are available while the queue is alive.
+///
+/// ## Usage synopsis
+/// @snippet concurrent/background_job_queue_test.cpp  Sample
+class BackgroundJobQueue final {
+ public:
+  using Job = std::function<void()>;
+
+  /// Starts `workers_count` tasks in the `task_processor` that run the jobs,
+  /// at most `max_queue_size` jobs may wait to be run.
+  BackgroundJobQueue(engine::TaskProcessor& task_processor, std::string name,
+                     std::size_t workers_count, std::size_t max_queue_size);
+
+  BackgroundJobQueue(BackgroundJobQueue&&) = delete;
+  BackgroundJobQueue& operator=(BackgroundJobQueue&&) = delete;
+  ~BackgroundJobQueue();
+
+  /// @brief Queues the job for execution in a background task.
+  /// @returns `false` if the queue is full, the job is not run in this case.
+  [[nodiscard]] bool TryPush(Job job);
+
+  /// Explicitly cancel and wait for the jobs. New jobs must not be pushed
+  /// after this call returns. Should be called no more than once.
+  void CancelAndWait() noexcept;
+
+  /// Approximate number of the jobs waiting to be run
+  std::size_t QueueSizeApprox() const noexcept;
+
+ private:
+  using Queue = NonFifoMpmcQueue<Job>;
+
+  void RunWorker(Queue::Consumer consumer) const;
+
+  const std::string name_;
+  const std::shared_ptr<Queue> queue_;
+  std::optional<Queue::MultiProducer> producer_;
+  std::vector<engine::TaskWithResult<void>> workers_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
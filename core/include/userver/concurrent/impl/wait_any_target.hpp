@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <userver/engine/impl/context_accessor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// Used by concurrent queues. Allows engine::WaitAny to sleep until one of the
+// queues has an element to pop. The queue provides IsReady() and calls
+// WakeupWaiters() after each push, which is cheap while nobody waits.
+class WaitAnyTarget : public engine::impl::ContextAccessor {
+ public:
+  WaitAnyTarget() noexcept;
+
+  WaitAnyTarget(const WaitAnyTarget&) = delete;
+  WaitAnyTarget& operator=(const WaitAnyTarget&) = delete;
+
+  void WakeupWaiters();
+
+ protected:
+  ~WaitAnyTarget();
+
+ private:
+  void AppendWaiter(engine::impl::TaskContext& context) noexcept final;
+  void RemoveWaiter(engine::impl::TaskContext& context) noexcept final;
+  void RethrowErrorResult() const final;
+
+  // A task in engine::WaitAny waits for several queues at once, so the
+  // intrusive engine wait lists do not fit here
+  std::atomic<std::size_t> waiters_count_{0};
+  std::mutex waiters_mutex_;
+  std::vector<engine::impl::TaskContext*> waiters_;
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
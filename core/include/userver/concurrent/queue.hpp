@@ -1,12 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
+#include <userver/concurrent/impl/wait_any_target.hpp>
 #include <userver/concurrent/queue_helpers.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/semaphore.hpp>
@@ -97,7 +101,8 @@ class GenericQueue final
       : queue_(),
         single_producer_token_(queue_),
         producer_side_(*this, std::min(max_size, kUnbounded)),
-        consumer_side_(*this) {}
+        consumer_side_(*this),
+        ready_to_pop_(*this) {}
 
   ~GenericQueue() {
     UASSERT(consumers_count_ == kCreatedAndDead || !consumers_count_);
@@ -200,6 +205,7 @@ class GenericQueue final
   class MultiProducerSide;
   class SingleConsumerSide;
   class MultiConsumerSide;
+  class ReadyToPopTarget;
 
   /// Proxy-class makes synchronization of Push operations in multi or single
   /// producer cases
@@ -223,11 +229,25 @@ class GenericQueue final
     return producer_side_.PushNoblock(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>& values,
+                              engine::Deadline deadline) {
+    if (values.empty()) return true;
+    return producer_side_.PushMany(token, values, deadline);
+  }
+
   template <typename Token>
   [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
     return consumer_side_.Pop(token, value, deadline);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_items,
+                                    engine::Deadline deadline) {
+    return consumer_side_.PopMany(token, values, max_items, deadline);
+  }
+
   template <typename Token>
   [[nodiscard]] bool PopNoblock(Token& token, T& value) {
     return consumer_side_.PopNoblock(token, value);
@@ -276,9 +296,14 @@ class GenericQueue final
         });
     if (new_producers_count == kCreatedAndDead) {
       consumer_side_.StopBlockingOnPop();
+      ready_to_pop_.WakeupWaiters();
     }
   }
 
+  engine::impl::ContextAccessor* GetReadyToPopAccessor() noexcept {
+    return &ready_to_pop_;
+  }
+
  public:  // TODO
   /// @cond
   bool NoMoreConsumers() const { return consumers_count_ == kCreatedAndDead; }
@@ -302,6 +327,27 @@ class GenericQueue final
     }
 
     consumer_side_.OnElementPushed();
+    ready_to_pop_.WakeupWaiters();
+  }
+
+  template <typename Token>
+  void DoPushMany(Token& token, std::vector<T>& values) {
+    const auto first = std::make_move_iterator(values.begin());
+    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, first, values.size());
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(first, values.size());
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_, first, values.size());
+    }
+
+    consumer_side_.OnElementsPushed(values.size());
+    ready_to_pop_.WakeupWaiters();
+    values.clear();
   }
 
   template <typename Token>
@@ -328,6 +374,47 @@ class GenericQueue final
     return false;
   }
 
+  // Appends up to `max_items` elements to `values`
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_items) {
+    if (max_items == 0) return 0;
+
+    const auto old_size = values.size();
+    values.resize(old_size + max_items);
+    auto first = values.begin() + old_size;
+    std::size_t count{};
+
+    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(token, first, max_items);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(first, max_items);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk_from_producer(single_producer_token_,
+                                                    first, max_items);
+    }
+
+    values.resize(old_size + count);
+    if (count != 0) {
+      producer_side_.OnElementPopped(
+          GetElementsSize(values.begin() + old_size, values.end()));
+    }
+    return count;
+  }
+
+  template <typename Iterator>
+  static std::size_t GetElementsSize(Iterator first, Iterator last) {
+    std::size_t result = 0;
+    for (; first != last; ++first) {
+      result += QueuePolicy::GetElementSize(*first);
+    }
+    return result;
+  }
+
   moodycamel::ConcurrentQueue<T> queue_{1};
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
@@ -336,6 +423,7 @@ class GenericQueue final
 
   ProducerSide producer_side_;
   ConsumerSide consumer_side_;
+  ReadyToPopTarget ready_to_pop_;
 
   static constexpr std::size_t kCreatedAndDead =
       std::numeric_limits<std::size_t>::max();
@@ -368,6 +456,18 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return DoPush(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>& values,
+                              engine::Deadline deadline) {
+    while (!DoPushMany(token, values)) {
+      if (queue_.NoMoreConsumers() ||
+          !non_full_event_.WaitForEventUntil(deadline)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -406,6 +506,21 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>& values) {
+    const std::size_t batch_size =
+        GetElementsSize(values.begin(), values.end());
+    if (queue_.NoMoreConsumers() ||
+        used_capacity_.load() + batch_size > total_capacity_.load()) {
+      return false;
+    }
+
+    used_capacity_.fetch_add(batch_size);
+    queue_.DoPushMany(token, values);
+    non_full_event_.Reset();
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -438,6 +553,17 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value));
   }
 
+  // Takes the capacity for the whole batch at once
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>& values,
+                              engine::Deadline deadline) {
+    const std::size_t batch_size =
+        GetElementsSize(values.begin(), values.end());
+    return remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                           batch_size) &&
+           DoPushMany(token, values, batch_size);
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -476,6 +602,19 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>& values,
+                                std::size_t batch_size) {
+    UASSERT(batch_size > 0);
+    if (queue_.NoMoreConsumers()) {
+      remaining_capacity_.unlock_shared_count(batch_size);
+      return false;
+    }
+
+    queue_.DoPushMany(token, values);
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore remaining_capacity_;
   concurrent::impl::SemaphoreCapacityControl remaining_capacity_control_;
@@ -508,11 +647,32 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_items,
+                                    engine::Deadline deadline) {
+    while (true) {
+      const auto count = DoPopMany(token, values, max_items);
+      if (count != 0) return count;
+
+      if (queue_.NoMoreProducers() ||
+          !nonempty_event_.WaitForEventUntil(deadline)) {
+        // Same TOCTOU as in Pop()
+        return DoPopMany(token, values, max_items);
+      }
+    }
+  }
+
   void OnElementPushed() {
     ++element_count_;
     nonempty_event_.Send();
   }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
+    nonempty_event_.Send();
+  }
+
   void StopBlockingOnPop() { nonempty_event_.Send(); }
 
   void ResumeBlockingOnPop() {}
@@ -530,6 +690,19 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_items) {
+    // Avoids resizing `values` to `max_items` when the queue holds less
+    const auto count = queue_.DoPopMany(
+        token, values, std::min(max_items, element_count_.load()));
+    if (count != 0) {
+      element_count_ -= count;
+      nonempty_event_.Reset();
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -561,8 +734,32 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
+  // Waits for a single element, then takes whatever else is available
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_items,
+                                    engine::Deadline deadline) {
+    if (max_items == 0 || !element_count_.try_lock_shared_until(deadline)) {
+      return 0;
+    }
+
+    std::size_t acquired = 1;
+    const auto available = std::min(max_items - 1, GetElementCount());
+    if (available != 0 && element_count_.try_lock_shared_count(available)) {
+      acquired += available;
+    }
+    while (acquired < max_items && element_count_.try_lock_shared()) {
+      ++acquired;
+    }
+    return DoPopMany(token, values, acquired);
+  }
+
   void OnElementPushed() { element_count_.unlock_shared(); }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
+
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
                                                kSemaphoreUnlockValue);
@@ -598,11 +795,44 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t acquired) {
+    std::size_t popped = 0;
+    while (popped != acquired) {
+      const auto count = queue_.DoPopMany(token, values, acquired - popped);
+      popped += count;
+      if (count == 0 && queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(acquired - popped);
+        break;
+      }
+      // See DoPop() on why the queue may appear empty
+    }
+    return popped;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
 };
 
+// Lets engine::WaitAny wait for the queue to have something to pop
+template <typename T, typename QueuePolicy>
+class GenericQueue<T, QueuePolicy>::ReadyToPopTarget final
+    : public impl::WaitAnyTarget {
+ public:
+  explicit ReadyToPopTarget(const GenericQueue& queue) noexcept
+      : queue_(queue) {}
+
+  bool IsReady() const noexcept override {
+    return queue_.consumer_side_.GetElementCount() != 0 ||
+           queue_.NoMoreProducers();
+  }
+
+ private:
+  const GenericQueue& queue_;
+};
+
 /// @ingroup userver_concurrency
 ///
 /// @brief Non FIFO multiple producers multiple consumers queue.
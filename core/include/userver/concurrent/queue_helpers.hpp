@@ -1,11 +1,18 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::impl {
+class ContextAccessor;
+}  // namespace engine::impl
+
 namespace concurrent {
 
 namespace impl {
@@ -63,6 +70,19 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push all the `values` into queue at once, waking up the consumers only
+  /// once. May wait asynchronously until the queue has room for the whole
+  /// batch. Leaves the `values` unmodified if the operation does not succeed
+  /// and clears them otherwise.
+  /// @returns whether push succeeded before the deadline and before the task
+  /// was canceled.
+  /// @note A batch that is larger than the queue max size is never pushed.
+  [[nodiscard]] bool PushMany(std::vector<ValueType>&& values,
+                              engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushMany(token_, values, deadline);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -124,12 +144,29 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_items` elements from queue and append them to `values`.
+  /// May wait asynchronously until there is at least one element, but does
+  /// not wait for the rest of the batch.
+  /// @returns the number of elements popped, `0` has the same meaning as
+  /// `false` from `Pop`.
+  [[nodiscard]] std::size_t PopMany(std::vector<ValueType>& values,
+                                    std::size_t max_items,
+                                    engine::Deadline deadline = {}) const {
+    return queue_->PopMany(token_, values, max_items, deadline);
+  }
+
   /// Const access to source queue.
   [[nodiscard]] std::shared_ptr<const QueueType> Queue() const {
     return {queue_};
   }
 
   /// @cond
+  // Internal helper for WaitAny, ready when there is something to pop or the
+  // producers are dead
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept {
+    return queue_ ? queue_->GetReadyToPopAccessor() : nullptr;
+  }
+
   // For internal use only
   Consumer(std::shared_ptr<QueueType> queue, EmplaceEnablerType /*unused*/)
       : queue_(std::move(queue)), token_(queue_->queue_) {}
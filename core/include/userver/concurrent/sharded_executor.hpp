@@ -0,0 +1,133 @@
+#pragma once
+
+/// @file userver/concurrent/sharded_executor.hpp
+/// @brief @copybrief concurrent::ShardedExecutor
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/single_threaded_task_processors_pool.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+namespace impl {
+
+class ShardedJob {
+ public:
+  virtual ~ShardedJob();
+
+  virtual void Run() = 0;
+};
+
+template <typename Function>
+class ShardedJobImpl final : public ShardedJob {
+ public:
+  explicit ShardedJobImpl(Function&& func) : func_(std::move(func)) {}
+
+  void Run() override { func_(); }
+
+ private:
+  Function func_;
+};
+
+template <typename Function>
+std::unique_ptr<ShardedJob> MakeShardedJob(Function&& func) {
+  return std::make_unique<ShardedJobImpl<std::decay_t<Function>>>(
+      std::decay_t<Function>(std::forward<Function>(func)));
+}
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Runs the jobs posted with the same key one after another on the same
+/// task processor of engine::SingleThreadedTaskProcessorsPool
+///
+/// Each task processor of the pool is a shard with a bounded FIFO mailbox and
+/// a single task that takes the jobs from the mailbox in batches and runs them
+/// in the order of posting. The jobs of a shard never run concurrently and
+/// always run on the same thread, so the state that is only touched by the
+/// jobs of a single key needs no mutexes.
+///
+/// Exceptions thrown by the jobs are logged and ignored.
+///
+/// ## Example usage:
+///
+/// @snippet concurrent/sharded_executor_test.cpp  Sample concurrent::ShardedExecutor usage
+class ShardedExecutor final {
+ public:
+  struct Settings final {
+    /// Max number of jobs waiting in the mailbox of a shard
+    std::size_t max_mailbox_size{10000};
+
+    /// Max number of jobs that are run before yielding to the other tasks of
+    /// the shard task processor
+    std::size_t max_batch_size{64};
+  };
+
+  ShardedExecutor(engine::SingleThreadedTaskProcessorsPool& pool,
+                  Settings settings);
+
+  ShardedExecutor(ShardedExecutor&&) = delete;
+  ShardedExecutor& operator=(ShardedExecutor&&) = delete;
+
+  /// Runs the jobs remaining in the mailboxes and waits for them
+  ~ShardedExecutor();
+
+  /// @returns the number of shards, equal to the size of the pool
+  std::size_t GetShardsCount() const noexcept { return shards_.size(); }
+
+  /// @returns the index of the shard that runs the jobs for `key`
+  template <typename Key>
+  std::size_t GetShardIndex(const Key& key) const {
+    return std::hash<Key>{}(key) % shards_.size();
+  }
+
+  /// @brief Puts `func` into the mailbox of the `key` shard, waiting for room
+  /// in the mailbox if it is full
+  /// @returns whether the job was posted before the deadline and before the
+  /// task was cancelled
+  template <typename Key, typename Function>
+  [[nodiscard]] bool Post(const Key& key, Function&& func,
+                          engine::Deadline deadline = {}) {
+    return DoPost(GetShardIndex(key),
+                  impl::MakeShardedJob(std::forward<Function>(func)),
+                  deadline);
+  }
+
+  /// @brief Puts `func` into the mailbox of the `key` shard without waiting
+  /// @returns false if the mailbox is full
+  template <typename Key, typename Function>
+  [[nodiscard]] bool TryPost(const Key& key, Function&& func) {
+    return DoTryPost(GetShardIndex(key),
+                     impl::MakeShardedJob(std::forward<Function>(func)));
+  }
+
+  /// @brief Writes the mailbox size, the counts of the posted, rejected and
+  /// processed jobs and of the batches, labeled by the shard index
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ShardedExecutor& executor);
+
+ private:
+  class Shard;
+
+  bool DoPost(std::size_t shard_index, std::unique_ptr<impl::ShardedJob>&& job,
+              engine::Deadline deadline);
+
+  bool DoTryPost(std::size_t shard_index,
+                 std::unique_ptr<impl::ShardedJob>&& job);
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
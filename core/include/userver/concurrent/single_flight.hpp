@@ -0,0 +1,135 @@
+#pragma once
+
+/// @file userver/concurrent/single_flight.hpp
+/// @brief @copybrief concurrent::SingleFlight
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// Statistics of a concurrent::SingleFlight, the coalescing ratio is
+/// `coalesced / calls`
+struct SingleFlightStatistics final {
+  /// Execute() calls
+  utils::statistics::RateCounter calls;
+  /// Execute() calls that joined a computation already in flight
+  utils::statistics::RateCounter coalesced;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const SingleFlightStatistics& stats);
+
+/// @ingroup userver_concurrency
+///
+/// @brief Shares one in-flight computation between the concurrent callers
+/// with the same key, e.g. identical requests to a database.
+///
+/// The first Execute() for a key starts the function in a utils::SharedAsync
+/// task, the callers with the same key that come before it finishes wait for
+/// the same result or exception. The result is not cached: a call after the
+/// computation finished starts a new one.
+///
+/// Cancellation follows engine::SharedTaskWithResult: a cancelled caller stops
+/// waiting with engine::WaitInterruptedException, the computation itself is
+/// cancelled once all its callers are gone.
+///
+/// ## Example usage:
+///
+/// @snippet concurrent/single_flight_test.cpp  Sample SingleFlight usage
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class SingleFlight final {
+ public:
+  /// @param task_name name of the computation tasks to show in logs
+  explicit SingleFlight(std::string task_name = "single-flight")
+      : task_name_(std::move(task_name)) {}
+
+  ~SingleFlight() {
+    UASSERT_MSG(flights_.empty(),
+                "SingleFlight is destroyed while someone waits for a result");
+  }
+
+  /// @brief Returns the result of `func`, shared with the concurrent callers
+  /// with the same key.
+  /// @throws anything `func` throws
+  /// @throws engine::WaitInterruptedException if the current task is
+  /// cancelled while waiting
+  template <typename Function>
+  Value Execute(const Key& key, Function&& func);
+
+  const SingleFlightStatistics& GetStatistics() const { return stats_; }
+
+ private:
+  struct Flight final {
+    engine::SharedTaskWithResult<Value> task;
+    std::size_t waiters{0};
+  };
+  using FlightPtr = std::shared_ptr<Flight>;
+
+  void Leave(const Key& key, FlightPtr& flight) noexcept;
+
+  const std::string task_name_;
+  engine::Mutex mutex_;
+  std::unordered_map<Key, FlightPtr, Hash, Equal> flights_;
+  SingleFlightStatistics stats_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename Function>
+Value SingleFlight<Key, Value, Hash, Equal>::Execute(const Key& key,
+                                                     Function&& func) {
+  FlightPtr flight;
+  {
+    std::lock_guard lock(mutex_);
+    ++stats_.calls;
+    const auto it = flights_.find(key);
+    if (it != flights_.end()) {
+      ++stats_.coalesced;
+      flight = it->second;
+    } else {
+      flight = std::make_shared<Flight>();
+      flight->task =
+          utils::SharedAsync(task_name_, std::forward<Function>(func));
+      flights_.emplace(key, flight);
+    }
+    ++flight->waiters;
+  }
+
+  const utils::FastScopeGuard leave([&]() noexcept { Leave(key, flight); });
+  return flight->task.Get();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void SingleFlight<Key, Value, Hash, Equal>::Leave(const Key& key,
+                                                  FlightPtr& flight) noexcept {
+  {
+    std::lock_guard lock(mutex_);
+    --flight->waiters;
+    // Later calls start a new computation once this one is done
+    if (flight->waiters == 0 || flight->task.IsFinished()) {
+      const auto it = flights_.find(key);
+      if (it != flights_.end() && it->second == flight) flights_.erase(it);
+    }
+  }
+  // The last caller cancels the computation and waits for it outside the lock
+  flight.reset();
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include <userver/congestion_control/controllers/gradient_config.hpp>
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/utils/smoothed_value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// @brief Controller that limits the load once the timings grow compared to
+/// the long term timings.
+///
+/// The limit is multiplied by the gradient
+/// `clamp(tolerance * long_timings / timings, 0.5, 1)` each step while the
+/// timings are too high or there are too many errors. Otherwise the limit grows
+/// by the square root of itself and is removed once the load falls below it.
+/// Both changes are smoothed, so a single slow step does not halve the limit.
+///
+/// The load that never slows down the timings is never limited.
+class GradientController final : public Controller {
+ public:
+  using StaticConfig = Controller::Config;
+
+  GradientController(
+      const std::string& name, v2::Sensor& sensor, Limiter& limiter,
+      Stats& stats, const StaticConfig& config,
+      dynamic_config::Source config_source,
+      std::function<GradientConfig(const dynamic_config::Snapshot&)>
+          config_getter);
+
+  Limit Update(const Sensor::Data& current) override;
+
+ private:
+  utils::SmoothedValue<int64_t> current_load_;
+  utils::SmoothedValue<int64_t> long_timings_;
+  std::optional<double> limit_;
+  std::size_t epochs_passed_{0};
+
+  dynamic_config::Source config_source_;
+  std::function<GradientConfig(const dynamic_config::Snapshot&)>
+      config_getter_;
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/formats/json_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// Dynamic options of the congestion_control::v2::GradientController
+struct GradientConfig {
+  bool enabled{true};
+  /// The limit is decreased once the timings grow this many times compared
+  /// to the long term timings
+  double tolerance{2.0};
+  double errors_threshold_percent{5.0};
+  /// Lower bound of the long term timings, so that jitter of the quick
+  /// requests does not activate the limit
+  std::chrono::milliseconds min_timings{20};
+  std::size_t min_limit{10};
+  std::size_t min_qps{10};
+  /// The limit is removed once it exceeds the load by this value
+  std::size_t safe_delta_limit{10};
+};
+
+GradientConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<GradientConfig>);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -24,6 +24,9 @@ struct Config {
   std::chrono::milliseconds min_timings{20};
   std::size_t min_limit{10};
   std::size_t min_qps{10};
+  // Percent of the operations waiting inside of the server that signals
+  // the server overload, see v2::Sensor::Data::server_wait_percent
+  double server_wait_threshold_percent{50.0};
 };
 
 }  // namespace congestion_control::v2
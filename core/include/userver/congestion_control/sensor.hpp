@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <optional>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
@@ -40,6 +41,10 @@ class Sensor {
 
     std::size_t current_load{0};
 
+    /// Percent of the operations that wait inside of the server, e.g. for
+    /// locks, as reported by the server itself; std::nullopt if unknown
+    std::optional<double> server_wait_percent;
+
     double GetRate() const {
       return static_cast<double>(timeouts) / (total ? total : 1);
     }
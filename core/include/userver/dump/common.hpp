@@ -8,10 +8,12 @@
 
 #include <chrono>
 #include <cstdint>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -39,8 +41,27 @@ namespace dump {
 /// @brief Reads the rest of the data from `reader`
 std::string ReadEntire(Reader& reader);
 
+/// @brief Writes the size and the raw bytes of `values` in a single
+/// operation, for flat layouts like sorted arrays or string pools
+///
+/// The elements are written in the little-endian byte order of the host, only
+/// little-endian hosts are supported.
+/// @warning The in-memory layout of `T` becomes a part of the dump format,
+/// `format-version` must be bumped on any change of it
+template <typename T>
+void WriteTriviallyCopyableArray(Writer& writer, const std::vector<T>& values);
+
+/// @brief Reads the data written by `WriteTriviallyCopyableArray` with a
+/// single bulk read into the storage of the result
+template <typename T>
+std::vector<T> ReadTriviallyCopyableArray(Reader& reader);
+
 namespace impl {
 
+// The raw bytes of the trivially copyable arrays are not byte-swapped
+inline constexpr bool kIsLittleEndianHost =
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+
 /// @brief Helpers for serialization of trivially-copyable types
 template <typename T>
 void WriteTrivial(Writer& writer, T value) {
@@ -227,6 +248,35 @@ void Write(Writer& writer, const formats::json::Value& value);
 /// @brief formats::json::Value deserialization support
 formats::json::Value Read(Reader& reader, To<formats::json::Value>);
 
+template <typename T>
+void WriteTriviallyCopyableArray(Writer& writer, const std::vector<T>& values) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  static_assert(impl::kIsLittleEndianHost,
+                "Trivially copyable arrays are dumped in the little-endian "
+                "byte order of the host");
+  writer.Write(values.size());
+  WriteStringViewUnsafe(
+      writer, std::string_view{reinterpret_cast<const char*>(values.data()),
+                               values.size() * sizeof(T)});
+}
+
+template <typename T>
+std::vector<T> ReadTriviallyCopyableArray(Reader& reader) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  static_assert(impl::kIsLittleEndianHost,
+                "Trivially copyable arrays are dumped in the little-endian "
+                "byte order of the host");
+  const auto size = reader.Read<std::size_t>();
+  if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+    throw Error("Too many elements in a trivially copyable array");
+  }
+
+  std::vector<T> values(size);
+  ReadUnsafeInto(reader, reinterpret_cast<char*>(values.data()),
+                 size * sizeof(T));
+  return values;
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
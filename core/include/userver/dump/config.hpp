@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -32,6 +33,17 @@ struct ConfigPatch final {
 ConfigPatch Parse(const formats::json::Value& value,
                   formats::parse::To<ConfigPatch>);
 
+struct CompressionConfig final {
+  /// `gzip` or `zstd`
+  std::string encoding;
+  /// Encoding specific level, the default one if not set
+  std::optional<int> level;
+  /// Blocks of this size are compressed independently
+  std::size_t block_size;
+  /// The number of blocks compressed or decompressed simultaneously
+  std::size_t parallel_blocks;
+};
+
 struct Config final {
   Config(std::string name, const yaml_config::YamlConfig& config,
          std::string_view dump_root);
@@ -45,6 +57,8 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool dump_is_memory_mapped;
+  std::optional<CompressionConfig> compression;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
@@ -85,9 +85,23 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `compression` | `object` | Compress the dump in independent blocks processed by several fs tasks in parallel, see below | no compression
+/// `memory-mapped` | `boolean` | Whether to read the dump through a memory mapping, incompatible with `encrypted` | `false`
 /// `first-update-mode` | `string` | specifies whether required or best-effort first update will be used | skip
 /// `first-update-type` | `string` | specifies whether incremental and/or full first update will be used | full
 ///
+/// Options of `compression`:
+///
+/// Name | Type | Description | Default value
+/// ---- | ---- | ----------- | -------------
+/// `encoding` | `string` | `gzip` or `zstd` | `zstd` if available, `gzip` otherwise
+/// `level` | `integer` | encoding specific compression level | the default of the encoding
+/// `block-size` | `integer` | size of the independently compressed blocks in bytes | 4194304
+/// `parallel-blocks` | `integer` | max number of blocks compressed or decompressed at the same time | 4
+///
+/// Enabling or disabling `compression` changes the format of dumps, so
+/// `format-version` should be bumped along with it.
+///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
 ///
@@ -168,7 +182,7 @@ class Dumper final {
          const components::ComponentContext& context, DumpableEntity& dumpable);
 
   class Impl;
-  utils::FastPimpl<Impl, 1056, 16> impl_;
+  utils::FastPimpl<Impl, 1200, 16> impl_;
 };
 
 }  // namespace dump
@@ -68,7 +68,15 @@ class Reader {
   /// @throws `Error` on read operation failure
   virtual std::string_view ReadRaw(std::size_t max_size) = 0;
 
+  /// @brief Reads exactly `size` bytes into `destination`
+  /// @note The default implementation copies the data returned by `ReadRaw`
+  /// in chunks, override it to avoid the intermediate buffer.
+  /// @throws `Error` on read operation failure or on end-of-file
+  virtual void ReadRawInto(char* destination, std::size_t size);
+
   friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
+  friend void ReadUnsafeInto(Reader& reader, char* destination,
+                             std::size_t size);
 };
 
 namespace impl {
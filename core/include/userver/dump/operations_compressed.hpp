@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+
+#include <userver/dump/config.hpp>
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Splits the data into blocks and compresses them in parallel tasks
+/// of the current task processor, writing the results to `base` in order.
+class CompressedWriter final : public Writer {
+ public:
+  CompressedWriter(std::unique_ptr<Writer> base,
+                   const CompressionConfig& config);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Reads the data written by `CompressedWriter`, decompressing the
+/// following blocks in parallel tasks of the current task processor.
+class CompressedReader final : public Reader {
+ public:
+  CompressedReader(std::unique_ptr<Reader> base,
+                   const CompressionConfig& config);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// Compresses the dumps of the `base` factory
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base,
+                              CompressionConfig config);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const std::unique_ptr<OperationsFactory> base_;
+  const CompressionConfig config_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -46,6 +46,7 @@ class FileReader final : public Reader {
 
  private:
   std::string_view ReadRaw(std::size_t max_size) override;
+  void ReadRawInto(char* destination, std::size_t size) override;
 
   fs::blocking::CFile file_;
   std::string path_;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A handle to a dump file mapped into memory.
+///
+/// Reads return views straight into the mapping, so strings and
+/// `ReadTriviallyCopyableArray` data are copied once, directly into the
+/// resulting objects. Page faults block the thread.
+class MmapFileReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file and maps it into memory
+  /// @throws `Error` on a filesystem error
+  explicit MmapFileReader(std::string path);
+
+  MmapFileReader(MmapFileReader&&) = delete;
+  MmapFileReader& operator=(MmapFileReader&&) = delete;
+  ~MmapFileReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+  void ReadRawInto(char* destination, std::size_t size) override;
+
+  std::string path_;
+  const char* data_{nullptr};
+  std::size_t size_{0};
+  std::size_t position_{0};
+};
+
+/// Reads the dumps with `MmapFileReader`, writes the same format with
+/// `FileWriter`
+class MmapOperationsFactory final : public OperationsFactory {
+ public:
+  explicit MmapOperationsFactory(boost::filesystem::perms perms);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -27,6 +27,10 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size);
 /// @warning The `string_view` will be invalidated on the next `Read` operation
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size);
 
+/// @brief Reads exactly `size` non-size-prefixed bytes into `destination`
+/// @note The caller must somehow know the data size in advance
+void ReadUnsafeInto(Reader& reader, char* destination, std::size_t size);
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
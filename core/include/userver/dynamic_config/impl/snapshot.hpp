@@ -3,12 +3,16 @@
 #include <any>
 #include <cstddef>
 #include <exception>
+#include <memory>
+#include <optional>
+#include <string>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
 #include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -40,6 +44,16 @@ ConfigId Register(Factory factory);
 template <typename Key>
 inline const ConfigId kConfigId = Register(&FactoryFor<Key>);
 
+// A config variable, shared between the snapshots it is the same in
+struct ConfigValue final {
+  std::any value;
+  // Sorted names of the docs the variable was parsed from, std::nullopt if the
+  // variable was not parsed from a DocsMap
+  std::optional<std::vector<std::string>> doc_names;
+};
+
+using DocNames = utils::impl::TransparentSet<std::string>;
+
 class SnapshotData final {
  public:
   SnapshotData() = default;
@@ -51,6 +65,11 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  // Parses only the variables that depend on the `changed_docs`, takes the
+  // rest from `previous`
+  SnapshotData(const DocsMap& docs_map, const SnapshotData& previous,
+               const DocNames& changed_docs);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -64,12 +83,21 @@ class SnapshotData final {
     }
   }
 
+  // Whether the variable was taken from `other` without changes
+  template <typename Key>
+  bool IsSharedWith(const SnapshotData& other, Key) const noexcept {
+    return IsSharedWith(other, impl::kConfigId<Key>);
+  }
+
   bool IsEmpty() const noexcept;
 
  private:
   const std::any& Get(impl::ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  bool IsSharedWith(const SnapshotData& other,
+                    impl::ConfigId id) const noexcept;
+
+  std::vector<std::shared_ptr<const ConfigValue>> user_configs_;
 };
 
 class StorageData;
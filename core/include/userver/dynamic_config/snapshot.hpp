@@ -30,7 +30,9 @@ using VariableOfKey = impl::VariableOfKey<Key>;
 ///
 /// When a config update comes in via new `DocsMap`, configs of all
 /// the registered types are constructed and stored in `Config`. After that
-/// the `DocsMap` is dropped.
+/// the `DocsMap` is dropped. On the subsequent updates only the configs that
+/// have read the changed docs are constructed again, the rest are shared with
+/// the previous `Snapshot`.
 ///
 /// Config types are automatically registered if they are accessed with `Get`
 /// somewhere in the program.
@@ -182,6 +182,8 @@ class Source final {
   ///
   /// @note Сallbacks occur only if one of the passed config is changed. This is
   /// true under any components::DynamicConfigClientUpdater options.
+  /// The configs that were not parsed again on an update are not compared,
+  /// so the subscription is cheap even with a lot of configs and subscribers.
   ///
   /// @warning To use this function, configs must have the `operator==`.
   ///
@@ -223,7 +225,12 @@ class Source final {
     UASSERT(!current.GetData().IsEmpty());
     UASSERT(!previous.GetData().IsEmpty());
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+    // The variables that did not change are shared between the snapshots, so
+    // most of the time the values are not compared
+    const bool is_equal =
+        (true && ... &&
+         (current.GetData().IsSharedWith(previous.GetData(), keys) ||
+          previous[keys] == current[keys]));
     return !is_equal;
   }
 
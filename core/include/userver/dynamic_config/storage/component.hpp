@@ -29,6 +29,13 @@ namespace components {
 /// ---- | ----------- | -------------
 /// fs-cache-path | path to the file to read and dump a config cache; set to empty string to disable reading and dumping configs to FS | -
 /// fs-task-processor | name of the task processor to run the blocking file write operations | -
+/// subscribers-max-parallelism | max number of subscribers that handle a config update concurrently, 0 for no limit | 0
+/// subscribers-warn-timeout | a subscriber that handles a config update for longer is reported to logs | 30s
+///
+/// ## Statistics:
+/// `dynamic-config.subscribers` contains `events`, `handling-time-ms` and
+/// `last-handling-time-ms` of each subscriber, labeled by `channel` and
+/// `subscriber`.
 ///
 /// ## Static configuration example:
 ///
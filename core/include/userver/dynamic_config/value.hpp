@@ -40,6 +40,11 @@ class DocsMap final {
 
   const utils::impl::TransparentSet<std::string>& GetConfigsExpectedToBeUsed(
       utils::InternalTag) const;
+
+  // Names of the docs that differ from the ones in `other` or are missing in
+  // one of the maps
+  utils::impl::TransparentSet<std::string> GetChangedNames(
+      const DocsMap& other, utils::InternalTag) const;
   /// @endcond
 
  private:
@@ -6,6 +6,8 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/engine/task/stack_size_class.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/impl/wrapped_call.hpp>
@@ -20,15 +22,42 @@ template <template <typename> typename TaskType, typename Function,
           typename... Args>
 [[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
                                       Task::Importance importance,
-                                      Deadline deadline, Function&& f,
+                                      Deadline deadline,
+                                      StackSizeClass stack_size_class,
+                                      TaskPriority priority, Function&& f,
                                       Args&&... args) {
   using ResultType =
       typename utils::impl::WrappedCallImplType<Function, Args...>::ResultType;
   constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
 
-  return TaskType<ResultType>{
-      MakeTask({task_processor, importance, kWaitMode, deadline},
-               std::forward<Function>(f), std::forward<Args>(args)...)};
+  return TaskType<ResultType>{MakeTask({task_processor, importance, kWaitMode,
+                                        deadline, stack_size_class, priority},
+                                       std::forward<Function>(f),
+                                       std::forward<Args>(args)...)};
+}
+
+template <template <typename> typename TaskType, typename Function,
+          typename... Args>
+[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
+                                      Task::Importance importance,
+                                      Deadline deadline,
+                                      StackSizeClass stack_size_class,
+                                      Function&& f, Args&&... args) {
+  return MakeTaskWithResult<TaskType>(
+      task_processor, importance, deadline, stack_size_class,
+      TaskPriority::kNormal, std::forward<Function>(f),
+      std::forward<Args>(args)...);
+}
+
+template <template <typename> typename TaskType, typename Function,
+          typename... Args>
+[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
+                                      Task::Importance importance,
+                                      Deadline deadline, Function&& f,
+                                      Args&&... args) {
+  return MakeTaskWithResult<TaskType>(
+      task_processor, importance, deadline, StackSizeClass::kDefault,
+      std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 }  // namespace impl
@@ -72,6 +101,42 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// Runs an asynchronous function call on a coroutine with the requested stack
+/// size using specified task processor
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               StackSizeClass stack_size_class, Function&& f,
+                               Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kNormal, {}, stack_size_class,
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// Runs an asynchronous function call in the requested task processor queue
+/// lane using specified task processor
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               TaskPriority priority, Function&& f,
+                               Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kNormal, {}, StackSizeClass::kDefault,
+      priority, std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// @brief Runs an asynchronous function call that will start regardless of
+/// cancellations in the requested task processor queue lane using specified
+/// task processor
+/// @see Task::Importance::Critical
+template <typename Function, typename... Args>
+[[nodiscard]] auto CriticalAsyncNoSpan(TaskProcessor& task_processor,
+                                       TaskPriority priority, Function&& f,
+                                       Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kCritical, {},
+      StackSizeClass::kDefault, priority, std::forward<Function>(f),
+      std::forward<Args>(args)...);
+}
+
 /// Runs an asynchronous function call using task processor of the caller
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(Function&& f, Args&&... args) {
@@ -96,6 +161,24 @@ template <typename Function, typename... Args>
                      std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// Runs an asynchronous function call on a coroutine with the requested stack
+/// size using task processor of the caller
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(StackSizeClass stack_size_class, Function&& f,
+                               Args&&... args) {
+  return AsyncNoSpan(current_task::GetTaskProcessor(), stack_size_class,
+                     std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// Runs an asynchronous function call in the requested task processor queue
+/// lane using task processor of the caller
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskPriority priority, Function&& f,
+                               Args&&... args) {
+  return AsyncNoSpan(current_task::GetTaskProcessor(), priority,
+                     std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// Runs an asynchronous function call with deadline using task processor of the
 /// caller
 template <typename Function, typename... Args>
@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -50,7 +51,7 @@ class Deadline final {
       return Deadline::Passed();
     }
 
-    const auto now = TimePoint::clock::now();
+    const auto now = utils::impl::FastSteadyNow();
     constexpr auto max_now = TimePoint::clock::time_point::max();
 
     // If:
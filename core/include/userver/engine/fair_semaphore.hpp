@@ -0,0 +1,129 @@
+#pragma once
+
+/// @file userver/engine/fair_semaphore.hpp
+/// @brief @copybrief engine::FairSemaphore
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Semaphore that shares its capacity fairly between the keys of the
+/// waiters, e.g. between the tenants of a service.
+///
+/// The waiters of a key are served in FIFO order, the keys are served with
+/// the deficit round robin: in each round a key is allowed to take up to
+/// `quantum * weight` locks more. So a key that queues a lot of heavy
+/// requests doesn't delay the requests of the other keys more than by a round.
+///
+/// A release of many locks grants all the waiters that fit in one pass. Until
+/// there are no waiters, the locks are taken without queueing.
+///
+/// ## Example usage:
+///
+/// @snippet engine/fair_semaphore_test.cpp  Sample engine::FairSemaphore usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class FairSemaphore final {
+ public:
+  using Counter = std::size_t;
+
+  /// @param capacity number of available locks
+  /// @param quantum number of locks a key of weight 1 may take in a round,
+  /// should be about the usual count of the locks requested at once
+  explicit FairSemaphore(Counter capacity, Counter quantum = 1);
+
+  ~FairSemaphore();
+
+  FairSemaphore(FairSemaphore&&) = delete;
+  FairSemaphore(const FairSemaphore&) = delete;
+  FairSemaphore& operator=(FairSemaphore&&) = delete;
+  FairSemaphore& operator=(const FairSemaphore&) = delete;
+
+  /// Sets the share of the key relative to the other keys, the default
+  /// weight is 1
+  void SetWeight(std::string_view key, std::size_t weight);
+
+  /// Gets the total number of available locks.
+  Counter GetCapacity() const noexcept { return capacity_; }
+
+  /// Returns an approximate number of available locks, use only for statistics.
+  std::size_t RemainingApprox() const;
+
+  /// Returns an approximate number of used locks, use only for statistics.
+  std::size_t UsedApprox() const;
+
+  /// Waits for `count` locks on behalf of the `key`
+  /// @returns false if the deadline is reached, the current task is cancelled
+  /// or `count` is greater than the capacity
+  [[nodiscard]] bool TryLockUntil(std::string_view key, Counter count,
+                                  Deadline deadline);
+
+  /// Returns the `count` locks and grants them to the waiters
+  void Unlock(Counter count);
+
+ private:
+  struct Waiter;
+  struct KeyQueue final {
+    std::string key;
+    std::size_t weight{1};
+    Counter deficit{0};
+    std::deque<Waiter*> waiters;
+  };
+
+  KeyQueue& GetQueue(std::string_view key);
+  void RemoveWaiter(KeyQueue& queue, Waiter& waiter) noexcept;
+  void Dispatch();
+
+  const Counter capacity_;
+  const Counter quantum_;
+
+  std::mutex mutex_;
+  std::atomic<Counter> acquired_{0};
+  // only the keys with waiters have queues
+  std::unordered_map<std::string, KeyQueue> queues_;
+  std::unordered_map<std::string, std::size_t> weights_;
+  // the keys in the order of the round, the front one is being served
+  std::deque<KeyQueue*> active_;
+  // whether the front key has already got its quantum for this round
+  bool turn_started_{false};
+};
+
+/// @brief RAII lock of engine::FairSemaphore, owns the lock if
+/// FairSemaphore::TryLockUntil() has succeeded
+class FairSemaphoreLock final {
+ public:
+  FairSemaphoreLock() noexcept = default;
+  FairSemaphoreLock(FairSemaphore& sem, std::string_view key,
+                    FairSemaphore::Counter count, Deadline deadline);
+  ~FairSemaphoreLock();
+
+  FairSemaphoreLock(const FairSemaphoreLock&) = delete;
+  FairSemaphoreLock(FairSemaphoreLock&&) noexcept;
+  FairSemaphoreLock& operator=(const FairSemaphoreLock&) = delete;
+  FairSemaphoreLock& operator=(FairSemaphoreLock&&) noexcept;
+
+  bool OwnsLock() const noexcept { return sem_ != nullptr; }
+  explicit operator bool() const noexcept { return OwnsLock(); }
+
+  void Unlock();
+
+ private:
+  FairSemaphore* sem_{nullptr};
+  FairSemaphore::Counter count_{0};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -232,7 +232,7 @@ void Future<T>::CheckValid() const {
 }
 
 template <typename T>
-Promise<T>::Promise() : state_(std::make_shared<impl::FutureState<T>>()) {}
+Promise<T>::Promise() : state_(impl::MakeFutureState<T>()) {}
 
 template <typename T>
 Promise<T>::~Promise() {
@@ -266,8 +266,7 @@ void Promise<T>::set_exception(std::exception_ptr ex) {
   state_->SetException(std::move(ex));
 }
 
-inline Promise<void>::Promise()
-    : state_(std::make_shared<impl::FutureState<void>>()) {}
+inline Promise<void>::Promise() : state_(impl::MakeFutureState<void>()) {}
 
 inline Promise<void>::~Promise() {
   if (state_ && !state_->IsReady()) {
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <exception>
+#include <memory>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future_status.hpp>
@@ -73,6 +75,59 @@ class FutureState<void> final : public FutureStateBase {
   utils::ResultStore<void> result_store_;
 };
 
+// Allocates the blocks of up to kMaxPooledFutureStateSize bytes from the size
+// class pools of the current thread, bigger ones from the global heap
+inline constexpr std::size_t kMaxPooledFutureStateSize = 512;
+
+void* AllocateFutureState(std::size_t size);
+
+void DeallocateFutureState(void* ptr, std::size_t size) noexcept;
+
+// Control block and FutureState are allocated as a single pooled block by
+// std::allocate_shared
+template <typename T>
+class FutureStateAllocator final {
+ public:
+  using value_type = T;
+
+  FutureStateAllocator() noexcept = default;
+
+  template <typename U>
+  /*implicit*/ FutureStateAllocator(const FutureStateAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    if constexpr (alignof(T) > alignof(std::max_align_t)) {
+      return std::allocator<T>{}.allocate(n);
+    } else {
+      return static_cast<T*>(AllocateFutureState(n * sizeof(T)));
+    }
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    if constexpr (alignof(T) > alignof(std::max_align_t)) {
+      std::allocator<T>{}.deallocate(ptr, n);
+    } else {
+      DeallocateFutureState(ptr, n * sizeof(T));
+    }
+  }
+
+  template <typename U>
+  bool operator==(const FutureStateAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const FutureStateAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+template <typename T>
+std::shared_ptr<FutureState<T>> MakeFutureState() {
+  return std::allocate_shared<FutureState<T>>(
+      FutureStateAllocator<FutureState<T>>{});
+}
+
 template <typename T>
 T FutureState<T>::Get() {
   WaitForResult();
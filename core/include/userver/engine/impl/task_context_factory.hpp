@@ -6,7 +6,9 @@
 #include <utility>
 
 #include <userver/engine/impl/task_context_holder.hpp>
+#include <userver/engine/task/stack_size_class.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/wrapped_call.hpp>
 
@@ -24,6 +26,8 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  StackSizeClass stack_size_class{StackSizeClass::kDefault};
+  TaskPriority priority{TaskPriority::kNormal};
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
@@ -91,7 +91,8 @@ class Storage final {
   Storage& operator=(Storage&&) = delete;
   ~Storage();
 
-  // Copies pointers to inherited variables from 'other'
+  // Shares the inherited variables of 'other', the variables are copied
+  // on the first modification by either of the storages
   // 'this' must not contain any variables
   void InheritFrom(Storage& other);
 
@@ -103,7 +104,7 @@ class Storage final {
   // Otherwise it is UB.
   template <typename T, VariableKind Kind>
   T& GetOrEmplace(Key key) {
-    DataBase* const old_data = GetGeneric(key);
+    auto* const old_data = GetGeneric<Kind>(key);
     if (!old_data) {
       const bool has_existing_variable = false;
       return DoEmplace<T, Kind>(key, has_existing_variable);
@@ -113,7 +114,7 @@ class Storage final {
 
   template <typename T, VariableKind Kind>
   T* GetOptional(Key key) noexcept {
-    DataBase* const data = GetGeneric(key);
+    auto* const data = GetGeneric<Kind>(key);
     if (!data) return nullptr;
     return &static_cast<DataImpl<T, Kind>&>(*data).Get();
   }
@@ -127,7 +128,7 @@ class Storage final {
 
   template <typename T, VariableKind Kind, typename... Args>
   T& Emplace(Key key, Args&&... args) {
-    DataBase* const old_data = GetGeneric(key);
+    auto* const old_data = GetGeneric<Kind>(key);
     const bool has_existing_variable = old_data != nullptr;
     auto& result = DoEmplace<T, Kind>(key, has_existing_variable,
                                       std::forward<Args>(args)...);
@@ -142,7 +143,18 @@ class Storage final {
   }
 
  private:
-  DataBase* GetGeneric(Key key) noexcept;
+  template <VariableKind Kind>
+  ConditionalDataBase<Kind>* GetGeneric(Key key) noexcept {
+    if constexpr (Kind == VariableKind::kInherited) {
+      return GetInherited(key);
+    } else {
+      return GetNormal(key);
+    }
+  }
+
+  NormalDataBase* GetNormal(Key key) noexcept;
+
+  InheritedDataBase* GetInherited(Key key) noexcept;
 
   void SetGeneric(Key key, NormalDataBase& node, bool has_existing_variable);
 
@@ -68,6 +68,8 @@ class PipeWriter final : public WritableBase {
   [[nodiscard]] size_t WriteAll(const void* buf, size_t len,
                                 Deadline deadline) override;
 
+  using WritableBase::WriteAll;
+
   /// File descriptor corresponding to the write end of the pipe.
   int Fd() const;
 
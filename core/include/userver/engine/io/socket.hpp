@@ -28,12 +28,6 @@ enum class SocketType {
   kUdp = kDgram,
 };
 
-/// IoData for vector send
-struct IoData final {
-  const void* data;
-  size_t len;
-};
-
 /// @brief Socket representation.
 ///
 /// It is not thread-safe to concurrently read from socket. It is not
@@ -85,6 +79,13 @@ class [[nodiscard]] Socket final : public RwBase {
   /// received any more, received bytes count otherwise.
   [[nodiscard]] size_t RecvSome(void* buf, size_t len, Deadline deadline);
 
+  /// @brief Receives at least one byte from the socket into the buffers,
+  /// filling them in order.
+  /// @returns 0 if connection is closed on one side and no data could be
+  /// received any more, received bytes count otherwise.
+  [[nodiscard]] size_t RecvSome(struct iovec* list, std::size_t list_size,
+                                Deadline deadline);
+
   /// @brief Receives exactly len bytes from the socket.
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t RecvAll(void* buf, size_t len, Deadline deadline);
@@ -173,6 +174,16 @@ class [[nodiscard]] Socket final : public RwBase {
     return SendAll(buf, len, deadline);
   }
 
+  /// @brief Writes exactly list_size buffers to the socket in a single
+  /// vectored syscall where possible.
+  /// @note Can return less than the total size if socket is closed by peer.
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
+  using WritableBase::WriteAll;
+
  private:
   AddrDomain domain_{AddrDomain::kUnspecified};
 
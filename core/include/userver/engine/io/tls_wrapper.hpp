@@ -3,6 +3,9 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <chrono>
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -11,16 +14,80 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/common.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// @brief Server-side TLS settings shared by the accepted connections.
+///
+/// Unlike the TlsWrapper::StartTlsServer() overload that sets up TLS from
+/// scratch for each connection, the returning clients resume their sessions
+/// without the key exchange, either from the bounded server session cache or
+/// with session tickets. Ticket keys are rotated every `ticket_key_lifetime`,
+/// tickets of the previous key are still accepted and are reissued.
+///
+/// Create one context per listening socket and pass it to StartTlsServer()
+/// for each accepted connection, e.g. in ProcessSocket() of a
+/// components::TcpAcceptorBase. The HTTP server does not terminate TLS, so
+/// it does not use the context.
+///
+/// Thread safe.
+class TlsServerContext final {
+ public:
+  struct Settings {
+    /// How long a session ticket key is used to issue new tickets
+    std::chrono::seconds ticket_key_lifetime{std::chrono::hours{1}};
+
+    /// Max number of sessions in the server session cache
+    std::size_t session_cache_size{20 * 1024};
+
+    /// If set, handshakes run on this task processor, which keeps the key
+    /// exchange from stalling the task processor of the connection
+    engine::TaskProcessor* handshake_task_processor{nullptr};
+
+    /// If set, the records of the established connections are encrypted and
+    /// decrypted by the kernel (kTLS) where the kernel and the negotiated
+    /// cipher support it, so that sends become plain socket writes and
+    /// TlsWrapper::SendFile() does not copy the file to the user space.
+    /// Requires OpenSSL 3.0 built with kTLS support, ignored otherwise.
+    bool enable_ktls{false};
+  };
+
+  TlsServerContext(const crypto::Certificate& cert,
+                   const crypto::PrivateKey& key,
+                   const std::vector<crypto::Certificate>& cert_authorities,
+                   const Settings& settings);
+  TlsServerContext(const crypto::Certificate& cert,
+                   const crypto::PrivateKey& key);
+
+  TlsServerContext(TlsServerContext&&) noexcept;
+  TlsServerContext& operator=(TlsServerContext&&) noexcept;
+  ~TlsServerContext();
+
+  /// @brief Starts issuing tickets with a new key before the rotation is due,
+  /// e.g. when the old key might have leaked.
+  ///
+  /// Tickets of the current key are accepted until the next rotation.
+  void RotateTicketKey();
+
+ private:
+  friend class TlsWrapper;
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe.
 ///
+/// Client sessions are kept in a process-wide bounded cache and are resumed on
+/// the next connections to the same server name and address. Handshake counts
+/// and timings are reported in `engine.tls` metrics.
+///
 /// Usage example:
 /// @snippet src/engine/io/tls_wrapper_test.cpp TLS wrapper usage
 class [[nodiscard]] TlsWrapper final : public RwBase {
@@ -36,6 +103,12 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
       const crypto::PrivateKey& key, Deadline deadline,
       const std::vector<crypto::Certificate>& cert_authorities = {});
 
+  /// Starts a TLS server on an opened socket, resuming the sessions of the
+  /// returning clients
+  static TlsWrapper StartTlsServer(Socket&& socket,
+                                   const TlsServerContext& context,
+                                   Deadline deadline);
+
   ~TlsWrapper() override;
 
   TlsWrapper(const TlsWrapper&) = delete;
@@ -47,6 +120,13 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// Whether the socket is valid.
   bool IsValid() const override;
 
+  /// Whether the handshake resumed a previous session.
+  bool IsSessionReused() const;
+
+  /// Whether the records are sent with kernel TLS.
+  /// @see TlsServerContext::Settings::enable_ktls
+  bool IsKernelTlsEnabled() const;
+
   /// Suspends current task until the socket has data available.
   [[nodiscard]] bool WaitReadable(Deadline) override;
 
@@ -66,9 +146,32 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+  /// @brief Sends exactly list_size buffers to the socket.
+  ///
+  /// Small buffers are coalesced into shared TLS records instead of producing
+  /// a record and a syscall per buffer.
+  /// @note Can return less than the total size if socket is closed by peer.
+  [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size,
+                               Deadline deadline);
+
+  /// @overload
+  [[nodiscard]] size_t SendAll(std::initializer_list<IoData> list,
+                               Deadline deadline) {
+    return SendAll(list.begin(), list.size(), deadline);
+  }
+
+  /// @brief Sends `size` bytes of the file starting from `offset`.
+  ///
+  /// With kernel TLS the file is sent with sendfile(2), otherwise it is read
+  /// in chunks and sent with SendAll().
+  /// @note Can return less than size if socket is closed by peer.
+  [[nodiscard]] size_t SendFile(int file_fd, std::size_t offset,
+                                std::size_t size, Deadline deadline);
+
   /// @brief Finishes TLS session and returns the socket.
   /// @warning Wrapper becomes invalid on entry and can only be used to retry
   ///   socket extraction if interrupted.
+  /// @warning With kernel TLS the returned socket keeps encrypting the data.
   [[nodiscard]] Socket StopTls(Deadline deadline);
 
   /// @brief Receives at least one byte from the socket.
@@ -93,6 +196,15 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
     return SendAll(buf, len, deadline);
   }
 
+  /// @brief Writes exactly list_size buffers to the socket.
+  /// @note Can return less than the total size if socket is closed by peer.
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
+  using WritableBase::WriteAll;
+
  private:
   explicit TlsWrapper(Socket&&);
 
@@ -0,0 +1,129 @@
+#pragma once
+
+/// @file userver/engine/reader_biased_shared_mutex.hpp
+/// @brief @copybrief engine::ReaderBiasedSharedMutex
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::SharedMutex alternative for the read-mostly data
+///
+/// Readers of engine::SharedMutex update the same atomic counter, which
+/// bounces the cache line between CPUs when there are many of them. Readers of
+/// ReaderBiasedSharedMutex only update one of the per-thread-group counters,
+/// so read locking scales with the number of worker threads. Writers have to
+/// check all the counters and are slower than engine::SharedMutex ones, and
+/// the mutex takes ~0.5KB.
+///
+/// A pending writer stops the new readers from coming in, so writers don't
+/// starve.
+///
+/// ## Example usage:
+///
+/// @snippet engine/shared_mutex_test.cpp  Sample ReaderBiasedSharedMutex usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class ReaderBiasedSharedMutex final {
+ public:
+  ReaderBiasedSharedMutex();
+  ~ReaderBiasedSharedMutex();
+
+  ReaderBiasedSharedMutex(const ReaderBiasedSharedMutex&) = delete;
+  ReaderBiasedSharedMutex(ReaderBiasedSharedMutex&&) = delete;
+  ReaderBiasedSharedMutex& operator=(const ReaderBiasedSharedMutex&) = delete;
+  ReaderBiasedSharedMutex& operator=(ReaderBiasedSharedMutex&&) = delete;
+
+  void lock();
+  void unlock();
+
+  bool try_lock();
+
+  template <typename Rep, typename Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  template <typename Clock, typename Duration>
+  bool try_lock_until(const std::chrono::time_point<Clock, Duration>&);
+
+  bool try_lock_until(Deadline deadline);
+
+  void lock_shared();
+  void unlock_shared();
+  bool try_lock_shared();
+
+  template <typename Rep, typename Period>
+  bool try_lock_shared_for(const std::chrono::duration<Rep, Period>&);
+
+  template <typename Clock, typename Duration>
+  bool try_lock_shared_until(const std::chrono::time_point<Clock, Duration>&);
+
+  bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  static constexpr std::size_t kReadersShardsCount = 8;
+
+  using ReadersCounter =
+      concurrent::impl::InterferenceShield<std::atomic<std::int64_t>>;
+
+  bool TryLockSharedFastPath();
+  std::int64_t GetReadersCount() const noexcept;
+  void ReleaseWriter();
+
+  /* A task may migrate to another thread while holding the shared lock, so
+   * unlock_shared() may decrement a different shard than lock_shared()
+   * incremented. Only the sum of the shards is meaningful.
+   */
+  std::array<ReadersCounter, kReadersShardsCount> readers_{};
+
+  /* Set while a writer waits for the readers to leave or holds the lock,
+   * the new readers back off and wait on readers_cv_.
+   */
+  concurrent::impl::InterferenceShield<std::atomic<bool>> has_writer_{false};
+
+  Mutex writers_mutex_;
+  SingleConsumerEvent readers_left_event_;
+
+  Mutex readers_mutex_;
+  ConditionVariable readers_cv_;
+};
+
+template <typename Rep, typename Period>
+bool ReaderBiasedSharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool ReaderBiasedSharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool ReaderBiasedSharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool ReaderBiasedSharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -16,10 +16,13 @@ struct TaskProcessorPoolsConfig final {
   std::size_t initial_coro_pool_size = 10;
   std::size_t max_coro_pool_size = 100;
   std::size_t coro_stack_size = 256 * 1024ULL;
+  std::size_t small_coro_stack_size = 0;
+  std::size_t large_coro_stack_size = 0;
   std::size_t ev_threads_num = 1;
   std::string ev_thread_name = "ev";
   bool ev_default_loop_disabled = false;
   bool defer_events = true;
+  bool ev_io_uring = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/environment_variables.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -22,9 +23,25 @@ class ThreadControl;
 
 namespace subprocess {
 
+/// @brief A child process with pipes connected to its standard input and
+/// output, see ProcessStarter::ExecWithPipes
+struct PipedChildProcess {
+  ChildProcess process;
+
+  /// Standard input of the child, close it to send EOF to the child
+  io::PipeWriter input;
+
+  /// Standard output of the child
+  io::PipeReader output;
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
+///
+/// The subprocesses are started with posix_spawn, which does not copy the
+/// page tables of the parent, so the start does not slow down with the growth
+/// of the parent RSS. If the command could not be executed, Exec throws.
 class ProcessStarter {
  public:
   explicit ProcessStarter(TaskProcessor& task_processor);
@@ -53,6 +70,17 @@ class ProcessStarter {
       const std::optional<std::string>& stdout_file = std::nullopt,
       const std::optional<std::string>& stderr_file = std::nullopt);
 
+  /// Exec subprocess with its standard input and output connected to pipes.
+  /// Variables from `env_update` will be added to current environment.
+  ///
+  /// Allows to start a helper process once and to stream the requests to it
+  /// instead of starting a process per request:
+  /// @snippet engine/subprocess/process_starter_test.cpp  Sample ExecWithPipes
+  PipedChildProcess ExecWithPipes(
+      const std::string& command, const std::vector<std::string>& args,
+      EnvironmentVariablesUpdate env_update = EnvironmentVariablesUpdate{{}},
+      const std::optional<std::string>& stderr_file = std::nullopt);
+
  private:
   ev::ThreadControl& thread_control_;
 };
@@ -0,0 +1,25 @@
+#pragma once
+
+/// @file userver/engine/task/stack_size_class.hpp
+/// @brief @copybrief engine::StackSizeClass
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Coroutine stack size requested for a task.
+///
+/// Sizes of the classes are set in the `coro_pool` section of the
+/// components::ManagerControllerComponent static configuration. A task that
+/// requests a class that is not configured gets the default stack size.
+enum class StackSizeClass : std::uint8_t {
+  kDefault,  ///< coro_pool.stack_size
+  kSmall,    ///< coro_pool.small_stack_size, for shallow tasks
+  kLarge,    ///< coro_pool.large_stack_size, for deeply recursive tasks
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+/// @file userver/engine/task/task_priority.hpp
+/// @brief @copybrief engine::TaskPriority
+
+#include <cstdint>
+#include <string_view>
+
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Task processor queue lane of a task.
+///
+/// The global task queue of a TaskProcessor keeps the lanes separately and
+/// takes the tasks of the `kHigh` lane first, yet gives every
+/// `high-priority-weight`-th turn to the `kNormal` lane, so that the normal
+/// tasks are not starved. Prefer `kHigh` for short latency-critical tasks, a
+/// busy `kHigh` lane slows down all the other tasks of the TaskProcessor.
+///
+/// The priority is the lane of each wakeup of the task, not of its first run
+/// only. Work-stealing task queues have a single lane and ignore the priority.
+enum class TaskPriority : std::uint8_t {
+  kNormal,  ///< the default lane
+  kHigh,    ///< the latency-critical lane
+};
+
+/// Returns "normal" or "high"
+std::string_view ToString(TaskPriority priority) noexcept;
+
+/// Parses "normal" or "high"
+TaskPriority Parse(const yaml_config::YamlConfig& value,
+                   formats::parse::To<TaskPriority>);
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
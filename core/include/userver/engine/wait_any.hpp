@@ -26,6 +26,9 @@ namespace engine {
 /// Works with different types of tasks and futures:
 /// @snippet src/engine/wait_any_test.cpp sample waitany
 ///
+/// Consumers of concurrent::GenericQueue are also accepted, such consumer is
+/// ready when the queue has something to pop or has no more producers.
+///
 /// @param tasks either a single container, or a pack of future-like elements.
 /// @returns the index of the completed task, or `std::nullopt` if there are no
 /// completed tasks (possible if current task was cancelled).
@@ -31,6 +31,12 @@ class FsCacheClient final {
   FileInfoWithDataConstPtr TryGetFile(std::string_view path) const;
 
   /// @brief Concurrency-safe cache update
+  /// @details Only the new files and the files with a changed inode, size,
+  /// modification or status change time are reread, the contents of the
+  /// unchanged files are shared with the previous version of the cache. The
+  /// files modified less than a second before an update are reread by the
+  /// next one too, as the filesystem timestamps may be too coarse to notice
+  /// a change made within the same tick.
   void UpdateCache();
 
  private:
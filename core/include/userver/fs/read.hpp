@@ -3,9 +3,11 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <ctime>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
@@ -20,6 +22,7 @@ struct FileInfoWithData {
   std::string data;
   std::string extension;
   size_t size;
+  std::time_t last_write_time{0};
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -44,6 +47,8 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden});
 
 /// @brief Reads file contents asynchronously
+/// @details If the whole file is in the page cache, it is read in the current
+/// task without a switch to the `async_tp`.
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
 /// @returns file contents
@@ -52,6 +57,27 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path);
 
+/// @brief Reads file contents asynchronously into `contents`, reusing its
+/// memory
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param contents the buffer to read into, its previous contents are lost
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+void ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path,
+                      std::string& contents);
+
+/// @brief Reads the contents of many files asynchronously
+/// @details The files that are in the page cache are read in the current task,
+/// the rest are read by a single task of the `async_tp`.
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param paths files to open
+/// @returns file contents in the order of `paths`
+/// @throws std::runtime_error if any read fails for any reason (e.g. no such
+/// file, read error, etc.),
+std::vector<std::string> ReadFilesContents(
+    engine::TaskProcessor& async_tp, const std::vector<std::string>& paths);
+
 /// @brief Checks whether the file exists asynchronosly
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file path to check
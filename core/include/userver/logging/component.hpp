@@ -45,11 +45,14 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `raw` or `binary` | tskv
+/// binary_records | for the `binary` format, write the messages to file_path as binary records for an offline decoder instead of TSKV | false
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// thread_buffer_size | if not 0, the size in bytes of the per-thread buffers that pass the messages to the logger task without allocations, must be a power of 2 | 0
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
+/// shipping | if exists, setups additional sink that ships the logs to a log agent in batched frames | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
 /// ### Logs output
@@ -60,12 +63,60 @@ namespace components {
 /// - Use `%file_name%` to write your logs in file. Use USR1 signal or `OnLogRotate` handler to reopen files after log rotation;
 /// - Use `unix:%socket_name%` to write your logs to unix socket. Socket must be created before the service starts and closed by listener afert service is shuted down.
 ///
+/// ### Per-thread buffers
+/// By default each message is allocated and pushed into the queue that is
+/// shared by all the threads. With `thread_buffer_size` the messages are
+/// copied into a ring buffer of the current thread instead, and the logger
+/// task writes out all the messages of a buffer at once, with a single
+/// flush. There is a buffer per CPU core, threads share them if there are
+/// more threads than cores. A message larger than a half of the buffer is
+/// allocated, and only the pointer to it is copied into the buffer, so the
+/// messages of a thread keep their order. If the buffer is full,
+/// `overflow_behavior` is applied and the dropped messages are counted in
+/// the logger statistics, just as for the queue.
+///
+/// ### Binary format
+/// With `format: binary` LOG_* macros copy the tags without escaping, and the
+/// logger task escapes and formats them into TSKV, which takes the
+/// formatting off the request handling tasks. With `binary_records: true`
+/// the logger task skips the formatting too and writes records of the
+/// following layout, with the numbers in the native byte order:
+///  * uint32 size of the rest of the record;
+///  * uint8 logging::Level;
+///  * int64 microseconds since the epoch;
+///  * the tags, each one is a uint16 key size, the key, a uint32 value size
+///    and the value.
+///
+/// The testsuite-capture sink always receives TSKV.
+///
 /// ### testsuite-capture options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// host | testsuite hostname, e.g. localhost | -
 /// port | testsuite port | -
 ///
+/// ### Log shipping
+/// With `shipping` the records are also sent to a log agent over TCP or UDP
+/// in frames of many records instead of a write per record. A frame is sent
+/// once it reaches `max_frame_size`, with the first record after
+/// `max_frame_delay` or on a flush, which also happens every 2 seconds. The
+/// frames that could not be sent are kept while the agent is unavailable and
+/// are resent as a whole after a reconnect. The shipping statistics, among
+/// them the dropped records, are reported in the `logger.shipping` metrics.
+///
+/// ### shipping options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// host | log agent hostname | -
+/// port | log agent port | -
+/// protocol | `tcp` or `udp`, a datagram per frame | tcp
+/// max_frame_size | max size in bytes of the records in a frame, for udp the larger records are dropped | 65536
+/// max_frame_delay | a frame is sent with the first record logged after this delay | 100ms
+/// compression | if set, each frame is compressed separately with this content coding: `gzip`, `zstd` or `br` | -
+/// max_spill_size | max size in bytes of the frames kept while the agent is unavailable, the oldest are dropped | 16777216
+/// reconnect_interval | min interval between the connection attempts | 1s
+/// io_timeout | connect and send timeout | 500ms
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp Sample logging component config
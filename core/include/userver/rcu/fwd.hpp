@@ -1,7 +1,8 @@
 #pragma once
 
 /// @file userver/rcu/fwd.hpp
-/// @brief Forward declarations for rcu::Variable and rcu::RcuMap
+/// @brief Forward declarations for rcu::Variable, rcu::RcuMap and
+/// rcu::ShardedRcuMap
 
 #include <functional>
 #include <unordered_map>
@@ -35,6 +36,10 @@ template <typename Key, typename Value,
           typename RcuMapTraits = DefaultRcuMapTraits<Key, Value>>
 class RcuMap;
 
+template <typename Key, typename Value,
+          typename RcuMapTraits = DefaultRcuMapTraits<Key, Value>>
+class ShardedRcuMap;
+
 }  // namespace rcu
 
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <cstdlib>
 #include <list>
+#include <type_traits>
 #include <unordered_set>
 
 #include <userver/engine/async.hpp>
@@ -26,6 +27,30 @@ namespace rcu {
 
 namespace impl {
 
+template <typename RcuTraits, typename = void>
+inline constexpr bool kHasAsymmetricFences = false;
+
+template <typename RcuTraits>
+inline constexpr bool kHasAsymmetricFences<
+    RcuTraits, std::void_t<decltype(RcuTraits::kAsymmetricFences)>> =
+    RcuTraits::kAsymmetricFences;
+
+// Makes the stores of every thread issued before the call visible to the
+// caller, pairs with a compiler-only fence on the other side. Uses
+// membarrier(2) where available and forces an IPI by changing the
+// protection of a page otherwise.
+void AsymmetricThreadFenceHeavy() noexcept;
+
+inline void AsymmetricThreadFenceLight() noexcept {
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+// Distinct for all the running threads
+inline const void* GetThreadTag() noexcept {
+  thread_local const char tag{};
+  return &tag;
+}
+
 // Hazard pointer implementation. Pointers form a linked list. \p ptr points
 // to the data they 'hold', next - to the next element in a list.
 // kUsed is a filler value to show that hazard pointer is not free. Please see
@@ -43,15 +68,25 @@ struct HazardPointerRecord final {
   // somewhere into kernel space and will cause SEGFAULT
   static inline T* const kUsed = reinterpret_cast<T*>(1);
 
-  explicit HazardPointerRecord(const Variable<T, RcuTraits>& owner)
-      : owner(owner) {}
+  explicit HazardPointerRecord(const Variable<T, RcuTraits>& owner,
+                               const void* owner_thread = nullptr)
+      : owner(owner), owner_thread(owner_thread) {}
 
   std::atomic<T*> ptr = kUsed;
   const Variable<T, RcuTraits>& owner;
+  // With asymmetric fences a record may be owned by a thread, then only that
+  // thread takes it, while any thread may release it.
+  const void* const owner_thread;
   std::atomic<HazardPointerRecord*> next{nullptr};
 
   // Simple operation that marks this hazard pointer as no longer used.
-  void Release() { ptr = nullptr; }
+  void Release() {
+    if constexpr (kHasAsymmetricFences<RcuTraits>) {
+      ptr.store(nullptr, std::memory_order_release);
+    } else {
+      ptr = nullptr;
+    }
+  }
 };
 
 template <typename T, typename RcuTraits>
@@ -77,6 +112,23 @@ struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
 };
 
+/// Rcu traits for extremely read-heavy variables.
+///
+/// Readers don't issue atomic read-modify-write operations or memory fences
+/// as long as a thread does not read several such variables of the same type
+/// in turn. In exchange, every write and `Cleanup` makes a process-wide memory
+/// barrier (`membarrier(2)` on Linux), which costs several microseconds and
+/// interrupts all the running threads of the process. Use only for variables
+/// that are updated at most a few times a second.
+///
+/// Add `static constexpr bool kAsymmetricFences = true;` to your own traits
+/// for the same behavior.
+template <typename T>
+struct AsymmetricFenceRcuTraits {
+  using MutexType = engine::Mutex;
+  static constexpr bool kAsymmetricFences = true;
+};
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
@@ -95,7 +147,13 @@ class [[nodiscard]] ReadablePtr final {
     do {
       t_ptr_ = ptr.GetCurrent();
 
-      hp_record_->ptr.store(t_ptr_);
+      if constexpr (impl::kHasAsymmetricFences<RcuTraits>) {
+        // The writer makes a heavy fence before looking for hazard pointers
+        hp_record_->ptr.store(t_ptr_, std::memory_order_relaxed);
+        impl::AsymmetricThreadFenceLight();
+      } else {
+        hp_record_->ptr.store(t_ptr_);
+      }
     } while (t_ptr_ != ptr.GetCurrent());
   }
 
@@ -429,7 +487,7 @@ class Variable final {
     auto* hp = hp_record_head_.load();
     while (hp) {
       T* t_ptr = nullptr;
-      if (hp->ptr.load() == nullptr &&
+      if (hp->owner_thread == nullptr && hp->ptr.load() == nullptr &&
           hp->ptr.compare_exchange_strong(
               t_ptr, impl::HazardPointerRecord<T, RcuTraits>::kUsed)) {
         return hp;
@@ -441,6 +499,10 @@ class Variable final {
   }
 
   impl::HazardPointerRecord<T, RcuTraits>& MakeHazardPointer() const {
+    if constexpr (impl::kHasAsymmetricFences<RcuTraits>) {
+      return MakeHazardPointerOwned();
+    }
+
     auto* hp = MakeHazardPointerCached();
     if (!hp) {
       hp = MakeHazardPointerFast();
@@ -456,9 +518,48 @@ class Variable final {
     return *hp;
   }
 
-  impl::HazardPointerRecord<T, RcuTraits>* MakeHazardPointerSlow() const {
+  // Takes the record owned by the current thread. Only the owner takes such
+  // records, so they are taken without read-modify-write operations.
+  impl::HazardPointerRecord<T, RcuTraits>& MakeHazardPointerOwned() const {
+    auto& cache = impl::cache<T, RcuTraits>;
+    auto* hp = cache.hp;
+    if (!hp || cache.variable != this || cache.variable_epoch != epoch_) {
+      const auto* thread_tag = impl::GetThreadTag();
+      hp = FindHazardPointerOwned(thread_tag);
+      const bool created = !hp;
+      // a new record is created taken
+      if (created) hp = MakeHazardPointerSlow(thread_tag);
+
+      cache.hp = hp;
+      cache.variable = this;
+      cache.variable_epoch = epoch_;
+      if (created) return *hp;
+    }
+
+    if (hp->ptr.load(std::memory_order_relaxed) == nullptr) {
+      hp->ptr.store(impl::HazardPointerRecord<T, RcuTraits>::kUsed,
+                    std::memory_order_relaxed);
+      return *hp;
+    }
+
+    // The thread already reads the variable, use a shared record
+    hp = MakeHazardPointerFast();
+    if (!hp) hp = MakeHazardPointerSlow();
+    return *hp;
+  }
+
+  impl::HazardPointerRecord<T, RcuTraits>* FindHazardPointerOwned(
+      const void* thread_tag) const {
+    for (auto* hp = hp_record_head_.load(); hp; hp = hp->next) {
+      if (hp->owner_thread == thread_tag) return hp;
+    }
+    return nullptr;
+  }
+
+  impl::HazardPointerRecord<T, RcuTraits>* MakeHazardPointerSlow(
+      const void* owner_thread = nullptr) const {
     // allocate new pointer, and add it to the list (atomically)
-    auto hp = new impl::HazardPointerRecord<T, RcuTraits>(*this);
+    auto hp = new impl::HazardPointerRecord<T, RcuTraits>(*this, owner_thread);
     impl::HazardPointerRecord<T, RcuTraits>* old_hp = nullptr;
     do {
       old_hp = hp_record_head_.load();
@@ -502,6 +603,11 @@ class Variable final {
   std::unordered_set<T*> CollectHazardPtrs(std::unique_lock<MutexType>&) {
     std::unordered_set<T*> hazard_ptrs;
 
+    if constexpr (impl::kHasAsymmetricFences<RcuTraits>) {
+      // Pairs with the light fence of the readers
+      impl::AsymmetricThreadFenceHeavy();
+    }
+
     // Learn all currently used hazard pointers
     for (auto* hp = hp_record_head_.load(); hp; hp = hp->next) {
       hazard_ptrs.insert(hp->ptr.load());
@@ -0,0 +1,439 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/rcu/fwd.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure allowing RCU keyset updates, split into
+/// independently updated shards.
+///
+/// Same as rcu::RcuMap, but the keys are split between `shards_count`
+/// rcu::Variable instances by their hash, so a keyset change copies only
+/// a single shard and writers to different shards don't wait for each other.
+/// Use Transaction to apply many changes with a single copy per touched shard.
+///
+/// Reads are as cheap as in rcu::RcuMap, Visit allows reading a value
+/// without copying its `shared_ptr`.
+///
+/// @note There is no consistency between shards: GetSnapshot and
+/// Transaction::Commit are atomic per shard only.
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_rcu_map_test.cpp  Sample rcu::ShardedRcuMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, typename RcuMapTraits>
+class ShardedRcuMap final {
+  using RcuTraits = typename impl::RcuTraitsFromRcuMapTraits<RcuMapTraits>;
+
+ public:
+  static_assert(!std::is_reference_v<Key>);
+  static_assert(!std::is_reference_v<Value>);
+  static_assert(!std::is_const_v<Key>);
+
+  using Hash = typename RcuMapTraits::Hash;
+  using KeyEqual = typename RcuMapTraits::KeyEqual;
+  using ValuePtr = std::shared_ptr<Value>;
+  using ConstValuePtr = std::shared_ptr<const Value>;
+  using RawMap = std::unordered_map<Key, ValuePtr, Hash, KeyEqual>;
+  using Snapshot = std::unordered_map<Key, ConstValuePtr, Hash, KeyEqual>;
+  using InsertReturnType =
+      typename RcuMap<Key, Value, RcuMapTraits>::InsertReturnType;
+
+  class Transaction;
+
+  static constexpr std::size_t kDefaultShardsCount = 64;
+
+  explicit ShardedRcuMap(std::size_t shards_count = kDefaultShardsCount);
+
+  ShardedRcuMap(const ShardedRcuMap&) = delete;
+  ShardedRcuMap(ShardedRcuMap&&) = delete;
+  ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+  ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+  std::size_t GetShardsCount() const;
+
+  /// Returns an estimated size of the map at some point in time
+  size_t SizeApprox() const;
+
+  /// @brief Returns a readonly value pointer by its key if exists
+  /// @throws MissingKeyException if the key is not present
+  const ConstValuePtr operator[](const Key&) const;
+
+  /// @brief Returns a modifiable value pointer by key if exists or
+  /// default-creates one
+  /// @note Copies the shard of the key if the key doesn't exist.
+  const ValuePtr operator[](const Key&);
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  const ConstValuePtr Get(const Key&) const;
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  const ValuePtr Get(const Key&);
+
+  /// @brief Calls `func(const Value&)` if the key exists, without copying
+  /// the value pointer
+  /// @returns whether the key was present
+  /// @note The shard can't be reclaimed while `func` runs, keep it short.
+  template <typename Func>
+  bool Visit(const Key& key, Func&& func) const;
+
+  /// @brief Inserts a new element into the container if there is no element
+  /// with the key in the container.
+  /// @note Copies the shard of the key if the key doesn't exist.
+  InsertReturnType Insert(const Key& key, ValuePtr value);
+
+  /// @brief Inserts a new element into the container constructed in-place with
+  /// the given args if there is no element with the key in the container.
+  /// @note Copies the shard of the key if the key doesn't exist.
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args);
+
+  /// @brief If a key equivalent to `key` already exists in the container, does
+  /// nothing. Otherwise, behaves like `Emplace`.
+  /// @note Copies the shard of the key if the key doesn't exist.
+  template <typename... Args>
+  InsertReturnType TryEmplace(const Key& key, Args&&... args);
+
+  /// @brief If a key equivalent to `key` already exists in the container,
+  /// replaces the associated value. Otherwise, inserts a new pair into the map.
+  /// @note Copies the shard of the key.
+  void InsertOrAssign(const Key& key, ValuePtr value);
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  /// @note Copies the shard of the key if the key exists.
+  bool Erase(const Key&);
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  ValuePtr Pop(const Key&);
+
+  /// Resets the map to an empty state
+  void Clear();
+
+  /// @brief Starts a transaction, used to perform a series of inserts and
+  /// erases with a single copy per touched shard.
+  /// @details Changes are buffered until `Commit` and are not visible even
+  /// to the Get of the same map.
+  Transaction StartTransaction();
+
+  /// @brief Returns a readonly copy of the map
+  /// @note Each of the shards is copied at a different point in time.
+  Snapshot GetSnapshot() const;
+
+ private:
+  using Shard = rcu::Variable<RawMap, RcuTraits>;
+
+  std::size_t GetShardIndex(const Key& key) const;
+  Shard& GetShard(const Key& key);
+  const Shard& GetShard(const Key& key) const;
+
+  InsertReturnType DoInsert(const Key& key, ValuePtr value);
+
+  utils::FixedArray<Shard> shards_;
+};
+
+/// @brief Buffers changes of rcu::ShardedRcuMap and applies them at once.
+///
+/// Shards are updated one after another in `Commit`, each touched shard is
+/// copied once. The transaction holds no locks before `Commit`, changes
+/// that are not committed are discarded.
+template <typename Key, typename Value, typename RcuMapTraits>
+class ShardedRcuMap<Key, Value, RcuMapTraits>::Transaction final {
+ public:
+  Transaction(Transaction&&) noexcept = default;
+  Transaction& operator=(Transaction&&) noexcept = default;
+
+  /// @brief Inserts the pair or replaces the value of an existing key
+  void InsertOrAssign(Key key, ValuePtr value);
+
+  /// @brief Removes the key if it exists
+  void Erase(Key key);
+
+  /// @brief Applies the buffered changes, the transaction is empty afterwards
+  void Commit();
+
+ private:
+  friend class ShardedRcuMap;
+
+  explicit Transaction(ShardedRcuMap& map);
+
+  struct Change final {
+    Key key;
+    // std::nullopt means erase
+    std::optional<ValuePtr> value;
+  };
+
+  void AddChange(Change&& change);
+
+  ShardedRcuMap* map_;
+  // by shard index
+  std::vector<std::vector<Change>> changes_;
+};
+
+template <typename K, typename V, typename RcuMapTraits>
+ShardedRcuMap<K, V, RcuMapTraits>::ShardedRcuMap(std::size_t shards_count)
+    : shards_(shards_count) {
+  UINVARIANT(shards_count > 0, "ShardedRcuMap requires at least one shard");
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t ShardedRcuMap<K, V, RcuMapTraits>::GetShardsCount() const {
+  return shards_.size();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+size_t ShardedRcuMap<K, V, RcuMapTraits>::SizeApprox() const {
+  size_t size = 0;
+  for (const auto& shard : shards_) {
+    const auto ptr = shard.Read();
+    size += ptr->size();
+  }
+  return size;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ConstValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::operator[](const K& key) const {
+  if (auto value = Get(key)) {
+    return value;
+  }
+  throw MissingKeyException("Key ") << key << " is missing";
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::operator[](const K& key) {
+  auto value = Get(key);
+  if (!value) {
+    auto txn = GetShard(key).StartWrite();
+    auto insertion_result = txn->emplace(key, std::make_shared<V>());
+    value = insertion_result.first->second;
+    if (insertion_result.second) txn.Commit();
+  }
+  return value;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ConstValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) const {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return const_cast<ShardedRcuMap<K, V, RcuMapTraits>*>(this)->Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+// Protects from assignment to map[key]
+// NOLINTNEXTLINE(readability-const-return-type)
+const typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Get(const K& key) {
+  auto snapshot = GetShard(key).Read();
+  auto it = snapshot->find(key);
+  if (it == snapshot->end()) return {};
+  return it->second;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename Func>
+bool ShardedRcuMap<K, V, RcuMapTraits>::Visit(const K& key,
+                                              Func&& func) const {
+  const auto snapshot = GetShard(key).Read();
+  const auto it = snapshot->find(key);
+  if (it == snapshot->end()) return false;
+
+  std::forward<Func>(func)(static_cast<const V&>(*it->second));
+  return true;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::Insert(const K& key, ValuePtr value) {
+  InsertReturnType result{Get(key), false};
+  if (result.value) return result;
+
+  return DoInsert(key, std::move(value));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::Emplace(const K& key, Args&&... args) {
+  InsertReturnType result{Get(key), false};
+  if (result.value) return result;
+
+  return DoInsert(key, std::make_shared<V>(std::forward<Args>(args)...));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+template <typename... Args>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::TryEmplace(const K& key, Args&&... args) {
+  InsertReturnType result{Get(key), false};
+  if (!result.value) {
+    auto txn = GetShard(key).StartWrite();
+    auto insertion_result = txn->try_emplace(key, nullptr);
+    if (insertion_result.second) {
+      result.value = insertion_result.first->second =
+          std::make_shared<V>(std::forward<Args>(args)...);
+      txn.Commit();
+      result.inserted = true;
+    } else {
+      result.value = insertion_result.first->second;
+    }
+  }
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::InsertOrAssign(const K& key,
+                                                       ValuePtr value) {
+  auto txn = GetShard(key).StartWrite();
+  txn->insert_or_assign(key, std::move(value));
+  txn.Commit();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+bool ShardedRcuMap<K, V, RcuMapTraits>::Erase(const K& key) {
+  return Pop(key) != nullptr;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::ValuePtr
+ShardedRcuMap<K, V, RcuMapTraits>::Pop(const K& key) {
+  if (!Get(key)) return {};
+
+  auto txn = GetShard(key).StartWrite();
+  const auto it = txn->find(key);
+  if (it == txn->end()) return {};
+
+  auto value = std::move(it->second);
+  txn->erase(it);
+  txn.Commit();
+  return value;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Clear() {
+  for (auto& shard : shards_) {
+    shard.Assign({});
+  }
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::Transaction
+ShardedRcuMap<K, V, RcuMapTraits>::StartTransaction() {
+  return Transaction{*this};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::Snapshot
+ShardedRcuMap<K, V, RcuMapTraits>::GetSnapshot() const {
+  Snapshot snapshot;
+  for (const auto& shard : shards_) {
+    const auto ptr = shard.Read();
+    snapshot.insert(ptr->begin(), ptr->end());
+  }
+  return snapshot;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t ShardedRcuMap<K, V, RcuMapTraits>::GetShardIndex(
+    const K& key) const {
+  return Hash{}(key) % shards_.size();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetShard(const K& key) -> Shard& {
+  return shards_[GetShardIndex(key)];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto ShardedRcuMap<K, V, RcuMapTraits>::GetShard(const K& key) const
+    -> const Shard& {
+  return shards_[GetShardIndex(key)];
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+typename ShardedRcuMap<K, V, RcuMapTraits>::InsertReturnType
+ShardedRcuMap<K, V, RcuMapTraits>::DoInsert(const K& key, ValuePtr value) {
+  auto txn = GetShard(key).StartWrite();
+  auto insertion_result = txn->emplace(key, std::move(value));
+  InsertReturnType result{insertion_result.first->second,
+                          insertion_result.second};
+  if (result.inserted) txn.Commit();
+  return result;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+ShardedRcuMap<K, V, RcuMapTraits>::Transaction::Transaction(ShardedRcuMap& map)
+    : map_{&map} {}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Transaction::InsertOrAssign(
+    K key, ValuePtr value) {
+  AddChange(Change{std::move(key), std::move(value)});
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Transaction::Erase(K key) {
+  AddChange(Change{std::move(key), std::nullopt});
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Transaction::AddChange(
+    Change&& change) {
+  if (changes_.empty()) changes_.resize(map_->shards_.size());
+  changes_[map_->GetShardIndex(change.key)].push_back(std::move(change));
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void ShardedRcuMap<K, V, RcuMapTraits>::Transaction::Commit() {
+  // Shards are locked one at a time, so transactions can't deadlock
+  for (std::size_t i = 0; i < changes_.size(); ++i) {
+    auto& shard_changes = changes_[i];
+    if (shard_changes.empty()) continue;
+
+    auto txn = map_->shards_[i].StartWrite();
+    for (auto& change : shard_changes) {
+      if (change.value.has_value()) {
+        txn->insert_or_assign(std::move(change.key), std::move(*change.value));
+      } else {
+        txn->erase(change.key);
+      }
+    }
+    txn.Commit();
+  }
+  changes_.clear();
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -72,7 +72,24 @@ namespace components {
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow trottling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
-/// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// connection.max_in_flight_requests | maximum number of pipelined requests from a single connection that are handled concurrently or wait for their responses to be sent; the connection is not read while the limit is reached | unlimited
+/// connection.max_pending_response_bytes | the connection is not read while the response being sent to it is not smaller than this value | unlimited
+/// connection.max_total_pending_response_bytes | the connections of the listener are not read while their responses that are not sent yet take at least this many bytes | unlimited
+/// connection.idle_park_timeout | keep-alive connections idle for this long release their coroutines until the data arrives, saves memory on many idle connections | never
+/// connection.request_parser | HTTP/1.x request parser: 'http_parser' or 'simd' that scans the header block with SIMD and falls back to 'http_parser' for chunked and upgrade requests | http_parser
+/// connection.http2.enabled | accept HTTP/2 with prior knowledge (h2c) in addition to HTTP/1.1 | false
+/// connection.http2.max_concurrent_streams | SETTINGS_MAX_CONCURRENT_STREAMS advertised to the peer | 100
+/// connection.http2.initial_window_size | SETTINGS_INITIAL_WINDOW_SIZE advertised to the peer, in bytes | 65535
+/// connection.http2.send_timeout | for how long a response may wait for the socket to accept the frames or for the peer to open the flow control window | 10s
+/// shards | how many listening sockets with SO_REUSEPORT and accepting tasks to create for the port, the kernel balances new connections between them; do not set if not sure what it is doing | number of event threads of the task processor
+/// reuseport_cpu_steering | pass a new connection to the listening socket number `cpu % shards`, where `cpu` received the connection; Linux only | false
+///
+/// If the service is started with the systemd socket activation protocol
+/// (`LISTEN_PID` and `LISTEN_FDS` environment variables), a listener uses the
+/// passed listening socket for its `port` or `unix-socket` instead of
+/// creating a new one, unless `reuseport_cpu_steering` is enabled. The service
+/// manager keeps such a socket open while the service restarts, so the new
+/// connections wait in its backlog instead of being refused.
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
 
@@ -0,0 +1,98 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <chrono>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that controls the sampling CPU profiler of the task
+/// processors.
+///
+/// While the profiler is running, each worker thread of each task processor
+/// is interrupted by SIGPROF once per `period` of the CPU time consumed by
+/// the thread. The stack of the thread, the task processor name and the name
+/// of the innermost tracing::Span of the running task are recorded without
+/// locks or allocations, and are aggregated in memory every
+/// `collect-interval`. The overhead is a few microseconds per sample, i.e.
+/// well below 1% of CPU at the default 100 Hz.
+///
+/// Only Linux is supported.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// period | CPU time between the samples of a single thread | 10ms
+/// start-on-startup | whether to start the profiler with the component | false
+/// collect-interval | how often the samples are moved from the per-thread buffers to the aggregated stacks | 1s
+///
+/// Options inherited from @ref server::handlers::HandlerBase :
+/// @copybrief server::handlers::HandlerBase
+///
+/// ## Static configuration example:
+///
+/// @code
+///   handler-cpu-profiler:
+///       path: /service/cpu-profiler
+///       method: GET,PUT,DELETE
+///       task_processor: monitor-task-processor
+///       period: 5ms
+/// @endcode
+///
+/// ## Scheme
+///
+/// `GET` returns the aggregated samples in the folded format accepted by
+/// `flamegraph.pl`, one stack per line with the outermost frame first:
+/// @code
+/// main-task-processor;handler-ping;void server::handlers::Ping::HandleRequestThrow(...);... 42
+/// main-task-processor;[no span];... 3
+/// @endcode
+/// The `reset=true` argument forgets the returned samples.
+///
+/// `PUT` starts the profiler, the `period_us=` argument overrides the static
+/// `period`. `DELETE` stops the profiler, the collected samples are kept.
+///
+/// @see @ref scripts/docs/en/userver/cpu_profiler.md
+
+// clang-format on
+class CpuProfiler final : public HttpHandlerBase {
+ public:
+  CpuProfiler(const components::ComponentConfig& config,
+              const components::ComponentContext& component_context);
+
+  ~CpuProfiler() override;
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::CpuProfiler
+  static constexpr std::string_view kName = "handler-cpu-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::string ProcessGet(const http::HttpRequest& request) const;
+  std::string ProcessPut(const http::HttpRequest& request) const;
+  std::string ProcessDelete() const;
+
+  const std::chrono::microseconds period_;
+  utils::PeriodicTask collect_task_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
@@ -26,6 +26,7 @@ namespace server::handlers {
 /// path | if a request matches this path wildcard then process it by handler | -
 /// as_fallback | set to "implicit-http-options" and do not specify a path if this handler processes the OPTIONS requests for paths that do not process OPTIONS method | -
 /// task_processor | a task processor to execute the requests | -
+/// task_priority | task processor queue lane of the request tasks: `normal` or `high` for short latency-critical handlers, see engine::TaskPriority | normal
 /// method | comma-separated list of allowed methods | -
 /// max_request_size | max size of the whole request | 1024 * 1024
 /// max_headers_size | max request headers size | 65536
@@ -37,8 +38,33 @@ namespace server::handlers {
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
 /// decompress_request | allow decompression of the requests | true
+/// response_compression.encodings | content codings to compress the response bodies with, in the order of preference: 'gzip', 'zstd' (USERVER_FEATURE_ZSTD builds), 'br' (USERVER_FEATURE_BROTLI builds) | [gzip]
+/// response_compression.min_body_size | do not compress smaller bodies, ignored for streamed bodies | 1024
+/// response_compression.level | compression level, clamped to the range of each encoding | 6 for gzip, 3 for zstd, 5 for br
+/// response_compression.task_processor | task processor to compress the bodies on | <compress in the handler task>
+/// response_cache.ways | number of the independently locked shards of the cache of the 200 responses to GET requests, the handler is not called on a hit | 16
+/// response_cache.size | total number of the cached responses | 1000
+/// response_cache.max_bytes | total size of the cached responses in bytes, 0 for no limit | 0
+/// response_cache.lifetime | the responses are recomputed once they are older | 1s
+/// response_cache.args | request arguments that the responses depend on | []
+/// response_cache.headers | request headers that the responses depend on, e.g. Accept-Language or Authorization | []
+/// admission_control.enabled | reject the requests that waited in the queues for too long before the handler started to process them | true
+/// admission_control.target_queue_time | acceptable queue time, the requests queued for longer are rejected once the minimal queue time stays above it for a whole interval | 5ms
+/// admission_control.interval | interval to watch the minimal queue time for, the requests queued for longer are always rejected | 100ms
+/// congestion_control.enabled | limit the requests in flight of the handler once its timings grow, see congestion_control::v2::GradientController | true
+/// congestion_control.fake_mode | compute and report the limit without rejecting the requests | false
+/// congestion_control.tolerance | the limit is decreased once the timings grow this many times compared to the long term timings | 2.0
+/// congestion_control.errors_threshold_percent | the limit is decreased once the percent of the timed out requests exceeds this value | 5.0
+/// congestion_control.min_timings | lower bound of the long term timings, so that jitter of the quick requests does not activate the limit | 20ms
+/// congestion_control.min_limit | the limit is never decreased below this value | 10
+/// congestion_control.min_qps | do not activate the limit with fewer requests per second | 10
+/// congestion_control.deactivate_delta | the limit is removed once it exceeds the requests in flight by this value | 10
+/// memory_accounting | account the request bodies, the PostgreSQL result sets and the other buffers charged with utils::MemoryCharge to the requests of the handler, see utils::MemoryAccount | <no accounting>
+/// memory_accounting.max_bytes_in_flight | soft limit of the bytes held by all the requests of the handler, the requests that go over it are answered with 429 | <no limit>
+/// memory_accounting.max_request_bytes | soft limit of the bytes held by a single request, the requests that go over it are answered with 429 | <no limit>
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
+/// request-body-stream | pass the HTTP/1.x request to the handler once its headers are received, the handler reads the body with server::http::RequestBodyStream while it is received; max_request_size still limits the whole request | false
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// deadline_propagation_enabled | when `false`, disables HTTP handler deadline propagation | true
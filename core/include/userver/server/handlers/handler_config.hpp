@@ -1,10 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <variant>
 #include <vector>
 
+#include <userver/congestion_control/controllers/gradient_config.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/server/handlers/auth/handler_auth_config.hpp>
 #include <userver/server/handlers/fallback_handlers.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -26,9 +29,84 @@ enum class UrlTrailingSlashOption {
   kDefault = kBoth,
 };
 
+/// Response body compression negotiated through the `Accept-Encoding` header
+struct ResponseCompressionConfig {
+  /// Content codings in the order of preference: "zstd", "br", "gzip"
+  std::vector<std::string> encodings{"gzip"};
+  /// Smaller bodies are sent as is, streamed bodies are always compressed
+  size_t min_body_size{1024};
+  /// Clamped to the range of each encoding, its default level if not set
+  std::optional<int> level;
+  /// Task processor to compress the bodies on, the handler task if not set
+  std::optional<std::string> task_processor;
+};
+
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<ResponseCompressionConfig>);
+
+/// Admission control that sheds the requests waited for too long before the
+/// handler started to process them, see AdmissionController
+struct AdmissionControlConfig {
+  bool enabled{true};
+  /// Acceptable queue time, the requests queued for longer are rejected once
+  /// the queue time stays above it for a whole interval
+  std::chrono::milliseconds target_queue_time{5};
+  /// Interval to watch the minimal queue time for, the requests queued for
+  /// longer are always rejected
+  std::chrono::milliseconds interval{100};
+};
+
+AdmissionControlConfig Parse(const yaml_config::YamlConfig& value,
+                             formats::parse::To<AdmissionControlConfig>);
+
+/// Congestion control that limits the requests in flight of the handler once
+/// its timings grow, see congestion_control::v2::GradientController
+struct HandlerCongestionControlConfig {
+  /// Compute and report the limit without rejecting the requests
+  bool fake_mode{false};
+  USERVER_NAMESPACE::congestion_control::v2::GradientConfig gradient{};
+};
+
+HandlerCongestionControlConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<HandlerCongestionControlConfig>);
+
+/// Cache of the ready responses to the GET requests of the handler, see
+/// ResponseCache
+struct ResponseCacheConfig {
+  /// Number of the independently locked shards
+  size_t ways{16};
+  /// Total number of the cached responses
+  size_t size{1000};
+  /// Total size of the cached responses in bytes, 0 for no limit
+  size_t max_bytes{0};
+  /// The responses are recomputed once they are older
+  std::chrono::milliseconds lifetime{1000};
+  /// Request arguments that the responses depend on
+  std::vector<std::string> args;
+  /// Request headers that the responses depend on
+  std::vector<std::string> headers;
+};
+
+ResponseCacheConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<ResponseCacheConfig>);
+
+/// Accounting of the memory held by the requests of the handler, see
+/// utils::MemoryAccount
+struct MemoryAccountingConfig {
+  /// Soft limit of the bytes held by all the requests of the handler
+  std::optional<size_t> max_bytes_in_flight;
+  /// Soft limit of the bytes held by a single request
+  std::optional<size_t> max_request_bytes;
+};
+
+MemoryAccountingConfig Parse(const yaml_config::YamlConfig& value,
+                             formats::parse::To<MemoryAccountingConfig>);
+
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
+  engine::TaskPriority task_priority{engine::TaskPriority::kNormal};
   std::string method;
   request::HttpRequestConfig request_config{};
   size_t request_body_size_log_limit{0};
@@ -38,8 +116,14 @@ struct HandlerConfig {
   std::optional<size_t> max_requests_in_flight;
   std::optional<size_t> max_requests_per_second;
   bool decompress_request{true};
+  std::optional<ResponseCompressionConfig> response_compression;
+  std::optional<ResponseCacheConfig> response_cache;
+  std::optional<AdmissionControlConfig> admission_control;
+  std::optional<HandlerCongestionControlConfig> congestion_control;
+  std::optional<MemoryAccountingConfig> memory_accounting;
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  bool request_body_stream{false};
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
@@ -19,6 +19,7 @@
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_response_body_stream_fwd.hpp>
+#include <userver/server/http/prepared_headers.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/tracing/span.hpp>
 
@@ -28,6 +29,10 @@ namespace tracing {
 class TracingManagerBase;
 }  // namespace tracing
 
+namespace utils {
+class MemoryAccount;
+}  // namespace utils
+
 /// @brief Most common \ref userver_http_handlers "userver HTTP handlers"
 namespace server::handlers {
 
@@ -35,6 +40,10 @@ class HttpHandlerStatistics;
 class HttpRequestStatistics;
 class HttpHandlerMethodStatistics;
 class HttpHandlerStatisticsScope;
+class ResponseCompression;
+class ResponseCache;
+class AdmissionController;
+class HandlerCongestionControl;
 
 // clang-format off
 
@@ -100,6 +109,11 @@ class HttpHandlerBase : public HandlerBase {
   [[noreturn]] void ThrowUnsupportedHttpMethod(
       const http::HttpRequest& request) const;
 
+  /// Declares headers sent with every response of the handler, they are
+  /// serialized once. Call it from the constructor of the derived handler.
+  /// @see server::http::PreparedHeaders
+  void AddConstantResponseHeaders(http::PreparedHeaders::Headers headers);
+
   /// The core method for HTTP request handling.
   /// `request` arg contains HTTP headers, full body, etc.
   /// The method should return response body.
@@ -122,6 +136,7 @@ class HttpHandlerBase : public HandlerBase {
   /// 3) The body size is huge and we want to have only a part of it
   ///    in memory.
   /// @note It is used only if IsStreamed() returned `true`.
+  /// @see server::http::MakeJsonBodyStreamBuilder for streaming a huge JSON
   virtual void HandleStreamRequest(const server::http::HttpRequest&,
                                    server::request::RequestContext&,
                                    server::http::ResponseBodyStream&) const;
@@ -174,6 +189,9 @@ class HttpHandlerBase : public HandlerBase {
                  request::RequestContext& context,
                  const dynamic_config::Snapshot& initial_config) const;
 
+  void CheckAdmission(const http::HttpRequest& http_request,
+                      const dynamic_config::Snapshot& initial_config) const;
+
   void CheckRatelimit(const http::HttpRequest& http_request) const;
 
   void DecompressRequestBody(http::HttpRequest& http_request) const;
@@ -183,7 +201,6 @@ class HttpHandlerBase : public HandlerBase {
                         const HttpStatistics& stats);
 
   void SetResponseAcceptEncoding(http::HttpResponse& response) const;
-  void SetResponseServerHostname(http::HttpResponse& response) const;
 
   const dynamic_config::Source config_source_;
   const std::vector<http::HttpMethod> allowed_methods_;
@@ -194,9 +211,15 @@ class HttpHandlerBase : public HandlerBase {
   std::unique_ptr<HttpHandlerStatistics> handler_statistics_;
   std::unique_ptr<HttpRequestStatistics> request_statistics_;
   std::vector<auth::AuthCheckerBasePtr> auth_checkers_;
+  std::unique_ptr<ResponseCompression> response_compression_;
+  std::unique_ptr<ResponseCache> response_cache_;
+  std::unique_ptr<AdmissionController> admission_controller_;
+  std::unique_ptr<HandlerCongestionControl> congestion_control_;
+  // Parent of the accounts of the requests
+  std::shared_ptr<utils::MemoryAccount> memory_account_;
 
   std::optional<logging::Level> log_level_;
-  bool set_response_server_hostname_;
+  std::optional<http::PreparedHeaders> constant_response_headers_;
   mutable utils::TokenBucket rate_limit_;
   bool is_body_streamed_;
 };
@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/http_handler_flatbuf_base.hpp
 /// @brief @copybrief server::handlers::HttpHandlerFlatbufBase
 
+#include <cstring>
+#include <string>
 #include <type_traits>
 
 #include <flatbuffers/flatbuffers.h>
@@ -21,6 +23,62 @@ namespace impl {
 inline const std::string kFlatbufRequestDataName = "__request_flatbuf";
 inline const std::string kFlatbufResponseDataName = "__response_flatbuf";
 
+inline constexpr std::size_t kFlatbufInitialResponseSize = 1024;
+
+/// Allocator for flatbuffers::FlatBufferBuilder that builds the buffer in a
+/// std::string, so that the finished buffer becomes the response body
+/// without a copy into a new string.
+class FlatbufStringAllocator final : public flatbuffers::Allocator {
+ public:
+  uint8_t* allocate(size_t size) override {
+    storage_.assign(size, '\0');
+    return reinterpret_cast<uint8_t*>(storage_.data());
+  }
+
+  // The buffer may already be owned by the result of ToString()
+  void deallocate(uint8_t*, size_t) override {}
+
+  uint8_t* reallocate_downward(uint8_t* old_p, size_t old_size,
+                               size_t new_size, size_t in_use_back,
+                               size_t in_use_front) override {
+    std::string new_storage(new_size, '\0');
+    auto* new_p = reinterpret_cast<uint8_t*>(new_storage.data());
+    memcpy_downward(old_p, old_size, new_p, new_size, in_use_back,
+                    in_use_front);
+    storage_.swap(new_storage);
+    return new_p;
+  }
+
+  /// Moves the finished buffer of the builder out of the allocator
+  std::string ToString(const flatbuffers::FlatBufferBuilder& fbb) {
+    const auto offset =
+        reinterpret_cast<const char*>(fbb.GetBufferPointer()) -
+        storage_.data();
+    const auto size = fbb.GetSize();
+
+    // flatbuffers are built from the back of the buffer
+    std::string result = std::move(storage_);
+    std::memmove(result.data(), result.data() + offset, size);
+    result.resize(size);
+    return result;
+  }
+
+ private:
+  std::string storage_;
+};
+
+template <typename InputType>
+const InputType& VerifyFlatbufRequest(const std::string& body) {
+  const auto* input_fbb = flatbuffers::GetRoot<InputType>(body.data());
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()),
+                                 body.size());
+  if (!input_fbb->Verify(verifier)) {
+    throw ClientError(
+        InternalMessage{"Invalid FlatBuffers format in request body"});
+  }
+  return *input_fbb;
+}
+
 }  // namespace impl
 
 // clang-format off
@@ -30,6 +88,10 @@ inline const std::string kFlatbufResponseDataName = "__response_flatbuf";
 /// @brief Convenient base for handlers that accept requests with body in
 /// Flatbuffer format and respond with body in Flatbuffer format.
 ///
+/// The request is unpacked into the object API types, see
+/// server::handlers::HttpHandlerFlatbufViewBase for the handlers that work
+/// with the request body in place.
+///
 /// ## Example usage:
 ///
 /// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - component
@@ -99,10 +161,12 @@ std::string HttpHandlerFlatbufBase<InputType, ReturnType>::HandleRequestThrow(
       impl::kFlatbufResponseDataName,
       HandleRequestFlatbufThrow(request, input, context));
 
-  flatbuffers::FlatBufferBuilder fbb;
+  impl::FlatbufStringAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb{impl::kFlatbufInitialResponseSize,
+                                     &allocator};
   auto ret_fbb = ReturnType::Pack(fbb, &ret);
   fbb.Finish(ret_fbb);
-  return {reinterpret_cast<const char*>(fbb.GetBufferPointer()), fbb.GetSize()};
+  return allocator.ToString(fbb);
 }
 
 template <typename InputType, typename ReturnType>
@@ -142,17 +206,11 @@ HttpHandlerFlatbufBase<InputType, ReturnType>::GetResponseDataForLogging(
 template <typename InputType, typename ReturnType>
 void HttpHandlerFlatbufBase<InputType, ReturnType>::ParseRequestData(
     const http::HttpRequest& request, request::RequestContext& context) const {
-  const auto& body = request.RequestBody();
-  const auto* input_fbb = flatbuffers::GetRoot<InputType>(body.data());
-  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()),
-                                 body.size());
-  if (!input_fbb->Verify(verifier)) {
-    throw ClientError(
-        InternalMessage{"Invalid FlatBuffers format in request body"});
-  }
+  const auto& input_fbb =
+      impl::VerifyFlatbufRequest<InputType>(request.RequestBody());
 
   typename InputType::NativeTableType input;
-  input_fbb->UnPackTo(&input);
+  input_fbb.UnPackTo(&input);
 
   context.SetData(impl::kFlatbufRequestDataName, std::move(input));
 }
@@ -165,6 +223,139 @@ HttpHandlerFlatbufBase<InputType, ReturnType>::GetStaticConfigSchema() {
   return schema;
 }
 
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Base for handlers that accept requests with body in Flatbuffer
+/// format and respond with body in Flatbuffer format without the object API.
+///
+/// Unlike server::handlers::HttpHandlerFlatbufBase, the handler gets a
+/// verified view into the request body and builds the response right in the
+/// buffer that becomes the response body, nothing is unpacked or copied.
+///
+/// ## Example usage:
+///
+/// @code
+/// flatbuffers::Offset<fbs::SampleResponse> HandleRequestFlatbufThrow(
+///     const server::http::HttpRequest&, const fbs::SampleRequest& request,
+///     flatbuffers::FlatBufferBuilder& builder,
+///     server::request::RequestContext&) const override {
+///   return fbs::CreateSampleResponse(builder, request.arg1() + request.arg2(),
+///                                    builder.CreateString(request.data()));
+/// }
+/// @endcode
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerFlatbufViewBase : public HttpHandlerBase {
+  static_assert(std::is_base_of<flatbuffers::Table, InputType>::value,
+                "Input type should be auto-generated FlatBuffers table type");
+  static_assert(std::is_base_of<flatbuffers::Table, ReturnType>::value,
+                "Return type should be auto-generated FlatBuffers table type");
+
+ public:
+  HttpHandlerFlatbufViewBase(
+      const components::ComponentConfig& config,
+      const components::ComponentContext& component_context);
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext& context) const final;
+
+  /// @param input verified view into the request body
+  /// @param builder builder of the response body
+  /// @returns the root table of the response built with `builder`
+  virtual flatbuffers::Offset<ReturnType> HandleRequestFlatbufThrow(
+      const http::HttpRequest& request, const InputType& input,
+      flatbuffers::FlatBufferBuilder& builder,
+      request::RequestContext& context) const = 0;
+
+  /// @returns A pointer to input data if it was verified successfully or
+  /// nullptr otherwise.
+  const InputType* GetInputData(const request::RequestContext& context) const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override it if you need a custom request body logging.
+  std::string GetRequestBodyForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& request_body) const override;
+
+  /// Override it if you need a custom response data logging.
+  std::string GetResponseDataForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& response_data) const override;
+
+  void ParseRequestData(const http::HttpRequest& request,
+                        request::RequestContext& context) const final;
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HttpHandlerFlatbufViewBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context) {}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto* input =
+      context.GetData<const InputType*>(impl::kFlatbufRequestDataName);
+
+  impl::FlatbufStringAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb{impl::kFlatbufInitialResponseSize,
+                                     &allocator};
+  fbb.Finish(HandleRequestFlatbufThrow(request, *input, fbb, context));
+  return allocator.ToString(fbb);
+}
+
+template <typename InputType, typename ReturnType>
+const InputType*
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetInputData(
+    const request::RequestContext& context) const {
+  const auto* input =
+      context.GetDataOptional<const InputType*>(impl::kFlatbufRequestDataName);
+  return input ? *input : nullptr;
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetRequestBodyForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& request_body) const {
+  size_t limit = GetConfig().request_body_size_log_limit;
+  return utils::log::ToLimitedHex(request_body, limit);
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetResponseDataForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& response_data) const {
+  size_t limit = GetConfig().response_data_size_log_limit;
+  return utils::log::ToLimitedHex(response_data, limit);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  // the request body outlives the request context data
+  const InputType* input =
+      &impl::VerifyFlatbufRequest<InputType>(request.RequestBody());
+  context.SetData(impl::kFlatbufRequestDataName, input);
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("HTTP handler flatbuf view base config");
+  return schema;
+}
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -3,6 +3,9 @@
 /// @file userver/server/handlers/http_handler_static.hpp
 /// @brief @copybrief server::handlers::HttpHandlerStatic
 
+#include <optional>
+#include <string>
+
 #include <userver/components/fs_cache.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/fs/fs_cache_client.hpp>
@@ -28,9 +31,19 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// Name               | Description                                                 | Default value
+/// ------------------ | ----------------------------------------------------------- | -------------
+/// fs-cache-component | Name of the FsCache component                               | fs-cache-component
+/// zero-copy-dir      | Directory to serve the files from instead of the FsCache    | -
+/// fs-task-processor  | Task processor to open the files from `zero-copy-dir` on   | fs-task-processor
+///
+/// Responses carry an `ETag` built from the file size and modification time,
+/// `If-None-Match` requests get 304 responses and a single byte range of the
+/// `Range` header gets a 206 one.
+///
+/// With `zero-copy-dir` the files are opened per request, HTTP/1 responses
+/// are sent with sendfile(2) and HTTP/2 ones are read with pread(2),
+/// see server::http::ResponseFileBody. Hidden files are not served.
 ///
 /// ## Example usage:
 ///
@@ -55,8 +68,13 @@ class HttpHandlerStatic final : public HttpHandlerBase {
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  std::string ServeFromCache(const http::HttpRequest& request) const;
+  std::string ServeZeroCopy(const http::HttpRequest& request) const;
+
   dynamic_config::Source config_;
-  const fs::FsCacheClient& storage_;
+  const std::optional<std::string> zero_copy_dir_;
+  const fs::FsCacheClient* storage_{nullptr};
+  engine::TaskProcessor* fs_task_processor_{nullptr};
 };
 
 }  // namespace server::handlers
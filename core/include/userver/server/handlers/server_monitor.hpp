@@ -3,8 +3,10 @@
 /// @file userver/server/handlers/server_monitor.hpp
 /// @brief @copybrief server::handlers::ServerMonitor
 
+#include <userver/engine/mutex.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -39,6 +41,12 @@ namespace server::handlers {
 ///   be a JSON dictionary in the form '{"label1":"value1", "label2":"value2"}'.
 /// * path - return metrics on for the following path
 /// * prefix - return metrics whose path starts from the specified prefix.
+///
+/// With the `response-body-streamed: true` static option the "prometheus",
+/// "prometheus-untyped", "graphite" and "solomon" formats are written to the
+/// response in chunks, without keeping the whole response in memory.
+/// Prometheus metric names and rendered labels are cached between the
+/// requests in any mode.
 
 // clang-format on
 class ServerMonitor final : public HttpHandlerBase {
@@ -53,9 +61,26 @@ class ServerMonitor final : public HttpHandlerBase {
   std::string HandleRequestThrow(const http::HttpRequest& request,
                                  request::RequestContext&) const override;
 
+  void HandleStreamRequest(const http::HttpRequest& request,
+                           request::RequestContext& context,
+                           http::ResponseBodyStream& response) const override;
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  struct ParsedRequest;
+
+  ParsedRequest ParseRequest(const http::HttpRequest& request) const;
+
+  // Returns `false` if the cache is used by another request
+  bool WritePrometheusCached(
+      const ParsedRequest& parsed,
+      const utils::statistics::ChunkConsumer& consumer) const;
+
+  void WritePrometheus(const ParsedRequest& parsed,
+                       utils::statistics::PrometheusCache& cache,
+                       const utils::statistics::ChunkConsumer& consumer) const;
+
   std::string GetResponseDataForLogging(
       const http::HttpRequest& request, request::RequestContext& context,
       const std::string& response_data) const override;
@@ -64,6 +89,9 @@ class ServerMonitor final : public HttpHandlerBase {
 
   using CommonLabels = std::unordered_map<std::string, std::string>;
   const CommonLabels common_labels_;
+
+  mutable engine::Mutex prometheus_cache_mutex_;
+  mutable utils::statistics::PrometheusCache prometheus_cache_;
 };
 
 }  // namespace server::handlers
@@ -0,0 +1,78 @@
+#pragma once
+
+/// @file userver/server/http/form_data_stream.hpp
+/// @brief @copybrief server::http::FormDataStream
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpRequest;
+class RequestBodyStream;
+class MultipartFormDataStreamParser;
+
+/// @brief Headers of a part of a multipart/form-data body
+struct FormDataPart {
+  std::string name;
+  std::string content_disposition;
+  std::optional<std::string> filename;
+  std::optional<std::string> content_type;
+  /// `charset` parameter of the request Content-Type
+  std::optional<std::string> default_charset;
+};
+
+/// @brief Reads a multipart/form-data request body part by part while it is
+/// received, see server::http::RequestBodyStream.
+///
+/// Unlike HttpRequest::GetFormDataArg() the whole body is never kept in memory,
+/// so it suits the uploads of large files. Only CRLF line breaks are supported
+/// and `_charset_` parts are returned as is.
+///
+/// @code
+/// server::http::FormDataStream form_data{request};
+/// server::http::FormDataPart part;
+/// std::string chunk;
+/// while (form_data.NextPart(part)) {
+///   while (form_data.ReadPartChunk(chunk)) Write(part.name, chunk);
+/// }
+/// @endcode
+class FormDataStream final {
+ public:
+  /// @throws server::handlers::RequestParseError if the request is not a valid
+  /// multipart/form-data one
+  explicit FormDataStream(const HttpRequest& request);
+
+  FormDataStream(FormDataStream&&) noexcept;
+  FormDataStream& operator=(FormDataStream&&) = delete;
+  ~FormDataStream();
+
+  /// @brief Waits for the headers of the next part, the rest of the current
+  /// part value is skipped.
+  /// @returns false once there are no more parts
+  /// @throws server::handlers::RequestParseError on malformed body, see
+  /// RequestBodyStream::ReadChunk() for the other exceptions
+  bool NextPart(FormDataPart& part, engine::Deadline deadline = {});
+
+  /// @brief Waits for the next chunk of the current part value.
+  /// @returns false at the end of the part value
+  /// @throws server::handlers::RequestParseError on malformed body, see
+  /// RequestBodyStream::ReadChunk() for the other exceptions
+  bool ReadPartChunk(std::string& chunk, engine::Deadline deadline = {});
+
+ private:
+  void ReadMore(engine::Deadline deadline);
+
+  RequestBodyStream& body_;
+  std::unique_ptr<MultipartFormDataStreamParser> parser_;
+  bool is_in_part_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -22,6 +22,7 @@ USERVER_NAMESPACE_BEGIN
 namespace server::http {
 
 class HttpRequestImpl;
+class RequestBodyStream;
 
 /// @brief HTTP Request data
 class HttpRequest final {
@@ -172,9 +173,15 @@ class HttpRequest final {
   /// @return List of cookies names.
   CookiesMapKeys GetCookieNames() const;
 
-  /// @return HTTP body.
+  /// @return HTTP body, empty for the handlers with the
+  /// `request-body-stream: true` static option, see GetBodyStream().
   const std::string& RequestBody() const;
 
+  /// @return HTTP body to read in chunks, the chunks are received while the
+  /// handler reads them for the handlers with the `request-body-stream: true`
+  /// static option.
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Body of an HTTP request that is read by the handler in chunks.
+///
+/// For handlers with the `request-body-stream: true` static option the
+/// request is passed to the handler as soon as its headers are received and
+/// the chunks of the HTTP/1.x body are handed to the handler as they arrive.
+/// The connection stops reading from the socket while kMaxBufferedChunks
+/// chunks of at most kMaxChunkSize bytes are waiting for the handler, so a
+/// slow handler slows down the client instead of buffering the whole body in
+/// memory. Once the handler is done with the request the rest of the body is
+/// discarded without waiting for the handler.
+///
+/// The streamed body is not decompressed and the `parse_args_from_body`
+/// option is ignored, multipart/form-data bodies could be read with
+/// server::http::FormDataStream.
+///
+/// In all the other cases (other handlers, HTTP/2 requests) the whole body is
+/// already received and is returned as a single chunk.
+class RequestBodyStream final {
+ public:
+  using Queue = concurrent::SpscQueue<std::string>;
+
+  /// Max number of received chunks not yet read by the handler
+  static constexpr std::size_t kMaxBufferedChunks = 8;
+
+  /// Max size of a chunk, the bigger reads of the connection are split
+  static constexpr std::size_t kMaxChunkSize = 16 * 1024;
+
+  /// @cond
+  explicit RequestBodyStream(const std::string& buffered_body);
+
+  RequestBodyStream(RequestBodyStream&&) = delete;
+  RequestBodyStream& operator=(RequestBodyStream&&) = delete;
+
+  // The chunks are pushed by the connection, an empty chunk ends the body
+  void SetConsumer(Queue::Consumer&& consumer);
+
+  // Lets the connection discard the rest of the body, called once the
+  // handler is done with the request
+  void Close() noexcept;
+  /// @endcond
+
+  /// @brief Waits for the next chunk of the body.
+  /// @returns false once the whole body was read, `chunk` is empty then
+  /// @throws server::handlers::ClientError if the client did not send the
+  /// whole body
+  /// @throws engine::WaitInterruptedException on deadline or cancellation
+  bool ReadChunk(std::string& chunk, engine::Deadline deadline = {});
+
+  /// @brief Reads the rest of the body, throws just like ReadChunk()
+  std::string ReadAll(engine::Deadline deadline = {});
+
+  /// @returns true if the body is received while the handler runs
+  bool IsStreamed() const noexcept;
+
+  /// @returns true if the whole body was read
+  bool IsFinished() const noexcept;
+
+ private:
+  const std::string& buffered_body_;
+  std::optional<Queue::Consumer> consumer_;
+  bool is_streamed_{false};
+  bool is_finished_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
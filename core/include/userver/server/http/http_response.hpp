@@ -4,6 +4,7 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -30,6 +31,9 @@ void OutputHeader(std::string& header, std::string_view key,
 }
 
 class HttpRequestImpl;
+class Http2Session;
+class ResponseFileBody;
+class PreparedHeaders;
 
 /// @brief HTTP Response data
 class HttpResponse final : public request::ResponseBase {
@@ -119,6 +123,7 @@ class HttpResponse final : public request::ResponseBase {
   /// @cond
   // TODO: server internals. remove from public interface
   void SendResponse(engine::io::Socket& socket) override;
+  void SendResponse(Http2Session& session);
   /// @endcond
 
   void SetStatusServiceUnavailable() override {
@@ -137,6 +142,16 @@ class HttpResponse final : public request::ResponseBase {
   // Can be called only once
   Queue::Producer GetBodyProducer();
 
+  /// @brief Sends the headers serialized beforehand along with the ones set
+  /// by SetHeader(), the headers must outlive the response, see
+  /// server::http::PreparedHeaders
+  void SetPreparedHeaders(const PreparedHeaders& headers);
+
+  /// @brief Sends the [offset, offset + size) range of the file as the body
+  /// if no data is set, see server::http::ResponseFileBody
+  void SetFileBody(std::shared_ptr<const ResponseFileBody> file,
+                   std::size_t offset, std::size_t size);
+
  private:
   // Returns total size of the response
   std::size_t SetBodyStreamed(engine::io::Socket& socket, std::string& header);
@@ -145,6 +160,9 @@ class HttpResponse final : public request::ResponseBase {
   std::size_t SetBodyNotStreamed(engine::io::Socket& socket,
                                  std::string& header);
 
+  bool HasPreparedContentType() const;
+  bool HasPreparedDate() const;
+
   const HttpRequestImpl& request_;
   HttpStatus status_ = HttpStatus::kOk;
   HeadersMap headers_;
@@ -153,6 +171,11 @@ class HttpResponse final : public request::ResponseBase {
   engine::SingleConsumerEvent headers_end_;
   std::optional<Queue::Consumer> body_stream_;
   std::optional<Queue::Producer> body_stream_producer_;
+
+  const PreparedHeaders* prepared_headers_{nullptr};
+  std::shared_ptr<const ResponseFileBody> file_body_;
+  std::size_t file_body_offset_{0};
+  std::size_t file_body_size_{0};
 };
 
 void SetThrottleReason(http::HttpResponse& http_response,
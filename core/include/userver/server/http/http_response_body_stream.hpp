@@ -1,12 +1,18 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <string_view>
 
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/response_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace compression {
+class Compressor;
+}
+
 namespace server::handlers {
 class HttpHandlerBase;
 }
@@ -15,7 +21,8 @@ namespace server::http {
 
 class ResponseBodyStream final {
  public:
-  ResponseBodyStream(ResponseBodyStream&&) = default;
+  ResponseBodyStream(ResponseBodyStream&&);
+  ~ResponseBodyStream();
 
   // Send a chunk of response data. It may NOT generate
   // exactly one HTTP chunk per call to PushBodyChunk().
@@ -38,9 +45,16 @@ class ResponseBodyStream final {
       server::http::HttpResponse::Queue::Producer&& queue_producer,
       server::http::HttpResponse& http_response);
 
+  // The body is compressed if the headers end without Content-Encoding
+  void SetCompressor(std::unique_ptr<compression::Compressor> compressor,
+                     std::string_view content_encoding);
+  void FinishCompression(engine::Deadline deadline);
+
   bool headers_ended_{false};
   HttpResponse::Queue::Producer queue_producer_;
   server::http::HttpResponse& http_response_;
+  std::unique_ptr<compression::Compressor> compressor_;
+  std::string_view compressor_encoding_;
 };
 
 }  // namespace server::http
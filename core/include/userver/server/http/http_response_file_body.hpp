@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/server/http/http_response_file_body.hpp
+/// @brief @copybrief server::http::ResponseFileBody
+
+#include <cstddef>
+#include <ctime>
+#include <string>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Regular file to send as a response body without keeping it in
+/// the process memory.
+///
+/// HTTP/1 responses are sent with sendfile(2), small files and HTTP/2
+/// responses are read with pread(2) right before sending. The file must not
+/// be truncated while the body is alive, replace files by renaming instead.
+class ResponseFileBody final {
+ public:
+  /// @brief Opens the file, blocks the current thread
+  /// @throws std::system_error if the file can't be opened
+  /// @throws std::runtime_error if it is not a regular file
+  explicit ResponseFileBody(const std::string& path);
+
+  ResponseFileBody(const ResponseFileBody&) = delete;
+  ResponseFileBody& operator=(const ResponseFileBody&) = delete;
+
+  int GetFd() const { return file_.GetNative(); }
+  std::size_t GetSize() const { return size_; }
+  std::time_t GetLastWriteTime() const { return last_write_time_; }
+
+  /// @brief Reads `size` bytes from `offset`, blocks the current thread
+  /// @throws std::system_error if the file can't be read
+  /// @throws std::runtime_error if the file was truncated
+  std::string Read(std::size_t offset, std::size_t size) const;
+
+ private:
+  fs::blocking::FileDescriptor file_;
+  std::size_t size_{0};
+  std::time_t last_write_time_{0};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
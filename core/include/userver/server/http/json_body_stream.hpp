@@ -0,0 +1,45 @@
+#pragma once
+
+/// @file userver/server/http/json_body_stream.hpp
+/// @brief @copybrief server::http::MakeJsonBodyStreamBuilder
+
+#include <cstddef>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/server/http/http_response_body_stream_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// Default size of the body chunks for MakeJsonBodyStreamBuilder
+inline constexpr std::size_t kDefaultJsonBodyChunkSize = 64 * 1024;
+
+/// @brief Returns formats::json::StringBuilder that sends the written JSON to
+/// the `stream` as soon as at least `chunk_size` bytes are buffered.
+///
+/// Allows streaming huge JSON responses from
+/// server::handlers::HttpHandlerBase::HandleStreamRequest without building
+/// them in memory. The headers must be ended before the first write and
+/// formats::json::StringBuilder::Flush() must be called after the last one.
+///
+/// @code
+/// response.SetHeader(http::headers::kContentType, "application/json");
+/// response.SetEndOfHeaders();
+///
+/// auto builder = server::http::MakeJsonBodyStreamBuilder(response);
+/// {
+///   formats::json::StringBuilder::ArrayGuard guard{builder};
+///   for (const auto& item : items) WriteToStream(item, builder);
+/// }
+/// builder.Flush();
+/// @endcode
+formats::json::StringBuilder MakeJsonBodyStreamBuilder(
+    ResponseBodyStream& stream,
+    std::size_t chunk_size = kDefaultJsonBodyChunkSize,
+    engine::Deadline deadline = {});
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#pragma once
+
+/// @file userver/server/http/prepared_headers.hpp
+/// @brief @copybrief server::http::PreparedHeaders
+
+#include <string>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Response headers that are the same for every response, serialized
+/// once.
+///
+/// Build it at handler construction and attach it to the responses with
+/// HttpResponse::SetPreparedHeaders(): HTTP/1 responses append the serialized
+/// block as is, without hashing and formatting the headers again.
+///
+/// The headers are not visible through HttpResponse::GetHeader() and must not
+/// be set with HttpResponse::SetHeader() too, or they are sent twice.
+class PreparedHeaders final {
+ public:
+  using Headers = std::vector<std::pair<std::string, std::string>>;
+
+  /// @throws std::runtime_error on invalid names and values and on the
+  /// headers the server sets itself: Content-Length, Connection and alike
+  explicit PreparedHeaders(Headers headers);
+
+  const Headers& GetHeaders() const { return headers_; }
+
+  /// @cond
+  // Serialized `name: value\r\n` lines
+  const std::string& GetHttp1Block() const { return http1_block_; }
+
+  // Lowercase names for HTTP/2
+  const Headers& GetLowercaseHeaders() const { return lowercase_headers_; }
+
+  bool HasContentType() const { return has_content_type_; }
+  bool HasDate() const { return has_date_; }
+  /// @endcond
+
+ private:
+  Headers headers_;
+  std::string http1_block_;
+  Headers lowercase_headers_;
+  bool has_content_type_{false};
+  bool has_date_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
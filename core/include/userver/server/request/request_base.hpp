@@ -11,6 +11,14 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace server {
+class RequestsView;
+}  // namespace server
+
+namespace server::impl {
+struct RequestsViewShard;
+}  // namespace server::impl
+
 namespace server::request {
 
 class RequestBase {
@@ -58,6 +66,16 @@ class RequestBase {
   std::chrono::steady_clock::time_point start_send_response_time_;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point finish_send_response_time_;
+
+ private:
+  friend class server::RequestsView;
+
+  // The request is linked into a shard of server::RequestsView while it is
+  // alive, if there is an InspectRequests handler
+  std::weak_ptr<RequestBase> view_self_;
+  server::impl::RequestsViewShard* view_shard_{nullptr};
+  RequestBase* view_prev_{nullptr};
+  RequestBase* view_next_{nullptr};
 };
 
 }  // namespace server::request
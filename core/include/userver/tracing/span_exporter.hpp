@@ -0,0 +1,62 @@
+#pragma once
+
+/// @file userver/tracing/span_exporter.hpp
+/// @brief @copybrief tracing::SpanExporter
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/logging/level.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/tracing/tracer_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief Data of a finished tracing::Span
+struct SpanData final {
+  std::string name;
+  std::string trace_id;
+  std::string span_id;
+  std::string parent_id;
+  ReferenceType reference_type{ReferenceType::kChild};
+  logging::Level log_level{logging::Level::kInfo};
+  std::string service_name;
+
+  std::chrono::system_clock::time_point start_time;
+  std::chrono::nanoseconds duration{0};
+
+  /// Tags of the span, including the inherited ones
+  std::vector<logging::LogExtra::Pair> tags;
+  /// Total times of the tracing::ScopeTime measurements of the span
+  std::vector<std::pair<std::string, std::chrono::nanoseconds>> timings;
+};
+
+/// @brief Base class for the receivers of the finished spans, e.g.
+/// otlp::SpanExporterComponent
+///
+/// When an exporter is set by tracing::SetSpanExporter, the spans that pass
+/// the log level checks are handed to it on finish and are not written to the
+/// default and the opentracing loggers.
+class SpanExporter {
+ public:
+  virtual ~SpanExporter();
+
+  /// Called on the task that finishes the span, should not block
+  virtual void Export(SpanData&& span) noexcept = 0;
+};
+
+/// Returns the current span exporter, if any
+std::shared_ptr<SpanExporter> GetSpanExporter();
+
+/// Atomically replaces the span exporter, `nullptr` returns the spans to
+/// the logs
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
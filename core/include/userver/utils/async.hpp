@@ -41,7 +41,7 @@ struct SpanWrapCall {
 
   struct Impl;
 
-  static constexpr std::size_t kImplSize = 4264;
+  static constexpr std::size_t kImplSize = 4384;
   static constexpr std::size_t kImplAlign = 8;
   utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
@@ -180,6 +180,57 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task on a coroutine with the requested stack size,
+/// task execution may be cancelled before the function starts execution in
+/// case of TaskProcessor overload.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param tasks_processor Task processor to run on
+/// @param name Name of the task to show in logs
+/// @param stack_size_class Coroutine stack size to run the task with
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
+                         std::string name,
+                         engine::StackSizeClass stack_size_class, Function&& f,
+                         Args&&... args) {
+  return engine::AsyncNoSpan(
+      task_processor, stack_size_class, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task in the requested task processor queue lane,
+/// task execution may be cancelled before the function starts execution in
+/// case of TaskProcessor overload.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param tasks_processor Task processor to run on
+/// @param name Name of the task to show in logs
+/// @param priority Task processor queue lane to run the task in
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
+                         std::string name, engine::TaskPriority priority,
+                         Function&& f, Args&&... args) {
+  return engine::AsyncNoSpan(
+      task_processor, priority, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task with deadline, task execution may be cancelled
@@ -301,6 +352,29 @@ template <typename Function, typename... Args>
                             std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task on current task processor in the requested
+/// queue lane, task execution may be cancelled before the function starts
+/// execution in case of engine::TaskProcessor overload.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param name Name of the task to show in logs
+/// @param priority Task processor queue lane to run the task in
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(std::string name, engine::TaskPriority priority,
+                         Function&& f, Args&&... args) {
+  return utils::Async(engine::current_task::GetTaskProcessor(), std::move(name),
+                      priority, std::forward<Function>(f),
+                      std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task with deadline on current task processor, task
@@ -323,6 +397,30 @@ template <typename Function, typename... Args>
                       std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task on current task processor on a coroutine with
+/// the requested stack size, task execution may be cancelled before the
+/// function starts execution in case of engine::TaskProcessor overload.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param name Name of the task to show in logs
+/// @param stack_size_class Coroutine stack size to run the task with
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(std::string name,
+                         engine::StackSizeClass stack_size_class, Function&& f,
+                         Args&&... args) {
+  return utils::Async(engine::current_task::GetTaskProcessor(), std::move(name),
+                      stack_size_class, std::forward<Function>(f),
+                      std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task with deadline on current task processor, task
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <chrono>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+// Same as std::chrono::steady_clock::now(). With the 'fast-steady-clock'
+// userver experiment enabled and the kernel clocksource being 'tsc', the time
+// is extrapolated from the TSC instead of the clock_gettime() call. The
+// extrapolation is kept continuous and is recalibrated against the
+// steady_clock every second, so that the time points of both are comparable
+// up to a few microseconds.
+std::chrono::steady_clock::time_point FastSteadyNow() noexcept;
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -64,6 +64,8 @@ extern UserverExperiment kRedisClusterAutoTopologyExperiment;
 
 extern UserverExperiment kPhdrCacheExperiment;
 
+extern UserverExperiment kFastSteadyClockExperiment;
+
 // TODO move to userver/grpc once the issues with linker are resolved.
 extern UserverExperiment kGrpcClientDeadlinePropagationExperiment;
 extern UserverExperiment kGrpcServerDeadlinePropagationExperiment;
@@ -0,0 +1,154 @@
+#pragma once
+
+/// @file userver/utils/memory_account.hpp
+/// @brief @copybrief utils::MemoryAccount
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @brief Thrown if a utils::MemoryCharge would bring a utils::MemoryAccount
+/// or one of its parents over the limit
+///
+/// The HTTP handlers answer with 429 Too Many Requests if it is thrown out of
+/// the request processing.
+class MemoryLimitExceeded final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Hierarchical counter of the bytes held by a request, a handler or
+/// another component, with an optional soft limit
+///
+/// The bytes charged to an account are also charged to all of its parents, so
+/// the accounts of the requests are nested into the account of their handler.
+/// The accounting is explicit: the buffers that are known to be large, like
+/// the HTTP request bodies or the PostgreSQL result sets, are charged with
+/// utils::MemoryCharge for as long as they are held, not every allocation.
+///
+/// The current account is inherited by the child tasks, see
+/// utils::MemoryAccountScope.
+class MemoryAccount final {
+ public:
+  /// @param limit soft limit, utils::MemoryCharge fails to go over it
+  /// @param parent account that is charged together with this one
+  explicit MemoryAccount(std::optional<std::size_t> limit = std::nullopt,
+                         std::shared_ptr<MemoryAccount> parent = {}) noexcept;
+
+  MemoryAccount(MemoryAccount&&) = delete;
+  MemoryAccount& operator=(MemoryAccount&&) = delete;
+  ~MemoryAccount();
+
+  /// @brief Charges `bytes` to this account and its parents
+  /// @returns false and charges nothing if one of the accounts would go
+  /// over its limit
+  bool TryCharge(std::size_t bytes) noexcept;
+
+  /// @brief Charges `bytes` to this account and its parents ignoring the
+  /// limits, for the memory that is already allocated and cannot be dropped
+  void ForceCharge(std::size_t bytes) noexcept;
+
+  /// Returns `bytes` charged earlier to this account and its parents
+  void Release(std::size_t bytes) noexcept;
+
+  /// @returns the bytes charged now, including the nested accounts
+  std::size_t GetCurrentBytes() const noexcept;
+
+  /// @returns whether this account or one of its parents is over the limit,
+  /// which happens after ForceCharge
+  bool IsOverLimit() const noexcept;
+
+  /// @brief Writes the current and the peak bytes, the limit, the total of the
+  /// charged bytes and the count of the rejected charges
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const MemoryAccount& account);
+
+ private:
+  bool DoTryCharge(std::size_t bytes) noexcept;
+  void DoForceCharge(std::size_t bytes) noexcept;
+  void DoRelease(std::size_t bytes) noexcept;
+  void UpdatePeak(std::size_t current_bytes) noexcept;
+
+  const std::optional<std::size_t> limit_;
+  const std::shared_ptr<MemoryAccount> parent_;
+  std::atomic<std::size_t> current_bytes_{0};
+  std::atomic<std::size_t> peak_bytes_{0};
+  utils::statistics::RateCounter charged_bytes_;
+  utils::statistics::RateCounter rejected_;
+};
+
+/// @brief RAII charge of a utils::MemoryAccount, the bytes are released on
+/// destruction
+class [[nodiscard]] MemoryCharge final {
+ public:
+  /// Creates an empty charge
+  MemoryCharge() noexcept = default;
+
+  /// @brief Charges `bytes` to `account`, if it is not null
+  /// @throws utils::MemoryLimitExceeded if the account or one of its parents
+  /// would go over the limit
+  MemoryCharge(std::shared_ptr<MemoryAccount> account, std::size_t bytes);
+
+  /// Charges `bytes` to `account`, if it is not null, ignoring the limits
+  static MemoryCharge Force(std::shared_ptr<MemoryAccount> account,
+                            std::size_t bytes) noexcept;
+
+  MemoryCharge(MemoryCharge&& other) noexcept;
+  MemoryCharge& operator=(MemoryCharge&& other) noexcept;
+  ~MemoryCharge();
+
+  /// @returns the charged bytes, 0 for an empty charge
+  std::size_t GetBytes() const noexcept { return bytes_; }
+
+ private:
+  struct ForceTag {};
+
+  MemoryCharge(ForceTag, std::shared_ptr<MemoryAccount>&& account,
+               std::size_t bytes) noexcept;
+
+  void Reset() noexcept;
+
+  std::shared_ptr<MemoryAccount> account_;
+  std::size_t bytes_{0};
+};
+
+/// @returns the memory account of the current task or nullptr
+std::shared_ptr<MemoryAccount> GetCurrentMemoryAccount() noexcept;
+
+/// @brief Charges `bytes` to the memory account of the current task, if any
+/// @throws utils::MemoryLimitExceeded if the account or one of its parents
+/// would go over the limit
+MemoryCharge ChargeCurrentMemoryAccount(std::size_t bytes);
+
+/// @brief Charges `bytes` to the memory account of the current task, if any,
+/// ignoring the limits
+MemoryCharge ForceChargeCurrentMemoryAccount(std::size_t bytes) noexcept;
+
+/// @brief Makes `account` the memory account of the current task and of the
+/// tasks it starts within the scope, restores the previous one on destruction
+class [[nodiscard]] MemoryAccountScope final {
+ public:
+  explicit MemoryAccountScope(std::shared_ptr<MemoryAccount> account);
+
+  MemoryAccountScope(MemoryAccountScope&&) = delete;
+  MemoryAccountScope& operator=(MemoryAccountScope&&) = delete;
+  ~MemoryAccountScope();
+
+ private:
+  std::shared_ptr<MemoryAccount> previous_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
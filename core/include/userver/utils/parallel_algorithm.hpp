@@ -0,0 +1,288 @@
+#pragma once
+
+/// @file userver/utils/parallel_algorithm.hpp
+/// @brief Parallel versions of the standard algorithms that run on an
+/// engine::TaskProcessor
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/parallel_for.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func(begin, end)` for each chunk of `chunk_size` indices in
+/// `[0, count)` using at most `max_parallelism` tasks of the `task_processor`,
+/// waits for all the calls to finish.
+///
+/// The workers yield after each chunk, so that other tasks of the
+/// `task_processor` are not starved, and stop on cancellation between the
+/// chunks.
+///
+/// @see utils::ParallelFor for the error handling
+template <typename Function>
+void ParallelForChunks(engine::TaskProcessor& task_processor,
+                       const std::string& name, std::size_t count,
+                       std::size_t chunk_size, std::size_t max_parallelism,
+                       Function&& func) {
+  UINVARIANT(chunk_size > 0, "chunk_size must be positive");
+  const auto chunks_count = (count + chunk_size - 1) / chunk_size;
+
+  utils::ParallelFor(task_processor, name, chunks_count, max_parallelism,
+                     [&](std::size_t chunk) {
+                       const auto begin = chunk * chunk_size;
+                       func(begin, std::min(begin + chunk_size, count));
+                       engine::Yield();
+                     });
+}
+
+namespace impl {
+
+// Large enough to hide the per-chunk overhead, small enough for the workers
+// to yield every few milliseconds
+inline constexpr std::size_t kMinParallelChunkSize = 1024;
+inline constexpr std::size_t kMaxParallelChunkSize = 64 * 1024;
+
+// A few chunks per worker even out the load if some workers are slower
+inline constexpr std::size_t kParallelChunksPerWorker = 4;
+
+inline std::size_t GetParallelChunkSize(std::size_t count,
+                                        std::size_t max_parallelism) {
+  UINVARIANT(max_parallelism > 0, "max_parallelism must be positive");
+  const auto chunk_size = count / (max_parallelism * kParallelChunksPerWorker);
+  return std::clamp(chunk_size, kMinParallelChunkSize, kMaxParallelChunkSize);
+}
+
+template <typename Function>
+void ParallelForAutoChunks(engine::TaskProcessor& task_processor,
+                           const std::string& name, std::size_t count,
+                           std::size_t max_parallelism, Function&& func) {
+  utils::ParallelForChunks(task_processor, name, count,
+                           GetParallelChunkSize(count, max_parallelism),
+                           max_parallelism, std::forward<Function>(func));
+}
+
+// Number of elements of `a` among the first `k` elements of
+// std::merge(a, b), found without merging
+template <typename RandomIt, typename Compare>
+std::size_t FindMergeSplit(RandomIt a, std::size_t a_size, RandomIt b,
+                           std::size_t b_size, std::size_t k, Compare& comp) {
+  std::size_t low = k > b_size ? k - b_size : 0;
+  std::size_t high = std::min(k, a_size);
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    // std::merge takes from `b` only if its element is strictly less
+    if (!comp(b[k - middle - 1], a[middle])) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// std::merge that moves the elements
+template <typename InputIt, typename OutputIt, typename Compare>
+void MoveMerge(InputIt a, InputIt a_last, InputIt b, InputIt b_last,
+               OutputIt out, Compare& comp) {
+  while (a != a_last && b != b_last) {
+    if (comp(*b, *a)) {
+      *out++ = std::move(*b++);
+    } else {
+      *out++ = std::move(*a++);
+    }
+  }
+  out = std::move(a, a_last, out);
+  std::move(b, b_last, out);
+}
+
+// Merges the sorted runs of `run_size` elements pairwise from `from` into
+// `to`, every merge is split into chunks that are processed in parallel
+template <typename FromIt, typename ToIt, typename Compare>
+void ParallelMergeRuns(engine::TaskProcessor& task_processor,
+                       const std::string& name, std::size_t max_parallelism,
+                       FromIt from, ToIt to, std::size_t count,
+                       std::size_t run_size, Compare& comp) {
+  const auto chunk_size = GetParallelChunkSize(count, max_parallelism);
+  const auto chunks_count = (count + chunk_size - 1) / chunk_size;
+  const auto get_pair_begin = [run_size](std::size_t pos) {
+    return pos / (2 * run_size) * (2 * run_size);
+  };
+
+  // The elements are moved out of `from` by the merges, so the chunk
+  // boundaries are found beforehand
+  std::vector<std::size_t> splits(chunks_count);
+  for (std::size_t chunk = 0; chunk < chunks_count; ++chunk) {
+    const auto pos = chunk * chunk_size;
+    const auto pair_begin = get_pair_begin(pos);
+    const auto middle = std::min(pair_begin + run_size, count);
+    const auto pair_end = std::min(pair_begin + 2 * run_size, count);
+    splits[chunk] =
+        impl::FindMergeSplit(from + pair_begin, middle - pair_begin,
+                             from + middle, pair_end - middle,
+                             pos - pair_begin, comp);
+  }
+
+  utils::ParallelForChunks(
+      task_processor, name, count, chunk_size, max_parallelism,
+      [&](std::size_t begin, std::size_t end) {
+        while (begin != end) {
+          const auto pair_begin = get_pair_begin(begin);
+          const auto middle = std::min(pair_begin + run_size, count);
+          const auto pair_end = std::min(pair_begin + 2 * run_size, count);
+          const auto chunk_end = std::min(end, pair_end);
+
+          // Inside of a pair `begin` and `chunk_end` are the chunk boundaries
+          const auto a_begin =
+              begin == pair_begin ? 0 : splits[begin / chunk_size];
+          const auto a_end = chunk_end == pair_end
+                                 ? middle - pair_begin
+                                 : splits[chunk_end / chunk_size];
+          const auto b_begin = begin - pair_begin - a_begin;
+          const auto b_end = chunk_end - pair_begin - a_end;
+
+          impl::MoveMerge(from + pair_begin + a_begin,
+                          from + pair_begin + a_end, from + middle + b_begin,
+                          from + middle + b_end, to + begin, comp);
+          begin = chunk_end;
+        }
+      });
+}
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel version of `std::for_each`, calls `func(*it)` for each
+/// element of `[first, last)` using at most `max_parallelism` tasks of the
+/// `task_processor`.
+///
+/// The elements are processed in chunks, the workers yield between them.
+/// @see utils::ParallelFor for the error handling
+template <typename RandomIt, typename Function>
+void ParallelForEach(engine::TaskProcessor& task_processor,
+                     const std::string& name, std::size_t max_parallelism,
+                     RandomIt first, RandomIt last, Function func) {
+  impl::ParallelForAutoChunks(
+      task_processor, name, std::distance(first, last), max_parallelism,
+      [&](std::size_t begin, std::size_t end) {
+        std::for_each(first + begin, first + end, std::ref(func));
+      });
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel version of `std::transform`.
+///
+/// `op` is called concurrently and must not have side effects on the other
+/// elements.
+/// @returns output iterator to the element past the last one transformed
+/// @see utils::ParallelForEach
+template <typename InputIt, typename OutputIt, typename UnaryOperation>
+OutputIt ParallelTransform(engine::TaskProcessor& task_processor,
+                           const std::string& name, std::size_t max_parallelism,
+                           InputIt first, InputIt last, OutputIt d_first,
+                           UnaryOperation op) {
+  const auto count = std::distance(first, last);
+  impl::ParallelForAutoChunks(
+      task_processor, name, count, max_parallelism,
+      [&](std::size_t begin, std::size_t end) {
+        std::transform(first + begin, first + end, d_first + begin,
+                       std::ref(op));
+      });
+  return d_first + count;
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel version of `std::reduce`.
+///
+/// The elements are combined in an unspecified order, so `op` must be
+/// associative and commutative.
+/// @see utils::ParallelForEach
+template <typename RandomIt, typename T, typename BinaryOperation = std::plus<>>
+T ParallelReduce(engine::TaskProcessor& task_processor, const std::string& name,
+                 std::size_t max_parallelism, RandomIt first, RandomIt last,
+                 T init, BinaryOperation op = {}) {
+  const std::size_t count = std::distance(first, last);
+  const auto chunk_size = impl::GetParallelChunkSize(count, max_parallelism);
+
+  std::vector<std::optional<T>> partial((count + chunk_size - 1) / chunk_size);
+  utils::ParallelForChunks(
+      task_processor, name, count, chunk_size, max_parallelism,
+      [&](std::size_t begin, std::size_t end) {
+        T result(first[begin]);
+        for (auto it = first + begin + 1; it != first + end; ++it) {
+          result = op(std::move(result), *it);
+        }
+        partial[begin / chunk_size].emplace(std::move(result));
+      });
+
+  for (auto& value : partial) init = op(std::move(init), std::move(*value));
+  return init;
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel version of `std::sort`.
+///
+/// Sorts the chunks in parallel and then merges them in parallel rounds
+/// through a temporary buffer of `last - first` elements, so the value type
+/// must be default constructible. Like `std::sort`, the sort is not stable.
+/// @see utils::ParallelForEach
+template <typename RandomIt, typename Compare = std::less<>>
+void ParallelSort(engine::TaskProcessor& task_processor,
+                  const std::string& name, std::size_t max_parallelism,
+                  RandomIt first, RandomIt last, Compare comp = {}) {
+  const std::size_t count = std::distance(first, last);
+  const auto run_size = impl::GetParallelChunkSize(count, max_parallelism);
+  if (count <= run_size) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  utils::ParallelForChunks(task_processor, name, count, run_size,
+                           max_parallelism,
+                           [&](std::size_t begin, std::size_t end) {
+                             std::sort(first + begin, first + end, comp);
+                           });
+
+  std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer(
+      count);
+  bool in_buffer = false;
+  for (auto merged_size = run_size; merged_size < count; merged_size *= 2) {
+    if (in_buffer) {
+      impl::ParallelMergeRuns(task_processor, name, max_parallelism,
+                              buffer.begin(), first, count, merged_size, comp);
+    } else {
+      impl::ParallelMergeRuns(task_processor, name, max_parallelism, first,
+                              buffer.begin(), count, merged_size, comp);
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    impl::ParallelForAutoChunks(
+        task_processor, name, count, max_parallelism,
+        [&](std::size_t begin, std::size_t end) {
+          std::move(buffer.begin() + begin, buffer.begin() + end,
+                    first + begin);
+        });
+  }
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#pragma once
+
+/// @file userver/utils/parallel_for.hpp
+/// @brief @copybrief utils::ParallelFor
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func(i)` for each `i` in `[0, count)` using at most
+/// `max_parallelism` tasks of the `task_processor`, waits for all the calls to
+/// finish.
+///
+/// Instead of a task and a tracing::Span per item, a few worker tasks are
+/// started, each one takes the next index until there are none left. The
+/// items are not processed in any particular order.
+///
+/// If some call throws, the workers do not take new items and are cancelled,
+/// and the exception is rethrown. If the current task is cancelled, the
+/// workers are cancelled and engine::WaitInterruptedException is thrown.
+///
+/// Each index is processed exactly once, so the results may be stored into a
+/// preallocated container without any synchronization:
+/// @snippet utils/parallel_for_test.cpp  Sample utils::ParallelFor usage
+///
+/// @param task_processor task processor to run the workers on
+/// @param name name of the workers tracing::Span
+/// @param count number of items to process
+/// @param max_parallelism the maximum number of concurrently processed items
+/// @param func function to call for each item index
+template <typename Function>
+void ParallelFor(engine::TaskProcessor& task_processor, const std::string& name,
+                 std::size_t count, std::size_t max_parallelism,
+                 Function&& func) {
+  UINVARIANT(max_parallelism > 0, "max_parallelism must be positive");
+  if (count == 0) return;
+
+  std::atomic<std::size_t> next_index{0};
+  std::atomic<bool> is_failed{false};
+
+  const auto worker = [&] {
+    while (!is_failed.load(std::memory_order_relaxed)) {
+      engine::current_task::CancellationPoint();
+      const auto index = next_index.fetch_add(1, std::memory_order_relaxed);
+      if (index >= count) return;
+
+      try {
+        func(index);
+      } catch (...) {
+        is_failed = true;
+        throw;
+      }
+    }
+  };
+
+  const auto workers_count = std::min(count, max_parallelism);
+  std::vector<engine::TaskWithResult<void>> workers;
+  workers.reserve(workers_count);
+  for (std::size_t i = 0; i < workers_count; ++i) {
+    workers.push_back(utils::Async(task_processor, name, std::ref(worker)));
+  }
+
+  // Rethrows the first exception, the destructors of the remaining workers
+  // cancel them and wait for them to stop
+  engine::WaitAllChecked(workers);
+}
+
+/// @ingroup userver_concurrency
+///
+/// @overload
+/// Runs the workers on the current task processor.
+template <typename Function>
+void ParallelFor(const std::string& name, std::size_t count,
+                 std::size_t max_parallelism, Function&& func) {
+  utils::ParallelFor(engine::current_task::GetTaskProcessor(), name, count,
+                     max_parallelism, std::forward<Function>(func));
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -17,6 +17,8 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/flags.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -101,6 +103,17 @@ class PeriodicTask final {
     /// @brief Used instead of `period` in case of exception, if set.
     std::optional<std::chrono::milliseconds> exception_period;
 
+    /// @brief If set, a task execution is deferred while the tasks wait in
+    /// the task processor queue for longer than this, so that the periodic
+    /// tasks do not add to the load of an already overloaded task processor.
+    /// A call to ForceStepAsync() is not deferred.
+    std::optional<std::chrono::microseconds> max_queue_wait_time;
+
+    /// @brief For how long a task execution may be deferred because of the
+    /// `max_queue_wait_time`, the task runs at least every
+    /// `period + max_overload_delay`.
+    std::chrono::milliseconds max_overload_delay{};
+
     /// @brief Flags that control the behavior of PeriodicTask.
     utils::Flags<Flags> flags{};
 
@@ -192,6 +205,11 @@ class PeriodicTask final {
   /// Get current settings. Note that they might become stale very quickly.
   Settings GetCurrentSettings() const;
 
+  /// @brief Writes `deferred-steps`, the count of the executions that were
+  /// deferred because of Settings::max_queue_wait_time
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const PeriodicTask& task);
+
  private:
   enum class SuspendState { kRunning, kSuspended };
 
@@ -201,6 +219,8 @@ class PeriodicTask final {
 
   bool Step();
 
+  void WaitForNoOverload();
+
   bool StepDebug(bool preserve_span);
 
   bool DoStep();
@@ -213,6 +233,7 @@ class PeriodicTask final {
   rcu::Variable<Settings> settings_;
   engine::SingleConsumerEvent changed_event_;
   std::atomic<bool> should_force_step_{false};
+  utils::statistics::RateCounter deferred_steps_;
 
   // For kNow only
   engine::Mutex step_mutex_;
@@ -16,6 +16,12 @@ std::string ToGraphiteFormat(
     const utils::statistics::Storage& statistics,
     const utils::statistics::Request& statistics_request = {});
 
+/// Output `statistics` in Graphite format with tags (labels) to `consumer`
+/// in chunks, without keeping the whole output in memory.
+void ToGraphiteFormat(const utils::statistics::Storage& statistics,
+                      const utils::statistics::Request& statistics_request,
+                      const ChunkConsumer& consumer);
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
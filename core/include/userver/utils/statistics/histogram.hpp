@@ -0,0 +1,147 @@
+#pragma once
+
+/// @file userver/utils/statistics/histogram.hpp
+/// @brief @copybrief utils::statistics::Histogram
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+class Histogram;
+
+/// @brief Non-atomic copy of the utils::statistics::Histogram buckets.
+///
+/// Snapshots of different histograms are merged by adding them up, which is
+/// exact because all the histograms share the same bucket boundaries.
+class HistogramSnapshot final {
+ public:
+  /// Each power of 2 range is split into 2^kSubBucketBits buckets, so the
+  /// relative error of the reported values is at most 1/8.
+  static constexpr std::size_t kSubBucketBits = 3;
+  static constexpr std::size_t kSubBucketsCount = 1 << kSubBucketBits;
+
+  /// Values of 2^kMaxValueBits and above are accounted in the last bucket.
+  static constexpr std::size_t kMaxValueBits = 40;
+
+  static constexpr std::size_t kBucketsCount =
+      kSubBucketsCount + (kMaxValueBits - kSubBucketBits) * kSubBucketsCount +
+      1;
+
+  /// Returns the index of the bucket for the value
+  static constexpr std::size_t GetBucketIndex(std::uint64_t value) noexcept {
+    if (value < kSubBucketsCount) return value;
+
+    const std::size_t msb = 63 - __builtin_clzll(value);
+    if (msb >= kMaxValueBits) return kBucketsCount - 1;
+
+    const std::size_t shift = msb - kSubBucketBits;
+    return kSubBucketsCount + shift * kSubBucketsCount +
+           ((value >> shift) - kSubBucketsCount);
+  }
+
+  /// Returns the max value that is accounted in the bucket, or
+  /// 2^kMaxValueBits for the last bucket.
+  static constexpr std::uint64_t GetBucketUpperBound(
+      std::size_t index) noexcept {
+    if (index < kSubBucketsCount) return index;
+    if (index >= kBucketsCount - 1) return std::uint64_t{1} << kMaxValueBits;
+
+    const std::size_t shift = (index - kSubBucketsCount) / kSubBucketsCount;
+    const std::uint64_t sub = (index - kSubBucketsCount) % kSubBucketsCount;
+    return ((kSubBucketsCount + sub) << shift) + (std::uint64_t{1} << shift) -
+           1;
+  }
+
+  /// Accounts `count` values equal to `value`
+  void Account(std::uint64_t value, std::uint64_t count = 1) noexcept;
+
+  /// Returns the number of values in the bucket
+  std::uint64_t GetBucket(std::size_t index) const noexcept {
+    return buckets_[index];
+  }
+
+  /// Returns the total number of accounted values
+  std::uint64_t GetCount() const noexcept;
+
+  /// Returns the sum of all the accounted values
+  std::uint64_t GetSum() const noexcept { return sum_; }
+
+  /// @brief Returns the upper bound of the bucket of the X percentile: the
+  /// min bound so that the number of values in the buckets up to it is more
+  /// than X percent of the total.
+  /// @param percent value in [0..100]
+  std::uint64_t GetPercentile(double percent) const noexcept;
+
+  HistogramSnapshot& operator+=(const HistogramSnapshot& other) noexcept;
+  HistogramSnapshot& operator+=(const Histogram& other) noexcept;
+
+ private:
+  friend class Histogram;
+
+  std::array<std::uint64_t, kBucketsCount> buckets_{};
+  std::uint64_t sum_{0};
+};
+
+/// @brief Lock-free histogram with log-linear buckets.
+///
+/// Values from 0 to 2^40 are accounted with a relative error of at most 1/8,
+/// so the same histogram works for nanoseconds, microseconds and bytes.
+/// Account() is a few relaxed atomic increments of one of the per-thread
+/// shards, so the histogram could be updated from many threads without
+/// contention. The shards are summed up in GetSnapshot().
+///
+/// Prometheus exposition writes the histogram as a `histogram` typed metric
+/// with `_bucket`, `_sum` and `_count` series. Other formats write the
+/// 0, 50, 90, 95, 98, 99, 99.6, 99.9 and 100 percentiles with the
+/// `percentile` label.
+///
+/// The histogram takes ~10KB, so prefer a small count of epochs when
+/// using it in utils::statistics::RecentPeriod:
+/// @code
+/// utils::statistics::RecentPeriod<utils::statistics::Histogram,
+///                                 utils::statistics::HistogramSnapshot>
+///     timings_;
+/// @endcode
+class Histogram final {
+ public:
+  Histogram() noexcept = default;
+  Histogram(const Histogram& other) noexcept;
+  Histogram& operator=(const Histogram& other) noexcept;
+
+  /// Accounts `count` values equal to `value`
+  void Account(std::uint64_t value, std::uint64_t count = 1) noexcept;
+
+  /// Returns the sum of all the shards
+  HistogramSnapshot GetSnapshot() const noexcept;
+
+  /// Resets all the buckets, the concurrent Account() calls may be lost
+  void Reset() noexcept;
+
+ private:
+  friend class HistogramSnapshot;
+
+  static constexpr std::size_t kShardsCount = 4;
+  static constexpr std::size_t kCacheLineSize = 64;
+
+  struct alignas(kCacheLineSize) Shard final {
+    std::array<std::atomic<std::uint64_t>, HistogramSnapshot::kBucketsCount>
+        buckets{};
+    std::atomic<std::uint64_t> sum{0};
+  };
+
+  std::array<Shard, kShardsCount> shards_{};
+};
+
+/// Writes the snapshot of the histogram
+void DumpMetric(Writer& writer, const Histogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
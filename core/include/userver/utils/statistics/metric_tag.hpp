@@ -22,6 +22,10 @@ namespace utils::statistics {
 /// ```
 /// formats::json::ValueBuilder DumpMetric(const Metric& m);
 /// ```
+///
+/// For the metrics that are updated by many threads all the time consider
+/// splitting them into per-thread shards with
+/// `MetricTag<utils::statistics::ShardedMetric<Metric>>`.
 template <typename Metric>
 class MetricTag final {
  public:
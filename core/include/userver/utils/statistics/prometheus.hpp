@@ -3,6 +3,7 @@
 /// @file userver/utils/statistics/prometheus.hpp
 /// @brief Statistics output in Prometheus format.
 
+#include <memory>
 #include <string>
 
 #include <userver/utils/statistics/storage.hpp>
@@ -26,6 +27,36 @@ std::string ToPrometheusLabel(std::string_view name);
 
 }  // namespace impl
 
+/// @brief Rendered names and labels of the metrics, reused between the calls
+/// to the streaming utils::statistics::ToPrometheusFormat and
+/// utils::statistics::ToPrometheusFormatUntyped.
+///
+/// Entries of the metrics that were not written during the last 16 calls are
+/// dropped. The cache is not thread-safe, use a separate cache for each
+/// concurrent call.
+class PrometheusCache final {
+ public:
+  PrometheusCache();
+  PrometheusCache(PrometheusCache&&) noexcept;
+  PrometheusCache& operator=(PrometheusCache&&) noexcept;
+  ~PrometheusCache();
+
+  /// @cond
+  struct Impl;
+  /// @endcond
+
+ private:
+  friend void ToPrometheusFormat(const Storage& statistics,
+                                 const Request& request, PrometheusCache& cache,
+                                 const ChunkConsumer& consumer);
+  friend void ToPrometheusFormatUntyped(const Storage& statistics,
+                                        const Request& request,
+                                        PrometheusCache& cache,
+                                        const ChunkConsumer& consumer);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Output `statistics` in Prometheus format, each metric has `gauge` type.
 std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
                                const utils::statistics::Request& request = {});
@@ -35,6 +66,21 @@ std::string ToPrometheusFormatUntyped(
     const utils::statistics::Storage& statistics,
     const utils::statistics::Request& request = {});
 
+/// Output `statistics` in Prometheus format to `consumer` in chunks, without
+/// keeping the whole output in memory. Metric names and rendered labels are
+/// taken from the `cache` filled by the previous calls.
+void ToPrometheusFormat(const utils::statistics::Storage& statistics,
+                        const utils::statistics::Request& request,
+                        PrometheusCache& cache, const ChunkConsumer& consumer);
+
+/// Output `statistics` in Prometheus format without metric types to
+/// `consumer` in chunks.
+/// @see streaming utils::statistics::ToPrometheusFormat
+void ToPrometheusFormatUntyped(const utils::statistics::Storage& statistics,
+                               const utils::statistics::Request& request,
+                               PrometheusCache& cache,
+                               const ChunkConsumer& consumer);
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,188 @@
+#pragma once
+
+/// @file userver/utils/statistics/sharded_counter.hpp
+/// @brief @copybrief utils::statistics::ShardedRelaxedCounter
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+inline constexpr std::size_t kCounterShardsCount = 8;
+
+// Returns a small number that never changes for the current thread. Threads
+// get consecutive numbers, so the worker threads of a TaskProcessor are
+// spread over the shards evenly.
+std::size_t GetThreadShardIndex() noexcept;
+
+template <class T>
+class ShardedAtomic final {
+ public:
+  constexpr ShardedAtomic() noexcept = default;
+
+  void Store(T desired) noexcept {
+    for (auto& shard : shards_) shard->store(T{}, std::memory_order_relaxed);
+    shards_[0]->store(desired, std::memory_order_relaxed);
+  }
+
+  T Load() const noexcept {
+    T result{};
+    for (const auto& shard : shards_) {
+      result += shard->load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  void Add(T arg,
+           std::memory_order order = std::memory_order_relaxed) noexcept {
+    auto& shard = shards_[GetThreadShardIndex() % kCounterShardsCount];
+    shard->fetch_add(arg, order);
+  }
+
+  void Sub(T arg) noexcept {
+    auto& shard = shards_[GetThreadShardIndex() % kCounterShardsCount];
+    shard->fetch_sub(arg, std::memory_order_relaxed);
+  }
+
+ private:
+  static_assert(std::atomic<T>::is_always_lock_free);
+
+  std::array<concurrent::impl::InterferenceShield<std::atomic<T>>,
+             kCounterShardsCount>
+      shards_{};
+};
+
+}  // namespace impl
+
+/// @brief Counter of type T that is split into cache line sized shards, one
+/// per group of threads.
+///
+/// Use it instead of utils::statistics::RelaxedCounter for the counters that
+/// are updated by many threads all the time, e.g. per request counters of a
+/// handler. Updates from different threads do not bounce the same cache line
+/// between CPUs, but the counter takes ~0.5KB and Load() sums up all the
+/// shards. Store() is not atomic against concurrent updates.
+template <class T>
+class ShardedRelaxedCounter final {
+ public:
+  using ValueType = T;
+
+  constexpr ShardedRelaxedCounter() noexcept = default;
+
+  ShardedRelaxedCounter(const ShardedRelaxedCounter& other) noexcept {
+    Store(other.Load());
+  }
+
+  ShardedRelaxedCounter& operator=(
+      const ShardedRelaxedCounter& other) noexcept {
+    if (this == &other) return *this;
+
+    Store(other.Load());
+    return *this;
+  }
+
+  ShardedRelaxedCounter& operator=(T desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  void Store(T desired) noexcept { value_.Store(desired); }
+
+  T Load() const noexcept { return value_.Load(); }
+
+  operator T() const noexcept { return Load(); }
+
+  ShardedRelaxedCounter& operator++() noexcept {
+    value_.Add(1);
+    return *this;
+  }
+
+  ShardedRelaxedCounter& operator--() noexcept {
+    value_.Sub(1);
+    return *this;
+  }
+
+  ShardedRelaxedCounter& operator+=(T arg) noexcept {
+    value_.Add(arg);
+    return *this;
+  }
+
+  ShardedRelaxedCounter& operator-=(T arg) noexcept {
+    value_.Sub(arg);
+    return *this;
+  }
+
+ private:
+  impl::ShardedAtomic<T> value_;
+};
+
+template <typename T>
+void DumpMetric(Writer& writer, const ShardedRelaxedCounter<T>& value) {
+  writer = value.Load();
+}
+
+/// @brief Counter of type Rate that is split into cache line sized shards.
+///
+/// This class is represented as Rate metric when serializing to statistics.
+/// Otherwise it is the same class as utils::statistics::ShardedRelaxedCounter
+class ShardedRateCounter final {
+ public:
+  using ValueType = Rate;
+
+  constexpr ShardedRateCounter() noexcept = default;
+
+  ShardedRateCounter(const ShardedRateCounter& other) noexcept {
+    Store(other.Load());
+  }
+
+  ShardedRateCounter& operator=(const ShardedRateCounter& other) noexcept {
+    if (this == &other) return *this;
+
+    Store(other.Load());
+    return *this;
+  }
+
+  ShardedRateCounter& operator=(Rate desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  void Store(Rate desired) noexcept { value_.Store(desired.value); }
+
+  Rate Load() const noexcept { return Rate{value_.Load()}; }
+
+  void Add(Rate arg,
+           std::memory_order order = std::memory_order_relaxed) noexcept {
+    value_.Add(arg.value, order);
+  }
+
+  ShardedRateCounter& operator++() noexcept {
+    value_.Add(1);
+    return *this;
+  }
+
+  ShardedRateCounter& operator+=(Rate arg) noexcept {
+    Add(arg);
+    return *this;
+  }
+
+ private:
+  impl::ShardedAtomic<Rate::ValueType> value_;
+};
+
+void DumpMetric(Writer& writer, const ShardedRateCounter& value);
+
+void ResetMetric(ShardedRateCounter& value);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
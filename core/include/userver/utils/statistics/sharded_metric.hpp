@@ -0,0 +1,82 @@
+#pragma once
+
+/// @file userver/utils/statistics/sharded_metric.hpp
+/// @brief @copybrief utils::statistics::ShardedMetric
+
+#include <array>
+#include <type_traits>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/meta_light.hpp>
+#include <userver/utils/statistics/metric_tag_impl.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Custom metric that is split into cache line sized shards, one per
+/// group of threads. The shards are merged with `operator+=` on dump.
+///
+/// Use `MetricTag<ShardedMetric<Metric>>` instead of `MetricTag<Metric>` for
+/// the metrics that are updated by many threads all the time, so that the
+/// updates from different threads do not contend on the same atomics:
+///
+/// @snippet utils/statistics/metrics_storage_test.cpp  ShardedMetric sample
+///
+/// `Metric` must still be thread-safe, as several threads share a shard and
+/// the shards are read concurrently with the updates. `Metric` must be
+/// default-constructible, copyable and provide the
+/// `Metric& operator+=(Metric&, const Metric&)` and the
+/// `void DumpMetric(utils::statistics::Writer&, const Metric&)` functions. An
+/// optional `void ResetMetric(Metric&)` resets all the shards.
+template <typename Metric>
+class ShardedMetric final {
+  static_assert(kHasWriterSupport<Metric>,
+                "Provide a `void DumpMetric(utils::statistics::Writer&, const "
+                "Metric&)` function in the namespace of `Metric`.");
+
+ public:
+  ShardedMetric() = default;
+
+  /// Returns the shard of the current thread to update
+  Metric& GetLocal() noexcept {
+    return *shards_[impl::GetThreadShardIndex() % impl::kCounterShardsCount];
+  }
+
+  /// Returns the sum of all the shards
+  Metric Merge() const {
+    Metric result{};
+    for (const auto& shard : shards_) result += *shard;
+    return result;
+  }
+
+  /// Resets all the shards with `ResetMetric`
+  void Reset() {
+    for (auto& shard : shards_) {
+      if constexpr (meta::kIsDetected<impl::HasResetMetric, Metric>) {
+        ResetMetric(*shard);
+      }
+    }
+  }
+
+ private:
+  std::array<concurrent::impl::InterferenceShield<Metric>,
+             impl::kCounterShardsCount>
+      shards_{};
+};
+
+template <typename Metric>
+void DumpMetric(Writer& writer, const ShardedMetric<Metric>& metric) {
+  writer = metric.Merge();
+}
+
+template <typename Metric>
+void ResetMetric(ShardedMetric<Metric>& metric) {
+  metric.Reset();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
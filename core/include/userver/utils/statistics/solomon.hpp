@@ -61,6 +61,14 @@ std::string ToSolomonFormat(
     const std::unordered_map<std::string, std::string>& common_labels,
     const utils::statistics::Request& statistics_request = {});
 
+/// Output `statistics` in Solomon format to `consumer` in chunks, without
+/// keeping the whole output in memory.
+void ToSolomonFormat(
+    const utils::statistics::Storage& statistics,
+    const std::unordered_map<std::string, std::string>& common_labels,
+    const utils::statistics::Request& statistics_request,
+    const ChunkConsumer& consumer);
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
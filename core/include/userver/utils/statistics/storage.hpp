@@ -110,8 +110,18 @@ class BaseFormatBuilder {
 
   virtual void HandleMetric(std::string_view path, LabelsSpan labels,
                             const MetricValue& value) = 0;
+
+  /// Writes the utils::statistics::Histogram. By default writes the
+  /// percentiles of the histogram via HandleMetric with a `percentile` label.
+  virtual void HandleHistogram(std::string_view path, LabelsSpan labels,
+                               const HistogramSnapshot& value);
 };
 
+/// @brief Receives the parts of the metrics formatted by the streaming
+/// overloads of utils::statistics::ToPrometheusFormat,
+/// utils::statistics::ToGraphiteFormat and utils::statistics::ToSolomonFormat.
+using ChunkConsumer = std::function<void(std::string&& chunk)>;
+
 /// @ingroup userver_clients
 ///
 /// Storage of metrics, usually retrieved from components::StatisticsStorage.
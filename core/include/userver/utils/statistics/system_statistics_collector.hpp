@@ -3,6 +3,8 @@
 /// @file userver/utils/statistics/system_statistics_collector.hpp
 /// @brief @copybrief components::SystemStatisticsCollector
 
+#include <memory>
+
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -10,6 +12,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace utils::statistics::impl {
+class SelfSystemStatsReader;
+}  // namespace utils::statistics::impl
+
 namespace components {
 
 // clang-format off
@@ -51,6 +57,8 @@ class SystemStatisticsCollector final : public LoggableComponentBase {
 
   const bool with_nginx_;
   engine::TaskProcessor& fs_task_processor_;
+  std::unique_ptr<utils::statistics::impl::SelfSystemStatsReader>
+      self_stats_reader_;
   utils::statistics::Entry statistics_holder_;
 };
 
@@ -15,6 +15,7 @@ USERVER_NAMESPACE_BEGIN
 namespace utils::statistics {
 
 class Writer;
+class HistogramSnapshot;
 
 namespace impl {
 
@@ -104,7 +105,8 @@ class Writer final {
   template <class T>
   void operator=(const T& value) {
     if constexpr (std::is_arithmetic_v<T> ||
-                  std::is_same_v<std::decay_t<T>, Rate>) {
+                  std::is_same_v<std::decay_t<T>, Rate> ||
+                  std::is_same_v<std::decay_t<T>, HistogramSnapshot>) {
       Write(value);
     } else {
       if (state_) {
@@ -157,6 +159,7 @@ class Writer final {
   void Write(long long value);
   void Write(double value);
   void Write(Rate value);
+  void Write(const HistogramSnapshot& value);
 
   void Write(float value) { Write(static_cast<double>(value)); }
 
@@ -1,6 +1,7 @@
 #include <userver/baggage/baggage.hpp>
 
 #include <algorithm>
+#include <memory>
 
 #include <fmt/format.h>
 
@@ -20,6 +21,17 @@ const int kHeaderLengthLimit = 8192;
 
 }  // namespace
 
+struct Baggage::ParsedHeader {
+  std::vector<BaggageEntry> entries;
+
+  // result header after parsing entities.
+  // empty string if is_valid_header == true
+  std::string result_header;
+
+  // true if requested header == header for sending
+  bool is_valid_header{true};
+};
+
 BaggageEntryProperty::BaggageEntryProperty(
     std::string_view key, std::optional<std::string_view> value)
     : key_(std::move(key)), value_(std::move(value)) {}
@@ -92,18 +104,19 @@ const BaggageEntryProperty& BaggageEntry::GetProperty(
 }
 
 std::string Baggage::ToString() const {
-  if (is_valid_header_) {
+  const auto& parsed = GetParsedHeader();
+  if (parsed.is_valid_header) {
     return header_value_;
   }
-  return result_header_;
+  return parsed.result_header;
 }
 
 const std::vector<BaggageEntry>& Baggage::GetEntries() const {
-  return entries_;
+  return GetParsedHeader().entries;
 }
 
 bool Baggage::HasEntry(const std::string& key) const {
-  for (const auto& entry : entries_) {
+  for (const auto& entry : GetEntries()) {
     if (entry.key_ == http::UrlEncode(key)) {
       return true;
     }
@@ -112,7 +125,7 @@ bool Baggage::HasEntry(const std::string& key) const {
 }
 
 const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
-  for (const auto& entry : entries_) {
+  for (const auto& entry : GetEntries()) {
     if (entry.key_ == http::UrlEncode(key)) {
       return entry;
     }
@@ -127,45 +140,22 @@ Baggage::Baggage(std::string header,
       std::remove_if(header_value_.begin(), header_value_.end(),
                      [](unsigned char x) { return std::isspace(x); }),
       header_value_.end());
-
-  FillEntries();
-
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
 }
 
+// The entries of the parsed header point into the original one, so the copy
+// parses its own header when needed
 Baggage::Baggage(const Baggage& baggage_copy) noexcept
-    : allowed_keys_(baggage_copy.allowed_keys_) {
-  if (baggage_copy.is_valid_header_) {
-    header_value_ = baggage_copy.header_value_;
-  } else {
-    header_value_ = baggage_copy.result_header_;
-  }
-  FillEntries();
-
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
-}
+    : header_value_(baggage_copy.header_value_),
+      allowed_keys_(baggage_copy.allowed_keys_) {}
 
 Baggage::Baggage(Baggage&& baggage_copy) noexcept
-    : allowed_keys_(std::move(baggage_copy.allowed_keys_)) {
-  if (baggage_copy.is_valid_header_) {
-    header_value_ = std::move(baggage_copy.header_value_);
-  } else {
-    header_value_ = std::move(baggage_copy.result_header_);
-  }
-  FillEntries();
-
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
+    : header_value_(std::move(baggage_copy.header_value_)),
+      allowed_keys_(std::move(baggage_copy.allowed_keys_)) {
+  baggage_copy.ResetParsedHeader();
 }
 
+Baggage::~Baggage() { ResetParsedHeader(); }
+
 void Baggage::AddEntry(std::string key, std::string value,
                        BaggageProperties properties) {
   auto encoded_key = http::UrlEncode(key);
@@ -174,13 +164,14 @@ void Baggage::AddEntry(std::string key, std::string value,
     throw BaggageException(
         "White list of entries doesn't contain selected key");
   }
-  if (entries_.size() >= kEntitiesLimit) {
+  const auto& parsed = GetParsedHeader();
+  if (parsed.entries.size() >= kEntitiesLimit) {
     throw BaggageException(
         fmt::format("Exceeded the limit of entries: {}", kEntitiesLimit));
   }
 
   std::string entry;
-  if (!entries_.empty()) {
+  if (!parsed.entries.empty()) {
     entry += ',';
   }
   entry += encoded_key + '=' + encoded_value;
@@ -193,36 +184,17 @@ void Baggage::AddEntry(std::string key, std::string value,
       entry += '=' + encoded_property_value;
     }
   }
-  if (is_valid_header_) {
-    if (header_value_.size() + entry.size() >= kHeaderLengthLimit) {
-      throw BaggageException(fmt::format(
-          "Exceeded the limit of header length: {}", kHeaderLengthLimit));
-    }
-    header_value_ += entry;
-    entries_.clear();
-    FillEntries();
-
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-      CreateResultHeader();
-    }
-  } else {
-    if (result_header_.size() + entry.size() >= kHeaderLengthLimit) {
-      throw BaggageException(fmt::format(
-          "Exceeded the limit of header length: {}", kHeaderLengthLimit));
-    }
-    // if header contains invalid entities, we should make new header
-    // by concatenating result_header_ and new entry
-    header_value_ = result_header_ + entry;
-    is_valid_header_ = true;
-    entries_.clear();
-    FillEntries();
-
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-      CreateResultHeader();
-    }
+  // if header contains invalid entities, we should make new header
+  // by concatenating result_header and new entry
+  auto header = parsed.is_valid_header ? header_value_ : parsed.result_header;
+  if (header.size() + entry.size() >= kHeaderLengthLimit) {
+    throw BaggageException(fmt::format(
+        "Exceeded the limit of header length: {}", kHeaderLengthLimit));
   }
+  header += entry;
+
+  ResetParsedHeader();
+  header_value_ = std::move(header);
 }
 
 bool Baggage::IsValidEntry(const std::string& key) const {
@@ -233,20 +205,17 @@ std::unordered_set<std::string> Baggage::GetAllowedKeys() const {
   return allowed_keys_;
 }
 
-void Baggage::CreateResultHeader() {
-  result_header_.reserve(header_value_.size());
-  for (size_t i = 0; i < entries_.size(); i++) {
-    if (i != 0) {
-      result_header_ += ",";
-    }
-    entries_[i].ConcatenateWith(result_header_);
+const Baggage::ParsedHeader& Baggage::GetParsedHeader() const {
+  if (const auto* parsed = parsed_header_.load(std::memory_order_acquire)) {
+    return *parsed;
   }
-}
 
-void Baggage::FillEntries() {
-  entries_.reserve(kEntitiesLimit);
+  // Baggage is shared between the tasks that inherit it, they may race to
+  // parse it. The first parsed header wins.
+  auto parsed = std::make_unique<ParsedHeader>();
+  auto& entries = parsed->entries;
   for (size_t header_pos = 0;
-       header_pos != std::string::npos && entries_.size() < kEntitiesLimit;) {
+       header_pos != std::string::npos && entries.size() < kEntitiesLimit;) {
     std::string_view entry{header_value_};
     entry.remove_prefix(header_pos);
     header_pos = header_value_.find(',', header_pos);
@@ -254,21 +223,51 @@ void Baggage::FillEntries() {
       entry.remove_suffix(header_value_.size() - header_pos);
     }
     if (!entry.empty()) {
-      auto parsed_entry = TryMakeBaggageEntry(entry);
+      auto parsed_entry = TryMakeBaggageEntry(entry, parsed->is_valid_header);
       if (parsed_entry) {
-        entries_.emplace_back(std::move(*parsed_entry));
+        entries.emplace_back(std::move(*parsed_entry));
       } else {
-        is_valid_header_ = false;
+        parsed->is_valid_header = false;
       }
     }
     if (header_pos != std::string::npos) {
       header_pos++;
     }
   }
+
+  // if header contains invalid symbols, we should fill result_header
+  if (!parsed->is_valid_header) {
+    auto& result_header = parsed->result_header;
+    result_header.reserve(header_value_.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+      if (i != 0) {
+        result_header += ",";
+      }
+      entries[i].ConcatenateWith(result_header);
+    }
+  }
+
+  ParsedHeader* expected = nullptr;
+  if (parsed_header_.compare_exchange_strong(expected, parsed.get(),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+    return *parsed.release();
+  }
+  return *expected;
+}
+
+void Baggage::ResetParsedHeader() noexcept {
+  delete parsed_header_.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
+    std::string_view entry) const {
+  bool is_valid_header = true;
+  return TryMakeBaggageEntry(entry, is_valid_header);
 }
 
 std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
-    std::string_view entry) {
+    std::string_view entry, bool& is_valid_header) const {
   if (entry.find(',') != std::string_view::npos) {
     LOG_LIMITED_WARNING() << "Entry contains invalid symbol: ','";
     return std::nullopt;
@@ -320,7 +319,6 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
 
   // make properties
   std::vector<BaggageEntryProperty> properties;
-  properties.reserve(kEntitiesLimit);
   while (property_pos != std::string_view::npos) {
     std::string_view property{entry};
     property.remove_prefix(property_pos + 1);
@@ -333,7 +331,7 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
       if (parsed_property) {
         properties.push_back(std::move(*parsed_property));
       } else {
-        is_valid_header_ = false;
+        is_valid_header = false;
       }
     }
   }
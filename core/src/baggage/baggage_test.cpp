@@ -221,6 +221,31 @@ UTEST(Parse, BaggageHeader) {
   ASSERT_EQ(baggage_with_spaces->ToString(), "");
 }
 
+UTEST(Baggage, CopyAndMove) {
+  const std::string header = "key1=value1,key6=value6,key2=value2;property1";
+
+  auto baggage = baggage::TryMakeBaggage(header, kAllowedKeys);
+  ASSERT_TRUE(baggage);
+  ASSERT_EQ(baggage->ToString(), "key1=value1,key2=value2;property1");
+
+  const auto copy = *baggage;
+  const auto moved = std::move(*baggage);
+  for (const auto* parsed : {&copy, &moved}) {
+    EXPECT_EQ(parsed->ToString(), "key1=value1,key2=value2;property1");
+    EXPECT_EQ(PrintBaggage(*parsed),
+              "Baggage:"
+              "\nEntry: key1 value1"
+              "\nEntry: key2 value2"
+              "\n\tProperty: property1");
+  }
+
+  // the valid header is propagated verbatim
+  const auto unparsed = baggage::TryMakeBaggage("key1=value1", kAllowedKeys);
+  const auto unparsed_copy = *unparsed;
+  EXPECT_EQ(unparsed_copy.ToString(), "key1=value1");
+  EXPECT_TRUE(unparsed_copy.HasEntry("key1"));
+}
+
 class UTestBaggage : public baggage::Baggage {
  public:
   UTestBaggage(const std::unordered_set<std::string>& allowed_keys)
@@ -1,11 +1,14 @@
 #include <cache/cache_dependencies.hpp>
 
+#include <userver/cache/invalidation_channel.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 
+#include <components/manager.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace cache {
@@ -58,6 +61,9 @@ CacheDependencies CacheDependencies::Make(
       dump_config ? &context.GetTaskProcessor(dump_config->fs_task_processor)
                   : nullptr,
       context.FindComponent<components::TestsuiteSupport>().GetDumpControl(),
+      context.GetManager().GetCachesStartupSemaphore(),
+      context.GetManager().GetStartTime(),
+      impl::FindInvalidationChannel(config, context),
   };
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <optional>
 #include <string>
@@ -9,6 +10,7 @@
 #include <userver/dump/config.hpp>
 #include <userver/dump/factory.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/testsuite/cache_control.hpp>
 #include <userver/testsuite/dump_control.hpp>
@@ -18,6 +20,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace cache {
 
+class InvalidationChannel;
+
 struct CacheDependencies final {
   std::string name;
   Config config;
@@ -29,6 +33,9 @@ struct CacheDependencies final {
   std::unique_ptr<dump::OperationsFactory> dump_rw_factory;
   engine::TaskProcessor* fs_task_processor;
   testsuite::DumpControl& dump_control;
+  engine::Semaphore* startup_semaphore;
+  std::chrono::steady_clock::time_point service_start_time;
+  InvalidationChannel* invalidation_channel;
 
   static CacheDependencies Make(const components::ComponentConfig& config,
                                 const components::ComponentContext& context);
@@ -1,7 +1,10 @@
 #include <cache/cache_update_trait_impl.hpp>
 
+#include <shared_mutex>
+
 #include <fmt/format.h>
 
+#include <userver/cache/invalidation_channel.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dynamic_config/source.hpp>
@@ -34,8 +37,20 @@ T CheckNotNull(T ptr) {
   return ptr;
 }
 
+std::chrono::milliseconds ToMilliseconds(
+    std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+}
+
 }  // namespace
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const StartupStatistics& stats) {
+  writer["queue-wait-ms"] = stats.queue_wait.load().count();
+  writer["duration-ms"] = stats.duration.load().count();
+  writer["ready-after-start-ms"] = stats.ready_after_start.load().count();
+}
+
 void CacheUpdateTrait::Impl::InvalidateAsync(UpdateType update_type) {
   if (!periodic_update_enabled_) {
     // We are in testsuite, update synchronously for repeatability.
@@ -88,12 +103,16 @@ const std::string& CacheUpdateTrait::Impl::Name() const { return name_; }
 CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies,
                              CacheUpdateTrait& self)
     : customized_trait_(self),
+      memory_account_(std::make_shared<utils::MemoryAccount>()),
       static_config_(dependencies.config),
       config_(static_config_),
       cache_control_(dependencies.cache_control),
       name_(std::move(dependencies.name)),
       update_task_name_("update-task/" + name_),
       task_processor_(dependencies.task_processor),
+      startup_semaphore_(dependencies.startup_semaphore),
+      service_start_time_(dependencies.service_start_time),
+      invalidation_channel_(dependencies.invalidation_channel),
       periodic_update_enabled_(
           dependencies.cache_control.IsPeriodicUpdateEnabled(static_config_,
                                                              name_)),
@@ -112,6 +131,10 @@ CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies,
   statistics_holder_ = dependencies.statistics_storage.RegisterWriter(
       "cache", [this](utils::statistics::Writer& writer) {
         writer.ValueWithLabels(statistics_, {"cache_name", Name()});
+        writer["startup"].ValueWithLabels(startup_statistics_,
+                                          {"cache_name", Name()});
+        writer["memory"].ValueWithLabels(*memory_account_,
+                                         {"cache_name", Name()});
       });
 
   if (dependencies.config.config_updates_enabled) {
@@ -156,9 +179,29 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
   // DynamicConfig::GetSource in their constructor.
   cache_invalidator_holder_.emplace(cache_control_, customized_trait_);
 
+  if (invalidation_channel_) {
+    invalidation_subscription_ =
+        invalidation_channel_->GetEventSource().AddListener(
+            this, "cache." + name_, &Impl::OnInvalidation);
+  }
+
   try {
     const auto config = GetConfig();
 
+    // Caches are constructed concurrently, limit the number of caches loading
+    // at the same time if requested
+    const auto startup_wait_start = std::chrono::steady_clock::now();
+    std::shared_lock<engine::Semaphore> startup_slot;
+    if (startup_semaphore_) {
+      startup_slot = std::shared_lock{*startup_semaphore_};
+    }
+    const auto startup_start = std::chrono::steady_clock::now();
+    std::optional<tracing::Span> startup_span{std::in_place,
+                                              "cache-startup/" + name_};
+    startup_span->AddTag(
+        "queue_wait_ms",
+        ToMilliseconds(startup_start - startup_wait_start).count());
+
     const auto dump_time = dumper_ ? dumper_->ReadDump() : std::nullopt;
     if (dump_time) {
       last_update_ = *dump_time;
@@ -200,6 +243,10 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
       }
     }
 
+    startup_span.reset();
+    if (startup_slot) startup_slot.unlock();
+    OnStartupFinished(startup_wait_start, startup_start);
+
     if (dump_time && config->first_update_type ==
                          FirstUpdateType::kIncrementalThenAsyncFull) {
       dump_first_update_type_ = UpdateType::kFull;
@@ -243,6 +290,7 @@ void CacheUpdateTrait::Impl::StopPeriodicUpdates() {
   }
 
   cache_invalidator_holder_.reset();
+  invalidation_subscription_.Unsubscribe();
   config_subscription_.Unsubscribe();
   statistics_holder_.Unregister();
 
@@ -274,6 +322,34 @@ void CacheUpdateTrait::Impl::OnConfigUpdate(
   cleanup_task_.SetSettings({new_config->cleanup_interval});
 }
 
+void CacheUpdateTrait::Impl::OnInvalidation(const InvalidationEvent& event) {
+  if (event.cache_name != name_) return;
+
+  // The changed rows are fetched by the incremental update, so the keys are
+  // not needed here
+  const bool is_full = event.type == InvalidationType::kAll ||
+                       event.type == InvalidationType::kFullUpdate ||
+                       GetAllowedUpdateTypes() == AllowedUpdateTypes::kOnlyFull;
+  LOG_DEBUG() << "Cache '" << name_ << "' is invalidated by an event";
+  InvalidateAsync(is_full ? UpdateType::kFull : UpdateType::kIncremental);
+}
+
+void CacheUpdateTrait::Impl::OnStartupFinished(
+    std::chrono::steady_clock::time_point wait_start,
+    std::chrono::steady_clock::time_point start) {
+  const auto now = std::chrono::steady_clock::now();
+  startup_statistics_.queue_wait = ToMilliseconds(start - wait_start);
+  startup_statistics_.duration = ToMilliseconds(now - start);
+  startup_statistics_.ready_after_start =
+      ToMilliseconds(now - service_start_time_);
+
+  LOG_INFO() << "Cache " << name_ << " is ready in "
+             << startup_statistics_.duration.load().count() << "ms, "
+             << startup_statistics_.ready_after_start.load().count()
+             << "ms after the service start, waited for a startup slot for "
+             << startup_statistics_.queue_wait.load().count() << "ms";
+}
+
 rcu::ReadablePtr<Config> CacheUpdateTrait::Impl::GetConfig() const {
   return config_.Read();
 }
@@ -369,6 +445,7 @@ void CacheUpdateTrait::Impl::DoUpdate(UpdateType update_type) {
                                       std::string{update_type_str});
 
   UpdateStatisticsScope stats(statistics_, update_type);
+  const utils::MemoryAccountScope memory_scope{memory_account_};
   LOG_INFO() << "Updating cache update_type=" << update_type_str
              << " name=" << name_;
 
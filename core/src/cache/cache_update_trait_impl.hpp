@@ -12,7 +12,9 @@
 #include <userver/concurrent/async_event_channel.hpp>
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/memory_account.hpp>
 #include <userver/utils/periodic_task.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
@@ -30,6 +32,19 @@ namespace cache {
 
 struct CacheDependencies;
 class CacheUpdateTrait;
+class InvalidationChannel;
+struct InvalidationEvent;
+
+// Timeline of the dump load and the first update, relative to the start of
+// the service
+struct StartupStatistics final {
+  std::atomic<std::chrono::milliseconds> queue_wait{{}};
+  std::atomic<std::chrono::milliseconds> duration{{}};
+  std::atomic<std::chrono::milliseconds> ready_after_start{{}};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const StartupStatistics& stats);
 
 class CacheUpdateTrait::Impl final {
  public:
@@ -87,6 +102,11 @@ class CacheUpdateTrait::Impl final {
 
   void OnConfigUpdate(const dynamic_config::Snapshot& config);
 
+  void OnInvalidation(const InvalidationEvent& event);
+
+  void OnStartupFinished(std::chrono::steady_clock::time_point wait_start,
+                         std::chrono::steady_clock::time_point start);
+
   // Over-aligned members go first
   utils::PeriodicTask update_task_;
   utils::PeriodicTask cleanup_task_;
@@ -94,12 +114,18 @@ class CacheUpdateTrait::Impl final {
 
   CacheUpdateTrait& customized_trait_;
   impl::Statistics statistics_;
+  StartupStatistics startup_statistics_;
+  // Charged with the buffers held by the updates, e.g. the result sets
+  const std::shared_ptr<utils::MemoryAccount> memory_account_;
   const Config static_config_;
   rcu::Variable<Config> config_;
   testsuite::CacheControl& cache_control_;
   const std::string name_;
   const std::string update_task_name_;
   engine::TaskProcessor& task_processor_;
+  engine::Semaphore* const startup_semaphore_;
+  const std::chrono::steady_clock::time_point service_start_time_;
+  InvalidationChannel* const invalidation_channel_;
   const bool periodic_update_enabled_;
   std::atomic<bool> is_running_{false};
   bool first_update_attempted_{false};
@@ -121,6 +147,7 @@ class CacheUpdateTrait::Impl final {
 
   utils::statistics::Entry statistics_holder_;
   concurrent::AsyncEventSubscriberScope config_subscription_;
+  concurrent::AsyncEventSubscriberScope invalidation_subscription_;
   std::optional<testsuite::CacheInvalidatorHolder> cache_invalidator_holder_;
 };
 
@@ -1,7 +1,9 @@
 #include <userver/cache/cache_update_trait.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <exception>
+#include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -12,11 +14,13 @@
 #include <cache/internal_helpers_test.hpp>
 #include <dump/internal_helpers_test.hpp>
 #include <userver/cache/cache_config.hpp>
+#include <userver/cache/invalidation_channel.hpp>
 #include <userver/cache/update_type.hpp>
 #include <userver/components/component.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/test_helpers.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/yaml/serialize.hpp>
 #include <userver/formats/yaml/value_builder.hpp>
@@ -25,7 +29,10 @@
 #include <userver/testsuite/cache_control.hpp>
 #include <userver/testsuite/dump_control.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/enumerate.hpp>
+#include <userver/utils/memory_account.hpp>
+#include <userver/utils/statistics/testing.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -903,4 +910,198 @@ UTEST(CacheUpdateTrait, FinishWithError) {
                     std::exception, "FinishWithError");
 }
 
+namespace {
+
+class SlowStartupCache final : public cache::CacheMockBase {
+ public:
+  SlowStartupCache(std::string_view name, const yaml_config::YamlConfig& config,
+                   cache::MockEnvironment& environment,
+                   std::atomic<int>& concurrent_updates,
+                   std::atomic<int>& max_concurrent_updates)
+      : cache::CacheMockBase(name, config, environment),
+        concurrent_updates_(concurrent_updates),
+        max_concurrent_updates_(max_concurrent_updates) {
+    StartPeriodicUpdates();
+  }
+
+  ~SlowStartupCache() final { StopPeriodicUpdates(); }
+
+ private:
+  void Update(cache::UpdateType, const std::chrono::system_clock::time_point&,
+              const std::chrono::system_clock::time_point&,
+              cache::UpdateStatisticsScope& stats_scope) override {
+    const auto current = ++concurrent_updates_;
+    auto max = max_concurrent_updates_.load();
+    while (max < current &&
+           !max_concurrent_updates_.compare_exchange_weak(max, current)) {
+    }
+
+    engine::SleepFor(std::chrono::milliseconds{20});
+    --concurrent_updates_;
+    stats_scope.Finish(kDummyDocumentsCount);
+  }
+
+  std::atomic<int>& concurrent_updates_;
+  std::atomic<int>& max_concurrent_updates_;
+};
+
+}  // namespace
+
+UTEST_MT(CacheUpdateTrait, StartupConcurrencyLimit, 4) {
+  constexpr int kCachesCount = 6;
+
+  const yaml_config::YamlConfig config{
+      formats::yaml::FromString(kFakeCacheConfig), {}};
+  cache::MockEnvironment environment;
+  engine::Semaphore startup_semaphore{2};
+  environment.startup_semaphore = &startup_semaphore;
+
+  std::atomic<int> concurrent_updates{0};
+  std::atomic<int> max_concurrent_updates{0};
+
+  std::vector<std::unique_ptr<SlowStartupCache>> caches(kCachesCount);
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kCachesCount; ++i) {
+    tasks.push_back(utils::Async("boot", [&, i] {
+      caches[i] = std::make_unique<SlowStartupCache>(
+          fmt::format("slow-startup-cache-{}", i), config, environment,
+          concurrent_updates, max_concurrent_updates);
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_GE(max_concurrent_updates, 1);
+  EXPECT_LE(max_concurrent_updates, 2);
+
+  const utils::statistics::Snapshot snapshot{environment.statistics_storage,
+                                             "cache.startup"};
+  const auto label = utils::statistics::Label{"cache_name",
+                                               "slow-startup-cache-0"};
+  EXPECT_GE(snapshot.SingleMetric("duration-ms", {label}).AsInt(), 20);
+  EXPECT_GE(snapshot.SingleMetric("ready-after-start-ms", {label}).AsInt(),
+            20);
+  EXPECT_GE(snapshot.SingleMetric("queue-wait-ms", {label}).AsInt(), 0);
+}
+
+namespace {
+
+// Delivers the events to the subscribers of this instance only
+class LoopbackInvalidationChannel final : public cache::InvalidationChannel {
+ public:
+  LoopbackInvalidationChannel() : InvalidationChannel("loopback") {}
+
+  void Publish(const cache::InvalidationEvent& event) override {
+    OnMessage(SerializeEvent(event));
+  }
+
+  void PublishRaw(std::string_view message) { OnMessage(message); }
+};
+
+class InvalidatedCache final : public cache::CacheMockBase {
+ public:
+  static constexpr auto kName = "invalidated-cache";
+
+  InvalidatedCache(const yaml_config::YamlConfig& config,
+                   cache::MockEnvironment& environment)
+      : CacheMockBase(kName, config, environment) {
+    StartPeriodicUpdates();
+  }
+
+  ~InvalidatedCache() final { StopPeriodicUpdates(); }
+
+  const std::vector<UpdateType>& GetUpdatesLog() const { return updates_log_; }
+
+ private:
+  void Update(cache::UpdateType type,
+              const std::chrono::system_clock::time_point&,
+              const std::chrono::system_clock::time_point&,
+              cache::UpdateStatisticsScope& stats_scope) override {
+    updates_log_.push_back(type);
+    OnCacheModified();
+    stats_scope.Finish(kDummyDocumentsCount);
+  }
+
+  std::vector<UpdateType> updates_log_;
+};
+
+}  // namespace
+
+UTEST(CacheUpdateTrait, InvalidationChannel) {
+  const yaml_config::YamlConfig config{
+      formats::yaml::FromString(kFakeCacheConfig), {}};
+  cache::MockEnvironment environment;
+  LoopbackInvalidationChannel channel;
+  environment.invalidation_channel = &channel;
+
+  InvalidatedCache test_cache(config, environment);
+  EXPECT_EQ(test_cache.GetUpdatesLog(), std::vector{UpdateType::kFull});
+
+  channel.Publish({"other-cache", cache::InvalidationType::kFullUpdate, {}});
+  EXPECT_EQ(test_cache.GetUpdatesLog().size(), 1);
+
+  channel.Publish({InvalidatedCache::kName,
+                   cache::InvalidationType::kIncrementalUpdate,
+                   {}});
+  channel.Publish({InvalidatedCache::kName, cache::InvalidationType::kAll, {}});
+  channel.PublishRaw("not a json");
+  EXPECT_EQ(test_cache.GetUpdatesLog(),
+            (std::vector{UpdateType::kFull, UpdateType::kIncremental,
+                         UpdateType::kFull}));
+}
+
+UTEST(CacheUpdateTrait, InvalidationEventSerialization) {
+  cache::InvalidationEvent event{
+      "cache", cache::InvalidationType::kKeys, {}};
+  event.keys.push_back(formats::json::ValueBuilder{42}.ExtractValue());
+  event.keys.push_back(formats::json::ValueBuilder{"key"}.ExtractValue());
+
+  const auto value = formats::json::ValueBuilder{event}.ExtractValue();
+  const auto parsed = value.As<cache::InvalidationEvent>();
+  EXPECT_EQ(parsed.cache_name, "cache");
+  EXPECT_EQ(parsed.type, cache::InvalidationType::kKeys);
+  ASSERT_EQ(parsed.keys.size(), 2);
+  EXPECT_EQ(parsed.keys[0].As<int>(), 42);
+  EXPECT_EQ(parsed.keys[1].As<std::string>(), "key");
+}
+
+namespace {
+
+class MemoryChargingCache final : public cache::CacheMockBase {
+ public:
+  MemoryChargingCache(const yaml_config::YamlConfig& config,
+                      cache::MockEnvironment& environment)
+      : cache::CacheMockBase("memory-charging-cache", config, environment) {
+    StartPeriodicUpdates();
+  }
+
+  ~MemoryChargingCache() final { StopPeriodicUpdates(); }
+
+ private:
+  void Update(cache::UpdateType, const std::chrono::system_clock::time_point&,
+              const std::chrono::system_clock::time_point&,
+              cache::UpdateStatisticsScope& stats_scope) override {
+    // E.g. a result set held while the cache data is built
+    const auto charge = utils::ChargeCurrentMemoryAccount(1000);
+    stats_scope.Finish(kDummyDocumentsCount);
+  }
+};
+
+}  // namespace
+
+UTEST(CacheUpdateTrait, MemoryAccountedPerCache) {
+  const yaml_config::YamlConfig config{
+      formats::yaml::FromString(kFakeCacheConfig), {}};
+  cache::MockEnvironment environment;
+  const MemoryChargingCache cache(config, environment);
+
+  const utils::statistics::Snapshot snapshot{environment.statistics_storage,
+                                             "cache.memory"};
+  const auto label =
+      utils::statistics::Label{"cache_name", "memory-charging-cache"};
+  EXPECT_EQ(snapshot.SingleMetric("current-bytes", {label}).AsInt(), 0);
+  EXPECT_EQ(snapshot.SingleMetric("peak-bytes", {label}).AsInt(), 1000);
+  EXPECT_EQ(snapshot.SingleMetric("charged-bytes", {label}).AsRate().value,
+            1000);
+}
+
 USERVER_NAMESPACE_END
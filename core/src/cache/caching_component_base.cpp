@@ -1,5 +1,6 @@
 #include <userver/cache/caching_component_base.hpp>
 
+#include <userver/components/component_config.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -7,6 +8,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components::impl {
 
+bool IsNegativeLookupFilterEnabled(const ComponentConfig& config) {
+  return config["negative-lookup-filter"].As<bool>(false);
+}
+
 yaml_config::Schema GetCachingComponentBaseSchema() {
   return yaml_config::MergeSchemas<dump::Dumper>(R"(
 type: object
@@ -64,6 +69,14 @@ properties:
     testsuite-force-periodic-update:
         type: boolean
         description: override testsuite-periodic-update-enabled in TestsuiteSupport component config
+    invalidation-channel:
+        type: string
+        description: name of the cache::InvalidationChannel component, an event from it triggers an update of the cache out of the schedule
+        defaultDescription: --
+    negative-lookup-filter:
+        type: boolean
+        description: maintain a bloom filter of the keys for a map cache, see GetNegativeLookupFilter()
+        defaultDescription: false
     dump:
         type: object
         description: manages dumps
@@ -0,0 +1,97 @@
+#include <userver/cache/chunked_cow_map.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::ChunkedCowMap<int, std::string>;
+
+Map MakeMap(int size) {
+  Map map;
+  for (int i = 0; i < size; ++i) map.insert_or_assign(i, std::to_string(i));
+  return map;
+}
+
+}  // namespace
+
+TEST(ChunkedCowMap, Basic) {
+  Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+
+  EXPECT_TRUE(map.try_emplace(1, "one").second);
+  EXPECT_FALSE(map.try_emplace(1, "uno").second);
+  EXPECT_FALSE(map.insert_or_assign(1, "uno").second);
+  map[2] = "two";
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_THROW(map.at(3), std::out_of_range);
+
+  EXPECT_EQ(map.erase(3), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 1);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(ChunkedCowMap, GrowsAndIterates) {
+  constexpr int kSize = 10'000;
+  const auto map = MakeMap(kSize);
+  ASSERT_EQ(map.size(), kSize);
+
+  std::unordered_map<int, std::string> seen{map.begin(), map.end()};
+  ASSERT_EQ(seen.size(), kSize);
+  for (int i = 0; i < kSize; ++i) EXPECT_EQ(seen.at(i), std::to_string(i));
+}
+
+TEST(ChunkedCowMap, CopiesAreIndependent) {
+  constexpr int kSize = 10'000;
+  const auto original = MakeMap(kSize);
+
+  auto copy = original;
+  copy.insert_or_assign(0, "zero");
+  copy.erase(1);
+  copy[kSize] = "new";
+  // grows the copy while sharing the chunks with the original
+  for (int i = kSize + 1; i < 2 * kSize; ++i) copy[i] = std::to_string(i);
+
+  EXPECT_EQ(original.size(), kSize);
+  EXPECT_EQ(original.at(0), "0");
+  EXPECT_EQ(original.at(1), "1");
+  EXPECT_FALSE(original.contains(kSize));
+
+  EXPECT_EQ(copy.size(), 2 * kSize - 1);
+  EXPECT_EQ(copy.at(0), "zero");
+  EXPECT_FALSE(copy.contains(1));
+  EXPECT_EQ(copy.at(kSize), "new");
+}
+
+TEST(ChunkedCowMap, IncrementalUpdate) {
+  const auto current = std::make_shared<const Map>(MakeMap(1000));
+
+  /// [Incremental update]
+  // Somewhere in cache's Update() for UpdateType::kIncremental
+  auto data = std::make_unique<Map>(*current);  // cheap, shares the chunks
+  data->insert_or_assign(42, "updated");        // copies a single chunk
+  data->erase(43);
+  // Set(std::move(data));
+  /// [Incremental update]
+
+  EXPECT_EQ(current->at(42), "42");
+  EXPECT_TRUE(current->contains(43));
+  EXPECT_EQ(data->at(42), "updated");
+  EXPECT_FALSE(data->contains(43));
+}
+
+USERVER_NAMESPACE_END
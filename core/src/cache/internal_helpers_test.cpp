@@ -33,6 +33,9 @@ CacheDependencies MakeDependencies(std::string_view name,
                   : nullptr,
       &engine::current_task::GetTaskProcessor(),
       environment.dump_control,
+      environment.startup_semaphore,
+      std::chrono::steady_clock::now(),
+      environment.invalidation_channel,
   };
 }
 
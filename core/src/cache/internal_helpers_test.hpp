@@ -34,6 +34,8 @@ struct MockEnvironment final {
       testsuite::CacheControl::PeriodicUpdatesMode::kDisabled};
   testsuite::DumpControl dump_control{
       testsuite::DumpControl::PeriodicsMode::kDisabled};
+  engine::Semaphore* startup_semaphore{nullptr};
+  InvalidationChannel* invalidation_channel{nullptr};
 };
 
 class CacheMockBase : public CacheUpdateTrait {
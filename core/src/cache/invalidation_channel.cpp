@@ -0,0 +1,94 @@
+#include <userver/cache/invalidation_channel.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+constexpr utils::TrivialBiMap kInvalidationTypeMap([](auto selector) {
+  return selector()
+      .Case(InvalidationType::kKeys, "keys")
+      .Case(InvalidationType::kAll, "all")
+      .Case(InvalidationType::kIncrementalUpdate, "incremental-update")
+      .Case(InvalidationType::kFullUpdate, "full-update");
+});
+
+}  // namespace
+
+formats::json::Value Serialize(const InvalidationEvent& event,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder{formats::common::Type::kObject};
+  builder["cache"] = event.cache_name;
+  builder["type"] =
+      utils::impl::EnumToStringView(event.type, kInvalidationTypeMap);
+  if (event.type == InvalidationType::kKeys) builder["keys"] = event.keys;
+  return builder.ExtractValue();
+}
+
+InvalidationEvent Parse(const formats::json::Value& value,
+                        formats::parse::To<InvalidationEvent>) {
+  InvalidationEvent event;
+  event.cache_name = value["cache"].As<std::string>();
+  event.type = utils::ParseFromValueString(value["type"], kInvalidationTypeMap);
+  if (event.type == InvalidationType::kKeys) {
+    event.keys = value["keys"].As<std::vector<formats::json::Value>>();
+  }
+  return event;
+}
+
+InvalidationChannel::InvalidationChannel(std::string name)
+    : channel_(std::move(name)) {}
+
+InvalidationChannel::~InvalidationChannel() = default;
+
+InvalidationChannel::EventSource& InvalidationChannel::GetEventSource() {
+  return channel_;
+}
+
+std::string InvalidationChannel::SerializeEvent(
+    const InvalidationEvent& event) {
+  return formats::json::ToString(
+      formats::json::ValueBuilder{event}.ExtractValue());
+}
+
+void InvalidationChannel::OnMessage(std::string_view message) {
+  InvalidationEvent event;
+  try {
+    event = formats::json::FromString(message).As<InvalidationEvent>();
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Malformed cache invalidation in '" << channel_.Name()
+                  << "': " << e;
+    return;
+  }
+
+  LOG_DEBUG() << "Invalidating cache '" << event.cache_name << "' from '"
+              << channel_.Name() << "'";
+  channel_.SendEvent(event);
+}
+
+namespace impl {
+
+InvalidationChannel* FindInvalidationChannel(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context) {
+  const auto name =
+      config["invalidation-channel"].As<std::optional<std::string>>();
+  if (!name) return nullptr;
+  return &context.FindComponent<InvalidationChannel>(*name);
+}
+
+}  // namespace impl
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -58,6 +58,13 @@ properties:
     size:
         type: integer
         description: max amount of items to store in cache
+    max-bytes:
+        type: integer
+        description: |
+            max total weight of the items in bytes, the least recently used
+            items are evicted to fit; 0 is unlimited
+        defaultDescription: 0
+        minimum: 0
     ways:
         type: integer
         description: number of ways for associative cache
@@ -65,10 +72,32 @@ properties:
         type: string
         description: TTL for cache entries (0 is unlimited)
         defaultDescription: 0
+    background-update:
+        type: boolean
+        description: |
+            refresh the entries that are accessed after a half of their
+            lifetime in background, without blocking the readers
+        defaultDescription: false
+    admission-policy:
+        type: string
+        description: |
+            `lru` to always evict the least recently used entry, `tiny-lfu`
+            to admit a new entry only if it is used more frequently than the
+            evicted one
+        defaultDescription: lru
+        enum:
+          - lru
+          - tiny-lfu
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
         defaultDescription: true
+    invalidation-channel:
+        type: string
+        description: |
+            name of the cache::InvalidationChannel component to receive the
+            invalidations of this cache from
+        defaultDescription: --
 )");
 }
 
@@ -1,10 +1,12 @@
 #include <userver/cache/lru_cache_config.hpp>
 
 #include <stdexcept>
+#include <string>
 
 #include <userver/components/component_config.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/formats/json/value.hpp>
 #include <userver/utils/algo.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,9 +17,19 @@ namespace {
 
 constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
+constexpr std::string_view kMaxBytes = "max-bytes";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kAdmissionPolicy = "admission-policy";
+
+template <typename Value>
+AdmissionPolicy ParseAdmissionPolicy(const Value& value) {
+  const auto policy = value.template As<std::string>("lru");
+  if (policy == "lru") return AdmissionPolicy::kLru;
+  if (policy == "tiny-lfu") return AdmissionPolicy::kTinyLfu;
+  throw std::runtime_error("Unknown admission-policy '" + policy + "'");
+}
 
 }  // namespace
 
@@ -25,10 +37,12 @@ using dump::impl::ParseMs;
 
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
+      max_bytes(config[kMaxBytes].As<std::size_t>(0)),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      admission_policy(ParseAdmissionPolicy(config[kAdmissionPolicy])) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -37,10 +51,12 @@ LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
 
 LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
     : size(value[kSize].As<std::size_t>()),
+      max_bytes(value[kMaxBytes].As<std::size_t>(0)),
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      admission_policy(ParseAdmissionPolicy(value[kAdmissionPolicy])) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -49,6 +65,12 @@ std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
   return way_size == 0 ? 1 : way_size;
 }
 
+std::size_t LruCacheConfig::GetWayMaxBytes(std::size_t ways) const {
+  if (max_bytes == 0) return 0;
+  const auto way_max_bytes = max_bytes / ways;
+  return way_max_bytes == 0 ? 1 : way_max_bytes;
+}
+
 LruCacheConfig Parse(const formats::json::Value& value,
                      formats::parse::To<LruCacheConfig>) {
   return LruCacheConfig{value};
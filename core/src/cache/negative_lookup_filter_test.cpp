@@ -0,0 +1,74 @@
+#include <userver/cache/negative_lookup_filter.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kKeysCount = 1000;
+
+std::vector<int> MakeKeys() {
+  std::vector<int> keys;
+  for (int i = 0; i < kKeysCount; ++i) keys.push_back(i * 2);
+  return keys;
+}
+
+}  // namespace
+
+UTEST(NegativeLookupFilter, PassesUntilRebuild) {
+  cache::NegativeLookupFilter<int> filter;
+  EXPECT_TRUE(filter.MayContain(1));
+
+  filter.Rebuild(MakeKeys());
+  EXPECT_FALSE(filter.MayContain(-1));
+
+  filter.Reset();
+  EXPECT_TRUE(filter.MayContain(-1));
+}
+
+UTEST(NegativeLookupFilter, NoFalseNegatives) {
+  cache::NegativeLookupFilter<int> filter;
+  filter.Rebuild(MakeKeys());
+
+  int passed_absent = 0;
+  for (int i = 0; i < kKeysCount; ++i) {
+    EXPECT_TRUE(filter.MayContain(i * 2));
+    if (filter.MayContain(i * 2 + 1)) ++passed_absent;
+  }
+  EXPECT_LT(passed_absent, kKeysCount / 50);
+}
+
+UTEST(NegativeLookupFilter, Add) {
+  cache::NegativeLookupFilter<std::string> filter;
+  filter.Add("a");
+  EXPECT_TRUE(filter.MayContain("b"));
+
+  filter.Rebuild(std::vector<std::string>{"a"});
+  EXPECT_FALSE(filter.MayContain("b"));
+
+  filter.Add("b");
+  EXPECT_TRUE(filter.MayContain("a"));
+  EXPECT_TRUE(filter.MayContain("b"));
+
+  // the keys added in between are dropped by the next rebuild
+  filter.Rebuild(std::vector<std::string>{"a"});
+  EXPECT_FALSE(filter.MayContain("b"));
+}
+
+UTEST(NegativeLookupFilter, MapItems) {
+  const std::unordered_map<std::string, int> map{{"a", 1}, {"b", 2}};
+  cache::NegativeLookupFilter<std::string> filter;
+  filter.Rebuild(map,
+                 [](const auto& item) -> const auto& { return item.first; });
+
+  EXPECT_TRUE(filter.MayContain("a"));
+  EXPECT_TRUE(filter.MayContain("b"));
+  EXPECT_FALSE(filter.MayContain("c"));
+}
+
+USERVER_NAMESPACE_END
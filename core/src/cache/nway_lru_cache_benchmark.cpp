@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/cache/nway_clock_cache.hpp>
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::size_t kWaySize = 1024;
+constexpr unsigned kKeysCount = 4096;
+
+}  // namespace
+
+// All the keys fit into the cache, so every Get is a hit: the case where the
+// mutex of NWayLRU ways is contended the most
+template <typename Cache>
+void nway_cache_get_contention(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+
+  engine::RunStandalone(readers_count, [&] {
+    std::atomic<bool> run{true};
+    Cache cache(kWays, kWaySize);
+    for (unsigned key = 0; key < kKeysCount; ++key) cache.Put(key, key);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count - 1);
+
+    for (std::size_t i = 0; i < readers_count - 1; i++) {
+      tasks.push_back(utils::Async("reader", [&, i] {
+        unsigned key = i;
+        while (run) {
+          benchmark::DoNotOptimize(cache.Get(key++ % kKeysCount));
+        }
+      }));
+    }
+
+    unsigned key = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(cache.Get(key++ % kKeysCount));
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(nway_cache_get_contention, cache::NWayLRU<unsigned, int>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(nway_cache_get_contention,
+                   cache::NWayClockCache<unsigned, int>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+template <typename Cache>
+void nway_cache_put(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    Cache cache(kWays, kWaySize);
+
+    unsigned key = 0;
+    for (auto _ : state) {
+      // twice as many keys as the cache holds, so the puts evict
+      cache.Put(key % (kWays * kWaySize * 2), key);
+      ++key;
+    }
+  });
+}
+BENCHMARK_TEMPLATE(nway_cache_put, cache::NWayLRU<unsigned, int>);
+BENCHMARK_TEMPLATE(nway_cache_put, cache::NWayClockCache<unsigned, int>);
+
+USERVER_NAMESPACE_END
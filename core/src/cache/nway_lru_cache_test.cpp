@@ -1,19 +1,36 @@
 #include <userver/utest/utest.hpp>
 
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/cache/nway_clock_cache.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-using Cache = cache::NWayLRU<int, int>;
+namespace {
+
+template <typename T>
+class NWayCache : public ::testing::Test {};
+
+using CachesToTest = ::testing::Types<cache::NWayLRU<int, int>,
+                                      cache::NWayClockCache<int, int>>;
+
+}  // namespace
+
+TYPED_UTEST_SUITE(NWayCache, CachesToTest);
 
-UTEST(NWayLRU, Ctr) {
-  UEXPECT_NO_THROW(Cache(1, 10));
-  UEXPECT_NO_THROW(Cache(10, 10));
-  UEXPECT_THROW(Cache(0, 10), std::logic_error);
+TYPED_UTEST(NWayCache, Ctr) {
+  UEXPECT_NO_THROW(TypeParam(1, 10));
+  UEXPECT_NO_THROW(TypeParam(10, 10));
+  UEXPECT_THROW(TypeParam(0, 10), std::logic_error);
 }
 
-UTEST(NWayLRU, Set) {
-  Cache cache(1, 1);
+TYPED_UTEST(NWayCache, Set) {
+  TypeParam cache(1, 1);
   EXPECT_EQ(0, cache.GetSize());
 
   cache.Put(1, 1);
@@ -26,8 +43,8 @@ UTEST(NWayLRU, Set) {
   EXPECT_FALSE(cache.Get(1).has_value());
 }
 
-UTEST(NWayLRU, GetExpired) {
-  Cache cache(1, 2);
+TYPED_UTEST(NWayCache, GetExpired) {
+  TypeParam cache(1, 2);
   cache.Put(1, 1);
   cache.Put(2, 2);
 
@@ -44,8 +61,8 @@ UTEST(NWayLRU, GetExpired) {
   EXPECT_EQ(0, cache.GetSize());
 }
 
-UTEST(NWayLRU, SetMultipleWays) {
-  Cache cache(2, 1);
+TYPED_UTEST(NWayCache, SetMultipleWays) {
+  TypeParam cache(2, 1);
   cache.Put(1, 1);
   cache.Put(2, 2);
 
@@ -54,4 +71,125 @@ UTEST(NWayLRU, SetMultipleWays) {
   EXPECT_EQ(1, cache.Get(1));
 }
 
+TYPED_UTEST(NWayCache, UpdateExisting) {
+  TypeParam cache(1, 2);
+  cache.Put(1, 1);
+  cache.Put(1, 2);
+
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_EQ(2, cache.Get(1));
+  EXPECT_EQ(2, cache.GetOr(1, 0));
+  EXPECT_EQ(0, cache.GetOr(2, 0));
+}
+
+TYPED_UTEST(NWayCache, InvalidateAndShrink) {
+  TypeParam cache(2, 10);
+  for (int key = 0; key < 20; ++key) cache.Put(key, key);
+
+  cache.InvalidateByKey(0);
+  EXPECT_FALSE(cache.Get(0).has_value());
+
+  cache.UpdateWaySize(2);
+  EXPECT_LE(cache.GetSize(), 4);
+
+  std::size_t visited = 0;
+  cache.VisitAll([&visited](const int& key, const int& value) {
+    EXPECT_EQ(key, value);
+    ++visited;
+  });
+  EXPECT_EQ(visited, cache.GetSize());
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayClockCache, SecondChance) {
+  cache::NWayClockCache<int, int> cache(1, 2);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  EXPECT_EQ(1, cache.Get(1));
+
+  // 2 was not used since it was added
+  cache.Put(3, 3);
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_FALSE(cache.Get(2).has_value());
+  EXPECT_EQ(3, cache.Get(3));
+}
+
+UTEST_MT(NWayClockCache, ConcurrentGetPut, 4) {
+  cache::NWayClockCache<int, int> cache(2, 50);
+  std::atomic<bool> stop{false};
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  for (int i = 0; i < 3; ++i) {
+    readers.push_back(utils::Async("reader", [&] {
+      while (!stop) {
+        for (int key = 0; key < 100; ++key) {
+          const auto value = cache.Get(key);
+          if (value) {
+            EXPECT_EQ(*value, key);
+          }
+        }
+      }
+    }));
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    for (int key = 0; key < 100; ++key) cache.Put(key, key);
+  }
+  stop = true;
+  for (auto& reader : readers) reader.Get();
+
+  EXPECT_LE(cache.GetSize(), 100);
+}
+
+UTEST(NWayLRU, TinyLfuKeepsFrequentKeys) {
+  cache::NWayLRU<int, int> cache(1, 100);
+  cache.SetAdmissionPolicy(cache::AdmissionPolicy::kTinyLfu);
+
+  for (int i = 0; i < 5; ++i) {
+    for (int key = 0; key < 50; ++key) cache.Put(key, key);
+  }
+  // a scan of keys that are used once
+  for (int key = 1000; key < 2000; ++key) cache.Put(key, key);
+
+  for (int key = 0; key < 50; ++key) EXPECT_EQ(cache.Get(key), key);
+  EXPECT_LE(cache.GetSize(), 100);
+}
+
+UTEST(NWayLRU, MaxWeight) {
+  cache::NWayLRU<int, std::string> cache(2, 100);
+  cache.UpdateWayMaxWeight(10000);
+
+  for (int key = 0; key < 100; ++key) cache.Put(key, std::string(1000, 'a'));
+  EXPECT_LE(cache.GetWeight(), 2 * (10000 + 2000));
+  EXPECT_LT(cache.GetSize(), 30);
+
+  // the weight limit survives the switch of the admission policy
+  cache.SetAdmissionPolicy(cache::AdmissionPolicy::kTinyLfu);
+  for (int key = 0; key < 100; ++key) cache.Put(key, std::string(1000, 'a'));
+  EXPECT_LE(cache.GetWeight(), 2 * (10000 + 2000));
+
+  cache.Invalidate();
+  EXPECT_EQ(cache.GetWeight(), 0);
+}
+
+UTEST(NWayLRU, SwitchAdmissionPolicy) {
+  cache::NWayLRU<int, int> cache(2, 10);
+  for (int key = 0; key < 10; ++key) cache.Put(key, key);
+  const auto size = cache.GetSize();
+
+  cache.SetAdmissionPolicy(cache::AdmissionPolicy::kTinyLfu);
+  EXPECT_EQ(cache.GetSize(), size);
+  cache.SetAdmissionPolicy(cache::AdmissionPolicy::kLru);
+  EXPECT_EQ(cache.GetSize(), size);
+
+  for (int key = 0; key < 10; ++key) {
+    const auto value = cache.Get(key);
+    if (value) {
+      EXPECT_EQ(*value, key);
+    }
+  }
+}
+
 USERVER_NAMESPACE_END
@@ -45,6 +45,19 @@ ResolverConfig ParseResolverConfig(
   return config;
 }
 
+void WriteNetLookupCounters(utils::statistics::Writer& writer,
+                            const Resolver::NetLookupCounters& counters) {
+  writer.ValueWithLabels(counters.cached, {kDnsReplySource, "cached"});
+  writer.ValueWithLabels(counters.cached_stale,
+                         {kDnsReplySource, "cached-stale"});
+  writer.ValueWithLabels(counters.cached_failure,
+                         {kDnsReplySource, "cached-failure"});
+  writer.ValueWithLabels(counters.network, {kDnsReplySource, "network"});
+  writer.ValueWithLabels(counters.network_failure,
+                         {kDnsReplySource, "network-failure"});
+  writer["prefetch"] = counters.prefetch;
+}
+
 }  // namespace
 
 Component::Component(const components::ComponentConfig& config,
@@ -64,14 +77,10 @@ clients::dns::Resolver& Component::GetResolver() { return resolver_; }
 void Component::Write(utils::statistics::Writer& writer) {
   const auto& counters = GetResolver().GetLookupSourceCounters();
   writer.ValueWithLabels(counters.file, {kDnsReplySource, "file"});
-  writer.ValueWithLabels(counters.cached, {kDnsReplySource, "cached"});
-  writer.ValueWithLabels(counters.cached_stale,
-                         {kDnsReplySource, "cached-stale"});
-  writer.ValueWithLabels(counters.cached_failure,
-                         {kDnsReplySource, "cached-failure"});
-  writer.ValueWithLabels(counters.network, {kDnsReplySource, "network"});
-  writer.ValueWithLabels(counters.network_failure,
-                         {kDnsReplySource, "network-failure"});
+  WriteNetLookupCounters(writer, counters);
+  if (auto srv_writer = writer["srv"]) {
+    WriteNetLookupCounters(srv_writer, counters.srv);
+  }
 }
 
 yaml_config::Schema Component::GetStaticConfigSchema() {
@@ -13,6 +13,16 @@ void SortAddrs(AddrVector& addrs) {
       });
 }
 
+void SortSrvRecords(SrvVector& records) {
+  std::stable_sort(records.begin(), records.end(),
+                   [](const SrvRecord& lhs, const SrvRecord& rhs) {
+                     if (lhs.priority != rhs.priority) {
+                       return lhs.priority < rhs.priority;
+                     }
+                     return lhs.weight > rhs.weight;
+                   });
+}
+
 }  // namespace clients::dns::impl
 
 USERVER_NAMESPACE_END
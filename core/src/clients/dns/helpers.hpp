@@ -8,6 +8,8 @@ namespace clients::dns::impl {
 
 void SortAddrs(AddrVector& addrs);
 
+void SortSrvRecords(SrvVector& records);
+
 }  // namespace clients::dns::impl
 
 USERVER_NAMESPACE_END
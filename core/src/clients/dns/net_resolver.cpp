@@ -1,9 +1,12 @@
 #include <clients/dns/net_resolver.hpp>
 
+#include <arpa/nameser.h>
 #include <sys/select.h>
 
+#include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <limits>
@@ -43,6 +46,55 @@ std::exception_ptr MakeNotResolvedException(std::string_view name,
       fmt::format("Could not resolve {}: {}", name, reason)});
 }
 
+// ares_parse_srv_reply() does not report TTLs, so they are read from the
+// answer section of the reply, see RFC1035 4.1
+std::chrono::seconds GetMinAnswerTtl(const unsigned char* abuf, int alen) {
+  constexpr int kHeaderSize = 12;
+  constexpr int kQuestionTailSize = 4;  // QTYPE, QCLASS
+  constexpr int kAnswerTailSize = 10;   // TYPE, CLASS, TTL, RDLENGTH
+
+  const auto read_uint16 = [abuf](int pos) {
+    return static_cast<int>((abuf[pos] << 8) | abuf[pos + 1]);
+  };
+  int pos = kHeaderSize;
+  const auto skip_name = [abuf, alen, &pos] {
+    char* name = nullptr;
+    long name_size = 0;
+    if (::ares_expand_name(abuf + pos, abuf, alen, &name, &name_size) !=
+        ARES_SUCCESS) {
+      return false;
+    }
+    ::ares_free_string(name);
+    pos += name_size;
+    return true;
+  };
+
+  if (alen < kHeaderSize) return std::chrono::seconds{0};
+  const auto questions = read_uint16(4);
+  const auto answers = read_uint16(6);
+  for (int i = 0; i < questions; ++i) {
+    if (!skip_name() || pos + kQuestionTailSize > alen) {
+      return std::chrono::seconds{0};
+    }
+    pos += kQuestionTailSize;
+  }
+
+  auto ttl = std::chrono::seconds::max();
+  for (int i = 0; i < answers; ++i) {
+    if (!skip_name() || pos + kAnswerTailSize > alen) break;
+    const auto record_ttl = (std::uint32_t{abuf[pos + 4]} << 24) |
+                            (std::uint32_t{abuf[pos + 5]} << 16) |
+                            (std::uint32_t{abuf[pos + 6]} << 8) |
+                            std::uint32_t{abuf[pos + 7]};
+    // RFC2181 8: values with the most significant bit set are treated as zero
+    const std::chrono::seconds record_ttl_seconds{
+        record_ttl > std::numeric_limits<std::int32_t>::max() ? 0 : record_ttl};
+    ttl = std::min(ttl, record_ttl_seconds);
+    pos += kAnswerTailSize + read_uint16(pos + 8);
+  }
+  return ttl == std::chrono::seconds::max() ? std::chrono::seconds{0} : ttl;
+}
+
 }  // namespace
 
 class NetResolver::Impl {
@@ -52,9 +104,15 @@ class NetResolver::Impl {
     engine::Promise<Response> promise;
   };
 
+  struct SrvRequest {
+    std::string name;
+    engine::Promise<SrvResponse> promise;
+  };
+
   engine::io::Poller poller;
   impl::ChannelPtr channel;
   moodycamel::ConcurrentQueue<std::unique_ptr<Request>> requests_queue;
+  moodycamel::ConcurrentQueue<std::unique_ptr<SrvRequest>> srv_requests_queue;
   engine::Task worker_task;
 
   static void SockStateCallback(void* data, ares_socket_t socket_fd,
@@ -107,6 +165,44 @@ class NetResolver::Impl {
     request->promise.set_value(std::move(response));
   }
 
+  static void SrvCallback(void* arg, int status, int /* timeouts */,
+                          unsigned char* abuf, int alen) {
+    std::unique_ptr<SrvRequest> request{static_cast<SrvRequest*>(arg)};
+    UASSERT(request);
+
+    SrvResponse response;
+    response.received_at = utils::datetime::MockNow();
+    if (status != ARES_SUCCESS) {
+      request->promise.set_exception(
+          MakeNotResolvedException(request->name, ares_strerror(status)));
+      return;
+    }
+
+    struct ares_srv_reply* reply = nullptr;
+    const int parse_ret = ::ares_parse_srv_reply(abuf, alen, &reply);
+    if (parse_ret != ARES_SUCCESS) {
+      request->promise.set_exception(
+          MakeNotResolvedException(request->name, ares_strerror(parse_ret)));
+      return;
+    }
+    impl::SrvReplyPtr srv_reply{reply};
+    for (auto* node = srv_reply.get(); node; node = node->next) {
+      response.records.push_back(
+          SrvRecord{node->host, node->port, node->priority, node->weight});
+      LOG_DEBUG() << request->name << " resolved to " << node->host << ':'
+                  << node->port << ", priority=" << node->priority
+                  << ", weight=" << node->weight;
+    }
+    if (response.records.empty()) {
+      request->promise.set_exception(
+          MakeNotResolvedException(request->name, "Empty SRV record list"));
+      return;
+    }
+    response.ttl = GetMinAnswerTtl(abuf, alen);
+    impl::SortSrvRecords(response.records);
+    request->promise.set_value(std::move(response));
+  }
+
   void AddSocketEventsToPoller() {
     std::array<ares_socket_t, ARES_GETSOCK_MAXNUM> ares_sockets{};
     const auto mask =
@@ -163,7 +259,9 @@ class NetResolver::Impl {
     };
 
     moodycamel::ConsumerToken requests_queue_token{requests_queue};
+    moodycamel::ConsumerToken srv_requests_queue_token{srv_requests_queue};
     std::vector<std::unique_ptr<Request>> current_requests;
+    std::vector<std::unique_ptr<SrvRequest>> current_srv_requests;
     while (!engine::current_task::ShouldCancel()) {
       current_requests.clear();
       requests_queue.try_dequeue_bulk(requests_queue_token,
@@ -174,6 +272,16 @@ class NetResolver::Impl {
                            &AddrinfoCallback, req.release());
       }
 
+      current_srv_requests.clear();
+      srv_requests_queue.try_dequeue_bulk(
+          srv_requests_queue_token, std::back_inserter(current_srv_requests),
+          -1);
+      for (auto& req : current_srv_requests) {
+        const auto* name_c_str = req->name.c_str();
+        ::ares_query(channel.get(), name_c_str, ns_c_in, ns_t_srv,
+                     &SrvCallback, req.release());
+      }
+
       AddSocketEventsToPoller();
       PollEvents();
 
@@ -253,6 +361,16 @@ engine::Future<NetResolver::Response> NetResolver::Resolve(std::string name) {
   return future;
 }
 
+engine::Future<NetResolver::SrvResponse> NetResolver::ResolveSrv(
+    std::string name) {
+  auto request = std::make_unique<Impl::SrvRequest>();
+  request->name = std::move(name);
+  auto future = request->promise.get_future();
+  impl_->srv_requests_queue.enqueue(std::move(request));
+  impl_->poller.Interrupt();
+  return future;
+}
+
 }  // namespace clients::dns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,12 @@ class NetResolver {
     std::chrono::seconds ttl{0};
   };
 
+  struct SrvResponse {
+    SrvVector records;
+    std::chrono::system_clock::time_point received_at;
+    std::chrono::seconds ttl{0};
+  };
+
   // reads resolv.conf for nameservers and some of the options from FS-TP
   NetResolver(engine::TaskProcessor& fs_task_processor,
               std::chrono::milliseconds query_timeout, int query_attempts,
@@ -33,9 +39,12 @@ class NetResolver {
 
   engine::Future<Response> Resolve(std::string name);
 
+  // name is the full service name, e.g. `_http._tcp.example.com`
+  engine::Future<SrvResponse> ResolveSrv(std::string name);
+
  private:
   class Impl;
-  constexpr static size_t kSize = 752;
+  constexpr static size_t kSize = 1352;
   constexpr static size_t kAlignment = 8;
   utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
@@ -236,4 +236,34 @@ UTEST(NetResolver, Select1024) {
   EXPECT_EQ(result.ttl, std::chrono::seconds{300});
 }
 
+UTEST(NetResolver, Srv) {
+  Mock mock{[](const Mock::DnsQuery& query) -> Mock::DnsAnswerVector {
+    if (query.type == Mock::RecordType::kSrv &&
+        query.name == "_http._tcp.yandex.ru") {
+      return {{query.type, Mock::SrvData{20, 1, 8080, "backup.yandex.ru"}, 42},
+              {query.type, Mock::SrvData{10, 1, 80, "light.yandex.ru"}, 13},
+              {query.type, Mock::SrvData{10, 5, 80, "heavy.yandex.ru"}, 13}};
+    }
+    throw std::exception{};
+  }};
+
+  auto resolver = GetResolver(mock);
+
+  const auto resolve_start = utils::datetime::MockNow();
+  const auto result = resolver->ResolveSrv("_http._tcp.yandex.ru").get();
+  ASSERT_EQ(result.records.size(), 3);
+  EXPECT_EQ(result.records[0].target, "heavy.yandex.ru");
+  EXPECT_EQ(result.records[0].port, 80);
+  EXPECT_EQ(result.records[0].priority, 10);
+  EXPECT_EQ(result.records[0].weight, 5);
+  EXPECT_EQ(result.records[1].target, "light.yandex.ru");
+  EXPECT_EQ(result.records[2].target, "backup.yandex.ru");
+  EXPECT_EQ(result.records[2].port, 8080);
+  EXPECT_LE(result.received_at - resolve_start, utest::kMaxTestWaitTime);
+  EXPECT_EQ(result.ttl, std::chrono::seconds{13});
+
+  UEXPECT_THROW(resolver->ResolveSrv("_ftp._tcp.yandex.ru").get(),
+                clients::dns::NotResolvedException);
+}
+
 USERVER_NAMESPACE_END
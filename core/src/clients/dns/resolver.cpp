@@ -2,9 +2,11 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <string_view>
+#include <type_traits>
 
 #include <clients/dns/file_resolver.hpp>
 #include <clients/dns/helpers.hpp>
@@ -79,17 +81,33 @@ std::optional<engine::io::Sockaddr> ParseNumericAddr(const std::string& name) {
   return result;
 }
 
+bool IsValidDomainNameChar(char c) {
+  return c == '.' || c == '-' || std::isdigit(c) ||
+         // not using isalpha/isalnum here as only ASCII is allowed
+         (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
 void CheckValidDomainName(const std::string& name) {
   // Not exhaustive, just quick character set check.
   for (char c : name) {
-    if (c != '.' && c != '-' && !std::isdigit(c) &&
-        // not using isalpha/isalnum here as only ASCII is allowed
-        !(c >= 'a' && c <= 'z') && !(c >= 'A' && c <= 'Z')) {
+    if (!IsValidDomainNameChar(c)) {
       throw NotResolvedException{"Invalid domain name: '" + name + "'"};
     }
   }
 }
 
+void CheckValidServiceName(const std::string& name) {
+  // RFC2782: service and protocol labels are prefixed with an underscore
+  if (name.empty() || name.front() != '_') {
+    throw NotResolvedException{"Invalid service name: '" + name + "'"};
+  }
+  for (char c : name) {
+    if (c != '_' && !IsValidDomainNameChar(c)) {
+      throw NotResolvedException{"Invalid service name: '" + name + "'"};
+    }
+  }
+}
+
 bool IsInDomain(std::string_view name, std::string_view domain) {
   if (name.empty()) return false;
 
@@ -128,8 +146,14 @@ const AddrVector& LocalhostAddrs() {
 
 enum class FailureMode { kIgnore, kCache };
 
+template <typename Records>
+using NetResponse =
+    std::conditional_t<std::is_same_v<Records, SrvVector>,
+                       NetResolver::SrvResponse, NetResolver::Response>;
+
 class Resolver::Impl {
  public:
+  template <typename Records>
   struct NetCacheResult {
     enum class Status {
       kMiss,
@@ -139,7 +163,7 @@ class Resolver::Impl {
     };
 
     Status status{Status::kMiss};
-    AddrVector addrs;
+    Records records;
   };
 
   Impl(engine::TaskProcessor& fs_task_processor, const ResolverConfig& config);
@@ -152,36 +176,52 @@ class Resolver::Impl {
   void FlushNetworkCache(const std::string& name);
 
   AddrVector QueryFileCache(const std::string& name);
-  NetCacheResult QueryNetCache(const std::string& name);
 
-  auto GetUpdateMutex(const std::string& name);
-  void AccountNetUpdateFailure();
-
-  template <typename Mutex>
-  AddrVector DoForegroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
-                               const std::string& name,
-                               engine::Deadline deadline);
-
-  template <typename Mutex>
-  void StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
-                            const std::string& name);
+  template <typename Records>
+  Records ResolveNet(const std::string& name, engine::Deadline deadline);
 
  private:
+  template <typename Records>
   struct NetCacheEntry {
-    AddrVector addrs;
+    Records records;
     std::chrono::steady_clock::time_point expiration;
+    // background update is started on the first lookup after this point
+    std::chrono::steady_clock::time_point update_after;
     bool is_failure{false};
   };
 
-  template <typename Mutex>
+  template <typename Records>
+  using NetCache = cache::NWayLRU<std::string, NetCacheEntry<Records>>;
+
+  template <typename Records>
+  NetCache<Records>& GetNetCache();
+
+  template <typename Records>
+  NetLookupCounters& GetNetCounters();
+
+  template <typename Records>
+  engine::Future<NetResponse<Records>> QueryNetwork(const std::string& name);
+
+  template <typename Records>
+  NetCacheResult<Records> QueryNetCache(const std::string& name);
+
+  template <typename Records, typename Mutex>
+  Records DoForegroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
+                            const std::string& name, engine::Deadline deadline);
+
+  template <typename Records, typename Mutex>
+  void StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
+                            const std::string& name);
+
+  template <typename Records, typename Mutex>
   void MoveQueryToBackground(std::unique_lock<Mutex>& lock, Mutex&& mutex,
-                             engine::Future<NetResolver::Response>&& future,
+                             engine::Future<NetResponse<Records>>&& future,
                              const std::string& name, FailureMode failure_mode);
 
-  template <typename Mutex>
+  template <typename Records, typename Mutex>
   void FinishNetUpdate(std::unique_lock<Mutex>& lock,
-                       engine::Future<NetResolver::Response>&& future,
-                       const std::string& name, AddrVector* addrs,
+                       engine::Future<NetResponse<Records>>&& future,
+                       const std::string& name, Records* records,
                        FailureMode failure_mode);
 
   LookupSourceCounters source_counters_;
@@ -190,7 +230,9 @@ class Resolver::Impl {
   const std::chrono::milliseconds net_cache_update_margin_;
   const std::chrono::milliseconds net_cache_max_reply_ttl_;
   const std::chrono::milliseconds net_cache_failure_ttl_;
-  cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
+  NetCache<AddrVector> net_cache_;
+  NetCache<SrvVector> srv_cache_;
+  // SRV names start with '_' and never clash with the domain names
   concurrent::MutexSet<std::string> net_cache_update_mutexes_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
@@ -205,6 +247,7 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
       net_cache_{config.cache_ways, config.cache_size_per_way},
+      srv_cache_{config.cache_ways, config.cache_size_per_way},
       net_cache_update_mutexes_(config.cache_ways) {}
 
 Resolver::Impl::~Impl() { wait_token_storage_.WaitForAllTokens(); }
@@ -216,10 +259,14 @@ const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
 
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
-void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
+void Resolver::Impl::FlushNetworkCache() {
+  net_cache_.Invalidate();
+  srv_cache_.Invalidate();
+}
 
 void Resolver::Impl::FlushNetworkCache(const std::string& name) {
   net_cache_.InvalidateByKey(name);
+  srv_cache_.InvalidateByKey(name);
 }
 
 AddrVector Resolver::Impl::QueryFileCache(const std::string& name) {
@@ -230,73 +277,145 @@ AddrVector Resolver::Impl::QueryFileCache(const std::string& name) {
   return addrs;
 }
 
-Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
+template <typename Records>
+Records Resolver::Impl::ResolveNet(const std::string& name,
+                                   engine::Deadline deadline) {
+  using Status = typename NetCacheResult<Records>::Status;
+
+  auto net_result = QueryNetCache<Records>(name);
+
+  if (net_result.status == Status::kHitReply) {
+    return std::move(net_result.records);
+  }
+
+  auto mutex = net_cache_update_mutexes_.GetMutexForKey(name);
+  std::unique_lock lock{mutex, std::defer_lock};
+  if (net_result.status == Status::kMiss) {
+    // synchronize with possible parallel updates
+    if (deadline.IsReachable()) {
+      lock.try_lock_for(deadline.TimeLeft());
+    } else {
+      lock.lock();
+    }
+    if (!lock) {
+      ++GetNetCounters<Records>().network_failure;
+      throw NotResolvedException{"Resolving '" + name + "' timed out (lock)"};
+    }
+
+    net_result = QueryNetCache<Records>(name);
+  }
+
+  switch (net_result.status) {
+    case Status::kMiss:
+      return DoForegroundQuery<Records>(lock, std::move(mutex), name,
+                                        deadline);
+
+    case Status::kHitReplyWithUpdate:
+      StartBackgroundQuery<Records>(lock, std::move(mutex), name);
+      [[fallthrough]];
+    case Status::kHitReply:
+      return std::move(net_result.records);
+
+    case Status::kHitFailure:
+      throw NotResolvedException{"Not resolving '" + name +
+                                 "' because of prior failure"};
+  }
+
+  UINVARIANT(false, "Unexpected cache result status");
+}
+
+template <typename Records>
+auto Resolver::Impl::GetNetCache() -> NetCache<Records>& {
+  if constexpr (std::is_same_v<Records, SrvVector>) {
+    return srv_cache_;
+  } else {
+    return net_cache_;
+  }
+}
+
+template <typename Records>
+Resolver::NetLookupCounters& Resolver::Impl::GetNetCounters() {
+  if constexpr (std::is_same_v<Records, SrvVector>) {
+    return source_counters_.srv;
+  } else {
+    return source_counters_;
+  }
+}
+
+template <typename Records>
+engine::Future<NetResponse<Records>> Resolver::Impl::QueryNetwork(
     const std::string& name) {
-  NetCacheResult result;
+  if constexpr (std::is_same_v<Records, SrvVector>) {
+    return net_resolver_.ResolveSrv(name);
+  } else {
+    return net_resolver_.Resolve(name);
+  }
+}
+
+template <typename Records>
+auto Resolver::Impl::QueryNetCache(const std::string& name)
+    -> NetCacheResult<Records> {
+  using Status = typename NetCacheResult<Records>::Status;
+  NetCacheResult<Records> result;
+  auto& counters = GetNetCounters<Records>();
 
   const auto now = utils::datetime::MockSteadyNow();
-  const auto cached = net_cache_.Get(name);
+  const auto cached = GetNetCache<Records>().Get(name);
   if (!cached) return result;
 
   if (cached->is_failure) {
     if (cached->expiration >= now) {
-      ++source_counters_.cached_failure;
-      result.status = NetCacheResult::Status::kHitFailure;
+      ++counters.cached_failure;
+      result.status = Status::kHitFailure;
     }
     return result;
   }
 
-  result.addrs = cached->addrs;
+  result.records = cached->records;
   if (cached->expiration >= now) {
-    ++source_counters_.cached;
+    ++counters.cached;
   } else {
-    ++source_counters_.cached_stale;
+    ++counters.cached_stale;
   }
 
-  if (cached->expiration - now >= net_cache_update_margin_) {
-    result.status = NetCacheResult::Status::kHitReply;
+  if (cached->update_after > now) {
+    result.status = Status::kHitReply;
   } else {
-    result.status = NetCacheResult::Status::kHitReplyWithUpdate;
+    result.status = Status::kHitReplyWithUpdate;
   }
 
   return result;
 }
 
-auto Resolver::Impl::GetUpdateMutex(const std::string& name) {
-  return net_cache_update_mutexes_.GetMutexForKey(name);
-}
-
-void Resolver::Impl::AccountNetUpdateFailure() {
-  ++source_counters_.network_failure;
-}
-
-template <typename Mutex>
-AddrVector Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
-                                             Mutex&& mutex,
-                                             const std::string& name,
-                                             engine::Deadline deadline) {
+template <typename Records, typename Mutex>
+Records Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
+                                          Mutex&& mutex,
+                                          const std::string& name,
+                                          engine::Deadline deadline) {
   UINVARIANT(lock, "Foreground query doesn't have a lock");
   UASSERT(lock.mutex() == &mutex);
 
   LOG_TRACE() << "Resolving '" << name << "' in foreground";
-  auto future = net_resolver_.Resolve(name);
+  auto future = QueryNetwork<Records>(name);
   auto future_status = future.wait_until(deadline);
   if (future_status != engine::FutureStatus::kReady) {
     LOG_TRACE() << "Sending query for '" << name << "' to background";
-    MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future),
-                          name, FailureMode::kCache);
+    MoveQueryToBackground<Records>(lock, std::forward<Mutex>(mutex),
+                                   std::move(future), name,
+                                   FailureMode::kCache);
     // not updating counters here as the request lives on in the background
     if (future_status == engine::FutureStatus::kTimeout) {
       throw NotResolvedException{"Resolving '" + name + "' timed out"};
     }
     throw NotResolvedException{"Resolving '" + name + "' interrupted"};
   }
-  AddrVector addrs;
-  FinishNetUpdate(lock, std::move(future), name, &addrs, FailureMode::kCache);
-  return addrs;
+  Records records;
+  FinishNetUpdate<Records>(lock, std::move(future), name, &records,
+                           FailureMode::kCache);
+  return records;
 }
 
-template <typename Mutex>
+template <typename Records, typename Mutex>
 void Resolver::Impl::StartBackgroundQuery(std::unique_lock<Mutex>& lock,
                                           Mutex&& mutex,
                                           const std::string& name) {
@@ -306,15 +425,16 @@ void Resolver::Impl::StartBackgroundQuery(std::unique_lock<Mutex>& lock,
     return;
   }
   LOG_TRACE() << "Updating record for '" << name << "' in background";
-  auto future = net_resolver_.Resolve(name);
-  MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future),
-                        name, FailureMode::kIgnore);
+  ++GetNetCounters<Records>().prefetch;
+  auto future = QueryNetwork<Records>(name);
+  MoveQueryToBackground<Records>(lock, std::forward<Mutex>(mutex),
+                                 std::move(future), name, FailureMode::kIgnore);
 }
 
-template <typename Mutex>
+template <typename Records, typename Mutex>
 void Resolver::Impl::MoveQueryToBackground(
     std::unique_lock<Mutex>& lock, Mutex&& mutex,
-    engine::Future<NetResolver::Response>&& future, const std::string& name,
+    engine::Future<NetResponse<Records>>&& future, const std::string& name,
     FailureMode failure_mode) {
   UASSERT(lock);
   UASSERT(lock.mutex() == &mutex);
@@ -322,8 +442,9 @@ void Resolver::Impl::MoveQueryToBackground(
       [token = wait_token_storage_.GetToken(), this, name, failure_mode](
           auto&& mutex, auto&& future) {
         std::unique_lock lock{mutex, std::adopt_lock};
-        this->FinishNetUpdate(lock, std::forward<decltype(future)>(future),
-                              name, nullptr, failure_mode);
+        this->FinishNetUpdate<Records>(
+            lock, std::forward<decltype(future)>(future), name, nullptr,
+            failure_mode);
       },
       std::forward<Mutex>(mutex), std::move(future))
       .Detach();
@@ -335,42 +456,60 @@ void Resolver::Impl::MoveQueryToBackground(
 //  - TTL of zero should not be cached
 //  - TTL should be capped (we use minutes instead of days though)
 //  - Stale records may be used and recommended to have a TTL of 30 seconds
-template <typename Mutex>
+//
+// Replies are refreshed in background during the last tenth of their TTL (but
+// no later than a network timeout before the expiration), so that the names in
+// use are never served stale or resolved in foreground.
+template <typename Records, typename Mutex>
 void Resolver::Impl::FinishNetUpdate(
     std::unique_lock<Mutex>& lock,
-    engine::Future<NetResolver::Response>&& future, const std::string& name,
-    AddrVector* addrs, FailureMode failure_mode) {
+    engine::Future<NetResponse<Records>>&& future, const std::string& name,
+    Records* records, FailureMode failure_mode) {
   UASSERT(lock);
-  NetResolver::Response response;
+  auto& net_cache = GetNetCache<Records>();
+  auto& counters = GetNetCounters<Records>();
+  NetResponse<Records> response;
   try {
     response = future.get();
   } catch (const ResolverException& ex) {
     LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
     if (failure_mode == FailureMode::kCache) {
       LOG_TRACE() << "Caching failure for '" << name << '\'';
-      net_cache_.Put(name, NetCacheEntry{{},
-                                         utils::datetime::MockSteadyNow() +
-                                             net_cache_failure_ttl_,
-                                         true});
+      const auto expiration =
+          utils::datetime::MockSteadyNow() + net_cache_failure_ttl_;
+      net_cache.Put(name,
+                    NetCacheEntry<Records>{{}, expiration, expiration, true});
     }
-    ++source_counters_.network_failure;
+    ++counters.network_failure;
     throw;
   }
 
+  auto& response_records = [&response]() -> Records& {
+    if constexpr (std::is_same_v<Records, SrvVector>) {
+      return response.records;
+    } else {
+      return response.addrs;
+    }
+  }();
+
   const auto effective_ttl =
       std::min<std::chrono::milliseconds>(response.ttl,
                                           net_cache_max_reply_ttl_) +
       (response.received_at - utils::datetime::MockNow());
-  if (addrs) *addrs = response.addrs;
+  if (records) *records = response_records;
   if (effective_ttl.count() > 0) {
     LOG_TRACE() << "Updating cache for '" << name << '\'';
-    net_cache_.Put(
-        name, NetCacheEntry{std::move(response.addrs),
-                            utils::datetime::MockSteadyNow() + effective_ttl});
+    const auto now = utils::datetime::MockSteadyNow();
+    const auto expiration = now + effective_ttl;
+    const auto update_after =
+        expiration - std::max<std::chrono::steady_clock::duration>(
+                         net_cache_update_margin_, effective_ttl / 10);
+    net_cache.Put(name, NetCacheEntry<Records>{std::move(response_records),
+                                               expiration, update_after});
   } else {
     LOG_TRACE() << "Skipping cache update for '" << name << '\'';
   }
-  ++source_counters_.network;
+  ++counters.network;
 }
 
 Resolver::Resolver(engine::TaskProcessor& fs_task_processor,
@@ -401,45 +540,18 @@ AddrVector Resolver::Resolve(const std::string& name,
     if (!file_addrs.empty()) return file_addrs;
   }
 
-  auto net_result = impl_->QueryNetCache(name);
-
-  if (net_result.status == Impl::NetCacheResult::Status::kHitReply) {
-    return std::move(net_result.addrs);
-  }
-
-  auto mutex = impl_->GetUpdateMutex(name);
-  std::unique_lock lock{mutex, std::defer_lock};
-  if (net_result.status == Impl::NetCacheResult::Status::kMiss) {
-    // synchronize with possible parallel updates
-    if (deadline.IsReachable()) {
-      lock.try_lock_for(deadline.TimeLeft());
-    } else {
-      lock.lock();
-    }
-    if (!lock) {
-      impl_->AccountNetUpdateFailure();
-      throw NotResolvedException{"Resolving '" + name + "' timed out (lock)"};
-    }
-
-    net_result = impl_->QueryNetCache(name);
-  }
-
-  switch (net_result.status) {
-    case Impl::NetCacheResult::Status::kMiss:
-      return impl_->DoForegroundQuery(lock, std::move(mutex), name, deadline);
+  return impl_->ResolveNet<AddrVector>(name, deadline);
+}
 
-    case Impl::NetCacheResult::Status::kHitReplyWithUpdate:
-      impl_->StartBackgroundQuery(lock, std::move(mutex), name);
-      [[fallthrough]];
-    case Impl::NetCacheResult::Status::kHitReply:
-      return std::move(net_result.addrs);
+SrvVector Resolver::ResolveSrv(const std::string& name,
+                               engine::Deadline deadline) {
+  CheckValidServiceName(name);
 
-    case Impl::NetCacheResult::Status::kHitFailure:
-      throw NotResolvedException{"Not resolving '" + name +
-                                 "' because of prior failure"};
+  if (IsInDomain(name, "localhost") || IsInDomain(name, "invalid")) {
+    throw NotResolvedException("Not resolving special name '" + name + '\'');
   }
 
-  UINVARIANT(false, "Unexpected cache result status");
+  return impl_->ResolveNet<SrvVector>(name, deadline);
 }
 
 const Resolver::LookupSourceCounters& Resolver::GetLookupSourceCounters()
@@ -73,6 +73,12 @@ struct MockedResolver {
             return {{query.type, kNetV4Sockaddr, 99999}};
           } else if (query.type == ServerMock::RecordType::kAAAA) {
             return {{query.type, kNetV6Sockaddr, 99999}};
+          } else if (query.type == ServerMock::RecordType::kSrv &&
+                     query.name == "_http._tcp.service") {
+            return {{query.type, ServerMock::SrvData{20, 1, 8080, "backup"},
+                     99999},
+                    {query.type, ServerMock::SrvData{10, 1, 80, "main"},
+                     99999}};
           }
           throw std::exception{};
         }},
@@ -517,4 +523,83 @@ UTEST(Resolver, FirstUpdateCombines) {
   EXPECT_EQ(counters.network_failure, 1);
 }
 
+UTEST(Resolver, Prefetch) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 1};
+  const auto& counters = resolver->GetLookupSourceCounters();
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  utils::datetime::MockSleep(std::chrono::seconds{850});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  EXPECT_EQ(counters.prefetch, 0);
+
+  // The last tenth of TTL, the reply is returned and updated in background
+  utils::datetime::MockSleep(std::chrono::seconds{100});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  EXPECT_EQ(counters.prefetch, 1);
+  while (counters.network < 2 && !test_deadline.IsReached()) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+
+  // Past the original expiration the prefetched reply is used
+  utils::datetime::MockSleep(std::chrono::seconds{100});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  EXPECT_EQ(counters.file, 0);
+  EXPECT_EQ(counters.cached, 3);
+  EXPECT_EQ(counters.cached_stale, 0);
+  EXPECT_EQ(counters.cached_failure, 0);
+  EXPECT_EQ(counters.network, 2);
+  EXPECT_EQ(counters.network_failure, 0);
+  EXPECT_EQ(counters.prefetch, 1);
+}
+
+UTEST(Resolver, Srv) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 1};
+
+  for (int i = 0; i < 2; ++i) {
+    const auto records =
+        resolver->ResolveSrv("_http._tcp.service", test_deadline);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].target, "main");
+    EXPECT_EQ(records[0].port, 80);
+    EXPECT_EQ(records[1].target, "backup");
+    EXPECT_EQ(records[1].port, 8080);
+  }
+
+  UEXPECT_THROW(resolver->ResolveSrv("_http._tcp.fail", test_deadline),
+                clients::dns::NotResolvedException);
+  UEXPECT_THROW(resolver->ResolveSrv("_http._tcp.fail", test_deadline),
+                clients::dns::NotResolvedException);
+  UEXPECT_THROW(resolver->ResolveSrv("http.service", test_deadline),
+                clients::dns::NotResolvedException);
+  UEXPECT_THROW(resolver->ResolveSrv("_http._tcp.localhost", test_deadline),
+                clients::dns::NotResolvedException);
+  // SRV names are not resolved as domain names
+  UEXPECT_THROW(resolver->Resolve("_http._tcp.service", test_deadline),
+                clients::dns::NotResolvedException);
+
+  const auto& counters = resolver->GetLookupSourceCounters();
+  EXPECT_EQ(counters.srv.cached, 1);
+  EXPECT_EQ(counters.srv.cached_stale, 0);
+  EXPECT_EQ(counters.srv.cached_failure, 1);
+  EXPECT_EQ(counters.srv.network, 1);
+  EXPECT_EQ(counters.srv.network_failure, 1);
+  EXPECT_EQ(counters.srv.prefetch, 0);
+  EXPECT_EQ(counters.cached, 0);
+  EXPECT_EQ(counters.network, 0);
+}
+
 USERVER_NAMESPACE_END
@@ -30,6 +30,13 @@ struct AddrinfoDeleter {
 };
 using AddrinfoPtr = std::unique_ptr<struct ares_addrinfo, AddrinfoDeleter>;
 
+struct SrvReplyDeleter {
+  void operator()(struct ares_srv_reply* reply) const noexcept {
+    ::ares_free_data(reply);
+  }
+};
+using SrvReplyPtr = std::unique_ptr<struct ares_srv_reply, SrvReplyDeleter>;
+
 }  // namespace clients::dns::impl
 
 USERVER_NAMESPACE_END
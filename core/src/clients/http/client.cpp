@@ -2,6 +2,8 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <iterator>
 #include <limits>
 
 #include <moodycamel/concurrentqueue.h>
@@ -15,11 +17,15 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/concurrency_limiter.hpp>
+#include <clients/http/connection_prewarmer.hpp>
+#include <clients/http/endpoint_balancer.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/openssl.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 #include <server/http/headers_propagator.hpp>
 
@@ -51,7 +57,16 @@ Client::Client(impl::ClientSettings settings,
                engine::TaskProcessor& fs_task_processor,
                impl::PluginPipeline&& plugin_pipeline)
     : deadline_propagation_config_(settings.deadline_propagation),
+      sticky_destinations_(settings.sticky_destinations),
       destination_statistics_(std::make_shared<DestinationStatistics>()),
+      endpoint_balancer_(std::make_shared<EndpointBalancer>()),
+      concurrency_limiters_(settings.concurrency_limit.enabled
+                                ? std::make_shared<ConcurrencyLimiters>(
+                                      settings.concurrency_limit)
+                                : nullptr),
+      tls_session_share_(settings.tls_session_cache
+                             ? std::make_shared<curl::share>()
+                             : nullptr),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
@@ -59,6 +74,8 @@ Client::Client(impl::ClientSettings settings,
       tracing_manager_(GetTracingManager(settings)),
       headers_propagator_(settings.headers_propagator),
       plugin_pipeline_(std::move(plugin_pipeline)) {
+  if (tls_session_share_) tls_session_share_->set_share_ssl_session(true);
+
   const auto io_threads = settings.io_threads;
   const auto& thread_name_prefix = settings.thread_name_prefix;
 
@@ -91,10 +108,19 @@ Client::Client(impl::ClientSettings settings,
       [this] { ReinitEasy(); });
 
   SetConfig({});
+
+  if (!settings.prewarm.destinations.empty()) {
+    prewarmer_ = std::make_unique<ConnectionPrewarmer>(
+        *this, std::move(settings.prewarm), *destination_statistics_);
+  }
 }
 
 Client::~Client() {
+  // Waits for the keep-alive requests
+  prewarmer_.reset();
   easy_reinit_task_.Stop();
+  // The queued requests fail right away instead of being sent
+  if (concurrency_limiters_) concurrency_limiters_->CancelQueueWaits();
 
   // We have to destroy *this only when all the requests are finished, because
   // otherwise `multis_` and `thread_pool_` are destroyed and pending requests
@@ -118,33 +144,68 @@ Client::~Client() {
 }
 
 Request Client::CreateRequest() {
-  auto request = [this] {
+  auto easy = TryDequeueIdle();
+  if (!easy) easy = std::move(CloneEasies(1).front());
+
+  auto request = MakeRequest(std::move(easy));
+  SetUpRequest(request);
+  return request;
+}
+
+std::vector<Request> Client::CreateRequests(std::size_t count) {
+  std::vector<std::shared_ptr<curl::easy>> easies;
+  easies.reserve(count);
+  while (easies.size() < count) {
     auto easy = TryDequeueIdle();
-    if (easy) {
-      auto idx = FindMultiIndex(easy->GetMulti());
-      auto wrapper =
-          std::make_shared<impl::EasyWrapper>(std::move(easy), *this);
-      return Request{std::move(wrapper), statistics_[idx].CreateRequestStats(),
-                     destination_statistics_, resolver_, plugin_pipeline_};
-    } else {
-      auto i = utils::RandRange(multis_.size());
-      auto& multi = multis_[i];
-
-      try {
-        auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                         return std::make_shared<impl::EasyWrapper>(
-                             easy_.Get()->GetBoundBlocking(*multi), *this);
-                       }).Get();
-        return Request{std::move(wrapper), statistics_[i].CreateRequestStats(),
-                       destination_statistics_, resolver_, plugin_pipeline_};
-      } catch (engine::WaitInterruptedException&) {
-        throw clients::http::CancelException();
-      } catch (engine::TaskCancelledException&) {
-        throw clients::http::CancelException();
-      }
-    }
-  }();
+    if (!easy) break;
+    easies.push_back(std::move(easy));
+  }
+  if (easies.size() < count) {
+    auto cloned = CloneEasies(count - easies.size());
+    std::move(cloned.begin(), cloned.end(), std::back_inserter(easies));
+  }
+
+  std::vector<Request> requests;
+  requests.reserve(count);
+  for (auto& easy : easies) {
+    requests.push_back(MakeRequest(std::move(easy)));
+    SetUpRequest(requests.back());
+  }
+  return requests;
+}
+
+std::vector<std::shared_ptr<curl::easy>> Client::CloneEasies(
+    std::size_t count) {
+  try {
+    return engine::AsyncNoSpan(fs_task_processor_, [this, count] {
+             std::vector<std::shared_ptr<curl::easy>> easies;
+             easies.reserve(count);
+             const auto easy = easy_.Get();
+             // The requests of a batch are spread over all the IO threads
+             auto i = utils::RandRange(multis_.size());
+             for (std::size_t n = 0; n < count; ++n) {
+               easies.push_back(easy->GetBoundBlocking(*multis_[i]));
+               i = (i + 1) % multis_.size();
+             }
+             return easies;
+           }).Get();
+  } catch (engine::WaitInterruptedException&) {
+    throw clients::http::CancelException();
+  } catch (engine::TaskCancelledException&) {
+    throw clients::http::CancelException();
+  }
+}
 
+Request Client::MakeRequest(std::shared_ptr<curl::easy>&& easy) {
+  const auto idx = FindMultiIndex(easy->GetMulti());
+  auto wrapper = std::make_shared<impl::EasyWrapper>(std::move(easy), *this);
+  // The idle handles were reset and forgot the share
+  wrapper->Easy().set_share(tls_session_share_);
+  return Request{std::move(wrapper), statistics_[idx].CreateRequestStats(),
+                 destination_statistics_, resolver_, plugin_pipeline_};
+}
+
+void Client::SetUpRequest(Request& request) {
   if (testsuite_config_) {
     request.SetTestsuiteConfig(testsuite_config_);
   }
@@ -153,6 +214,10 @@ Request Client::CreateRequest() {
 
   request.SetTracingManager(*tracing_manager_.GetBase());
   request.SetHeadersPropagator(headers_propagator_);
+  request.SetEndpointBalancer(endpoint_balancer_);
+  if (concurrency_limiters_) {
+    request.SetConcurrencyLimiters(concurrency_limiters_);
+  }
 
   if (user_agent_) {
     request.user_agent(*user_agent_);
@@ -165,8 +230,6 @@ Request Client::CreateRequest() {
     request.proxy(*proxy_value);
   }
   request.SetDeadlinePropagationConfig(deadline_propagation_config_);
-
-  return request;
 }
 
 void Client::SetMultiplexingEnabled(bool enabled) {
@@ -206,6 +269,11 @@ InstanceStatistics Client::GetMultiStatistics(size_t n) const {
   s.multi.socket_open = multi_stats.open_socket_total();
   s.multi.current_load = multi_stats.get_busy_storage().GetCurrentLoad();
   s.multi.socket_ratelimit = multi_stats.socket_ratelimited_total();
+  s.multi.transfers = multi_stats.transfer_total();
+  s.multi.reused_connections = multi_stats.reused_connection_total();
+  s.multi.tls_handshakes = multi_stats.tls_handshake_total();
+  s.multi.tls_resumed = multi_stats.tls_resumed_total();
+  s.multi.tls_handshake_time_us = multi_stats.tls_handshake_time_us_total();
   return s;
 }
 
@@ -234,6 +302,14 @@ const DestinationStatistics& Client::GetDestinationStatistics() const {
   return *destination_statistics_;
 }
 
+void Client::StartPrewarm() {
+  if (prewarmer_) prewarmer_->Start();
+}
+
+const ConcurrencyLimiters* Client::GetConcurrencyLimiters() const {
+  return concurrency_limiters_.get();
+}
+
 void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   try {
     easy->reset();
@@ -245,6 +321,13 @@ void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   DecPending();
 }
 
+curl::multi* Client::GetStickyMulti(
+    std::string_view host_port) const noexcept {
+  if (!sticky_destinations_ || multis_.empty()) return nullptr;
+  const auto idx = std::hash<std::string_view>{}(host_port) % multis_.size();
+  return multis_[idx].get();
+}
+
 std::shared_ptr<curl::easy> Client::TryDequeueIdle() noexcept {
   std::shared_ptr<curl::easy> result;
   if (!idle_queue_->try_dequeue(result)) {
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::unique_ptr<clients::http::Client> MakeClient() {
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 1;
+  return std::make_unique<clients::http::Client>(
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{});
+}
+
+}  // namespace
+
+// Fan-out with no idle connection handles, e.g. on a load burst
+void http_client_create_request_fanout(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto client = MakeClient();
+      std::vector<clients::http::Request> requests;
+      requests.reserve(count);
+      state.ResumeTiming();
+
+      for (std::size_t i = 0; i < count; ++i) {
+        requests.push_back(client->CreateRequest());
+      }
+
+      state.PauseTiming();
+      requests.clear();
+      client.reset();
+      state.ResumeTiming();
+    }
+  });
+}
+BENCHMARK(http_client_create_request_fanout)->Arg(50)->Arg(200);
+
+void http_client_create_requests_fanout(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto client = MakeClient();
+      state.ResumeTiming();
+
+      auto requests = client->CreateRequests(count);
+
+      state.PauseTiming();
+      requests.clear();
+      client.reset();
+      state.ResumeTiming();
+    }
+  });
+}
+BENCHMARK(http_client_create_requests_fanout)->Arg(50)->Arg(200);
+
+// Steady state, all the connection handles are reused
+void http_client_create_request_idle(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto client = MakeClient();
+    const auto count = static_cast<std::size_t>(state.range(0));
+    client->CreateRequests(count);
+
+    std::vector<clients::http::Request> requests;
+    requests.reserve(count);
+    for (auto _ : state) {
+      for (std::size_t i = 0; i < count; ++i) {
+        requests.push_back(client->CreateRequest());
+      }
+      requests.clear();
+    }
+  });
+}
+BENCHMARK(http_client_create_request_idle)->Arg(50)->Arg(200);
+
+void http_client_create_requests_idle(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto client = MakeClient();
+    const auto count = static_cast<std::size_t>(state.range(0));
+    client->CreateRequests(count);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(client->CreateRequests(count));
+    }
+  });
+}
+BENCHMARK(http_client_create_requests_idle)->Arg(50)->Arg(200);
+
+USERVER_NAMESPACE_END
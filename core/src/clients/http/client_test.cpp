@@ -7,10 +7,15 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/concurrency_limiter.hpp>
+#include <clients/http/destination_statistics.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
+#include <curl-ev/error_code.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/request_body_writer.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -19,9 +24,11 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/formats/json/parser/parser.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
@@ -256,6 +263,54 @@ struct AuthCallback {
   }
 };
 
+HttpResponse keep_alive_callback(const HttpRequest& request) {
+  if (request.find("\r\n\r\n") == std::string::npos) {
+    return {{}, HttpResponse::kTryReadMore};
+  }
+  return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+          HttpResponse::kWriteAndContinue};
+}
+
+// Responds with the decoded body once the whole body is received
+HttpResponse streamed_body_echo_callback(const HttpRequest& request) {
+  const auto headers_end = request.find("\r\n\r\n");
+  if (headers_end == std::string::npos) {
+    return {{}, HttpResponse::kTryReadMore};
+  }
+  const std::string_view body =
+      std::string_view{request}.substr(headers_end + 4);
+
+  std::string payload;
+  if (request.find("Transfer-Encoding: chunked") != std::string::npos) {
+    std::size_t pos = 0;
+    while (true) {
+      const auto size_end = body.find("\r\n", pos);
+      if (size_end == std::string::npos) {
+        return {{}, HttpResponse::kTryReadMore};
+      }
+      const auto size = std::stoul(
+          std::string{body.substr(pos, size_end - pos)}, nullptr, 16);
+      if (body.size() < size_end + 2 + size + 2) {
+        return {{}, HttpResponse::kTryReadMore};
+      }
+      if (size == 0) break;
+      payload.append(body.substr(size_end + 2, size));
+      pos = size_end + 2 + size + 2;
+    }
+  } else {
+    const auto length_pos = request.find("Content-Length: ");
+    EXPECT_NE(length_pos, std::string::npos) << request;
+    const auto length = std::stoul(request.substr(length_pos + 16));
+    if (body.size() < length) return {{}, HttpResponse::kTryReadMore};
+    payload = body;
+  }
+
+  return {
+      "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " +
+          std::to_string(payload.size()) + "\r\n\r\n" + payload,
+      HttpResponse::kWriteAndClose};
+}
+
 HttpResponse put_validate_callback(const HttpRequest& request) {
   LOG_INFO() << "HTTP Server receive: " << request;
 
@@ -612,6 +667,38 @@ UTEST(HttpClient, PostEcho) {
   }
 }
 
+UTEST(HttpClient, StreamedJsonBody) {
+  const utest::SimpleServer http_server{EchoCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  std::string json = "[";
+  for (int i = 0; i < 10000; ++i) json += std::to_string(i) + ",";
+  json.back() = ']';
+
+  auto queue = concurrent::StringStreamQueue::Create();
+  auto stream_response =
+      http_client_ptr->CreateRequest()
+          .post(http_server.GetBaseUrl(), json)
+          .http_version(clients::http::HttpVersion::k11)
+          .timeout(kTimeout)
+          .async_perform_stream_body(queue);
+  EXPECT_EQ(stream_response.StatusCode(), clients::http::Status::OK);
+
+  std::vector<int64_t> result;
+  formats::json::parser::Int64Parser int_parser;
+  formats::json::parser::ArrayParser<int64_t,
+                                     formats::json::parser::Int64Parser>
+      parser(int_parser);
+  formats::json::parser::SubscriberSink<std::vector<int64_t>> sink(result);
+  parser.Reset();
+  parser.Subscribe(sink);
+  stream_response.ReadJson(parser, engine::Deadline::FromDuration(kTimeout));
+
+  ASSERT_EQ(result.size(), 10000);
+  EXPECT_EQ(result.front(), 0);
+  EXPECT_EQ(result.back(), 9999);
+}
+
 UTEST(HttpClient, StatsOnTimeout) {
   const int kRetries = 5;
   const utest::SimpleServer http_server{&sleep_callback};
@@ -809,6 +896,77 @@ UTEST(HttpClient, PutEcho) {
   EXPECT_EQ(request.perform()->body(), kTestData);
 }
 
+UTEST(HttpClient, PostBodyStream) {
+  const utest::SimpleServer http_server{&streamed_body_echo_callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  // Each chunk is larger than the buffer, so the writer waits for the upload
+  constexpr std::size_t kMaxBufferedBytes = 1024;
+  const std::string chunk(kMaxBufferedBytes * 3, 'x');
+  constexpr unsigned kChunks = 16;
+
+  clients::http::RequestBodyWriter writer{kMaxBufferedBytes};
+  auto future = http_client_ptr->CreateRequest()
+                    .post(http_server.GetBaseUrl())
+                    .data_stream(writer)
+                    .http_version(clients::http::HttpVersion::k11)
+                    .timeout(kTimeout)
+                    .async_perform();
+
+  for (unsigned i = 0; i < kChunks; ++i) {
+    // Lets the upload run out of the data and pause
+    engine::SleepFor(std::chrono::milliseconds{1});
+    ASSERT_TRUE(writer.Write(chunk));
+  }
+  writer.Finish();
+
+  const auto response = future.Get();
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(response->body().size(), chunk.size() * kChunks);
+}
+
+UTEST(HttpClient, PutBodyStreamWithSize) {
+  const utest::SimpleServer http_server{&streamed_body_echo_callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::RequestBodyWriter writer;
+  auto future = http_client_ptr->CreateRequest()
+                    .data_stream(writer, std::string_view{kTestData}.size() * 2)
+                    .put()
+                    .url(http_server.GetBaseUrl())
+                    .http_version(clients::http::HttpVersion::k11)
+                    .timeout(kTimeout)
+                    .async_perform();
+
+  auto task = utils::Async("writer", [&writer] {
+    EXPECT_TRUE(writer.Write(kTestData));
+    EXPECT_TRUE(writer.Write(""));
+    EXPECT_TRUE(writer.Write(kTestData));
+    writer.Finish();
+  });
+
+  const auto response = future.Get();
+  task.Get();
+  EXPECT_EQ(response->body(), std::string{kTestData} + kTestData);
+}
+
+UTEST(HttpClient, BodyStreamWriteAfterResponse) {
+  const utest::SimpleServer http_server{EchoCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  // The server responds without waiting for the body
+  clients::http::RequestBodyWriter writer{1};
+  auto future = http_client_ptr->CreateRequest()
+                    .post(http_server.GetBaseUrl())
+                    .data_stream(writer)
+                    .http_version(clients::http::HttpVersion::k11)
+                    .timeout(kSmallTimeout)
+                    .async_perform();
+  future.Wait();
+
+  EXPECT_FALSE(writer.Write("data", engine::Deadline::FromDuration(kTimeout)));
+}
+
 UTEST(HttpClient, PutValidateHeader) {
   const utest::SimpleServer http_server{&put_validate_callback};
   auto http_client_ptr = utest::CreateHttpClient();
@@ -1451,6 +1609,28 @@ UTEST(HttpClient, RequestReuseSample) {
   EXPECT_EQ(*shared_echo_callback.responses_200, 2);
 }
 
+UTEST(HttpClient, TryPerform) {
+  EchoCallback echo_callback{};
+  const utest::SimpleServer http_server{echo_callback};
+  const utest::SimpleServer http_sleep_server{sleep_callback_1s};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  auto request = http_client_ptr->CreateRequest()
+                     .post(http_sleep_server.GetBaseUrl(), kTestData)
+                     .retry(1)
+                     .timeout(kSmallTimeout);
+
+  const auto failed = request.TryPerform();
+  ASSERT_FALSE(failed.has_value());
+  EXPECT_EQ(failed.error(), std::error_code{
+                                curl::errc::EasyErrorCode::kOperationTimedout});
+
+  request.url(http_server.GetBaseUrl());
+  const auto succeeded = request.TryPerform();
+  ASSERT_TRUE(succeeded.has_value());
+  EXPECT_EQ(succeeded.value()->body(), kTestData);
+}
+
 UTEST(HttpClient, DISABLED_RequestReuseSampleStream) {
   EchoCallback shared_echo_callback{};
   const utest::SimpleServer http_server{shared_echo_callback,
@@ -1563,6 +1743,159 @@ UTEST(HttpClient, TestConnectTo) {
   }
 }
 
+UTEST(HttpClient, StickyDestinations) {
+  const utest::SimpleServer http_server{&keep_alive_callback};
+
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 4;
+  settings.sticky_destinations = true;
+  clients::http::Client http_client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  // All the requests land on the same IO thread and reuse its connection
+  constexpr std::size_t kRequests = 16;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    const auto response = http_client.CreateRequest()
+                              .get(http_server.GetBaseUrl())
+                              .http_version(clients::http::HttpVersion::k11)
+                              .timeout(kTimeout)
+                              .perform();
+    EXPECT_TRUE(response->IsOk());
+  }
+
+  clients::http::MultiStats stats;
+  for (const auto& instance : http_client.GetPoolStatistics().multi) {
+    stats += instance.multi;
+  }
+  EXPECT_EQ(stats.transfers, kRequests);
+  EXPECT_EQ(stats.reused_connections, kRequests - 1);
+}
+
+UTEST(HttpClient, PrewarmConnections) {
+  const utest::SimpleServer http_server{&keep_alive_callback};
+
+  constexpr std::size_t kConnections = 3;
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 1;
+  settings.prewarm.destinations = {{http_server.GetBaseUrl(), kConnections}};
+  settings.prewarm.timeout = kTimeout;
+  settings.prewarm.keep_alive_interval = std::chrono::milliseconds{0};
+  clients::http::Client http_client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  http_client.StartPrewarm();
+  EXPECT_EQ(http_server.GetConnectionsOpenedCount(), kConnections);
+
+  const auto stats = http_client.GetDestinationStatistics()
+                         .GetPrewarmMap()
+                         .Get(USERVER_NAMESPACE::http::ExtractMetaTypeFromUrl(
+                             http_server.GetBaseUrl()));
+  ASSERT_TRUE(stats);
+  EXPECT_EQ(stats->warm_connections.load(), kConnections);
+  EXPECT_EQ(stats->attempts.Load().value, kConnections);
+  EXPECT_EQ(stats->failures.Load().value, 0u);
+
+  // The requests reuse the prewarmed connections
+  std::vector<clients::http::ResponseFuture> futures;
+  for (auto& request : http_client.CreateRequests(kConnections)) {
+    futures.push_back(request.get(http_server.GetBaseUrl())
+                          .http_version(clients::http::HttpVersion::k11)
+                          .timeout(kTimeout)
+                          .async_perform());
+  }
+  for (auto& future : futures) {
+    EXPECT_TRUE(future.Get()->IsOk());
+  }
+  EXPECT_EQ(http_server.GetConnectionsOpenedCount(), kConnections);
+}
+
+std::shared_ptr<clients::http::Client> CreateLimitedHttpClient(
+    std::chrono::milliseconds queue_timeout) {
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 1;
+  settings.concurrency_limit.enabled = true;
+  settings.concurrency_limit.initial_limit = 1;
+  settings.concurrency_limit.min_limit = 1;
+  settings.concurrency_limit.max_limit = 1;
+  settings.concurrency_limit.queue_timeout = queue_timeout;
+  return std::make_shared<clients::http::Client>(
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{});
+}
+
+clients::http::ResponseFuture StartLimitedRequest(
+    clients::http::Client& http_client, const utest::SimpleServer& server) {
+  return http_client.CreateRequest()
+      .get(server.GetBaseUrl())
+      .SetDestinationMetricName("limited")
+      .retry(1)
+      .http_version(clients::http::HttpVersion::k11)
+      .timeout(kTimeout)
+      .async_perform();
+}
+
+clients::http::ConcurrencyLimiter::Stats GetLimiterStats(
+    const clients::http::Client& http_client) {
+  const auto* limiters = http_client.GetConcurrencyLimiters();
+  for (const auto& [destination, limiter] : *limiters) {
+    if (destination == "limited") return limiter->GetStats();
+  }
+  ADD_FAILURE() << "No concurrency limiter of the destination";
+  return {};
+}
+
+UTEST(HttpClient, ConcurrencyLimitFailFast) {
+  const utest::SimpleServer http_server{&sleep_callback};
+  auto http_client_ptr = CreateLimitedHttpClient(std::chrono::milliseconds{0});
+
+  auto in_flight = StartLimitedRequest(*http_client_ptr, http_server);
+  auto rejected = StartLimitedRequest(*http_client_ptr, http_server);
+  UEXPECT_THROW(rejected.Get(), clients::http::NetworkProblemException);
+
+  const auto stats = GetLimiterStats(*http_client_ptr);
+  EXPECT_EQ(stats.rejected, 1);
+  EXPECT_EQ(stats.queued_total, 0);
+  EXPECT_EQ(stats.in_flight, 1);
+}
+
+UTEST(HttpClient, ConcurrencyLimitQueueTimeout) {
+  const utest::SimpleServer http_server{&sleep_callback};
+  auto http_client_ptr = CreateLimitedHttpClient(kSmallTimeout);
+
+  auto in_flight = StartLimitedRequest(*http_client_ptr, http_server);
+  auto queued = StartLimitedRequest(*http_client_ptr, http_server);
+  UEXPECT_THROW(queued.Get(), clients::http::NetworkProblemException);
+
+  const auto stats = GetLimiterStats(*http_client_ptr);
+  EXPECT_EQ(stats.rejected, 1);
+  EXPECT_EQ(stats.queued_total, 1);
+  EXPECT_EQ(stats.queued, 0);
+  // Only the request in flight has reached the server
+  EXPECT_LE(http_server.GetConnectionsOpenedCount(), 1);
+}
+
+UTEST(HttpClient, ConcurrencyLimitCancelQueued) {
+  const utest::SimpleServer http_server{&sleep_callback};
+  auto http_client_ptr = CreateLimitedHttpClient(kTimeout);
+
+  auto in_flight = StartLimitedRequest(*http_client_ptr, http_server);
+  auto queued = StartLimitedRequest(*http_client_ptr, http_server);
+  while (GetLimiterStats(*http_client_ptr).queued == 0) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+
+  // The wait for the slot stops without waiting for the queue timeout
+  queued.Cancel();
+  while (GetLimiterStats(*http_client_ptr).queued != 0) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  EXPECT_EQ(GetLimiterStats(*http_client_ptr).in_flight, 1);
+  // Only the request in flight has reached the server
+  EXPECT_LE(http_server.GetConnectionsOpenedCount(), 1);
+}
+
 UTEST(HttpClient, CheckSchema) {
   auto http_client_ptr = utest::CreateHttpClient();
   UEXPECT_NO_THROW(http_client_ptr->CreateRequest().url("http://localhost"));
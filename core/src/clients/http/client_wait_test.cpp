@@ -1,5 +1,8 @@
 #include <userver/clients/http/client.hpp>
 
+#include <algorithm>
+
+#include <userver/clients/http/response_batch.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
 
@@ -74,6 +77,10 @@ HttpResponse SleepCallback(const HttpRequest& request) {
   return SleepCallbackBase(request, utest::kMaxTestWaitTime);
 }
 
+HttpResponse ShortSleepCallback(const HttpRequest& request) {
+  return SleepCallbackBase(request, std::chrono::milliseconds{200});
+}
+
 /// [HTTP Client - waitany]
 std::size_t ProcessReadyRequests(
     std::vector<clients::http::ResponseFuture>& requests,
@@ -170,4 +177,36 @@ UTEST(HttpClient, WaitAnyMany) {
   EXPECT_EQ(processed, kRepetitions);
 }
 
+UTEST(HttpClient, ResponseBatch) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const utest::SimpleServer http_sleep_server{&ShortSleepCallback};
+  const utest::SimpleServer http_echo_server{&EchoSimpleCallback};
+
+  auto requests = http_client_ptr->CreateRequests(kRepetitions);
+  ASSERT_EQ(requests.size(), kRepetitions);
+  requests.front().post(http_sleep_server.GetBaseUrl(), kTestData);
+  for (std::size_t i = 1; i < requests.size(); ++i) {
+    requests[i].post(http_echo_server.GetBaseUrl(), kTestData);
+  }
+  for (auto& request : requests) {
+    request.retry(1)
+        .http_version(clients::http::HttpVersion::k11)
+        .timeout(utest::kMaxTestWaitTime);
+  }
+
+  clients::http::ResponseBatch batch{requests};
+  std::vector<std::size_t> indexes;
+  while (auto result = batch.GetNext()) {
+    EXPECT_TRUE(result->response->IsOk());
+    indexes.push_back(result->index);
+  }
+  EXPECT_EQ(batch.GetPendingCount(), 0);
+
+  ASSERT_EQ(indexes.size(), kRepetitions);
+  // The slow request is the last one to complete
+  EXPECT_EQ(indexes.back(), 0);
+  std::sort(indexes.begin(), indexes.end());
+  for (std::size_t i = 0; i < indexes.size(); ++i) EXPECT_EQ(indexes[i], i);
+}
+
 USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/testsuite/testsuite_support.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 
+#include <clients/http/concurrency_limiter.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
@@ -115,6 +116,9 @@ HttpClient::HttpClient(const ComponentConfig& component_config,
       std::move(stats_name), [this](utils::statistics::Writer& writer) {
         return WriteStatistics(writer);
       });
+
+  // After the DNS resolver, the proxy and the pool size are set
+  http_client_.StartPrewarm();
 }
 
 std::vector<utils::NotNull<clients::http::Plugin*>> HttpClient::FindPlugins(
@@ -146,6 +150,9 @@ void HttpClient::WriteStatistics(utils::statistics::Writer& writer) {
     DumpMetric(writer, http_client_.GetPoolStatistics());
   }
   DumpMetric(writer, http_client_.GetDestinationStatistics());
+  if (const auto* limiters = http_client_.GetConcurrencyLimiters()) {
+    DumpMetric(writer, *limiters);
+  }
 }
 
 yaml_config::Schema HttpClient::GetStaticConfigSchema() {
@@ -170,6 +177,68 @@ properties:
         type: boolean
         description: whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care
         defaultDescription: false
+    sticky-destinations:
+        type: boolean
+        description: whether to perform all the requests to the same host and port on the same IO thread, so that they reuse the connections of a single connection pool
+        defaultDescription: false
+    tls-session-cache:
+        type: boolean
+        description: whether to share the TLS sessions between the IO threads, so that the new connections to a known host resume the session with an abbreviated handshake
+        defaultDescription: true
+    concurrency-limit:
+        type: object
+        description: adaptive limit of the in-flight requests per destination, applies to the requests with destination metrics
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: whether to limit the in-flight requests
+                defaultDescription: false
+            initial-limit:
+                type: integer
+                description: limit to start with
+                defaultDescription: 20
+            min-limit:
+                type: integer
+                description: the limit never goes below this value
+                defaultDescription: 4
+            max-limit:
+                type: integer
+                description: the limit never goes above this value
+                defaultDescription: 1000
+            queue-timeout-ms:
+                type: integer
+                description: how long a request waits for a free slot, 0 to fail immediately
+                defaultDescription: 0
+    prewarm:
+        type: object
+        description: destinations to open the connections to at component start, before the traffic arrives
+        additionalProperties: false
+        properties:
+            destinations:
+                type: array
+                description: destinations to prewarm
+                items:
+                    type: object
+                    description: destination to prewarm
+                    additionalProperties: false
+                    properties:
+                        url:
+                            type: string
+                            description: URL to send the HEAD requests to, for example a health check handler
+                        connections:
+                            type: integer
+                            description: number of connections to open
+                            defaultDescription: 1
+                            minimum: 1
+            timeout:
+                type: string
+                description: timeout of the prewarm requests, the component start waits for at most that long
+                defaultDescription: 1s
+            keep-alive-interval:
+                type: string
+                description: how often to repeat the prewarm requests so that the connections are not closed as idle, 0 to only prewarm at start
+                defaultDescription: 30s
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
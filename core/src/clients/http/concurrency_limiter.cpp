@@ -0,0 +1,224 @@
+#include <clients/http/concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// Number of samples for the long-term and the recent response time EWMA
+constexpr double kLongWindow = 100;
+constexpr double kShortWindow = 10;
+
+// The recent response time may exceed the long-term one that much before
+// the limit starts to shrink
+constexpr double kTolerance = 1.5;
+
+// Weight of the newly computed limit
+constexpr double kSmoothing = 0.2;
+
+// The limit is cut by that ratio on each timeout or overload response
+constexpr double kBackoffRatio = 0.9;
+
+double UpdateEwma(double old, double sample, double window) {
+  return old == 0 ? sample : old + (sample - old) / window;
+}
+
+}  // namespace
+
+ConcurrencyLimiter::Slot::Slot(std::shared_ptr<ConcurrencyLimiter> limiter,
+                               std::size_t in_flight,
+                               Clock::time_point start_time)
+    : limiter_(std::move(limiter)),
+      in_flight_(in_flight),
+      start_time_(start_time) {
+  UASSERT(limiter_);
+}
+
+ConcurrencyLimiter::Slot::~Slot() {
+  if (limiter_) limiter_->Release(std::nullopt, in_flight_, false);
+}
+
+void ConcurrencyLimiter::Slot::Finish(bool is_overload, Clock::time_point now) {
+  UASSERT(limiter_);
+  auto limiter = std::move(limiter_);
+  limiter->Release(
+      std::chrono::duration_cast<std::chrono::microseconds>(now - start_time_),
+      in_flight_, is_overload);
+}
+
+ConcurrencyLimiter::ConcurrencyLimiter(
+    const impl::ConcurrencyLimitConfig& config)
+    : config_(config), limit_(static_cast<double>(config.initial_limit)) {
+  UASSERT(config_.min_limit > 0);
+  UASSERT(config_.min_limit <= config_.max_limit);
+}
+
+std::optional<ConcurrencyLimiter::Slot> ConcurrencyLimiter::TryAcquire() {
+  std::size_t in_flight = 0;
+  {
+    const std::lock_guard lock{mutex_};
+    if (!waiters_.empty() || in_flight_ >= static_cast<std::size_t>(limit_)) {
+      return std::nullopt;
+    }
+    in_flight = ++in_flight_;
+  }
+  return MakeSlot(in_flight);
+}
+
+std::optional<ConcurrencyLimiter::Slot> ConcurrencyLimiter::Acquire(
+    engine::Deadline deadline) {
+  Waiter waiter;
+  auto future = waiter.promise.get_future();
+  std::list<Waiter*>::iterator waiter_it;
+  {
+    const std::lock_guard lock{mutex_};
+    if (waiters_.empty() && in_flight_ < static_cast<std::size_t>(limit_)) {
+      const auto in_flight = ++in_flight_;
+      return MakeSlot(in_flight);
+    }
+    if (deadline.IsReached()) {
+      ++rejected_;
+      return std::nullopt;
+    }
+    waiter_it = waiters_.insert(waiters_.end(), &waiter);
+  }
+
+  ++queued_total_;
+  const auto queue_start = Clock::now();
+  const auto status = future.wait_until(deadline);
+  queue_time_us_total_ += std::chrono::duration_cast<std::chrono::microseconds>(
+                              Clock::now() - queue_start)
+                              .count();
+
+  if (status != engine::FutureStatus::kReady) {
+    const std::lock_guard lock{mutex_};
+    // The slot could have been handed over while we were waking up
+    if (!waiter.is_woken) {
+      waiters_.erase(waiter_it);
+      ++rejected_;
+      return std::nullopt;
+    }
+  }
+  return MakeSlot(waiter.in_flight);
+}
+
+ConcurrencyLimiter::Stats ConcurrencyLimiter::GetStats() const {
+  Stats stats;
+  {
+    const std::lock_guard lock{mutex_};
+    stats.limit = static_cast<std::size_t>(limit_);
+    stats.in_flight = in_flight_;
+    stats.queued = waiters_.size();
+  }
+  stats.rejected = rejected_.load();
+  stats.queued_total = queued_total_.load();
+  stats.queue_time_us_total = queue_time_us_total_.load();
+  return stats;
+}
+
+ConcurrencyLimiter::Slot ConcurrencyLimiter::MakeSlot(std::size_t in_flight) {
+  return Slot{shared_from_this(), in_flight, Clock::now()};
+}
+
+void ConcurrencyLimiter::Release(
+    std::optional<std::chrono::microseconds> response_time,
+    std::size_t in_flight_at_start, bool is_overload) {
+  const std::lock_guard lock{mutex_};
+  UASSERT(in_flight_ > 0);
+  --in_flight_;
+
+  if (is_overload) {
+    limit_ = std::max(static_cast<double>(config_.min_limit),
+                      limit_ * kBackoffRatio);
+  } else if (response_time) {
+    UpdateLimit(*response_time, in_flight_at_start);
+  }
+
+  WakeUpWaiters();
+}
+
+void ConcurrencyLimiter::UpdateLimit(std::chrono::microseconds response_time,
+                                     std::size_t in_flight_at_start) {
+  const auto sample = static_cast<double>(response_time.count() + 1);
+  long_response_time_us_ =
+      UpdateEwma(long_response_time_us_, sample, kLongWindow);
+  short_response_time_us_ =
+      UpdateEwma(short_response_time_us_, sample, kShortWindow);
+
+  // Lets the long-term estimate follow a faster upstream after an overload
+  if (long_response_time_us_ > 2 * short_response_time_us_) {
+    long_response_time_us_ *= 0.95;
+  }
+
+  // The requests of a mostly idle client tell nothing about the limit
+  if (static_cast<double>(in_flight_at_start) * 2 < limit_) return;
+
+  const double gradient = std::clamp(
+      kTolerance * long_response_time_us_ / short_response_time_us_, 0.5, 1.0);
+  const double new_limit = limit_ * gradient + std::sqrt(limit_);
+  limit_ = std::clamp(limit_ * (1 - kSmoothing) + new_limit * kSmoothing,
+                      static_cast<double>(config_.min_limit),
+                      static_cast<double>(config_.max_limit));
+}
+
+void ConcurrencyLimiter::WakeUpWaiters() {
+  while (!waiters_.empty() &&
+         in_flight_ < static_cast<std::size_t>(limit_)) {
+    auto* waiter = waiters_.front();
+    waiters_.pop_front();
+    waiter->in_flight = ++in_flight_;
+    waiter->is_woken = true;
+    // Under the lock, so that the timed out waiter does not leave before
+    waiter->promise.set_value();
+  }
+}
+
+ConcurrencyLimiters::ConcurrencyLimiters(
+    const impl::ConcurrencyLimitConfig& config)
+    : config_(config) {}
+
+std::shared_ptr<ConcurrencyLimiter> ConcurrencyLimiters::Get(
+    const std::string& destination) {
+  auto limiter = limiters_.Get(destination);
+  if (limiter) return limiter;
+  return limiters_.TryEmplace(destination, config_).value;
+}
+
+void ConcurrencyLimiters::DetachQueueWait(engine::Task&& task) {
+  queue_waits_.Detach(std::move(task));
+}
+
+void ConcurrencyLimiters::CancelQueueWaits() noexcept {
+  queue_waits_.CancelAndWait();
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConcurrencyLimiter::Stats& stats) {
+  writer["limit"] = stats.limit;
+  writer["in-flight"] = stats.in_flight;
+  writer["queued"] = stats.queued;
+  writer["rejected"] = stats.rejected;
+  writer["queue"]["total"] = stats.queued_total;
+  writer["queue"]["mean-time-us"] =
+      stats.queued_total ? stats.queue_time_us_total / stats.queued_total : 0;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConcurrencyLimiters& limiters) {
+  for (const auto& [destination, limiter] : limiters) {
+    writer["concurrency-limit"].ValueWithLabels(
+        limiter->GetStats(), {"http_destination", destination});
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <userver/clients/http/impl/config.hpp>
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Adaptive limit of the in-flight requests to a destination.
+///
+/// The limit follows the gradient of the response times: while the recent
+/// response time is close to the long-term one the limit grows, once the
+/// upstream slows down because of the queueing the limit shrinks. Timeouts
+/// and overload responses cut the limit right away.
+class ConcurrencyLimiter final
+    : public std::enable_shared_from_this<ConcurrencyLimiter> {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// A request in flight, releases its slot when finished or destroyed
+  class Slot final {
+   public:
+    Slot(std::shared_ptr<ConcurrencyLimiter> limiter, std::size_t in_flight,
+         Clock::time_point start_time);
+
+    Slot(Slot&&) noexcept = default;
+    Slot& operator=(Slot&&) = delete;
+    ~Slot();
+
+    /// `is_overload` is for the timeouts and overload responses, their
+    /// response times tell nothing about the upstream latency
+    void Finish(bool is_overload, Clock::time_point now = Clock::now());
+
+   private:
+    std::shared_ptr<ConcurrencyLimiter> limiter_;
+    std::size_t in_flight_;
+    Clock::time_point start_time_;
+  };
+
+  struct Stats {
+    std::size_t limit{0};
+    std::size_t in_flight{0};
+    std::size_t queued{0};
+    std::uint64_t rejected{0};
+    std::uint64_t queued_total{0};
+    std::uint64_t queue_time_us_total{0};
+  };
+
+  explicit ConcurrencyLimiter(const impl::ConcurrencyLimitConfig& config);
+
+  /// @returns std::nullopt if all the slots are taken
+  std::optional<Slot> TryAcquire();
+
+  /// @brief Waits in the queue for a free slot, coroutine context only.
+  /// @returns std::nullopt on deadline or cancellation
+  std::optional<Slot> Acquire(engine::Deadline deadline);
+
+  Stats GetStats() const;
+
+ private:
+  struct Waiter {
+    engine::Promise<void> promise;
+    // Set under the mutex once the slot is handed over
+    bool is_woken{false};
+    std::size_t in_flight{0};
+  };
+
+  Slot MakeSlot(std::size_t in_flight);
+  void Release(std::optional<std::chrono::microseconds> response_time,
+               std::size_t in_flight_at_start, bool is_overload);
+  void UpdateLimit(std::chrono::microseconds response_time,
+                   std::size_t in_flight_at_start);
+  void WakeUpWaiters();
+
+  const impl::ConcurrencyLimitConfig config_;
+
+  // Taken for a short time by the coroutines and the ev threads
+  mutable std::mutex mutex_;
+  double limit_;
+  double long_response_time_us_{0};
+  double short_response_time_us_{0};
+  std::size_t in_flight_{0};
+  std::list<Waiter*> waiters_;
+
+  std::atomic<std::uint64_t> rejected_{0};
+  std::atomic<std::uint64_t> queued_total_{0};
+  std::atomic<std::uint64_t> queue_time_us_total_{0};
+};
+
+/// Concurrency limiters of all the destinations of the client
+class ConcurrencyLimiters final {
+ public:
+  explicit ConcurrencyLimiters(const impl::ConcurrencyLimitConfig& config);
+
+  std::shared_ptr<ConcurrencyLimiter> Get(const std::string& destination);
+
+  std::chrono::milliseconds GetQueueTimeout() const noexcept {
+    return config_.queue_timeout;
+  }
+
+  /// Takes the task of a request waiting for a slot
+  void DetachQueueWait(engine::Task&& task);
+
+  /// Cancels the waits of the requests and waits for them to finish, called
+  /// once by the client destructor
+  void CancelQueueWaits() noexcept;
+
+  using LimitersMap = rcu::RcuMap<std::string, ConcurrencyLimiter>;
+
+  LimitersMap::ConstIterator begin() const { return limiters_.begin(); }
+  LimitersMap::ConstIterator end() const { return limiters_.end(); }
+
+ private:
+  const impl::ConcurrencyLimitConfig config_;
+  LimitersMap limiters_;
+  concurrent::BackgroundTaskStorageCore queue_waits_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConcurrencyLimiter::Stats& stats);
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConcurrencyLimiters& limiters);
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,128 @@
+#include <clients/http/concurrency_limiter.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::ConcurrencyLimiter;
+
+clients::http::impl::ConcurrencyLimitConfig MakeConfig(std::size_t limit) {
+  clients::http::impl::ConcurrencyLimitConfig config;
+  config.enabled = true;
+  config.initial_limit = limit;
+  config.min_limit = 2;
+  config.max_limit = 100;
+  return config;
+}
+
+std::vector<ConcurrencyLimiter::Slot> AcquireAll(ConcurrencyLimiter& limiter) {
+  std::vector<ConcurrencyLimiter::Slot> slots;
+  while (auto slot = limiter.TryAcquire()) slots.push_back(std::move(*slot));
+  return slots;
+}
+
+}  // namespace
+
+UTEST(ConcurrencyLimiter, TryAcquire) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(4));
+
+  auto slots = AcquireAll(*limiter);
+  EXPECT_EQ(slots.size(), 4);
+  EXPECT_EQ(limiter->GetStats().in_flight, 4);
+
+  slots.pop_back();
+  EXPECT_EQ(limiter->GetStats().in_flight, 3);
+  EXPECT_TRUE(limiter->TryAcquire());
+}
+
+UTEST(ConcurrencyLimiter, FailFast) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(4));
+  auto slots = AcquireAll(*limiter);
+
+  EXPECT_FALSE(limiter->Acquire(engine::Deadline::Passed()));
+  const auto stats = limiter->GetStats();
+  EXPECT_EQ(stats.rejected, 1);
+  EXPECT_EQ(stats.queued_total, 0);
+  // Does not change the limit
+  EXPECT_EQ(stats.limit, 4);
+}
+
+UTEST(ConcurrencyLimiter, Queue) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(4));
+  auto slots = AcquireAll(*limiter);
+
+  auto task = engine::AsyncNoSpan([&limiter] {
+    return limiter->Acquire(
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+  });
+  while (limiter->GetStats().queued == 0) engine::Yield();
+  // Queued requests go first
+  EXPECT_FALSE(limiter->TryAcquire());
+
+  slots.pop_back();
+  EXPECT_TRUE(task.Get());
+  const auto stats = limiter->GetStats();
+  EXPECT_EQ(stats.queued, 0);
+  EXPECT_EQ(stats.queued_total, 1);
+  EXPECT_EQ(stats.rejected, 0);
+}
+
+UTEST(ConcurrencyLimiter, QueueTimeout) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(4));
+  auto slots = AcquireAll(*limiter);
+
+  EXPECT_FALSE(limiter->Acquire(
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+  const auto stats = limiter->GetStats();
+  EXPECT_EQ(stats.queued, 0);
+  EXPECT_EQ(stats.rejected, 1);
+}
+
+UTEST(ConcurrencyLimiter, OverloadShrinks) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(10));
+
+  for (int i = 0; i < 10; ++i) {
+    auto slot = limiter->TryAcquire();
+    ASSERT_TRUE(slot);
+    slot->Finish(/*is_overload=*/true);
+  }
+  EXPECT_LT(limiter->GetStats().limit, 10);
+  EXPECT_GE(limiter->GetStats().limit, 2);
+}
+
+UTEST(ConcurrencyLimiter, StableLatencyGrows) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(4));
+
+  for (int i = 0; i < 20; ++i) {
+    auto slots = AcquireAll(*limiter);
+    const auto now = ConcurrencyLimiter::Clock::now();
+    for (auto& slot : slots) {
+      slot.Finish(/*is_overload=*/false, now + std::chrono::milliseconds{5});
+    }
+  }
+  const auto limit = limiter->GetStats().limit;
+  EXPECT_GT(limit, 4);
+  EXPECT_LE(limit, 100);
+}
+
+UTEST(ConcurrencyLimiter, IdleDoesNotGrow) {
+  auto limiter = std::make_shared<ConcurrencyLimiter>(MakeConfig(10));
+
+  for (int i = 0; i < 50; ++i) {
+    auto slot = limiter->TryAcquire();
+    ASSERT_TRUE(slot);
+    slot->Finish(/*is_overload=*/false);
+  }
+  EXPECT_EQ(limiter->GetStats().limit, 10);
+}
+
+USERVER_NAMESPACE_END
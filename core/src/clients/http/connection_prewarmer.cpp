@@ -0,0 +1,100 @@
+#include <clients/http/connection_prewarmer.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/http/url.hpp>
+#include <userver/logging/log.hpp>
+
+#include <clients/http/destination_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+ConnectionPrewarmer::ConnectionPrewarmer(
+    Client& client, impl::PrewarmConfig config,
+    DestinationStatistics& destination_statistics)
+    : client_(client), config_(std::move(config)) {
+  destinations_.reserve(config_.destinations.size());
+  for (const auto& destination : config_.destinations) {
+    // Same name as the one of the destination metrics of the requests
+    destinations_.push_back(
+        {destination,
+         destination_statistics.GetPrewarmStatistics(
+             USERVER_NAMESPACE::http::ExtractMetaTypeFromUrl(
+                 destination.url))});
+  }
+}
+
+ConnectionPrewarmer::~ConnectionPrewarmer() { keep_alive_task_.Stop(); }
+
+void ConnectionPrewarmer::Start() {
+  if (destinations_.empty()) return;
+
+  Prewarm();
+
+  if (config_.keep_alive_interval.count() == 0) return;
+  keep_alive_task_.Start(
+      "http_prewarm_keep_alive",
+      utils::PeriodicTask::Settings(config_.keep_alive_interval, {},
+                                    logging::Level::kDebug),
+      [this] { Prewarm(); });
+}
+
+void ConnectionPrewarmer::Prewarm() {
+  struct Round {
+    const Destination& destination;
+    std::vector<ResponseFuture> futures;
+    std::size_t failures{0};
+  };
+
+  std::vector<Round> rounds;
+  rounds.reserve(destinations_.size());
+
+  // All the requests are in flight at once, each of them opens a connection
+  // of its own unless a connection to the host is idle in the pool
+  for (const auto& destination : destinations_) {
+    auto& round = rounds.emplace_back(Round{destination, {}});
+    const auto connections = destination.config.connections;
+    destination.stats.attempts += utils::statistics::Rate{connections};
+    try {
+      auto requests = client_.CreateRequests(connections);
+      round.futures.reserve(requests.size());
+      for (auto& request : requests) {
+        round.futures.push_back(request.head(destination.config.url)
+                                    .timeout(config_.timeout)
+                                    .retry(1)
+                                    .async_perform());
+      }
+    } catch (const std::exception& e) {
+      LOG_WARNING() << "Failed to prewarm connections to "
+                    << destination.config.url << ": " << e;
+      round.failures = connections - round.futures.size();
+    }
+  }
+
+  for (auto& round : rounds) {
+    for (auto& future : round.futures) {
+      // Any response means that the connection was established
+      auto response = future.TryGet();
+      if (!response.has_value()) {
+        LOG_WARNING() << "Failed to prewarm a connection to "
+                      << round.destination.config.url << ": "
+                      << response.error().message();
+        ++round.failures;
+      }
+    }
+
+    const auto connections = round.destination.config.connections;
+    round.destination.stats.failures +=
+        utils::statistics::Rate{round.failures};
+    round.destination.stats.warm_connections = connections - round.failures;
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
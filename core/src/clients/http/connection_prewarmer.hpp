@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/impl/config.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Client;
+class DestinationStatistics;
+struct PrewarmStatistics;
+
+/// Opens the connections to the configured destinations before the traffic
+/// arrives and periodically sends requests over them, so that they are not
+/// closed as idle. The connect time and the TLS handshake are paid at start
+/// instead of by the first requests of the service.
+class ConnectionPrewarmer final {
+ public:
+  ConnectionPrewarmer(Client& client, impl::PrewarmConfig config,
+                      DestinationStatistics& destination_statistics);
+
+  ~ConnectionPrewarmer();
+
+  /// Prewarms the connections and starts the keep-alive task
+  void Start();
+
+  /// @brief Sends the requests to all the destinations at once and waits for
+  /// at most the prewarm timeout. Failures are logged and accounted in the
+  /// destination statistics.
+  void Prewarm();
+
+ private:
+  struct Destination {
+    impl::PrewarmDestination config;
+    PrewarmStatistics& stats;
+  };
+
+  Client& client_;
+  const impl::PrewarmConfig config_;
+  std::vector<Destination> destinations_;
+  utils::PeriodicTask keep_alive_task_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
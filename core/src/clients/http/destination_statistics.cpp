@@ -19,6 +19,13 @@ void DumpMetric(utils::statistics::Writer& writer,
 
 }  // namespace
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const PrewarmStatistics& stats) {
+  writer["warm-connections"] = stats.warm_connections.load();
+  writer["attempts"] = stats.attempts;
+  writer["failures"] = stats.failures;
+}
+
 std::shared_ptr<RequestStats>
 DestinationStatistics::GetStatisticsForDestination(
     const std::string& destination) {
@@ -79,6 +86,21 @@ void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
   max_auto_destinations_ = max_auto_destinations;
 }
 
+std::optional<std::chrono::milliseconds>
+DestinationStatistics::GetRecentTimingPercentile(const std::string& destination,
+                                                 double percent) const {
+  const auto stats = rcu_map_.Get(destination);
+  if (!stats) return std::nullopt;
+  return stats->GetRecentTimingPercentile(percent);
+}
+
+PrewarmStatistics& DestinationStatistics::GetPrewarmStatistics(
+    const std::string& destination) {
+  // Prewarm destinations come from the static config, the entries live as
+  // long as the client
+  return *prewarm_map_[destination];
+}
+
 DestinationStatistics::DestinationsMap::ConstIterator
 DestinationStatistics::begin() const {
   return rcu_map_.begin();
@@ -96,6 +118,9 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer.ValueWithLabels(FullInstanceStatisticsView{instance_stat},
                            {"http_destination", url});
   }
+  for (const auto& [url, stat_ptr] : stats.GetPrewarmMap()) {
+    writer["prewarm"].ValueWithLabels(*stat_ptr, {"http_destination", url});
+  }
 }
 
 }  // namespace clients::http
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 #include <clients/http/statistics.hpp>
 
@@ -12,6 +15,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 
+// Warmness of the connections that are opened before the traffic arrives
+struct PrewarmStatistics final {
+  // Connections that answered during the last prewarm round
+  std::atomic<std::size_t> warm_connections{0};
+  utils::statistics::RateCounter attempts;
+  utils::statistics::RateCounter failures;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const PrewarmStatistics& stats);
+
 class DestinationStatistics final {
  public:
   // Return pointer to related RequestStats
@@ -25,11 +39,22 @@ class DestinationStatistics final {
 
   void SetAutoMaxSize(size_t max_auto_destinations);
 
+  // Returns std::nullopt for unknown destinations and the ones without recent
+  // requests
+  std::optional<std::chrono::milliseconds> GetRecentTimingPercentile(
+      const std::string& destination, double percent) const;
+
+  // Returns statistics of the prewarmed connections to the destination
+  PrewarmStatistics& GetPrewarmStatistics(const std::string& destination);
+
   using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
+  using PrewarmMap = rcu::RcuMap<std::string, PrewarmStatistics>;
 
   DestinationsMap::ConstIterator begin() const;
   DestinationsMap::ConstIterator end() const;
 
+  const PrewarmMap& GetPrewarmMap() const { return prewarm_map_; }
+
  private:
   std::shared_ptr<RequestStats> GetExistingStatisticsForDestination(
       const std::string& destination);
@@ -38,6 +63,7 @@ class DestinationStatistics final {
       const std::string& destination);
 
   rcu::RcuMap<std::string, Statistics> rcu_map_;
+  PrewarmMap prewarm_map_;
   size_t max_auto_destinations_{0};
   std::atomic<size_t> current_auto_destinations_{0};
 };
@@ -4,6 +4,8 @@
 #include <userver/clients/http/response_future.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <curl-ev/url.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace clients::http::impl {
@@ -17,6 +19,27 @@ EasyWrapper::~EasyWrapper() { client_.PushIdleEasy(std::move(easy_)); }
 
 curl::easy& EasyWrapper::Easy() { return *easy_; }
 
+void EasyWrapper::BindToStickyMulti(std::string_view proxy_url) {
+  if (!client_.sticky_destinations_) return;
+
+  std::string host_port{proxy_url};
+  if (host_port.empty()) {
+    const auto& url = easy_->get_easy_url();
+    std::error_code ec;
+    const auto host = url.GetHostPtr(ec);
+    if (ec || !host) return;
+    host_port = host.get();
+    const auto port = url.GetPortPtr(ec);
+    if (!ec && port) {
+      host_port += ':';
+      host_port += port.get();
+    }
+  }
+
+  auto* multi = client_.GetStickyMulti(host_port);
+  if (multi && multi != easy_->GetMulti()) easy_->rebind(*multi);
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <string_view>
 
 #include <curl-ev/easy.hpp>
 
@@ -25,6 +27,11 @@ class EasyWrapper final {
 
   curl::easy& Easy();
 
+  /// Moves the handle to the IO thread of the destination (the proxy if any)
+  /// if the client routes destinations to sticky threads. Must not be called
+  /// while the handle is performed.
+  void BindToStickyMulti(std::string_view proxy_url);
+
  private:
   std::shared_ptr<curl::easy> easy_;
   Client& client_;
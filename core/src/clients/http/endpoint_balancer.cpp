@@ -0,0 +1,136 @@
+#include <clients/http/endpoint_balancer.hpp>
+
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// Weight of the previous latency in EWMA is (kEwmaDivisor - 1) / kEwmaDivisor
+constexpr std::int64_t kEwmaDivisor = 8;
+
+std::uint64_t Score(const EndpointBalancer::EndpointStats& stats) {
+  const auto in_flight = stats.in_flight.load(std::memory_order_relaxed);
+  const auto latency = stats.latency_ewma_us.load(std::memory_order_relaxed);
+  return (in_flight + 1) * static_cast<std::uint64_t>(latency + 1);
+}
+
+}  // namespace
+
+EndpointBalancer::Attempt::Attempt(std::shared_ptr<EndpointStats> stats,
+                                   std::string address,
+                                   Clock::time_point start_time)
+    : stats_(std::move(stats)),
+      address_(std::move(address)),
+      start_time_(start_time) {
+  UASSERT(stats_);
+  ++stats_->in_flight;
+}
+
+EndpointBalancer::Attempt::~Attempt() {
+  if (stats_) --stats_->in_flight;
+}
+
+void EndpointBalancer::Attempt::Finish(bool is_failure, Clock::time_point now) {
+  UASSERT(stats_);
+  auto stats = std::move(stats_);
+  --stats->in_flight;
+
+  if (is_failure) {
+    const auto failures = ++stats->consecutive_failures;
+    if (failures >= kEjectionConsecutiveFailures) {
+      stats->ejected_until = (now + kEjectionTime).time_since_epoch().count();
+      stats->consecutive_failures = 0;
+    }
+    return;
+  }
+
+  stats->consecutive_failures = 0;
+  const std::int64_t latency =
+      std::chrono::duration_cast<std::chrono::microseconds>(now - start_time_)
+          .count();
+  // Concurrent updates may be lost, that only slows down the convergence
+  const auto old = stats->latency_ewma_us.load(std::memory_order_relaxed);
+  const auto updated =
+      old == 0 ? latency : old + (latency - old) / kEwmaDivisor;
+  stats->latency_ewma_us.store(updated, std::memory_order_relaxed);
+}
+
+EndpointBalancer::Attempt EndpointBalancer::Pick(
+    const std::string& host_port, const std::vector<std::string>& addresses,
+    LoadBalancing policy, Clock::time_point now) {
+  UASSERT(!addresses.empty());
+  UASSERT(policy != LoadBalancing::kNone);
+
+  const auto now_rep = now.time_since_epoch().count();
+  std::vector<std::shared_ptr<EndpointStats>> endpoints;
+  endpoints.reserve(addresses.size());
+  std::vector<std::size_t> healthy;
+  healthy.reserve(addresses.size());
+  for (const auto& address : addresses) {
+    const auto key = host_port + '/' + address;
+    auto stats = endpoints_.Get(key);
+    if (!stats) stats = endpoints_.Emplace(key).value;
+    if (stats->ejected_until.load(std::memory_order_relaxed) <= now_rep) {
+      healthy.push_back(endpoints.size());
+    }
+    endpoints.push_back(std::move(stats));
+  }
+
+  if (healthy.empty()) {
+    // Ejecting all the endpoints leaves nothing to recover
+    for (std::size_t i = 0; i < endpoints.size(); ++i) healthy.push_back(i);
+  }
+
+  const auto index = PickIndex(endpoints, healthy, policy);
+  return Attempt{std::move(endpoints[index]), addresses[index], now};
+}
+
+std::size_t EndpointBalancer::PickIndex(
+    const std::vector<std::shared_ptr<EndpointStats>>& endpoints,
+    const std::vector<std::size_t>& healthy, LoadBalancing policy) {
+  switch (policy) {
+    case LoadBalancing::kRoundRobin:
+      return healthy[round_robin_counter_++ % healthy.size()];
+
+    case LoadBalancing::kLeastRequests: {
+      // Starts from a random endpoint to spread the ties
+      const auto offset = utils::RandRange(healthy.size());
+      auto best = healthy[offset];
+      auto best_in_flight = std::numeric_limits<std::size_t>::max();
+      for (std::size_t i = 0; i < healthy.size(); ++i) {
+        const auto index = healthy[(offset + i) % healthy.size()];
+        const auto in_flight = endpoints[index]->in_flight.load();
+        if (in_flight < best_in_flight) {
+          best = index;
+          best_in_flight = in_flight;
+        }
+      }
+      return best;
+    }
+
+    case LoadBalancing::kPowerOfTwoChoices: {
+      if (healthy.size() == 1) return healthy.front();
+      const auto first = utils::RandRange(healthy.size());
+      auto second = utils::RandRange(healthy.size() - 1);
+      if (second >= first) ++second;
+      const auto lhs = healthy[first];
+      const auto rhs = healthy[second];
+      return Score(*endpoints[lhs]) <= Score(*endpoints[rhs]) ? lhs : rhs;
+    }
+
+    case LoadBalancing::kNone:
+      break;
+  }
+
+  UINVARIANT(false, "Unexpected load balancing policy");
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Picks one of the resolved addresses of a host for a request, the addresses
+/// are tracked across all the requests of the client
+class EndpointBalancer final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Endpoints with that many failures in a row are not picked for
+  /// kEjectionTime unless all the endpoints of the host are ejected
+  static constexpr std::size_t kEjectionConsecutiveFailures = 5;
+  static constexpr std::chrono::seconds kEjectionTime{10};
+
+  struct EndpointStats {
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::int64_t> latency_ewma_us{0};
+    std::atomic<std::size_t> consecutive_failures{0};
+    std::atomic<Clock::rep> ejected_until{0};
+  };
+
+  /// Request attempt to the picked endpoint, accounted as in flight until
+  /// finished or destroyed
+  class Attempt final {
+   public:
+    Attempt(std::shared_ptr<EndpointStats> stats, std::string address,
+            Clock::time_point start_time);
+
+    Attempt(Attempt&&) noexcept = default;
+    Attempt& operator=(Attempt&&) = delete;
+    ~Attempt();
+
+    const std::string& GetAddress() const noexcept { return address_; }
+
+    /// `is_failure` is for the network errors and 5xx responses
+    void Finish(bool is_failure, Clock::time_point now = Clock::now());
+
+   private:
+    std::shared_ptr<EndpointStats> stats_;
+    std::string address_;
+    Clock::time_point start_time_;
+  };
+
+  /// `addresses` of `host_port` must not be empty, `policy` must not be
+  /// LoadBalancing::kNone
+  Attempt Pick(const std::string& host_port,
+               const std::vector<std::string>& addresses, LoadBalancing policy,
+               Clock::time_point now = Clock::now());
+
+ private:
+  std::size_t PickIndex(
+      const std::vector<std::shared_ptr<EndpointStats>>& endpoints,
+      const std::vector<std::size_t>& healthy, LoadBalancing policy);
+
+  // "host:port/address"
+  rcu::RcuMap<std::string, EndpointStats> endpoints_;
+  std::atomic<std::size_t> round_robin_counter_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
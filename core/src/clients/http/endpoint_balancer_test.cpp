@@ -0,0 +1,109 @@
+#include <clients/http/endpoint_balancer.hpp>
+
+#include <optional>
+#include <set>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::EndpointBalancer;
+using clients::http::LoadBalancing;
+
+const std::string kHostPort = "example.com:80";
+const std::vector<std::string> kAddresses{"10.0.0.1", "10.0.0.2",
+                                          "10.0.0.3"};
+
+}  // namespace
+
+UTEST(EndpointBalancer, RoundRobin) {
+  EndpointBalancer balancer;
+
+  std::set<std::string> picked;
+  for (std::size_t i = 0; i < kAddresses.size(); ++i) {
+    picked.insert(
+        balancer.Pick(kHostPort, kAddresses, LoadBalancing::kRoundRobin)
+            .GetAddress());
+  }
+  EXPECT_EQ(picked.size(), kAddresses.size());
+}
+
+UTEST(EndpointBalancer, LeastRequests) {
+  EndpointBalancer balancer;
+
+  std::vector<EndpointBalancer::Attempt> in_flight;
+  std::set<std::string> picked;
+  for (std::size_t i = 0; i < kAddresses.size(); ++i) {
+    in_flight.push_back(
+        balancer.Pick(kHostPort, kAddresses, LoadBalancing::kLeastRequests));
+    picked.insert(in_flight.back().GetAddress());
+  }
+  EXPECT_EQ(picked.size(), kAddresses.size());
+
+  const auto finished_address = in_flight[1].GetAddress();
+  in_flight[1].Finish(false);
+  EXPECT_EQ(
+      balancer.Pick(kHostPort, kAddresses, LoadBalancing::kLeastRequests)
+          .GetAddress(),
+      finished_address);
+}
+
+UTEST(EndpointBalancer, PowerOfTwoChoicesPrefersFaster) {
+  EndpointBalancer balancer;
+  const std::vector<std::string> addresses{"10.0.0.1", "10.0.0.2"};
+  auto now = EndpointBalancer::Clock::now();
+
+  for (const auto& [index, latency] :
+       {std::pair{0, std::chrono::milliseconds{100}},
+        std::pair{1, std::chrono::milliseconds{1}}}) {
+    const std::vector<std::string> single{addresses[index]};
+    auto attempt =
+        balancer.Pick(kHostPort, single, LoadBalancing::kRoundRobin, now);
+    attempt.Finish(false, now + latency);
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer
+                  .Pick(kHostPort, addresses,
+                        LoadBalancing::kPowerOfTwoChoices, now)
+                  .GetAddress(),
+              addresses[1]);
+  }
+}
+
+UTEST(EndpointBalancer, Ejection) {
+  EndpointBalancer balancer;
+  const auto now = EndpointBalancer::Clock::now();
+  const std::vector<std::string> failing{kAddresses[0]};
+
+  for (std::size_t i = 0; i < EndpointBalancer::kEjectionConsecutiveFailures;
+       ++i) {
+    balancer.Pick(kHostPort, failing, LoadBalancing::kRoundRobin, now)
+        .Finish(true, now);
+  }
+
+  for (std::size_t i = 0; i < 2 * kAddresses.size(); ++i) {
+    EXPECT_NE(balancer
+                  .Pick(kHostPort, kAddresses, LoadBalancing::kRoundRobin, now)
+                  .GetAddress(),
+              kAddresses[0]);
+  }
+
+  // The only endpoint is picked even if ejected
+  EXPECT_EQ(balancer.Pick(kHostPort, failing, LoadBalancing::kRoundRobin, now)
+                .GetAddress(),
+            kAddresses[0]);
+
+  const auto later = now + EndpointBalancer::kEjectionTime;
+  std::set<std::string> picked;
+  for (std::size_t i = 0; i < kAddresses.size(); ++i) {
+    picked.insert(
+        balancer.Pick(kHostPort, kAddresses, LoadBalancing::kRoundRobin, later)
+            .GetAddress());
+  }
+  EXPECT_EQ(picked.size(), kAddresses.size());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,136 @@
+#include <userver/clients/http/hedging.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <clients/http/destination_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::int64_t kBudgetUnit = 1000;
+
+bool IsSuccess(const Response& response) {
+  return static_cast<int>(response.status_code()) < 500;
+}
+
+}  // namespace
+
+HedgingPolicy::HedgingPolicy(HedgingSettings settings)
+    : HedgingPolicy(settings, nullptr, {}) {}
+
+HedgingPolicy::HedgingPolicy(HedgingSettings settings, const Client& client,
+                             std::string destination)
+    : HedgingPolicy(settings, &client, std::move(destination)) {}
+
+HedgingPolicy::HedgingPolicy(HedgingSettings settings, const Client* client,
+                             std::string destination)
+    : settings_(settings),
+      client_(client),
+      destination_(std::move(destination)),
+      budget_(static_cast<std::int64_t>(settings_.max_budget) * kBudgetUnit) {
+  UINVARIANT(settings_.max_attempts >= 1, "max_attempts must be positive");
+}
+
+std::chrono::milliseconds HedgingPolicy::GetDelay() const {
+  if (settings_.delay_percentile && client_) {
+    const auto percentile =
+        client_->GetDestinationStatistics().GetRecentTimingPercentile(
+            destination_, *settings_.delay_percentile);
+    if (percentile) return *percentile;
+  }
+  return settings_.delay;
+}
+
+std::shared_ptr<Response> HedgingPolicy::Perform(
+    const std::function<Request()>& create_request) {
+  FillBudget();
+
+  const auto delay = GetDelay();
+  const auto task_deadline = server::request::GetTaskInheritedDeadline();
+
+  std::vector<ResponseFuture> attempts;
+  attempts.reserve(settings_.max_attempts);
+  attempts.push_back(create_request().async_perform());
+  std::size_t pending_attempts = 1;
+  bool may_hedge = attempts.size() < settings_.max_attempts;
+  auto hedge_deadline = engine::Deadline::FromDuration(delay);
+
+  std::shared_ptr<Response> last_response;
+  std::exception_ptr last_error;
+  while (pending_attempts > 0) {
+    const auto index = engine::WaitAnyUntil(
+        may_hedge ? hedge_deadline : engine::Deadline{}, attempts);
+
+    if (!index) {
+      if (engine::current_task::ShouldCancel()) {
+        throw CancelException(
+            "HTTP response wait was aborted due to task cancellation", {});
+      }
+      // The attempts in flight are slow, hedging
+      if (task_deadline.IsReached() || !TryConsumeBudget()) {
+        may_hedge = false;
+        continue;
+      }
+      attempts.push_back(create_request().async_perform());
+      ++pending_attempts;
+      may_hedge = attempts.size() < settings_.max_attempts;
+      hedge_deadline = engine::Deadline::FromDuration(delay);
+      continue;
+    }
+
+    --pending_attempts;
+    try {
+      auto response = attempts[*index].Get();
+      // The other attempts are cancelled by ~ResponseFuture
+      if (IsSuccess(*response)) return response;
+      last_response = std::move(response);
+    } catch (const BaseException&) {
+      last_error = std::current_exception();
+    }
+  }
+
+  if (last_response) return last_response;
+  UASSERT(last_error);
+  std::rethrow_exception(last_error);
+}
+
+void HedgingPolicy::FillBudget() noexcept {
+  const auto max_budget =
+      static_cast<std::int64_t>(settings_.max_budget) * kBudgetUnit;
+  const auto fill = static_cast<std::int64_t>(
+      settings_.budget_ratio * static_cast<double>(kBudgetUnit));
+  auto budget = budget_.load();
+  while (budget < max_budget &&
+         !budget_.compare_exchange_weak(budget,
+                                        std::min(budget + fill, max_budget))) {
+  }
+}
+
+bool HedgingPolicy::TryConsumeBudget() noexcept {
+  auto budget = budget_.load();
+  while (budget >= kBudgetUnit) {
+    if (budget_.compare_exchange_weak(budget, budget - kBudgetUnit)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <userver/clients/http/hedging.hpp>
+
+#include <atomic>
+#include <memory>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::chrono::milliseconds kHedgingDelay{50};
+
+// The first request hangs, the others are answered at once
+struct FirstHangsCallback {
+  HttpResponse operator()(const HttpRequest&) const {
+    if ((*requests)++ == 0) {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    }
+    return {
+        "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 2\r\n\r\nok",
+        HttpResponse::kWriteAndClose};
+  }
+
+  std::shared_ptr<std::atomic<int>> requests =
+      std::make_shared<std::atomic<int>>(0);
+};
+
+clients::http::HedgingSettings MakeSettings() {
+  clients::http::HedgingSettings settings;
+  settings.delay = kHedgingDelay;
+  return settings;
+}
+
+}  // namespace
+
+UTEST(HttpClientHedging, HedgedAttemptWins) {
+  const FirstHangsCallback callback;
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+  clients::http::HedgingPolicy policy{MakeSettings()};
+
+  const auto response = policy.Perform([&] {
+    return http_client_ptr->CreateRequest()
+        .get(http_server.GetBaseUrl())
+        .timeout(utest::kMaxTestWaitTime);
+  });
+
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(response->body(), "ok");
+  EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClientHedging, NoHedgingForFastResponses) {
+  const FirstHangsCallback callback;
+  // Answers the first request at once
+  *callback.requests = 1;
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+  clients::http::HedgingPolicy policy{MakeSettings()};
+
+  const auto response = policy.Perform([&] {
+    return http_client_ptr->CreateRequest()
+        .get(http_server.GetBaseUrl())
+        .timeout(utest::kMaxTestWaitTime);
+  });
+
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClientHedging, Budget) {
+  const FirstHangsCallback callback;
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+  auto settings = MakeSettings();
+  settings.max_budget = 0;
+  clients::http::HedgingPolicy policy{settings};
+
+  const auto create_request = [&] {
+    return http_client_ptr->CreateRequest()
+        .get(http_server.GetBaseUrl())
+        .timeout(kHedgingDelay * 4);
+  };
+  EXPECT_THROW(policy.Perform(create_request),
+               clients::http::TimeoutException);
+  EXPECT_EQ(*callback.requests, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <userver/clients/http/impl/config.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
@@ -37,8 +40,53 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(
   return result;
 }
 
+ConcurrencyLimitConfig ParseConcurrencyLimitConfig(
+    const yaml_config::YamlConfig& value) {
+  ConcurrencyLimitConfig result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.initial_limit =
+      value["initial-limit"].As<std::size_t>(result.initial_limit);
+  result.min_limit = value["min-limit"].As<std::size_t>(result.min_limit);
+  result.max_limit = value["max-limit"].As<std::size_t>(result.max_limit);
+  result.queue_timeout = std::chrono::milliseconds{
+      value["queue-timeout-ms"].As<std::int64_t>(result.queue_timeout.count())};
+
+  if (result.min_limit == 0 || result.min_limit > result.max_limit) {
+    throw std::runtime_error(
+        "Invalid concurrency-limit: min-limit should be positive and not "
+        "greater than max-limit");
+  }
+  result.initial_limit =
+      std::clamp(result.initial_limit, result.min_limit, result.max_limit);
+  return result;
+}
+
+PrewarmConfig ParsePrewarmConfig(const yaml_config::YamlConfig& value) {
+  PrewarmConfig result;
+  result.destinations =
+      value["destinations"].As<std::vector<PrewarmDestination>>({});
+  result.timeout =
+      value["timeout"].As<std::chrono::milliseconds>(result.timeout);
+  result.keep_alive_interval =
+      value["keep-alive-interval"].As<std::chrono::milliseconds>(
+          result.keep_alive_interval);
+  return result;
+}
+
 }  // namespace
 
+PrewarmDestination Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<PrewarmDestination>) {
+  PrewarmDestination result;
+  result.url = value["url"].As<std::string>();
+  result.connections = value["connections"].As<std::size_t>(result.connections);
+  if (result.connections == 0) {
+    throw std::runtime_error("Invalid prewarm destination '" + result.url +
+                             "': connections should be positive");
+  }
+  return result;
+}
+
 ClientSettings Parse(const yaml_config::YamlConfig& value,
                      formats::parse::To<ClientSettings>) {
   ClientSettings result;
@@ -46,7 +94,14 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
       value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
+  result.sticky_destinations =
+      value["sticky-destinations"].As<bool>(result.sticky_destinations);
+  result.tls_session_cache =
+      value["tls-session-cache"].As<bool>(result.tls_session_cache);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.concurrency_limit =
+      ParseConcurrencyLimitConfig(value["concurrency-limit"]);
+  result.prewarm = ParsePrewarmConfig(value["prewarm"]);
   return result;
 }
 
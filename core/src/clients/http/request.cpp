@@ -10,6 +10,7 @@
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
+#include <userver/clients/http/request_body_writer.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -242,6 +243,11 @@ std::shared_ptr<Response> Request::perform(
   return async_perform(location).Get();
 }
 
+utils::expected<std::shared_ptr<Response>, std::error_code>
+Request::TryPerform(utils::impl::SourceLocation location) {
+  return async_perform(location).TryGet();
+}
+
 Request& Request::url(const std::string& url) & {
   if (!IsAllowedSchemaInUrl(url)) {
     throw BadArgumentException(curl::errc::EasyErrorCode::kUnsupportedProtocol,
@@ -352,6 +358,14 @@ Request Request::connect_to(const ConnectTo& connect_to) && {
   return std::move(this->connect_to(connect_to));
 }
 
+Request& Request::load_balancing(LoadBalancing policy) & {
+  pimpl_->load_balancing(policy);
+  return *this;
+}
+Request Request::load_balancing(LoadBalancing policy) && {
+  return std::move(this->load_balancing(policy));
+}
+
 Request& Request::data(std::string data) & {
   if (!data.empty())
     pimpl_->easy().add_header(kHeaderExpect, "",
@@ -363,6 +377,19 @@ Request Request::data(std::string data) && {
   return std::move(this->data(std::move(data)));
 }
 
+Request& Request::data_stream(const RequestBodyWriter& writer,
+                              std::optional<std::size_t> size) & {
+  UINVARIANT(writer.stream_, "data_stream() of a moved out writer");
+  pimpl_->data_stream(writer.stream_, size);
+  pimpl_->easy().add_header(kHeaderExpect, "",
+                            curl::easy::EmptyHeaderAction::kDoNotSend);
+  return *this;
+}
+Request Request::data_stream(const RequestBodyWriter& writer,
+                             std::optional<std::size_t> size) && {
+  return std::move(this->data_stream(writer, size));
+}
+
 Request& Request::form(const Form& form) & {
   pimpl_->easy().set_http_post(form.GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
@@ -488,7 +515,9 @@ Request& Request::method(HttpMethod method) & {
     case HttpMethod::kPatch:
       pimpl_->easy().set_custom_request(ToString(method));
       // ensure a body as we should send Content-Length for this method
-      if (!pimpl_->easy().has_post_data()) data({});
+      if (!pimpl_->easy().has_post_data() && !pimpl_->HasBodyStream()) {
+        data({});
+      }
       break;
   };
   return *this;
@@ -633,6 +662,16 @@ void Request::SetHeadersPropagator(
   pimpl_->SetHeadersPropagator(headers_propagator);
 }
 
+void Request::SetEndpointBalancer(
+    std::shared_ptr<EndpointBalancer> balancer) & {
+  pimpl_->SetEndpointBalancer(std::move(balancer));
+}
+
+void Request::SetConcurrencyLimiters(
+    std::shared_ptr<ConcurrencyLimiters> limiters) & {
+  pimpl_->SetConcurrencyLimiters(std::move(limiters));
+}
+
 const std::string& Request::GetUrl() const& {
   return pimpl_->easy().get_original_url();
 }
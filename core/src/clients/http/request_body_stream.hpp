@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <userver/concurrent/queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+/// Shared state of a RequestBodyWriter and the request that sends its chunks
+struct RequestBodyStream final {
+  using Queue = concurrent::StringStreamQueue;
+
+  explicit RequestBodyStream(std::size_t max_buffered_bytes)
+      : queue(Queue::Create(max_buffered_bytes)) {}
+
+  std::shared_ptr<Queue> queue;
+  /// set by the curl read callback that ran out of chunks, the writer resumes
+  /// the transfer after pushing the next chunk or finishing the body
+  std::atomic<bool> is_paused{false};
+  /// set by the request before the chunks are written
+  std::function<void()> resume;
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#include <userver/clients/http/request_body_writer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <clients/http/request_body_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+RequestBodyWriter::RequestBodyWriter(std::size_t max_buffered_bytes)
+    : stream_(std::make_shared<impl::RequestBodyStream>(max_buffered_bytes)),
+      producer_(stream_->queue->GetProducer()),
+      max_chunk_size_(std::max<std::size_t>(max_buffered_bytes, 1)) {}
+
+RequestBodyWriter::RequestBodyWriter(RequestBodyWriter&& other) noexcept
+    : stream_(std::move(other.stream_)),
+      producer_(std::exchange(other.producer_, std::nullopt)),
+      max_chunk_size_(other.max_chunk_size_) {}
+
+RequestBodyWriter& RequestBodyWriter::operator=(
+    RequestBodyWriter&& other) noexcept {
+  if (this != &other) {
+    Finish();
+    stream_ = std::move(other.stream_);
+    producer_ = std::exchange(other.producer_, std::nullopt);
+    max_chunk_size_ = other.max_chunk_size_;
+  }
+  return *this;
+}
+
+RequestBodyWriter::~RequestBodyWriter() { Finish(); }
+
+bool RequestBodyWriter::Write(std::string chunk, engine::Deadline deadline) {
+  if (!producer_) return false;
+  // An empty chunk would end the body for curl
+  if (chunk.empty()) return true;
+
+  // Larger chunks would never fit the queue
+  while (chunk.size() > max_chunk_size_) {
+    if (!Push(chunk.substr(0, max_chunk_size_), deadline)) return false;
+    chunk.erase(0, max_chunk_size_);
+  }
+  return Push(std::move(chunk), deadline);
+}
+
+void RequestBodyWriter::Finish() {
+  if (!producer_) return;
+  producer_.reset();
+  Resume();
+}
+
+bool RequestBodyWriter::Push(std::string&& chunk, engine::Deadline deadline) {
+  if (!producer_->Push(std::move(chunk), deadline)) return false;
+  Resume();
+  return true;
+}
+
+void RequestBodyWriter::Resume() {
+  if (stream_->is_paused.exchange(false) && stream_->resume) {
+    stream_->resume();
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
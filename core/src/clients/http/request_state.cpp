@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <map>
 #include <string_view>
 
@@ -56,6 +57,22 @@ const std::string kTestsuiteSupportedErrorsKey = "X-Testsuite-Supported-Errors";
 const std::string kTestsuiteSupportedErrors =
     boost::algorithm::join(boost::adaptors::keys(kTestsuiteActions), ",");
 
+// Content codings decoded by curl, brotli and zstd are optional in libcurl
+const std::string& GetAcceptEncoding() {
+  static const std::string kAcceptEncoding = [] {
+    const auto* info = curl::native::curl_version_info(
+        curl::native::CURLversion::CURLVERSION_NOW);
+    std::string result;
+#ifdef CURL_VERSION_ZSTD
+    if (info->features & CURL_VERSION_ZSTD) result += "zstd,";
+#endif
+    if (info->features & CURL_VERSION_BROTLI) result += "br,";
+    result += "gzip,deflate,identity";
+    return result;
+  }();
+  return kAcceptEncoding;
+}
+
 std::error_code TestsuiteResponseHook(Status status_code,
                                       const Headers& headers,
                                       tracing::Span& span) {
@@ -181,8 +198,8 @@ RequestState::RequestState(
   easy().set_header_function(&RequestState::on_header);
   easy().set_header_data(this);
 
-  // set autodecoding for gzip and deflate
-  easy().set_accept_encoding("gzip,deflate,identity");
+  // set autodecoding for all the codings supported by curl
+  easy().set_accept_encoding(GetAcceptEncoding().c_str());
 }
 
 RequestState::~RequestState() {
@@ -280,9 +297,32 @@ void RequestState::connect_to(const ConnectTo& connect_to) {
   curl::native::curl_slist* ptr = connect_to.GetUnderlying();
   if (ptr) {
     easy().set_connect_to(ptr);
+    is_connect_to_set_ = true;
   }
 }
 
+void RequestState::data_stream(
+    const std::shared_ptr<impl::RequestBodyStream>& stream,
+    std::optional<std::size_t> size) {
+  UINVARIANT(!body_stream_, "The request body stream is already set");
+  stream->resume = [weak_state = weak_from_this()] {
+    if (auto state = weak_state.lock()) state->easy().unpause();
+  };
+  body_stream_.emplace(BodyStreamData{stream, stream->queue->GetConsumer()});
+
+  // CURLOPT_POST without CURLOPT_POSTFIELDS reads the body with the callback
+  easy().set_post(true);
+  easy().set_post_fields(static_cast<void*>(nullptr));
+  easy().set_post_field_size_large(
+      size ? static_cast<curl::native::curl_off_t>(*size) : -1);
+  easy().set_read_function(&RequestState::BodyStreamReadFunction);
+  easy().set_read_data(this);
+}
+
+void RequestState::load_balancing(LoadBalancing policy) {
+  load_balancing_ = policy;
+}
+
 void RequestState::proxy(const std::string& value) {
   proxy_url_ = value;
   easy().set_proxy(value);
@@ -303,6 +343,7 @@ void RequestState::http_auth_type(curl::easy::httpauth_t value, bool auth_only,
 void RequestState::Cancel() {
   // We can not call `retry_.timer.reset();` here because of data race
   is_cancelled_ = true;
+  if (queue_wait_.IsValid()) queue_wait_.RequestCancel();
   easy().cancel();
 }
 
@@ -312,6 +353,7 @@ void RequestState::SetDestinationMetricNameAuto(std::string destination) {
 
 void RequestState::SetDestinationMetricName(const std::string& destination) {
   dest_req_stats_ = dest_stats_->GetStatisticsForDestination(destination);
+  explicit_destination_metric_name_ = destination;
 }
 
 void RequestState::SetTestsuiteConfig(
@@ -401,6 +443,9 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   }
 
   holder->AccountResponse(err);
+  holder->FinishConcurrencySlot(err, status_code);
+  // Lets the writer know that the body is not read anymore
+  holder->body_stream_.reset();
   const auto sockets = easy.get_num_connects();
   holder->WithRequestStats(
       [sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
@@ -429,6 +474,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
     const utils::Overloaded visitor{
         [&holder, &err](FullBufferedData& buffered_data) {
           { [[maybe_unused]] const auto cleanup = holder->response_move(); }
+          buffered_data.error_ = err;
           auto promise = std::move(buffered_data.promise_);
           // The task will wake up and may reuse RequestState.
           promise.set_exception(holder->PrepareException(err));
@@ -479,10 +525,12 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder,
   // - if we used all attempts
   // - if failed to reach server, and we should not retry on fails
   // - if this request was cancelled
+  // - if the streamed body could not be sent again
   const bool not_need_retry =
       (!err && !holder->ShouldRetryResponse()) ||
       (holder->retry_.current >= holder->retry_.retries) ||
-      (err && !holder->retry_.on_fails) || holder->is_cancelled_.load();
+      (err && !holder->retry_.on_fails) || holder->is_cancelled_.load() ||
+      holder->HasBodyStream();
 
   if (not_need_retry) {
     // finish if no need to retry
@@ -602,11 +650,13 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(
   easy().set_sink(&response_->sink_string());
 
   auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
+  easy_->BindToStickyMulti(proxy_url_);
 
   if (UpdateTimeoutFromDeadlineAndCheck()) {
-    perform_request([holder = shared_from_this()](std::error_code err) mutable {
-      RequestState::on_retry(std::move(holder), err);
-    });
+    perform_limited_request(
+        [holder = shared_from_this()](std::error_code err) mutable {
+          RequestState::on_retry(std::move(holder), err);
+        });
   }
 
   return future;
@@ -628,11 +678,13 @@ engine::Future<void> RequestState::async_perform_stream(
   retry_.retries = 1;
 
   auto future = std::get_if<StreamData>(&data_)->headers_promise.get_future();
+  easy_->BindToStickyMulti(proxy_url_);
 
   if (UpdateTimeoutFromDeadlineAndCheck()) {
-    perform_request([holder = shared_from_this()](std::error_code err) mutable {
-      RequestState::on_completed(std::move(holder), err);
-    });
+    perform_limited_request(
+        [holder = shared_from_this()](std::error_code err) mutable {
+          RequestState::on_completed(std::move(holder), err);
+        });
   }
 
   return future;
@@ -650,7 +702,8 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
 
   plugin_pipeline_.HookPerformRequest(*this);
 
-  if (resolver_ && retry_.current == 1) {
+  // Each attempt of a balanced request picks the endpoint anew
+  if (resolver_ && (retry_.current == 1 || IsLoadBalanced())) {
     engine::AsyncNoSpan([this, holder = shared_from_this(),
                          handler = std::move(handler)]() mutable {
       try {
@@ -674,6 +727,54 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
   }
 }
 
+void RequestState::perform_limited_request(curl::easy::handler_type handler) {
+  // Only the destinations with metrics are limited, so that the number of
+  // the limiters is bounded too
+  if (!concurrency_limiters_ || !dest_req_stats_) {
+    perform_request(std::move(handler));
+    return;
+  }
+
+  auto limiter = concurrency_limiters_->Get(
+      explicit_destination_metric_name_.value_or(destination_metric_name_));
+  const auto queue_timeout = std::min(
+      concurrency_limiters_->GetQueueTimeout(), effective_timeout_);
+  const bool should_queue = queue_timeout > std::chrono::milliseconds::zero();
+
+  auto slot = limiter->TryAcquire();
+  if (slot) {
+    concurrency_slot_.emplace(std::move(*slot));
+    perform_request(std::move(handler));
+    return;
+  }
+
+  // Acquire() accounts the rejection, it never waits with the passed
+  // deadline. The rejected requests fail outside of async_perform, as the
+  // queued ones.
+  const auto deadline = should_queue
+                            ? engine::Deadline::FromDuration(queue_timeout)
+                            : engine::Deadline::Passed();
+  auto task = engine::AsyncNoSpan([this, holder = shared_from_this(),
+                                   limiter = std::move(limiter), deadline,
+                                   handler = std::move(handler)]() mutable {
+    auto slot = limiter->Acquire(deadline);
+    if (!slot || is_cancelled_) {
+      // The rejected requests are not retried
+      const std::error_code err =
+          is_cancelled_
+              ? std::make_error_code(std::errc::operation_canceled)
+              : curl::errc::RateLimitErrorCode::kDestinationConcurrencyLimit;
+      RequestState::on_completed(std::move(holder), err);
+      return;
+    }
+    concurrency_slot_.emplace(std::move(*slot));
+    perform_request(std::move(handler));
+  });
+  queue_wait_ = engine::TaskCancellationToken(task);
+  // The client cancels the waits before its destruction
+  concurrency_limiters_->DetachQueueWait(std::move(task));
+}
+
 void RequestState::SetEasyTimeout(std::chrono::milliseconds timeout) {
   UASSERT_MSG(
       timeout >= std::chrono::seconds{0},
@@ -737,6 +838,8 @@ void RequestState::HandleDeadlineAlreadyPassed() {
 
   const utils::Overloaded visitor{
       [&exc](FullBufferedData& buffered_data) {
+        buffered_data.error_ =
+            std::error_code{curl::errc::EasyErrorCode::kOperationTimedout};
         auto promise = std::move(buffered_data.promise_);
         // The task will wake up and may reuse RequestState.
         promise.set_exception(std::move(exc));
@@ -800,6 +903,8 @@ bool RequestState::ShouldRetryResponse() {
 }
 
 void RequestState::AccountResponse(std::error_code err) {
+  FinishEndpointAttempt(err);
+
   const auto attempts = retry_.current;
 
   const auto time_to_start =
@@ -832,6 +937,11 @@ void RequestState::ThrowDeadlineExpiredException() {
       PrepareDeadlinePassedException(GetLoggedOriginalUrl(), LocalStats{}));
 }
 
+std::error_code RequestState::GetResponseError() const noexcept {
+  const auto* buffered_data = std::get_if<FullBufferedData>(&data_);
+  return buffered_data ? buffered_data->error_ : std::error_code{};
+}
+
 void RequestState::ResetDataForNewRequest() {
   SetBaggageHeader(easy());
 
@@ -839,6 +949,8 @@ void RequestState::ResetDataForNewRequest() {
   response_->SetStatusCode(Status::InternalServerError);
 
   is_cancelled_ = false;
+  concurrency_slot_.reset();
+  queue_wait_ = {};
   retry_.current = 1;
   effective_timeout_ = original_timeout_;
   deadline_ = server::request::GetTaskInheritedDeadline();
@@ -891,6 +1003,37 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb,
   return CURL_WRITEFUNC_PAUSE;
 }
 
+bool RequestState::BodyStreamData::PopChunk() {
+  chunk_offset = 0;
+  return consumer.PopNoblock(chunk);
+}
+
+size_t RequestState::BodyStreamReadFunction(void* ptr, size_t size,
+                                            size_t nmemb, void* userdata) {
+  RequestState& rs = *static_cast<RequestState*>(userdata);
+  if (!rs.body_stream_) return CURL_READFUNC_ABORT;
+  auto& body = *rs.body_stream_;
+
+  if (body.chunk_offset == body.chunk.size() && !body.PopChunk()) {
+    // The writer resumes the transfer if it pushes anything after this point
+    body.stream->is_paused = true;
+    const bool is_finished = body.stream->queue->NoMoreProducers();
+    if (!body.PopChunk()) {
+      if (is_finished) return 0;
+      LOG_TRACE() << "Body stream is empty, pausing the upload"
+                  << tracing::impl::LogSpanAsLastNonCoro{
+                         rs.span_storage_->Get()};
+      return CURL_READFUNC_PAUSE;
+    }
+  }
+
+  const auto copied =
+      std::min(size * nmemb, body.chunk.size() - body.chunk_offset);
+  std::memcpy(ptr, body.chunk.data() + body.chunk_offset, copied);
+  body.chunk_offset += copied;
+  return copied;
+}
+
 void RequestState::ApplyTestsuiteConfig() {
   if (!testsuite_config_) {
     return;
@@ -966,6 +1109,11 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
   if (hostname.find(':') != std::string::npos) return;
 
   const auto addrs = resolver.Resolve(hostname, deadline);
+  if (IsLoadBalanced() && !addrs.empty()) {
+    PickEndpoint(hostname, target.Get().GetPortPtr().get(), addrs);
+    return;
+  }
+
   auto addr_strings =
       addrs | boost::adaptors::transformed(
                   [](const auto& addr) { return addr.PrimaryAddressString(); });
@@ -974,6 +1122,56 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
                      fmt::to_string(fmt::join(addr_strings, ",")));
 }
 
+bool RequestState::IsLoadBalanced() const {
+  return load_balancing_ != LoadBalancing::kNone && endpoint_balancer_ &&
+         !is_connect_to_set_ && proxy_url_.empty();
+}
+
+void RequestState::PickEndpoint(const std::string& hostname,
+                                const std::string& port,
+                                const clients::dns::AddrVector& addrs) {
+  std::vector<std::string> addresses;
+  addresses.reserve(addrs.size());
+  for (const auto& addr : addrs) {
+    addresses.push_back(addr.PrimaryAddressString());
+  }
+
+  endpoint_attempt_.reset();
+  endpoint_attempt_.emplace(endpoint_balancer_->Pick(
+      utils::StrCat(hostname, ":", port), addresses, load_balancing_));
+
+  // cURL reuses a connection only for the same CONNECT_TO target, so the
+  // endpoints get separate connection pools
+  const auto& address = endpoint_attempt_->GetAddress();
+  const bool is_ipv6 = address.find(':') != std::string::npos;
+  ConnectTo connect_to{
+      fmt::format(is_ipv6 ? "{0}:{1}:[{2}]:{1}" : "{0}:{1}:{2}:{1}", hostname,
+                  port, address)};
+  easy().set_connect_to(connect_to.GetUnderlying());
+  // The previous value is freed only after cURL got the new one
+  endpoint_connect_to_ = std::move(connect_to);
+}
+
+void RequestState::FinishEndpointAttempt(std::error_code err) {
+  if (!endpoint_attempt_) return;
+  const bool is_failure =
+      (err && !is_cancelled_) || easy().get_response_code() >= 500;
+  endpoint_attempt_->Finish(is_failure);
+  endpoint_attempt_.reset();
+}
+
+void RequestState::FinishConcurrencySlot(std::error_code err,
+                                         Status status_code) {
+  if (!concurrency_slot_) return;
+  const bool is_overload =
+      err == curl::errc::EasyErrorCode::kOperationTimedout ||
+      status_code == Status::TooManyRequests ||
+      status_code == Status::ServiceUnavailable ||
+      status_code == Status::GatewayTimeout;
+  concurrency_slot_->Finish(is_overload);
+  concurrency_slot_.reset();
+}
+
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) {
   tracing_manager_ = m;
 }
@@ -983,6 +1181,16 @@ void RequestState::SetHeadersPropagator(
   headers_propagator_ = propagator;
 }
 
+void RequestState::SetEndpointBalancer(
+    std::shared_ptr<EndpointBalancer> balancer) {
+  endpoint_balancer_ = std::move(balancer);
+}
+
+void RequestState::SetConcurrencyLimiters(
+    std::shared_ptr<ConcurrencyLimiters> limiters) {
+  concurrency_limiters_ = std::move(limiters);
+}
+
 RequestTracingEditor RequestState::GetEditableTracingInstance() {
   return RequestTracingEditor(easy());
 }
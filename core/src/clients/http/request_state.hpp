@@ -7,7 +7,9 @@
 #include <string>
 #include <system_error>
 
+#include <userver/clients/dns/common.hpp>
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
@@ -18,6 +20,7 @@
 #include <userver/crypto/private_key.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/url.hpp>
 #include <userver/tracing/in_place_span.hpp>
@@ -26,8 +29,11 @@
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/not_null.hpp>
 
+#include <clients/http/concurrency_limiter.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/endpoint_balancer.hpp>
+#include <clients/http/request_body_stream.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -39,7 +45,6 @@ USERVER_NAMESPACE_BEGIN
 namespace clients::http {
 
 class StreamedResponse;
-class ConnectTo;
 
 class RequestState : public std::enable_shared_from_this<RequestState> {
  public:
@@ -85,6 +90,12 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void unix_socket_path(const std::string& path);
   /// set connect_to option
   void connect_to(const ConnectTo& connect_to);
+  /// send the body written to the stream while the request is performed
+  void data_stream(const std::shared_ptr<impl::RequestBodyStream>& stream,
+                   std::optional<std::size_t> size);
+  bool HasBodyStream() const { return body_stream_.has_value(); }
+  /// set the policy to pick one of the resolved addresses
+  void load_balancing(LoadBalancing policy);
   /// sets proxy to use
   void proxy(const std::string& value);
   /// sets proxy auth type to use
@@ -102,6 +113,10 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   [[noreturn]] void ThrowDeadlineExpiredException();
 
+  /// error of the completed async_perform() without rethrowing it, may be
+  /// empty for the errors that have no code
+  std::error_code GetResponseError() const noexcept;
+
   /// cancel request
   void Cancel();
 
@@ -128,6 +143,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void SetTracingManager(const tracing::TracingManagerBase&);
   void SetHeadersPropagator(const server::http::HeadersPropagator*);
+  void SetEndpointBalancer(std::shared_ptr<EndpointBalancer> balancer);
+  void SetConcurrencyLimiters(std::shared_ptr<ConcurrencyLimiters> limiters);
 
   RequestTracingEditor GetEditableTracingInstance();
 
@@ -150,6 +167,9 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void on_retry_timer(std::error_code err);
   /// run curl async_request, called once per attempt
   void perform_request(curl::easy::handler_type handler);
+  /// takes a slot of the destination concurrency limit and runs
+  /// perform_request, called once per request
+  void perform_limited_request(curl::easy::handler_type handler);
 
   void UpdateTimeoutFromDeadline(std::chrono::milliseconds rtt_estimate);
   [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(
@@ -164,6 +184,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   static size_t StreamWriteFunction(char* ptr, size_t size, size_t nmemb,
                                     void* userdata);
+  static size_t BodyStreamReadFunction(void* ptr, size_t size, size_t nmemb,
+                                       void* userdata);
 
   void AccountResponse(std::error_code err);
   std::exception_ptr PrepareException(std::error_code err);
@@ -177,6 +199,11 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void WithRequestStats(const Func& func);
 
   void ResolveTargetAddress(clients::dns::Resolver& resolver);
+  bool IsLoadBalanced() const;
+  void PickEndpoint(const std::string& hostname, const std::string& port,
+                    const clients::dns::AddrVector& addrs);
+  void FinishEndpointAttempt(std::error_code err);
+  void FinishConcurrencySlot(std::error_code err, Status status_code);
 
   /// curl handler wrapper
   std::shared_ptr<impl::EasyWrapper> easy_;
@@ -185,6 +212,7 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   std::shared_ptr<DestinationStatistics> dest_stats_;
   std::string destination_metric_name_;
+  std::optional<std::string> explicit_destination_metric_name_;
 
   std::shared_ptr<const TestsuiteConfig> testsuite_config_;
   std::vector<std::string> allowed_urls_extra_;
@@ -229,6 +257,17 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   clients::dns::Resolver* resolver_{nullptr};
   std::string proxy_url_;
+  bool is_connect_to_set_{false};
+
+  LoadBalancing load_balancing_{LoadBalancing::kNone};
+  std::shared_ptr<EndpointBalancer> endpoint_balancer_;
+  std::optional<EndpointBalancer::Attempt> endpoint_attempt_;
+  // CURLOPT_CONNECT_TO to the address of endpoint_attempt_
+  std::optional<ConnectTo> endpoint_connect_to_;
+  std::shared_ptr<ConcurrencyLimiters> concurrency_limiters_;
+  std::optional<ConcurrencyLimiter::Slot> concurrency_slot_;
+  // The wait of a queued request for its slot
+  engine::TaskCancellationToken queue_wait_;
   impl::PluginPipeline& plugin_pipeline_;
 
   struct StreamData {
@@ -242,9 +281,23 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   struct FullBufferedData {
     engine::Promise<std::shared_ptr<Response>> promise_;
+    // set before the exception is passed to the promise_
+    std::error_code error_;
   };
 
   std::variant<FullBufferedData, StreamData> data_;
+
+  struct BodyStreamData {
+    bool PopChunk();
+
+    std::shared_ptr<impl::RequestBodyStream> stream;
+    impl::RequestBodyStream::Queue::Consumer consumer;
+    // accessed from the curl read callback only
+    std::string chunk;
+    std::size_t chunk_offset{0};
+  };
+
+  std::optional<BodyStreamData> body_stream_;
 };
 
 }  // namespace clients::http
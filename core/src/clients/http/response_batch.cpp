@@ -0,0 +1,66 @@
+#include <userver/clients/http/response_batch.hpp>
+
+#include <numeric>
+#include <utility>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/engine/wait_any.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+std::vector<ResponseFuture> PerformAll(std::vector<Request>& requests) {
+  std::vector<ResponseFuture> futures;
+  futures.reserve(requests.size());
+  for (auto& request : requests) {
+    futures.push_back(request.async_perform());
+  }
+  return futures;
+}
+
+}  // namespace
+
+ResponseBatch::ResponseBatch(std::vector<Request>& requests)
+    : ResponseBatch(PerformAll(requests)) {}
+
+ResponseBatch::ResponseBatch(std::vector<ResponseFuture>&& futures)
+    : futures_(std::move(futures)), indexes_(futures_.size()) {
+  std::iota(indexes_.begin(), indexes_.end(), std::size_t{0});
+}
+
+std::optional<ResponseBatch::Result> ResponseBatch::GetNext() {
+  if (futures_.empty()) return std::nullopt;
+
+  const auto ready = engine::WaitAny(futures_);
+  if (!ready) throw CancelException();
+
+  // The completed request leaves the batch even if it has failed, so that
+  // it is not waited for again
+  auto future = std::move(futures_[*ready]);
+  const auto index = indexes_[*ready];
+  if (*ready + 1 != futures_.size()) {
+    futures_[*ready] = std::move(futures_.back());
+    indexes_[*ready] = indexes_.back();
+  }
+  futures_.pop_back();
+  indexes_.pop_back();
+
+  return Result{index, future.Get()};
+}
+
+std::size_t ResponseBatch::GetPendingCount() const noexcept {
+  return futures_.size();
+}
+
+void ResponseBatch::Cancel() {
+  for (auto& future : futures_) future.Cancel();
+  futures_.clear();
+  indexes_.clear();
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include <clients/http/request_state.hpp>
+#include <curl-ev/error_code.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -113,6 +114,34 @@ std::shared_ptr<Response> ResponseFuture::Get() {
   throw TimeoutException("Future timeout", {});  // no local stats available
 }
 
+utils::expected<std::shared_ptr<Response>, std::error_code>
+ResponseFuture::TryGet() {
+  const auto status = future_.wait_until(deadline_);
+  if (status == engine::FutureStatus::kCancelled) {
+    const auto stats = request_state_->easy().get_local_stats();
+    Cancel();
+    throw CancelException(
+        "HTTP response wait was aborted due to task cancellation", stats);
+  }
+
+  const std::error_code timeout_error{
+      curl::errc::EasyErrorCode::kOperationTimedout};
+  if (status == engine::FutureStatus::kTimeout) {
+    if (was_deadline_propagated_) Detach();
+    return utils::unexpected(timeout_error);
+  }
+
+  const auto error = request_state_->GetResponseError();
+  if (error) {
+    Detach();
+    return utils::unexpected(error);
+  }
+
+  auto response = future_.get();
+  Detach();
+  return response;
+}
+
 engine::impl::ContextAccessor*
 ResponseFuture::TryGetContextAccessor() noexcept {
   return future_.TryGetContextAccessor();
@@ -131,6 +131,13 @@ void Statistics::AccountError(ErrorGroup error) {
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+std::optional<std::chrono::milliseconds> Statistics::GetRecentTimingPercentile(
+    double percent) const {
+  const auto timings = timings_percentile_.GetStatsForPeriod();
+  if (timings.Count() == 0) return std::nullopt;
+  return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const InstanceStatistics& stats, FormatMode format_mode) {
   writer["timings"] = stats.timings_percentile;
@@ -163,6 +170,24 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer["sockets"]["throttled"] = stats.multi.socket_ratelimit;
     writer["sockets"]["active"] =
         stats.multi.socket_open - stats.multi.socket_close;
+
+    writer["connections"]["transfers"] = stats.multi.transfers;
+    writer["connections"]["reused"] = stats.multi.reused_connections;
+    writer["connections"]["reuse-ratio"] =
+        stats.multi.transfers
+            ? static_cast<double>(stats.multi.reused_connections) /
+                  static_cast<double>(stats.multi.transfers)
+            : 0.0;
+
+    // Handshakes of the new TLS connections, `mean-time-us` shows whether
+    // the shared TLS session cache saves the round trips
+    auto tls = writer["connections"]["tls-handshakes"];
+    tls["total"] = stats.multi.tls_handshakes;
+    tls["resumed"] = stats.multi.tls_resumed;
+    tls["mean-time-us"] =
+        stats.multi.tls_handshakes
+            ? stats.multi.tls_handshake_time_us / stats.multi.tls_handshakes
+            : 0;
   }
 
   writer["sockets"]["open"] = stats.multi.socket_open;
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -44,12 +45,22 @@ struct MultiStats {
   uint64_t socket_open{0};
   uint64_t socket_close{0};
   uint64_t socket_ratelimit{0};
+  uint64_t transfers{0};
+  uint64_t reused_connections{0};
+  uint64_t tls_handshakes{0};
+  uint64_t tls_resumed{0};
+  uint64_t tls_handshake_time_us{0};
   double current_load{0};
 
   MultiStats& operator+=(const MultiStats& other) {
     socket_open += other.socket_open;
     socket_close += other.socket_close;
     socket_ratelimit += other.socket_ratelimit;
+    transfers += other.transfers;
+    reused_connections += other.reused_connections;
+    tls_handshakes += other.tls_handshakes;
+    tls_resumed += other.tls_resumed;
+    tls_handshake_time_us += other.tls_handshake_time_us;
     current_load += other.current_load;
     return *this;
   }
@@ -89,6 +100,10 @@ class Statistics {
 
   void AccountStatus(int);
 
+  // Returns std::nullopt if there were no requests recently
+  std::optional<std::chrono::milliseconds> GetRecentTimingPercentile(
+      double percent) const;
+
  private:
   std::atomic<uint64_t> easy_handles_{0};
   std::atomic<uint64_t> last_time_to_start_us_{0};
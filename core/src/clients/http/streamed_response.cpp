@@ -3,6 +3,7 @@
 #include <algorithm>  // for std::min
 
 #include <clients/http/request_state.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
 #include <userver/utils/algo.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -82,6 +83,17 @@ bool StreamedResponse::ReadChunk(std::string& output,
   return queue_consumer_.Pop(output, deadline);
 }
 
+void StreamedResponse::ReadJson(formats::json::parser::BaseParser& parser,
+                                engine::Deadline deadline) {
+  WaitForHeadersOrThrow(deadline_);
+
+  formats::json::parser::ParserState state;
+  state.PushParser(parser);
+  state.ProcessChunkedInput([this, deadline](std::string& chunk) {
+    return queue_consumer_.Pop(chunk, deadline);
+  });
+}
+
 }  // namespace clients::http
 
 USERVER_NAMESPACE_END
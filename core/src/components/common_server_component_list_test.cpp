@@ -160,6 +160,9 @@ components_manager:
         decompress_request: false
         throttling_enabled: false
         set-response-server-hostname: false
+        memory_accounting:
+            max_bytes_in_flight: 1048576
+            max_request_bytes: 65536
 
         # Options from server::handlers::HttpHandlerBase
         log-level: WARNING
@@ -1,5 +1,7 @@
 #include "component_context_component_info.hpp"
 
+#include <algorithm>
+
 #include <userver/components/component_context.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -149,6 +151,24 @@ std::string ComponentInfo::GetDependencies() const {
                      fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::AddLoadWaitDuration(
+    std::chrono::steady_clock::duration duration) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  load_wait_duration_ += duration;
+}
+
+void ComponentInfo::SetLoadDuration(
+    std::chrono::steady_clock::duration duration) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  load_duration_ = duration;
+}
+
+std::chrono::steady_clock::duration ComponentInfo::GetOwnLoadDuration() const {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  return std::max(load_duration_ - load_wait_duration_,
+                  std::chrono::steady_clock::duration::zero());
+}
+
 bool ComponentInfo::HasComponent() const {
   std::lock_guard<engine::Mutex> lock(mutex_);
   return !!component_;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -72,6 +73,13 @@ class ComponentInfo final {
 
   std::string GetDependencies() const;
 
+  void AddLoadWaitDuration(std::chrono::steady_clock::duration duration);
+  void SetLoadDuration(std::chrono::steady_clock::duration duration);
+
+  // Time spent in the constructor, excluding the waits for the other
+  // components
+  std::chrono::steady_clock::duration GetOwnLoadDuration() const;
+
  private:
   bool HasComponent() const;
   std::unique_ptr<ComponentBase> ExtractComponent();
@@ -92,6 +100,8 @@ class ComponentInfo final {
   ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
   bool stage_switching_cancelled_{false};
   std::atomic<bool> on_loading_cancelled_called_{false};
+  std::chrono::steady_clock::duration load_duration_{};
+  std::chrono::steady_clock::duration load_wait_duration_{};
 };
 
 }  // namespace components::impl
@@ -1,6 +1,9 @@
 #include <components/component_context_impl.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <optional>
 #include <queue>
 
 #include <fmt/format.h>
@@ -117,7 +120,10 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
-  component_info.SetComponent(factory(context));
+  const auto load_start = std::chrono::steady_clock::now();
+  auto new_component = factory(context);
+  component_info.SetLoadDuration(std::chrono::steady_clock::now() - load_start);
+  component_info.SetComponent(std::move(new_component));
   auto* component = component_info.GetComponent();
   if (component) {
     // Call the following command on logs to get the component dependencies:
@@ -132,6 +138,7 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
 
 void ComponentContext::Impl::OnAllComponentsLoaded() {
   StopPrintAddingComponentsTask();
+  LogLoadCriticalPath();
   tracing::Span span(kOnAllComponentsLoadedRootName);
   return ProcessAllComponentLifetimeStageSwitchings(
       {impl::ComponentLifetimeStage::kRunning,
@@ -343,7 +350,11 @@ impl::ComponentBase* ComponentContext::Impl::DoFindComponent(
   }
   SearchingComponentScope finder(*this, this_component_name);
 
-  return component_info.WaitAndGetComponent();
+  const auto wait_start = std::chrono::steady_clock::now();
+  component = component_info.WaitAndGetComponent();
+  components_.at(this_component_name)
+      .AddLoadWaitDuration(std::chrono::steady_clock::now() - wait_start);
+  return component;
 }
 
 void ComponentContext::Impl::AddDependency(impl::ComponentNameFromInfo name) {
@@ -463,6 +474,59 @@ void ComponentContext::Impl::PrintAddingComponents() const {
              << JoinNamesFromInfo(adding_components, ", ") << ']';
 }
 
+void ComponentContext::Impl::LogLoadCriticalPath() const {
+  // The longest by the own load time chain of dependencies, it bounds the
+  // startup time no matter how many components are constructed concurrently
+  struct PathInfo {
+    std::chrono::steady_clock::duration duration{};
+    std::optional<impl::ComponentNameFromInfo> next;
+  };
+  std::unordered_map<impl::ComponentNameFromInfo, PathInfo> paths;
+  paths.reserve(components_.size());
+
+  const auto find_path = [&](impl::ComponentNameFromInfo name,
+                             const auto& find_path_ref) -> const PathInfo& {
+    if (const auto it = paths.find(name); it != paths.end()) return it->second;
+
+    PathInfo path;
+    const auto& component_info = components_.at(name);
+    component_info.ForEachItDependsOn([&](impl::ComponentNameFromInfo dep) {
+      const auto& dep_path = find_path_ref(dep, find_path_ref);
+      if (!path.next || dep_path.duration > path.duration) {
+        path.duration = dep_path.duration;
+        path.next = dep;
+      }
+    });
+    path.duration += component_info.GetOwnLoadDuration();
+    return paths.emplace(name, path).first->second;
+  };
+
+  std::optional<impl::ComponentNameFromInfo> start;
+  std::chrono::steady_clock::duration duration{};
+  for (const auto& [name, component_info] : components_) {
+    const auto& path = find_path(name, find_path);
+    if (!start || path.duration > duration) {
+      start = name;
+      duration = path.duration;
+    }
+  }
+  if (!start) return;
+
+  using Ms = std::chrono::milliseconds;
+  std::string chain;
+  for (auto current = start; current; current = paths.at(*current).next) {
+    if (!chain.empty()) chain += " -> ";
+    fmt::format_to(
+        std::back_inserter(chain), "{} ({}ms)", current->StringViewName(),
+        std::chrono::duration_cast<Ms>(
+            components_.at(*current).GetOwnLoadDuration())
+            .count());
+  }
+  LOG_INFO() << "Components load critical path takes "
+             << std::chrono::duration_cast<Ms>(duration).count()
+             << "ms: " << chain;
+}
+
 }  // namespace components
 
 USERVER_NAMESPACE_END
@@ -139,6 +139,8 @@ struct ComponentContext::Impl {
   void StopPrintAddingComponentsTask();
   void PrintAddingComponents() const;
 
+  void LogLoadCriticalPath() const;
+
   const Manager& manager_;
 
   ComponentMap components_;
@@ -0,0 +1,178 @@
+#include <userver/components/heap_profiler.hpp>
+
+#include <algorithm>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <utils/jemalloc.hpp>
+#include <utils/jemalloc_profile.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+constexpr std::string_view kDumpPrefix = "heap.";
+constexpr std::string_view kDumpSuffix = ".prof";
+
+// lexicographical order of the names is the chronological one
+const std::string kDumpTimeFormat = "%Y%m%dT%H%M%S";
+
+bool IsDumpName(std::string_view name) {
+  return name.size() > kDumpPrefix.size() + kDumpSuffix.size() &&
+         name.substr(0, kDumpPrefix.size()) == kDumpPrefix &&
+         name.substr(name.size() - kDumpSuffix.size()) == kDumpSuffix;
+}
+
+}  // namespace
+
+HeapProfiler::HeapProfiler(const ComponentConfig& config,
+                           const ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      dump_directory_(config["dump-directory"].As<std::string>()),
+      max_dumps_(config["max-dumps"].As<std::size_t>(24)),
+      top_sites_count_(config["top-sites"].As<std::size_t>(10)) {
+  const auto lg_sample = config["lg-sample"].As<std::size_t>(21);
+  if (auto ec = utils::jemalloc::ProfReset(lg_sample)) {
+    LOG_WARNING() << "Heap profiling is disabled, start the service with "
+                     "MALLOC_CONF=prof:true,prof_active:false to enable it: "
+                  << ec.message();
+  } else if (auto ec = utils::jemalloc::ProfActivate()) {
+    LOG_WARNING() << "Failed to activate the heap profiling: " << ec.message();
+  } else {
+    is_active_ = true;
+  }
+
+  if (is_active_) {
+    fs::blocking::CreateDirectories(dump_directory_);
+
+    utils::PeriodicTask::Settings settings{
+        config["dump-interval"].As<std::chrono::milliseconds>(
+            std::chrono::minutes{10})};
+    settings.task_processor = &context.GetTaskProcessor(
+        config["fs-task-processor"].As<std::string>());
+    dump_task_.Start("heap-profiler", settings, [this] { DumpProfile(); });
+  }
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("heap-profiler",
+                          [this](utils::statistics::Writer& writer) {
+                            ExtendStatistics(writer);
+                          });
+}
+
+HeapProfiler::~HeapProfiler() {
+  statistics_holder_.Unregister();
+  dump_task_.Stop();
+  if (is_active_) {
+    if (auto ec = utils::jemalloc::ProfDeactivate()) {
+      LOG_WARNING() << "Failed to deactivate the heap profiling: "
+                    << ec.message();
+    }
+  }
+}
+
+void HeapProfiler::DumpProfile() {
+  const auto path = fmt::format(
+      "{}/{}{}{}", dump_directory_, kDumpPrefix,
+      utils::datetime::Timestring(utils::datetime::Now(),
+                                  utils::datetime::kDefaultTimezone,
+                                  kDumpTimeFormat),
+      kDumpSuffix);
+  if (auto ec = utils::jemalloc::ProfDump(path)) {
+    ++dump_errors_;
+    LOG_ERROR() << "Failed to dump the heap profile to " << path << ": "
+                << ec.message();
+    return;
+  }
+  ++dumps_;
+  RemoveOldDumps();
+
+  const auto profile =
+      utils::jemalloc::ParseProfile(fs::blocking::ReadFileContents(path));
+  std::vector<Site> top_sites;
+  for (auto& site : utils::jemalloc::GetTopSites(profile, top_sites_count_)) {
+    top_sites.push_back({std::move(site.name), site.objects, site.bytes});
+  }
+  top_sites_.Assign(std::move(top_sites));
+}
+
+void HeapProfiler::RemoveOldDumps() {
+  std::vector<std::string> dumps;
+  for (const auto& entry :
+       boost::filesystem::directory_iterator{dump_directory_}) {
+    if (IsDumpName(entry.path().filename().string())) {
+      dumps.push_back(entry.path().string());
+    }
+  }
+  if (dumps.size() <= max_dumps_) return;
+
+  std::sort(dumps.begin(), dumps.end());
+  dumps.resize(dumps.size() - max_dumps_);
+  for (const auto& dump : dumps) {
+    LOG_DEBUG() << "Removing the old heap profile " << dump;
+    fs::blocking::RemoveSingleFile(dump);
+  }
+}
+
+void HeapProfiler::ExtendStatistics(utils::statistics::Writer& writer) {
+  writer["dumps"] = dumps_;
+  writer["dump-errors"] = dump_errors_;
+
+  const auto top_sites = top_sites_.Read();
+  for (const auto& site : *top_sites) {
+    writer["top-sites"]["bytes"].ValueWithLabels(site.bytes,
+                                                 {"site", site.name});
+    writer["top-sites"]["objects"].ValueWithLabels(site.objects,
+                                                   {"site", site.name});
+  }
+}
+
+yaml_config::Schema HeapProfiler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: Component for continuous jemalloc heap profiling.
+additionalProperties: false
+properties:
+    fs-task-processor:
+        type: string
+        description: Task processor to dump and parse heap profiles on
+    dump-directory:
+        type: string
+        description: Directory to write the heap profiles into
+    lg-sample:
+        type: integer
+        description: An allocation is sampled every 2^lg-sample bytes on average
+        defaultDescription: 21
+        minimum: 0
+    dump-interval:
+        type: string
+        description: Interval between the heap profile dumps
+        defaultDescription: 10m
+    max-dumps:
+        type: integer
+        description: How many latest heap profiles to keep in the directory
+        defaultDescription: 24
+        minimum: 1
+    top-sites:
+        type: integer
+        description: How many allocation sites to report as metrics
+        defaultDescription: 10
+        minimum: 0
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
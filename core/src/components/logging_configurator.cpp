@@ -1,9 +1,14 @@
 #include <userver/components/logging_configurator.hpp>
 
+#include <fmt/format.h>
+
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
+#include <logging/log_sampling.hpp>
+#include <logging/log_sampling_config.hpp>
 #include <tracing/no_log_spans.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -34,6 +39,27 @@ logging::DynamicDebugConfig ParseDynamicDebug(
 
 constexpr dynamic_config::Key<ParseDynamicDebug> kDynamicDebugConfig{};
 
+constexpr std::string_view kLogSamplingName = "USERVER_LOG_SAMPLING";
+
+logging::LogSamplingConfig ParseLogSampling(
+    const dynamic_config::DocsMap& docs_map) {
+  if (!docs_map.Has(kLogSamplingName)) return {};
+  return docs_map.Get(kLogSamplingName).As<logging::LogSamplingConfig>();
+}
+
+constexpr dynamic_config::Key<ParseLogSampling> kLogSamplingConfig{};
+
+void WriteSamplingStatistics(utils::statistics::Writer& writer) {
+  for (const auto& location : logging::GetDynamicDebugLocations()) {
+    const auto sampled_out = location.sampled_out.load();
+    if (sampled_out == 0) continue;
+
+    writer["sampled_out"].ValueWithLabels(
+        sampled_out,
+        {"location", fmt::format("{}:{}", location.path, location.line)});
+  }
+}
+
 }  // namespace
 
 LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
@@ -47,10 +73,17 @@ LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
       context.FindComponent<components::DynamicConfig>()
           .GetSource()
           .UpdateAndListen(this, kName, &LoggingConfigurator::OnConfigUpdate);
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("logger.sampling", &WriteSamplingStatistics);
 }
 
 LoggingConfigurator::~LoggingConfigurator() {
+  statistics_holder_.Unregister();
   config_subscription_.Unsubscribe();
+  logging::ResetLogSampling();
 }
 
 void LoggingConfigurator::OnConfigUpdate(
@@ -87,6 +120,34 @@ void LoggingConfigurator::OnConfigUpdate(
   } catch (const std::exception& e) {
     LOG_ERROR() << "Failed to set dynamic debug logs from config: " << e;
   }
+
+  try {
+    const auto& sampling = config[kLogSamplingConfig];
+    auto old_sampling = log_sampling_.Read();
+    if (!(*old_sampling == sampling)) {
+      auto lock = log_sampling_.StartWrite();
+      *lock = sampling;
+      UpdateLogSampling(sampling);
+      lock.Commit();
+    }
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Failed to set log sampling from config: " << e;
+  }
+}
+
+void LoggingConfigurator::UpdateLogSampling(
+    const logging::LogSamplingConfig& sampling) {
+  // Like for the dynamic debug logs, some messages may be sampled with a
+  // mix of the old and the new ratios during the update
+  logging::ResetLogSampling();
+
+  for (const auto& [level, ratio] : sampling.levels) {
+    logging::SetLevelSamplingRatio(level, ratio);
+  }
+  for (const auto& [location, ratio] : sampling.locations) {
+    const auto [path, line] = logging::SplitLocation(location);
+    logging::SetLocationSamplingRatio(path, line, ratio);
+  }
 }
 
 yaml_config::Schema LoggingConfigurator::GetStaticConfigSchema() {
@@ -15,6 +15,7 @@
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/components/component_list.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/hostinfo/cpu_limit.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/logging/log.hpp>
@@ -115,7 +116,7 @@ void Manager::TaskProcessorsStorage::Reset() noexcept {
     task_processor->InitiateShutdown();
   }
   LOG_TRACE() << "Waiting for all coroutines to become idle";
-  while (task_processor_pools_->GetCoroPool().GetStats().active_coroutines) {
+  while (task_processor_pools_->GetCoroPoolStats().active_coroutines) {
     std::this_thread::sleep_for(std::chrono::milliseconds{10});
   }
   LOG_TRACE() << "Stopping task processors";
@@ -138,7 +139,12 @@ Manager::Manager(std::unique_ptr<ManagerConfig>&& config,
       task_processors_storage_(
           std::make_shared<engine::impl::TaskProcessorPools>(
               config_->coro_pool, config_->event_thread_pool)),
-      start_time_(std::chrono::steady_clock::now()) {
+      start_time_(std::chrono::steady_clock::now()),
+      caches_startup_semaphore_(
+          config_->caches_startup_concurrency
+              ? std::make_unique<engine::Semaphore>(
+                    config_->caches_startup_concurrency)
+              : nullptr) {
   LOG_INFO() << "Starting components manager";
 
   for (auto processor_config : config_->task_processors) {
@@ -227,6 +233,10 @@ std::chrono::milliseconds Manager::GetLoadDuration() const {
   return load_duration_;
 }
 
+engine::Semaphore* Manager::GetCachesStartupSemaphore() const {
+  return caches_startup_semaphore_.get();
+}
+
 void Manager::CreateComponentContext(const ComponentList& component_list) {
   std::set<std::string> loading_component_names;
   for (const auto& adder : component_list) {
@@ -16,6 +16,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine {
+class Semaphore;
+}  // namespace engine
+
 namespace engine::impl {
 class TaskProcessorPools;
 }  // namespace engine::impl
@@ -52,6 +56,10 @@ class Manager final {
 
   std::chrono::milliseconds GetLoadDuration() const;
 
+  /// Limits the number of caches loading at the same time on startup,
+  /// nullptr if there's no limit
+  engine::Semaphore* GetCachesStartupSemaphore() const;
+
  private:
   class TaskProcessorsStorage {
    public:
@@ -105,6 +113,7 @@ class Manager final {
   engine::TaskProcessor* default_task_processor_{nullptr};
   const std::chrono::steady_clock::time_point start_time_;
   std::chrono::milliseconds load_duration_{0};
+  const std::unique_ptr<engine::Semaphore> caches_startup_semaphore_;
 
   os_signals::ProcessorComponent* signal_processor_{nullptr};
 };
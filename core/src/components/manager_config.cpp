@@ -100,6 +100,37 @@ properties:
                 type: integer
                 description: size of a single coroutine, bytes
                 defaultDescription: 256 * 1024
+            local_cache_size:
+                type: integer
+                description: >
+                    max amount of idle coroutines to keep in a per-thread
+                    cache, 0 to disable the caches
+                defaultDescription: 32
+            stack_reclaim_idle_threshold:
+                type: string
+                description: >
+                    return the stack memory of coroutines that were idle for
+                    longer than this to the OS, 0 to disable
+                defaultDescription: 0
+            small_stack_size:
+                type: integer
+                description: >
+                    size of a coroutine for tasks started with
+                    engine::StackSizeClass::kSmall, bytes, 0 to use stack_size
+                defaultDescription: 0
+            large_stack_size:
+                type: integer
+                description: >
+                    size of a coroutine for tasks started with
+                    engine::StackSizeClass::kLarge, bytes, 0 to use stack_size
+                defaultDescription: 0
+            stack_usage_sampling_period:
+                type: integer
+                description: >
+                    measure the max stack usage of every N-th task and report
+                    it per task type in metrics, 0 to disable; expensive, for
+                    choosing the stack sizes only
+                defaultDescription: 0
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -122,6 +153,36 @@ properties:
                 description: >
                     Whether to defer timer events to a per-thread periodic timer
                     or notify ev-loop right away
+            cpu_affinity:
+                type: object
+                description: pin the ev threads to a set of CPUs
+                additionalProperties: false
+                properties:
+                    cpus:
+                        type: string
+                        description: CPU list, e.g. "0-15,32-47"
+                    numa-node:
+                        type: integer
+                        description: pin to all the CPUs of the NUMA node
+                    pin-each-thread:
+                        type: boolean
+                        description: |
+                            pin each thread to a single CPU of the set
+                            in round-robin manner
+                        defaultDescription: false
+            io_backend:
+                type: string
+                description: >
+                    backend for socket operations; io_uring falls back to
+                    libev if it is not supported by the kernel
+                defaultDescription: libev
+                enum:
+                  - libev
+                  - io_uring
+            io_uring_entries:
+                type: integer
+                description: size of the submission queue of each ev thread
+                defaultDescription: 256
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -163,6 +224,67 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                task-processor-queue:
+                    type: string
+                    description: |
+                        task queue implementation. `work-stealing-task-queue`
+                        gives each worker its own local queue and lets idle
+                        workers steal tasks from the busy ones.
+                    defaultDescription: global-task-queue
+                    enum:
+                      - global-task-queue
+                      - work-stealing-task-queue
+                high-priority-weight:
+                    type: integer
+                    description: |
+                        number of engine::TaskPriority::kHigh tasks a worker
+                        takes in a row from the global task queue before it
+                        takes an engine::TaskPriority::kNormal task
+                    defaultDescription: 8
+                    minimum: 1
+                cpu-affinity:
+                    type: object
+                    description: pin the worker threads to a set of CPUs
+                    additionalProperties: false
+                    properties:
+                        cpus:
+                            type: string
+                            description: CPU list, e.g. "0-15,32-47"
+                        numa-node:
+                            type: integer
+                            description: pin to all the CPUs of the NUMA node
+                        pin-each-thread:
+                            type: boolean
+                            description: |
+                                pin each thread to a single CPU of the set
+                                in round-robin manner
+                            defaultDescription: false
+                task-time-accounting:
+                    type: boolean
+                    description: |
+                        account the time the tasks spend running, in the
+                        queue and waiting, per span name
+                    defaultDescription: false
+                jemalloc:
+                    type: object
+                    description: jemalloc options of the worker threads
+                    additionalProperties: false
+                    properties:
+                        tcache:
+                            type: boolean
+                            description: |
+                                enable or disable the thread caches of the
+                                worker threads
+                            defaultDescription: the allocator default
+                        arenas:
+                            type: integer
+                            description: |
+                                number of jemalloc arenas that are not
+                                shared with the other threads, the worker
+                                threads are spread over them; 0 to use the
+                                shared arenas
+                            defaultDescription: 0
+                            minimum: 0
                 task-trace:
                     type: object
                     description: .
@@ -187,6 +309,13 @@ properties:
         type: boolean
         description: whether to mlock(2) process debug info
         defaultDescription: true
+    caches_startup_concurrency:
+        type: integer
+        description: |
+            max number of caches loading a dump or performing the first
+            update at the same time, 0 for no limit
+        defaultDescription: 0
+        minimum: 0
     static_config_validation:
         type: object
         description: settings for basic syntax validation in config.yaml
@@ -227,6 +356,9 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value,
           ValidationMode::kAll);
   config.mlock_debug_info =
       value["mlock_debug_info"].As<bool>(config.mlock_debug_info);
+  config.caches_startup_concurrency =
+      value["caches_startup_concurrency"].As<std::size_t>(
+          config.caches_startup_concurrency);
   return config;
 }
 
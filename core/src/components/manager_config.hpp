@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,7 @@ struct ManagerConfig {
   utils::impl::UserverExperimentSet enabled_experiments;
   bool experiments_force_enabled{false};
   bool mlock_debug_info{true};
+  std::size_t caches_startup_concurrency{0};
 
   static ManagerConfig FromString(
       const std::string&, const std::optional<std::string>& config_vars_path,
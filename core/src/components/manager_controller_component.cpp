@@ -2,8 +2,10 @@
 
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
+#include <engine/io/tls_statistics.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
+#include <utils/jemalloc.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
@@ -48,7 +50,46 @@ void DumpMetric(utils::statistics::Writer& writer,
     context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
   }
 
+  for (const auto priority : {TaskPriority::kNormal, TaskPriority::kHigh}) {
+    writer["queue-wait"].ValueWithLabels(
+        counter.GetQueueWaitStats(priority),
+        {"task_priority", ToString(priority)});
+  }
+
   writer["worker-threads"] = task_processor.GetWorkerCount();
+
+  if (task_processor.ShouldAccountTaskTime()) {
+    auto span_timings = writer["span-timings"];
+    for (const auto& [span_name, timings] : counter.GetSpanTimings()) {
+      span_timings.ValueWithLabels(timings, {"span_name", span_name});
+    }
+  }
+
+  if (const auto& arenas = task_processor.GetJemallocArenas();
+      !arenas.empty() && !utils::jemalloc::RefreshStats()) {
+    auto jemalloc_arenas = writer["jemalloc-arenas"];
+    for (const auto arena : arenas) {
+      utils::jemalloc::ArenaStats stats;
+      if (utils::jemalloc::GetArenaStats(arena, stats)) continue;
+
+      const auto arena_name = std::to_string(arena);
+      const utils::statistics::LabelView label{"jemalloc_arena", arena_name};
+      jemalloc_arenas["threads"].ValueWithLabels(stats.threads, label);
+      jemalloc_arenas["allocated"].ValueWithLabels(stats.allocated_bytes,
+                                                   label);
+      jemalloc_arenas["active"].ValueWithLabels(stats.active_bytes, label);
+      jemalloc_arenas["resident"].ValueWithLabels(stats.resident_bytes, label);
+    }
+  }
+
+  if (const auto* queue = task_processor.GetWorkStealingTaskQueue()) {
+    auto work_stealing = writer["work-stealing"];
+    for (std::size_t i = 0; i < queue->GetWorkerCount(); ++i) {
+      work_stealing.ValueWithLabels(
+          queue->GetWorkerStats(i),
+          {"task_processor_worker", std::to_string(i)});
+    }
+  }
 }
 
 }  // namespace engine
@@ -100,19 +141,45 @@ void ManagerControllerComponent::WriteStatistics(
   const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
   auto& ev_thread_pool = pools_ptr->EventThreadPool();
   for (auto* thread : ev_thread_pool.NextThreads(ev_thread_pool.GetSize())) {
+    const utils::statistics::LabelView label{"ev_thread_name",
+                                             thread->GetName()};
     writer["ev-threads"]["cpu-load-percent"].ValueWithLabels(
-        thread->GetCurrentLoadPercent(),
-        {{"ev_thread_name", thread->GetName()}});
+        thread->GetCurrentLoadPercent(), label);
+    writer["ev-threads"]["wakeups"].ValueWithLabels(thread->GetWakeupsCount(),
+                                                    label);
+    writer["ev-threads"]["processed-payloads"].ValueWithLabels(
+        thread->GetProcessedPayloadsCount(), label);
   }
 
   // coroutines
   if (auto coro_pool = writer["coro-pool"]) {
+    const auto& pools = components_manager_.GetTaskProcessorPools();
+    auto stats = pools->GetCoroPoolStats();
     if (auto coro_stats = coro_pool["coroutines"]) {
-      auto stats =
-          components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
       coro_stats["active"] = stats.active_coroutines;
       coro_stats["total"] = stats.total_coroutines;
     }
+    if (auto stack_stats = coro_pool["stacks"]) {
+      stack_stats["reserved-bytes"] = stats.reserved_stack_bytes;
+      stack_stats["resident-bytes"] = stats.resident_stack_bytes;
+    }
+
+    const auto& stack_usage_monitor = pools->GetStackUsageMonitor();
+    if (stack_usage_monitor.IsEnabled()) {
+      if (auto usage_stats = coro_pool["stack-usage"]) {
+        for (const auto& usage : stack_usage_monitor.GetStackUsage()) {
+          usage_stats["max-bytes"].ValueWithLabels(
+              usage.max_bytes, {"task_type", usage.task_type});
+        }
+      }
+    }
+  }
+
+  // TLS handshakes of engine::io::TlsWrapper
+  if (auto tls = writer["tls"]) {
+    const auto& tls_stats = engine::io::impl::GetTlsStatistics();
+    tls.ValueWithLabels(tls_stats.client, {"tls_side", "client"});
+    tls.ValueWithLabels(tls_stats.server, {"tls_side", "server"});
   }
 
   // misc
@@ -92,6 +92,11 @@ void TcpAcceptorBase::KeepAccepting() {
   }
 }
 
+void TcpAcceptorBase::DetachSocketTask(std::function<void()> function) {
+  tasks_.Detach(
+      engine::AsyncNoSpan(sockets_task_processor_, std::move(function)));
+}
+
 void TcpAcceptorBase::OnAllComponentsLoaded() {
   // Start handling after the derived object was fully constructed
 
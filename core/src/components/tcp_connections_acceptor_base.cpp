@@ -0,0 +1,306 @@
+#include <userver/components/tcp_connections_acceptor_base.hpp>
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include <engine/io/poller.hpp>
+#include <userver/components/component.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace impl {
+
+class TcpBufferPool final {
+ public:
+  using Buffer = TcpConnectionsAcceptorBase::Buffer;
+
+  TcpBufferPool(std::vector<std::size_t> sizes, std::size_t max_pooled)
+      : max_pooled_(max_pooled) {
+    std::sort(sizes.begin(), sizes.end());
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+    for (const auto size : sizes) {
+      size_classes_.push_back(std::make_unique<SizeClass>(size));
+    }
+  }
+
+  Buffer Acquire(std::size_t size) {
+    auto* size_class = FindSizeClass(size, std::greater_equal<>{});
+    if (!size_class) {
+      return {std::make_unique<char[]>(size), size, *this};
+    }
+
+    std::unique_ptr<char[]> data;
+    if (size_class->free.try_dequeue(data)) {
+      --size_class->free_count;
+    } else {
+      data = std::make_unique<char[]>(size_class->size);
+    }
+    return {std::move(data), size_class->size, *this};
+  }
+
+  void Release(std::unique_ptr<char[]> data, std::size_t size) noexcept {
+    auto* size_class = FindSizeClass(size, std::equal_to<>{});
+    if (!size_class) return;
+
+    // the limit is approximate, it is fine to keep a few more buffers
+    if (size_class->free_count.load(std::memory_order_relaxed) >=
+        max_pooled_) {
+      return;
+    }
+    if (size_class->free.enqueue(std::move(data))) {
+      ++size_class->free_count;
+    }
+  }
+
+ private:
+  struct SizeClass {
+    explicit SizeClass(std::size_t size) : size(size) {}
+
+    const std::size_t size;
+    moodycamel::ConcurrentQueue<std::unique_ptr<char[]>> free;
+    std::atomic<std::size_t> free_count{0};
+  };
+
+  template <typename Predicate>
+  SizeClass* FindSizeClass(std::size_t size, Predicate predicate) noexcept {
+    for (const auto& size_class : size_classes_) {
+      if (predicate(size_class->size, size)) return size_class.get();
+    }
+    return nullptr;
+  }
+
+  const std::size_t max_pooled_;
+  std::vector<std::unique_ptr<SizeClass>> size_classes_;
+};
+
+}  // namespace impl
+
+TcpConnectionsAcceptorBase::Buffer::Buffer(std::unique_ptr<char[]> data,
+                                           std::size_t size,
+                                           impl::TcpBufferPool& pool) noexcept
+    : data_(std::move(data)), size_(size), pool_(&pool) {}
+
+TcpConnectionsAcceptorBase::Buffer::Buffer(Buffer&& other) noexcept
+    : data_(std::move(other.data_)),
+      size_(std::exchange(other.size_, 0)),
+      pool_(other.pool_) {}
+
+TcpConnectionsAcceptorBase::Buffer&
+TcpConnectionsAcceptorBase::Buffer::operator=(Buffer&& other) noexcept {
+  if (this == &other) return *this;
+  if (data_) pool_->Release(std::move(data_), size_);
+  data_ = std::move(other.data_);
+  size_ = std::exchange(other.size_, 0);
+  pool_ = other.pool_;
+  return *this;
+}
+
+TcpConnectionsAcceptorBase::Buffer::~Buffer() {
+  if (data_) pool_->Release(std::move(data_), size_);
+}
+
+TcpConnectionsAcceptorBase::Connection::Connection(engine::io::Socket&& socket,
+                                                   std::uint64_t id,
+                                                   impl::TcpBufferPool& pool)
+    : socket_(std::move(socket)), id_(id), pool_(pool) {}
+
+TcpConnectionsAcceptorBase::Connection::~Connection() = default;
+
+bool TcpConnectionsAcceptorBase::Connection::SendAll(
+    const void* buf, std::size_t len, engine::Deadline deadline) {
+  const std::lock_guard lock{write_mutex_};
+  if (is_closed_ || !socket_.IsValid()) return false;
+  return socket_.SendAll(buf, len, deadline) == len;
+}
+
+TcpConnectionsAcceptorBase::Buffer
+TcpConnectionsAcceptorBase::Connection::AcquireBuffer(std::size_t size) {
+  return pool_.Acquire(size);
+}
+
+void TcpConnectionsAcceptorBase::Connection::Close() noexcept {
+  const std::lock_guard lock{write_mutex_};
+  if (is_closed_.exchange(true) || !socket_.IsValid()) return;
+
+  // The fd may be waited for by the reading coroutine or by the parking
+  // task, they close the socket after they notice the shutdown
+  ::shutdown(socket_.Fd(), SHUT_RDWR);
+}
+
+void TcpConnectionsAcceptorBase::Connection::DoClose() noexcept {
+  const std::lock_guard lock{write_mutex_};
+  is_closed_ = true;
+  try {
+    socket_.Close();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to close the connection " << id_ << ": " << ex;
+  }
+}
+
+TcpConnectionsAcceptorBase::TcpConnectionsAcceptorBase(
+    const ComponentConfig& config, const ComponentContext& context)
+    : TcpAcceptorBase(config, context),
+      read_buffer_size_(config["read-buffer-size"].As<std::size_t>(4096)),
+      keep_warm_timeout_(
+          config["keep-warm-timeout"].As<std::chrono::milliseconds>(100)),
+      buffer_pool_(std::make_unique<impl::TcpBufferPool>(
+          config["buffer-sizes"].As<std::vector<std::size_t>>(
+              std::vector<std::size_t>{4096, 65536}),
+          config["max-pooled-buffers"].As<std::size_t>(1024))),
+      poller_(std::make_unique<engine::io::Poller>()) {}
+
+TcpConnectionsAcceptorBase::~TcpConnectionsAcceptorBase() {
+  // the connections parked after the parking task has stopped
+  const auto connections = connections_to_park_.Lock();
+  for (auto& connection : *connections) {
+    connection->DoClose();
+  }
+}
+
+yaml_config::Schema TcpConnectionsAcceptorBase::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<TcpAcceptorBase>(R"(
+type: object
+description: |
+  Component for accepting incoming TCP connections and reading the data
+  from them, idle connections are parked without a coroutine
+additionalProperties: false
+properties:
+  buffer-sizes:
+      type: array
+      description: size classes of the pooled buffers, in bytes
+      defaultDescription: '[4096, 65536]'
+      items:
+          type: integer
+          description: size of the buffers
+          minimum: 1
+  max-pooled-buffers:
+      type: integer
+      description: how many free buffers of each size class to keep
+      defaultDescription: 1024
+      minimum: 0
+  read-buffer-size:
+      type: integer
+      description: size of the buffer to read the data into
+      defaultDescription: 4096
+      minimum: 1
+  keep-warm-timeout:
+      type: string
+      description: |
+          how long to keep the coroutine of an idle connection before
+          parking it
+      defaultDescription: 100ms
+)");
+}
+
+void TcpConnectionsAcceptorBase::OnConnectionOpened(
+    const std::shared_ptr<Connection>&) {}
+
+void TcpConnectionsAcceptorBase::OnConnectionClosed(
+    const Connection&) noexcept {}
+
+void TcpConnectionsAcceptorBase::ProcessSocket(engine::io::Socket&& sock) {
+  if (!is_parking_started_.exchange(true)) {
+    DetachSocketTask([this] { KeepParking(); });
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  std::shared_ptr<Connection> connection{
+      new Connection(std::move(sock), ++last_connection_id_, *buffer_pool_)};
+  OnConnectionOpened(connection);
+  ServeConnection(std::move(connection));
+}
+
+void TcpConnectionsAcceptorBase::ServeConnection(
+    std::shared_ptr<Connection> connection) {
+  auto buffer = buffer_pool_->Acquire(read_buffer_size_);
+  auto& socket = connection->socket_;
+
+  while (!connection->IsClosed()) {
+    const auto keep_warm_deadline =
+        engine::Deadline::FromDuration(keep_warm_timeout_);
+    if (!socket.WaitReadable(keep_warm_deadline)) {
+      if (engine::current_task::ShouldCancel()) break;
+
+      // idle, the coroutine and the buffer are released until the data arrives
+      Park(std::move(connection));
+      return;
+    }
+
+    try {
+      const auto read_bytes = socket.RecvSome(buffer.Data(), buffer.Size(), {});
+      if (read_bytes == 0) break;
+      if (!ProcessData(connection, {buffer.Data(), read_bytes})) break;
+    } catch (const std::exception& ex) {
+      LOG_INFO() << "Closing the connection " << connection->Id() << ": "
+                 << ex;
+      break;
+    }
+  }
+
+  connection->DoClose();
+  OnConnectionClosed(*connection);
+}
+
+void TcpConnectionsAcceptorBase::Park(std::shared_ptr<Connection> connection) {
+  {
+    auto connections = connections_to_park_.Lock();
+    connections->push_back(std::move(connection));
+  }
+  poller_->Interrupt();
+}
+
+void TcpConnectionsAcceptorBase::KeepParking() {
+  std::unordered_map<int, std::shared_ptr<Connection>> parked;
+  std::vector<std::shared_ptr<Connection>> connections;
+
+  engine::io::Poller::Event event;
+  for (;;) {
+    const auto status = poller_->NextEvent(event, {});
+    if (status == engine::io::Poller::Status::kNoEvents) break;
+
+    if (status == engine::io::Poller::Status::kInterrupt) {
+      {
+        auto connections_to_park = connections_to_park_.Lock();
+        connections_to_park->swap(connections);
+      }
+      for (auto& connection : connections) {
+        const auto fd = connection->socket_.Fd();
+        poller_->Add(fd, engine::io::Poller::Event::kRead);
+        parked.emplace(fd, std::move(connection));
+      }
+      connections.clear();
+      continue;
+    }
+
+    const auto it = parked.find(event.fd);
+    if (it == parked.end()) continue;
+    poller_->Remove(event.fd);
+    DetachSocketTask([this, connection = std::move(it->second)] {
+      ServeConnection(connection);
+    });
+    parked.erase(it);
+  }
+
+  // cancelled, the component is stopping
+  for (auto& [fd, connection] : parked) {
+    poller_->Remove(fd);
+    connection->DoClose();
+    OnConnectionClosed(*connection);
+  }
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
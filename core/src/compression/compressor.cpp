@@ -0,0 +1,303 @@
+#include <compression/compressor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <zlib.h>
+
+#ifdef USERVER_FEATURE_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef USERVER_FEATURE_BROTLI
+#include <brotli/encode.h>
+#endif
+
+#include <fmt/format.h>
+
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+namespace {
+
+constexpr utils::TrivialBiMap kEncodingNames([](auto selector) {
+  return selector()
+      .Case(Encoding::kGzip, "gzip")
+      .Case(Encoding::kZstd, "zstd")
+      .Case(Encoding::kBrotli, "br");
+});
+
+constexpr std::size_t kEncodingsCount = 3;
+
+// "-1" is required to avoid memory fragmentation
+// (stdlibc++ allocates capacity+1 bytes).
+constexpr std::size_t kOutputChunkSize = 16 * 1024 - 1;
+
+constexpr std::string_view kOptionalWhitespace = " \t";
+
+std::string_view Trim(std::string_view value) {
+  const auto begin = value.find_first_not_of(kOptionalWhitespace);
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(kOptionalWhitespace);
+  return value.substr(begin, end - begin + 1);
+}
+
+// `;q=0`, `;q=0.0` and alike reject the coding
+bool IsRejected(std::string_view params) {
+  while (!params.empty()) {
+    const auto semicolon = params.find(';');
+    const auto param = Trim(params.substr(0, semicolon));
+    if (param.size() > 2 && (param[0] == 'q' || param[0] == 'Q') &&
+        param[1] == '=') {
+      const auto value = param.substr(2);
+      return value[0] == '0' &&
+             value.find_first_not_of(".0") == std::string_view::npos;
+    }
+    if (semicolon == std::string_view::npos) break;
+    params.remove_prefix(semicolon + 1);
+  }
+  return false;
+}
+
+int ClampLevel(std::optional<int> level, int min, int max, int default_level) {
+  return std::clamp(level.value_or(default_level), min, max);
+}
+
+// Grows the output by a chunk and returns the free space
+std::pair<char*, std::size_t> GrowOutput(std::string& output,
+                                         std::size_t& old_size) {
+  old_size = output.size();
+  output.resize(old_size + kOutputChunkSize);
+  return {output.data() + old_size, kOutputChunkSize};
+}
+
+class GzipCompressor final : public Compressor {
+ public:
+  explicit GzipCompressor(int level) {
+    // 15 window bits plus 16 for the gzip header and trailer
+    if (deflateInit2(&stream_, level, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      throw CompressionError("failed to initialize gzip compression");
+    }
+  }
+
+  ~GzipCompressor() override { deflateEnd(&stream_); }
+
+  void Compress(std::string_view input, Flush flush,
+                std::string& output) override {
+    const int mode = flush == Flush::kFinish ? Z_FINISH
+                     : flush == Flush::kSync ? Z_SYNC_FLUSH
+                                             : Z_NO_FLUSH;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream_.avail_in = input.size();
+    do {
+      std::size_t old_size = 0;
+      const auto [out, out_size] = GrowOutput(output, old_size);
+      stream_.next_out = reinterpret_cast<Bytef*>(out);
+      stream_.avail_out = out_size;
+      if (deflate(&stream_, mode) == Z_STREAM_ERROR) {
+        throw CompressionError("gzip compression failed");
+      }
+      output.resize(old_size + out_size - stream_.avail_out);
+    } while (stream_.avail_out == 0);
+  }
+
+ private:
+  z_stream stream_{};
+};
+
+#ifdef USERVER_FEATURE_ZSTD
+class ZstdCompressor final : public Compressor {
+ public:
+  explicit ZstdCompressor(int level) : context_(ZSTD_createCCtx()) {
+    if (!context_ || ZSTD_isError(ZSTD_CCtx_setParameter(
+                         context_, ZSTD_c_compressionLevel, level))) {
+      ZSTD_freeCCtx(context_);
+      throw CompressionError("failed to initialize zstd compression");
+    }
+  }
+
+  ~ZstdCompressor() override { ZSTD_freeCCtx(context_); }
+
+  void Compress(std::string_view input, Flush flush,
+                std::string& output) override {
+    const auto mode = flush == Flush::kFinish ? ZSTD_e_end
+                      : flush == Flush::kSync ? ZSTD_e_flush
+                                              : ZSTD_e_continue;
+
+    ZSTD_inBuffer in{input.data(), input.size(), 0};
+    while (true) {
+      std::size_t old_size = 0;
+      const auto [out_data, out_size] = GrowOutput(output, old_size);
+      ZSTD_outBuffer out{out_data, out_size, 0};
+      const auto remaining = ZSTD_compressStream2(context_, &out, &in, mode);
+      if (ZSTD_isError(remaining)) {
+        throw CompressionError(fmt::format("zstd compression failed: {}",
+                                           ZSTD_getErrorName(remaining)));
+      }
+      output.resize(old_size + out.pos);
+      if (mode == ZSTD_e_continue ? in.pos == in.size : remaining == 0) break;
+    }
+  }
+
+ private:
+  ZSTD_CCtx* context_;
+};
+#endif
+
+#ifdef USERVER_FEATURE_BROTLI
+class BrotliCompressor final : public Compressor {
+ public:
+  explicit BrotliCompressor(int level)
+      : state_(BrotliEncoderCreateInstance(nullptr, nullptr, nullptr)) {
+    if (!state_ ||
+        !BrotliEncoderSetParameter(state_, BROTLI_PARAM_QUALITY, level)) {
+      BrotliEncoderDestroyInstance(state_);
+      throw CompressionError("failed to initialize brotli compression");
+    }
+  }
+
+  ~BrotliCompressor() override { BrotliEncoderDestroyInstance(state_); }
+
+  void Compress(std::string_view input, Flush flush,
+                std::string& output) override {
+    const auto operation = flush == Flush::kFinish ? BROTLI_OPERATION_FINISH
+                           : flush == Flush::kSync ? BROTLI_OPERATION_FLUSH
+                                                   : BROTLI_OPERATION_PROCESS;
+
+    auto available_in = input.size();
+    const auto* next_in = reinterpret_cast<const std::uint8_t*>(input.data());
+    while (true) {
+      std::size_t available_out = 0;
+      if (!BrotliEncoderCompressStream(state_, operation, &available_in,
+                                       &next_in, &available_out, nullptr,
+                                       nullptr)) {
+        throw CompressionError("brotli compression failed");
+      }
+
+      std::size_t size = 0;
+      const auto* data = BrotliEncoderTakeOutput(state_, &size);
+      output.append(reinterpret_cast<const char*>(data), size);
+
+      if (available_in == 0 && !BrotliEncoderHasMoreOutput(state_) &&
+          (operation != BROTLI_OPERATION_FINISH ||
+           BrotliEncoderIsFinished(state_))) {
+        break;
+      }
+    }
+  }
+
+ private:
+  BrotliEncoderState* state_;
+};
+#endif
+
+}  // namespace
+
+std::string_view ToString(Encoding encoding) {
+  return utils::impl::EnumToStringView(encoding, kEncodingNames);
+}
+
+Encoding EncodingFromString(std::string_view name) {
+  if (const auto encoding = kEncodingNames.TryFindICase(name)) {
+    return *encoding;
+  }
+  throw CompressionError(
+      fmt::format("unknown encoding '{}', expected one of {}", name,
+                  kEncodingNames.DescribeSecond()));
+}
+
+bool IsSupported(Encoding encoding) {
+  switch (encoding) {
+    case Encoding::kGzip:
+      return true;
+    case Encoding::kZstd:
+#ifdef USERVER_FEATURE_ZSTD
+      return true;
+#else
+      return false;
+#endif
+    case Encoding::kBrotli:
+#ifdef USERVER_FEATURE_BROTLI
+      return true;
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+std::optional<Encoding> NegotiateEncoding(
+    std::string_view accept_encoding, const std::vector<Encoding>& preferred) {
+  std::array<std::optional<bool>, kEncodingsCount> is_accepted{};
+  std::optional<bool> is_any_accepted;
+
+  while (!accept_encoding.empty()) {
+    const auto comma = accept_encoding.find(',');
+    const auto coding = accept_encoding.substr(0, comma);
+    const auto semicolon = coding.find(';');
+    const auto name = Trim(coding.substr(0, semicolon));
+    const bool accepted =
+        semicolon == std::string_view::npos ||
+        !IsRejected(coding.substr(semicolon + 1));
+
+    if (name == "*") {
+      is_any_accepted = accepted;
+    } else if (const auto encoding = kEncodingNames.TryFindICase(name)) {
+      is_accepted[static_cast<std::size_t>(*encoding)] = accepted;
+    }
+
+    if (comma == std::string_view::npos) break;
+    accept_encoding.remove_prefix(comma + 1);
+  }
+
+  for (const auto encoding : preferred) {
+    const auto accepted = is_accepted[static_cast<std::size_t>(encoding)];
+    if (accepted.value_or(is_any_accepted.value_or(false))) return encoding;
+  }
+  return std::nullopt;
+}
+
+std::unique_ptr<Compressor> MakeCompressor(Encoding encoding,
+                                           std::optional<int> level) {
+  switch (encoding) {
+    case Encoding::kGzip:
+      return std::make_unique<GzipCompressor>(
+          ClampLevel(level, 1, Z_BEST_COMPRESSION, 6));
+    case Encoding::kZstd:
+#ifdef USERVER_FEATURE_ZSTD
+      return std::make_unique<ZstdCompressor>(
+          ClampLevel(level, 1, ZSTD_maxCLevel(), 3));
+#else
+      break;
+#endif
+    case Encoding::kBrotli:
+#ifdef USERVER_FEATURE_BROTLI
+      // The default quality of 11 is too slow for on the fly compression
+      return std::make_unique<BrotliCompressor>(
+          ClampLevel(level, BROTLI_MIN_QUALITY, BROTLI_MAX_QUALITY, 5));
+#else
+      break;
+#endif
+  }
+  throw CompressionError(fmt::format("{} compression is not supported",
+                                     ToString(encoding)));
+}
+
+std::string Compress(Encoding encoding, std::optional<int> level,
+                     std::string_view data) {
+  std::string result;
+  MakeCompressor(encoding, level)
+      ->Compress(data, Compressor::Flush::kFinish, result);
+  return result;
+}
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
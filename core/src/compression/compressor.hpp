@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+/// HTTP content codings of the response body
+enum class Encoding {
+  kGzip,
+  kZstd,
+  kBrotli,
+};
+
+/// Returns the content coding name for Content-Encoding, e.g. "br"
+std::string_view ToString(Encoding encoding);
+
+/// @throws CompressionError on unknown names
+Encoding EncodingFromString(std::string_view name);
+
+/// Whether the encoding is built in, zstd and brotli are optional
+bool IsSupported(Encoding encoding);
+
+/// @brief Picks the first of the server preferred encodings accepted by the
+/// `Accept-Encoding` header value, see RFC 9110 12.5.3
+std::optional<Encoding> NegotiateEncoding(
+    std::string_view accept_encoding, const std::vector<Encoding>& preferred);
+
+/// @brief Streaming compressor, appends the compressed data to the output
+class Compressor {
+ public:
+  enum class Flush {
+    kNone,   ///< may keep the data buffered
+    kSync,   ///< the peer may decompress all the data passed so far
+    kFinish  ///< ends the stream, the compressor must not be used afterwards
+  };
+
+  virtual ~Compressor() = default;
+
+  /// @throws CompressionError
+  virtual void Compress(std::string_view input, Flush flush,
+                        std::string& output) = 0;
+};
+
+/// @param level encoding specific level, clamped to the range of the
+/// encoding, the default one of the encoding if not set
+/// @throws CompressionError if the encoding is not supported
+std::unique_ptr<Compressor> MakeCompressor(Encoding encoding,
+                                           std::optional<int> level);
+
+/// Compresses the whole data at once
+std::string Compress(Encoding encoding, std::optional<int> level,
+                     std::string_view data);
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,131 @@
+#include <compression/compressor.hpp>
+
+#include <gtest/gtest.h>
+
+#ifdef USERVER_FEATURE_ZSTD
+#include <zstd.h>
+#endif
+
+#ifdef USERVER_FEATURE_BROTLI
+#include <brotli/decode.h>
+#endif
+
+#include <compression/gzip.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using compression::Encoding;
+
+std::string MakeData() {
+  std::string data;
+  for (int i = 0; i < 10000; ++i) data += "some data " + std::to_string(i);
+  return data;
+}
+
+std::string Decompress(Encoding encoding, std::string_view compressed,
+                       std::size_t size) {
+  switch (encoding) {
+    case Encoding::kGzip:
+      return compression::gzip::Decompress(compressed, size);
+    case Encoding::kZstd: {
+#ifdef USERVER_FEATURE_ZSTD
+      std::string result(size, '\0');
+      const auto decompressed_size = ZSTD_decompress(
+          result.data(), result.size(), compressed.data(), compressed.size());
+      EXPECT_FALSE(ZSTD_isError(decompressed_size));
+      result.resize(decompressed_size);
+      return result;
+#else
+      break;
+#endif
+    }
+    case Encoding::kBrotli: {
+#ifdef USERVER_FEATURE_BROTLI
+      std::string result(size, '\0');
+      auto decompressed_size = result.size();
+      EXPECT_EQ(BrotliDecoderDecompress(
+                    compressed.size(),
+                    reinterpret_cast<const std::uint8_t*>(compressed.data()),
+                    &decompressed_size,
+                    reinterpret_cast<std::uint8_t*>(result.data())),
+                BROTLI_DECODER_RESULT_SUCCESS);
+      result.resize(decompressed_size);
+      return result;
+#else
+      break;
+#endif
+    }
+  }
+  ADD_FAILURE() << "unsupported encoding";
+  return {};
+}
+
+class CompressorTest : public ::testing::TestWithParam<Encoding> {};
+
+}  // namespace
+
+TEST_P(CompressorTest, RoundTrip) {
+  const auto encoding = GetParam();
+  if (!compression::IsSupported(encoding)) {
+    EXPECT_THROW(compression::MakeCompressor(encoding, {}),
+                 compression::CompressionError);
+    return;
+  }
+
+  const auto data = MakeData();
+  const auto compressed = compression::Compress(encoding, {}, data);
+  EXPECT_LT(compressed.size(), data.size() / 4);
+  EXPECT_EQ(Decompress(encoding, compressed, data.size()), data);
+}
+
+TEST_P(CompressorTest, Streaming) {
+  const auto encoding = GetParam();
+  if (!compression::IsSupported(encoding)) return;
+
+  const auto data = MakeData();
+  const auto compressor = compression::MakeCompressor(encoding, 1);
+  std::string compressed;
+  for (std::size_t pos = 0; pos < data.size(); pos += 1000) {
+    compressor->Compress(std::string_view{data}.substr(pos, 1000),
+                         compression::Compressor::Flush::kSync, compressed);
+    EXPECT_FALSE(compressed.empty());
+  }
+  compressor->Compress({}, compression::Compressor::Flush::kFinish,
+                       compressed);
+  EXPECT_EQ(Decompress(encoding, compressed, data.size()), data);
+}
+
+INSTANTIATE_TEST_SUITE_P(/*no prefix*/, CompressorTest,
+                         ::testing::Values(Encoding::kGzip, Encoding::kZstd,
+                                           Encoding::kBrotli));
+
+TEST(Compression, NegotiateEncoding) {
+  using compression::NegotiateEncoding;
+  const std::vector<Encoding> preferred{Encoding::kZstd, Encoding::kBrotli,
+                                        Encoding::kGzip};
+
+  EXPECT_EQ(NegotiateEncoding("", preferred), std::nullopt);
+  EXPECT_EQ(NegotiateEncoding("identity", preferred), std::nullopt);
+  EXPECT_EQ(NegotiateEncoding("gzip, deflate, br", preferred),
+            Encoding::kBrotli);
+  EXPECT_EQ(NegotiateEncoding("GZIP", preferred), Encoding::kGzip);
+  EXPECT_EQ(NegotiateEncoding("zstd;q=0, gzip;q=0.5", preferred),
+            Encoding::kGzip);
+  EXPECT_EQ(NegotiateEncoding("zstd; q=0.000, br;q=0.1", preferred),
+            Encoding::kBrotli);
+  EXPECT_EQ(NegotiateEncoding("*", preferred), Encoding::kZstd);
+  EXPECT_EQ(NegotiateEncoding("zstd;q=0, *", preferred), Encoding::kBrotli);
+  EXPECT_EQ(NegotiateEncoding("gzip, *;q=0", preferred), Encoding::kGzip);
+  EXPECT_EQ(NegotiateEncoding("br", {Encoding::kGzip}), std::nullopt);
+}
+
+TEST(Compression, EncodingNames) {
+  EXPECT_EQ(compression::ToString(Encoding::kBrotli), "br");
+  EXPECT_EQ(compression::EncodingFromString("zstd"), Encoding::kZstd);
+  EXPECT_THROW(compression::EncodingFromString("deflate"),
+               compression::CompressionError);
+}
+
+USERVER_NAMESPACE_END
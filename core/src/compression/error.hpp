@@ -11,6 +11,11 @@ class DecompressionError : public std::runtime_error {
   using std::runtime_error::runtime_error;
 };
 
+/// Compression failed or the encoding is not supported
+class CompressionError : public std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
 /// Decompressed data size exceeds the limit
 class TooBigError : public DecompressionError {
  public:
@@ -0,0 +1,38 @@
+#include <compression/zstd.hpp>
+
+#ifdef USERVER_FEATURE_ZSTD
+#include <zstd.h>
+#include <zstd_errors.h>
+#endif
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::zstd {
+
+std::string Decompress(std::string_view compressed, std::size_t max_size) {
+#ifdef USERVER_FEATURE_ZSTD
+  std::string decompressed(max_size, '\0');
+  const auto size =
+      ZSTD_decompress(decompressed.data(), decompressed.size(),
+                      compressed.data(), compressed.size());
+  if (ZSTD_isError(size)) {
+    if (ZSTD_getErrorCode(size) == ZSTD_error_dstSize_tooSmall) {
+      throw TooBigError();
+    }
+    throw DecompressionError(fmt::format(
+        "failed to decompress zstd'ed data: {}", ZSTD_getErrorName(size)));
+  }
+  decompressed.resize(size);
+  return decompressed;
+#else
+  static_cast<void>(compressed);
+  static_cast<void>(max_size);
+  throw DecompressionError("zstd support is disabled");
+#endif
+}
+
+}  // namespace compression::zstd
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::zstd {
+
+/// Decompresses a single zstd frame, `max_size` must be enough for the whole
+/// decompressed data.
+/// @throws DecompressionError, including the case of zstd being disabled
+std::string Decompress(std::string_view compressed, std::size_t max_size);
+
+}  // namespace compression::zstd
+
+USERVER_NAMESPACE_END
@@ -1,24 +1,28 @@
 #include <userver/concurrent/async_event_channel.hpp>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 
 #include <fmt/format.h>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace concurrent::impl {
 
-void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task) {
-  constexpr std::chrono::seconds kSubscriberTimeout(30);
-
+void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task,
+                 std::chrono::milliseconds warn_timeout) {
   while (true) {
-    task.WaitFor(kSubscriberTimeout);
+    task.WaitFor(warn_timeout);
     if (task.IsFinished()) break;
 
-    LOG_ERROR() << "Subscriber " << name << " handles event for too long";
+    LOG_ERROR() << "Subscriber " << name
+                << " handles event for too long, more than "
+                << warn_timeout.count() << "ms";
   }
 
   try {
@@ -28,6 +32,59 @@ void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task) {
   }
 }
 
+void ListenersStatistics::Add(std::string_view listener_name) {
+  auto timings = timings_.Lock();
+  ++(*timings)[std::string{listener_name}].listeners;
+}
+
+void ListenersStatistics::Account(
+    std::string_view listener_name,
+    std::chrono::steady_clock::duration handling_time) {
+  auto timings = timings_.Lock();
+  const auto it = timings->find(std::string{listener_name});
+  // The listener is added to the statistics before it is subscribed
+  if (it == timings->end()) return;
+  auto& listener_timings = it->second;
+  ++listener_timings.events;
+  listener_timings.total += handling_time;
+  listener_timings.last = handling_time;
+}
+
+void ListenersStatistics::Remove(std::string_view listener_name) noexcept {
+  auto timings = timings_.Lock();
+  const auto it = std::find_if(timings->begin(), timings->end(),
+                               [listener_name](const auto& item) {
+                                 return item.first == listener_name;
+                               });
+  if (it == timings->end()) return;
+  // The statistics of the same-named listeners are kept until the last one
+  // unsubscribes
+  if (--it->second.listeners == 0) timings->erase(it);
+}
+
+void ListenersStatistics::Write(utils::statistics::Writer& writer,
+                                std::string_view channel_name) const {
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+
+  auto timings = timings_.Lock();
+  for (const auto& [listener_name, listener_timings] : *timings) {
+    const std::array<utils::statistics::LabelView, 2> label_views{{
+        {"channel", channel_name},
+        {"subscriber", listener_name},
+    }};
+    const utils::statistics::LabelsSpan labels{label_views};
+    writer["events"].ValueWithLabels(
+        utils::statistics::Rate{listener_timings.events}, labels);
+    writer["handling-time-ms"].ValueWithLabels(
+        utils::statistics::Rate{static_cast<std::uint64_t>(
+            duration_cast<milliseconds>(listener_timings.total).count())},
+        labels);
+    writer["last-handling-time-ms"].ValueWithLabels(
+        duration_cast<milliseconds>(listener_timings.last).count(), labels);
+  }
+}
+
 [[noreturn]] void ReportAlreadySubscribed(std::string_view channel_name,
                                           std::string_view listener_name) {
   UINVARIANT(false, fmt::format("{} is already subscribed to channel {}",
@@ -1,9 +1,14 @@
 #include <userver/utest/utest.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <stdexcept>
+#include <vector>
 
 #include <userver/concurrent/async_event_channel.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -234,6 +239,113 @@ UTEST(AsyncEventChannel, OnListenerRemovalSample) {
   /*! [OnListenerRemoval sample] */
 }
 
+UTEST(AsyncEventChannel, MaxParallelism) {
+  concurrent::AsyncEventChannel<int> channel("channel");
+  channel.SetSettings({/*max_parallelism=*/2, std::chrono::seconds{30}});
+
+  std::atomic<int> in_flight{0};
+  std::atomic<int> max_in_flight{0};
+  std::atomic<int> handled{0};
+  auto listener = [&](int) {
+    // UTEST runs the listeners in a single thread
+    const int current = ++in_flight;
+    if (current > max_in_flight) max_in_flight = current;
+    engine::SleepFor(std::chrono::milliseconds{10});
+    --in_flight;
+    ++handled;
+  };
+
+  std::vector<concurrent::AsyncEventSubscriberScope> subscriptions;
+  int ids[5]{};
+  for (auto& id : ids) {
+    subscriptions.push_back(channel.AddListener(
+        concurrent::FunctionId(&id), "listener", listener));
+  }
+
+  channel.SendEvent(1);
+  EXPECT_EQ(handled, 5);
+  EXPECT_EQ(max_in_flight, 2);
+
+  for (auto& subscription : subscriptions) subscription.Unsubscribe();
+}
+
+UTEST(AsyncEventChannel, Statistics) {
+  concurrent::AsyncEventChannel<int> channel("channel");
+
+  int value1{0};
+  int value2{0};
+  Subscriber s1(value1);
+  Subscriber s2(value2);
+  auto sub1 = channel.AddListener(&s1, "first", &Subscriber::OnEvent);
+  auto sub2 = channel.AddListener(&s2, "second", &Subscriber::OnEvent);
+
+  channel.SendEvent(1);
+  channel.SendEvent(2);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "channels", [&channel](utils::statistics::Writer& writer) {
+        writer = channel;
+      });
+
+  const auto get_events = [&storage](const char* subscriber) {
+    return utils::statistics::Snapshot{storage, "channels",
+                                       {{"channel", "channel"},
+                                        {"subscriber", subscriber}}}
+        .SingleMetric("events")
+        .AsRate()
+        .value;
+  };
+  EXPECT_EQ(get_events("first"), 2);
+  EXPECT_EQ(get_events("second"), 2);
+
+  sub1.Unsubscribe();
+  UEXPECT_THROW(get_events("first"), utils::statistics::MetricQueryError);
+  EXPECT_EQ(get_events("second"), 2);
+
+  holder.Unregister();
+  sub2.Unsubscribe();
+}
+
+UTEST(AsyncEventChannel, StatisticsOfSameNamedListeners) {
+  concurrent::AsyncEventChannel<int> channel("channel");
+
+  int value1{0};
+  int value2{0};
+  Subscriber s1(value1);
+  Subscriber s2(value2);
+  auto sub1 = channel.AddListener(&s1, "same", &Subscriber::OnEvent);
+  auto sub2 = channel.AddListener(&s2, "same", &Subscriber::OnEvent);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "channels", [&channel](utils::statistics::Writer& writer) {
+        writer = channel;
+      });
+
+  const auto get_events = [&storage] {
+    return utils::statistics::Snapshot{storage, "channels",
+                                       {{"channel", "channel"},
+                                        {"subscriber", "same"}}}
+        .SingleMetric("events")
+        .AsRate()
+        .value;
+  };
+  // Written since the subscription, before any event
+  EXPECT_EQ(get_events(), 0);
+
+  channel.SendEvent(1);
+  EXPECT_EQ(get_events(), 2);
+
+  sub1.Unsubscribe();
+  EXPECT_EQ(get_events(), 2);
+
+  sub2.Unsubscribe();
+  UEXPECT_THROW(get_events(), utils::statistics::MetricQueryError);
+
+  holder.Unregister();
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
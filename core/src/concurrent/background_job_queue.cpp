@@ -0,0 +1,69 @@
+#include <userver/concurrent/background_job_queue.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+BackgroundJobQueue::BackgroundJobQueue(engine::TaskProcessor& task_processor,
+                                       std::string name,
+                                       std::size_t workers_count,
+                                       std::size_t max_queue_size)
+    : name_(std::move(name)),
+      queue_(Queue::Create(max_queue_size)),
+      producer_(queue_->GetMultiProducer()) {
+  UINVARIANT(workers_count > 0, "workers_count must be positive");
+
+  workers_.reserve(workers_count);
+  for (std::size_t i = 0; i < workers_count; ++i) {
+    // The workers are critical, otherwise an overload of the task processor
+    // would silently stop the job processing
+    workers_.push_back(engine::CriticalAsyncNoSpan(
+        task_processor, &BackgroundJobQueue::RunWorker, this,
+        queue_->GetConsumer()));
+  }
+}
+
+BackgroundJobQueue::~BackgroundJobQueue() {
+  if (producer_) CancelAndWait();
+}
+
+bool BackgroundJobQueue::TryPush(Job job) {
+  UINVARIANT(producer_, "Trying to push a job into a stopped queue");
+  return producer_->PushNoblock(std::move(job));
+}
+
+void BackgroundJobQueue::CancelAndWait() noexcept {
+  UASSERT_MSG(producer_, "CancelAndWait should be called no more than once");
+  producer_.reset();
+  for (auto& worker : workers_) worker.RequestCancel();
+
+  const engine::TaskCancellationBlocker cancel_blocker;
+  for (auto& worker : workers_) worker.Wait();
+  workers_.clear();
+}
+
+std::size_t BackgroundJobQueue::QueueSizeApprox() const noexcept {
+  return queue_->GetSizeApproximate();
+}
+
+void BackgroundJobQueue::RunWorker(Queue::Consumer consumer) const {
+  Job job;
+  while (consumer.Pop(job)) {
+    try {
+      job();
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Job of the background queue '" << name_
+                  << "' failed: " << ex;
+    }
+    job = {};
+  }
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <userver/concurrent/background_job_queue.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(BackgroundJobQueue, Sample, 4) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  std::atomic<int> processed{0};
+
+  /// [Sample]
+  concurrent::BackgroundJobQueue queue(task_processor, "audit",
+                                       /*workers_count=*/2,
+                                       /*max_queue_size=*/100);
+
+  for (int i = 0; i < 10; ++i) {
+    if (!queue.TryPush([&processed] { ++processed; })) {
+      // The queue is full, drop the job
+    }
+  }
+  /// [Sample]
+
+  while (processed != 10) engine::Yield();
+  EXPECT_EQ(queue.QueueSizeApprox(), 0);
+}
+
+UTEST(BackgroundJobQueue, Full) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  concurrent::BackgroundJobQueue queue(task_processor, "test", 1, 1);
+
+  engine::SingleConsumerEvent started;
+  engine::SingleConsumerEvent finish;
+  ASSERT_TRUE(queue.TryPush([&] {
+    started.Send();
+    [[maybe_unused]] const bool ok = finish.WaitForEvent();
+  }));
+  ASSERT_TRUE(started.WaitForEventFor(utest::kMaxTestWaitTime));
+
+  EXPECT_TRUE(queue.TryPush([] {}));
+  EXPECT_FALSE(queue.TryPush([] {}));
+
+  finish.Send();
+}
+
+UTEST(BackgroundJobQueue, Exception) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  concurrent::BackgroundJobQueue queue(task_processor, "test", 1, 10);
+
+  engine::SingleConsumerEvent event;
+  ASSERT_TRUE(queue.TryPush([] { throw std::runtime_error("failure"); }));
+  ASSERT_TRUE(queue.TryPush([&event] { event.Send(); }));
+
+  EXPECT_TRUE(event.WaitForEventFor(utest::kMaxTestWaitTime));
+}
+
+UTEST(BackgroundJobQueue, CancelAndWait) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  concurrent::BackgroundJobQueue queue(task_processor, "test", 1, 10);
+
+  std::atomic<bool> cancelled{false};
+  engine::SingleConsumerEvent started;
+  ASSERT_TRUE(queue.TryPush([&] {
+    started.Send();
+    engine::SingleConsumerEvent event;
+    cancelled = !event.WaitForEventFor(utest::kMaxTestWaitTime);
+  }));
+  std::atomic<bool> dropped_job_started{false};
+  ASSERT_TRUE(queue.TryPush([&] { dropped_job_started = true; }));
+
+  ASSERT_TRUE(started.WaitForEventFor(utest::kMaxTestWaitTime));
+  queue.CancelAndWait();
+
+  EXPECT_TRUE(cancelled);
+  EXPECT_FALSE(dropped_job_started);
+}
+
+USERVER_NAMESPACE_END
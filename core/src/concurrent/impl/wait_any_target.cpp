@@ -0,0 +1,66 @@
+#include <userver/concurrent/impl/wait_any_target.hpp>
+
+#include <algorithm>
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+namespace {
+
+constexpr bool kAdopt = false;
+
+}  // namespace
+
+WaitAnyTarget::WaitAnyTarget() noexcept = default;
+
+WaitAnyTarget::~WaitAnyTarget() {
+  UASSERT_MSG(waiters_.empty(), "Someone is waiting on the queue");
+}
+
+void WaitAnyTarget::WakeupWaiters() {
+  // Pairs with the waiters_count_ increment in AppendWaiter(): either the
+  // waiter sees the new element in IsReady(), or we see the waiter
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters_count_.load(std::memory_order_relaxed) == 0) return;
+
+  const std::lock_guard lock{waiters_mutex_};
+  for (auto* waiter : waiters_) {
+    const boost::intrusive_ptr<engine::impl::TaskContext> context{waiter,
+                                                                  kAdopt};
+    context->Wakeup(engine::impl::TaskContext::WakeupSource::kWaitList,
+                    engine::impl::TaskContext::NoEpoch{});
+  }
+  waiters_.clear();
+}
+
+void WaitAnyTarget::AppendWaiter(engine::impl::TaskContext& context) noexcept {
+  waiters_count_.fetch_add(1);
+  const std::lock_guard lock{waiters_mutex_};
+  waiters_.push_back(
+      boost::intrusive_ptr<engine::impl::TaskContext>{&context}.detach());
+}
+
+void WaitAnyTarget::RemoveWaiter(engine::impl::TaskContext& context) noexcept {
+  {
+    const std::lock_guard lock{waiters_mutex_};
+    const auto it = std::find(waiters_.begin(), waiters_.end(), &context);
+    if (it != waiters_.end()) {
+      const boost::intrusive_ptr<engine::impl::TaskContext> adopted{*it,
+                                                                    kAdopt};
+      waiters_.erase(it);
+    }
+  }
+  waiters_count_.fetch_sub(1);
+}
+
+void WaitAnyTarget::RethrowErrorResult() const {}
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
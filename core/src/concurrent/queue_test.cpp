@@ -7,6 +7,8 @@
 
 #include <concurrent/mp_queue_test.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -17,6 +19,7 @@ namespace {
 constexpr std::size_t kProducersCount = 4;
 constexpr std::size_t kConsumersCount = 4;
 constexpr std::size_t kMessageCount = 1000;
+constexpr std::size_t kBatchSize = 10;
 
 template <typename Producer>
 auto GetProducerTask(const Producer& producer, std::size_t i) {
@@ -31,6 +34,9 @@ auto GetProducerTask(const Producer& producer, std::size_t i) {
 template <typename T>
 class NonCoroutineTest : public ::testing::Test {};
 
+template <typename T>
+class BatchTest : public ::testing::Test {};
+
 using TestMpmcTypes =
     testing::Types<concurrent::NonFifoMpmcQueue<int>,
                    concurrent::NonFifoMpmcQueue<std::unique_ptr<int>>,
@@ -83,6 +89,197 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   EXPECT_EQ(value, 2);
 }
 
+TYPED_UTEST_SUITE(BatchTest, TestQueueTypes);
+
+TYPED_UTEST(BatchTest, PushPopMany) {
+  auto queue = TypeParam::Create(10);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> values{0, 1, 2, 3, 4, 5};
+  EXPECT_TRUE(producer.PushMany(std::move(values)));
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(queue->GetSizeApproximate(), 6);
+
+  // The batch does not fit, the values stay intact
+  values = {6, 7, 8, 9, 10};
+  EXPECT_FALSE(
+      producer.PushMany(std::move(values), engine::Deadline::Passed()));
+  EXPECT_EQ(values.size(), 5);
+
+  std::vector<std::size_t> popped{100};
+  EXPECT_EQ(consumer.PopMany(popped, 4), 4);
+  EXPECT_EQ(popped, (std::vector<std::size_t>{100, 0, 1, 2, 3}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 2);
+
+  EXPECT_TRUE(producer.PushMany(std::move(values)));
+  EXPECT_EQ(queue->GetSizeApproximate(), 7);
+
+  popped.clear();
+  EXPECT_EQ(consumer.PopMany(popped, 100), 7);
+  EXPECT_EQ(popped, (std::vector<std::size_t>{4, 5, 6, 7, 8, 9, 10}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+
+  EXPECT_EQ(consumer.PopMany(popped, 100, engine::Deadline::Passed()), 0);
+  EXPECT_EQ(popped.size(), 7);
+}
+
+TYPED_UTEST(BatchTest, PopManyWaitsForFirst) {
+  auto queue = TypeParam::Create();
+  auto consumer = queue->GetConsumer();
+  std::optional producer(queue->GetProducer());
+
+  auto task = utils::Async("consumer", [&consumer] {
+    std::vector<std::size_t> popped;
+    EXPECT_EQ(consumer.PopMany(popped, 10), 3);
+    EXPECT_EQ(popped, (std::vector<std::size_t>{1, 2, 3}));
+
+    // Returns 0 once the producer is dead
+    EXPECT_EQ(consumer.PopMany(popped, 10), 0);
+  });
+
+  engine::Yield();
+  EXPECT_TRUE(producer->PushMany({1, 2, 3}));
+  engine::Yield();
+  producer.reset();
+
+  UEXPECT_NO_THROW(task.Get());
+}
+
+TYPED_UTEST(BatchTest, PushManyWaitsForCapacity) {
+  auto queue = TypeParam::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  EXPECT_TRUE(producer.PushMany({0, 1, 2}));
+
+  auto task = utils::Async("producer", [&producer] {
+    return producer.PushMany({3, 4, 5});
+  });
+
+  std::size_t value{};
+  EXPECT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(value, 1);
+
+  EXPECT_TRUE(task.Get());
+
+  std::vector<std::size_t> popped;
+  EXPECT_EQ(consumer.PopMany(popped, 10), 4);
+  EXPECT_EQ(popped, (std::vector<std::size_t>{2, 3, 4, 5}));
+}
+
+UTEST(NonFifoMpmcQueue, WaitAny) {
+  using Queue = concurrent::NonFifoMpmcQueue<int>;
+  auto queue1 = Queue::Create();
+  auto queue2 = Queue::Create();
+  auto producer1 = queue1->GetProducer();
+  std::optional producer2(queue2->GetProducer());
+  auto consumer1 = queue1->GetConsumer();
+  auto consumer2 = queue2->GetConsumer();
+
+  EXPECT_EQ(engine::WaitAnyFor(std::chrono::milliseconds{10}, consumer1,
+                               consumer2),
+            std::nullopt);
+
+  auto task = utils::Async("producer", [&producer1] {
+    engine::SleepFor(std::chrono::milliseconds{10});
+    return producer1.Push(1);
+  });
+  EXPECT_EQ(engine::WaitAny(consumer1, consumer2), 0);
+  EXPECT_TRUE(task.Get());
+
+  int value{};
+  EXPECT_TRUE(consumer1.PopNoblock(value));
+  EXPECT_EQ(value, 1);
+
+  // A queue with dead producers is ready, Pop will not block on it
+  producer2.reset();
+  EXPECT_EQ(engine::WaitAny(consumer1, consumer2), 1);
+  EXPECT_FALSE(consumer2.Pop(value));
+}
+
+UTEST_MT(NonFifoMpmcQueue, WaitAnyMultiConsumer, 3) {
+  using Queue = concurrent::NonFifoMpmcQueue<int>;
+  auto queue1 = Queue::Create();
+  auto queue2 = Queue::Create();
+  auto producer = queue2->GetMultiProducer();
+  std::vector<Queue::MultiConsumer> consumers;
+  consumers.push_back(queue1->GetMultiConsumer());
+  consumers.push_back(queue2->GetMultiConsumer());
+
+  auto waiters = utils::GenerateFixedArray(2, [&](std::size_t) {
+    return utils::Async("waiter", [&] { return engine::WaitAny(consumers); });
+  });
+
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_TRUE(producer.PushMany({1, 2}));
+
+  for (auto& waiter : waiters) {
+    EXPECT_EQ(waiter.Get(), 1);
+  }
+  std::vector<int> popped;
+  EXPECT_EQ(consumers[1].PopMany(popped, 10), 2);
+}
+
+UTEST_MT(NonFifoMpmcQueue, MpmcBatches, kProducersCount + kConsumersCount) {
+  auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kBatchSize);
+  std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [&producer = producers[i], i] {
+          std::vector<std::size_t> batch;
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            batch.push_back(message);
+            if (batch.size() == kBatchSize) {
+              ASSERT_TRUE(producer.PushMany(std::move(batch)));
+            }
+          }
+          ASSERT_TRUE(producer.PushMany(std::move(batch)));
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetMultiConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopMany(values, kBatchSize) != 0) {
+            EXPECT_LE(values.size(), kBatchSize);
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
   auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
   auto producer = queue->GetProducer();
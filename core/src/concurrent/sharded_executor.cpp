@@ -0,0 +1,138 @@
+#include <userver/concurrent/sharded_executor.hpp>
+
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/mpsc_queue.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+namespace impl {
+
+ShardedJob::~ShardedJob() = default;
+
+}  // namespace impl
+
+class ShardedExecutor::Shard final {
+ public:
+  Shard(engine::TaskProcessor& task_processor, const Settings& settings)
+      : mailbox_(Mailbox::Create(settings.max_mailbox_size)),
+        producer_(mailbox_->GetMultiProducer()),
+        consumer_task_(engine::CriticalAsyncNoSpan(
+            task_processor,
+            [this, consumer = mailbox_->GetConsumer(),
+             max_batch_size = settings.max_batch_size] {
+              Consume(consumer, max_batch_size);
+            })) {}
+
+  ~Shard() {
+    // The consumer runs the remaining jobs and stops once there are no
+    // producers left
+    producer_.reset();
+    consumer_task_.Wait();
+  }
+
+  bool Post(std::unique_ptr<impl::ShardedJob>&& job,
+            engine::Deadline deadline) {
+    return Account(producer_->Push(std::move(job), deadline));
+  }
+
+  bool TryPost(std::unique_ptr<impl::ShardedJob>&& job) {
+    return Account(producer_->PushNoblock(std::move(job)));
+  }
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const Shard& shard) {
+    writer["mailbox-size"] = shard.mailbox_->GetSizeApproximate();
+    writer["posted"] = shard.posted_;
+    writer["rejected"] = shard.rejected_;
+    writer["processed"] = shard.processed_;
+    writer["batches"] = shard.batches_;
+  }
+
+ private:
+  using Mailbox = MpscQueue<std::unique_ptr<impl::ShardedJob>>;
+
+  bool Account(bool is_posted) noexcept {
+    ++(is_posted ? posted_ : rejected_);
+    return is_posted;
+  }
+
+  void Consume(const Mailbox::Consumer& consumer, std::size_t max_batch_size) {
+    std::unique_ptr<impl::ShardedJob> job;
+    while (consumer.Pop(job)) {
+      std::size_t batch_size = 0;
+      do {
+        Run(*job);
+        job.reset();
+      } while (++batch_size < max_batch_size && consumer.PopNoblock(job));
+
+      processed_ += utils::statistics::Rate{batch_size};
+      ++batches_;
+      // Let the other tasks of the shard task processor run between batches
+      engine::Yield();
+    }
+  }
+
+  static void Run(impl::ShardedJob& job) noexcept {
+    try {
+      job.Run();
+    } catch (const std::exception& e) {
+      LOG_ERROR() << "Unhandled exception in a sharded executor job: " << e;
+    }
+  }
+
+  std::shared_ptr<Mailbox> mailbox_;
+  std::optional<Mailbox::MultiProducer> producer_;
+
+  utils::statistics::RateCounter posted_;
+  utils::statistics::RateCounter rejected_;
+  utils::statistics::RateCounter processed_;
+  utils::statistics::RateCounter batches_;
+
+  engine::TaskWithResult<void> consumer_task_;
+};
+
+ShardedExecutor::ShardedExecutor(engine::SingleThreadedTaskProcessorsPool& pool,
+                                 Settings settings) {
+  UINVARIANT(pool.GetSize() != 0, "ShardedExecutor requires a non-empty pool");
+  UINVARIANT(settings.max_batch_size != 0, "max_batch_size must be positive");
+
+  shards_.reserve(pool.GetSize());
+  for (std::size_t i = 0; i < pool.GetSize(); ++i) {
+    shards_.push_back(std::make_unique<Shard>(pool.At(i), settings));
+  }
+}
+
+ShardedExecutor::~ShardedExecutor() = default;
+
+bool ShardedExecutor::DoPost(std::size_t shard_index,
+                             std::unique_ptr<impl::ShardedJob>&& job,
+                             engine::Deadline deadline) {
+  return shards_[shard_index]->Post(std::move(job), deadline);
+}
+
+bool ShardedExecutor::DoTryPost(std::size_t shard_index,
+                                std::unique_ptr<impl::ShardedJob>&& job) {
+  return shards_[shard_index]->TryPost(std::move(job));
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ShardedExecutor& executor) {
+  for (std::size_t i = 0; i < executor.shards_.size(); ++i) {
+    writer.ValueWithLabels(*executor.shards_[i], {"shard", std::to_string(i)});
+  }
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,143 @@
+#include <userver/concurrent/sharded_executor.hpp>
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/future.hpp>
+#include <userver/engine/single_use_event.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kShards = 4;
+
+/// [Sample concurrent::ShardedExecutor usage]
+class OrderBooks final {
+ public:
+  explicit OrderBooks(engine::SingleThreadedTaskProcessorsPool& pool)
+      : volumes_(pool.GetSize()), executor_(pool, {}) {}
+
+  void AddOrder(const std::string& instrument, int volume) {
+    // All the orders of an instrument are handled by the same shard
+    const bool posted = executor_.Post(instrument, [this, instrument, volume] {
+      GetShardVolumes(instrument)[instrument] += volume;
+    });
+    if (!posted) throw std::runtime_error("Failed to post an order");
+  }
+
+  int GetVolume(const std::string& instrument) {
+    engine::Promise<int> promise;
+    auto future = promise.get_future();
+    const bool posted = executor_.Post(
+        instrument, [this, instrument, promise = std::move(promise)]() mutable {
+          promise.set_value(GetShardVolumes(instrument)[instrument]);
+        });
+    if (!posted) throw std::runtime_error("Failed to post a query");
+    return future.get();
+  }
+
+ private:
+  // Only the jobs of a shard touch its volumes, no mutex is required
+  std::unordered_map<std::string, int>& GetShardVolumes(
+      const std::string& instrument) {
+    return volumes_[executor_.GetShardIndex(instrument)];
+  }
+
+  // Outlives the executor, which runs the remaining jobs on destruction
+  std::vector<std::unordered_map<std::string, int>> volumes_;
+  concurrent::ShardedExecutor executor_;
+};
+/// [Sample concurrent::ShardedExecutor usage]
+
+}  // namespace
+
+UTEST(ShardedExecutor, SameKeySameThreadInOrder) {
+  auto pool = engine::SingleThreadedTaskProcessorsPool::MakeForTests(kShards);
+
+  constexpr int kKeys = 10;
+  constexpr int kJobsPerKey = 100;
+  std::array<std::vector<int>, kKeys> sequences;
+  std::array<std::vector<std::thread::id>, kKeys> threads;
+
+  {
+    concurrent::ShardedExecutor executor(pool, {});
+    EXPECT_EQ(executor.GetShardsCount(), kShards);
+
+    for (int i = 0; i < kJobsPerKey; ++i) {
+      for (int key = 0; key < kKeys; ++key) {
+        ASSERT_TRUE(executor.Post(key, [&sequences, &threads, key, i] {
+          sequences[key].push_back(i);
+          threads[key].push_back(std::this_thread::get_id());
+        }));
+      }
+    }
+    // The destructor runs the remaining jobs
+  }
+
+  for (int key = 0; key < kKeys; ++key) {
+    ASSERT_EQ(sequences[key].size(), static_cast<std::size_t>(kJobsPerKey));
+    for (int i = 0; i < kJobsPerKey; ++i) {
+      EXPECT_EQ(sequences[key][i], i);
+      EXPECT_EQ(threads[key][i], threads[key][0]);
+    }
+  }
+}
+
+UTEST(ShardedExecutor, BoundedMailbox) {
+  auto pool = engine::SingleThreadedTaskProcessorsPool::MakeForTests(1);
+  concurrent::ShardedExecutor executor(
+      pool, {/*max_mailbox_size=*/1, /*max_batch_size=*/64});
+
+  engine::SingleUseEvent started;
+  engine::SingleUseEvent released;
+  ASSERT_TRUE(executor.TryPost(0, [&] {
+    started.Send();
+    released.WaitNonCancellable();
+  }));
+  started.WaitNonCancellable();
+
+  int processed = 0;
+  EXPECT_TRUE(executor.TryPost(0, [&processed] { ++processed; }));
+  EXPECT_FALSE(executor.TryPost(0, [&processed] { ++processed; }));
+  EXPECT_FALSE(executor.Post(
+      0, [&processed] { ++processed; },
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "executor", [&executor](utils::statistics::Writer& writer) {
+        writer = executor;
+      });
+  const utils::statistics::Snapshot snapshot{storage, "executor",
+                                             {{"shard", "0"}}};
+  EXPECT_EQ(snapshot.SingleMetric("posted").AsRate().value, 2);
+  EXPECT_EQ(snapshot.SingleMetric("rejected").AsRate().value, 2);
+  EXPECT_EQ(snapshot.SingleMetric("mailbox-size").AsInt(), 1);
+
+  released.Send();
+  holder.Unregister();
+}
+
+UTEST(ShardedExecutor, Sample) {
+  auto pool = engine::SingleThreadedTaskProcessorsPool::MakeForTests(kShards);
+  OrderBooks books(pool);
+  for (int i = 0; i < 10; ++i) {
+    books.AddOrder("first", 1);
+    books.AddOrder("second", 2);
+  }
+
+  EXPECT_EQ(books.GetVolume("first"), 10);
+  EXPECT_EQ(books.GetVolume("second"), 20);
+  EXPECT_EQ(books.GetVolume("third"), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,17 @@
+#include <userver/concurrent/single_flight.hpp>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const SingleFlightStatistics& stats) {
+  writer["calls"] = stats.calls;
+  writer["coalesced"] = stats.coalesced;
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
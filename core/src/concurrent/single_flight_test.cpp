@@ -0,0 +1,141 @@
+#include <userver/concurrent/single_flight.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using SingleFlight = concurrent::SingleFlight<std::string, int>;
+
+// Waits until `count` callers have joined the computations
+void WaitForCallers(const SingleFlight& single_flight, std::size_t count) {
+  while (single_flight.GetStatistics().calls.Load().value < count) {
+    engine::Yield();
+  }
+}
+
+}  // namespace
+
+UTEST_MT(SingleFlight, Coalescing, 4) {
+  /// [Sample SingleFlight usage]
+  SingleFlight single_flight;
+  std::atomic<int> computations{0};
+  engine::SingleConsumerEvent release;
+
+  std::vector<engine::TaskWithResult<int>> callers;
+  for (int i = 0; i < 8; ++i) {
+    callers.push_back(utils::Async("caller", [&] {
+      return single_flight.Execute("key", [&] {
+        ++computations;
+        EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+        return 42;
+      });
+    }));
+  }
+  /// [Sample SingleFlight usage]
+
+  WaitForCallers(single_flight, callers.size());
+  release.Send();
+  for (auto& caller : callers) EXPECT_EQ(caller.Get(), 42);
+
+  EXPECT_EQ(computations, 1);
+  EXPECT_EQ(single_flight.GetStatistics().calls.Load().value, 8);
+  EXPECT_EQ(single_flight.GetStatistics().coalesced.Load().value, 7);
+}
+
+UTEST(SingleFlight, DifferentKeys) {
+  SingleFlight single_flight;
+  std::atomic<int> computations{0};
+
+  auto first = utils::Async("caller", [&] {
+    return single_flight.Execute("first", [&] { return ++computations; });
+  });
+  auto second = utils::Async("caller", [&] {
+    return single_flight.Execute("second", [&] { return ++computations; });
+  });
+  EXPECT_NE(first.Get(), second.Get());
+  EXPECT_EQ(computations, 2);
+}
+
+UTEST(SingleFlight, NoCaching) {
+  SingleFlight single_flight;
+  int computations = 0;
+  EXPECT_EQ(single_flight.Execute("key", [&] { return ++computations; }), 1);
+  EXPECT_EQ(single_flight.Execute("key", [&] { return ++computations; }), 2);
+  EXPECT_EQ(single_flight.GetStatistics().coalesced.Load().value, 0);
+}
+
+UTEST(SingleFlight, SharedException) {
+  SingleFlight single_flight;
+  engine::SingleConsumerEvent release;
+
+  auto caller = [&] {
+    return single_flight.Execute("key", [&]() -> int {
+      EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+      throw std::runtime_error("failure");
+    });
+  };
+  auto first = utils::Async("caller", caller);
+  auto second = utils::Async("caller", caller);
+
+  WaitForCallers(single_flight, 2);
+  release.Send();
+  UEXPECT_THROW(first.Get(), std::runtime_error);
+  UEXPECT_THROW(second.Get(), std::runtime_error);
+  EXPECT_EQ(single_flight.GetStatistics().coalesced.Load().value, 1);
+}
+
+UTEST(SingleFlight, CancelledCaller) {
+  SingleFlight single_flight;
+  engine::SingleConsumerEvent release;
+
+  auto caller = [&] {
+    return single_flight.Execute("key", [&] {
+      EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+      return 42;
+    });
+  };
+  auto cancelled = utils::Async("caller", caller);
+  auto waiting = utils::Async("caller", caller);
+  WaitForCallers(single_flight, 2);
+
+  // Other callers keep the computation running
+  cancelled.SyncCancel();
+  release.Send();
+  EXPECT_EQ(waiting.Get(), 42);
+}
+
+UTEST(SingleFlight, AllCallersCancelled) {
+  SingleFlight single_flight;
+  std::atomic<bool> is_computation_cancelled{false};
+
+  auto caller = [&] {
+    return single_flight.Execute("key", [&] {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+      is_computation_cancelled = engine::current_task::ShouldCancel();
+      return 42;
+    });
+  };
+  auto first = utils::Async("caller", caller);
+  auto second = utils::Async("caller", caller);
+  WaitForCallers(single_flight, 2);
+
+  first.SyncCancel();
+  second.SyncCancel();
+  EXPECT_TRUE(is_computation_cancelled);
+
+  // A new computation is started afterwards
+  EXPECT_EQ(single_flight.Execute("key", [] { return 1; }), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+constexpr std::size_t kCurrentLoadEpochs = 3;
+constexpr std::size_t kLongTimingsEpochs = 30;
+
+constexpr double kMinGradient = 0.5;
+// Errors decrease the limit even if the timings are fine
+constexpr double kErrorsGradient = 0.9;
+// Weight of the new limit in the smoothed one
+constexpr double kLimitSmoothing = 0.2;
+}  // namespace
+
+GradientController::GradientController(
+    const std::string& name, v2::Sensor& sensor, Limiter& limiter, Stats& stats,
+    const StaticConfig& config, dynamic_config::Source config_source,
+    std::function<GradientConfig(const dynamic_config::Snapshot&)>
+        config_getter)
+    : Controller(name, sensor, limiter, stats, config),
+      current_load_(kCurrentLoadEpochs),
+      long_timings_(kLongTimingsEpochs),
+      config_source_(config_source),
+      config_getter_(std::move(config_getter)) {}
+
+Limit GradientController::Update(const Sensor::Data& current) {
+  const auto config = config_getter_(config_source_.GetSnapshot());
+  SetEnabled(config.enabled);
+
+  current_load_.Update(current.current_load);
+  const auto current_load = current_load_.GetSmoothed();
+
+  if (current.total < config.min_qps && !limit_) {
+    // Too little QPS, timings avg data is VERY noisy
+    return {std::nullopt, current.current_load};
+  }
+
+  if (epochs_passed_ < kLongTimingsEpochs) {
+    // First seconds of service life might be too noisy
+    epochs_passed_++;
+    long_timings_.Update(current.timings_avg_ms);
+    return {std::nullopt, current.current_load};
+  }
+
+  const auto long_timings = std::max<double>(long_timings_.GetSmoothed(),
+                                             config.min_timings.count());
+  const auto timings = std::max<double>(current.timings_avg_ms, 1);
+  auto gradient = std::clamp(config.tolerance * long_timings / timings,
+                             kMinGradient, 1.0);
+  if (100 * current.GetRate() > config.errors_threshold_percent) {
+    gradient = std::min(gradient, kErrorsGradient);
+  }
+  const bool overloaded = gradient < 1.0;
+
+  LOG_DEBUG() << "CC " << GetName() << ": sensor=(" << current.ToLogString()
+              << ") long_timings=" << long_timings << " gradient=" << gradient;
+
+  if (!overloaded) {
+    // Sticky to "good" timings
+    long_timings_.Update(current.timings_avg_ms);
+  }
+
+  if (!limit_) {
+    if (!overloaded) return {std::nullopt, current.current_load};
+    LOG_ERROR() << GetName() << " Congestion Control is activated";
+    limit_ = current_load;
+  }
+
+  const auto new_limit =
+      overloaded ? *limit_ * gradient : *limit_ + std::sqrt(*limit_);
+  *limit_ = *limit_ * (1 - kLimitSmoothing) + new_limit * kLimitSmoothing;
+
+  if (!overloaded && *limit_ > current_load + config.safe_delta_limit) {
+    LOG_ERROR() << GetName() << " Congestion Control is deactivated";
+    limit_.reset();
+    return {std::nullopt, current.current_load};
+  }
+
+  limit_ = std::max<double>(*limit_, config.min_limit);
+  return {static_cast<std::size_t>(*limit_), current.current_load};
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,28 @@
+#include <userver/congestion_control/controllers/gradient_config.hpp>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+GradientConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<GradientConfig>) {
+  GradientConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.tolerance = value["tolerance"].As<double>(config.tolerance);
+  config.errors_threshold_percent =
+      value["errors-threshold-percent"].As<double>(
+          config.errors_threshold_percent);
+  config.min_timings = std::chrono::milliseconds{
+      value["min-timings-ms"].As<std::size_t>(config.min_timings.count())};
+  config.min_limit = value["min-limit"].As<std::size_t>(config.min_limit);
+  config.min_qps = value["min-qps"].As<std::size_t>(config.min_qps);
+  config.safe_delta_limit =
+      value["deactivate-delta"].As<std::size_t>(config.safe_delta_limit);
+  return config;
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+  void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Stats stats;
+FakeSensor sensor;
+FakeLimiter limiter;
+
+congestion_control::v2::GradientController MakeController() {
+  return {"test",
+          sensor,
+          limiter,
+          stats,
+          {},
+          dynamic_config::GetDefaultSource(),
+          [](auto) { return congestion_control::v2::GradientConfig{}; }};
+}
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t timings_avg_ms,
+                                              std::size_t current_load) {
+  congestion_control::v2::Sensor::Data data;
+  data.total = 1000;
+  data.timings_avg_ms = timings_avg_ms;
+  data.current_load = current_load;
+  return data;
+}
+
+}  // namespace
+
+TEST(CCGradient, StableTimings) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 1000; i++) {
+    auto limit = controller.Update(MakeData(100, 100 + i % 10));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, QuickRequestsJitter) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 1000; i++) {
+    // Grows many times, but stays below min-timings-ms
+    auto limit = controller.Update(MakeData(i % 2 ? 1 : 15, 100));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, SlowdownAndRecovery) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 30; i++) {
+    auto limit = controller.Update(MakeData(100, 100));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+
+  auto limit = controller.Update(MakeData(1000, 100));
+  ASSERT_TRUE(limit.load_limit);
+  auto previous_limit = *limit.load_limit;
+  EXPECT_LT(previous_limit, 100);
+
+  for (size_t i = 0; i < 10; i++) {
+    limit = controller.Update(MakeData(1000, previous_limit));
+    ASSERT_TRUE(limit.load_limit) << i;
+    EXPECT_LE(*limit.load_limit, previous_limit) << i;
+    previous_limit = *limit.load_limit;
+  }
+  EXPECT_GE(previous_limit, congestion_control::v2::GradientConfig{}.min_limit);
+
+  // Timings are back to normal, the load is below the limit
+  for (size_t i = 0; i < 100 && limit.load_limit; i++) {
+    limit = controller.Update(MakeData(100, 5));
+  }
+  EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
+USERVER_NAMESPACE_END
@@ -66,6 +66,13 @@ Limit LinearController::Update(const Sensor::Data& current) {
     long_timings_.Update(current.timings_avg_ms);
   }
 
+  if (current.server_wait_percent &&
+      *current.server_wait_percent > config.server_wait_threshold_percent) {
+    // The server is overloaded before the timeouts and timings show it, maybe
+    // by the other instances
+    overloaded = true;
+  }
+
   if (overloaded) {
     if (current_limit_) {
       *current_limit_ = *current_limit_ * 0.95;
@@ -15,6 +15,8 @@ Config::Config(formats::json::Value config) {
       std::chrono::milliseconds(config["min-timings-ms"].As<std::size_t>(20));
   min_limit = config["min-limit"].As<std::size_t>(10);
   min_qps = config["min-qps"].As<std::size_t>(10);
+  server_wait_threshold_percent =
+      config["server-wait-threshold-percent"].As<double>(50.0);
 }
 
 }  // namespace congestion_control::v2
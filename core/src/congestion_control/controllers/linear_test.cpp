@@ -156,6 +156,40 @@ TEST(CCLinear, ExtraLoad) {
   }
 }
 
+TEST(CCLinear, ServerWait) {
+  congestion_control::v2::LinearController controller(
+      "test", sensor, limiter, stats, {}, dynamic_config::GetDefaultSource(),
+      [](auto) { return congestion_control::v2::Config(); });
+
+  congestion_control::v2::Sensor::Data data;
+  data.timings_avg_ms = 100;
+  data.total = 100;
+  data.current_load = 50;
+  data.server_wait_percent = 10;
+
+  // Init
+  for (size_t i = 0; i < 31; i++) {
+    auto limit = controller.Update(data);
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+
+  // The server is overloaded, while the timings are still fine
+  data.server_wait_percent = 80;
+  auto limit = controller.Update(data);
+  ASSERT_NE(limit.load_limit, std::nullopt);
+  EXPECT_EQ(*limit.load_limit, 50);
+
+  limit = controller.Update(data);
+  ASSERT_NE(limit.load_limit, std::nullopt);
+  EXPECT_LT(*limit.load_limit, 50);
+
+  // The server load is unknown
+  data.server_wait_percent.reset();
+  data.current_load = 10;
+  limit = controller.Update(data);
+  EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
 TEST(CCLinear, MinMax) {
   congestion_control::v2::LinearController controller(
       "test", sensor, limiter, stats, {}, dynamic_config::GetDefaultSource(),
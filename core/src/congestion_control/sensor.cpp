@@ -17,8 +17,13 @@ double Sensor::Data::GetLoadPercent() const {
 namespace v2 {
 
 std::string Sensor::Data::ToLogString() const {
-  return fmt::format("events={}/{} timings_avg={}ms current_load={}", timeouts,
-                     total, timings_avg_ms, current_load);
+  auto result =
+      fmt::format("events={}/{} timings_avg={}ms current_load={}", timeouts,
+                  total, timings_avg_ms, current_load);
+  if (server_wait_percent) {
+    result += fmt::format(" server_wait={}%", *server_wait_percent);
+  }
+  return result;
 }
 
 }  // namespace v2
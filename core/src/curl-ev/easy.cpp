@@ -21,6 +21,7 @@
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
+#include <openssl/ssl.h>
 
 #include <engine/ev/thread_control.hpp>
 #include <server/net/listener_impl.hpp>
@@ -139,6 +140,11 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
   return std::make_shared<easy>(cloned, &multi_handle);
 }
 
+void easy::rebind(multi& multi_handle) {
+  UASSERT(!multi_registered_);
+  multi_ = &multi_handle;
+}
+
 easy* easy::from_native(native::CURL* native_easy) {
   easy* easy_handle = nullptr;
   native::curl_easy_getinfo(native_easy, native::CURLINFO_PRIVATE,
@@ -229,6 +235,20 @@ void easy::do_ev_cancel(size_t request_num) {
   }
 }
 
+void easy::unpause() {
+  if (multi_) {
+    multi_->GetThreadControl().RunInEvLoopAsync(
+        [self = shared_from_this(), this] { do_ev_unpause(); });
+  }
+}
+
+void easy::do_ev_unpause() {
+  // The transfer may be already finished
+  if (multi_registered_) {
+    native::curl_easy_pause(handle_, CURLPAUSE_CONT);
+  }
+}
+
 void easy::reset() {
   LOG_TRACE() << "easy::reset start " << this;
 
@@ -603,7 +623,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
   share_ = std::move(share);
 
-  if (share) {
+  if (share_) {
     ec = std::error_code{
         static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
             handle_, native::CURLOPT_SHARE, share_->native_handle()))};
@@ -628,6 +648,15 @@ void easy::handle_completion(const std::error_code& err) {
 
   multi_registered_ = false;
 
+  if (!err && multi_) {
+    // No new connections were made by the transfer
+    long connects = 0;
+    native::curl_easy_getinfo(handle_, native::CURLINFO_NUM_CONNECTS,
+                              &connects);
+    multi_->Statistics().mark_transfer_completed(connects == 0);
+    if (connects != 0) account_tls_handshake();
+  }
+
   auto handler = std::function<void(std::error_code)>([](std::error_code) {});
   swap(handler, handler_);
 
@@ -638,6 +667,29 @@ void easy::handle_completion(const std::error_code& err) {
   handler(err);
 }
 
+void easy::account_tls_handshake() {
+  native::curl_off_t connect_us = 0;
+  native::curl_off_t appconnect_us = 0;
+  native::curl_easy_getinfo(handle_, native::CURLINFO_CONNECT_TIME_T,
+                            &connect_us);
+  native::curl_easy_getinfo(handle_, native::CURLINFO_APPCONNECT_TIME_T,
+                            &appconnect_us);
+  // Zero for the plain connections
+  if (appconnect_us <= 0) return;
+
+  bool resumed = false;
+  native::curl_tlssessioninfo* session_info = nullptr;
+  if (native::curl_easy_getinfo(handle_, native::CURLINFO_TLS_SSL_PTR,
+                                &session_info) == native::CURLE_OK &&
+      session_info && session_info->backend == native::CURLSSLBACKEND_OPENSSL &&
+      session_info->internals) {
+    resumed = SSL_session_reused(static_cast<SSL*>(session_info->internals));
+  }
+
+  multi_->Statistics().mark_tls_handshake(
+      std::chrono::microseconds{appconnect_us - connect_us}, resumed);
+}
+
 void easy::mark_retry() { ++retries_count_; }
 
 clients::http::LocalStats easy::get_local_stats() {
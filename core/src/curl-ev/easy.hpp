@@ -169,6 +169,8 @@ class easy final : public std::enable_shared_from_this<easy> {
   std::shared_ptr<easy> GetBoundBlocking(multi&) const;
 
   const multi* GetMulti() const { return multi_; }
+  // Moves the handle that is not being performed to another multi
+  void rebind(multi& multi_handle);
 
   inline native::CURL* native_handle() { return handle_; }
   engine::ev::ThreadControl& GetThreadControl();
@@ -177,6 +179,8 @@ class easy final : public std::enable_shared_from_this<easy> {
   void perform(std::error_code& ec);
   void async_perform(handler_type handler);
   void cancel();
+  // resumes the transfer paused by a read or write callback
+  void unpause();
   void reset();
   void set_source(std::shared_ptr<std::istream> source);
   void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
@@ -748,6 +752,7 @@ class easy final : public std::enable_shared_from_this<easy> {
 
   native::curl_socket_t open_tcp_socket(native::curl_sockaddr* address);
   void cancel(size_t request_num);
+  void account_tls_handshake();
 
   static size_t write_function(char* ptr, size_t size, size_t nmemb,
                                void* userdata) noexcept;
@@ -767,6 +772,7 @@ class easy final : public std::enable_shared_from_this<easy> {
   // do_ev_* methods run in libev thread
   void do_ev_async_perform(handler_type handler, size_t request_num);
   void do_ev_cancel(size_t request_num);
+  void do_ev_unpause();
 
   void mark_start_performing();
   void mark_open_socket();
@@ -14,6 +14,18 @@ void MultiStatistics::mark_close_socket() { close_++; }
 
 void MultiStatistics::mark_socket_ratelimited() { ratelimited_++; }
 
+void MultiStatistics::mark_transfer_completed(bool reused_connection) {
+  transfers_++;
+  if (reused_connection) reused_connections_++;
+}
+
+void MultiStatistics::mark_tls_handshake(std::chrono::microseconds duration,
+                                         bool resumed) {
+  tls_handshakes_++;
+  if (resumed) tls_resumed_++;
+  tls_handshake_time_us_ += duration.count();
+}
+
 long long MultiStatistics::open_socket_total() const { return open_.load(); }
 
 long long MultiStatistics::close_socket_total() const { return close_.load(); }
@@ -22,6 +34,24 @@ long long MultiStatistics::socket_ratelimited_total() const {
   return ratelimited_.load();
 }
 
+long long MultiStatistics::transfer_total() const { return transfers_.load(); }
+
+long long MultiStatistics::reused_connection_total() const {
+  return reused_connections_.load();
+}
+
+long long MultiStatistics::tls_handshake_total() const {
+  return tls_handshakes_.load();
+}
+
+long long MultiStatistics::tls_resumed_total() const {
+  return tls_resumed_.load();
+}
+
+long long MultiStatistics::tls_handshake_time_us_total() const {
+  return tls_handshake_time_us_.load();
+}
+
 utils::statistics::BusyStorage& MultiStatistics::get_busy_storage() {
   return busy_storage_;
 }
@@ -4,6 +4,7 @@
 #include <userver/utils/statistics/common.hpp>
 
 #include <atomic>
+#include <chrono>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -16,10 +17,17 @@ class MultiStatistics final {
   void mark_open_socket();
   void mark_close_socket();
   void mark_socket_ratelimited();
+  void mark_transfer_completed(bool reused_connection);
+  void mark_tls_handshake(std::chrono::microseconds duration, bool resumed);
 
   long long open_socket_total() const;
   long long close_socket_total() const;
   long long socket_ratelimited_total() const;
+  long long transfer_total() const;
+  long long reused_connection_total() const;
+  long long tls_handshake_total() const;
+  long long tls_resumed_total() const;
+  long long tls_handshake_time_us_total() const;
 
   utils::statistics::BusyStorage& get_busy_storage();
   const utils::statistics::BusyStorage& get_busy_storage() const;
@@ -28,6 +36,11 @@ class MultiStatistics final {
   std::atomic_llong open_{0};
   std::atomic_llong close_{0};
   std::atomic_llong ratelimited_{0};
+  std::atomic_llong transfers_{0};
+  std::atomic_llong reused_connections_{0};
+  std::atomic_llong tls_handshakes_{0};
+  std::atomic_llong tls_resumed_{0};
+  std::atomic_llong tls_handshake_time_us_{0};
   utils::statistics::BusyStorage busy_storage_;
 };
 
@@ -83,15 +83,16 @@ void share::set_user_data(void* user_data) {
   throw_error(ec, __func__);
 }
 
-void share::lock(native::CURL*, native::curl_lock_data,
+void share::lock(native::CURL*, native::curl_lock_data data,
                  native::curl_lock_access, void* userptr) {
   auto* self = static_cast<share*>(userptr);
-  self->mutex_.lock();
+  self->mutexes_.at(data).lock();
 }
 
-void share::unlock(native::CURL*, native::curl_lock_data, void* userptr) {
+void share::unlock(native::CURL*, native::curl_lock_data data,
+                   void* userptr) {
   auto* self = static_cast<share*>(userptr);
-  self->mutex_.unlock();
+  self->mutexes_.at(data).unlock();
 }
 
 }  // namespace curl
@@ -223,4 +223,51 @@ TEST(DumpCommon, ReadEntire) {
   }
 }
 
+namespace {
+
+struct FlatEntry final {
+  std::uint64_t id;
+  double weight;
+  char tag[4];
+};
+
+}  // namespace
+
+TEST(DumpCommon, TriviallyCopyableArray) {
+  std::vector<FlatEntry> entries;
+  for (std::uint64_t i = 0; i < 3000; ++i) {
+    entries.push_back({i, i * 0.5, {'a', 'b', 'c', static_cast<char>(i)}});
+  }
+
+  dump::MockWriter writer;
+  dump::WriteTriviallyCopyableArray(writer, entries);
+  dump::WriteTriviallyCopyableArray(writer, std::vector<int>{});
+
+  const auto data = std::move(writer).Extract();
+  EXPECT_EQ(data.size(), 2 + entries.size() * sizeof(FlatEntry) + 1);
+
+  dump::MockReader reader(data);
+  const auto result = dump::ReadTriviallyCopyableArray<FlatEntry>(reader);
+  EXPECT_TRUE(dump::ReadTriviallyCopyableArray<int>(reader).empty());
+  reader.Finish();
+
+  ASSERT_EQ(result.size(), entries.size());
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(result[i].id, entries[i].id);
+    EXPECT_EQ(result[i].weight, entries[i].weight);
+    EXPECT_EQ(std::string_view(result[i].tag, 4),
+              std::string_view(entries[i].tag, 4));
+  }
+}
+
+TEST(DumpCommon, TriviallyCopyableArrayTruncated) {
+  dump::MockWriter writer;
+  dump::WriteTriviallyCopyableArray(writer, std::vector<int>{1, 2, 3});
+  auto data = std::move(writer).Extract();
+  data.pop_back();
+
+  dump::MockReader reader(data);
+  UEXPECT_THROW(dump::ReadTriviallyCopyableArray<int>(reader), dump::Error);
+}
+
 USERVER_NAMESPACE_END
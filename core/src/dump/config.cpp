@@ -4,6 +4,7 @@
 
 #include <fmt/format.h>
 
+#include <compression/compressor.hpp>
 #include <userver/dynamic_config/value.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,9 +19,40 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kMemoryMapped = "memory-mapped";
+constexpr std::string_view kCompression = "compression";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr std::size_t kDefaultCompressionBlockSize = 4 * 1024 * 1024;
+constexpr std::size_t kDefaultCompressionParallelBlocks = 4;
+
+std::optional<CompressionConfig> ParseCompression(
+    const yaml_config::YamlConfig& config) {
+  if (config.IsMissing()) return std::nullopt;
+
+  CompressionConfig result{
+      config["encoding"].As<std::string>(
+          compression::IsSupported(compression::Encoding::kZstd) ? "zstd"
+                                                                 : "gzip"),
+      config["level"].As<std::optional<int>>(),
+      config["block-size"].As<std::size_t>(kDefaultCompressionBlockSize),
+      config["parallel-blocks"].As<std::size_t>(
+          kDefaultCompressionParallelBlocks),
+  };
+
+  const auto encoding = compression::EncodingFromString(result.encoding);
+  if (encoding == compression::Encoding::kBrotli ||
+      !compression::IsSupported(encoding)) {
+    throw std::logic_error(
+        fmt::format("{} dump compression is not supported", result.encoding));
+  }
+  if (result.block_size == 0 || result.parallel_blocks == 0) {
+    throw std::logic_error(
+        "dump compression block-size and parallel-blocks must be positive");
+  }
+  return result;
+}
 
 }  // namespace
 
@@ -67,6 +99,8 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_memory_mapped(config[kMemoryMapped].As<bool>(false)),
+      compression(ParseCompression(config[kCompression])),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +112,10 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (dump_is_encrypted && dump_is_memory_mapped) {
+    throw std::logic_error(fmt::format("{}: {} and {} can't be used together",
+                                       this->name, kEncrypted, kMemoryMapped));
+  }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
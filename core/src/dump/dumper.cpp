@@ -34,6 +34,7 @@
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dump/factory.hpp>
+#include <userver/dump/unsafe.hpp>
 #include <userver/testsuite/dump_control.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -86,6 +87,51 @@ Config ParseConfig(const components::ComponentConfig& config,
       context.FindComponent<components::DumpConfigurator>().GetDumpRoot()};
 }
 
+// Counts the data size before compression and encryption
+class CountingWriter final : public Writer {
+ public:
+  explicit CountingWriter(std::unique_ptr<Writer> base)
+      : base_(std::move(base)) {}
+
+  void Finish() override { base_->Finish(); }
+
+  std::size_t GetWrittenSize() const { return written_size_; }
+
+ private:
+  void WriteRaw(std::string_view data) override {
+    WriteStringViewUnsafe(*base_, data);
+    written_size_ += data.size();
+  }
+
+  const std::unique_ptr<Writer> base_;
+  std::size_t written_size_{0};
+};
+
+class CountingReader final : public Reader {
+ public:
+  explicit CountingReader(std::unique_ptr<Reader> base)
+      : base_(std::move(base)) {}
+
+  void Finish() override { base_->Finish(); }
+
+  std::size_t GetReadSize() const { return read_size_; }
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override {
+    const auto result = ReadUnsafeAtMost(*base_, max_size);
+    read_size_ += result.size();
+    return result;
+  }
+
+  void ReadRawInto(char* destination, std::size_t size) override {
+    ReadUnsafeInto(*base_, destination, size);
+    read_size_ += size;
+  }
+
+  const std::unique_ptr<Reader> base_;
+  std::size_t read_size_{0};
+};
+
 using NoAutoReset = engine::SingleConsumerEvent::NoAutoReset;
 
 enum class SignalStatus {
@@ -424,15 +470,16 @@ void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
 
   const auto dump_stats = dump_data.locator.RegisterNewDump(update_time);
   const auto& dump_path = dump_stats.full_path;
-  auto writer = dump_data.rw_factory->CreateWriter(dump_path, scope);
-  dump_data.dumpable.GetAndWrite(*writer);
-  writer->Finish();
+  CountingWriter writer{dump_data.rw_factory->CreateWriter(dump_path, scope)};
+  dump_data.dumpable.GetAndWrite(writer);
+  writer.Finish();
   const auto dump_size = boost::filesystem::file_size(dump_path);
 
   LOG_INFO() << Name() << ": a new dump has been written at \"" << dump_path
              << '"';
 
   statistics_.last_written_size = dump_size;
+  statistics_.last_written_raw_size = writer.GetWrittenSize();
   statistics_.last_nontrivial_write_duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::steady_clock::now() - dump_start);
@@ -459,10 +506,11 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(
           auto dump_stats = dump_data.locator.GetLatestDump();
           if (!dump_stats) return std::optional<TimePoint>{};
 
-          auto reader =
-              dump_data.rw_factory->CreateReader(dump_stats->full_path);
-          dump_data.dumpable.ReadAndSet(*reader);
-          reader->Finish();
+          CountingReader reader{
+              dump_data.rw_factory->CreateReader(dump_stats->full_path)};
+          dump_data.dumpable.ReadAndSet(reader);
+          reader.Finish();
+          statistics_.loaded_raw_size = reader.GetReadSize();
 
           LOG_INFO() << Name() << ": a dump has been loaded successfully";
           return std::optional{dump_stats->update_time};
@@ -574,6 +622,32 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            compression:
+                type: object
+                description: Compress the dump in independent blocks, processed by several fs tasks in parallel. Changes the dump format
+                defaultDescription: no compression
+                additionalProperties: false
+                properties:
+                    encoding:
+                        type: string
+                        description: gzip or zstd
+                        defaultDescription: zstd if available, gzip otherwise
+                    level:
+                        type: integer
+                        description: encoding specific compression level
+                        defaultDescription: the default of the encoding
+                    block-size:
+                        type: integer
+                        description: size of the independently compressed blocks in bytes
+                        defaultDescription: 4194304
+                    parallel-blocks:
+                        type: integer
+                        description: max number of blocks compressed or decompressed at the same time
+                        defaultDescription: 4
+            memory-mapped:
+                type: boolean
+                description: Whether to read the dump through a memory mapping instead of buffered reads, incompatible with `encrypted`
+                defaultDescription: false
 )");
 }
 
@@ -1,8 +1,10 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
+#include <userver/dump/operations_mmap.hpp>
 #include <userver/storages/secdist/component.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +21,13 @@ boost::filesystem::perms GetPerms(const Config& config) {
     return perms::owner_read;
 }
 
+std::unique_ptr<dump::OperationsFactory> WithCompression(
+    const Config& config, std::unique_ptr<dump::OperationsFactory> factory) {
+  if (!config.compression) return factory;
+  return std::make_unique<dump::CompressedOperationsFactory>(
+      std::move(factory), *config.compression);
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
@@ -28,17 +37,23 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
   if (config.dump_is_encrypted) {
     const auto& secdist = context.FindComponent<components::Secdist>().Get();
     auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
-    return std::make_unique<dump::EncryptedOperationsFactory>(
-        std::move(secret_key), dump_perms);
+    return WithCompression(
+        config, std::make_unique<dump::EncryptedOperationsFactory>(
+                    std::move(secret_key), dump_perms));
   } else {
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return CreateDefaultOperationsFactory(config);
   }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(
     const Config& config) {
   auto dump_perms = GetPerms(config);
-  return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+  if (config.dump_is_memory_mapped) {
+    return WithCompression(
+        config, std::make_unique<dump::MmapOperationsFactory>(dump_perms));
+  }
+  return WithCompression(
+      config, std::make_unique<dump::FileOperationsFactory>(dump_perms));
 }
 
 }  // namespace dump
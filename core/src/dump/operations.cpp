@@ -0,0 +1,32 @@
+#include <userver/dump/operations.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+void Reader::ReadRawInto(char* destination, std::size_t size) {
+  constexpr std::size_t kChunkSize = 1024 * 1024;  // 1 MiB
+
+  while (size != 0) {
+    const auto chunk_size = std::min(size, kChunkSize);
+    const auto chunk = ReadRaw(chunk_size);
+    if (chunk.size() != chunk_size) {
+      throw Error(
+          fmt::format("Unexpected end-of-file while trying to read from the "
+                      "dump file: requested-size={}",
+                      size));
+    }
+
+    chunk.copy(destination, chunk_size);
+    destination += chunk_size;
+    size -= chunk_size;
+  }
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,255 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <compression/compressor.hpp>
+#include <compression/gzip.hpp>
+#include <compression/zstd.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+constexpr std::string_view kMagic = "userver-compressed-dump-1";
+
+// Guards against allocating garbage sizes from a corrupted dump
+constexpr std::uint64_t kMaxBlockSize = std::uint64_t{1} << 32;
+
+struct Block final {
+  std::uint64_t raw_size{0};
+  std::string data;
+};
+
+std::string DecompressBlock(compression::Encoding encoding,
+                            std::string_view compressed,
+                            std::uint64_t raw_size) {
+  std::string result;
+  // one more byte to detect the data exceeding the declared size
+  switch (encoding) {
+    case compression::Encoding::kGzip:
+      result = compression::gzip::Decompress(compressed, raw_size + 1);
+      break;
+    case compression::Encoding::kZstd:
+      result = compression::zstd::Decompress(compressed, raw_size + 1);
+      break;
+    case compression::Encoding::kBrotli:
+      throw Error("brotli dump compression is not supported");
+  }
+
+  if (result.size() != raw_size) {
+    throw Error(fmt::format(
+        "Unexpected size of a decompressed dump block: expected={}, actual={}",
+        raw_size, result.size()));
+  }
+  return result;
+}
+
+}  // namespace
+
+struct CompressedWriter::Impl final {
+  void FlushBlock();
+  void WriteOldestBlock();
+
+  std::unique_ptr<Writer> base;
+  compression::Encoding encoding;
+  std::optional<int> level;
+  std::size_t block_size;
+  std::size_t parallel_blocks;
+
+  std::string block;
+  std::deque<engine::TaskWithResult<Block>> pending_blocks;
+};
+
+void CompressedWriter::Impl::FlushBlock() {
+  if (pending_blocks.size() >= parallel_blocks) WriteOldestBlock();
+
+  pending_blocks.push_back(engine::AsyncNoSpan(
+      [encoding = encoding, level = level, raw = std::move(block)] {
+        return Block{raw.size(), compression::Compress(encoding, level, raw)};
+      }));
+
+  block = {};
+  block.reserve(block_size);
+}
+
+void CompressedWriter::Impl::WriteOldestBlock() {
+  Block compressed;
+  try {
+    compressed = pending_blocks.front().Get();
+  } catch (const compression::CompressionError& ex) {
+    throw Error(fmt::format("Failed to compress a dump block: {}", ex.what()));
+  }
+  pending_blocks.pop_front();
+
+  base->Write(compressed.raw_size);
+  base->Write(std::string_view{compressed.data});
+}
+
+CompressedWriter::CompressedWriter(std::unique_ptr<Writer> base,
+                                   const CompressionConfig& config)
+    : impl_(std::make_unique<Impl>(
+          Impl{std::move(base),
+               compression::EncodingFromString(config.encoding), config.level,
+               config.block_size, config.parallel_blocks, {}, {}})) {
+  impl_->block.reserve(impl_->block_size);
+
+  WriteStringViewUnsafe(*impl_->base, kMagic);
+  impl_->base->Write(config.encoding);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  auto& impl = *impl_;
+  while (!data.empty()) {
+    const auto size =
+        std::min(impl.block_size - impl.block.size(), data.size());
+    impl.block.append(data.substr(0, size));
+    data.remove_prefix(size);
+
+    if (impl.block.size() == impl.block_size) impl.FlushBlock();
+  }
+}
+
+void CompressedWriter::Finish() {
+  auto& impl = *impl_;
+  if (!impl.block.empty()) impl.FlushBlock();
+  while (!impl.pending_blocks.empty()) impl.WriteOldestBlock();
+
+  // an empty block marks the end of the data
+  impl.base->Write(std::uint64_t{0});
+  impl.base->Finish();
+}
+
+struct CompressedReader::Impl final {
+  void Prefetch();
+  bool NextBlock();
+
+  std::unique_ptr<Reader> base;
+  std::size_t parallel_blocks;
+  compression::Encoding encoding{compression::Encoding::kZstd};
+
+  bool base_exhausted{false};
+  std::deque<engine::TaskWithResult<std::string>> pending_blocks;
+  std::string block;
+  std::size_t block_pos{0};
+  std::string buffer;
+};
+
+void CompressedReader::Impl::Prefetch() {
+  while (!base_exhausted && pending_blocks.size() < parallel_blocks) {
+    const auto raw_size = base->Read<std::uint64_t>();
+    if (raw_size == 0) {
+      base_exhausted = true;
+      break;
+    }
+    if (raw_size > kMaxBlockSize) {
+      throw Error(fmt::format("Dump block is too large: {}", raw_size));
+    }
+
+    pending_blocks.push_back(engine::AsyncNoSpan(
+        [encoding = encoding, raw_size,
+         compressed = std::string{ReadStringViewUnsafe(*base)}] {
+          return DecompressBlock(encoding, compressed, raw_size);
+        }));
+  }
+}
+
+bool CompressedReader::Impl::NextBlock() {
+  Prefetch();
+  if (pending_blocks.empty()) return false;
+
+  try {
+    block = pending_blocks.front().Get();
+  } catch (const compression::DecompressionError& ex) {
+    throw Error(
+        fmt::format("Failed to decompress a dump block: {}", ex.what()));
+  }
+  pending_blocks.pop_front();
+  block_pos = 0;
+
+  // keep the next blocks decompressing while this one is read
+  Prefetch();
+  return true;
+}
+
+CompressedReader::CompressedReader(std::unique_ptr<Reader> base,
+                                   const CompressionConfig& config)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->base = std::move(base);
+  impl_->parallel_blocks = config.parallel_blocks;
+
+  if (ReadUnsafeAtMost(*impl_->base, kMagic.size()) != kMagic) {
+    throw Error("The dump is not compressed or has an unknown format");
+  }
+  try {
+    impl_->encoding =
+        compression::EncodingFromString(impl_->base->Read<std::string>());
+  } catch (const compression::CompressionError& ex) {
+    throw Error(fmt::format("Unsupported dump compression: {}", ex.what()));
+  }
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  auto& impl = *impl_;
+  if (impl.block.size() - impl.block_pos >= max_size) {
+    const auto result =
+        std::string_view{impl.block}.substr(impl.block_pos, max_size);
+    impl.block_pos += max_size;
+    return result;
+  }
+
+  // the data spans several blocks
+  impl.buffer.clear();
+  while (impl.buffer.size() < max_size) {
+    if (impl.block_pos == impl.block.size() && !impl.NextBlock()) break;
+
+    const auto size = std::min(max_size - impl.buffer.size(),
+                               impl.block.size() - impl.block_pos);
+    impl.buffer.append(impl.block, impl.block_pos, size);
+    impl.block_pos += size;
+  }
+  return impl.buffer;
+}
+
+void CompressedReader::Finish() {
+  auto& impl = *impl_;
+  if (impl.block_pos != impl.block.size() || impl.NextBlock()) {
+    throw Error("Unexpected extra data at the end of the compressed dump");
+  }
+  impl.base->Finish();
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    std::unique_ptr<OperationsFactory> base, CompressionConfig config)
+    : base_(std::move(base)), config_(std::move(config)) {}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(
+      base_->CreateReader(std::move(full_path)), config_);
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(
+      base_->CreateWriter(std::move(full_path), scope), config_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
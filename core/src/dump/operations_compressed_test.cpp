@@ -0,0 +1,119 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <string>
+
+#include <compression/compressor.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+dump::CompressionConfig MakeConfig(std::string encoding) {
+  // small blocks, so that the data spans many of them
+  return {std::move(encoding), std::nullopt, 1000, 3};
+}
+
+std::vector<std::string> MakeData() {
+  std::vector<std::string> data;
+  for (int i = 0; i < 10000; ++i) {
+    data.push_back("some data " + std::to_string(i));
+  }
+  // larger than a block
+  data.push_back(std::string(5000, 'x'));
+  return data;
+}
+
+std::string WriteCompressed(const dump::CompressionConfig& config,
+                            const std::vector<std::string>& data) {
+  auto base = std::make_unique<dump::MockWriter>();
+  auto& base_ref = *base;
+
+  dump::CompressedWriter writer(std::move(base), config);
+  writer.Write(data);
+  writer.Write(std::string{"tail"});
+  writer.Finish();
+
+  return std::move(base_ref).Extract();
+}
+
+class DumpOperationsCompressedEncoding
+    : public testing::TestWithParam<std::string> {
+ protected:
+  void SetUp() override {
+    if (!compression::IsSupported(
+            compression::EncodingFromString(GetParam()))) {
+      GTEST_SKIP() << GetParam() << " is not supported";
+    }
+  }
+};
+
+}  // namespace
+
+INSTANTIATE_UTEST_SUITE_P(/*no prefix*/, DumpOperationsCompressedEncoding,
+                          testing::Values("gzip", "zstd"));
+
+UTEST_P_MT(DumpOperationsCompressedEncoding, WriteRead, 4) {
+  const auto config = MakeConfig(GetParam());
+  const auto data = MakeData();
+
+  const auto compressed = WriteCompressed(config, data);
+  EXPECT_LT(compressed.size(), dump::ToBinary(data).size() / 2);
+
+  dump::CompressedReader reader(std::make_unique<dump::MockReader>(compressed),
+                                config);
+  EXPECT_EQ(reader.Read<std::vector<std::string>>(), data);
+  EXPECT_EQ(reader.Read<std::string>(), "tail");
+  reader.Finish();
+}
+
+UTEST_P(DumpOperationsCompressedEncoding, EmptyDump) {
+  const auto config = MakeConfig(GetParam());
+
+  auto base = std::make_unique<dump::MockWriter>();
+  auto& base_ref = *base;
+  dump::CompressedWriter writer(std::move(base), config);
+  writer.Finish();
+
+  dump::CompressedReader reader(
+      std::make_unique<dump::MockReader>(std::move(base_ref).Extract()),
+      config);
+  EXPECT_EQ(dump::ReadUnsafeAtMost(reader, 10), "");
+  reader.Finish();
+}
+
+UTEST_P(DumpOperationsCompressedEncoding, Underread) {
+  const auto config = MakeConfig(GetParam());
+  const auto compressed = WriteCompressed(config, MakeData());
+
+  dump::CompressedReader reader(std::make_unique<dump::MockReader>(compressed),
+                                config);
+  reader.Read<std::vector<std::string>>();
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, NotCompressed) {
+  UEXPECT_THROW(dump::CompressedReader(
+                    std::make_unique<dump::MockReader>(dump::ToBinary(42)),
+                    MakeConfig("gzip")),
+                dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, ReadsOtherEncoding) {
+  const auto data = MakeData();
+  const auto compressed = WriteCompressed(MakeConfig("gzip"), data);
+
+  // the encoding is stored in the dump
+  dump::CompressedReader reader(std::make_unique<dump::MockReader>(compressed),
+                                MakeConfig("zstd"));
+  EXPECT_EQ(reader.Read<std::vector<std::string>>(), data);
+  EXPECT_EQ(reader.Read<std::string>(), "tail");
+  reader.Finish();
+}
+
+USERVER_NAMESPACE_END
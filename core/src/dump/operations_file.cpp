@@ -87,6 +87,23 @@ std::string_view FileReader::ReadRaw(std::size_t max_size) {
   return {curr_chunk_.data(), bytes_read};
 }
 
+void FileReader::ReadRawInto(char* destination, std::size_t size) {
+  std::size_t bytes_read = 0;
+  try {
+    bytes_read = file_.Read(destination, size);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            path_, ex.what()));
+  }
+
+  if (bytes_read != size) {
+    throw Error(
+        fmt::format("Unexpected end-of-file while trying to read from the dump "
+                    "file \"{}\": requested-size={}",
+                    path_, size));
+  }
+}
+
 void FileReader::Finish() {
   std::size_t bytes_read = 0;
 
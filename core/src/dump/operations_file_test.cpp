@@ -113,4 +113,16 @@ TEST(DumpOperationsFile, Underread) {
   FAIL();
 }
 
+TEST(DumpOperationsFile, ReadInto) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "abcdef");
+
+  dump::FileReader reader(file.GetPath());
+  std::string buffer(4, '\0');
+  dump::ReadUnsafeInto(reader, buffer.data(), buffer.size());
+  EXPECT_EQ(buffer, "abcd");
+  UEXPECT_THROW(dump::ReadUnsafeInto(reader, buffer.data(), buffer.size()),
+                dump::Error);
+}
+
 USERVER_NAMESPACE_END
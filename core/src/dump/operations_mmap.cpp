@@ -0,0 +1,96 @@
+#include <userver/dump/operations_mmap.hpp>
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    auto file = fs::blocking::FileDescriptor::Open(
+        path_, fs::blocking::OpenFlag::kRead);
+    size_ = file.GetSize();
+    if (size_ == 0) return;  // zero-length mappings are not allowed
+
+    void* data =
+        ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.GetNative(), 0);
+    if (data == MAP_FAILED) {
+      throw std::runtime_error(
+          fmt::format("mmap failed: {}", std::strerror(errno)));
+    }
+    data_ = static_cast<const char*>(data);
+    // the mapping outlives the descriptor
+    std::move(file).Close();
+  } catch (const std::exception& ex) {
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+    throw Error(fmt::format(
+        "Failed to map the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+
+  // dumps are read once from start to end, the advice is best-effort
+  ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+  ::madvise(const_cast<char*>(data_), size_, MADV_WILLNEED);
+}
+
+MmapFileReader::~MmapFileReader() {
+  if (data_) ::munmap(const_cast<char*>(data_), size_);
+}
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+  const auto read_size = std::min(max_size, size_ - position_);
+  const std::string_view result{data_ + position_, read_size};
+  position_ += read_size;
+  return result;
+}
+
+void MmapFileReader::ReadRawInto(char* destination, std::size_t size) {
+  if (size > size_ - position_) {
+    throw Error(
+        fmt::format("Unexpected end-of-file while trying to read from the dump "
+                    "file \"{}\": requested-size={}",
+                    path_, size));
+  }
+
+  if (size != 0) std::memcpy(destination, data_ + position_, size);
+  position_ += size;
+}
+
+void MmapFileReader::Finish() {
+  if (position_ != size_) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, size_, position_, size_ - position_));
+  }
+}
+
+MmapOperationsFactory::MmapOperationsFactory(boost::filesystem::perms perms)
+    : perms_(perms) {}
+
+std::unique_ptr<Reader> MmapOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<MmapFileReader>(std::move(full_path));
+}
+
+std::unique_ptr<Writer> MmapOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<FileWriter>(std::move(full_path), perms_, scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
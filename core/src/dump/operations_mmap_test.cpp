@@ -0,0 +1,89 @@
+#include <userver/dump/operations_mmap.hpp>
+
+#include <boost/regex.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) {
+  return dir.GetPath() + "/dump";
+}
+
+}  // namespace
+
+UTEST(DumpOperationsMmap, ReadsFileWriterDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  const std::vector<std::uint32_t> values(100'000, 42);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::MmapOperationsFactory factory{boost::filesystem::perms::owner_read};
+  auto writer = factory.CreateWriter(path, scope_time);
+  writer->Write(std::string{"header"});
+  dump::WriteTriviallyCopyableArray(*writer, values);
+  writer->Write(std::uint64_t{1} << 60);
+  writer->Finish();
+
+  auto reader = factory.CreateReader(path);
+  EXPECT_EQ(reader->Read<std::string>(), "header");
+  EXPECT_EQ(dump::ReadTriviallyCopyableArray<std::uint32_t>(*reader), values);
+  EXPECT_EQ(reader->Read<std::uint64_t>(), std::uint64_t{1} << 60);
+  reader->Finish();
+}
+
+UTEST(DumpOperationsMmap, EmptyDump) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(dump::ReadUnsafeAtMost(reader, 10), "");
+  reader.Finish();
+}
+
+UTEST(DumpOperationsMmap, Overread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  UEXPECT_THROW(ReadStringViewUnsafe(reader, 11), dump::Error);
+
+  std::string buffer(11, '\0');
+  UEXPECT_THROW(dump::ReadUnsafeInto(reader, buffer.data(), buffer.size()),
+                dump::Error);
+}
+
+UTEST(DumpOperationsMmap, Underread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  try {
+    reader.Finish();
+  } catch (const dump::Error& ex) {
+    EXPECT_TRUE(boost::regex_match(
+        ex.what(),
+        boost::regex{"Unexpected extra data at the end of the dump file "
+                     "\".+\": file-size=10, position=9, unread-size=1"}))
+        << ex.what();
+    return;
+  }
+  FAIL();
+}
+
+UTEST(DumpOperationsMmap, MissingFile) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  UEXPECT_THROW(dump::MmapFileReader{DumpFilePath(dir)}, dump::Error);
+}
+
+USERVER_NAMESPACE_END
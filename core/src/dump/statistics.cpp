@@ -1,16 +1,31 @@
 #include <dump/statistics.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
 #include <userver/formats/json/value_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
+namespace {
+
+std::uint64_t GetThroughputKbPerSecond(std::size_t size,
+                                       std::chrono::milliseconds duration) {
+  return size / 1024 * 1000 / std::max<std::int64_t>(duration.count(), 1);
+}
+
+}  // namespace
+
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
   const bool is_loaded = stats.is_loaded;
   writer["is-loaded-from-dump"] = is_loaded ? 1 : 0;
   if (is_loaded) {
-    writer["load-duration-ms"] = stats.load_duration.load().count();
+    const auto load_duration = stats.load_duration.load();
+    writer["load-duration-ms"] = load_duration.count();
+    writer["load-throughput-kb-per-s"] =
+        GetThroughputKbPerSecond(stats.loaded_raw_size.load(), load_duration);
   }
   writer["is-current-from-dump"] = stats.is_current_from_dump.load() ? 1 : 0;
 
@@ -23,8 +38,16 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
             std::chrono::steady_clock::now() -
             stats.last_nontrivial_write_start_time.load())
             .count();
-    write["duration-ms"] = stats.last_nontrivial_write_duration.load().count();
-    write["size-kb"] = stats.last_written_size.load() / 1024;
+    const auto duration = stats.last_nontrivial_write_duration.load();
+    const auto size = stats.last_written_size.load();
+    const auto raw_size = stats.last_written_raw_size.load();
+    write["duration-ms"] = duration.count();
+    write["size-kb"] = size / 1024;
+    write["raw-size-kb"] = raw_size / 1024;
+    write["throughput-kb-per-s"] = GetThroughputKbPerSecond(raw_size, duration);
+    if (size != 0) {
+      write["compression-ratio"] = static_cast<double>(raw_size) / size;
+    }
   }
 }
 
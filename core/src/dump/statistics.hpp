@@ -16,11 +16,14 @@ struct Statistics {
   std::atomic<bool> is_loaded{false};
   std::atomic<bool> is_current_from_dump{false};
   std::atomic<std::chrono::milliseconds> load_duration{{}};
+  std::atomic<std::size_t> loaded_raw_size{0};
 
   std::atomic<std::chrono::steady_clock::time_point>
       last_nontrivial_write_start_time{{}};
   std::atomic<std::chrono::milliseconds> last_nontrivial_write_duration{{}};
   std::atomic<std::size_t> last_written_size{0};
+  // before compression
+  std::atomic<std::size_t> last_written_raw_size{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
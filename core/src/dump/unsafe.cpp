@@ -37,6 +37,10 @@ std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size) {
   return result;
 }
 
+void ReadUnsafeInto(Reader& reader, char* destination, std::size_t size) {
+  reader.ReadRawInto(destination, size);
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
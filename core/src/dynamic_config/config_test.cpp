@@ -5,7 +5,10 @@
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -426,4 +429,66 @@ UTEST(DynamicConfigSubscription, Snippet) {
 
 }  // namespace
 
+namespace {
+
+int foo_parse_count = 0;
+int bar_parse_count = 0;
+
+// The docs are missing in the defaults that the other tests parse
+int ParseFooDoc(const dynamic_config::DocsMap& docs_map) {
+  ++foo_parse_count;
+  if (!docs_map.Has("USERVER_TEST_FOO")) return 0;
+  return docs_map.Get("USERVER_TEST_FOO").As<int>();
+}
+
+int ParseBarDoc(const dynamic_config::DocsMap& docs_map) {
+  ++bar_parse_count;
+  if (!docs_map.Has("USERVER_TEST_BAR")) return 0;
+  return docs_map.Get("USERVER_TEST_BAR").As<int>();
+}
+
+constexpr dynamic_config::Key<ParseFooDoc> kFooDocConfig;
+constexpr dynamic_config::Key<ParseBarDoc> kBarDocConfig;
+
+formats::json::Value MakeDoc(int value) {
+  return formats::json::ValueBuilder{value}.ExtractValue();
+}
+
+}  // namespace
+
+UTEST(DynamicConfig, DeltaUpdateParsesChangedDocsOnly) {
+  auto old_docs = dynamic_config::impl::GetDefaultDocsMap();
+  old_docs.Set("USERVER_TEST_FOO", MakeDoc(1));
+  const dynamic_config::impl::SnapshotData old_config(old_docs, {});
+  EXPECT_EQ(old_config[kFooDocConfig], 1);
+  EXPECT_EQ(old_config[kBarDocConfig], 0);
+
+  foo_parse_count = 0;
+  bar_parse_count = 0;
+  auto new_docs = old_docs;
+  new_docs.Set("USERVER_TEST_FOO", MakeDoc(2));
+  const auto changed_docs =
+      new_docs.GetChangedNames(old_docs, utils::InternalTag{});
+  EXPECT_EQ(changed_docs, dynamic_config::impl::DocNames{"USERVER_TEST_FOO"});
+
+  const dynamic_config::impl::SnapshotData new_config(new_docs, old_config,
+                                                      changed_docs);
+  EXPECT_EQ(new_config[kFooDocConfig], 2);
+  EXPECT_EQ(new_config[kBarDocConfig], 0);
+  EXPECT_EQ(foo_parse_count, 1);
+  EXPECT_EQ(bar_parse_count, 0);
+  EXPECT_FALSE(new_config.IsSharedWith(old_config, kFooDocConfig));
+  EXPECT_TRUE(new_config.IsSharedWith(old_config, kBarDocConfig));
+
+  // A doc that was checked with DocsMap::Has and then appeared
+  auto newer_docs = new_docs;
+  newer_docs.Set("USERVER_TEST_BAR", MakeDoc(3));
+  const dynamic_config::impl::SnapshotData newer_config(
+      newer_docs, new_config,
+      newer_docs.GetChangedNames(new_docs, utils::InternalTag{}));
+  EXPECT_EQ(newer_config[kBarDocConfig], 3);
+  EXPECT_EQ(foo_parse_count, 1);
+  EXPECT_TRUE(newer_config.IsSharedWith(new_config, kFooDocConfig));
+}
+
 USERVER_NAMESPACE_END
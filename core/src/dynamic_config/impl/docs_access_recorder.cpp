@@ -0,0 +1,54 @@
+#include <dynamic_config/impl/docs_access_recorder.hpp>
+
+#include <algorithm>
+
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+namespace {
+
+thread_local USERVER_IMPL_CONSTINIT DocsAccessRecorder* current_recorder{
+    nullptr};
+
+USERVER_PREVENT_TLS_CACHING DocsAccessRecorder* GetCurrentRecorder() noexcept {
+  return current_recorder;
+}
+
+USERVER_PREVENT_TLS_CACHING void SetCurrentRecorder(
+    DocsAccessRecorder* recorder) noexcept {
+  current_recorder = recorder;
+}
+
+}  // namespace
+
+DocsAccessRecorder::DocsAccessRecorder() noexcept
+    : previous_(GetCurrentRecorder()) {
+  SetCurrentRecorder(this);
+}
+
+DocsAccessRecorder::~DocsAccessRecorder() {
+  UASSERT_MSG(GetCurrentRecorder() == this,
+              "DocsAccessRecorder lived across a context switch");
+  SetCurrentRecorder(previous_);
+}
+
+std::vector<std::string> DocsAccessRecorder::ExtractNames() && {
+  std::sort(names_.begin(), names_.end());
+  names_.erase(std::unique(names_.begin(), names_.end()), names_.end());
+  return std::move(names_);
+}
+
+void DocsAccessRecorder::OnAccess(std::string_view name) {
+  if (auto* recorder = GetCurrentRecorder()) {
+    recorder->names_.emplace_back(name);
+  }
+}
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+// Records the names of the docs that are accessed with DocsMap::Get and
+// DocsMap::Has by the current thread while the recorder is alive. Must not
+// live across a context switch.
+class DocsAccessRecorder final {
+ public:
+  DocsAccessRecorder() noexcept;
+  ~DocsAccessRecorder();
+
+  DocsAccessRecorder(const DocsAccessRecorder&) = delete;
+  DocsAccessRecorder& operator=(const DocsAccessRecorder&) = delete;
+
+  // Returns the sorted unique names
+  std::vector<std::string> ExtractNames() &&;
+
+  // Called by DocsMap
+  static void OnAccess(std::string_view name);
+
+ private:
+  DocsAccessRecorder* const previous_;
+  std::vector<std::string> names_;
+};
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
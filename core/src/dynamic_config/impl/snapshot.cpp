@@ -2,6 +2,7 @@
 
 #include <fmt/format.h>
 
+#include <dynamic_config/impl/docs_access_recorder.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/utils/cpu_relax.hpp>
@@ -18,6 +19,39 @@ std::vector<impl::Factory>& Registry() {
   return registry;
 }
 
+std::shared_ptr<const ConfigValue> ParseConfig(impl::Factory factory,
+                                               const DocsMap& docs_map) {
+  try {
+    DocsAccessRecorder recorder;
+    auto value = factory(docs_map);
+    return std::make_shared<const ConfigValue>(
+        ConfigValue{std::move(value), std::move(recorder).ExtractNames()});
+  } catch (const std::exception& ex) {
+    throw std::runtime_error(
+        fmt::format("While parsing dynamic config values: {} ({})", ex.what(),
+                    compiler::GetTypeName(typeid(ex))));
+  }
+}
+
+bool DependsOnAny(const std::vector<std::string>& doc_names,
+                  const DocNames& changed_docs) {
+  for (const auto& name : doc_names) {
+    if (changed_docs.count(name) != 0) return true;
+  }
+  return false;
+}
+
+// A reused variable does not call DocsMap::Get, the docs are marked as used
+// manually to keep DocsMap::GetConfigsExpectedToBeUsed accurate
+void MarkAsUsed(const DocsMap& docs_map,
+                const std::vector<std::string>& doc_names) {
+  for (const auto& name : doc_names) {
+    if (docs_map.Has(name)) {
+      [[maybe_unused]] const auto doc = docs_map.Get(name);
+    }
+  }
+}
+
 }  // namespace
 
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
@@ -38,7 +72,9 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    user_configs_[config_variable.GetId()] =
+        std::make_shared<const ConfigValue>(
+            ConfigValue{config_variable.GetValue(), std::nullopt});
   }
 }
 
@@ -47,15 +83,9 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
   for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+    if (!user_configs_[id]) {
       relax.Relax(1);
-      try {
-        user_configs_[id] = factory(defaults);
-      } catch (const std::exception& ex) {
-        throw std::runtime_error(
-            fmt::format("While parsing dynamic config values: {} ({})",
-                        ex.what(), compiler::GetTypeName(typeid(ex))));
-      }
+      user_configs_[id] = ParseConfig(factory, defaults);
     }
   }
 }
@@ -66,20 +96,50 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
   if (defaults.IsEmpty()) return;
 
   for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
+    if (user_configs_[id]) continue;
     user_configs_[id] = defaults.user_configs_[id];
   }
 }
 
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const SnapshotData& previous,
+                           const DocNames& changed_docs) {
+  utils::impl::AssertStaticRegistrationFinished();
+  user_configs_.resize(Registry().size());
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (const auto [id, factory] : utils::enumerate(Registry())) {
+    const auto* previous_config =
+        previous.IsEmpty() ? nullptr : previous.user_configs_[id].get();
+    if (previous_config && previous_config->doc_names &&
+        !DependsOnAny(*previous_config->doc_names, changed_docs)) {
+      MarkAsUsed(docs_map, *previous_config->doc_names);
+      user_configs_[id] = previous.user_configs_[id];
+      continue;
+    }
+
+    relax.Relax(1);
+    user_configs_[id] = ParseConfig(factory, docs_map);
+  }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
 const std::any& SnapshotData::Get(impl::ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return config->value;
+}
+
+bool SnapshotData::IsSharedWith(const SnapshotData& other,
+                                impl::ConfigId id) const noexcept {
+  if (id >= user_configs_.size() || id >= other.user_configs_.size()) {
+    return false;
+  }
+  return user_configs_[id] && user_configs_[id] == other.user_configs_[id];
 }
 
 }  // namespace dynamic_config::impl
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <optional>
 #include <string>
 #include <unordered_set>
 
@@ -9,6 +10,7 @@
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/updates_sink/find.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -17,6 +19,8 @@
 #include <userver/fs/write.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <dynamic_config/storage_data.hpp>
@@ -34,6 +38,7 @@ constexpr std::chrono::seconds kWaitInterval(5);
 class DynamicConfig::Impl final {
  public:
   Impl(const ComponentConfig&, const ComponentContext&);
+  ~Impl();
 
   dynamic_config::Source GetSource();
   auto& GetChannel() { return cache_.GetChannel(); }
@@ -60,10 +65,16 @@ class DynamicConfig::Impl final {
   engine::TaskProcessor* fs_task_processor_;
   std::string fs_loading_error_msg_;
 
+  // The last applied docs, to find the changed ones on the next update
+  engine::Mutex set_config_mutex_;
+  std::optional<dynamic_config::DocsMap> docs_map_;
+
   std::atomic<bool> is_loaded_{false};
   mutable engine::Mutex loaded_mutex_;
   mutable engine::ConditionVariable loaded_cv_;
   bool config_load_cancelled_{false};
+
+  utils::statistics::Entry statistics_holder_;
 };
 
 DynamicConfig::Impl::Impl(const ComponentConfig& config,
@@ -78,9 +89,29 @@ DynamicConfig::Impl::Impl(const ComponentConfig& config,
              fmt::format("At least one dynamic config updater component "
                          "responsible for DynamicConfig initialization should "
                          "be defined in a static config!"));
+
+  concurrent::AsyncEventChannelSettings subscribers_settings;
+  subscribers_settings.max_parallelism =
+      config["subscribers-max-parallelism"].As<std::size_t>(
+          subscribers_settings.max_parallelism);
+  subscribers_settings.warn_timeout =
+      config["subscribers-warn-timeout"].As<std::chrono::milliseconds>(
+          subscribers_settings.warn_timeout);
+  cache_.SetSubscribersSettings(subscribers_settings);
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("dynamic-config.subscribers",
+                          [this](utils::statistics::Writer& writer) {
+                            writer = cache_;
+                          });
+
   ReadFsCache();
 }
 
+DynamicConfig::Impl::~Impl() { statistics_holder_.Unregister(); }
+
 dynamic_config::Source DynamicConfig::Impl::GetSource() {
   WaitUntilLoaded();
   return dynamic_config::Source{cache_};
@@ -125,7 +156,19 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
-  dynamic_config::impl::SnapshotData config(value, {});
+  std::lock_guard set_config_lock(set_config_mutex_);
+
+  // Only the variables that depend on the changed docs are parsed again, the
+  // rest are shared with the previous snapshot
+  auto config = [&] {
+    if (!docs_map_) return dynamic_config::impl::SnapshotData(value, {});
+    const auto changed_docs =
+        value.GetChangedNames(*docs_map_, utils::InternalTag{});
+    LOG_DEBUG() << "Dynamic config update changes " << changed_docs.size()
+                << " docs";
+    const auto previous = cache_.Read();
+    return dynamic_config::impl::SnapshotData(value, *previous, changed_docs);
+  }();
 
   if (!value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
     LOG_INFO() << "Some configs expected to be used are actually not needed: "
@@ -140,6 +183,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
     loaded_cv_.NotifyAll();
   };
   cache_.Update(std::move(config), std::move(after_assign_hook));
+  docs_map_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater,
@@ -272,6 +316,15 @@ properties:
     fs-task-processor:
         type: string
         description: name of the task processor to run the blocking file write operations
+    subscribers-max-parallelism:
+        type: integer
+        description: max number of subscribers that handle a config update concurrently, 0 for no limit
+        defaultDescription: 0
+        minimum: 0
+    subscribers-warn-timeout:
+        type: string
+        description: a subscriber that handles a config update for longer is reported to logs
+        defaultDescription: 30s
 )");
 }
 
@@ -6,6 +6,7 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -54,6 +55,12 @@ StorageData::SnapshotChannel& StorageData::GetChannel() {
   return snapshot_channel_;
 }
 
+void StorageData::SetSubscribersSettings(
+    const concurrent::AsyncEventChannelSettings& settings) {
+  snapshot_channel_.SetSettings(settings);
+  diff_channel_.SetSettings(settings);
+}
+
 concurrent::AsyncEventSubscriberScope StorageData::DoUpdateAndListen(
     concurrent::FunctionId id, std::string_view name,
     SnapshotChannel::Function&& func) {
@@ -88,6 +95,11 @@ concurrent::AsyncEventSubscriberScope StorageData::DoUpdateAndListen(
                                          std::move(updater));
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const StorageData& data) {
+  writer = data.snapshot_channel_;
+  writer = data.diff_channel_;
+}
+
 }  // namespace dynamic_config::impl
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,6 +26,9 @@ class StorageData final {
 
   SnapshotChannel& GetChannel();
 
+  void SetSubscribersSettings(
+      const concurrent::AsyncEventChannelSettings& settings);
+
   concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
       concurrent::FunctionId id, std::string_view name,
       SnapshotChannel::Function&& func);
@@ -33,6 +37,9 @@ class StorageData final {
       concurrent::FunctionId id, std::string_view name,
       DiffChannel::Function&& func);
 
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const StorageData& data);
+
  private:
   Snapshot GetSnapshot() { return Snapshot{*this}; }
 
@@ -4,6 +4,7 @@
 
 #include <fmt/format.h>
 
+#include <dynamic_config/impl/docs_access_recorder.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <utils/internal_tag.hpp>
@@ -13,6 +14,7 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 
 formats::json::Value DocsMap::Get(std::string_view name) const {
+  impl::DocsAccessRecorder::OnAccess(name);
   const auto it = utils::impl::FindTransparent(docs_, name);
   if (it == docs_.end()) {
     throw std::runtime_error(fmt::format("Can't find doc for '{}'", name));
@@ -28,6 +30,7 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
 }
 
 bool DocsMap::Has(std::string_view name) const {
+  impl::DocsAccessRecorder::OnAccess(name);
   return utils::impl::FindTransparent(docs_, name) != docs_.end();
 }
 
@@ -84,6 +87,19 @@ bool DocsMap::AreContentsEqual(const DocsMap& other) const {
   return docs_ == other.docs_;
 }
 
+utils::impl::TransparentSet<std::string> DocsMap::GetChangedNames(
+    const DocsMap& other, utils::InternalTag) const {
+  utils::impl::TransparentSet<std::string> result;
+  for (const auto& [name, value] : docs_) {
+    const auto it = other.docs_.find(name);
+    if (it == other.docs_.end() || it->second != value) result.insert(name);
+  }
+  for (const auto& [name, value] : other.docs_) {
+    if (docs_.find(name) == docs_.end()) result.insert(name);
+  }
+  return result;
+}
+
 void DocsMap::SetConfigsExpectedToBeUsed(
     utils::impl::TransparentSet<std::string> configs, utils::InternalTag) {
   configs_to_be_used_ = std::move(configs);
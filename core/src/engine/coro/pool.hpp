@@ -1,9 +1,18 @@
 #pragma once
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <algorithm>  // for std::max
 #include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -11,9 +20,11 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
 
 #include "pool_config.hpp"
 #include "pool_stats.hpp"
+#include "stack_usage_monitor.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +37,8 @@ class Pool final {
   class CoroutinePtr;
   using TaskPipe = typename boost::coroutines2::coroutine<Task*>::pull_type;
   using Executor = void (*)(TaskPipe&);
+  using StackAllocator = boost::coroutines2::protected_fixedsize_stack;
+  using StackContext = decltype(std::declval<StackAllocator&>().allocate());
 
   Pool(PoolConfig config, Executor executor);
   ~Pool();
@@ -36,26 +49,88 @@ class Pool final {
   std::size_t GetStackSize() const;
 
  private:
-  Coroutine CreateCoroutine(bool quiet = false);
+  // Remembers the stack of the coroutine being created
+  class RecordingStackAllocator final {
+   public:
+    RecordingStackAllocator(StackAllocator allocator, StackContext* stack)
+        : allocator_(allocator), stack_(stack) {}
+
+    StackContext allocate() {
+      auto stack = allocator_.allocate();
+      if (stack_) *stack_ = stack;
+      return stack;
+    }
+
+    void deallocate(StackContext& stack) noexcept {
+      allocator_.deallocate(stack);
+    }
+
+   private:
+    StackAllocator allocator_;
+    StackContext* stack_;
+  };
+
+  struct IdleCoroutine final {
+    Coroutine coroutine;
+    StackContext stack;
+    std::chrono::steady_clock::time_point idle_since;
+    bool is_reclaimed{false};
+  };
+
+  struct LocalCache final {
+    ~LocalCache();
+
+    Pool* owner{nullptr};
+    std::vector<IdleCoroutine> coroutines;
+  };
+
+  // Per-thread state is kept for a few pools at once, one per stack size class
+  static constexpr std::size_t kMaxThreadLocalPools = 4;
+
+  template <typename Token>
+  struct LocalToken final {
+    const Pool* owner{nullptr};
+    std::optional<Token> token;
+  };
+
+  IdleCoroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
 
+  LocalCache* GetLocalCache();
+  void SpillLocalCache(LocalCache& cache);
+  // Returns false if the coroutine was dropped
+  bool PushIdle(IdleCoroutine&& coroutine);
+  bool PushIdle(IdleCoroutine&& coroutine, moodycamel::ProducerToken* token);
+  void OnIdleCoroutineDropped(const IdleCoroutine& coroutine) noexcept;
+
+  void RunStackReclaimer();
+  void ReclaimIdleStacks();
+  void ReclaimStack(IdleCoroutine& coroutine) noexcept;
+
+  // Returns nullptr if the thread already uses too many pools
   template <typename Token>
-  Token& GetToken();
+  Token* GetToken();
 
   const PoolConfig config_;
   const Executor executor_;
 
-  boost::coroutines2::protected_fixedsize_stack stack_allocator_;
-  moodycamel::ConcurrentQueue<Coroutine> coroutines_;
+  StackAllocator stack_allocator_;
+  moodycamel::ConcurrentQueue<IdleCoroutine> coroutines_;
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
+  std::atomic<std::size_t> reclaimed_coroutines_num_{0};
+
+  std::mutex reclaimer_mutex_;
+  std::condition_variable reclaimer_cv_;
+  bool is_reclaimer_stopped_{false};
+  std::thread reclaimer_;
 };
 
 template <typename Task>
 class Pool<Task>::CoroutinePtr final {
  public:
-  CoroutinePtr(Coroutine&& coro, Pool<Task>& pool) noexcept
-      : coro_(std::move(coro)), pool_(&pool) {}
+  CoroutinePtr(Coroutine&& coro, StackContext stack, Pool<Task>& pool) noexcept
+      : coro_(std::move(coro)), stack_(stack), pool_(&pool) {}
 
   CoroutinePtr(CoroutinePtr&&) noexcept = default;
   CoroutinePtr& operator=(CoroutinePtr&&) noexcept = default;
@@ -70,6 +145,8 @@ class Pool<Task>::CoroutinePtr final {
     return coro_;
   }
 
+  const StackContext& GetStack() const noexcept { return stack_; }
+
   void ReturnToPool() && {
     UASSERT(coro_);
     pool_->PutCoroutine(std::move(*this));
@@ -77,14 +154,27 @@ class Pool<Task>::CoroutinePtr final {
 
  private:
   Coroutine coro_;
+  StackContext stack_;
   Pool<Task>* pool_;
 };
 
+template <typename Task>
+Pool<Task>::LocalCache::~LocalCache() {
+  if (!owner) return;
+  // Worker threads are joined before the pool is destroyed. The thread-local
+  // tokens may be already destroyed at the thread exit, so they are not used.
+  for (auto& coroutine : coroutines) {
+    if (!owner->PushIdle(std::move(coroutine), nullptr)) {
+      --owner->idle_coroutines_num_;
+    }
+  }
+}
+
 template <typename Task>
 Pool<Task>::Pool(PoolConfig config, Executor executor)
     : config_(std::move(config)),
       executor_(executor),
-      stack_allocator_(config.stack_size),
+      stack_allocator_(config_.stack_size),
       coroutines_(config_.max_size),
       idle_coroutines_num_(config_.initial_size),
       total_coroutines_num_(0) {
@@ -93,61 +183,105 @@ Pool<Task>::Pool(PoolConfig config, Executor executor)
     bool ok = coroutines_.enqueue(token, CreateCoroutine(/*quiet =*/true));
     UINVARIANT(ok, "Failed to allocate the initial coro pool");
   }
+
+  if (config_.stack_reclaim_idle_threshold.count() > 0) {
+    reclaimer_ = std::thread([this] { RunStackReclaimer(); });
+  }
 }
 
 template <typename Task>
-Pool<Task>::~Pool() = default;
+Pool<Task>::~Pool() {
+  if (reclaimer_.joinable()) {
+    {
+      std::lock_guard lock(reclaimer_mutex_);
+      is_reclaimer_stopped_ = true;
+    }
+    reclaimer_cv_.notify_all();
+    reclaimer_.join();
+  }
+}
 
 template <typename Task>
 typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
   struct CoroutineMover {
-    std::optional<Coroutine>& result;
+    std::optional<IdleCoroutine>& result;
 
-    CoroutineMover& operator=(Coroutine&& coro) {
+    CoroutineMover& operator=(IdleCoroutine&& coro) {
       result.emplace(std::move(coro));
       return *this;
     }
   };
 
-  std::optional<Coroutine> coroutine;
-  CoroutineMover mover{coroutine};
-  auto& token = GetToken<moodycamel::ConsumerToken>();
-  if (coroutines_.try_dequeue(token, mover)) {
+  std::optional<IdleCoroutine> coroutine;
+  auto* cache = GetLocalCache();
+  if (cache && !cache->coroutines.empty()) {
+    coroutine.emplace(std::move(cache->coroutines.back()));
+    cache->coroutines.pop_back();
     --idle_coroutines_num_;
   } else {
-    coroutine.emplace(CreateCoroutine());
+    CoroutineMover mover{coroutine};
+    auto* token = GetToken<moodycamel::ConsumerToken>();
+    if (token ? coroutines_.try_dequeue(*token, mover)
+              : coroutines_.try_dequeue(mover)) {
+      --idle_coroutines_num_;
+    } else {
+      coroutine.emplace(CreateCoroutine());
+    }
   }
-  return CoroutinePtr(std::move(*coroutine), *this);
+
+  if (coroutine->is_reclaimed) --reclaimed_coroutines_num_;
+  return CoroutinePtr(std::move(coroutine->coroutine), coroutine->stack,
+                      *this);
 }
 
 template <typename Task>
 void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
   if (idle_coroutines_num_.load() >= config_.max_size) return;
-  auto& token = GetToken<moodycamel::ProducerToken>();
-  const bool ok = coroutines_.enqueue(token, std::move(coroutine_ptr.Get()));
-  if (ok) ++idle_coroutines_num_;
+
+  IdleCoroutine coroutine{std::move(coroutine_ptr.Get()),
+                          coroutine_ptr.GetStack(), {}, false};
+  auto* cache = GetLocalCache();
+  if (!cache) {
+    if (PushIdle(std::move(coroutine))) ++idle_coroutines_num_;
+    return;
+  }
+
+  if (cache->coroutines.size() >= config_.local_cache_size) {
+    SpillLocalCache(*cache);
+  }
+  cache->coroutines.push_back(std::move(coroutine));
+  ++idle_coroutines_num_;
 }
 
 template <typename Task>
 PoolStats Pool<Task>::GetStats() const {
   PoolStats stats;
-  stats.active_coroutines =
-      total_coroutines_num_.load() - coroutines_.size_approx();
-  stats.total_coroutines =
-      std::max(total_coroutines_num_.load(), stats.active_coroutines);
+  const auto total = total_coroutines_num_.load();
+  const auto idle = idle_coroutines_num_.load();
+  stats.active_coroutines = total - std::min(idle, total);
+  stats.total_coroutines = std::max(total, stats.active_coroutines);
+
+  const auto reclaimed =
+      std::min(reclaimed_coroutines_num_.load(), stats.total_coroutines);
+  stats.reserved_stack_bytes = stats.total_coroutines * config_.stack_size;
+  stats.resident_stack_bytes =
+      (stats.total_coroutines - reclaimed) * config_.stack_size +
+      reclaimed * std::min(kIdleStackTopSize, config_.stack_size);
   return stats;
 }
 
 template <typename Task>
-typename Pool<Task>::Coroutine Pool<Task>::CreateCoroutine(bool quiet) {
+typename Pool<Task>::IdleCoroutine Pool<Task>::CreateCoroutine(bool quiet) {
   try {
-    Coroutine coroutine(stack_allocator_, executor_);
+    StackContext stack{};
+    Coroutine coroutine(RecordingStackAllocator{stack_allocator_, &stack},
+                        executor_);
     const auto new_total = ++total_coroutines_num_;
     if (!quiet) {
       LOG_DEBUG() << "Created a coroutine #" << new_total << '/'
                   << config_.max_size;
     }
-    return coroutine;
+    return IdleCoroutine{std::move(coroutine), stack, {}, false};
   } catch (const std::bad_alloc&) {
     if (errno == ENOMEM) {
       // It should be ok to allocate here (which LOG_ERROR might do),
@@ -175,11 +309,154 @@ std::size_t Pool<Task>::GetStackSize() const {
   return config_.stack_size;
 }
 
+template <typename Task>
+typename Pool<Task>::LocalCache* Pool<Task>::GetLocalCache() {
+  if (config_.local_cache_size == 0) return nullptr;
+
+  // Coroutines are only taken and returned by the worker threads of a single
+  // TaskProcessor, outside of any coroutine
+  thread_local LocalCache caches[kMaxThreadLocalPools];
+  for (auto& cache : caches) {
+    if (cache.owner == this) return &cache;
+    if (!cache.owner) {
+      cache.owner = this;
+      cache.coroutines.reserve(config_.local_cache_size);
+      return &cache;
+    }
+  }
+  return nullptr;
+}
+
+template <typename Task>
+void Pool<Task>::SpillLocalCache(LocalCache& cache) {
+  // The coldest coroutines are at the front
+  const auto spill_count =
+      std::max<std::size_t>(cache.coroutines.size() / 2, 1);
+  for (std::size_t i = 0; i < spill_count; ++i) {
+    if (!PushIdle(std::move(cache.coroutines[i]))) --idle_coroutines_num_;
+  }
+  cache.coroutines.erase(cache.coroutines.begin(),
+                         cache.coroutines.begin() + spill_count);
+}
+
+template <typename Task>
+bool Pool<Task>::PushIdle(IdleCoroutine&& coroutine) {
+  return PushIdle(std::move(coroutine),
+                  GetToken<moodycamel::ProducerToken>());
+}
+
+template <typename Task>
+bool Pool<Task>::PushIdle(IdleCoroutine&& coroutine,
+                          moodycamel::ProducerToken* token) {
+  coroutine.idle_since = std::chrono::steady_clock::now();
+  if (token ? coroutines_.enqueue(*token, std::move(coroutine))
+            : coroutines_.enqueue(std::move(coroutine))) {
+    return true;
+  }
+
+  OnIdleCoroutineDropped(coroutine);
+  return false;
+}
+
+template <typename Task>
+void Pool<Task>::OnIdleCoroutineDropped(
+    const IdleCoroutine& coroutine) noexcept {
+  if (coroutine.is_reclaimed) --reclaimed_coroutines_num_;
+  OnCoroutineDestruction();
+}
+
+template <typename Task>
+void Pool<Task>::RunStackReclaimer() {
+  utils::SetCurrentThreadName("coro-reclaimer");
+
+  std::unique_lock lock(reclaimer_mutex_);
+  while (!reclaimer_cv_.wait_for(lock, config_.stack_reclaim_idle_threshold,
+                                 [this] { return is_reclaimer_stopped_; })) {
+    lock.unlock();
+    ReclaimIdleStacks();
+    lock.lock();
+  }
+}
+
+template <typename Task>
+void Pool<Task>::ReclaimIdleStacks() {
+  // Take a small batch at a time to leave the rest available for workers
+  static constexpr std::size_t kBatchSize = 64;
+
+  struct CoroutineAppender {
+    std::vector<IdleCoroutine>& result;
+
+    CoroutineAppender& operator=(IdleCoroutine&& coro) {
+      result.push_back(std::move(coro));
+      return *this;
+    }
+  };
+
+  std::vector<IdleCoroutine> batch;
+  batch.reserve(kBatchSize);
+  CoroutineAppender appender{batch};
+
+  moodycamel::ProducerToken producer_token(coroutines_);
+  moodycamel::ConsumerToken consumer_token(coroutines_);
+  const auto deadline =
+      std::chrono::steady_clock::now() - config_.stack_reclaim_idle_threshold;
+
+  auto left = coroutines_.size_approx();
+  while (left > 0) {
+    while (batch.size() < std::min(left, kBatchSize) &&
+           coroutines_.try_dequeue(consumer_token, appender)) {
+    }
+    if (batch.empty()) break;
+    left -= std::min(left, batch.size());
+
+    for (auto& coroutine : batch) {
+      if (!coroutine.is_reclaimed && coroutine.idle_since <= deadline) {
+        ReclaimStack(coroutine);
+      }
+    }
+
+    if (!coroutines_.enqueue_bulk(producer_token,
+                                  std::make_move_iterator(batch.begin()),
+                                  batch.size())) {
+      for (const auto& coroutine : batch) OnIdleCoroutineDropped(coroutine);
+      idle_coroutines_num_ -= batch.size();
+    }
+    batch.clear();
+  }
+}
+
+template <typename Task>
+void Pool<Task>::ReclaimStack(IdleCoroutine& coroutine) noexcept {
+  static const auto kPageSize =
+      static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+  auto* const top = static_cast<char*>(coroutine.stack.sp);
+  // skip the guard page at the bottom
+  auto* const bottom = top - coroutine.stack.size + kPageSize;
+  const auto keep_size =
+      (kIdleStackTopSize + kPageSize - 1) / kPageSize * kPageSize;
+  if (top - bottom <= static_cast<std::ptrdiff_t>(keep_size)) return;
+
+  auto* const reclaim_end = top - keep_size;
+  if (::madvise(bottom, reclaim_end - bottom, MADV_DONTNEED) == 0) {
+    coroutine.is_reclaimed = true;
+    ++reclaimed_coroutines_num_;
+  }
+}
+
 template <typename Task>
 template <typename Token>
-Token& Pool<Task>::GetToken() {
-  thread_local Token token(coroutines_);
-  return token;
+Token* Pool<Task>::GetToken() {
+  thread_local LocalToken<Token> tokens[kMaxThreadLocalPools];
+  for (auto& token : tokens) {
+    if (token.owner == this) return &*token.token;
+    if (!token.owner) {
+      token.token.emplace(coroutines_);
+      token.owner = this;
+      return &*token.token;
+    }
+  }
+  return nullptr;
 }
 
 }  // namespace engine::coro
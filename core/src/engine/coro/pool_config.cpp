@@ -10,6 +10,18 @@ PoolConfig Parse(const yaml_config::YamlConfig& value,
   config.initial_size = value["initial_size"].As<size_t>();
   config.max_size = value["max_size"].As<size_t>();
   config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
+  config.local_cache_size =
+      value["local_cache_size"].As<size_t>(config.local_cache_size);
+  config.stack_reclaim_idle_threshold =
+      value["stack_reclaim_idle_threshold"].As<std::chrono::milliseconds>(
+          config.stack_reclaim_idle_threshold);
+  config.small_stack_size =
+      value["small_stack_size"].As<size_t>(config.small_stack_size);
+  config.large_stack_size =
+      value["large_stack_size"].As<size_t>(config.large_stack_size);
+  config.stack_usage_sampling_period =
+      value["stack_usage_sampling_period"].As<size_t>(
+          config.stack_usage_sampling_period);
   return config;
 }
 
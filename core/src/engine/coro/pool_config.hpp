@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
@@ -13,6 +14,14 @@ struct PoolConfig {
   size_t initial_size = 1000;
   size_t max_size = 10000;
   size_t stack_size = 256 * 1024ULL;
+  size_t local_cache_size = 32;
+  // Zero disables the reclamation of idle stacks
+  std::chrono::milliseconds stack_reclaim_idle_threshold{0};
+  // Zero disables the stack size class, tasks get the default stack_size
+  size_t small_stack_size = 0;
+  size_t large_stack_size = 0;
+  // Zero disables the sampling of stack high-water marks
+  size_t stack_usage_sampling_period = 0;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
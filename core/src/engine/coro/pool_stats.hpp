@@ -10,11 +10,17 @@ namespace engine::coro {
 struct PoolStats {
   size_t active_coroutines = 0;
   size_t total_coroutines = 0;
+  // Address space mapped for the stacks of all the coroutines
+  size_t reserved_stack_bytes = 0;
+  // Upper estimate: stacks are considered fully resident unless reclaimed
+  size_t resident_stack_bytes = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
   lhs.active_coroutines += rhs.active_coroutines;
   lhs.total_coroutines += rhs.total_coroutines;
+  lhs.reserved_stack_bytes += rhs.reserved_stack_bytes;
+  lhs.resident_stack_bytes += rhs.resident_stack_bytes;
   return lhs;
 }
 
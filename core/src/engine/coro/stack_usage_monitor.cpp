@@ -0,0 +1,93 @@
+#include "stack_usage_monitor.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <userver/compiler/demangle.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+constexpr std::uint64_t kStackPattern = 0x6b63617453755459ULL;  // "YTuStack"
+
+struct PaintedRange final {
+  std::uint64_t* begin{nullptr};
+  std::uint64_t* end{nullptr};
+};
+
+PaintedRange GetPaintedRange(const void* stack_top,
+                             std::size_t stack_size) noexcept {
+  static const auto kPageSize =
+      static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  if (stack_size <= kPageSize + kIdleStackTopSize) return {};
+
+  const auto top = reinterpret_cast<std::uintptr_t>(stack_top);
+  // skip the guard page at the bottom
+  const auto begin = top - stack_size + kPageSize;
+  const auto end = (top - kIdleStackTopSize) & ~(sizeof(std::uint64_t) - 1);
+  return {reinterpret_cast<std::uint64_t*>(begin),
+          reinterpret_cast<std::uint64_t*>(end)};
+}
+
+}  // namespace
+
+StackUsageMonitor::StackUsageMonitor(std::size_t sampling_period)
+    : sampling_period_(sampling_period) {}
+
+bool StackUsageMonitor::ShouldSample() noexcept {
+  if (!IsEnabled()) return false;
+  return tasks_started_.fetch_add(1, std::memory_order_relaxed) %
+             sampling_period_ ==
+         0;
+}
+
+void StackUsageMonitor::PaintStack(void* stack_top,
+                                   std::size_t stack_size) noexcept {
+  const auto range = GetPaintedRange(stack_top, stack_size);
+  std::fill(range.begin, range.end, kStackPattern);
+}
+
+std::size_t StackUsageMonitor::MeasureStackUsage(
+    const void* stack_top, std::size_t stack_size) noexcept {
+  const auto range = GetPaintedRange(stack_top, stack_size);
+  const auto* const first_used = std::find_if(
+      range.begin, range.end,
+      [](std::uint64_t word) { return word != kStackPattern; });
+  if (first_used == range.end) {
+    return std::min(kIdleStackTopSize, stack_size);
+  }
+  return static_cast<const char*>(stack_top) -
+         reinterpret_cast<const char*>(first_used);
+}
+
+void StackUsageMonitor::AccountStackUsage(std::type_index task_type,
+                                          std::size_t bytes) {
+  std::lock_guard lock(mutex_);
+  auto& max_bytes = max_usage_[task_type];
+  max_bytes = std::max(max_bytes, bytes);
+}
+
+std::vector<StackUsage> StackUsageMonitor::GetStackUsage() const {
+  std::vector<std::pair<std::type_index, std::size_t>> usage;
+  {
+    std::lock_guard lock(mutex_);
+    usage.assign(max_usage_.begin(), max_usage_.end());
+  }
+
+  std::vector<StackUsage> result;
+  result.reserve(usage.size());
+  for (const auto& [task_type, max_bytes] : usage) {
+    result.push_back({compiler::GetTypeName(task_type), max_bytes});
+  }
+  return result;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+// The top of an idle stack only holds the frames of the executor loop
+inline constexpr std::size_t kIdleStackTopSize = 16 * 1024;
+
+struct StackUsage final {
+  std::string task_type;
+  std::size_t max_bytes{0};
+};
+
+// Measures stack high-water marks of every N-th started task, per type of the
+// task payload. Painting and scanning the whole stack is expensive, so this is
+// meant to be used for choosing the stack size classes, not in production.
+class StackUsageMonitor final {
+ public:
+  // Zero sampling period disables the monitor
+  explicit StackUsageMonitor(std::size_t sampling_period);
+
+  bool IsEnabled() const noexcept { return sampling_period_ != 0; }
+
+  bool ShouldSample() noexcept;
+
+  // Fills the part of an idle coroutine stack below its top with a pattern
+  static void PaintStack(void* stack_top, std::size_t stack_size) noexcept;
+
+  // Returns the stack depth reached since the stack was painted
+  static std::size_t MeasureStackUsage(const void* stack_top,
+                                       std::size_t stack_size) noexcept;
+
+  void AccountStackUsage(std::type_index task_type, std::size_t bytes);
+
+  std::vector<StackUsage> GetStackUsage() const;
+
+ private:
+  const std::size_t sampling_period_;
+  std::atomic<std::size_t> tasks_started_{0};
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::type_index, std::size_t> max_usage_;
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#include <engine/cpu_affinity.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+std::vector<std::size_t> CpuAffinityConfig::GetThreadCpus(
+    std::size_t thread_index) const {
+  if (!pin_each_thread || cpus.empty()) return cpus;
+  return {cpus[thread_index % cpus.size()]};
+}
+
+CpuAffinityConfig Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<CpuAffinityConfig>) {
+  CpuAffinityConfig config;
+
+  const auto cpus = value["cpus"];
+  const auto numa_node = value["numa-node"];
+  if (!cpus.IsMissing() && !numa_node.IsMissing()) {
+    throw std::runtime_error(fmt::format(
+        "Only one of 'cpus' and 'numa-node' may be specified in '{}'",
+        value.GetPath()));
+  }
+
+  if (!cpus.IsMissing()) {
+    config.cpus = ParseCpuList(cpus.As<std::string>());
+  } else if (!numa_node.IsMissing()) {
+    config.cpus = GetNumaNodeCpus(numa_node.As<std::size_t>());
+  }
+  config.pin_each_thread =
+      value["pin-each-thread"].As<bool>(config.pin_each_thread);
+
+  return config;
+}
+
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+  std::vector<std::size_t> result;
+  for (auto range : utils::text::SplitIntoStringViewVector(cpu_list, ",")) {
+    while (!range.empty() && range.front() == ' ') range.remove_prefix(1);
+    while (!range.empty() && (range.back() == ' ' || range.back() == '\n')) {
+      range.remove_suffix(1);
+    }
+    if (range.empty()) continue;
+
+    const auto dash_pos = range.find('-');
+    if (dash_pos == std::string_view::npos) {
+      result.push_back(utils::FromString<std::size_t>(range));
+      continue;
+    }
+
+    const auto first =
+        utils::FromString<std::size_t>(range.substr(0, dash_pos));
+    const auto last =
+        utils::FromString<std::size_t>(range.substr(dash_pos + 1));
+    if (first > last) {
+      throw std::invalid_argument(
+          fmt::format("Invalid CPU range '{}' in CPU list '{}'", range,
+                      cpu_list));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+  }
+
+  if (result.empty()) {
+    throw std::invalid_argument(fmt::format("Empty CPU list '{}'", cpu_list));
+  }
+  return result;
+}
+
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node) {
+  const auto path =
+      fmt::format("/sys/devices/system/node/node{}/cpulist", numa_node);
+  if (!fs::blocking::FileExists(path)) {
+    throw std::runtime_error(
+        fmt::format("NUMA node {} was not found: '{}' is missing", numa_node,
+                    path));
+  }
+  return ParseCpuList(fs::blocking::ReadFileContents(path));
+}
+
+void SetThreadCpuAffinity(std::thread::native_handle_type thread,
+                          const std::vector<std::size_t>& cpus) noexcept {
+  UASSERT(!cpus.empty());
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) {
+      LOG_ERROR() << "CPU " << cpu << " is out of range, ignoring it";
+      continue;
+    }
+    CPU_SET(cpu, &cpu_set);
+  }
+
+  const auto result =
+      ::pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set);
+  if (result != 0) {
+    LOG_ERROR() << "Failed to set CPU affinity: "
+                << std::error_code(result, std::system_category()).message();
+  }
+#else
+  (void)thread;
+  LOG_WARNING() << "CPU affinity is not supported on this platform, ignoring "
+                   "it";
+#endif
+}
+
+void SetCurrentThreadCpuAffinity(const CpuAffinityConfig& config,
+                                 std::size_t thread_index) noexcept {
+  if (!config.IsEnabled()) return;
+  SetThreadCpuAffinity(::pthread_self(), config.GetThreadCpus(thread_index));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// CPU pinning settings for a group of engine threads
+struct CpuAffinityConfig {
+  /// CPUs the threads are allowed to run on, empty means no pinning
+  std::vector<std::size_t> cpus;
+
+  /// Pin each thread to a single CPU from `cpus` in round-robin manner,
+  /// otherwise each thread may run on any CPU from `cpus`
+  bool pin_each_thread{false};
+
+  bool IsEnabled() const noexcept { return !cpus.empty(); }
+
+  /// Returns the CPUs for the `thread_index`-th thread of the group
+  std::vector<std::size_t> GetThreadCpus(std::size_t thread_index) const;
+};
+
+/// Parses `cpus: "0-3,8,10-11"` and `numa-node: N` options
+CpuAffinityConfig Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<CpuAffinityConfig>);
+
+/// Parses the Linux CPU list format, e.g. "0-3,8,10-11"
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+/// Reads the CPUs of a NUMA node from sysfs. Does blocking file IO.
+std::vector<std::size_t> GetNumaNodeCpus(std::size_t numa_node);
+
+/// Restricts the thread to `cpus`, logs an error on failure
+void SetThreadCpuAffinity(std::thread::native_handle_type thread,
+                          const std::vector<std::size_t>& cpus) noexcept;
+
+/// Applies `config` to the current thread, which is the `thread_index`-th
+/// thread of its group
+void SetCurrentThreadCpuAffinity(const CpuAffinityConfig& config,
+                                 std::size_t thread_index) noexcept;
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include <engine/cpu_affinity.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CpuAffinity, ParseCpuList) {
+  EXPECT_THAT(engine::ParseCpuList("3"), testing::ElementsAre(3));
+  EXPECT_THAT(engine::ParseCpuList("0-3"), testing::ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(engine::ParseCpuList("0-1,8,10-11\n"),
+              testing::ElementsAre(0, 1, 8, 10, 11));
+  EXPECT_THAT(engine::ParseCpuList(" 4 , 6-7 "),
+              testing::ElementsAre(4, 6, 7));
+}
+
+TEST(CpuAffinity, ParseCpuListInvalid) {
+  EXPECT_ANY_THROW(engine::ParseCpuList(""));
+  EXPECT_ANY_THROW(engine::ParseCpuList("3-1"));
+  EXPECT_ANY_THROW(engine::ParseCpuList("a-b"));
+  EXPECT_ANY_THROW(engine::ParseCpuList("1-"));
+}
+
+TEST(CpuAffinity, GetThreadCpus) {
+  engine::CpuAffinityConfig config;
+  config.cpus = {2, 3, 5};
+  EXPECT_THAT(config.GetThreadCpus(0), testing::ElementsAre(2, 3, 5));
+
+  config.pin_each_thread = true;
+  EXPECT_THAT(config.GetThreadCpus(0), testing::ElementsAre(2));
+  EXPECT_THAT(config.GetThreadCpus(2), testing::ElementsAre(5));
+  EXPECT_THAT(config.GetThreadCpus(4), testing::ElementsAre(3));
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,7 +15,7 @@ bool Deadline::IsReached() const noexcept {
   if (!IsReachable()) return false;
   if (value_ == kPassed) return true;
 
-  return value_ <= TimePoint::clock::now();
+  return value_ <= utils::impl::FastSteadyNow();
 }
 
 bool Deadline::IsSurelyReachedApprox() const noexcept {
@@ -28,7 +29,7 @@ bool Deadline::IsSurelyReachedApprox() const noexcept {
 Deadline::Duration Deadline::TimeLeft() const noexcept {
   UASSERT(IsReachable());
   if (value_ == kPassed) return Duration::zero();
-  return value_ - TimePoint::clock::now();
+  return value_ - utils::impl::FastSteadyNow();
 }
 
 Deadline::Duration Deadline::TimeLeftApprox() const noexcept {
@@ -3,6 +3,8 @@
 #include <chrono>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
+#include <userver/utils/impl/userver_experiments.hpp>
 
 #include <utils/gbench_auxilary.hpp>
 
@@ -27,6 +29,32 @@ void deadline_is_reached(benchmark::State& state,
   }
 }
 
+void steady_clock_now(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+  }
+}
+
+void fast_steady_clock_now(benchmark::State& state) {
+  utils::impl::UserverExperimentsScope experiments;
+  experiments.Set(utils::impl::kFastSteadyClockExperiment, true);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::impl::FastSteadyNow());
+  }
+}
+
+void deadline_20ms_interval_construction_fast_clock(benchmark::State& state) {
+  utils::impl::UserverExperimentsScope experiments;
+  experiments.Set(utils::impl::kFastSteadyClockExperiment, true);
+  deadline_from_duration(state, std::chrono::milliseconds{20});
+}
+
+void deadline_20ms_interval_reached_fast_clock(benchmark::State& state) {
+  utils::impl::UserverExperimentsScope experiments;
+  experiments.Set(utils::impl::kFastSteadyClockExperiment, true);
+  deadline_is_reached(state, std::chrono::milliseconds{20});
+}
+
 void deadline_1us_interval_construction(benchmark::State& state) {
   deadline_from_duration(state, std::chrono::microseconds{1});
 }
@@ -49,6 +77,9 @@ void deadline_100s_interval_reached(benchmark::State& state) {
 
 }  // namespace
 
+BENCHMARK(steady_clock_now);
+BENCHMARK(fast_steady_clock_now);
+
 BENCHMARK(deadline_1us_interval_construction);
 BENCHMARK(deadline_20ms_interval_construction);
 
@@ -56,4 +87,7 @@ BENCHMARK(deadline_1us_interval_reached);
 BENCHMARK(deadline_20ms_interval_reached);
 BENCHMARK(deadline_100s_interval_reached);
 
+BENCHMARK(deadline_20ms_interval_construction_fast_clock);
+BENCHMARK(deadline_20ms_interval_reached_fast_clock);
+
 USERVER_NAMESPACE_END
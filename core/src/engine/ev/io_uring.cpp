@@ -0,0 +1,406 @@
+#include "io_uring.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define USERVER_IMPL_HAS_IO_URING
+#endif
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+#ifdef USERVER_IMPL_HAS_IO_URING
+
+namespace {
+
+std::string GetErrnoMessage(int error_code) {
+  return std::error_code(error_code, std::system_category()).message();
+}
+
+int IoUringSetup(unsigned entries, io_uring_params* params) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+int IoUringRegister(int ring_fd, unsigned opcode, void* arg,
+                    unsigned nr_args) noexcept {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+bool AreOpcodesSupported(int ring_fd) {
+  constexpr unsigned kProbeOps = 256;
+  std::vector<std::byte> buffer(sizeof(io_uring_probe) +
+                                kProbeOps * sizeof(io_uring_probe_op));
+  auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+  if (IoUringRegister(ring_fd, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+    return false;
+  }
+
+  for (const auto opcode :
+       {IORING_OP_RECV, IORING_OP_SEND, IORING_OP_SENDMSG, IORING_OP_ACCEPT,
+        IORING_OP_READ, IORING_OP_WRITE, IORING_OP_ASYNC_CANCEL}) {
+    if (opcode > probe->last_op ||
+        !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void* MapRing(int ring_fd, std::size_t size, off_t offset) noexcept {
+  void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+  return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+template <typename T>
+T* RingPtr(void* ring, unsigned offset) noexcept {
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+// Lets the ev thread reap the completions and the kernel free the submission
+// queue slots, without spinning on a full queue
+void YieldForSubmissionSlot() noexcept {
+  if (current_task::IsTaskProcessorThread()) {
+    engine::Yield();
+  } else {
+    std::this_thread::yield();
+  }
+}
+
+void FillSqe(io_uring_sqe& sqe, const IoUringRequest& request) noexcept {
+  sqe.fd = request.fd;
+  sqe.addr = reinterpret_cast<std::uint64_t>(request.addr);
+  sqe.len = static_cast<std::uint32_t>(std::min<std::uint64_t>(
+      request.len, std::numeric_limits<std::uint32_t>::max()));
+
+  switch (request.opcode) {
+    case IoUringOpcode::kRecv:
+      sqe.opcode = IORING_OP_RECV;
+      sqe.msg_flags = request.flags;
+      break;
+    case IoUringOpcode::kSend:
+      sqe.opcode = IORING_OP_SEND;
+      sqe.msg_flags = request.flags;
+      break;
+    case IoUringOpcode::kSendMsg:
+      sqe.opcode = IORING_OP_SENDMSG;
+      sqe.len = 1;
+      sqe.msg_flags = request.flags;
+      break;
+    case IoUringOpcode::kAccept:
+      sqe.opcode = IORING_OP_ACCEPT;
+      sqe.len = 0;
+      sqe.addr2 = reinterpret_cast<std::uint64_t>(request.addr2);
+      sqe.accept_flags = request.flags;
+      break;
+    case IoUringOpcode::kRead:
+      sqe.opcode = IORING_OP_READ;
+      // use the current file position
+      sqe.off = std::numeric_limits<std::uint64_t>::max();
+      break;
+    case IoUringOpcode::kWrite:
+      sqe.opcode = IORING_OP_WRITE;
+      sqe.off = std::numeric_limits<std::uint64_t>::max();
+      break;
+  }
+}
+
+}  // namespace
+
+struct IoUring::Rings final {
+  ~Rings() {
+    if (sqes) ::munmap(sqes, sqes_size);
+    if (cq_ring && cq_ring != sq_ring) ::munmap(cq_ring, cq_ring_size);
+    if (sq_ring) ::munmap(sq_ring, sq_ring_size);
+  }
+
+  void* sq_ring{nullptr};
+  std::size_t sq_ring_size{0};
+  void* cq_ring{nullptr};
+  std::size_t cq_ring_size{0};
+  io_uring_sqe* sqes{nullptr};
+  std::size_t sqes_size{0};
+
+  // Shared with the kernel
+  unsigned* sq_head{nullptr};
+  unsigned* sq_tail{nullptr};
+  unsigned* sq_flags{nullptr};
+  unsigned* sq_array{nullptr};
+  unsigned sq_mask{0};
+  unsigned sq_entries{0};
+
+  unsigned* cq_head{nullptr};
+  unsigned* cq_tail{nullptr};
+  io_uring_cqe* cqes{nullptr};
+  unsigned cq_mask{0};
+};
+
+std::unique_ptr<IoUring> IoUring::TryCreate(std::size_t entries) {
+  io_uring_params params{};
+  const int ring_fd = IoUringSetup(static_cast<unsigned>(entries), &params);
+  if (ring_fd < 0) {
+    LOG_WARNING() << "io_uring is not available, falling back to libev: "
+                  << GetErrnoMessage(errno);
+    return nullptr;
+  }
+  utils::FastScopeGuard close_ring([ring_fd]() noexcept { ::close(ring_fd); });
+
+  // Without NODROP completions may be lost, hanging their waiters forever
+  if (!(params.features & IORING_FEAT_NODROP) ||
+      !AreOpcodesSupported(ring_fd)) {
+    LOG_WARNING() << "io_uring of this kernel lacks the required features, "
+                     "falling back to libev";
+    return nullptr;
+  }
+
+  auto rings = std::make_unique<Rings>();
+  rings->sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  rings->cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool is_single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (is_single_mmap) {
+    rings->sq_ring_size = rings->cq_ring_size =
+        std::max(rings->sq_ring_size, rings->cq_ring_size);
+  }
+
+  rings->sq_ring = MapRing(ring_fd, rings->sq_ring_size, IORING_OFF_SQ_RING);
+  rings->cq_ring =
+      is_single_mmap
+          ? rings->sq_ring
+          : MapRing(ring_fd, rings->cq_ring_size, IORING_OFF_CQ_RING);
+  rings->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  rings->sqes = static_cast<io_uring_sqe*>(
+      MapRing(ring_fd, rings->sqes_size, IORING_OFF_SQES));
+  if (!rings->sq_ring || !rings->cq_ring || !rings->sqes) {
+    LOG_WARNING() << "Failed to map io_uring rings, falling back to libev: "
+                  << GetErrnoMessage(errno);
+    return nullptr;
+  }
+
+  rings->sq_head = RingPtr<unsigned>(rings->sq_ring, params.sq_off.head);
+  rings->sq_tail = RingPtr<unsigned>(rings->sq_ring, params.sq_off.tail);
+  rings->sq_flags = RingPtr<unsigned>(rings->sq_ring, params.sq_off.flags);
+  rings->sq_array = RingPtr<unsigned>(rings->sq_ring, params.sq_off.array);
+  rings->sq_mask = *RingPtr<unsigned>(rings->sq_ring, params.sq_off.ring_mask);
+  rings->sq_entries = params.sq_entries;
+  rings->cq_head = RingPtr<unsigned>(rings->cq_ring, params.cq_off.head);
+  rings->cq_tail = RingPtr<unsigned>(rings->cq_ring, params.cq_off.tail);
+  rings->cqes = RingPtr<io_uring_cqe>(rings->cq_ring, params.cq_off.cqes);
+  rings->cq_mask = *RingPtr<unsigned>(rings->cq_ring, params.cq_off.ring_mask);
+
+  int event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (event_fd < 0 || IoUringRegister(ring_fd, IORING_REGISTER_EVENTFD,
+                                      &event_fd, 1) < 0) {
+    LOG_WARNING() << "Failed to set up io_uring notifications, falling back "
+                     "to libev: "
+                  << GetErrnoMessage(errno);
+    if (event_fd >= 0) ::close(event_fd);
+    return nullptr;
+  }
+
+  close_ring.Release();
+  return std::unique_ptr<IoUring>(
+      new IoUring(ring_fd, event_fd, std::move(rings)));
+}
+
+IoUring::IoUring(int ring_fd, int event_fd, std::unique_ptr<Rings> rings)
+    : ring_fd_(ring_fd), event_fd_(event_fd), rings_(std::move(rings)) {}
+
+IoUring::~IoUring() {
+  ::close(event_fd_);
+  ::close(ring_fd_);
+}
+
+std::optional<int> IoUring::Perform(IoUringOperation& operation,
+                                    const IoUringRequest& request,
+                                    Deadline deadline) {
+  operation.completed_.Reset();
+  operation.result_ = 0;
+  operation.is_in_flight_.store(true);
+  utils::FastScopeGuard reset_in_flight(
+      [&operation]() noexcept { operation.is_in_flight_.store(false); });
+
+  while (true) {
+    {
+      std::lock_guard lock(submission_mutex_);
+      if (TryPushRequest(request, &operation)) break;
+    }
+    // The kernel frees the submission queue slots on io_uring_enter
+    SubmitPending();
+    YieldForSubmissionSlot();
+  }
+  SubmitPending();
+
+  if (operation.completed_.WaitForEventUntil(deadline)) {
+    return operation.result_;
+  }
+
+  Cancel(operation);
+  {
+    // The kernel may still write into the buffers of the request. The wait
+    // sleeps until the ev thread reaps the completion and cannot be
+    // interrupted with the cancellation blocked.
+    TaskCancellationBlocker block_cancel;
+    [[maybe_unused]] const bool is_completed =
+        operation.completed_.WaitForEventUntil(Deadline{});
+    UASSERT(is_completed);
+  }
+
+  if (operation.result_ == -ECANCELED) return std::nullopt;
+  return operation.result_;
+}
+
+void IoUring::Cancel(IoUringOperation& operation) noexcept {
+  if (!operation.is_in_flight_.load()) return;
+
+  while (true) {
+    {
+      std::lock_guard lock(submission_mutex_);
+      if (TryPushCancel(operation)) break;
+    }
+    SubmitPending();
+    YieldForSubmissionSlot();
+  }
+  SubmitPending();
+}
+
+void IoUring::ReapCompletions() noexcept {
+  std::uint64_t notifications = 0;
+  [[maybe_unused]] const auto read_result =
+      ::read(event_fd_, &notifications, sizeof(notifications));
+
+  auto& rings = *rings_;
+  while (true) {
+    auto head = *rings.cq_head;
+    const auto tail = __atomic_load_n(rings.cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+      const auto& cqe = rings.cqes[head & rings.cq_mask];
+      // Cancellation requests have no operation
+      if (!cqe.user_data) continue;
+
+      auto* operation = reinterpret_cast<IoUringOperation*>(cqe.user_data);
+      operation->result_ = cqe.res;
+      // The waiter may destroy the operation right after this
+      operation->completed_.Send();
+    }
+    __atomic_store_n(rings.cq_head, head, __ATOMIC_RELEASE);
+
+    // Completions that did not fit into the queue are kept by the kernel
+    if (!(__atomic_load_n(rings.sq_flags, __ATOMIC_RELAXED) &
+          IORING_SQ_CQ_OVERFLOW)) {
+      break;
+    }
+    IoUringEnter(ring_fd_, 0, 0, IORING_ENTER_GETEVENTS);
+  }
+
+  // Retry the submissions that failed with EBUSY while the queue was full
+  SubmitPending();
+}
+
+bool IoUring::TryPushRequest(const IoUringRequest& request,
+                             IoUringOperation* operation) noexcept {
+  auto& rings = *rings_;
+  const auto head = __atomic_load_n(rings.sq_head, __ATOMIC_ACQUIRE);
+  const auto tail = *rings.sq_tail;
+  if (tail - head >= rings.sq_entries) return false;
+
+  const auto index = tail & rings.sq_mask;
+  auto& sqe = rings.sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  FillSqe(sqe, request);
+  sqe.user_data = reinterpret_cast<std::uint64_t>(operation);
+  rings.sq_array[index] = index;
+  __atomic_store_n(rings.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool IoUring::TryPushCancel(IoUringOperation& operation) noexcept {
+  auto& rings = *rings_;
+  const auto head = __atomic_load_n(rings.sq_head, __ATOMIC_ACQUIRE);
+  const auto tail = *rings.sq_tail;
+  if (tail - head >= rings.sq_entries) return false;
+
+  const auto index = tail & rings.sq_mask;
+  auto& sqe = rings.sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_ASYNC_CANCEL;
+  sqe.fd = -1;
+  sqe.addr = reinterpret_cast<std::uint64_t>(&operation);
+  sqe.user_data = 0;
+  rings.sq_array[index] = index;
+  __atomic_store_n(rings.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+void IoUring::SubmitPending() noexcept {
+  auto& rings = *rings_;
+  const auto tail = __atomic_load_n(rings.sq_tail, __ATOMIC_ACQUIRE);
+  const auto head = __atomic_load_n(rings.sq_head, __ATOMIC_ACQUIRE);
+  if (tail == head) return;
+
+  // Several submitters may race here, the kernel takes what is available
+  if (IoUringEnter(ring_fd_, tail - head, 0, 0) < 0) {
+    const auto error_code = errno;
+    if (error_code != EINTR && error_code != EAGAIN && error_code != EBUSY) {
+      LOG_ERROR() << "Failed to submit io_uring requests: "
+                  << GetErrnoMessage(error_code);
+    }
+  }
+}
+
+#else
+
+struct IoUring::Rings final {};
+
+std::unique_ptr<IoUring> IoUring::TryCreate(std::size_t) {
+  LOG_WARNING() << "io_uring is not supported on this platform, falling back "
+                   "to libev";
+  return nullptr;
+}
+
+IoUring::IoUring(int ring_fd, int event_fd, std::unique_ptr<Rings> rings)
+    : ring_fd_(ring_fd), event_fd_(event_fd), rings_(std::move(rings)) {}
+
+IoUring::~IoUring() = default;
+
+std::optional<int> IoUring::Perform(IoUringOperation&, const IoUringRequest&,
+                                    Deadline) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+void IoUring::Cancel(IoUringOperation&) noexcept {}
+
+void IoUring::ReapCompletions() noexcept {}
+
+#endif
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
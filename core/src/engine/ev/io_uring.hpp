@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+enum class IoUringOpcode {
+  kRecv,
+  kSend,
+  kSendMsg,
+  kAccept,
+  kRead,
+  kWrite,
+};
+
+struct IoUringRequest final {
+  IoUringOpcode opcode{IoUringOpcode::kRecv};
+  int fd{-1};
+  // Buffer, msghdr for kSendMsg, sockaddr for kAccept
+  void* addr{nullptr};
+  // socklen_t for kAccept
+  void* addr2{nullptr};
+  std::uint64_t len{0};
+  // msg_flags for kRecv, kSend and kSendMsg, accept_flags for kAccept
+  int flags{0};
+};
+
+/// State of a single in-flight request, must outlive its completion
+class IoUringOperation final {
+ public:
+  IoUringOperation() = default;
+
+  IoUringOperation(const IoUringOperation&) = delete;
+  IoUringOperation& operator=(const IoUringOperation&) = delete;
+
+ private:
+  friend class IoUring;
+
+  int result_{0};
+  std::atomic<bool> is_in_flight_{false};
+  engine::SingleConsumerEvent completed_;
+};
+
+/// @brief A completion based I/O backend for an ev::Thread.
+///
+/// Requests are submitted from coroutines on any thread, completions are
+/// reaped by the owning ev thread on a notification from an eventfd.
+class IoUring final {
+ public:
+  // Returns nullptr if io_uring is not supported by the kernel
+  static std::unique_ptr<IoUring> TryCreate(std::size_t entries);
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+  ~IoUring();
+
+  /// @brief Submits the request and waits for it to complete.
+  ///
+  /// On deadline or task cancellation the request is cancelled, but the call
+  /// still waits for the kernel to release the buffers of the request.
+  /// @returns io_uring_cqe::res of the request, std::nullopt if the request
+  /// was cancelled due to the deadline or the task cancellation.
+  std::optional<int> Perform(IoUringOperation& operation,
+                             const IoUringRequest& request, Deadline deadline);
+
+  /// Cancels the operation if it is in flight, thread-safe
+  void Cancel(IoUringOperation& operation) noexcept;
+
+  /// Becomes readable when there are completions to reap
+  int GetEventFd() const noexcept { return event_fd_; }
+
+  /// Must be called from the owning ev thread only
+  void ReapCompletions() noexcept;
+
+ private:
+  struct Rings;
+
+  IoUring(int ring_fd, int event_fd, std::unique_ptr<Rings> rings);
+
+  // Returns false if the submission queue is full
+  bool TryPushRequest(const IoUringRequest& request,
+                      IoUringOperation* operation) noexcept;
+  bool TryPushCancel(IoUringOperation& operation) noexcept;
+  void SubmitPending() noexcept;
+
+  const int ring_fd_;
+  const int event_fd_;
+  const std::unique_ptr<Rings> rings_;
+
+  std::mutex submission_mutex_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include "thread.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 #include <stdexcept>
 
 #include <sys/param.h>
@@ -12,13 +14,16 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/thread_name.hpp>
 
+#include <engine/cpu_affinity.hpp>
 #include <utils/check_syscall.hpp>
 #include <utils/impl/assert_extra.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include "child_process_map.hpp"
+#include "io_uring.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -57,25 +62,33 @@ void ReleaseEvDefaultLoop() {
   ev_default_loop_flag.clear();
 }
 
+// Payloads processed per wakeup before letting the other watchers run, the
+// rest is processed on the next ev-loop iteration
+constexpr std::size_t kMaxPayloadsPerWakeup = 1024;
+
 constexpr std::chrono::milliseconds kCpuStatsCollectInterval{1000};
 constexpr std::size_t kCpuStatsThrottle{16};
 
 }  // namespace
 
 Thread::Thread(const std::string& thread_name,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, false, register_event_mode) {}
+               RegisterEventMode register_event_mode,
+               std::size_t io_uring_entries)
+    : Thread(thread_name, false, register_event_mode, io_uring_entries) {}
 
 Thread::Thread(const std::string& thread_name, UseDefaultEvLoop,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, true, register_event_mode) {}
+               RegisterEventMode register_event_mode,
+               std::size_t io_uring_entries)
+    : Thread(thread_name, true, register_event_mode, io_uring_entries) {}
 
 Thread::Thread(const std::string& thread_name, bool use_ev_default_loop,
-               RegisterEventMode register_event_mode)
+               RegisterEventMode register_event_mode,
+               std::size_t io_uring_entries)
     : use_ev_default_loop_(use_ev_default_loop),
       register_event_mode_(register_event_mode),
       loop_(nullptr),
       lock_(loop_mutex_, std::defer_lock),
+      io_uring_entries_(io_uring_entries),
       name_{thread_name},
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
       is_running_(false) {
@@ -93,7 +106,7 @@ void Thread::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
   RegisterInEvLoop(payload);
 
   if (!IsInEvThread()) {
-    ev_async_send(loop_, &watch_update_);
+    WakeupEvLoop();
   }
 }
 
@@ -125,16 +138,50 @@ void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
   func_queue_.Push(payload);
 }
 
+void Thread::WakeupEvLoop() noexcept {
+  // Pairs with the exchange in ProcessQueue(), makes the pushed payloads
+  // visible to the ev thread
+  if (wakeup_pending_.exchange(true, std::memory_order_acq_rel)) return;
+
+  ++wakeups_count_;
+  ev_async_send(loop_, &watch_update_);
+}
+
 bool Thread::IsInEvThread() const {
   return (std::this_thread::get_id() == thread_.get_id());
 }
 
+void Thread::ScheduleTimer(TimerWheel::Timer& timer,
+                           TimerWheel::Clock::time_point expiry) noexcept {
+  UASSERT(IsInEvThread());
+  timer_wheel_.Schedule(timer, expiry);
+  RearmTimerWheelDriver();
+}
+
+void Thread::CancelTimer(TimerWheel::Timer& timer) noexcept {
+  UASSERT(IsInEvThread());
+  // The driver is not rearmed, a spurious wakeup is cheaper than a restart
+  timer_wheel_.Cancel(timer);
+}
+
 std::uint8_t Thread::GetCurrentLoadPercent() const {
   return cpu_stats_storage_.GetCurrentLoadPercent();
 }
 
 const std::string& Thread::GetName() const { return name_; }
 
+utils::statistics::Rate Thread::GetWakeupsCount() const noexcept {
+  return wakeups_count_.Load();
+}
+
+utils::statistics::Rate Thread::GetProcessedPayloadsCount() const noexcept {
+  return processed_payloads_count_.Load();
+}
+
+void Thread::SetCpuAffinity(const std::vector<std::size_t>& cpus) noexcept {
+  SetThreadCpuAffinity(thread_.native_handle(), cpus);
+}
+
 void Thread::Start() {
   loop_ = use_ev_default_loop_ ? ev_default_loop(EVFLAG_AUTO)
                                : ev_loop_new(EVFLAG_AUTO);
@@ -174,12 +221,25 @@ void Thread::Start() {
     ev_timer_start(loop_, &stats_timer_);
   }
 
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_init(&timer_wheel_driver_, TimerWheelWatcher);
+
   if (use_ev_default_loop_) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     ev_child_init(&watch_child_, ChildWatcher, 0, 0);
     ev_child_start(loop_, &watch_child_);
   }
 
+  if (io_uring_entries_ != 0) {
+    io_uring_ = IoUring::TryCreate(io_uring_entries_);
+  }
+  if (io_uring_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_io_init(&watch_io_uring_, IoUringWatcher, io_uring_->GetEventFd(),
+               EV_READ);
+    ev_io_start(loop_, &watch_io_uring_);
+  }
+
   is_running_ = true;
   thread_ = std::thread([this] {
     utils::SetCurrentThreadName(name_);
@@ -215,7 +275,9 @@ void Thread::RunEvLoop() {
   } else {
     ev_timer_stop(loop_, &stats_timer_);
   }
+  ev_timer_stop(loop_, &timer_wheel_driver_);
   if (use_ev_default_loop_) ev_child_stop(loop_, &watch_child_);
+  if (io_uring_) ev_io_stop(loop_, &watch_io_uring_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -232,8 +294,27 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
 }
 
 void Thread::UpdateLoopWatcherImpl() {
-  while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
-    LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
+  if (!ProcessQueue(kMaxPayloadsPerWakeup)) {
+    // Continue after the I/O watchers of this iteration had their turn
+    WakeupEvLoop();
+  }
+}
+
+bool Thread::ProcessQueue(std::size_t budget) {
+  // Submissions from now on have to wake us up again
+  wakeup_pending_.exchange(false, std::memory_order_acq_rel);
+
+  std::size_t processed = 0;
+  utils::FastScopeGuard stats_guard([&]() noexcept {
+    processed_payloads_count_ += utils::statistics::Rate{processed};
+  });
+
+  while (processed < budget) {
+    AsyncPayloadBase* payload = func_queue_.TryPop();
+    if (!payload) return true;
+
+    ++processed;
+    LOG_TRACE() << "Thread::ProcessQueue(), "
                 << compiler::GetTypeName(typeid(*payload));
     try {
       payload->PerformAndRelease();
@@ -241,6 +322,7 @@ void Thread::UpdateLoopWatcherImpl() {
       LOG_WARNING() << "exception in async thread func: " << ex;
     }
   }
+  return false;
 }
 
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -251,7 +333,8 @@ void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
 
 void Thread::BreakLoopWatcherImpl() {
   is_running_ = false;
-  UpdateLoopWatcherImpl();
+  // Everything submitted before the break must be processed
+  ProcessQueue(std::numeric_limits<std::size_t>::max());
   ev_break(loop_, EVBREAK_ALL);
 }
 
@@ -302,6 +385,47 @@ void Thread::ChildWatcherImpl(ev_child* w) {
   }
 }
 
+void Thread::IoUringWatcher(struct ev_loop* loop, ev_io*, int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  ev_thread->io_uring_->ReapCompletions();
+}
+
+void Thread::TimerWheelWatcher(struct ev_loop* loop, ev_timer*,
+                               int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  ev_thread->timer_wheel_.Advance(TimerWheel::Clock::now());
+  ev_thread->RearmTimerWheelDriver();
+}
+
+void Thread::RearmTimerWheelDriver() noexcept {
+  const auto next_wakeup = timer_wheel_.GetNextWakeup();
+  if (!next_wakeup) {
+    ev_timer_stop(loop_, &timer_wheel_driver_);
+    return;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  if (ev_is_active(&timer_wheel_driver_) &&
+      timer_wheel_driver_expiry_ <= *next_wakeup) {
+    // Waking up too early is fine, the driver is rearmed after Advance()
+    return;
+  }
+
+  using LibEvDuration = std::chrono::duration<double>;
+  const auto delay = std::max(*next_wakeup - TimerWheel::Clock::now(),
+                              TimerWheel::Clock::duration::zero());
+  timer_wheel_driver_expiry_ = *next_wakeup;
+
+  ev_timer_stop(loop_, &timer_wheel_driver_);
+  ev_now_update(loop_);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_set(&timer_wheel_driver_,
+               std::chrono::duration_cast<LibEvDuration>(delay).count(), 0.0);
+  ev_timer_start(loop_, &timer_wheel_driver_);
+}
+
 void Thread::Acquire(struct ev_loop* loop) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
@@ -5,19 +5,24 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <ev.h>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+class IoUring;
+
 class Thread final {
  public:
   struct UseDefaultEvLoop {};
@@ -34,8 +39,12 @@ class Thread final {
     kDeferred
   };
 
-  Thread(const std::string& thread_name, RegisterEventMode);
-  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode);
+  // Non-zero io_uring_entries enables the io_uring backend for the thread,
+  // if it is supported by the kernel
+  Thread(const std::string& thread_name, RegisterEventMode,
+         std::size_t io_uring_entries = 0);
+  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode,
+         std::size_t io_uring_entries = 0);
   ~Thread();
 
   struct ev_loop* GetEvLoop() const { return loop_; }
@@ -52,14 +61,33 @@ class Thread final {
 
   bool IsInEvThread() const;
 
+  // Coarse timers for the task deadlines, must be called from the ev thread
+  void ScheduleTimer(TimerWheel::Timer& timer,
+                     TimerWheel::Clock::time_point expiry) noexcept;
+  void CancelTimer(TimerWheel::Timer& timer) noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  // Count of the ev-loop wakeups for RunInEvLoopAsync(). Submissions that
+  // find a wakeup already in flight are coalesced with it.
+  utils::statistics::Rate GetWakeupsCount() const noexcept;
+  // Count of the payloads processed from the cross-thread queue
+  utils::statistics::Rate GetProcessedPayloadsCount() const noexcept;
+
+  void SetCpuAffinity(const std::vector<std::size_t>& cpus) noexcept;
+
+  // Returns nullptr if the io_uring backend is disabled or not supported
+  IoUring* GetIoUring() const noexcept { return io_uring_.get(); }
+
  private:
   Thread(const std::string& thread_name, bool use_ev_default_loop,
-         RegisterEventMode register_event_mode);
+         RegisterEventMode register_event_mode, std::size_t io_uring_entries);
 
   void RegisterInEvLoop(AsyncPayloadBase& payload);
+  void WakeupEvLoop() noexcept;
+  // Returns false if the budget was exhausted before the queue was drained
+  bool ProcessQueue(std::size_t budget);
 
   void Start();
 
@@ -73,6 +101,9 @@ class Thread final {
   void BreakLoopWatcherImpl();
   static void ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept;
   static void ChildWatcherImpl(ev_child* w);
+  static void IoUringWatcher(struct ev_loop*, ev_io* w, int) noexcept;
+  static void TimerWheelWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+  void RearmTimerWheelDriver() noexcept;
 
   static void Acquire(struct ev_loop* loop) noexcept;
   static void Release(struct ev_loop* loop) noexcept;
@@ -80,6 +111,11 @@ class Thread final {
   void ReleaseImpl() noexcept;
 
   concurrent::impl::IntrusiveMpscQueue<AsyncPayloadBase> func_queue_;
+  // Set if watch_update_ is already signalled and func_queue_ is going to be
+  // processed, so that the burst of submissions costs a single ev_async_send
+  std::atomic<bool> wakeup_pending_{false};
+  utils::statistics::RateCounter wakeups_count_;
+  utils::statistics::RateCounter processed_payloads_count_;
 
   bool use_ev_default_loop_;
   RegisterEventMode register_event_mode_;
@@ -94,6 +130,15 @@ class Thread final {
   ev_async watch_update_{};
   ev_async watch_break_{};
   ev_child watch_child_{};
+  ev_io watch_io_uring_{};
+
+  TimerWheel timer_wheel_;
+  // Wakes up the loop for the closest timer of the timer_wheel_
+  ev_timer timer_wheel_driver_{};
+  TimerWheel::Clock::time_point timer_wheel_driver_expiry_{};
+
+  const std::size_t io_uring_entries_;
+  std::unique_ptr<IoUring> io_uring_;
 
   const std::string name_;
   utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
@@ -36,6 +36,19 @@ const std::string& ThreadControlBase::GetName() const {
   return thread_.GetName();
 }
 
+utils::statistics::Rate ThreadControlBase::GetWakeupsCount() const noexcept {
+  return thread_.GetWakeupsCount();
+}
+
+utils::statistics::Rate ThreadControlBase::GetProcessedPayloadsCount()
+    const noexcept {
+  return thread_.GetProcessedPayloadsCount();
+}
+
+IoUring* ThreadControlBase::GetIoUring() const noexcept {
+  return thread_.GetIoUring();
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStart(ev_timer& w) noexcept {
   UASSERT(IsInEvThread());
@@ -85,6 +98,17 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoSchedule(
+    TimerWheel::Timer& timer, TimerWheel::Clock::time_point expiry) noexcept {
+  thread_.ScheduleTimer(timer, expiry);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoCancel(TimerWheel::Timer& timer) noexcept {
+  thread_.CancelTimer(timer);
+}
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -97,6 +121,17 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Schedule(
+    TimerWheel::Timer& timer, TimerWheel::Clock::time_point expiry) noexcept {
+  DoSchedule(timer, expiry);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Cancel(TimerWheel::Timer& timer) noexcept {
+  DoCancel(timer);
+}
+
 ThreadControl::ThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -9,9 +9,11 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -98,6 +100,7 @@ class CallerOwnedPayloadBlocking final
 }  // namespace impl
 
 class Thread;
+class IoUring;
 
 class ThreadControlBase {
  public:
@@ -131,6 +134,11 @@ class ThreadControlBase {
 
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
+  utils::statistics::Rate GetWakeupsCount() const noexcept;
+  utils::statistics::Rate GetProcessedPayloadsCount() const noexcept;
+
+  // Returns nullptr if the io_uring backend is disabled or not supported
+  IoUring* GetIoUring() const noexcept;
 
  protected:
   explicit ThreadControlBase(Thread& thread) noexcept;
@@ -146,6 +154,10 @@ class ThreadControlBase {
   void DoStart(ev_io& w) noexcept;
   void DoStop(ev_io& w) noexcept;
 
+  void DoSchedule(TimerWheel::Timer& timer,
+                  TimerWheel::Clock::time_point expiry) noexcept;
+  void DoCancel(TimerWheel::Timer& timer) noexcept;
+
  private:
   Thread& thread_;
 };
@@ -214,6 +226,12 @@ class TimerThreadControl final : public ThreadControlBase {
   void Start(ev_timer& w) noexcept;
   void Stop(ev_timer& w) noexcept;
   void Again(ev_timer& w) noexcept;
+
+  /// Coarse timers of the per-thread TimerWheel, much cheaper than ev_timer
+  /// for the distant expiry time points
+  void Schedule(TimerWheel::Timer& timer,
+                TimerWheel::Clock::time_point expiry) noexcept;
+  void Cancel(TimerWheel::Timer& timer) noexcept;
 };
 
 class ThreadControl final : public ThreadControlBase {
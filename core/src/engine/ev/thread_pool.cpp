@@ -30,6 +30,10 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
     : use_ev_default_loop_(use_ev_default_loop) {
   const auto register_timer_event_mode =
       GetRegisterEventMode(config.defer_events);
+  // Timer threads do no I/O, so only the default threads get a ring
+  const auto io_uring_entries = config.io_backend == IoBackend::kIoUring
+                                    ? config.io_uring_entries
+                                    : std::size_t{0};
 
   {
     default_threads_.threads =
@@ -38,14 +42,22 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
               fmt::format("{}_{}", config.thread_name, index);
           return (use_ev_default_loop && index == 0)
                      ? Thread(thread_name, Thread::kUseDefaultEvLoop,
-                              register_timer_event_mode)
-                     : Thread(thread_name, register_timer_event_mode);
+                              register_timer_event_mode, io_uring_entries)
+                     : Thread(thread_name, register_timer_event_mode,
+                              io_uring_entries);
         });
 
     default_threads_.thread_controls = utils::GenerateFixedArray(
         default_threads_.threads.size(), [&](std::size_t index) {
           return ThreadControl(default_threads_.threads[index]);
         });
+
+    if (config.cpu_affinity.IsEnabled()) {
+      for (std::size_t i = 0; i < default_threads_.threads.size(); ++i) {
+        default_threads_.threads[i].SetCpuAffinity(
+            config.cpu_affinity.GetThreadCpus(i));
+      }
+    }
   }
 
   {
@@ -67,6 +79,12 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
         threads_to_wrap.size(), [&threads_to_wrap](std::size_t index) {
           return TimerThreadControl{threads_to_wrap[index]};
         });
+
+    if (config.cpu_affinity.IsEnabled()) {
+      for (auto& thread : timer_threads_.threads) {
+        thread.SetCpuAffinity(config.cpu_affinity.cpus);
+      }
+    }
   }
 }
 
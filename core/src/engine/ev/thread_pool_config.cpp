@@ -1,9 +1,22 @@
 #include "thread_pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(IoBackend::kLibev, "libev")
+        .Case(IoBackend::kIoUring, "io_uring");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ThreadPoolConfig>) {
   ThreadPoolConfig config;
@@ -13,6 +26,11 @@ ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
           config.dedicated_timer_threads);
   config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
   config.defer_events = value["defer_events"].As<bool>(config.defer_events);
+  config.cpu_affinity =
+      value["cpu_affinity"].As<CpuAffinityConfig>(config.cpu_affinity);
+  config.io_backend = value["io_backend"].As<IoBackend>(config.io_backend);
+  config.io_uring_entries =
+      value["io_uring_entries"].As<std::size_t>(config.io_uring_entries);
   return config;
 }
 
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include <engine/cpu_affinity.hpp>
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -9,12 +10,23 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+enum class IoBackend {
+  kLibev,
+  kIoUring,
+};
+
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>);
+
 struct ThreadPoolConfig {
   std::size_t threads = 2;
   std::size_t dedicated_timer_threads = 0;
   std::string thread_name = "event-worker";
   bool ev_default_loop_disabled = false;
   bool defer_events = false;
+  CpuAffinityConfig cpu_affinity;
+  IoBackend io_backend = IoBackend::kLibev;
+  std::size_t io_uring_entries = 256;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
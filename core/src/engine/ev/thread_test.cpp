@@ -0,0 +1,42 @@
+#include <engine/ev/thread.hpp>
+
+#include <future>
+#include <vector>
+
+#include <engine/ev/thread_control.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(EvThread, CoalescedWakeups) {
+  constexpr std::size_t kSubmissionsCount = 10'000;
+
+  engine::ev::Thread thread{"ev-test",
+                            engine::ev::Thread::RegisterEventMode::kImmediate};
+  engine::ev::ThreadControl thread_control{thread};
+
+  std::promise<void> unblock;
+  thread_control.RunInEvLoopAsync(
+      [future = unblock.get_future()] { future.wait(); });
+
+  std::vector<std::size_t> processed;
+  processed.reserve(kSubmissionsCount);
+  for (std::size_t i = 0; i < kSubmissionsCount; ++i) {
+    thread_control.RunInEvLoopAsync(
+        [&processed, i] { processed.push_back(i); });
+  }
+  unblock.set_value();
+  thread_control.RunInEvLoopBlocking([] {});
+
+  ASSERT_EQ(processed.size(), kSubmissionsCount);
+  for (std::size_t i = 0; i < kSubmissionsCount; ++i) {
+    ASSERT_EQ(processed[i], i);
+  }
+
+  // The burst costs a single wakeup, plus a few to resume processing after
+  // the per-wakeup budget is exhausted
+  EXPECT_LT(thread.GetWakeupsCount().value, kSubmissionsCount / 100);
+  EXPECT_GE(thread.GetProcessedPayloadsCount().value, kSubmissionsCount + 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,204 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+constexpr std::size_t kBitsInWord = 64;
+
+}  // namespace
+
+TimerWheel::Timer::Timer(Callback callback, void* data) noexcept
+    : callback_(callback), data_(data) {}
+
+TimerWheel::Timer::~Timer() {
+  UASSERT_MSG(!IsScheduled(), "Timer is destroyed while still scheduled");
+}
+
+TimerWheel::Slot::Slot() noexcept {
+  head.prev = &head;
+  head.next = &head;
+}
+
+TimerWheel::Slot::~Slot() { UASSERT(IsEmpty()); }
+
+TimerWheel::TimerWheel(Clock::time_point now) noexcept : start_(now) {}
+
+TimerWheel::~TimerWheel() {
+  // Drop the remaining timers without firing them
+  for (auto& level : levels_) {
+    for (auto& slot : level) {
+      while (!slot.IsEmpty()) Remove(static_cast<Timer&>(*slot.head.next));
+    }
+  }
+}
+
+void TimerWheel::Schedule(Timer& timer, Clock::time_point expiry) noexcept {
+  if (timer.IsScheduled()) Remove(timer);
+
+  // Rounding up, so that the timer never fires too early
+  const auto expiry_tick =
+      ToTick(expiry + kTick - std::chrono::nanoseconds{1});
+  timer.expiry_tick_ = std::max(expiry_tick, current_tick_ + 1);
+  Place(timer);
+}
+
+void TimerWheel::Cancel(Timer& timer) noexcept {
+  if (timer.IsScheduled()) Remove(timer);
+}
+
+void TimerWheel::Advance(Clock::time_point now) noexcept {
+  const auto target_tick = ToTick(now);
+  while (current_tick_ < target_tick) {
+    if (scheduled_count_ == 0) {
+      current_tick_ = target_tick;
+      break;
+    }
+
+    if (level_counts_[0] == 0) {
+      // Nothing can fire until the next cascade
+      const auto skip_to = std::min(target_tick, FindNextCascadeTick() - 1);
+      if (skip_to > current_tick_) {
+        current_tick_ = skip_to;
+        continue;
+      }
+    }
+
+    ++current_tick_;
+    ProcessTick();
+  }
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::GetNextWakeup()
+    const noexcept {
+  if (scheduled_count_ == 0) return std::nullopt;
+
+  auto next_tick = FindNextCascadeTick();
+  if (level_counts_[0] != 0) {
+    next_tick = std::min(next_tick, FindNextFirstLevelTick());
+  }
+  return start_ + next_tick * kTick;
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point) const noexcept {
+  if (time_point <= start_) return 0;
+  return static_cast<std::uint64_t>((time_point - start_) / kTick);
+}
+
+void TimerWheel::Place(Timer& timer) noexcept {
+  UASSERT(!timer.IsScheduled());
+  UASSERT(timer.expiry_tick_ >= current_tick_);
+
+  // Too distant timers are parked in the last level and re-placed on cascade
+  const auto placement_tick =
+      current_tick_ +
+      std::min(timer.expiry_tick_ - current_tick_, kMaxDelayTicks);
+  const auto delta = placement_tick - current_tick_;
+
+  std::size_t level = 0;
+  while (level + 1 < kLevelsCount &&
+         delta >> (kSlotBits * (level + 1)) != 0) {
+    ++level;
+  }
+  const auto slot = (placement_tick >> (kSlotBits * level)) & kSlotMask;
+
+  auto& head = levels_[level][slot].head;
+  timer.prev = head.prev;
+  timer.next = &head;
+  head.prev->next = &timer;
+  head.prev = &timer;
+
+  timer.position_ = level * kSlotsCount + slot;
+  ++level_counts_[level];
+  ++scheduled_count_;
+  if (level == 0) {
+    first_level_bitmap_[slot / kBitsInWord] |= std::uint64_t{1}
+                                               << (slot % kBitsInWord);
+  }
+}
+
+void TimerWheel::Remove(Timer& timer) noexcept {
+  UASSERT(timer.IsScheduled());
+
+  timer.prev->next = timer.next;
+  timer.next->prev = timer.prev;
+  timer.prev = nullptr;
+  timer.next = nullptr;
+
+  const auto level = timer.position_ / kSlotsCount;
+  const auto slot = timer.position_ % kSlotsCount;
+  --level_counts_[level];
+  --scheduled_count_;
+  if (level == 0 && levels_[0][slot].IsEmpty()) {
+    first_level_bitmap_[slot / kBitsInWord] &=
+        ~(std::uint64_t{1} << (slot % kBitsInWord));
+  }
+}
+
+void TimerWheel::Cascade(std::size_t level) noexcept {
+  auto& slot = levels_[level][(current_tick_ >> (kSlotBits * level)) &
+                              kSlotMask];
+  while (!slot.IsEmpty()) {
+    auto& timer = static_cast<Timer&>(*slot.head.next);
+    Remove(timer);
+    Place(timer);
+  }
+}
+
+void TimerWheel::ProcessTick() noexcept {
+  // Higher levels go first, their timers may land into the current slot
+  for (std::size_t level = kLevelsCount - 1; level > 0; --level) {
+    if ((current_tick_ & ((std::uint64_t{1} << (kSlotBits * level)) - 1)) ==
+        0) {
+      Cascade(level);
+    }
+  }
+
+  auto& slot = levels_[0][current_tick_ & kSlotMask];
+  while (!slot.IsEmpty()) {
+    auto& timer = static_cast<Timer&>(*slot.head.next);
+    UASSERT(timer.expiry_tick_ == current_tick_);
+    Remove(timer);
+    // The callback may destroy the timer
+    timer.callback_(timer.data_);
+  }
+}
+
+std::uint64_t TimerWheel::FindNextCascadeTick() const noexcept {
+  std::size_t level = 1;
+  while (level + 1 < kLevelsCount && level_counts_[level] == 0) ++level;
+
+  const auto level_mask = (std::uint64_t{1} << (kSlotBits * level)) - 1;
+  return (current_tick_ | level_mask) + 1;
+}
+
+std::uint64_t TimerWheel::FindNextFirstLevelTick() const noexcept {
+  constexpr std::size_t kWordsCount = kSlotsCount / kBitsInWord;
+
+  // The current slot is always empty, search the others in the circular order
+  const auto start = (current_tick_ + 1) & kSlotMask;
+  auto word = start / kBitsInWord;
+  auto bits = first_level_bitmap_[word] & (~std::uint64_t{0}
+                                           << (start % kBitsInWord));
+  for (std::size_t i = 0; i <= kWordsCount; ++i) {
+    if (bits != 0) {
+      const auto slot = word * kBitsInWord + __builtin_ctzll(bits);
+      return current_tick_ + 1 + ((slot - start) & kSlotMask);
+    }
+    word = (word + 1) % kWordsCount;
+    bits = first_level_bitmap_[word];
+  }
+
+  UASSERT_MSG(false, "First level is not empty, but no slots are found");
+  return current_tick_ + 1;
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
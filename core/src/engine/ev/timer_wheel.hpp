@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// Hierarchical timer wheel with a coarse granularity for the task deadlines.
+//
+// Each started or stopped ev_timer costs O(log N) of the libev heap
+// maintenance, which dominates the ev threads with ~100k of the in-flight
+// deadlines. The wheel inserts and cancels the timers in O(1) and needs a
+// single ev_timer to wake up the loop, see Thread.
+//
+// The timers never fire earlier than their expiry and usually fire within
+// kTick after it.
+//
+// Not thread-safe, all the methods must be called from the same thread.
+class TimerWheel final {
+  struct ListNode {
+    ListNode* prev{nullptr};
+    ListNode* next{nullptr};
+  };
+
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::chrono::milliseconds kTick{1};
+
+  class Timer final : private ListNode {
+   public:
+    using Callback = void (*)(void* data) noexcept;
+
+    Timer(Callback callback, void* data) noexcept;
+
+    Timer(const Timer&) = delete;
+    Timer(Timer&&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    Timer& operator=(Timer&&) = delete;
+    ~Timer();
+
+    bool IsScheduled() const noexcept { return prev != nullptr; }
+
+   private:
+    friend class TimerWheel;
+
+    std::uint64_t expiry_tick_{0};
+    // level * kSlotsCount + slot, valid only while the timer is scheduled
+    std::size_t position_{0};
+    Callback callback_;
+    void* data_;
+  };
+
+  explicit TimerWheel(Clock::time_point now = Clock::now()) noexcept;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel(TimerWheel&&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  TimerWheel& operator=(TimerWheel&&) = delete;
+  ~TimerWheel();
+
+  // Reschedules the timer if it is already scheduled
+  void Schedule(Timer& timer, Clock::time_point expiry) noexcept;
+
+  // Does nothing for a timer that is not scheduled
+  void Cancel(Timer& timer) noexcept;
+
+  // Fires the timers that have expired by `now`. The callbacks may schedule
+  // and cancel the timers.
+  void Advance(Clock::time_point now) noexcept;
+
+  // Returns when Advance() should be called next, std::nullopt if there are no
+  // scheduled timers
+  std::optional<Clock::time_point> GetNextWakeup() const noexcept;
+
+  std::size_t GetScheduledCount() const noexcept { return scheduled_count_; }
+
+ private:
+  static constexpr std::size_t kSlotBits = 8;
+  static constexpr std::size_t kSlotsCount = 1 << kSlotBits;
+  static constexpr std::size_t kLevelsCount = 4;
+  static constexpr std::uint64_t kSlotMask = kSlotsCount - 1;
+  static constexpr std::uint64_t kMaxDelayTicks =
+      (std::uint64_t{1} << (kSlotBits * kLevelsCount)) - 1;
+
+  // Circular doubly linked list with a sentinel
+  struct Slot final {
+    Slot() noexcept;
+    ~Slot();
+
+    bool IsEmpty() const noexcept { return head.next == &head; }
+
+    ListNode head;
+  };
+
+  using Level = std::array<Slot, kSlotsCount>;
+
+  std::uint64_t ToTick(Clock::time_point time_point) const noexcept;
+  void Place(Timer& timer) noexcept;
+  void Remove(Timer& timer) noexcept;
+  void Cascade(std::size_t level) noexcept;
+  void ProcessTick() noexcept;
+  std::uint64_t FindNextCascadeTick() const noexcept;
+  std::uint64_t FindNextFirstLevelTick() const noexcept;
+
+  const Clock::time_point start_;
+  std::uint64_t current_tick_{0};
+  std::size_t scheduled_count_{0};
+  std::array<std::size_t, kLevelsCount> level_counts_{};
+  // Non-empty slots of the first level, to find the next expiry quickly
+  std::array<std::uint64_t, kSlotsCount / 64> first_level_bitmap_{};
+  std::array<Level, kLevelsCount> levels_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
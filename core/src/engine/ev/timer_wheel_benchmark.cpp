@@ -0,0 +1,63 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using namespace std::chrono_literals;
+
+void Noop(void*) noexcept {}
+
+}  // namespace
+
+// Deadline that is set up and then cancelled, with `range(0)` other timers
+// in flight
+void timer_wheel_schedule_cancel(benchmark::State& state) {
+  const auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  std::vector<std::unique_ptr<TimerWheel::Timer>> in_flight;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    in_flight.push_back(std::make_unique<TimerWheel::Timer>(&Noop, nullptr));
+    wheel.Schedule(*in_flight.back(), now + 1s + 1ms * i);
+  }
+
+  TimerWheel::Timer timer{&Noop, nullptr};
+  std::int64_t i = 0;
+  for (auto _ : state) {
+    wheel.Schedule(timer, now + 10s + 1ms * (++i % 1000));
+    wheel.Cancel(timer);
+  }
+
+  for (auto& other : in_flight) wheel.Cancel(*other);
+}
+BENCHMARK(timer_wheel_schedule_cancel)->Range(1, 1'000'000);
+
+// Tick of an ev thread with `range(0)` distant timers in flight
+void timer_wheel_advance(benchmark::State& state) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  std::vector<std::unique_ptr<TimerWheel::Timer>> in_flight;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    in_flight.push_back(std::make_unique<TimerWheel::Timer>(&Noop, nullptr));
+    wheel.Schedule(*in_flight.back(), now + 24h * 30 + 1ms * i);
+  }
+
+  for (auto _ : state) {
+    now += TimerWheel::kTick;
+    wheel.Advance(now);
+  }
+
+  for (auto& other : in_flight) wheel.Cancel(*other);
+}
+BENCHMARK(timer_wheel_advance)->Range(1, 1'000'000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,229 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using namespace std::chrono_literals;
+
+const auto kStart = TimerWheel::Clock::time_point{} + 100h;
+
+struct TestTimer final {
+  TestTimer() : timer(&OnTimer, this) {}
+
+  static void OnTimer(void* data) noexcept {
+    auto& self = *static_cast<TestTimer*>(data);
+    ++self.fired_count;
+    self.fired_at = *self.now;
+  }
+
+  const TimerWheel::Clock::time_point* now{nullptr};
+  std::size_t fired_count{0};
+  TimerWheel::Clock::time_point fired_at{};
+  TimerWheel::Timer timer;
+};
+
+struct Wheel final {
+  void Schedule(TestTimer& timer, TimerWheel::Clock::duration delay) {
+    timer.now = &now;
+    wheel.Schedule(timer.timer, now + delay);
+  }
+
+  void AdvanceBy(TimerWheel::Clock::duration duration) {
+    now += duration;
+    wheel.Advance(now);
+  }
+
+  TimerWheel::Clock::time_point now{kStart};
+  TimerWheel wheel{kStart};
+};
+
+}  // namespace
+
+TEST(TimerWheel, Basic) {
+  Wheel wheel;
+  TestTimer timer;
+  wheel.Schedule(timer, 10ms);
+  EXPECT_TRUE(timer.timer.IsScheduled());
+  EXPECT_EQ(wheel.wheel.GetScheduledCount(), 1);
+  EXPECT_EQ(wheel.wheel.GetNextWakeup(), kStart + 10ms);
+
+  wheel.AdvanceBy(9ms);
+  EXPECT_EQ(timer.fired_count, 0);
+
+  wheel.AdvanceBy(1ms);
+  EXPECT_EQ(timer.fired_count, 1);
+  EXPECT_FALSE(timer.timer.IsScheduled());
+  EXPECT_EQ(wheel.wheel.GetScheduledCount(), 0);
+  EXPECT_EQ(wheel.wheel.GetNextWakeup(), std::nullopt);
+}
+
+TEST(TimerWheel, NeverFiresEarly) {
+  Wheel wheel;
+  TestTimer timer;
+  wheel.Schedule(timer, 1500us);
+
+  wheel.AdvanceBy(1ms);
+  EXPECT_EQ(timer.fired_count, 0);
+  wheel.AdvanceBy(999us);
+  EXPECT_EQ(timer.fired_count, 0);
+  wheel.AdvanceBy(1us);
+  EXPECT_EQ(timer.fired_count, 1);
+
+  TestTimer expired;
+  wheel.Schedule(expired, -1s);
+  wheel.wheel.Advance(wheel.now);
+  EXPECT_EQ(expired.fired_count, 0);
+  wheel.AdvanceBy(1ms);
+  EXPECT_EQ(expired.fired_count, 1);
+}
+
+TEST(TimerWheel, CancelAndReschedule) {
+  Wheel wheel;
+  TestTimer first;
+  TestTimer second;
+  wheel.Schedule(first, 5ms);
+  wheel.Schedule(second, 5ms);
+
+  wheel.wheel.Cancel(first.timer);
+  wheel.wheel.Cancel(first.timer);
+  EXPECT_FALSE(first.timer.IsScheduled());
+  EXPECT_EQ(wheel.wheel.GetScheduledCount(), 1);
+
+  wheel.Schedule(second, 2s);
+  EXPECT_EQ(wheel.wheel.GetScheduledCount(), 1);
+
+  wheel.AdvanceBy(1s);
+  EXPECT_EQ(first.fired_count, 0);
+  EXPECT_EQ(second.fired_count, 0);
+  wheel.AdvanceBy(1s);
+  EXPECT_EQ(second.fired_count, 1);
+  EXPECT_EQ(second.fired_at, kStart + 2s);
+}
+
+TEST(TimerWheel, RescheduleFromCallback) {
+  struct PeriodicTimer final {
+    static void OnTimer(void* data) noexcept {
+      auto& self = *static_cast<PeriodicTimer*>(data);
+      ++self.fired_count;
+      self.wheel->wheel.Schedule(self.timer, self.wheel->now + 300ms);
+    }
+
+    Wheel* wheel;
+    std::size_t fired_count{0};
+    TimerWheel::Timer timer{&OnTimer, this};
+  };
+
+  Wheel wheel;
+  PeriodicTimer periodic{&wheel};
+  wheel.wheel.Schedule(periodic.timer, wheel.now + 300ms);
+
+  for (int i = 0; i < 10; ++i) wheel.AdvanceBy(300ms);
+  EXPECT_EQ(periodic.fired_count, 10);
+  wheel.wheel.Cancel(periodic.timer);
+}
+
+TEST(TimerWheel, DistantTimers) {
+  Wheel wheel;
+  TestTimer minute;
+  TestTimer day;
+  TestTimer year;
+  wheel.Schedule(minute, 1min);
+  wheel.Schedule(day, 24h);
+  wheel.Schedule(year, 24h * 365);
+
+  EXPECT_EQ(wheel.wheel.GetNextWakeup(), kStart + 256ms);
+
+  wheel.AdvanceBy(1min);
+  EXPECT_EQ(minute.fired_count, 1);
+  wheel.AdvanceBy(24h - 1min - 1ms);
+  EXPECT_EQ(day.fired_count, 0);
+  wheel.AdvanceBy(1ms);
+  EXPECT_EQ(day.fired_count, 1);
+
+  wheel.AdvanceBy(24h * 364 - 1ms);
+  EXPECT_EQ(year.fired_count, 0);
+  wheel.AdvanceBy(1ms);
+  EXPECT_EQ(year.fired_count, 1);
+}
+
+TEST(TimerWheel, Destruction) {
+  TestTimer timer;
+  {
+    Wheel wheel;
+    wheel.Schedule(timer, 1s);
+  }
+  EXPECT_FALSE(timer.timer.IsScheduled());
+  EXPECT_EQ(timer.fired_count, 0);
+}
+
+TEST(TimerWheel, Random) {
+  constexpr std::size_t kTimersCount = 2000;
+
+  std::minstd_rand rng{42};
+  std::uniform_int_distribution<std::int64_t> delay_ms{0, 300'000};
+  std::uniform_int_distribution<std::int64_t> step_ms{0, 700};
+
+  Wheel wheel;
+  std::vector<std::unique_ptr<TestTimer>> timers;
+  std::vector<TimerWheel::Clock::time_point> expiries;
+  for (std::size_t i = 0; i < kTimersCount; ++i) {
+    timers.push_back(std::make_unique<TestTimer>());
+    const auto delay = std::chrono::milliseconds{delay_ms(rng)};
+    wheel.Schedule(*timers.back(), delay);
+    expiries.push_back(wheel.now + delay);
+  }
+  for (std::size_t i = 0; i < kTimersCount; i += 7) {
+    wheel.wheel.Cancel(timers[i]->timer);
+  }
+
+  while (wheel.wheel.GetScheduledCount() != 0) {
+    const auto next_wakeup = wheel.wheel.GetNextWakeup();
+    ASSERT_TRUE(next_wakeup);
+    ASSERT_GT(*next_wakeup, wheel.now);
+    wheel.AdvanceBy(std::chrono::milliseconds{step_ms(rng)});
+  }
+
+  for (std::size_t i = 0; i < kTimersCount; ++i) {
+    const auto& timer = *timers[i];
+    if (i % 7 == 0) {
+      EXPECT_EQ(timer.fired_count, 0);
+    } else {
+      ASSERT_EQ(timer.fired_count, 1);
+      EXPECT_GE(timer.fired_at, expiries[i]);
+      EXPECT_LT(timer.fired_at, expiries[i] + 701ms);
+    }
+  }
+}
+
+TEST(TimerWheel, NextWakeupIsPrecise) {
+  std::minstd_rand rng{7};
+  std::uniform_int_distribution<std::int64_t> delay_ms{1, 100'000};
+
+  Wheel wheel;
+  for (int i = 0; i < 500; ++i) {
+    TestTimer timer;
+    const auto delay = std::chrono::milliseconds{delay_ms(rng)};
+    const auto expiry = wheel.now + delay;
+    wheel.Schedule(timer, delay);
+
+    // Wake up as requested until the timer fires
+    while (timer.fired_count == 0) {
+      const auto next_wakeup = wheel.wheel.GetNextWakeup();
+      ASSERT_TRUE(next_wakeup);
+      ASSERT_LE(*next_wakeup, expiry);
+      wheel.AdvanceBy(*next_wakeup - wheel.now);
+    }
+    ASSERT_EQ(timer.fired_at, expiry);
+  }
+}
+
+USERVER_NAMESPACE_END
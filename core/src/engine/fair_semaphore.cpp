@@ -0,0 +1,185 @@
+#include <userver/engine/fair_semaphore.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+struct FairSemaphore::Waiter final {
+  explicit Waiter(Counter count) : count(count) {}
+
+  const Counter count;
+  bool granted{false};
+  SingleConsumerEvent event;
+};
+
+FairSemaphore::FairSemaphore(Counter capacity, Counter quantum)
+    : capacity_(capacity), quantum_(quantum) {
+  UASSERT(quantum_ > 0);
+}
+
+FairSemaphore::~FairSemaphore() {
+  UASSERT_MSG(acquired_.load() == 0, "FairSemaphore is destroyed while in use");
+  UASSERT_MSG(queues_.empty(), "Someone is waiting on the FairSemaphore");
+}
+
+void FairSemaphore::SetWeight(std::string_view key, std::size_t weight) {
+  UASSERT(weight > 0);
+  std::lock_guard lock{mutex_};
+
+  std::string key_str{key};
+  const auto it = queues_.find(key_str);
+  if (it != queues_.end()) it->second.weight = weight;
+  weights_[std::move(key_str)] = weight;
+}
+
+std::size_t FairSemaphore::RemainingApprox() const {
+  const auto acquired = acquired_.load(std::memory_order_relaxed);
+  return capacity_ >= acquired ? capacity_ - acquired : 0;
+}
+
+std::size_t FairSemaphore::UsedApprox() const {
+  return acquired_.load(std::memory_order_relaxed);
+}
+
+bool FairSemaphore::TryLockUntil(std::string_view key, Counter count,
+                                 Deadline deadline) {
+  UASSERT(count > 0);
+  if (count > capacity_) return false;
+
+  std::unique_lock lock{mutex_};
+  // the queued waiters go first
+  if (queues_.empty() && acquired_.load() + count <= capacity_) {
+    acquired_ += count;
+    return true;
+  }
+  if (deadline.IsReached()) return false;
+
+  Waiter waiter{count};
+  auto& queue = GetQueue(key);
+  queue.waiters.push_back(&waiter);
+  Dispatch();
+  if (waiter.granted) return true;
+
+  lock.unlock();
+  // the event is sent with the mutex held, so the waiter is destroyed only
+  // after the Send() completes
+  [[maybe_unused]] const bool is_signaled =
+      waiter.event.WaitForEventUntil(deadline);
+  lock.lock();
+
+  if (waiter.granted) return true;
+
+  RemoveWaiter(queue, waiter);
+  // the waiter may have held up the ones behind it
+  Dispatch();
+  return false;
+}
+
+void FairSemaphore::Unlock(Counter count) {
+  UASSERT(count > 0);
+  std::lock_guard lock{mutex_};
+
+  UASSERT_MSG(acquired_.load() >= count,
+              "Trying to release more locks than have been acquired");
+  acquired_ -= count;
+  Dispatch();
+}
+
+FairSemaphore::KeyQueue& FairSemaphore::GetQueue(std::string_view key) {
+  std::string key_str{key};
+  auto [it, inserted] = queues_.try_emplace(key_str);
+  auto& queue = it->second;
+  if (inserted) {
+    const auto weight_it = weights_.find(key_str);
+    if (weight_it != weights_.end()) queue.weight = weight_it->second;
+    queue.key = std::move(key_str);
+    active_.push_back(&queue);
+  }
+  return queue;
+}
+
+void FairSemaphore::RemoveWaiter(KeyQueue& queue, Waiter& waiter) noexcept {
+  auto& waiters = queue.waiters;
+  const auto it = std::find(waiters.begin(), waiters.end(), &waiter);
+  UASSERT(it != waiters.end());
+  waiters.erase(it);
+  if (!waiters.empty()) return;
+
+  const auto active_it = std::find(active_.begin(), active_.end(), &queue);
+  UASSERT(active_it != active_.end());
+  if (active_it == active_.begin()) turn_started_ = false;
+  active_.erase(active_it);
+  queues_.erase(queue.key);
+}
+
+void FairSemaphore::Dispatch() {
+  while (!active_.empty()) {
+    auto& queue = *active_.front();
+    if (!turn_started_) {
+      queue.deficit += quantum_ * queue.weight;
+      turn_started_ = true;
+    }
+
+    while (!queue.waiters.empty()) {
+      auto& waiter = *queue.waiters.front();
+      if (waiter.count > queue.deficit) break;
+      // the turn goes on after the next release
+      if (acquired_.load() + waiter.count > capacity_) return;
+
+      acquired_ += waiter.count;
+      queue.deficit -= waiter.count;
+      queue.waiters.pop_front();
+      waiter.granted = true;
+      waiter.event.Send();
+    }
+
+    active_.pop_front();
+    turn_started_ = false;
+    if (queue.waiters.empty()) {
+      queues_.erase(queue.key);
+    } else {
+      active_.push_back(&queue);
+    }
+  }
+}
+
+FairSemaphoreLock::FairSemaphoreLock(FairSemaphore& sem, std::string_view key,
+                                     FairSemaphore::Counter count,
+                                     Deadline deadline) {
+  if (sem.TryLockUntil(key, count, deadline)) {
+    sem_ = &sem;
+    count_ = count;
+  }
+}
+
+FairSemaphoreLock::~FairSemaphoreLock() {
+  if (OwnsLock()) Unlock();
+}
+
+FairSemaphoreLock::FairSemaphoreLock(FairSemaphoreLock&& other) noexcept
+    : sem_(std::exchange(other.sem_, nullptr)),
+      count_(std::exchange(other.count_, 0)) {}
+
+FairSemaphoreLock& FairSemaphoreLock::operator=(
+    FairSemaphoreLock&& other) noexcept {
+  if (OwnsLock()) Unlock();
+  sem_ = std::exchange(other.sem_, nullptr);
+  count_ = std::exchange(other.count_, 0);
+  return *this;
+}
+
+void FairSemaphoreLock::Unlock() {
+  UASSERT(OwnsLock());
+  std::exchange(sem_, nullptr)->Unlock(count_);
+  count_ = 0;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,170 @@
+#include <userver/engine/fair_semaphore.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Queues a waiter for each of the keys, then releases the only lock and
+// returns the keys in the order the locks have been granted
+std::vector<std::string> GetGrantOrder(engine::FairSemaphore& sem,
+                                       const std::vector<std::string>& keys) {
+  engine::FairSemaphoreLock holder{sem, "holder", 1, {}};
+  EXPECT_TRUE(holder);
+
+  std::vector<std::string> order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (const auto& key : keys) {
+    tasks.push_back(engine::AsyncNoSpan([&sem, &order, key] {
+      const engine::FairSemaphoreLock lock{sem, key, 1, {}};
+      EXPECT_TRUE(lock);
+      order.push_back(key);
+    }));
+  }
+  // let all the tasks queue on the semaphore
+  engine::Yield();
+
+  holder.Unlock();
+  engine::GetAll(tasks);
+  return order;
+}
+
+}  // namespace
+
+UTEST(FairSemaphore, LockUnlock) {
+  /// [Sample engine::FairSemaphore usage]
+  constexpr std::size_t kMaxHeavyQueries = 10;
+  engine::FairSemaphore sem{kMaxHeavyQueries};
+
+  {
+    const engine::FairSemaphoreLock lock{
+        sem, "tenant", 2, engine::Deadline::FromDuration(100ms)};
+    if (!lock) {
+      // timed out waiting for the other tenants
+      FAIL();
+    }
+
+    // at most 10 units of the heavy queries run at once
+    EXPECT_EQ(sem.UsedApprox(), 2);
+  }
+  /// [Sample engine::FairSemaphore usage]
+
+  EXPECT_EQ(sem.RemainingApprox(), kMaxHeavyQueries);
+}
+
+UTEST(FairSemaphore, Deadline) {
+  engine::FairSemaphore sem{1};
+  engine::FairSemaphoreLock holder{sem, "a", 1, {}};
+  ASSERT_TRUE(holder);
+
+  const engine::FairSemaphoreLock lock{sem, "b", 1,
+                                       engine::Deadline::FromDuration(10ms)};
+  EXPECT_FALSE(lock);
+
+  holder.Unlock();
+  const engine::FairSemaphoreLock next_lock{sem, "b", 1, {}};
+  EXPECT_TRUE(next_lock);
+}
+
+UTEST(FairSemaphore, UnreachableCount) {
+  engine::FairSemaphore sem{2};
+  EXPECT_FALSE(sem.TryLockUntil("a", 3, {}));
+  EXPECT_EQ(sem.UsedApprox(), 0);
+}
+
+UTEST(FairSemaphore, Cancel) {
+  engine::FairSemaphore sem{1};
+  engine::FairSemaphoreLock holder{sem, "a", 1, {}};
+
+  auto task = engine::AsyncNoSpan([&sem] {
+    const engine::FairSemaphoreLock lock{sem, "b", 1, {}};
+    return lock.OwnsLock();
+  });
+  engine::Yield();
+  task.SyncCancel();
+  EXPECT_FALSE(task.Get());
+
+  holder.Unlock();
+  EXPECT_EQ(sem.UsedApprox(), 0);
+}
+
+UTEST(FairSemaphore, NoisyKeyDoesNotHoldUpOthers) {
+  engine::FairSemaphore sem{1};
+
+  std::vector<std::string> keys(10, "noisy");
+  keys.push_back("quiet");
+  const auto order = GetGrantOrder(sem, keys);
+
+  ASSERT_EQ(order.size(), keys.size());
+  EXPECT_EQ(order[0], "noisy");
+  EXPECT_EQ(order[1], "quiet");
+}
+
+UTEST(FairSemaphore, Weights) {
+  engine::FairSemaphore sem{1};
+  sem.SetWeight("heavy", 2);
+
+  std::vector<std::string> keys(4, "heavy");
+  keys.insert(keys.end(), 4, "light");
+  const auto order = GetGrantOrder(sem, keys);
+
+  const std::vector<std::string> expected{"heavy", "heavy", "light", "heavy",
+                                          "heavy", "light", "light", "light"};
+  EXPECT_EQ(order, expected);
+}
+
+UTEST(FairSemaphore, ReleaseWakesSeveral) {
+  engine::FairSemaphore sem{3};
+  engine::FairSemaphoreLock holder{sem, "a", 3, {}};
+
+  std::vector<engine::TaskWithResult<bool>> tasks;
+  for (const auto* key : {"a", "b", "c"}) {
+    tasks.push_back(engine::AsyncNoSpan([&sem, key] {
+      return sem.TryLockUntil(key, 1, {});
+    }));
+  }
+  engine::Yield();
+  EXPECT_EQ(sem.UsedApprox(), 3);
+
+  holder.Unlock();
+  for (auto& task : tasks) EXPECT_TRUE(task.Get());
+  EXPECT_EQ(sem.UsedApprox(), 3);
+  sem.Unlock(3);
+}
+
+UTEST(FairSemaphore, BigRequestIsNotStarved) {
+  engine::FairSemaphore sem{2};
+  engine::FairSemaphoreLock holder{sem, "small", 1, {}};
+
+  auto big = engine::AsyncNoSpan(
+      [&sem] { return engine::FairSemaphoreLock{sem, "big", 2, {}}; });
+  engine::Yield();
+
+  // the small requests queue behind the big one instead of taking the
+  // released lock
+  auto small = engine::AsyncNoSpan(
+      [&sem] { return engine::FairSemaphoreLock{sem, "small", 1, {}}; });
+  engine::Yield();
+  EXPECT_FALSE(big.IsFinished());
+  EXPECT_FALSE(small.IsFinished());
+
+  holder.Unlock();
+  auto big_lock = big.Get();
+  EXPECT_TRUE(big_lock);
+  EXPECT_FALSE(small.IsFinished());
+
+  big_lock.Unlock();
+  EXPECT_TRUE(small.Get());
+}
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #include <userver/engine/future.hpp>
 
 #include <condition_variable>
+#include <cstdint>
 #include <future>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -126,6 +129,49 @@ void future_coro_single_threaded(benchmark::State& state) {
 }
 BENCHMARK(future_coro_single_threaded);
 
+// Many states are alive at once, like the ones of the requests in flight
+void future_coro_many_states(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    std::vector<engine::Future<int>> futures;
+    futures.reserve(state.range(0));
+    for (auto _ : state) {
+      for (std::int64_t i = 0; i < state.range(0); ++i) {
+        engine::Promise<int> promise;
+        futures.push_back(promise.get_future());
+        promise.set_value(42);
+      }
+      for (auto& future : futures) {
+        benchmark::DoNotOptimize(future.get());
+      }
+      futures.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(future_coro_many_states)->RangeMultiplier(8)->Range(1, 512);
+
+// The same with the states allocated from the heap, for comparison
+void future_coro_many_states_make_shared(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    std::vector<std::shared_ptr<engine::impl::FutureState<int>>> states;
+    states.reserve(state.range(0));
+    for (auto _ : state) {
+      for (std::int64_t i = 0; i < state.range(0); ++i) {
+        states.push_back(std::make_shared<engine::impl::FutureState<int>>());
+        states.back()->SetValue(42);
+      }
+      for (auto& future_state : states) {
+        benchmark::DoNotOptimize(future_state->Get());
+      }
+      states.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(future_coro_many_states_make_shared)
+    ->RangeMultiplier(8)
+    ->Range(1, 512);
+
 void future_std_set_and_get(benchmark::State& state) {
   engine::RunStandalone(2, [&] { RunPrepared<FutureStdSetGet>(state); });
 }
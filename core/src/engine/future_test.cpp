@@ -1,5 +1,6 @@
 #include <userver/utest/utest.hpp>
 
+#include <array>
 #include <chrono>
 #include <exception>
 #include <future>
@@ -393,4 +394,43 @@ UTEST(Future, WaitAnyPromiseKilledInOtherThread) {
   UEXPECT_THROW(future.get(), std::future_error);
 }
 
+UTEST(Future, LargeValue) {
+  // Too big for the shared state pools
+  using LargeValue = std::array<char, 4096>;
+  engine::Promise<LargeValue> promise;
+  auto future = promise.get_future();
+
+  LargeValue value{};
+  value.back() = 'a';
+  promise.set_value(value);
+  EXPECT_EQ(future.get().back(), 'a');
+}
+
+UTEST_MT(Future, StatesFreedInOtherThreads, 2) {
+  constexpr std::size_t kStates = 1000;
+  std::vector<engine::Future<std::string>> futures;
+  futures.reserve(kStates);
+  for (std::size_t i = 0; i < kStates; ++i) {
+    engine::Promise<std::string> promise;
+    futures.push_back(promise.get_future());
+    promise.set_value(std::to_string(i));
+  }
+
+  // The freed states are cached by that thread and released on its exit
+  std::thread th([futures = std::move(futures)]() mutable {
+    for (std::size_t i = 0; i < kStates; ++i) {
+      EXPECT_EQ(futures[i].get(), std::to_string(i));
+    }
+    futures.clear();
+  });
+  th.join();
+
+  for (std::size_t i = 0; i < kStates; ++i) {
+    engine::Promise<std::string> promise;
+    auto future = promise.get_future();
+    promise.set_value(std::to_string(i));
+    EXPECT_EQ(future.get(), std::to_string(i));
+  }
+}
+
 USERVER_NAMESPACE_END
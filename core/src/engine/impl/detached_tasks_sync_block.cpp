@@ -1,10 +1,14 @@
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <optional>
 
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 
 #include <concurrent/intrusive_walkable_pool.hpp>
 #include <engine/task/task_context.hpp>
@@ -13,10 +17,24 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// The tasks are registered in the shard of the current thread, so that the
+// threads of a TaskProcessor do not contend on a single free list
+constexpr std::size_t kTokenShardsCount = 8;
+
+std::size_t GetTokenShardIndex() noexcept {
+  return utils::statistics::impl::GetThreadShardIndex() % kTokenShardsCount;
+}
+
+}  // namespace
+
 struct DetachedTasksSyncBlock::Token final {
-  explicit Token(DetachedTasksSyncBlock& owner) : owner(owner) {}
+  Token(DetachedTasksSyncBlock& owner, std::size_t shard_index)
+      : owner(owner), shard_index(shard_index) {}
 
   DetachedTasksSyncBlock& owner;
+  const std::size_t shard_index;
 
   concurrent::impl::IntrusiveWalkablePoolHook<Token> pool_hook{};
 
@@ -28,10 +46,19 @@ struct DetachedTasksSyncBlock::Token final {
 };
 
 struct DetachedTasksSyncBlock::Impl final {
+  using TokenPool = concurrent::impl::IntrusiveWalkablePool<
+      Token, concurrent::impl::MemberHook<&Token::pool_hook>>;
+  using TokenShards =
+      std::array<concurrent::impl::InterferenceShield<TokenPool>,
+                 kTokenShardsCount>;
+
+  template <typename Func>
+  void WalkTokens(const Func& func) {
+    for (auto& shard : *cancel_tokens) shard->Walk(func);
+  }
+
   std::optional<utils::impl::WaitTokenStorage> wait_tokens{};
-  concurrent::impl::IntrusiveWalkablePool<
-      Token, concurrent::impl::MemberHook<&Token::pool_hook>>
-      cancel_tokens{};
+  std::unique_ptr<TokenShards> cancel_tokens{std::make_unique<TokenShards>()};
   std::atomic<TaskCancellationReason> cancel_new_tasks{
       TaskCancellationReason::kNone};
 };
@@ -45,7 +72,9 @@ DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
 DetachedTasksSyncBlock::~DetachedTasksSyncBlock() = default;
 
 void DetachedTasksSyncBlock::Add(TaskContext& context) {
-  auto& token = impl_->cancel_tokens.Acquire([this] { return Token(*this); });
+  const auto shard_index = GetTokenShardIndex();
+  auto& token = (*impl_->cancel_tokens)[shard_index]->Acquire(
+      [this, shard_index] { return Token(*this, shard_index); });
   UASSERT(token.task == nullptr);
 
   boost::intrusive_ptr<TaskContext> context_copy(&context);
@@ -75,14 +104,14 @@ void DetachedTasksSyncBlock::Dispose(Token& token) noexcept {
                                                     /*add_ref=*/false);
   }
   [[maybe_unused]] const auto wait_token = std::move(token.wait_token);
-  token.owner.impl_->cancel_tokens.Release(token);
+  (*token.owner.impl_->cancel_tokens)[token.shard_index]->Release(token);
 }
 
 void DetachedTasksSyncBlock::RequestCancellation(
     TaskCancellationReason reason) noexcept {
   impl_->cancel_new_tasks.store(reason);
 
-  impl_->cancel_tokens.Walk([&](Token& token) {
+  impl_->WalkTokens([&](Token& token) {
     auto* const context_ptr = token.task.exchange(nullptr);
 
     if (context_ptr != nullptr) {
@@ -1,9 +1,14 @@
 #include <userver/engine/impl/future_state.hpp>
 
+#include <array>
 #include <future>
+#include <new>
+#include <utility>
 
+#include <compiler/tls.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
 #include <userver/engine/exception.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
@@ -27,13 +32,122 @@ FutureStatus ToFutureStatus(TaskContext::WakeupSource wakeup_source) {
   }
 }
 
+// Sanitizers should see each state as a separate heap allocation
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+constexpr bool kIsPoolingEnabled = false;
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+constexpr bool kIsPoolingEnabled = false;
+#else
+constexpr bool kIsPoolingEnabled = true;
+#endif
+#else
+constexpr bool kIsPoolingEnabled = true;
+#endif
+
+constexpr std::size_t kSizeClassStep = 64;
+constexpr std::size_t kSizeClassesCount =
+    kMaxPooledFutureStateSize / kSizeClassStep;
+static_assert(kMaxPooledFutureStateSize % kSizeClassStep == 0);
+
+// Bounds the memory kept by a thread that frees more states than it allocates,
+// e.g. the thread of the consumers of the futures
+constexpr std::size_t kMaxCachedBlocksPerClass = 512;
+
+struct FreeBlock final {
+  FreeBlock* next;
+};
+
+struct FreeList final {
+  FreeBlock* head{nullptr};
+  std::size_t size{0};
+};
+
+// Trivially destructible, so that the states freed by the destructors of the
+// other thread_local variables still find it alive
+struct LocalPools final {
+  std::array<FreeList, kSizeClassesCount> lists{};
+  bool is_drainer_registered{false};
+  bool is_drained{false};
+};
+
+thread_local USERVER_IMPL_CONSTINIT LocalPools local_pools;
+
+USERVER_PREVENT_TLS_CACHING LocalPools& GetLocalPools() noexcept {
+  return local_pools;
+}
+
+constexpr std::size_t GetSizeClass(std::size_t size) noexcept {
+  return (size + kSizeClassStep - 1) / kSizeClassStep - 1;
+}
+
+constexpr std::size_t GetBlockSize(std::size_t size_class) noexcept {
+  return (size_class + 1) * kSizeClassStep;
+}
+
+// Returns the cached blocks to the heap at thread exit
+class LocalPoolsDrainer final {
+ public:
+  ~LocalPoolsDrainer() {
+    auto& pools = GetLocalPools();
+    for (auto& list : pools.lists) {
+      while (list.head) {
+        ::operator delete(std::exchange(list.head, list.head->next));
+      }
+      list.size = 0;
+    }
+    pools.is_drained = true;
+  }
+};
+
+USERVER_PREVENT_TLS_CACHING void RegisterLocalPoolsDrainer(
+    LocalPools& pools) noexcept {
+  thread_local LocalPoolsDrainer drainer;
+  pools.is_drainer_registered = true;
+}
+
 }  // namespace
 
+void* AllocateFutureState(std::size_t size) {
+  if (!kIsPoolingEnabled || size > kMaxPooledFutureStateSize) {
+    return ::operator new(size);
+  }
+
+  const auto size_class = GetSizeClass(size);
+  auto& list = GetLocalPools().lists[size_class];
+  if (!list.head) return ::operator new(GetBlockSize(size_class));
+
+  --list.size;
+  return std::exchange(list.head, list.head->next);
+}
+
+void DeallocateFutureState(void* ptr, std::size_t size) noexcept {
+  if (!kIsPoolingEnabled || size > kMaxPooledFutureStateSize) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  // The last owner of a state may run on any thread, the block then moves to
+  // the pool of that thread
+  auto& pools = GetLocalPools();
+  auto& list = pools.lists[GetSizeClass(size)];
+  if (pools.is_drained || list.size >= kMaxCachedBlocksPerClass) {
+    ::operator delete(ptr);
+    return;
+  }
+  if (!pools.is_drainer_registered) RegisterLocalPoolsDrainer(pools);
+
+  list.head = ::new (ptr) FreeBlock{list.head};
+  ++list.size;
+}
+
 class FutureStateBase::WaitStrategy final : public impl::WaitStrategy {
  public:
   WaitStrategy(FutureStateBase& state, impl::TaskContext& context,
                Deadline deadline)
-      : impl::WaitStrategy(deadline), state_(state), context_(context) {}
+      : impl::WaitStrategy(deadline, impl::WaitKind::kFuture),
+        state_(state),
+        context_(context) {}
 
   void SetupWakeups() override {
     state_.finish_waiters_->Append(&context_);
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 
 #include <userver/engine/deadline.hpp>
 
 #include <userver/utils/assert.hpp>
 
+#include <compiler/relax_cpu.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
@@ -14,6 +17,11 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+// Spinning is cheaper than going to sleep and waking up for the short
+// critical sections. Same bounds as in the glibc adaptive mutex.
+inline constexpr std::int32_t kMutexMinSpins = 10;
+inline constexpr std::int32_t kMutexMaxSpins = 100;
+
 template <class Waiters>
 class MutexImpl {
  public:
@@ -37,9 +45,13 @@ class MutexImpl {
   class MutexWaitStrategy;
 
   bool LockFastPath(TaskContext&);
+  bool LockSpinPath(TaskContext&);
   bool LockSlowPath(TaskContext&, Deadline);
 
   std::atomic<TaskContext*> owner_;
+  // Moving average of the spins it took to acquire the mutex, estimates the
+  // length of the critical sections
+  std::atomic<std::int32_t> spins_estimate_{0};
   Waiters lock_waiters_;
 };
 
@@ -48,7 +60,7 @@ class MutexImpl<WaitList>::MutexWaitStrategy final : public WaitStrategy {
  public:
   MutexWaitStrategy(MutexImpl<WaitList>& mutex, TaskContext& current,
                     Deadline deadline)
-      : WaitStrategy(deadline),
+      : WaitStrategy(deadline, WaitKind::kMutex),
         mutex_(mutex),
         current_(current),
         waiter_token_(mutex_.lock_waiters_),
@@ -76,7 +88,9 @@ class MutexImpl<WaitListLight>::MutexWaitStrategy final : public WaitStrategy {
  public:
   MutexWaitStrategy(MutexImpl<WaitListLight>& mutex, TaskContext& current,
                     Deadline deadline)
-      : WaitStrategy(deadline), mutex_(mutex), current_(current) {}
+      : WaitStrategy(deadline, WaitKind::kMutex),
+        mutex_(mutex),
+        current_(current) {}
 
   void SetupWakeups() override {
     mutex_.lock_waiters_.Append(&current_);
@@ -105,6 +119,29 @@ bool MutexImpl<Waiters>::LockFastPath(TaskContext& current) {
                                         std::memory_order_acquire);
 }
 
+template <class Waiters>
+bool MutexImpl<Waiters>::LockSpinPath(TaskContext& current) {
+  const auto estimate = spins_estimate_.load(std::memory_order_relaxed);
+  const auto max_spins =
+      std::min(kMutexMaxSpins, estimate * 2 + kMutexMinSpins);
+
+  compiler::RelaxCpu relax;
+  for (std::int32_t spins = 1; spins <= max_spins; ++spins) {
+    relax();
+    // Checking first, not to bounce the cache line with the owner
+    if (owner_.load(std::memory_order_relaxed) == nullptr &&
+        LockFastPath(current)) {
+      spins_estimate_.store(estimate + (spins - estimate) / 8,
+                            std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  // The critical sections are too long, spin less next time
+  spins_estimate_.store(estimate - estimate / 8, std::memory_order_relaxed);
+  return false;
+}
+
 template <class Waiters>
 bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
   TaskContext* expected = nullptr;
@@ -156,7 +193,8 @@ bool MutexImpl<Waiters>::try_lock() {
 template <class Waiters>
 bool MutexImpl<Waiters>::try_lock_until(Deadline deadline) {
   auto& current = current_task::GetCurrentTaskContext();
-  return LockFastPath(current) || LockSlowPath(current, deadline);
+  return LockFastPath(current) || LockSpinPath(current) ||
+         LockSlowPath(current, deadline);
 }
 
 }  // namespace engine::impl
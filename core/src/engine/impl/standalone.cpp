@@ -19,12 +19,17 @@ std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(
   coro_config.initial_size = pools_config.initial_coro_pool_size;
   coro_config.max_size = pools_config.max_coro_pool_size;
   coro_config.stack_size = pools_config.coro_stack_size;
+  coro_config.small_stack_size = pools_config.small_coro_stack_size;
+  coro_config.large_stack_size = pools_config.large_coro_stack_size;
 
   ev::ThreadPoolConfig ev_config;
   ev_config.threads = pools_config.ev_threads_num;
   ev_config.thread_name = pools_config.ev_thread_name;
   ev_config.ev_default_loop_disabled = pools_config.ev_default_loop_disabled;
   ev_config.defer_events = pools_config.defer_events;
+  if (pools_config.ev_io_uring) {
+    ev_config.io_backend = ev::IoBackend::kIoUring;
+  }
 
   return std::make_shared<TaskProcessorPools>(std::move(coro_config),
                                               std::move(ev_config));
@@ -1,10 +1,12 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 
+#include <atomic>
+#include <memory>
+
 #include <fmt/format.h>
-#include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/slist.hpp>
-#include <boost/range/adaptor/reversed.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -47,10 +49,46 @@ using NormalDataList = boost::intrusive::slist<
     boost::intrusive::constant_time_size<false>, boost::intrusive::linear<true>,
     boost::intrusive::cache_last<false>>;
 
-using InheritedDataList = boost::intrusive::list<
-    DataPtr,
-    boost::intrusive::member_hook<DataPtr, ListHook, &DataPtr::list_hook>,
-    boost::intrusive::constant_time_size<false>>;
+// The inherited variables of a task, shared with its child tasks until
+// either of them modifies any of the variables
+struct InheritedSet final {
+  InheritedSet() = default;
+
+  InheritedSet(const InheritedSet& other) {
+    for (Key key = 0; key < variable_count; ++key) {
+      auto* const node = other.data[key];
+      if (node) node->AddRef();
+      data[key] = node;
+    }
+  }
+
+  ~InheritedSet() {
+    for (Key key = 0; key < variable_count; ++key) {
+      if (data[key]) data[key]->DeleteSelf();
+    }
+  }
+
+  bool IsShared() const noexcept {
+    // Only the owning task adds references, the others may only drop theirs
+    return ref_counter.load(std::memory_order_acquire) != 1;
+  }
+
+  std::atomic<std::size_t> ref_counter{1};
+  const std::unique_ptr<InheritedDataBase*[]> data{
+      std::make_unique<InheritedDataBase*[]>(variable_count)};
+};
+
+void intrusive_ptr_add_ref(InheritedSet* set) noexcept {
+  set->ref_counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+void intrusive_ptr_release(InheritedSet* set) noexcept {
+  if (set->ref_counter.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete set;
+  }
+}
+
+constexpr bool kAdopt = false;
 
 }  // namespace
 
@@ -71,11 +109,22 @@ void ReportVariableNotSet(const std::type_info& type) {
 struct Storage::Impl final {
   std::unique_ptr<DataPtr[]> data;
   NormalDataList normal_data_storage;
-  InheritedDataList inherited_data_storage;
+  boost::intrusive_ptr<InheritedSet> inherited_data;
 
-  void DoSetGeneric(Key key, DataBase& node);
+  // Makes the inherited variables owned by this storage only
+  InheritedSet& GetUniqueInherited();
 };
 
+InheritedSet& Storage::Impl::GetUniqueInherited() {
+  if (!inherited_data) {
+    inherited_data = boost::intrusive_ptr{new InheritedSet(), kAdopt};
+  } else if (inherited_data->IsShared()) {
+    inherited_data =
+        boost::intrusive_ptr{new InheritedSet(*inherited_data), kAdopt};
+  }
+  return *inherited_data;
+}
+
 Storage::Storage() { utils::impl::AssertStaticRegistrationFinished(); }
 
 Storage::~Storage() {
@@ -91,79 +140,59 @@ Storage::~Storage() {
     impl_->normal_data_storage.pop_front_and_dispose(disposer);
   }
 
-  while (!impl_->inherited_data_storage.empty()) {
-    impl_->inherited_data_storage.pop_front_and_dispose(disposer);
-  }
+  impl_->inherited_data.reset();
 }
 
 void Storage::InheritFrom(Storage& other) {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
-
-  if (!other.impl_->inherited_data_storage.empty() && !impl_->data) {
-    impl_->data = std::make_unique<DataPtr[]>(variable_count);
-  }
+  UASSERT(!impl_->inherited_data);
 
-  for (DataPtr& their_ptr :
-       other.impl_->inherited_data_storage | boost::adaptors::reversed) {
-    UASSERT(their_ptr.ptr);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-    UASSERT(node.GetKey() < variable_count);
-
-    auto& our_ptr = impl_->data[node.GetKey()];
-    UASSERT(!our_ptr.ptr);
-    our_ptr.ptr = &node;
-    impl_->inherited_data_storage.push_front(our_ptr);
-    node.AddRef();
-  }
+  impl_->inherited_data = other.impl_->inherited_data;
 }
 
 void Storage::InitializeFrom(Storage&& other) noexcept {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
+  UASSERT(!impl_->inherited_data);
   impl_ = std::move(other.impl_);
 }
 
-DataBase* Storage::GetGeneric(Key key) noexcept {
+NormalDataBase* Storage::GetNormal(Key key) noexcept {
   UASSERT(key < variable_count);
   if (!impl_->data) return nullptr;
-  return impl_->data[key].ptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  return static_cast<NormalDataBase*>(impl_->data[key].ptr);
 }
 
-void Storage::Impl::DoSetGeneric(Key key, DataBase& node) {
+InheritedDataBase* Storage::GetInherited(Key key) noexcept {
   UASSERT(key < variable_count);
-  if (!data) data = std::make_unique<DataPtr[]>(variable_count);
-  data[key].ptr = &node;
+  if (!impl_->inherited_data) return nullptr;
+  return impl_->inherited_data->data[key];
 }
 
 void Storage::SetGeneric(Key key, NormalDataBase& node,
                          bool has_existing_variable) {
-  impl_->DoSetGeneric(key, node);
+  UASSERT(key < variable_count);
+  if (!impl_->data) impl_->data = std::make_unique<DataPtr[]>(variable_count);
+  impl_->data[key].ptr = &node;
   if (!has_existing_variable) {
     impl_->normal_data_storage.push_front(impl_->data[key]);
   }
 }
 
 void Storage::SetGeneric(Key key, InheritedDataBase& node,
-                         bool has_existing_variable) {
-  impl_->DoSetGeneric(key, node);
-  if (!has_existing_variable) {
-    impl_->inherited_data_storage.push_front(impl_->data[key]);
-  }
+                         bool /*has_existing_variable*/) {
+  UASSERT(key < variable_count);
+  impl_->GetUniqueInherited().data[key] = &node;
 }
 
 void Storage::EraseInherited(Key key) noexcept {
   UASSERT(key < variable_count);
-  if (!impl_->data) return;
-
-  auto& data_ptr = impl_->data[key];
-  auto* const data = data_ptr.ptr;
-  if (!data) return;
+  if (!GetInherited(key)) return;
 
-  data_ptr.ptr = nullptr;
-  impl_->inherited_data_storage.erase(
-      InheritedDataList::s_iterator_to(data_ptr));
+  // NOLINTNEXTLINE(bugprone-exception-escape)
+  auto& data_ptr = impl_->GetUniqueInherited().data[key];
+  auto* const data = data_ptr;
+  data_ptr = nullptr;
   data->DeleteSelf();
 }
 
@@ -2,6 +2,7 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <compiler/relax_cpu.hpp>
 #include <engine/task/task_context.hpp>
 
 #include <userver/utils/assert.hpp>
@@ -14,6 +15,12 @@ namespace {
 
 constexpr bool kAdopt = false;
 
+// The critical sections of a WaitList are a few pointer updates long, so its
+// owner usually leaves it sooner than a thread would fall asleep on the
+// futex and wake up again. Sleeping in the kernel right away makes the
+// threads of a hot primitive line up in a lock convoy.
+constexpr int kLockSpinsCount = 128;
+
 template <class Container, class Value>
 bool IsInIntrusiveContainer(const Container& container, const Value& val) {
   const auto val_it = Container::s_iterator_to(val);
@@ -33,6 +40,15 @@ using MemberHookConfig =
 
 }  // namespace
 
+void WaitList::Lock::LockSlowPath(std::mutex& mutex) {
+  compiler::RelaxCpu relax;
+  for (int i = 0; i < kLockSpinsCount; ++i) {
+    relax();
+    if (mutex.try_lock()) return;
+  }
+  mutex.lock();
+}
+
 struct WaitList::List
     : public boost::intrusive::make_list<
           impl::TaskContext, boost::intrusive::constant_time_size<false>,
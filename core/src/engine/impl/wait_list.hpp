@@ -5,6 +5,7 @@
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <userver/utils/assert.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,15 +19,34 @@ class WaitList final {
  public:
   class Lock final {
    public:
-    explicit Lock(WaitList& list) noexcept : impl_(list.mutex_) {}
+    explicit Lock(WaitList& list) noexcept : mutex_(list.mutex_) { lock(); }
+    ~Lock() {
+      if (owns_) mutex_.unlock();
+    }
+
+    Lock(const Lock&) = delete;
+    Lock& operator=(const Lock&) = delete;
+
+    explicit operator bool() noexcept { return owns_; }
 
-    explicit operator bool() noexcept { return !!impl_; }
+    void lock() {
+      UASSERT(!owns_);
+      if (!mutex_.try_lock()) LockSlowPath(mutex_);
+      owns_ = true;
+    }
 
-    void lock() { impl_.lock(); }
-    void unlock() { impl_.unlock(); }
+    void unlock() {
+      UASSERT(owns_);
+      owns_ = false;
+      mutex_.unlock();
+    }
 
    private:
-    std::unique_lock<std::mutex> impl_;
+    // Spins for a while before going to sleep in the kernel
+    static void LockSlowPath(std::mutex& mutex);
+
+    std::mutex& mutex_;
+    bool owns_{false};
   };
 
   // This guard is used to optimize the hot path of unlocking:
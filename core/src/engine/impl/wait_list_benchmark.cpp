@@ -139,7 +139,7 @@ void wait_list_add_remove_contention(benchmark::State& state) {
 }
 BENCHMARK(wait_list_add_remove_contention)
     ->RangeMultiplier(2)
-    ->Range(1, 2)
+    ->Range(1, 8)
     ->UseRealTime();
 
 void wait_list_add_remove_contention_unbalanced(benchmark::State& state) {
@@ -9,6 +9,17 @@ ReadableBase::~ReadableBase() = default;
 WritableBase::~WritableBase() = default;
 RwBase::~RwBase() = default;
 
+size_t WritableBase::WriteAll(const IoData* list, std::size_t list_size,
+                              Deadline deadline) {
+  size_t sent_bytes = 0;
+  for (std::size_t i = 0; i < list_size; ++i) {
+    const auto chunk_size = WriteAll(list[i].data, list[i].len, deadline);
+    sent_bytes += chunk_size;
+    if (chunk_size != list[i].len) break;
+  }
+  return sent_bytes;
+}
+
 }  // namespace engine::io
 
 USERVER_NAMESPACE_END
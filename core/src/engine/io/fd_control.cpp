@@ -11,6 +11,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/ev/thread_control.hpp>
 #include <engine/task/task_context.hpp>
 #include <utils/check_syscall.hpp>
 
@@ -73,7 +74,14 @@ bool Direction::Wait(Deadline deadline) {
   return poller_.Wait(deadline).has_value();
 }
 
-void Direction::Reset(int fd) { poller_.Reset(fd, kind_); }
+void Direction::Reset(int fd) {
+  poller_.Reset(fd, kind_);
+  io_uring_ = current_task::GetEventThread().GetIoUring();
+}
+
+void Direction::CancelIoUring() noexcept {
+  if (io_uring_) io_uring_->Cancel(io_uring_operation_);
+}
 
 void Direction::Invalidate() { poller_.Invalidate(); }
 
@@ -102,6 +110,10 @@ FdControlHolder FdControl::Adopt(int fd) {
 void FdControl::Close() {
   if (!IsValid()) return;
   Invalidate();
+  // Requests in flight hold a reference to the file and would not notice
+  // the close otherwise
+  read_.CancelIoUring();
+  write_.CancelIoUring();
 
   const auto fd = Fd();
   if (::close(fd) == -1) {
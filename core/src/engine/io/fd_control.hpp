@@ -1,5 +1,6 @@
 #pragma once
 
+#include <sys/socket.h>
 #include <sys/uio.h>
 #include <atomic>
 #include <cerrno>
@@ -12,6 +13,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/ev/io_uring.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
@@ -86,12 +88,37 @@ class Direction final {
                     TransferMode mode, Deadline deadline,
                     const Context&... context);
 
+  // Whether the operations may be performed via the io_uring of the ev thread
+  bool IsIoUringEnabled() const noexcept { return io_uring_ != nullptr; }
+
+  // Same as PerformIo, but the operation is performed by the kernel via
+  // io_uring instead of a readiness wait and a syscall
+  template <typename... Context>
+  size_t PerformIoUring(SingleUserGuard& guard, ev::IoUringOpcode opcode,
+                        void* buf, size_t len, int flags, TransferMode mode,
+                        Deadline deadline, const Context&... context);
+
+  // Same as PerformIoV, via io_uring sendmsg
+  template <typename... Context>
+  size_t PerformIoUringV(SingleUserGuard& guard, struct iovec* list,
+                         std::size_t list_size, int flags, TransferMode mode,
+                         Deadline deadline, const Context&... context);
+
+  // Performs a single io_uring request and returns its result, which is
+  // a negated errno on failure. Throws on timeout and cancellation.
+  template <typename... Context>
+  int PerformIoUringRequest(SingleUserGuard& guard,
+                            const ev::IoUringRequest& request,
+                            size_t processed_bytes, Deadline deadline,
+                            const Context&... context);
+
  private:
   friend class FdControl;
   explicit Direction(Kind kind);
 
   void Reset(int fd);
   void WakeupWaiters() { poller_.WakeupWaiters(); }
+  void CancelIoUring() noexcept;
 
   // does not notify
   void Invalidate();
@@ -103,6 +130,8 @@ class Direction final {
 
   FdPoller poller_;
   Kind kind_;
+  ev::IoUring* io_uring_{nullptr};
+  ev::IoUringOperation io_uring_operation_;
 };
 
 class FdControl final {
@@ -249,6 +278,115 @@ size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
   return pos - begin;
 }
 
+template <typename... Context>
+int Direction::PerformIoUringRequest(SingleUserGuard&,
+                                     const ev::IoUringRequest& request,
+                                     size_t processed_bytes, Deadline deadline,
+                                     const Context&... context) {
+  UASSERT(io_uring_);
+  const auto result =
+      io_uring_->Perform(io_uring_operation_, request, deadline);
+  if (!result) {
+    if (current_task::ShouldCancel()) {
+      throw(IoCancelled(/*bytes_transferred =*/processed_bytes)
+            << ... << context);
+    } else {
+      throw(IoTimeout(/*bytes_transferred =*/processed_bytes)
+            << ... << context);
+    }
+  }
+  if (*result < 0 && !IsValid()) {
+    throw((IoException() << "Fd closed during ") << ... << context);
+  }
+  return *result;
+}
+
+template <typename... Context>
+size_t Direction::PerformIoUringV(SingleUserGuard& guard, struct iovec* list,
+                                  std::size_t list_size, int flags,
+                                  TransferMode mode, Deadline deadline,
+                                  const Context&... context) {
+  UASSERT(list_size > 0);
+  UASSERT(list_size <= IOV_MAX);
+  std::size_t processed_bytes = 0;
+  do {
+    struct msghdr message {};
+    message.msg_iov = list;
+    message.msg_iovlen = list_size;
+
+    ev::IoUringRequest request;
+    request.opcode = ev::IoUringOpcode::kSendMsg;
+    request.fd = Fd();
+    request.addr = &message;
+    request.flags = flags;
+    const auto chunk_size = PerformIoUringRequest(
+        guard, request, processed_bytes, deadline, context...);
+
+    if (chunk_size > 0) {
+      processed_bytes += chunk_size;
+      if (mode != TransferMode::kWhole) {
+        break;
+      }
+      std::size_t offset = chunk_size;
+      while (list_size > 0) {
+        const std::size_t len = list->iov_len;
+        if (offset >= len) {
+          ++list;
+          offset -= len;
+          --list_size;
+          UASSERT(list_size != 0 || offset == 0);
+        } else {
+          list->iov_len -= offset;
+          list->iov_base = static_cast<char*>(list->iov_base) + offset;
+          break;
+        }
+      }
+    } else if (!chunk_size ||
+               TryHandleError(-chunk_size, processed_bytes, mode, deadline,
+                              context...) == ErrorMode::kFatal) {
+      break;
+    }
+  } while (list_size != 0);
+  return processed_bytes;
+}
+
+template <typename... Context>
+size_t Direction::PerformIoUring(SingleUserGuard& guard,
+                                 ev::IoUringOpcode opcode, void* buf,
+                                 size_t len, int flags, TransferMode mode,
+                                 Deadline deadline,
+                                 const Context&... context) {
+  char* const begin = static_cast<char*>(buf);
+  char* const end = begin + len;
+
+  char* pos = begin;
+
+  while (pos < end) {
+    ev::IoUringRequest request;
+    request.opcode = opcode;
+    request.fd = Fd();
+    request.addr = pos;
+    request.len = end - pos;
+    request.flags = flags;
+    const auto chunk_size = PerformIoUringRequest(guard, request, pos - begin,
+                                                  deadline, context...);
+
+    if (chunk_size > 0) {
+      pos += chunk_size;
+      // Unlike a nonblocking syscall the request waits for the data, so the
+      // partial mode may not spin until EAGAIN
+      if (mode != TransferMode::kWhole) {
+        break;
+      }
+    } else if (!chunk_size ||
+               TryHandleError(-chunk_size, pos - begin, mode, deadline,
+                              context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return pos - begin;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
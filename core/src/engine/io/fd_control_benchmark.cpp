@@ -2,6 +2,8 @@
 
 #include <unistd.h>
 
+#include <array>
+
 #include <userver/engine/run_standalone.hpp>
 #include <utils/check_syscall.hpp>
 
@@ -30,6 +32,14 @@ namespace io = engine::io;
 using Deadline = engine::Deadline;
 using FdControl = io::impl::FdControl;
 
+constexpr std::size_t kPipeMessageSize = 16;
+
+engine::TaskProcessorPoolsConfig MakeConfig(const benchmark::State& state) {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_io_uring = state.range(0) != 0;
+  return config;
+}
+
 }  // namespace
 
 void fd_control_destroy(benchmark::State& state) {
@@ -47,8 +57,9 @@ void fd_control_destroy(benchmark::State& state) {
 }
 BENCHMARK(fd_control_destroy);
 
+// Arg is 1 for the io_uring backend, whose requests are cancelled on close
 void fd_control_close_destroy(benchmark::State& state) {
-  engine::RunStandalone([&] {
+  engine::RunStandalone(1, MakeConfig(state), [&] {
     for (auto _ : state) {
       state.PauseTiming();
       Pipe pipe;
@@ -61,7 +72,7 @@ void fd_control_close_destroy(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(fd_control_close_destroy);
+BENCHMARK(fd_control_close_destroy)->Arg(0)->Arg(1);
 
 void fd_control_wait_destroy(benchmark::State& state) {
   engine::RunStandalone([&] {
@@ -94,4 +105,51 @@ void fd_control_construct_wait_destroy(benchmark::State& state) {
 }
 BENCHMARK(fd_control_construct_wait_destroy);
 
+// Arg is 1 for the io_uring backend, 0 for libev
+void fd_control_pipe_write_read(benchmark::State& state) {
+  engine::RunStandalone(1, MakeConfig(state), [&] {
+    Pipe pipe;
+    auto read_control = FdControl::Adopt(pipe.ExtractIn());
+    auto write_control = FdControl::Adopt(pipe.ExtractOut());
+    auto& read_dir = read_control->Read();
+    auto& write_dir = write_control->Write();
+    const bool use_io_uring = state.range(0) != 0;
+    if (use_io_uring && !write_dir.IsIoUringEnabled()) {
+      state.SkipWithError("io_uring is not supported by the kernel");
+      return;
+    }
+
+    std::array<char, kPipeMessageSize> buf{};
+    const auto write_func = [](int fd, void* data, std::size_t size) {
+      return ::write(fd, data, size);
+    };
+    // The pipe never blocks, a message fits into its buffer
+    const Deadline deadline{};
+    for (auto _ : state) {
+      io::impl::Direction::SingleUserGuard write_guard(write_dir);
+      io::impl::Direction::SingleUserGuard read_guard(read_dir);
+      std::size_t transferred = 0;
+      if (use_io_uring) {
+        transferred = write_dir.PerformIoUring(
+            write_guard, engine::ev::IoUringOpcode::kWrite, buf.data(),
+            buf.size(), 0, io::impl::TransferMode::kWhole, deadline, "write");
+        transferred += read_dir.PerformIoUring(
+            read_guard, engine::ev::IoUringOpcode::kRead, buf.data(),
+            buf.size(), 0, io::impl::TransferMode::kWhole, deadline, "read");
+      } else {
+        transferred = write_dir.PerformIo(write_guard, write_func, buf.data(),
+                                          buf.size(),
+                                          io::impl::TransferMode::kWhole,
+                                          deadline, "write");
+        transferred += read_dir.PerformIo(read_guard, &::read, buf.data(),
+                                          buf.size(),
+                                          io::impl::TransferMode::kWhole,
+                                          deadline, "read");
+      }
+      benchmark::DoNotOptimize(transferred);
+    }
+  });
+}
+BENCHMARK(fd_control_pipe_write_read)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
@@ -73,7 +73,7 @@ class DirectionWaitStrategy final : public engine::impl::WaitStrategy {
   DirectionWaitStrategy(Deadline deadline, engine::impl::WaitListLight& waiters,
                         ev::Watcher<ev_io>& watcher,
                         engine::impl::TaskContext& current)
-      : WaitStrategy(deadline),
+      : WaitStrategy(deadline, engine::impl::WaitKind::kIo),
         waiters_(waiters),
         watcher_(watcher),
         current_(current) {}
@@ -106,6 +106,13 @@ class SendToWrapper {
   const Sockaddr& dest_addr_;
 };
 
+constexpr int kSendFlags =
+// MAC_COMPAT: does not support MSG_NOSIGNAL
+#ifdef MSG_NOSIGNAL
+    MSG_NOSIGNAL |
+#endif
+    0;
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
   UASSERT(data);
   UASSERT(count > 0);
@@ -220,16 +227,41 @@ size_t Socket::RecvSome(void* buf, size_t len, Deadline deadline) {
   }
   auto& dir = fd_control_->Read();
   impl::Direction::SingleUserGuard guard(dir);
+  if (dir.IsIoUringEnabled()) {
+    return dir.PerformIoUring(guard, ev::IoUringOpcode::kRecv, buf, len, 0,
+                              impl::TransferMode::kOnce, deadline,
+                              "RecvSome from ", peername_);
+  }
   return dir.PerformIo(guard, &RecvWrapper, buf, len, impl::TransferMode::kOnce,
                        deadline, "RecvSome from ", peername_);
 }
 
+size_t Socket::RecvSome(struct iovec* list, std::size_t list_size,
+                        Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to RecvSome from closed socket");
+  }
+  UASSERT(list);
+  UASSERT(list_size > 0);
+  UINVARIANT(list_size <= IOV_MAX, "To big array of iovec for RecvSome");
+  auto& dir = fd_control_->Read();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformIoV(guard, &readv, list, list_size,
+                        impl::TransferMode::kOnce, deadline, "RecvSome from ",
+                        peername_);
+}
+
 size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
   if (!IsValid()) {
     throw IoException("Attempt to RecvAll from closed socket");
   }
   auto& dir = fd_control_->Read();
   impl::Direction::SingleUserGuard guard(dir);
+  if (dir.IsIoUringEnabled()) {
+    return dir.PerformIoUring(guard, ev::IoUringOpcode::kRecv, buf, len, 0,
+                              impl::TransferMode::kWhole, deadline,
+                              "RecvAll from ", peername_);
+  }
   return dir.PerformIo(guard, &RecvWrapper, buf, len,
                        impl::TransferMode::kWhole, deadline, "RecvAll from ",
                        peername_);
@@ -264,6 +296,13 @@ size_t Socket::SendAll(const struct iovec* list, std::size_t list_size,
   UINVARIANT(list_size <= IOV_MAX, "To big array of IoData for SendAll");
   auto& dir = fd_control_->Write();
   impl::Direction::SingleUserGuard guard(dir);
+  if (dir.IsIoUringEnabled()) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return dir.PerformIoUringV(guard, const_cast<struct iovec*>(list),
+                               list_size, kSendFlags,
+                               impl::TransferMode::kWhole, deadline,
+                               "SendAll to ", peername_);
+  }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
   return dir.PerformIoV(guard, &writev, const_cast<struct iovec*>(list),
                         list_size, impl::TransferMode::kWhole, deadline,
@@ -276,6 +315,13 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
   }
   auto& dir = fd_control_->Write();
   impl::Direction::SingleUserGuard guard(dir);
+  if (dir.IsIoUringEnabled()) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return dir.PerformIoUring(guard, ev::IoUringOpcode::kSend,
+                              const_cast<void*>(buf), len, kSendFlags,
+                              impl::TransferMode::kWhole, deadline,
+                              "SendAll to ", peername_);
+  }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
   return dir.PerformIo(guard, &SendWrapper, const_cast<void*>(buf), len,
                        impl::TransferMode::kWhole, deadline, "SendAll to ",
@@ -329,13 +375,27 @@ Socket Socket::Accept(Deadline deadline) {
     Sockaddr buf;
     auto len = buf.Capacity();
 
+    int fd = -1;
+    if (dir.IsIoUringEnabled()) {
+      ev::IoUringRequest request;
+      request.opcode = ev::IoUringOpcode::kAccept;
+      request.fd = dir.Fd();
+      request.addr = buf.Data();
+      request.addr2 = &len;
+      request.flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+      fd = dir.PerformIoUringRequest(guard, request, 0, deadline, "Accept");
+      if (fd < 0) {
+        errno = -fd;
+        fd = -1;
+      }
+    } else {
 // MAC_COMPAT: no accept4
 #ifdef HAVE_ACCEPT4
-    int fd =
-        ::accept4(dir.Fd(), buf.Data(), &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      fd = ::accept4(dir.Fd(), buf.Data(), &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
 #else
-    int fd = ::accept(dir.Fd(), buf.Data(), &len);
+      fd = ::accept(dir.Fd(), buf.Data(), &len);
 #endif
+    }
 
     UASSERT(len <= buf.Capacity());
     if (fd != -1) {
@@ -138,4 +138,35 @@ BENCHMARK(socket_send_all_v);
 // TODO(TAXICOMMON-5510) flaky, sometimes throws engine::io::IoTimeout
 // BENCHMARK(socket_send_all_range)->RangeMultiplier(10)->Range(10, 10000);
 
+// Arg is 1 for the io_uring backend, 0 for libev
+void socket_ping_pong(benchmark::State& state) {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_io_uring = state.range(0) != 0;
+  engine::RunStandalone(2, config, [&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(test_deadline);
+    auto task_echo = engine::AsyncNoSpan(
+        [test_deadline](auto&& server) {
+          std::array<char, 16> buf = {};
+          while (true) {
+            const auto recv_bytes =
+                server.RecvSome(buf.data(), buf.size(), test_deadline);
+            if (recv_bytes == 0) break;
+            server.SendAll(buf.data(), recv_bytes, test_deadline);
+          }
+        },
+        std::move(server));
+    std::array<char, 16> buf = {};
+    for (auto _ : state) {
+      client.SendAll("qwerty", 6, test_deadline);
+      const auto recv_bytes = client.RecvAll(buf.data(), 6, test_deadline);
+      benchmark::DoNotOptimize(recv_bytes);
+    }
+    client.Close();
+    task_echo.Get();
+  });
+}
+BENCHMARK(socket_ping_pong)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
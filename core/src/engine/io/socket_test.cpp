@@ -3,6 +3,7 @@
 #include <arpa/inet.h>
 #include <gtest/gtest.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <array>
@@ -15,6 +16,7 @@
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/internal/net/net_listener.hpp>
@@ -176,6 +178,28 @@ UTEST(Socket, SendAllVector) {
   EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+UTEST(Socket, RecvSomeVector) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  TcpListener listener;
+  auto sockets = listener.MakeSocketPair(deadline);
+  EXPECT_EQ(sockets.second.SendAll("headerbody", 10, deadline), 10);
+
+  std::array<char, 6> header{};
+  std::array<char, 16> body{};
+  std::array<struct ::iovec, 2> list{{{header.data(), header.size()},
+                                      {body.data(), body.size()}}};
+  EXPECT_EQ(sockets.first.RecvSome(list.data(), list.size(), deadline), 10);
+  EXPECT_EQ(std::string(header.data(), header.size()), "header");
+  EXPECT_EQ(std::string(body.data(), 4), "body");
+
+  // the interface overload sends the buffers in one go as well
+  io::WritableBase& writable = sockets.second;
+  EXPECT_EQ(writable.WriteAll({{"ab", 2}, {"cd", 2}}, deadline), 4);
+  EXPECT_EQ(sockets.first.RecvAll(body.data(), 4, deadline), 4);
+  EXPECT_EQ(std::string(body.data(), 4), "abcd");
+}
+
 UTEST(Socket, SendAllVectorHeap) {
   const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -440,4 +464,36 @@ UTEST(Socket, WriteALot) {
   }
 }
 
+TEST(Socket, IoUringBackend) {
+  // Falls back to libev if io_uring is not supported by the kernel
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_io_uring = true;
+  engine::RunStandalone(1, config, [] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener listener;
+    auto sockets = listener.MakeSocketPair(deadline);
+    auto read_task = engine::AsyncNoSpan([&sockets, &deadline] {
+      std::array<char, 18> buf = {};
+      EXPECT_EQ(sockets.first.RecvAll(buf.data(), buf.size(), deadline),
+                buf.size());
+      EXPECT_EQ(std::string(buf.data(), buf.size()), "datachunk 1chunk 2");
+    });
+
+    EXPECT_EQ(sockets.second.SendAll(
+                  {{"data", 4}, {"chunk 1", 7}, {"chunk 2", 7}}, deadline),
+              18);
+    read_task.Get();
+
+    char c = 0;
+    EXPECT_THROW(
+        sockets.first.RecvSome(&c, 1, Deadline::FromDuration(
+                                           std::chrono::milliseconds{10})),
+        io::IoTimeout);
+
+    sockets.second.Close();
+    EXPECT_EQ(sockets.first.RecvSome(&c, 1, deadline), 0);
+  });
+}
+
 USERVER_NAMESPACE_END
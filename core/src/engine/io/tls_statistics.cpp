@@ -0,0 +1,30 @@
+#include <engine/io/tls_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+void TlsHandshakeStatistics::Account(
+    bool is_resumed, std::chrono::steady_clock::duration duration) {
+  ++(is_resumed ? resumed : full);
+  timings.GetCurrentCounter().Account(
+      std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+}
+
+TlsStatistics& GetTlsStatistics() noexcept {
+  static TlsStatistics statistics;
+  return statistics;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TlsHandshakeStatistics& stats) {
+  writer["handshakes"].ValueWithLabels(stats.full, {"tls_session", "full"});
+  writer["handshakes"].ValueWithLabels(stats.resumed,
+                                       {"tls_session", "resumed"});
+  writer["handshake-failures"] = stats.failed;
+  writer["handshake-timings"] = stats.timings;
+}
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
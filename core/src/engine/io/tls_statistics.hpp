@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+// milliseconds, up to 10s
+using TlsHandshakeTimings =
+    utils::statistics::Percentile</*buckets=*/1000, std::uint32_t,
+                                  /*extra_buckets=*/90,
+                                  /*extra_bucket_size=*/100>;
+
+struct TlsHandshakeStatistics {
+  void Account(bool is_resumed, std::chrono::steady_clock::duration duration);
+  void AccountFailure() { ++failed; }
+
+  utils::statistics::RelaxedCounter<std::uint64_t> full{0};
+  utils::statistics::RelaxedCounter<std::uint64_t> resumed{0};
+  utils::statistics::RelaxedCounter<std::uint64_t> failed{0};
+  utils::statistics::RecentPeriod<TlsHandshakeTimings, TlsHandshakeTimings,
+                                  utils::datetime::SteadyClock>
+      timings;
+};
+
+struct TlsStatistics {
+  TlsHandshakeStatistics client;
+  TlsHandshakeStatistics server;
+};
+
+// Process-wide statistics of engine::io::TlsWrapper
+TlsStatistics& GetTlsStatistics() noexcept;
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TlsHandshakeStatistics& stats);
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
@@ -1,19 +1,46 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <exception>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
 
 #include <crypto/helpers.hpp>
 #include <crypto/openssl.hpp>
 #include <engine/io/fd_control.hpp>
+#include <engine/io/tls_statistics.hpp>
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+// Kernel TLS is set up by OpenSSL, which requires its own socket BIO
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L && !defined(OPENSSL_NO_KTLS)
+#define USERVER_TLS_WRAPPER_HAS_KTLS
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
@@ -194,6 +221,9 @@ int SSL_write_ex(SSL* ssl, const void* data, size_t len,
 }
 #endif
 
+// Max TLS record plaintext size
+constexpr size_t kMaxCoalescedSize = 16 * 1024;
+
 SslCtx MakeSslCtx() {
   crypto::impl::Openssl::Init();
 
@@ -225,6 +255,253 @@ SslCtx MakeSslCtx() {
   return ssl_ctx;
 }
 
+SslCtx MakeServerSslCtx(
+    const crypto::Certificate& cert, const crypto::PrivateKey& key,
+    const std::vector<crypto::Certificate>& cert_authorities) {
+  auto ssl_ctx = MakeSslCtx();
+
+  if (!cert_authorities.empty()) {
+    auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
+    for (const auto& ca : cert_authorities) {
+      if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
+        throw TlsException(crypto::FormatSslError(
+            "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
+      }
+    }
+  }
+
+  if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
+  }
+
+  if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
+  }
+  return ssl_ctx;
+}
+
+// Client sessions are shared between the SSL contexts of the connections
+constexpr std::size_t kClientSessionCacheSize = 1024;
+
+struct SslSessionDeleter {
+  void operator()(SSL_SESSION* session) const noexcept {
+    SSL_SESSION_free(session);
+  }
+};
+using SslSession = std::unique_ptr<SSL_SESSION, SslSessionDeleter>;
+
+class ClientSessionCache final {
+ public:
+  void Put(const std::string& key, SslSession&& session) {
+    std::lock_guard lock{mutex_};
+    sessions_.Put(key, std::move(session));
+  }
+
+  // Makes the connection resume the cached session, if there is one
+  void Apply(const std::string& key, SSL* ssl) {
+    std::lock_guard lock{mutex_};
+    auto* session = sessions_.Get(key);
+    if (!session) return;
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+    if (!SSL_SESSION_is_resumable(session->get())) {
+      sessions_.Erase(key);
+      return;
+    }
+#endif
+    SSL_set_session(ssl, session->get());
+  }
+
+ private:
+  std::mutex mutex_;
+  cache::LruMap<std::string, SslSession> sessions_{kClientSessionCacheSize};
+};
+
+ClientSessionCache& GetClientSessionCache() {
+  static ClientSessionCache cache;
+  return cache;
+}
+
+void FreeSessionKey(void*, void* ptr, CRYPTO_EX_DATA*, int, long,
+                    void*) noexcept {
+  delete static_cast<std::string*>(ptr);
+}
+
+// Ex data of SSL with the ClientSessionCache key of the connection
+int GetSessionKeyIndex() {
+  static const int kIndex =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, &FreeSessionKey);
+  return kIndex;
+}
+
+int OnNewClientSession(SSL* ssl, SSL_SESSION* session) noexcept {
+  const auto* key = static_cast<const std::string*>(
+      SSL_get_ex_data(ssl, GetSessionKeyIndex()));
+  if (!key) return 0;
+
+  // 1 is returned in any case as the session is owned by us from now on
+  SslSession holder{session};
+  try {
+    GetClientSessionCache().Put(*key, std::move(holder));
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_WARNING() << "Failed to cache a TLS session: " << ex;
+  }
+  return 1;
+}
+
+constexpr std::string_view kSessionIdContext = "userver";
+
+struct TicketKey {
+  std::array<unsigned char, 16> name{};
+  std::array<unsigned char, 32> aes_key{};
+  std::array<unsigned char, 32> hmac_key{};
+};
+
+TicketKey MakeTicketKey() {
+  TicketKey key;
+  if (1 != RAND_bytes(key.name.data(), key.name.size()) ||
+      1 != RAND_bytes(key.aes_key.data(), key.aes_key.size()) ||
+      1 != RAND_bytes(key.hmac_key.data(), key.hmac_key.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to generate a session ticket key: RAND_bytes"));
+  }
+  return key;
+}
+
+class TicketKeys final {
+ public:
+  explicit TicketKeys(std::chrono::seconds lifetime)
+      : lifetime_(lifetime),
+        current_(MakeTicketKey()),
+        rotated_at_(std::chrono::steady_clock::now()) {}
+
+  TicketKey GetCurrent() {
+    std::lock_guard lock{mutex_};
+    RotateIfExpired();
+    return current_;
+  }
+
+  // Returns 1 for the current key, 2 for the previous one and 0 if the key is
+  // unknown, just like the ticket key callback should
+  int Find(const unsigned char* name, TicketKey& key) {
+    std::lock_guard lock{mutex_};
+    RotateIfExpired();
+    if (IsNamed(current_, name)) {
+      key = current_;
+      return 1;
+    }
+    if (previous_ && IsNamed(*previous_, name)) {
+      key = *previous_;
+      return 2;
+    }
+    return 0;
+  }
+
+  void Rotate() {
+    std::lock_guard lock{mutex_};
+    DoRotate();
+  }
+
+ private:
+  static bool IsNamed(const TicketKey& key, const unsigned char* name) {
+    return std::memcmp(key.name.data(), name, key.name.size()) == 0;
+  }
+
+  void RotateIfExpired() {
+    const auto since_rotation =
+        std::chrono::steady_clock::now() - rotated_at_;
+    if (since_rotation < lifetime_) return;
+    DoRotate();
+    if (since_rotation >= 2 * lifetime_) previous_.reset();
+  }
+
+  void DoRotate() {
+    auto key = MakeTicketKey();
+    previous_ = std::move(current_);
+    current_ = std::move(key);
+    rotated_at_ = std::chrono::steady_clock::now();
+  }
+
+  const std::chrono::steady_clock::duration lifetime_;
+  std::mutex mutex_;
+  TicketKey current_;
+  std::optional<TicketKey> previous_;
+  std::chrono::steady_clock::time_point rotated_at_;
+};
+
+void FreeTicketKeys(void*, void* ptr, CRYPTO_EX_DATA*, int, long,
+                    void*) noexcept {
+  delete static_cast<TicketKeys*>(ptr);
+}
+
+// Ex data of SSL_CTX with the TicketKeys of a TlsServerContext
+int GetTicketKeysIndex() {
+  static const int kIndex =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, &FreeTicketKeys);
+  return kIndex;
+}
+
+TicketKeys& GetTicketKeys(SSL_CTX* ssl_ctx) {
+  auto* keys = static_cast<TicketKeys*>(
+      SSL_CTX_get_ex_data(ssl_ctx, GetTicketKeysIndex()));
+  UASSERT(keys);
+  return *keys;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+using TicketMacCtx = EVP_MAC_CTX;
+
+bool InitTicketMac(EVP_MAC_CTX* mac_ctx, const TicketKey& key) {
+  std::array<OSSL_PARAM, 2> params{
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                       const_cast<char*>("SHA256"), 0),
+      OSSL_PARAM_construct_end()};
+  return 1 == EVP_MAC_init(mac_ctx, key.hmac_key.data(), key.hmac_key.size(),
+                           params.data());
+}
+#else
+using TicketMacCtx = HMAC_CTX;
+
+bool InitTicketMac(HMAC_CTX* mac_ctx, const TicketKey& key) {
+  return 1 == HMAC_Init_ex(mac_ctx, key.hmac_key.data(), key.hmac_key.size(),
+                           EVP_sha256(), nullptr);
+}
+#endif
+
+int OnSessionTicket(SSL* ssl, unsigned char* key_name, unsigned char* iv,
+                    EVP_CIPHER_CTX* cipher_ctx, TicketMacCtx* mac_ctx,
+                    int enc) noexcept {
+  const auto* cipher = EVP_aes_256_cbc();
+  try {
+    auto& keys = GetTicketKeys(SSL_get_SSL_CTX(ssl));
+    TicketKey key;
+    int result = 1;
+    if (enc) {
+      key = keys.GetCurrent();
+      if (1 != RAND_bytes(iv, EVP_CIPHER_iv_length(cipher))) return -1;
+      std::memcpy(key_name, key.name.data(), key.name.size());
+      if (1 != EVP_EncryptInit_ex(cipher_ctx, cipher, nullptr,
+                                  key.aes_key.data(), iv)) {
+        return -1;
+      }
+    } else {
+      result = keys.Find(key_name, key);
+      if (!result) return 0;  // full handshake
+      if (1 != EVP_DecryptInit_ex(cipher_ctx, cipher, nullptr,
+                                  key.aes_key.data(), iv)) {
+        return -1;
+      }
+    }
+    if (!InitTicketMac(mac_ctx, key)) return -1;
+    return result;
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_ERROR() << "Failed to process a TLS session ticket: " << ex;
+    return -1;
+  }
+}
+
 enum InterruptAction {
   kPass,
   kFail,
@@ -232,6 +509,78 @@ enum InterruptAction {
 
 }  // namespace
 
+class TlsServerContext::Impl {
+ public:
+  SslCtx ssl_ctx;
+  engine::TaskProcessor* handshake_task_processor{nullptr};
+  bool enable_ktls{false};
+};
+
+TlsServerContext::TlsServerContext(
+    const crypto::Certificate& cert, const crypto::PrivateKey& key,
+    const std::vector<crypto::Certificate>& cert_authorities,
+    const Settings& settings)
+    : impl_(std::make_unique<Impl>()) {
+  auto ssl_ctx = MakeServerSslCtx(cert, key, cert_authorities);
+
+  SSL_CTX_set_session_cache_mode(ssl_ctx.get(), SSL_SESS_CACHE_SERVER);
+  SSL_CTX_sess_set_cache_size(ssl_ctx.get(), settings.session_cache_size);
+  // tickets must not outlive their keys
+  SSL_CTX_set_timeout(ssl_ctx.get(), settings.ticket_key_lifetime.count());
+  if (1 != SSL_CTX_set_session_id_context(
+               ssl_ctx.get(),
+               reinterpret_cast<const unsigned char*>(kSessionIdContext.data()),
+               kSessionIdContext.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up TLS server context: "
+        "SSL_CTX_set_session_id_context"));
+  }
+
+  // owned by SSL_CTX, as the connections may outlive the context
+  auto ticket_keys =
+      std::make_unique<TicketKeys>(settings.ticket_key_lifetime);
+  if (1 != SSL_CTX_set_ex_data(ssl_ctx.get(), GetTicketKeysIndex(),
+                               ticket_keys.get())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up TLS server context: SSL_CTX_set_ex_data"));
+  }
+  [[maybe_unused]] auto* disowned_keys = ticket_keys.release();
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+  const auto ticket_cb_ret =
+      SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_ctx.get(), &OnSessionTicket);
+#else
+  // cast in openssl1.x macro expansion
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  const auto ticket_cb_ret =
+      SSL_CTX_set_tlsext_ticket_key_cb(ssl_ctx.get(), &OnSessionTicket);
+#endif
+  if (1 != ticket_cb_ret) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up TLS server context: set_tlsext_ticket_key_cb"));
+  }
+
+  impl_->ssl_ctx = std::move(ssl_ctx);
+  impl_->handshake_task_processor = settings.handshake_task_processor;
+#ifdef USERVER_TLS_WRAPPER_HAS_KTLS
+  impl_->enable_ktls = settings.enable_ktls;
+#endif
+}
+
+TlsServerContext::TlsServerContext(const crypto::Certificate& cert,
+                                   const crypto::PrivateKey& key)
+    : TlsServerContext(cert, key, {}, Settings{}) {}
+
+TlsServerContext::TlsServerContext(TlsServerContext&&) noexcept = default;
+
+TlsServerContext& TlsServerContext::operator=(TlsServerContext&&) noexcept =
+    default;
+
+TlsServerContext::~TlsServerContext() = default;
+
+void TlsServerContext::RotateTicketKey() {
+  GetTicketKeys(impl_->ssl_ctx.get()).Rotate();
+}
+
 class TlsWrapper::Impl {
  public:
   explicit Impl(Socket&& socket) : bio_data(std::move(socket)) {}
@@ -239,33 +588,72 @@ class TlsWrapper::Impl {
   Impl(Impl&& other) noexcept
       : bio_data(std::move(other.bio_data)),
         ssl(std::move(other.ssl)),
-        is_in_shutdown(other.is_in_shutdown) {
+        is_in_shutdown(other.is_in_shutdown),
+        is_native_bio(other.is_native_bio) {
     UASSERT(SSL_get_rbio(ssl.get()) == SSL_get_wbio(ssl.get()));
-    SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
+    if (!is_native_bio) SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
-    Bio socket_bio{BIO_new(GetSocketBioMethod())};
+  void SetUp(SSL_CTX* ssl_ctx, bool enable_ktls = false) {
+    Bio socket_bio;
+    if (enable_ktls) {
+      // OpenSSL switches its socket BIO to kernel TLS after the handshake,
+      // waits for the nonblocking socket are done in WaitSocket()
+      socket_bio.reset(BIO_new_socket(bio_data.socket.Fd(), BIO_NOCLOSE));
+      is_native_bio = true;
+    } else {
+      socket_bio.reset(BIO_new(GetSocketBioMethod()));
+    }
     if (!socket_bio) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: BIO_new"));
     }
-    BIO_set_shutdown(socket_bio.get(), 0);
-    SyncBioData(socket_bio.get(), nullptr);
-    BIO_set_init(socket_bio.get(), 1);
+    if (!is_native_bio) {
+      BIO_set_shutdown(socket_bio.get(), 0);
+      SyncBioData(socket_bio.get(), nullptr);
+      BIO_set_init(socket_bio.get(), 1);
+    }
 
-    ssl.reset(SSL_new(ssl_ctx.get()));
+    ssl.reset(SSL_new(ssl_ctx));
     if (!ssl) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
     }
 #if OPENSSL_VERSION_NUMBER < 0x010100000L
     ssl->s3->flags |= SSL3_FLAGS_NO_RENEGOTIATE_CIPHERS;
+#endif
+#ifdef USERVER_TLS_WRAPPER_HAS_KTLS
+    if (is_native_bio) SSL_set_options(ssl.get(), SSL_OP_ENABLE_KTLS);
 #endif
     SSL_set_bio(ssl.get(), socket_bio.get(), socket_bio.get());
     [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
   }
 
+  void DoHandshake(int (*handshake_func)(SSL*),
+                   impl::TlsHandshakeStatistics& stats, Deadline deadline,
+                   std::string_view side) {
+    UASSERT(ssl);
+    PrepareIo(deadline);
+
+    const auto start = std::chrono::steady_clock::now();
+    auto ret = handshake_func(ssl.get());
+    while (1 != ret && is_native_bio && WaitSocket(ret, 0)) {
+      ret = handshake_func(ssl.get());
+    }
+    if (1 != ret) {
+      stats.AccountFailure();
+      if (bio_data.last_exception) {
+        std::rethrow_exception(bio_data.last_exception);
+      }
+
+      throw TlsException(crypto::FormatSslError(
+          fmt::format("Failed to set up {} TLS wrapper ({})", side,
+                      SSL_get_error(ssl.get(), ret))));
+    }
+    stats.Account(SSL_session_reused(ssl.get()),
+                  std::chrono::steady_clock::now() - start);
+  }
+
   template <typename SslIoFunc>
   size_t PerformSslIo(SslIoFunc&& io_func, void* buf, size_t len,
                       impl::TransferMode mode, InterruptAction interrupt_action,
@@ -273,7 +661,7 @@ class TlsWrapper::Impl {
     UASSERT(ssl);
     if (!len) return 0;
 
-    bio_data.current_deadline = deadline;
+    PrepareIo(deadline);
 
     char* const begin = static_cast<char*>(buf);
     char* const end = begin + len;
@@ -294,6 +682,8 @@ class TlsWrapper::Impl {
           // timeout, cancel, EOF, or just a spurious wakeup
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (is_native_bio) WaitSocket(io_ret, pos - begin);
+            break;
           case SSL_ERROR_ZERO_RETURN:
             break;
 
@@ -327,6 +717,80 @@ class TlsWrapper::Impl {
     return pos - begin;
   }
 
+  void PrepareIo(Deadline deadline) noexcept {
+    bio_data.current_deadline = deadline;
+    // the userver socket BIO resets it by itself
+    if (is_native_bio) bio_data.last_exception = {};
+  }
+
+  // With the native socket BIO OpenSSL does not wait for the socket, so the
+  // waits are done here. Returns false and stores the exception if the wait
+  // was interrupted, just like the userver socket BIO does.
+  bool WaitSocket(int ssl_ret, size_t bytes_transferred) {
+    UASSERT(is_native_bio);
+    const int ssl_error = SSL_get_error(ssl.get(), ssl_ret);
+    bool is_ready = false;
+    if (ssl_error == SSL_ERROR_WANT_READ) {
+      is_ready = bio_data.socket.WaitReadable(bio_data.current_deadline);
+    } else if (ssl_error == SSL_ERROR_WANT_WRITE) {
+      is_ready = bio_data.socket.WaitWriteable(bio_data.current_deadline);
+    } else {
+      return false;
+    }
+
+    if (is_ready) {
+      bio_data.last_exception = {};
+      return true;
+    }
+    try {
+      if (engine::current_task::ShouldCancel()) {
+        throw IoCancelled(bytes_transferred) << "TLS socket wait";
+      }
+      throw IoTimeout(bytes_transferred) << "TLS socket wait";
+    } catch (const IoInterrupted&) {
+      bio_data.last_exception = std::current_exception();
+    }
+    return false;
+  }
+
+  bool IsKernelTlsEnabled() const {
+#ifdef USERVER_TLS_WRAPPER_HAS_KTLS
+    return ssl && is_native_bio && BIO_get_ktls_send(SSL_get_wbio(ssl.get()));
+#else
+    return false;
+#endif
+  }
+
+#ifdef USERVER_TLS_WRAPPER_HAS_KTLS
+  size_t SendFileKtls(int file_fd, std::size_t offset, std::size_t size,
+                      Deadline deadline) {
+    UASSERT(IsKernelTlsEnabled());
+    PrepareIo(deadline);
+
+    std::size_t sent_bytes = 0;
+    while (sent_bytes < size) {
+      const auto ret = SSL_sendfile(ssl.get(), file_fd, offset + sent_bytes,
+                                    size - sent_bytes, 0);
+      if (ret > 0) {
+        sent_bytes += ret;
+        continue;
+      }
+      if (ret == 0) {
+        throw IoException("the file was truncated while sending");
+      }
+      if (!WaitSocket(ret, sent_bytes)) {
+        // the record might be partially sent, the channel is unusable
+        ssl.reset();
+        if (bio_data.last_exception) {
+          std::rethrow_exception(bio_data.last_exception);
+        }
+        throw TlsException(crypto::FormatSslError("SendFile failed"));
+      }
+    }
+    return sent_bytes;
+  }
+#endif
+
   void CheckAlive() const {
     if (!ssl) {
       throw TlsException("SSL connection is broken");
@@ -336,6 +800,8 @@ class TlsWrapper::Impl {
   SocketBioData bio_data;
   Ssl ssl;
   bool is_in_shutdown{false};
+  // whether OpenSSL socket BIO is used instead of the userver one
+  bool is_native_bio{false};
 
  private:
   void SyncBioData(BIO* bio,
@@ -351,6 +817,9 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
                                       const std::string& server_name,
                                       Deadline deadline) {
   auto ssl_ctx = MakeSslCtx();
+  SSL_CTX_set_session_cache_mode(
+      ssl_ctx.get(), SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ssl_ctx.get(), &OnNewClientSession);
 
   if (!server_name.empty()) {
     X509_VERIFY_PARAM* verify_param = SSL_CTX_get0_param(ssl_ctx.get());
@@ -367,29 +836,28 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(ssl_ctx.get());
+  auto* ssl = wrapper.impl_->ssl.get();
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-    if (1 != SSL_set_tlsext_host_name(wrapper.impl_->ssl.get(),
-                                      server_name.c_str())) {
+    if (1 != SSL_set_tlsext_host_name(ssl, server_name.c_str())) {
       throw TlsException(crypto::FormatSslError(
           "Failed to set up client TLS wrapper: SSL_set_tlsext_host_name"));
     }
   }
 
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_connect(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
-
+  auto session_key = std::make_unique<std::string>(fmt::format(
+      "{}@{}", server_name, wrapper.impl_->bio_data.socket.Getpeername()));
+  GetClientSessionCache().Apply(*session_key, ssl);
+  if (1 != SSL_set_ex_data(ssl, GetSessionKeyIndex(), session_key.get())) {
     throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up client TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
+        "Failed to set up client TLS wrapper: SSL_set_ex_data"));
   }
+  [[maybe_unused]] auto* disowned_key = session_key.release();
+
+  wrapper.impl_->DoHandshake(&SSL_connect, impl::GetTlsStatistics().client,
+                             deadline, "client");
   return wrapper;
 }
 
@@ -397,43 +865,31 @@ TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
     const std::vector<crypto::Certificate>& cert_authorities) {
-  auto ssl_ctx = MakeSslCtx();
-
-  if (!cert_authorities.empty()) {
-    auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
-    for (const auto& ca : cert_authorities) {
-      if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
-        throw TlsException(crypto::FormatSslError(
-            "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
-      }
-    }
-  }
-
-  if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
-  }
-
-  if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
-  }
+  auto ssl_ctx = MakeServerSslCtx(cert, key, cert_authorities);
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_accept(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
+  wrapper.impl_->SetUp(ssl_ctx.get());
+  wrapper.impl_->DoHandshake(&SSL_accept, impl::GetTlsStatistics().server,
+                             deadline, "server");
+  return wrapper;
+}
 
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up server TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
+TlsWrapper TlsWrapper::StartTlsServer(Socket&& socket,
+                                      const TlsServerContext& context,
+                                      Deadline deadline) {
+  TlsWrapper wrapper{std::move(socket)};
+  wrapper.impl_->SetUp(context.impl_->ssl_ctx.get(),
+                       context.impl_->enable_ktls);
+
+  const auto handshake = [&wrapper, deadline] {
+    wrapper.impl_->DoHandshake(&SSL_accept, impl::GetTlsStatistics().server,
+                               deadline, "server");
+  };
+  if (auto* task_processor = context.impl_->handshake_task_processor) {
+    engine::AsyncNoSpan(*task_processor, handshake).Get();
+  } else {
+    handshake();
   }
-
   return wrapper;
 }
 
@@ -450,6 +906,14 @@ bool TlsWrapper::IsValid() const {
   return impl_->ssl && !impl_->is_in_shutdown;
 }
 
+bool TlsWrapper::IsSessionReused() const {
+  return impl_->ssl && SSL_session_reused(impl_->ssl.get());
+}
+
+bool TlsWrapper::IsKernelTlsEnabled() const {
+  return impl_->IsKernelTlsEnabled();
+}
+
 bool TlsWrapper::WaitReadable(Deadline deadline) {
   impl_->CheckAlive();
   char buf = 0;
@@ -482,10 +946,78 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
                              deadline, "SendAll");
 }
 
+size_t TlsWrapper::SendAll(const IoData* list, std::size_t list_size,
+                           Deadline deadline) {
+  impl_->CheckAlive();
+
+  // Every SSL_write produces at least one record, so small buffers are
+  // gathered into one to avoid tiny records.
+  std::string coalesced;
+  size_t sent_bytes = 0;
+  const auto flush = [&] {
+    if (coalesced.empty()) return true;
+    const auto chunk_size =
+        impl_->PerformSslIo(&SSL_write_ex, coalesced.data(), coalesced.size(),
+                            impl::TransferMode::kWhole, InterruptAction::kFail,
+                            deadline, "SendAll");
+    sent_bytes += chunk_size;
+    const bool is_sent = chunk_size == coalesced.size();
+    coalesced.clear();
+    return is_sent;
+  };
+
+  for (std::size_t i = 0; i < list_size; ++i) {
+    const auto& data = list[i];
+    if (coalesced.size() + data.len <= kMaxCoalescedSize) {
+      if (coalesced.empty()) coalesced.reserve(kMaxCoalescedSize);
+      coalesced.append(static_cast<const char*>(data.data), data.len);
+      continue;
+    }
+
+    if (!flush()) return sent_bytes;
+    const auto chunk_size = SendAll(data.data, data.len, deadline);
+    sent_bytes += chunk_size;
+    if (chunk_size != data.len) return sent_bytes;
+  }
+  flush();
+  return sent_bytes;
+}
+
+size_t TlsWrapper::SendFile(int file_fd, std::size_t offset, std::size_t size,
+                            Deadline deadline) {
+  impl_->CheckAlive();
+#ifdef USERVER_TLS_WRAPPER_HAS_KTLS
+  if (impl_->IsKernelTlsEnabled()) {
+    return impl_->SendFileKtls(file_fd, offset, size, deadline);
+  }
+#endif
+
+  std::string buffer(std::min(size, kMaxCoalescedSize), '\0');
+  size_t sent_bytes = 0;
+  while (sent_bytes < size) {
+    const auto chunk_size = std::min(size - sent_bytes, buffer.size());
+    const auto read_bytes =
+        ::pread(file_fd, buffer.data(), chunk_size, offset + sent_bytes);
+    if (read_bytes < 0) {
+      const auto err_value = errno;
+      if (err_value == EINTR) continue;
+      throw IoSystemError(err_value, "calling ::pread");
+    }
+    if (read_bytes == 0) {
+      throw IoException("the file was truncated while sending");
+    }
+
+    const auto chunk_sent = SendAll(buffer.data(), read_bytes, deadline);
+    sent_bytes += chunk_sent;
+    if (chunk_sent != static_cast<size_t>(read_bytes)) break;
+  }
+  return sent_bytes;
+}
+
 Socket TlsWrapper::StopTls(Deadline deadline) {
   if (impl_->ssl) {
     impl_->is_in_shutdown = true;
-    impl_->bio_data.current_deadline = deadline;
+    impl_->PrepareIo(deadline);
     int shutdown_ret = 0;
     while (shutdown_ret != 1) {
       shutdown_ret = SSL_shutdown(impl_->ssl.get());
@@ -495,6 +1027,7 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
           // this is fine
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (impl_->is_native_bio) impl_->WaitSocket(shutdown_ret, 0);
             break;
 
           // connection breaking errors
@@ -8,6 +8,9 @@
 #include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/engine/single_consumer_event.hpp>
@@ -216,6 +219,39 @@ UTEST_MT(TlsWrapper, DocTest, 2) {
   EXPECT_EQ(result, kData.substr(0, result.size()));
 }
 
+UTEST_MT(TlsWrapper, SendAllVector, 2) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  const std::string large_chunk(32 * 1024, 'x');
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+  auto server_task = utils::Async(
+      "tls-server",
+      [deadline, &large_chunk](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), deadline);
+        EXPECT_EQ(tls_server.SendAll({{"head", 4},
+                                      {large_chunk.data(), large_chunk.size()},
+                                      {"er", 2},
+                                      {"tail", 4}},
+                                     deadline),
+                  large_chunk.size() + 10);
+      },
+      std::move(server));
+
+  auto tls_client =
+      io::TlsWrapper::StartTlsClient(std::move(client), {}, deadline);
+  std::string buffer(large_chunk.size() + 10, '\0');
+  EXPECT_EQ(tls_client.RecvAll(buffer.data(), buffer.size(), deadline),
+            buffer.size());
+  EXPECT_EQ(buffer, "head" + large_chunk + "ertail");
+
+  server_task.Get();
+}
+
 UTEST(TlsWrapper, Move) {
   const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -476,6 +512,103 @@ UTEST_MT(TlsWrapper, DoubleSmoke, 4) {
   other_client_task.Get();
 }
 
+UTEST_MT(TlsWrapper, SessionResumption, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  io::TlsServerContext::Settings settings;
+  settings.handshake_task_processor = &engine::current_task::GetTaskProcessor();
+  io::TlsServerContext context{crypto::Certificate::LoadFromString(cert),
+                               crypto::PrivateKey::LoadFromString(key),
+                               {},
+                               settings};
+  TcpListener tcp_listener;
+
+  // returns whether the session was resumed
+  const auto talk = [&] {
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+    auto server_task = engine::AsyncNoSpan(
+        [&context, test_deadline](auto&& server) {
+          auto tls_server = io::TlsWrapper::StartTlsServer(
+              std::forward<decltype(server)>(server), context, test_deadline);
+          EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+          return tls_server.IsSessionReused();
+        },
+        std::move(server));
+
+    auto tls_client =
+        io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+    char c = 0;
+    // also receives the session tickets sent after the handshake
+    EXPECT_EQ(1, tls_client.RecvSome(&c, 1, test_deadline));
+    EXPECT_EQ('1', c);
+    EXPECT_EQ(server_task.Get(), tls_client.IsSessionReused());
+    return tls_client.IsSessionReused();
+  };
+
+  EXPECT_FALSE(talk());
+  EXPECT_TRUE(talk());
+
+  // tickets of the previous key are accepted
+  context.RotateTicketKey();
+  EXPECT_TRUE(talk());
+
+  context.RotateTicketKey();
+  context.RotateTicketKey();
+  EXPECT_FALSE(talk());
+  EXPECT_TRUE(talk());
+}
+
+UTEST_MT(TlsWrapper, KernelTls, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  const std::string file_data(64 * 1024, 'f');
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), file_data);
+
+  io::TlsServerContext::Settings settings;
+  settings.enable_ktls = true;
+  io::TlsServerContext context{crypto::Certificate::LoadFromString(cert),
+                               crypto::PrivateKey::LoadFromString(key),
+                               {},
+                               settings};
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+  auto server_task = engine::AsyncNoSpan(
+      [&context, &file, &file_data, test_deadline](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server), context, test_deadline);
+        // depends on the kernel, the connection works either way
+        LOG_INFO() << "Kernel TLS enabled: " << tls_server.IsKernelTlsEnabled();
+
+        EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+        char c = 0;
+        EXPECT_EQ(1, tls_server.RecvSome(&c, 1, test_deadline));
+        EXPECT_EQ('2', c);
+
+        const auto fd = fs::blocking::FileDescriptor::Open(
+            file.GetPath(), fs::blocking::OpenFlag::kRead);
+        EXPECT_EQ(file_data.size() - 1,
+                  tls_server.SendFile(fd.GetNative(), 1, file_data.size() - 1,
+                                      test_deadline));
+      },
+      std::move(server));
+
+  auto tls_client =
+      io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+  char c = 0;
+  EXPECT_EQ(1, tls_client.RecvSome(&c, 1, test_deadline));
+  EXPECT_EQ('1', c);
+  EXPECT_EQ(1, tls_client.SendAll("2", 1, test_deadline));
+
+  std::string buffer(file_data.size() - 1, '\0');
+  EXPECT_EQ(tls_client.RecvAll(buffer.data(), buffer.size(), test_deadline),
+            buffer.size());
+  EXPECT_EQ(buffer, file_data.substr(1));
+
+  server_task.Get();
+}
+
 UTEST(TlsWrapper, InvalidSocket) {
   const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -0,0 +1,110 @@
+#include <userver/engine/reader_biased_shared_mutex.hpp>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+std::size_t GetReadersShardIndex() noexcept {
+  return utils::statistics::impl::GetThreadShardIndex();
+}
+
+}  // namespace
+
+ReaderBiasedSharedMutex::ReaderBiasedSharedMutex() = default;
+
+ReaderBiasedSharedMutex::~ReaderBiasedSharedMutex() {
+  UASSERT(!has_writer_->load());
+  UASSERT(GetReadersCount() == 0);
+}
+
+void ReaderBiasedSharedMutex::lock() {
+  const engine::TaskCancellationBlocker block_cancels;
+  [[maybe_unused]] const bool locked = try_lock_until(Deadline{});
+  UASSERT(locked);
+}
+
+void ReaderBiasedSharedMutex::unlock() { ReleaseWriter(); }
+
+bool ReaderBiasedSharedMutex::try_lock() {
+  return try_lock_until(Deadline::Passed());
+}
+
+bool ReaderBiasedSharedMutex::try_lock_until(Deadline deadline) {
+  if (!writers_mutex_.try_lock_until(deadline)) return false;
+
+  // Pairs with the readers_ update in TryLockSharedFastPath(): either the
+  // reader sees the writer and backs off, or the writer sees the reader
+  has_writer_->store(true);
+  while (GetReadersCount() != 0) {
+    if (!readers_left_event_.WaitForEventUntil(deadline)) {
+      ReleaseWriter();
+      return false;
+    }
+  }
+  return true;
+}
+
+void ReaderBiasedSharedMutex::lock_shared() {
+  if (TryLockSharedFastPath()) return;
+
+  const engine::TaskCancellationBlocker block_cancels;
+  [[maybe_unused]] const bool locked = try_lock_shared_until(Deadline{});
+  UASSERT(locked);
+}
+
+void ReaderBiasedSharedMutex::unlock_shared() {
+  readers_[GetReadersShardIndex() % kReadersShardsCount]->fetch_sub(1);
+  if (has_writer_->load()) readers_left_event_.Send();
+}
+
+bool ReaderBiasedSharedMutex::try_lock_shared() {
+  return TryLockSharedFastPath();
+}
+
+bool ReaderBiasedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  while (!TryLockSharedFastPath()) {
+    std::unique_lock lock(readers_mutex_);
+    const bool no_writer = readers_cv_.WaitUntil(
+        lock, deadline, [this] { return !has_writer_->load(); });
+    if (!no_writer) return false;
+  }
+  return true;
+}
+
+bool ReaderBiasedSharedMutex::TryLockSharedFastPath() {
+  auto& readers = *readers_[GetReadersShardIndex() % kReadersShardsCount];
+  readers.fetch_add(1);
+  if (!has_writer_->load()) return true;
+
+  // The writer may be already waiting for this reader to leave
+  readers.fetch_sub(1);
+  readers_left_event_.Send();
+  return false;
+}
+
+std::int64_t ReaderBiasedSharedMutex::GetReadersCount() const noexcept {
+  std::int64_t result = 0;
+  for (const auto& readers : readers_) result += readers->load();
+  return result;
+}
+
+void ReaderBiasedSharedMutex::ReleaseWriter() {
+  // The flag is reset before the next writer may set it again
+  has_writer_->store(false);
+  {
+    const engine::TaskCancellationBlocker block_cancels;
+    std::lock_guard lock(readers_mutex_);
+    readers_cv_.NotifyAll();
+  }
+  writers_mutex_.unlock();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -18,7 +18,7 @@ class SemaphoreWaitStrategy final : public impl::WaitStrategy {
  public:
   SemaphoreWaitStrategy(impl::WaitList& waiters, impl::TaskContext& current,
                         Deadline deadline) noexcept
-      : WaitStrategy(deadline),
+      : WaitStrategy(deadline, impl::WaitKind::kMutex),
         waiters_(waiters),
         current_(current),
         waiter_token_(waiters_),
@@ -1,18 +1,24 @@
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-void shared_mutex_benchmark(benchmark::State& state) {
+namespace {
+
+template <typename SharedMutex>
+void SharedLock(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     int variable = 0;
-    engine::SharedMutex mutex;
+    SharedMutex mutex;
     std::atomic<bool> is_running(true);
 
     std::vector<engine::TaskWithResult<void>> tasks;
@@ -43,6 +49,63 @@ void shared_mutex_benchmark(benchmark::State& state) {
     }
   });
 }
+// Readers with a writer once in a while
+template <typename SharedMutex>
+void SharedLockWithWriter(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    int variable = 0;
+    SharedMutex mutex;
+    std::atomic<bool> is_running(true);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < state.range(0) - 1; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&] {
+        while (is_running) {
+          std::shared_lock lock(mutex);
+          benchmark::DoNotOptimize(variable);
+        }
+      }));
+    }
+
+    std::int64_t iteration = 0;
+    for (auto _ : state) {
+      if (++iteration % 1000 == 0) {
+        std::unique_lock lock(mutex);
+        ++variable;
+      } else {
+        std::shared_lock lock(mutex);
+        benchmark::DoNotOptimize(variable);
+      }
+    }
+
+    is_running = false;
+
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+}  // namespace
+
+void shared_mutex_benchmark(benchmark::State& state) {
+  SharedLock<engine::SharedMutex>(state);
+}
 BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
 
+void reader_biased_shared_mutex_benchmark(benchmark::State& state) {
+  SharedLock<engine::ReaderBiasedSharedMutex>(state);
+}
+BENCHMARK(reader_biased_shared_mutex_benchmark)->DenseRange(1, 6);
+
+void shared_mutex_with_writer_benchmark(benchmark::State& state) {
+  SharedLockWithWriter<engine::SharedMutex>(state);
+}
+BENCHMARK(shared_mutex_with_writer_benchmark)->DenseRange(1, 6);
+
+void reader_biased_shared_mutex_with_writer_benchmark(benchmark::State& state) {
+  SharedLockWithWriter<engine::ReaderBiasedSharedMutex>(state);
+}
+BENCHMARK(reader_biased_shared_mutex_with_writer_benchmark)->DenseRange(1, 6);
+
 USERVER_NAMESPACE_END
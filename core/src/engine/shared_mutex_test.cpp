@@ -1,14 +1,24 @@
 #include <userver/utest/utest.hpp>
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-UTEST(SharedMutex, SharedLockUnlockDouble) {
-  engine::SharedMutex mutex;
+template <class T>
+struct SharedMutex : public ::testing::Test {};
+TYPED_UTEST_SUITE_P(SharedMutex);
+
+TYPED_UTEST_P(SharedMutex, SharedLockUnlockDouble) {
+  TypeParam mutex;
   mutex.lock_shared();
   mutex.unlock_shared();
 
@@ -16,8 +26,8 @@ UTEST(SharedMutex, SharedLockUnlockDouble) {
   mutex.unlock_shared();
 }
 
-UTEST(SharedMutex, SharedLockParallel) {
-  engine::SharedMutex mutex;
+TYPED_UTEST_P(SharedMutex, SharedLockParallel) {
+  TypeParam mutex;
   std::atomic<int> count{0};
   std::atomic<bool> was{false};
 
@@ -25,7 +35,7 @@ UTEST(SharedMutex, SharedLockParallel) {
   tasks.reserve(2);
   for (auto i = 0; i < 2; i++)
     tasks.push_back(utils::Async("", [&mutex, &count, &was] {
-      std::shared_lock<engine::SharedMutex> lock(mutex);
+      std::shared_lock<TypeParam> lock(mutex);
 
       count++;
       for (auto i = 0; i < 3 && count != 2; i++) {
@@ -40,12 +50,12 @@ UTEST(SharedMutex, SharedLockParallel) {
   EXPECT_TRUE(was.load());
 }
 
-UTEST(SharedMutex, SharedAndUniqueLock) {
-  engine::SharedMutex mutex;
+TYPED_UTEST_P(SharedMutex, SharedAndUniqueLock) {
+  TypeParam mutex;
 
-  std::unique_lock<engine::SharedMutex> lock(mutex);
+  std::unique_lock<TypeParam> lock(mutex);
   auto reader = utils::Async(
-      "", [&mutex] { std::shared_lock<engine::SharedMutex> lock(mutex); });
+      "", [&mutex] { std::shared_lock<TypeParam> lock(mutex); });
 
   reader.WaitFor(std::chrono::milliseconds(50));
   EXPECT_FALSE(reader.IsFinished());
@@ -57,12 +67,12 @@ UTEST(SharedMutex, SharedAndUniqueLock) {
   UEXPECT_NO_THROW(reader.Get());
 }
 
-UTEST(SharedMutex, UniqueAndSharedLock) {
-  engine::SharedMutex mutex;
+TYPED_UTEST_P(SharedMutex, UniqueAndSharedLock) {
+  TypeParam mutex;
 
-  std::shared_lock<engine::SharedMutex> lock(mutex);
+  std::shared_lock<TypeParam> lock(mutex);
   auto writer = utils::Async(
-      "", [&mutex] { std::unique_lock<engine::SharedMutex> lock(mutex); });
+      "", [&mutex] { std::unique_lock<TypeParam> lock(mutex); });
 
   writer.WaitFor(std::chrono::milliseconds(50));
   EXPECT_FALSE(writer.IsFinished());
@@ -74,14 +84,14 @@ UTEST(SharedMutex, UniqueAndSharedLock) {
   UEXPECT_NO_THROW(writer.Get());
 }
 
-UTEST_MT(SharedMutex, WritersDontStarve, 2) {
-  engine::SharedMutex mutex;
+TYPED_UTEST_P_MT(SharedMutex, WritersDontStarve, 2) {
+  TypeParam mutex;
   std::atomic<ssize_t> counter{0};
   std::atomic<ssize_t> loaded{-1};
 
-  std::shared_lock<engine::SharedMutex> lock(mutex);
+  std::shared_lock<TypeParam> lock(mutex);
   auto writer = utils::Async("", [&mutex, &counter, &loaded] {
-    std::unique_lock<engine::SharedMutex> lock(mutex);
+    std::unique_lock<TypeParam> lock(mutex);
     loaded = counter.load();
   });
 
@@ -92,7 +102,7 @@ UTEST_MT(SharedMutex, WritersDontStarve, 2) {
   readers.reserve(10);
   for (int i = 0; i < 10; i++) {
     readers.push_back(utils::Async("", [&counter, &mutex] {
-      std::shared_lock<engine::SharedMutex> lock(mutex);
+      std::shared_lock<TypeParam> lock(mutex);
       counter++;
     }));
   }
@@ -108,8 +118,8 @@ UTEST_MT(SharedMutex, WritersDontStarve, 2) {
   EXPECT_EQ(loaded.load(), 0);
 }
 
-UTEST(SharedMutex, TryLock) {
-  engine::SharedMutex mutex;
+TYPED_UTEST_P(SharedMutex, TryLock) {
+  TypeParam mutex;
 
   for (int i = 0; i < 10; i++) {
     ASSERT_TRUE(mutex.try_lock());
@@ -118,18 +128,52 @@ UTEST(SharedMutex, TryLock) {
 
   {
     // mutex must be free of writers
-    std::shared_lock<engine::SharedMutex> lock(mutex);
+    std::shared_lock<TypeParam> lock(mutex);
   }
 }
 
-UTEST(SharedMutex, TryLockFail) {
-  engine::SharedMutex mutex;
+TYPED_UTEST_P(SharedMutex, TryLockFail) {
+  TypeParam mutex;
 
-  std::unique_lock<engine::SharedMutex> lock(mutex);
+  std::unique_lock<TypeParam> lock(mutex);
   auto task = utils::Async("", [&mutex] { return mutex.try_lock(); });
   EXPECT_FALSE(task.Get());
 }
 
+TYPED_UTEST_P_MT(SharedMutex, ReadersAndWriters, 4) {
+  TypeParam mutex;
+  std::pair<int, int> data{0, 0};
+  std::atomic<bool> is_running{true};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 6; ++i) {
+    tasks.push_back(utils::Async("reader", [&] {
+      while (is_running) {
+        std::shared_lock lock(mutex);
+        // the task may migrate to another thread while holding the lock
+        engine::Yield();
+        ASSERT_EQ(data.first, data.second);
+      }
+    }));
+  }
+  for (int i = 0; i < 2; ++i) {
+    tasks.push_back(utils::Async("writer", [&] {
+      for (int j = 0; j < 100; ++j) {
+        std::unique_lock lock(mutex);
+        ++data.first;
+        engine::Yield();
+        ++data.second;
+      }
+    }));
+  }
+
+  for (std::size_t i = 6; i < tasks.size(); ++i) tasks[i].Get();
+  is_running = false;
+  for (auto& task : tasks) task.Get();
+  EXPECT_EQ(data.first, 200);
+  EXPECT_EQ(data.second, 200);
+}
+
 UTEST(SharedMutex, SampleSharedMutex) {
   /// [Sample engine::SharedMutex usage]
 
@@ -153,4 +197,32 @@ UTEST(SharedMutex, SampleSharedMutex) {
   /// [Sample engine::SharedMutex usage]
 }
 
+UTEST(SharedMutex, SampleReaderBiasedSharedMutex) {
+  /// [Sample ReaderBiasedSharedMutex usage]
+  engine::ReaderBiasedSharedMutex mutex;
+  std::unordered_map<std::string, int> data;
+  {
+    std::lock_guard lock(mutex);
+    // rare updates are slower than with engine::SharedMutex
+    data["count"] = 1;
+  }
+
+  {
+    // frequent reads from many threads do not contend
+    std::shared_lock lock(mutex);
+    ASSERT_EQ(data.at("count"), 1);
+  }
+  /// [Sample ReaderBiasedSharedMutex usage]
+}
+
+REGISTER_TYPED_UTEST_SUITE_P(SharedMutex, SharedLockUnlockDouble,
+                             SharedLockParallel, SharedAndUniqueLock,
+                             UniqueAndSharedLock, WritersDontStarve, TryLock,
+                             TryLockFail, ReadersAndWriters);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSharedMutex, SharedMutex,
+                                engine::SharedMutex);
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineReaderBiasedSharedMutex, SharedMutex,
+                                engine::ReaderBiasedSharedMutex);
+
 USERVER_NAMESPACE_END
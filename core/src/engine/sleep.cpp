@@ -12,7 +12,8 @@ namespace impl {
 namespace {
 class CommonSleepWaitStrategy final : public WaitStrategy {
  public:
-  CommonSleepWaitStrategy(Deadline deadline) : WaitStrategy(deadline) {}
+  CommonSleepWaitStrategy(Deadline deadline)
+      : WaitStrategy(deadline, WaitKind::kSleep) {}
 
   void SetupWakeups() override {}
 
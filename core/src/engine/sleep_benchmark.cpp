@@ -1,3 +1,6 @@
+#include <cstdint>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <engine/ev/thread_control.hpp>
@@ -67,4 +70,30 @@ BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline,
                   true);
 
+// Typical server load: lots of tasks waiting with long deadlines, most of the
+// deadlines are never reached
+void many_unreached_deadlines_benchmark(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto tasks_count = state.range(0);
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(tasks_count);
+
+    for (auto _ : state) {
+      for (std::int64_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(
+            [i] { engine::InterruptibleSleepFor(10s + 1ms * (i % 1000)); }));
+      }
+      engine::Yield();
+      for (auto& task : tasks) task.RequestCancel();
+      for (auto& task : tasks) task.Wait();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * tasks_count);
+  });
+}
+BENCHMARK(many_unreached_deadlines_benchmark)
+    ->RangeMultiplier(10)
+    ->Range(10, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+
 USERVER_NAMESPACE_END
@@ -1,20 +1,23 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <spawn.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
 #include <csignal>
-#include <cstdio>
 #include <cstring>
-#include <iostream>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <userver/engine/io/pipe.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <utils/check_syscall.hpp>
 
 #include <engine/ev/child_process_map.hpp>
@@ -31,20 +34,68 @@ USERVER_NAMESPACE_BEGIN
 namespace engine::subprocess {
 namespace {
 
-void DoExecve(const std::string& command, const std::vector<std::string>& args,
-              const EnvironmentVariables& env,
-              const std::optional<std::string>& stdout_file,
-              const std::optional<std::string>& stderr_file) {
-  if (stdout_file) {
-    if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-      utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
-    }
+void CheckSpawnError(int error, const char* what) {
+  // posix_spawn* functions return the error instead of setting errno
+  if (error != 0) {
+    throw std::system_error(std::error_code(error, std::system_category()),
+                            fmt::format("Error while {}", what));
   }
-  if (stderr_file) {
-    if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-      utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
-    }
+}
+
+class SpawnFileActions final {
+ public:
+  SpawnFileActions() {
+    CheckSpawnError(posix_spawn_file_actions_init(&actions_),
+                    "posix_spawn_file_actions_init");
+  }
+
+  SpawnFileActions(const SpawnFileActions&) = delete;
+  SpawnFileActions& operator=(const SpawnFileActions&) = delete;
+
+  ~SpawnFileActions() { posix_spawn_file_actions_destroy(&actions_); }
+
+  void AddAppendFile(int fd, const std::string& path) {
+    // same flags as freopen(path, "a")
+    CheckSpawnError(
+        posix_spawn_file_actions_addopen(&actions_, fd, path.c_str(),
+                                         O_WRONLY | O_CREAT | O_APPEND, 0666),
+        "posix_spawn_file_actions_addopen");
+  }
+
+  void AddDup2(int fd, int new_fd) {
+    CheckSpawnError(posix_spawn_file_actions_adddup2(&actions_, fd, new_fd),
+                    "posix_spawn_file_actions_adddup2");
+  }
+
+  const posix_spawn_file_actions_t* Get() const { return &actions_; }
+
+ private:
+  posix_spawn_file_actions_t actions_{};
+};
+
+struct ChildStreams {
+  std::optional<std::string> stdout_file;
+  std::optional<std::string> stderr_file;
+  int stdin_fd{-1};
+  int stdout_fd{-1};
+};
+
+int DoSpawn(const std::string& command, const std::vector<std::string>& args,
+            const EnvironmentVariables& env, const ChildStreams& streams) {
+  SpawnFileActions actions;
+  // The pipe ends are dup'ed before the files are opened, so that a file
+  // could not take the descriptor of a pipe
+  if (streams.stdin_fd != -1) actions.AddDup2(streams.stdin_fd, STDIN_FILENO);
+  if (streams.stdout_fd != -1) {
+    actions.AddDup2(streams.stdout_fd, STDOUT_FILENO);
   }
+  if (streams.stdout_file) {
+    actions.AddAppendFile(STDOUT_FILENO, *streams.stdout_file);
+  }
+  if (streams.stderr_file) {
+    actions.AddAppendFile(STDERR_FILENO, *streams.stderr_file);
+  }
+
   std::vector<char*> argv_ptrs;
   std::vector<std::string> envp_buf;
   std::vector<char*> envp_ptrs;
@@ -67,27 +118,33 @@ void DoExecve(const std::string& command, const std::vector<std::string>& args,
   }
   envp_ptrs.push_back(nullptr);
 
-  utils::CheckSyscall(
-      execve(command.c_str(), argv_ptrs.data(), envp_ptrs.data()), "execve");
+  // Unlike fork(), posix_spawn does not copy the page tables of the parent
+  // (glibc uses clone with CLONE_VM | CLONE_VFORK), so the start of a child
+  // does not slow down with the growth of the parent RSS. Errors of the exec
+  // and of the file actions are reported to the parent.
+  pid_t pid = -1;
+  CheckSpawnError(posix_spawn(&pid, command.c_str(), actions.Get(), nullptr,
+                              argv_ptrs.data(), envp_ptrs.data()),
+                  "posix_spawn");
+  return pid;
 }
 
-}  // namespace
-
-ProcessStarter::ProcessStarter(TaskProcessor& task_processor)
-    : thread_control_(
-          task_processor.EventThreadPool().GetEvDefaultLoopThread()) {}
+void MakeBlocking(int fd) {
+  const auto flags = utils::CheckSyscall(::fcntl(fd, F_GETFL), "fcntl");
+  utils::CheckSyscall(::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK), "fcntl");
+}
 
-ChildProcess ProcessStarter::Exec(
-    const std::string& command, const std::vector<std::string>& args,
-    const EnvironmentVariables& env,
-    const std::optional<std::string>& stdout_file,
-    const std::optional<std::string>& stderr_file) {
+ChildProcess DoExec(ev::ThreadControl& thread_control,
+                    const std::string& command,
+                    const std::vector<std::string>& args,
+                    const EnvironmentVariables& env,
+                    const ChildStreams& streams) {
   tracing::Span span("ProcessStarter::Exec");
   span.AddTag("command", command);
   Promise<ChildProcess> promise;
   auto future = promise.get_future();
-  thread_control_.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
-    LOG_DEBUG() << "do fork() + execve(), command=" << command << ", args=["
+  thread_control.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
+    LOG_DEBUG() << "do posix_spawn(), command=" << command << ", args=["
                 << (args.empty() ? "" : '\'' + boost::join(args, "' '") + '\'')
                 << "], env=["
                 << (env.empty()
@@ -99,37 +156,29 @@ ChildProcess ProcessStarter::Exec(
                                                 }),
                                       ", "))
                 << ']';
-    auto pid = utils::CheckSyscall(fork(), "fork");
-    if (pid) {
-      // in parent thread
-      span.AddTag("child-process-pid", pid);
-      LOG_DEBUG() << "Started child process with pid=" << pid;
-      Promise<ChildProcessStatus> exec_result_promise;
-      auto res = ChildProcessMapSet(
-          pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-      if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-      } else {
-        std::string msg = "process with pid=" + std::to_string(pid) +
-                          " already exists in child_process_map";
-        LOG_ERROR() << msg << ", send SIGKILL";
-        ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-        promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-      }
+    int pid = -1;
+    try {
+      pid = DoSpawn(command, args, env, streams);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Cannot execute child: " << ex;
+      promise.set_exception(std::current_exception());
+      return;
+    }
+
+    span.AddTag("child-process-pid", pid);
+    LOG_DEBUG() << "Started child process with pid=" << pid;
+    Promise<ChildProcessStatus> exec_result_promise;
+    auto res = ChildProcessMapSet(
+        pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+    if (res.second) {
+      promise.set_value(ChildProcess{
+          ChildProcessImpl{pid, res.first->status_promise.get_future()}});
     } else {
-      // in child thread
-      try {
-        try {
-          DoExecve(command, args, env, stdout_file, stderr_file);
-        } catch (const std::exception& ex) {
-          std::cerr << "Cannot execute child: " << ex.what();
-        }
-      } catch (...) {
-        // must not do anything in a child
-      }
-      // on success execve does not return
-      std::abort();
+      std::string msg = "process with pid=" + std::to_string(pid) +
+                        " already exists in child_process_map";
+      LOG_ERROR() << msg << ", send SIGKILL";
+      ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+      promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
     }
   });
 
@@ -137,6 +186,21 @@ ChildProcess ProcessStarter::Exec(
   return future.get();
 }
 
+}  // namespace
+
+ProcessStarter::ProcessStarter(TaskProcessor& task_processor)
+    : thread_control_(
+          task_processor.EventThreadPool().GetEvDefaultLoopThread()) {}
+
+ChildProcess ProcessStarter::Exec(
+    const std::string& command, const std::vector<std::string>& args,
+    const EnvironmentVariables& env,
+    const std::optional<std::string>& stdout_file,
+    const std::optional<std::string>& stderr_file) {
+  return DoExec(thread_control_, command, args, env,
+                ChildStreams{stdout_file, stderr_file});
+}
+
 ChildProcess ProcessStarter::Exec(
     const std::string& command, const std::vector<std::string>& args,
     EnvironmentVariablesUpdate env_update,
@@ -156,6 +220,36 @@ ChildProcess ProcessStarter::Exec(
               stderr_file);
 }
 
+PipedChildProcess ProcessStarter::ExecWithPipes(
+    const std::string& command, const std::vector<std::string>& args,
+    EnvironmentVariablesUpdate env_update,
+    const std::optional<std::string>& stderr_file) {
+  io::Pipe input;
+  io::Pipe output;
+
+  ChildStreams streams{std::nullopt, stderr_file};
+  streams.stdin_fd = input.reader.Release();
+  utils::FastScopeGuard stdin_guard(
+      [fd = streams.stdin_fd]() noexcept { ::close(fd); });
+  streams.stdout_fd = output.writer.Release();
+  utils::FastScopeGuard stdout_guard(
+      [fd = streams.stdout_fd]() noexcept { ::close(fd); });
+  // The parent ends stay non-blocking, the child gets blocking ones as most
+  // programs do not expect non-blocking standard streams
+  MakeBlocking(streams.stdin_fd);
+  MakeBlocking(streams.stdout_fd);
+
+  // The child ends are closed by the guards, so the parent gets EOF once
+  // the child exits
+  auto process = DoExec(
+      thread_control_, command, args,
+      EnvironmentVariables{GetCurrentEnvironmentVariables()}.UpdateWith(
+          std::move(env_update)),
+      streams);
+  return PipedChildProcess{std::move(process), std::move(input.writer),
+                           std::move(output.reader)};
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <string>
+#include <system_error>
 #include <thread>
 #include <vector>
 
@@ -65,6 +66,41 @@ UTEST(Subprocess, False) {
   EXPECT_NE(0, status.GetExitCode());
 }
 
+UTEST(Subprocess, NonExistentCommand) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  UEXPECT_THROW(starter.Exec("/non/existent/command", {}), std::system_error);
+}
+
+UTEST(Subprocess, ExecWithPipes) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  /// [Sample ExecWithPipes]
+  auto child = starter.ExecWithPipes("/bin/cat", {});
+
+  const std::string request = "request\n";
+  ASSERT_EQ(child.input.WriteAll(request.data(), request.size(), deadline),
+            request.size());
+
+  std::string response(request.size(), '\0');
+  ASSERT_EQ(child.output.ReadAll(response.data(), response.size(), deadline),
+            request.size());
+  EXPECT_EQ(response, request);
+
+  child.input.Close();
+  auto status = child.process.Get();
+  /// [Sample ExecWithPipes]
+
+  ASSERT_TRUE(status.IsExited());
+  EXPECT_EQ(0, status.GetExitCode());
+
+  char c = 0;
+  EXPECT_EQ(child.output.ReadSome(&c, 1, deadline), 0);
+}
+
 UTEST(Subprocess, CheckSpdlogClosesFds) {
   auto file = fs::blocking::TempFile::Create("/tmp", kSpdlogFilePart);
   auto logger = logging::MakeFileLogger("to_file", file.GetPath(),
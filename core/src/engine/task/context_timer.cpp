@@ -13,6 +13,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Shorter timers are armed on ev_timer for the sub-tick precision, longer
+// ones go to the TimerWheel. Most of the deadlines are the long ones, and
+// most of them are cancelled long before the expiry.
+constexpr std::chrono::milliseconds kTimerWheelMinTimeLeft{50};
+
+}  // namespace
+
 class ContextTimer::Impl final : public ev::MultiShotAsyncPayload<Impl> {
  public:
   Impl();
@@ -36,6 +45,7 @@ class ContextTimer::Impl final : public ev::MultiShotAsyncPayload<Impl> {
   void DoFinalize();
 
   static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnWheelTimer(void* data) noexcept;
   void DoOnTimer();
 
   class Finalizer final : public ev::SingleShotAsyncPayload<Finalizer> {
@@ -56,11 +66,13 @@ class ContextTimer::Impl final : public ev::MultiShotAsyncPayload<Impl> {
   std::optional<ev::TimerThreadControl> thread_control_;
   Params params_;
   ev_timer timer_{};
+  ev::TimerWheel::Timer wheel_timer_;
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
   Finalizer finalizer_;
 };
 
-ContextTimer::Impl::Impl() : finalizer_(*this) {
+ContextTimer::Impl::Impl()
+    : wheel_timer_(&OnWheelTimer, this), finalizer_(*this) {
   timer_.data = this;
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_init(&timer_, OnTimer);
@@ -118,23 +130,31 @@ void ContextTimer::Impl::DoPerformAndRelease() {
 
 void ContextTimer::Impl::ArmTimerInEvThread() {
   using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
+  const auto time_left = params_.deadline.TimeLeft();
+  const auto now = Deadline::Clock::now();
 
-  LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  LOG_TRACE() << "time_left="
+              << std::chrono::duration_cast<LibEvDuration>(time_left).count();
+  if (time_left <= Deadline::Duration::zero()) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
-  thread_control_->Again(timer_);
+  if (time_left < kTimerWheelMinTimeLeft) {
+    thread_control_->Cancel(wheel_timer_);
+    timer_.repeat =
+        std::chrono::duration_cast<LibEvDuration>(time_left).count();
+    thread_control_->Again(timer_);
+  } else {
+    thread_control_->Stop(timer_);
+    thread_control_->Schedule(wheel_timer_, now + time_left);
+  }
 }
 
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   thread_control_->Stop(timer_);
+  thread_control_->Cancel(wheel_timer_);
 }
 
 void ContextTimer::Impl::DoFinalize() {
@@ -154,6 +174,12 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnWheelTimer(void* data) noexcept {
+  auto* impl = static_cast<Impl*>(data);
+  UASSERT(impl != nullptr);
+  impl->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
   try {
     // do not keep the function object around for much longer
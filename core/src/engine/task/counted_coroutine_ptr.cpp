@@ -17,6 +17,12 @@ CountedCoroutinePtr::CoroPool::Coroutine& CountedCoroutinePtr::operator*() {
   return coro_->Get();
 }
 
+const CountedCoroutinePtr::CoroPool::StackContext&
+CountedCoroutinePtr::GetStack() const {
+  UASSERT(coro_);
+  return coro_->GetStack();
+}
+
 void CountedCoroutinePtr::ReturnToPool() && {
   if (coro_) std::move(*coro_).ReturnToPool();
   token_ = std::nullopt;
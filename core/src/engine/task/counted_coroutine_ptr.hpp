@@ -28,6 +28,8 @@ class CountedCoroutinePtr final {
 
   CoroPool::Coroutine& operator*();
 
+  const CoroPool::StackContext& GetStack() const;
+
   void ReturnToPool() &&;
 
  private:
@@ -0,0 +1,424 @@
+#include <engine/task/cpu_profiler.hpp>
+
+#include <pthread.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include <fmt/format.h>
+#include <boost/stacktrace/frame.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <compiler/tls.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// 256 samples per thread are collected within 2.5 seconds at 100 Hz
+constexpr std::size_t kRingSize = 256;
+constexpr std::size_t kMaxDepth = 64;
+constexpr std::size_t kMaxLabelSize = 64;
+// Bounds the memory of the aggregated stacks, the samples of the new stacks
+// are counted as dropped after that
+constexpr std::size_t kMaxStacks = 100'000;
+
+// The signal handler and the signal trampoline of the kernel
+constexpr std::size_t kSkippedFrames = 2;
+
+constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
+constexpr std::string_view kNoSpan = "[no span]";
+constexpr std::string_view kDroppedSamples = "[dropped samples]";
+
+struct Sample final {
+  // the innermost frame first, terminated by nullptr if less than kMaxDepth
+  const void* frames[kMaxDepth + 1];
+  std::size_t label_size{0};
+  char label[kMaxLabelSize];
+};
+
+}  // namespace
+
+struct CpuProfiler::ThreadState final {
+  const std::string* task_processor_name{nullptr};
+#ifdef __linux__
+  pthread_t thread{};
+  pid_t tid{0};
+  timer_t timer{};
+#endif
+  bool has_timer{false};
+
+  // Allocated on the first Start() and kept until the thread unregisters, as
+  // the signals of the deleted timer may still be pending
+  std::unique_ptr<Sample[]> ring_storage;
+  std::atomic<Sample*> ring{nullptr};
+  // written by the signal handler only
+  std::atomic<std::size_t> head{0};
+  // written by Collect() only
+  std::atomic<std::size_t> tail{0};
+  std::atomic<std::uint64_t> dropped{0};
+};
+
+namespace {
+
+thread_local USERVER_IMPL_CONSTINIT CpuProfiler::ThreadState*
+    current_thread_state = nullptr;
+
+USERVER_PREVENT_TLS_CACHING CpuProfiler::ThreadState*
+GetCurrentThreadState() noexcept {
+  return current_thread_state;
+}
+
+USERVER_PREVENT_TLS_CACHING void SetCurrentThreadState(
+    CpuProfiler::ThreadState* state) noexcept {
+  current_thread_state = state;
+}
+
+// Async-signal-safe: no locks, no allocations, errno is preserved
+void OnProfilerSignal(int /*signo*/, siginfo_t* /*info*/,
+                      void* /*ucontext*/) noexcept {
+  const int saved_errno = errno;
+
+  auto* const state = GetCurrentThreadState();
+  auto* const ring =
+      state ? state->ring.load(std::memory_order_acquire) : nullptr;
+  if (ring) {
+    const auto head = state->head.load(std::memory_order_relaxed);
+    if (head - state->tail.load(std::memory_order_acquire) >= kRingSize) {
+      state->dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      auto& sample = ring[head % kRingSize];
+      const auto stored = boost::stacktrace::safe_dump_to(
+          kSkippedFrames, sample.frames, sizeof(sample.frames));
+      if (stored == 0) sample.frames[0] = nullptr;
+
+      std::size_t label_size = 0;
+      auto* const context = current_task::GetCurrentTaskContextUnchecked();
+      const char* const label = context ? context->GetProfilerLabel() : nullptr;
+      if (label) {
+        while (label_size < kMaxLabelSize && label[label_size] != '\0') {
+          sample.label[label_size] = label[label_size];
+          ++label_size;
+        }
+      }
+      sample.label_size = label_size;
+
+      state->head.store(head + 1, std::memory_order_release);
+    }
+  }
+
+  errno = saved_errno;
+}
+
+std::string MakeStackKey(std::string_view task_processor_name,
+                         const Sample& sample) {
+  std::size_t depth = 0;
+  while (depth < kMaxDepth && sample.frames[depth]) ++depth;
+
+  std::string key;
+  key.reserve(task_processor_name.size() + sample.label_size + 2 +
+              depth * sizeof(const void*));
+  key.append(task_processor_name);
+  key.push_back('\0');
+  key.append(sample.label, sample.label_size);
+  key.push_back('\0');
+  key.append(reinterpret_cast<const char*>(sample.frames),
+             depth * sizeof(const void*));
+  return key;
+}
+
+std::string SanitizeFrameName(std::string name) {
+  // ';' separates the frames and the space separates the count
+  for (auto& c : name) {
+    if (c == ';') c = ':';
+    if (c == '\n') c = ' ';
+  }
+  return name;
+}
+
+class FrameNames final {
+ public:
+  // Returns nullptr for the frames of the coroutine startup machinery
+  const std::string* Get(const void* address) {
+    auto it = names_.find(address);
+    if (it == names_.end()) {
+      auto name = boost::stacktrace::frame(address).name();
+      if (name.empty()) name = fmt::format("{}", address);
+      const bool is_start = name.find(kStartOfCoroutine) != std::string::npos;
+      it = names_
+               .emplace(address, is_start
+                                     ? std::nullopt
+                                     : std::optional{SanitizeFrameName(
+                                           std::move(name))})
+               .first;
+    }
+    return it->second ? &*it->second : nullptr;
+  }
+
+ private:
+  std::unordered_map<const void*, std::optional<std::string>> names_;
+};
+
+}  // namespace
+
+CpuProfiler& CpuProfiler::Get() {
+  // Never destroyed, the worker threads may unregister after the statics
+  // are destroyed
+  static auto& profiler = *new CpuProfiler();
+  return profiler;
+}
+
+void CpuProfiler::RegisterCurrentThread(
+    const std::string& task_processor_name) {
+  UASSERT(!GetCurrentThreadState());
+
+  auto state = std::make_unique<ThreadState>();
+  state->task_processor_name = &task_processor_name;
+#ifdef __linux__
+  state->thread = pthread_self();
+  state->tid = static_cast<pid_t>(syscall(SYS_gettid));
+#endif
+  SetCurrentThreadState(state.get());
+
+  const std::lock_guard lock(mutex_);
+  auto& registered = *threads_.emplace_back(std::move(state));
+  if (is_running_) {
+    try {
+      StartThreadTimer(registered);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to start the CPU profiler on a thread of '"
+                  << task_processor_name << "': " << ex;
+    }
+  }
+}
+
+void CpuProfiler::UnregisterCurrentThread() noexcept {
+  auto* const state = GetCurrentThreadState();
+  if (!state) return;
+
+  const std::lock_guard lock(mutex_);
+#ifdef __linux__
+  if (state->has_timer) {
+    ::timer_delete(state->timer);
+    state->has_timer = false;
+  }
+#endif
+
+  try {
+    CollectThread(*state);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to collect the CPU profiler samples: " << ex;
+  }
+
+  // The pending signals of this thread see no state and do nothing
+  SetCurrentThreadState(nullptr);
+  for (auto it = threads_.begin(); it != threads_.end(); ++it) {
+    if (it->get() == state) {
+      threads_.erase(it);
+      break;
+    }
+  }
+}
+
+void CpuProfiler::Start(std::chrono::microseconds period) {
+#ifndef __linux__
+  (void)period;
+  throw std::runtime_error("CPU profiler is supported only on Linux");
+#else
+  UINVARIANT(period.count() > 0, "CPU profiler period should be positive");
+
+  const std::lock_guard lock(mutex_);
+  if (!is_signal_handler_installed_) {
+    // The handler is never removed: the default action of SIGPROF terminates
+    // the process, and the signals of the deleted timers may still be pending
+    struct sigaction action {};
+    action.sa_sigaction = &OnProfilerSignal;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    utils::CheckSyscall(::sigaction(SIGPROF, &action, nullptr),
+                        "installing the SIGPROF handler");
+    is_signal_handler_installed_ = true;
+  }
+
+  period_ = period;
+  is_running_ = true;
+  for (auto& state : threads_) {
+    StartThreadTimer(*state);
+  }
+  LOG_INFO() << "CPU profiler started on " << threads_.size()
+             << " threads with the period of " << period.count() << "us";
+#endif
+}
+
+void CpuProfiler::Stop() noexcept {
+  const std::lock_guard lock(mutex_);
+  if (!is_running_) return;
+
+#ifdef __linux__
+  for (auto& state : threads_) {
+    if (state->has_timer) {
+      ::timer_delete(state->timer);
+      state->has_timer = false;
+    }
+  }
+#endif
+  is_running_ = false;
+  LOG_INFO() << "CPU profiler stopped";
+}
+
+bool CpuProfiler::IsRunning() const {
+  const std::lock_guard lock(mutex_);
+  return is_running_;
+}
+
+std::chrono::microseconds CpuProfiler::GetPeriod() const {
+  const std::lock_guard lock(mutex_);
+  return period_;
+}
+
+void CpuProfiler::Collect() {
+  const std::lock_guard lock(mutex_);
+  for (auto& state : threads_) {
+    CollectThread(*state);
+  }
+}
+
+std::string CpuProfiler::GetFoldedStacks() {
+  Collect();
+
+  const std::lock_guard lock(mutex_);
+  FrameNames frame_names;
+  std::string result;
+  std::vector<const std::string*> frames;
+
+  for (const auto& [key, count] : stacks_) {
+    const std::string_view key_view = key;
+    const auto first_zero = key_view.find('\0');
+    const auto second_zero = key_view.find('\0', first_zero + 1);
+    UASSERT(second_zero != std::string_view::npos);
+
+    const auto task_processor_name = key_view.substr(0, first_zero);
+    const auto label =
+        key_view.substr(first_zero + 1, second_zero - first_zero - 1);
+    const auto raw_frames = key_view.substr(second_zero + 1);
+
+    frames.clear();
+    for (std::size_t i = 0; i < raw_frames.size() / sizeof(const void*); ++i) {
+      const void* address = nullptr;
+      std::memcpy(&address, raw_frames.data() + i * sizeof(address),
+                  sizeof(address));
+      const auto* name = frame_names.Get(address);
+      if (!name) break;
+      frames.push_back(name);
+    }
+
+    result.append(task_processor_name);
+    result.push_back(';');
+    result.append(label.empty() ? kNoSpan : label);
+    for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+      result.push_back(';');
+      result.append(**it);
+    }
+    fmt::format_to(std::back_inserter(result), " {}\n", count);
+  }
+
+  for (const auto& [task_processor_name, count] : dropped_samples_) {
+    fmt::format_to(std::back_inserter(result), "{};{} {}\n",
+                   task_processor_name, kDroppedSamples, count);
+  }
+
+  return result;
+}
+
+void CpuProfiler::Reset() {
+  Collect();
+
+  const std::lock_guard lock(mutex_);
+  stacks_.clear();
+  dropped_samples_.clear();
+}
+
+void CpuProfiler::StartThreadTimer(ThreadState& state) {
+#ifdef __linux__
+  if (!state.ring_storage) {
+    state.ring_storage = std::make_unique<Sample[]>(kRingSize);
+    state.ring.store(state.ring_storage.get(), std::memory_order_release);
+  }
+
+  if (!state.has_timer) {
+    clockid_t clock{};
+    const int error = ::pthread_getcpuclockid(state.thread, &clock);
+    if (error != 0) {
+      throw std::system_error(error, std::system_category(),
+                              "Error while getting the thread CPU clock");
+    }
+
+    sigevent event{};
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = SIGPROF;
+    event._sigev_un._tid = state.tid;
+    utils::CheckSyscall(::timer_create(clock, &event, &state.timer),
+                        "creating the CPU profiler timer");
+    state.has_timer = true;
+  }
+
+  const auto seconds =
+      std::chrono::duration_cast<std::chrono::seconds>(period_);
+  itimerspec spec{};
+  spec.it_interval.tv_sec = seconds.count();
+  spec.it_interval.tv_nsec =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(period_ - seconds)
+          .count();
+  spec.it_value = spec.it_interval;
+  utils::CheckSyscall(::timer_settime(state.timer, 0, &spec, nullptr),
+                      "arming the CPU profiler timer");
+#else
+  (void)state;
+#endif
+}
+
+void CpuProfiler::CollectThread(ThreadState& state) {
+  auto* const ring = state.ring.load(std::memory_order_acquire);
+  const auto& task_processor_name = *state.task_processor_name;
+
+  if (ring) {
+    const auto head = state.head.load(std::memory_order_acquire);
+    auto tail = state.tail.load(std::memory_order_relaxed);
+    for (; tail != head; ++tail) {
+      auto key = MakeStackKey(task_processor_name, ring[tail % kRingSize]);
+      if (auto it = stacks_.find(key); it != stacks_.end()) {
+        ++it->second;
+      } else if (stacks_.size() < kMaxStacks) {
+        stacks_.emplace(std::move(key), 1);
+      } else {
+        ++dropped_samples_[task_processor_name];
+      }
+    }
+    state.tail.store(tail, std::memory_order_release);
+  }
+
+  const auto dropped = state.dropped.exchange(0, std::memory_order_relaxed);
+  if (dropped != 0) dropped_samples_[task_processor_name] += dropped;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Sampling CPU profiler of the TaskProcessor worker threads.
+//
+// While the profiler is running, each worker thread has a timer on its own CPU
+// time clock that sends SIGPROF to the thread once per `period` of consumed
+// CPU time. The signal handler stores the stack of the thread and the name of
+// the innermost tracing::Span of the running task into a per-thread ring
+// without locks or allocations. Collect() moves the samples from the rings
+// into the aggregated stacks, the rings overflow if it is not called often
+// enough (see the `[dropped samples]` stacks).
+//
+// Only Linux is supported, Start() throws on other platforms.
+class CpuProfiler final {
+ public:
+  struct ThreadState;
+
+  static CpuProfiler& Get();
+
+  CpuProfiler(const CpuProfiler&) = delete;
+  CpuProfiler& operator=(const CpuProfiler&) = delete;
+
+  // Called by the TaskProcessor worker threads, the `task_processor_name`
+  // should outlive the registration
+  void RegisterCurrentThread(const std::string& task_processor_name);
+  void UnregisterCurrentThread() noexcept;
+
+  void Start(std::chrono::microseconds period);
+  void Stop() noexcept;
+  bool IsRunning() const;
+  std::chrono::microseconds GetPeriod() const;
+
+  void Collect();
+
+  // Folded stacks in the format of flamegraph.pl, one per line:
+  // `task_processor;span;outermost_frame;...;innermost_frame count`
+  std::string GetFoldedStacks();
+
+  // Forgets the collected samples
+  void Reset();
+
+ private:
+  CpuProfiler() = default;
+  ~CpuProfiler() = default;
+
+  void StartThreadTimer(ThreadState& state);
+  void CollectThread(ThreadState& state);
+
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<ThreadState>> threads_;
+  std::chrono::microseconds period_{0};
+  bool is_running_{false};
+  bool is_signal_handler_installed_{false};
+
+  // the task processor name, the span name and the frames, see MakeStackKey
+  std::unordered_map<std::string, std::uint64_t> stacks_;
+  std::unordered_map<std::string, std::uint64_t> dropped_samples_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#include <engine/task/cpu_profiler.hpp>
+
+#include <chrono>
+
+#include <fmt/format.h>
+
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kSpanName = "cpu_profiler_test_span";
+
+void BurnCpu(std::chrono::milliseconds duration) {
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+  volatile std::uint64_t counter = 0;
+  while (std::chrono::steady_clock::now() < deadline) {
+    counter = counter + 1;
+  }
+}
+
+}  // namespace
+
+#ifdef __linux__
+
+UTEST(CpuProfiler, SamplesSpanName) {
+  auto& profiler = engine::impl::CpuProfiler::Get();
+  profiler.Reset();
+
+  profiler.Start(std::chrono::milliseconds{1});
+  EXPECT_TRUE(profiler.IsRunning());
+  {
+    tracing::Span span{std::string{kSpanName}};
+    BurnCpu(std::chrono::milliseconds{200});
+  }
+  profiler.Stop();
+  EXPECT_FALSE(profiler.IsRunning());
+
+  const auto stacks = profiler.GetFoldedStacks();
+  EXPECT_NE(stacks.find(fmt::format(";{};", kSpanName)), std::string::npos)
+      << stacks;
+
+  profiler.Reset();
+  EXPECT_EQ(profiler.GetFoldedStacks(), "");
+}
+
+#endif
+
+USERVER_NAMESPACE_END
@@ -127,6 +127,33 @@ UTEST(TaskInheritedVariable, IndependenceFromParentChanges) {
   sub_task.Get();
 }
 
+UTEST(TaskInheritedVariable, IndependenceOfSiblings) {
+  constexpr std::string_view kValue1 = "value1";
+  constexpr std::string_view kNewValue1 = "new_value1";
+
+  engine::SingleConsumerEvent changed;
+  kStringVariable.Emplace(kValue1);
+
+  auto first = utils::Async("first", [&] {
+    kStringVariable.Emplace(kNewValue1);
+    EXPECT_EQ(kStringVariable.Get(), kNewValue1);
+    changed.Send();
+  });
+  auto second = utils::Async("second", [&] {
+    EXPECT_TRUE(changed.WaitForEvent());
+    EXPECT_EQ(kStringVariable.Get(), kValue1);
+
+    // the grandchild shares the variables of its parent only
+    utils::Async("grandchild", [&] {
+      EXPECT_EQ(kStringVariable.Get(), kValue1);
+    }).Get();
+  });
+
+  first.Get();
+  second.Get();
+  EXPECT_EQ(kStringVariable.Get(), kValue1);
+}
+
 UTEST(TaskInheritedVariable, Overwrite) {
   constexpr std::string_view kValue1 = "value1";
   constexpr std::string_view kValue2 = "value2";
@@ -168,9 +168,10 @@ TaskProcessor& GetTaskProcessor() {
 }
 
 std::size_t GetStackSize() {
-  return GetTaskProcessor()
+  auto& context = GetCurrentTaskContext();
+  return context.GetTaskProcessor()
       .GetTaskProcessorPools()
-      ->GetCoroPool()
+      ->GetCoroPool(context.GetStackSizeClass())
       .GetStackSize();
 }
 
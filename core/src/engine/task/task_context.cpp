@@ -1,18 +1,21 @@
 #include "task_context.hpp"
 
 #include <exception>
+#include <typeinfo>
 #include <utility>
 
 #include <fmt/format.h>
 #include <boost/exception/diagnostic_information.hpp>
 
 #include <engine/coro/pool.hpp>
+#include <engine/coro/stack_usage_monitor.hpp>
 #include <logging/log_extra_stacktrace.hpp>
 #include <userver/engine/exception.hpp>
 #include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 #include <userver/utils/underlying_value.hpp>
 
 #include <compiler/tls.hpp>
@@ -102,11 +105,15 @@ auto* const kFinishedDetachedToken =
 
 TaskContext::TaskContext(TaskProcessor& task_processor,
                          Task::Importance importance, Task::WaitMode wait_type,
-                         Deadline deadline,
+                         Deadline deadline, StackSizeClass stack_size_class,
+                         TaskPriority priority,
                          utils::impl::WrappedCallBase& payload)
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      stack_size_class_(stack_size_class),
+      priority_(priority),
+      is_time_accounted_(task_processor_.ShouldAccountTaskTime()),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
@@ -173,7 +180,7 @@ class LockedWaitStrategy final : public WaitStrategy {
  public:
   LockedWaitStrategy(Deadline deadline, GenericWaitList& waiters,
                      TaskContext& current, const TaskContext& target)
-      : WaitStrategy(deadline),
+      : WaitStrategy(deadline, WaitKind::kFuture),
         waiters_(waiters),
         current_(current),
         target_(target) {}
@@ -213,7 +220,8 @@ void TaskContext::DoStep() {
 
   SleepState::Flags clear_flags{SleepFlags::kSleeping};
   if (!coro_) {
-    coro_ = task_processor_.GetCoroutine();
+    coro_ = task_processor_.GetCoroutine(stack_size_class_);
+    StartStackUsageSampling();
     clear_flags |= SleepFlags::kWakeupByBootstrap;
     ArmCancellationTimer();
   }
@@ -235,6 +243,7 @@ void TaskContext::DoStep() {
   switch (yield_reason_) {
     case YieldReason::kTaskCancelled:
     case YieldReason::kTaskComplete: {
+      FinishStackUsageSampling();
       std::move(coro_).ReturnToPool();
       auto new_state = (yield_reason_ == YieldReason::kTaskComplete)
                            ? Task::State::kCompleted
@@ -325,7 +334,9 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy) {
   UASSERT(task_pipe_);
   TraceStateTransition(Task::State::kSuspended);
   ProfilerStopExecution();
+  AccountStoppedRunning(wait_strategy.GetWaitKind());
   [[maybe_unused]] TaskContext* context = (*task_pipe_)().get();
+  AccountStartedRunning();
   ProfilerStartExecution();
   TraceStateTransition(Task::State::kRunning);
   UASSERT(context == this);
@@ -493,6 +504,7 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
     context->yield_reason_ = YieldReason::kNone;
     context->task_pipe_ = &task_pipe;
 
+    context->AccountStartedRunning();
     context->ProfilerStartExecution();
 
     // We only let tasks ran with CriticalAsync enter function body, others
@@ -529,6 +541,7 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
     }
 
     context->ProfilerStopExecution();
+    context->AccountStoppedRunning(WaitKind::kOther);
 
     context->task_pipe_ = nullptr;
   }
@@ -666,6 +679,7 @@ void TaskContext::Schedule() {
   UASSERT(state_ != Task::State::kQueued);
   SetState(Task::State::kQueued);
   TraceStateTransition(Task::State::kQueued);
+  AccountScheduled();
   task_processor_.Schedule(this);
   // NOTE: may be executed at this point
 }
@@ -673,7 +687,7 @@ void TaskContext::Schedule() {
 void TaskContext::ProfilerStartExecution() {
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
-    execute_started_ = std::chrono::steady_clock::now();
+    execute_started_ = utils::impl::FastSteadyNow();
   } else {
     execute_started_ = {};
   }
@@ -688,7 +702,7 @@ void TaskContext::ProfilerStopExecution() {
     return;
   }
 
-  auto now = std::chrono::steady_clock::now();
+  auto now = utils::impl::FastSteadyNow();
   auto duration = now - execute_started_;
   auto duration_us =
       std::chrono::duration_cast<std::chrono::microseconds>(duration);
@@ -705,11 +719,51 @@ void TaskContext::ProfilerStopExecution() {
   }
 }
 
+TaskTimings TaskContext::GetTimings(
+    std::chrono::steady_clock::time_point now) const noexcept {
+  UASSERT(IsCurrent());
+  auto timings = timings_;
+  if (is_time_accounted_ && now > timings_timepoint_) {
+    timings.running += now - timings_timepoint_;
+  }
+  return timings;
+}
+
+// The wait ends when the task is put into the queue, possibly by another
+// thread. The queue synchronizes it with the next AccountStartedRunning.
+void TaskContext::AccountScheduled() noexcept {
+  if (!is_time_accounted_) return;
+
+  const auto now = utils::impl::FastSteadyNow();
+  if (timings_timepoint_ != std::chrono::steady_clock::time_point{}) {
+    timings_.waiting[static_cast<std::size_t>(wait_kind_)] +=
+        now - timings_timepoint_;
+  }
+  timings_timepoint_ = now;
+}
+
+void TaskContext::AccountStartedRunning() noexcept {
+  if (!is_time_accounted_) return;
+
+  const auto now = utils::impl::FastSteadyNow();
+  timings_.queued += now - timings_timepoint_;
+  timings_timepoint_ = now;
+}
+
+void TaskContext::AccountStoppedRunning(WaitKind wait_kind) noexcept {
+  if (!is_time_accounted_) return;
+
+  const auto now = utils::impl::FastSteadyNow();
+  timings_.running += now - timings_timepoint_;
+  timings_timepoint_ = now;
+  wait_kind_ = wait_kind;
+}
+
 void TaskContext::TraceStateTransition(Task::State state) {
   if (trace_csw_left_ == 0) return;
   --trace_csw_left_;
 
-  auto now = std::chrono::steady_clock::now();
+  auto now = utils::impl::FastSteadyNow();
   auto diff = now - last_state_change_timepoint_;
   if (last_state_change_timepoint_ == std::chrono::steady_clock::time_point())
     diff = {};
@@ -734,6 +788,26 @@ void TaskContext::ResetPayload() noexcept {
   std::destroy_at(std::exchange(payload_, nullptr));
 }
 
+void TaskContext::StartStackUsageSampling() noexcept {
+  if (!task_processor_.GetStackUsageMonitor().ShouldSample()) return;
+
+  const auto& stack = coro_.GetStack();
+  coro::StackUsageMonitor::PaintStack(stack.sp, stack.size);
+  is_stack_usage_sampled_ = true;
+}
+
+void TaskContext::FinishStackUsageSampling() {
+  if (!is_stack_usage_sampled_) return;
+  is_stack_usage_sampled_ = false;
+  // The payload is gone if the task was cancelled before it started
+  if (!payload_) return;
+
+  const auto& stack = coro_.GetStack();
+  task_processor_.GetStackUsageMonitor().AccountStackUsage(
+      typeid(*payload_),
+      coro::StackUsageMonitor::MeasureStackUsage(stack.sp, stack.size));
+}
+
 void intrusive_ptr_add_ref(TaskContext* p) noexcept {
   UASSERT(p);
 
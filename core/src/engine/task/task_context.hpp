@@ -16,13 +16,16 @@
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_counter.hpp>
+#include <engine/task/task_timings.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/stack_size_class.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
@@ -52,13 +55,18 @@ class WaitStrategy {
 
   Deadline GetDeadline() const { return deadline_; }
 
+  WaitKind GetWaitKind() const noexcept { return wait_kind_; }
+
  protected:
   ~WaitStrategy() = default;
 
-  constexpr WaitStrategy(Deadline deadline) noexcept : deadline_(deadline) {}
+  constexpr WaitStrategy(Deadline deadline,
+                         WaitKind wait_kind = WaitKind::kOther) noexcept
+      : deadline_(deadline), wait_kind_(wait_kind) {}
 
  private:
   const Deadline deadline_;
+  const WaitKind wait_kind_;
 };
 
 class TaskContext final : public ContextAccessor {
@@ -79,6 +87,7 @@ class TaskContext final : public ContextAccessor {
   };
 
   TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline,
+              StackSizeClass, TaskPriority,
               utils::impl::WrappedCallBase& payload);
 
   ~TaskContext() noexcept;
@@ -100,6 +109,13 @@ class TaskContext final : public ContextAccessor {
   // exceeding these limits causes task to become cancelled
   bool IsCritical() const;
 
+  StackSizeClass GetStackSizeClass() const noexcept {
+    return stack_size_class_;
+  }
+
+  // the task processor queue lane of the task
+  TaskPriority GetPriority() const noexcept { return priority_; }
+
   // whether task is allowed to be awaited from multiple coroutines
   // simultaneously
   bool IsSharedWaitAllowed() const;
@@ -170,6 +186,23 @@ class TaskContext final : public ContextAccessor {
     task_queue_wait_timepoint_ = tp;
   }
 
+  // The name of the innermost tracing::Span of the task, read by the
+  // engine::impl::CpuProfiler from the signal handler
+  const char* GetProfilerLabel() const noexcept {
+    return profiler_label_.load(std::memory_order_acquire);
+  }
+
+  void SetProfilerLabel(const char* label) noexcept {
+    profiler_label_.store(label, std::memory_order_release);
+  }
+
+  bool IsTimeAccounted() const noexcept { return is_time_accounted_; }
+
+  // The timings of the task so far, including the current running slice that
+  // started before `now`. Should be called from the task itself.
+  TaskTimings GetTimings(
+      std::chrono::steady_clock::time_point now) const noexcept;
+
   void SetCancelDeadline(Deadline deadline);
 
   bool HasLocalStorage() const noexcept;
@@ -210,12 +243,23 @@ class TaskContext final : public ContextAccessor {
 
   void TraceStateTransition(Task::State state);
 
+  void AccountScheduled() noexcept;
+  void AccountStartedRunning() noexcept;
+  void AccountStoppedRunning(WaitKind wait_kind) noexcept;
+
   void ResetPayload() noexcept;
 
+  void StartStackUsageSampling() noexcept;
+  void FinishStackUsageSampling();
+
   const uint64_t magic_{kMagic};
   TaskProcessor& task_processor_;
   TaskCounter::Token task_counter_token_;
   const bool is_critical_;
+  const StackSizeClass stack_size_class_;
+  const TaskPriority priority_;
+  const bool is_time_accounted_;
+  bool is_stack_usage_sampled_{false};
   bool is_cancellable_{true};
   bool within_sleep_{false};
   EhGlobals eh_globals_;
@@ -238,6 +282,11 @@ class TaskContext final : public ContextAccessor {
 
   size_t trace_csw_left_;
 
+  // the last change of the task state, if is_time_accounted_
+  std::chrono::steady_clock::time_point timings_timepoint_;
+  WaitKind wait_kind_{WaitKind::kOther};
+  TaskTimings timings_;
+
   AtomicSleepState sleep_state_{
       SleepState{SleepFlags::kSleeping, SleepState::Epoch{0}}};
   WakeupSource wakeup_source_{WakeupSource::kNone};
@@ -248,6 +297,8 @@ class TaskContext final : public ContextAccessor {
 
   std::optional<task_local::Storage> local_storage_{};
 
+  std::atomic<const char*> profiler_label_{nullptr};
+
   // refcounter for task abandoning (cancellation) in engine::SharedTask
   std::atomic<std::size_t> shared_task_usages_{1};
 
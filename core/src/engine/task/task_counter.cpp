@@ -1,11 +1,13 @@
 #include <engine/task/task_counter.hpp>
 
 #include <algorithm>
+#include <mutex>
 #include <thread>
 
 #include <compiler/tls.hpp>
 #include <userver/compiler/impl/constexpr.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +17,11 @@ namespace {
 
 static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
 
+// Bounds the memory for the spans with generated names, the timings of the
+// other spans are accounted under kOtherSpans
+constexpr std::size_t kMaxSpanNamesPerThread = 1000;
+constexpr std::string_view kOtherSpans = "[other]";
+
 using Rate = utils::statistics::Rate;
 
 struct LocalTaskCounterData final {
@@ -32,6 +39,12 @@ GetLocalTaskCounterData() noexcept {
 
 }  // namespace
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const QueueWaitStats& stats) {
+  writer["measured"] = stats.measured;
+  writer["total-time-us"] = stats.total_time_us;
+}
+
 TaskCounter::Token::Token(TaskCounter& counter) noexcept : counter_(counter) {
   counter_.Increment(GlobalCounterId::kCreated);
 }
@@ -59,7 +72,7 @@ TaskCounter::CoroToken& TaskCounter::CoroToken::operator=(
 }
 
 TaskCounter::TaskCounter(std::size_t thread_count)
-    : local_counters_(thread_count) {}
+    : local_counters_(thread_count), local_span_timings_(thread_count) {}
 
 TaskCounter::~TaskCounter() { UASSERT(!MayHaveTasksAlive()); }
 
@@ -127,6 +140,16 @@ Rate TaskCounter::GetSpuriousWakeups() const noexcept {
   return GetApproximate(LocalCounterId::kSpuriousWakeups);
 }
 
+QueueWaitStats TaskCounter::GetQueueWaitStats(
+    TaskPriority priority) const noexcept {
+  if (priority == TaskPriority::kHigh) {
+    return {GetApproximate(LocalCounterId::kHighPriorityQueueWaitMeasured),
+            GetApproximate(LocalCounterId::kHighPriorityQueueWaitTimeUs)};
+  }
+  return {GetApproximate(LocalCounterId::kNormalPriorityQueueWaitMeasured),
+          GetApproximate(LocalCounterId::kNormalPriorityQueueWaitTimeUs)};
+}
+
 void TaskCounter::AccountTaskCancel() noexcept {
   Increment(LocalCounterId::kCancelled);
 }
@@ -159,6 +182,54 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountQueueWait(
+    TaskPriority priority, std::chrono::microseconds wait_time) noexcept {
+  const Rate wait_time_us{static_cast<Rate::ValueType>(wait_time.count())};
+  if (priority == TaskPriority::kHigh) {
+    Increment(LocalCounterId::kHighPriorityQueueWaitMeasured);
+    Add(LocalCounterId::kHighPriorityQueueWaitTimeUs, wait_time_us);
+  } else {
+    Increment(LocalCounterId::kNormalPriorityQueueWaitMeasured);
+    Add(LocalCounterId::kNormalPriorityQueueWaitTimeUs, wait_time_us);
+  }
+}
+
+void TaskCounter::AccountSpanTimings(std::string_view span_name,
+                                     const TaskTimings& timings) {
+  const auto local_data = GetLocalTaskCounterData();
+  // The spans are accounted by their own tasks, so the thread always belongs
+  // to this task processor
+  UASSERT(local_data.local_counter == this);
+  const auto index = (local_data.local_counter == this)
+                         ? local_data.task_processor_thread_index
+                         : 0;
+  auto& local = *local_span_timings_[index];
+
+  const std::lock_guard lock(local.mutex);
+  auto it = utils::impl::FindTransparent(local.timings, span_name);
+  if (it == local.timings.end()) {
+    if (local.timings.size() >= kMaxSpanNamesPerThread) {
+      span_name = kOtherSpans;
+      it = utils::impl::FindTransparent(local.timings, span_name);
+    }
+    if (it == local.timings.end()) {
+      it = local.timings.emplace(std::string{span_name}, TaskTimings{}).first;
+    }
+  }
+  it->second += timings;
+}
+
+TaskCounter::SpanTimings TaskCounter::GetSpanTimings() const {
+  SpanTimings result;
+  for (const auto& local : local_span_timings_) {
+    const std::lock_guard lock(local->mutex);
+    for (const auto& [name, timings] : local->timings) {
+      result[name] += timings;
+    }
+  }
+  return result;
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -168,27 +239,31 @@ Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
 }
 
 Rate TaskCounter::GetApproximate(GlobalCounterId id) const noexcept {
-  return Rate{global_counters_[static_cast<std::size_t>(id)]->Load()} +
+  return global_counters_[static_cast<std::size_t>(id)].Load() +
          GetApproximate(static_cast<LocalCounterId>(id));
 }
 
-void TaskCounter::Increment(LocalCounterId id) noexcept {
+void TaskCounter::Increment(LocalCounterId id) noexcept { Add(id, Rate{1}); }
+
+void TaskCounter::Add(LocalCounterId id, Rate value) noexcept {
   const auto local_data = GetLocalTaskCounterData();
   UASSERT(local_data.local_counter == this);
   auto& counter = (*local_counters_[local_data.task_processor_thread_index])
       [static_cast<std::size_t>(id)];
-  counter.Store(counter.Load() + Rate{1});
+  counter.Store(counter.Load() + value);
 }
 
 void TaskCounter::Increment(GlobalCounterId id) noexcept {
   const auto local_data = GetLocalTaskCounterData();
-  auto& counter =
-      (local_data.local_counter == this)
-          ? (*local_counters_[local_data.task_processor_thread_index])
-                [static_cast<std::size_t>(id)]
-          : *global_counters_[static_cast<std::size_t>(id)];
   // seq_cst synchronizes-with MayHaveTasksAlive.
-  counter.Add(Rate{1}, std::memory_order_seq_cst);
+  if (local_data.local_counter == this) {
+    (*local_counters_[local_data.task_processor_thread_index])
+        [static_cast<std::size_t>(id)]
+            .Add(Rate{1}, std::memory_order_seq_cst);
+  } else {
+    global_counters_[static_cast<std::size_t>(id)].Add(
+        Rate{1}, std::memory_order_seq_cst);
+  }
 }
 
 void SetLocalTaskCounterData(TaskCounter& counter, std::size_t thread_id) {
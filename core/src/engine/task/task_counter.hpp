@@ -5,15 +5,34 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
 
-#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/task_timings.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+// Queue wait times of a task processor queue lane. The time is measured for
+// some of the tasks only, see TaskProcessor::Schedule.
+struct QueueWaitStats final {
+  // Tasks the queue wait time was measured for
+  utils::statistics::Rate measured;
+  // Total queue wait time of the measured tasks
+  utils::statistics::Rate total_time_us;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const QueueWaitStats& stats);
+
 class TaskCounter final {
   using Rate = utils::statistics::Rate;
 
@@ -21,6 +40,8 @@ class TaskCounter final {
   class Token;
   class CoroToken;
 
+  using SpanTimings = utils::impl::TransparentMap<std::string, TaskTimings>;
+
   explicit TaskCounter(std::size_t thread_count);
 
   ~TaskCounter();
@@ -55,6 +76,8 @@ class TaskCounter final {
 
   Rate GetSpuriousWakeups() const noexcept;
 
+  QueueWaitStats GetQueueWaitStats(TaskPriority priority) const noexcept;
+
   void AccountTaskCancel() noexcept;
 
   void AccountTaskCancelOverload() noexcept;
@@ -71,6 +94,16 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  void AccountQueueWait(TaskPriority priority,
+                        std::chrono::microseconds wait_time) noexcept;
+
+  // Adds the TaskTimings of a finished span, called by the task of the span
+  void AccountSpanTimings(std::string_view span_name,
+                          const TaskTimings& timings);
+
+  // The totals of the finished spans by span name
+  SpanTimings GetSpanTimings() const;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -95,6 +128,10 @@ class TaskCounter final {
     kOverload,
     kOverloadSensor,
     kNoOverloadSensor,
+    kNormalPriorityQueueWaitMeasured,
+    kNormalPriorityQueueWaitTimeUs,
+    kHighPriorityQueueWaitMeasured,
+    kHighPriorityQueueWaitTimeUs,
 
     kCountersSize,
   };
@@ -109,9 +146,10 @@ class TaskCounter final {
   using LocalCounterPack = concurrent::impl::InterferenceShield<
       std::array<Counter, kLocalCountersSize>>;
 
+  // Tasks of other TaskProcessors and of non-worker threads are accounted
+  // here, the counters are sharded to not serialize the threads on them
   using GlobalCounterPack =
-      std::array<concurrent::impl::InterferenceShield<Counter>,
-                 kGlobalCountersSize>;
+      std::array<utils::statistics::ShardedRateCounter, kGlobalCountersSize>;
 
   Rate GetApproximate(LocalCounterId) const noexcept;
 
@@ -119,10 +157,20 @@ class TaskCounter final {
 
   void Increment(LocalCounterId) noexcept;
 
+  void Add(LocalCounterId, Rate) noexcept;
+
   void Increment(GlobalCounterId) noexcept;
 
+  // The mutex is contended only by the statistics collection
+  struct LocalSpanTimings final {
+    mutable std::mutex mutex;
+    SpanTimings timings;
+  };
+
   GlobalCounterPack global_counters_;
   utils::FixedArray<LocalCounterPack> local_counters_;
+  utils::FixedArray<concurrent::impl::InterferenceShield<LocalSpanTimings>>
+      local_span_timings_;
 };
 
 class TaskCounter::Token final {
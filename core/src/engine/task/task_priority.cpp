@@ -0,0 +1,31 @@
+#include <userver/engine/task/task_priority.hpp>
+
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr utils::TrivialBiMap kTaskPriorityMap([](auto selector) {
+  return selector()
+      .Case(TaskPriority::kNormal, "normal")
+      .Case(TaskPriority::kHigh, "high");
+});
+
+}  // namespace
+
+std::string_view ToString(TaskPriority priority) noexcept {
+  return kTaskPriorityMap.TryFind(priority).value_or("unknown");
+}
+
+TaskPriority Parse(const yaml_config::YamlConfig& value,
+                   formats::parse::To<TaskPriority>) {
+  return utils::ParseFromValueString(value, kTaskPriorityMap);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
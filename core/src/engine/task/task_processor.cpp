@@ -8,14 +8,17 @@
 #include <concurrent/impl/latch.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
+#include <engine/task/cpu_profiler.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -27,7 +30,7 @@ void SetTaskQueueWaitTimepoint(impl::TaskContext* context) {
   thread_local size_t task_count = 0;
   if (task_count++ == kTaskTimestampInterval) {
     task_count = 0;
-    context->SetQueueWaitTimepoint(std::chrono::steady_clock::now());
+    context->SetQueueWaitTimepoint(utils::impl::FastSteadyNow());
   } else {
     /* Don't call clock_gettime() too often.
      * This leads to killing some innocent tasks on overload, up to
@@ -53,6 +56,19 @@ void EmitMagicNanosleep() {
   nanosleep(&ts, nullptr);
 }
 
+std::variant<TaskQueue, WorkStealingTaskQueue> MakeTaskQueue(
+    const TaskProcessorConfig& config) {
+  switch (config.task_queue) {
+    case TaskQueueType::kGlobalTaskQueue:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<TaskQueue>, config};
+    case TaskQueueType::kWorkStealingTaskQueue:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<WorkStealingTaskQueue>, config};
+  }
+  UINVARIANT(false, "Unexpected value of task_queue");
+}
+
 void TaskProcessorThreadStartedHook() {
   utils::impl::AssertStaticRegistrationFinished();
   (void)utils::DefaultRandom();
@@ -62,27 +78,70 @@ void TaskProcessorThreadStartedHook() {
   EmitMagicNanosleep();
 }
 
+std::vector<unsigned> MakeJemallocArenas(const TaskProcessorConfig& config) {
+  std::vector<unsigned> arenas;
+  arenas.reserve(config.jemalloc_arenas);
+  for (std::size_t i = 0; i < config.jemalloc_arenas; ++i) {
+    unsigned arena = 0;
+    const auto ec = utils::jemalloc::CreateArena(arena);
+    if (ec) {
+      LOG_WARNING() << "Failed to create a jemalloc arena for task_processor "
+                    << config.name << ": " << ec.message();
+      break;
+    }
+    arenas.push_back(arena);
+  }
+  return arenas;
+}
+
+void SetUpJemalloc(const TaskProcessorConfig& config,
+                   const std::vector<unsigned>& arenas,
+                   std::size_t index) noexcept {
+  if (config.jemalloc_tcache) {
+    const auto ec = utils::jemalloc::SetThreadTcacheEnabled(
+        *config.jemalloc_tcache);
+    if (ec) {
+      LOG_WARNING() << "Failed to set up the jemalloc tcache of task_processor "
+                    << config.name << ": " << ec.message();
+    }
+  }
+  if (!arenas.empty()) {
+    const auto ec =
+        utils::jemalloc::SetThreadArena(arenas[index % arenas.size()]);
+    if (ec) {
+      LOG_WARNING() << "Failed to set up the jemalloc arena of task_processor "
+                    << config.name << ": " << ec.message();
+    }
+  }
+}
+
 }  // namespace
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_counter_(config.worker_threads),
-      task_queue_(config),
+      task_queue_(MakeTaskQueue(config)),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      pools_(std::move(pools)),
+      jemalloc_arenas_(MakeJemallocArenas(config_)) {
   utils::impl::FinishStaticRegistration();
   try {
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
-               << " thread_name=" << config_.thread_name;
+               << " thread_name=" << config_.thread_name
+               << " work_stealing="
+               << std::holds_alternative<WorkStealingTaskQueue>(task_queue_);
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
     for (size_t i = 0; i < config_.worker_threads; ++i) {
       workers_.emplace_back([this, i, &workers_left] {
         PrepareWorkerThread(i);
+        impl::CpuProfiler::Get().RegisterCurrentThread(config_.name);
         workers_left.count_down();
-        ProcessTasks();
+        std::visit([this](auto& queue) { ProcessTasks(queue); },
+                   task_queue_);
+        impl::CpuProfiler::Get().UnregisterCurrentThread();
       });
     }
     workers_left.wait();
@@ -100,7 +159,7 @@ void TaskProcessor::Cleanup() noexcept {
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustion();
 
-  task_queue_.StopProcessing();
+  std::visit([](auto& queue) { queue.StopProcessing(); }, task_queue_);
 
   for (auto& w : workers_) {
     w.join();
@@ -131,7 +190,18 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
 
   SetTaskQueueWaitTimepoint(context);
 
-  task_queue_.Push(context);
+  std::visit([context](auto& queue) { queue.Push(context); }, task_queue_);
+}
+
+size_t TaskProcessor::GetTaskQueueSize() const {
+  return std::visit(
+      [](const auto& queue) { return queue.GetSizeApproximate(); },
+      task_queue_);
+}
+
+const WorkStealingTaskQueue* TaskProcessor::GetWorkStealingTaskQueue()
+    const noexcept {
+  return std::get_if<WorkStealingTaskQueue>(&task_queue_);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
@@ -142,8 +212,13 @@ ev::ThreadPool& TaskProcessor::EventThreadPool() {
   return pools_->EventThreadPool();
 }
 
-impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() {
-  return {pools_->GetCoroPool().GetCoroutine(), *this};
+impl::CountedCoroutinePtr TaskProcessor::GetCoroutine(
+    StackSizeClass stack_size_class) {
+  return {pools_->GetCoroPool(stack_size_class).GetCoroutine(), *this};
+}
+
+coro::StackUsageMonitor& TaskProcessor::GetStackUsageMonitor() {
+  return pools_->GetStackUsageMonitor();
 }
 
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
@@ -230,15 +305,21 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
   }
 
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
+  SetCurrentThreadCpuAffinity(config_.cpu_affinity, index);
+  SetUpJemalloc(config_, jemalloc_arenas_, index);
 
   impl::SetLocalTaskCounterData(task_counter_, index);
+  if (auto* queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+    queue->PrepareWorker(index);
+  }
 
   TaskProcessorThreadStartedHook();
 }
 
-void TaskProcessor::ProcessTasks() noexcept {
+template <typename TaskQueueImpl>
+void TaskProcessor::ProcessTasks(TaskQueueImpl& task_queue) noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto context = task_queue.PopBlocking();
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
@@ -262,14 +343,21 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
   const auto max_wait_time = max_task_queue_wait_time_.load();
   const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
+  const auto wait_timepoint = context.GetQueueWaitTimepoint();
+  std::chrono::steady_clock::duration wait_time{};
+  if (wait_timepoint != std::chrono::steady_clock::time_point()) {
+    wait_time = utils::impl::FastSteadyNow() - wait_timepoint;
+    GetTaskCounter().AccountQueueWait(
+        context.GetPriority(),
+        std::chrono::duration_cast<std::chrono::microseconds>(wait_time));
+  }
+
   if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
     SetTaskQueueWaitTimeOverloaded(false);
     return;
   }
 
-  const auto wait_timepoint = context.GetQueueWaitTimepoint();
   if (wait_timepoint != std::chrono::steady_clock::time_point()) {
-    const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
     const auto wait_time_us =
         std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
     LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
@@ -5,15 +5,18 @@
 #include <functional>
 #include <memory>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
-#include <concurrent/impl/interference_shield.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/work_stealing_task_queue.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
+#include <userver/engine/task/stack_size_class.hpp>
 #include <userver/logging/logger.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -26,6 +29,10 @@ class TaskProcessorPools;
 class CountedCoroutinePtr;
 }  // namespace impl
 
+namespace coro {
+class StackUsageMonitor;
+}  // namespace coro
+
 namespace ev {
 class ThreadPool;
 }  // namespace ev
@@ -41,7 +48,9 @@ class TaskProcessor final {
 
   void Adopt(impl::TaskContext& context);
 
-  impl::CountedCoroutinePtr GetCoroutine();
+  impl::CountedCoroutinePtr GetCoroutine(StackSizeClass stack_size_class);
+
+  coro::StackUsageMonitor& GetStackUsageMonitor();
 
   ev::ThreadPool& EventThreadPool();
 
@@ -55,7 +64,10 @@ class TaskProcessor final {
 
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
-  size_t GetTaskQueueSize() const { return task_queue_.GetSizeApproximate(); }
+  size_t GetTaskQueueSize() const;
+
+  // Returns nullptr unless the work-stealing task queue is used
+  const WorkStealingTaskQueue* GetWorkStealingTaskQueue() const noexcept;
 
   size_t GetWorkerCount() const { return workers_.size(); }
 
@@ -65,6 +77,15 @@ class TaskProcessor final {
 
   bool ShouldProfilerForceStacktrace() const;
 
+  bool ShouldAccountTaskTime() const noexcept {
+    return config_.task_time_accounting;
+  }
+
+  // Returns the jemalloc arenas dedicated to the worker threads
+  const std::vector<unsigned>& GetJemallocArenas() const noexcept {
+    return jemalloc_arenas_;
+  }
+
   size_t GetTaskTraceMaxCswForNewTask() const;
 
   const std::string& GetTaskTraceLoggerName() const;
@@ -78,7 +99,8 @@ class TaskProcessor final {
 
   void PrepareWorkerThread(std::size_t index) noexcept;
 
-  void ProcessTasks() noexcept;
+  template <typename TaskQueueImpl>
+  void ProcessTasks(TaskQueueImpl& task_queue) noexcept;
 
   void CheckWaitTime(impl::TaskContext& context);
 
@@ -91,10 +113,11 @@ class TaskProcessor final {
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<std::atomic<bool>>
       task_queue_wait_time_overloaded_{false};
-  TaskQueue task_queue_;
+  std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  const std::vector<unsigned> jemalloc_arenas_;
   std::vector<std::thread> workers_;
   logging::LoggerPtr task_trace_logger_{nullptr};
 
@@ -24,6 +24,18 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TaskQueueType::kGlobalTaskQueue, "global-task-queue")
+        .Case(TaskQueueType::kWorkStealingTaskQueue,
+              "work-stealing-task-queue");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
@@ -35,6 +47,22 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.task_queue =
+      value["task-processor-queue"].As<TaskQueueType>(config.task_queue);
+  config.high_priority_weight = value["high-priority-weight"].As<std::size_t>(
+      config.high_priority_weight);
+  config.cpu_affinity =
+      value["cpu-affinity"].As<CpuAffinityConfig>(config.cpu_affinity);
+
+  config.task_time_accounting =
+      value["task-time-accounting"].As<bool>(config.task_time_accounting);
+
+  const auto jemalloc = value["jemalloc"];
+  if (!jemalloc.IsMissing()) {
+    config.jemalloc_tcache = jemalloc["tcache"].As<std::optional<bool>>();
+    config.jemalloc_arenas =
+        jemalloc["arenas"].As<std::size_t>(config.jemalloc_arenas);
+  }
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
@@ -3,8 +3,10 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 
+#include <engine/cpu_affinity.hpp>
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
@@ -21,6 +23,14 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobalTaskQueue,
+  kWorkStealingTaskQueue,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,11 +39,21 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{10000};
+  TaskQueueType task_queue{TaskQueueType::kGlobalTaskQueue};
+  std::size_t high_priority_weight{8};
+  CpuAffinityConfig cpu_affinity;
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
   std::string task_trace_logger_name;
 
+  bool task_time_accounting{false};
+
+  // jemalloc tuning of the worker threads, the allocator defaults if not set
+  std::optional<bool> jemalloc_tcache;
+  // number of arenas the worker threads allocate from, 0 for the shared ones
+  std::size_t jemalloc_arenas{0};
+
   void SetName(const std::string& new_name);
 };
 
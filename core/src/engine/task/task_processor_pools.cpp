@@ -10,11 +10,38 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+coro::PoolConfig MakeStackSizeClassConfig(const coro::PoolConfig& config,
+                                          std::size_t stack_size) {
+  auto result = config;
+  result.stack_size = stack_size;
+  // Only the default stack size class is preallocated
+  result.initial_size = 0;
+  return result;
+}
+
+}  // namespace
+
 TaskProcessorPools::TaskProcessorPools(coro::PoolConfig coro_pool_config,
                                        ev::ThreadPoolConfig ev_pool_config)
-    : coro_pool_(std::move(coro_pool_config), &TaskContext::CoroFunc),
+    : coro_pool_(coro_pool_config, &TaskContext::CoroFunc),
+      stack_usage_monitor_(coro_pool_config.stack_usage_sampling_period),
       event_thread_pool_(std::move(ev_pool_config),
                          ev::ThreadPool::kUseDefaultEvLoop) {
+  if (coro_pool_config.small_stack_size != 0) {
+    small_coro_pool_.emplace(
+        MakeStackSizeClassConfig(coro_pool_config,
+                                 coro_pool_config.small_stack_size),
+        &TaskContext::CoroFunc);
+  }
+  if (coro_pool_config.large_stack_size != 0) {
+    large_coro_pool_.emplace(
+        MakeStackSizeClassConfig(coro_pool_config,
+                                 coro_pool_config.large_stack_size),
+        &TaskContext::CoroFunc);
+  }
+
   const bool old_value =
       std::exchange(logging::impl::has_background_threads_which_can_log, true);
   UASSERT_MSG(!old_value,
@@ -28,6 +55,28 @@ TaskProcessorPools::~TaskProcessorPools() {
   UASSERT(old_value);
 }
 
+TaskProcessorPools::CoroPool& TaskProcessorPools::GetCoroPool(
+    StackSizeClass stack_size_class) {
+  switch (stack_size_class) {
+    case StackSizeClass::kDefault:
+      break;
+    case StackSizeClass::kSmall:
+      if (small_coro_pool_) return *small_coro_pool_;
+      break;
+    case StackSizeClass::kLarge:
+      if (large_coro_pool_) return *large_coro_pool_;
+      break;
+  }
+  return coro_pool_;
+}
+
+coro::PoolStats TaskProcessorPools::GetCoroPoolStats() const {
+  auto stats = coro_pool_.GetStats();
+  if (small_coro_pool_) stats += small_coro_pool_->GetStats();
+  if (large_coro_pool_) stats += large_coro_pool_->GetStats();
+  return stats;
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
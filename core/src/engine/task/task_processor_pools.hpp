@@ -1,7 +1,11 @@
 #pragma once
 
+#include <optional>
+
 #include <engine/coro/pool.hpp>
+#include <engine/coro/stack_usage_monitor.hpp>
 #include <engine/ev/thread_pool.hpp>
+#include <userver/engine/task/stack_size_class.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,11 +22,24 @@ class TaskProcessorPools final {
 
   ~TaskProcessorPools();
 
-  CoroPool& GetCoroPool() { return coro_pool_; }
+  // Falls back to the default pool if the class is not configured
+  CoroPool& GetCoroPool(
+      StackSizeClass stack_size_class = StackSizeClass::kDefault);
+
+  // Summed up over the pools of all the stack size classes
+  coro::PoolStats GetCoroPoolStats() const;
+
+  coro::StackUsageMonitor& GetStackUsageMonitor() {
+    return stack_usage_monitor_;
+  }
+
   ev::ThreadPool& EventThreadPool() { return event_thread_pool_; }
 
  private:
   CoroPool coro_pool_;
+  std::optional<CoroPool> small_coro_pool_;
+  std::optional<CoroPool> large_coro_pool_;
+  coro::StackUsageMonitor stack_usage_monitor_;
   ev::ThreadPool event_thread_pool_;
 };
 
@@ -10,51 +10,77 @@ namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
 }
 
+TaskQueue::Consumer::Consumer(TaskQueue& queue)
+    : normal_token(queue.normal_lane_), high_token(queue.high_lane_) {}
+
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations),
+      high_priority_weight_(config.high_priority_weight) {
+  UASSERT(high_priority_weight_ > 0);
+}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
-  DoPush(context.get());
+  DoPush(context.get(), context->GetPriority());
   context.detach();
 }
 
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
   // Current thread handles only a single TaskProcessor, so it's safe to store
-  // a token for the task processor in a thread-local variable.
-  thread_local moodycamel::ConsumerToken token(queue_);
+  // the tokens for the task processor in a thread-local variable.
+  thread_local Consumer consumer(*this);
 
-  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(token),
+  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(consumer),
                                                   /* add_ref= */ false};
 
   if (!context) {
     // return "stop" token back
-    DoPush(nullptr);
+    DoPush(nullptr, TaskPriority::kNormal);
   }
 
   return context;
 }
 
-void TaskQueue::StopProcessing() { DoPush(nullptr); }
+void TaskQueue::StopProcessing() { DoPush(nullptr, TaskPriority::kNormal); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept {
-  return queue_.size_approx();
+  return normal_lane_.size_approx() + high_lane_.size_approx();
 }
 
-void TaskQueue::DoPush(impl::TaskContext* context) {
+void TaskQueue::DoPush(impl::TaskContext* context, TaskPriority priority) {
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::enqueue
-  queue_.enqueue(context);
+  auto& lane = (priority == TaskPriority::kHigh) ? high_lane_ : normal_lane_;
+  lane.enqueue(context);
   queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+impl::TaskContext* TaskQueue::DoPopBlocking(Consumer& consumer) {
   impl::TaskContext* context{};
 
-  // This piece of code is copy-pasted from
-  // moodycamel::BlockingConcurrentQueue::wait_dequeue
+  // The semaphore counts the tasks of both lanes, so after a successful wait
+  // one of the lanes has a task for us
   queue_semaphore_.wait();
-  while (!queue_.try_dequeue(token, context)) {
+
+  const auto try_pop_high = [&] {
+    if (!high_lane_.try_dequeue(consumer.high_token, context)) return false;
+    ++consumer.high_priority_in_row;
+    return true;
+  };
+  const auto try_pop_normal = [&] {
+    if (!normal_lane_.try_dequeue(consumer.normal_token, context)) {
+      return false;
+    }
+    consumer.high_priority_in_row = 0;
+    return true;
+  };
+
+  while (true) {
+    if (consumer.high_priority_in_row < high_priority_weight_) {
+      if (try_pop_high() || try_pop_normal()) break;
+    } else {
+      if (try_pop_normal() || try_pop_high()) break;
+    }
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
   }
@@ -5,6 +5,7 @@
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task_priority.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,6 +15,10 @@ namespace impl {
 class TaskContext;
 }  // namespace impl
 
+// Keeps the tasks of each TaskPriority in a separate lane. The workers take
+// the tasks of the high priority lane first, but after
+// `high_priority_weight` of them in a row a worker prefers the normal lane
+// once, so that the normal tasks are never starved.
 class TaskQueue final {
  public:
   explicit TaskQueue(const TaskProcessorConfig& config);
@@ -28,12 +33,24 @@ class TaskQueue final {
   std::size_t GetSizeApproximate() const noexcept;
 
  private:
-  void DoPush(impl::TaskContext* context);
+  using Lane = moodycamel::ConcurrentQueue<impl::TaskContext*>;
 
-  impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+  struct Consumer final {
+    explicit Consumer(TaskQueue& queue);
 
-  moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+    moodycamel::ConsumerToken normal_token;
+    moodycamel::ConsumerToken high_token;
+    std::size_t high_priority_in_row{0};
+  };
+
+  void DoPush(impl::TaskContext* context, TaskPriority priority);
+
+  impl::TaskContext* DoPopBlocking(Consumer& consumer);
+
+  Lane normal_lane_;
+  Lane high_lane_;
   moodycamel::LightweightSemaphore queue_semaphore_;
+  const std::size_t high_priority_weight_;
 };
 
 }  // namespace engine
@@ -0,0 +1,83 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::TaskProcessorConfig MakeSingleWorkerConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "task-queue-test";
+  config.thread_name = "tq-worker";
+  config.worker_threads = 1;
+  config.high_priority_weight = 2;
+  return config;
+}
+
+}  // namespace
+
+UTEST(TaskQueue, HighPriorityFirstWithoutStarvation) {
+  engine::TaskProcessor task_processor{
+      MakeSingleWorkerConfig(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  // Occupies the only worker until all the tasks are queued
+  std::atomic<bool> is_released{false};
+  auto blocker = engine::AsyncNoSpan(task_processor, [&is_released] {
+    while (!is_released) {
+    }
+  });
+
+  std::string order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor,
+                                        engine::TaskPriority::kNormal,
+                                        [&order] { order += 'N'; }));
+  }
+  for (int i = 0; i < 6; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor,
+                                        engine::TaskPriority::kHigh,
+                                        [&order] { order += 'H'; }));
+  }
+
+  is_released = true;
+  blocker.Get();
+  engine::WaitAllChecked(tasks);
+
+  EXPECT_EQ(order, "HHNHHNHHN");
+
+  // The queue wait time is measured for some of the tasks only
+  const auto& counter = task_processor.GetTaskCounter();
+  const auto normal = counter.GetQueueWaitStats(engine::TaskPriority::kNormal);
+  const auto high = counter.GetQueueWaitStats(engine::TaskPriority::kHigh);
+  EXPECT_GT(normal.measured.value + high.measured.value, 0u);
+}
+
+UTEST(TaskQueue, OnlyHighPriority) {
+  engine::TaskProcessor task_processor{
+      MakeSingleWorkerConfig(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  constexpr int kTasksCount = 100;
+  std::vector<engine::TaskWithResult<int>> tasks;
+  tasks.reserve(kTasksCount);
+  for (int i = 0; i < kTasksCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(
+        task_processor, engine::TaskPriority::kHigh, [i] { return i; }));
+  }
+  for (int i = 0; i < kTasksCount; ++i) {
+    EXPECT_EQ(tasks[i].Get(), i);
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -301,6 +301,24 @@ TEST(Task, CoroStackSizeSet) {
   });
 }
 
+TEST(Task, CoroStackSizeClasses) {
+  engine::TaskProcessorPoolsConfig config{};
+  config.coro_stack_size = 128 * 1024;
+  config.large_coro_stack_size = 512 * 1024;
+  engine::RunStandalone(1, config, []() {
+    EXPECT_EQ(engine::current_task::GetStackSize(), 128 * 1024);
+    EXPECT_EQ(engine::AsyncNoSpan(engine::StackSizeClass::kLarge, [] {
+                return engine::current_task::GetStackSize();
+              }).Get(),
+              512 * 1024);
+    // Not configured, falls back to the default stack size
+    EXPECT_EQ(engine::AsyncNoSpan(engine::StackSizeClass::kSmall, [] {
+                return engine::current_task::GetStackSize();
+              }).Get(),
+              128 * 1024);
+  });
+}
+
 // ASAN has issues with stacks of more than ~4MB, so we use 3MB stacks here
 TEST(Task, UseMediumStack) {
   engine::TaskProcessorPoolsConfig config{};
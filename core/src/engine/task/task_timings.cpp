@@ -0,0 +1,69 @@
+#include <engine/task/task_timings.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+std::int64_t ToMicroseconds(std::chrono::nanoseconds duration) noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+std::string_view ToString(WaitKind kind) noexcept {
+  switch (kind) {
+    case WaitKind::kOther:
+      return "other";
+    case WaitKind::kSleep:
+      return "sleep";
+    case WaitKind::kMutex:
+      return "mutex";
+    case WaitKind::kFuture:
+      return "future";
+    case WaitKind::kIo:
+      return "io";
+    case WaitKind::kCount:
+      break;
+  }
+
+  UASSERT_MSG(false, "Invalid WaitKind");
+  return "unknown";
+}
+
+TaskTimings& TaskTimings::operator+=(const TaskTimings& other) noexcept {
+  running += other.running;
+  queued += other.queued;
+  for (std::size_t i = 0; i < kWaitKindCount; ++i) {
+    waiting[i] += other.waiting[i];
+  }
+  return *this;
+}
+
+TaskTimings& TaskTimings::operator-=(const TaskTimings& other) noexcept {
+  running -= other.running;
+  queued -= other.queued;
+  for (std::size_t i = 0; i < kWaitKindCount; ++i) {
+    waiting[i] -= other.waiting[i];
+  }
+  return *this;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const TaskTimings& timings) {
+  writer["running-us"] = ToMicroseconds(timings.running);
+  writer["queued-us"] = ToMicroseconds(timings.queued);
+  for (std::size_t i = 0; i < kWaitKindCount; ++i) {
+    writer["waiting-us"].ValueWithLabels(
+        ToMicroseconds(timings.waiting[i]),
+        {"wait_kind", ToString(static_cast<WaitKind>(i))});
+  }
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
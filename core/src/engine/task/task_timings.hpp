@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// What a sleeping task waits for, reported by the WaitStrategy
+enum class WaitKind : std::uint8_t {
+  kOther,
+  kSleep,   // engine::SleepFor and engine::SleepUntil
+  kMutex,   // mutexes and semaphores
+  kFuture,  // tasks and futures
+  kIo,      // sockets, pipes and other file descriptors
+
+  kCount,
+};
+
+inline constexpr auto kWaitKindCount =
+    static_cast<std::size_t>(WaitKind::kCount);
+
+std::string_view ToString(WaitKind kind) noexcept;
+
+// Where the time of a task goes: running on a worker thread, waiting in the
+// task queue and sleeping on each kind of wait. Collected only if the
+// `task-time-accounting` option of the TaskProcessor is enabled.
+struct TaskTimings final {
+  std::chrono::nanoseconds running{0};
+  std::chrono::nanoseconds queued{0};
+  std::array<std::chrono::nanoseconds, kWaitKindCount> waiting{};
+
+  TaskTimings& operator+=(const TaskTimings& other) noexcept;
+  TaskTimings& operator-=(const TaskTimings& other) noexcept;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const TaskTimings& timings);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
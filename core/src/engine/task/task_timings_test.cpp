@@ -0,0 +1,88 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <engine/task/task_timings.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kSleepTime{20};
+
+engine::TaskProcessorConfig MakeTimeAccountingConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "time-accounting";
+  config.thread_name = "ta-worker";
+  config.worker_threads = 2;
+  config.task_time_accounting = true;
+  return config;
+}
+
+std::chrono::nanoseconds GetWaiting(const engine::impl::TaskTimings& timings,
+                                    engine::impl::WaitKind kind) {
+  return timings.waiting[static_cast<std::size_t>(kind)];
+}
+
+}  // namespace
+
+UTEST(TaskTimings, PerSpanName) {
+  engine::TaskProcessor task_processor{
+      MakeTimeAccountingConfig(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  engine::Mutex mutex;
+  std::unique_lock lock{mutex};
+
+  auto task = engine::AsyncNoSpan(task_processor, [&mutex] {
+    {
+      tracing::Span span{"locking"};
+      const std::lock_guard lock{mutex};
+    }
+    {
+      tracing::Span span{"sleeping"};
+      engine::SleepFor(kSleepTime);
+    }
+  });
+  engine::SleepFor(kSleepTime);
+  lock.unlock();
+  task.Get();
+
+  const auto span_timings = task_processor.GetTaskCounter().GetSpanTimings();
+
+  const auto sleeping = span_timings.find("sleeping");
+  ASSERT_NE(sleeping, span_timings.end());
+  EXPECT_GE(GetWaiting(sleeping->second, engine::impl::WaitKind::kSleep),
+            kSleepTime);
+  EXPECT_GT(sleeping->second.running.count(), 0);
+
+  const auto locking = span_timings.find("locking");
+  ASSERT_NE(locking, span_timings.end());
+  EXPECT_GT(GetWaiting(locking->second, engine::impl::WaitKind::kMutex)
+                .count(),
+            0);
+  EXPECT_EQ(GetWaiting(locking->second, engine::impl::WaitKind::kSleep)
+                .count(),
+            0);
+}
+
+UTEST(TaskTimings, DisabledByDefault) {
+  auto task = engine::AsyncNoSpan([] {
+    tracing::Span span{"not_accounted"};
+    engine::SleepFor(std::chrono::milliseconds{1});
+  });
+  task.Get();
+
+  EXPECT_TRUE(engine::current_task::GetTaskProcessor()
+                  .GetTaskCounter()
+                  .GetSpanTimings()
+                  .empty());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,335 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <algorithm>
+
+#include <compiler/tls.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Check the global queue first every N pops, so that the tasks from other
+// threads are not starved by the workers busy with their local tasks.
+constexpr std::size_t kGlobalQueueCheckInterval = 61;
+
+// Prevents a pair of tasks that wake each other up from starving the rest of
+// the local queue.
+constexpr std::size_t kMaxLifoStreak = 16;
+
+constexpr std::size_t kMaxStealBatch = 32;
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+struct LocalConsumerData final {
+  const void* queue{nullptr};
+  std::size_t index{0};
+};
+
+thread_local USERVER_IMPL_CONSTINIT LocalConsumerData local_consumer_data;
+
+USERVER_PREVENT_TLS_CACHING LocalConsumerData
+GetLocalConsumerData() noexcept {
+  return local_consumer_data;
+}
+
+USERVER_PREVENT_TLS_CACHING void SetLocalConsumerData(
+    LocalConsumerData data) noexcept {
+  local_consumer_data = data;
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const WorkStealingWorkerStats& stats) {
+  writer["local-hits"] = stats.local_hits;
+  writer["global-hits"] = stats.global_hits;
+  writer["steals"] = stats.steals;
+}
+
+bool WorkStealingTaskQueue::LocalQueue::TryPush(
+    impl::TaskContext* context) noexcept {
+  std::lock_guard lock(mutex_);
+  if (size_ == kCapacity) return false;
+  buffer_[(head_ + size_) % kCapacity] = context;
+  ++size_;
+  size_approx_.store(size_, std::memory_order_relaxed);
+  return true;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::LocalQueue::TryPop() noexcept {
+  if (size_approx_.load(std::memory_order_relaxed) == 0) return nullptr;
+
+  std::lock_guard lock(mutex_);
+  if (size_ == 0) return nullptr;
+  auto* context = buffer_[head_];
+  head_ = (head_ + 1) % kCapacity;
+  --size_;
+  size_approx_.store(size_, std::memory_order_relaxed);
+  return context;
+}
+
+std::size_t WorkStealingTaskQueue::LocalQueue::StealHalf(
+    impl::TaskContext** out, std::size_t max) noexcept {
+  if (size_approx_.load(std::memory_order_relaxed) == 0) return 0;
+
+  std::lock_guard lock(mutex_);
+  const auto count = std::min((size_ + 1) / 2, max);
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i] = buffer_[head_];
+    head_ = (head_ + 1) % kCapacity;
+  }
+  size_ -= count;
+  size_approx_.store(size_, std::memory_order_relaxed);
+  return count;
+}
+
+std::size_t WorkStealingTaskQueue::LocalQueue::GetSizeApproximate()
+    const noexcept {
+  return size_approx_.load(std::memory_order_relaxed);
+}
+
+WorkStealingTaskQueue::Consumer::Consumer(int spinning_iterations)
+    : semaphore(kSemaphoreInitialCount, spinning_iterations) {}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : consumers_(config.worker_threads, config.spinning_iterations) {
+  sleepers_.reserve(consumers_.size());
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() {
+  UASSERT(!HasQueuedTasks());
+}
+
+void WorkStealingTaskQueue::PrepareWorker(std::size_t index) noexcept {
+  UASSERT(index < consumers_.size());
+  SetLocalConsumerData({this, index});
+}
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  auto* const raw_context = context.detach();
+
+  auto* const consumer = GetCurrentConsumer();
+  if (!consumer) {
+    DoPushGlobal(raw_context);
+  } else if (auto* current = current_task::GetCurrentTaskContextUnchecked();
+             current && current != raw_context) {
+    // The task was woken up by a running task, it is likely to use the data
+    // that is hot in the cache of this worker.
+    auto* const displaced =
+        consumer->lifo_slot.exchange(raw_context, std::memory_order_acq_rel);
+    if (displaced && !consumer->local_queue.TryPush(displaced)) {
+      DoPushGlobal(displaced);
+    }
+  } else if (!consumer->local_queue.TryPush(raw_context)) {
+    DoPushGlobal(raw_context);
+  }
+
+  // Pairs with the fence in Sleep()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleepers_count_->load(std::memory_order_relaxed) != 0) {
+    WakeUpOneSleeper();
+  }
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  const auto data = GetLocalConsumerData();
+  UINVARIANT(data.queue == this,
+             "PopBlocking called from a thread that is not a worker of this "
+             "task queue");
+  auto& consumer = *consumers_[data.index];
+
+  while (true) {
+    if (auto* context = TryPop(consumer)) {
+      return {context, /* add_ref= */ false};
+    }
+    if (is_stopped_.load()) return nullptr;
+    Sleep(consumer);
+  }
+}
+
+void WorkStealingTaskQueue::StopProcessing() {
+  is_stopped_.store(true);
+  WakeUpAllSleepers();
+}
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = global_queue_.size_approx();
+  for (const auto& consumer : consumers_) {
+    size += consumer->local_queue.GetSizeApproximate();
+    if (consumer->lifo_slot.load(std::memory_order_relaxed)) ++size;
+  }
+  return size;
+}
+
+WorkStealingWorkerStats WorkStealingTaskQueue::GetWorkerStats(
+    std::size_t index) const noexcept {
+  UASSERT(index < consumers_.size());
+  const auto& consumer = *consumers_[index];
+  return {consumer.local_hits.Load(), consumer.global_hits.Load(),
+          consumer.steals.Load()};
+}
+
+WorkStealingTaskQueue::Consumer*
+WorkStealingTaskQueue::GetCurrentConsumer() noexcept {
+  const auto data = GetLocalConsumerData();
+  if (data.queue != this) return nullptr;
+  return &*consumers_[data.index];
+}
+
+void WorkStealingTaskQueue::DoPushGlobal(impl::TaskContext* context) {
+  global_queue_.enqueue(context);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopLocal(
+    Consumer& consumer) noexcept {
+  const bool lifo_allowed = consumer.lifo_streak < kMaxLifoStreak;
+  if (lifo_allowed &&
+      consumer.lifo_slot.load(std::memory_order_relaxed) != nullptr) {
+    if (auto* context =
+            consumer.lifo_slot.exchange(nullptr, std::memory_order_acquire)) {
+      ++consumer.lifo_streak;
+      ++consumer.local_hits;
+      return context;
+    }
+  }
+  consumer.lifo_streak = 0;
+
+  if (auto* context = consumer.local_queue.TryPop()) {
+    ++consumer.local_hits;
+    return context;
+  }
+
+  if (!lifo_allowed) {
+    if (auto* context =
+            consumer.lifo_slot.exchange(nullptr, std::memory_order_acquire)) {
+      ++consumer.local_hits;
+      return context;
+    }
+  }
+
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopGlobal(Consumer& consumer) {
+  impl::TaskContext* context{};
+  if (!global_queue_.try_dequeue(context)) return nullptr;
+  consumer.lifo_streak = 0;
+  ++consumer.global_hits;
+  return context;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TrySteal(Consumer& consumer) {
+  const auto consumers_count = consumers_.size();
+  if (consumers_count < 2) return nullptr;
+
+  impl::TaskContext* stolen[kMaxStealBatch];
+  const auto start = utils::RandRange(consumers_count);
+  for (std::size_t i = 0; i < consumers_count; ++i) {
+    auto& victim = *consumers_[(start + i) % consumers_count];
+    if (&victim == &consumer) continue;
+
+    const auto count = victim.local_queue.StealHalf(stolen, kMaxStealBatch);
+    if (count != 0) {
+      for (std::size_t j = 1; j < count; ++j) {
+        if (!consumer.local_queue.TryPush(stolen[j])) DoPushGlobal(stolen[j]);
+      }
+      ++consumer.steals;
+      return stolen[0];
+    }
+
+    // The victim is probably busy running a long task, don't let the task in
+    // its LIFO slot wait for it.
+    if (victim.lifo_slot.load(std::memory_order_relaxed) != nullptr) {
+      if (auto* context =
+              victim.lifo_slot.exchange(nullptr, std::memory_order_acquire)) {
+        ++consumer.steals;
+        return context;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPop(Consumer& consumer) {
+  if (++consumer.pops_since_global_check >= kGlobalQueueCheckInterval) {
+    consumer.pops_since_global_check = 0;
+    if (auto* context = TryPopGlobal(consumer)) return context;
+  }
+
+  if (auto* context = TryPopLocal(consumer)) return context;
+  if (auto* context = TryPopGlobal(consumer)) return context;
+  return TrySteal(consumer);
+}
+
+bool WorkStealingTaskQueue::HasQueuedTasks() const noexcept {
+  if (global_queue_.size_approx() != 0) return true;
+  return std::any_of(
+      consumers_.begin(), consumers_.end(), [](const ConsumerSlot& consumer) {
+        return consumer->local_queue.GetSizeApproximate() != 0 ||
+               consumer->lifo_slot.load(std::memory_order_relaxed) != nullptr;
+      });
+}
+
+bool WorkStealingTaskQueue::TryUnregisterSleeper(std::size_t index) {
+  std::lock_guard lock(sleepers_mutex_);
+  const auto it = std::find(sleepers_.begin(), sleepers_.end(), index);
+  if (it == sleepers_.end()) return false;
+  sleepers_.erase(it);
+  sleepers_count_->fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+void WorkStealingTaskQueue::WakeUpOneSleeper() {
+  std::size_t index{};
+  {
+    std::lock_guard lock(sleepers_mutex_);
+    if (sleepers_.empty()) return;
+    index = sleepers_.back();
+    sleepers_.pop_back();
+    sleepers_count_->fetch_sub(1, std::memory_order_relaxed);
+  }
+  consumers_[index]->semaphore.signal();
+}
+
+void WorkStealingTaskQueue::WakeUpAllSleepers() {
+  std::vector<std::size_t> sleepers;
+  {
+    std::lock_guard lock(sleepers_mutex_);
+    sleepers.swap(sleepers_);
+    sleepers_count_->store(0, std::memory_order_relaxed);
+  }
+  for (const auto index : sleepers) consumers_[index]->semaphore.signal();
+}
+
+void WorkStealingTaskQueue::Sleep(Consumer& consumer) {
+  const auto index = GetLocalConsumerData().index;
+  {
+    std::lock_guard lock(sleepers_mutex_);
+    sleepers_.push_back(index);
+    sleepers_count_->fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Pairs with the fence in Push(): either the pusher sees us sleeping, or we
+  // see the pushed task.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if ((HasQueuedTasks() || is_stopped_.load()) && TryUnregisterSleeper(index)) {
+    return;
+  }
+
+  // Either nobody woke us up yet, or the signal is already on its way
+  consumer.semaphore.wait();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/task_processor_config.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// Per-worker counters of the WorkStealingTaskQueue
+struct WorkStealingWorkerStats final {
+  /// Tasks taken from the worker's own LIFO slot or local queue
+  utils::statistics::Rate local_hits;
+  /// Tasks taken from the shared global queue
+  utils::statistics::Rate global_hits;
+  /// Successful attempts to steal tasks from other workers
+  utils::statistics::Rate steals;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const WorkStealingWorkerStats& stats);
+
+/// @brief Task queue with a LIFO slot and a local queue per worker thread.
+///
+/// Tasks scheduled from a worker thread of the owning TaskProcessor stay on
+/// that worker, tasks scheduled from other threads go to the global FIFO
+/// queue. Idle workers steal from the local queues of the other workers before
+/// going to sleep.
+class WorkStealingTaskQueue final {
+ public:
+  explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
+
+  WorkStealingTaskQueue(const WorkStealingTaskQueue&) = delete;
+  WorkStealingTaskQueue& operator=(const WorkStealingTaskQueue&) = delete;
+
+  ~WorkStealingTaskQueue();
+
+  /// Must be called once from each worker thread before PopBlocking
+  void PrepareWorker(std::size_t index) noexcept;
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+  std::size_t GetWorkerCount() const noexcept { return consumers_.size(); }
+
+  WorkStealingWorkerStats GetWorkerStats(std::size_t index) const noexcept;
+
+ private:
+  // A bounded ring buffer, only the owner pushes into it
+  class LocalQueue final {
+   public:
+    bool TryPush(impl::TaskContext* context) noexcept;
+    impl::TaskContext* TryPop() noexcept;
+    // Moves up to a half of the tasks into `out`, returns the moved count
+    std::size_t StealHalf(impl::TaskContext** out, std::size_t max) noexcept;
+    std::size_t GetSizeApproximate() const noexcept;
+
+   private:
+    static constexpr std::size_t kCapacity = 256;
+
+    mutable std::mutex mutex_;
+    impl::TaskContext* buffer_[kCapacity]{};
+    std::size_t head_{0};
+    std::size_t size_{0};
+    std::atomic<std::size_t> size_approx_{0};
+  };
+
+  struct Consumer final {
+    explicit Consumer(int spinning_iterations);
+
+    std::atomic<impl::TaskContext*> lifo_slot{nullptr};
+    LocalQueue local_queue;
+    moodycamel::LightweightSemaphore semaphore;
+
+    // Only mutated by the owning worker
+    std::size_t pops_since_global_check{0};
+    std::size_t lifo_streak{0};
+
+    utils::statistics::RateCounter local_hits;
+    utils::statistics::RateCounter global_hits;
+    utils::statistics::RateCounter steals;
+  };
+
+  using ConsumerSlot = concurrent::impl::InterferenceShield<Consumer>;
+
+  Consumer* GetCurrentConsumer() noexcept;
+
+  void DoPushGlobal(impl::TaskContext* context);
+
+  impl::TaskContext* TryPopLocal(Consumer& consumer) noexcept;
+
+  impl::TaskContext* TryPopGlobal(Consumer& consumer);
+
+  impl::TaskContext* TrySteal(Consumer& consumer);
+
+  impl::TaskContext* TryPop(Consumer& consumer);
+
+  bool HasQueuedTasks() const noexcept;
+
+  // Returns false if the consumer was woken up or it was not registered
+  bool TryUnregisterSleeper(std::size_t index);
+
+  void WakeUpOneSleeper();
+
+  void WakeUpAllSleepers();
+
+  void Sleep(Consumer& consumer);
+
+  moodycamel::ConcurrentQueue<impl::TaskContext*> global_queue_;
+  utils::FixedArray<ConsumerSlot> consumers_;
+
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>>
+      sleepers_count_{0};
+  std::mutex sleepers_mutex_;
+  std::vector<std::size_t> sleepers_;
+
+  std::atomic<bool> is_stopped_{false};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkerThreads = 4;
+
+engine::TaskProcessorConfig MakeWorkStealingConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "work-stealing";
+  config.thread_name = "ws-worker";
+  config.worker_threads = kWorkerThreads;
+  config.task_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+  return config;
+}
+
+std::uint64_t SumStats(const engine::WorkStealingTaskQueue& queue) {
+  std::uint64_t result = 0;
+  for (std::size_t i = 0; i < queue.GetWorkerCount(); ++i) {
+    const auto stats = queue.GetWorkerStats(i);
+    result += stats.local_hits.value + stats.global_hits.value;
+  }
+  return result;
+}
+
+}  // namespace
+
+UTEST(WorkStealingTaskQueue, RunsTasksFromOtherThreads) {
+  engine::TaskProcessor task_processor{
+      MakeWorkStealingConfig(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+  ASSERT_NE(task_processor.GetWorkStealingTaskQueue(), nullptr);
+
+  constexpr int kTasksCount = 100;
+  std::vector<engine::TaskWithResult<int>> tasks;
+  tasks.reserve(kTasksCount);
+  for (int i = 0; i < kTasksCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [i] { return i; }));
+  }
+  for (int i = 0; i < kTasksCount; ++i) {
+    EXPECT_EQ(tasks[i].Get(), i);
+  }
+
+  EXPECT_GE(SumStats(*task_processor.GetWorkStealingTaskQueue()),
+            static_cast<std::uint64_t>(kTasksCount));
+}
+
+UTEST(WorkStealingTaskQueue, NestedTasks) {
+  engine::TaskProcessor task_processor{
+      MakeWorkStealingConfig(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  constexpr std::size_t kSubtasksCount = 1000;
+  std::atomic<std::size_t> finished{0};
+  engine::AsyncNoSpan(task_processor, [&finished] {
+    std::vector<engine::TaskWithResult<void>> subtasks;
+    subtasks.reserve(kSubtasksCount);
+    for (std::size_t i = 0; i < kSubtasksCount; ++i) {
+      subtasks.push_back(engine::AsyncNoSpan([&finished] {
+        engine::Yield();
+        ++finished;
+      }));
+    }
+    for (auto& subtask : subtasks) subtask.Get();
+  }).Get();
+
+  EXPECT_EQ(finished.load(), kSubtasksCount);
+}
+
+UTEST(WorkStealingTaskQueue, YieldLetsOtherTasksRun) {
+  engine::TaskProcessor task_processor{
+      [] {
+        auto config = MakeWorkStealingConfig();
+        config.worker_threads = 1;
+        return config;
+      }(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  std::atomic<bool> other_task_ran{false};
+  engine::AsyncNoSpan(task_processor, [&other_task_ran] {
+    auto other = engine::AsyncNoSpan([&other_task_ran] {
+      other_task_ran = true;
+    });
+    while (!other_task_ran) engine::Yield();
+    other.Get();
+  }).Get();
+
+  EXPECT_TRUE(other_task_ran);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,17 @@
 #include <userver/fs/fs_cache_client.hpp>
 
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <fs/read_helpers.hpp>
+
+#include <userver/engine/async.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/periodic_task.hpp>
 
@@ -8,6 +19,99 @@ USERVER_NAMESPACE_BEGIN
 
 namespace fs {
 
+namespace {
+
+using FilesMap = rcu::RcuMap<std::string, const FileInfoWithData>;
+
+// Files modified this close to the scan may be modified again within the
+// timestamp granularity of the filesystem without a visible change
+constexpr std::chrono::seconds kRacyModificationWindow{1};
+
+std::chrono::nanoseconds ToDuration(const ::timespec& time) {
+  return std::chrono::seconds{time.tv_sec} +
+         std::chrono::nanoseconds{time.tv_nsec};
+}
+
+// What tells a file version from another without reading it
+struct FileStamp final {
+  bool operator==(const FileStamp& other) const noexcept {
+    return device == other.device && inode == other.inode &&
+           size == other.size && modification_time == other.modification_time &&
+           change_time == other.change_time;
+  }
+
+  std::uint64_t device{0};
+  std::uint64_t inode{0};
+  std::uint64_t size{0};
+  std::chrono::nanoseconds modification_time{0};
+  std::chrono::nanoseconds change_time{0};
+};
+
+FileStamp MakeFileStamp(const struct ::stat& info) {
+  FileStamp stamp;
+  stamp.device = info.st_dev;
+  stamp.inode = info.st_ino;
+  stamp.size = info.st_size;
+#ifdef __APPLE__
+  stamp.modification_time = ToDuration(info.st_mtimespec);
+  stamp.change_time = ToDuration(info.st_ctimespec);
+#else
+  stamp.modification_time = ToDuration(info.st_mtim);
+  stamp.change_time = ToDuration(info.st_ctim);
+#endif
+  return stamp;
+}
+
+// All the entries of the cache are created by ScanChanges
+struct CachedFileInfo final : FileInfoWithData {
+  FileStamp stamp;
+  // Changed right before it was read, the next scan rereads it
+  bool is_racy{false};
+};
+
+// Rereads only the new files and the files with a changed stamp, the rest are
+// shared with the `old_map`. Returns whether anything has changed.
+bool ScanChanges(const std::string& dir, const FilesMap::Snapshot& old_map,
+                 FilesMap::RawMap& new_map) {
+  const auto scan_start = std::chrono::system_clock::now().time_since_epoch();
+  bool is_changed = false;
+  for (const auto& f : boost::filesystem::recursive_directory_iterator(dir)) {
+    if (f.status().type() != boost::filesystem::regular_file) continue;
+    if (impl::IsHiddenFile(f.path())) continue;
+
+    const auto& full_path = f.path().string();
+    struct ::stat stat_info {};
+    // The file was removed after it was listed
+    if (::stat(full_path.c_str(), &stat_info) != 0) continue;
+    const auto stamp = MakeFileStamp(stat_info);
+
+    auto relative_path = full_path.substr(dir.size());
+    const auto old_it = old_map.find(relative_path);
+    if (old_it != old_map.end()) {
+      const auto& old_info =
+          static_cast<const CachedFileInfo&>(*old_it->second);
+      if (!old_info.is_racy && old_info.stamp == stamp) {
+        new_map.emplace(std::move(relative_path), old_it->second);
+        continue;
+      }
+    }
+
+    auto info = std::make_shared<CachedFileInfo>();
+    info->size = stamp.size;
+    info->extension = f.path().extension().string();
+    info->last_write_time = stat_info.st_mtime;
+    info->data = fs::blocking::ReadFileContents(full_path);
+    info->stamp = stamp;
+    info->is_racy =
+        stamp.modification_time + kRacyModificationWindow > scan_start;
+    new_map.emplace(std::move(relative_path), std::move(info));
+    is_changed = true;
+  }
+  return is_changed || new_map.size() != old_map.size();
+}
+
+}  // namespace
+
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
                              engine::TaskProcessor& tp)
@@ -24,18 +128,19 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
-  auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
-  data_.Assign(std::move(map));
+  const auto old_map = data_.GetSnapshot();
+  FilesMap::RawMap new_map;
+  const bool is_changed =
+      engine::AsyncNoSpan(tp_, &ScanChanges, std::cref(dir_),
+                          std::cref(old_map), std::ref(new_map))
+          .Get();
+  if (is_changed) data_.Assign(std::move(new_map));
 }
 
 FileInfoWithDataConstPtr FsCacheClient::TryGetFile(
     std::string_view path) const {
   LOG_DEBUG() << "Find file " << path;
-  auto snap = data_.GetSnapshot();
-  if (auto it = snap.find(std::string{path}); it != snap.end())
-    return it->second;
-  return nullptr;
+  return data_.Get(std::string{path});
 }
 
 }  // namespace fs
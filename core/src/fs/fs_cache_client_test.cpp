@@ -0,0 +1,79 @@
+#include <userver/utest/utest.hpp>
+
+#include <ctime>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/fs/fs_cache_client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The files modified right before a scan are reread by the next one
+void WriteOldFile(const std::string& path, std::string_view contents) {
+  fs::blocking::RewriteFileContents(path, contents);
+  boost::filesystem::last_write_time(path, std::time(nullptr) - 3600);
+}
+
+}  // namespace
+
+UTEST(FsCacheClient, Update) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto& path = dir.GetPath();
+  WriteOldFile(path + "/same.txt", "same");
+  WriteOldFile(path + "/changed.txt", "old");
+  WriteOldFile(path + "/removed.txt", "removed");
+  WriteOldFile(path + "/.hidden", "hidden");
+
+  fs::FsCacheClient client(path, std::chrono::milliseconds{0},
+                           engine::current_task::GetTaskProcessor());
+
+  const auto same = client.TryGetFile("/same.txt");
+  ASSERT_TRUE(same);
+  EXPECT_EQ(same->data, "same");
+  EXPECT_EQ(same->extension, ".txt");
+  ASSERT_TRUE(client.TryGetFile("/changed.txt"));
+  EXPECT_EQ(client.TryGetFile("/changed.txt")->data, "old");
+  EXPECT_TRUE(client.TryGetFile("/removed.txt"));
+  EXPECT_FALSE(client.TryGetFile("/.hidden"));
+  EXPECT_FALSE(client.TryGetFile("/missing.txt"));
+
+  fs::blocking::RewriteFileContents(path + "/changed.txt", "new text");
+  boost::filesystem::remove(path + "/removed.txt");
+  fs::blocking::CreateDirectories(path + "/subdir");
+  fs::blocking::RewriteFileContents(path + "/subdir/added.txt", "added");
+  client.UpdateCache();
+
+  // The unchanged files are not reread
+  EXPECT_EQ(client.TryGetFile("/same.txt"), same);
+  ASSERT_TRUE(client.TryGetFile("/changed.txt"));
+  EXPECT_EQ(client.TryGetFile("/changed.txt")->data, "new text");
+  EXPECT_FALSE(client.TryGetFile("/removed.txt"));
+  ASSERT_TRUE(client.TryGetFile("/subdir/added.txt"));
+  EXPECT_EQ(client.TryGetFile("/subdir/added.txt")->data, "added");
+}
+
+UTEST(FsCacheClient, SameSizeRewrite) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto& path = dir.GetPath();
+  fs::blocking::RewriteFileContents(path + "/file.txt", "old");
+
+  fs::FsCacheClient client(path, std::chrono::milliseconds{0},
+                           engine::current_task::GetTaskProcessor());
+  ASSERT_TRUE(client.TryGetFile("/file.txt"));
+  EXPECT_EQ(client.TryGetFile("/file.txt")->data, "old");
+
+  // Same size and most probably the same second of the modification time
+  fs::blocking::RewriteFileContents(path + "/file.txt", "new");
+  client.UpdateCache();
+  ASSERT_TRUE(client.TryGetFile("/file.txt"));
+  EXPECT_EQ(client.TryGetFile("/file.txt")->data, "new");
+}
+
+USERVER_NAMESPACE_END
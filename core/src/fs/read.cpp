@@ -1,5 +1,14 @@
 #include <userver/fs/read.hpp>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <fs/read_helpers.hpp>
+
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 
@@ -7,7 +16,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace fs {
 
-namespace {
+namespace impl {
 
 bool IsHiddenFile(const boost::filesystem::path& path) {
   auto name = path.filename().native();
@@ -15,18 +24,100 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
   return name != ".." && name != "." && name[0] == '.';
 }
 
+}  // namespace impl
+
+namespace {
+
 std::string GetRelative(std::string_view path, std::string_view dir) {
   UASSERT(dir.size() < path.size());
   auto rel = path.substr(dir.size());
   return std::string{rel};
 }
 
+// Reads the file in the current task if all of its data is in the page cache.
+// Returns false if the read would block or fails for any reason, the caller
+// should fall back to the blocking read on the fs task processor, that also
+// reports the errors properly.
+bool TryReadCachedFileContents(const std::string& path,
+                               std::string& contents) {
+#if defined(RWF_NOWAIT)
+  constexpr std::size_t kMinReadSize = 4096;
+
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) return false;
+
+  struct ::stat info {};
+  bool is_ok = ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+
+  contents.clear();
+  while (is_ok) {
+    // One byte more than the file size to detect EOF in a single call
+    const auto capacity = std::max<std::size_t>(
+        {contents.size() * 2, static_cast<std::size_t>(info.st_size) + 1,
+         kMinReadSize});
+    const auto offset = contents.size();
+    contents.resize(capacity);
+
+    ::iovec iov{contents.data() + offset, capacity - offset};
+    const auto res = ::preadv2(fd, &iov, 1, offset, RWF_NOWAIT);
+    if (res < 0) {
+      // EAGAIN if the data is not cached, or RWF_NOWAIT is not supported
+      is_ok = false;
+      break;
+    }
+
+    contents.resize(offset + res);
+    if (res == 0) break;
+  }
+
+  ::close(fd);
+  return is_ok;
+#else
+  (void)path;
+  (void)contents;
+  return false;
+#endif
+}
+
 }  // namespace
 
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path) {
-  return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
+  std::string contents;
+  ReadFileContents(async_tp, path, contents);
+  return contents;
+}
+
+void ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path,
+                      std::string& contents) {
+  if (TryReadCachedFileContents(path, contents)) return;
+
+  contents =
+      engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
+          .Get();
+}
+
+std::vector<std::string> ReadFilesContents(
+    engine::TaskProcessor& async_tp, const std::vector<std::string>& paths) {
+  std::vector<std::string> contents(paths.size());
+  std::vector<std::size_t> uncached;
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    if (!TryReadCachedFileContents(paths[i], contents[i])) {
+      uncached.push_back(i);
+    }
+  }
+  if (uncached.empty()) return contents;
+
+  // A single hop to the fs task processor for all the uncached files
+  engine::AsyncNoSpan(async_tp,
+                      [&] {
+                        for (const auto i : uncached) {
+                          contents[i] =
+                              fs::blocking::ReadFileContents(paths[i]);
+                        }
+                      })
       .Get();
+  return contents;
 }
 
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
@@ -36,11 +127,13 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
   for (const auto& f : boost::filesystem::recursive_directory_iterator(path)) {
     // only files
     if (f.status().type() != boost::filesystem::regular_file) continue;
-    if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(f.path()))
+    if ((flags & SettingsReadFile::kSkipHidden) &&
+        impl::IsHiddenFile(f.path()))
       continue;
     FileInfoWithData info{};
     info.size = boost::filesystem::file_size(f.path());
     info.extension = f.path().extension().string();
+    info.last_write_time = boost::filesystem::last_write_time(f.path());
     info.data = ReadFileContents(async_tp, f.path().string());
     data[GetRelative(f.path().string(), path)] =
         std::make_shared<const FileInfoWithData>(std::move(info));
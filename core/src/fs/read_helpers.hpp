@@ -0,0 +1,14 @@
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::impl {
+
+/// Whether the file name starts with a dot, `.` and `..` are not hidden
+bool IsHiddenFile(const boost::filesystem::path& path);
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
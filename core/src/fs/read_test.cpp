@@ -0,0 +1,74 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/fs/read.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(AsyncFs, ReadFileContents) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "some text");
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  EXPECT_EQ(fs::ReadFileContents(async_tp, file.GetPath()), "some text");
+}
+
+UTEST(AsyncFs, ReadFileContentsLarge) {
+  const auto file = fs::blocking::TempFile::Create();
+  std::string text(100'000, 'a');
+  for (std::size_t i = 0; i < text.size(); i += 7) text[i] = 'b';
+  fs::blocking::RewriteFileContents(file.GetPath(), text);
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  EXPECT_EQ(fs::ReadFileContents(async_tp, file.GetPath()), text);
+}
+
+UTEST(AsyncFs, ReadFileContentsIntoBuffer) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "short");
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  std::string contents = "some previous long contents";
+  fs::ReadFileContents(async_tp, file.GetPath(), contents);
+  EXPECT_EQ(contents, "short");
+
+  fs::blocking::RewriteFileContents(file.GetPath(), "");
+  fs::ReadFileContents(async_tp, file.GetPath(), contents);
+  EXPECT_EQ(contents, "");
+}
+
+UTEST(AsyncFs, ReadFileContentsErrors) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  UEXPECT_THROW(fs::ReadFileContents(async_tp, dir.GetPath() + "/missing"),
+                std::runtime_error);
+}
+
+UTEST(AsyncFs, ReadFilesContents) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  std::vector<std::string> paths;
+  for (int i = 0; i < 5; ++i) {
+    paths.push_back(dir.GetPath() + "/file" + std::to_string(i));
+    fs::blocking::RewriteFileContents(paths.back(), std::to_string(i));
+  }
+
+  const auto contents = fs::ReadFilesContents(async_tp, paths);
+  ASSERT_EQ(contents.size(), paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    EXPECT_EQ(contents[i], std::to_string(i));
+  }
+
+  paths.push_back(dir.GetPath() + "/missing");
+  UEXPECT_THROW(fs::ReadFilesContents(async_tp, paths), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
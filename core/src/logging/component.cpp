@@ -9,6 +9,7 @@
 #include <logging/config.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/fd_sink.hpp>
+#include <logging/impl/shipping_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
 #include <logging/tp_logger.hpp>
@@ -83,6 +84,14 @@ auto MakeTestsuiteSink(const logging::TestsuiteCaptureConfig& config) {
   return std::make_unique<logging::impl::TcpSocketSink>(std::move(addrs));
 }
 
+auto MakeShippingSink(const logging::ShippingConfig& config,
+                      logging::statistics::LogStatistics& stats) {
+  auto addrs = net::blocking::GetAddrInfo(config.host,
+                                          std::to_string(config.port).c_str());
+  return std::make_unique<logging::impl::ShippingSink>(
+      std::move(addrs), config, stats.shipping.emplace());
+}
+
 std::shared_ptr<logging::impl::TpLogger> MakeLogger(
     const logging::LoggerConfig& config,
     logging::impl::TcpSocketSink*& socket_sink) {
@@ -92,9 +101,15 @@ std::shared_ptr<logging::impl::TpLogger> MakeLogger(
   logger->SetFlushOn(config.flush_level);
 
   if (auto basic_sink = MakeOptionalSink(config)) {
+    basic_sink->SetBinaryRecords(config.binary_records);
     logger->AddSink(std::move(basic_sink));
   }
 
+  if (config.shipping) {
+    logger->AddSink(
+        MakeShippingSink(*config.shipping, logger->GetStatistics()));
+  }
+
   if (config.testsuite_capture) {
     auto socket_sink_holder = MakeTestsuiteSink(*config.testsuite_capture);
     socket_sink = socket_sink_holder.get();
@@ -175,7 +190,8 @@ void Logging::Init(const ComponentConfig& config,
 
     logger->StartConsumerTask(context.GetTaskProcessor(tp_name),
                               logger_config.message_queue_size,
-                              logger_config.queue_overflow_behavior);
+                              logger_config.queue_overflow_behavior,
+                              logger_config.thread_buffer_size);
 
     auto insertion_result =
         loggers_.emplace(logger_config.logger_name, std::move(logger));
@@ -312,6 +328,11 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - binary
+                binary_records:
+                    type: boolean
+                    description: for the `binary` format, write the messages to file_path as binary records for an offline decoder instead of TSKV
+                    defaultDescription: false
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -327,6 +348,10 @@ properties:
                     enum:
                       - discard
                       - block
+                thread_buffer_size:
+                    type: integer
+                    description: if not 0, the size in bytes of the per-thread buffers that pass the messages to the logger task without allocations, must be a power of 2
+                    defaultDescription: 0
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
@@ -343,6 +368,52 @@ properties:
                         port:
                             type: integer
                             description: testsuite port
+                shipping:
+                    type: object
+                    description: if exists, setups additional sink that ships the logs to a log agent in batched frames
+                    defaultDescription: "{}"
+                    additionalProperties: false
+                    properties:
+                        host:
+                            type: string
+                            description: log agent hostname
+                        port:
+                            type: integer
+                            description: log agent port
+                        protocol:
+                            type: string
+                            description: transport protocol
+                            defaultDescription: tcp
+                            enum:
+                              - tcp
+                              - udp
+                        max_frame_size:
+                            type: integer
+                            description: max size in bytes of the records in a frame, for udp the larger records are dropped
+                            defaultDescription: 65536
+                        max_frame_delay:
+                            type: string
+                            description: a frame is sent with the first record logged after this delay
+                            defaultDescription: 100ms
+                        compression:
+                            type: string
+                            description: if set, each frame is compressed separately with this content coding
+                            enum:
+                              - gzip
+                              - zstd
+                              - br
+                        max_spill_size:
+                            type: integer
+                            description: max size in bytes of the frames kept while the agent is unavailable, the oldest are dropped
+                            defaultDescription: 16777216
+                        reconnect_interval:
+                            type: string
+                            description: min interval between the connection attempts
+                            defaultDescription: 1s
+                        io_timeout:
+                            type: string
+                            description: connect and send timeout
+                            defaultDescription: 500ms
 )");
 }
 
@@ -1,5 +1,7 @@
 #include "config.hpp"
 
+#include <stdexcept>
+
 #include <userver/logging/level_serialization.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -8,6 +10,54 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
+ShippingProtocol Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<ShippingProtocol>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(ShippingProtocol::kTcp, "tcp")
+        .Case(ShippingProtocol::kUdp, "udp");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
+ShippingConfig Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<ShippingConfig>) {
+  ShippingConfig config;
+  config.host = value["host"].As<std::string>();
+  config.port = value["port"].As<int>();
+  config.protocol = value["protocol"].As<ShippingProtocol>(config.protocol);
+
+  config.max_frame_size =
+      value["max_frame_size"].As<std::size_t>(config.max_frame_size);
+  config.max_frame_delay =
+      value["max_frame_delay"].As<std::chrono::milliseconds>(
+          config.max_frame_delay);
+  if (config.max_frame_size == 0) {
+    throw std::runtime_error("max_frame_size must be positive, path: " +
+                             value.GetPath());
+  }
+
+  const auto compression =
+      value["compression"].As<std::optional<std::string>>();
+  if (compression) {
+    config.compression = compression::EncodingFromString(*compression);
+    if (!compression::IsSupported(*config.compression)) {
+      throw std::runtime_error("Compression '" + *compression +
+                               "' is not supported by this build, path: " +
+                               value.GetPath());
+    }
+  }
+
+  config.max_spill_size =
+      value["max_spill_size"].As<std::size_t>(config.max_spill_size);
+  config.reconnect_interval =
+      value["reconnect_interval"].As<std::chrono::milliseconds>(
+          config.reconnect_interval);
+  config.io_timeout =
+      value["io_timeout"].As<std::chrono::milliseconds>(config.io_timeout);
+  return config;
+}
+
 QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
                             formats::parse::To<QueueOverflowBehavior>) {
   static constexpr utils::TrivialBiMap kMap([](auto selector) {
@@ -42,6 +92,15 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
 
   config.format = value["format"].As<Format>();
 
+  config.binary_records =
+      value["binary_records"].As<bool>(config.binary_records);
+  if (config.binary_records && config.format != Format::kBinary) {
+    throw std::runtime_error(
+        "binary_records are supported only for the 'binary' log format, "
+        "path: " +
+        value.GetPath());
+  }
+
   config.flush_level =
       value["flush_level"].As<logging::Level>(config.flush_level);
 
@@ -52,12 +111,17 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
       value["overflow_behavior"].As<QueueOverflowBehavior>(
           config.queue_overflow_behavior);
 
+  config.thread_buffer_size =
+      value["thread_buffer_size"].As<size_t>(config.thread_buffer_size);
+
   config.fs_task_processor =
       value["fs-task-processor"].As<std::optional<std::string>>();
 
   config.testsuite_capture =
       value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
 
+  config.shipping = value["shipping"].As<std::optional<ShippingConfig>>();
+
   return config;
 }
 
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
+#include <compression/compressor.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -19,6 +23,29 @@ struct TestsuiteCaptureConfig final {
 TestsuiteCaptureConfig Parse(const yaml_config::YamlConfig& value,
                              formats::parse::To<TestsuiteCaptureConfig>);
 
+enum class ShippingProtocol { kTcp, kUdp };
+
+ShippingProtocol Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<ShippingProtocol>);
+
+// see logging::impl::ShippingSink
+struct ShippingConfig final {
+  std::string host;
+  int port{};
+  ShippingProtocol protocol{ShippingProtocol::kTcp};
+
+  std::size_t max_frame_size{64 * 1024};
+  std::chrono::milliseconds max_frame_delay{100};
+  std::optional<compression::Encoding> compression;
+
+  std::size_t max_spill_size{16 * 1024 * 1024};
+  std::chrono::milliseconds reconnect_interval{1000};
+  std::chrono::milliseconds io_timeout{500};
+};
+
+ShippingConfig Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<ShippingConfig>);
+
 enum class QueueOverflowBehavior { kDiscard, kBlock };
 
 QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
@@ -34,16 +61,23 @@ struct LoggerConfig final {
   std::string file_path;
   Level level = Level::kInfo;
   Format format = Format::kTskv;
+  // write Format::kBinary messages as binary records, see
+  // logging/binary_record.hpp
+  bool binary_records = false;
   Level flush_level = Level::kWarning;
 
   // must be a power of 2
   size_t message_queue_size = kDefaultMessageQueueSize;
   QueueOverflowBehavior queue_overflow_behavior =
       QueueOverflowBehavior::kDiscard;
+  // 0 to pass the messages through the queue only, must be a power of 2
+  size_t thread_buffer_size = 0;
 
   std::optional<std::string> fs_task_processor;
 
   std::optional<TestsuiteCaptureConfig> testsuite_capture;
+
+  std::optional<ShippingConfig> shipping;
 };
 
 LoggerConfig Parse(const yaml_config::YamlConfig& value,
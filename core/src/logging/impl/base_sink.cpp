@@ -15,6 +15,8 @@ void BaseSink::Log(const spdlog::details::log_msg& msg) {
   Write({formatted.data(), formatted.size()});
 }
 
+void BaseSink::LogRecord(std::string_view record) { Write(record); }
+
 void BaseSink::SetPattern(const std::string& pattern) {
   SetFormatter(std::make_unique<spdlog::pattern_formatter>(pattern));
 }
@@ -35,6 +37,12 @@ bool BaseSink::IsShouldLog(Level msg_level) const {
   return msg_level >= level_.load();
 }
 
+void BaseSink::SetBinaryRecords(bool binary_records) noexcept {
+  binary_records_ = binary_records;
+}
+
+bool BaseSink::IsBinaryRecords() const noexcept { return binary_records_; }
+
 BaseSink::~BaseSink() = default;
 
 }  // namespace logging::impl
@@ -16,6 +16,9 @@ class BaseSink {
 
   void Log(const spdlog::details::log_msg& msg);
 
+  /// Writes the record as is, bypassing the formatter
+  void LogRecord(std::string_view record);
+
   virtual void Flush();
 
   void SetPattern(const std::string& pattern);
@@ -28,12 +31,18 @@ class BaseSink {
   Level GetLevel() const;
   bool IsShouldLog(Level msg_level) const;
 
+  /// Whether the messages of Format::kBinary loggers should be written as
+  /// binary records instead of TSKV
+  void SetBinaryRecords(bool binary_records) noexcept;
+  bool IsBinaryRecords() const noexcept;
+
  protected:
   virtual void Write(std::string_view log) = 0;
 
  private:
   std::unique_ptr<spdlog::formatter> formatter_;
   std::atomic<Level> level_{Level::kTrace};
+  bool binary_records_{false};
 };
 
 }  // namespace logging::impl
@@ -0,0 +1,103 @@
+#include <logging/impl/log_ring_buffer.hpp>
+
+#include <cstring>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+static_assert(sizeof(LogRingBuffer::TimePoint::rep) <= sizeof(std::int64_t));
+
+LogRingBuffer::LogRingBuffer(std::size_t capacity)
+    : capacity_(capacity), data_(std::make_unique<char[]>(capacity)) {
+  UINVARIANT(capacity_ >= kRecordAlignment * 2 &&
+                 (capacity_ & (capacity_ - 1)) == 0,
+             "Log buffer size must be a power of 2");
+}
+
+LogRingBuffer::~LogRingBuffer() {
+  // Frees the external payloads of the records that were not consumed
+  ConsumeAll([](Level, TimePoint, std::string_view) {});
+}
+
+bool LogRingBuffer::IsFitting(std::size_t payload_size) const noexcept {
+  // Larger records would often wait for the whole buffer to become free
+  return payload_size < kExternalSize &&
+         GetRecordSize(payload_size) <= capacity_ / 2;
+}
+
+bool LogRingBuffer::TryPush(Level level, TimePoint time,
+                            std::string_view payload) noexcept {
+  UASSERT(IsFitting(payload.size()));
+  return TryPushRecord(level, time, static_cast<std::uint32_t>(payload.size()),
+                       payload.data(), payload.size());
+}
+
+bool LogRingBuffer::TryPushExternal(
+    Level level, TimePoint time,
+    std::unique_ptr<std::string>& payload) noexcept {
+  UASSERT(payload);
+  auto* const raw_payload = payload.get();
+  if (!TryPushRecord(level, time, kExternalSize, &raw_payload,
+                     sizeof(raw_payload))) {
+    return false;
+  }
+  [[maybe_unused]] auto* const released = payload.release();
+  return true;
+}
+
+bool LogRingBuffer::TryPushRecord(Level level, TimePoint time,
+                                  std::uint32_t size_field, const void* data,
+                                  std::size_t data_size) noexcept {
+  const auto record_size = GetRecordSize(data_size);
+  auto tail = tail_->load(std::memory_order_relaxed);
+  const auto head = head_->load(std::memory_order_acquire);
+
+  const auto offset = tail & (capacity_ - 1);
+  const auto space_till_end = capacity_ - offset;
+  const auto padding_size = record_size > space_till_end ? space_till_end : 0;
+
+  if (tail + padding_size + record_size - head > capacity_) return false;
+
+  if (padding_size != 0) {
+    WriteHeader(tail, Header{kPaddingSize, level, 0});
+    tail += padding_size;
+  }
+
+  const auto time_since_epoch =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          time.time_since_epoch())
+          .count();
+  WriteHeader(tail, Header{size_field, level,
+                           static_cast<std::int64_t>(time_since_epoch)});
+  std::memcpy(data_.get() + (tail & (capacity_ - 1)) + sizeof(Header), data,
+              data_size);
+
+  tail_->store(tail + record_size, std::memory_order_release);
+  return true;
+}
+
+std::size_t LogRingBuffer::GetRecordSize(std::size_t payload_size) noexcept {
+  const auto size = sizeof(Header) + payload_size;
+  return (size + kRecordAlignment - 1) / kRecordAlignment * kRecordAlignment;
+}
+
+void LogRingBuffer::WriteHeader(std::uint64_t position,
+                                const Header& header) noexcept {
+  std::memcpy(data_.get() + (position & (capacity_ - 1)), &header,
+              sizeof(header));
+}
+
+LogRingBuffer::Header LogRingBuffer::ReadHeader(
+    std::uint64_t position) const noexcept {
+  Header header{};
+  std::memcpy(&header, data_.get() + (position & (capacity_ - 1)),
+              sizeof(header));
+  return header;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Single-producer single-consumer ring buffer of log records
+///
+/// The records are stored contiguously as a header followed by the payload,
+/// so pushing a record does not allocate. A record that does not fit into
+/// the tail of the buffer is preceded by a padding that wraps the buffer
+/// around. A payload that is not fitting is stored on the heap and the
+/// record holds only the pointer to it.
+class LogRingBuffer final {
+ public:
+  using TimePoint = std::chrono::system_clock::time_point;
+
+  /// @param capacity size in bytes, must be a power of 2
+  explicit LogRingBuffer(std::size_t capacity);
+  ~LogRingBuffer();
+
+  /// Returns whether a record with the payload may be pushed by TryPush
+  bool IsFitting(std::size_t payload_size) const noexcept;
+
+  /// Producer side. Returns false if there is not enough free space.
+  bool TryPush(Level level, TimePoint time, std::string_view payload) noexcept;
+
+  /// Producer side, for the payloads that are not fitting. Takes the ownership
+  /// of `payload` only on success, returns false if there is not enough free
+  /// space.
+  bool TryPushExternal(Level level, TimePoint time,
+                       std::unique_ptr<std::string>& payload) noexcept;
+
+  /// Consumer side. Calls `func(level, time, payload)` for the records pushed
+  /// so far, returns the count of the consumed records.
+  template <typename Func>
+  std::size_t ConsumeAll(Func&& func);
+
+ private:
+  struct Header final {
+    // kPaddingSize for the padding up to the end of the buffer,
+    // kExternalSize for the pointer to the payload on the heap
+    std::uint32_t payload_size;
+    Level level;
+    std::int64_t time_since_epoch;
+  };
+
+  static constexpr auto kPaddingSize = static_cast<std::uint32_t>(-1);
+  static constexpr auto kExternalSize = kPaddingSize - 1;
+  // Each record is aligned by the header size, so there is always enough
+  // space for the padding header at the end of the buffer.
+  static constexpr std::size_t kRecordAlignment = sizeof(Header);
+
+  static std::size_t GetRecordSize(std::size_t payload_size) noexcept;
+
+  bool TryPushRecord(Level level, TimePoint time, std::uint32_t size_field,
+                     const void* data, std::size_t data_size) noexcept;
+
+  void WriteHeader(std::uint64_t position, const Header& header) noexcept;
+  Header ReadHeader(std::uint64_t position) const noexcept;
+
+  const std::size_t capacity_;
+  const std::unique_ptr<char[]> data_;
+
+  // Monotonic positions, the offset in data_ is `position & (capacity_ - 1)`
+  concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> head_{0};
+  concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> tail_{0};
+};
+
+template <typename Func>
+std::size_t LogRingBuffer::ConsumeAll(Func&& func) {
+  const auto tail = tail_->load(std::memory_order_acquire);
+  auto head = head_->load(std::memory_order_relaxed);
+  std::size_t count = 0;
+
+  // Free the space of the consumed records even if `func` throws
+  const utils::FastScopeGuard release_guard([this, &head]() noexcept {
+    head_->store(head, std::memory_order_release);
+  });
+
+  while (head != tail) {
+    const auto header = ReadHeader(head);
+    const auto offset = head & (capacity_ - 1);
+    if (header.payload_size == kPaddingSize) {
+      head += capacity_ - offset;
+      continue;
+    }
+
+    const auto* data = data_.get() + offset + sizeof(Header);
+    const TimePoint time{std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::nanoseconds{header.time_since_epoch})};
+
+    if (header.payload_size == kExternalSize) {
+      std::string* raw_payload = nullptr;
+      std::memcpy(&raw_payload, data, sizeof(raw_payload));
+      head += GetRecordSize(sizeof(raw_payload));
+      // The record is released before `func` is called, so that the
+      // payload is freed even if `func` throws
+      const std::unique_ptr<std::string> payload{raw_payload};
+      ++count;
+      func(header.level, time, std::string_view{*payload});
+      continue;
+    }
+
+    const std::string_view payload{data, header.payload_size};
+    func(header.level, time, payload);
+
+    head += GetRecordSize(header.payload_size);
+    ++count;
+  }
+
+  return count;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
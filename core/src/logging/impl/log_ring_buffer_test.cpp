@@ -0,0 +1,139 @@
+#include <logging/impl/log_ring_buffer.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using logging::Level;
+using logging::impl::LogRingBuffer;
+
+struct Record {
+  Level level;
+  LogRingBuffer::TimePoint time;
+  std::string payload;
+};
+
+std::vector<Record> ConsumeAll(LogRingBuffer& buffer) {
+  std::vector<Record> records;
+  buffer.ConsumeAll([&records](Level level, LogRingBuffer::TimePoint time,
+                               std::string_view payload) {
+    records.push_back({level, time, std::string{payload}});
+  });
+  return records;
+}
+
+}  // namespace
+
+TEST(LogRingBuffer, Basic) {
+  LogRingBuffer buffer{1024};
+  const auto now = std::chrono::system_clock::now();
+
+  EXPECT_TRUE(ConsumeAll(buffer).empty());
+
+  EXPECT_TRUE(buffer.TryPush(Level::kInfo, now, "first"));
+  EXPECT_TRUE(buffer.TryPush(Level::kError, now, ""));
+
+  const auto records = ConsumeAll(buffer);
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].level, Level::kInfo);
+  EXPECT_EQ(records[0].time, now);
+  EXPECT_EQ(records[0].payload, "first");
+  EXPECT_EQ(records[1].level, Level::kError);
+  EXPECT_EQ(records[1].payload, "");
+
+  EXPECT_TRUE(ConsumeAll(buffer).empty());
+}
+
+TEST(LogRingBuffer, Fitting) {
+  LogRingBuffer buffer{256};
+  EXPECT_TRUE(buffer.IsFitting(0));
+  EXPECT_TRUE(buffer.IsFitting(100));
+  EXPECT_FALSE(buffer.IsFitting(200));
+}
+
+TEST(LogRingBuffer, Overflow) {
+  LogRingBuffer buffer{256};
+  const auto now = std::chrono::system_clock::now();
+  const std::string payload(100, 'a');
+
+  EXPECT_TRUE(buffer.TryPush(Level::kInfo, now, payload));
+  EXPECT_TRUE(buffer.TryPush(Level::kInfo, now, payload));
+  EXPECT_FALSE(buffer.TryPush(Level::kInfo, now, payload));
+
+  EXPECT_EQ(ConsumeAll(buffer).size(), 2);
+  EXPECT_TRUE(buffer.TryPush(Level::kInfo, now, payload));
+}
+
+TEST(LogRingBuffer, WrapAround) {
+  LogRingBuffer buffer{256};
+  const auto now = std::chrono::system_clock::now();
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    // sizes not dividing the capacity make the records wrap around the end
+    const std::string payload(i % 90, static_cast<char>('a' + i % 26));
+    ASSERT_TRUE(buffer.TryPush(Level::kWarning, now, payload));
+
+    const auto records = ConsumeAll(buffer);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].payload, payload);
+  }
+}
+
+TEST(LogRingBuffer, External) {
+  LogRingBuffer buffer{64};
+  const auto now = std::chrono::system_clock::now();
+  const std::string large_payload(1000, 'x');
+  ASSERT_FALSE(buffer.IsFitting(large_payload.size()));
+
+  auto payload = std::make_unique<std::string>(large_payload);
+  EXPECT_TRUE(buffer.TryPush(Level::kInfo, now, "before"));
+  EXPECT_TRUE(buffer.TryPushExternal(Level::kError, now, payload));
+  EXPECT_FALSE(payload);
+
+  payload = std::make_unique<std::string>(large_payload);
+  EXPECT_FALSE(buffer.TryPushExternal(Level::kError, now, payload));
+  EXPECT_TRUE(payload) << "The payload is kept on failure";
+
+  const auto records = ConsumeAll(buffer);
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].payload, "before");
+  EXPECT_EQ(records[1].level, Level::kError);
+  EXPECT_EQ(records[1].payload, large_payload);
+
+  // The payloads that are left in the buffer are freed by the destructor
+  EXPECT_TRUE(buffer.TryPushExternal(Level::kError, now, payload));
+}
+
+TEST(LogRingBuffer, ProducerConsumer) {
+  constexpr std::size_t kRecordsCount = 100000;
+  LogRingBuffer buffer{4096};
+
+  std::thread producer([&buffer] {
+    for (std::size_t i = 0; i < kRecordsCount; ++i) {
+      const auto payload = std::to_string(i);
+      while (!buffer.TryPush(Level::kInfo, {}, payload)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::size_t expected = 0;
+  while (expected < kRecordsCount) {
+    buffer.ConsumeAll([&expected](Level, auto, std::string_view payload) {
+      EXPECT_EQ(payload, std::to_string(expected));
+      ++expected;
+    });
+  }
+
+  producer.join();
+  EXPECT_TRUE(ConsumeAll(buffer).empty());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#include "shipping_sink.hpp"
+
+#include <exception>
+#include <utility>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+ShippingSink::ShippingSink(std::vector<engine::io::Sockaddr> addrs,
+                           ShippingConfig config,
+                           statistics::ShippingStatistics& stats)
+    : addrs_(std::move(addrs)), config_(std::move(config)), stats_(stats) {}
+
+void ShippingSink::Flush() {
+  const std::lock_guard lock{mutex_};
+  ShipFrame();
+  SendPending();
+}
+
+void ShippingSink::Write(std::string_view log) {
+  const std::lock_guard lock{mutex_};
+  if (config_.protocol == ShippingProtocol::kUdp &&
+      log.size() > config_.max_frame_size) {
+    // does not fit into a datagram
+    ++stats_.dropped_records;
+    return;
+  }
+
+  if (!frame_.data.empty() &&
+      frame_.data.size() + log.size() > config_.max_frame_size) {
+    ShipFrame();
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  if (frame_.data.empty()) {
+    frame_.data.reserve(config_.max_frame_size);
+    frame_start_ = now;
+  }
+  frame_.data.append(log);
+  ++frame_.records;
+
+  if (frame_.data.size() >= config_.max_frame_size ||
+      now - frame_start_ >= config_.max_frame_delay) {
+    ShipFrame();
+  }
+  if (!pending_.empty()) SendPending();
+}
+
+void ShippingSink::ShipFrame() {
+  if (frame_.data.empty()) return;
+
+  auto frame = std::exchange(frame_, Frame{});
+  if (config_.compression) {
+    try {
+      frame.data = compression::Compress(*config_.compression, {}, frame.data);
+    } catch (const std::exception&) {
+      stats_.dropped_records += utils::statistics::Rate{frame.records};
+      return;
+    }
+  }
+
+  pending_size_ += frame.data.size();
+  pending_.push_back(std::move(frame));
+  while (pending_size_ > config_.max_spill_size) {
+    auto& oldest = pending_.front();
+    stats_.dropped_records += utils::statistics::Rate{oldest.records};
+    pending_size_ -= oldest.data.size();
+    pending_.pop_front();
+  }
+}
+
+void ShippingSink::SendPending() {
+  // sockets require a coroutine, e.g. the records logged before the logger
+  // task is started wait for it in the spill buffer
+  if (!engine::current_task::IsTaskProcessorThread()) return;
+
+  while (!pending_.empty() && EnsureConnected()) {
+    auto& frame = pending_.front();
+    try {
+      const auto sent_bytes = socket_.SendAll(
+          frame.data.data(), frame.data.size(),
+          engine::Deadline::FromDuration(config_.io_timeout));
+      if (sent_bytes != frame.data.size()) {
+        // closed by the agent, the frame is resent after a reconnect
+        socket_.Close();
+        return;
+      }
+    } catch (const std::exception&) {
+      socket_.Close();
+      return;
+    }
+
+    ++stats_.sent_frames;
+    stats_.sent_bytes += utils::statistics::Rate{frame.data.size()};
+    pending_size_ -= frame.data.size();
+    pending_.pop_front();
+  }
+}
+
+bool ShippingSink::EnsureConnected() {
+  if (socket_) return true;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now < next_connect_time_) return false;
+  next_connect_time_ = now + config_.reconnect_interval;
+
+  const auto type = config_.protocol == ShippingProtocol::kUdp
+                        ? engine::io::SocketType::kDgram
+                        : engine::io::SocketType::kStream;
+  for (const auto& addr : addrs_) {
+    try {
+      engine::io::Socket socket{addr.Domain(), type};
+      socket.Connect(addr, engine::Deadline::FromDuration(config_.io_timeout));
+      socket_ = std::move(socket);
+      ++stats_.reconnects;
+      return true;
+    } catch (const std::exception&) {
+      continue;
+    }
+  }
+  return false;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <logging/config.hpp>
+#include <logging/impl/base_sink.hpp>
+#include <logging/statistics/log_stats.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/io/socket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// Ships the records to a log agent over TCP or UDP in frames of many
+/// records, a frame per write or datagram. If the compression is set, each
+/// frame is compressed separately.
+///
+/// A frame is sent once it reaches `max_frame_size`, on Flush() or with the
+/// first record after `max_frame_delay`. The frames that could not be sent
+/// are kept in a spill buffer of at most `max_spill_size` bytes and are
+/// resent as a whole after a reconnect, the oldest ones are dropped on
+/// overflow. Connects are attempted at most once per `reconnect_interval`,
+/// so an unavailable agent does not block the logger.
+class ShippingSink final : public BaseSink {
+ public:
+  ShippingSink(std::vector<engine::io::Sockaddr> addrs, ShippingConfig config,
+               statistics::ShippingStatistics& stats);
+
+  void Flush() override;
+
+ protected:
+  void Write(std::string_view log) final;
+
+ private:
+  struct Frame {
+    std::string data;
+    std::size_t records{0};
+  };
+
+  void ShipFrame();
+  void SendPending();
+  bool EnsureConnected();
+
+  const std::vector<engine::io::Sockaddr> addrs_;
+  const ShippingConfig config_;
+  statistics::ShippingStatistics& stats_;
+
+  std::mutex mutex_;
+  Frame frame_;
+  std::chrono::steady_clock::time_point frame_start_;
+  std::deque<Frame> pending_;
+  std::size_t pending_size_{0};
+  engine::io::Socket socket_;
+  std::chrono::steady_clock::time_point next_connect_time_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
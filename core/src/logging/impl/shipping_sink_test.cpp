@@ -0,0 +1,121 @@
+#include "shipping_sink.hpp"
+
+#include <array>
+#include <optional>
+#include <string>
+
+#include <compression/gzip.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+
+#include "sink_helper_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+logging::ShippingConfig MakeConfig() {
+  logging::ShippingConfig config;
+  config.max_frame_delay = std::chrono::hours{1};
+  config.reconnect_interval = std::chrono::milliseconds{0};
+  config.io_timeout = utest::kMaxTestWaitTime;
+  return config;
+}
+
+std::string ReadAll(engine::io::Socket&& socket, engine::Deadline deadline) {
+  std::array<char, 1024> buf{};
+  std::string data;
+  while (const auto read_size =
+             socket.RecvSome(buf.data(), buf.size(), deadline)) {
+    data.append(buf.data(), read_size);
+  }
+  return data;
+}
+
+}  // namespace
+
+UTEST(ShippingSink, Batching) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  internal::net::TcpListener listener(internal::net::IpVersion::kV4);
+  logging::statistics::ShippingStatistics stats;
+
+  std::optional<logging::impl::ShippingSink> sink;
+  sink.emplace(std::vector{listener.addr}, MakeConfig(), stats);
+  sink->Log({"default", spdlog::level::warn, "message"});
+  sink->Log({"basic", spdlog::level::info, "message 2"});
+  EXPECT_EQ(stats.sent_frames.Load().value, 0U);
+
+  sink->Flush();
+  EXPECT_EQ(stats.sent_frames.Load().value, 1U);
+  EXPECT_EQ(stats.reconnects.Load().value, 1U);
+  sink.reset();
+
+  const auto logs = test::ReadFromSocket(listener.socket.Accept(deadline));
+  ASSERT_EQ(logs.size(), 2);
+  EXPECT_EQ(logs[0], "[datetime] [default] [warning] message");
+  EXPECT_EQ(logs[1], "[datetime] [basic] [info] message 2");
+}
+
+UTEST(ShippingSink, MaxFrameSize) {
+  internal::net::TcpListener listener(internal::net::IpVersion::kV4);
+  logging::statistics::ShippingStatistics stats;
+
+  auto config = MakeConfig();
+  config.max_frame_size = 60;
+  logging::impl::ShippingSink sink{{listener.addr}, config, stats};
+  sink.Log({"default", spdlog::level::warn, "message 1"});
+  sink.Log({"default", spdlog::level::warn, "message 2"});
+  sink.Log({"default", spdlog::level::warn, "message 3"});
+  EXPECT_EQ(stats.sent_frames.Load().value, 2U);
+
+  sink.Flush();
+  EXPECT_EQ(stats.sent_frames.Load().value, 3U);
+}
+
+UTEST(ShippingSink, SpillOverflow) {
+  std::optional<internal::net::TcpListener> listener;
+  listener.emplace(internal::net::IpVersion::kV4);
+  const auto addr = listener->addr;
+  listener.reset();
+  logging::statistics::ShippingStatistics stats;
+
+  auto config = MakeConfig();
+  config.max_spill_size = 100;
+  logging::impl::ShippingSink sink{{addr}, config, stats};
+  sink.Log({"default", spdlog::level::warn, "message 1"});
+  sink.Flush();
+  EXPECT_EQ(stats.dropped_records.Load().value, 0U);
+
+  for (int i = 0; i < 10; ++i) {
+    sink.Log({"default", spdlog::level::warn, "message 2"});
+    sink.Flush();
+  }
+  EXPECT_GT(stats.dropped_records.Load().value, 0U);
+  EXPECT_EQ(stats.sent_frames.Load().value, 0U);
+  EXPECT_EQ(stats.reconnects.Load().value, 0U);
+}
+
+UTEST(ShippingSink, Compression) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  internal::net::TcpListener listener(internal::net::IpVersion::kV4);
+  logging::statistics::ShippingStatistics stats;
+
+  auto config = MakeConfig();
+  config.compression = compression::Encoding::kGzip;
+  std::optional<logging::impl::ShippingSink> sink;
+  sink.emplace(std::vector{listener.addr}, config, stats);
+  sink->Log({"default", spdlog::level::warn, "message"});
+  sink->Log({"basic", spdlog::level::info, "message 2"});
+  sink->Flush();
+  sink.reset();
+
+  const auto compressed = ReadAll(listener.socket.Accept(deadline), deadline);
+  EXPECT_EQ(stats.sent_bytes.Load().value, compressed.size());
+  const auto logs =
+      test::NormalizeLogs(compression::gzip::Decompress(compressed, 1024));
+  ASSERT_EQ(logs.size(), 2);
+  EXPECT_EQ(logs[0], "[datetime] [default] [warning] message");
+  EXPECT_EQ(logs[1], "[datetime] [basic] [info] message 2");
+}
+
+USERVER_NAMESPACE_END
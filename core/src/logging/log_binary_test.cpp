@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include <logging/binary_record.hpp>
+#include <logging/logging_test.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST_F(LoggingBinaryTest, Basic) {
+  constexpr auto kTextToLog = "This is the binary text to log";
+  LOG_INFO() << kTextToLog;
+
+  EXPECT_EQ(LoggedText(), kTextToLog);
+
+  auto str = GetStreamString();
+  EXPECT_NE(str.find("\tmodule="), std::string::npos) << str;
+  EXPECT_NE(str.find("timestamp="), std::string::npos) << str;
+  EXPECT_NE(str.find("\tthread_id="), std::string::npos) << str;
+  EXPECT_NE(str.find("\tlevel="), std::string::npos) << str;
+  EXPECT_EQ(GetRecordsCount(), 1);
+}
+
+TEST_F(LoggingBinaryTest, EscapedOnTheLoggerSide) {
+  LOG_INFO() << "tab\there, newline\nthere"
+             << logging::LogExtra{{"some.key", "value\twith tab"}};
+  logging::LogFlush();
+
+  const auto str = GetStreamString();
+  EXPECT_NE(str.find("text=tab\\there, newline\\nthere"), std::string::npos)
+      << str;
+  EXPECT_NE(str.find("\tsome_key=value\\twith tab"), std::string::npos)
+      << str;
+  EXPECT_EQ(GetRecordsCount(), 1);
+}
+
+TEST_F(LoggingBinaryTest, SameAsTskv) {
+  auto tskv_logger = MakeNamedStreamLogger("tskv", logging::Format::kTskv);
+
+  const auto log = [](logging::LoggerRef logger) {
+    LOG_INFO_TO(logger) << "text with = and \\ and \t"
+                        << logging::LogExtra{{"a", 42}, {"b", "c"}};
+  };
+
+  log(*GetStreamLogger());
+  log(*tskv_logger.logger);
+  logging::LogFlush();
+  logging::LogFlush(*tskv_logger.logger);
+
+  // Timestamps, thread ids and the source lines differ, compare the rest
+  const auto cut_prefix = [](std::string_view record) {
+    return std::string{record.substr(record.find("\ttext="))};
+  };
+  EXPECT_EQ(cut_prefix(GetStreamString()),
+            cut_prefix(tskv_logger.stream.str()));
+}
+
+TEST(LoggingBinaryRecords, Decodable) {
+  auto sink = std::make_unique<StringSink>();
+  sink->SetBinaryRecords(true);
+  auto& stream = sink->GetStream();
+  auto logger = MakeLoggerFromSink("binary-records", std::move(sink),
+                                   logging::Format::kBinary);
+
+  LOG_WARNING_TO(*logger) << "text\twith tab";
+  logging::LogFlush(*logger);
+
+  const auto record = stream.str();
+  std::string_view rest = record;
+
+  std::uint32_t record_size{};
+  ASSERT_GE(rest.size(), sizeof(record_size));
+  std::memcpy(&record_size, rest.data(), sizeof(record_size));
+  rest.remove_prefix(sizeof(record_size));
+  ASSERT_EQ(rest.size(), record_size);
+
+  std::uint8_t level{};
+  std::memcpy(&level, rest.data(), sizeof(level));
+  EXPECT_EQ(static_cast<logging::Level>(level), logging::Level::kWarning);
+  rest.remove_prefix(sizeof(level) + sizeof(std::int64_t));
+
+  std::string text;
+  EXPECT_TRUE(logging::impl::ForEachBinaryField(
+      rest, [&text](std::string_view key, std::string_view value) {
+        if (key == "text") text = value;
+      }));
+  EXPECT_EQ(text, "text\twith tab");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,28 @@
+#include "log_sampling_config.hpp"
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+bool operator==(const LogSamplingConfig& a, const LogSamplingConfig& b) {
+  return a.levels == b.levels && a.locations == b.locations;
+}
+
+LogSamplingConfig Parse(const formats::json::Value& value,
+                        formats::parse::To<LogSamplingConfig>) {
+  using Ratios = std::unordered_map<std::string, double>;
+
+  LogSamplingConfig config;
+  for (const auto& [level, ratio] : value["levels"].As<Ratios>({})) {
+    config.levels.emplace(LevelFromString(level), ratio);
+  }
+  config.locations = value["locations"].As<Ratios>({});
+  return config;
+}
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+struct LogSamplingConfig {
+  // ratios of the messages to keep
+  std::unordered_map<Level, double> levels;
+  std::unordered_map<std::string, double> locations;
+};
+
+bool operator==(const LogSamplingConfig& a, const LogSamplingConfig& b);
+
+LogSamplingConfig Parse(const formats::json::Value& value,
+                        formats::parse::To<LogSamplingConfig>);
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
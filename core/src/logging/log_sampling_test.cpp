@@ -0,0 +1,159 @@
+#include <userver/utest/utest.hpp>
+
+#include <gmock/gmock.h>
+
+#include <logging/dynamic_debug.hpp>
+#include <logging/log_sampling.hpp>
+#include <logging/logging_test.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/uuid4.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+auto MakeSamplingResetGuard() {
+  return utils::FastScopeGuard([]() noexcept {
+    try {
+      logging::ResetLogSampling();
+    } catch (const std::exception& e) {
+      ADD_FAILURE() << e.what();
+    }
+  });
+}
+
+std::uint64_t GetSampledOut(const std::string& path, int line) {
+  std::uint64_t result = 0;
+  logging::ForEachLogLocation(
+      path, line, [&result](logging::LogEntryContent& location) {
+        result += location.sampled_out.load();
+      });
+  return result;
+}
+
+class LoggingSamplingCoro : public LoggingTest {};
+
+}  // namespace
+
+TEST_F(LoggingTest, SamplingLevel) {
+  const auto guard = MakeSamplingResetGuard();
+  const std::string filename{USERVER_FILEPATH};
+
+  const auto do_log = [](std::string_view string) {
+#line 30001
+    LOG_INFO() << string;
+  };
+
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 0);
+  do_log("dropped");
+  LOG_WARNING() << "warning";
+
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 1);
+  do_log("kept");
+
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("dropped")));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("warning"));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("kept"));
+  EXPECT_EQ(GetSampledOut(filename, 30001), 1);
+}
+
+TEST_F(LoggingTest, SamplingLocationOverridesLevel) {
+  const auto guard = MakeSamplingResetGuard();
+  const std::string filename{USERVER_FILEPATH};
+
+  const auto do_log = [](std::string_view string) {
+#line 40001
+    LOG_INFO() << string;
+  };
+
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 0);
+  logging::SetLocationSamplingRatio(filename, 40001, 1);
+
+  do_log("location");
+  LOG_INFO() << "unrelated";
+
+  logging::SetLocationSamplingRatio(filename, 40001, 0);
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 1);
+  do_log("dropped");
+
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("location"));
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("unrelated")));
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("dropped")));
+}
+
+TEST_F(LoggingTest, SamplingNotEvaluated) {
+  const auto guard = MakeSamplingResetGuard();
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 0);
+
+  bool is_evaluated = false;
+  const auto evaluate = [&is_evaluated] {
+    is_evaluated = true;
+    return "evaluated";
+  };
+  LOG_INFO() << evaluate();
+
+  EXPECT_FALSE(is_evaluated);
+  EXPECT_EQ(GetRecordsCount(), 0);
+}
+
+TEST_F(LoggingTest, SamplingForceEnabled) {
+  const auto guard = MakeSamplingResetGuard();
+  const std::string filename{USERVER_FILEPATH};
+
+  const auto do_log = [](std::string_view string) {
+#line 50001
+    LOG_INFO() << string;
+  };
+
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 0);
+  logging::AddDynamicDebugLog(filename, 50001);
+  do_log("forced");
+  logging::RemoveDynamicDebugLog(filename, 50001);
+
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("forced"));
+}
+
+TEST_F(LoggingTest, SamplingInvalidRatio) {
+  EXPECT_ANY_THROW(logging::SetLevelSamplingRatio(logging::Level::kInfo, 2));
+  EXPECT_ANY_THROW(logging::SetLevelSamplingRatio(logging::Level::kInfo, -1));
+}
+
+UTEST_F(LoggingSamplingCoro, SamplingTraceConsistent) {
+  const auto guard = MakeSamplingResetGuard();
+  constexpr std::size_t kSpans = 40;
+  constexpr std::size_t kMessages = 10;
+
+  logging::SetLevelSamplingRatio(logging::Level::kInfo, 0.5);
+
+  for (std::size_t span_index = 0; span_index < kSpans; ++span_index) {
+    // A child of the test span would share its trace id
+    auto span = tracing::Span::MakeSpan(
+        "sampled", utils::generators::GenerateUuid(), /*parent_span_id=*/"");
+    for (std::size_t i = 0; i < kMessages; ++i) {
+      LOG_INFO() << "span" << span_index << " message" << i;
+    }
+  }
+  logging::LogFlush();
+
+  const auto logs = GetStreamString();
+  std::size_t kept_spans = 0;
+  for (std::size_t span_index = 0; span_index < kSpans; ++span_index) {
+    std::size_t kept_messages = 0;
+    for (std::size_t i = 0; i < kMessages; ++i) {
+      if (logs.find(fmt::format("span{} message{}\t", span_index, i)) !=
+          std::string::npos) {
+        ++kept_messages;
+      }
+    }
+    EXPECT_TRUE(kept_messages == 0 || kept_messages == kMessages)
+        << kept_messages << " messages of span #" << span_index;
+    if (kept_messages != 0) ++kept_spans;
+  }
+
+  // the chance of a failure is 2^-39
+  EXPECT_NE(kept_spans, 0);
+  EXPECT_NE(kept_spans, kSpans);
+}
+
+USERVER_NAMESPACE_END
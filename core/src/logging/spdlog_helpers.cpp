@@ -15,6 +15,8 @@ const std::string& GetSpdlogPattern(Format format) {
 
   switch (format) {
     case Format::kTskv:
+    // the fields are rendered into TSKV by TpLogger
+    case Format::kBinary:
       return kSpdlogTskvPattern;
     case Format::kLtsv:
       return kSpdlogLtsvPattern;
@@ -6,6 +6,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::statistics {
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ShippingStatistics& stats) {
+  writer["sent_frames"] = stats.sent_frames;
+  writer["sent_bytes"] = stats.sent_bytes;
+  writer["dropped_records"] = stats.dropped_records;
+  writer["reconnects"] = stats.reconnects;
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats) {
   writer["dropped"].ValueWithLabels(stats.dropped, {"version", "2"});
 
@@ -19,6 +27,8 @@ void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats) {
   }
 
   writer["total"] = total;
+
+  if (stats.shipping) writer["shipping"] = *stats.shipping;
 }
 
 }  // namespace logging::statistics
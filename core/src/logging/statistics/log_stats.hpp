@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <optional>
 
 #include <userver/logging/level.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
@@ -12,12 +13,26 @@ namespace logging::statistics {
 
 using Counter = utils::statistics::RateCounter;
 
+// see logging::impl::ShippingSink
+struct ShippingStatistics final {
+  Counter sent_frames{};
+  Counter sent_bytes{};
+  Counter dropped_records{};
+  Counter reconnects{};
+};
+
 struct LogStatistics final {
   Counter dropped{};
 
   std::array<Counter, kLevelMax + 1> by_level{};
+
+  // set up by the shipping sink of the logger, if there is one
+  std::optional<ShippingStatistics> shipping;
 };
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ShippingStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats);
 
 }  // namespace logging::statistics
@@ -1,12 +1,21 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+
 #include <fmt/format.h>
 #include <spdlog/common.h>
 #include <spdlog/spdlog.h>
 
+#include <compiler/relax_cpu.hpp>
+#include <compiler/tls.hpp>
 #include <engine/task/task_context.hpp>
+#include <logging/binary_record.hpp>
 #include <logging/spdlog_helpers.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
@@ -17,12 +26,44 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr auto kNoThreadIndex = static_cast<std::size_t>(-1);
+
+std::atomic<std::size_t> threads_count{0};
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t thread_index = kNoThreadIndex;
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetThreadIndex() noexcept {
+  if (thread_index == kNoThreadIndex) {
+    thread_index = threads_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  return thread_index;
+}
+
+}  // namespace
+
+namespace async {
+
+ThreadBuffer::ThreadBuffer(std::size_t size) : ring(size) {
+  drain_node.action = DrainThreadBuffer{this};
+}
+
+}  // namespace async
+
 struct TpLogger::ActionVisitor final {
   TpLogger& logger;
 
   void operator()(impl::async::Log&& log) const {
     logger.AccountLogConsumed();
-    logger.BackendLog(std::move(log));
+    logger.BackendLog(log.level, log.time, log.payload);
+    if (logger.ShouldFlush(log.level)) {
+      logger.BackendFlush();
+    }
+  }
+
+  void operator()(impl::async::DrainThreadBuffer&& drain) const noexcept {
+    logger.BackendDrain(*drain.buffer);
   }
 
   void operator()(impl::async::Stop&&) const noexcept {
@@ -50,12 +91,25 @@ TpLogger::TpLogger(Format format, std::string logger_name)
 
 void TpLogger::StartConsumerTask(engine::TaskProcessor& task_processor,
                                  std::size_t max_queue_size,
-                                 QueueOverflowBehavior overflow_policy) {
+                                 QueueOverflowBehavior overflow_policy,
+                                 std::size_t thread_buffer_size) {
   UINVARIANT(max_queue_size != 0 && max_queue_size <= (std::size_t{1} << 31),
              "Invalid max queue size");
   max_queue_size_.store(max_queue_size);
   overflow_policy_.store(overflow_policy);
 
+  if (thread_buffer_size != 0 && thread_buffers_.empty() &&
+      state_.load() == State::kSync) {
+    // Log() reads thread_buffers_ only after observing State::kAsync
+    const auto buffers_count =
+        std::max(std::thread::hardware_concurrency(), 1U);
+    thread_buffers_.reserve(buffers_count);
+    for (std::size_t i = 0; i < buffers_count; ++i) {
+      thread_buffers_.push_back(
+          std::make_unique<impl::async::ThreadBuffer>(thread_buffer_size));
+    }
+  }
+
   auto expected = State::kSync;
   const bool success = state_.compare_exchange_strong(expected, State::kAsync);
   UINVARIANT(success, "Logger can only be switched to async mode once");
@@ -131,6 +185,11 @@ void TpLogger::Log(Level level, std::string_view msg) {
     return;
   }
 
+  if (state_.load() == State::kAsync && !thread_buffers_.empty()) {
+    PushToThreadBuffer(level, msg);
+    return;
+  }
+
   impl::async::Log action{level, std::string{msg}};
 
   if (TryWaitFreeQueueCapacity()) {
@@ -170,6 +229,12 @@ bool TpLogger::ShouldLog(Level level) const noexcept {
   return true;
 }
 
+std::optional<std::uint64_t> TpLogger::GetSamplingKey() const noexcept {
+  const auto* const span = tracing::Span::CurrentSpanUnchecked();
+  if (!span) return std::nullopt;
+  return std::hash<std::string_view>{}(span->GetTraceId());
+}
+
 void TpLogger::AddSink(impl::SinkPtr&& sink) {
   UASSERT(sink);
   sink->SetLevel(Level::kTrace);  // Always on
@@ -251,6 +316,56 @@ void TpLogger::Push(impl::async::Action&& action) {
   DoPush(*node.release());
 }
 
+void TpLogger::PushToThreadBuffer(Level level, std::string_view msg) {
+  auto& buffer = *thread_buffers_[GetThreadIndex() % thread_buffers_.size()];
+  // A large record is kept on the heap, but it still goes through the buffer.
+  // Through the queue it would get ahead of the next records of the thread,
+  // which are drained by the drain_node that was pushed before it.
+  std::unique_ptr<std::string> external_msg;
+  if (!buffer.ring.IsFitting(msg.size())) {
+    external_msg = std::make_unique<std::string>(msg);
+  }
+
+  const auto time = std::chrono::system_clock::now();
+  const auto try_push = [&buffer, &external_msg, level, time, msg] {
+    compiler::RelaxCpu relax;
+    while (buffer.producer_lock.test_and_set(std::memory_order_acquire)) {
+      relax();
+    }
+    const bool success =
+        external_msg ? buffer.ring.TryPushExternal(level, time, external_msg)
+                     : buffer.ring.TryPush(level, time, msg);
+    buffer.producer_lock.clear(std::memory_order_release);
+    return success;
+  };
+
+  if (!try_push()) {
+    // Do not do blocking push if we are not in a coroutine context.
+    if (overflow_policy_.load() != QueueOverflowBehavior::kBlock ||
+        !engine::current_task::IsTaskProcessorThread()) {
+      ++stats_.dropped;
+      return;
+    }
+
+    // The buffer is not empty, so the drain is already scheduled
+    const engine::TaskCancellationBlocker block_cancel;
+    std::unique_lock lock{capacity_waiters_mutex_};
+    [[maybe_unused]] const bool success =
+        buffer_waiters_cv_.Wait(lock, try_push);
+    UASSERT(success);
+  }
+
+  ScheduleDrain(buffer);
+}
+
+void TpLogger::ScheduleDrain(impl::async::ThreadBuffer& buffer) noexcept {
+  // BackendDrain resets the flag before reading the buffer, so the record is
+  // either seen by the running drain or by the newly pushed drain_node.
+  if (!buffer.is_drain_scheduled.exchange(true, std::memory_order_acq_rel)) {
+    DoPush(buffer.drain_node);
+  }
+}
+
 void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   auto consumer = queue_.PushAndTryStartConsuming(node);
   if (consumer.IsValid()) {
@@ -280,8 +395,13 @@ void TpLogger::ConsumeNode(
   auto& action_node = static_cast<impl::async::ActionNode&>(node);
   if (&action_node == &stop_node_) return;
 
+  // drain_node is owned by its ThreadBuffer and may be pushed again as soon
+  // as the drain starts
+  const bool is_owned_node =
+      std::holds_alternative<impl::async::DrainThreadBuffer>(
+          action_node.action);
   BackendPerform(std::move(action_node.action));
-  delete &action_node;
+  if (!is_owned_node) delete &action_node;
 }
 
 void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
@@ -295,12 +415,20 @@ void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
       [this](auto& node) noexcept { ConsumeNode(node); });
 }
 
-void TpLogger::BackendLog(impl::async::Log&& action) const {
+void TpLogger::BackendLog(Level level,
+                          std::chrono::system_clock::time_point time,
+                          std::string_view payload) const {
   spdlog::details::log_msg msg{};
   msg.logger_name = GetLoggerName();
-  msg.level = ToSpdlogLevel(action.level);
-  msg.time = action.time;
-  msg.payload = action.payload;
+  msg.level = ToSpdlogLevel(level);
+  msg.time = time;
+  msg.payload = spdlog::string_view_t{payload.data(), payload.size()};
+
+  // Format::kBinary messages are formatted here rather than in LogHelper, and
+  // only if some sink needs them
+  const bool is_binary = GetFormat() == Format::kBinary;
+  fmt::memory_buffer tskv;
+  fmt::memory_buffer record;
 
   for (const auto& sink : GetSinks()) {
     if (!sink->IsShouldLog(static_cast<Level>(msg.level))) {
@@ -311,14 +439,52 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
     }
 
     try {
+      if (is_binary && sink->IsBinaryRecords()) {
+        if (record.size() == 0) {
+          AppendBinaryRecord(record, level, time, payload);
+        }
+        sink->LogRecord({record.data(), record.size()});
+        continue;
+      }
+
+      if (is_binary && tskv.size() == 0) {
+        RenderBinaryAsTskv(payload, tskv);
+        msg.payload = spdlog::string_view_t{tskv.data(), tskv.size()};
+      }
       sink->Log(msg);
     } catch (const std::exception& e) {
       UASSERT_MSG(false, "While writing a log message caught an exception: " +
                              std::string(e.what()));
     }
   }
+}
+
+void TpLogger::BackendDrain(impl::async::ThreadBuffer& buffer) noexcept {
+  // Synchronizes with the producers that found the drain already scheduled
+  buffer.is_drain_scheduled.exchange(false, std::memory_order_acq_rel);
+
+  // The whole batch goes to the sinks before a single flush
+  bool should_flush = false;
+  try {
+    buffer.ring.ConsumeAll([this, &should_flush](Level level, auto time,
+                                                 std::string_view payload) {
+      BackendLog(level, time, payload);
+      should_flush = should_flush || ShouldFlush(level);
+    });
+  } catch (const std::exception& e) {
+    UASSERT_MSG(false, fmt::format("Exception while doing an async logging: {}",
+                                   e.what()));
+  }
+
+  if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
+    {
+      // See AccountLogConsumed
+      const std::lock_guard lock{capacity_waiters_mutex_};
+    }
+    buffer_waiters_cv_.NotifyAll();
+  }
 
-  if (ShouldFlush(action.level)) {
+  if (should_flush) {
     BackendFlush();
   }
 }
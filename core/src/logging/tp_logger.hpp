@@ -1,14 +1,17 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <future>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
 
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/future.hpp>
 #include <userver/engine/mutex.hpp>
@@ -16,11 +19,11 @@
 #include <userver/logging/format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 
-#include <concurrent/impl/interference_shield.hpp>
 #include <concurrent/impl/intrusive_hooks.hpp>
 #include <engine/impl/async_flat_combining_queue.hpp>
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
+#include <logging/impl/log_ring_buffer.hpp>
 #include <logging/impl/reopen_mode.hpp>
 #include <logging/statistics/log_stats.hpp>
 
@@ -53,12 +56,32 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+struct ThreadBuffer;
+
+// Logs the records of the ThreadBuffer, see TpLogger::PushToThreadBuffer
+struct DrainThreadBuffer {
+  ThreadBuffer* buffer{nullptr};
+};
+
+using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro,
+                            DrainThreadBuffer>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
   Action action{Stop{}};
 };
 
+struct ThreadBuffer final {
+  explicit ThreadBuffer(std::size_t size);
+
+  LogRingBuffer ring;
+  // Serializes the producers, in case there are more threads than buffers
+  std::atomic_flag producer_lock = ATOMIC_FLAG_INIT;
+  // Whether drain_node is in the queue
+  std::atomic<bool> is_drain_scheduled{false};
+  // Not deleted after being consumed, unlike the other nodes
+  ActionNode drain_node;
+};
+
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
@@ -67,9 +90,13 @@ class TpLogger final : public LoggerBase {
   TpLogger(Format format, std::string logger_name);
   ~TpLogger() override;
 
+  /// @param thread_buffer_size if not zero, the records are passed to the
+  /// consumer task through the per-thread buffers of this size in bytes
+  /// instead of the shared queue, must be a power of 2
   void StartConsumerTask(engine::TaskProcessor& task_processor,
                          std::size_t max_queue_size,
-                         QueueOverflowBehavior overflow_policy);
+                         QueueOverflowBehavior overflow_policy,
+                         std::size_t thread_buffer_size = 0);
 
   void StopConsumerTask();
 
@@ -77,6 +104,7 @@ class TpLogger final : public LoggerBase {
   void Flush() override;
   void PrependCommonTags(TagWriter writer) const override;
   bool ShouldLog(Level level) const noexcept override;
+  std::optional<std::uint64_t> GetSamplingKey() const noexcept override;
 
   void AddSink(impl::SinkPtr&& sink);
   const std::vector<impl::SinkPtr>& GetSinks() const;
@@ -102,13 +130,17 @@ class TpLogger final : public LoggerBase {
   bool HasFreeQueueCapacity() noexcept;
   bool TryWaitFreeQueueCapacity();
   void Push(impl::async::Action&& action);
+  void PushToThreadBuffer(Level level, std::string_view msg);
+  void ScheduleDrain(impl::async::ThreadBuffer& buffer) noexcept;
   void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
   void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
   void AccountLogConsumed() noexcept;
   void BackendPerform(impl::async::Action&& action) noexcept;
-  void BackendLog(impl::async::Log&& action) const;
+  void BackendLog(Level level, std::chrono::system_clock::time_point time,
+                  std::string_view payload) const;
+  void BackendDrain(impl::async::ThreadBuffer& buffer) noexcept;
   void BackendFlush() const;
   void BackendReopen(ReopenMode reopen_mode) const;
 
@@ -119,6 +151,8 @@ class TpLogger final : public LoggerBase {
 
   engine::Mutex capacity_waiters_mutex_;
   engine::ConditionVariable capacity_waiters_cv_;
+  // Waiters for the free space in thread_buffers_, use capacity_waiters_mutex_
+  engine::ConditionVariable buffer_waiters_cv_;
   engine::Task consuming_task_;
   std::atomic<QueueSize> max_queue_size_{std::numeric_limits<QueueSize>::max()};
   std::atomic<QueueOverflowBehavior> overflow_policy_{
@@ -128,6 +162,9 @@ class TpLogger final : public LoggerBase {
   Queue::Consumer queue_consumer_;
   // A dummy action used for notifying the async task during stopping.
   impl::async::ActionNode stop_node_;
+  // Empty unless the thread buffers are enabled, allocated before state_
+  // becomes kAsync and never changed after that
+  std::vector<std::unique_ptr<impl::async::ThreadBuffer>> thread_buffers_;
 
   Queue queue_;
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
@@ -2,7 +2,11 @@
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <vector>
+
 #include <logging/impl/null_sink.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -33,10 +37,13 @@ class TpLoggerBenchmark : public benchmark::Fixture {
 
   void TearDown(const benchmark::State&) override { guard_.reset(); }
 
-  auto StartAsyncLoggerScope() {
+  auto StartAsyncLoggerScope(
+      logging::QueueOverflowBehavior overflow_policy =
+          logging::QueueOverflowBehavior::kDiscard,
+      std::size_t thread_buffer_size = 0) {
     tp_logger_->StartConsumerTask(engine::current_task::GetTaskProcessor(),
-                                  1 << 30,
-                                  logging::QueueOverflowBehavior::kDiscard);
+                                  1 << 30, overflow_policy,
+                                  thread_buffer_size);
     return utils::FastScopeGuard(
         [this]() noexcept { tp_logger_->StopConsumerTask(); });
   }
@@ -64,4 +71,48 @@ BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+// Arguments: writers count, thread buffer size (0 for the shared queue only),
+// overflow policy (0 to discard, 1 to block)
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringContention)
+(benchmark::State& state) {
+  const std::size_t writers_count = state.range(0);
+  const auto overflow_policy = state.range(2)
+                                   ? logging::QueueOverflowBehavior::kBlock
+                                   : logging::QueueOverflowBehavior::kDiscard;
+
+  // one more thread for the consumer task
+  engine::RunStandalone(writers_count + 1, [&] {
+    auto scope = StartAsyncLoggerScope(overflow_policy, state.range(1));
+    const auto msg = Launder(std::string(64, '*'));
+    std::atomic<bool> run{true};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(writers_count - 1);
+    for (std::size_t i = 0; i < writers_count - 1; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&] {
+        while (run) {
+          LOG_INFO() << msg;
+        }
+      }));
+    }
+
+    for (auto _ : state) {
+      LOG_INFO() << msg;
+    }
+
+    run = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringContention)
+    ->Apply([](benchmark::internal::Benchmark* b) {
+      for (const long writers_count : {1, 4, 16, 32}) {
+        for (const long thread_buffer_size : {0, 1 << 16}) {
+          for (const long overflow_policy : {0, 1}) {
+            b->Args({writers_count, thread_buffer_size, overflow_policy});
+          }
+        }
+      }
+    });
+
 USERVER_NAMESPACE_END
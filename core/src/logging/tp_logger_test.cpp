@@ -47,7 +47,8 @@ class LoggingTestCoro : public LoggingTestBase {
 
   std::shared_ptr<logging::impl::TpLogger> StartAsyncLogger(
       std::size_t queue_size_max = 10,
-      QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard) {
+      QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard,
+      std::size_t thread_buffer_size = 0) {
     UASSERT_MSG(engine::current_task::IsTaskProcessorThread(),
                 "Misconfigured test. Should be run in coroutine environment");
 
@@ -59,7 +60,7 @@ class LoggingTestCoro : public LoggingTestBase {
         });
 
     logger->StartConsumerTask(engine::current_task::GetTaskProcessor(),
-                              queue_size_max, on_overflow);
+                              queue_size_max, on_overflow, thread_buffer_size);
 
     // Tracing should not break the TpLogger
     logger->SetLevel(logging::Level::kTrace);
@@ -600,6 +601,83 @@ UTEST_F(LoggingTestCoro, TpLoggerFlushMultiple) {
   EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
 }
 
+UTEST_F(LoggingTestCoro, TpLoggerThreadBuffers) {
+  auto logger = StartAsyncLogger(2, QueueOverflowBehavior::kDiscard, 1 << 16);
+
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    LOG_INFO_TO(logger) << i;
+    if (i % 100 == 0) {
+      logger->Flush();
+      EXPECT_THAT(GetStreamString(),
+                  testing::HasSubstr(fmt::format("text={}", i)));
+    }
+  }
+  logger->StopConsumerTask();
+
+  const auto logs = GetStreamString();
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    EXPECT_THAT(logs, testing::HasSubstr(fmt::format("text={}", i)));
+  }
+  // the queue size limit does not apply to the thread buffers
+  EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
+  EXPECT_EQ(GetMetric("total"), kLoggingTestIterations);
+  EXPECT_EQ(GetMetric("dropped"), 0);
+}
+
+UTEST_F(LoggingTestCoro, TpLoggerThreadBuffersLargeRecord) {
+  constexpr std::size_t kBufferSize = 1024;
+  auto logger =
+      StartAsyncLogger(16, QueueOverflowBehavior::kDiscard, kBufferSize);
+
+  const std::string large_text(kBufferSize, 'x');
+  LOG_INFO_TO(logger) << "before";
+  LOG_INFO_TO(logger) << large_text;
+  LOG_INFO_TO(logger) << "after";
+  logger->StopConsumerTask();
+
+  const auto logs = GetStreamString();
+  const auto before = logs.find("text=before");
+  const auto large = logs.find("text=" + large_text);
+  const auto after = logs.find("text=after");
+  ASSERT_NE(before, std::string::npos);
+  ASSERT_NE(large, std::string::npos);
+  ASSERT_NE(after, std::string::npos);
+  EXPECT_LT(before, large);
+  EXPECT_LT(large, after);
+}
+
+UTEST_F(LoggingTestCoro, TpLoggerThreadBuffersOverflow) {
+  auto logger = StartAsyncLogger(2, QueueOverflowBehavior::kDiscard, 1024);
+
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    LOG_INFO_TO(logger) << i;
+  }
+  logger->StopConsumerTask();
+
+  EXPECT_GE(GetRecordsCount(), 1) << "Nothing was logged";
+  EXPECT_LT(GetRecordsCount(), kLoggingTestIterations) << "Nothing was skipped";
+
+  EXPECT_EQ(GetMetric("total"), kLoggingTestIterations);
+  EXPECT_EQ(GetMetric("dropped") + GetRecordsCount(), kLoggingTestIterations);
+}
+
+UTEST_F(LoggingTestCoro, TpLoggerThreadBuffersOverflowBlocking) {
+  auto logger = StartAsyncLogger(2, QueueOverflowBehavior::kBlock, 1024);
+
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    LOG_INFO_TO(logger) << i;
+  }
+  logger->StopConsumerTask();
+
+  const auto logs = GetStreamString();
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    EXPECT_THAT(logs, testing::HasSubstr(fmt::format("text={}", i)));
+  }
+
+  EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
+  EXPECT_EQ(GetMetric("dropped"), 0);
+}
+
 UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleMT, 4) {
   const std::size_t message_count =
       kLoggingTestIterations * (GetThreadCount() - 1);
@@ -784,4 +862,30 @@ UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleStdThreadFlushSyncCancelMT, 4) {
   EXPECT_EQ(GetRecordsCount(), message_count);
 }
 
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersMT, 4) {
+  const std::size_t message_count =
+      kLoggingTestIterations * (GetThreadCount() - 1);
+  auto logger =
+      StartAsyncLogger(2, QueueOverflowBehavior::kDiscard, 1 << 20);
+  LogTestMT(logger, GetThreadCount(), kTestLogging);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersBlockingMT, 4) {
+  const std::size_t message_count =
+      kLoggingTestIterations * (GetThreadCount() - 1);
+  auto logger = StartAsyncLogger(2, QueueOverflowBehavior::kBlock, 1024);
+  LogTestMT(logger, GetThreadCount(), kTestLogging);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerThreadBuffersFlushSyncCancelMT, 4) {
+  const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+  auto logger =
+      StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kDiscard,
+                       1 << 16);
+  LogTestMT(logger, GetThreadCount(), kTestLogFlushSyncCancel);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
 USERVER_NAMESPACE_END
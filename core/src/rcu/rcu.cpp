@@ -1,16 +1,89 @@
 #include <userver/rcu/rcu.hpp>
 
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#endif
+
 #include <atomic>
+#include <mutex>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace rcu::impl {
 
+namespace {
+
+#if defined(__linux__) && defined(SYS_membarrier)
+bool RegisterMembarrier() noexcept {
+  const auto commands = ::syscall(SYS_membarrier, MEMBARRIER_CMD_QUERY, 0);
+  if (commands < 0 || !(commands & MEMBARRIER_CMD_PRIVATE_EXPEDITED)) {
+    return false;
+  }
+  return ::syscall(SYS_membarrier,
+                   MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0;
+}
+
+bool TryMembarrier() noexcept {
+  static const bool is_registered = RegisterMembarrier();
+  return is_registered &&
+         ::syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0) == 0;
+}
+#else
+bool TryMembarrier() noexcept { return false; }
+#endif
+
+// Revoking the write access to a dirty page makes the kernel flush the TLBs
+// of every CPU running the threads of the process, which executes a full
+// barrier on each of them
+class PageProtectionFence final {
+ public:
+  PageProtectionFence() {
+    const auto page_size = ::sysconf(_SC_PAGESIZE);
+    void* page = ::mmap(nullptr, page_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    UINVARIANT(page != MAP_FAILED, "Failed to map a page for memory fences");
+    page_ = static_cast<char*>(page);
+    page_size_ = page_size;
+  }
+
+  void Fence() noexcept {
+    std::lock_guard lock(mutex_);
+    [[maybe_unused]] const auto rw_result =
+        ::mprotect(page_, page_size_, PROT_READ | PROT_WRITE);
+    UASSERT(rw_result == 0);
+    // make the page dirty, otherwise the TLB flush may be skipped
+    *static_cast<volatile char*>(page_) = 0;
+    [[maybe_unused]] const auto ro_result =
+        ::mprotect(page_, page_size_, PROT_READ);
+    UASSERT(ro_result == 0);
+  }
+
+ private:
+  std::mutex mutex_;
+  char* page_{nullptr};
+  std::size_t page_size_{0};
+};
+
+}  // namespace
+
 uint64_t GetNextEpoch() noexcept {
   static std::atomic<uint64_t> counter{1};  // 0 is the default value in data
   return counter++;
 }
 
+void AsymmetricThreadFenceHeavy() noexcept {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (TryMembarrier()) return;
+
+  static PageProtectionFence fallback;
+  fallback.Fence();
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
 }  // namespace rcu::impl
 
 USERVER_NAMESPACE_END
@@ -2,13 +2,17 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <queue>
+#include <type_traits>
 #include <vector>
 
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -37,6 +41,45 @@ BENCHMARK_TEMPLATE(rcu_read, 1);
 BENCHMARK_TEMPLATE(rcu_read, 2);
 BENCHMARK_TEMPLATE(rcu_read, 4);
 
+template <typename RcuTraits>
+void rcu_read_traits(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+
+  engine::RunStandalone(readers_count, [&] {
+    std::atomic<bool> run{true};
+    rcu::Variable<std::uint64_t, RcuTraits> var{0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count - 1);
+
+    for (std::size_t i = 0; i < readers_count - 1; i++) {
+      tasks.push_back(utils::Async("reader", [&] {
+        while (run) {
+          auto reader = var.Read();
+          benchmark::DoNotOptimize(*reader);
+        }
+      }));
+    }
+
+    for (auto _ : state) {
+      auto reader = var.Read();
+      benchmark::DoNotOptimize(*reader);
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_read_traits, rcu::DefaultRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(rcu_read_traits,
+                   rcu::AsymmetricFenceRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
 template <int VariableCount>
 void rcu_write(benchmark::State& state) {
   engine::RunStandalone([&] {
@@ -150,4 +193,132 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+namespace {
+
+constexpr std::uint64_t kMapSize = 1'000'000;
+
+using RcuMap = rcu::RcuMap<std::uint64_t, std::uint64_t>;
+using ShardedRcuMap = rcu::ShardedRcuMap<std::uint64_t, std::uint64_t>;
+
+template <typename Map>
+void FillMap(Map& map) {
+  if constexpr (std::is_same_v<Map, ShardedRcuMap>) {
+    auto txn = map.StartTransaction();
+    for (std::uint64_t i = 0; i < kMapSize; ++i) {
+      txn.InsertOrAssign(i, std::make_shared<std::uint64_t>(i));
+    }
+    txn.Commit();
+  } else {
+    typename Map::RawMap raw_map;
+    raw_map.reserve(kMapSize);
+    for (std::uint64_t i = 0; i < kMapSize; ++i) {
+      raw_map.emplace(i, std::make_shared<std::uint64_t>(i));
+    }
+    map.Assign(std::move(raw_map));
+  }
+}
+
+// Applies `count` updates starting from the `first` key
+template <typename Map>
+void UpdateMap(Map& map, std::uint64_t first, std::uint64_t count) {
+  if constexpr (std::is_same_v<Map, ShardedRcuMap>) {
+    auto txn = map.StartTransaction();
+    for (std::uint64_t i = 0; i < count; ++i) {
+      const auto key = (first + i) % kMapSize;
+      txn.InsertOrAssign(key, std::make_shared<std::uint64_t>(key));
+    }
+    txn.Commit();
+  } else {
+    auto txn = map.StartWrite();
+    for (std::uint64_t i = 0; i < count; ++i) {
+      const auto key = (first + i) % kMapSize;
+      (*txn)[key] = std::make_shared<std::uint64_t>(key);
+    }
+    txn.Commit();
+  }
+}
+
+}  // namespace
+
+// Reads of a 1M map while other tasks keep updating it in batches of
+// state.range(1) keys
+template <typename Map>
+void rcu_map_mixed_load(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+  const std::uint64_t batch_size = state.range(1);
+
+  engine::RunStandalone(readers_count + 1, [&] {
+    std::atomic<bool> run{true};
+    Map map;
+    FillMap(map);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count);
+
+    for (std::size_t i = 0; i < readers_count - 1; i++) {
+      tasks.push_back(utils::Async("reader", [&, i] {
+        std::uint64_t key = i;
+        while (run) {
+          benchmark::DoNotOptimize(map.Get(key));
+          key = (key + 7919) % kMapSize;
+        }
+      }));
+    }
+
+    tasks.push_back(utils::Async("writer", [&] {
+      std::uint64_t first = 0;
+      while (run) {
+        UpdateMap(map, first, batch_size);
+        first += batch_size;
+        engine::Yield();
+      }
+    }));
+
+    std::uint64_t key = 0;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(map.Get(key));
+      key = (key + 7919) % kMapSize;
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_map_mixed_load, RcuMap)
+    ->Args({1, 1})
+    ->Args({4, 1})
+    ->Args({4, 1000});
+BENCHMARK_TEMPLATE(rcu_map_mixed_load, ShardedRcuMap)
+    ->Args({1, 1})
+    ->Args({4, 1})
+    ->Args({4, 1000});
+
+// A batch of state.range(0) updates of a 1M map
+template <typename Map>
+void rcu_map_batched_update(benchmark::State& state) {
+  const std::uint64_t batch_size = state.range(0);
+
+  engine::RunStandalone([&] {
+    Map map;
+    FillMap(map);
+
+    std::uint64_t first = 0;
+    for (auto _ : state) {
+      UpdateMap(map, first, batch_size);
+      first += batch_size;
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+  });
+}
+BENCHMARK_TEMPLATE(rcu_map_batched_update, RcuMap)
+    ->RangeMultiplier(10)
+    ->Range(1, 10'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(rcu_map_batched_update, ShardedRcuMap)
+    ->RangeMultiplier(10)
+    ->Range(1, 10'000)
+    ->Unit(benchmark::kMillisecond);
+
 USERVER_NAMESPACE_END
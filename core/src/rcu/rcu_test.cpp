@@ -20,6 +20,9 @@ struct StdMutexRcuTraits {
   using MutexType = std::mutex;
 };
 
+template <typename T>
+using AsymmetricVariable = rcu::Variable<T, rcu::AsymmetricFenceRcuTraits<T>>;
+
 }  // namespace
 
 UTEST(Rcu, Ctr) { rcu::Variable<X> ptr; }
@@ -624,4 +627,103 @@ TEST(Rcu, StdMutexConcurrentWrites) {
   EXPECT_EQ(std::make_pair(3, 2), *reader);
 }
 
+UTEST(Rcu, AsymmetricFenceReadCommitted) {
+  AsymmetricVariable<X> ptr(1, 2);
+
+  auto first_reader = ptr.Read();
+  // the thread-owned hazard pointer is busy, a shared one is used
+  auto second_reader = ptr.Read();
+  {
+    auto writer = ptr.StartWrite();
+    writer->first = 3;
+    writer.Commit();
+  }
+
+  EXPECT_EQ(std::make_pair(1, 2), *first_reader);
+  EXPECT_EQ(std::make_pair(1, 2), *second_reader);
+
+  auto reader = ptr.Read();
+  EXPECT_EQ(std::make_pair(3, 2), *reader);
+}
+
+UTEST(Rcu, AsymmetricFenceCleanup) {
+  static std::atomic<size_t> count{0};
+  struct Counted {
+    Counted() { count++; }
+    Counted(const Counted&) { count++; }
+    ~Counted() { count--; }
+  };
+
+  AsymmetricVariable<Counted> ptr;
+  {
+    auto reader = ptr.Read();
+    auto writer = ptr.StartWrite();
+    writer.Commit();
+    EXPECT_EQ(count.load(), 2);
+  }
+
+  ptr.Cleanup();
+
+  // For background delete
+  engine::Yield();
+  engine::Yield();
+
+  EXPECT_EQ(count.load(), 1);
+}
+
+UTEST(Rcu, AsymmetricFenceSeveralVariables) {
+  AsymmetricVariable<int> first{1};
+  AsymmetricVariable<int> second{2};
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(first.ReadCopy(), 1);
+    EXPECT_EQ(second.ReadCopy(), 2);
+  }
+}
+
+UTEST_MT(Rcu, AsymmetricFenceTortureTest, kTotalTasks) {
+  AsymmetricVariable<CleaningUpInt> data{1};
+  std::atomic<bool> keep_running{true};
+
+  engine::Mutex ping_pong_mutex;
+  auto ptr = data.Read();
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  for (std::size_t i = 0; i < kReadablePtrPingPongTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        std::lock_guard lock(ping_pong_mutex);
+        // copy a ptr created by another thread
+        ptr = rcu::ReadablePtr{ptr};
+        ASSERT_GT(ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kReadingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto local_ptr = data.Read();
+        ASSERT_GT(local_ptr->value, 0);
+        // may continue on another thread
+        engine::Yield();
+        ASSERT_GT(local_ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kWritingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto old = data.Read();
+        data.Assign(CleaningUpInt{old->value + 1});
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  keep_running = false;
+}
+
 USERVER_NAMESPACE_END
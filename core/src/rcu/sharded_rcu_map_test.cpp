@@ -0,0 +1,136 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedRcuMap, Empty) {
+  rcu::ShardedRcuMap<std::string, int> map;
+  const auto& cmap = map;
+
+  EXPECT_EQ(map.SizeApprox(), 0);
+  EXPECT_TRUE(map.GetSnapshot().empty());
+  UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(cmap.Get("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_FALSE(map.Pop("any"));
+  EXPECT_FALSE(cmap.Visit("any", [](int) { FAIL(); }));
+}
+
+UTEST(ShardedRcuMap, Modify) {
+  rcu::ShardedRcuMap<int, int> map{4};
+  EXPECT_EQ(map.GetShardsCount(), 4);
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(map.Emplace(i, i).inserted);
+  }
+  EXPECT_EQ(map.SizeApprox(), 100);
+
+  const auto insert_result = map.Insert(1, std::make_shared<int>(42));
+  EXPECT_FALSE(insert_result.inserted);
+  EXPECT_EQ(*insert_result.value, 1);
+
+  EXPECT_FALSE(map.TryEmplace(2, 42).inserted);
+  EXPECT_TRUE(map.TryEmplace(100, 42).inserted);
+  EXPECT_EQ(*map[100], 42);
+  EXPECT_EQ(*map[101], 0);
+
+  map.InsertOrAssign(1, std::make_shared<int>(-1));
+  EXPECT_EQ(*map.Get(1), -1);
+
+  *map[3] = 33;
+  int visited = 0;
+  EXPECT_TRUE(map.Visit(3, [&visited](int value) { visited = value; }));
+  EXPECT_EQ(visited, 33);
+
+  EXPECT_TRUE(map.Erase(4));
+  EXPECT_FALSE(map.Get(4));
+  EXPECT_EQ(*map.Pop(5), 5);
+  EXPECT_FALSE(map.Pop(5));
+  EXPECT_EQ(map.SizeApprox(), 100);
+  EXPECT_EQ(map.GetSnapshot().size(), 100);
+
+  map.Clear();
+  EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST(ShardedRcuMap, Transaction) {
+  /// [Sample rcu::ShardedRcuMap usage]
+  rcu::ShardedRcuMap<std::string, int> map;
+  map.InsertOrAssign("stale", std::make_shared<int>(0));
+
+  auto txn = map.StartTransaction();
+  txn.Erase("stale");
+  for (int i = 0; i < 1000; ++i) {
+    txn.InsertOrAssign(std::to_string(i), std::make_shared<int>(i));
+  }
+  txn.InsertOrAssign("42", std::make_shared<int>(-42));
+
+  // changes are not visible until the commit
+  EXPECT_EQ(map.SizeApprox(), 1);
+  EXPECT_FALSE(map.Get("42"));
+
+  txn.Commit();
+
+  EXPECT_EQ(map.SizeApprox(), 1000);
+  EXPECT_FALSE(map.Get("stale"));
+  EXPECT_EQ(*map.Get("42"), -42);
+  /// [Sample rcu::ShardedRcuMap usage]
+
+  // committing an empty transaction is a no-op
+  txn.Commit();
+  EXPECT_EQ(map.SizeApprox(), 1000);
+}
+
+UTEST(ShardedRcuMap, UncommittedTransaction) {
+  rcu::ShardedRcuMap<int, int> map;
+  {
+    auto txn = map.StartTransaction();
+    txn.InsertOrAssign(1, std::make_shared<int>(1));
+  }
+  EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentTransactions, 4) {
+  constexpr int kWriters = 4;
+  constexpr int kKeysPerWriter = 1000;
+
+  rcu::ShardedRcuMap<int, int> map{8};
+  std::atomic<bool> stop{false};
+
+  auto reader = utils::Async("reader", [&] {
+    while (!stop) {
+      for (int key = 0; key < kWriters * kKeysPerWriter; key += 97) {
+        map.Visit(key, [key](int value) { EXPECT_EQ(value, key); });
+      }
+      engine::Yield();
+    }
+  });
+
+  std::vector<engine::TaskWithResult<void>> writers;
+  for (int writer = 0; writer < kWriters; ++writer) {
+    writers.push_back(utils::Async("writer", [&map, writer] {
+      auto txn = map.StartTransaction();
+      for (int i = 0; i < kKeysPerWriter; ++i) {
+        const auto key = writer * kKeysPerWriter + i;
+        txn.InsertOrAssign(key, std::make_shared<int>(key));
+      }
+      txn.Commit();
+    }));
+  }
+  for (auto& writer : writers) writer.Get();
+
+  stop = true;
+  reader.Get();
+
+  EXPECT_EQ(map.SizeApprox(), kWriters * kKeysPerWriter);
+}
+
+USERVER_NAMESPACE_END
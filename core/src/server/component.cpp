@@ -147,9 +147,61 @@ properties:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    max_in_flight_requests:
+                        type: integer
+                        description: maximum number of pipelined requests from a single connection that are handled concurrently or wait for their responses to be sent; the connection is not read while the limit is reached
+                        defaultDescription: unlimited
+                        minimum: 1
+                    max_pending_response_bytes:
+                        type: integer
+                        description: the connection is not read while the response being sent to it is not smaller than this value
+                        defaultDescription: unlimited
+                        minimum: 1
+                    max_total_pending_response_bytes:
+                        type: integer
+                        description: the connections of the listener are not read while their responses that are not sent yet take at least this many bytes
+                        defaultDescription: unlimited
+                        minimum: 1
+                    idle_park_timeout:
+                        type: string
+                        description: keep-alive connections idle for this long release their coroutines until the data arrives, saves memory on many idle connections
+                        defaultDescription: never
+                    request_parser:
+                        type: string
+                        description: "HTTP/1.x request parser: 'http_parser' or 'simd' that scans the header block with SIMD and falls back to 'http_parser' for chunked and upgrade requests"
+                        defaultDescription: http_parser
+                        enum:
+                          - http_parser
+                          - simd
+                    http2:
+                        type: object
+                        description: HTTP/2 options
+                        additionalProperties: false
+                        properties:
+                            enabled:
+                                type: boolean
+                                description: accept HTTP/2 with prior knowledge (h2c) in addition to HTTP/1.1
+                                defaultDescription: false
+                            max_concurrent_streams:
+                                type: integer
+                                description: SETTINGS_MAX_CONCURRENT_STREAMS advertised to the peer
+                                defaultDescription: 100
+                            initial_window_size:
+                                type: integer
+                                description: SETTINGS_INITIAL_WINDOW_SIZE advertised to the peer, in bytes
+                                defaultDescription: 65535
+                            send_timeout:
+                                type: string
+                                description: for how long a response may wait for the socket to accept the frames or for the peer to open the flow control window, the stream is reset after that
+                                defaultDescription: 10s
             shards:
                 type: integer
-                description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+                description: how many listening sockets with SO_REUSEPORT and accepting tasks to create for the port, the kernel balances new connections between them; do not set if not sure what it is doing
+                defaultDescription: number of event threads of the task processor
+            reuseport_cpu_steering:
+                type: boolean
+                description: pass a new connection to the listening socket number `cpu % shards`, where `cpu` received the connection; Linux only
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
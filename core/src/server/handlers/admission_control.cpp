@@ -0,0 +1,67 @@
+#include <server/handlers/admission_control.hpp>
+
+#include <cstdint>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+AdmissionControlConfig Parse(const formats::json::Value& value,
+                             formats::parse::To<AdmissionControlConfig>) {
+  AdmissionControlConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.target_queue_time = std::chrono::milliseconds{
+      value["target-queue-time-ms"].As<std::int64_t>(
+          config.target_queue_time.count())};
+  config.interval = std::chrono::milliseconds{
+      value["interval-ms"].As<std::int64_t>(config.interval.count())};
+  return config;
+}
+
+bool AdmissionController::Admit(Clock::duration queue_time,
+                                Clock::time_point now,
+                                const AdmissionControlConfig& config) noexcept {
+  if (!config.enabled) return true;
+
+  const auto now_rep = now.time_since_epoch().count();
+  auto interval_end = interval_end_.load(std::memory_order_relaxed);
+  if (now_rep >= interval_end) {
+    const auto interval =
+        std::chrono::duration_cast<Clock::duration>(config.interval);
+    // Only the task that started the new interval judges the previous one
+    if (interval_end_.compare_exchange_strong(
+            interval_end, now_rep + interval.count(),
+            std::memory_order_relaxed)) {
+      const auto interval_min = interval_min_queue_time_.exchange(
+          kNoQueueTime, std::memory_order_relaxed);
+      // The queues are drained if no requests came for a whole interval
+      const bool was_idle = now_rep - interval_end >= interval.count();
+      is_overloaded_.store(
+          interval_end != 0 && !was_idle && interval_min != kNoQueueTime &&
+              Clock::duration{interval_min} > config.target_queue_time,
+          std::memory_order_relaxed);
+    }
+  }
+
+  const auto queue_time_rep = queue_time.count();
+  auto interval_min = interval_min_queue_time_.load(std::memory_order_relaxed);
+  while (queue_time_rep < interval_min &&
+         !interval_min_queue_time_.compare_exchange_weak(
+             interval_min, queue_time_rep, std::memory_order_relaxed)) {
+  }
+
+  if (is_overloaded_.load(std::memory_order_relaxed)) {
+    return queue_time <= config.target_queue_time;
+  }
+  return queue_time <= config.interval;
+}
+
+bool AdmissionController::IsOverloaded() const noexcept {
+  return is_overloaded_.load(std::memory_order_relaxed);
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
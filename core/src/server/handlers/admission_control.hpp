@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+AdmissionControlConfig Parse(const formats::json::Value& value,
+                             formats::parse::To<AdmissionControlConfig>);
+
+/// @brief CoDel admission control on the time a request spent in the queues
+/// before the handler started to process it.
+///
+/// The handler is overloaded if even the quickest request of the last interval
+/// waited for longer than the target queue time. Once overloaded, the requests
+/// that waited for longer than the target are rejected, so the fresh ones that
+/// still have a chance to meet the client deadline are processed. The requests
+/// that waited for longer than the whole interval are always rejected: the
+/// client has probably given up on them.
+///
+/// Lock free, the interval bounds are approximate under contention.
+class AdmissionController final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Returns false if the request should be rejected
+  bool Admit(Clock::duration queue_time, Clock::time_point now,
+             const AdmissionControlConfig& config) noexcept;
+
+  bool IsOverloaded() const noexcept;
+
+ private:
+  static constexpr auto kNoQueueTime = std::numeric_limits<Clock::rep>::max();
+
+  std::atomic<Clock::rep> interval_end_{0};
+  std::atomic<Clock::rep> interval_min_queue_time_{kNoQueueTime};
+  std::atomic<bool> is_overloaded_{false};
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <server/handlers/admission_control.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::AdmissionControlConfig;
+using server::handlers::AdmissionController;
+using std::chrono::milliseconds;
+
+const AdmissionControlConfig kConfig{true, milliseconds{5},
+                                     milliseconds{100}};
+
+}  // namespace
+
+TEST(AdmissionController, NotOverloaded) {
+  AdmissionController controller;
+  auto now = AdmissionController::Clock::now();
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(controller.Admit(milliseconds{1}, now, kConfig));
+    EXPECT_TRUE(controller.Admit(milliseconds{50}, now, kConfig));
+    now += milliseconds{30};
+  }
+  EXPECT_FALSE(controller.IsOverloaded());
+
+  // Too stale to be meaningful for the client
+  EXPECT_FALSE(controller.Admit(milliseconds{101}, now, kConfig));
+}
+
+TEST(AdmissionController, Overloaded) {
+  AdmissionController controller;
+  auto now = AdmissionController::Clock::now();
+
+  EXPECT_TRUE(controller.Admit(milliseconds{20}, now, kConfig));
+  now += milliseconds{50};
+  EXPECT_TRUE(controller.Admit(milliseconds{20}, now, kConfig));
+  now += milliseconds{60};
+  // The whole interval was above the target
+  EXPECT_FALSE(controller.Admit(milliseconds{20}, now, kConfig));
+  EXPECT_TRUE(controller.IsOverloaded());
+  EXPECT_TRUE(controller.Admit(milliseconds{4}, now, kConfig));
+
+  // A quick request in the interval ends the overload
+  now += milliseconds{101};
+  EXPECT_TRUE(controller.Admit(milliseconds{20}, now, kConfig));
+  EXPECT_FALSE(controller.IsOverloaded());
+}
+
+TEST(AdmissionController, IdleIsNotOverloaded) {
+  AdmissionController controller;
+  auto now = AdmissionController::Clock::now();
+
+  EXPECT_TRUE(controller.Admit(milliseconds{20}, now, kConfig));
+  now += milliseconds{250};
+  EXPECT_TRUE(controller.Admit(milliseconds{20}, now, kConfig));
+  now += milliseconds{500};
+  EXPECT_TRUE(controller.Admit(milliseconds{20}, now, kConfig));
+  EXPECT_FALSE(controller.IsOverloaded());
+}
+
+TEST(AdmissionController, Disabled) {
+  AdmissionController controller;
+  auto config = kConfig;
+  config.enabled = false;
+
+  EXPECT_TRUE(controller.Admit(milliseconds{1000},
+                               AdmissionController::Clock::now(), config));
+}
+
+TEST(AdmissionController, ParseJson) {
+  const auto config =
+      formats::json::FromString(
+          R"({"target-queue-time-ms": 10, "interval-ms": 200})")
+          .As<AdmissionControlConfig>();
+  EXPECT_TRUE(config.enabled);
+  EXPECT_EQ(config.target_queue_time, milliseconds{10});
+  EXPECT_EQ(config.interval, milliseconds{200});
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <server/handlers/congestion_control.hpp>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/handlers/http_server_settings.hpp>
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+HandlerCongestionControl::HandlerCongestionControl(
+    const std::string& handler_name,
+    const HandlerCongestionControlConfig& config,
+    dynamic_config::Source config_source,
+    const HttpHandlerMethodStatistics& statistics)
+    : statistics_(statistics),
+      sensor_(*this),
+      limiter_(*this),
+      controller_(handler_name, sensor_, limiter_, stats_,
+                  {config.fake_mode, true}, config_source,
+                  [handler_name, static_config = config.gradient](
+                      const dynamic_config::Snapshot& snapshot) {
+                    return snapshot[kCongestionControl]
+                        .GetOptional(handler_name)
+                        .value_or(static_config);
+                  }) {
+  controller_.Start();
+}
+
+bool HandlerCongestionControl::Admit(std::size_t requests_in_flight) noexcept {
+  if (requests_in_flight <= limit_.load(std::memory_order_relaxed)) {
+    return true;
+  }
+  ++rejected_;
+  return false;
+}
+
+void HandlerCongestionControl::Account(
+    std::chrono::steady_clock::duration timing, bool is_timeout) noexcept {
+  ++total_;
+  if (is_timeout) ++timeouts_;
+  timings_sum_us_ +=
+      std::chrono::duration_cast<std::chrono::microseconds>(timing).count();
+}
+
+std::optional<std::size_t> HandlerCongestionControl::GetLimit() const noexcept {
+  const auto limit = limit_.load(std::memory_order_relaxed);
+  if (limit == kNoLimit) return std::nullopt;
+  return limit;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HandlerCongestionControl& congestion_control) {
+  USERVER_NAMESPACE::congestion_control::v2::DumpMetric(
+      writer, congestion_control.stats_);
+  writer["rejected"] = congestion_control.rejected_.load();
+}
+
+HandlerCongestionControl::Sensor::Data
+HandlerCongestionControl::Sensor::GetCurrent() {
+  const std::uint64_t total = owner_.total_;
+  const std::uint64_t timeouts = owner_.timeouts_;
+  const std::uint64_t timings_sum_us = owner_.timings_sum_us_;
+
+  Data data;
+  data.total = total - last_total_;
+  data.timeouts = timeouts - last_timeouts_;
+  if (data.total != 0) {
+    data.timings_avg_ms =
+        (timings_sum_us - last_timings_sum_us_) / data.total / 1000;
+  }
+  data.current_load = owner_.statistics_.GetInFlight();
+
+  last_total_ = total;
+  last_timeouts_ = timeouts;
+  last_timings_sum_us_ = timings_sum_us;
+  return data;
+}
+
+void HandlerCongestionControl::Limiter::SetLimit(
+    const USERVER_NAMESPACE::congestion_control::Limit& new_limit) {
+  owner_.limit_.store(new_limit.load_limit.value_or(kNoLimit),
+                      std::memory_order_relaxed);
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+class HttpHandlerMethodStatistics;
+
+/// @brief Per-handler congestion control on the requests in flight.
+///
+/// Each handler has its own sensor of the handler timings and its own
+/// congestion_control::v2::GradientController, so an expensive handler is
+/// limited once it slows down, while the quick handlers of the same server are
+/// not affected.
+class HandlerCongestionControl final {
+ public:
+  HandlerCongestionControl(const std::string& handler_name,
+                           const HandlerCongestionControlConfig& config,
+                           dynamic_config::Source config_source,
+                           const HttpHandlerMethodStatistics& statistics);
+
+  /// Returns false if the request should be rejected
+  bool Admit(std::size_t requests_in_flight) noexcept;
+
+  /// Accounts a request that was admitted and processed
+  void Account(std::chrono::steady_clock::duration timing,
+               bool is_timeout) noexcept;
+
+  std::optional<std::size_t> GetLimit() const noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const HandlerCongestionControl& congestion_control);
+
+ private:
+  class Sensor final
+      : public USERVER_NAMESPACE::congestion_control::v2::Sensor {
+   public:
+    explicit Sensor(HandlerCongestionControl& owner) : owner_(owner) {}
+
+    Data GetCurrent() override;
+
+   private:
+    HandlerCongestionControl& owner_;
+    std::uint64_t last_total_{0};
+    std::uint64_t last_timeouts_{0};
+    std::uint64_t last_timings_sum_us_{0};
+  };
+
+  class Limiter final : public USERVER_NAMESPACE::congestion_control::Limiter {
+   public:
+    explicit Limiter(HandlerCongestionControl& owner) : owner_(owner) {}
+
+    void SetLimit(const USERVER_NAMESPACE::congestion_control::Limit&
+                      new_limit) override;
+
+   private:
+    HandlerCongestionControl& owner_;
+  };
+
+  static constexpr auto kNoLimit = std::numeric_limits<std::size_t>::max();
+
+  const HttpHandlerMethodStatistics& statistics_;
+
+  utils::statistics::ShardedRelaxedCounter<std::uint64_t> total_;
+  utils::statistics::ShardedRelaxedCounter<std::uint64_t> timeouts_;
+  utils::statistics::ShardedRelaxedCounter<std::uint64_t> timings_sum_us_;
+  std::atomic<std::size_t> limit_{kNoLimit};
+  std::atomic<std::uint64_t> rejected_{0};
+
+  USERVER_NAMESPACE::congestion_control::v2::Stats stats_;
+  Sensor sensor_;
+  Limiter limiter_;
+  // Stops the periodic updates first
+  USERVER_NAMESPACE::congestion_control::v2::GradientController controller_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
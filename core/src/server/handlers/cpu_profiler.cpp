@@ -0,0 +1,117 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <engine/task/cpu_profiler.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDefaultPeriod{10};
+constexpr std::chrono::milliseconds kDefaultCollectInterval{1'000};
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config,
+                         const components::ComponentContext& context)
+    : HttpHandlerBase(config, context, /*is_monitor = */ true),
+      period_(config["period"].As<std::chrono::milliseconds>(kDefaultPeriod)) {
+  if (config["start-on-startup"].As<bool>(false)) {
+    engine::impl::CpuProfiler::Get().Start(period_);
+  }
+
+  // The samples are kept in small per-thread buffers until collected
+  collect_task_.Start(
+      "cpu_profiler_collect",
+      {config["collect-interval"].As<std::chrono::milliseconds>(
+           kDefaultCollectInterval),
+       {},
+       logging::Level::kTrace},
+      [] {
+        auto& profiler = engine::impl::CpuProfiler::Get();
+        if (profiler.IsRunning()) profiler.Collect();
+      });
+}
+
+CpuProfiler::~CpuProfiler() {
+  collect_task_.Stop();
+  engine::impl::CpuProfiler::Get().Stop();
+}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  switch (request.GetMethod()) {
+    case http::HttpMethod::kGet:
+      return ProcessGet(request);
+    case http::HttpMethod::kPut:
+      return ProcessPut(request);
+    case http::HttpMethod::kDelete:
+      return ProcessDelete();
+    default:
+      throw std::runtime_error("unsupported method: " + request.GetMethodStr());
+  }
+}
+
+std::string CpuProfiler::ProcessGet(const http::HttpRequest& request) const {
+  auto& profiler = engine::impl::CpuProfiler::Get();
+  auto result = profiler.GetFoldedStacks();
+  if (request.GetArg("reset") == "true") profiler.Reset();
+  return result;
+}
+
+std::string CpuProfiler::ProcessPut(const http::HttpRequest& request) const {
+  auto period = period_;
+  if (request.HasArg("period_us")) {
+    try {
+      period = std::chrono::microseconds{
+          utils::FromString<std::uint32_t>(request.GetArg("period_us"))};
+    } catch (const std::exception& ex) {
+      request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+      return std::string{"invalid 'period_us' value: "} + ex.what() + "\n";
+    }
+    if (period.count() == 0) {
+      request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+      return "'period_us' should be positive\n";
+    }
+  }
+
+  engine::impl::CpuProfiler::Get().Start(period);
+  return "OK\n";
+}
+
+std::string CpuProfiler::ProcessDelete() const {
+  engine::impl::CpuProfiler::Get().Stop();
+  return "OK\n";
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: Handler that controls the sampling CPU profiler
+additionalProperties: false
+properties:
+    period:
+        type: string
+        description: CPU time between the samples of a single thread
+        defaultDescription: 10ms
+    start-on-startup:
+        type: boolean
+        description: whether to start the profiler with the component
+        defaultDescription: false
+    collect-interval:
+        type: string
+        description: |
+            how often the samples are moved from the per-thread buffers to the
+            aggregated stacks
+        defaultDescription: 1s
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -40,6 +40,15 @@ properties:
     task_processor:
         type: string
         description: a task processor to execute the requests
+    task_priority:
+        type: string
+        description: |
+            task processor queue lane of the request tasks, `high` for short
+            latency-critical handlers, see engine::TaskPriority
+        defaultDescription: normal
+        enum:
+          - normal
+          - high
     method:
         type: string
         description: comma-separated list of allowed methods
@@ -95,6 +104,144 @@ properties:
         type: boolean
         description: allow decompression of the requests
         defaultDescription: false
+    response_compression:
+        type: object
+        description: compress the response bodies with one of the encodings accepted by the client
+        defaultDescription: <no compression>
+        additionalProperties: false
+        properties:
+            encodings:
+                type: array
+                description: content codings in the order of preference, 'zstd' and 'br' are only available in builds with USERVER_FEATURE_ZSTD and USERVER_FEATURE_BROTLI
+                defaultDescription: '[gzip]'
+                items:
+                    type: string
+                    description: content coding
+                    enum:
+                      - gzip
+                      - zstd
+                      - br
+            min_body_size:
+                type: integer
+                description: do not compress smaller bodies, ignored for streamed bodies
+                defaultDescription: 1024
+            level:
+                type: integer
+                description: compression level, clamped to the range of each encoding
+                defaultDescription: 6 for gzip, 3 for zstd, 5 for br
+            task_processor:
+                type: string
+                description: task processor to compress the bodies on
+                defaultDescription: <compress in the handler task>
+    response_cache:
+        type: object
+        description: answer the repeated GET requests with the 200 responses cached by the path and the listed args and headers, the handler is not called then; the checks of the auth, the rate limit and the admission control are still done
+        defaultDescription: <no cache>
+        additionalProperties: false
+        properties:
+            ways:
+                type: integer
+                description: number of the independently locked shards of the cache
+                defaultDescription: 16
+                minimum: 1
+            size:
+                type: integer
+                description: total number of the cached responses
+                defaultDescription: 1000
+                minimum: 1
+            max_bytes:
+                type: integer
+                description: total size of the cached responses in bytes, 0 for no limit
+                defaultDescription: 0
+            lifetime:
+                type: string
+                description: the responses are recomputed once they are older
+                defaultDescription: 1s
+            args:
+                type: array
+                description: request arguments that the responses depend on
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: argument name
+            headers:
+                type: array
+                description: request headers that the responses depend on, e.g. Accept-Language or Authorization
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: header name
+    admission_control:
+        type: object
+        description: reject the requests that waited for too long before the handler started to process them, the values could be overridden by USERVER_HANDLER_ADMISSION_CONTROL dynamic config
+        defaultDescription: <no admission control>
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: enable the admission control
+                defaultDescription: true
+            target_queue_time:
+                type: string
+                description: acceptable queue time, the requests queued for longer are rejected once the minimal queue time stays above it for a whole interval
+                defaultDescription: 5ms
+            interval:
+                type: string
+                description: interval to watch the minimal queue time for, the requests queued for longer are always rejected
+                defaultDescription: 100ms
+    congestion_control:
+        type: object
+        description: limit the requests in flight of the handler once its timings grow, see congestion_control::v2::GradientController, the values except fake_mode could be overridden by USERVER_HANDLER_CONGESTION_CONTROL dynamic config
+        defaultDescription: <no congestion control>
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: enable the congestion control
+                defaultDescription: true
+            fake_mode:
+                type: boolean
+                description: compute and report the limit without rejecting the requests
+                defaultDescription: false
+            tolerance:
+                type: number
+                description: the limit is decreased once the timings grow this many times compared to the long term timings
+                defaultDescription: 2.0
+                minimum: 1
+            errors_threshold_percent:
+                type: number
+                description: the limit is decreased once the percent of the timed out requests exceeds this value
+                defaultDescription: 5.0
+            min_timings:
+                type: string
+                description: lower bound of the long term timings, so that jitter of the quick requests does not activate the limit
+                defaultDescription: 20ms
+            min_limit:
+                type: integer
+                description: the limit is never decreased below this value
+                defaultDescription: 10
+            min_qps:
+                type: integer
+                description: do not activate the limit with fewer requests per second
+                defaultDescription: 10
+            deactivate_delta:
+                type: integer
+                description: the limit is removed once it exceeds the requests in flight by this value
+                defaultDescription: 10
+    memory_accounting:
+        type: object
+        description: account the request bodies, the PostgreSQL result sets and the other buffers charged with utils::MemoryCharge to the requests of the handler, see utils::MemoryAccount
+        defaultDescription: <no accounting>
+        additionalProperties: false
+        properties:
+            max_bytes_in_flight:
+                type: integer
+                description: soft limit of the bytes held by all the requests of the handler, the requests that go over it are answered with 429
+                defaultDescription: <no limit>
+            max_request_bytes:
+                type: integer
+                description: soft limit of the bytes held by a single request, the requests that go over it are answered with 429
+                defaultDescription: <no limit>
     throttling_enabled:
         type: boolean
         description: allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options
@@ -107,6 +254,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: pass the HTTP/1.x request to the handler once its headers are received, the handler reads the body with server::http::RequestBodyStream while it is received; max_request_size still limits the whole request
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
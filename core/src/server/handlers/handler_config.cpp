@@ -2,6 +2,7 @@
 
 #include <fmt/format.h>
 
+#include <compression/compressor.hpp>
 #include <server/server_config.hpp>
 
 #include <server/http/parse_http_status.hpp>
@@ -31,6 +32,102 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml,
   return FallbackHandlerFromString(value);
 }
 
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<ResponseCompressionConfig>) {
+  ResponseCompressionConfig config;
+  config.encodings =
+      value["encodings"].As<std::vector<std::string>>(config.encodings);
+  for (const auto& name : config.encodings) {
+    const auto encoding = compression::EncodingFromString(name);
+    if (!compression::IsSupported(encoding)) {
+      throw std::runtime_error(fmt::format(
+          "{} response compression is not supported by this build of "
+          "userver, at {}",
+          name, value.GetPath()));
+    }
+  }
+  config.min_body_size =
+      value["min_body_size"].As<size_t>(config.min_body_size);
+  config.level = value["level"].As<std::optional<int>>();
+  config.task_processor =
+      value["task_processor"].As<std::optional<std::string>>();
+  return config;
+}
+
+ResponseCacheConfig Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<ResponseCacheConfig>) {
+  ResponseCacheConfig config;
+  config.ways = value["ways"].As<size_t>(config.ways);
+  config.size = value["size"].As<size_t>(config.size);
+  config.max_bytes = value["max_bytes"].As<size_t>(config.max_bytes);
+  config.lifetime =
+      value["lifetime"].As<std::chrono::milliseconds>(config.lifetime);
+  config.args = value["args"].As<std::vector<std::string>>(config.args);
+  config.headers =
+      value["headers"].As<std::vector<std::string>>(config.headers);
+  if (config.ways == 0 || config.size == 0 ||
+      config.lifetime <= std::chrono::milliseconds::zero()) {
+    throw std::runtime_error(fmt::format(
+        "response cache ways, size and lifetime should be positive, at {}",
+        value.GetPath()));
+  }
+  return config;
+}
+
+AdmissionControlConfig Parse(const yaml_config::YamlConfig& value,
+                             formats::parse::To<AdmissionControlConfig>) {
+  AdmissionControlConfig config;
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.target_queue_time =
+      value["target_queue_time"].As<std::chrono::milliseconds>(
+          config.target_queue_time);
+  config.interval =
+      value["interval"].As<std::chrono::milliseconds>(config.interval);
+  if (config.target_queue_time <= std::chrono::milliseconds::zero() ||
+      config.interval < config.target_queue_time) {
+    throw std::runtime_error(fmt::format(
+        "admission control target_queue_time should be positive and not "
+        "greater than interval, at {}",
+        value.GetPath()));
+  }
+  return config;
+}
+
+HandlerCongestionControlConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<HandlerCongestionControlConfig>) {
+  HandlerCongestionControlConfig config;
+  auto& gradient = config.gradient;
+  config.fake_mode = value["fake_mode"].As<bool>(config.fake_mode);
+  gradient.enabled = value["enabled"].As<bool>(gradient.enabled);
+  gradient.tolerance = value["tolerance"].As<double>(gradient.tolerance);
+  gradient.errors_threshold_percent =
+      value["errors_threshold_percent"].As<double>(
+          gradient.errors_threshold_percent);
+  gradient.min_timings = value["min_timings"].As<std::chrono::milliseconds>(
+      gradient.min_timings);
+  gradient.min_limit = value["min_limit"].As<std::size_t>(gradient.min_limit);
+  gradient.min_qps = value["min_qps"].As<std::size_t>(gradient.min_qps);
+  gradient.safe_delta_limit =
+      value["deactivate_delta"].As<std::size_t>(gradient.safe_delta_limit);
+  if (gradient.tolerance < 1.0) {
+    throw std::runtime_error(fmt::format(
+        "congestion control tolerance should not be less than 1, at {}",
+        value.GetPath()));
+  }
+  return config;
+}
+
+MemoryAccountingConfig Parse(const yaml_config::YamlConfig& value,
+                             formats::parse::To<MemoryAccountingConfig>) {
+  MemoryAccountingConfig config;
+  config.max_bytes_in_flight =
+      value["max_bytes_in_flight"].As<std::optional<size_t>>();
+  config.max_request_bytes =
+      value["max_request_bytes"].As<std::optional<size_t>>();
+  return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config, bool is_monitor) {
@@ -60,6 +157,8 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
   }
 
   config.task_processor = value["task_processor"].As<std::string>();
+  config.task_priority =
+      value["task_priority"].As<engine::TaskPriority>(config.task_priority);
   config.method = value["method"].As<std::string>();
   config.request_config.max_request_size =
       value["max_request_size"].As<size_t>(handler_defaults.max_request_size);
@@ -83,11 +182,24 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
   config.max_requests_per_second =
       value["max_requests_per_second"].As<std::optional<size_t>>();
   config.decompress_request = value["decompress_request"].As<bool>(true);
+  config.response_compression =
+      value["response_compression"]
+          .As<std::optional<ResponseCompressionConfig>>();
+  config.response_cache =
+      value["response_cache"].As<std::optional<ResponseCacheConfig>>();
+  config.admission_control =
+      value["admission_control"].As<std::optional<AdmissionControlConfig>>();
+  config.congestion_control =
+      value["congestion_control"]
+          .As<std::optional<HandlerCongestionControlConfig>>();
+  config.memory_accounting =
+      value["memory_accounting"].As<std::optional<MemoryAccountingConfig>>();
   config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
   config.set_response_server_hostname =
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
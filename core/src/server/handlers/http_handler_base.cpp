@@ -4,8 +4,12 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <compression/gzip.hpp>
+#include <server/handlers/admission_control.hpp>
+#include <server/handlers/congestion_control.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
+#include <server/handlers/response_cache.hpp>
+#include <server/handlers/response_compression.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/server_config.hpp>
 #include <userver/baggage/baggage.hpp>
@@ -27,6 +31,7 @@
 #include <userver/server/handlers/impl/deadline_propagation_config.hpp>
 #include <userver/server/http/http_error.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response_body_stream.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
@@ -42,6 +47,7 @@
 #include <userver/utils/graphite.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/log.hpp>
+#include <userver/utils/memory_account.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/scope_guard.hpp>
 #include <userver/utils/text.hpp>
@@ -233,6 +239,16 @@ class RequestProcessor final {
     }
   }
 
+  void HandleMemoryLimitExceeded(std::string_view step_name,
+                                 const utils::MemoryLimitExceeded& ex) {
+    SetThrottleReason(
+        http_request_.GetHttpResponse(), ex.what(),
+        std::string{
+            USERVER_NAMESPACE::http::headers::ratelimit_reason::kMemory});
+    HandleCustomException(
+        step_name, ExceptionWithCode<HandlerErrorCode::kTooManyRequests>());
+  }
+
   void FinishProcessing() noexcept { process_finished_ = true; }
 
   const http::HttpRequest& GetRequest() { return http_request_; }
@@ -259,6 +275,8 @@ class RequestProcessor final {
       process_step_func();
     } catch (const CustomHandlerException& ex) {
       HandleCustomException(step_name, ex);
+    } catch (const utils::MemoryLimitExceeded& ex) {
+      HandleMemoryLimitExceeded(step_name, ex);
     } catch (const std::exception& ex) {
       process_finished_ = true;
       auto& response = http_request_.GetHttpResponse();
@@ -539,6 +557,35 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
         {1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
   }
 
+  if (const auto& compression_config = GetConfig().response_compression) {
+    engine::TaskProcessor* compression_task_processor = nullptr;
+    if (compression_config->task_processor) {
+      compression_task_processor =
+          &context.GetTaskProcessor(*compression_config->task_processor);
+    }
+    response_compression_ = std::make_unique<ResponseCompression>(
+        *compression_config, compression_task_processor);
+  }
+
+  if (const auto& cache_config = GetConfig().response_cache) {
+    response_cache_ = std::make_unique<ResponseCache>(*cache_config);
+  }
+
+  if (GetConfig().admission_control) {
+    admission_controller_ = std::make_unique<AdmissionController>();
+  }
+
+  if (const auto& congestion_control = GetConfig().congestion_control) {
+    congestion_control_ = std::make_unique<HandlerCongestionControl>(
+        handler_name_, *congestion_control, config_source_,
+        handler_statistics_->GetTotal());
+  }
+
+  if (const auto& memory_accounting = GetConfig().memory_accounting) {
+    memory_account_ = std::make_shared<utils::MemoryAccount>(
+        memory_accounting->max_bytes_in_flight);
+  }
+
   auto& server_component = context.FindComponent<components::Server>();
 
   engine::TaskProcessor& task_processor =
@@ -571,17 +618,32 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       std::move(prefix),
       [this](utils::statistics::Writer& result) {
         FormatStatistics(result["handler"], *handler_statistics_);
+        if (congestion_control_) {
+          result["handler"]["congestion-control"] = *congestion_control_;
+        }
+        if (memory_account_) {
+          result["handler"]["memory"] = *memory_account_;
+        }
+        if (response_cache_) {
+          result["handler"]["response-cache"] = *response_cache_;
+        }
         if constexpr (kIncludeServerHttpMetrics) {
           FormatStatistics(result["request"], *request_statistics_);
         }
       },
       std::move(labels));
 
-  set_response_server_hostname_ =
+  const bool set_response_server_hostname =
       GetConfig().set_response_server_hostname.value_or(
           server_component.GetServer()
               .GetConfig()
               .set_response_server_hostname);
+  if (set_response_server_hostname) {
+    AddConstantResponseHeaders({{
+        std::string{USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname},
+        kHostname,
+    }});
+  }
 }
 
 HttpHandlerBase::~HttpHandlerBase() { statistics_holder_.Unregister(); }
@@ -600,8 +662,21 @@ void HttpHandlerBase::HandleRequestStream(
   // Though it can be changed in HandleStreamRequest().
   response_body_stream.SetStatusCode(500);
 
+  if (response_compression_) {
+    auto [compressor, content_encoding] =
+        response_compression_->StartStreamCompression(http_request, response);
+    if (compressor) {
+      response_body_stream.SetCompressor(std::move(compressor),
+                                         content_encoding);
+    }
+  }
+
   try {
     HandleStreamRequest(http_request, context, response_body_stream);
+  } catch (const utils::MemoryLimitExceeded& e) {
+    LOG_WARNING() << "memory limit exceeded in '" << HandlerName()
+                  << "' handler in handle_request: " << e;
+    response_body_stream.SetStatusCode(http::HttpStatus::kTooManyRequests);
   } catch (const CustomHandlerException& e) {
     response_body_stream.SetStatusCode(http::GetHttpStatus(e));
 
@@ -634,6 +709,10 @@ void HttpHandlerBase::HandleRequestStream(
                                 }));
     }
   }
+
+  if (!engine::current_task::ShouldCancel()) {
+    response_body_stream.FinishCompression(engine::Deadline());
+  }
 }
 
 void HttpHandlerBase::HandleRequest(request::RequestBase& request,
@@ -644,6 +723,13 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
   http::HttpRequest http_request(http_request_impl);
   auto& response = http_request.GetHttpResponse();
   std::optional<tracing::Span> span_storage;
+  const auto start_time = std::chrono::steady_clock::now();
+
+  // A streamed response ends its headers while the handler runs, so the
+  // constant headers are attached before any of the processing steps
+  if (constant_response_headers_) {
+    response.SetPreparedHeaders(*constant_response_headers_);
+  }
 
   try {
     HttpHandlerStatisticsScope stats_scope(*handler_statistics_,
@@ -661,10 +747,34 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     SetUpBaggage(http_request, request_processor.GetInitialDynamicConfig());
     LogYandexHeaders(http_request);
 
+    if (admission_controller_) {
+      request_processor.ProcessRequestStep(
+          "check_admission", [this, &http_request, &request_processor] {
+            CheckAdmission(http_request,
+                           request_processor.GetInitialDynamicConfig());
+          });
+    }
+
     request_processor.ProcessRequestStep(
         "check_ratelimit",
         [this, &http_request] { CheckRatelimit(http_request); });
 
+    // The account of the request is inherited by the tasks it starts
+    std::optional<utils::MemoryAccountScope> memory_scope;
+    utils::MemoryCharge request_body_charge;
+    if (memory_account_) {
+      request_processor.ProcessRequestStep(
+          "check_memory",
+          [this, &http_request, &memory_scope, &request_body_charge] {
+            memory_scope.emplace(std::make_shared<utils::MemoryAccount>(
+                GetConfig().memory_accounting->max_request_bytes,
+                memory_account_));
+            // Fails for any body once the handler is over the limit
+            request_body_charge = utils::ChargeCurrentMemoryAccount(
+                http_request.RequestBody().size());
+          });
+    }
+
     request_processor.ProcessRequestStepNoScopeTime(
         kDeadlinePropagationStep, [&request_processor, &dp_context] {
           SetUpInheritedData(request_processor, dp_context);
@@ -676,6 +786,23 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
                     request_processor.GetInitialDynamicConfig());
         });
 
+    // Answered before the request data is parsed, so that the hits do not
+    // build the JSON of the request
+    std::string response_cache_key;
+    if (response_cache_) {
+      request_processor.ProcessRequestStep(
+          "lookup_response_cache",
+          [this, &http_request, &response, &request_processor,
+           &response_cache_key] {
+            response_cache_key = response_cache_->MakeKey(http_request);
+            if (!response_cache_key.empty() &&
+                response_cache_->TryRespond(response_cache_key, http_request,
+                                            response)) {
+              request_processor.FinishProcessing();
+            }
+          });
+    }
+
     if (GetConfig().decompress_request) {
       request_processor.ProcessRequestStep(
           "decompress_request_body",
@@ -713,6 +840,15 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
           }
         });
 
+    // Skipped on the hits and on the failures as the processing is finished
+    if (!response_cache_key.empty()) {
+      request_processor.ProcessRequestStep(
+          "store_response_cache",
+          [this, &http_request, &response, &response_cache_key] {
+            response_cache_->Store(response_cache_key, http_request, response);
+          });
+    }
+
     CompleteDeadlinePropagation(request_processor, dp_context);
     if (GetConfig().set_tracing_headers) {
       tracing_manager_.FillResponseWithTracingContext(*span_storage, response);
@@ -724,8 +860,27 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     LOG_ERROR() << "unable to handle request: " << ex;
   }
 
+  // The connection discards the rest of the body the handler did not read
+  http_request.GetBodyStream().Close();
+
+  // The throttled requests are quick and do not show the handler timings
+  if (congestion_control_ &&
+      response.GetStatus() != http::HttpStatus::kTooManyRequests) {
+    congestion_control_->Account(
+        std::chrono::steady_clock::now() - start_time,
+        response.GetStatus() == GetConfig().deadline_expired_status_code);
+  }
+
+  // After the request processor is gone to log the uncompressed body
+  if (response_compression_ && !response.IsBodyStreamed()) {
+    try {
+      response_compression_->CompressResponse(http_request, response);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "unable to compress response: " << ex;
+    }
+  }
+
   SetResponseAcceptEncoding(response);
-  SetResponseServerHostname(response);
   response.SetHeadersEnd();
 }
 
@@ -871,11 +1026,56 @@ void HttpHandlerBase::CheckRatelimit(
 
     throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
   }
+
+  if (congestion_control_ &&
+      !congestion_control_->Admit(total_statistics.GetInFlight())) {
+    auto& http_response = http_request.GetHttpResponse();
+    auto log_reason =
+        fmt::format("reached congestion control limit={}",
+                    congestion_control_->GetLimit().value_or(0));
+    SetThrottleReason(
+        http_response, std::move(log_reason),
+        std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kCC});
+
+    throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
+  }
+}
+
+void HttpHandlerBase::CheckAdmission(
+    const http::HttpRequest& http_request,
+    const dynamic_config::Snapshot& initial_config) const {
+  UASSERT(admission_controller_);
+  const auto& config =
+      initial_config[kAdmissionControl]
+          .GetOptional(handler_name_)
+          .value_or(*GetConfig().admission_control);
+
+  const auto now = std::chrono::steady_clock::now();
+  const auto queue_time = now - http_request.GetStartTime();
+  if (admission_controller_->Admit(queue_time, now, config)) return;
+
+  auto& http_response = http_request.GetHttpResponse();
+  auto log_reason = fmt::format(
+      "request waited for {}ms in the queues, target_queue_time={}ms",
+      std::chrono::duration_cast<std::chrono::milliseconds>(queue_time).count(),
+      config.target_queue_time.count());
+  SetThrottleReason(
+      http_response, std::move(log_reason),
+      std::string{
+          USERVER_NAMESPACE::http::headers::ratelimit_reason::kQueueTime});
+
+  handler_statistics_->GetByMethod(http_request.GetMethod())
+      .IncrementAdmissionRejected();
+  handler_statistics_->GetTotal().IncrementAdmissionRejected();
+
+  throw ExceptionWithCode<HandlerErrorCode::kTooManyRequests>();
 }
 
 void HttpHandlerBase::DecompressRequestBody(
     http::HttpRequest& http_request) const {
   if (!http_request.IsBodyCompressed()) return;
+  // Streamed bodies are passed to the handler as is
+  if (http_request.GetBodyStream().IsStreamed()) return;
 
   const auto& content_encoding = http_request.GetHeader(
       USERVER_NAMESPACE::http::headers::kContentEncoding);
@@ -983,12 +1183,16 @@ void HttpHandlerBase::SetResponseAcceptEncoding(
   }
 }
 
-void HttpHandlerBase::SetResponseServerHostname(
-    http::HttpResponse& response) const {
-  if (set_response_server_hostname_) {
-    response.SetHeader(USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname,
-                       kHostname);
+void HttpHandlerBase::AddConstantResponseHeaders(
+    http::PreparedHeaders::Headers headers) {
+  if (constant_response_headers_) {
+    auto all_headers = constant_response_headers_->GetHeaders();
+    all_headers.insert(all_headers.end(),
+                       std::make_move_iterator(headers.begin()),
+                       std::make_move_iterator(headers.end()));
+    headers = std::move(all_headers);
   }
+  constant_response_headers_.emplace(std::move(headers));
 }
 
 yaml_config::Schema HttpHandlerBase::GetStaticConfigSchema() {
@@ -27,6 +27,7 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
       in_flight(stats.GetInFlight()),
       too_many_requests_in_flight(stats.GetTooManyRequestsInFlight()),
       rate_limit_reached(stats.GetRateLimitReached()),
+      admission_rejected(stats.GetAdmissionRejected()),
       deadline_received(stats.GetDeadlineReceived()),
       cancelled_by_deadline(stats.GetCancelledByDeadline()) {}
 
@@ -37,6 +38,7 @@ void HttpHandlerStatisticsSnapshot::Add(
   in_flight += other.in_flight;
   too_many_requests_in_flight += other.too_many_requests_in_flight;
   rate_limit_reached += other.rate_limit_reached;
+  admission_rejected += other.admission_rejected;
   deadline_received += other.deadline_received;
   cancelled_by_deadline += other.cancelled_by_deadline;
 }
@@ -47,6 +49,7 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["in-flight"] = stats.in_flight;
   writer["too-many-requests-in-flight"] = stats.too_many_requests_in_flight;
   writer["rate-limit-reached"] = stats.rate_limit_reached;
+  writer["admission-rejected"] = stats.admission_rejected;
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
   writer["timings"] = stats.timings;
@@ -11,6 +11,7 @@
 #include <userver/utils/statistics/aggregated_values.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -37,11 +38,11 @@ class HttpHandlerMethodStatistics final {
 
   Percentile GetTimings() const { return timings_.GetStatsForPeriod(); }
 
-  size_t GetInFlight() const noexcept { return in_flight_; }
+  size_t GetInFlight() const noexcept { return in_flight_.Load(); }
 
-  void IncrementInFlight() noexcept { in_flight_++; }
+  void IncrementInFlight() noexcept { ++in_flight_; }
 
-  void DecrementInFlight() noexcept { in_flight_--; }
+  void DecrementInFlight() noexcept { --in_flight_; }
 
   void IncrementTooManyRequestsInFlight() noexcept {
     too_many_requests_in_flight_++;
@@ -55,8 +56,12 @@ class HttpHandlerMethodStatistics final {
 
   size_t GetRateLimitReached() const noexcept { return rate_limit_reached_; }
 
+  void IncrementAdmissionRejected() noexcept { admission_rejected_++; }
+
+  size_t GetAdmissionRejected() const noexcept { return admission_rejected_; }
+
   std::uint64_t GetDeadlineReceived() const noexcept {
-    return deadline_received_.load();
+    return deadline_received_.Load();
   }
 
   std::uint64_t GetCancelledByDeadline() const noexcept {
@@ -70,10 +75,12 @@ class HttpHandlerMethodStatistics final {
 
   RecentPeriod timings_;
   utils::statistics::HttpCodes reply_codes_;
-  std::atomic<std::size_t> in_flight_{0};
+  // Updated by each request, so sharded to not bounce a cache line
+  utils::statistics::ShardedRelaxedCounter<std::size_t> in_flight_;
   std::atomic<std::uint64_t> too_many_requests_in_flight_{0};
   std::atomic<std::uint64_t> rate_limit_reached_{0};
-  std::atomic<std::uint64_t> deadline_received_{0};
+  std::atomic<std::uint64_t> admission_rejected_{0};
+  utils::statistics::ShardedRelaxedCounter<std::uint64_t> deadline_received_;
   std::atomic<std::uint64_t> cancelled_by_deadline_{0};
 };
 
@@ -93,6 +100,7 @@ struct HttpHandlerStatisticsSnapshot final {
   std::size_t in_flight{0};
   std::uint64_t too_many_requests_in_flight{0};
   std::uint64_t rate_limit_reached{0};
+  std::uint64_t admission_rejected{0};
   std::uint64_t deadline_received{0};
   std::uint64_t cancelled_by_deadline{0};
 };
@@ -1,9 +1,15 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <memory>
+
+#include <server/http/conditional_request.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response_file_body.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,6 +24,71 @@ auto ParseContentTypeMap(const dynamic_config::DocsMap& docs_map) {
 }
 constexpr dynamic_config::Key<ParseContentTypeMap> kContentTypeMap{};
 
+std::string NotFound(const http::HttpRequest& request) {
+  request.GetResponse().SetStatusNotFound();
+  return "File not found";
+}
+
+// Hidden files and `..` segments are never served, just like the FsCache
+// skips hidden files
+bool IsServablePath(std::string_view path) {
+  if (path.empty() || path[0] != '/') return false;
+  return path.find("/.") == std::string_view::npos;
+}
+
+std::string GetExtension(std::string_view path) {
+  const auto dot = path.rfind('.');
+  if (dot == std::string_view::npos || path.find('/', dot) != path.npos) {
+    return {};
+  }
+  return std::string{path.substr(dot)};
+}
+
+// Sets the validators and the status of the response, returns false if no
+// body should be sent
+bool SetUpFileResponse(const http::HttpRequest& request, std::size_t size,
+                       std::time_t last_write_time, http::ByteRange& range) {
+  auto& response = request.GetHttpResponse();
+  auto etag = http::MakeFileETag(size, last_write_time);
+
+  if (http::MatchesIfNoneMatch(
+          request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch),
+          etag)) {
+    response.SetStatus(http::HttpStatus::kNotModified);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag,
+                       std::move(etag));
+    return false;
+  }
+
+  range = {0, size};
+  const auto& range_header =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kRange);
+  const auto& if_range =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kIfRange);
+  // The part the client has is stale if If-Range does not match
+  const bool is_range_valid =
+      !range_header.empty() && (if_range.empty() || if_range == etag);
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, std::move(etag));
+  if (!is_range_valid) return true;
+
+  switch (http::ParseByteRange(range_header, size, range)) {
+    case http::RangeKind::kWholeBody:
+      range = {0, size};
+      return true;
+    case http::RangeKind::kPartial:
+      response.SetStatus(http::HttpStatus::kPartialContent);
+      response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                         http::MakeContentRange(range, size));
+      return true;
+    case http::RangeKind::kNotSatisfiable:
+      response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+      response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                         http::MakeContentRange({}, size));
+      return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -25,24 +96,74 @@ HttpHandlerStatic::HttpHandlerStatic(
     const components::ComponentContext& context)
     : HttpHandlerBase(config, context),
       config_(context.FindComponent<components::DynamicConfig>().GetSource()),
-      storage_(context
-                   .FindComponent<components::FsCache>(
-                       config["fs-cache-component"].As<std::string>(
-                           "fs-cache-component"))
-                   .GetClient()) {}
+      zero_copy_dir_(config["zero-copy-dir"].As<std::optional<std::string>>()) {
+  AddConstantResponseHeaders({{
+      std::string{USERVER_NAMESPACE::http::headers::kAcceptRanges},
+      "bytes",
+  }});
+  if (zero_copy_dir_) {
+    fs_task_processor_ = &context.GetTaskProcessor(
+        config["fs-task-processor"].As<std::string>("fs-task-processor"));
+  } else {
+    storage_ = &context
+                    .FindComponent<components::FsCache>(
+                        config["fs-cache-component"].As<std::string>(
+                            "fs-cache-component"))
+                    .GetClient();
+  }
+}
 
 std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
-  const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
-    const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+  if (zero_copy_dir_) return ServeZeroCopy(request);
+  return ServeFromCache(request);
+}
+
+std::string HttpHandlerStatic::ServeFromCache(
+    const http::HttpRequest& request) const {
+  const auto file = storage_->TryGetFile(request.GetRequestPath());
+  if (!file) return NotFound(request);
+
+  const auto config = config_.GetSnapshot();
+  request.GetHttpResponse().SetContentType(
+      config[kContentTypeMap][file->extension]);
+
+  http::ByteRange range;
+  if (!SetUpFileResponse(request, file->data.size(), file->last_write_time,
+                         range)) {
+    return {};
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+  if (range.size == file->data.size()) return file->data;
+  return file->data.substr(range.offset, range.size);
+}
+
+std::string HttpHandlerStatic::ServeZeroCopy(
+    const http::HttpRequest& request) const {
+  const auto& path = request.GetRequestPath();
+  if (!IsServablePath(path)) return NotFound(request);
+
+  std::shared_ptr<const http::ResponseFileBody> file;
+  try {
+    file = engine::AsyncNoSpan(*fs_task_processor_, [this, &path] {
+             return std::make_shared<const http::ResponseFileBody>(
+                 *zero_copy_dir_ + path);
+           }).Get();
+  } catch (const std::exception& ex) {
+    LOG_DEBUG() << "Can't open the file: " << ex;
+    return NotFound(request);
+  }
+
+  const auto config = config_.GetSnapshot();
+  auto& response = request.GetHttpResponse();
+  response.SetContentType(config[kContentTypeMap][GetExtension(path)]);
+
+  http::ByteRange range;
+  if (SetUpFileResponse(request, file->GetSize(), file->GetLastWriteTime(),
+                        range)) {
+    response.SetFileBody(std::move(file), range.offset, range.size);
+  }
+  return {};
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -57,6 +178,15 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    zero-copy-dir:
+        type: string
+        description: |
+            Directory to serve the files from without reading them into the
+            memory, the FsCache component is not used if set
+    fs-task-processor:
+        type: string
+        description: Task processor to open the files from zero-copy-dir on
+        defaultDescription: fs-task-processor
 )");
 }
 
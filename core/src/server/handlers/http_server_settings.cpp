@@ -1,5 +1,7 @@
 #include <server/handlers/http_server_settings.hpp>
 
+#include <server/handlers/admission_control.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -21,6 +23,24 @@ bool ParseCancelHandleRequestByDeadline(
   return docs_map.Get("USERVER_CANCEL_HANDLE_REQUEST_BY_DEADLINE").As<bool>();
 }
 
+dynamic_config::ValueDict<AdmissionControlConfig> ParseAdmissionControl(
+    const dynamic_config::DocsMap& docs_map) {
+  constexpr std::string_view kName = "USERVER_HANDLER_ADMISSION_CONTROL";
+  if (!docs_map.Has(kName)) return {};
+  return docs_map.Get(kName)
+      .As<dynamic_config::ValueDict<AdmissionControlConfig>>();
+}
+
+dynamic_config::ValueDict<
+    USERVER_NAMESPACE::congestion_control::v2::GradientConfig>
+ParseCongestionControl(const dynamic_config::DocsMap& docs_map) {
+  constexpr std::string_view kName = "USERVER_HANDLER_CONGESTION_CONTROL";
+  if (!docs_map.Has(kName)) return {};
+  return docs_map.Get(kName)
+      .As<dynamic_config::ValueDict<
+          USERVER_NAMESPACE::congestion_control::v2::GradientConfig>>();
+}
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/server/handlers/handler_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,6 +26,21 @@ bool ParseCancelHandleRequestByDeadline(const dynamic_config::DocsMap&);
 inline constexpr dynamic_config::Key<ParseCancelHandleRequestByDeadline>
     kCancelHandleRequestByDeadline;
 
+// Overrides of the handlers admission_control static configs by handler name,
+// empty if the config is missing
+dynamic_config::ValueDict<AdmissionControlConfig> ParseAdmissionControl(
+    const dynamic_config::DocsMap&);
+
+inline constexpr dynamic_config::Key<ParseAdmissionControl> kAdmissionControl;
+
+// Overrides of the handlers congestion_control static configs by handler name,
+// empty if the config is missing
+dynamic_config::ValueDict<
+    USERVER_NAMESPACE::congestion_control::v2::GradientConfig>
+ParseCongestionControl(const dynamic_config::DocsMap&);
+
+inline constexpr dynamic_config::Key<ParseCongestionControl> kCongestionControl;
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
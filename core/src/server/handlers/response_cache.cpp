@@ -0,0 +1,128 @@
+#include <server/handlers/response_cache.hpp>
+
+#include <algorithm>
+#include <functional>
+
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_status.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+// The parts are prefixed with their sizes, so that the values with the
+// separators inside do not make the keys of the different requests equal
+void AppendKeyPart(std::string& key, std::string_view part) {
+  key += std::to_string(part.size());
+  key += ':';
+  key += part;
+}
+
+bool IsNoCacheRequested(const http::HttpRequest& request) {
+  const auto& cache_control =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kCacheControl);
+  return cache_control.find("no-cache") != std::string::npos ||
+         cache_control.find("no-store") != std::string::npos;
+}
+
+bool IsNotModified(const http::HttpRequest& request, const std::string& etag) {
+  const auto& if_none_match =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+  return if_none_match == etag || if_none_match == "*";
+}
+
+void SetNotModified(http::HttpResponse& response) {
+  response.SetStatus(http::HttpStatus::kNotModified);
+  response.SetData({});
+}
+
+}  // namespace
+
+ResponseCache::ResponseCache(const ResponseCacheConfig& config)
+    : args_(config.args),
+      headers_(config.headers),
+      cache_(config.ways, std::max<std::size_t>(config.size / config.ways, 1)) {
+  cache_.SetMaxLifetime(config.lifetime);
+  cache_.SetWayMaxWeight(config.max_bytes / config.ways);
+}
+
+std::string ResponseCache::MakeKey(const http::HttpRequest& request) const {
+  if (request.GetMethod() != http::HttpMethod::kGet) return {};
+
+  std::string key;
+  AppendKeyPart(key, request.GetRequestPath());
+  for (const auto& arg : args_) {
+    AppendKeyPart(key, arg);
+    const auto& values = request.GetArgVector(arg);
+    key += std::to_string(values.size());
+    for (const auto& value : values) AppendKeyPart(key, value);
+  }
+  for (const auto& header : headers_) {
+    AppendKeyPart(key, request.GetHeader(header));
+  }
+  return key;
+}
+
+bool ResponseCache::TryRespond(const std::string& key,
+                               const http::HttpRequest& request,
+                               http::HttpResponse& response) {
+  if (IsNoCacheRequested(request)) return false;
+
+  const auto entry = cache_.GetOptionalNoUpdate(key);
+  if (!entry) return false;
+
+  const auto& cached = **entry;
+  for (const auto& [name, value] : cached.headers) {
+    response.SetHeader(name, value);
+  }
+  if (IsNotModified(request, cached.etag)) {
+    SetNotModified(response);
+  } else {
+    response.SetData(cached.body);
+  }
+  return true;
+}
+
+void ResponseCache::Store(const std::string& key,
+                          const http::HttpRequest& request,
+                          http::HttpResponse& response) {
+  if (response.GetStatus() != http::HttpStatus::kOk ||
+      response.IsBodyStreamed()) {
+    return;
+  }
+  // The cookies are personal, the responses that set them are not shared
+  const auto cookie_names = response.GetCookieNames();
+  if (cookie_names.begin() != cookie_names.end()) return;
+
+  if (!response.HasHeader(USERVER_NAMESPACE::http::headers::kETag)) {
+    response.SetHeader(
+        USERVER_NAMESPACE::http::headers::kETag,
+        fmt::format("\"{:016x}\"",
+                    std::hash<std::string>{}(response.GetData())));
+  }
+
+  auto entry = std::make_shared<Entry>();
+  entry->body = response.GetData();
+  entry->etag = response.GetHeader(USERVER_NAMESPACE::http::headers::kETag);
+  for (const auto& name : response.GetHeaderNames()) {
+    entry->headers.emplace_back(name, response.GetHeader(name));
+  }
+  const bool is_not_modified = IsNotModified(request, entry->etag);
+  cache_.Put(key, std::move(entry));
+
+  if (is_not_modified) SetNotModified(response);
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ResponseCache& cache) {
+  writer = cache.cache_.GetStatistics();
+  writer["current-documents-count"] = cache.cache_.GetSizeApproximate();
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
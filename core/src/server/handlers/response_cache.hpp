@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// Caches the successful GET responses of a handler, see ResponseCacheConfig
+class ResponseCache final {
+ public:
+  explicit ResponseCache(const ResponseCacheConfig& config);
+
+  /// Returns the key of the request, an empty one if the request should not
+  /// be cached
+  std::string MakeKey(const http::HttpRequest& request) const;
+
+  /// Fills the response from the cache
+  /// @returns false if there is no fresh response for the key
+  bool TryRespond(const std::string& key, const http::HttpRequest& request,
+                  http::HttpResponse& response);
+
+  /// Stores the response if it is a cacheable one and sets its ETag
+  void Store(const std::string& key, const http::HttpRequest& request,
+             http::HttpResponse& response);
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ResponseCache& cache);
+
+ private:
+  struct Entry final {
+    std::string body;
+    std::string etag;
+    std::vector<std::pair<std::string, std::string>> headers;
+  };
+
+  friend std::size_t Weight(const Entry& entry) {
+    std::size_t weight = sizeof(entry) + entry.body.size();
+    for (const auto& [name, value] : entry.headers) {
+      weight += name.size() + value.size();
+    }
+    return weight;
+  }
+
+  const std::vector<std::string> args_;
+  const std::vector<std::string> headers_;
+  cache::ExpirableLruCache<std::string, std::shared_ptr<const Entry>> cache_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#include <server/handlers/response_cache.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <server/http/create_parser_test.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::HttpRequest;
+using server::http::HttpResponse;
+using server::http::HttpStatus;
+
+server::handlers::ResponseCacheConfig MakeConfig() {
+  server::handlers::ResponseCacheConfig config;
+  config.ways = 1;
+  config.size = 10;
+  config.lifetime = std::chrono::minutes{1};
+  config.args = {"id"};
+  config.headers = {"Accept-Language"};
+  return config;
+}
+
+// Runs the `handle` on the request parsed from the `request_data`
+void WithRequest(const std::string& request_data,
+                 const std::function<void(const HttpRequest&)>& handle) {
+  bool is_parsed = false;
+  auto parser = server::CreateTestParser(
+      [&](std::shared_ptr<server::request::RequestBase>&& request) {
+        is_parsed = true;
+        auto& request_impl =
+            dynamic_cast<server::http::HttpRequestImpl&>(*request);
+        handle(HttpRequest{request_impl});
+      });
+  parser.Parse(request_data.data(), request_data.size());
+  ASSERT_TRUE(is_parsed);
+}
+
+// Returns the body of the response, computing it with the `body` on a miss
+std::string Get(server::handlers::ResponseCache& cache,
+                const std::string& target, const std::string& body,
+                const std::string& extra_headers = {}) {
+  std::string result;
+  WithRequest("GET " + target + " HTTP/1.1\r\n" + extra_headers + "\r\n",
+              [&](const HttpRequest& request) {
+                auto& response = request.GetHttpResponse();
+                const auto key = cache.MakeKey(request);
+                if (!cache.TryRespond(key, request, response)) {
+                  response.SetData(body);
+                  cache.Store(key, request, response);
+                }
+                result = response.GetData();
+              });
+  return result;
+}
+
+}  // namespace
+
+UTEST(ResponseCache, Key) {
+  server::handlers::ResponseCache cache{MakeConfig()};
+
+  EXPECT_EQ(Get(cache, "/path?id=1&ignored=1", "first"), "first");
+  EXPECT_EQ(Get(cache, "/path?id=1&ignored=2", "second"), "first");
+  EXPECT_EQ(Get(cache, "/path?id=2", "third"), "third");
+  EXPECT_EQ(Get(cache, "/other?id=1", "fourth"), "fourth");
+  EXPECT_EQ(Get(cache, "/path?id=1", "fifth", "Accept-Language: en\r\n"),
+            "fifth");
+  EXPECT_EQ(Get(cache, "/path?id=1", "sixth", "Accept-Language: en\r\n"),
+            "fifth");
+}
+
+UTEST(ResponseCache, NoCache) {
+  server::handlers::ResponseCache cache{MakeConfig()};
+
+  EXPECT_EQ(Get(cache, "/path", "first"), "first");
+  EXPECT_EQ(Get(cache, "/path", "second", "Cache-Control: no-cache\r\n"),
+            "second");
+  EXPECT_EQ(Get(cache, "/path", "third"), "second");
+}
+
+UTEST(ResponseCache, ETag) {
+  server::handlers::ResponseCache cache{MakeConfig()};
+
+  std::string etag;
+  WithRequest("GET /path HTTP/1.1\r\n\r\n", [&](const HttpRequest& request) {
+    auto& response = request.GetHttpResponse();
+    const auto key = cache.MakeKey(request);
+    ASSERT_FALSE(cache.TryRespond(key, request, response));
+    response.SetData("body");
+    response.SetHeader(std::string_view{"X-Custom"}, "value");
+    cache.Store(key, request, response);
+    etag = response.GetHeader(http::headers::kETag);
+  });
+  ASSERT_FALSE(etag.empty());
+
+  WithRequest("GET /path HTTP/1.1\r\n\r\n", [&](const HttpRequest& request) {
+    auto& response = request.GetHttpResponse();
+    ASSERT_TRUE(cache.TryRespond(cache.MakeKey(request), request, response));
+    EXPECT_EQ(response.GetStatus(), HttpStatus::kOk);
+    EXPECT_EQ(response.GetData(), "body");
+    EXPECT_EQ(response.GetHeader(http::headers::kETag), etag);
+    EXPECT_EQ(response.GetHeader(std::string_view{"X-Custom"}), "value");
+  });
+
+  WithRequest("GET /path HTTP/1.1\r\nIf-None-Match: " + etag + "\r\n\r\n",
+              [&](const HttpRequest& request) {
+                auto& response = request.GetHttpResponse();
+                ASSERT_TRUE(cache.TryRespond(cache.MakeKey(request), request,
+                                             response));
+                EXPECT_EQ(response.GetStatus(), HttpStatus::kNotModified);
+                EXPECT_EQ(response.GetData(), "");
+              });
+}
+
+UTEST(ResponseCache, OnlySuccessfulGets) {
+  server::handlers::ResponseCache cache{MakeConfig()};
+
+  WithRequest("POST /path HTTP/1.1\r\n\r\n", [&](const HttpRequest& request) {
+    EXPECT_TRUE(cache.MakeKey(request).empty());
+  });
+
+  WithRequest("GET /path HTTP/1.1\r\n\r\n", [&](const HttpRequest& request) {
+    auto& response = request.GetHttpResponse();
+    response.SetStatus(HttpStatus::kInternalServerError);
+    response.SetData("error");
+    cache.Store(cache.MakeKey(request), request, response);
+  });
+  EXPECT_EQ(Get(cache, "/path", "body"), "body");
+}
+
+USERVER_NAMESPACE_END
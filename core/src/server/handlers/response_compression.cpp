@@ -0,0 +1,91 @@
+#include <server/handlers/response_compression.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::string_view kAcceptEncodingToken = "Accept-Encoding";
+
+// Caches must not serve the compressed body to clients that can't decode it
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+  const auto& vary =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{kAcceptEncodingToken});
+  } else if (vary.find(kAcceptEncodingToken) == std::string::npos &&
+             vary != "*") {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       vary + ", " + std::string{kAcceptEncodingToken});
+  }
+}
+
+}  // namespace
+
+ResponseCompression::ResponseCompression(
+    const ResponseCompressionConfig& config,
+    engine::TaskProcessor* task_processor)
+    : min_body_size_(config.min_body_size),
+      level_(config.level),
+      task_processor_(task_processor) {
+  encodings_.reserve(config.encodings.size());
+  for (const auto& name : config.encodings) {
+    encodings_.push_back(compression::EncodingFromString(name));
+  }
+}
+
+void ResponseCompression::CompressResponse(const http::HttpRequest& request,
+                                           http::HttpResponse& response) const {
+  const auto& body = response.GetData();
+  if (body.size() < min_body_size_) return;
+
+  const auto encoding = Negotiate(request, response);
+  if (!encoding) return;
+
+  std::string compressed;
+  if (task_processor_) {
+    compressed = engine::AsyncNoSpan(*task_processor_, [this, encoding, &body] {
+                   return compression::Compress(*encoding, level_, body);
+                 }).Get();
+  } else {
+    compressed = compression::Compress(*encoding, level_, body);
+  }
+  // Already compressed data may grow
+  if (compressed.size() >= body.size()) return;
+
+  response.SetData(std::move(compressed));
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding,
+                     std::string{compression::ToString(*encoding)});
+}
+
+ResponseCompression::StreamCompressor
+ResponseCompression::StartStreamCompression(
+    const http::HttpRequest& request, http::HttpResponse& response) const {
+  const auto encoding = Negotiate(request, response);
+  if (!encoding) return {};
+  return {compression::MakeCompressor(*encoding, level_),
+          compression::ToString(*encoding)};
+}
+
+std::optional<compression::Encoding> ResponseCompression::Negotiate(
+    const http::HttpRequest& request, http::HttpResponse& response) const {
+  // Ranges refer to the bytes of the uncompressed body
+  if (response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding) ||
+      response.HasHeader(USERVER_NAMESPACE::http::headers::kContentRange)) {
+    return std::nullopt;
+  }
+  AddVaryAcceptEncoding(response);
+  return compression::NegotiateEncoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+      encodings_);
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
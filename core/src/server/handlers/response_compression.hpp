@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+
+#include <compression/compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// Compresses the response bodies of a handler, see ResponseCompressionConfig
+class ResponseCompression final {
+ public:
+  /// @param task_processor to compress the bodies on, nullptr to compress in
+  /// the handler task
+  ResponseCompression(const ResponseCompressionConfig& config,
+                      engine::TaskProcessor* task_processor);
+
+  /// Compresses the body with an encoding accepted by the client
+  void CompressResponse(const http::HttpRequest& request,
+                        http::HttpResponse& response) const;
+
+  struct StreamCompressor {
+    std::unique_ptr<compression::Compressor> compressor;
+    std::string_view content_encoding;
+  };
+
+  /// Returns a compressor for the streamed body with an encoding accepted by
+  /// the client, an empty one if there is no such encoding
+  StreamCompressor StartStreamCompression(const http::HttpRequest& request,
+                                          http::HttpResponse& response) const;
+
+ private:
+  std::optional<compression::Encoding> Negotiate(
+      const http::HttpRequest& request, http::HttpResponse& response) const;
+
+  std::vector<compression::Encoding> encodings_;
+  const size_t min_body_size_;
+  const std::optional<int> level_;
+  engine::TaskProcessor* const task_processor_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <userver/components/statistics_storage.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_response_body_stream.hpp>
 #include <userver/utils/statistics/graphite.hpp>
 #include <userver/utils/statistics/json.hpp>
 #include <userver/utils/statistics/pretty_format.hpp>
@@ -66,47 +67,35 @@ ServerMonitor::ServerMonitor(
               .GetStorage()),
       common_labels_{config["common-labels"].As<CommonLabels>({})} {}
 
+struct ServerMonitor::ParsedRequest final {
+  StatsFormat format;
+  utils::statistics::Request statistics_request;
+};
+
 std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                                               request::RequestContext&) const {
-  const auto& prefix = request.GetArg("prefix");
-  const auto& path = request.GetArg("path");
-  if (!path.empty() && !prefix.empty() && path != prefix) {
-    throw handlers::ClientError(handlers::ExternalBody{
-        "Use either 'path' or 'prefix' URL parameter, not both"});
-  }
-
-  std::vector<utils::statistics::Label> labels;
-  const auto& labels_json = request.GetArg("labels");
-  if (!labels_json.empty()) {
-    auto json = formats::json::FromString(labels_json);
-    for (auto [key, value] : Items(json)) {
-      labels.emplace_back(std::move(key), value.As<std::string>());
-    }
-  }
+  const auto parsed = ParseRequest(request);
+  const auto& statistics_request = parsed.statistics_request;
 
-  const auto format = ParseFormat(request.GetArg("format"));
-
-  using utils::statistics::Request;
-  auto common_labels =
-      format == StatsFormat::kSolomon ? Request::AddLabels{} : common_labels_;
-  const auto statistics_request =
-      (path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels),
-                                              std::move(labels))
-                    : Request::MakeWithPath(path, std::move(common_labels),
-                                            std::move(labels)));
-
-  switch (format) {
+  switch (parsed.format) {
     case StatsFormat::kGraphite:
       return utils::statistics::ToGraphiteFormat(statistics_storage_,
                                                  statistics_request);
 
     case StatsFormat::kPrometheus:
-      return utils::statistics::ToPrometheusFormat(statistics_storage_,
-                                                   statistics_request);
-
-    case StatsFormat::kPrometheusUntyped:
-      return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_,
-                                                          statistics_request);
+    case StatsFormat::kPrometheusUntyped: {
+      std::string result;
+      if (WritePrometheusCached(parsed, [&result](std::string&& chunk) {
+            result += chunk;
+          })) {
+        return result;
+      }
+      return parsed.format == StatsFormat::kPrometheus
+                 ? utils::statistics::ToPrometheusFormat(statistics_storage_,
+                                                         statistics_request)
+                 : utils::statistics::ToPrometheusFormatUntyped(
+                       statistics_storage_, statistics_request);
+    }
 
     case StatsFormat::kJson:
       return utils::statistics::ToJsonFormat(statistics_storage_,
@@ -129,6 +118,99 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
   UINVARIANT(false, "Unexpected 'format' value");
 }
 
+void ServerMonitor::HandleStreamRequest(
+    const http::HttpRequest& request, request::RequestContext& context,
+    http::ResponseBodyStream& response) const {
+  const auto parsed = ParseRequest(request);
+  const auto& statistics_request = parsed.statistics_request;
+
+  response.SetStatusCode(http::HttpStatus::kOk);
+  response.SetEndOfHeaders();
+
+  const utils::statistics::ChunkConsumer consumer =
+      [&response](std::string&& chunk) {
+        response.PushBodyChunk(std::move(chunk), engine::Deadline{});
+      };
+
+  switch (parsed.format) {
+    case StatsFormat::kGraphite:
+      utils::statistics::ToGraphiteFormat(statistics_storage_,
+                                          statistics_request, consumer);
+      return;
+
+    case StatsFormat::kPrometheus:
+    case StatsFormat::kPrometheusUntyped:
+      if (!WritePrometheusCached(parsed, consumer)) {
+        // Another scrape is using the cache
+        utils::statistics::PrometheusCache cache;
+        WritePrometheus(parsed, cache, consumer);
+      }
+      return;
+
+    case StatsFormat::kSolomon:
+      utils::statistics::ToSolomonFormat(statistics_storage_, common_labels_,
+                                         statistics_request, consumer);
+      return;
+
+    default:
+      response.PushBodyChunk(HandleRequestThrow(request, context),
+                             engine::Deadline{});
+  }
+}
+
+ServerMonitor::ParsedRequest ServerMonitor::ParseRequest(
+    const http::HttpRequest& request) const {
+  const auto& prefix = request.GetArg("prefix");
+  const auto& path = request.GetArg("path");
+  if (!path.empty() && !prefix.empty() && path != prefix) {
+    throw handlers::ClientError(handlers::ExternalBody{
+        "Use either 'path' or 'prefix' URL parameter, not both"});
+  }
+
+  std::vector<utils::statistics::Label> labels;
+  const auto& labels_json = request.GetArg("labels");
+  if (!labels_json.empty()) {
+    auto json = formats::json::FromString(labels_json);
+    for (auto [key, value] : Items(json)) {
+      labels.emplace_back(std::move(key), value.As<std::string>());
+    }
+  }
+
+  const auto format = ParseFormat(request.GetArg("format"));
+
+  using utils::statistics::Request;
+  auto common_labels =
+      format == StatsFormat::kSolomon ? Request::AddLabels{} : common_labels_;
+  return {format, path.empty() ? Request::MakeWithPrefix(
+                                     prefix, std::move(common_labels),
+                                     std::move(labels))
+                               : Request::MakeWithPath(
+                                     path, std::move(common_labels),
+                                     std::move(labels))};
+}
+
+bool ServerMonitor::WritePrometheusCached(
+    const ParsedRequest& parsed,
+    const utils::statistics::ChunkConsumer& consumer) const {
+  const std::unique_lock lock{prometheus_cache_mutex_, std::try_to_lock};
+  if (!lock.owns_lock()) return false;
+
+  WritePrometheus(parsed, prometheus_cache_, consumer);
+  return true;
+}
+
+void ServerMonitor::WritePrometheus(
+    const ParsedRequest& parsed, utils::statistics::PrometheusCache& cache,
+    const utils::statistics::ChunkConsumer& consumer) const {
+  if (parsed.format == StatsFormat::kPrometheus) {
+    utils::statistics::ToPrometheusFormat(
+        statistics_storage_, parsed.statistics_request, cache, consumer);
+  } else {
+    utils::statistics::ToPrometheusFormatUntyped(
+        statistics_storage_, parsed.statistics_request, cache, consumer);
+  }
+}
+
 std::string ServerMonitor::GetResponseDataForLogging(const http::HttpRequest&,
                                                      request::RequestContext&,
                                                      const std::string&) const {
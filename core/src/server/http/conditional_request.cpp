@@ -0,0 +1,115 @@
+#include <server/http/conditional_request.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kOptionalWhitespace = " \t";
+constexpr std::string_view kWeakPrefix = "W/";
+constexpr std::string_view kBytesUnit = "bytes=";
+
+std::string_view Trim(std::string_view value) {
+  const auto begin = value.find_first_not_of(kOptionalWhitespace);
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(kOptionalWhitespace);
+  return value.substr(begin, end - begin + 1);
+}
+
+std::string_view StripWeakPrefix(std::string_view etag) {
+  if (etag.substr(0, kWeakPrefix.size()) == kWeakPrefix) {
+    etag.remove_prefix(kWeakPrefix.size());
+  }
+  return etag;
+}
+
+bool ParsePosition(std::string_view value, std::size_t& position) {
+  if (value.empty()) return false;
+  std::size_t result = 0;
+  for (const char c : value) {
+    if (c < '0' || c > '9') return false;
+    if (result > (std::numeric_limits<std::size_t>::max() - 9) / 10) {
+      return false;
+    }
+    result = result * 10 + (c - '0');
+  }
+  position = result;
+  return true;
+}
+
+}  // namespace
+
+std::string MakeFileETag(std::size_t size, std::time_t last_write_time) {
+  return fmt::format(FMT_COMPILE("\"{:x}-{:x}\""), last_write_time, size);
+}
+
+bool MatchesIfNoneMatch(std::string_view if_none_match, std::string_view etag) {
+  if (if_none_match.empty()) return false;
+  if (Trim(if_none_match) == "*") return true;
+
+  etag = StripWeakPrefix(etag);
+  while (!if_none_match.empty()) {
+    const auto comma = if_none_match.find(',');
+    if (StripWeakPrefix(Trim(if_none_match.substr(0, comma))) == etag) {
+      return true;
+    }
+    if (comma == std::string_view::npos) break;
+    if_none_match.remove_prefix(comma + 1);
+  }
+  return false;
+}
+
+RangeKind ParseByteRange(std::string_view range_header, std::size_t body_size,
+                         ByteRange& range) {
+  range_header = Trim(range_header);
+  if (range_header.substr(0, kBytesUnit.size()) != kBytesUnit) {
+    return RangeKind::kWholeBody;
+  }
+  const auto spec = Trim(range_header.substr(kBytesUnit.size()));
+  if (spec.find(',') != std::string_view::npos) return RangeKind::kWholeBody;
+
+  const auto dash = spec.find('-');
+  if (dash == std::string_view::npos) return RangeKind::kWholeBody;
+  const auto first = spec.substr(0, dash);
+  const auto last = spec.substr(dash + 1);
+
+  std::size_t first_pos = 0;
+  std::size_t last_pos = 0;
+  if (first.empty()) {
+    // suffix-range: the last N bytes
+    if (!ParsePosition(last, last_pos)) return RangeKind::kWholeBody;
+    if (last_pos == 0 || body_size == 0) return RangeKind::kNotSatisfiable;
+    range.size = std::min(last_pos, body_size);
+    range.offset = body_size - range.size;
+    return RangeKind::kPartial;
+  }
+
+  if (!ParsePosition(first, first_pos)) return RangeKind::kWholeBody;
+  if (last.empty()) {
+    last_pos = body_size - 1;
+  } else if (!ParsePosition(last, last_pos) || last_pos < first_pos) {
+    return RangeKind::kWholeBody;
+  }
+  if (first_pos >= body_size) return RangeKind::kNotSatisfiable;
+
+  range.offset = first_pos;
+  range.size = std::min(last_pos, body_size - 1) - first_pos + 1;
+  return RangeKind::kPartial;
+}
+
+std::string MakeContentRange(const ByteRange& range, std::size_t body_size) {
+  if (range.size == 0) return fmt::format(FMT_COMPILE("bytes */{}"), body_size);
+  return fmt::format(FMT_COMPILE("bytes {}-{}/{}"), range.offset,
+                     range.offset + range.size - 1, body_size);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
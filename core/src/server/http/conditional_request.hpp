@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// Strong entity tag of a file built from its size and modification time
+std::string MakeFileETag(std::size_t size, std::time_t last_write_time);
+
+/// @brief Whether the `If-None-Match` header value lists the entity tag, uses
+/// the weak comparison, see RFC 9110 13.1.2
+bool MatchesIfNoneMatch(std::string_view if_none_match, std::string_view etag);
+
+struct ByteRange {
+  std::size_t offset{0};
+  std::size_t size{0};
+};
+
+enum class RangeKind {
+  kWholeBody,  ///< no range, a malformed one, other units or several ranges
+  kPartial,
+  kNotSatisfiable,
+};
+
+/// @brief Parses the `Range` header value for a body of `body_size` bytes,
+/// only a single byte range is supported, see RFC 9110 14.1.2
+RangeKind ParseByteRange(std::string_view range_header, std::size_t body_size,
+                         ByteRange& range);
+
+/// `Content-Range` header value of a partial response
+std::string MakeContentRange(const ByteRange& range, std::size_t body_size);
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <server/http/conditional_request.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::ByteRange;
+using server::http::RangeKind;
+
+RangeKind Parse(std::string_view header, std::size_t size, ByteRange& range) {
+  return server::http::ParseByteRange(header, size, range);
+}
+
+}  // namespace
+
+TEST(ConditionalRequest, ETag) {
+  const auto etag = server::http::MakeFileETag(0x10, 0x5f00);
+  EXPECT_EQ(etag, "\"5f00-10\"");
+
+  EXPECT_FALSE(server::http::MatchesIfNoneMatch("", etag));
+  EXPECT_TRUE(server::http::MatchesIfNoneMatch("*", etag));
+  EXPECT_TRUE(server::http::MatchesIfNoneMatch(etag, etag));
+  EXPECT_TRUE(server::http::MatchesIfNoneMatch("W/\"5f00-10\"", etag));
+  EXPECT_TRUE(
+      server::http::MatchesIfNoneMatch("\"other\", \"5f00-10\" ", etag));
+  EXPECT_FALSE(server::http::MatchesIfNoneMatch("\"5f00-11\"", etag));
+}
+
+TEST(ConditionalRequest, Range) {
+  ByteRange range;
+  EXPECT_EQ(Parse("bytes=0-9", 100, range), RangeKind::kPartial);
+  EXPECT_EQ(range.offset, 0);
+  EXPECT_EQ(range.size, 10);
+  EXPECT_EQ(server::http::MakeContentRange(range, 100), "bytes 0-9/100");
+
+  EXPECT_EQ(Parse("bytes=90-", 100, range), RangeKind::kPartial);
+  EXPECT_EQ(range.offset, 90);
+  EXPECT_EQ(range.size, 10);
+
+  EXPECT_EQ(Parse("bytes=95-200", 100, range), RangeKind::kPartial);
+  EXPECT_EQ(range.offset, 95);
+  EXPECT_EQ(range.size, 5);
+
+  EXPECT_EQ(Parse("bytes=-20", 100, range), RangeKind::kPartial);
+  EXPECT_EQ(range.offset, 80);
+  EXPECT_EQ(range.size, 20);
+
+  EXPECT_EQ(Parse("bytes=-200", 100, range), RangeKind::kPartial);
+  EXPECT_EQ(range.offset, 0);
+  EXPECT_EQ(range.size, 100);
+}
+
+TEST(ConditionalRequest, RangeNotSatisfiable) {
+  ByteRange range;
+  EXPECT_EQ(Parse("bytes=100-", 100, range), RangeKind::kNotSatisfiable);
+  EXPECT_EQ(Parse("bytes=-0", 100, range), RangeKind::kNotSatisfiable);
+  EXPECT_EQ(Parse("bytes=0-", 0, range), RangeKind::kNotSatisfiable);
+  EXPECT_EQ(server::http::MakeContentRange({}, 100), "bytes */100");
+}
+
+TEST(ConditionalRequest, RangeWholeBody) {
+  ByteRange range;
+  for (const std::string_view header : {
+           "",
+           "items=0-1",
+           "bytes=0-1,5-6",
+           "bytes=5-1",
+           "bytes=a-b",
+           "bytes=5",
+           "bytes=-",
+       }) {
+    EXPECT_EQ(Parse(header, 100, range), RangeKind::kWholeBody) << header;
+  }
+}
+
+USERVER_NAMESPACE_END
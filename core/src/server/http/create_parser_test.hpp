@@ -9,27 +9,41 @@
 #include <userver/server/http/http_request.hpp>
 
 #include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server {
 
+namespace impl {
+
+inline const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
+inline constexpr server::request::HttpRequestConfig kTestRequestConfig{
+    /*.max_url_size = */ 8192,
+    /*.max_request_size = */ 1024 * 1024,
+    /*.max_headers_size = */ 65536,
+    /*.parse_args_from_body = */ false,
+    /*.testing_mode = */ true,  // non default value
+    /*.decompress_request = */ false,
+};
+inline server::net::ParserStats test_stats;
+inline server::request::ResponseDataAccounter test_accounter;
+
+}  // namespace impl
+
 inline server::http::HttpRequestParser CreateTestParser(
-    server::http::HttpRequestParser::OnNewRequestCb&& cb) {
-  static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
-  static constexpr server::request::HttpRequestConfig kTestRequestConfig{
-      /*.max_url_size = */ 8192,
-      /*.max_request_size = */ 1024 * 1024,
-      /*.max_headers_size = */ 65536,
-      /*.parse_args_from_body = */ false,
-      /*.testing_mode = */ true,  // non default value
-      /*.decompress_request = */ false,
-  };
-  static server::net::ParserStats test_stats;
-  static server::request::ResponseDataAccounter test_accounter;
-  return server::http::HttpRequestParser(kTestHandlerInfoIndex,
-                                         kTestRequestConfig, std::move(cb),
-                                         test_stats, test_accounter);
+    server::http::HttpRequestParser::OnNewRequestCb&& cb,
+    std::shared_ptr<server::http::HttpRequestPool> request_pool = {}) {
+  return server::http::HttpRequestParser(
+      impl::kTestHandlerInfoIndex, impl::kTestRequestConfig, std::move(cb),
+      impl::test_stats, impl::test_accounter, std::move(request_pool));
+}
+
+inline server::http::SimdHttpRequestParser CreateSimdTestParser(
+    server::http::SimdHttpRequestParser::OnNewRequestCb&& cb) {
+  return server::http::SimdHttpRequestParser(
+      impl::kTestHandlerInfoIndex, impl::kTestRequestConfig, std::move(cb),
+      impl::test_stats, impl::test_accounter);
 }
 
 }  // namespace server
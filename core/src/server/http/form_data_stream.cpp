@@ -0,0 +1,100 @@
+#include <userver/server/http/form_data_stream.hpp>
+
+#include <server/http/multipart_form_data_parser.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+using Event = MultipartFormDataStreamParser::Event;
+
+[[noreturn]] void ThrowParseError() {
+  throw handlers::RequestParseError(handlers::InternalMessage{
+      "failed to parse multipart/form-data request body"});
+}
+
+}  // namespace
+
+FormDataStream::FormDataStream(const HttpRequest& request)
+    : body_(request.GetBodyStream()) {
+  auto parser = MultipartFormDataStreamParser::Create(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType));
+  if (!parser) {
+    throw handlers::RequestParseError(handlers::InternalMessage{
+        "not a multipart/form-data request or no boundary"});
+  }
+  parser_ = std::make_unique<MultipartFormDataStreamParser>(std::move(*parser));
+}
+
+FormDataStream::FormDataStream(FormDataStream&&) noexcept = default;
+
+FormDataStream::~FormDataStream() = default;
+
+bool FormDataStream::NextPart(FormDataPart& part, engine::Deadline deadline) {
+  std::string skipped_data;
+  while (true) {
+    switch (parser_->Next(part, skipped_data)) {
+      case Event::kNeedMoreData:
+        ReadMore(deadline);
+        break;
+      case Event::kPartBegin:
+        is_in_part_ = true;
+        return true;
+      case Event::kPartData:
+        break;
+      case Event::kPartEnd:
+        is_in_part_ = false;
+        break;
+      case Event::kEnd:
+        return false;
+      case Event::kError:
+        ThrowParseError();
+    }
+  }
+}
+
+bool FormDataStream::ReadPartChunk(std::string& chunk,
+                                   engine::Deadline deadline) {
+  chunk.clear();
+  if (!is_in_part_) return false;
+
+  FormDataPart unused_part;
+  while (true) {
+    switch (parser_->Next(unused_part, chunk)) {
+      case Event::kNeedMoreData:
+        ReadMore(deadline);
+        break;
+      case Event::kPartData:
+        return true;
+      case Event::kPartEnd:
+        is_in_part_ = false;
+        return false;
+      case Event::kPartBegin:
+      case Event::kEnd:
+        UASSERT_MSG(false, "a part is not ended with a delimiter");
+        [[fallthrough]];
+      case Event::kError:
+        ThrowParseError();
+    }
+  }
+}
+
+void FormDataStream::ReadMore(engine::Deadline deadline) {
+  std::string chunk;
+  if (body_.ReadChunk(chunk, deadline)) {
+    parser_->Feed(chunk);
+  } else {
+    parser_->FinishInput();
+  }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <server/http/headers_propagator.hpp>
 
-#include <userver/server/request/task_inherited_request.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/request/task_inherited_request_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,10 +12,16 @@ HeadersPropagator::HeadersPropagator(std::vector<std::string>&& headers)
 
 void HeadersPropagator::PropagateHeaders(
     clients::http::RequestTracingEditor request) const {
+  if (headers_.empty()) return;
+
+  // the headers are read from the incoming request only when an outgoing
+  // one is made
+  const auto* incoming = server::request::kTaskInheritedRequest.GetOptional();
+  if (incoming == nullptr) return;
+
   for (const auto& header : headers_) {
-    if (server::request::HasTaskInheritedHeader(header)) {
-      request.SetHeader(header,
-                        server::request::GetTaskInheritedHeader(header));
+    if ((*incoming)->HasHeader(header)) {
+      request.SetHeader(header, (*incoming)->GetHeader(header));
     }
   }
 }
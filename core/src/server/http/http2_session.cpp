@@ -0,0 +1,502 @@
+#include "http2_session.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// HTTP/2 header names are always lowercase
+constexpr std::string_view kCookieName = "cookie";
+constexpr std::string_view kCookieSeparator = "; ";
+
+}  // namespace
+
+struct Http2Session::Stream final {
+  std::optional<HttpRequestConstructor> request_constructor;
+  const request::ResponseBase* response{nullptr};
+  std::string authority;
+  std::string cookie;
+  bool url_complete{false};
+  bool headers_complete{false};
+};
+
+struct Http2Session::PendingBody final {
+  std::string_view data;
+  size_t offset{0};
+  bool is_done{false};
+  bool is_closed{false};
+};
+
+void Http2Session::SessionDeleter::operator()(
+    nghttp2_session* session) const noexcept {
+  nghttp2_session_del(session);
+}
+
+Http2Session::Http2Session(const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           const net::Http2Config& config,
+                           engine::io::Socket& socket,
+                           OnNewRequestCb&& on_new_request_cb,
+                           net::ParserStats& parser_stats,
+                           net::Http2Stats& stats,
+                           request::ResponseDataAccounter& data_accounter)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      socket_(socket),
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      parser_stats_(parser_stats),
+      stats_(stats),
+      data_accounter_(data_accounter),
+      send_timeout_(config.send_timeout) {
+  nghttp2_session_callbacks* callbacks = nullptr;
+  if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+    throw std::bad_alloc();
+  }
+  nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks,
+                                                          &OnBeginHeaders);
+  nghttp2_session_callbacks_set_on_header_callback(callbacks, &OnHeader);
+  nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks,
+                                                       &OnFrameRecv);
+  nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks,
+                                                            &OnDataChunkRecv);
+  nghttp2_session_callbacks_set_on_stream_close_callback(callbacks,
+                                                         &OnStreamClose);
+
+  nghttp2_session* session = nullptr;
+  const auto rv = nghttp2_session_server_new(&session, callbacks, this);
+  nghttp2_session_callbacks_del(callbacks);
+  if (rv != 0) {
+    throw std::runtime_error(fmt::format(
+        "nghttp2_session_server_new() failed: {}", nghttp2_strerror(rv)));
+  }
+  session_.reset(session);
+
+  const std::array<nghttp2_settings_entry, 2> settings{{
+      {NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, config.max_concurrent_streams},
+      {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, config.initial_window_size},
+  }};
+  nghttp2_submit_settings(session_.get(), NGHTTP2_FLAG_NONE, settings.data(),
+                          settings.size());
+}
+
+Http2Session::~Http2Session() {
+  for (auto& [stream_id, stream] : streams_) {
+    if (stream->request_constructor) --parser_stats_.parsing_request_count;
+  }
+}
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  UASSERT(new_requests_.empty());
+  bool is_ok = true;
+  {
+    std::unique_lock lock(mutex_);
+    // The socket is broken after a failed write
+    if (is_stopped_) return false;
+
+    const auto rv = nghttp2_session_mem_recv(
+        session_.get(), reinterpret_cast<const std::uint8_t*>(data), size);
+    if (rv < 0) {
+      LOG_WARNING() << "nghttp2_session_mem_recv() failed: "
+                    << nghttp2_strerror(static_cast<int>(rv));
+      is_ok = false;
+    }
+    // Collects the SETTINGS and WINDOW_UPDATE frames, GOAWAY on errors and
+    // the DATA frames that were blocked by the flow control
+    CollectOutputLocked();
+    window_updated_cv_.NotifyAll();
+
+    if (!nghttp2_session_want_read(session_.get()) &&
+        !nghttp2_session_want_write(session_.get())) {
+      is_ok = false;
+    }
+  }
+
+  try {
+    Flush();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to send HTTP/2 frames: " << ex;
+    is_ok = false;
+  }
+
+  // The requests queue may block, so the handlers are started without
+  // holding the session lock
+  for (auto& request : new_requests_) {
+    on_new_request_cb_(std::move(request));
+  }
+  new_requests_.clear();
+  return is_ok;
+}
+
+std::optional<size_t> Http2Session::SendResponse(
+    const request::ResponseBase& response, const Http2Headers& headers,
+    std::optional<std::string_view> body) {
+  std::unique_lock lock(mutex_);
+  if (is_stopped_) return std::nullopt;
+
+  const auto response_it = response_streams_.find(&response);
+  if (response_it == response_streams_.end()) {
+    LOG_DEBUG() << "HTTP/2 stream was closed before the response was sent";
+    return std::nullopt;
+  }
+  const auto stream_id = response_it->second;
+  response_streams_.erase(response_it);
+
+  size_t sent_bytes = 0;
+  utils::SmallVector<nghttp2_nv, kHttp2OnStackHeadersCount> nva;
+  nva.reserve(headers.size());
+  for (const auto& header : headers) {
+    nva.push_back({reinterpret_cast<std::uint8_t*>(
+                       const_cast<char*>(header.name.data())),
+                   reinterpret_cast<std::uint8_t*>(
+                       const_cast<char*>(header.value.data())),
+                   header.name.size(), header.value.size(),
+                   NGHTTP2_NV_FLAG_NONE});
+    sent_bytes += header.name.size() + header.value.size();
+  }
+
+  nghttp2_data_provider data_provider{};
+  if (body) {
+    data_provider.read_callback = &ReadBody;
+    pending_bodies_[stream_id] = PendingBody{*body};
+  }
+  const auto rv = nghttp2_submit_response(session_.get(), stream_id,
+                                          nva.data(), nva.size(),
+                                          body ? &data_provider : nullptr);
+  if (rv != 0) {
+    LOG_WARNING() << "nghttp2_submit_response() failed: "
+                  << nghttp2_strerror(rv);
+    pending_bodies_.erase(stream_id);
+    return std::nullopt;
+  }
+  CollectOutputLocked();
+  lock.unlock();
+  try {
+    Flush();
+  } catch (const std::exception&) {
+    // ReadBody() must not touch the body after the response is gone
+    lock.lock();
+    pending_bodies_.erase(stream_id);
+    throw;
+  }
+  if (!body) return sent_bytes;
+
+  // DATA frames are produced by ReadBody() while the peer's flow control
+  // window allows, the rest is flushed by Parse() on WINDOW_UPDATE
+  lock.lock();
+  while (true) {
+    const auto it = pending_bodies_.find(stream_id);
+    UASSERT(it != pending_bodies_.end());
+    const auto pending = it->second;
+    if (pending.is_done || pending.is_closed || is_stopped_) {
+      pending_bodies_.erase(it);
+      sent_bytes += pending.offset;
+      if (pending.is_done) return sent_bytes;
+      return std::nullopt;
+    }
+
+    ++stats_.flow_control_stalls;
+    if (window_updated_cv_.WaitFor(lock, send_timeout_) ==
+        engine::CvStatus::kTimeout) {
+      LOG_WARNING() << "Timed out waiting for HTTP/2 flow control window";
+      pending_bodies_.erase(stream_id);
+      nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE, stream_id,
+                                NGHTTP2_CANCEL);
+      CollectOutputLocked();
+      lock.unlock();
+      Flush();
+      return std::nullopt;
+    }
+  }
+}
+
+void Http2Session::Stop() {
+  std::lock_guard lock(mutex_);
+  is_stopped_ = true;
+  window_updated_cv_.NotifyAll();
+}
+
+int Http2Session::OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                                 void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  if (frame->hd.type != NGHTTP2_HEADERS ||
+      frame->headers.cat != NGHTTP2_HCAT_REQUEST) {
+    return 0;
+  }
+
+  auto stream = std::make_unique<Stream>();
+  ++self->parser_stats_.parsing_request_count;
+  stream->request_constructor.emplace(self->request_constructor_config_,
+                                      self->handler_info_index_,
+                                      self->data_accounter_);
+  self->streams_[frame->hd.stream_id] = std::move(stream);
+  ++self->stats_.streams_opened;
+  return 0;
+}
+
+int Http2Session::OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                           const std::uint8_t* name, size_t name_size,
+                           const std::uint8_t* value, size_t value_size,
+                           std::uint8_t, void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  return self->OnHeaderImpl(
+      frame->hd.stream_id,
+      std::string_view{reinterpret_cast<const char*>(name), name_size},
+      std::string_view{reinterpret_cast<const char*>(value), value_size});
+}
+
+int Http2Session::OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                              void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  return self->OnFrameRecvImpl(*frame);
+}
+
+int Http2Session::OnDataChunkRecv(nghttp2_session*, std::uint8_t,
+                                  std::int32_t stream_id,
+                                  const std::uint8_t* data, size_t size,
+                                  void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  const auto it = self->streams_.find(stream_id);
+  if (it == self->streams_.end()) return 0;
+  auto& stream = *it->second;
+  if (!stream.request_constructor) return 0;
+
+  try {
+    stream.request_constructor->AppendBody(reinterpret_cast<const char*>(data),
+                                           size);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append body: " << ex;
+    self->FinalizeStream(stream_id, stream);
+  }
+  return 0;
+}
+
+int Http2Session::OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                                std::uint32_t error_code, void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  if (error_code != NGHTTP2_NO_ERROR) ++self->stats_.streams_reset;
+
+  const auto it = self->streams_.find(stream_id);
+  if (it != self->streams_.end()) {
+    const auto& stream = *it->second;
+    if (stream.request_constructor) {
+      --self->parser_stats_.parsing_request_count;
+    }
+    if (stream.response) self->response_streams_.erase(stream.response);
+    self->streams_.erase(it);
+  }
+
+  const auto body_it = self->pending_bodies_.find(stream_id);
+  if (body_it != self->pending_bodies_.end()) {
+    body_it->second.is_closed = true;
+    self->window_updated_cv_.NotifyAll();
+  }
+  return 0;
+}
+
+ssize_t Http2Session::ReadBody(nghttp2_session*, std::int32_t stream_id,
+                               std::uint8_t* buf, size_t length,
+                               std::uint32_t* data_flags, nghttp2_data_source*,
+                               void* user_data) {
+  auto* self = static_cast<Http2Session*>(user_data);
+  UASSERT(self != nullptr);
+  const auto it = self->pending_bodies_.find(stream_id);
+  if (it == self->pending_bodies_.end()) {
+    return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+  }
+
+  auto& pending = it->second;
+  const auto chunk_size =
+      std::min(length, pending.data.size() - pending.offset);
+  std::memcpy(buf, pending.data.data() + pending.offset, chunk_size);
+  pending.offset += chunk_size;
+  if (pending.offset == pending.data.size()) {
+    *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    pending.is_done = true;
+  }
+  return static_cast<ssize_t>(chunk_size);
+}
+
+int Http2Session::OnHeaderImpl(std::int32_t stream_id, std::string_view name,
+                               std::string_view value) {
+  const auto it = streams_.find(stream_id);
+  if (it == streams_.end()) return 0;
+  auto& stream = *it->second;
+  // Trailers are ignored, as with HTTP/1.1
+  if (!stream.request_constructor || stream.headers_complete) return 0;
+
+  auto& constructor = *stream.request_constructor;
+  LOG_TRACE() << "header: '" << name << "': '" << value << '\'';
+  try {
+    if (!name.empty() && name[0] == ':') {
+      if (name == ":method") {
+        constructor.SetMethod(HttpMethodFromString(value));
+      } else if (name == ":path") {
+        constructor.AppendUrl(value.data(), value.size());
+      } else if (name == ":authority") {
+        stream.authority = value;
+      }
+      return 0;
+    }
+
+    CompleteUrl(stream);
+    if (name == kCookieName) {
+      // HTTP/2 allows splitting the cookie header into several fields
+      if (!stream.cookie.empty()) stream.cookie.append(kCookieSeparator);
+      stream.cookie.append(value);
+      return 0;
+    }
+    constructor.AppendHeaderField(name.data(), name.size());
+    constructor.AppendHeaderValue(value.data(), value.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append header: " << ex;
+    FinalizeStream(stream_id, stream);
+  }
+  return 0;
+}
+
+int Http2Session::OnFrameRecvImpl(const nghttp2_frame& frame) {
+  switch (frame.hd.type) {
+    case NGHTTP2_WINDOW_UPDATE:
+    case NGHTTP2_SETTINGS:
+      window_updated_cv_.NotifyAll();
+      return 0;
+    case NGHTTP2_HEADERS:
+    case NGHTTP2_DATA:
+      break;
+    default:
+      return 0;
+  }
+
+  const auto stream_id = frame.hd.stream_id;
+  const auto it = streams_.find(stream_id);
+  if (it == streams_.end()) return 0;
+  auto& stream = *it->second;
+  if (!stream.request_constructor) return 0;
+
+  try {
+    if (frame.hd.type == NGHTTP2_HEADERS && !stream.headers_complete &&
+        (frame.hd.flags & NGHTTP2_FLAG_END_HEADERS)) {
+      auto& constructor = *stream.request_constructor;
+      CompleteUrl(stream);
+      if (!stream.cookie.empty()) {
+        constructor.AppendHeaderField(kCookieName.data(), kCookieName.size());
+        constructor.AppendHeaderValue(stream.cookie.data(),
+                                      stream.cookie.size());
+      }
+      constructor.AppendHeaderField("", 0);
+      stream.headers_complete = true;
+      LOG_TRACE() << "headers complete";
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't complete headers: " << ex;
+    FinalizeStream(stream_id, stream);
+    return 0;
+  }
+
+  if (frame.hd.flags & NGHTTP2_FLAG_END_STREAM) {
+    LOG_TRACE() << "message complete";
+    FinalizeStream(stream_id, stream);
+  }
+  return 0;
+}
+
+void Http2Session::FinalizeStream(std::int32_t stream_id, Stream& stream) {
+  UASSERT(stream.request_constructor);
+  // The connection outlives the stream
+  stream.request_constructor->SetIsFinal(false);
+  auto request = stream.request_constructor->Finalize();
+  --parser_stats_.parsing_request_count;
+  stream.request_constructor.reset();
+  if (!request) {
+    LOG_ERROR() << "request is null after Finalize()";
+    nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_INTERNAL_ERROR);
+    return;
+  }
+
+  stream.response = &request->GetResponse();
+  response_streams_[stream.response] = stream_id;
+  new_requests_.push_back(std::move(request));
+}
+
+void Http2Session::CompleteUrl(Stream& stream) {
+  if (stream.url_complete) return;
+  stream.url_complete = true;
+
+  auto& constructor = *stream.request_constructor;
+  constructor.SetHttpMajor(2);
+  constructor.SetHttpMinor(0);
+  constructor.ParseUrl();
+  if (!stream.authority.empty()) {
+    const std::string_view host_name = USERVER_NAMESPACE::http::headers::kHost;
+    constructor.AppendHeaderField(host_name.data(), host_name.size());
+    constructor.AppendHeaderValue(stream.authority.data(),
+                                  stream.authority.size());
+  }
+}
+
+void Http2Session::CollectOutputLocked() {
+  while (true) {
+    const std::uint8_t* data = nullptr;
+    const auto size = nghttp2_session_mem_send(session_.get(), &data);
+    if (size < 0) {
+      throw std::runtime_error(
+          fmt::format("nghttp2_session_mem_send() failed: {}",
+                      nghttp2_strerror(static_cast<int>(size))));
+    }
+    if (size == 0) break;
+    out_buffer_.append(reinterpret_cast<const char*>(data),
+                       static_cast<size_t>(size));
+  }
+}
+
+void Http2Session::Flush() {
+  // Whoever gets the send mutex first sends everything collected so far, so
+  // the frames reach the socket in the order nghttp2 produced them
+  std::lock_guard send_lock(send_mutex_);
+  send_buffer_.clear();
+  {
+    std::lock_guard lock(mutex_);
+    send_buffer_.swap(out_buffer_);
+  }
+  if (send_buffer_.empty()) return;
+
+  try {
+    const auto sent = socket_.SendAll(
+        send_buffer_.data(), send_buffer_.size(),
+        engine::Deadline::FromDuration(send_timeout_));
+    if (sent != send_buffer_.size()) {
+      throw std::runtime_error("HTTP/2 connection was closed by the peer");
+    }
+  } catch (const std::exception&) {
+    // A partially written frame breaks the whole connection
+    std::lock_guard lock(mutex_);
+    is_stopped_ = true;
+    window_updated_cv_.NotifyAll();
+    throw;
+  }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
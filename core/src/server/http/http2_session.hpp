@@ -0,0 +1,148 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <server/net/connection_config.hpp>
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/server/request/request_config.hpp>
+#include <userver/utils/small_vector.hpp>
+
+#include "http_request_constructor.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// Connection preface prefix of HTTP/2 with prior knowledge
+inline constexpr std::string_view kHttp2PrefaceStart = "PRI * HTTP/2.0";
+
+struct Http2Header final {
+  std::string name;
+  std::string value;
+};
+
+/// Fits the headers of a typical response without a dynamic allocation
+inline constexpr std::size_t kHttp2OnStackHeadersCount = 16;
+
+using Http2Headers =
+    utils::SmallVector<Http2Header, kHttp2OnStackHeadersCount>;
+
+/// @brief Server side of an HTTP/2 connection (h2c with prior knowledge).
+///
+/// Parse() is called by the connection reader, SendResponse() by the response
+/// sender. Both drive the nghttp2 session under the session mutex and write
+/// its output to the socket after releasing it, so that a peer that does not
+/// read does not block the other side of the connection.
+class Http2Session final : public request::RequestParser {
+ public:
+  using OnNewRequestCb =
+      std::function<void(std::shared_ptr<request::RequestBase>&&)>;
+
+  Http2Session(const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               const net::Http2Config& config, engine::io::Socket& socket,
+               OnNewRequestCb&& on_new_request_cb,
+               net::ParserStats& parser_stats, net::Http2Stats& stats,
+               request::ResponseDataAccounter& data_accounter);
+  ~Http2Session() override;
+
+  bool Parse(const char* data, size_t size) override;
+
+  /// @brief Sends the response on the stream of its request.
+  ///
+  /// Waits for the peer to open the flow control window if needed, the stream
+  /// is reset if the window stays closed for Http2Config::send_timeout.
+  /// @param body std::nullopt for responses without DATA frames
+  /// @returns the number of bytes sent, std::nullopt if the stream was closed
+  /// or reset before the whole response was sent
+  std::optional<size_t> SendResponse(const request::ResponseBase& response,
+                                     const Http2Headers& headers,
+                                     std::optional<std::string_view> body);
+
+  /// Wakes up and fails the pending responses, called when the connection
+  /// to the peer is lost.
+  void Stop();
+
+ private:
+  struct Stream;
+  struct PendingBody;
+  struct SessionDeleter {
+    void operator()(nghttp2_session* session) const noexcept;
+  };
+
+  static int OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                            void* user_data);
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const std::uint8_t* name, size_t name_size,
+                      const std::uint8_t* value, size_t value_size,
+                      std::uint8_t flags, void* user_data);
+  static int OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                         void* user_data);
+  static int OnDataChunkRecv(nghttp2_session*, std::uint8_t flags,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             size_t size, void* user_data);
+  static int OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data);
+  static ssize_t ReadBody(nghttp2_session*, std::int32_t stream_id,
+                          std::uint8_t* buf, size_t length,
+                          std::uint32_t* data_flags,
+                          nghttp2_data_source* source, void* user_data);
+
+  int OnHeaderImpl(std::int32_t stream_id, std::string_view name,
+                   std::string_view value);
+  int OnFrameRecvImpl(const nghttp2_frame& frame);
+
+  // Makes the request and passes it to the handlers after the session
+  // mutex is released
+  void FinalizeStream(std::int32_t stream_id, Stream& stream);
+  void CompleteUrl(Stream& stream);
+
+  // Moves everything nghttp2 has to send to out_buffer_
+  void CollectOutputLocked();
+
+  // Writes out_buffer_ to the socket, must be called without holding mutex_
+  void Flush();
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  engine::io::Socket& socket_;
+  OnNewRequestCb on_new_request_cb_;
+  net::ParserStats& parser_stats_;
+  net::Http2Stats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+  const std::chrono::milliseconds send_timeout_;
+
+  engine::Mutex send_mutex_;
+  std::string send_buffer_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable window_updated_cv_;
+  std::unique_ptr<nghttp2_session, SessionDeleter> session_;
+  std::unordered_map<std::int32_t, std::unique_ptr<Stream>> streams_;
+  std::unordered_map<const request::ResponseBase*, std::int32_t>
+      response_streams_;
+  std::unordered_map<std::int32_t, PendingBody> pending_bodies_;
+  std::vector<std::shared_ptr<request::RequestBase>> new_requests_;
+  std::string out_buffer_;
+  bool is_stopped_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(const std::string& buffered_body)
+    : buffered_body_(buffered_body) {}
+
+void RequestBodyStream::SetConsumer(Queue::Consumer&& consumer) {
+  UASSERT(!consumer_);
+  consumer_.emplace(std::move(consumer));
+  is_streamed_ = true;
+}
+
+void RequestBodyStream::Close() noexcept {
+  is_finished_ = true;
+  consumer_.reset();
+}
+
+bool RequestBodyStream::ReadChunk(std::string& chunk,
+                                  engine::Deadline deadline) {
+  chunk.clear();
+  if (is_finished_) return false;
+
+  if (!is_streamed_) {
+    is_finished_ = true;
+    chunk = buffered_body_;
+    return !chunk.empty();
+  }
+
+  if (!consumer_->Pop(chunk, deadline)) {
+    if (engine::current_task::ShouldCancel()) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+    if (deadline.IsReached()) {
+      throw engine::WaitInterruptedException(
+          engine::TaskCancellationReason::kDeadline);
+    }
+    is_finished_ = true;
+    consumer_.reset();
+    throw handlers::ClientError(handlers::InternalMessage{
+        "the client did not send the whole request body"});
+  }
+
+  if (chunk.empty()) {
+    is_finished_ = true;
+    // Lets the connection discard the rest of the data without waiting
+    consumer_.reset();
+    return false;
+  }
+  return true;
+}
+
+std::string RequestBodyStream::ReadAll(engine::Deadline deadline) {
+  std::string body;
+  std::string chunk;
+  while (ReadChunk(chunk, deadline)) body.append(chunk);
+  return body;
+}
+
+bool RequestBodyStream::IsStreamed() const noexcept { return is_streamed_; }
+
+bool RequestBodyStream::IsFinished() const noexcept { return is_finished_; }
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -43,10 +43,13 @@ void StripDuplicateStartingSlashes(std::string& s) {
 
 HttpRequestConstructor::HttpRequestConstructor(
     Config config, const HandlerInfoIndex& handler_info_index,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    HttpRequestPool* request_pool)
     : config_(config),
       handler_info_index_(handler_info_index),
-      request_(std::make_shared<HttpRequestImpl>(data_accounter)) {}
+      request_(request_pool
+                   ? request_pool->Create(data_accounter)
+                   : std::make_shared<HttpRequestImpl>(data_accounter)) {}
 
 void HttpRequestConstructor::SetMethod(HttpMethod method) {
   request_->orig_method_ = method;
@@ -113,6 +116,7 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    is_body_streamed_ = handler_config.request_body_stream;
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
@@ -157,12 +161,29 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
   header_value_.append(data, size);
 }
 
+void HttpRequestConstructor::AppendHeader(std::string_view name,
+                                          std::string_view value) {
+  UASSERT(!header_field_flag_ && !header_value_flag_);
+  AccountHeadersSize(name.size() + value.size());
+  AccountRequestSize(name.size() + value.size());
+
+  // The views point into the read buffer that is reused for the next reads,
+  // while the request outlives it, so the header map owns copies
+  InsertHeader(std::string{name}, std::string{value});
+}
+
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   AccountRequestSize(size);
+  if (is_headers_finalized_) {
+    PushBody(data, size);
+    return;
+  }
   request_->request_body_.append(data, size);
 }
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
+  // Set before FinalizeHeaders(), the request is owned by the handler then
+  if (is_headers_finalized_) return;
   request_->is_final_ = is_final;
 }
 
@@ -177,6 +198,53 @@ std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
   return std::move(request_);  // request_ is left empty
 }
 
+std::shared_ptr<request::RequestBase>
+HttpRequestConstructor::FinalizeHeaders() {
+  UASSERT(is_body_streamed_);
+  UASSERT(!is_headers_finalized_);
+  is_headers_finalized_ = true;
+
+  FinalizeImpl();
+  CheckStatus();
+
+  if (status_ == Status::kOk) {
+    const auto queue = RequestBodyStream::Queue::Create(
+        RequestBodyStream::kMaxBufferedChunks);
+    request_->body_stream_.SetConsumer(queue->GetConsumer());
+    body_producer_.emplace(queue->GetProducer());
+  }
+
+  // The consumer of the body must not be kept alive by the constructor,
+  // otherwise a handler that does not read the body blocks the connection
+  // until the whole request is received
+  url_ = request_->GetUrl();
+  return std::move(request_);  // request_ is left empty
+}
+
+void HttpRequestConstructor::FinishBody() {
+  UASSERT(is_headers_finalized_);
+  if (body_producer_) {
+    // An empty chunk tells the handler that the body is complete
+    [[maybe_unused]] const bool pushed = body_producer_->Push({});
+    body_producer_.reset();
+  }
+}
+
+void HttpRequestConstructor::PushBody(const char* data, size_t size) {
+  while (body_producer_ && size != 0) {
+    // Bounds the bytes waiting for the handler whatever the read size is
+    const auto chunk_size = std::min(size, RequestBodyStream::kMaxChunkSize);
+    if (!body_producer_->Push(std::string(data, chunk_size))) {
+      // The handler does not read the body anymore, the rest is discarded
+      LOG_DEBUG() << "request body stream is closed, discarding the rest of "
+                     "the body";
+      body_producer_.reset();
+    }
+    data += chunk_size;
+    size -= chunk_size;
+  }
+}
+
 void HttpRequestConstructor::FinalizeImpl() {
   if (status_ != Status::kOk &&
       (!config_.testing_mode || status_ != Status::kHandlerNotFound)) {
@@ -190,7 +258,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   try {
     ParseArgs(parsed_url_);
-    if (config_.parse_args_from_body) {
+    if (config_.parse_args_from_body && !is_headers_finalized_) {
       if (!config_.decompress_request || !request_->IsBodyCompressed())
         ParseArgs(request_->request_body_.data(),
                   request_->request_body_.size());
@@ -220,7 +288,8 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
+  // Streamed multipart bodies are parsed by the handler with FormDataStream
+  if (!is_headers_finalized_ && IsMultipartFormDataContentType(content_type)) {
     if (!ParseMultipartFormData(content_type, request_->RequestBody(),
                                 request_->form_data_args_)) {
       SetStatus(Status::kParseMultipartFormDataError);
@@ -245,9 +314,18 @@ void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
 void HttpRequestConstructor::AddHeader() {
   UASSERT(header_field_flag_);
 
+  InsertHeader(std::move(header_field_), std::move(header_value_));
+  header_field_.clear();
+  header_value_.clear();
+}
+
+void HttpRequestConstructor::InsertHeader(std::string name,
+                                          std::string value) {
+  // The trailers of a streamed body, the request is owned by the handler
+  if (is_headers_finalized_) return;
+
   try {
-    request_->headers_.InsertOrAppend(std::move(header_field_),
-                                      std::move(header_value_));
+    request_->headers_.InsertOrAppend(std::move(name), std::move(value));
   } catch (const USERVER_NAMESPACE::http::headers::HeaderMap::
                TooManyHeadersException&) {
     SetStatus(Status::kHeadersTooLarge);
@@ -255,8 +333,6 @@ void HttpRequestConstructor::AddHeader() {
         "HeaderMap reached its maximum capacity, already contains {} headers",
         request_->headers_.size()));
   }
-  header_field_.clear();
-  header_value_.clear();
 }
 
 void HttpRequestConstructor::ParseCookies() {
@@ -315,7 +391,7 @@ void HttpRequestConstructor::AccountRequestSize(size_t size) {
         "request is too large, " + std::to_string(request_size_) + ">" +
         std::to_string(config_.max_request_size) +
         " (enforced by 'max_request_size' handler limit in config.yaml)" +
-        ", url: " + (url_parsed_ ? request_->GetUrl() : "not parsed yet") +
+        ", url: " + (url_parsed_ ? GetUrl() : "not parsed yet") +
         ", added size " + std::to_string(size));
   }
 }
@@ -340,11 +416,15 @@ void HttpRequestConstructor::AccountHeadersSize(size_t size) {
                             std::to_string(config_.max_headers_size) +
                             " (enforced by 'max_headers_size' handler limit in "
                             "config.yaml)" +
-                            ", url: " + request_->GetUrl() + ", added size " +
+                            ", url: " + GetUrl() + ", added size " +
                             std::to_string(size));
   }
 }
 
+const std::string& HttpRequestConstructor::GetUrl() const {
+  return request_ ? request_->GetUrl() : url_;
+}
+
 void HttpRequestConstructor::CheckStatus() const {
   switch (status_) {
     case Status::kOk:
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 
 #include <http_parser.h>
 
@@ -12,6 +15,7 @@
 
 #include "handler_info_index.hpp"
 #include "http_request_impl.hpp"
+#include "http_request_pool.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,9 +39,11 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   using Config = server::request::HttpRequestConfig;
 
+  /// @param request_pool if set, the request memory is taken from the pool
   HttpRequestConstructor(Config config,
                          const HandlerInfoIndex& handler_info_index,
-                         request::ResponseDataAccounter& data_accounter);
+                         request::ResponseDataAccounter& data_accounter,
+                         HttpRequestPool* request_pool = nullptr);
 
   HttpRequestConstructor(HttpRequestConstructor&&) = delete;
   HttpRequestConstructor& operator=(HttpRequestConstructor&&) = delete;
@@ -50,18 +56,40 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void ParseUrl();
   void AppendHeaderField(const char* data, size_t size);
   void AppendHeaderValue(const char* data, size_t size);
+  // Adds a complete header, must not be mixed with AppendHeaderField() and
+  // AppendHeaderValue() for the same request. The name and the value are
+  // copied, they may point into the read buffer.
+  void AppendHeader(std::string_view name, std::string_view value);
   void AppendBody(const char* data, size_t size);
 
   void SetIsFinal(bool is_final);
 
   std::shared_ptr<request::RequestBase> Finalize() override;
 
+  // Whether the handler reads the body with RequestBodyStream, known after
+  // ParseUrl()
+  bool IsBodyStreamed() const { return is_body_streamed_; }
+
+  // Finalizes the request once its headers are complete and hands it over,
+  // the following AppendBody() calls pass the data to the RequestBodyStream
+  // of the request. Blocks in AppendBody() while the handler does not keep
+  // up, the rest of the body is discarded once the stream is closed.
+  std::shared_ptr<request::RequestBase> FinalizeHeaders();
+
+  bool IsHeadersFinalized() const { return is_headers_finalized_; }
+
+  // Ends the body of the request returned by FinalizeHeaders(), the handler
+  // gets an error if the constructor is destroyed without calling it
+  void FinishBody();
+
  private:
   void FinalizeImpl();
+  void PushBody(const char* data, size_t size);
 
   void ParseArgs(const http_parser_url& url);
   void ParseArgs(const char* data, size_t size);
   void AddHeader();
+  void InsertHeader(std::string name, std::string value);
   void ParseCookies();
 
   void SetStatus(Status status);
@@ -69,6 +97,9 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void AccountUrlSize(size_t size);
   void AccountHeadersSize(size_t size);
 
+  // The url for the error messages, also after FinalizeHeaders()
+  const std::string& GetUrl() const;
+
   void CheckStatus() const;
 
   Config config_;
@@ -84,9 +115,15 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   size_t url_size_ = 0;
   size_t headers_size_ = 0;
   bool url_parsed_ = false;
+  bool is_body_streamed_ = false;
+  bool is_headers_finalized_ = false;
   Status status_ = Status::kOk;
 
   std::shared_ptr<HttpRequestImpl> request_;
+  // The url of the request handed over by FinalizeHeaders()
+  std::string url_;
+  // Engaged after FinalizeHeaders() until the handler stops reading the body
+  std::optional<RequestBodyStream::Queue::Producer> body_producer_;
 };
 
 }  // namespace server::http
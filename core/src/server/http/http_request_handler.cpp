@@ -193,10 +193,12 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     request->GetResponse().SetReady(now);
   };
 
+  const auto priority = handler->GetConfig().task_priority;
   if (!is_monitor_ && throttling_enabled) {
-    return engine::AsyncNoSpan(*task_processor, std::move(payload));
+    return engine::AsyncNoSpan(*task_processor, priority, std::move(payload));
   } else {
-    return engine::CriticalAsyncNoSpan(*task_processor, std::move(payload));
+    return engine::CriticalAsyncNoSpan(*task_processor, priority,
+                                       std::move(payload));
   }
 }  // namespace http
 
@@ -6,6 +6,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
@@ -74,16 +75,39 @@ namespace server::http {
 // unordered_maps because we don't need different seeds and want to avoid its
 // overhead.
 HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter)
-    : form_data_args_(kZeroAllocationBucketCount,
+    : HttpRequestImpl(
+          data_accounter,
+          Buffers{{}, {}, {}, HttpRequest::HeadersMap(kBucketCount)}) {}
+
+HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter,
+                                 Buffers&& buffers)
+    : url_(std::move(buffers.url)),
+      request_path_(std::move(buffers.request_path)),
+      request_body_(std::move(buffers.request_body)),
+      form_data_args_(kZeroAllocationBucketCount,
                       request_args_.hash_function()),
       path_args_by_name_index_(kZeroAllocationBucketCount,
                                request_args_.hash_function()),
-      headers_(kBucketCount),
+      headers_(std::move(buffers.headers)),
       cookies_(kZeroAllocationBucketCount, request_args_.hash_function()),
-      response_(*this, data_accounter) {}
+      body_stream_(request_body_),
+      response_(*this, data_accounter) {
+  UASSERT(url_.empty() && request_path_.empty() && request_body_.empty());
+  UASSERT(headers_.empty());
+}
 
 HttpRequestImpl::~HttpRequestImpl() = default;
 
+HttpRequestImpl::Buffers HttpRequestImpl::ReleaseBuffers() noexcept {
+  Buffers buffers{std::move(url_), std::move(request_path_),
+                  std::move(request_body_), std::move(headers_)};
+  buffers.url.clear();
+  buffers.request_path.clear();
+  buffers.request_body.clear();
+  buffers.headers.clear();
+  return buffers;
+}
+
 std::chrono::duration<double> HttpRequestImpl::GetRequestTime() const {
   return GetResponse().SentTime() - StartTime();
 }
@@ -339,9 +363,13 @@ void HttpRequestImpl::WriteAccessLog(
           EscapeForAccessLog(GetOrigMethodStr()), EscapeForAccessLog(GetUrl()),
           GetHttpMajor(), GetHttpMinor(),
           static_cast<int>(response_.GetStatus()),
-          EscapeForAccessLog(GetHeader("Referer")),
-          EscapeForAccessLog(GetHeader("User-Agent")),
-          EscapeForAccessLog(GetHeader("Cookie")), GetRequestTime().count(),
+          EscapeForAccessLog(
+              GetHeader(USERVER_NAMESPACE::http::headers::kReferer)),
+          EscapeForAccessLog(
+              GetHeader(USERVER_NAMESPACE::http::headers::kUserAgent)),
+          EscapeForAccessLog(
+              GetHeader(USERVER_NAMESPACE::http::headers::kCookie)),
+          GetRequestTime().count(),
           GetResponse().BytesSent(), GetResponseTime().count()));
 }
 
@@ -377,14 +405,20 @@ void HttpRequestImpl::WriteAccessTskvLog(
                   static_cast<int>(response_.GetStatus()), GetHttpMajor(),
                   GetHttpMinor(), EscapeForAccessTskvLog(GetOrigMethodStr()),
                   EscapeForAccessTskvLog(GetUrl()),
-                  EscapeForAccessTskvLog(GetHeader("Referer")),
-                  EscapeForAccessTskvLog(GetHeader("Cookie")),
-                  EscapeForAccessTskvLog(GetHeader("User-Agent")),
+                  EscapeForAccessTskvLog(
+                      GetHeader(USERVER_NAMESPACE::http::headers::kReferer)),
+                  EscapeForAccessTskvLog(
+                      GetHeader(USERVER_NAMESPACE::http::headers::kCookie)),
+                  EscapeForAccessTskvLog(
+                      GetHeader(USERVER_NAMESPACE::http::headers::kUserAgent)),
                   EscapeForAccessTskvLog(GetHost()),
                   EscapeForAccessTskvLog(remote_address),
-                  EscapeForAccessTskvLog(GetHeader("X-Forwarded-For")),
-                  EscapeForAccessTskvLog(GetHeader("X-Real-IP")),
-                  EscapeForAccessTskvLog(GetHeader("X-YaRequestId")),
+                  EscapeForAccessTskvLog(GetHeader(
+                      USERVER_NAMESPACE::http::headers::kXForwardedFor)),
+                  EscapeForAccessTskvLog(
+                      GetHeader(USERVER_NAMESPACE::http::headers::kXRealIp)),
+                  EscapeForAccessTskvLog(GetHeader(
+                      USERVER_NAMESPACE::http::headers::kXYaRequestId)),
                   EscapeForAccessTskvLog(GetHost()),
                   EscapeForAccessTskvLog(remote_address),
                   GetRequestTime().count(), GetResponseTime().count(),
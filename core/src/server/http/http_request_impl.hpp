@@ -10,6 +10,7 @@
 
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
@@ -27,9 +28,22 @@ namespace http {
 
 class HttpRequestImpl final : public request::RequestBase {
  public:
+  /// Memory of a finished request reused by the next one, see HttpRequestPool
+  struct Buffers {
+    std::string url;
+    std::string request_path;
+    std::string request_body;
+    HttpRequest::HeadersMap headers;
+  };
+
   HttpRequestImpl(request::ResponseDataAccounter& data_accounter);
+  HttpRequestImpl(request::ResponseDataAccounter& data_accounter,
+                  Buffers&& buffers);
   ~HttpRequestImpl() override;
 
+  /// Moves out the cleared buffers, the request must not be used afterwards
+  Buffers ReleaseBuffers() noexcept;
+
   const HttpMethod& GetMethod() const { return method_; }
   const HttpMethod& GetOrigMethod() const { return orig_method_; }
   const std::string& GetMethodStr() const { return ToString(method_); }
@@ -85,6 +99,7 @@ class HttpRequestImpl final : public request::RequestBase {
   const HttpRequest::CookiesMap& GetCookies() const;
 
   const std::string& RequestBody() const { return request_body_; }
+  RequestBodyStream& GetBodyStream() const { return body_stream_; }
   void SetRequestBody(std::string body);
   void ParseArgsFromBody();
   void SetResponseStatus(HttpStatus status) const {
@@ -148,6 +163,7 @@ class HttpRequestImpl final : public request::RequestBase {
   HttpRequest::HeadersMap headers_;
   HttpRequest::CookiesMap cookies_;
   bool is_final_{false};
+  mutable RequestBodyStream body_stream_;
 
   mutable HttpResponse response_;
   engine::TaskProcessor* task_processor_{nullptr};
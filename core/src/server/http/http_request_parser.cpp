@@ -52,12 +52,14 @@ HttpRequestParser::HttpRequestParser(
     const HandlerInfoIndex& handler_info_index,
     const request::HttpRequestConfig& request_config,
     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<HttpRequestPool> request_pool)
     : handler_info_index_(handler_info_index),
       request_constructor_config_{request_config},
       on_new_request_cb_(std::move(on_new_request_cb)),
       stats_(stats),
-      data_accounter_(data_accounter) {
+      data_accounter_(data_accounter),
+      request_pool_(std::move(request_pool)) {
   http_parser_init(&parser_, HTTP_REQUEST);
   parser_.data = this;
 }
@@ -182,6 +184,11 @@ int HttpRequestParser::OnHeadersCompleteImpl(http_parser* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+
+  if (request_constructor_->IsBodyStreamed()) {
+    request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+    on_new_request_cb_(request_constructor_->FinalizeHeaders());
+  }
   return 0;
 }
 
@@ -208,6 +215,9 @@ int HttpRequestParser::OnMessageCompleteImpl(http_parser* p) {
   request_constructor_->SetIsFinal(!http_should_keep_alive(p));
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "message complete";
+  if (request_constructor_->IsHeadersFinalized()) {
+    request_constructor_->FinishBody();
+  }
   if (!FinalizeRequest()) return -1;
   return 0;
 }
@@ -215,7 +225,7 @@ int HttpRequestParser::OnMessageCompleteImpl(http_parser* p) {
 void HttpRequestParser::CreateRequestConstructor() {
   ++stats_.parsing_request_count;
   request_constructor_.emplace(request_constructor_config_, handler_info_index_,
-                               data_accounter_);
+                               data_accounter_, request_pool_.get());
   url_complete_ = false;
 }
 
@@ -245,6 +255,10 @@ bool HttpRequestParser::FinalizeRequest() {
 bool HttpRequestParser::FinalizeRequestImpl() {
   if (!request_constructor_) CreateRequestConstructor();
 
+  // The request was passed to the handler with its headers, the body stream
+  // is aborted unless the whole body was received
+  if (request_constructor_->IsHeadersFinalized()) return true;
+
   if (auto request = request_constructor_->Finalize()) {
     on_new_request_cb_(std::move(request));
   } else {
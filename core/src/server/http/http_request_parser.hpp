@@ -26,7 +26,8 @@ class HttpRequestParser final : public request::RequestParser {
   HttpRequestParser(const HandlerInfoIndex& handler_info_index,
                     const request::HttpRequestConfig& request_config,
                     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-                    request::ResponseDataAccounter& data_accounter);
+                    request::ResponseDataAccounter& data_accounter,
+                    std::shared_ptr<HttpRequestPool> request_pool = {});
 
   HttpRequestParser(HttpRequestParser&&) = delete;
   HttpRequestParser& operator=(HttpRequestParser&&) = delete;
@@ -70,6 +71,7 @@ class HttpRequestParser final : public request::RequestParser {
   static const http_parser_settings parser_settings;
   net::ParserStats& stats_;
   request::ResponseDataAccounter& data_accounter_;
+  const std::shared_ptr<HttpRequestPool> request_pool_;
 };
 
 }  // namespace server::http
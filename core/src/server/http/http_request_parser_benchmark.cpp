@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <fmt/format.h>
+
+#include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const server::http::HandlerInfoIndex kHandlerInfoIndex;
+const server::request::HttpRequestConfig kRequestConfig{};
+
+std::string MakeRequest(std::int64_t headers_count) {
+  std::string request = "GET /some/path?arg=value HTTP/1.1\r\n";
+  for (std::int64_t i = 0; i < headers_count; ++i) {
+    request += fmt::format("X-Header-Name-{}: some-header-value-{}\r\n", i, i);
+  }
+  request += "\r\n";
+  return request;
+}
+
+template <typename Parser>
+void http_request_parser(benchmark::State& state) {
+  const auto request = MakeRequest(state.range(0));
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter accounter;
+  Parser parser{kHandlerInfoIndex, kRequestConfig,
+                [](std::shared_ptr<server::request::RequestBase>&& request) {
+                  benchmark::DoNotOptimize(request);
+                },
+                stats, accounter};
+
+  for (auto _ : state) {
+    parser.Parse(request.data(), request.size());
+  }
+  state.SetBytesProcessed(state.iterations() * request.size());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(http_request_parser, server::http::HttpRequestParser)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_TEMPLATE(http_request_parser, server::http::SimdHttpRequestParser)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,135 @@
+#include "http_request_pool.hpp"
+
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+void ShrinkIfTooLarge(std::string& buffer) noexcept {
+  if (buffer.capacity() > HttpRequestPool::kMaxCachedBufferSize) {
+    std::string{}.swap(buffer);
+  }
+}
+
+}  // namespace
+
+// std::allocate_shared destroys the object through the allocator, which lets
+// the pool take the request buffers right before ~HttpRequestImpl().
+template <typename T>
+class HttpRequestPool::Allocator final {
+ public:
+  using value_type = T;
+
+  explicit Allocator(std::shared_ptr<HttpRequestPool> pool) noexcept
+      : pool_(std::move(pool)) {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  Allocator(const Allocator<U>& other) noexcept : pool_(other.pool_) {}
+
+  T* allocate(std::size_t n) {
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    return static_cast<T*>(pool_->AllocateBlock(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    pool_->DeallocateBlock(p, n * sizeof(T));
+  }
+
+  template <typename U>
+  void destroy(U* p) noexcept {
+    if constexpr (std::is_same_v<U, HttpRequestImpl>) pool_->Recycle(*p);
+    p->~U();
+  }
+
+  template <typename U>
+  bool operator==(const Allocator<U>& other) const noexcept {
+    return pool_ == other.pool_;
+  }
+
+  template <typename U>
+  bool operator!=(const Allocator<U>& other) const noexcept {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <typename U>
+  friend class Allocator;
+
+  std::shared_ptr<HttpRequestPool> pool_;
+};
+
+HttpRequestPool::HttpRequestPool() {
+  // no allocations on the deallocation path
+  free_blocks_.reserve(kMaxCachedRequests);
+  free_buffers_.reserve(kMaxCachedRequests);
+}
+
+HttpRequestPool::~HttpRequestPool() {
+  for (auto* block : free_blocks_) ::operator delete(block, block_size_);
+}
+
+std::shared_ptr<HttpRequestImpl> HttpRequestPool::Create(
+    request::ResponseDataAccounter& data_accounter) {
+  std::optional<HttpRequestImpl::Buffers> buffers;
+  {
+    std::lock_guard lock{mutex_};
+    if (!free_buffers_.empty()) {
+      buffers.emplace(std::move(free_buffers_.back()));
+      free_buffers_.pop_back();
+    }
+  }
+
+  const Allocator<HttpRequestImpl> allocator{shared_from_this()};
+  if (buffers) {
+    return std::allocate_shared<HttpRequestImpl>(allocator, data_accounter,
+                                                 std::move(*buffers));
+  }
+  return std::allocate_shared<HttpRequestImpl>(allocator, data_accounter);
+}
+
+void* HttpRequestPool::AllocateBlock(std::size_t size) {
+  {
+    std::lock_guard lock{mutex_};
+    if (size == block_size_ && !free_blocks_.empty()) {
+      auto* block = free_blocks_.back();
+      free_blocks_.pop_back();
+      return block;
+    }
+  }
+  return ::operator new(size);
+}
+
+void HttpRequestPool::DeallocateBlock(void* block, std::size_t size) noexcept {
+  {
+    std::lock_guard lock{mutex_};
+    if (block_size_ == 0) block_size_ = size;
+    if (size == block_size_ && free_blocks_.size() < kMaxCachedRequests) {
+      free_blocks_.push_back(block);
+      return;
+    }
+  }
+  ::operator delete(block, size);
+}
+
+void HttpRequestPool::Recycle(HttpRequestImpl& request) noexcept {
+  auto buffers = request.ReleaseBuffers();
+  ShrinkIfTooLarge(buffers.url);
+  ShrinkIfTooLarge(buffers.request_path);
+  ShrinkIfTooLarge(buffers.request_body);
+
+  std::lock_guard lock{mutex_};
+  if (free_buffers_.size() < kMaxCachedRequests) {
+    free_buffers_.push_back(std::move(buffers));
+  }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "http_request_impl.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Per-connection cache of request memory reused between keep-alive
+/// requests.
+///
+/// Each request is a single allocation holding both the shared_ptr control
+/// block and the HttpRequestImpl. When the last reference to a request is
+/// dropped, the allocation and the capacity of the url, path, body and header
+/// map buffers go back to the pool and are picked up by the next request of
+/// the connection. Requests keep the pool alive, so they may outlive the
+/// connection.
+class HttpRequestPool final
+    : public std::enable_shared_from_this<HttpRequestPool> {
+ public:
+  /// Enough for a pipelining client, the rest are freed as usual
+  static constexpr std::size_t kMaxCachedRequests = 4;
+
+  /// Larger buffers are freed instead of being cached
+  static constexpr std::size_t kMaxCachedBufferSize = 16 * 1024;
+
+  HttpRequestPool();
+  ~HttpRequestPool();
+
+  /// Must be called on a pool owned by a std::shared_ptr
+  std::shared_ptr<HttpRequestImpl> Create(
+      request::ResponseDataAccounter& data_accounter);
+
+ private:
+  template <typename T>
+  class Allocator;
+
+  void* AllocateBlock(std::size_t size);
+  void DeallocateBlock(void* block, std::size_t size) noexcept;
+  void Recycle(HttpRequestImpl& request) noexcept;
+
+  std::mutex mutex_;
+  std::size_t block_size_{0};
+  std::vector<void*> free_blocks_;
+  std::vector<HttpRequestImpl::Buffers> free_buffers_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+#include <server/http/http_request_parser.hpp>
+#include <server/http/http_request_pool.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const server::http::HandlerInfoIndex kHandlerInfoIndex;
+const server::request::HttpRequestConfig kRequestConfig{};
+
+constexpr std::string_view kRequest =
+    "POST /some/path?arg=value&other=value HTTP/1.1\r\n"
+    "Host: localhost\r\n"
+    "User-Agent: benchmark\r\n"
+    "Accept: */*\r\n"
+    "Content-Type: application/json\r\n"
+    "X-Request-Id: 0123456789abcdef\r\n"
+    "Content-Length: 16\r\n"
+    "\r\n"
+    "{\"key\":\"value\"} ";
+
+// Reports the jemalloc bytes allocated per request, if jemalloc is in use
+void http_request_pool(benchmark::State& state) {
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter accounter;
+  std::shared_ptr<server::request::RequestBase> request;
+  server::http::HttpRequestParser parser{
+      kHandlerInfoIndex, kRequestConfig,
+      [&request](std::shared_ptr<server::request::RequestBase>&& r) {
+        request = std::move(r);
+      },
+      stats, accounter,
+      state.range(0) ? std::make_shared<server::http::HttpRequestPool>()
+                     : nullptr};
+
+  std::uint64_t allocated_before = 0;
+  const bool has_jemalloc_stats =
+      !utils::jemalloc::GetThreadAllocatedBytes(allocated_before);
+
+  for (auto _ : state) {
+    parser.Parse(kRequest.data(), kRequest.size());
+    request.reset();
+  }
+
+  std::uint64_t allocated_after = 0;
+  if (has_jemalloc_stats &&
+      !utils::jemalloc::GetThreadAllocatedBytes(allocated_after)) {
+    state.counters["allocated_bytes_per_request"] = benchmark::Counter(
+        allocated_after - allocated_before, benchmark::Counter::kAvgIterations);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(http_request_pool)->Arg(0)->Arg(1);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <server/http/http_request_pool.hpp>
+
+#include <string>
+
+#include <server/http/create_parser_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(HttpRequestPool, ReusesMemory) {
+  server::request::ResponseDataAccounter accounter;
+  const auto pool = std::make_shared<server::http::HttpRequestPool>();
+
+  auto first = pool->Create(accounter);
+  const void* const first_address = first.get();
+  first.reset();
+
+  const auto second = pool->Create(accounter);
+  EXPECT_EQ(second.get(), first_address);
+}
+
+UTEST(HttpRequestPool, KeepAliveRequests) {
+  std::shared_ptr<server::http::HttpRequestImpl> request;
+  auto parser = server::CreateTestParser(
+      [&request](std::shared_ptr<server::request::RequestBase>&& r) {
+        request = std::static_pointer_cast<server::http::HttpRequestImpl>(r);
+      },
+      std::make_shared<server::http::HttpRequestPool>());
+
+  const std::string first =
+      "POST /first?a=b HTTP/1.1\r\n"
+      "X-First: 1\r\n"
+      "Content-Length: 5\r\n"
+      "\r\n"
+      "hello";
+  ASSERT_TRUE(parser.Parse(first.data(), first.size()));
+  ASSERT_TRUE(request);
+  EXPECT_EQ(request->RequestBody(), "hello");
+  const void* const first_address = request.get();
+  request.reset();
+
+  const std::string second =
+      "GET /second HTTP/1.1\r\n"
+      "X-Second: 2\r\n"
+      "\r\n";
+  ASSERT_TRUE(parser.Parse(second.data(), second.size()));
+  ASSERT_TRUE(request);
+  EXPECT_EQ(request.get(), first_address);
+  EXPECT_EQ(request->GetUrl(), "/second");
+  EXPECT_EQ(request->GetRequestPath(), "/second");
+  EXPECT_EQ(request->RequestBody(), "");
+  EXPECT_FALSE(request->HasHeader("X-First"));
+  EXPECT_FALSE(request->HasArg("a"));
+  EXPECT_EQ(request->GetHeader("X-Second"), "2");
+  EXPECT_EQ(request->HeaderCount(), 1);
+}
+
+UTEST(HttpRequestPool, RequestOutlivesPool) {
+  server::request::ResponseDataAccounter accounter;
+  auto pool = std::make_shared<server::http::HttpRequestPool>();
+  auto request = pool->Create(accounter);
+  pool.reset();
+  EXPECT_EQ(request->GetUrl(), "");
+}
+
+USERVER_NAMESPACE_END
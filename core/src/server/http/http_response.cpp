@@ -1,21 +1,35 @@
 #include <userver/server/http/http_response.hpp>
 
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
+#include <algorithm>
 #include <array>
+#include <cctype>
+#include <cerrno>
+#include <optional>
+#include <vector>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/server/http/http_response_file_body.hpp>
+#include <userver/server/http/prepared_headers.hpp>
 #include <userver/tracing/set_throttle_reason.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/http_cached_date.hpp>
 
 #include "http_request_impl.hpp"
@@ -35,6 +49,41 @@ constexpr std::string_view kKeepAlive = "keep-alive";
 
 const std::string kHostname = hostinfo::blocking::GetRealHostName();
 
+// Smaller file bodies are read into memory and sent together with the
+// headers in one syscall
+constexpr std::size_t kMinSendfileSize = 16 * 1024;
+
+#ifdef __linux__
+std::size_t SendFile(engine::io::Socket& socket, int file_fd,
+                     std::size_t offset, std::size_t size) {
+  auto file_offset = static_cast<off_t>(offset);
+  std::size_t sent_bytes = 0;
+  while (sent_bytes < size) {
+    const auto result =
+        ::sendfile(socket.Fd(), file_fd, &file_offset, size - sent_bytes);
+    if (result > 0) {
+      sent_bytes += result;
+      continue;
+    }
+    if (result == 0) {
+      throw engine::io::IoException("the file was truncated while sending");
+    }
+    const auto err_value = errno;
+    if (err_value == EINTR) continue;
+    if (err_value != EAGAIN && err_value != EWOULDBLOCK) {
+      throw engine::io::IoSystemError(err_value, "calling ::sendfile");
+    }
+    if (!socket.WaitWriteable(engine::Deadline{})) {
+      if (engine::current_task::ShouldCancel()) {
+        throw engine::io::IoCancelled(sent_bytes) << "sendfile";
+      }
+      throw engine::io::IoTimeout(sent_bytes) << "sendfile";
+    }
+  }
+  return sent_bytes;
+}
+#endif
+
 void CheckHeaderName(std::string_view name) {
   static constexpr auto init = []() {
     std::array<uint8_t, 256> res{};  // zero initialize
@@ -74,6 +123,20 @@ bool IsBodyForbiddenForStatus(server::http::HttpStatus status) {
 
 const std::string kEmptyString{};
 
+// Connection-specific headers are prohibited in HTTP/2, RFC 7540 8.1.2.2
+bool IsConnectionSpecificHeader(std::string_view lowercase_name) {
+  return lowercase_name == "connection" || lowercase_name == "keep-alive" ||
+         lowercase_name == "proxy-connection" ||
+         lowercase_name == "transfer-encoding" || lowercase_name == "upgrade";
+}
+
+std::string ToLowerHeaderName(std::string_view name) {
+  std::string result{name};
+  std::transform(result.begin(), result.end(), result.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return result;
+}
+
 }  // namespace
 
 namespace server::http {
@@ -100,6 +163,28 @@ void OutputHeader(std::string& header, std::string_view key,
 
 }  // namespace impl
 
+PreparedHeaders::PreparedHeaders(Headers headers)
+    : headers_(std::move(headers)) {
+  lowercase_headers_.reserve(headers_.size());
+  for (const auto& [name, value] : headers_) {
+    CheckHeaderName(name);
+    CheckHeaderValue(value);
+
+    auto lowercase_name = ToLowerHeaderName(name);
+    if (IsConnectionSpecificHeader(lowercase_name) ||
+        lowercase_name == "content-length" || lowercase_name == "set-cookie") {
+      throw std::runtime_error(
+          fmt::format("header '{}' can't be prepared, it is set per response",
+                      name));
+    }
+    has_content_type_ |= lowercase_name == "content-type";
+    has_date_ |= lowercase_name == "date";
+
+    impl::OutputHeader(http1_block_, name, value);
+    lowercase_headers_.emplace_back(std::move(lowercase_name), value);
+  }
+}
+
 HttpResponse::HttpResponse(const HttpRequestImpl& request,
                            request::ResponseDataAccounter& data_accounter)
     : ResponseBase(data_accounter),
@@ -252,16 +337,19 @@ void HttpResponse::SendResponse(engine::io::Socket& socket) {
 
   headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
   const auto end = headers_.end();
-  if (headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
+  if (!HasPreparedDate() &&
+      headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kDate,
                        // impl::GetCachedDate() must not cross thread boundaries
                        impl::GetCachedDate());
   }
-  if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
+  if (!HasPreparedContentType() &&
+      headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentType,
                        kDefaultContentTypeString);
   }
   headers_.OutputInHttpFormat(header);
+  if (prepared_headers_) header.append(prepared_headers_->GetHttp1Block());
   if (headers_.find(USERVER_NAMESPACE::http::headers::kConnection) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kConnection,
                        (request_.IsFinal() ? kClose : kKeepAlive));
@@ -285,19 +373,89 @@ void HttpResponse::SendResponse(engine::io::Socket& socket) {
   SetSent(sent_bytes, std::chrono::steady_clock::now());
 }
 
+void HttpResponse::SendResponse(Http2Session& session) {
+  Http2Headers headers;
+  headers.reserve(headers_.size() + cookies_.size() + 4);
+  headers.push_back({":status", std::to_string(static_cast<int>(status_))});
+
+  headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
+  const auto end = headers_.end();
+  if (!HasPreparedDate() &&
+      headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
+    headers.push_back({"date", std::string{impl::GetCachedDate()}});
+  }
+  if (!HasPreparedContentType() &&
+      headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
+    headers.push_back({"content-type", kDefaultContentTypeString});
+  }
+  for (const auto& [name, value] : headers_) {
+    auto lowercase_name = ToLowerHeaderName(name);
+    if (IsConnectionSpecificHeader(lowercase_name)) continue;
+    headers.push_back({std::move(lowercase_name), value});
+  }
+  if (prepared_headers_) {
+    for (const auto& [name, value] : prepared_headers_->GetLowercaseHeaders()) {
+      headers.push_back({name, value});
+    }
+  }
+  for (const auto& cookie : cookies_) {
+    headers.push_back({"set-cookie", cookie.second.ToString()});
+  }
+
+  std::string streamed_data;
+  const bool is_streamed = IsBodyStreamed() && GetData().empty();
+  if (is_streamed) {
+    // The stream is collected beforehand, DATA frames are sent in one go
+    std::string body_part;
+    while (body_stream_->Pop(body_part)) streamed_data.append(body_part);
+    body_stream_producer_.reset();
+    body_stream_.reset();
+  }
+
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+  const bool is_head_request = request_.GetOrigMethod() == HttpMethod::kHead;
+  std::string_view data = is_streamed ? streamed_data : GetData();
+  const bool is_file_body = file_body_ && data.empty();
+  const auto data_size = is_file_body ? file_body_size_ : data.size();
+  if (!is_body_forbidden) {
+    headers.push_back({"content-length", std::to_string(data_size)});
+  }
+
+  std::string file_data;
+  std::optional<std::string_view> body;
+  if (!is_head_request && !is_body_forbidden && data_size != 0) {
+    if (is_file_body) {
+      // HTTP/2 frames the data anyway, so the file is read into memory
+      file_data = file_body_->Read(file_body_offset_, file_body_size_);
+      data = file_data;
+    }
+    body = data;
+  }
+
+  const auto sent_bytes = session.SendResponse(*this, headers, body);
+  if (!sent_bytes) {
+    SetSendFailed(std::chrono::steady_clock::now());
+    return;
+  }
+  SetSent(*sent_bytes, std::chrono::steady_clock::now());
+}
+
 std::size_t HttpResponse::SetBodyNotStreamed(engine::io::Socket& socket,
                                              std::string& header) {
   const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
   const bool is_head_request = request_.GetOrigMethod() == HttpMethod::kHead;
-  const auto& data = GetData();
+  std::string_view data = GetData();
+  const bool is_file_body = file_body_ && data.empty();
+  const auto data_size = is_file_body ? file_body_size_ : data.size();
 
   if (!is_body_forbidden) {
+    const fmt::format_int content_length{data_size};
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength,
-                       fmt::format(FMT_COMPILE("{}"), data.size()));
+                       {content_length.data(), content_length.size()});
   }
   header.append(kCrlf);
 
-  if (is_body_forbidden && !data.empty()) {
+  if (is_body_forbidden && data_size != 0) {
     LOG_LIMITED_WARNING()
         << "Non-empty body provided for response with HTTP code "
         << static_cast<int>(status_)
@@ -306,6 +464,20 @@ std::size_t HttpResponse::SetBodyNotStreamed(engine::io::Socket& socket,
 
   ssize_t sent_bytes = 0;
   if (!is_head_request && !is_body_forbidden) {
+    std::string file_data;
+    if (is_file_body) {
+#ifdef __linux__
+      if (file_body_size_ >= kMinSendfileSize) {
+        sent_bytes =
+            socket.SendAll(header.data(), header.size(), engine::Deadline{});
+        return sent_bytes + SendFile(socket, file_body_->GetFd(),
+                                     file_body_offset_, file_body_size_);
+      }
+#endif
+      file_data = file_body_->Read(file_body_offset_, file_body_size_);
+      data = file_data;
+    }
+    // The body is sent right from its storage, never copied into the header
     sent_bytes = socket.SendAll(
         {{header.data(), header.size()}, {data.data(), data.size()}},
         engine::Deadline{});
@@ -334,9 +506,14 @@ std::size_t HttpResponse::SetBodyStreamed(engine::io::Socket& socket,
       continue;
     }
 
-    auto size = fmt::format("\r\n{:x}\r\n", body_part.size());
+    // "\r\n" + up to 16 hex digits + "\r\n"
+    std::array<char, 20> size{};
+    const auto size_end =
+        fmt::format_to(size.data(), FMT_COMPILE("\r\n{:x}\r\n"),
+                       body_part.size());
     sent_bytes += socket.SendAll(
-        {{size.data(), size.size()}, {body_part.data(), body_part.size()}},
+        {{size.data(), static_cast<std::size_t>(size_end - size.data())},
+         {body_part.data(), body_part.size()}},
         engine::Deadline{});
   }
 
@@ -383,6 +560,29 @@ HttpResponse::Queue::Producer HttpResponse::GetBodyProducer() {
   return producer;
 }
 
+void HttpResponse::SetPreparedHeaders(const PreparedHeaders& headers) {
+  UASSERT_MSG(!headers_end_.IsReady(),
+              "SetPreparedHeaders() is called after the headers end");
+  prepared_headers_ = &headers;
+}
+
+bool HttpResponse::HasPreparedContentType() const {
+  return prepared_headers_ && prepared_headers_->HasContentType();
+}
+
+bool HttpResponse::HasPreparedDate() const {
+  return prepared_headers_ && prepared_headers_->HasDate();
+}
+
+void HttpResponse::SetFileBody(std::shared_ptr<const ResponseFileBody> file,
+                               std::size_t offset, std::size_t size) {
+  UASSERT(file);
+  UASSERT(offset <= file->GetSize() && size <= file->GetSize() - offset);
+  file_body_ = std::move(file);
+  file_body_offset_ = offset;
+  file_body_size_ = size;
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
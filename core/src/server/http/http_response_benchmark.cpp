@@ -1,9 +1,15 @@
 #include <benchmark/benchmark.h>
 
 #include <fmt/compile.h>
+#include <array>
+#include <atomic>
 #include <sstream>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
 
@@ -67,9 +73,71 @@ void http_headers_serialization_ostreams(benchmark::State& state) {
   }
 }
 
+std::string MakeHeaders(std::size_t body_size) {
+  std::string headers;
+  headers.reserve(1024);
+  headers.append("HTTP/1.1 200 OK\r\n");
+  for (const auto& header : kHeaders) {
+    server::http::impl::OutputHeader(headers, header.first, header.second);
+  }
+  const fmt::format_int content_length{body_size};
+  server::http::impl::OutputHeader(
+      headers, USERVER_NAMESPACE::http::headers::kContentLength,
+      {content_length.data(), content_length.size()});
+  headers.append("\r\n");
+  return headers;
+}
+
+// Sends the response to a draining peer, either as a single concatenated
+// buffer or as headers and body handed to a vectored write
+template <bool IsConcatenated>
+void http_response_send(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    const auto deadline =
+        engine::Deadline::FromDuration(std::chrono::seconds{60});
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+    const std::string body(state.range(0), 'a');
+
+    std::atomic<bool> is_reading{true};
+    auto reader = engine::AsyncNoSpan(
+        [&is_reading, deadline](auto&& socket) {
+          std::array<char, 64 * 1024> buf{};
+          while (socket.RecvSome(buf.data(), buf.size(), deadline) > 0 &&
+                 is_reading) {
+          }
+        },
+        std::move(server));
+
+    for (auto _ : state) {
+      auto headers = MakeHeaders(body.size());
+      std::size_t sent_bytes = 0;
+      if constexpr (IsConcatenated) {
+        headers.append(body);
+        sent_bytes = client.SendAll(headers.data(), headers.size(), deadline);
+      } else {
+        sent_bytes = client.SendAll(
+            {{headers.data(), headers.size()}, {body.data(), body.size()}},
+            deadline);
+      }
+      benchmark::DoNotOptimize(sent_bytes);
+    }
+
+    is_reading = false;
+    [[maybe_unused]] const auto sent = client.SendAll("x", 1, deadline);
+    reader.Get();
+  });
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
+BENCHMARK_TEMPLATE(http_response_send, true)
+    ->RangeMultiplier(32)
+    ->Range(1024, 1024 * 1024);
+BENCHMARK_TEMPLATE(http_response_send, false)
+    ->RangeMultiplier(32)
+    ->Range(1024, 1024 * 1024);
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <compression/compressor.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,10 +14,20 @@ ResponseBodyStream::ResponseBodyStream(
     : queue_producer_(std::move(queue_producer)),
       http_response_(http_response) {}
 
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) = default;
+
+ResponseBodyStream::~ResponseBodyStream() = default;
+
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk,
                                        engine::Deadline deadline) {
   UASSERT_MSG(headers_ended_,
               "SetEndOfHeaders() was not called before PushBodyChunk()");
+  if (compressor_) {
+    std::string compressed;
+    compressor_->Compress(chunk, compression::Compressor::Flush::kSync,
+                          compressed);
+    chunk = std::move(compressed);
+  }
   const auto success = queue_producer_.Push(std::move(chunk), deadline);
   UASSERT(success);
 }
@@ -31,10 +43,38 @@ void ResponseBodyStream::SetHeader(std::string_view name,
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+  if (compressor_) {
+    if (http_response_.HasHeader(
+            USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+      // already encoded by the handler
+      compressor_.reset();
+    } else {
+      http_response_.SetHeader(
+          USERVER_NAMESPACE::http::headers::kContentEncoding,
+          std::string{compressor_encoding_});
+    }
+  }
   headers_ended_ = true;
   http_response_.SetHeadersEnd();
 }
 
+void ResponseBodyStream::SetCompressor(
+    std::unique_ptr<compression::Compressor> compressor,
+    std::string_view content_encoding) {
+  UASSERT(!headers_ended_);
+  compressor_ = std::move(compressor);
+  compressor_encoding_ = content_encoding;
+}
+
+void ResponseBodyStream::FinishCompression(engine::Deadline deadline) {
+  if (!compressor_ || !headers_ended_) return;
+
+  std::string tail;
+  compressor_->Compress({}, compression::Compressor::Flush::kFinish, tail);
+  compressor_.reset();
+  if (!tail.empty()) PushBodyChunk(std::move(tail), deadline);
+}
+
 void ResponseBodyStream::SetStatusCode(int status_code) {
   http_response_.SetStatus(static_cast<server::http::HttpStatus>(status_code));
 }
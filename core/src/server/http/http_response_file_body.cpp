@@ -0,0 +1,56 @@
+#include <userver/server/http/http_response_file_body.hpp>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+ResponseFileBody::ResponseFileBody(const std::string& path)
+    : file_(fs::blocking::FileDescriptor::Open(path,
+                                               fs::blocking::OpenFlag::kRead)) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  struct ::stat stats;
+  if (::fstat(GetFd(), &stats) == -1) {
+    throw std::system_error(errno, std::generic_category(),
+                            fmt::format("calling ::fstat for '{}'", path));
+  }
+  if (!S_ISREG(stats.st_mode)) {
+    throw std::runtime_error(fmt::format("'{}' is not a regular file", path));
+  }
+  size_ = stats.st_size;
+  last_write_time_ = stats.st_mtime;
+}
+
+std::string ResponseFileBody::Read(std::size_t offset,
+                                   std::size_t size) const {
+  std::string data(size, '\0');
+  std::size_t read_bytes = 0;
+  while (read_bytes < size) {
+    const auto result = ::pread(GetFd(), data.data() + read_bytes,
+                                size - read_bytes, offset + read_bytes);
+    if (result > 0) {
+      read_bytes += result;
+      continue;
+    }
+    if (result == 0) {
+      throw std::runtime_error("the file was truncated while reading");
+    }
+    const auto err_value = errno;
+    if (err_value == EINTR) continue;
+    throw std::system_error(err_value, std::generic_category(),
+                            "calling ::pread");
+  }
+  return data;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
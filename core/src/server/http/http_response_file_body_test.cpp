@@ -0,0 +1,38 @@
+#include <userver/server/http/http_response_file_body.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(ResponseFileBody, Read) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "0123456789");
+
+  const server::http::ResponseFileBody body{file.GetPath()};
+  EXPECT_EQ(body.GetSize(), 10);
+  EXPECT_EQ(body.Read(0, 10), "0123456789");
+  EXPECT_EQ(body.Read(3, 4), "3456");
+  EXPECT_EQ(body.Read(10, 0), "");
+}
+
+TEST(ResponseFileBody, ReadTruncated) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "0123456789");
+
+  const server::http::ResponseFileBody body{file.GetPath()};
+  fs::blocking::RewriteFileContents(file.GetPath(), "012");
+  EXPECT_EQ(body.GetSize(), 10);
+  EXPECT_THROW(body.Read(0, 10), std::runtime_error);
+}
+
+TEST(ResponseFileBody, NotRegularFile) {
+  EXPECT_THROW(server::http::ResponseFileBody{"/"}, std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
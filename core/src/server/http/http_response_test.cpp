@@ -9,6 +9,7 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_response.hpp>
+#include <userver/server/http/prepared_headers.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -46,6 +47,50 @@ UTEST(HttpResponse, Smoke) {
             fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, PreparedHeaders) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  const server::http::PreparedHeaders prepared_headers{{
+      {"Content-Type", "text/plain"},
+      {"X-Constant", "value"},
+  }};
+  EXPECT_EQ(prepared_headers.GetHttp1Block(),
+            "Content-Type: text/plain\r\nX-Constant: value\r\n");
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+  response.SetData("test data");
+  response.SetHeader(std::string_view{"X-Dynamic"}, "dynamic");
+  response.SetPreparedHeaders(prepared_headers);
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+  const std::string_view reply{buffer.data(), reply_size};
+
+  EXPECT_NE(reply.find("\r\nX-Constant: value\r\n"), std::string_view::npos);
+  EXPECT_NE(reply.find("\r\nX-Dynamic: dynamic\r\n"), std::string_view::npos);
+  // The prepared Content-Type replaces the default one
+  EXPECT_EQ(reply.find("text/html"), std::string_view::npos);
+}
+
+UTEST(HttpResponse, PreparedHeadersInvalid) {
+  using Headers = server::http::PreparedHeaders::Headers;
+  EXPECT_ANY_THROW(server::http::PreparedHeaders(Headers{{"Bad Name", "v"}}));
+  EXPECT_ANY_THROW(server::http::PreparedHeaders(Headers{{"X-Name", "a\nb"}}));
+  EXPECT_ANY_THROW(
+      server::http::PreparedHeaders(Headers{{"Content-Length", "1"}}));
+  EXPECT_ANY_THROW(server::http::PreparedHeaders(Headers{{"Connection", "x"}}));
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
   auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
   const server::http::HttpRequestImpl request{*accounter};
@@ -0,0 +1,21 @@
+#include <userver/server/http/json_body_stream.hpp>
+
+#include <userver/server/http/http_response_body_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+formats::json::StringBuilder MakeJsonBodyStreamBuilder(
+    ResponseBodyStream& stream, std::size_t chunk_size,
+    engine::Deadline deadline) {
+  return formats::json::StringBuilder{
+      [&stream, deadline](std::string&& chunk) {
+        stream.PushBodyChunk(std::move(chunk), deadline);
+      },
+      chunk_size};
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,9 @@ const char kLf = '\n';
 
 const std::string kOwsChars = " \t";
 
+constexpr std::string_view kCrLf = "\r\n";
+constexpr std::string_view kHeadersEnd = "\r\n\r\n";
+
 [[nodiscard]] std::string_view LtrimOws(std::string_view str) {
   const auto first_pchar_pos = str.find_first_not_of(kOwsChars);
   str.remove_prefix(
@@ -390,25 +393,9 @@ bool ParseMultipartFormDataBody(std::string_view body,
   return false;
 }
 
-}  // namespace
-
-bool IsMultipartFormDataContentType(std::string_view content_type) {
-  if (!IEquals(content_type.substr(0, kMultipartFormData.size()),
-               kMultipartFormData))
-    return false;
-  if (content_type.size() == kMultipartFormData.size()) return true;
-  switch (content_type[kMultipartFormData.size()]) {
-    case ';':
-    case ' ':
-    case '\t':
-      return true;
-  }
-  return false;
-}
-
-bool ParseMultipartFormData(const std::string& content_type,
-                            std::string_view body, FormDataArgs& form_data_args,
-                            bool strict_cr_lf) {
+// Parses the parameters of multipart/form-data content type
+bool ParseContentTypeParams(const std::string& content_type,
+                            std::string& boundary, std::string& charset) {
   static const std::string kBoundary = "boundary";
   static const std::string kCharset = "charset";
   static const std::string kBoundaryNotFound =
@@ -422,8 +409,6 @@ bool ParseMultipartFormData(const std::string& content_type,
   unparsed.remove_prefix(kMultipartFormData.size());
   SkipOptionalSpaces(unparsed);
 
-  std::string boundary;
-  std::string charset;
   while (!unparsed.empty()) {
     if (!SkipSymbol(unparsed, ';')) return false;
     SkipOptionalSpaces(unparsed);
@@ -455,11 +440,225 @@ bool ParseMultipartFormData(const std::string& content_type,
     LOG_WARNING() << kBoundaryNotFound;
     return false;
   }
+  return true;
+}
+
+}  // namespace
+
+bool IsMultipartFormDataContentType(std::string_view content_type) {
+  if (!IEquals(content_type.substr(0, kMultipartFormData.size()),
+               kMultipartFormData))
+    return false;
+  if (content_type.size() == kMultipartFormData.size()) return true;
+  switch (content_type[kMultipartFormData.size()]) {
+    case ';':
+    case ' ':
+    case '\t':
+      return true;
+  }
+  return false;
+}
+
+bool ParseMultipartFormData(const std::string& content_type,
+                            std::string_view body, FormDataArgs& form_data_args,
+                            bool strict_cr_lf) {
+  std::string boundary;
+  std::string charset;
+  if (!ParseContentTypeParams(content_type, boundary, charset)) return false;
 
   return ParseMultipartFormDataBody(body, boundary, std::move(charset),
                                     form_data_args, strict_cr_lf);
 }
 
+std::optional<MultipartFormDataStreamParser>
+MultipartFormDataStreamParser::Create(const std::string& content_type) {
+  std::string boundary;
+  std::string charset;
+  if (!ParseContentTypeParams(content_type, boundary, charset)) {
+    return std::nullopt;
+  }
+  return MultipartFormDataStreamParser{boundary, std::move(charset)};
+}
+
+MultipartFormDataStreamParser::MultipartFormDataStreamParser(
+    std::string_view boundary, std::string charset)
+    : delimiter_(std::string{kCrLf} + "--" + std::string{boundary}),
+      charset_(std::move(charset)) {}
+
+void MultipartFormDataStreamParser::Feed(std::string_view data) {
+  UASSERT(!is_input_finished_);
+  buffer_.append(data);
+}
+
+void MultipartFormDataStreamParser::FinishInput() { is_input_finished_ = true; }
+
+MultipartFormDataStreamParser::Event MultipartFormDataStreamParser::Next(
+    FormDataPart& part, std::string& data) {
+  const auto event = NextImpl(part, data);
+  if (event == Event::kNeedMoreData && is_input_finished_) {
+    LOG_WARNING() << "Unexpected request body end";
+    state_ = State::kError;
+    return Event::kError;
+  }
+  return event;
+}
+
+MultipartFormDataStreamParser::Event MultipartFormDataStreamParser::NextImpl(
+    FormDataPart& part, std::string& data) {
+  // The dash-boundary at the body start lacks the leading CRLF
+  const std::string_view dash_boundary =
+      std::string_view{delimiter_}.substr(kCrLf.size());
+
+  while (true) {
+    switch (state_) {
+      case State::kPreamble: {
+        if (is_body_start_) {
+          if (buffer_.size() < dash_boundary.size()) {
+            return Event::kNeedMoreData;
+          }
+          is_body_start_ = false;
+          if (std::string_view{buffer_}.substr(0, dash_boundary.size()) ==
+              dash_boundary) {
+            buffer_.erase(0, dash_boundary.size());
+            state_ = State::kAfterBoundary;
+            break;
+          }
+        }
+        const auto pos = buffer_.find(delimiter_);
+        if (pos == std::string::npos) {
+          // The rest of the buffer could be the start of the delimiter
+          DiscardAllButTail();
+          return Event::kNeedMoreData;
+        }
+        buffer_.erase(0, pos + delimiter_.size());
+        state_ = State::kAfterBoundary;
+        break;
+      }
+
+      case State::kAfterBoundary: {
+        if (buffer_.size() < 2) return Event::kNeedMoreData;
+        if (buffer_[0] == '-' && buffer_[1] == '-') {
+          state_ = State::kEnd;
+          buffer_.clear();
+          return Event::kEnd;
+        }
+        // https://datatracker.ietf.org/doc/html/rfc2046#section-5.1.1
+        const auto pos = buffer_.find(kCrLf);
+        if (pos == std::string::npos) {
+          // The last char could be the start of CRLF
+          const auto padding =
+              std::string_view{buffer_}.substr(0, buffer_.size() - 1);
+          if (padding.find_first_not_of(kOwsChars) != std::string_view::npos) {
+            return Error("Unexpected characters after the boundary");
+          }
+          return Event::kNeedMoreData;
+        }
+        if (std::string_view{buffer_}.substr(0, pos).find_first_not_of(
+                kOwsChars) != std::string_view::npos) {
+          return Error("Unexpected characters after the boundary");
+        }
+        buffer_.erase(0, pos + kCrLf.size());
+        state_ = State::kHeaders;
+        break;
+      }
+
+      case State::kHeaders: {
+        const auto pos = buffer_.find(kHeadersEnd);
+        if (pos == std::string::npos) {
+          if (buffer_.size() > kMaxPartHeadersSize) {
+            return Error("Too large headers of the form-data part");
+          }
+          return Event::kNeedMoreData;
+        }
+        // Keeps the CRLF of the last header for the loop below
+        std::string_view headers =
+            std::string_view{buffer_}.substr(0, pos + kCrLf.size());
+        if (!ParsePartHeaders(headers, part)) {
+          state_ = State::kError;
+          return Event::kError;
+        }
+        buffer_.erase(0, pos + kHeadersEnd.size());
+        state_ = State::kValue;
+        return Event::kPartBegin;
+      }
+
+      case State::kValue: {
+        const auto pos = buffer_.find(delimiter_);
+        if (pos == 0) {
+          buffer_.erase(0, delimiter_.size());
+          state_ = State::kAfterBoundary;
+          return Event::kPartEnd;
+        }
+        const auto data_size =
+            pos == std::string::npos ? CompleteDataSize() : pos;
+        if (data_size == 0) return Event::kNeedMoreData;
+        data.assign(buffer_, 0, data_size);
+        buffer_.erase(0, data_size);
+        return Event::kPartData;
+      }
+
+      case State::kEnd:
+        return Event::kEnd;
+
+      case State::kError:
+        return Event::kError;
+    }
+  }
+}
+
+bool MultipartFormDataStreamParser::ParsePartHeaders(std::string_view headers,
+                                                     FormDataPart& part) {
+  FormDataArgInfo arg_info;
+  while (!headers.empty()) {
+    auto header_name = ReadToken(headers);
+    if (header_name.empty()) {
+      LOG_WARNING()
+          << "Can't parse multipart header: header-name token not found";
+      return false;
+    }
+    if (!SkipSymbol(headers, ':')) return false;
+    auto header_value = ReadHeaderValue(headers);
+    if (!SkipCrLf(headers, kCrLf)) return false;
+
+    if (!ProcessMultipartFormDataHeader(header_name, header_value, arg_info)) {
+      LOG_WARNING() << "Can't parse multipart header name";
+      return false;
+    }
+  }
+  if (arg_info.arg.content_disposition.empty()) {
+    LOG_WARNING() << "Missing Content-Disposition header";
+    return false;
+  }
+
+  part.name = std::move(arg_info.name);
+  part.content_disposition = std::string{arg_info.arg.content_disposition};
+  part.filename = std::move(arg_info.arg.filename);
+  part.content_type.reset();
+  if (arg_info.arg.content_type) {
+    part.content_type.emplace(*arg_info.arg.content_type);
+  }
+  part.default_charset.reset();
+  if (!charset_.empty()) part.default_charset = charset_;
+  return true;
+}
+
+MultipartFormDataStreamParser::Event MultipartFormDataStreamParser::Error(
+    std::string_view message) {
+  LOG_WARNING() << message;
+  state_ = State::kError;
+  return Event::kError;
+}
+
+size_t MultipartFormDataStreamParser::CompleteDataSize() const {
+  // The tail could be the start of the delimiter
+  const auto tail_size = std::min(buffer_.size(), delimiter_.size() - 1);
+  return buffer_.size() - tail_size;
+}
+
+void MultipartFormDataStreamParser::DiscardAllButTail() {
+  buffer_.erase(0, CompleteDataSize());
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
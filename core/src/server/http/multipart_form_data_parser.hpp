@@ -1,11 +1,13 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
 
 #include <userver/server/http/form_data_arg.hpp>
+#include <userver/server/http/form_data_stream.hpp>
 #include <userver/utils/str_icase.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,6 +22,60 @@ bool ParseMultipartFormData(const std::string& content_type,
                             std::string_view body, FormDataArgs& form_data_args,
                             bool strict_cr_lf = false);
 
+/// Incremental parser of multipart/form-data bodies received in chunks, only
+/// CRLF line breaks are supported
+class MultipartFormDataStreamParser final {
+ public:
+  enum class Event {
+    kNeedMoreData,  ///< Feed() more data or call FinishInput()
+    kPartBegin,     ///< the part headers are parsed
+    kPartData,      ///< a chunk of the part value
+    kPartEnd,
+    kEnd,  ///< the closing boundary is reached
+    kError,
+  };
+
+  /// Returns std::nullopt if the content type is not multipart/form-data or
+  /// has no boundary
+  static std::optional<MultipartFormDataStreamParser> Create(
+      const std::string& content_type);
+
+  void Feed(std::string_view data);
+  void FinishInput();
+
+  /// Fills `part` on kPartBegin and `data` on kPartData
+  Event Next(FormDataPart& part, std::string& data);
+
+ private:
+  enum class State {
+    kPreamble,
+    kAfterBoundary,
+    kHeaders,
+    kValue,
+    kEnd,
+    kError,
+  };
+
+  static constexpr size_t kMaxPartHeadersSize = 64 * 1024;
+
+  MultipartFormDataStreamParser(std::string_view boundary, std::string charset);
+
+  Event NextImpl(FormDataPart& part, std::string& data);
+  bool ParsePartHeaders(std::string_view headers, FormDataPart& part);
+  Event Error(std::string_view message);
+  // Size of the buffered data that can't be the start of the delimiter
+  size_t CompleteDataSize() const;
+  void DiscardAllButTail();
+
+  // CRLF "--" boundary
+  std::string delimiter_;
+  std::string charset_;
+  std::string buffer_;
+  State state_{State::kPreamble};
+  bool is_body_start_{true};
+  bool is_input_finished_{false};
+};
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -532,4 +532,113 @@ TEST(MultipartFormDataParser, ParseErrors) {
   EXPECT_TRUE(form_data_args.empty());
 }
 
+namespace {
+
+struct StreamedPart {
+  server::http::FormDataPart headers;
+  std::string value;
+};
+
+// Feeds the body by `chunk_size` bytes
+std::optional<std::vector<StreamedPart>> ParseStreamed(
+    const std::string& content_type, std::string_view body,
+    std::size_t chunk_size) {
+  using Event = server::http::MultipartFormDataStreamParser::Event;
+  auto parser = server::http::MultipartFormDataStreamParser::Create(
+      content_type);
+  if (!parser) return std::nullopt;
+
+  std::vector<StreamedPart> parts;
+  server::http::FormDataPart part;
+  std::string data;
+  while (true) {
+    switch (parser->Next(part, data)) {
+      case Event::kNeedMoreData:
+        if (body.empty()) {
+          parser->FinishInput();
+        } else {
+          parser->Feed(body.substr(0, chunk_size));
+          body.remove_prefix(std::min(chunk_size, body.size()));
+        }
+        break;
+      case Event::kPartBegin:
+        parts.push_back({part, {}});
+        break;
+      case Event::kPartData:
+        EXPECT_FALSE(parts.empty());
+        EXPECT_FALSE(data.empty());
+        parts.back().value += data;
+        break;
+      case Event::kPartEnd:
+        break;
+      case Event::kEnd:
+        return parts;
+      case Event::kError:
+        return std::nullopt;
+    }
+  }
+}
+
+constexpr std::string_view kStreamedContentType =
+    "multipart/form-data; charset=UTF-8; boundary=-----8099aaf9723cd601";
+
+constexpr std::string_view kStreamedBody =
+    "preamble\r\n"
+    "-------8099aaf9723cd601\r\n"
+    "Content-Disposition: form-data; name=\"text\"\r\n"
+    "\r\n"
+    "line\r\n---not a delimiter\r\n"
+    "-------8099aaf9723cd601  \r\n"
+    "Content-Disposition: form-data; name=\"file\"; filename=\"a.txt\"\r\n"
+    "Content-Type: text/plain\r\n"
+    "\r\n"
+    "\r\n"
+    "-------8099aaf9723cd601--\r\n"
+    "epilogue";
+
+}  // namespace
+
+TEST(MultipartFormDataStreamParser, Chunks) {
+  for (std::size_t chunk_size : {1, 2, 3, 7, 24, 1000}) {
+    const auto parts = ParseStreamed(std::string{kStreamedContentType},
+                                     kStreamedBody, chunk_size);
+    ASSERT_TRUE(parts) << chunk_size;
+    ASSERT_EQ(parts->size(), 2);
+
+    const auto& text = (*parts)[0];
+    EXPECT_EQ(text.headers.name, "text");
+    EXPECT_EQ(text.headers.content_disposition, R"(form-data; name="text")");
+    EXPECT_FALSE(text.headers.filename);
+    EXPECT_FALSE(text.headers.content_type);
+    EXPECT_EQ(text.headers.default_charset, "UTF-8");
+    EXPECT_EQ(text.value, "line\r\n---not a delimiter");
+
+    const auto& file = (*parts)[1];
+    EXPECT_EQ(file.headers.name, "file");
+    EXPECT_EQ(file.headers.filename, "a.txt");
+    EXPECT_EQ(file.headers.content_type, "text/plain");
+    EXPECT_EQ(file.value, "");
+  }
+}
+
+TEST(MultipartFormDataStreamParser, Errors) {
+  EXPECT_FALSE(server::http::MultipartFormDataStreamParser::Create(
+      "multipart/form-data"));
+  EXPECT_FALSE(
+      server::http::MultipartFormDataStreamParser::Create("text/plain"));
+
+  const std::string content_type{kStreamedContentType};
+  const auto truncated = kStreamedBody.substr(0, kStreamedBody.size() / 2);
+  EXPECT_FALSE(ParseStreamed(content_type, truncated, 5));
+  EXPECT_FALSE(ParseStreamed(content_type,
+                             "-------8099aaf9723cd601\r\n"
+                             "Content-Type: text/plain\r\n"
+                             "\r\n"
+                             "value\r\n"
+                             "-------8099aaf9723cd601--",
+                             3));
+  EXPECT_FALSE(ParseStreamed(content_type,
+                             "-------8099aaf9723cd601 garbage\r\n", 3));
+}
+
 USERVER_NAMESPACE_END
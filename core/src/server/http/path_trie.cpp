@@ -0,0 +1,20 @@
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+PathSegments SplitPathBySlash(std::string_view path) {
+  PathSegments segments;
+  while (true) {
+    const auto slash = path.find('/');
+    segments.push_back(path.substr(0, slash));
+    if (slash == std::string_view::npos) break;
+    path.remove_prefix(slash + 1);
+  }
+  return segments;
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+using PathSegments = boost::container::small_vector<std::string_view, 16>;
+
+/// Splits the path by '/', the segments point into `path`
+PathSegments SplitPathBySlash(std::string_view path);
+
+/// @brief Trie of path segments built from the handler paths at startup.
+///
+/// A lookup walks the request path segment by segment and only backtracks
+/// into wildcard branches. At each level a fixed segment is preferred to a
+/// wildcard, and a deeper `*` suffix is preferred to a shallower one.
+template <typename Value>
+class PathTrie final {
+ public:
+  struct Match {
+    const Value* value{nullptr};
+    /// Number of path segments matched before the `*` suffix, or the number
+    /// of all the segments for exact matches
+    std::size_t prefix_size{0};
+    bool is_any_suffix{false};
+  };
+
+  /// @param segments fixed segments of the path, std::nullopt for wildcards
+  /// @param is_any_suffix whether the path ends with a `*` matching one or
+  /// more segments
+  Value& Emplace(const std::vector<std::optional<std::string>>& segments,
+                 bool is_any_suffix) {
+    Node* node = &root_;
+    for (const auto& segment : segments) {
+      auto& next = segment ? node->fixed[*segment] : node->wildcard;
+      if (!next) next = std::make_unique<Node>();
+      node = next.get();
+    }
+
+    auto& value = is_any_suffix ? node->any_suffix_value : node->value;
+    if (!value) value.emplace();
+    return *value;
+  }
+
+  /// @brief Finds the best match for the path accepted by the predicate.
+  ///
+  /// Rejected values are skipped and the search goes on.
+  template <typename Predicate>
+  std::optional<Match> Find(const PathSegments& path,
+                            const Predicate& accept) const {
+    return Find(root_, 0, path, accept);
+  }
+
+ private:
+  struct Node {
+    utils::impl::TransparentMap<std::string, std::unique_ptr<Node>> fixed;
+    std::unique_ptr<Node> wildcard;
+    std::optional<Value> value;
+    std::optional<Value> any_suffix_value;
+  };
+
+  template <typename Predicate>
+  static std::optional<Match> Find(const Node& node, std::size_t depth,
+                                   const PathSegments& path,
+                                   const Predicate& accept) {
+    if (depth == path.size()) {
+      if (node.value && accept(*node.value)) {
+        return Match{&*node.value, depth, false};
+      }
+      return std::nullopt;
+    }
+
+    if (const auto* next =
+            utils::impl::FindTransparentOrNullptr(node.fixed, path[depth])) {
+      if (auto match = Find(**next, depth + 1, path, accept)) return match;
+    }
+    if (node.wildcard) {
+      if (auto match = Find(*node.wildcard, depth + 1, path, accept)) {
+        return match;
+      }
+    }
+    if (node.any_suffix_value && accept(*node.any_suffix_value)) {
+      return Match{&*node.any_suffix_value, depth, true};
+    }
+    return std::nullopt;
+  }
+
+  Node root_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
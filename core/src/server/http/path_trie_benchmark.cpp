@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <fmt/format.h>
+
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+using server::http::impl::SplitPathBySlash;
+
+// Routes like "/v1/service-{i}/{id}/items/{item_id}" and
+// "/v1/service-{i}/static/*", the request matches the last added route
+void http_path_trie_lookup(benchmark::State& state) {
+  const auto routes_count = state.range(0);
+
+  PathTrie<std::int64_t> trie;
+  for (std::int64_t i = 0; i < routes_count; ++i) {
+    trie.Emplace({"", "v1", fmt::format("service-{}", i), std::nullopt,
+                  "items", std::nullopt},
+                 false) = i;
+    trie.Emplace({"", "v1", fmt::format("service-{}", i), "static"}, true) =
+        -i;
+  }
+
+  const auto path = fmt::format("/v1/service-{}/12345/items/67890",
+                                routes_count - 1);
+  for (auto _ : state) {
+    const auto match =
+        trie.Find(SplitPathBySlash(path), [](std::int64_t) { return true; });
+    benchmark::DoNotOptimize(match);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(http_path_trie_lookup)->RangeMultiplier(8)->Range(1, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#include <server/http/path_trie.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+using server::http::impl::SplitPathBySlash;
+using Segments = std::vector<std::optional<std::string>>;
+
+std::optional<PathTrie<int>::Match> Find(const PathTrie<int>& trie,
+                                         std::string_view path) {
+  return trie.Find(SplitPathBySlash(path), [](int) { return true; });
+}
+
+int FindValue(const PathTrie<int>& trie, std::string_view path) {
+  const auto match = Find(trie, path);
+  return match ? *match->value : 0;
+}
+
+}  // namespace
+
+TEST(PathTrie, SplitPathBySlash) {
+  using Expected = std::vector<std::string_view>;
+  const auto split = [](std::string_view path) {
+    const auto segments = SplitPathBySlash(path);
+    return Expected(segments.begin(), segments.end());
+  };
+  EXPECT_EQ(split(""), Expected({""}));
+  EXPECT_EQ(split("/"), Expected({"", ""}));
+  EXPECT_EQ(split("/a//b/"), Expected({"", "a", "", "b", ""}));
+}
+
+TEST(PathTrie, FixedBeforeWildcard) {
+  PathTrie<int> trie;
+  trie.Emplace(Segments{"", "a", std::nullopt, "c"}, false) = 1;
+  trie.Emplace(Segments{"", "a", "b", std::nullopt}, false) = 2;
+  trie.Emplace(Segments{"", "a", std::nullopt, std::nullopt}, false) = 3;
+
+  EXPECT_EQ(FindValue(trie, "/a/b/c"), 2);
+  EXPECT_EQ(FindValue(trie, "/a/x/c"), 1);
+  EXPECT_EQ(FindValue(trie, "/a/x/y"), 3);
+  EXPECT_EQ(FindValue(trie, "/a/b/c/d"), 0);
+  EXPECT_EQ(FindValue(trie, "/a/b"), 0);
+}
+
+TEST(PathTrie, AnySuffix) {
+  PathTrie<int> trie;
+  trie.Emplace(Segments{"", "a"}, true) = 1;
+  trie.Emplace(Segments{"", "a", std::nullopt, "c"}, true) = 2;
+  trie.Emplace(Segments{"", "a", "b"}, false) = 3;
+
+  EXPECT_EQ(FindValue(trie, "/a"), 0);
+  EXPECT_EQ(FindValue(trie, "/a/"), 1);
+  EXPECT_EQ(FindValue(trie, "/a/b"), 3);
+  EXPECT_EQ(FindValue(trie, "/a/b/c"), 1);
+  EXPECT_EQ(FindValue(trie, "/a/b/c/d"), 2);
+
+  const auto match = Find(trie, "/a/x/c/d/e");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(*match->value, 2);
+  EXPECT_TRUE(match->is_any_suffix);
+  EXPECT_EQ(match->prefix_size, 4);
+}
+
+TEST(PathTrie, RejectedValuesAreSkipped) {
+  PathTrie<int> trie;
+  trie.Emplace(Segments{"", "a", "b"}, false) = 1;
+  trie.Emplace(Segments{"", std::nullopt, "b"}, false) = 2;
+
+  const auto match = trie.Find(SplitPathBySlash("/a/b"),
+                               [](int value) { return value != 1; });
+  ASSERT_TRUE(match);
+  EXPECT_EQ(*match->value, 2);
+  EXPECT_FALSE(match->is_any_suffix);
+  EXPECT_EQ(match->prefix_size, 3);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,367 @@
+#include "simd_http_request_parser.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kCrlf = "\r\n";
+constexpr std::string_view kOptionalWhitespace = " \t";
+
+// Returns the first control character (< 0x20 or DEL) in [begin, end): the
+// line end, a tab or a malformed byte.
+const char* FindControlChar(const char* begin, const char* end) noexcept {
+#if defined(__SSE2__)
+  const auto max_control = _mm_set1_epi8(0x1f);
+  const auto del = _mm_set1_epi8(0x7f);
+  for (; end - begin >= 16; begin += 16) {
+    const auto chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    // unsigned chunk <= 0x1f
+    const auto is_control = _mm_or_si128(
+        _mm_cmpeq_epi8(_mm_min_epu8(chunk, max_control), chunk),
+        _mm_cmpeq_epi8(chunk, del));
+    const auto mask = _mm_movemask_epi8(is_control);
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+#elif defined(__ARM_NEON)
+  const auto min_printable = vdupq_n_u8(0x20);
+  const auto del = vdupq_n_u8(0x7f);
+  for (; end - begin >= 16; begin += 16) {
+    const auto chunk = vld1q_u8(reinterpret_cast<const std::uint8_t*>(begin));
+    const auto is_control =
+        vorrq_u8(vcltq_u8(chunk, min_printable), vceqq_u8(chunk, del));
+    // 4 bits per byte
+    const auto mask = vget_lane_u64(
+        vreinterpret_u64_u8(
+            vshrn_n_u16(vreinterpretq_u16_u8(is_control), 4)),
+        0);
+    if (mask != 0) return begin + (__builtin_ctzll(mask) >> 2);
+  }
+#endif
+  for (; begin != end; ++begin) {
+    const auto c = static_cast<unsigned char>(*begin);
+    if (c < 0x20 || c == 0x7f) return begin;
+  }
+  return end;
+}
+
+std::string_view TrimOptionalWhitespace(std::string_view value) {
+  const auto begin = value.find_first_not_of(kOptionalWhitespace);
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(kOptionalWhitespace);
+  return value.substr(begin, end - begin + 1);
+}
+
+bool ParseContentLength(std::string_view value, size_t& content_length) {
+  if (value.empty()) return false;
+  size_t result = 0;
+  for (const char c : value) {
+    if (c < '0' || c > '9') return false;
+    if (result > (std::numeric_limits<size_t>::max() - 9) / 10) return false;
+    result = result * 10 + (c - '0');
+  }
+  content_length = result;
+  return true;
+}
+
+template <typename Func>
+void ForEachToken(std::string_view value, Func&& func) {
+  while (!value.empty()) {
+    const auto comma = value.find(',');
+    func(TrimOptionalWhitespace(value.substr(0, comma)));
+    if (comma == std::string_view::npos) break;
+    value.remove_prefix(comma + 1);
+  }
+}
+
+}  // namespace
+
+SimdHttpRequestParser::SimdHttpRequestParser(
+    const HandlerInfoIndex& handler_info_index,
+    const request::HttpRequestConfig& request_config,
+    OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<HttpRequestPool> request_pool)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter),
+      request_pool_(std::move(request_pool)) {}
+
+SimdHttpRequestParser::~SimdHttpRequestParser() {
+  if (request_constructor_) --stats_.parsing_request_count;
+}
+
+bool SimdHttpRequestParser::Parse(const char* data, size_t size) {
+  if (fallback_parser_) return fallback_parser_->Parse(data, size);
+
+  std::string_view input{data, size};
+  const bool is_pending = !pending_.empty();
+  if (is_pending) {
+    pending_.append(input);
+    input = pending_;
+  }
+
+  size_t offset = 0;
+  while (offset < input.size()) {
+    const auto consumed = ParseImpl(input.substr(offset));
+    if (!consumed) {
+      pending_.clear();
+      return false;
+    }
+    if (*consumed == 0) break;
+    offset += *consumed;
+  }
+  if (fallback_parser_) {
+    pending_.clear();
+    return true;
+  }
+
+  // Keeps the incomplete header block for the next call
+  if (is_pending) {
+    pending_.erase(0, offset);
+  } else {
+    pending_.assign(input.substr(offset));
+  }
+
+  // Per-handler limits are checked once the header block is complete
+  if (pending_.size() > request_constructor_config_.max_request_size) {
+    LOG_WARNING() << "request header block is too large, "
+                  << pending_.size() << " bytes and not complete";
+    pending_.clear();
+    FinalizeRequest();
+    return false;
+  }
+  return true;
+}
+
+std::optional<size_t> SimdHttpRequestParser::ParseImpl(std::string_view data) {
+  if (request_constructor_) {
+    const auto chunk_size = std::min(body_remaining_, data.size());
+    try {
+      request_constructor_->AppendBody(data.data(), chunk_size);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't append body: " << ex;
+      FinalizeRequest();
+      return std::nullopt;
+    }
+    body_remaining_ -= chunk_size;
+    if (body_remaining_ == 0 && !CompleteRequest()) return std::nullopt;
+    return chunk_size;
+  }
+
+  size_t headers_size = 0;
+  switch (ParseHeaders(data, headers_size)) {
+    case HeadersStatus::kIncomplete:
+      return 0;
+    case HeadersStatus::kError:
+      LOG_WARNING() << "malformed request header block";
+      FinalizeRequest();
+      return std::nullopt;
+    case HeadersStatus::kUnsupported:
+      if (!SwitchToFallbackParser(data)) return std::nullopt;
+      return data.size();
+    case HeadersStatus::kComplete:
+      break;
+  }
+
+  if (!StartRequest()) return std::nullopt;
+  body_remaining_ = headers_.content_length;
+  if (body_remaining_ == 0 && !CompleteRequest()) return std::nullopt;
+  return headers_size;
+}
+
+SimdHttpRequestParser::HeadersStatus SimdHttpRequestParser::ParseHeaders(
+    std::string_view data, size_t& size) {
+  const char* const begin = data.data();
+  const char* const end = begin + data.size();
+
+  // Empty lines before the request line are ignored, RFC 7230 3.5
+  const char* pos = begin;
+  while (end - pos >= 2 && pos[0] == '\r' && pos[1] == '\n') pos += 2;
+
+  const auto next_line = [&pos, end](std::string_view& line) {
+    const char* line_end = FindControlChar(pos, end);
+    while (line_end != end && *line_end == '\t') {
+      line_end = FindControlChar(line_end + 1, end);
+    }
+    if (end - line_end < 2) return HeadersStatus::kIncomplete;
+    if (std::string_view{line_end, kCrlf.size()} != kCrlf) {
+      return HeadersStatus::kError;
+    }
+    line = std::string_view{pos, static_cast<size_t>(line_end - pos)};
+    pos = line_end + kCrlf.size();
+    return HeadersStatus::kComplete;
+  };
+
+  std::string_view line;
+  if (const auto status = next_line(line); status != HeadersStatus::kComplete) {
+    return status;
+  }
+
+  // method SP request-target SP HTTP-version
+  const auto method_end = line.find(' ');
+  const auto version_begin = line.rfind(' ');
+  if (method_end == std::string_view::npos || method_end == version_begin ||
+      method_end + 1 == version_begin) {
+    return HeadersStatus::kError;
+  }
+  const auto version = line.substr(version_begin + 1);
+  if (version.size() != 8 || version.substr(0, 7) != "HTTP/1." ||
+      version[7] < '0' || version[7] > '9') {
+    return HeadersStatus::kError;
+  }
+
+  headers_.method = HttpMethodFromString(line.substr(0, method_end));
+  if (headers_.method == HttpMethod::kUnknown) return HeadersStatus::kError;
+  if (headers_.method == HttpMethod::kConnect) {
+    return HeadersStatus::kUnsupported;
+  }
+  headers_.url = line.substr(method_end + 1, version_begin - method_end - 1);
+  headers_.http_minor = version[7] - '0';
+  headers_.content_length = 0;
+  headers_.fields.clear();
+
+  bool has_content_length = false;
+  bool has_close = false;
+  bool has_keep_alive = false;
+  while (true) {
+    if (const auto status = next_line(line);
+        status != HeadersStatus::kComplete) {
+      return status;
+    }
+    if (line.empty()) break;
+
+    // obs-fold and whitespace before the colon are rejected, RFC 7230 3.2.4
+    const auto colon = line.find(':');
+    if (colon == std::string_view::npos || colon == 0) {
+      return HeadersStatus::kError;
+    }
+    const auto name = line.substr(0, colon);
+    if (name.find_first_of(kOptionalWhitespace) != std::string_view::npos) {
+      return HeadersStatus::kError;
+    }
+    const auto value = TrimOptionalWhitespace(line.substr(colon + 1));
+
+    const utils::StrIcaseEqual equal;
+    if (equal(name, "content-length")) {
+      size_t content_length = 0;
+      if (!ParseContentLength(value, content_length) ||
+          (has_content_length && content_length != headers_.content_length)) {
+        return HeadersStatus::kError;
+      }
+      has_content_length = true;
+      headers_.content_length = content_length;
+    } else if (equal(name, "transfer-encoding") || equal(name, "upgrade")) {
+      return HeadersStatus::kUnsupported;
+    } else if (equal(name, "connection")) {
+      ForEachToken(value, [&](std::string_view token) {
+        if (equal(token, "close")) has_close = true;
+        if (equal(token, "keep-alive")) has_keep_alive = true;
+      });
+    }
+    headers_.fields.emplace_back(name, value);
+  }
+
+  headers_.keep_alive =
+      !has_close && (headers_.http_minor >= 1 || has_keep_alive);
+  size = pos - begin;
+  return HeadersStatus::kComplete;
+}
+
+bool SimdHttpRequestParser::StartRequest() {
+  UASSERT(!request_constructor_);
+  ++stats_.parsing_request_count;
+  request_constructor_.emplace(request_constructor_config_, handler_info_index_,
+                               data_accounter_, request_pool_.get());
+
+  auto& constructor = *request_constructor_;
+  try {
+    constructor.SetMethod(headers_.method);
+    constructor.SetHttpMajor(1);
+    constructor.SetHttpMinor(headers_.http_minor);
+    constructor.AppendUrl(headers_.url.data(), headers_.url.size());
+    constructor.ParseUrl();
+    for (const auto& [name, value] : headers_.fields) {
+      constructor.AppendHeader(name, value);
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse request headers: " << ex;
+    FinalizeRequest();
+    return false;
+  }
+  constructor.SetIsFinal(!headers_.keep_alive);
+  if (constructor.IsBodyStreamed()) {
+    on_new_request_cb_(constructor.FinalizeHeaders());
+  }
+  return true;
+}
+
+bool SimdHttpRequestParser::CompleteRequest() {
+  UASSERT(request_constructor_);
+  if (request_constructor_->IsHeadersFinalized()) {
+    request_constructor_->FinishBody();
+  }
+  return FinalizeRequest();
+}
+
+bool SimdHttpRequestParser::FinalizeRequest() {
+  if (!request_constructor_) {
+    ++stats_.parsing_request_count;
+    request_constructor_.emplace(request_constructor_config_,
+                                 handler_info_index_, data_accounter_,
+                                 request_pool_.get());
+  }
+
+  if (request_constructor_->IsHeadersFinalized()) {
+    // The request was passed to the handler with its headers, the body stream
+    // is aborted unless CompleteRequest() finished it
+    --stats_.parsing_request_count;
+    request_constructor_.reset();
+    return true;
+  }
+
+  auto request = request_constructor_->Finalize();
+  --stats_.parsing_request_count;
+  request_constructor_.reset();
+  if (!request) {
+    LOG_ERROR() << "request is null after Finalize()";
+    return false;
+  }
+  on_new_request_cb_(std::move(request));
+  return true;
+}
+
+bool SimdHttpRequestParser::SwitchToFallbackParser(std::string_view data) {
+  LOG_DEBUG() << "falling back to http_parser for the rest of the connection";
+  fallback_parser_.emplace(
+      handler_info_index_, request_constructor_config_,
+      [this](std::shared_ptr<request::RequestBase>&& request) {
+        on_new_request_cb_(std::move(request));
+      },
+      stats_, data_accounter_, request_pool_);
+  return fallback_parser_->Parse(data.data(), data.size());
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+#include "http_request_parser.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief HTTP/1.x request parser that scans the request line and the header
+/// block with SIMD in one pass.
+///
+/// Headers are passed to the request as views into the data given to Parse(),
+/// the data is only copied if the header block is split between several
+/// Parse() calls. Requests with `Transfer-Encoding` or `Upgrade` are rare on
+/// the hot path, the connection falls back to HttpRequestParser for them.
+class SimdHttpRequestParser final : public request::RequestParser {
+ public:
+  using OnNewRequestCb = HttpRequestParser::OnNewRequestCb;
+
+  SimdHttpRequestParser(const HandlerInfoIndex& handler_info_index,
+                        const request::HttpRequestConfig& request_config,
+                        OnNewRequestCb&& on_new_request_cb,
+                        net::ParserStats& stats,
+                        request::ResponseDataAccounter& data_accounter,
+                        std::shared_ptr<HttpRequestPool> request_pool = {});
+  ~SimdHttpRequestParser() override;
+
+  bool Parse(const char* data, size_t size) override;
+
+ private:
+  enum class HeadersStatus { kComplete, kIncomplete, kError, kUnsupported };
+
+  struct Headers {
+    HttpMethod method{HttpMethod::kUnknown};
+    std::string_view url;
+    unsigned short http_minor{1};
+    std::vector<std::pair<std::string_view, std::string_view>> fields;
+    size_t content_length{0};
+    bool keep_alive{true};
+  };
+
+  // Returns the size of the header block in `size`
+  HeadersStatus ParseHeaders(std::string_view data, size_t& size);
+
+  // Returns the number of bytes consumed, std::nullopt on errors
+  std::optional<size_t> ParseImpl(std::string_view data);
+  bool StartRequest();
+  // Finalizes the request with the whole body received
+  bool CompleteRequest();
+  bool FinalizeRequest();
+  bool SwitchToFallbackParser(std::string_view data);
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+  const std::shared_ptr<HttpRequestPool> request_pool_;
+
+  // Part of the header block received by the previous Parse() calls
+  std::string pending_;
+  Headers headers_;
+  std::optional<HttpRequestConstructor> request_constructor_;
+  size_t body_remaining_{0};
+
+  std::optional<HttpRequestParser> fallback_parser_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
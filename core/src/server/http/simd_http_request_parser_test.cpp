@@ -0,0 +1,134 @@
+#include <server/http/simd_http_request_parser.hpp>
+
+#include <string>
+#include <vector>
+
+#include <server/http/create_parser_test.hpp>
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Requests = std::vector<std::shared_ptr<server::http::HttpRequestImpl>>;
+
+auto CollectTo(Requests& requests) {
+  return [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+    requests.push_back(
+        std::static_pointer_cast<server::http::HttpRequestImpl>(request));
+  };
+}
+
+constexpr std::string_view kGetRequest =
+    "GET /path?arg=value HTTP/1.1\r\n"
+    "Host: localhost\r\n"
+    "X-Header:  value with spaces \t\r\n"
+    "Accept: */*\r\n"
+    "\r\n";
+
+constexpr std::string_view kPostRequest =
+    "POST /post HTTP/1.1\r\n"
+    "Content-Length: 5\r\n"
+    "\r\n"
+    "hello";
+
+}  // namespace
+
+UTEST(SimdHttpRequestParser, Get) {
+  Requests requests;
+  auto parser = server::CreateSimdTestParser(CollectTo(requests));
+
+  EXPECT_TRUE(parser.Parse(kGetRequest.data(), kGetRequest.size()));
+  ASSERT_EQ(requests.size(), 1);
+
+  const auto& request = *requests[0];
+  EXPECT_EQ(request.GetMethod(), server::http::HttpMethod::kGet);
+  EXPECT_EQ(request.GetUrl(), "/path?arg=value");
+  EXPECT_EQ(request.GetRequestPath(), "/path");
+  EXPECT_EQ(request.GetArg("arg"), "value");
+  EXPECT_EQ(request.GetHttpMinor(), 1);
+  EXPECT_EQ(request.GetHeader("host"), "localhost");
+  EXPECT_EQ(request.GetHeader("x-header"), "value with spaces");
+  EXPECT_EQ(request.GetHeader("Accept"), "*/*");
+  EXPECT_FALSE(request.IsFinal());
+}
+
+UTEST(SimdHttpRequestParser, ByteByByte) {
+  Requests requests;
+  auto parser = server::CreateSimdTestParser(CollectTo(requests));
+
+  const std::string data = std::string{kGetRequest} + std::string{kPostRequest};
+  for (const char c : data) {
+    EXPECT_TRUE(parser.Parse(&c, 1));
+  }
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_EQ(requests[0]->GetHeader("x-header"), "value with spaces");
+  EXPECT_EQ(requests[1]->GetMethod(), server::http::HttpMethod::kPost);
+  EXPECT_EQ(requests[1]->RequestBody(), "hello");
+}
+
+UTEST(SimdHttpRequestParser, Pipelined) {
+  Requests requests;
+  auto parser = server::CreateSimdTestParser(CollectTo(requests));
+
+  const std::string data = std::string{kPostRequest} +
+                           std::string{kGetRequest} +
+                           std::string{kPostRequest};
+  EXPECT_TRUE(parser.Parse(data.data(), data.size()));
+  ASSERT_EQ(requests.size(), 3);
+  EXPECT_EQ(requests[0]->RequestBody(), "hello");
+  EXPECT_EQ(requests[1]->GetUrl(), "/path?arg=value");
+  EXPECT_EQ(requests[2]->RequestBody(), "hello");
+}
+
+UTEST(SimdHttpRequestParser, KeepAlive) {
+  Requests requests;
+  auto parser = server::CreateSimdTestParser(CollectTo(requests));
+
+  constexpr std::string_view kData =
+      "GET / HTTP/1.0\r\n\r\n"
+      "GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n"
+      "GET / HTTP/1.1\r\nConnection: foo, close\r\n\r\n";
+  EXPECT_TRUE(parser.Parse(kData.data(), kData.size()));
+  ASSERT_EQ(requests.size(), 3);
+  EXPECT_TRUE(requests[0]->IsFinal());
+  EXPECT_FALSE(requests[1]->IsFinal());
+  EXPECT_TRUE(requests[2]->IsFinal());
+}
+
+UTEST(SimdHttpRequestParser, ChunkedFallback) {
+  Requests requests;
+  auto parser = server::CreateSimdTestParser(CollectTo(requests));
+
+  constexpr std::string_view kData =
+      "POST /chunked HTTP/1.1\r\n"
+      "Transfer-Encoding: chunked\r\n"
+      "\r\n"
+      "5\r\nhello\r\n0\r\n\r\n";
+  const std::string data = std::string{kData} + std::string{kGetRequest};
+  EXPECT_TRUE(parser.Parse(data.data(), data.size() - 3));
+  EXPECT_TRUE(parser.Parse(data.data() + data.size() - 3, 3));
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_EQ(requests[0]->GetUrl(), "/chunked");
+  EXPECT_EQ(requests[0]->RequestBody(), "hello");
+  EXPECT_EQ(requests[1]->GetUrl(), "/path?arg=value");
+}
+
+UTEST(SimdHttpRequestParser, Malformed) {
+  for (const std::string_view data : {
+           "GET / HTTP/1.1\r\nBad Header: value\r\n\r\n",
+           "GET / HTTP/1.1\r\n folded: value\r\n\r\n",
+           "GET / HTTP/1.1\r\nName: va\x01ue\r\n\r\n",
+           "GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n",
+           "GET / HTTP/2.1\r\n\r\n",
+           "GET /\r\n\r\n",
+           "FOO / HTTP/1.1\r\n\r\n",
+       }) {
+    Requests requests;
+    auto parser = server::CreateSimdTestParser(CollectTo(requests));
+    EXPECT_FALSE(parser.Parse(data.data(), data.size())) << data;
+    EXPECT_EQ(requests.size(), 1) << data;
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <server/http/wildcard_path_index.hpp>
 
+#include <optional>
 #include <stdexcept>
 
 #include <boost/algorithm/string/split.hpp>
@@ -29,43 +30,6 @@ std::string ExtractWildcardName(const std::string& str) {
   return str.substr(1, str.size() - 2);
 }
 
-bool GetFromHandlerMethodIndex(const WildcardPathIndex::Node& node,
-                               HttpMethod method,
-                               const std::vector<std::string>& path,
-                               MatchRequestResult& match_result,
-                               bool limit_path_length) {
-  const auto& index_map = node.handler_method_index_map;
-  decltype(index_map.begin()) it;
-  if (limit_path_length) {
-    it = index_map.find(path.size());
-  } else {
-    it = index_map.upper_bound(path.size());
-    if (it == index_map.begin()) return false;
-    --it;
-  }
-  if (it == index_map.end()) return false;
-  const auto& handler_method_index = it->second;
-
-  const auto* handler_info_data =
-      handler_method_index.GetHandlerInfoData(method);
-  if (!handler_info_data) {
-    match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
-    return false;
-  }
-
-  match_result.handler_info = &handler_info_data->handler_info;
-  for (const auto& arg : handler_info_data->wildcards) {
-    if (arg.index > path.size())
-      throw std::logic_error(
-          "matched path from handler has length greater than path from "
-          "request");
-    match_result.args_from_path.emplace_back(
-        arg.name, arg.index == path.size() ? std::string{} : path[arg.index]);
-  }
-  match_result.status = MatchRequestResult::Status::kOk;
-  return true;
-}
-
 }  // namespace
 
 bool HasWildcardSpecificSymbols(const std::string& path) {
@@ -108,95 +72,67 @@ void WildcardPathIndex::AddHandler(const handlers::HttpHandlerBase& handler,
 
 bool WildcardPathIndex::MatchRequest(HttpMethod method, const std::string& path,
                                      MatchRequestResult& match_result) const {
-  return MatchRequest(root_, method, SplitBySlash(path), path.size(),
-                      match_result);
+  const auto path_segments = SplitPathBySlash(path);
+  const auto match = trie_.Find(
+      path_segments, [method, &match_result](const HandlerMethodIndex& index) {
+        if (index.GetHandlerInfoData(method)) return true;
+        match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
+        return false;
+      });
+  if (!match) return false;
+
+  const auto& handler_info_data = *match->value->GetHandlerInfoData(method);
+  match_result.handler_info = &handler_info_data.handler_info;
+  for (const auto& arg : handler_info_data.wildcards) {
+    match_result.args_from_path.emplace_back(
+        arg.name, std::string{path_segments[arg.index]});
+  }
+
+  if (match->is_any_suffix) {
+    // "/some/.../path/*"
+    const auto asterisk_pos = match->prefix_size;
+    match_result.matched_path_length = asterisk_pos;
+    for (size_t i = 0; i < asterisk_pos; i++) {
+      match_result.matched_path_length += path_segments[i].size();
+    }
+    for (size_t i = asterisk_pos; i < path_segments.size(); i++) {
+      match_result.args_from_path.emplace_back(std::string{},
+                                               std::string{path_segments[i]});
+    }
+  } else {
+    match_result.matched_path_length = path.size();
+  }
+  match_result.status = MatchRequestResult::Status::kOk;
+  return true;
 }
 
 void WildcardPathIndex::AddHandler(const std::string& path,
                                    const handlers::HttpHandlerBase& handler,
                                    engine::TaskProcessor& task_processor) {
   auto path_vec = SplitBySlash(path);
-  std::vector<PathItem> path_fixed_items;
+  // only the trailing '*' matches any suffix, others are fixed segments
+  const bool is_any_suffix = path_vec.back() == kAnySuffixMark;
+  if (is_any_suffix) path_vec.pop_back();
+
+  std::vector<std::optional<std::string>> segments;
   std::vector<PathItem> path_wildcards;
   std::unordered_set<std::string> wildcard_names;
   try {
     for (size_t i = 0; i < path_vec.size(); i++) {
       if (!HasWildcardSpecificSymbols(path_vec[i])) {
-        path_fixed_items.emplace_back(
-            ExtractFixedPathItem(i, std::move(path_vec[i])));
+        segments.emplace_back(std::move(path_vec[i]));
       } else {
         path_wildcards.emplace_back(
             ExtractWildcardPathItem(i, path_vec[i], wildcard_names));
+        segments.emplace_back(std::nullopt);
       }
     }
   } catch (const std::exception& ex) {
     throw std::runtime_error("Failed to process handler path '" + path +
                              "': " + ex.what());
   }
-  AddPath(handler, task_processor, std::move(path_fixed_items),
-          std::move(path_wildcards));
-}
-
-void WildcardPathIndex::AddPath(const handlers::HttpHandlerBase& handler,
-                                engine::TaskProcessor& task_processor,
-                                std::vector<PathItem>&& fixed_path,
-                                std::vector<PathItem> wildcards) {
-  size_t length = fixed_path.size() + wildcards.size();
-  Node* cur = &root_;
-  for (auto& path_item : std::move(fixed_path)) {
-    cur = &cur->next[path_item.index][std::move(path_item.name)];
-  }
-  cur->handler_method_index_map[length].AddHandler(handler, task_processor,
-                                                   std::move(wildcards));
-}
-
-bool WildcardPathIndex::MatchRequest(const Node& node, HttpMethod method,
-                                     const std::vector<std::string>& path,
-                                     size_t path_string_length,
-                                     MatchRequestResult& match_result) const {
-  for (const auto& next_item : node.next) {
-    if (next_item.first >= path.size()) break;
-    auto it = next_item.second.find(path[next_item.first]);
-    if (it != next_item.second.end()) {
-      if (MatchRequest(it->second, method, path, path_string_length,
-                       match_result))
-        return true;
-    }
-  }
-
-  // check for match without '*'
-  if (GetFromHandlerMethodIndex(node, method, path, match_result, true)) {
-    match_result.matched_path_length = path_string_length;
-    return true;
-  }
-
-  // check "/some/.../path/*"
-  auto node_next_it = node.next.lower_bound(path.size());
-  while (node_next_it != node.next.begin()) {
-    --node_next_it;
-    auto it = node_next_it->second.find(kAnySuffixMark);
-    if (it != node_next_it->second.end()) {
-      if (GetFromHandlerMethodIndex(it->second, method, path, match_result,
-                                    false)) {
-        size_t asterisk_pos = node_next_it->first;
-        match_result.matched_path_length = asterisk_pos;
-        for (size_t i = 0; i < asterisk_pos; i++) {
-          match_result.matched_path_length += path[i].size();
-        }
-        for (size_t i = asterisk_pos; i < path.size(); i++) {
-          match_result.args_from_path.emplace_back(std::string{}, path[i]);
-        }
-        return true;
-      }
-    }
-  }
-
-  return false;
-}
-
-PathItem WildcardPathIndex::ExtractFixedPathItem(size_t index,
-                                                 std::string&& path_elem) {
-  return PathItem{index, std::move(path_elem)};
+  trie_.Emplace(segments, is_any_suffix)
+      .AddHandler(handler, task_processor, std::move(path_wildcards));
 }
 
 PathItem WildcardPathIndex::ExtractWildcardPathItem(
@@ -2,11 +2,16 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <system_error>
+#include <utility>
 #include <vector>
 
 #include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
 
 #include <userver/engine/async.hpp>
@@ -15,14 +20,24 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_config.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+// Other connections do not notify about their sent responses
+constexpr std::chrono::milliseconds kTotalPendingBytesPollInterval{10};
+
+}  // namespace
+
 std::shared_ptr<Connection> Connection::Create(
     engine::TaskProcessor& task_processor, const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -51,6 +66,10 @@ Connection::Connection(
       data_accounter_(data_accounter),
       remote_address_(peer_socket_.Getpeername().PrimaryAddressString()),
       request_tasks_(Queue::Create()) {
+  if (config_.max_in_flight_requests) {
+    in_flight_semaphore_.emplace(*config_.max_in_flight_requests);
+  }
+
   LOG_DEBUG() << "Incoming connection from " << peer_socket_.Getpeername()
               << ", fd " << Fd();
 
@@ -62,17 +81,28 @@ void Connection::SetCloseCb(CloseCb close_cb) {
   close_cb_ = std::move(close_cb);
 }
 
+void Connection::SetParking(std::shared_ptr<ConnectionParking> parking) {
+  parking_ = std::move(parking);
+}
+
 void Connection::Start() {
   LOG_TRACE() << "Starting socket listener for fd " << Fd();
 
+  const bool is_resumed = std::exchange(is_parked_, false);
+  if (is_resumed) {
+    // the queue of the previous tasks is closed
+    request_tasks_ = Queue::Create();
+    --stats_->parked_connections;
+  }
+
   // TODO TAXICOMMON-1993 Remove slicing once the issues with payload lifetime
   // in cancelled TaskWithResult are resolved
   engine::Task socket_listener =
       // NOLINTNEXTLINE(cppcoreguidelines-slicing)
       engine::AsyncNoSpan(
           task_processor_,
-          [this](Queue::Producer producer) {
-            ListenForRequests(std::move(producer));
+          [this, is_resumed](Queue::Producer producer) {
+            ListenForRequests(std::move(producer), is_resumed);
           },
           request_tasks_->GetProducer());
 
@@ -90,7 +120,11 @@ void Connection::Start() {
 
         socket_listener.SyncCancel();
         self->ProcessResponses(consumer);  // Consume remaining requests
-        self->Shutdown();
+        if (self->is_parked_ && !engine::current_task::ShouldCancel()) {
+          self->Park();
+        } else {
+          self->Shutdown();
+        }
       },
       shared_from_this(), std::move(socket_listener));
   response_sender_launched_event_.Send();
@@ -99,10 +133,25 @@ void Connection::Start() {
   LOG_TRACE() << "Started socket listener for fd " << Fd();
 }
 
-void Connection::Stop() { response_sender_task_.RequestCancel(); }
+void Connection::Stop() {
+  // a parked connection is closed by its parking
+  if (response_sender_task_.IsValid()) response_sender_task_.RequestCancel();
+}
 
 int Connection::Fd() const { return peer_socket_.Fd(); }
 
+bool Connection::IsKeepaliveExpired() const noexcept {
+  return keepalive_deadline_.IsReached();
+}
+
+void Connection::CloseParked() noexcept {
+  UASSERT(is_parked_);
+  LOG_TRACE() << "Closing parked connection for fd " << Fd();
+
+  --stats_->parked_connections;
+  Close();
+}
+
 void Connection::Shutdown() noexcept {
   UASSERT(response_sender_task_.IsValid());
 
@@ -110,27 +159,45 @@ void Connection::Shutdown() noexcept {
                  "requests) for fd "
               << Fd();
 
+  Close();
+
+  UASSERT(IsRequestTasksEmpty());
+
+  // `~Connection()` may be called from within the `response_sender_task_`.
+  // Without `Detach()` we get a deadlock.
+  std::move(response_sender_task_).Detach();
+}
+
+void Connection::Close() noexcept {
   peer_socket_.Close();  // should not throw
 
   --stats_->active_connections;
   ++stats_->connections_closed;
 
   if (close_cb_) close_cb_();  // should not throw
+}
 
+void Connection::Park() noexcept {
+  UASSERT(response_sender_task_.IsValid());
+  UASSERT(parking_);
   UASSERT(IsRequestTasksEmpty());
 
-  // `~Connection()` may be called from within the `response_sender_task_`.
-  // Without `Detach()` we get a deadlock.
+  LOG_TRACE() << "Parking idle connection for fd " << Fd();
+  ++stats_->parked_connections;
+
+  // The parking may restart the connection right away, this task must not
+  // touch the connection after that
+  auto parking = parking_;
   std::move(response_sender_task_).Detach();
+  parking->Park(shared_from_this());
 }
 
 bool Connection::IsRequestTasksEmpty() const noexcept {
   return request_tasks_->GetSizeApproximate() == 0;
 }
 
-void Connection::ListenForRequests(Queue::Producer producer) noexcept {
-  using RequestBasePtr = std::shared_ptr<request::RequestBase>;
-
+void Connection::ListenForRequests(Queue::Producer producer,
+                                   bool is_resumed) noexcept {
   utils::ScopeGuard send_stopper([this]() {
     // do not request cancel unless we're sure it's in valid state
     // this task can only normally be cancelled from response sender
@@ -142,19 +209,37 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
   try {
     request_tasks_->SetSoftMaxSize(config_.requests_queue_size_threshold);
 
-    http::HttpRequestParser request_parser(
-        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
-        [this, &producer](RequestBasePtr&& request_ptr) {
-          if (!NewRequest(std::move(request_ptr), producer)) {
-            is_accepting_requests_ = false;
-          }
-        },
-        stats_->parser_stats, data_accounter_);
+    request_producer_ = &producer;
+    utils::FastScopeGuard producer_guard(
+        [this]() noexcept { request_producer_ = nullptr; });
+
+    if (!http1_parser_) {
+      http1_parser_ = CreateHttp1Parser(
+          [this](std::shared_ptr<request::RequestBase>&& request_ptr) {
+            OnNewRequest(std::move(request_ptr));
+          });
+      // The protocol is unknown until the first bytes of the HTTP/2 preface
+      if (!config_.http2.enabled) request_parser_ = http1_parser_.get();
+    }
+
+    utils::ScopeGuard http2_stopper([this]() {
+      // wakes up the response sender waiting for the flow control window
+      if (http2_session_) http2_session_->Stop();
+    });
+
+    std::string preface_data;
 
     std::vector<char> buf(config_.in_buffer_size);
     std::size_t last_bytes_read = 0;
     while (is_accepting_requests_) {
-      auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
+      if (!WaitForPendingResponses()) return;
+
+      // a resumed connection keeps the deadline it has been parked with
+      if (!std::exchange(is_resumed, false)) {
+        keepalive_deadline_ =
+            engine::Deadline::FromDuration(config_.keepalive_timeout);
+      }
+      const auto deadline = keepalive_deadline_;
 
       bool is_readable = true;
       // If we didn't fill the buffer in the previous loop iteration we almost
@@ -168,6 +253,19 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
       //
       // So instead we just do 2. and 3., shaving off a whole recv syscall
       if (last_bytes_read != buf.size()) {
+        if (CanPark()) {
+          const auto park_deadline = std::min(
+              engine::Deadline::FromDuration(*config_.idle_park_timeout),
+              deadline);
+          if (!peer_socket_.WaitReadable(park_deadline) &&
+              !engine::current_task::ShouldCancel() && !deadline.IsReached()) {
+            // The buffer and the coroutines are released until the socket
+            // becomes readable, see ConnectionParking
+            is_parked_ = true;
+            send_stopper.Release();
+            return;
+          }
+        }
         is_readable = peer_socket_.WaitReadable(deadline);
       }
 
@@ -190,7 +288,34 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
       LOG_TRACE() << "Received " << last_bytes_read << " byte(s) from "
                   << peer_socket_.Getpeername() << " on fd " << Fd();
 
-      if (!request_parser.Parse(buf.data(), last_bytes_read)) {
+      std::string_view data{buf.data(), last_bytes_read};
+      if (!request_parser_) {
+        preface_data.append(data);
+        const auto& preface = http::kHttp2PrefaceStart;
+        const auto compared_size =
+            std::min(preface_data.size(), preface.size());
+        if (preface_data.compare(0, compared_size, preface, 0,
+                                 compared_size) != 0) {
+          request_parser_ = http1_parser_.get();
+        } else if (compared_size == preface.size()) {
+          ++stats_->http2_stats.connections;
+          http2_session_ = std::make_unique<http::Http2Session>(
+              request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+              config_.http2, peer_socket_,
+              [this](std::shared_ptr<request::RequestBase>&& request_ptr) {
+                OnNewRequest(std::move(request_ptr));
+              },
+              stats_->parser_stats, stats_->http2_stats, data_accounter_);
+          request_parser_ = http2_session_.get();
+        } else {
+          continue;
+        }
+        data = preface_data;
+      }
+
+      const bool is_parsed = request_parser_->Parse(data.data(), data.size());
+      if (!preface_data.empty()) std::string{}.swap(preface_data);
+      if (!is_parsed) {
         LOG_DEBUG() << "Malformed request from " << peer_socket_.Getpeername()
                     << " on fd " << Fd();
 
@@ -223,6 +348,41 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
   }
 }
 
+std::unique_ptr<request::RequestParser> Connection::CreateHttp1Parser(
+    http::HttpRequestParser::OnNewRequestCb on_new_request_cb) {
+  // keep-alive requests of the connection reuse the memory of the previous
+  // ones
+  auto request_pool = std::make_shared<http::HttpRequestPool>();
+  switch (config_.request_parser) {
+    case RequestParserType::kHttpParser:
+      return std::make_unique<http::HttpRequestParser>(
+          request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+          std::move(on_new_request_cb), stats_->parser_stats, data_accounter_,
+          std::move(request_pool));
+    case RequestParserType::kSimd:
+      return std::make_unique<http::SimdHttpRequestParser>(
+          request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+          std::move(on_new_request_cb), stats_->parser_stats, data_accounter_,
+          std::move(request_pool));
+  }
+
+  UINVARIANT(false, "Unexpected request parser type");
+}
+
+void Connection::OnNewRequest(
+    std::shared_ptr<request::RequestBase>&& request_ptr) {
+  UASSERT(request_producer_);
+  if (!NewRequest(std::move(request_ptr), *request_producer_)) {
+    is_accepting_requests_ = false;
+  }
+}
+
+bool Connection::CanPark() const noexcept {
+  // HTTP/2 streams and the pipelined requests keep the connection busy
+  return parking_ && config_.idle_park_timeout && http1_parser_ &&
+         request_parser_ == http1_parser_.get() && in_flight_requests_ == 0;
+}
+
 bool Connection::NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                             Queue::Producer& producer) {
   if (!is_accepting_requests_) {
@@ -237,9 +397,72 @@ bool Connection::NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
     is_accepting_requests_ = false;
   }
 
+  if (!AcquireInFlightSlot()) return false;
+
   ++stats_->active_request_count;
   auto task = request_handler_.StartRequestTask(request_ptr);
-  return producer.Push({std::move(request_ptr), std::move(task)});
+  if (!producer.Push({std::move(request_ptr), std::move(task)})) {
+    ReleaseInFlightSlot();
+    return false;
+  }
+  return true;
+}
+
+bool Connection::AcquireInFlightSlot() {
+  if (in_flight_semaphore_ && !in_flight_semaphore_->try_lock_shared()) {
+    // Stops reading from the socket until a response is sent, the pipelined
+    // requests wait in the socket buffers
+    ++stats_->in_flight_limit_reached;
+    if (!in_flight_semaphore_->try_lock_shared_until(engine::Deadline{})) {
+      return false;
+    }
+  }
+
+  const auto in_flight = ++in_flight_requests_;
+  utils::AtomicMax(stats_->max_connection_in_flight_requests, in_flight);
+  return true;
+}
+
+void Connection::ReleaseInFlightSlot() noexcept {
+  --in_flight_requests_;
+  if (in_flight_semaphore_) in_flight_semaphore_->unlock_shared();
+}
+
+bool Connection::WaitForPendingResponses() {
+  const bool is_pending_bytes_limit_reached = IsPendingBytesLimitReached();
+  const bool is_total_pending_bytes_limit_reached =
+      IsTotalPendingBytesLimitReached();
+  if (!is_pending_bytes_limit_reached &&
+      !is_total_pending_bytes_limit_reached) {
+    return true;
+  }
+
+  // Stops reading from the socket, so the slow clients can't make us keep
+  // ever more responses in memory
+  if (is_pending_bytes_limit_reached) ++stats_->pending_bytes_limit_reached;
+  if (is_total_pending_bytes_limit_reached) {
+    ++stats_->total_pending_bytes_limit_reached;
+  }
+  ++stats_->paused_connections;
+  utils::ScopeGuard paused_guard([this] { --stats_->paused_connections; });
+
+  while (IsPendingBytesLimitReached() || IsTotalPendingBytesLimitReached()) {
+    const bool is_sent = response_sent_event_.WaitForEventFor(
+        kTotalPendingBytesPollInterval);
+    if (!is_sent && engine::current_task::ShouldCancel()) return false;
+  }
+  return true;
+}
+
+bool Connection::IsPendingBytesLimitReached() const noexcept {
+  return config_.max_pending_response_bytes &&
+         pending_response_bytes_ >= *config_.max_pending_response_bytes;
+}
+
+bool Connection::IsTotalPendingBytesLimitReached() const noexcept {
+  return config_.max_total_pending_response_bytes &&
+         data_accounter_.GetCurrentLevel() >=
+             *config_.max_total_pending_response_bytes;
 }
 
 void Connection::ProcessResponses(Queue::Consumer& consumer) noexcept {
@@ -254,9 +477,14 @@ void Connection::ProcessResponses(Queue::Consumer& consumer) noexcept {
       /* In stream case we don't want a user task to exit
        * until SendResponse() as the task produces body chunks.
        */
+      const auto data_size = item.first->GetResponse().GetData().size();
+      pending_response_bytes_ = data_size;
       SendResponse(*item.first);
+      pending_response_bytes_ = 0;
+      response_sent_event_.Send();
       item.first.reset();
       item.second = {};
+      ReleaseInFlightSlot();
     }
   } catch (const std::exception& e) {
     LOG_ERROR() << "Exception for fd " << Fd() << ": " << e;
@@ -308,7 +536,12 @@ void Connection::SendResponse(request::RequestBase& request) {
   if (is_response_chain_valid_ && peer_socket_) {
     try {
       // Might be a stream reading or a fully constructed response
-      response.SendResponse(peer_socket_);
+      if (http2_session_) {
+        static_cast<http::HttpResponse&>(response).SendResponse(
+            *http2_session_);
+      } else {
+        response.SendResponse(peer_socket_);
+      }
     } catch (const engine::io::IoSystemError& ex) {
       // working with raw values because std::errc compares error_category
       // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
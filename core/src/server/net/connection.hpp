@@ -1,16 +1,22 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
+#include <server/net/connection_parking.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 
 #include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -49,24 +55,49 @@ class Connection final : public std::enable_shared_from_this<Connection> {
 
   void SetCloseCb(CloseCb close_cb);
 
+  // If set, the connection releases its coroutines while idle for
+  // idle_park_timeout
+  void SetParking(std::shared_ptr<ConnectionParking> parking);
+
+  // Is called again by the parking to resume a parked connection
   void Start();
 
   void Stop();  // Can be called after Start() has finished
 
   int Fd() const;
 
+  // The following functions may be called for a parked connection only
+  bool IsKeepaliveExpired() const noexcept;
+  void CloseParked() noexcept;
+
  private:
   using QueueItem = std::pair<std::shared_ptr<request::RequestBase>,
                               engine::TaskWithResult<void>>;
   using Queue = concurrent::SpscQueue<QueueItem>;
 
   void Shutdown() noexcept;
+  void Close() noexcept;
+  void Park() noexcept;
 
   bool IsRequestTasksEmpty() const noexcept;
 
-  void ListenForRequests(Queue::Producer) noexcept;
+  void ListenForRequests(Queue::Producer, bool is_resumed) noexcept;
+  void OnNewRequest(std::shared_ptr<request::RequestBase>&& request_ptr);
+  bool CanPark() const noexcept;
+  std::unique_ptr<request::RequestParser> CreateHttp1Parser(
+      std::function<void(std::shared_ptr<request::RequestBase>&&)>
+          on_new_request_cb);
   bool NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                   Queue::Producer&);
+  // Waits for the response to one of the previous requests to be sent
+  // if max_in_flight_requests is reached
+  bool AcquireInFlightSlot();
+  void ReleaseInFlightSlot() noexcept;
+  // Waits for the pending responses to be sent if any of the
+  // max_*pending_response_bytes is reached
+  bool WaitForPendingResponses();
+  bool IsPendingBytesLimitReached() const noexcept;
+  bool IsTotalPendingBytesLimitReached() const noexcept;
 
   void ProcessResponses(Queue::Consumer&) noexcept;
   void HandleQueueItem(QueueItem& item) noexcept;
@@ -76,18 +107,37 @@ class Connection final : public std::enable_shared_from_this<Connection> {
   const ConnectionConfig& config_;
   const request::HttpRequestConfig& handler_defaults_config_;
   engine::io::Socket peer_socket_;
+  // Set by ListenForRequests() if the peer starts with the HTTP/2 preface
+  std::unique_ptr<http::Http2Session> http2_session_;
+  // The parsers outlive the tasks of a parked connection, a partially received
+  // request is kept by them
+  std::unique_ptr<request::RequestParser> http1_parser_;
+  // Null until the protocol is known
+  request::RequestParser* request_parser_{nullptr};
+  // Producer of the running ListenForRequests()
+  Queue::Producer* request_producer_{nullptr};
+  engine::Deadline keepalive_deadline_;
   const http::RequestHandlerBase& request_handler_;
   const std::shared_ptr<Stats> stats_;
   request::ResponseDataAccounter& data_accounter_;
   const std::string remote_address_;
 
   std::shared_ptr<Queue> request_tasks_;
+  // Engaged if max_in_flight_requests is set
+  std::optional<engine::CancellableSemaphore> in_flight_semaphore_;
+  std::atomic<std::size_t> in_flight_requests_{0};
+  // Data size of the response being sent
+  std::atomic<std::size_t> pending_response_bytes_{0};
+  engine::SingleConsumerEvent response_sent_event_;
   engine::SingleConsumerEvent response_sender_launched_event_;
   engine::SingleConsumerEvent response_sender_assigned_event_;
   engine::Task response_sender_task_;
 
   bool is_accepting_requests_{true};
   bool is_response_chain_valid_{true};
+  // Set by ListenForRequests() when it exits to park the connection
+  bool is_parked_{false};
+  std::shared_ptr<ConnectionParking> parking_;
   CloseCb close_cb_;
 };
 
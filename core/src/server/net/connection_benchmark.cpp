@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/http/request_handler_base.hpp>
+#include <server/net/connection.hpp>
+#include <server/net/listener_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
+
+constexpr std::string_view kRequest =
+    "GET /ping HTTP/1.1\r\nHost: localhost\r\n\r\n";
+constexpr std::string_view kResponseStart = "HTTP/1.1 200";
+
+// Responds 200 OK to every request without any handler lookup, so that only
+// the connection, the parser and the response serialization are measured
+class PingRequestHandler final : public server::http::RequestHandlerBase {
+ public:
+  engine::TaskWithResult<void> StartRequestTask(
+      std::shared_ptr<server::request::RequestBase> request) const override {
+    auto& http_request = dynamic_cast<server::http::HttpRequestImpl&>(*request);
+    http_request.SetHttpHandlerStatistics(statistics_);
+
+    return engine::AsyncNoSpan([&http_request] {
+      http_request.SetResponseStatus(server::http::HttpStatus::kOk);
+      http_request.GetHttpResponse().SetData("OK");
+    });
+  }
+
+  const server::http::HandlerInfoIndex& GetHandlerInfoIndex() const override {
+    return handler_info_index_;
+  }
+
+  const logging::LoggerPtr& LoggerAccess() const noexcept override {
+    return no_logger_;
+  }
+
+  const logging::LoggerPtr& LoggerAccessTskv() const noexcept override {
+    return no_logger_;
+  }
+
+ private:
+  mutable server::handlers::HttpRequestStatistics statistics_;
+  logging::LoggerPtr no_logger_;
+  server::http::HandlerInfoIndex handler_info_index_;
+};
+
+std::size_t CountResponses(std::string_view data) {
+  std::size_t count = 0;
+  for (auto pos = data.find(kResponseStart); pos != std::string_view::npos;
+       pos = data.find(kResponseStart, pos + kResponseStart.size())) {
+    ++count;
+  }
+  return count;
+}
+
+double GetPercentile(std::vector<double>& values, double percent) {
+  if (values.empty()) return 0;
+  const auto index = static_cast<std::size_t>(
+      static_cast<double>(values.size() - 1) * percent / 100);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+}  // namespace
+
+// Sends batches of `state.range(0)` pipelined requests over a loopback TCP
+// connection served by net::Connection and waits for all the responses.
+// A batch of 1 is the non-pipelined request-response load.
+void server_connection_requests(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    const auto deadline = engine::Deadline::FromDuration(kDeadlineMaxTime);
+    const auto pipeline_depth = static_cast<std::size_t>(state.range(0));
+
+    server::net::ListenerConfig config;
+    config.handler_defaults = server::request::HttpRequestConfig{};
+    config.connection_config.max_in_flight_requests = pipeline_depth;
+
+    internal::net::TcpListener listener;
+    auto [server_socket, client] = listener.MakeSocketPair(deadline);
+
+    auto stats = std::make_shared<server::net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    const PingRequestHandler handler;
+    auto connection = server::net::Connection::Create(
+        engine::current_task::GetTaskProcessor(), config.connection_config,
+        config.handler_defaults, std::move(server_socket), handler, stats,
+        data_accounter);
+    connection->Start();
+
+    std::string requests;
+    for (std::size_t i = 0; i < pipeline_depth; ++i) requests += kRequest;
+
+    std::vector<double> latencies_us;
+    std::string responses;
+    std::array<char, 16 * 1024> buf{};
+    for ([[maybe_unused]] auto _ : state) {
+      const auto start = std::chrono::steady_clock::now();
+      const auto sent = client.SendAll(requests.data(), requests.size(),
+                                       deadline);
+      UINVARIANT(sent == requests.size(), "Failed to send the requests");
+
+      responses.clear();
+      while (CountResponses(responses) < pipeline_depth) {
+        const auto received = client.RecvSome(buf.data(), buf.size(), deadline);
+        UINVARIANT(received != 0, "Connection closed by the server");
+        responses.append(buf.data(), received);
+      }
+      latencies_us.push_back(
+          std::chrono::duration<double, std::micro>(
+              std::chrono::steady_clock::now() - start)
+              .count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * pipeline_depth);
+    state.counters["p50_us"] = GetPercentile(latencies_us, 50);
+    state.counters["p99_us"] = GetPercentile(latencies_us, 99);
+    state.counters["max_us"] = GetPercentile(latencies_us, 100);
+
+    connection->Stop();
+    const std::weak_ptr<server::net::Connection> weak = connection;
+    connection.reset();
+    while (weak.lock()) engine::Yield();
+  });
+}
+BENCHMARK(server_connection_requests)->Arg(1)->Arg(8)->Arg(64);
+
+USERVER_NAMESPACE_END
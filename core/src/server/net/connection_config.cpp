@@ -1,11 +1,39 @@
 #include <server/net/connection_config.hpp>
 
+#include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+RequestParserType Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<RequestParserType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(RequestParserType::kHttpParser, "http_parser")
+        .Case(RequestParserType::kSimd, "simd");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+Http2Config Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Http2Config>) {
+  Http2Config config;
+
+  config.enabled = value["enabled"].As<bool>(config.enabled);
+  config.max_concurrent_streams =
+      value["max_concurrent_streams"].As<std::uint32_t>(
+          config.max_concurrent_streams);
+  config.initial_window_size = value["initial_window_size"].As<std::uint32_t>(
+      config.initial_window_size);
+  config.send_timeout =
+      value["send_timeout"].As<std::chrono::milliseconds>(config.send_timeout);
+
+  return config;
+}
+
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ConnectionConfig>) {
   ConnectionConfig config;
@@ -18,6 +46,21 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
   config.keepalive_timeout =
       value["keepalive_timeout"].As<std::chrono::seconds>(
           config.keepalive_timeout);
+  config.max_in_flight_requests =
+      value["max_in_flight_requests"].As<std::optional<size_t>>(
+          config.max_in_flight_requests);
+  config.max_pending_response_bytes =
+      value["max_pending_response_bytes"].As<std::optional<size_t>>(
+          config.max_pending_response_bytes);
+  config.max_total_pending_response_bytes =
+      value["max_total_pending_response_bytes"].As<std::optional<size_t>>(
+          config.max_total_pending_response_bytes);
+  config.idle_park_timeout =
+      value["idle_park_timeout"].As<std::optional<std::chrono::milliseconds>>(
+          config.idle_park_timeout);
+  config.http2 = value["http2"].As<Http2Config>(config.http2);
+  config.request_parser =
+      value["request_parser"].As<RequestParserType>(config.request_parser);
 
   return config;
 }
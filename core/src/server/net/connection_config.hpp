@@ -1,6 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/yaml_config/yaml_config.hpp>
@@ -9,10 +12,40 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+enum class RequestParserType {
+  kHttpParser,
+  kSimd,
+};
+
+RequestParserType Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<RequestParserType>);
+
+struct Http2Config {
+  bool enabled = false;
+  std::uint32_t max_concurrent_streams = 100;
+  std::uint32_t initial_window_size = 65535;
+  // For how long a response may wait for the socket or for the peer's flow
+  // control window
+  std::chrono::milliseconds send_timeout{std::chrono::seconds{10}};
+};
+
+Http2Config Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Http2Config>);
+
 struct ConnectionConfig {
   size_t in_buffer_size = 32 * 1024;
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
+  // Requests that are handled or wait for the previous responses to be sent
+  std::optional<size_t> max_in_flight_requests;
+  // Bytes of the response being sent to the connection
+  std::optional<size_t> max_pending_response_bytes;
+  // Bytes of the responses not yet sent to all the connections of the port
+  std::optional<size_t> max_total_pending_response_bytes;
+  // Keep-alive connections idle for this long release their coroutines
+  std::optional<std::chrono::milliseconds> idle_park_timeout;
+  RequestParserType request_parser = RequestParserType::kHttpParser;
+  Http2Config http2;
 };
 
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
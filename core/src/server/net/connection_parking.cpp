@@ -0,0 +1,104 @@
+#include <server/net/connection_parking.hpp>
+
+#include <chrono>
+#include <unordered_map>
+#include <utility>
+
+#include <server/net/connection.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+namespace {
+
+// The parked connections are checked for the expired keepalive_timeout this
+// often, that is the precision of the timeout for them
+constexpr std::chrono::seconds kKeepaliveCheckInterval{1};
+
+}  // namespace
+
+ConnectionParking::ConnectionParking() = default;
+
+ConnectionParking::~ConnectionParking() = default;
+
+void ConnectionParking::Park(std::shared_ptr<Connection> connection) {
+  bool is_stopped = false;
+  {
+    auto to_park = to_park_.Lock();
+    is_stopped = to_park->is_stopped;
+    if (!is_stopped) to_park->connections.push_back(connection);
+  }
+
+  if (is_stopped) {
+    connection->CloseParked();
+    return;
+  }
+  poller_.Interrupt();
+}
+
+void ConnectionParking::Run() {
+  std::unordered_map<int, std::shared_ptr<Connection>> parked;
+  std::vector<std::shared_ptr<Connection>> connections;
+
+  const auto resume = [&](auto it) {
+    poller_.Remove(it->first);
+    auto connection = std::move(it->second);
+    parked.erase(it);
+    connection->Start();
+  };
+
+  engine::io::Poller::Event event;
+  auto check_deadline = engine::Deadline::FromDuration(kKeepaliveCheckInterval);
+  for (;;) {
+    const auto status = poller_.NextEvent(event, check_deadline);
+    if (engine::current_task::ShouldCancel()) break;
+
+    if (status == engine::io::Poller::Status::kNoEvents) {
+      // restarted connections close themselves on the expired timeout
+      for (auto it = parked.begin(); it != parked.end();) {
+        auto next = std::next(it);
+        if (it->second->IsKeepaliveExpired()) resume(it);
+        it = next;
+      }
+      check_deadline = engine::Deadline::FromDuration(kKeepaliveCheckInterval);
+      continue;
+    }
+
+    if (status == engine::io::Poller::Status::kInterrupt) {
+      {
+        auto to_park = to_park_.Lock();
+        to_park->connections.swap(connections);
+      }
+      for (auto& connection : connections) {
+        const auto fd = connection->Fd();
+        poller_.Add(fd, engine::io::Poller::Event::kRead);
+        parked.emplace(fd, std::move(connection));
+      }
+      connections.clear();
+      continue;
+    }
+
+    const auto it = parked.find(event.fd);
+    if (it != parked.end()) resume(it);
+  }
+
+  {
+    auto to_park = to_park_.Lock();
+    to_park->is_stopped = true;
+    to_park->connections.swap(connections);
+  }
+  LOG_TRACE() << "Closing " << parked.size() + connections.size()
+              << " parked connections";
+  for (auto& [fd, connection] : parked) {
+    poller_.Remove(fd);
+    connection->CloseParked();
+  }
+  for (auto& connection : connections) connection->CloseParked();
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
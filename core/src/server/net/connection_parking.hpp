@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <engine/io/poller.hpp>
+#include <userver/concurrent/variable.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+class Connection;
+
+// Keeps the idle keep-alive connections that have released their coroutines
+// and restarts a connection once its socket becomes readable or its
+// keepalive_timeout expires. A single task waits on all the parked sockets.
+class ConnectionParking final {
+ public:
+  ConnectionParking();
+  ~ConnectionParking();
+
+  // Called by a connection that has no running tasks. The connection is
+  // closed if the parking has already stopped.
+  void Park(std::shared_ptr<Connection> connection);
+
+  // Runs until the current task is cancelled, then closes all the parked
+  // connections
+  void Run();
+
+ private:
+  struct ToPark {
+    std::vector<std::shared_ptr<Connection>> connections;
+    bool is_stopped{false};
+  };
+
+  engine::io::Poller poller_;
+  concurrent::Variable<ToPark> to_park_;
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
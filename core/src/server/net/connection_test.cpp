@@ -1,10 +1,13 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/http/request_handler_base.hpp>
+#include <server/net/connection_parking.hpp>
 #include <server/net/create_socket.hpp>
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
@@ -282,6 +285,198 @@ UTEST(ServerNetConnection, KeepAlive) {
   EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST(ServerNetConnection, PipelinedInFlightLimit) {
+  constexpr std::size_t kPipelinedRequests = 3;
+  constexpr std::string_view kRequest =
+      "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  constexpr std::string_view kResponseStart = "HTTP/1.1 404";
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.max_in_flight_requests = 1;
+  auto request_socket = net::CreateSocket(config);
+
+  const auto addr = request_socket.Getsockname();
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, deadline);
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto connection_ptr = net::Connection::Create(
+      engine::current_task::GetTaskProcessor(), config.connection_config,
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+  connection_ptr->Start();
+
+  std::string requests;
+  for (std::size_t i = 0; i < kPipelinedRequests; ++i) requests += kRequest;
+  ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline),
+            requests.size());
+
+  std::string responses;
+  std::size_t responses_count = 0;
+  while (responses_count < kPipelinedRequests) {
+    std::array<char, 4096> buf{};
+    const auto received = client.RecvSome(buf.data(), buf.size(), deadline);
+    ASSERT_NE(received, 0);
+    responses.append(buf.data(), received);
+
+    responses_count = 0;
+    for (auto pos = responses.find(kResponseStart); pos != std::string::npos;
+         pos = responses.find(kResponseStart, pos + 1)) {
+      ++responses_count;
+    }
+  }
+
+  EXPECT_EQ(responses_count, kPipelinedRequests);
+  EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+  EXPECT_EQ(stats->max_connection_in_flight_requests, 1);
+  EXPECT_GE(stats->in_flight_limit_reached, 1);
+}
+
+UTEST(ServerNetConnection, TotalPendingBytesLimit) {
+  constexpr std::string_view kRequest =
+      "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  constexpr std::string_view kResponseStart = "HTTP/1.1 404";
+  constexpr std::size_t kOtherResponsesSize = 1024;
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.max_total_pending_response_bytes =
+      kOtherResponsesSize;
+  auto request_socket = net::CreateSocket(config);
+
+  const auto addr = request_socket.Getsockname();
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, deadline);
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  // Responses of the other connections that are not sent yet
+  const auto other_responses_time = std::chrono::steady_clock::now();
+  data_accounter.StartRequest(kOtherResponsesSize, other_responses_time);
+
+  auto connection_ptr = net::Connection::Create(
+      engine::current_task::GetTaskProcessor(), config.connection_config,
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+  connection_ptr->Start();
+
+  ASSERT_EQ(client.SendAll(kRequest.data(), kRequest.size(), deadline),
+            kRequest.size());
+
+  std::array<char, 4096> buf{};
+  EXPECT_FALSE(client.WaitReadable(
+      Deadline::FromDuration(std::chrono::milliseconds{100})));
+  EXPECT_EQ(handler.asyncs_finished, 0);
+  EXPECT_EQ(stats->total_pending_bytes_limit_reached, 1);
+  EXPECT_EQ(stats->paused_connections, 1);
+
+  data_accounter.StopRequest(kOtherResponsesSize, other_responses_time);
+
+  const auto received = client.RecvSome(buf.data(), buf.size(), deadline);
+  ASSERT_NE(received, 0);
+  EXPECT_EQ(std::string_view(buf.data(), received).substr(
+                0, kResponseStart.size()),
+            kResponseStart);
+  EXPECT_EQ(handler.asyncs_finished, 1);
+  EXPECT_EQ(stats->paused_connections, 0);
+  EXPECT_EQ(stats->pending_bytes_limit_reached, 0);
+}
+
+UTEST(ServerNetConnection, Http2PriorKnowledge) {
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.http2.enabled = true;
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+  const auto create_request = [&] {
+    return http_client_ptr->CreateRequest()
+        .get(HttpConnectionUriFromSocket(request_socket))
+        .http_version(clients::http::HttpVersion::k2PriorKnowledge)
+        .retry(1)
+        .timeout(utest::kMaxTestWaitTime)
+        .async_perform();
+  };
+  auto request = create_request();
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto connection_ptr = net::Connection::Create(
+      engine::current_task::GetTaskProcessor(), config.connection_config,
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+
+  connection_ptr->Start();
+  EXPECT_EQ(request.Get()->status_code(), 404);
+
+  request = create_request();
+  EXPECT_EQ(request.Get()->status_code(), 404);
+  EXPECT_EQ(stats->http2_stats.connections, 1);
+  EXPECT_EQ(stats->http2_stats.streams_opened, 2);
+  EXPECT_EQ(stats->http2_stats.streams_reset, 0);
+}
+
+UTEST(ServerNetConnection, IdleParking) {
+  constexpr std::string_view kRequest =
+      "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  constexpr std::string_view kResponseStart = "HTTP/1.1 404";
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.idle_park_timeout = std::chrono::milliseconds{10};
+  auto request_socket = net::CreateSocket(config);
+
+  const auto addr = request_socket.Getsockname();
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, deadline);
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto parking = std::make_shared<net::ConnectionParking>();
+  auto parking_task = engine::AsyncNoSpan([parking] { parking->Run(); });
+
+  auto connection_ptr = net::Connection::Create(
+      engine::current_task::GetTaskProcessor(), config.connection_config,
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+  connection_ptr->SetParking(parking);
+  connection_ptr->Start();
+
+  for (std::size_t i = 1; i <= 2; ++i) {
+    ASSERT_EQ(client.SendAll(kRequest.data(), kRequest.size(), deadline),
+              kRequest.size());
+
+    std::array<char, 4096> buf{};
+    const auto received = client.RecvSome(buf.data(), buf.size(), deadline);
+    ASSERT_NE(received, 0);
+    EXPECT_EQ(std::string_view(buf.data(), received).substr(
+                  0, kResponseStart.size()),
+              kResponseStart);
+    EXPECT_EQ(handler.asyncs_finished, i);
+
+    while (stats->parked_connections == 0) engine::Yield();
+  }
+
+  parking_task.SyncCancel();
+  EXPECT_EQ(stats->parked_connections, 0);
+  EXPECT_EQ(stats->active_connections, 0);
+  EXPECT_EQ(stats->connections_closed, 1);
+}
+
 UTEST(ServerNetConnection, CancelMultipleInFlight) {
   constexpr std::size_t kInFlightRequests = 10;
   constexpr std::size_t kMaxAttempts = 10;
@@ -1,14 +1,23 @@
 #include "create_socket.hpp"
 
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <system_error>
@@ -21,12 +30,84 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
 namespace {
+
+// The systemd socket activation protocol: the service manager passes the
+// listening sockets starting from this descriptor, their count is in the
+// LISTEN_FDS environment variable
+constexpr int kListenFdsStart = 3;
+
+int GetInheritedSocketsCount() {
+  const char* listen_pid = std::getenv("LISTEN_PID");
+  const char* listen_fds = std::getenv("LISTEN_FDS");
+  if (!listen_pid || !listen_fds) return 0;
+
+  // The variables are meant for some other process that we were forked from
+  if (std::strtol(listen_pid, nullptr, 10) != ::getpid()) return 0;
+  return std::max(0, static_cast<int>(std::strtol(listen_fds, nullptr, 10)));
+}
+
+bool IsListeningStreamSocket(int fd) {
+  int value = 0;
+  socklen_t len = sizeof(value);
+  if (::getsockopt(fd, SOL_SOCKET, SO_ACCEPTCONN, &value, &len) == -1 ||
+      !value) {
+    return false;
+  }
+  len = sizeof(value);
+  return ::getsockopt(fd, SOL_SOCKET, SO_TYPE, &value, &len) != -1 &&
+         value == SOCK_STREAM;
+}
+
+bool IsSocketFor(const engine::io::Sockaddr& addr,
+                 const ListenerConfig& config) {
+  switch (addr.Domain()) {
+    case engine::io::AddrDomain::kUnix:
+      return !config.unix_socket_path.empty() &&
+             config.unix_socket_path == addr.As<struct sockaddr_un>()->sun_path;
+    case engine::io::AddrDomain::kInet:
+    case engine::io::AddrDomain::kInet6:
+      return config.unix_socket_path.empty() && addr.Port() == config.port;
+    default:
+      return false;
+  }
+}
+
+// Looks for a listening socket for the `config` among the ones passed by the
+// service manager, the service manager keeps the socket open and accepting
+// connections while the service restarts. Each call returns a duplicate of
+// the inherited socket, so all the listener shards share it.
+std::optional<engine::io::Socket> TryAdoptInheritedSocket(
+    const ListenerConfig& config) {
+  const auto fds_count = GetInheritedSocketsCount();
+  for (int fd = kListenFdsStart; fd < kListenFdsStart + fds_count; ++fd) {
+    if (!IsListeningStreamSocket(fd)) continue;
+
+    engine::io::Sockaddr addr;
+    auto len = addr.Capacity();
+    if (::getsockname(fd, addr.Data(), &len) == -1) continue;
+    if (!IsSocketFor(addr, config)) continue;
+
+    // Do not leak the inherited socket into the child processes
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    const auto dup_fd = utils::CheckSyscall(
+        ::fcntl(fd, F_DUPFD_CLOEXEC, 0), "duplicating inherited socket fd={}",
+        fd);
+    LOG_INFO() << "Using the inherited listening socket fd=" << fd
+               << " for " << addr;
+    return engine::io::Socket{dup_fd, addr.Domain()};
+  }
+  return std::nullopt;
+}
+
 engine::io::Socket CreateUnixSocket(const std::string& path, int backlog) {
   engine::io::Sockaddr addr;
   auto* sa = addr.As<struct sockaddr_un>();
@@ -76,12 +157,44 @@ engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog) {
 }  // namespace
 
 engine::io::Socket CreateSocket(const ListenerConfig& config) {
+  // CPU steering needs a separate socket for each shard
+  if (!config.reuseport_cpu_steering) {
+    if (auto socket = TryAdoptInheritedSocket(config)) {
+      return std::move(*socket);
+    }
+  }
+
   if (config.unix_socket_path.empty())
     return CreateIpv6Socket(config.port, config.backlog);
   else
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
 }
 
+void AttachReuseportCpuSteering(engine::io::Socket& socket,
+                                std::size_t sockets_count) {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  // A = current_cpu; A %= sockets_count; return A;
+  std::array<sock_filter, 3> code{{
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0,
+       static_cast<std::uint32_t>(sockets_count)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  }};
+  sock_fprog program{static_cast<unsigned short>(code.size()), code.data()};
+
+  utils::CheckSyscall(
+      ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program,
+                   sizeof(program)),
+      "attaching SO_REUSEPORT CPU steering program");
+#else
+  (void)socket;
+  (void)sockets_count;
+  throw std::runtime_error(
+      "SO_REUSEPORT CPU steering is not supported on this platform");
+#endif
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <server/net/listener_config.hpp>
 #include <userver/engine/io/socket.hpp>
 
@@ -7,8 +9,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+// Creates a new listening socket, or adopts a matching one passed by the
+// service manager using the systemd socket activation protocol
+// (LISTEN_PID and LISTEN_FDS environment variables).
 engine::io::Socket CreateSocket(const ListenerConfig& config);
 
+// Makes the kernel pass a new connection of the SO_REUSEPORT group to the
+// socket number `cpu % sockets_count`, `cpu` being the CPU that processed the
+// incoming SYN. Linux only.
+void AttachReuseportCpuSteering(engine::io::Socket& socket,
+                                std::size_t sockets_count);
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
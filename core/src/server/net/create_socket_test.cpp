@@ -0,0 +1,42 @@
+#include <server/net/create_socket.hpp>
+
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kShards = 2;
+
+}  // namespace
+
+UTEST(ServerNetCreateSocket, ReuseportCpuSteering) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::net::ListenerConfig config;
+  auto first = server::net::CreateSocket(config);
+  config.port = first.Getsockname().Port();
+  auto second = server::net::CreateSocket(config);
+  server::net::AttachReuseportCpuSteering(first, kShards);
+
+  auto addr = first.Getsockname();
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, deadline);
+
+  // The connection goes to the socket selected by the CPU of the SYN
+  bool is_accepted = false;
+  while (!is_accepted && !deadline.IsReached()) {
+    for (auto* socket : {&first, &second}) {
+      const auto poll_deadline =
+          engine::Deadline::FromDuration(std::chrono::milliseconds{10});
+      if (socket->WaitReadable(poll_deadline)) {
+        is_accepted = socket->Accept(deadline).IsValid();
+        break;
+      }
+    }
+  }
+  EXPECT_TRUE(is_accepted);
+}
+
+USERVER_NAMESPACE_END
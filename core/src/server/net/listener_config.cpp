@@ -21,6 +21,8 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   config.max_connections =
       value["max_connections"].As<size_t>(config.max_connections);
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+  config.reuseport_cpu_steering =
+      value["reuseport_cpu_steering"].As<bool>(config.reuseport_cpu_steering);
   config.task_processor = value["task_processor"].As<std::string>();
   config.backlog = value["backlog"].As<int>(config.backlog);
 
@@ -32,6 +34,12 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
     throw std::runtime_error(
         "Either non-zero 'port' or non-empty 'unix-socket' fields must be set");
 
+  if (config.reuseport_cpu_steering && !config.unix_socket_path.empty()) {
+    throw std::runtime_error(
+        "'reuseport_cpu_steering' is not applicable to unix sockets in " +
+        value.GetPath());
+  }
+
   if (config.backlog <= 0) {
     throw std::runtime_error("Invalid backlog value in " + value.GetPath());
   }
@@ -22,6 +22,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+engine::io::Socket CreateListenerSocket(const EndpointInfo& endpoint_info) {
+  auto socket = CreateSocket(endpoint_info.listener_config);
+  if (endpoint_info.listener_config.reuseport_cpu_steering) {
+    // The program is shared by the SO_REUSEPORT group, attaching it to every
+    // socket keeps it in place whichever sockets are closed
+    AttachReuseportCpuSteering(socket, endpoint_info.listener_shards);
+  }
+  return socket;
+}
+
+}  // namespace
+
 ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
                            std::shared_ptr<EndpointInfo> endpoint_info,
                            request::ResponseDataAccounter& data_accounter)
@@ -46,13 +60,24 @@ ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
               }
             }
           },
-          CreateSocket(endpoint_info_->listener_config))) {}
+          CreateListenerSocket(*endpoint_info_))) {
+  if (endpoint_info_->listener_config.connection_config.idle_park_timeout) {
+    connection_parking_ = std::make_shared<ConnectionParking>();
+    connection_parking_task_ = engine::CriticalAsyncNoSpan(
+        task_processor_,
+        [parking = connection_parking_] { parking->Run(); });
+  }
+}
 
 ListenerImpl::~ListenerImpl() {
   LOG_TRACE() << "Stopping socket listener task";
   socket_listener_task_.SyncCancel();
   LOG_TRACE() << "Stopped socket listener task";
 
+  if (connection_parking_task_.IsValid()) {
+    // closes the parked connections and the ones parked later on
+    connection_parking_task_.SyncCancel();
+  }
   CloseConnections();
 }
 
@@ -97,6 +122,7 @@ void ListenerImpl::SetupConnection(engine::io::Socket peer_socket) {
   connection_ptr->SetCloseCb([endpoint_info = endpoint_info_]() {
     --endpoint_info->connection_count;
   });
+  if (connection_parking_) connection_ptr->SetParking(connection_parking_);
 
   AddConnection(connection_ptr);
 
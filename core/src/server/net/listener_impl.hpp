@@ -10,6 +10,7 @@
 #include <userver/engine/task/task_with_result.hpp>
 
 #include "connection.hpp"
+#include "connection_parking.hpp"
 #include "endpoint_info.hpp"
 #include "stats.hpp"
 
@@ -45,6 +46,10 @@ class ListenerImpl final {
 
   engine::TaskWithResult<void> socket_listener_task_;
 
+  // Engaged if connection.idle_park_timeout is set
+  std::shared_ptr<ConnectionParking> connection_parking_;
+  engine::TaskWithResult<void> connection_parking_task_;
+
   // connections_ are added in socket_listener_task_ and removed
   // in ~ListenerImpl(), no synchronization required
   std::vector<std::weak_ptr<Connection>> connections_;
@@ -4,17 +4,20 @@
 #include <cstddef>
 #include <vector>
 
+#include <userver/utils/atomic.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
 struct ParserStats {
   ParserStats(const ParserStats& other)
-      : parsing_request_count(other.parsing_request_count.load()) {}
+      : parsing_request_count(other.parsing_request_count) {}
 
   ParserStats() = default;
 
-  std::atomic<size_t> parsing_request_count{0};
+  utils::statistics::ShardedRelaxedCounter<size_t> parsing_request_count;
 };
 
 inline ParserStats& operator+=(ParserStats& lhs, const ParserStats& rhs) {
@@ -22,14 +25,48 @@ inline ParserStats& operator+=(ParserStats& lhs, const ParserStats& rhs) {
   return lhs;
 }
 
+struct Http2Stats {
+  Http2Stats(const Http2Stats& other)
+      : connections(other.connections.load()),
+        streams_opened(other.streams_opened.load()),
+        streams_reset(other.streams_reset.load()),
+        flow_control_stalls(other.flow_control_stalls.load()) {}
+
+  Http2Stats() = default;
+
+  std::atomic<size_t> connections{0};
+  std::atomic<size_t> streams_opened{0};
+  // closed with an error code by either side
+  std::atomic<size_t> streams_reset{0};
+  // times a response had to wait for a WINDOW_UPDATE from the peer
+  std::atomic<size_t> flow_control_stalls{0};
+};
+
+inline Http2Stats& operator+=(Http2Stats& lhs, const Http2Stats& rhs) {
+  lhs.connections += rhs.connections;
+  lhs.streams_opened += rhs.streams_opened;
+  lhs.streams_reset += rhs.streams_reset;
+  lhs.flow_control_stalls += rhs.flow_control_stalls;
+  return lhs;
+}
+
 struct Stats {
   Stats(const Stats& other)
       : active_connections(other.active_connections.load()),
         connections_created(other.connections_created.load()),
         connections_closed(other.connections_closed.load()),
+        paused_connections(other.paused_connections.load()),
+        parked_connections(other.parked_connections.load()),
+        pending_bytes_limit_reached(other.pending_bytes_limit_reached.load()),
+        total_pending_bytes_limit_reached(
+            other.total_pending_bytes_limit_reached.load()),
         parser_stats(other.parser_stats),
-        active_request_count(other.active_request_count.load()),
-        requests_processed_count(other.requests_processed_count.load()) {}
+        active_request_count(other.active_request_count),
+        requests_processed_count(other.requests_processed_count),
+        in_flight_limit_reached(other.in_flight_limit_reached.load()),
+        max_connection_in_flight_requests(
+            other.max_connection_in_flight_requests.load()),
+        http2_stats(other.http2_stats) {}
 
   Stats() = default;
 
@@ -37,21 +74,46 @@ struct Stats {
   std::atomic<size_t> active_connections{0};
   std::atomic<size_t> connections_created{0};
   std::atomic<size_t> connections_closed{0};
-
-  // per connection
+  // connections not read while their responses are pending
+  std::atomic<size_t> paused_connections{0};
+  // idle connections without coroutines, see ConnectionParking
+  std::atomic<size_t> parked_connections{0};
+  // times a connection stopped reading because of max_pending_response_bytes
+  std::atomic<size_t> pending_bytes_limit_reached{0};
+  // times a connection stopped reading because of
+  // max_total_pending_response_bytes
+  std::atomic<size_t> total_pending_bytes_limit_reached{0};
+
+  // per connection, updated by each request so sharded to not bounce a cache
+  // line between the workers
   ParserStats parser_stats;
-  std::atomic<size_t> active_request_count{0};
-  std::atomic<size_t> requests_processed_count{0};
+  utils::statistics::ShardedRelaxedCounter<size_t> active_request_count;
+  utils::statistics::ShardedRelaxedCounter<size_t> requests_processed_count;
+  // times a connection stopped reading because of max_in_flight_requests
+  std::atomic<size_t> in_flight_limit_reached{0};
+  // high-water mark of requests in flight on a single connection
+  std::atomic<size_t> max_connection_in_flight_requests{0};
+
+  Http2Stats http2_stats;
 };
 
 inline Stats& operator+=(Stats& lhs, const Stats& rhs) {
   lhs.active_connections += rhs.active_connections;
   lhs.connections_created += rhs.connections_created;
   lhs.connections_closed += rhs.connections_closed;
+  lhs.paused_connections += rhs.paused_connections;
+  lhs.parked_connections += rhs.parked_connections;
+  lhs.pending_bytes_limit_reached += rhs.pending_bytes_limit_reached;
+  lhs.total_pending_bytes_limit_reached +=
+      rhs.total_pending_bytes_limit_reached;
 
   lhs.parser_stats += rhs.parser_stats;
   lhs.active_request_count += rhs.active_request_count;
   lhs.requests_processed_count += rhs.requests_processed_count;
+  lhs.in_flight_limit_reached += rhs.in_flight_limit_reached;
+  utils::AtomicMax(lhs.max_connection_in_flight_requests,
+                   rhs.max_connection_in_flight_requests.load());
+  lhs.http2_stats += rhs.http2_stats;
   return lhs;
 }
 
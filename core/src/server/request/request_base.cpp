@@ -1,12 +1,16 @@
 #include <userver/server/request/request_base.hpp>
 
+#include <server/requests_view.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
 
 RequestBase::RequestBase() : start_time_(std::chrono::steady_clock::now()) {}
 
-RequestBase::~RequestBase() = default;
+RequestBase::~RequestBase() {
+  if (view_shard_) RequestsView::Unregister(*this);
+}
 
 void RequestBase::SetTaskCreateTime() {
   task_create_time_ = std::chrono::steady_clock::now();
@@ -1,93 +1,70 @@
 #include <server/requests_view.hpp>
-#include <userver/engine/async.hpp>
-#include <userver/engine/sleep.hpp>
-#include <userver/engine/task/cancel.hpp>
 
-USERVER_NAMESPACE_BEGIN
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 
-namespace {
-const auto kDequeueBulkSize = 10000;
-const auto kDequeuePollPeriod = std::chrono::milliseconds(100);
-}  // namespace
+USERVER_NAMESPACE_BEGIN
 
 namespace server {
 
-RequestsView::RequestsView()
-    : queue_(std::make_shared<Queue>()), job_requests(kDequeueBulkSize) {}
-
-RequestsView::~RequestsView() { StopBackgroundWorker(); }
-
-std::vector<std::shared_ptr<request::RequestBase>>
-RequestsView::GetAllRequests() {
-  std::vector<std::shared_ptr<request::RequestBase>> result;
-
-  // Move all to-be-deleted items into delete_list
-  // to avoid deletion under mutex.
-  std::list<RequestWPtr> delete_list;
-
-  {
-    std::lock_guard<engine::Mutex> lock(requests_in_flight_mutex_);
-    result.reserve(requests_in_flight_.size());
-
-    for (auto it = requests_in_flight_.begin();
-         it != requests_in_flight_.end();) {
-      auto ptr = it->lock();
-      if (!ptr) {
-        auto old = it++;
-        delete_list.splice(delete_list.begin(), requests_in_flight_, old);
-        continue;
-      }
-
-      result.push_back(std::move(ptr));
-      ++it;
+RequestsView::~RequestsView() {
+  // The requests should be gone with the connections, detach the leftovers
+  for (auto& shard : shards_) {
+    const std::lock_guard lock{shard->mutex};
+    for (auto* request = shard->head; request;) {
+      auto* next = request->view_next_;
+      request->view_shard_ = nullptr;
+      request->view_prev_ = request->view_next_ = nullptr;
+      request = next;
     }
+    shard->head = nullptr;
   }
-
-  return result;
 }
 
-void RequestsView::StartBackgroundWorker() {
-  job_task_ = engine::CriticalAsyncNoSpan([this]() { DoJob(); });
+void RequestsView::Register(
+    const std::shared_ptr<request::RequestBase>& request) {
+  UASSERT(request);
+  UASSERT(!request->view_shard_);
+  auto& shard = *shards_[utils::statistics::impl::GetThreadShardIndex() %
+                         kShardsCount];
+  request->view_self_ = request;
+
+  const std::lock_guard lock{shard.mutex};
+  request->view_shard_ = &shard;
+  request->view_next_ = shard.head;
+  if (shard.head) shard.head->view_prev_ = request.get();
+  shard.head = request.get();
+  ++shard.size;
 }
 
-void RequestsView::StopBackgroundWorker() { job_task_.SyncCancel(); }
+void RequestsView::Unregister(request::RequestBase& request) noexcept {
+  auto& shard = *request.view_shard_;
 
-void RequestsView::GarbageCollect() {
-  // Move all to-be-deleted items into delete_list
-  // to avoid deletion under mutex.
-  std::list<RequestWPtr> delete_list;
-
-  std::lock_guard<engine::Mutex> lock(requests_in_flight_mutex_);
-  for (auto it = requests_in_flight_.begin();
-       it != requests_in_flight_.end();) {
-    if (!it->expired()) {
-      ++it;
-      continue;
-    }
-
-    auto old = it++;
-    delete_list.splice(delete_list.begin(), requests_in_flight_, old);
-  }
-}
-
-void RequestsView::HandleQueue() {
-  std::lock_guard<engine::Mutex> lock(requests_in_flight_mutex_);
-  for (;;) {
-    const auto count =
-        queue_->try_dequeue_bulk(job_requests.begin(), job_requests.size());
-    if (count == 0) break;
-
-    for (size_t i = 0; i < count; ++i)
-      requests_in_flight_.push_back(std::move(job_requests[i]));
+  const std::lock_guard lock{shard.mutex};
+  if (request.view_prev_) {
+    request.view_prev_->view_next_ = request.view_next_;
+  } else {
+    shard.head = request.view_next_;
   }
+  if (request.view_next_) request.view_next_->view_prev_ = request.view_prev_;
+  request.view_shard_ = nullptr;
+  --shard.size;
 }
 
-void RequestsView::DoJob() {
-  while (!engine::current_task::ShouldCancel()) {
-    GarbageCollect();
-    HandleQueue();
-    engine::InterruptibleSleepFor(kDequeuePollPeriod);
+std::vector<std::shared_ptr<request::RequestBase>>
+RequestsView::GetAllRequests() const {
+  std::vector<std::shared_ptr<request::RequestBase>> result;
+  for (auto& shard : shards_) {
+    const std::lock_guard lock{shard->mutex};
+    result.reserve(result.size() + shard->size);
+    // The requests being destroyed are still linked, but can't be locked
+    for (auto* request = shard->head; request; request = request->view_next_) {
+      if (auto ptr = request->view_self_.lock()) {
+        result.push_back(std::move(ptr));
+      }
+    }
   }
+  return result;
 }
 
 }  // namespace server
@@ -1,46 +1,54 @@
 #pragma once
 
-#include <list>
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <vector>
 
-#include <moodycamel/concurrentqueue.h>
-#include <userver/engine/mutex.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/server/request/request_base.hpp>
-#include <userver/utils/periodic_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server {
 
+namespace impl {
+
+struct RequestsViewShard final {
+  std::mutex mutex;
+  request::RequestBase* head{nullptr};
+  std::size_t size{0};
+};
+
+}  // namespace impl
+
+/// Requests in flight for the InspectRequests handler.
+///
+/// A request is linked into the intrusive list of the shard of the current
+/// thread and unlinks itself on destruction. So the registration takes an
+/// uncontended lock and allocates nothing, and there is no background work.
 class RequestsView final {
  public:
-  RequestsView();
+  RequestsView() = default;
   ~RequestsView();
 
-  using RequestWPtr = std::weak_ptr<request::RequestBase>;
-  using Queue = moodycamel::ConcurrentQueue<RequestWPtr>;
+  RequestsView(const RequestsView&) = delete;
+  RequestsView& operator=(const RequestsView&) = delete;
 
-  std::shared_ptr<Queue> GetQueue() { return queue_; }
+  void Register(const std::shared_ptr<request::RequestBase>& request);
 
-  std::vector<std::shared_ptr<request::RequestBase>> GetAllRequests();
+  std::vector<std::shared_ptr<request::RequestBase>> GetAllRequests() const;
 
-  void StartBackgroundWorker();
-
-  void StopBackgroundWorker();
+  /// Called by the request on destruction
+  static void Unregister(request::RequestBase& request) noexcept;
 
  private:
-  void DoJob();
-
-  void GarbageCollect();
-
-  void HandleQueue();
+  static constexpr std::size_t kShardsCount = 8;
 
-  std::shared_ptr<Queue> queue_;
-  engine::TaskWithResult<void> job_task_;
-  std::vector<RequestWPtr> job_requests;
+  using Shard = concurrent::impl::InterferenceShield<impl::RequestsViewShard>;
 
-  engine::Mutex requests_in_flight_mutex_;
-  std::list<RequestWPtr> requests_in_flight_;
+  mutable std::array<Shard, kShardsCount> shards_{};
 };
 
 }  // namespace server
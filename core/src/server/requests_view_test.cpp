@@ -0,0 +1,72 @@
+#include <server/requests_view.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <server/http/http_request_impl.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::shared_ptr<server::request::RequestBase> MakeRequest(
+    server::request::ResponseDataAccounter& accounter) {
+  return std::make_shared<server::http::HttpRequestImpl>(accounter);
+}
+
+}  // namespace
+
+UTEST(RequestsView, RegisterUnregister) {
+  server::request::ResponseDataAccounter accounter;
+  server::RequestsView view;
+  EXPECT_TRUE(view.GetAllRequests().empty());
+
+  auto first = MakeRequest(accounter);
+  auto second = MakeRequest(accounter);
+  auto third = MakeRequest(accounter);
+  view.Register(first);
+  view.Register(second);
+  view.Register(third);
+  EXPECT_EQ(view.GetAllRequests().size(), 3);
+
+  second.reset();
+  auto requests = view.GetAllRequests();
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_TRUE((requests[0] == first && requests[1] == third) ||
+              (requests[0] == third && requests[1] == first));
+
+  // The requests got from the view are unregistered once they are released
+  first.reset();
+  third.reset();
+  EXPECT_EQ(view.GetAllRequests().size(), 2);
+  requests.clear();
+  EXPECT_TRUE(view.GetAllRequests().empty());
+}
+
+UTEST_MT(RequestsView, Concurrent, 4) {
+  server::request::ResponseDataAccounter accounter;
+  server::RequestsView view;
+  auto kept = MakeRequest(accounter);
+  view.Register(kept);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 4; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      for (int j = 0; j < 1000; ++j) {
+        auto request = MakeRequest(accounter);
+        view.Register(request);
+        EXPECT_FALSE(view.GetAllRequests().empty());
+      }
+    }));
+  }
+  engine::GetAll(tasks);
+
+  const auto requests = view.GetAllRequests();
+  ASSERT_EQ(requests.size(), 1);
+  EXPECT_EQ(requests[0], kept);
+}
+
+USERVER_NAMESPACE_END
@@ -63,6 +63,8 @@ void PortInfo::Init(const ServerConfig& config,
   size_t listener_shards = listener_config.shards ? *listener_config.shards
                                                   : event_thread_pool.GetSize();
 
+  endpoint_info_->listener_shards = listener_shards;
+
   listeners_.reserve(listener_shards);
   while (listener_shards--) {
     listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
@@ -132,6 +134,9 @@ class ServerImpl final {
   void SetRpsRatelimit(std::optional<size_t> rps);
 
  private:
+  // Outlives the requests of the listeners
+  RequestsView requests_view_{};
+
   PortInfo main_port_info_;
   PortInfo monitor_port_info_;
 
@@ -141,7 +146,6 @@ class ServerImpl final {
   bool is_stopping_{false};
 
   std::atomic<bool> has_requests_view_watchers_{false};
-  RequestsView requests_view_{};
 
   const ServerConfig config_;
 };
@@ -170,10 +174,8 @@ void ServerImpl::StartPortInfos() {
   UASSERT(main_port_info_.request_handler_);
 
   if (has_requests_view_watchers_.load()) {
-    auto queue = requests_view_.GetQueue();
-    requests_view_.StartBackgroundWorker();
-    auto hook = [queue](std::shared_ptr<request::RequestBase> request) {
-      queue->enqueue(request);
+    auto hook = [this](std::shared_ptr<request::RequestBase> request) {
+      requests_view_.Register(request);
     };
     main_port_info_.request_handler_->SetNewRequestHook(hook);
     if (monitor_port_info_.request_handler_) {
@@ -323,6 +325,12 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     conn_stats["active"] = server_stats.active_connections;
     conn_stats["opened"] = server_stats.connections_created;
     conn_stats["closed"] = server_stats.connections_closed;
+    conn_stats["paused"] = server_stats.paused_connections;
+    conn_stats["parked"] = server_stats.parked_connections;
+    conn_stats["pending-bytes-limit-reached"] =
+        server_stats.pending_bytes_limit_reached;
+    conn_stats["total-pending-bytes-limit-reached"] =
+        server_stats.total_pending_bytes_limit_reached;
   }
 
   if (auto request_stats = writer["requests"]) {
@@ -330,6 +338,18 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     request_stats["avg-lifetime-ms"] = pimpl->GetAvgRequestTimeMs().count();
     request_stats["processed"] = server_stats.requests_processed_count;
     request_stats["parsing"] = server_stats.parser_stats.parsing_request_count;
+    request_stats["in-flight-limit-reached"] =
+        server_stats.in_flight_limit_reached;
+    request_stats["max-in-flight-per-connection"] =
+        server_stats.max_connection_in_flight_requests;
+  }
+
+  if (auto http2_stats = writer["http2"]) {
+    http2_stats["connections"] = server_stats.http2_stats.connections;
+    http2_stats["streams-opened"] = server_stats.http2_stats.streams_opened;
+    http2_stats["streams-reset"] = server_stats.http2_stats.streams_reset;
+    http2_stats["flow-control-stalls"] =
+        server_stats.http2_stats.flow_control_stalls;
   }
 }
 
@@ -1,6 +1,7 @@
 #include <userver/tracing/scope_time.hpp>
 
 #include <userver/tracing/span.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 
 #include <tracing/time_storage.hpp>
 
@@ -27,7 +28,7 @@ ScopeTime::~ScopeTime() { Reset(); }
 ScopeTime::Duration ScopeTime::Reset() {
   if (scope_name_.empty()) return ScopeTime::Duration(0);
 
-  const auto duration = std::chrono::steady_clock::now() - start_;
+  const auto duration = utils::impl::FastSteadyNow() - start_;
   ts_.PushLap(scope_name_, duration);
   scope_name_.clear();
   return duration;
@@ -36,7 +37,7 @@ ScopeTime::Duration ScopeTime::Reset() {
 ScopeTime::Duration ScopeTime::Reset(std::string scope_name) {
   auto result = Reset();
   scope_name_ = std::move(scope_name);
-  start_ = std::chrono::steady_clock::now();
+  start_ = utils::impl::FastSteadyNow();
   return result;
 }
 
@@ -44,7 +45,7 @@ void ScopeTime::Discard() { scope_name_.clear(); }
 
 ScopeTime::Duration ScopeTime::DurationSinceReset() const {
   if (scope_name_.empty()) return ScopeTime::Duration{0};
-  return std::chrono::steady_clock::now() - start_;
+  return utils::impl::FastSteadyNow() - start_;
 }
 
 ScopeTime::Duration ScopeTime::DurationTotal(
@@ -1,19 +1,25 @@
 #include <tracing/span_impl.hpp>
 
+#include <cstring>
 #include <type_traits>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
+#include <boost/container/small_vector.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
 #include <logging/log_helper_impl.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 #include <utils/internal_tag.hpp>
@@ -65,12 +71,33 @@ std::string_view StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
-std::string GenerateSpanId() {
-  std::uniform_int_distribution<std::uint64_t> dist;
-  auto random_value = dist(utils::DefaultRandom());
+// Lets the engine::impl::CpuProfiler attribute the samples of the task to its
+// innermost span. Called on each change of the span stack, so that the label
+// never outlives the name of the span.
+void UpdateProfilerLabel(const SpanStack* spans) noexcept {
+  auto* const context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+  context->SetProfilerLabel(spans && !spans->empty()
+                                ? spans->back().GetName().c_str()
+                                : nullptr);
+}
+
+impl::TraceId GenerateTraceId() {
+  const auto uuid = utils::generators::GenerateBoostUuid();
 
-  static_assert(sizeof(random_value) == 8);
-  return utils::encoding::ToHex(&random_value, 8);
+  impl::TraceId::Binary binary;
+  static_assert(sizeof(binary) == sizeof(uuid.data));
+  std::memcpy(binary.data(), uuid.data, sizeof(binary));
+  return impl::TraceId{binary};
+}
+
+impl::SpanId GenerateSpanId() {
+  const std::uint64_t random_value = utils::Rand64();
+
+  impl::SpanId::Binary binary;
+  static_assert(sizeof(random_value) == sizeof(binary));
+  std::memcpy(binary.data(), &random_value, sizeof(binary));
+  return impl::SpanId{binary};
 }
 
 }  // namespace
@@ -89,9 +116,8 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
       log_level_(is_no_log_span_ ? logging::Level::kNone : log_level),
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
-      start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
+      start_steady_time_(utils::impl::FastSteadyNow()),
+      trace_id_(parent ? parent->trace_id_ : GenerateTraceId()),
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
@@ -100,15 +126,30 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
   }
+
+  auto* const context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (context && context->IsTimeAccounted()) {
+    task_context_ = context;
+    task_timings_at_start_ = context->GetTimings(start_steady_time_);
+  }
 }
 
 Span::Impl::~Impl() {
+  // The hook unlinks itself only after `name_` is destroyed
+  if (is_linked()) DetachFromCoroStack();
+  AccountTaskTimings();
+
   if (!ShouldLog()) {
     return;
   }
 
   {
     const DetachLocalSpansScope ignore_local_span;
+    if (auto exporter = GetSpanExporter()) {
+      exporter->Export(std::move(*this).ExtractSpanData());
+      return;
+    }
+
     logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
                           source_location_};
     std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
@@ -116,7 +157,7 @@ Span::Impl::~Impl() {
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-  const auto steady_now = std::chrono::steady_clock::now();
+  const auto steady_now = utils::impl::FastSteadyNow();
   const auto duration = steady_now - start_steady_time_;
   const auto total_time_ms =
       std::chrono::duration_cast<RealMilliseconds>(duration).count();
@@ -144,23 +185,67 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   LogOpenTracing();
 }
 
+SpanData Span::Impl::ExtractSpanData() && {
+  SpanData data;
+  data.name = name_;
+  data.trace_id = std::move(trace_id_).ExtractString();
+  data.span_id = std::move(span_id_).ExtractString();
+  data.parent_id = std::move(parent_id_).ExtractString();
+  data.reference_type = reference_type_;
+  data.log_level = log_level_;
+  data.service_name = tracer_->GetServiceName();
+  data.start_time = start_system_time_;
+  data.duration = utils::impl::FastSteadyNow() - start_steady_time_;
+
+  if (log_extra_local_) {
+    log_extra_inheritable_.Extend(std::move(*log_extra_local_));
+  }
+  data.tags.reserve(log_extra_inheritable_.extra_->size());
+  for (auto& [key, value] : *log_extra_inheritable_.extra_) {
+    data.tags.emplace_back(key, std::move(value.GetValue()));
+  }
+
+  data.timings = std::move(time_storage_).ExtractTotals();
+  return data;
+}
+
+void Span::Impl::AccountTaskTimings() const {
+  // The span may be moved to another task, its timings are meaningless then
+  if (!task_context_ ||
+      task_context_ != engine::current_task::GetCurrentTaskContextUnchecked()) {
+    return;
+  }
+
+  auto timings = task_context_->GetTimings(utils::impl::FastSteadyNow());
+  timings -= task_timings_at_start_;
+  task_context_->GetTaskProcessor().GetTaskCounter().AccountSpanTimings(
+      name_, timings);
+}
+
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   writer.ExtendLogExtra(log_extra_inheritable_);
   tracer_->LogSpanContextTo(*this, writer);
 }
 
-void Span::Impl::DetachFromCoroStack() { unlink(); }
+void Span::Impl::DetachFromCoroStack() {
+  unlink();
+  if (engine::current_task::IsTaskProcessorThread()) {
+    UpdateProfilerLabel(task_local_spans.GetOptional());
+  }
+}
 
 void Span::Impl::AttachToCoroStack() {
   UASSERT(!is_linked());
-  task_local_spans->push_back(*this);
+  auto& spans = *task_local_spans;
+  spans.push_back(*this);
+  UpdateProfilerLabel(&spans);
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+impl::SpanId Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   if (!parent) return {};
 
   if (!parent->is_linked()) {
-    return parent->GetSpanId();
+    return parent->span_id_;
   }
 
   const auto* spans_ptr = task_local_spans.GetOptional();
@@ -173,9 +258,9 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   // orphaned. It's still possible for chaining to break in case parent span
   // becomes non-loggable after child span is created, but that we can't control
   for (auto current = spans_ptr->iterator_to(*parent);; --current) {
-    if (current->GetParentId().empty() /* won't find better candidate */ ||
+    if (current->parent_id_.IsEmpty() /* won't find better candidate */ ||
         current->ShouldLog()) {
-      return current->GetSpanId();
+      return current->span_id_;
     }
     if (current == spans_ptr->begin()) break;
   };
@@ -194,7 +279,7 @@ bool Span::Impl::ShouldLog() const {
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
   if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+    DeallocateImpl(impl);
   }
 }
 
@@ -225,7 +310,7 @@ Span::Span(std::string name, ReferenceType reference_type,
                           source_location),
              Span::OptionalDeleter{OptionalDeleter::ShouldDelete()}) {
   AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
+  if (pimpl_->GetRawParentId().IsEmpty()) {
     SetLink(utils::generators::GenerateUuid());
   }
   pimpl_->span_ = this;
@@ -422,6 +507,7 @@ DetachLocalSpansScope::DetachLocalSpansScope() noexcept {
     if (auto* const spans_ptr = task_local_spans.GetOptional()) {
       old_spans_ = std::move(*spans_ptr);
       UASSERT(spans_ptr->empty());
+      UpdateProfilerLabel(nullptr);
     }
   }
 }
@@ -432,6 +518,7 @@ DetachLocalSpansScope::~DetachLocalSpansScope() {
               "A Span was constructed while in DetachLocalSpansScope");
   if (!old_spans_.empty()) {
     *task_local_spans = std::move(old_spans_);
+    UpdateProfilerLabel(&*task_local_spans);
   }
 }
 
@@ -16,7 +16,7 @@ SpanBuilder::SpanBuilder(std::string name,
                           logging::Level::kInfo, location),
              Span::OptionalDeleter{Span::OptionalDeleter::ShouldDelete()}) {
   pimpl_->AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
+  if (pimpl_->GetRawParentId().IsEmpty()) {
     AddTagFrozen(kLinkTag, utils::generators::GenerateUuid());
   }
 }
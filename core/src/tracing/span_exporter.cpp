@@ -0,0 +1,31 @@
+#include <userver/tracing/span_exporter.hpp>
+
+#include <userver/rcu/rcu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+auto& SpanExporterInternal() {
+  static rcu::Variable<std::shared_ptr<SpanExporter>> span_exporter;
+  return span_exporter;
+}
+
+}  // namespace
+
+SpanExporter::~SpanExporter() = default;
+
+std::shared_ptr<SpanExporter> GetSpanExporter() {
+  return SpanExporterInternal().ReadCopy();
+}
+
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+  UASSERT(engine::current_task::IsTaskProcessorThread());
+  SpanExporterInternal().Assign(std::move(exporter));
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
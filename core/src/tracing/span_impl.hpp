@@ -15,13 +15,20 @@
 #include <userver/logging/log_helper.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <engine/task/task_timings.hpp>
 #include <tracing/time_storage.hpp>
+#include <tracing/tracing_id.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::impl {
+class TaskContext;
+}  // namespace engine::impl
+
 namespace tracing {
 
 inline const std::string kLinkTag = "link";
@@ -51,23 +58,29 @@ class Span::Impl
   // Log this Span specifically
   void PutIntoLogger(logging::impl::TagWriter writer) &&;
 
+  // Pass this Span to the tracing::SpanExporter instead of the logs
+  SpanData ExtractSpanData() &&;
+
   // Add the context of this Span a non-Span-specific log record
   void LogTo(logging::impl::TagWriter writer);
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
-  const std::string& GetSpanId() const& noexcept { return span_id_; }
-  const std::string& GetParentId() const& noexcept { return parent_id_; }
+  const std::string& GetTraceId() const { return trace_id_.GetString(); }
+  const std::string& GetSpanId() const { return span_id_.GetString(); }
+  const std::string& GetParentId() const { return parent_id_.GetString(); }
 
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-  std::string GetSpanId() && noexcept { return std::move(span_id_); }
-  std::string GetParentId() && noexcept { return std::move(parent_id_); }
+  // The ids without formatting them to strings
+  const impl::TraceId& GetRawTraceId() const noexcept { return trace_id_; }
+  const impl::SpanId& GetRawSpanId() const noexcept { return span_id_; }
+  const impl::SpanId& GetRawParentId() const noexcept { return parent_id_; }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
-  void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
-  void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
+  void SetTraceId(std::string&& id) { trace_id_.Assign(std::move(id)); }
+  void SetSpanId(std::string&& id) { span_id_.Assign(std::move(id)); }
+  void SetParentId(std::string&& id) { parent_id_.Assign(std::move(id)); }
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  const std::string& GetName() const noexcept { return name_; }
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
@@ -77,8 +90,9 @@ class Span::Impl
   static void AddOpentracingTags(formats::json::StringBuilder& output,
                                  const logging::LogExtra& input);
 
-  static std::string GetParentIdForLogging(const Span::Impl* parent);
+  static impl::SpanId GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
+  void AccountTaskTimings() const;
 
   const std::string name_;
   const bool is_no_log_span_;
@@ -96,12 +110,16 @@ class Span::Impl
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
 
-  std::string trace_id_;
-  std::string span_id_;
-  std::string parent_id_;
+  impl::TraceId trace_id_;
+  impl::SpanId span_id_;
+  impl::SpanId parent_id_;
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  // the task of the span if it accounts the engine::impl::TaskTimings
+  engine::impl::TaskContext* task_context_{nullptr};
+  engine::impl::TaskTimings task_timings_at_start_;
+
   friend class Span;
   friend class SpanBuilder;
 };
@@ -114,11 +132,28 @@ using SpanStack =
 
 const Span::Impl* GetParentSpanImpl();
 
+namespace impl {
+
+// Span::Impl are created and destroyed on every request, so their storage is
+// taken from a pool instead of the allocator
+void* AcquireSpanImplStorage();
+void ReleaseSpanImplStorage(void* storage) noexcept;
+
+}  // namespace impl
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  void* const storage = impl::AcquireSpanImplStorage();
+  try {
+    return new (storage) Span::Impl(std::forward<Args>(args)...);
+  } catch (...) {
+    impl::ReleaseSpanImplStorage(storage);
+    throw;
+  }
 }
 
+void DeallocateImpl(Span::Impl* impl) noexcept;
+
 class DetachLocalSpansScope final {
  public:
   DetachLocalSpansScope() noexcept;
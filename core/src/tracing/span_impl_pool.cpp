@@ -0,0 +1,80 @@
+#include <tracing/span_impl.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include <compiler/tls.hpp>
+#include <concurrent/intrusive_walkable_pool.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+// Threads take the storage from different pools not to contend on a single
+// pool head. The storage is returned to the pool it was taken from, as the
+// span may be finished on another thread.
+constexpr std::size_t kPoolsCount = 16;
+
+struct SpanImplStorage final {
+  alignas(Span::Impl) std::byte data[sizeof(Span::Impl)];
+  std::size_t pool_index{0};
+  concurrent::impl::IntrusiveWalkablePoolHook<SpanImplStorage> pool_hook;
+};
+
+static_assert(offsetof(SpanImplStorage, data) == 0);
+
+using SpanImplPool = concurrent::impl::IntrusiveWalkablePool<
+    SpanImplStorage,
+    concurrent::impl::MemberHook<&SpanImplStorage::pool_hook>>;
+
+constexpr auto kNoPoolIndex = static_cast<std::size_t>(-1);
+
+std::atomic<std::size_t> threads_count{0};
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t thread_pool_index =
+    kNoPoolIndex;
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetThreadPoolIndex() noexcept {
+  if (thread_pool_index == kNoPoolIndex) {
+    thread_pool_index =
+        threads_count.fetch_add(1, std::memory_order_relaxed) % kPoolsCount;
+  }
+  return thread_pool_index;
+}
+
+std::array<SpanImplPool, kPoolsCount>& GetPools() {
+  // Never destroyed, the spans of the detached tasks may outlive the statics
+  static auto& pools = *new std::array<SpanImplPool, kPoolsCount>();
+  return pools;
+}
+
+}  // namespace
+
+namespace impl {
+
+void* AcquireSpanImplStorage() {
+  const auto pool_index = GetThreadPoolIndex();
+  auto& storage = GetPools()[pool_index].Acquire();
+  storage.pool_index = pool_index;
+  return storage.data;
+}
+
+void ReleaseSpanImplStorage(void* storage) noexcept {
+  auto& node = *static_cast<SpanImplStorage*>(storage);
+  GetPools()[node.pool_index].Release(node);
+}
+
+}  // namespace impl
+
+void DeallocateImpl(Span::Impl* impl) noexcept {
+  impl->~Impl();
+  impl::ReleaseSpanImplStorage(impl);
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
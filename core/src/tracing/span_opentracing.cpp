@@ -8,6 +8,7 @@
 #include <userver/logging/log_extra.hpp>
 #include <userver/tracing/opentracing.hpp>
 #include <userver/tracing/tags.hpp>
+#include <userver/utils/impl/fast_steady_clock.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -93,7 +94,7 @@ void Span::Impl::LogOpenTracing() const {
 }
 
 void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
-  const auto steady_now = std::chrono::steady_clock::now();
+  const auto steady_now = utils::impl::FastSteadyNow();
   const auto duration = steady_now - start_steady_time_;
   const auto duration_microseconds =
       std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
@@ -104,9 +105,11 @@ void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
   if (tracer_) {
     writer.PutTag(jaeger::kServiceName, tracer_->GetServiceName());
   }
-  writer.PutTag(jaeger::kTraceId, trace_id_);
-  writer.PutTag(jaeger::kParentId, parent_id_);
-  writer.PutTag(jaeger::kSpanId, span_id_);
+  impl::TraceId::HexBuffer trace_id_buffer;
+  impl::SpanId::HexBuffer span_id_buffer;
+  writer.PutTag(jaeger::kTraceId, trace_id_.GetView(trace_id_buffer));
+  writer.PutTag(jaeger::kParentId, parent_id_.GetView(span_id_buffer));
+  writer.PutTag(jaeger::kSpanId, span_id_.GetView(span_id_buffer));
   writer.PutTag(jaeger::kStartTime, start_time);
   writer.PutTag(jaeger::kStartTimeMillis, start_time / 1000);
   writer.PutTag(jaeger::kDuration, duration_microseconds);
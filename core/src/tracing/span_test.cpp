@@ -9,6 +9,7 @@
 #include <userver/tracing/noop.hpp>
 #include <userver/tracing/opentracing.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -17,6 +18,19 @@ USERVER_NAMESPACE_BEGIN
 
 class Span : public LoggingTest {};
 
+namespace {
+
+class CollectingSpanExporter final : public tracing::SpanExporter {
+ public:
+  void Export(tracing::SpanData&& span) noexcept override {
+    spans.push_back(std::move(span));
+  }
+
+  std::vector<tracing::SpanData> spans;
+};
+
+}  // namespace
+
 class OpentracingSpan : public Span {
  protected:
   OpentracingSpan()
@@ -717,4 +731,37 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
   }
 }
 
+UTEST_F(Span, Exporter) {
+  auto exporter = std::make_shared<CollectingSpanExporter>();
+  tracing::SetSpanExporter(exporter);
+
+  std::string parent_span_id;
+  {
+    tracing::Span parent("parent_span");
+    parent.AddTag("inherited", 1);
+    parent_span_id = parent.GetSpanId();
+    {
+      tracing::Span span("span_name");
+      span.AddNonInheritableTag("local", "value");
+      auto st = span.CreateScopeTime("xxx");
+    }
+    tracing::Span no_log_span("no_log_span", tracing::ReferenceType::kChild,
+                              logging::Level::kTrace);
+  }
+  tracing::SetSpanExporter({});
+
+  logging::LogFlush();
+  EXPECT_FALSE(LoggedTextContains("span_name"));
+
+  ASSERT_EQ(exporter->spans.size(), 2);
+  const auto& span = exporter->spans[0];
+  EXPECT_EQ(span.name, "span_name");
+  EXPECT_EQ(span.parent_id, parent_span_id);
+  EXPECT_EQ(span.trace_id, exporter->spans[1].trace_id);
+  EXPECT_EQ(span.tags.size(), 2);
+  ASSERT_EQ(span.timings.size(), 1);
+  EXPECT_EQ(span.timings[0].first, "xxx");
+  EXPECT_EQ(exporter->spans[1].name, "parent_span");
+}
+
 USERVER_NAMESPACE_END
@@ -34,6 +34,15 @@ void TimeStorage::MergeInto(logging::impl::TagWriter writer) {
   }
 }
 
+std::vector<std::pair<std::string, TimeStorage::Duration>>
+TimeStorage::ExtractTotals() && {
+  std::vector<std::pair<std::string, Duration>> totals;
+  totals.reserve(data_.size());
+  for (auto& [key, value] : data_) totals.emplace_back(key, value);
+  data_.clear();
+  return totals;
+}
+
 }  // namespace tracing::impl
 
 USERVER_NAMESPACE_END
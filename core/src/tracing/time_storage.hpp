@@ -3,6 +3,8 @@
 #include <chrono>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <userver/logging/log_extra.hpp>
 
@@ -32,6 +34,9 @@ class TimeStorage {
 
   void MergeInto(logging::impl::TagWriter writer);
 
+  /// Moves out the accumulated times of all the keys
+  std::vector<std::pair<std::string, Duration>> ExtractTotals() &&;
+
  private:
   std::unordered_map<std::string, Duration> data_;
 };
@@ -4,6 +4,7 @@
 #include <userver/logging/null_logger.hpp>
 #include <userver/tracing/noop.hpp>
 #include <userver/tracing/opentracing.hpp>
+#include <userver/tracing/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,6 +35,33 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+// The typical handler creates a few dozens of child spans for its database
+// and HTTP calls
+void tracing_child_span_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    tracing::Span root_span("root");
+    root_span.AddTag("inherited", "value");
+
+    for (auto _ : state) {
+      tracing::Span span("child");
+      benchmark::DoNotOptimize(span);
+    }
+  });
+}
+BENCHMARK(tracing_child_span_ctr);
+
+void tracing_child_span_ids(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    tracing::Span root_span("root");
+
+    for (auto _ : state) {
+      tracing::Span span("child");
+      benchmark::DoNotOptimize(span.GetSpanId());
+    }
+  });
+}
+BENCHMARK(tracing_child_span_ids);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
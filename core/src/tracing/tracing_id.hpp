@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+// Id of a trace or of a span. The generated ids are stored in binary and are
+// hex formatted only on demand, so that a Span does not allocate for them.
+// The ids that came from the outside are kept as is, unless they have the
+// lowercase hex format of the generated ids.
+//
+// Like the rest of the Span, the id is not thread-safe: GetString() caches
+// the formatted id. Copying does not read the cache.
+template <std::size_t Bytes>
+class TracingId final {
+ public:
+  static constexpr std::size_t kHexSize = Bytes * 2;
+  using Binary = std::array<std::uint8_t, Bytes>;
+  using HexBuffer = std::array<char, kHexSize>;
+
+  TracingId() noexcept = default;
+
+  explicit TracingId(const Binary& binary) noexcept
+      : binary_(binary), state_(State::kBinary) {}
+
+  TracingId(const TracingId& other)
+      : binary_(other.binary_), state_(other.state_) {
+    if (state_ == State::kString) string_ = other.string_;
+  }
+
+  TracingId(TracingId&&) noexcept = default;
+
+  TracingId& operator=(const TracingId& other) {
+    if (this == &other) return *this;
+    *this = TracingId{other};
+    return *this;
+  }
+
+  TracingId& operator=(TracingId&&) noexcept = default;
+
+  void Assign(std::string&& id) {
+    is_string_cached_ = false;
+    if (id.empty()) {
+      state_ = State::kEmpty;
+      string_.clear();
+    } else if (ParseHex(id, binary_)) {
+      state_ = State::kBinary;
+    } else {
+      state_ = State::kString;
+      string_ = std::move(id);
+    }
+  }
+
+  bool IsEmpty() const noexcept { return state_ == State::kEmpty; }
+
+  // Returns the id, formatting it into the `buffer` if needed
+  std::string_view GetView(HexBuffer& buffer) const noexcept {
+    switch (state_) {
+      case State::kEmpty:
+        return {};
+      case State::kBinary:
+        FormatHex(binary_, buffer);
+        return {buffer.data(), buffer.size()};
+      case State::kString:
+        break;
+    }
+    return string_;
+  }
+
+  const std::string& GetString() const {
+    if (state_ == State::kBinary && !is_string_cached_) {
+      HexBuffer buffer;
+      string_.assign(GetView(buffer));
+      is_string_cached_ = true;
+    }
+    return string_;
+  }
+
+  std::string ExtractString() && {
+    GetString();
+    return std::move(string_);
+  }
+
+ private:
+  enum class State : std::uint8_t { kEmpty, kBinary, kString };
+
+  // SIMD formatting of utils::encoding, the ids are formatted for each log
+  static void FormatHex(const Binary& binary, HexBuffer& buffer) noexcept {
+    utils::encoding::ToHexChars(
+        {reinterpret_cast<const char*>(binary.data()), binary.size()},
+        buffer.data());
+  }
+
+  static int FromHexDigit(char c) noexcept {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+
+  // Only the ids that format back to the same string are parsed
+  static bool ParseHex(std::string_view hex, Binary& binary) noexcept {
+    if (hex.size() != kHexSize) return false;
+
+    Binary result{};
+    for (std::size_t i = 0; i < Bytes; ++i) {
+      const int high = FromHexDigit(hex[i * 2]);
+      const int low = FromHexDigit(hex[i * 2 + 1]);
+      if (high < 0 || low < 0) return false;
+      result[i] = static_cast<std::uint8_t>(high << 4 | low);
+    }
+    binary = result;
+    return true;
+  }
+
+  Binary binary_{};
+  State state_{State::kEmpty};
+  mutable bool is_string_cached_{false};
+  // the foreign id, or the cached hex of the binary one
+  mutable std::string string_;
+};
+
+using TraceId = TracingId<16>;
+using SpanId = TracingId<8>;
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#include <tracing/tracing_id.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(TracingId, Binary) {
+  const tracing::impl::SpanId id{
+      {0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef}};
+  EXPECT_FALSE(id.IsEmpty());
+
+  tracing::impl::SpanId::HexBuffer buffer;
+  EXPECT_EQ(id.GetView(buffer), "0123456789abcdef");
+  EXPECT_EQ(id.GetString(), "0123456789abcdef");
+
+  const auto copy = id;
+  EXPECT_EQ(copy.GetString(), "0123456789abcdef");
+}
+
+TEST(TracingId, Assign) {
+  tracing::impl::SpanId id;
+  EXPECT_TRUE(id.IsEmpty());
+  EXPECT_EQ(id.GetString(), "");
+
+  id.Assign("fedcba9876543210");
+  tracing::impl::SpanId::HexBuffer buffer;
+  EXPECT_EQ(id.GetView(buffer), "fedcba9876543210");
+  EXPECT_EQ(id.GetString(), "fedcba9876543210");
+
+  id.Assign("");
+  EXPECT_TRUE(id.IsEmpty());
+  EXPECT_EQ(id.GetString(), "");
+}
+
+TEST(TracingId, Foreign) {
+  // only the ids that format back to the same string are stored in binary
+  for (const std::string foreign :
+       {"FEDCBA9876543210", "fedcba98765432", "fedcba9876543210aa",
+        "some-foreign-id"}) {
+    tracing::impl::SpanId id;
+    id.Assign(std::string{foreign});
+
+    tracing::impl::SpanId::HexBuffer buffer;
+    EXPECT_EQ(id.GetView(buffer), foreign);
+    EXPECT_EQ(id.GetString(), foreign);
+
+    const auto copy = id;
+    EXPECT_EQ(copy.GetString(), foreign);
+    EXPECT_EQ(std::move(id).ExtractString(), foreign);
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <userver/utils/expected.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <system_error>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsFailed(std::uint64_t iteration, std::int64_t error_percent) {
+  return static_cast<std::int64_t>(iteration % 100) < error_percent;
+}
+
+// The calls are not inlined to keep the unwinding through a real frame, as
+// in the drivers
+[[gnu::noinline]] std::shared_ptr<int> PerformOrThrow(bool is_failed) {
+  if (is_failed) {
+    throw clients::http::TimeoutException("Timeout was reached", {});
+  }
+  return std::make_shared<int>(42);
+}
+
+[[gnu::noinline]] utils::expected<std::shared_ptr<int>, std::error_code>
+TryPerform(bool is_failed) {
+  if (is_failed) {
+    return utils::unexpected(std::make_error_code(std::errc::timed_out));
+  }
+  return std::make_shared<int>(42);
+}
+
+}  // namespace
+
+// Arg is the percent of the failed calls, e.g. on a partial outage
+void expected_vs_throw_throw(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto error_percent = state.range(0);
+    std::uint64_t iteration = 0;
+    std::uint64_t errors = 0;
+    for (auto _ : state) {
+      try {
+        benchmark::DoNotOptimize(
+            PerformOrThrow(IsFailed(iteration++, error_percent)));
+      } catch (const clients::http::TimeoutException&) {
+        ++errors;
+      }
+    }
+    benchmark::DoNotOptimize(errors);
+  });
+}
+BENCHMARK(expected_vs_throw_throw)->Arg(0)->Arg(50)->Arg(100);
+
+void expected_vs_throw_expected(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto error_percent = state.range(0);
+    std::uint64_t iteration = 0;
+    std::uint64_t errors = 0;
+    for (auto _ : state) {
+      auto result = TryPerform(IsFailed(iteration++, error_percent));
+      if (!result.has_value()) {
+        ++errors;
+        continue;
+      }
+      benchmark::DoNotOptimize(result.value());
+    }
+    benchmark::DoNotOptimize(errors);
+  });
+}
+BENCHMARK(expected_vs_throw_expected)->Arg(0)->Arg(50)->Arg(100);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,231 @@
+#include <userver/utils/impl/fast_steady_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#include <userver/utils/impl/userver_experiments.hpp>
+#include <utils/impl/fast_steady_clock_calibration.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Greater lags, e.g. after a VM migration, are not smoothed out
+constexpr std::int64_t kMaxSmoothedErrorNs = 1'000'000;
+// The rate is corrected by at most 1/1024 of the measured one
+constexpr int kMaxSlewShift = 10;
+
+std::uint64_t GetMult(std::int64_t ns, std::uint64_t ticks) noexcept {
+  if (ticks == 0) return 0;
+  return static_cast<std::uint64_t>(
+      (static_cast<unsigned __int128>(ns) << kMultShift) / ticks);
+}
+
+#if defined(__x86_64__)
+
+std::int64_t ToNs(Clock::time_point time_point) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time_point.time_since_epoch())
+      .count();
+}
+
+Clock::time_point FromNs(std::int64_t ns) noexcept {
+  return Clock::time_point{std::chrono::duration_cast<Clock::duration>(
+      std::chrono::nanoseconds{ns})};
+}
+
+// The TSC rate is measured over this time before the TSC is used
+constexpr std::int64_t kInitialCalibrationNs = 10'000'000;
+
+std::int64_t MulShift(std::uint64_t ticks, std::uint64_t mult) noexcept {
+  return static_cast<std::int64_t>(
+      (static_cast<unsigned __int128>(ticks) * mult) >> kMultShift);
+}
+
+bool HasInvariantTsc() noexcept {
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+  return (edx & (1u << 8)) != 0;
+}
+
+// The kernel uses the TSC for the steady clock only if it is synchronized
+// between the CPUs and does not stop in the idle states
+bool IsKernelClocksourceTsc() noexcept {
+  auto* file = std::fopen(
+      "/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+  if (!file) return false;
+  char buffer[32]{};
+  const auto size = std::fread(buffer, 1, sizeof(buffer) - 1, file);
+  std::fclose(file);
+  return std::strncmp(buffer, "tsc\n", size) == 0 && size == 4;
+}
+
+class TscClock final {
+ public:
+  TscClock() noexcept {
+    if (!HasInvariantTsc() || !IsKernelClocksourceTsc()) {
+      state_.store(State::kUnsupported, std::memory_order_relaxed);
+      return;
+    }
+    ref_ns_ = ToNs(Clock::now());
+    ref_tsc_ = __rdtsc();
+    state_.store(State::kCalibrating, std::memory_order_release);
+  }
+
+  std::optional<std::int64_t> TryNowNs() noexcept {
+    if (state_.load(std::memory_order_acquire) != State::kReady) {
+      return std::nullopt;
+    }
+
+    // Falls back to the steady_clock instead of waiting for the update
+    const auto seq = seq_.load(std::memory_order_acquire);
+    if (seq & 1) return std::nullopt;
+    const auto base_tsc = base_tsc_.load(std::memory_order_relaxed);
+    const auto base_ns = base_ns_.load(std::memory_order_relaxed);
+    const auto mult = mult_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (seq_.load(std::memory_order_relaxed) != seq) return std::nullopt;
+
+    const std::uint64_t tsc = __rdtsc();
+    // The TSCs of the CPUs may differ by a few ticks
+    const std::uint64_t ticks = tsc > base_tsc ? tsc - base_tsc : 0;
+    if (ticks > period_ticks_.load(std::memory_order_relaxed)) {
+      Recalibrate();
+    }
+    return base_ns + MulShift(ticks, mult);
+  }
+
+  // Called with the steady_clock time while the TSC rate is being measured
+  void OnSteadyNow(Clock::time_point now) noexcept {
+    if (state_.load(std::memory_order_acquire) != State::kCalibrating) return;
+
+    const auto now_ns = ToNs(now);
+    if (now_ns - ref_ns_ < kInitialCalibrationNs) return;
+    if (is_updating_.test_and_set(std::memory_order_acquire)) return;
+
+    if (state_.load(std::memory_order_relaxed) == State::kCalibrating) {
+      const std::uint64_t tsc = __rdtsc();
+      const auto mult = GetMult(now_ns - ref_ns_, tsc - ref_tsc_);
+      if (mult == 0) {
+        state_.store(State::kUnsupported, std::memory_order_relaxed);
+      } else {
+        Store(tsc, now_ns, mult);
+        state_.store(State::kReady, std::memory_order_release);
+      }
+    }
+    is_updating_.clear(std::memory_order_release);
+  }
+
+ private:
+  enum class State { kUnsupported, kCalibrating, kReady };
+
+  // Keeps the time continuous: instead of jumping to the steady_clock time,
+  // the rate is adjusted so that the time converges to it
+  void Recalibrate() noexcept {
+    if (is_updating_.test_and_set(std::memory_order_acquire)) return;
+
+    const std::uint64_t tsc_before = __rdtsc();
+    const auto steady_ns = ToNs(Clock::now());
+    const std::uint64_t tsc_after = __rdtsc();
+    const auto tsc = tsc_before + (tsc_after - tsc_before) / 2;
+
+    const auto old_base_tsc = base_tsc_.load(std::memory_order_relaxed);
+    const auto old_mult = mult_.load(std::memory_order_relaxed);
+    if (tsc > old_base_tsc) {
+      const auto extrapolated_ns = base_ns_.load(std::memory_order_relaxed) +
+                                   MulShift(tsc - old_base_tsc, old_mult);
+      const auto true_mult = GetMult(steady_ns - ref_ns_, tsc - ref_tsc_);
+      if (true_mult != 0) {
+        const auto next = impl::Recalibrate(
+            extrapolated_ns, steady_ns, true_mult,
+            period_ticks_.load(std::memory_order_relaxed));
+        Store(tsc, next.base_ns, next.mult);
+      }
+    }
+
+    is_updating_.clear(std::memory_order_release);
+  }
+
+  void Store(std::uint64_t tsc, std::int64_t ns, std::uint64_t mult) noexcept {
+    const auto seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    base_tsc_.store(tsc, std::memory_order_relaxed);
+    base_ns_.store(ns, std::memory_order_relaxed);
+    mult_.store(mult, std::memory_order_relaxed);
+    period_ticks_.store(GetPeriodTicks(mult), std::memory_order_relaxed);
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  std::atomic<State> state_{State::kUnsupported};
+  std::atomic_flag is_updating_ = ATOMIC_FLAG_INIT;
+
+  // The first measurement, the TSC rate is averaged from it
+  std::int64_t ref_ns_{0};
+  std::uint64_t ref_tsc_{0};
+
+  // Seqlock protected extrapolation parameters
+  std::atomic<std::uint64_t> seq_{0};
+  std::atomic<std::uint64_t> base_tsc_{0};
+  std::atomic<std::int64_t> base_ns_{0};
+  std::atomic<std::uint64_t> mult_{0};
+  std::atomic<std::uint64_t> period_ticks_{0};
+};
+
+#endif
+
+}  // namespace
+
+TscExtrapolation Recalibrate(std::int64_t extrapolated_ns,
+                             std::int64_t steady_ns, std::uint64_t true_mult,
+                             std::uint64_t period_ticks) noexcept {
+  const auto error_ns = steady_ns - extrapolated_ns;
+  if (error_ns > kMaxSmoothedErrorNs) return {steady_ns, true_mult};
+
+  // The error is spread over the next period, bounded so that the time does
+  // not speed up or slow down noticeably. A steady_clock that is behind is
+  // caught up with by slowing down, the time never goes backwards.
+  const auto max_correction = true_mult >> kMaxSlewShift;
+  const auto correction =
+      std::min(GetMult(error_ns >= 0 ? error_ns : -error_ns, period_ticks),
+               max_correction);
+  return {extrapolated_ns,
+          error_ns >= 0 ? true_mult + correction : true_mult - correction};
+}
+
+std::uint64_t GetPeriodTicks(std::uint64_t mult) noexcept {
+  return static_cast<std::uint64_t>(
+      (static_cast<unsigned __int128>(kRecalibrationPeriodNs) << kMultShift) /
+      mult);
+}
+
+Clock::time_point FastSteadyNow() noexcept {
+#if defined(__x86_64__)
+  if (kFastSteadyClockExperiment.IsEnabled()) {
+    static TscClock tsc_clock;
+    if (const auto ns = tsc_clock.TryNowNs()) return FromNs(*ns);
+
+    const auto now = Clock::now();
+    tsc_clock.OnSteadyNow(now);
+    return now;
+  }
+#endif
+  return Clock::now();
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+// The TSC time is recalibrated against the steady_clock once per this period
+inline constexpr std::int64_t kRecalibrationPeriodNs = 1'000'000'000;
+
+// The multipliers are fixed point numbers of nanoseconds per tick
+inline constexpr int kMultShift = 32;
+
+struct TscExtrapolation {
+  std::int64_t base_ns{0};
+  std::uint64_t mult{0};
+};
+
+// Returns the extrapolation for the next recalibration period. The time is
+// kept continuous and monotonic: a lag of more than 1ms is jumped over, any
+// other difference with the steady_clock is slewed out with the rate differing
+// from `true_mult` by 1/1024 at most, so the time never goes at half speed.
+TscExtrapolation Recalibrate(std::int64_t extrapolated_ns,
+                             std::int64_t steady_ns, std::uint64_t true_mult,
+                             std::uint64_t period_ticks) noexcept;
+
+// The ticks of one recalibration period at the rate `mult`
+std::uint64_t GetPeriodTicks(std::uint64_t mult) noexcept;
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,111 @@
+#include <userver/utils/impl/fast_steady_clock.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/impl/userver_experiments.hpp>
+#include <utils/impl/fast_steady_clock_calibration.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Checks that the time is monotonic and stays within the calls of the
+// steady_clock around it
+void CheckFollowsSteadyClock(Clock::duration duration,
+                             std::chrono::microseconds tolerance) {
+  const auto end = Clock::now() + duration;
+  auto previous = utils::impl::FastSteadyNow();
+  for (;;) {
+    const auto before = Clock::now();
+    const auto now = utils::impl::FastSteadyNow();
+    const auto after = Clock::now();
+
+    ASSERT_GE(now, previous);
+    ASSERT_GE(now, before - tolerance);
+    ASSERT_LE(now, after + tolerance);
+
+    previous = now;
+    if (after > end) break;
+  }
+}
+
+}  // namespace
+
+TEST(FastSteadyClock, Disabled) {
+  CheckFollowsSteadyClock(std::chrono::milliseconds{10},
+                          std::chrono::microseconds{0});
+}
+
+TEST(FastSteadyClock, Enabled) {
+  utils::impl::UserverExperimentsScope experiments;
+  experiments.Set(utils::impl::kFastSteadyClockExperiment, true);
+
+  // Covers the initial calibration and a few recalibrations
+  CheckFollowsSteadyClock(std::chrono::milliseconds{3500},
+                          std::chrono::microseconds{100});
+}
+
+TEST(FastSteadyClock, EnabledWithSleeps) {
+  utils::impl::UserverExperimentsScope experiments;
+  experiments.Set(utils::impl::kFastSteadyClockExperiment, true);
+
+  for (int i = 0; i < 4; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+    CheckFollowsSteadyClock(std::chrono::milliseconds{10},
+                            std::chrono::microseconds{100});
+  }
+}
+
+TEST(FastSteadyClock, RecalibrationSlewsOutLargeLead) {
+  // 1ns per tick, the TSC clock is a second ahead of the steady_clock
+  constexpr std::uint64_t kTrueMult = std::uint64_t{1}
+                                      << utils::impl::kMultShift;
+  constexpr std::int64_t kPeriodNs = utils::impl::kRecalibrationPeriodNs;
+  std::int64_t steady_ns = 0;
+  std::int64_t tsc_ns = kPeriodNs;
+  auto period_ticks = utils::impl::GetPeriodTicks(kTrueMult);
+
+  int periods = 0;
+  while (tsc_ns - steady_ns > 1'000) {
+    ASSERT_LT(++periods, 1200) << "the lead is not slewed out";
+    const auto next = utils::impl::Recalibrate(tsc_ns, steady_ns, kTrueMult,
+                                               period_ticks);
+    // Never goes backwards or jumps, the rate differs by 1/1024 at most
+    ASSERT_EQ(next.base_ns, tsc_ns);
+    ASSERT_GE(next.mult, kTrueMult - (kTrueMult >> 10));
+    ASSERT_LE(next.mult, kTrueMult);
+
+    // The next recalibration happens a period of the TSC clock later
+    period_ticks = utils::impl::GetPeriodTicks(next.mult);
+    tsc_ns += static_cast<std::int64_t>(
+        (static_cast<unsigned __int128>(period_ticks) * next.mult) >>
+        utils::impl::kMultShift);
+    steady_ns += static_cast<std::int64_t>(period_ticks);
+  }
+}
+
+TEST(FastSteadyClock, RecalibrationJumpsOverLag) {
+  constexpr std::uint64_t kTrueMult = std::uint64_t{1}
+                                      << utils::impl::kMultShift;
+  const auto period_ticks = utils::impl::GetPeriodTicks(kTrueMult);
+
+  const auto lagging = utils::impl::Recalibrate(
+      0, utils::impl::kRecalibrationPeriodNs, kTrueMult, period_ticks);
+  EXPECT_EQ(lagging.base_ns, utils::impl::kRecalibrationPeriodNs);
+  EXPECT_EQ(lagging.mult, kTrueMult);
+
+  // A small lag is slewed out over the next period
+  const auto small_lag =
+      utils::impl::Recalibrate(0, 1'000, kTrueMult, period_ticks);
+  EXPECT_EQ(small_lag.base_ns, 0);
+  EXPECT_GT(small_lag.mult, kTrueMult);
+  EXPECT_LE(small_lag.mult, kTrueMult + (kTrueMult >> 10));
+}
+
+USERVER_NAMESPACE_END
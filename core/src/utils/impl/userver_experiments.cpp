@@ -101,6 +101,8 @@ UserverExperiment kRedisClusterAutoTopologyExperiment{
 
 UserverExperiment kPhdrCacheExperiment{"phdr-cache"};
 
+UserverExperiment kFastSteadyClockExperiment{"fast-steady-clock"};
+
 UserverExperiment kGrpcClientDeadlinePropagationExperiment{
     "grpc-client-deadline-propagation"};
 UserverExperiment kGrpcServerDeadlinePropagationExperiment{
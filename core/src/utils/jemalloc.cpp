@@ -6,6 +6,8 @@
 #include <cerrno>
 #endif
 
+#include <fmt/format.h>
+
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,6 +38,13 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code Read(const std::string& name, T& value) {
+  std::size_t size = sizeof(value);
+  int rc = mallctl(name.c_str(), &value, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -55,6 +64,14 @@ std::error_code ProfDeactivate() { return MallCtl<bool>("prof.active", false); }
 
 std::error_code ProfDump() { return MallCtl("prof.dump"); }
 
+std::error_code ProfDump(const std::string& filename) {
+  return MallCtl<const char*>("prof.dump", filename.c_str());
+}
+
+std::error_code ProfReset(std::size_t lg_sample) {
+  return MallCtl<size_t>("prof.reset", lg_sample);
+}
+
 std::error_code SetMaxBgThreads(size_t max_bg_threads) {
   return MallCtl<size_t>("max_background_threads", max_bg_threads);
 }
@@ -68,6 +85,51 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+std::error_code GetThreadAllocatedBytes(std::uint64_t& allocated_bytes) {
+  size_t size = sizeof(allocated_bytes);
+  int rc = mallctl("thread.allocated", &allocated_bytes, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
+std::error_code SetThreadTcacheEnabled(bool enabled) {
+  return MallCtl<bool>("thread.tcache.enabled", enabled);
+}
+
+std::error_code CreateArena(unsigned& arena) {
+  size_t size = sizeof(arena);
+  int rc = mallctl("arenas.create", &arena, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
+std::error_code SetThreadArena(unsigned arena) {
+  return MallCtl<unsigned>("thread.arena", arena);
+}
+
+std::error_code RefreshStats() { return MallCtl<std::uint64_t>("epoch", 1); }
+
+std::error_code GetArenaStats(unsigned arena, ArenaStats& stats) {
+  std::size_t page_size = 0;
+  if (auto ec = Read("arenas.page", page_size)) return ec;
+
+  const auto prefix = fmt::format("stats.arenas.{}.", arena);
+  unsigned threads = 0;
+  std::size_t small_allocated = 0;
+  std::size_t large_allocated = 0;
+  std::size_t active_pages = 0;
+  std::size_t resident = 0;
+  if (auto ec = Read(prefix + "nthreads", threads)) return ec;
+  if (auto ec = Read(prefix + "small.allocated", small_allocated)) return ec;
+  if (auto ec = Read(prefix + "large.allocated", large_allocated)) return ec;
+  if (auto ec = Read(prefix + "pactive", active_pages)) return ec;
+  if (auto ec = Read(prefix + "resident", resident)) return ec;
+
+  stats.threads = threads;
+  stats.allocated_bytes = small_allocated + large_allocated;
+  stats.active_bytes = active_pages * page_size;
+  stats.resident_bytes = resident;
+  return {};
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
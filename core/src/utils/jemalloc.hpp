@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <system_error>
 
@@ -15,6 +16,13 @@ std::error_code ProfDeactivate();
 
 std::error_code ProfDump();
 
+/// Writes the heap profile to the file
+std::error_code ProfDump(const std::string& filename);
+
+/// Discards the collected profile and samples an allocation every
+/// 2^lg_sample bytes on average from now on
+std::error_code ProfReset(std::size_t lg_sample);
+
 std::error_code SetMaxBgThreads(size_t max_bg_threads);
 
 std::error_code EnableBgThreads();
@@ -22,6 +30,30 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+/// Total bytes allocated by the current thread so far
+std::error_code GetThreadAllocatedBytes(std::uint64_t& allocated_bytes);
+
+/// Enables or disables the thread cache of the current thread
+std::error_code SetThreadTcacheEnabled(bool enabled);
+
+/// Creates a new arena, returns its index in `arena`
+std::error_code CreateArena(unsigned& arena);
+
+/// Makes the current thread allocate from the arena
+std::error_code SetThreadArena(unsigned arena);
+
+struct ArenaStats {
+  std::size_t threads{0};
+  std::size_t allocated_bytes{0};
+  std::size_t active_bytes{0};
+  std::size_t resident_bytes{0};
+};
+
+/// Updates the statistics snapshot returned by GetArenaStats
+std::error_code RefreshStats();
+
+std::error_code GetArenaStats(unsigned arena, ArenaStats& stats);
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
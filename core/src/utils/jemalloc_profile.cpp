@@ -0,0 +1,178 @@
+#include <utils/jemalloc_profile.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <boost/stacktrace/frame.hpp>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::jemalloc {
+
+namespace {
+
+constexpr std::string_view kHeader = "heap_v2/";
+constexpr std::string_view kStackPrefix = "@ ";
+constexpr std::string_view kTotalPrefix = "  t*: ";
+constexpr std::string_view kMappedLibraries = "MAPPED_LIBRARIES:";
+
+// Frames of the allocator itself, the allocations are attributed to the
+// first frame that does not contain any of these
+constexpr std::array<std::string_view, 11> kAllocatorFrames{
+    "malloc",         "calloc",        "realloc",
+    "memalign",       "aligned_alloc", "operator new",
+    "je_",            "imalloc",       "prof_",
+    "std::allocator", "new_allocator",
+};
+
+bool StartsWith(std::string_view str, std::string_view prefix) {
+  return str.substr(0, prefix.size()) == prefix;
+}
+
+std::uint64_t ParseNumber(std::string_view& str, int base = 10) {
+  std::uint64_t result = 0;
+  const auto [ptr, ec] =
+      std::from_chars(str.data(), str.data() + str.size(), result, base);
+  if (ec != std::errc{}) {
+    throw std::runtime_error(
+        fmt::format("Invalid number in the heap profile: '{}'", str));
+  }
+  str.remove_prefix(ptr - str.data());
+  return result;
+}
+
+// "0x4012ab 0x4011cd"
+std::vector<std::uintptr_t> ParseStack(std::string_view str) {
+  std::vector<std::uintptr_t> stack;
+  while (!str.empty()) {
+    const auto space = str.find(' ');
+    auto address = str.substr(0, space);
+    if (StartsWith(address, "0x")) address.remove_prefix(2);
+    if (!address.empty()) stack.push_back(ParseNumber(address, 16));
+    if (space == std::string_view::npos) break;
+    str.remove_prefix(space + 1);
+  }
+  return stack;
+}
+
+// "13: 6688 [0: 0]", see AdjustSamples of jeprof
+void ParseTotal(std::string_view str, std::uint64_t sample_period,
+                ProfileSite& site) {
+  const auto objects = ParseNumber(str);
+  if (!StartsWith(str, ": ")) {
+    throw std::runtime_error("Invalid site totals in the heap profile");
+  }
+  str.remove_prefix(2);
+  const auto bytes = ParseNumber(str);
+
+  double scale = 1;
+  if (objects != 0 && sample_period != 0) {
+    const auto average_size = static_cast<double>(bytes) / objects;
+    scale = 1 / (1 - std::exp(-average_size / sample_period));
+  }
+  site.objects = static_cast<std::uint64_t>(objects * scale);
+  site.bytes = static_cast<std::uint64_t>(bytes * scale);
+}
+
+bool IsAllocatorFrame(std::string_view name) {
+  return std::any_of(
+      kAllocatorFrames.begin(), kAllocatorFrames.end(),
+      [name](std::string_view frame) {
+        return name.find(frame) != std::string_view::npos;
+      });
+}
+
+}  // namespace
+
+Profile ParseProfile(std::string_view data) {
+  if (!StartsWith(data, kHeader)) {
+    throw std::runtime_error("Not a heap_v2 profile");
+  }
+  data.remove_prefix(kHeader.size());
+
+  Profile profile;
+  profile.sample_period = ParseNumber(data);
+
+  ProfileSite* site = nullptr;
+  while (!data.empty()) {
+    const auto line_end = data.find('\n');
+    const auto line = data.substr(0, line_end);
+    if (line == kMappedLibraries) break;
+
+    if (StartsWith(line, kStackPrefix)) {
+      site = &profile.sites.emplace_back();
+      site->stack = ParseStack(line.substr(kStackPrefix.size()));
+    } else if (site && StartsWith(line, kTotalPrefix)) {
+      ParseTotal(line.substr(kTotalPrefix.size()), profile.sample_period,
+                 *site);
+      // the per-thread lines are not needed
+      site = nullptr;
+    }
+
+    if (line_end == std::string_view::npos) break;
+    data.remove_prefix(line_end + 1);
+  }
+
+  profile.sites.erase(
+      std::remove_if(profile.sites.begin(), profile.sites.end(),
+                     [](const ProfileSite& site) { return site.bytes == 0; }),
+      profile.sites.end());
+  return profile;
+}
+
+std::string GetFrameName(std::uintptr_t address) {
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  return boost::stacktrace::frame(reinterpret_cast<const void*>(address))
+      .name();
+}
+
+std::vector<TopSite> GetTopSites(const Profile& profile, std::size_t max_count,
+                                 const FrameNameFunc& frame_name) {
+  std::unordered_map<std::uintptr_t, std::string> names;
+  const auto get_name = [&](std::uintptr_t address) -> const std::string& {
+    auto [it, inserted] = names.try_emplace(address);
+    if (inserted) {
+      it->second = frame_name(address);
+      if (it->second.empty()) it->second = fmt::format("{:#x}", address);
+    }
+    return it->second;
+  };
+
+  std::unordered_map<std::string_view, TopSite> by_name;
+  for (const auto& site : profile.sites) {
+    const std::string* name = nullptr;
+    for (const auto address : site.stack) {
+      name = &get_name(address);
+      if (!IsAllocatorFrame(*name)) break;
+    }
+    if (!name) continue;
+
+    auto& top_site = by_name[*name];
+    top_site.objects += site.objects;
+    top_site.bytes += site.bytes;
+  }
+
+  std::vector<TopSite> result;
+  result.reserve(by_name.size());
+  for (auto& [name, site] : by_name) {
+    site.name = std::string{name};
+    result.push_back(std::move(site));
+  }
+
+  const auto middle = result.begin() + std::min(max_count, result.size());
+  std::partial_sort(result.begin(), middle, result.end(),
+                    [](const TopSite& lhs, const TopSite& rhs) {
+                      return lhs.bytes > rhs.bytes;
+                    });
+  result.erase(middle, result.end());
+  return result;
+}
+
+}  // namespace utils::jemalloc
+
+USERVER_NAMESPACE_END
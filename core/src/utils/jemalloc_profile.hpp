@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::jemalloc {
+
+/// Allocations of a single stack trace, estimated from the samples
+struct ProfileSite {
+  /// Return addresses, the innermost frame first
+  std::vector<std::uintptr_t> stack;
+  std::uint64_t objects{0};
+  std::uint64_t bytes{0};
+};
+
+/// Heap profile written by the `prof.dump` mallctl
+struct Profile {
+  std::uint64_t sample_period{0};
+  std::vector<ProfileSite> sites;
+};
+
+/// @brief Parses the `heap_v2` profile and scales the sampled counts, just
+/// like jeprof does.
+/// @throws std::runtime_error if the data is not a `heap_v2` profile
+Profile ParseProfile(std::string_view data);
+
+/// Allocations attributed to a function
+struct TopSite {
+  std::string name;
+  std::uint64_t objects{0};
+  std::uint64_t bytes{0};
+};
+
+using FrameNameFunc = std::function<std::string(std::uintptr_t address)>;
+
+/// Returns the name of the function at the address, empty if unknown
+std::string GetFrameName(std::uintptr_t address);
+
+/// @brief Attributes the allocations to the innermost frames that are not
+/// in the allocator and returns at most `max_count` functions that hold the
+/// most bytes, the largest first.
+std::vector<TopSite> GetTopSites(
+    const Profile& profile, std::size_t max_count,
+    const FrameNameFunc& frame_name = &GetFrameName);
+
+}  // namespace utils::jemalloc
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,79 @@
+#include <utils/jemalloc_profile.hpp>
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kProfile = R"(heap_v2/524288
+  t*: 7: 3145728 [0: 0]
+  t0: 7: 3145728 [0: 0]
+@ 0x10 0x20 0x30
+  t*: 4: 2097152 [0: 0]
+  t0: 4: 2097152 [0: 0]
+@ 0x10 0x21 0x31
+  t*: 2: 1048576 [0: 0]
+  t0: 2: 1048576 [0: 0]
+@ 0x11 0x40
+  t*: 1: 1048576 [0: 0]
+  t0: 1: 1048576 [0: 0]
+@ 0x12
+  t*: 0: 0 [0: 0]
+
+MAPPED_LIBRARIES:
+00400000-00401000 r-xp 00000000 08:01 1 /usr/bin/service
+)";
+
+std::string FakeFrameName(std::uintptr_t address) {
+  switch (address) {
+    case 0x10:
+    case 0x11:
+      return "malloc";
+    case 0x20:
+    case 0x21:
+      return "Cache::Update()";
+    case 0x40:
+      return "Parser::Parse()";
+    default:
+      return {};
+  }
+}
+
+}  // namespace
+
+TEST(JemallocProfile, Parse) {
+  const auto profile = utils::jemalloc::ParseProfile(kProfile);
+  EXPECT_EQ(profile.sample_period, 524288);
+  ASSERT_EQ(profile.sites.size(), 3);
+
+  const auto& site = profile.sites[0];
+  EXPECT_EQ(site.stack, (std::vector<std::uintptr_t>{0x10, 0x20, 0x30}));
+  // 512KiB objects are sampled with the probability of 1 - e^-1
+  EXPECT_EQ(site.objects, 6);
+  EXPECT_NEAR(site.bytes, 3317645, 1);
+}
+
+TEST(JemallocProfile, NotAProfile) {
+  EXPECT_THROW(utils::jemalloc::ParseProfile("heap_v1/1\n"),
+               std::runtime_error);
+}
+
+TEST(JemallocProfile, TopSites) {
+  const auto profile = utils::jemalloc::ParseProfile(kProfile);
+  const auto top = utils::jemalloc::GetTopSites(profile, 10, &FakeFrameName);
+
+  ASSERT_EQ(top.size(), 2);
+  EXPECT_EQ(top[0].name, "Cache::Update()");
+  EXPECT_EQ(top[0].bytes, profile.sites[0].bytes + profile.sites[1].bytes);
+  EXPECT_EQ(top[1].name, "Parser::Parse()");
+  EXPECT_EQ(top[1].bytes, profile.sites[2].bytes);
+
+  const auto first = utils::jemalloc::GetTopSites(profile, 1, &FakeFrameName);
+  ASSERT_EQ(first.size(), 1);
+  EXPECT_EQ(first[0].name, "Cache::Update()");
+}
+
+USERVER_NAMESPACE_END
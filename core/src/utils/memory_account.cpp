@@ -0,0 +1,192 @@
+#include <userver/utils/memory_account.hpp>
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/engine/task/inherited_variable.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+engine::TaskInheritedVariable<std::shared_ptr<MemoryAccount>>
+    kCurrentMemoryAccount;
+
+}  // namespace
+
+MemoryAccount::MemoryAccount(std::optional<std::size_t> limit,
+                             std::shared_ptr<MemoryAccount> parent) noexcept
+    : limit_(limit), parent_(std::move(parent)) {}
+
+MemoryAccount::~MemoryAccount() {
+  // Charges made with TryCharge or ForceCharge directly are not released
+  // automatically, do not let them stay in the parents forever
+  const auto leftover = current_bytes_.load(std::memory_order_relaxed);
+  if (leftover != 0 && parent_) parent_->Release(leftover);
+}
+
+bool MemoryAccount::TryCharge(std::size_t bytes) noexcept {
+  for (auto* account = this; account; account = account->parent_.get()) {
+    if (!account->DoTryCharge(bytes)) {
+      for (auto* charged = this; charged != account;
+           charged = charged->parent_.get()) {
+        charged->DoRelease(bytes);
+      }
+      // Counted by the nested account and by all of its parents
+      for (auto* rejected = this; rejected;
+           rejected = rejected->parent_.get()) {
+        ++rejected->rejected_;
+      }
+      return false;
+    }
+  }
+
+  for (auto* account = this; account; account = account->parent_.get()) {
+    account->charged_bytes_.Add(utils::statistics::Rate{bytes});
+    account->UpdatePeak(account->GetCurrentBytes());
+  }
+  return true;
+}
+
+void MemoryAccount::ForceCharge(std::size_t bytes) noexcept {
+  for (auto* account = this; account; account = account->parent_.get()) {
+    account->DoForceCharge(bytes);
+  }
+}
+
+void MemoryAccount::Release(std::size_t bytes) noexcept {
+  for (auto* account = this; account; account = account->parent_.get()) {
+    account->DoRelease(bytes);
+  }
+}
+
+std::size_t MemoryAccount::GetCurrentBytes() const noexcept {
+  return current_bytes_.load(std::memory_order_relaxed);
+}
+
+bool MemoryAccount::IsOverLimit() const noexcept {
+  for (const auto* account = this; account; account = account->parent_.get()) {
+    if (account->limit_ && account->GetCurrentBytes() > *account->limit_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MemoryAccount::DoTryCharge(std::size_t bytes) noexcept {
+  auto current = current_bytes_.load(std::memory_order_relaxed);
+  do {
+    // The account may already be over the limit after ForceCharge
+    if (limit_ && (current > *limit_ || bytes > *limit_ - current)) {
+      return false;
+    }
+  } while (!current_bytes_.compare_exchange_weak(current, current + bytes,
+                                                 std::memory_order_relaxed));
+  return true;
+}
+
+void MemoryAccount::DoForceCharge(std::size_t bytes) noexcept {
+  const auto current =
+      current_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  charged_bytes_.Add(utils::statistics::Rate{bytes});
+  UpdatePeak(current);
+}
+
+void MemoryAccount::DoRelease(std::size_t bytes) noexcept {
+  current_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryAccount::UpdatePeak(std::size_t current_bytes) noexcept {
+  auto peak = peak_bytes_.load(std::memory_order_relaxed);
+  while (peak < current_bytes &&
+         !peak_bytes_.compare_exchange_weak(peak, current_bytes,
+                                            std::memory_order_relaxed)) {
+  }
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MemoryAccount& account) {
+  writer["current-bytes"] = account.GetCurrentBytes();
+  writer["peak-bytes"] = account.peak_bytes_.load(std::memory_order_relaxed);
+  if (account.limit_) writer["limit-bytes"] = *account.limit_;
+  writer["charged-bytes"] = account.charged_bytes_;
+  writer["rejected"] = account.rejected_;
+}
+
+MemoryCharge::MemoryCharge(std::shared_ptr<MemoryAccount> account,
+                           std::size_t bytes) {
+  if (!account) return;
+  if (!account->TryCharge(bytes)) {
+    throw MemoryLimitExceeded(fmt::format(
+        "Charging {} bytes would exceed the memory limit, {} bytes are held",
+        bytes, account->GetCurrentBytes()));
+  }
+  account_ = std::move(account);
+  bytes_ = bytes;
+}
+
+MemoryCharge::MemoryCharge(ForceTag, std::shared_ptr<MemoryAccount>&& account,
+                           std::size_t bytes) noexcept
+    : account_(std::move(account)), bytes_(account_ ? bytes : 0) {
+  if (account_) account_->ForceCharge(bytes_);
+}
+
+MemoryCharge MemoryCharge::Force(std::shared_ptr<MemoryAccount> account,
+                                 std::size_t bytes) noexcept {
+  return MemoryCharge{ForceTag{}, std::move(account), bytes};
+}
+
+MemoryCharge::MemoryCharge(MemoryCharge&& other) noexcept
+    : account_(std::move(other.account_)),
+      bytes_(std::exchange(other.bytes_, 0)) {}
+
+MemoryCharge& MemoryCharge::operator=(MemoryCharge&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    account_ = std::move(other.account_);
+    bytes_ = std::exchange(other.bytes_, 0);
+  }
+  return *this;
+}
+
+MemoryCharge::~MemoryCharge() { Reset(); }
+
+void MemoryCharge::Reset() noexcept {
+  if (account_) account_->Release(bytes_);
+  account_.reset();
+  bytes_ = 0;
+}
+
+std::shared_ptr<MemoryAccount> GetCurrentMemoryAccount() noexcept {
+  const auto* account = kCurrentMemoryAccount.GetOptional();
+  return account ? *account : nullptr;
+}
+
+MemoryCharge ChargeCurrentMemoryAccount(std::size_t bytes) {
+  return MemoryCharge{GetCurrentMemoryAccount(), bytes};
+}
+
+MemoryCharge ForceChargeCurrentMemoryAccount(std::size_t bytes) noexcept {
+  return MemoryCharge::Force(GetCurrentMemoryAccount(), bytes);
+}
+
+MemoryAccountScope::MemoryAccountScope(std::shared_ptr<MemoryAccount> account)
+    : previous_(GetCurrentMemoryAccount()) {
+  kCurrentMemoryAccount.Set(std::move(account));
+}
+
+MemoryAccountScope::~MemoryAccountScope() {
+  if (previous_) {
+    kCurrentMemoryAccount.Set(std::move(previous_));
+  } else {
+    kCurrentMemoryAccount.Erase();
+  }
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
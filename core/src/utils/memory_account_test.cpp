@@ -0,0 +1,98 @@
+#include <userver/utils/memory_account.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(MemoryAccount, ChargesParents) {
+  auto handler = std::make_shared<utils::MemoryAccount>(100);
+  auto request = std::make_shared<utils::MemoryAccount>(std::nullopt, handler);
+
+  {
+    const utils::MemoryCharge charge{request, 60};
+    EXPECT_EQ(charge.GetBytes(), 60u);
+    EXPECT_EQ(request->GetCurrentBytes(), 60u);
+    EXPECT_EQ(handler->GetCurrentBytes(), 60u);
+
+    // The handler limit applies to the nested request account
+    UEXPECT_THROW(utils::MemoryCharge(request, 50), utils::MemoryLimitExceeded);
+    EXPECT_EQ(request->GetCurrentBytes(), 60u);
+    EXPECT_EQ(handler->GetCurrentBytes(), 60u);
+  }
+
+  EXPECT_EQ(request->GetCurrentBytes(), 0u);
+  EXPECT_EQ(handler->GetCurrentBytes(), 0u);
+}
+
+UTEST(MemoryAccount, ForceChargeGoesOverLimit) {
+  auto handler = std::make_shared<utils::MemoryAccount>(100);
+  auto request = std::make_shared<utils::MemoryAccount>(10, handler);
+
+  auto forced = utils::MemoryCharge::Force(request, 150);
+  EXPECT_EQ(handler->GetCurrentBytes(), 150u);
+  EXPECT_TRUE(request->IsOverLimit());
+  EXPECT_TRUE(handler->IsOverLimit());
+  EXPECT_FALSE(handler->TryCharge(1));
+
+  forced = {};
+  EXPECT_EQ(handler->GetCurrentBytes(), 0u);
+  EXPECT_FALSE(request->IsOverLimit());
+  EXPECT_TRUE(handler->TryCharge(100));
+  handler->Release(100);
+}
+
+UTEST(MemoryAccount, InheritedByChildTasks) {
+  EXPECT_EQ(utils::GetCurrentMemoryAccount(), nullptr);
+  // Charges nothing without an account
+  EXPECT_EQ(utils::ChargeCurrentMemoryAccount(10).GetBytes(), 0u);
+
+  auto account = std::make_shared<utils::MemoryAccount>(100);
+  {
+    const utils::MemoryAccountScope scope{account};
+    EXPECT_EQ(utils::GetCurrentMemoryAccount(), account);
+
+    auto charge = utils::Async("child", [] {
+                    return utils::ChargeCurrentMemoryAccount(30);
+                  }).Get();
+    EXPECT_EQ(account->GetCurrentBytes(), 30u);
+
+    UEXPECT_THROW(utils::Async("child",
+                               [] {
+                                 return utils::ChargeCurrentMemoryAccount(80);
+                               })
+                      .Get(),
+                  utils::MemoryLimitExceeded);
+  }
+
+  EXPECT_EQ(utils::GetCurrentMemoryAccount(), nullptr);
+  EXPECT_EQ(account->GetCurrentBytes(), 0u);
+}
+
+UTEST(MemoryAccount, Metrics) {
+  auto handler = std::make_shared<utils::MemoryAccount>(100);
+  auto request = std::make_shared<utils::MemoryAccount>(std::nullopt, handler);
+
+  {
+    const utils::MemoryCharge first{request, 40};
+    const utils::MemoryCharge second{request, 50};
+    EXPECT_FALSE(request->TryCharge(20));
+  }
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "memory", [&handler](utils::statistics::Writer& writer) {
+        writer = *handler;
+      });
+  const utils::statistics::Snapshot snapshot{storage, "memory"};
+  EXPECT_EQ(snapshot.SingleMetric("current-bytes").AsInt(), 0);
+  EXPECT_EQ(snapshot.SingleMetric("peak-bytes").AsInt(), 90);
+  EXPECT_EQ(snapshot.SingleMetric("limit-bytes").AsInt(), 100);
+  EXPECT_EQ(snapshot.SingleMetric("charged-bytes").AsRate().value, 90);
+  EXPECT_EQ(snapshot.SingleMetric("rejected").AsRate().value, 1);
+  holder.Unregister();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <userver/utils/parallel_algorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSize = 10'000'000;
+
+std::vector<std::uint64_t> MakeRandomVector() {
+  std::mt19937_64 rng{42};
+  std::vector<std::uint64_t> result(kSize);
+  for (auto& value : result) value = rng();
+  return result;
+}
+
+}  // namespace
+
+// Baseline for parallel_sort on a single coroutine
+void std_sort(benchmark::State& state) {
+  const auto values = MakeRandomVector();
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto copy = values;
+    state.ResumeTiming();
+
+    std::sort(copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy.data());
+  }
+}
+BENCHMARK(std_sort)->Unit(benchmark::kMillisecond);
+
+// Sort on `range(0)` worker threads
+void parallel_sort(benchmark::State& state) {
+  const std::size_t workers_count = state.range(0);
+  engine::RunStandalone(workers_count, [&] {
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    const auto values = MakeRandomVector();
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto copy = values;
+      state.ResumeTiming();
+
+      utils::ParallelSort(task_processor, "sort", workers_count, copy.begin(),
+                          copy.end());
+      benchmark::DoNotOptimize(copy.data());
+    }
+  });
+}
+BENCHMARK(parallel_sort)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond);
+
+// Transform on `range(0)` worker threads
+void parallel_transform(benchmark::State& state) {
+  const std::size_t workers_count = state.range(0);
+  engine::RunStandalone(workers_count, [&] {
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    const auto values = MakeRandomVector();
+    std::vector<double> result(values.size());
+    for (auto _ : state) {
+      utils::ParallelTransform(
+          task_processor, "transform", workers_count, values.begin(),
+          values.end(), result.begin(),
+          [](std::uint64_t value) { return static_cast<double>(value) / 3; });
+      benchmark::DoNotOptimize(result.data());
+    }
+  });
+}
+BENCHMARK(parallel_transform)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
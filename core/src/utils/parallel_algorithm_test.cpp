@@ -0,0 +1,126 @@
+#include <userver/utils/parallel_algorithm.hpp>
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkersCount = 4;
+
+auto& GetTaskProcessor() { return engine::current_task::GetTaskProcessor(); }
+
+std::vector<int> MakeRandomVector(std::size_t size) {
+  std::minstd_rand rng{42};
+  std::vector<int> result(size);
+  for (auto& value : result) value = static_cast<int>(rng() % 1000);
+  return result;
+}
+
+}  // namespace
+
+UTEST_MT(UtilsParallelAlgorithm, ForChunks, kWorkersCount) {
+  constexpr std::size_t kCount = 1000;
+  std::vector<std::atomic<int>> processed(kCount);
+
+  utils::ParallelForChunks(GetTaskProcessor(), "chunks", kCount, 64,
+                           kWorkersCount,
+                           [&](std::size_t begin, std::size_t end) {
+                             EXPECT_EQ(begin % 64, 0);
+                             EXPECT_LE(end - begin, 64);
+                             for (auto i = begin; i < end; ++i) ++processed[i];
+                           });
+
+  for (const auto& item : processed) EXPECT_EQ(item.load(), 1);
+}
+
+UTEST_MT(UtilsParallelAlgorithm, ForEach, kWorkersCount) {
+  std::vector<int> values(100'000, 1);
+  utils::ParallelForEach(GetTaskProcessor(), "for-each", kWorkersCount,
+                         values.begin(), values.end(),
+                         [](int& value) { value *= 3; });
+  EXPECT_EQ(std::count(values.begin(), values.end(), 3), values.size());
+}
+
+UTEST_MT(UtilsParallelAlgorithm, Transform, kWorkersCount) {
+  const auto values = MakeRandomVector(100'000);
+  std::vector<long> result(values.size());
+
+  const auto result_end = utils::ParallelTransform(
+      GetTaskProcessor(), "transform", kWorkersCount, values.begin(),
+      values.end(), result.begin(), [](int value) { return value * 2L; });
+
+  EXPECT_EQ(result_end, result.end());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(result[i], values[i] * 2L);
+  }
+}
+
+UTEST_MT(UtilsParallelAlgorithm, Reduce, kWorkersCount) {
+  const auto values = MakeRandomVector(100'000);
+
+  EXPECT_EQ(utils::ParallelReduce(GetTaskProcessor(), "reduce", kWorkersCount,
+                                  values.begin(), values.end(), 10L),
+            std::accumulate(values.begin(), values.end(), 10L));
+  EXPECT_EQ(utils::ParallelReduce(GetTaskProcessor(), "reduce", kWorkersCount,
+                                  values.begin(), values.begin(), 10L),
+            10L);
+}
+
+UTEST_MT(UtilsParallelAlgorithm, Sort, kWorkersCount) {
+  for (const std::size_t size : {0, 1, 1000, 1025, 10'000, 1'000'003}) {
+    auto values = MakeRandomVector(size);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    utils::ParallelSort(GetTaskProcessor(), "sort", kWorkersCount,
+                        values.begin(), values.end());
+    ASSERT_EQ(values, expected) << "size=" << size;
+
+    utils::ParallelSort(GetTaskProcessor(), "sort", kWorkersCount,
+                        values.begin(), values.end(), std::greater<>{});
+    std::reverse(expected.begin(), expected.end());
+    ASSERT_EQ(values, expected) << "size=" << size;
+  }
+}
+
+UTEST_MT(UtilsParallelAlgorithm, SortMoveOnly, kWorkersCount) {
+  const auto keys = MakeRandomVector(100'000);
+  std::vector<std::unique_ptr<int>> values;
+  values.reserve(keys.size());
+  for (const auto key : keys) values.push_back(std::make_unique<int>(key));
+
+  utils::ParallelSort(
+      GetTaskProcessor(), "sort", kWorkersCount, values.begin(), values.end(),
+      [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; });
+
+  ASSERT_TRUE(values.front());
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    ASSERT_TRUE(values[i]);
+    ASSERT_LE(*values[i - 1], *values[i]);
+  }
+}
+
+UTEST_MT(UtilsParallelAlgorithm, Exception, kWorkersCount) {
+  std::vector<int> values(100'000);
+  std::iota(values.begin(), values.end(), 0);
+
+  UEXPECT_THROW_MSG(utils::ParallelForEach(GetTaskProcessor(), "for-each",
+                                           kWorkersCount, values.begin(),
+                                           values.end(),
+                                           [](int value) {
+                                             if (value == 5000) {
+                                               throw std::runtime_error("5000");
+                                             }
+                                           }),
+                    std::runtime_error, "5000");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <userver/utils/parallel_for.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(UtilsParallelFor, Sample, 4) {
+  /// [Sample utils::ParallelFor usage]
+  const std::vector<int> requests{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  std::vector<int> responses(requests.size());
+
+  utils::ParallelFor("handle-request", requests.size(), 3,
+                     [&](std::size_t i) { responses[i] = requests[i] * 2; });
+  /// [Sample utils::ParallelFor usage]
+
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    EXPECT_EQ(responses[i], requests[i] * 2);
+  }
+}
+
+UTEST(UtilsParallelFor, Empty) {
+  utils::ParallelFor("empty", 0, 1, [](std::size_t) { FAIL(); });
+}
+
+UTEST_MT(UtilsParallelFor, MaxParallelism, 4) {
+  constexpr std::size_t kCount = 100;
+  constexpr std::size_t kMaxParallelism = 3;
+
+  std::atomic<std::size_t> running{0};
+  std::atomic<std::size_t> max_running{0};
+  std::vector<std::atomic<int>> processed(kCount);
+
+  utils::ParallelFor("worker", kCount, kMaxParallelism, [&](std::size_t i) {
+    const auto now_running = ++running;
+    auto old_max = max_running.load();
+    while (old_max < now_running &&
+           !max_running.compare_exchange_weak(old_max, now_running)) {
+    }
+    engine::Yield();
+    ++processed[i];
+    --running;
+  });
+
+  EXPECT_LE(max_running.load(), kMaxParallelism);
+  for (const auto& item : processed) EXPECT_EQ(item.load(), 1);
+}
+
+UTEST_MT(UtilsParallelFor, FailureCancelsSiblings, 4) {
+  constexpr std::size_t kCount = 1000;
+
+  std::atomic<std::size_t> started{0};
+  UEXPECT_THROW_MSG(
+      utils::ParallelFor("worker", kCount, 3,
+                         [&](std::size_t i) {
+                           ++started;
+                           if (i == 0) throw std::runtime_error("failure");
+
+                           // Only wakes up due to the cancellation
+                           engine::SingleConsumerEvent event;
+                           [[maybe_unused]] const bool ok =
+                               event.WaitForEventFor(utest::kMaxTestWaitTime);
+                         }),
+      std::runtime_error, "failure");
+
+  EXPECT_LT(started.load(), kCount);
+}
+
+UTEST(UtilsParallelFor, CallerCancelled) {
+  engine::current_task::GetCancellationToken().RequestCancel();
+
+  UEXPECT_THROW(utils::ParallelFor("worker", 10, 2,
+                                   [](std::size_t) {
+                                     engine::InterruptibleSleepFor(
+                                         utest::kMaxTestWaitTime);
+                                   }),
+                engine::WaitInterruptedException);
+}
+
+USERVER_NAMESPACE_END
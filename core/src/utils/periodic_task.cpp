@@ -1,5 +1,6 @@
 #include <userver/utils/periodic_task.hpp>
 
+#include <algorithm>
 #include <random>
 
 #include <fmt/format.h>
@@ -10,6 +11,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <compiler/tls.hpp>
 
@@ -19,6 +21,9 @@ namespace utils {
 
 namespace {
 
+// How often the task processor load is checked while an execution is deferred
+constexpr std::chrono::milliseconds kOverloadCheckPeriod{100};
+
 USERVER_PREVENT_TLS_CACHING
 std::minstd_rand& GetFastRandomBitsGenerator() {
   thread_local std::minstd_rand rand{utils::Rand()};
@@ -138,11 +143,16 @@ void PeriodicTask::Run() {
     }
   }
 
+  bool is_forced_step = false;
   while (!engine::current_task::ShouldCancel()) {
     const auto before = std::chrono::steady_clock::now();
     bool no_exception = true;
 
     if (!std::exchange(skip_step, false)) {
+      if (!std::exchange(is_forced_step, false)) {
+        WaitForNoOverload();
+        if (engine::current_task::ShouldCancel()) break;
+      }
       no_exception = Step();
     }
 
@@ -161,6 +171,7 @@ void PeriodicTask::Run() {
 
     while (changed_event_.WaitForEventUntil(start + MutatePeriod(period))) {
       if (should_force_step_.exchange(false)) {
+        is_forced_step = true;
         break;
       }
       // The config variable value has been changed, reload
@@ -199,6 +210,60 @@ bool PeriodicTask::Step() {
   return DoStep();
 }
 
+void PeriodicTask::WaitForNoOverload() {
+  std::chrono::microseconds max_queue_wait_time{};
+  engine::Deadline deadline;
+  {
+    const auto settings = settings_.Read();
+    if (!settings->max_queue_wait_time) return;
+    max_queue_wait_time = *settings->max_queue_wait_time;
+    deadline = engine::Deadline::FromDuration(settings->max_overload_delay);
+  }
+
+  std::optional<std::chrono::steady_clock::time_point> deferral_start;
+  while (!engine::current_task::ShouldCancel()) {
+    // The time to get back from the end of the task processor queue
+    const auto yield_start = std::chrono::steady_clock::now();
+    engine::Yield();
+    const auto queue_wait_time = std::chrono::steady_clock::now() - yield_start;
+    if (queue_wait_time <= max_queue_wait_time || deadline.IsReached()) break;
+
+    // Logged once per deferral, the load is rechecked much more often
+    if (!deferral_start) {
+      deferral_start = yield_start;
+      deferred_steps_.Add(utils::statistics::Rate{1});
+      const auto name_ptr = name_.Read();
+      LOG_INFO() << "Deferring PeriodicTask with name=" << *name_ptr
+                 << ", the task processor queue wait time is "
+                 << std::chrono::duration_cast<std::chrono::microseconds>(
+                        queue_wait_time)
+                        .count()
+                 << "us";
+    }
+
+    const auto check_deadline = std::min(
+        deadline, engine::Deadline::FromDuration(kOverloadCheckPeriod));
+    if (changed_event_.WaitForEventUntil(check_deadline) &&
+        should_force_step_.exchange(false)) {
+      break;
+    }
+  }
+
+  if (deferral_start) {
+    const auto name_ptr = name_.Read();
+    LOG_INFO() << "Resuming PeriodicTask with name=" << *name_ptr
+               << " after deferring it for "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - *deferral_start)
+                      .count()
+               << "ms";
+  }
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const PeriodicTask& task) {
+  writer["deferred-steps"] = task.deferred_steps_;
+}
+
 bool PeriodicTask::StepDebug(bool preserve_span) {
   std::lock_guard<engine::Mutex> lock_step(step_mutex_);
 
@@ -8,6 +8,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 using namespace std::chrono_literals;
 
@@ -340,6 +342,68 @@ UTEST(PeriodicTask, ForceStepAsyncPeriod) {
   task.Stop();
 }
 
+UTEST(PeriodicTask, OverloadDelay) {
+  SimpleTaskData simple;
+
+  constexpr auto kMaxOverloadDelay = 100ms;
+  utils::PeriodicTask::Settings settings(utest::kMaxTestWaitTime,
+                                         utils::PeriodicTask::Flags::kNow);
+  // Any queue wait time is considered to be an overload
+  settings.max_queue_wait_time = 0us;
+  settings.max_overload_delay = kMaxOverloadDelay;
+
+  const auto start = std::chrono::steady_clock::now();
+  utils::PeriodicTask task("task", settings, simple.GetTaskFunction());
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple]() { return simple.GetCount() > 0; }));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, kMaxOverloadDelay);
+
+  task.Stop();
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "periodic", [&task](utils::statistics::Writer& writer) {
+        writer = task;
+      });
+  // A single deferral, however many times the load was rechecked
+  EXPECT_EQ(utils::statistics::Snapshot(storage, "periodic")
+                .SingleMetric("deferred-steps")
+                .AsRate()
+                .value,
+            1);
+  holder.Unregister();
+}
+
+UTEST(PeriodicTask, OverloadDelayForceStep) {
+  SimpleTaskData simple;
+
+  utils::PeriodicTask::Settings settings(utest::kMaxTestWaitTime);
+  settings.max_queue_wait_time = 0us;
+  settings.max_overload_delay = utest::kMaxTestWaitTime;
+  utils::PeriodicTask task("task", settings, simple.GetTaskFunction());
+
+  task.ForceStepAsync();
+  EXPECT_TRUE(
+      simple.WaitFor(100ms, [&simple]() { return simple.GetCount() == 1; }));
+
+  task.Stop();
+}
+
+UTEST(PeriodicTask, NoOverload) {
+  SimpleTaskData simple;
+
+  utils::PeriodicTask::Settings settings(utest::kMaxTestWaitTime,
+                                         utils::PeriodicTask::Flags::kNow);
+  settings.max_queue_wait_time = utest::kMaxTestWaitTime;
+  settings.max_overload_delay = utest::kMaxTestWaitTime;
+  utils::PeriodicTask task("task", settings, simple.GetTaskFunction());
+
+  EXPECT_TRUE(
+      simple.WaitFor(100ms, [&simple]() { return simple.GetCount() > 0; }));
+
+  task.Stop();
+}
+
 UTEST(PeriodicTask, StopStop) {
   SimpleTaskData simple;
 
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+#include <fmt/format.h>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+// Big enough to amortize the chunk push, small enough to not keep the whole
+// output of a huge Storage in memory.
+inline constexpr std::size_t kChunkSize = 64 * 1024;
+
+enum class IsLastChunk { kNo, kYes };
+
+// Passes the accumulated data to `consumer` if there is enough of it or if
+// it is the last chunk. Does nothing if there is no `consumer`.
+inline void FlushChunk(fmt::memory_buffer& buf, const ChunkConsumer* consumer,
+                       IsLastChunk is_last = IsLastChunk::kNo) {
+  if (!consumer) return;
+  if (buf.size() < kChunkSize &&
+      (is_last == IsLastChunk::kNo || buf.size() == 0)) {
+    return;
+  }
+
+  (*consumer)(fmt::to_string(buf));
+  buf.clear();
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,8 @@
 #include <userver/utils/statistics/fmt.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
+#include <utils/statistics/chunked_output.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::statistics {
@@ -28,8 +30,9 @@ void AppendGraphiteSafe(fmt::memory_buffer& out, std::string_view value) {
 
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
-  FormatBuilder()
-      : ending_(fmt::format(FMT_COMPILE(" {}\n"),
+  explicit FormatBuilder(const ChunkConsumer* consumer = nullptr)
+      : consumer_(consumer),
+        ending_(fmt::format(FMT_COMPILE(" {}\n"),
                             std::chrono::duration_cast<std::chrono::seconds>(
                                 utils::datetime::MockNow().time_since_epoch())
                                 .count())) {}
@@ -44,10 +47,13 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}"), value);
     buf_.append(ending_);
+    impl::FlushChunk(buf_, consumer_);
   }
 
   std::string Release() { return fmt::to_string(buf_); }
 
+  void Finish() { impl::FlushChunk(buf_, consumer_, impl::IsLastChunk::kYes); }
+
  private:
   void PutLabel(const LabelView& label) {
     buf_.push_back(';');
@@ -57,6 +63,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     AppendGraphiteSafe(buf_, label.Value());
   }
 
+  const ChunkConsumer* const consumer_;
   const std::string ending_;
   fmt::memory_buffer buf_;
 };
@@ -70,6 +77,14 @@ std::string ToGraphiteFormat(const utils::statistics::Storage& statistics,
   return builder.Release();
 }
 
+void ToGraphiteFormat(const utils::statistics::Storage& statistics,
+                      const utils::statistics::Request& request,
+                      const ChunkConsumer& consumer) {
+  FormatBuilder builder{&consumer};
+  statistics.VisitMetrics(builder, request);
+  builder.Finish();
+}
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
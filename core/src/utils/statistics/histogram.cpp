@@ -0,0 +1,105 @@
+#include <userver/utils/statistics/histogram.hpp>
+
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+void HistogramSnapshot::Account(std::uint64_t value,
+                                std::uint64_t count) noexcept {
+  buckets_[GetBucketIndex(value)] += count;
+  sum_ += value * count;
+}
+
+std::uint64_t HistogramSnapshot::GetCount() const noexcept {
+  std::uint64_t result = 0;
+  for (const auto value : buckets_) result += value;
+  return result;
+}
+
+std::uint64_t HistogramSnapshot::GetPercentile(double percent) const noexcept {
+  const auto count = GetCount();
+  if (count == 0) return 0;
+
+  const auto want_sum = static_cast<double>(count) * percent;
+  std::uint64_t sum = 0;
+  std::size_t max_index = 0;
+  for (std::size_t i = 0; i < buckets_.size(); ++i) {
+    sum += buckets_[i];
+    if (static_cast<double>(sum) * 100 > want_sum) {
+      return GetBucketUpperBound(i);
+    }
+    if (buckets_[i]) max_index = i;
+  }
+
+  return GetBucketUpperBound(max_index);
+}
+
+HistogramSnapshot& HistogramSnapshot::operator+=(
+    const HistogramSnapshot& other) noexcept {
+  for (std::size_t i = 0; i < buckets_.size(); ++i) {
+    buckets_[i] += other.buckets_[i];
+  }
+  sum_ += other.sum_;
+  return *this;
+}
+
+HistogramSnapshot& HistogramSnapshot::operator+=(
+    const Histogram& other) noexcept {
+  for (const auto& shard : other.shards_) {
+    for (std::size_t i = 0; i < buckets_.size(); ++i) {
+      buckets_[i] += shard.buckets[i].load(std::memory_order_relaxed);
+    }
+    sum_ += shard.sum.load(std::memory_order_relaxed);
+  }
+  return *this;
+}
+
+Histogram::Histogram(const Histogram& other) noexcept { *this = other; }
+
+Histogram& Histogram::operator=(const Histogram& other) noexcept {
+  if (this == &other) return *this;
+
+  for (std::size_t shard = 0; shard < kShardsCount; ++shard) {
+    auto& to = shards_[shard];
+    const auto& from = other.shards_[shard];
+    for (std::size_t i = 0; i < to.buckets.size(); ++i) {
+      to.buckets[i].store(from.buckets[i].load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+    }
+    to.sum.store(from.sum.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+  }
+  return *this;
+}
+
+void Histogram::Account(std::uint64_t value, std::uint64_t count) noexcept {
+  auto& shard = shards_[impl::GetThreadShardIndex() % kShardsCount];
+  shard.buckets[HistogramSnapshot::GetBucketIndex(value)].fetch_add(
+      count, std::memory_order_relaxed);
+  shard.sum.fetch_add(value * count, std::memory_order_relaxed);
+}
+
+HistogramSnapshot Histogram::GetSnapshot() const noexcept {
+  HistogramSnapshot result;
+  result += *this;
+  return result;
+}
+
+void Histogram::Reset() noexcept {
+  for (auto& shard : shards_) {
+    for (auto& bucket : shard.buckets) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    shard.sum.store(0, std::memory_order_relaxed);
+  }
+}
+
+void DumpMetric(Writer& writer, const Histogram& histogram) {
+  writer = histogram.GetSnapshot();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
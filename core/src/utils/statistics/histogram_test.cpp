@@ -0,0 +1,172 @@
+#include <userver/utils/statistics/histogram.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using utils::statistics::Histogram;
+using utils::statistics::HistogramSnapshot;
+
+class PercentilesBuilder final
+    : public utils::statistics::BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path,
+                    utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue& value) override {
+    ASSERT_EQ(path, "histogram");
+    ASSERT_EQ(labels.size(), 1);
+    ASSERT_EQ(labels.begin()->Name(), "percentile");
+    result_.emplace(labels.begin()->Value(), value.AsInt());
+  }
+
+  const std::map<std::string, std::int64_t>& GetResult() const {
+    return result_;
+  }
+
+ private:
+  std::map<std::string, std::int64_t> result_;
+};
+
+}  // namespace
+
+TEST(Histogram, BucketIndex) {
+  for (std::uint64_t value = 0; value < 8; ++value) {
+    EXPECT_EQ(HistogramSnapshot::GetBucketIndex(value), value);
+    EXPECT_EQ(HistogramSnapshot::GetBucketUpperBound(value), value);
+  }
+
+  std::size_t prev_index = 7;
+  for (std::uint64_t value = 8; value < 100'000; ++value) {
+    const auto index = HistogramSnapshot::GetBucketIndex(value);
+    const auto upper = HistogramSnapshot::GetBucketUpperBound(index);
+    ASSERT_TRUE(index == prev_index || index == prev_index + 1) << value;
+    ASSERT_GE(upper, value);
+    ASSERT_LE(upper - value, value / HistogramSnapshot::kSubBucketsCount);
+    if (index != prev_index) {
+      ASSERT_EQ(HistogramSnapshot::GetBucketUpperBound(prev_index) + 1, value);
+    }
+    prev_index = index;
+  }
+
+  constexpr std::uint64_t kMaxValue = std::uint64_t{1}
+                                      << HistogramSnapshot::kMaxValueBits;
+  EXPECT_EQ(HistogramSnapshot::GetBucketIndex(kMaxValue - 1),
+            HistogramSnapshot::kBucketsCount - 2);
+  EXPECT_EQ(HistogramSnapshot::GetBucketUpperBound(
+                HistogramSnapshot::kBucketsCount - 2),
+            kMaxValue - 1);
+  EXPECT_EQ(HistogramSnapshot::GetBucketIndex(kMaxValue),
+            HistogramSnapshot::kBucketsCount - 1);
+  EXPECT_EQ(HistogramSnapshot::GetBucketIndex(~std::uint64_t{0}),
+            HistogramSnapshot::kBucketsCount - 1);
+}
+
+TEST(Histogram, Percentiles) {
+  Histogram histogram;
+  for (std::uint64_t value = 1; value <= 1000; ++value) {
+    histogram.Account(value);
+  }
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.GetCount(), 1000);
+  EXPECT_EQ(snapshot.GetSum(), 500'500);
+  EXPECT_EQ(snapshot.GetPercentile(0), 1);
+  EXPECT_EQ(snapshot.GetPercentile(100), 1023);
+
+  const auto p50 = snapshot.GetPercentile(50);
+  EXPECT_GE(p50, 500);
+  EXPECT_LE(p50, 500 + 500 / 8);
+
+  const auto p99 = snapshot.GetPercentile(99);
+  EXPECT_GE(p99, 990);
+  EXPECT_LE(p99, 990 + 990 / 8);
+
+  histogram.Reset();
+  EXPECT_EQ(histogram.GetSnapshot().GetCount(), 0);
+  EXPECT_EQ(histogram.GetSnapshot().GetPercentile(50), 0);
+}
+
+UTEST_MT(Histogram, ConcurrentAccount, 4) {
+  constexpr std::uint64_t kIterations = 10'000;
+  Histogram histogram;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&histogram] {
+      for (std::uint64_t value = 0; value < kIterations; ++value) {
+        histogram.Account(value);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.GetCount(), kIterations * GetThreadCount());
+  EXPECT_EQ(snapshot.GetSum(),
+            kIterations * (kIterations - 1) / 2 * GetThreadCount());
+}
+
+TEST(Histogram, Merge) {
+  Histogram first;
+  Histogram second;
+  first.Account(10, 3);
+  second.Account(1'000'000);
+
+  HistogramSnapshot merged;
+  merged += first;
+  merged += second.GetSnapshot();
+  EXPECT_EQ(merged.GetCount(), 4);
+  EXPECT_EQ(merged.GetSum(), 1'000'030);
+  EXPECT_EQ(merged.GetPercentile(50), 10);
+  EXPECT_GE(merged.GetPercentile(100), 1'000'000);
+
+  utils::statistics::RecentPeriod<Histogram, HistogramSnapshot> recent;
+  recent.GetCurrentCounter().Account(42);
+  EXPECT_EQ(recent.GetStatsForPeriod().GetCount(), 1);
+}
+
+UTEST(Histogram, Prometheus) {
+  Histogram histogram;
+  histogram.Account(3, 2);
+  histogram.Account(100);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter("histogram", [&](auto& writer) {
+    writer.ValueWithLabels(histogram, {"label", "value"});
+  });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage),
+            "# TYPE histogram histogram\n"
+            "histogram_bucket{label=\"value\",le=\"3\"} 2\n"
+            "histogram_bucket{label=\"value\",le=\"103\"} 3\n"
+            "histogram_bucket{label=\"value\",le=\"+Inf\"} 3\n"
+            "histogram_sum{label=\"value\"} 106\n"
+            "histogram_count{label=\"value\"} 3\n");
+}
+
+UTEST(Histogram, DefaultPercentiles) {
+  Histogram histogram;
+  histogram.Account(5, 99);
+  histogram.Account(1000);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "histogram", [&](auto& writer) { writer = histogram; });
+
+  PercentilesBuilder builder;
+  storage.VisitMetrics(builder);
+  const auto& result = builder.GetResult();
+  EXPECT_EQ(result.size(), 9);
+  EXPECT_EQ(result.at("p0"), 5);
+  EXPECT_EQ(result.at("p98"), 5);
+  EXPECT_EQ(result.at("p99_9"), 1023);
+  EXPECT_EQ(result.at("p100"), 1023);
+}
+
+USERVER_NAMESPACE_END
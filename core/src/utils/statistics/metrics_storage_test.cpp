@@ -1,8 +1,13 @@
 #include <userver/utils/statistics/metrics_storage.hpp>
 
 #include <atomic>
+#include <vector>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/sharded_metric.hpp>
 #include <userver/utils/statistics/storage.hpp>
 #include <userver/utils/statistics/testing.hpp>
 
@@ -24,6 +29,36 @@ void DumpMetric(utils::statistics::Writer& writer, const MetricWritable& m) {
 
 utils::statistics::MetricTag<MetricWritable> kWriterMetric{"writer-metric"};
 
+/// [ShardedMetric sample]
+struct RequestsMetric {
+  utils::statistics::RelaxedCounter<int> ok{0};
+  utils::statistics::RelaxedCounter<int> errors{0};
+};
+
+RequestsMetric& operator+=(RequestsMetric& lhs, const RequestsMetric& rhs) {
+  lhs.ok += rhs.ok.Load();
+  lhs.errors += rhs.errors.Load();
+  return lhs;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const RequestsMetric& m) {
+  writer["ok"] = m.ok.Load();
+  writer["errors"] = m.errors.Load();
+}
+
+void ResetMetric(RequestsMetric& m) {
+  m.ok = 0;
+  m.errors = 0;
+}
+
+utils::statistics::MetricTag<utils::statistics::ShardedMetric<RequestsMetric>>
+    kShardedMetric{"sharded-metric"};
+
+void AccountRequest(utils::statistics::MetricsStorage& metrics_storage) {
+  ++metrics_storage.GetMetric(kShardedMetric).GetLocal().ok;
+}
+/// [ShardedMetric sample]
+
 }  // namespace
 
 UTEST(MetricsStorage, Smoke) {
@@ -59,4 +94,31 @@ UTEST(MetricsStorage, SmokeWriter) {
   }
 }
 
+UTEST_MT(MetricsStorage, Sharded, 4) {
+  constexpr int kTasks = 8;
+  constexpr int kIterations = 1000;
+
+  utils::statistics::Storage storage;
+  utils::statistics::MetricsStorage metrics_storage;
+  const auto statistic_holders = metrics_storage.RegisterIn(storage);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&metrics_storage] {
+      for (int j = 0; j < kIterations; ++j) AccountRequest(metrics_storage);
+    }));
+  }
+  engine::GetAll(tasks);
+  ++metrics_storage.GetMetric(kShardedMetric).GetLocal().errors;
+
+  utils::statistics::Snapshot snap{storage};
+  EXPECT_EQ(snap.SingleMetric("sharded-metric.ok").AsInt(),
+            kTasks * kIterations);
+  EXPECT_EQ(snap.SingleMetric("sharded-metric.errors").AsInt(), 1);
+
+  metrics_storage.ResetMetrics();
+  utils::statistics::Snapshot reset_snap{storage};
+  EXPECT_EQ(reset_snap.SingleMetric("sharded-metric.ok").AsInt(), 0);
+}
+
 USERVER_NAMESPACE_END
@@ -10,12 +10,72 @@
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
+#include <utils/statistics/chunked_output.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::statistics {
 
+struct PrometheusCache::Impl final {
+  // Entries that were not used during this count of the scrapes are dropped
+  static constexpr std::uint64_t kMaxUnusedScrapes = 16;
+
+  struct Labels final {
+    std::string rendered;
+    std::uint64_t last_used;
+  };
+
+  struct Metric final {
+    std::string name;
+    utils::impl::TransparentMap<std::string, Labels> labels;
+    std::uint64_t last_used{0};
+    std::uint64_t typed{0};
+  };
+
+  explicit Impl(bool cache_labels) : cache_labels(cache_labels) {}
+
+  void StartScrape() noexcept { ++scrape; }
+
+  void DropUnused() {
+    if (scrape % kMaxUnusedScrapes != 0) return;
+
+    for (auto it = metrics.begin(); it != metrics.end();) {
+      auto& metric = it->second;
+      if (scrape - metric.last_used >= kMaxUnusedScrapes) {
+        it = metrics.erase(it);
+        continue;
+      }
+
+      for (auto labels_it = metric.labels.begin();
+           labels_it != metric.labels.end();) {
+        if (scrape - labels_it->second.last_used >= kMaxUnusedScrapes) {
+          labels_it = metric.labels.erase(labels_it);
+        } else {
+          ++labels_it;
+        }
+      }
+      ++it;
+    }
+  }
+
+  const bool cache_labels;
+  std::uint64_t scrape{0};
+  utils::impl::TransparentMap<std::string, Metric> metrics;
+  std::string labels_key;
+};
+
+PrometheusCache::PrometheusCache() : impl_(std::make_unique<Impl>(true)) {}
+
+PrometheusCache::PrometheusCache(PrometheusCache&&) noexcept = default;
+
+PrometheusCache& PrometheusCache::operator=(PrometheusCache&&) noexcept =
+    default;
+
+PrometheusCache::~PrometheusCache() = default;
+
 namespace impl {
 
 namespace {
@@ -25,43 +85,136 @@ enum class Typed { kYes, kNo };
 template <Typed IsTyped>
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
-  explicit FormatBuilder() = default;
+  FormatBuilder(PrometheusCache::Impl& cache, const ChunkConsumer* consumer)
+      : cache_(cache), consumer_(consumer) {
+    cache_.StartScrape();
+  }
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
-    DumpMetricNameAndType(path, value);
-    DumpLabels(labels);
+    auto& metric = GetMetric(path);
+    DumpMetricType(metric, value);
+    buf_.append(metric.name);
+    DumpLabels(metric, labels);
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
+    FlushChunk(buf_, consumer_);
+  }
+
+  // Native histograms require the protobuf exposition format, so the classic
+  // cumulative buckets are written with the log-linear `le` boundaries. Only
+  // the non-empty buckets are written to keep the output small.
+  void HandleHistogram(std::string_view path,
+                       utils::statistics::LabelsSpan labels,
+                       const HistogramSnapshot& value) override {
+    auto& metric = GetMetric(path);
+    DumpMetricType(metric, "histogram");
+    const auto& name = metric.name;
+
+    std::uint64_t count = 0;
+    for (std::size_t i = 0; i + 1 < HistogramSnapshot::kBucketsCount; ++i) {
+      const auto bucket = value.GetBucket(i);
+      if (bucket == 0) continue;
+
+      count += bucket;
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket"), name);
+      DumpLabels(labels, HistogramSnapshot::GetBucketUpperBound(i));
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), count);
+    }
+    count += value.GetBucket(HistogramSnapshot::kBucketsCount - 1);
+
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_bucket"), name);
+    DumpLabels(labels, "+Inf");
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), count);
+
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_sum"), name);
+    DumpLabels(metric, labels);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"),
+                   value.GetSum());
+
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}_count"), name);
+    DumpLabels(metric, labels);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), count);
+    FlushChunk(buf_, consumer_);
   }
 
   std::string Release() { return fmt::to_string(buf_); }
 
+  void Finish() {
+    FlushChunk(buf_, consumer_, IsLastChunk::kYes);
+    cache_.DropUnused();
+  }
+
  private:
-  void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
-    if (const auto* const converted =
-            utils::impl::FindTransparentOrNullptr(metrics_, name)) {
-      buf_.append(*converted);
-      return;
-    }
+  using Metric = PrometheusCache::Impl::Metric;
 
-    auto prometheus_name = impl::ToPrometheusName(name);
-    DumpMetricType(prometheus_name, value);
-    buf_.append(prometheus_name);
-    metrics_.emplace(name, std::move(prometheus_name));
+  Metric& GetMetric(std::string_view path) {
+    auto* metric = utils::impl::FindTransparentOrNullptr(cache_.metrics, path);
+    if (!metric) {
+      metric = &cache_.metrics[std::string{path}];
+      metric->name = impl::ToPrometheusName(path);
+    }
+    metric->last_used = cache_.scrape;
+    return *metric;
   }
 
-  void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
+  // The type is written once per scrape, before the first sample of the
+  // metric
+  void DumpMetricType([[maybe_unused]] Metric& metric,
                       [[maybe_unused]] const MetricValue& value) {
     if constexpr (IsTyped == Typed::kYes) {
-      const auto type = value.Visit(utils::Overloaded{
-          [](const Rate&) -> std::string_view { return "counter"; },
-          [](const auto&) -> std::string_view { return "gauge"; }});
+      DumpMetricType(metric, value.Visit(utils::Overloaded{
+                                 [](const Rate&) -> std::string_view {
+                                   return "counter";
+                                 },
+                                 [](const auto&) -> std::string_view {
+                                   return "gauge";
+                                 }}));
+    }
+  }
+
+  void DumpMetricType([[maybe_unused]] Metric& metric,
+                      [[maybe_unused]] std::string_view type) {
+    if constexpr (IsTyped == Typed::kYes) {
+      if (metric.typed == cache_.scrape) return;
+      metric.typed = cache_.scrape;
       fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"),
-                     prometheus_name, type);
+                     metric.name, type);
     }
   }
 
-  void DumpLabels(utils::statistics::LabelsSpan labels) {
+  void DumpLabels(Metric& metric, utils::statistics::LabelsSpan labels) {
+    if (!cache_.cache_labels) {
+      DumpLabels(labels);
+      return;
+    }
+
+    auto& key = cache_.labels_key;
+    key.clear();
+    for (const auto& label : labels) {
+      key.append(label.Name());
+      key.push_back('\0');
+      key.append(label.Value());
+      key.push_back('\0');
+    }
+
+    if (auto* const cached =
+            utils::impl::FindTransparentOrNullptr(metric.labels, key)) {
+      cached->last_used = cache_.scrape;
+      buf_.append(cached->rendered);
+      return;
+    }
+
+    const auto begin = buf_.size();
+    DumpLabels(labels);
+    metric.labels.emplace(
+        key, PrometheusCache::Impl::Labels{
+                 std::string(buf_.data() + begin, buf_.size() - begin),
+                 cache_.scrape});
+  }
+
+  template <class Bound = std::nullptr_t>
+  void DumpLabels(utils::statistics::LabelsSpan labels,
+                  [[maybe_unused]] const Bound& le = nullptr) {
     buf_.push_back('{');
     bool sep = false;
     for (const auto& label : labels) {
@@ -76,13 +229,37 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       buf_.push_back('"');
       sep = true;
     }
+    if constexpr (!std::is_same_v<Bound, std::nullptr_t>) {
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}le=\"{}\""),
+                     sep ? "," : "", le);
+    }
     buf_.push_back('}');
   }
 
+  PrometheusCache::Impl& cache_;
+  const ChunkConsumer* const consumer_;
   fmt::memory_buffer buf_;
-  utils::impl::TransparentMap<std::string, std::string> metrics_;
 };
 
+template <Typed IsTyped>
+std::string ToString(const utils::statistics::Storage& statistics,
+                     const utils::statistics::Request& request) {
+  // Names are cached for the duration of a single scrape only
+  PrometheusCache::Impl cache{/*cache_labels=*/false};
+  FormatBuilder<IsTyped> builder{cache, nullptr};
+  statistics.VisitMetrics(builder, request);
+  return builder.Release();
+}
+
+template <Typed IsTyped>
+void ToChunks(const utils::statistics::Storage& statistics,
+              const utils::statistics::Request& request,
+              PrometheusCache::Impl& cache, const ChunkConsumer& consumer) {
+  FormatBuilder<IsTyped> builder{cache, &consumer};
+  statistics.VisitMetrics(builder, request);
+  builder.Finish();
+}
+
 }  // namespace
 
 std::string ToPrometheusName(std::string_view data) {
@@ -119,17 +296,28 @@ std::string ToPrometheusLabel(std::string_view name) {
 
 std::string ToPrometheusFormat(const utils::statistics::Storage& statistics,
                                const utils::statistics::Request& request) {
-  impl::FormatBuilder<impl::Typed::kYes> builder{};
-  statistics.VisitMetrics(builder, request);
-  return builder.Release();
+  return impl::ToString<impl::Typed::kYes>(statistics, request);
 }
 
 std::string ToPrometheusFormatUntyped(
     const utils::statistics::Storage& statistics,
     const utils::statistics::Request& request) {
-  impl::FormatBuilder<impl::Typed::kNo> builder{};
-  statistics.VisitMetrics(builder, request);
-  return builder.Release();
+  return impl::ToString<impl::Typed::kNo>(statistics, request);
+}
+
+void ToPrometheusFormat(const utils::statistics::Storage& statistics,
+                        const utils::statistics::Request& request,
+                        PrometheusCache& cache, const ChunkConsumer& consumer) {
+  impl::ToChunks<impl::Typed::kYes>(statistics, request, *cache.impl_,
+                                    consumer);
+}
+
+void ToPrometheusFormatUntyped(const utils::statistics::Storage& statistics,
+                               const utils::statistics::Request& request,
+                               PrometheusCache& cache,
+                               const ChunkConsumer& consumer) {
+  impl::ToChunks<impl::Typed::kNo>(statistics, request, *cache.impl_,
+                                   consumer);
 }
 
 }  // namespace utils::statistics
@@ -413,6 +413,40 @@ child{application="processing"} 8
   }
 }
 
+UTEST(MetricsPrometheus, StreamingWithCache) {
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter("big", [](Writer& writer) {
+    for (int i = 0; i < 10'000; ++i) {
+      writer["metric"].ValueWithLabels(
+          i, {{"index", std::to_string(i)}, {"la:bel", "\"quoted\""}});
+    }
+    writer["rate"] = Rate{42};
+  });
+
+  const auto expected = ToPrometheusFormat(storage);
+  const auto expected_untyped = ToPrometheusFormatUntyped(storage);
+  EXPECT_NE(expected, expected_untyped);
+
+  PrometheusCache cache;
+  for (int scrape = 0; scrape < 3; ++scrape) {
+    std::string result;
+    std::size_t chunks = 0;
+    const auto consumer = [&](std::string&& chunk) {
+      EXPECT_FALSE(chunk.empty());
+      result += chunk;
+      ++chunks;
+    };
+
+    ToPrometheusFormat(storage, {}, cache, consumer);
+    EXPECT_EQ(result, expected);
+    EXPECT_GT(chunks, 1);
+
+    result.clear();
+    ToPrometheusFormatUntyped(storage, {}, cache, consumer);
+    EXPECT_EQ(result, expected_untyped);
+  }
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
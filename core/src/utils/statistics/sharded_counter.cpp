@@ -0,0 +1,40 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+namespace {
+
+std::atomic<std::size_t> next_shard_index{0};
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t shard_index = 0;
+thread_local USERVER_IMPL_CONSTINIT bool has_shard_index = false;
+
+}  // namespace
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetThreadShardIndex() noexcept {
+  if (!has_shard_index) {
+    shard_index = next_shard_index.fetch_add(1, std::memory_order_relaxed);
+    has_shard_index = true;
+  }
+  return shard_index;
+}
+
+}  // namespace impl
+
+void DumpMetric(Writer& writer, const ShardedRateCounter& value) {
+  writer = value.Load();
+}
+
+void ResetMetric(ShardedRateCounter& value) { value.Store(Rate{0}); }
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::statistics::RelaxedCounter<std::uint64_t> relaxed_counter;
+utils::statistics::ShardedRelaxedCounter<std::uint64_t> sharded_counter;
+
+}  // namespace
+
+void relaxed_counter_increment(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    ++relaxed_counter;
+  }
+  benchmark::DoNotOptimize(relaxed_counter.Load());
+}
+BENCHMARK(relaxed_counter_increment)->ThreadRange(1, 32)->UseRealTime();
+
+void sharded_counter_increment(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    ++sharded_counter;
+  }
+  benchmark::DoNotOptimize(sharded_counter.Load());
+}
+BENCHMARK(sharded_counter_increment)->ThreadRange(1, 32)->UseRealTime();
+
+void sharded_counter_load(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(sharded_counter.Load());
+  }
+}
+BENCHMARK(sharded_counter_load);
+
+USERVER_NAMESPACE_END
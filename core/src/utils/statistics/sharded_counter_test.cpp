@@ -0,0 +1,70 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+UTEST(ShardedRelaxedCounter, Basic) {
+  ShardedRelaxedCounter<std::size_t> counter;
+  EXPECT_EQ(counter.Load(), 0);
+
+  ++counter;
+  counter += 10;
+  EXPECT_EQ(counter.Load(), 11);
+
+  --counter;
+  counter -= 5;
+  EXPECT_EQ(counter.Load(), 5);
+
+  counter = 42;
+  EXPECT_EQ(counter.Load(), 42);
+
+  const auto copy = counter;
+  EXPECT_EQ(copy.Load(), 42);
+}
+
+UTEST_MT(ShardedRelaxedCounter, Concurrent, 4) {
+  constexpr std::size_t kIterations = 10'000;
+  ShardedRelaxedCounter<std::size_t> counter;
+  ShardedRelaxedCounter<std::size_t> in_flight;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        ++in_flight;
+        ++counter;
+        --in_flight;
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(counter.Load(), kIterations * GetThreadCount());
+  EXPECT_EQ(in_flight.Load(), 0);
+}
+
+UTEST(ShardedRateCounter, DumpMetric) {
+  Storage storage;
+  ShardedRateCounter rate_counter;
+  rate_counter += Rate{9};
+  ++rate_counter;
+  const auto rate_counter_scope = storage.RegisterWriter(
+      "test", [&rate_counter](Writer& writer) { writer = rate_counter; });
+
+  EXPECT_EQ(Snapshot{storage}.SingleMetric("test"), MetricValue{Rate{10}});
+
+  ResetMetric(rate_counter);
+  EXPECT_EQ(Snapshot{storage}.SingleMetric("test"), MetricValue{Rate{0}});
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
+#include <utils/statistics/chunked_output.hpp>
 #include <utils/statistics/solomon_limits.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -21,20 +22,34 @@ constexpr bool IsReservedLabelName(std::string_view name) {
 }
 class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
-  explicit SolomonJsonBuilder(formats::json::StringBuilder& builder)
-      : builder_{builder} {}
+  SolomonJsonBuilder(formats::json::StringBuilder& builder,
+                     const ChunkConsumer* consumer)
+      : builder_{builder}, consumer_{consumer} {}
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
-    formats::json::StringBuilder::ObjectGuard guard{builder_};
-    builder_.Key("labels");
-    DumpLabels(path, labels);
-    builder_.Key("value");
-    value.Visit([this](auto x) { WriteToStream(x, builder_); });
-
-    if (value.IsRate()) {
-      builder_.Key("type");
-      builder_.WriteString("RATE");
+    {
+      formats::json::StringBuilder::ObjectGuard guard{builder_};
+      builder_.Key("labels");
+      DumpLabels(path, labels);
+      builder_.Key("value");
+      value.Visit([this](auto x) { WriteToStream(x, builder_); });
+
+      if (value.IsRate()) {
+        builder_.Key("type");
+        builder_.WriteString("RATE");
+      }
+    }
+    FlushChunk();
+  }
+
+  void FlushChunk(impl::IsLastChunk is_last = impl::IsLastChunk::kNo) {
+    if (!consumer_) return;
+
+    const auto size = builder_.GetStringView().size();
+    if (size >= impl::kChunkSize ||
+        (is_last == impl::IsLastChunk::kYes && size != 0)) {
+      (*consumer_)(builder_.ExtractWrittenPart());
     }
   }
 
@@ -100,16 +115,15 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
   }
 
   formats::json::StringBuilder& builder_;
+  const ChunkConsumer* const consumer_;
 };
 
-}  // namespace
-
-std::string ToSolomonFormat(
+void WriteSolomonFormat(
     const utils::statistics::Storage& statistics,
     const std::unordered_map<std::string, std::string>& common_labels,
-    const utils::statistics::Request& request) {
-  formats::json::StringBuilder builder;
-  SolomonJsonBuilder solomon_json_builder(builder);
+    const utils::statistics::Request& request,
+    formats::json::StringBuilder& builder, const ChunkConsumer* consumer) {
+  SolomonJsonBuilder solomon_json_builder(builder, consumer);
   {
     formats::json::StringBuilder::ObjectGuard object_guard(builder);
     solomon_json_builder.AddCommonLabels(common_labels);
@@ -118,9 +132,28 @@ std::string ToSolomonFormat(
     formats::json::StringBuilder::ArrayGuard array_guard(builder);
     statistics.VisitMetrics(solomon_json_builder, request);
   }
+  solomon_json_builder.FlushChunk(impl::IsLastChunk::kYes);
+}
+
+}  // namespace
+
+std::string ToSolomonFormat(
+    const utils::statistics::Storage& statistics,
+    const std::unordered_map<std::string, std::string>& common_labels,
+    const utils::statistics::Request& request) {
+  formats::json::StringBuilder builder;
+  WriteSolomonFormat(statistics, common_labels, request, builder, nullptr);
   return builder.GetString();
 }
 
+void ToSolomonFormat(
+    const utils::statistics::Storage& statistics,
+    const std::unordered_map<std::string, std::string>& common_labels,
+    const utils::statistics::Request& request, const ChunkConsumer& consumer) {
+  formats::json::StringBuilder builder;
+  WriteSolomonFormat(statistics, common_labels, request, builder, &consumer);
+}
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -397,6 +397,27 @@ UTEST(MetricsSolomon, RateMetric) {
   TestToMetricsSolomon(statistics_storage, expected);
 }
 
+UTEST(MetricsSolomon, Streaming) {
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter("big", [](Writer& writer) {
+    for (int i = 0; i < 10'000; ++i) {
+      writer["metric"].ValueWithLabels(i, {"index", std::to_string(i)});
+    }
+  });
+
+  const std::unordered_map<std::string, std::string> common_labels{
+      {"application", "processing"}};
+
+  std::string result;
+  std::size_t chunks = 0;
+  ToSolomonFormat(storage, common_labels, {}, [&](std::string&& chunk) {
+    result += chunk;
+    ++chunks;
+  });
+  EXPECT_EQ(result, ToSolomonFormat(storage, common_labels));
+  EXPECT_GT(chunks, 1);
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -7,6 +7,8 @@
 #include <userver/formats/common/utils.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/text.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
@@ -94,6 +96,22 @@ Request::Request(std::string prefix_in, PrefixMatch path_match_type_in,
 
 BaseFormatBuilder::~BaseFormatBuilder() = default;
 
+void BaseFormatBuilder::HandleHistogram(std::string_view path,
+                                        LabelsSpan labels,
+                                        const HistogramSnapshot& value) {
+  std::vector<LabelView> percentile_labels{labels.begin(), labels.end()};
+  percentile_labels.emplace_back();
+
+  for (const double percent : {0.0, 50.0, 90.0, 95.0, 98.0, 99.0, 99.6, 99.9,
+                               100.0}) {
+    const auto name = GetPercentileFieldName(percent);
+    percentile_labels.back() = LabelView{"percentile", name};
+    HandleMetric(path, LabelsSpan{percentile_labels},
+                 MetricValue{static_cast<std::int64_t>(
+                     value.GetPercentile(percent))});
+  }
+}
+
 Storage::Storage() : may_register_extenders_(true) {}
 
 formats::json::Value Storage::GetAsJson() const {
@@ -5,12 +5,20 @@
 #include <sys/resource.h>
 #include <sys/time.h>
 #endif
+#ifdef __linux__
+#include <dirent.h>
+#endif
 #include <unistd.h>
 
 #include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
 #include <iterator>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <boost/filesystem/operations.hpp>
@@ -20,7 +28,6 @@
 #include <userver/fs/blocking/read.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/from_string.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -46,6 +53,53 @@ void Merge(SystemStats& to, const SystemStats& from) {
   });
 }
 
+// /proc/<pid>/stat and /proc/<pid>/io are much shorter
+constexpr std::size_t kMaxProcFileSize = 4096;
+
+using ProcFileBuffer = std::array<char, kMaxProcFileSize>;
+
+std::int64_t ParseInt64(std::string_view value) {
+  std::int64_t result{};
+  const auto* const end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, result);
+  if (ec != std::errc{} || ptr != end) {
+    throw std::runtime_error(fmt::format("Invalid number '{}'", value));
+  }
+  return result;
+}
+
+std::string_view ReadProcFile(const fs::blocking::FileDescriptor& file,
+                              ProcFileBuffer& buffer) {
+  const auto size = ::pread(file.GetNative(), buffer.data(), buffer.size(), 0);
+  if (size < 0) {
+    throw std::system_error(errno, std::generic_category(), "pread");
+  }
+  return {buffer.data(), static_cast<std::size_t>(size)};
+}
+
+std::optional<std::int64_t> CountOpenFiles(const std::string& fd_dir_path) {
+  DIR* const dir = ::opendir(fd_dir_path.c_str());
+  if (!dir) return std::nullopt;
+
+  std::int64_t count = 0;
+  while (const auto* entry = ::readdir(dir)) {
+    if (entry->d_name[0] != '.') ++count;
+  }
+  ::closedir(dir);
+  return count;
+}
+
+std::optional<fs::blocking::FileDescriptor> TryOpenProcFile(
+    const std::string& path) {
+  try {
+    return fs::blocking::FileDescriptor::Open(path,
+                                              fs::blocking::OpenFlag::kRead);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Could not open " << path << ": " << ex;
+    return std::nullopt;
+  }
+}
+
 bool IsProcStatMatchesName(std::string_view data, std::string_view name) {
   size_t pos = data.find(' ');
   return pos != std::string_view::npos && pos + 2 + name.size() < data.size() &&
@@ -77,8 +131,7 @@ void ParseProcStat(std::string_view data, SystemStats& stats) {
     size_t next_delim_pos = std::min(data.find(' ', pos), data.size());
 
     const auto get_current_value = [=] {
-      return utils::FromString<int64_t>(
-          std::string{data.substr(pos, next_delim_pos - pos)});
+      return ParseInt64(data.substr(pos, next_delim_pos - pos));
     };
 
     switch (field_num) {
@@ -137,8 +190,7 @@ void ParseProcStatIo(std::string_view data, SystemStats& stats) {
       auto value_pos = pos + header.size();
       UASSERT(value_pos < next_newline_pos);
       auto value_len = next_newline_pos - value_pos;
-      field = utils::FromString<int64_t>(
-          std::string{data.substr(value_pos, value_len)});
+      field = ParseInt64(data.substr(value_pos, value_len));
     };
 
     parse_if_matches(stats.io_read_bytes, kReadBytesHeader);
@@ -157,17 +209,7 @@ SystemStats GetSystemStatisticsByProcPath(std::string_view path) {
     LOG_LIMITED_DEBUG() << "Could not get stats from " << path << ": " << ex;
   }
 
-  {
-    boost::system::error_code ec;
-    boost::filesystem::directory_iterator it{fmt::format("{}/fd", path), ec};
-    if (!ec) {
-      stats.open_files = 0;
-      while (!ec && it != boost::filesystem::directory_iterator{}) {
-        ++*stats.open_files;
-        it.increment(ec);
-      }
-    }
-  }
+  stats.open_files = CountOpenFiles(fmt::format("{}/fd", path));
 
   try {
     ParseProcStatIo(fs::blocking::ReadFileContents(fmt::format("{}/io", path)),
@@ -291,6 +333,42 @@ SystemStats GetSystemStatisticsByExeName(std::string_view name) {
   return {};
 }
 
+SelfSystemStatsReader::SelfSystemStatsReader() {
+#ifdef __linux__
+  stat_file_ = TryOpenProcFile("/proc/self/stat");
+  io_file_ = TryOpenProcFile("/proc/self/io");
+#endif
+}
+
+SystemStats SelfSystemStatsReader::Read() const {
+#ifdef __linux__
+  SystemStats stats;
+  ProcFileBuffer buffer;
+
+  if (stat_file_) {
+    try {
+      ParseProcStat(ReadProcFile(*stat_file_, buffer), stats);
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_DEBUG() << "Could not get self stats: " << ex;
+    }
+  }
+
+  stats.open_files = CountOpenFiles("/proc/self/fd");
+
+  if (io_file_) {
+    try {
+      ParseProcStatIo(ReadProcFile(*io_file_, buffer), stats);
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_DEBUG() << "Could not get self I/O stats: " << ex;
+    }
+  }
+
+  return stats;
+#else
+  return GetSelfSystemStatistics();
+#endif
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
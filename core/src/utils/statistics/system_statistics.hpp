@@ -4,6 +4,7 @@
 #include <optional>
 #include <string_view>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,6 +25,19 @@ void DumpMetric(Writer& writer, const SystemStats& stats);
 SystemStats GetSelfSystemStatistics();
 SystemStats GetSystemStatisticsByExeName(std::string_view name);
 
+// Same as GetSelfSystemStatistics(), but keeps the /proc files open between
+// the calls and rereads them with pread() into a stack buffer. Thread-safe.
+class SelfSystemStatsReader final {
+ public:
+  SelfSystemStatsReader();
+
+  SystemStats Read() const;
+
+ private:
+  std::optional<fs::blocking::FileDescriptor> stat_file_;
+  std::optional<fs::blocking::FileDescriptor> io_file_;
+};
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -15,7 +15,13 @@ SystemStatisticsCollector::SystemStatisticsCollector(
     : LoggableComponentBase(config, context),
       with_nginx_(config["with-nginx"].As<bool>(false)),
       fs_task_processor_(context.GetTaskProcessor(
-          config["fs-task-processor"].As<std::string>())) {
+          config["fs-task-processor"].As<std::string>())),
+      self_stats_reader_(
+          // opens the /proc files
+          engine::AsyncNoSpan(fs_task_processor_, [] {
+            using utils::statistics::impl::SelfSystemStatsReader;
+            return std::make_unique<SelfSystemStatsReader>();
+          }).Get()) {
   statistics_holder_ =
       context.FindComponent<components::StatisticsStorage>()
           .GetStorage()
@@ -31,7 +37,7 @@ SystemStatisticsCollector::~SystemStatisticsCollector() {
 void SystemStatisticsCollector::ExtendStatistics(
     utils::statistics::Writer& writer) {
   engine::CriticalAsyncNoSpan(fs_task_processor_, [&] {
-    DumpMetric(writer, utils::statistics::impl::GetSelfSystemStatistics());
+    DumpMetric(writer, self_stats_reader_->Read());
     if (with_nginx_) {
       writer.ValueWithLabels(
           utils::statistics::impl::GetSystemStatisticsByExeName("nginx"),
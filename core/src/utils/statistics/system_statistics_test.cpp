@@ -0,0 +1,30 @@
+#include <utils/statistics/system_statistics.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+#ifdef __linux__
+TEST(SystemStatistics, SelfReader) {
+  const utils::statistics::impl::SelfSystemStatsReader reader;
+
+  // the files are reread on each call
+  for (int i = 0; i < 2; ++i) {
+    const auto stats = reader.Read();
+    const auto expected = utils::statistics::impl::GetSelfSystemStatistics();
+
+    ASSERT_TRUE(stats.cpu_time_sec);
+    EXPECT_GE(*stats.cpu_time_sec, 0);
+    ASSERT_TRUE(stats.rss_kb);
+    EXPECT_GT(*stats.rss_kb, 0);
+    ASSERT_TRUE(stats.open_files);
+    EXPECT_GT(*stats.open_files, 0);
+    EXPECT_EQ(stats.major_pagefaults.has_value(),
+              expected.major_pagefaults.has_value());
+    EXPECT_EQ(stats.io_read_bytes.has_value(),
+              expected.io_read_bytes.has_value());
+  }
+}
+#endif
+
+USERVER_NAMESPACE_END
@@ -68,26 +68,29 @@ bool CanSubPathSucceedStartsWith(std::string_view current_path,
                                  current_path.substr(initial_path_size));
 }
 
-void CheckAndWrite(impl::WriterState& state,
-                   std::variant<std::int64_t, double, Rate> value) {
+bool IsRequested(const impl::WriterState& state) {
   UINVARIANT(!state.path.empty(),
              "Detected an attempt to write a metric by empty path");
 
   if (state.request.prefix_match_type != Request::PrefixMatch::kNoop) {
     UASSERT(!state.request.prefix.empty());
     if (state.path.size() < state.request.prefix.size()) {
-      return;
+      return false;
     } else {
       // Already checked in Writer constructor and is OK
     }
   }
 
-  const LabelsSpan labels{state.add_labels};
-  if (!LeftContainsRight(labels, state.request.require_labels)) {
-    return;
-  }
+  return LeftContainsRight(LabelsSpan{state.add_labels},
+                           state.request.require_labels);
+}
 
-  state.builder.HandleMetric(state.path, labels, MetricValue{value});
+void CheckAndWrite(impl::WriterState& state,
+                   std::variant<std::int64_t, double, Rate> value) {
+  if (!IsRequested(state)) return;
+
+  state.builder.HandleMetric(state.path, LabelsSpan{state.add_labels},
+                             MetricValue{value});
 }
 
 }  // namespace
@@ -163,6 +166,16 @@ void Writer::Write(Rate value) {
   }
 }
 
+void Writer::Write(const HistogramSnapshot& value) {
+  if (state_) {
+    ValidateUsage();
+    if (!IsRequested(*state_)) return;
+
+    const LabelsSpan labels{state_->add_labels};
+    state_->builder.HandleHistogram(state_->path, labels, value);
+  }
+}
+
 void Writer::ResetState() noexcept {
   UASSERT(state_);
 
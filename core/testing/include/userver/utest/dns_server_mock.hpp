@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -25,6 +26,7 @@ class DnsServerMock final {
     kA = 1,
     kAAAA = 28,
     kCname = 5,
+    kSrv = 33,
   };
 
   struct DnsQuery {
@@ -32,9 +34,16 @@ class DnsServerMock final {
     std::string name;
   };
 
+  struct SrvData {
+    std::uint16_t priority{0};
+    std::uint16_t weight{0};
+    std::uint16_t port{0};
+    std::string target;
+  };
+
   struct DnsAnswer {
-    using AnswerData =
-        std::variant<std::monostate, engine::io::Sockaddr, std::string>;
+    using AnswerData = std::variant<std::monostate, engine::io::Sockaddr,
+                                    std::string, SrvData>;
 
     RecordType type{RecordType::kInvalid};
     AnswerData data;
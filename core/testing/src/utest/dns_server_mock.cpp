@@ -128,6 +128,13 @@ class DnsMessageWriter {
         const uint16_t rdlength = alias.size() + 2;
         *this << rdlength << alias;
       } break;
+      case DnsServerMock::RecordType::kSrv: {
+        UASSERT(std::holds_alternative<DnsServerMock::SrvData>(answer.data));
+        const auto& srv = std::get<DnsServerMock::SrvData>(answer.data);
+        const uint16_t rdlength = 6 + srv.target.size() + 2;
+        *this << rdlength << srv.priority << srv.weight << srv.port
+              << srv.target;
+      } break;
       default:
         UASSERT_MSG(false, "Invalid answer type");
     }
@@ -181,8 +188,9 @@ auto ParseMessage(const char* data, size_t size) noexcept {
   query.type = static_cast<DnsServerMock::RecordType>(GetNetworkUint16(pos));
   pos += 2;
   UASSERT_MSG(query.type == DnsServerMock::RecordType::kA ||
-                  query.type == DnsServerMock::RecordType::kAAAA,
-              "Only A and AAAA queries are supported");
+                  query.type == DnsServerMock::RecordType::kAAAA ||
+                  query.type == DnsServerMock::RecordType::kSrv,
+              "Only A, AAAA and SRV queries are supported");
 
   auto qclass = GetNetworkUint16(pos);
   UASSERT_MSG(qclass == kInClass, "Only IN queries are supported");
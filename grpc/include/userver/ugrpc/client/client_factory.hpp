@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactory
 
 #include <cstddef>
+#include <vector>
 
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/security/credentials.h>
@@ -19,6 +20,7 @@
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/ugrpc/client/retry_config.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -42,6 +44,19 @@ struct ClientFactoryConfig {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Max number of underlying channels per endpoint. A channel is added once
+  /// all the channels have `max_streams_per_channel` RPCs in flight, the
+  /// RPCs go to the channel with the least RPCs in flight. Values below
+  /// `channel_count` disable the growth.
+  std::size_t max_channel_count{1};
+
+  /// RPCs in flight on a channel that make it busy, usually the
+  /// max-concurrent-streams of the server HTTP/2 connections
+  std::size_t max_streams_per_channel{100};
+
+  /// Retries of the unary RPCs, each client gets its own retry budget
+  RetryConfig retry{};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
@@ -59,6 +74,15 @@ class ClientFactory final {
                 testsuite::GrpcControl& testsuite_grpc,
                 dynamic_config::Source source);
 
+  /// The RPCs of the clients are spread across the `queues`
+  ClientFactory(ClientFactoryConfig&& config,
+                engine::TaskProcessor& channel_task_processor,
+                MiddlewareFactories mws,
+                std::vector<grpc::CompletionQueue*> queues,
+                utils::statistics::Storage& statistics_storage,
+                testsuite::GrpcControl& testsuite_grpc,
+                dynamic_config::Source source);
+
   template <typename Client>
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
@@ -68,11 +92,12 @@ class ClientFactory final {
 
   engine::TaskProcessor& channel_task_processor_;
   MiddlewareFactories mws_;
-  grpc::CompletionQueue& queue_;
+  const std::vector<grpc::CompletionQueue*> queues_;
   impl::ChannelCache channel_cache_;
   ugrpc::impl::StatisticsStorage client_statistics_storage_;
   const dynamic_config::Source config_source_;
   testsuite::GrpcControl& testsuite_grpc_;
+  const RetryConfig retry_config_;
 };
 
 template <typename Client>
@@ -86,9 +111,10 @@ Client ClientFactory::MakeClient(const std::string& client_name,
   for (const auto& mw_factory : mws_)
     mws.push_back(mw_factory->GetMiddleware(client_name));
 
-  return Client(impl::ClientParams{client_name, std::move(mws), queue_,
+  return Client(impl::ClientParams{client_name, std::move(mws), queues_,
                                    statistics, GetChannel(endpoint),
-                                   config_source_, testsuite_grpc_});
+                                   config_source_, testsuite_grpc_,
+                                   retry_config_});
 }
 
 }  // namespace ugrpc::client
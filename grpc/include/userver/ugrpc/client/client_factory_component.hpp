@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactoryComponent
 
 #include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include <userver/ugrpc/client/client_factory.hpp>
 #include <userver/ugrpc/client/queue_holder.hpp>
@@ -46,7 +47,13 @@ namespace ugrpc::client {
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
+/// completion-queue-count | Number of completion queues, each one is drained by its own thread. Ignored if ugrpc::server::ServerComponent exists, the queues of the server are used then | 1
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// max-channel-count | Max number of underlying grpc::Channel objects, a channel is added once all of them have max-streams-per-channel RPCs in flight | channel-count
+/// max-streams-per-channel | Number of RPCs in flight that makes a channel busy, usually the max-concurrent-streams of the server | 100
+/// retry.retryable-status-codes | status codes of the unary RPC attempts that are retried, see ugrpc::client::Qos::attempts | ['UNAVAILABLE']
+/// retry.budget | max number of retried and hedged attempts of a client in a burst | 100
+/// retry.budget-refill-interval | the retry budget of a client gets one more attempt each interval | 10ms
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -61,12 +68,15 @@ class ClientFactoryComponent final : public components::LoggableComponentBase {
   ClientFactoryComponent(const components::ComponentConfig& config,
                          const components::ComponentContext& context);
 
+  ~ClientFactoryComponent() override;
+
   ClientFactory& GetFactory();
 
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
   std::optional<QueueHolder> queue_;
+  utils::statistics::Entry queue_statistics_holder_;
   std::optional<ClientFactory> factory_;
 };
 
@@ -0,0 +1,27 @@
+#pragma once
+
+/// @file userver/ugrpc/client/context_factory.hpp
+/// @brief @copybrief ugrpc::client::ClientContextFactory
+
+#include <functional>
+#include <memory>
+
+#include <grpcpp/client_context.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Creates the `grpc::ClientContext` of each attempt of a unary RPC.
+///
+/// A `grpc::ClientContext` can only be used by a single call and gRPC has no
+/// way to read its metadata back. So the unary RPCs make several attempts,
+/// see Qos::attempts, only if the client method is given a factory: each
+/// attempt gets a context with the same metadata and settings. The deadline
+/// of the first context is set to all of them.
+using ClientContextFactory =
+    std::function<std::unique_ptr<grpc::ClientContext>()>;
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/ugrpc/client/generic.hpp
+/// @brief @copybrief ugrpc::client::GenericClient
+
+#include <memory>
+#include <string_view>
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/client/rpc.hpp>
+#include <userver/ugrpc/impl/static_metadata.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Allows to perform RPCs with dynamic method names without parsing
+/// the messages.
+///
+/// The messages are passed as raw `grpc::ByteBuffer`, e.g. the ones received
+/// by ugrpc::server::GenericServiceBase, so a proxy could forward calls without
+/// deserialization and serialization. Created by
+/// ugrpc::client::ClientFactory::MakeClient<GenericClient>.
+///
+/// `call_name` is the full method name, e.g.
+/// `sample.ugrpc.UnitTestService/SayHello`. It is not copied and must outlive
+/// the returned RPC object. Static QOS configs do not apply to the generic
+/// calls and the statistics of all the generic calls are accounted as
+/// a single `Generic/Generic` method.
+class GenericClient final {
+ public:
+  GenericClient(GenericClient&&) noexcept = default;
+  GenericClient& operator=(GenericClient&&) noexcept = delete;
+
+  /// Initiate a single request -> single response RPC
+  client::UnaryCall<grpc::ByteBuffer> CallUnary(
+      std::string_view call_name, const grpc::ByteBuffer& request,
+      std::unique_ptr<grpc::ClientContext> context =
+          std::make_unique<grpc::ClientContext>(),
+      const Qos& qos = {}) const;
+
+  /// Initiate a request stream -> response stream RPC, this works for any
+  /// kind of method on the server side
+  client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>
+  CallBidirectional(std::string_view call_name,
+                    std::unique_ptr<grpc::ClientContext> context =
+                        std::make_unique<grpc::ClientContext>(),
+                    const Qos& qos = {}) const;
+
+  /// @cond
+  // For internal use only
+  explicit GenericClient(impl::ClientParams&&);
+
+  static ugrpc::impl::StaticServiceMetadata GetMetadata();
+  /// @endcond
+
+ private:
+  template <typename Client>
+  friend impl::ClientData& impl::GetClientData(Client& client);
+
+  impl::ClientData impl_;
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,7 @@
 #include <userver/ugrpc/client/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
 #include <userver/ugrpc/impl/async_method_invocation.hpp>
+#include <userver/ugrpc/impl/compression.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -102,6 +103,8 @@ class RpcData final {
 
   ugrpc::impl::RpcStatisticsScope& GetStatsScope() noexcept;
 
+  const ugrpc::CompressionConfig& GetCompression() const noexcept;
+
   void SetWritesFinished() noexcept;
 
   bool AreWritesFinished() const noexcept;
@@ -142,6 +145,9 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  // Released once the RPC object is destroyed
+  ChannelCache::Lease channel_lease_;
+  const ugrpc::CompressionConfig compression_;
 
   std::optional<AsyncMethodInvocation> invocation_;
   grpc::Status status_;
@@ -221,12 +227,38 @@ void ReadAsync(GrpcStream& stream, Response& response, RpcData& data) noexcept {
   stream.Read(&response, read.GetTag());
 }
 
+// Compresses the single request of the RPC if it is large enough, must be
+// called before the RPC starts
+template <typename Request>
+void ApplyRequestCompression(RpcData& data, const Request& request) {
+  const auto& compression = data.GetCompression();
+  if (ugrpc::impl::ShouldCompress(compression, request, data.GetStatsScope())) {
+    data.GetContext().set_compression_algorithm(compression.algorithm);
+  }
+}
+
+// Enables the compression of the requests of a stream, the small ones are
+// sent uncompressed by ApplyWriteCompression
+void EnableStreamCompression(RpcData& data);
+
+template <typename Request>
+void ApplyWriteCompression(RpcData& data, const Request& request,
+                           grpc::WriteOptions& options) {
+  const auto& compression = data.GetCompression();
+  if (compression.algorithm == GRPC_COMPRESS_NONE) return;
+  if (!ugrpc::impl::ShouldCompress(compression, request,
+                                   data.GetStatsScope())) {
+    options.set_no_compression();
+  }
+}
+
 void PrepareWrite(RpcData& data);
 
 template <typename GrpcStream, typename Request>
 bool Write(GrpcStream& stream, const Request& request,
            grpc::WriteOptions options, RpcData& data) {
   PrepareWrite(data);
+  ApplyWriteCompression(data, request, options);
   AsyncMethodInvocation write;
   stream.Write(request, options, write.GetTag());
   const auto result = Wait(write, data.GetContext());
@@ -245,6 +277,7 @@ template <typename GrpcStream, typename Request>
 void WriteAndCheck(GrpcStream& stream, const Request& request,
                    grpc::WriteOptions options, RpcData& data) {
   PrepareWriteAndCheck(data);
+  ApplyWriteCompression(data, request, options);
   AsyncMethodInvocation write;
   stream.Write(request, options, write.GetTag());
   CheckOk(data, Wait(write, data.GetContext()), "WriteAndCheck");
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <memory>
 #include <string_view>
+#include <utility>
 
 #include <grpcpp/client_context.h>
 #include <grpcpp/completion_queue.h>
 
 #include <userver/dynamic_config/snapshot.hpp>
 
+#include <userver/ugrpc/client/context_factory.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/impl/retry.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,17 +29,31 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  ChannelCache::Lease channel_lease;
+  // Only set for the unary RPCs with several attempts
+  std::unique_ptr<RetryParams> retry{};
+  ugrpc::CompressionConfig compression{};
 };
 
 CallParams DoCreateCallParams(const ClientData&, std::size_t method_id,
                               std::unique_ptr<grpc::ClientContext>);
 
+// The user qos goes first, the missing settings are taken from the config
+ugrpc::CompressionConfig MakeCompressionConfig(const Qos& user_qos,
+                                               const Qos& config_qos);
+
+// The params of one more attempt of the RPC, that makes a single attempt
+CallParams MakeAttemptCallParams(const RetryParams& retry);
+
+// With a `context_factory` the unary RPCs may make several attempts,
+// `client_context` is then the context of the first one
 template <typename ClientQosConfig>
 CallParams CreateCallParams(const ClientData& client_data,
                             std::size_t method_id,
                             std::unique_ptr<grpc::ClientContext> client_context,
                             const ClientQosConfig& client_qos,
-                            const ugrpc::client::Qos& qos) {
+                            const ugrpc::client::Qos& qos,
+                            ClientContextFactory context_factory = {}) {
   const auto& metadata = client_data.GetMetadata();
   const auto& full_name = metadata.method_full_names[method_id];
   const auto& method_name =
@@ -42,14 +61,21 @@ CallParams CreateCallParams(const ClientData& client_data,
 
   const auto& config = client_data.GetConfigSnapshot();
 
+  const auto& config_qos = config[client_qos][method_name];
+
   // User qos goes first
   ApplyQos(*client_context, qos, client_data.GetTestsuiteControl());
 
   // If user qos was empty update timeout from config
-  ApplyQos(*client_context, config[client_qos][method_name],
-           client_data.GetTestsuiteControl());
+  ApplyQos(*client_context, config_qos, client_data.GetTestsuiteControl());
 
-  return DoCreateCallParams(client_data, method_id, std::move(client_context));
+  auto retry = MakeRetryParams(client_data, method_id, *client_context,
+                               std::move(context_factory), qos, config_qos);
+  auto params =
+      DoCreateCallParams(client_data, method_id, std::move(client_context));
+  params.retry = std::move(retry);
+  params.compression = MakeCompressionConfig(qos, config_qos);
+  return params;
 }
 
 }  // namespace ugrpc::client::impl
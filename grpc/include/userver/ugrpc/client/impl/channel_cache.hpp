@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -12,6 +13,7 @@
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,26 +21,42 @@ namespace ugrpc::client::impl {
 
 class ChannelCache final {
  public:
+  // The pool of an endpoint starts with `channel_count` channels and grows up
+  // to `max_channel_count` once all the channels have at least
+  // `max_streams_per_channel` RPCs in flight.
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               std::size_t channel_count, std::size_t max_channel_count,
+               std::size_t max_streams_per_channel);
 
   ~ChannelCache();
 
   class Token;
+  class Lease;
 
   // The grpc::Channel is kept in cache as long as some Token pointing to it is
   // alive.
   Token Get(const std::string& endpoint);
 
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ChannelCache& cache);
+
  private:
+  struct PooledChannel final {
+    std::shared_ptr<grpc::Channel> channel;
+    std::atomic<std::uint64_t> in_flight{0};
+  };
+
   struct CountedChannel final {
     CountedChannel(const std::string& endpoint,
                    const std::shared_ptr<grpc::ChannelCredentials>& credentials,
                    const grpc::ChannelArguments& channel_args,
-                   std::size_t count);
+                   std::size_t count, std::size_t max_count);
 
-    utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    // All the channels are created beforehand, as gRPC channels do not
+    // connect until used. Only the first `active_count` ones are used.
+    utils::FixedArray<PooledChannel> channels;
+    std::atomic<std::size_t> active_count;
     std::uint64_t counter{0};
   };
 
@@ -47,9 +65,31 @@ class ChannelCache final {
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
   const std::size_t channel_count_;
+  const std::size_t max_channel_count_;
+  const std::uint64_t max_streams_per_channel_;
   concurrent::Variable<Map> channels_;
 };
 
+// Keeps an RPC accounted as in flight on the channel
+class ChannelCache::Lease final {
+ public:
+  Lease() noexcept = default;
+
+  Lease(Lease&&) noexcept;
+  Lease& operator=(Lease&&) noexcept;
+  ~Lease();
+
+  std::size_t GetChannelIndex() const noexcept;
+
+ private:
+  friend class Token;
+
+  Lease(PooledChannel& channel, std::size_t index) noexcept;
+
+  PooledChannel* channel_{nullptr};
+  std::size_t index_{0};
+};
+
 class ChannelCache::Token final {
  public:
   Token() noexcept = default;
@@ -62,17 +102,28 @@ class ChannelCache::Token final {
   Token& operator=(Token&&) noexcept;
   ~Token();
 
+  // Number of the channels currently in use
   std::size_t GetChannelCount() const noexcept;
 
+  // The pool never grows beyond that
+  std::size_t GetMaxChannelCount() const noexcept;
+
+  // Allowed for any index below GetMaxChannelCount()
   const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
       noexcept;
 
+  // Picks the channel with the least RPCs in flight, adds a channel to the
+  // pool if all of them are busy
+  Lease LeaseChannel() const noexcept;
+
  private:
   ChannelCache* cache_{nullptr};
   const std::string* endpoint_{nullptr};
   CountedChannel* counted_channel_{nullptr};
 };
 
+void DumpMetric(utils::statistics::Writer& writer, const ChannelCache& cache);
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
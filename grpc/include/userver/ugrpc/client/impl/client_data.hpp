@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/channel.h>
 #include <grpcpp/completion_queue.h>
@@ -10,7 +11,9 @@
 #include <userver/dynamic_config/source.hpp>
 #include <userver/testsuite/grpc_control.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
+#include <userver/ugrpc/client/impl/retry_budget.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
+#include <userver/ugrpc/client/retry_config.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -23,11 +26,12 @@ namespace ugrpc::client::impl {
 struct ClientParams final {
   std::string client_name;
   Middlewares mws;
-  grpc::CompletionQueue& queue;
+  const std::vector<grpc::CompletionQueue*>& queues;
   ugrpc::impl::ServiceStatistics& statistics_storage;
   impl::ChannelCache::Token channel_token;
   const dynamic_config::Source config_source;
   testsuite::GrpcControl& testsuite_grpc;
+  const RetryConfig& retry_config;
 };
 
 /// A helper class for generated gRPC clients
@@ -41,8 +45,10 @@ class ClientData final {
   template <typename Service>
   ClientData(ClientParams&& params, ugrpc::impl::StaticServiceMetadata metadata,
              std::in_place_type_t<Service>)
-      : params_(std::move(params)), metadata_(metadata) {
-    const std::size_t channel_count = GetChannelToken().GetChannelCount();
+      : params_(std::move(params)),
+        metadata_(metadata),
+        retry_budget_(std::make_unique<RetryBudget>(params_.retry_config)) {
+    const std::size_t channel_count = GetChannelToken().GetMaxChannelCount();
     stubs_ = utils::GenerateFixedArray(channel_count, [&](std::size_t index) {
       return StubPtr(
           Service::NewStub(GetChannelToken().GetChannel(index)).release(),
@@ -57,12 +63,24 @@ class ClientData final {
   ClientData& operator=(const ClientData&) = delete;
 
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  Stub<Service>& GetStub(const ChannelCache::Lease& lease) const {
+    return GetStubByType<Stub<Service>>(lease);
   }
 
-  grpc::CompletionQueue& GetQueue() const { return params_.queue; }
+  template <typename StubType>
+  StubType& GetStubByType(const ChannelCache::Lease& lease) const {
+    return *static_cast<StubType*>(stubs_[lease.GetChannelIndex()].get());
+  }
+
+  ChannelCache::Lease LeaseChannel() const {
+    return params_.channel_token.LeaseChannel();
+  }
+
+  // The RPCs are spread across the queues
+  grpc::CompletionQueue& GetQueue() const {
+    const auto& queues = params_.queues;
+    return *queues[queues.size() == 1 ? 0 : utils::RandRange(queues.size())];
+  }
 
   dynamic_config::Snapshot GetConfigSnapshot() const {
     return params_.config_source.GetSnapshot();
@@ -86,6 +104,8 @@ class ClientData final {
     return params_.testsuite_grpc;
   }
 
+  RetryBudget& GetRetryBudget() const { return *retry_budget_; }
+
  private:
   using StubDeleterType = void (*)(void*);
   using StubPtr = std::unique_ptr<void, StubDeleterType>;
@@ -97,6 +117,7 @@ class ClientData final {
 
   ClientParams params_;
   ugrpc::impl::StaticServiceMetadata metadata_;
+  std::unique_ptr<RetryBudget> retry_budget_;
   utils::FixedArray<StubPtr> stubs_;
 };
 
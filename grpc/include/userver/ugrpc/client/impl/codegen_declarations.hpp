@@ -7,6 +7,7 @@
 
 #include <grpcpp/completion_queue.h>
 
+#include <userver/ugrpc/client/context_factory.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <userver/ugrpc/client/context_factory.hpp>
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/compression.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+/// Everything needed to start one more attempt of a unary RPC
+struct RetryParams final {
+  std::size_t attempts{1};
+  std::optional<std::chrono::milliseconds> hedging_delay;
+  const ClientData& client_data;
+  std::size_t method_id;
+
+  // Creates the contexts of the attempts with the user metadata and settings
+  ClientContextFactory context_factory;
+  // The deadline of the whole RPC, taken from the first context
+  std::chrono::system_clock::time_point deadline;
+  // Applied by each attempt, depending on the size of the request
+  ugrpc::CompressionConfig compression;
+
+  std::unique_ptr<grpc::ClientContext> MakeContext() const;
+};
+
+// Returns nullptr if the RPC makes a single attempt, that is always the case
+// without a `context_factory`
+std::unique_ptr<RetryParams> MakeRetryParams(
+    const ClientData& client_data, std::size_t method_id,
+    const grpc::ClientContext& context, ClientContextFactory&& context_factory,
+    const Qos& user_qos, const Qos& config_qos);
+
+using AttemptStarter =
+    std::function<engine::TaskWithResult<void>(std::size_t attempt)>;
+
+// Runs the attempts started by `start_attempt` until one of them succeeds or
+// fails with a status that is not retried. The other attempts are cancelled.
+// Returns the index of the successful attempt, rethrows the error otherwise.
+std::size_t RunAttempts(const RetryParams& params, std::string_view call_name,
+                        const AttemptStarter& start_attempt);
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+
+#include <grpcpp/support/status.h>
+
+#include <userver/utils/token_bucket.hpp>
+
+#include <userver/ugrpc/client/retry_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+/// Limits the retried and hedged attempts of a single client
+class RetryBudget final {
+ public:
+  explicit RetryBudget(const RetryConfig& config);
+
+  bool IsRetryable(grpc::StatusCode code) const noexcept;
+
+  /// @returns false if the client has run out of the retries
+  bool TryObtain();
+
+ private:
+  const std::vector<grpc::StatusCode> retryable_status_codes_;
+  utils::TokenBucket tokens_;
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <unordered_map>
 
+#include <grpc/compression.h>
 #include <grpcpp/client_context.h>
 
 #include <userver/formats/json_fwd.hpp>
@@ -17,8 +19,37 @@ class GrpcControl;
 
 namespace ugrpc::client {
 
+/// @brief Per-RPC settings, e.g. from the ugrpc::client::ClientQos dynamic
+/// config. The settings passed to the client method go first, the missing ones
+/// are taken from the dynamic config.
 struct Qos final {
+  /// The timeout of the whole RPC, including all the attempts
   std::optional<std::chrono::milliseconds> timeout;
+
+  /// @brief Max number of attempts of a unary RPC.
+  ///
+  /// The attempts that failed with one of RetryConfig::retryable_status_codes
+  /// are retried while there is time left and the retry budget of the client
+  /// allows. Only the unary RPCs started with a ClientContextFactory make
+  /// several attempts. Streaming RPCs, the RPCs started with a single
+  /// `grpc::ClientContext` and UnaryCall::FinishAsync make a single attempt.
+  std::optional<std::size_t> attempts;
+
+  /// @brief Delay of the hedged attempts of a unary RPC.
+  ///
+  /// If set, one more attempt is started every `hedging_delay` until there is
+  /// a response or `attempts` are started. The first successful response
+  /// wins, the other attempts are cancelled.
+  std::optional<std::chrono::milliseconds> hedging_delay;
+
+  /// @brief Compression of the requests, see ugrpc::CompressionConfig.
+  ///
+  /// Parsed from 'identity', 'deflate' or 'gzip'. The responses are
+  /// compressed as configured by the server.
+  std::optional<grpc_compression_algorithm> compression;
+
+  /// Min size of the serialized request to compress
+  std::optional<std::size_t> compression_min_size;
 };
 
 Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>);
@@ -3,28 +3,43 @@
 /// @file userver/ugrpc/client/queue_holder.hpp
 /// @brief @copybrief ugrpc::client::QueueHolder
 
+#include <cstddef>
+#include <vector>
+
 #include <grpcpp/completion_queue.h>
 
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
-/// @brief Manages a gRPC completion queue, usable only in clients
+/// @brief Manages gRPC completion queues, usable only in clients
 class QueueHolder final {
  public:
-  QueueHolder();
+  /// Each queue is drained by its own thread
+  explicit QueueHolder(std::size_t queue_count = 1);
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
   ~QueueHolder();
 
+  /// @returns the first queue
   grpc::CompletionQueue& GetQueue();
 
+  /// @returns all the queues
+  const std::vector<grpc::CompletionQueue*>& GetQueues();
+
+  /// @cond
+  // For internal use only
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const QueueHolder& holder);
+  /// @endcond
+
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 144, 8> impl_;
+  utils::FastPimpl<Impl, 40, 8> impl_;
 };
 
 }  // namespace ugrpc::client
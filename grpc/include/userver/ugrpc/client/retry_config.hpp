@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/ugrpc/client/retry_config.hpp
+/// @brief @copybrief ugrpc::client::RetryConfig
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include <grpcpp/support/status.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Retries of the unary RPCs of a client, enabled per RPC with
+/// Qos::attempts and Qos::hedging_delay.
+///
+/// Each client has its own retry budget, so that the retries do not overload
+/// a backend that is already failing.
+struct RetryConfig final {
+  /// The failed attempts with these status codes are retried
+  std::vector<grpc::StatusCode> retryable_status_codes{
+      grpc::StatusCode::UNAVAILABLE};
+
+  /// Max number of retried and hedged attempts a client makes in a burst
+  std::size_t budget{100};
+
+  /// The budget gets one more attempt each `budget_refill_interval`
+  std::chrono::milliseconds budget_refill_interval{10};
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -3,14 +3,17 @@
 /// @file userver/ugrpc/client/rpc.hpp
 /// @brief Classes representing an outgoing RPC
 
+#include <functional>
 #include <memory>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <grpcpp/impl/codegen/proto_utils.h>
 
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/ugrpc/client/exceptions.hpp>
@@ -126,6 +129,19 @@ class CallAnyBase {
   std::unique_ptr<impl::RpcData> data_;
 };
 
+template <typename Response>
+class UnaryCall;
+
+namespace impl {
+
+template <typename Response>
+struct UnaryCallRetries final {
+  std::unique_ptr<RetryParams> params;
+  std::function<UnaryCall<Response>(CallParams&&)> make_attempt;
+};
+
+}  // namespace impl
+
 /// @brief Controls a single request -> single response RPC
 ///
 /// This class is not thread-safe except for `GetContext`.
@@ -142,6 +158,11 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ///
   /// The connection is not closed, it will be reused for new RPCs.
   ///
+  /// With Qos::attempts above 1 and a ugrpc::client::ClientContextFactory
+  /// passed to the client method, the failed attempts are retried and the
+  /// hedged attempts are started, see ugrpc::client::RetryConfig. `GetContext`
+  /// and `GetSpan` only refer to the first attempt then.
+  ///
   /// @returns the response on success
   /// @throws ugrpc::client::RpcError on an RPC error
   /// @throws ugrpc::client::RpcCancelledError on task cancellation
@@ -151,6 +172,8 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ///
   /// `FinishAsync` should not be called multiple times for the same RPC.
   ///
+  /// Makes a single attempt, regardless of Qos::attempts.
+  ///
   /// `Finish` and `FinishAsync` should not be called together for the same RPC.
   ///
   /// @returns the future for the single response
@@ -170,7 +193,17 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ~UnaryCall() = default;
 
  private:
+  template <typename Stub, typename Request>
+  UnaryCall(
+      std::unique_ptr<impl::RetryParams> retry, impl::CallParams&& params,
+      Stub& stub,
+      impl::RawResponseReaderPreparer<Stub, Request, Response> prepare_func,
+      const Request& req);
+
+  Response FinishWithRetries();
+
   impl::RawResponseReader<Response> reader_;
+  std::unique_ptr<impl::UnaryCallRetries<Response>> retries_;
 };
 
 /// @brief Controls a single request -> response stream RPC
@@ -392,6 +425,20 @@ void CallMiddlewares(const Middlewares& mws, CallAnyBase& call,
                      std::function<void()> user_call,
                      const ::google::protobuf::Message* request);
 
+namespace impl {
+
+// Raw grpc::ByteBuffer requests of GenericClient are not seen by middlewares
+template <typename Request>
+const ::google::protobuf::Message* ToInitialRequest(const Request& request) {
+  if constexpr (std::is_base_of_v<::google::protobuf::Message, Request>) {
+    return &request;
+  } else {
+    return nullptr;
+  }
+}
+
+}  // namespace impl
+
 // ========================== Implementation follows ==========================
 
 template <typename RPC>
@@ -454,7 +501,34 @@ UnaryCall<Response>::UnaryCall(
     impl::CallParams&& params, Stub& stub,
     impl::RawResponseReaderPreparer<Stub, Request, Response> prepare_func,
     const Request& req)
+    // `params.retry` is taken out before CallAnyBase takes the rest
+    : UnaryCall(std::move(params.retry), std::move(params), stub, prepare_func,
+                req) {}
+
+template <typename Response>
+template <typename Stub, typename Request>
+UnaryCall<Response>::UnaryCall(
+    std::unique_ptr<impl::RetryParams> retry, impl::CallParams&& params,
+    Stub& stub,
+    impl::RawResponseReaderPreparer<Stub, Request, Response> prepare_func,
+    const Request& req)
     : CallAnyBase(std::move(params)) {
+  if (retry) {
+    retries_ = std::make_unique<impl::UnaryCallRetries<Response>>();
+    auto& client_data = retry->client_data;
+    retries_->params = std::move(retry);
+    // The only copy of the request, all the further attempts are started
+    // from it
+    retries_->make_attempt = [&client_data, prepare_func, request = req](
+                                 impl::CallParams&& attempt_params) {
+      auto& attempt_stub = client_data.template GetStubByType<Stub>(
+          attempt_params.channel_lease);
+      return UnaryCall(std::move(attempt_params), attempt_stub, prepare_func,
+                       request);
+    };
+  }
+
+  impl::ApplyRequestCompression(GetData(), req);
   CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -462,18 +536,46 @@ UnaryCall<Response>::UnaryCall(
                                        &GetData().GetQueue());
         reader_->StartCall();
       },
-      &req);
+      impl::ToInitialRequest(req));
   GetData().SetWritesFinished();
 }
 
 template <typename Response>
 Response UnaryCall<Response>::Finish() {
+  if (retries_) return FinishWithRetries();
+
   Response response;
   UnaryFuture future = FinishAsync(response);
   future.Get();
   return response;
 }
 
+template <typename Response>
+Response UnaryCall<Response>::FinishWithRetries() {
+  const auto retries = std::move(retries_);
+  const auto& params = *retries->params;
+
+  // The calls of the attempts, except for the first one that is `*this`
+  std::vector<UnaryCall> calls;
+  calls.reserve(params.attempts - 1);
+  std::vector<Response> responses(params.attempts);
+
+  const auto winner = impl::RunAttempts(
+      params, GetCallName(), [&](std::size_t attempt) {
+        UnaryCall* call = this;
+        if (attempt != 0) {
+          calls.push_back(
+              retries->make_attempt(impl::MakeAttemptCallParams(params)));
+          call = &calls.back();
+        }
+        return engine::AsyncNoSpan(
+            [call, &response = responses[attempt]] {
+              response = call->Finish();
+            });
+      });
+  return std::move(responses[winner]);
+}
+
 template <typename Response>
 UnaryFuture UnaryCall<Response>::FinishAsync(Response& response) {
   UASSERT(reader_);
@@ -492,6 +594,7 @@ InputStream<Response>::InputStream(
     impl::RawReaderPreparer<Stub, Request, Response> prepare_func,
     const Request& req)
     : CallAnyBase(std::move(params)) {
+  impl::ApplyRequestCompression(GetData(), req);
   CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -499,7 +602,7 @@ InputStream<Response>::InputStream(
                                        &GetData().GetQueue());
         impl::StartCall(*stream_, GetData());
       },
-      &req);
+      impl::ToInitialRequest(req));
   GetData().SetWritesFinished();
 }
 
@@ -522,6 +625,7 @@ OutputStream<Request, Response>::OutputStream(
     impl::RawWriterPreparer<Stub, Request, Response> prepare_func)
     : CallAnyBase(std::move(params)),
       final_response_(std::make_unique<Response>()) {
+  impl::EnableStreamCompression(GetData());
   CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -573,6 +677,7 @@ BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::CallParams&& params, Stub& stub,
     impl::RawReaderWriterPreparer<Stub, Request, Response> prepare_func)
     : CallAnyBase(std::move(params)) {
+  impl::EnableStreamCompression(GetData());
   CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
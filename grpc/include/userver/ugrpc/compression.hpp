@@ -0,0 +1,37 @@
+#pragma once
+
+/// @file userver/ugrpc/compression.hpp
+/// @brief @copybrief ugrpc::CompressionConfig
+
+#include <cstddef>
+
+#include <grpc/compression.h>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Compression of the messages sent by an RPC
+///
+/// The messages smaller than `min_message_size` are sent uncompressed, the
+/// compression of the small messages costs more CPU than it saves traffic.
+/// The algorithm is only used if the peer accepts it.
+struct CompressionConfig final {
+  /// GRPC_COMPRESS_NONE disables the compression
+  grpc_compression_algorithm algorithm{GRPC_COMPRESS_NONE};
+
+  /// Min size of the serialized message to compress
+  std::size_t min_message_size{0};
+};
+
+/// Parses `algorithm` ('identity', 'deflate' or 'gzip') and
+/// `min-message-size-bytes`
+CompressionConfig Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<CompressionConfig>);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
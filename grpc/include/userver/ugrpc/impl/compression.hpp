@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <grpc/compression.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/compression.hpp>
+#include <userver/ugrpc/impl/statistics_scope.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+/// Returns nullopt for the unknown names
+std::optional<grpc_compression_algorithm> FindCompressionAlgorithm(
+    std::string_view name) noexcept;
+
+template <typename Message>
+std::size_t GetMessageSize(const Message& message) {
+  if constexpr (std::is_same_v<Message, grpc::ByteBuffer>) {
+    return message.Length();
+  } else {
+    return message.ByteSizeLong();
+  }
+}
+
+/// Decides whether the message is sent compressed and accounts it
+template <typename Message>
+bool ShouldCompress(const CompressionConfig& config, const Message& message,
+                    RpcStatisticsScope& statistics) {
+  if (config.algorithm == GRPC_COMPRESS_NONE) return false;
+  const auto size = GetMessageSize(message);
+  const bool is_compressed = size >= config.min_message_size;
+  statistics.OnMessageSent(size, is_compressed);
+  return is_compressed;
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/engine/single_use_event.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -10,11 +11,15 @@ namespace ugrpc::impl {
 
 class QueueRunner final {
  public:
-  explicit QueueRunner(grpc::CompletionQueue& queue);
+  // `events` counts the events taken from the queue and must outlive the
+  // runner, so that the metrics could be read after the queue is shut down
+  QueueRunner(grpc::CompletionQueue& queue,
+              utils::statistics::RateCounter& events);
   ~QueueRunner();
 
  private:
   grpc::CompletionQueue& queue_;
+  utils::statistics::RateCounter& events_;
   engine::SingleUseEvent completion_;
 };
 
@@ -45,6 +45,28 @@ class MethodStatistics final {
 
   void AccountCancelled() noexcept;
 
+  // Unary client RPCs with Qos::attempts above 1
+  void AccountRetry() noexcept;
+
+  void AccountHedge() noexcept;
+
+  void AccountHedgeWin() noexcept;
+
+  void AccountRetryBudgetExhausted() noexcept;
+
+  // Messages of the methods with the compression enabled, `size` is the size
+  // of the serialized message before the compression
+  void AccountMessageSent(std::size_t size, bool is_compressed) noexcept;
+
+  // The calls being handled by the service, for the per-method limits of the
+  // congestion control middleware. Returns false if there are `max` already.
+  bool TryStartHandling(std::size_t max_in_flight) noexcept;
+
+  void FinishHandling() noexcept;
+
+  // Median of the timings of the last minute, recomputed at most once a second
+  std::chrono::milliseconds GetRecentTimingMedian() noexcept;
+
   friend void DumpMetric(utils::statistics::Writer& writer,
                          const MethodStatistics& stats);
 
@@ -66,6 +88,20 @@ class MethodStatistics final {
 
   RateCounter deadline_updated_{0};
   RateCounter deadline_cancelled_{0};
+
+  RateCounter retries_{0};
+  RateCounter hedges_{0};
+  RateCounter hedge_wins_{0};
+  RateCounter retry_budget_exhausted_{0};
+
+  RateCounter compressed_messages_{0};
+  RateCounter compressed_bytes_{0};
+  RateCounter uncompressed_messages_{0};
+  RateCounter uncompressed_bytes_{0};
+
+  std::atomic<std::size_t> handling_{0};
+  std::atomic<std::int64_t> timing_median_ms_{0};
+  std::atomic<std::chrono::steady_clock::rep> timing_median_update_{0};
 };
 
 class ServiceStatistics final {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 #include <grpcpp/support/status.h>
@@ -27,6 +28,12 @@ class RpcStatisticsScope final {
 
   void OnNetworkError();
 
+  // Only for the methods with the compression enabled
+  void OnMessageSent(std::size_t size, bool is_compressed);
+
+  // For the per-method limits of the congestion control middleware
+  MethodStatistics& GetMethodStatistics() noexcept { return statistics_; }
+
  private:
   // Represents how the RPC was finished. Kinds with higher numeric values
   // override those with lower ones.
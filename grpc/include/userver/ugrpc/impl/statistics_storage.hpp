@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string_view>
 #include <unordered_map>
 
@@ -16,8 +17,12 @@ namespace ugrpc::impl {
 /// for storing their statistics.
 class StatisticsStorage final {
  public:
+  // Writes the metrics that are not tied to a service, e.g. of the channels
+  using ExtraWriter = std::function<void(utils::statistics::Writer&)>;
+
   explicit StatisticsStorage(utils::statistics::Storage& statistics_storage,
-                             std::string_view domain);
+                             std::string_view domain,
+                             ExtraWriter extra_writer = {});
 
   StatisticsStorage(const StatisticsStorage&) = delete;
   StatisticsStorage& operator=(const StatisticsStorage&) = delete;
@@ -44,6 +49,7 @@ class StatisticsStorage final {
                      std::hash<ServiceId>, ServiceIdComparer>
       service_statistics_;
   engine::SharedMutex mutex_;
+  const ExtraWriter extra_writer_;
 
   utils::statistics::Entry statistics_holder_;
 };
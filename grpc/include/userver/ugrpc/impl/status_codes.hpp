@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string_view>
 
 #include <grpcpp/support/status.h>
@@ -10,6 +11,10 @@ namespace ugrpc::impl {
 
 std::string_view ToString(grpc::StatusCode code) noexcept;
 
+// Parses the names returned by ToString, e.g. "UNAVAILABLE"
+std::optional<grpc::StatusCode> StatusCodeFromString(
+    std::string_view name) noexcept;
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
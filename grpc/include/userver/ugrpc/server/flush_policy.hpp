@@ -0,0 +1,39 @@
+#pragma once
+
+/// @file userver/ugrpc/server/flush_policy.hpp
+/// @brief @copybrief ugrpc::server::FlushPolicy
+
+#include <chrono>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Controls the coalescing of the messages written to a server stream
+///
+/// The messages of a batch are sent with the gRPC buffer hint, so the write
+/// completes once the message is buffered instead of waiting for a
+/// transport round-trip. The batch is flushed by the write that reaches any
+/// of the limits, by the last write of `WriteMany` and by `Finish`.
+///
+/// @warning Buffered messages are not sent until the next flush, in an event
+/// subscription scenario cap the batches with `max_delay` or `WriteMany`.
+///
+/// The default policy sends every message immediately.
+struct FlushPolicy final {
+  /// Flush every `max_messages`-th message, 0 means no limit
+  std::size_t max_messages{1};
+
+  /// Flush once the batch has at least `max_bytes` of serialized messages,
+  /// 0 means no limit
+  std::size_t max_bytes{0};
+
+  /// Flush on the first write after `max_delay` since the start of the batch.
+  /// 0 means no limit. There is no timer, the time is only checked on writes.
+  std::chrono::milliseconds max_delay{0};
+};
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
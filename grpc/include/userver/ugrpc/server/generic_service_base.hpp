@@ -0,0 +1,42 @@
+#pragma once
+
+/// @file userver/ugrpc/server/generic_service_base.hpp
+/// @brief @copybrief ugrpc::server::GenericServiceBase
+
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/server/rpc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Base class for a service that handles the RPCs of any method without
+/// parsing the messages.
+///
+/// The messages are passed as raw `grpc::ByteBuffer`, so proxies that only
+/// route on metadata do not pay for deserialization and serialization. Every
+/// call is seen as a bidirectional stream regardless of the method kind,
+/// the full method name is available via `call.GetCallName()`, e.g.
+/// `sample.ugrpc.UnitTestService/SayHello`.
+///
+/// The generic service receives the calls of all the methods that are not
+/// implemented by the other services of the server, at most one generic
+/// service could be registered. The statistics of all the generic calls are
+/// accounted as a single `Generic/Generic` method.
+///
+/// @see ugrpc::client::GenericClient for forwarding the calls
+class GenericServiceBase {
+ public:
+  using Call = BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>;
+
+  GenericServiceBase& operator=(GenericServiceBase&&) = delete;
+  virtual ~GenericServiceBase();
+
+  /// Called concurrently for every incoming RPC
+  virtual void Handle(Call& call) = 0;
+};
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <google/protobuf/arena.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// Initial blocks of the per-call arenas, shared by all the calls of a service
+class ArenaBlockPool final {
+ public:
+  explicit ArenaBlockPool(std::size_t block_size);
+
+  ArenaBlockPool(ArenaBlockPool&&) = delete;
+  ArenaBlockPool& operator=(ArenaBlockPool&&) = delete;
+  ~ArenaBlockPool();
+
+  class BlockDeleter final {
+   public:
+    explicit BlockDeleter(ArenaBlockPool& pool) noexcept : pool_(&pool) {}
+
+    void operator()(char* block) const noexcept { pool_->Release(block); }
+
+   private:
+    ArenaBlockPool* pool_;
+  };
+
+  using Block = std::unique_ptr<char[], BlockDeleter>;
+
+  std::size_t GetBlockSize() const noexcept { return block_size_; }
+
+  Block Acquire();
+
+ private:
+  struct Impl;
+
+  void Release(char* block) noexcept;
+
+  const std::size_t block_size_;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// Arena of a single call, owns the request and the messages created by the
+/// handler via CallAnyBase::GetArena()
+class CallArena final {
+ public:
+  explicit CallArena(ArenaBlockPool& pool);
+
+  google::protobuf::Arena& Get() noexcept { return arena_; }
+
+ private:
+  // The arena must be destroyed before its initial block returns to the pool
+  ArenaBlockPool::Block block_;
+  google::protobuf::Arena arena_;
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <string_view>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_context.h>
 
@@ -9,6 +10,7 @@
 #include <userver/logging/fwd.hpp>
 #include <userver/tracing/span.hpp>
 
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -21,6 +23,8 @@ struct CallParams {
   ugrpc::impl::RpcStatisticsScope& statistics;
   logging::LoggerRef access_tskv_logger;
   tracing::Span& call_span;
+  google::protobuf::Arena* arena;
+  const ugrpc::CompressionConfig& compression;
 };
 
 }  // namespace ugrpc::server::impl
@@ -2,7 +2,9 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <grpcpp/completion_queue.h>
@@ -13,6 +15,7 @@
 #include <userver/logging/null_logger.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
@@ -23,12 +26,20 @@ namespace ugrpc::server::impl {
 
 /// Config for a `ServiceWorker`, provided by `ugrpc::server::Server`
 struct ServiceSettings final {
-  grpc::ServerCompletionQueue& queue;
+  // Each queue gets its own listeners of all the methods
+  std::vector<grpc::ServerCompletionQueue*> queues;
   engine::TaskProcessor& task_processor;
   ugrpc::impl::StatisticsStorage& statistics_storage;
   Middlewares middlewares;
   logging::LoggerPtr access_tskv_logger;
   const dynamic_config::Source config_source;
+  // 0 disables the per-call arenas
+  std::size_t arena_initial_block_size{0};
+  // Unary methods served by 'inline_tasks_per_queue' long-lived tasks
+  std::vector<std::string> inline_methods{};
+  std::size_t inline_tasks_per_queue{0};
+  CompressionConfig compression{};
+  std::unordered_map<std::string, CompressionConfig> method_compression{};
 };
 
 /// @brief Listens to requests for a gRPC service, forwarding them to a
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -29,6 +32,7 @@
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/server/impl/async_service.hpp>
+#include <userver/ugrpc/server/impl/call_arena.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
 #include <userver/ugrpc/server/impl/call_traits.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
@@ -50,6 +54,16 @@ void ReportNetworkError(const RpcInterruptedError& ex,
 void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
                grpc::ServerContext& context, std::string_view call_name);
 
+// Destroys the task-local variables of the previous call served by the task,
+// so that the next call sees the variables as in a new task
+void ResetTaskLocalVariables() noexcept;
+
+void CheckInlineMethods(const ServiceSettings& settings,
+                        const ugrpc::impl::StaticServiceMetadata& metadata);
+
+const CompressionConfig& FindCompression(const ServiceSettings& settings,
+                                         std::string_view method_name);
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
@@ -57,8 +71,11 @@ struct ServiceData final {
               const ugrpc::impl::StaticServiceMetadata& metadata)
       : settings(settings),
         metadata(metadata),
-        statistics(settings.statistics_storage.GetServiceStatistics(metadata)) {
-  }
+        statistics(settings.statistics_storage.GetServiceStatistics(metadata)),
+        arena_blocks(settings.arena_initial_block_size == 0
+                         ? nullptr
+                         : std::make_unique<ArenaBlockPool>(
+                               settings.arena_initial_block_size)) {}
 
   ~ServiceData() = default;
 
@@ -67,6 +84,8 @@ struct ServiceData final {
   AsyncService<GrpcppService> async_service{metadata.method_full_names.size()};
   utils::impl::WaitTokenStorage wait_tokens;
   ugrpc::impl::ServiceStatistics& statistics;
+  // nullptr if the per-call arenas are disabled
+  const std::unique_ptr<ArenaBlockPool> arena_blocks;
 };
 
 /// Per-gRPC-method data
@@ -76,6 +95,7 @@ struct MethodData final {
   const std::size_t method_id{};
   typename CallTraits::ServiceBase& service;
   const typename CallTraits::ServiceMethod service_method;
+  grpc::ServerCompletionQueue& queue;
 
   std::string_view call_name{
       service_data.metadata.method_full_names[method_id]};
@@ -84,33 +104,53 @@ struct MethodData final {
       call_name.substr(service_data.metadata.service_full_name.size() + 1)};
   ugrpc::impl::MethodStatistics& statistics{
       service_data.statistics.GetMethodStatistics(method_id)};
+  const CompressionConfig& compression{
+      FindCompression(service_data.settings, method_name)};
 };
 
 template <typename GrpcppService, typename CallTraits>
 class CallData final {
  public:
-  explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data)
+  explicit CallData(const MethodData<GrpcppService, CallTraits>& method_data,
+                    bool is_inline = false)
       : wait_token_(method_data.service_data.wait_tokens.GetToken()),
-        method_data_(method_data) {
+        method_data_(method_data),
+        is_inline_(is_inline) {
     UASSERT(method_data.method_id <
             method_data.service_data.metadata.method_full_names.size());
+
+    if (auto* arena_blocks = method_data.service_data.arena_blocks.get()) {
+      arena_.emplace(*arena_blocks);
+      if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
+        initial_request_ =
+            google::protobuf::Arena::CreateMessage<InitialRequest>(
+                &arena_->Get());
+      }
+    }
   }
 
-  void operator()() && {
+  void operator()() && { Run(); }
+
+  // Waits for a call and handles it, returns false once the queue is shut down
+  bool Run() {
     // Based on the tensorflow code, we must first call AsyncNotifyWhenDone
     // and only then Prepare<>
     // see
     // https://git.ecdf.ed.ac.uk/s1886313/tensorflow/-/blob/438604fc885208ee05f9eef2d0f2c630e1360a83/tensorflow/core/distributed_runtime/rpc/grpc_call.h#L201
     // and grpc::ServerContext::AsyncNotifyWhenDone
+    //
+    // The inline tasks serve many calls and are never cancelled by a call
     ugrpc::server::impl::RpcFinishedEvent notify_when_done(
-        engine::current_task::GetCancellationToken(), context_);
+        is_inline_ ? engine::TaskCancellationToken{}
+                   : engine::current_task::GetCancellationToken(),
+        context_);
 
     context_.AsyncNotifyWhenDone(notify_when_done.GetTag());
 
     // the request for an incoming RPC must be performed synchronously
-    auto& queue = method_data_.service_data.settings.queue;
+    auto& queue = method_data_.queue;
     method_data_.service_data.async_service.template Prepare<CallTraits>(
-        method_data_.method_id, context_, initial_request_, raw_responder_,
+        method_data_.method_id, context_, *initial_request_, raw_responder_,
         queue, queue, prepare_.GetTag());
 
     if (prepare_.Wait() != impl::AsyncMethodInvocation::WaitStatus::kOk) {
@@ -119,11 +159,12 @@ class CallData final {
       // Do not wait for notify_when_done. When queue is shutting down, it will
       // not be called.
       // https://github.com/grpc/grpc/issues/10136
-      return;
+      return false;
     }
 
-    // start a concurrent listener immediately, as advised by gRPC docs
-    ListenAsync(method_data_);
+    // start a concurrent listener immediately, as advised by gRPC docs. The
+    // other inline tasks are listening already.
+    if (!is_inline_) ListenAsync(method_data_);
 
     HandleRpc();
 
@@ -132,6 +173,7 @@ class CallData final {
     // stack-allocated object, that object is going to be freed upon exit. To
     // prevent segfaults, wait until queue is done with this object.
     notify_when_done.Wait();
+    return true;
   }
 
   static void ListenAsync(const MethodData<GrpcppService, CallTraits>& data) {
@@ -141,6 +183,16 @@ class CallData final {
         .Detach();
   }
 
+  // Starts a task that serves the calls one after another
+  static void ListenInline(const MethodData<GrpcppService, CallTraits>& data) {
+    engine::CriticalAsyncNoSpan(
+        data.service_data.settings.task_processor,
+        [data, token = data.service_data.wait_tokens.GetToken()] {
+          while (CallData(data, true).Run()) ResetTaskLocalVariables();
+        })
+        .Detach();
+  }
+
  private:
   using InitialRequest = typename CallTraits::InitialRequest;
   using RawCall = typename CallTraits::RawCall;
@@ -162,21 +214,23 @@ class CallData final {
 
     auto& access_tskv_logger =
         method_data_.service_data.settings.access_tskv_logger;
-    Call responder(CallParams{context_, call_name, statistics_scope,
-                              *access_tskv_logger, span_->Get()},
-                   raw_responder_);
+    Call responder(
+        CallParams{context_, call_name, statistics_scope, *access_tskv_logger,
+                   span_->Get(), arena_ ? &arena_->Get() : nullptr,
+                   method_data_.compression},
+        raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
         (service.*service_method)(responder);
       } else {
-        (service.*service_method)(responder, std::move(initial_request_));
+        (service.*service_method)(responder, std::move(*initial_request_));
       }
     };
 
     try {
       ::google::protobuf::Message* initial_request = nullptr;
       if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-        initial_request = &initial_request_;
+        initial_request = initial_request_;
       }
 
       // TODO: pass responder as function_ref?
@@ -199,9 +253,14 @@ class CallData final {
   const utils::impl::WaitTokenStorage::Token wait_token_;
 
   MethodData<GrpcppService, CallTraits> method_data_;
+  const bool is_inline_;
 
   grpc::ServerContext context_{};
-  InitialRequest initial_request_{};
+  // Owns the arena-allocated initial request, if any
+  std::optional<CallArena> arena_{};
+  InitialRequest default_initial_request_{};
+  // Points either to 'default_initial_request_' or into 'arena_'
+  InitialRequest* initial_request_{&default_initial_request_};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -216,11 +275,16 @@ class ServiceWorkerImpl final : public ServiceWorker {
                     Service& service, ServiceMethods... service_methods)
       : service_data_(settings, metadata),
         start_{[this, &service, service_methods...] {
-          std::size_t method_id = 0;
-          (CallData<GrpcppService, CallTraits<ServiceMethods>>::ListenAsync(
-               {service_data_, method_id++, service, service_methods}),
-           ...);
-        }} {}
+          for (auto* queue : service_data_.settings.queues) {
+            std::size_t method_id = 0;
+            (Listen<CallTraits<ServiceMethods>>(
+                 {service_data_, method_id++, service, service_methods,
+                  *queue}),
+             ...);
+          }
+        }} {
+    CheckInlineMethods(service_data_.settings, service_data_.metadata);
+  }
 
   ~ServiceWorkerImpl() override {
     service_data_.wait_tokens.WaitForAllTokens();
@@ -235,6 +299,23 @@ class ServiceWorkerImpl final : public ServiceWorker {
   void Start() override { start_(); }
 
  private:
+  template <typename Traits>
+  void Listen(const MethodData<GrpcppService, Traits>& data) {
+    using Call = CallData<GrpcppService, Traits>;
+    if constexpr (Traits::kCallCategory == CallCategory::kUnary) {
+      const auto& settings = service_data_.settings;
+      if (std::find(settings.inline_methods.begin(),
+                    settings.inline_methods.end(),
+                    data.method_name) != settings.inline_methods.end()) {
+        for (std::size_t i = 0; i < settings.inline_tasks_per_queue; ++i) {
+          Call::ListenInline(data);
+        }
+        return;
+      }
+    }
+    Call::ListenAsync(data);
+  }
+
   ServiceData<GrpcppService> service_data_;
   std::function<void()> start_;
 };
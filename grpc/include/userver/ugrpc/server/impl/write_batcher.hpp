@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <grpcpp/impl/codegen/call_op_set.h>
+
+#include <userver/ugrpc/impl/compression.hpp>
+#include <userver/ugrpc/server/flush_policy.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+/// Decides which writes of a stream flush the buffered messages
+class WriteBatcher final {
+ public:
+  void SetPolicy(const FlushPolicy& policy) noexcept;
+
+  bool NeedsMessageSize() const noexcept { return policy_.max_bytes != 0; }
+
+  /// Accounts the next message of the stream and returns the options for its
+  /// write, `message_size` is only used if NeedsMessageSize()
+  grpc::WriteOptions NextWrite(std::size_t message_size, bool force_flush);
+
+  template <typename Message>
+  std::size_t GetMessageSize(const Message& message) const {
+    if (!NeedsMessageSize()) return 0;
+    return ugrpc::impl::GetMessageSize(message);
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  FlushPolicy policy_{};
+  std::size_t batch_messages_{0};
+  std::size_t batch_bytes_{0};
+  Clock::time_point batch_start_{};
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
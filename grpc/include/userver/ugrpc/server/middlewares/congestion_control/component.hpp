@@ -15,7 +15,18 @@ class Middleware;
 
 /// @ingroup userver_components userver_base_classes
 ///
-/// @brief Component for gRPC server logging
+/// @brief Component for gRPC server congestion control
+///
+/// Rejects the calls with RESOURCE_EXHAUSTED before the handler runs if:
+/// - the server is overloaded, see congestion_control::Component;
+/// - the method has `max-in-flight` calls in its handlers already;
+/// - `shed-by-latency` is set and there is less time left until the
+///   deadline than the median timing of the method.
+///
+/// The per-method limits are taken from the USERVER_GRPC_SERVER_METHOD_LIMITS
+/// dynamic config by the call name, e.g.
+/// `sample.ugrpc.UnitTestService/SayHello`, with the `__default__` for the
+/// other methods.
 
 class Component final : public MiddlewareComponentBase {
  public:
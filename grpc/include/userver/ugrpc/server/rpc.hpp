@@ -3,18 +3,23 @@
 /// @file userver/ugrpc/server/rpc.hpp
 /// @brief Classes representing an incoming RPC
 
+#include <iterator>
+
 #include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/utils/assert.hpp>
 
+#include <userver/ugrpc/impl/compression.hpp>
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/span.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 #include <userver/ugrpc/server/exceptions.hpp>
+#include <userver/ugrpc/server/flush_policy.hpp>
 #include <userver/ugrpc/server/impl/async_methods.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
+#include <userver/ugrpc/server/impl/write_batcher.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -43,6 +48,15 @@ class CallAnyBase {
 
   tracing::Span& GetSpan() { return params_.call_span; }
 
+  /// @brief Per-call arena, the initial request of the RPC is allocated on it
+  ///
+  /// The arena lives until the RPC is destroyed, so the response could be
+  /// created with `google::protobuf::Arena::CreateMessage<Response>(arena)`
+  /// to avoid the heap allocations of its fields.
+  ///
+  /// @returns nullptr unless `arena-initial-block-size` is set for the service
+  google::protobuf::Arena* GetArena() { return params_.arena; }
+
   /// @cond
   // For internal use only
   ugrpc::impl::RpcStatisticsScope& Statistics(ugrpc::impl::InternalTag);
@@ -55,6 +69,30 @@ class CallAnyBase {
 
   void LogFinish(grpc::Status status) const;
 
+  // Compresses the single response of the RPC if it is large enough, must be
+  // called before the initial metadata is sent
+  template <typename Message>
+  void ApplyResponseCompression(const Message& response) {
+    if (ugrpc::impl::ShouldCompress(params_.compression, response,
+                                    params_.statistics)) {
+      params_.context.set_compression_algorithm(params_.compression.algorithm);
+    }
+  }
+
+  // Enables the compression of the responses of a stream, the small ones are
+  // sent uncompressed by ApplyWriteCompression
+  void EnableStreamCompression();
+
+  template <typename Message>
+  void ApplyWriteCompression(const Message& response,
+                             grpc::WriteOptions& options) {
+    if (params_.compression.algorithm == GRPC_COMPRESS_NONE) return;
+    if (!ugrpc::impl::ShouldCompress(params_.compression, response,
+                                     params_.statistics)) {
+      options.set_no_compression();
+    }
+  }
+
  private:
   impl::CallParams params_;
 };
@@ -153,10 +191,28 @@ template <typename Response>
 class OutputStream final : public CallAnyBase {
  public:
   /// @brief Write the next outgoing message
+  ///
+  /// The message could be buffered, see SetFlushPolicy.
+  ///
   /// @param response the next message to write
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Write several messages as a single batch
+  ///
+  /// All the messages except the last one are buffered, so the batch does not
+  /// wait for a transport round-trip per message. The FlushPolicy could flush
+  /// the batch earlier.
+  ///
+  /// @param responses a range of the messages to write
+  /// @throws ugrpc::server::RpcError on an RPC error
+  template <typename Responses>
+  void WriteMany(const Responses& responses);
+
+  /// @brief Set the coalescing of the subsequent writes, messages are sent
+  /// immediately by default
+  void SetFlushPolicy(const FlushPolicy& policy) noexcept;
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -193,8 +249,11 @@ class OutputStream final : public CallAnyBase {
  private:
   enum class State { kNew, kOpen, kFinished };
 
+  void DoWrite(const Response& response, bool force_flush);
+
   impl::RawWriter<Response>& stream_;
   State state_{State::kNew};
+  impl::WriteBatcher write_batcher_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -215,10 +274,28 @@ class BidirectionalStream : public CallAnyBase {
   [[nodiscard]] bool Read(Request& request);
 
   /// @brief Write the next outgoing message
+  ///
+  /// The message could be buffered, see SetFlushPolicy.
+  ///
   /// @param response the next message to write
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Write several messages as a single batch
+  ///
+  /// All the messages except the last one are buffered, so the batch does not
+  /// wait for a transport round-trip per message. The FlushPolicy could flush
+  /// the batch earlier.
+  ///
+  /// @param responses a range of the messages to write
+  /// @throws ugrpc::server::RpcError on an RPC error
+  template <typename Responses>
+  void WriteMany(const Responses& responses);
+
+  /// @brief Set the coalescing of the subsequent writes, messages are sent
+  /// immediately by default
+  void SetFlushPolicy(const FlushPolicy& policy) noexcept;
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -255,8 +332,11 @@ class BidirectionalStream : public CallAnyBase {
  private:
   enum class State { kOpen, kReadsDone, kFinished };
 
+  void DoWrite(const Response& response, bool force_flush);
+
   impl::RawReaderWriter<Request, Response>& stream_;
   State state_{State::kOpen};
+  impl::WriteBatcher write_batcher_;
 };
 
 // ========================== Implementation follows ==========================
@@ -280,6 +360,7 @@ void UnaryCall<Response>::Finish(const Response& response) {
   is_finished_ = true;
 
   LogFinish(grpc::Status::OK);
+  ApplyResponseCompression(response);
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
   Statistics().OnExplicitFinish(grpc::StatusCode::OK);
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), grpc::Status::OK);
@@ -326,6 +407,7 @@ void InputStream<Request, Response>::Finish(const Response& response) {
              "'Finish' called on a finished stream");
   state_ = State::kFinished;
   LogFinish(grpc::Status::OK);
+  ApplyResponseCompression(response);
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
   Statistics().OnExplicitFinish(grpc::StatusCode::OK);
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), grpc::Status::OK);
@@ -347,7 +429,9 @@ void InputStream<Request, Response>::FinishWithError(
 template <typename Response>
 OutputStream<Response>::OutputStream(impl::CallParams&& call_params,
                                      impl::RawWriter<Response>& stream)
-    : CallAnyBase(std::move(call_params)), stream_(stream) {}
+    : CallAnyBase(std::move(call_params)), stream_(stream) {
+  EnableStreamCompression();
+}
 
 template <typename Response>
 OutputStream<Response>::~OutputStream() {
@@ -359,15 +443,39 @@ OutputStream<Response>::~OutputStream() {
 
 template <typename Response>
 void OutputStream<Response>::Write(const Response& response) {
+  DoWrite(response, false);
+}
+
+template <typename Response>
+template <typename Responses>
+void OutputStream<Response>::WriteMany(const Responses& responses) {
+  const auto end = std::end(responses);
+  for (auto it = std::begin(responses); it != end;) {
+    const Response& response = *it;
+    DoWrite(response, ++it == end);
+  }
+}
+
+template <typename Response>
+void OutputStream<Response>::SetFlushPolicy(
+    const FlushPolicy& policy) noexcept {
+  write_batcher_.SetPolicy(policy);
+}
+
+template <typename Response>
+void OutputStream<Response>::DoWrite(const Response& response,
+                                     bool force_flush) {
   UINVARIANT(state_ != State::kFinished, "'Write' called on a finished stream");
 
   // For some reason, gRPC requires explicit 'SendInitialMetadata' in output
   // streams
   impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Writes are not buffered by default, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  auto write_options = write_batcher_.NextWrite(
+      write_batcher_.GetMessageSize(response), force_flush);
+  ApplyWriteCompression(response, write_options);
 
   impl::Write(stream_, response, write_options, GetCallName());
 }
@@ -405,6 +513,7 @@ void OutputStream<Response>::WriteAndFinish(const Response& response) {
   // Don't buffer writes, otherwise in an event subscription scenario, events
   // may never actually be delivered
   grpc::WriteOptions write_options{};
+  ApplyWriteCompression(response, write_options);
 
   const auto status = grpc::Status::OK;
   LogFinish(status);
@@ -415,7 +524,9 @@ template <typename Request, typename Response>
 BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::CallParams&& call_params,
     impl::RawReaderWriter<Request, Response>& stream)
-    : CallAnyBase(std::move(call_params)), stream_(stream) {}
+    : CallAnyBase(std::move(call_params)), stream_(stream) {
+  EnableStreamCompression();
+}
 
 template <typename Request, typename Response>
 BidirectionalStream<Request, Response>::~BidirectionalStream() {
@@ -439,10 +550,36 @@ bool BidirectionalStream<Request, Response>::Read(Request& request) {
 
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(const Response& response) {
+  DoWrite(response, false);
+}
+
+template <typename Request, typename Response>
+template <typename Responses>
+void BidirectionalStream<Request, Response>::WriteMany(
+    const Responses& responses) {
+  const auto end = std::end(responses);
+  for (auto it = std::begin(responses); it != end;) {
+    const Response& response = *it;
+    DoWrite(response, ++it == end);
+  }
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::SetFlushPolicy(
+    const FlushPolicy& policy) noexcept {
+  write_batcher_.SetPolicy(policy);
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::DoWrite(const Response& response,
+                                                     bool force_flush) {
   UINVARIANT(state_ != State::kFinished, "'Write' called on a finished stream");
 
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Writes are not buffered by default, optimize for ping-pong-style
+  // interaction
+  auto write_options = write_batcher_.NextWrite(
+      write_batcher_.GetMessageSize(response), force_flush);
+  ApplyWriteCompression(response, write_options);
 
   impl::Write(stream_, response, write_options, GetCallName());
 }
@@ -481,6 +618,7 @@ void BidirectionalStream<Request, Response>::WriteAndFinish(
 
   // Don't buffer writes, optimize for ping-pong-style interaction
   grpc::WriteOptions write_options{};
+  ApplyWriteCompression(response, write_options);
 
   const auto status = grpc::Status::OK;
   LogFinish(status);
@@ -3,9 +3,11 @@
 /// @file userver/ugrpc/server/server.hpp
 /// @brief @copybrief ugrpc::server::Server
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/server_builder.h>
@@ -25,6 +27,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server {
 
+class GenericServiceBase;
+
 /// Settings relating to the whole gRPC server
 struct ServerConfig final {
   /// The port to listen to. If `0`, a free port will be picked automatically.
@@ -43,6 +47,10 @@ struct ServerConfig final {
   /// Serve a web page with runtime info about gRPC connections
   bool enable_channelz{false};
 
+  /// Number of completion queues, each one is drained by its own thread.
+  /// The incoming RPCs of all the services are spread across the queues.
+  std::size_t completion_queue_count{1};
+
   /// 'access-tskv.log' logger
   logging::LoggerPtr access_tskv_logger{logging::MakeNullLogger()};
 };
@@ -69,6 +77,12 @@ class Server final {
   /// least until `Stop` is called.
   void AddService(ServiceBase& service, ServiceConfig&& config);
 
+  /// @brief Register a generic service implementation that handles the RPCs
+  /// of all the methods that are not implemented by the other services.
+  /// At most one generic service could be registered, the same lifetime
+  /// requirements apply.
+  void AddService(GenericServiceBase& service, ServiceConfig&& config);
+
   /// @brief Get names of all registered services
   std::vector<std::string_view> GetServiceNames() const;
 
@@ -82,6 +96,10 @@ class Server final {
   /// usually no more than one instance per program.
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  /// @brief Get all the completion queues of the server, the first one is
+  /// returned by GetCompletionQueue()
+  std::vector<grpc::CompletionQueue*> GetCompletionQueues();
+
   /// @brief Start accepting requests
   /// @note Must be called at most once after all the services are registered
   void Start();
@@ -3,8 +3,14 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 
@@ -19,6 +25,30 @@ struct ServiceConfig final {
 
   /// Server middlewares to use for the gRPC service.
   Middlewares middlewares;
+
+  /// If not 0, requests are parsed into a per-call protobuf arena with
+  /// a reused initial block of this size, see CallAnyBase::GetArena.
+  std::size_t arena_initial_block_size{0};
+
+  /// @brief Names of the unary methods served by long-lived tasks.
+  ///
+  /// Each completion queue gets `inline_tasks_per_queue` tasks per method
+  /// that handle the calls one after another, instead of a new task per
+  /// call. Suits cheap handlers that do not wait for anything. The handlers
+  /// are not cancelled when the client cancels the call, the task-local
+  /// variables are reset between the calls.
+  std::vector<std::string> inline_methods{};
+
+  /// Max number of the calls of each inline method handled concurrently on
+  /// a completion queue
+  std::size_t inline_tasks_per_queue{4};
+
+  /// Compression of the responses of the methods missing from
+  /// `method_compression`
+  CompressionConfig compression{};
+
+  /// Compression of the responses by method name, e.g. SayHello
+  std::unordered_map<std::string, CompressionConfig> method_compression{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -15,6 +15,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server {
 
+class GenericServiceBase;
 class ServerComponent;
 
 // clang-format off
@@ -28,6 +29,12 @@ class ServerComponent;
 /// ---- | ----------- | -------------
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// middlewares | middleware component names to use for each RPC call, can be empty array ([]) | taken from grpc-server.service-defaults
+/// arena-initial-block-size | if not 0, requests are parsed into per-call protobuf arenas with reused initial blocks of this size, see ugrpc::server::CallAnyBase::GetArena | 0
+/// inline-methods | unary methods served by long-lived tasks instead of a new task per call, see ugrpc::server::ServiceConfig::inline_methods | []
+/// inline-tasks-per-queue | number of tasks per completion queue serving each of the inline-methods | 4
+/// compression.algorithm | compression of the responses, 'identity', 'deflate' or 'gzip', see ugrpc::CompressionConfig | identity
+/// compression.min-message-size-bytes | the smaller responses are sent uncompressed | 0
+/// method-compression | the `compression` by method name, e.g. `SayHello` | {}
 
 // clang-format on
 
@@ -43,6 +50,9 @@ class ServiceComponentBase : public components::LoggableComponentBase {
   /// RegisterService with it
   void RegisterService(ServiceBase& service);
 
+  /// @overload
+  void RegisterService(GenericServiceBase& service);
+
  private:
   ServerComponent& server_;
   ServiceConfig config_;
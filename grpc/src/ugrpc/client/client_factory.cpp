@@ -2,14 +2,18 @@
 
 #include <optional>
 #include <stdexcept>
+#include <string>
 
 #include <fmt/format.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/logging/level_serialization.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include <userver/ugrpc/impl/status_codes.hpp>
+
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/impl/to_string.hpp>
 
@@ -55,6 +59,31 @@ AuthType Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+RetryConfig ParseRetryConfig(const yaml_config::YamlConfig& value) {
+  RetryConfig config;
+  if (value.IsMissing()) return config;
+
+  const auto codes = value["retryable-status-codes"];
+  if (!codes.IsMissing()) {
+    config.retryable_status_codes.clear();
+    for (const auto& code : codes) {
+      const auto name = code.As<std::string>();
+      const auto status_code = ugrpc::impl::StatusCodeFromString(name);
+      if (!status_code) {
+        throw std::runtime_error(fmt::format(
+            "Invalid gRPC status code '{}' at '{}'", name, code.GetPath()));
+      }
+      config.retryable_status_codes.push_back(*status_code);
+    }
+  }
+
+  config.budget = value["budget"].As<std::size_t>(config.budget);
+  config.budget_refill_interval =
+      value["budget-refill-interval"].As<std::chrono::milliseconds>(
+          config.budget_refill_interval);
+  return config;
+}
+
 std::shared_ptr<grpc::ChannelCredentials> MakeDefaultCredentials(
     AuthType type) {
   switch (type) {
@@ -80,6 +109,12 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
       value["native-log-level"].As<logging::Level>(config.native_log_level);
   config.channel_count =
       value["channel-count"].As<std::size_t>(config.channel_count);
+  config.max_channel_count =
+      value["max-channel-count"].As<std::size_t>(config.channel_count);
+  config.max_streams_per_channel =
+      value["max-streams-per-channel"].As<std::size_t>(
+          config.max_streams_per_channel);
+  config.retry = ParseRetryConfig(value["retry"]);
 
   return config;
 }
@@ -91,16 +126,35 @@ ClientFactory::ClientFactory(ClientFactoryConfig&& config,
                              utils::statistics::Storage& statistics_storage,
                              testsuite::GrpcControl& testsuite_grpc,
                              dynamic_config::Source source)
+    : ClientFactory(std::move(config), channel_task_processor, std::move(mws),
+                    std::vector<grpc::CompletionQueue*>{&queue},
+                    statistics_storage, testsuite_grpc, source) {}
+
+ClientFactory::ClientFactory(ClientFactoryConfig&& config,
+                             engine::TaskProcessor& channel_task_processor,
+                             MiddlewareFactories mws,
+                             std::vector<grpc::CompletionQueue*> queues,
+                             utils::statistics::Storage& statistics_storage,
+                             testsuite::GrpcControl& testsuite_grpc,
+                             dynamic_config::Source source)
     : channel_task_processor_(channel_task_processor),
       mws_(mws),
-      queue_(queue),
+      queues_(std::move(queues)),
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? config.credentials
                          : grpc::InsecureChannelCredentials(),
-                     config.channel_args, config.channel_count),
-      client_statistics_storage_(statistics_storage, "client"),
+                     config.channel_args, config.channel_count,
+                     config.max_channel_count, config.max_streams_per_channel),
+      client_statistics_storage_(
+          statistics_storage, "client",
+          [this](utils::statistics::Writer& writer) {
+            auto channels = writer["channels"];
+            impl::DumpMetric(channels, channel_cache_);
+          }),
       config_source_(source),
-      testsuite_grpc_(testsuite_grpc) {
+      testsuite_grpc_(testsuite_grpc),
+      retry_config_(std::move(config.retry)) {
+  UINVARIANT(!queues_.empty(), "No completion queues for the clients");
   ugrpc::impl::SetupNativeLogging();
   ugrpc::impl::UpdateNativeLogLevel(config.native_log_level);
 }
@@ -5,6 +5,8 @@
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/ugrpc/server/server_component.hpp>
@@ -20,17 +22,22 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto& task_processor =
       context.GetTaskProcessor(config["task-processor"].As<std::string>());
 
-  grpc::CompletionQueue* queue = nullptr;
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+
+  std::vector<grpc::CompletionQueue*> queues;
   if (auto* const server =
           context.FindComponentOptional<ugrpc::server::ServerComponent>()) {
-    queue = &server->GetServer().GetCompletionQueue();
+    queues = server->GetServer().GetCompletionQueues();
   } else {
-    queue_.emplace();
-    queue = &queue_->GetQueue();
+    queue_.emplace(config["completion-queue-count"].As<std::size_t>(1));
+    queues = queue_->GetQueues();
+    queue_statistics_holder_ = statistics_storage.RegisterWriter(
+        "grpc.client.queues", [this](utils::statistics::Writer& writer) {
+          DumpMetric(writer, *queue_);
+        });
   }
 
-  auto& statistics_storage =
-      context.FindComponent<components::StatisticsStorage>().GetStorage();
   const auto config_source =
       context.FindComponent<components::DynamicConfig>().GetSource();
 
@@ -45,7 +52,12 @@ ClientFactoryComponent::ClientFactoryComponent(
     mws.push_back(component.GetMiddlewareFactory());
   }
   factory_.emplace(config.As<ClientFactoryConfig>(), task_processor, mws,
-                   *queue, statistics_storage, testsuite_grpc, config_source);
+                   std::move(queues), statistics_storage, testsuite_grpc,
+                   config_source);
+}
+
+ClientFactoryComponent::~ClientFactoryComponent() {
+  queue_statistics_holder_.Unregister();
 }
 
 ClientFactory& ClientFactoryComponent::GetFactory() { return *factory_; }
@@ -90,11 +102,56 @@ properties:
             This value is used if the name resolution process can't get value
             from DNS
         defaultDescription: absent
+    completion-queue-count:
+        type: integer
+        description: |
+            Number of completion queues, each one is drained by its own
+            thread. Ignored if ugrpc::server::ServerComponent exists, the
+            queues of the server are used then.
+        defaultDescription: 1
+        minimum: 1
     channel-count:
         type: integer
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    max-channel-count:
+        type: integer
+        description: |
+            Max number of channels for each endpoint, a channel is added once
+            all the channels have max-streams-per-channel RPCs in flight.
+        defaultDescription: channel-count
+    max-streams-per-channel:
+        type: integer
+        description: |
+            Number of RPCs in flight that makes a channel busy, usually the
+            max-concurrent-streams of the server.
+        defaultDescription: 100
+    retry:
+        type: object
+        description: retries of the unary RPCs
+        additionalProperties: false
+        properties:
+            retryable-status-codes:
+                type: array
+                description: status codes of the attempts that are retried
+                defaultDescription: '[UNAVAILABLE]'
+                items:
+                    type: string
+                    description: gRPC status code, e.g. UNAVAILABLE
+            budget:
+                type: integer
+                description: |
+                    Max number of retried and hedged attempts of a client in
+                    a burst.
+                defaultDescription: 100
+                minimum: 0
+            budget-refill-interval:
+                type: string
+                description: |
+                    The retry budget of a client gets one more attempt each
+                    interval.
+                defaultDescription: 10ms
     middlewares:
         type: array
         items:
@@ -0,0 +1,101 @@
+#include <userver/ugrpc/client/generic.hpp>
+
+#include <string>
+#include <utility>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include <userver/utils/algo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+namespace {
+
+constexpr std::string_view kGenericMethodFullNames[] = {"Generic/Generic"};
+
+constexpr ugrpc::impl::StaticServiceMetadata kGenericMetadata{
+    "Generic", kGenericMethodFullNames};
+
+// Mimics the generated code for ClientData
+struct GenericService final {
+  using Stub = grpc::GenericStub;
+
+  static std::unique_ptr<Stub> NewStub(
+      const std::shared_ptr<grpc::Channel>& channel) {
+    return std::make_unique<Stub>(channel);
+  }
+};
+
+// Binds the method name, so that the calls could be prepared just like
+// the ones of the generated stubs
+class GenericStubAdapter final {
+ public:
+  GenericStubAdapter(grpc::GenericStub& stub, std::string_view call_name)
+      : stub_(stub), method_(utils::StrCat("/", call_name)) {}
+
+  impl::RawResponseReader<grpc::ByteBuffer> PrepareAsyncUnary(
+      grpc::ClientContext* context, const grpc::ByteBuffer& request,
+      grpc::CompletionQueue* queue) {
+    return stub_.PrepareUnaryCall(context, method_, request, queue);
+  }
+
+  impl::RawReaderWriter<grpc::ByteBuffer, grpc::ByteBuffer>
+  PrepareAsyncBidirectional(grpc::ClientContext* context,
+                            grpc::CompletionQueue* queue) {
+    return stub_.PrepareCall(context, method_, queue);
+  }
+
+ private:
+  grpc::GenericStub& stub_;
+  const std::string method_;
+};
+
+impl::CallParams CreateGenericCallParams(
+    const impl::ClientData& client_data, std::string_view call_name,
+    std::unique_ptr<grpc::ClientContext> context, const Qos& qos) {
+  ApplyQos(*context, qos, client_data.GetTestsuiteControl());
+  auto call_params =
+      impl::DoCreateCallParams(client_data, 0, std::move(context));
+  call_params.call_name = call_name;
+  call_params.compression = impl::MakeCompressionConfig(qos, {});
+  return call_params;
+}
+
+}  // namespace
+
+GenericClient::GenericClient(impl::ClientParams&& client_params)
+    : impl_(std::move(client_params), GetMetadata(),
+            std::in_place_type<GenericService>) {}
+
+client::UnaryCall<grpc::ByteBuffer> GenericClient::CallUnary(
+    std::string_view call_name, const grpc::ByteBuffer& request,
+    std::unique_ptr<grpc::ClientContext> context, const Qos& qos) const {
+  auto call_params =
+      CreateGenericCallParams(impl_, call_name, std::move(context), qos);
+  GenericStubAdapter stub{
+      impl_.GetStub<GenericService>(call_params.channel_lease), call_name};
+  return {std::move(call_params), stub, &GenericStubAdapter::PrepareAsyncUnary,
+          request};
+}
+
+client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>
+GenericClient::CallBidirectional(std::string_view call_name,
+                                 std::unique_ptr<grpc::ClientContext> context,
+                                 const Qos& qos) const {
+  auto call_params =
+      CreateGenericCallParams(impl_, call_name, std::move(context), qos);
+  GenericStubAdapter stub{
+      impl_.GetStub<GenericService>(call_params.channel_lease), call_name};
+  return {std::move(call_params), stub,
+          &GenericStubAdapter::PrepareAsyncBidirectional};
+}
+
+ugrpc::impl::StaticServiceMetadata GenericClient::GetMetadata() {
+  return kGenericMetadata;
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
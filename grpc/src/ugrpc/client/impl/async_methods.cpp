@@ -93,7 +93,9 @@ RpcData::RpcData(impl::CallParams&& params)
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      channel_lease_(std::move(params.channel_lease)),
+      compression_(params.compression) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_);
@@ -161,6 +163,10 @@ ugrpc::impl::RpcStatisticsScope& RpcData::GetStatsScope() noexcept {
   return stats_scope_;
 }
 
+const ugrpc::CompressionConfig& RpcData::GetCompression() const noexcept {
+  return compression_;
+}
+
 void RpcData::SetFinished() noexcept {
   UASSERT(context_);
   UINVARIANT(!is_finished_, "Tried to finish already finished call");
@@ -275,6 +281,13 @@ void PrepareRead(RpcData& data) {
   UINVARIANT(!data.IsFinished(), "'Read' called on a finished call");
 }
 
+void EnableStreamCompression(RpcData& data) {
+  const auto algorithm = data.GetCompression().algorithm;
+  if (algorithm != GRPC_COMPRESS_NONE) {
+    data.GetContext().set_compression_algorithm(algorithm);
+  }
+}
+
 void PrepareWrite(RpcData& data) {
   UINVARIANT(!data.AreWritesFinished(),
              "'Write' called on a stream that is closed for writes");
@@ -13,7 +13,25 @@ CallParams DoCreateCallParams(const ClientData& client_data,
                     client_data.GetMetadata().method_full_names[method_id],
                     std::move(context),
                     client_data.GetStatistics(method_id),
-                    client_data.GetMiddlewares()};
+                    client_data.GetMiddlewares(),
+                    client_data.LeaseChannel()};
+}
+
+ugrpc::CompressionConfig MakeCompressionConfig(const Qos& user_qos,
+                                               const Qos& config_qos) {
+  ugrpc::CompressionConfig compression;
+  compression.algorithm = user_qos.compression.value_or(
+      config_qos.compression.value_or(GRPC_COMPRESS_NONE));
+  compression.min_message_size = user_qos.compression_min_size.value_or(
+      config_qos.compression_min_size.value_or(0));
+  return compression;
+}
+
+CallParams MakeAttemptCallParams(const RetryParams& retry) {
+  auto params = DoCreateCallParams(retry.client_data, retry.method_id,
+                                   retry.MakeContext());
+  params.compression = retry.compression;
+  return params;
 }
 
 }  // namespace ugrpc::client::impl
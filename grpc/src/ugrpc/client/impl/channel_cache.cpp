@@ -1,12 +1,17 @@
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <string>
 #include <utility>
 
+#include <grpc/impl/codegen/grpc_types.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/to_string.hpp>
 
@@ -47,44 +52,137 @@ const std::shared_ptr<grpc::Channel>& ChannelCache::Token::GetChannel(
     std::size_t index) const noexcept {
   UASSERT(counted_channel_);
   UASSERT(index < counted_channel_->channels.size());
-  return counted_channel_->channels[index];
+  return counted_channel_->channels[index].channel;
 }
 
 std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
+  UASSERT(counted_channel_);
+  return counted_channel_->active_count.load(std::memory_order_relaxed);
+}
+
+std::size_t ChannelCache::Token::GetMaxChannelCount() const noexcept {
   UASSERT(counted_channel_);
   return counted_channel_->channels.size();
 }
 
+ChannelCache::Lease ChannelCache::Token::LeaseChannel() const noexcept {
+  UASSERT(cache_);
+  UASSERT(counted_channel_);
+  auto& channels = counted_channel_->channels;
+  auto active_count =
+      counted_channel_->active_count.load(std::memory_order_relaxed);
+
+  // Equally loaded channels are picked evenly
+  const auto start = utils::RandRange(active_count);
+  std::size_t best_index = start;
+  auto best_in_flight = std::numeric_limits<std::uint64_t>::max();
+  for (std::size_t i = 0; i < active_count; ++i) {
+    const auto index = (start + i) % active_count;
+    const auto in_flight =
+        channels[index].in_flight.load(std::memory_order_relaxed);
+    if (in_flight < best_in_flight) {
+      best_index = index;
+      best_in_flight = in_flight;
+    }
+  }
+
+  // Otherwise the new RPCs would wait for the max-concurrent-streams of the
+  // HTTP/2 connections
+  if (best_in_flight >= cache_->max_streams_per_channel_ &&
+      active_count < channels.size() &&
+      counted_channel_->active_count.compare_exchange_strong(
+          active_count, active_count + 1, std::memory_order_relaxed)) {
+    best_index = active_count;
+  }
+
+  return Lease{channels[best_index], best_index};
+}
+
+ChannelCache::Lease::Lease(PooledChannel& channel, std::size_t index) noexcept
+    : channel_(&channel), index_(index) {
+  channel_->in_flight.fetch_add(1, std::memory_order_relaxed);
+}
+
+ChannelCache::Lease::Lease(Lease&& other) noexcept
+    : channel_(std::exchange(other.channel_, nullptr)), index_(other.index_) {}
+
+ChannelCache::Lease& ChannelCache::Lease::operator=(Lease&& other) noexcept {
+  std::swap(channel_, other.channel_);
+  std::swap(index_, other.index_);
+  return *this;
+}
+
+ChannelCache::Lease::~Lease() {
+  if (channel_) channel_->in_flight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::size_t ChannelCache::Lease::GetChannelIndex() const noexcept {
+  UASSERT(channel_);
+  return index_;
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
+    const grpc::ChannelArguments& channel_args, std::size_t count,
+    std::size_t max_count)
+    : active_count(count) {
+  UASSERT(count > 0);
+  UASSERT(count <= max_count);
+
+  auto args = channel_args;
+  if (max_count > 1) {
+    // Channels with the same arguments share the connections of the global
+    // subchannel pool, which defeats the purpose of having many channels
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  }
+
   const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
-  channels = utils::GenerateFixedArray(count, [&](std::size_t) {
-    return grpc::CreateCustomChannel(endpoint_string, credentials,
-                                     channel_args);
+  channels = utils::GenerateFixedArray(max_count, [&](std::size_t) {
+    return PooledChannel{
+        grpc::CreateCustomChannel(endpoint_string, credentials, args)};
   });
-  UASSERT(count > 0);
 }
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count,
+    std::size_t max_channel_count, std::size_t max_streams_per_channel)
     : credentials_(std::move(credentials)),
       channel_args_(channel_args),
-      channel_count_(channel_count) {
+      channel_count_(channel_count),
+      max_channel_count_(std::max(channel_count, max_channel_count)),
+      max_streams_per_channel_(max_streams_per_channel) {
   UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
+  UINVARIANT(max_streams_per_channel > 0,
+             "Max streams per channel must be greater than zero");
 }
 
 ChannelCache::~ChannelCache() = default;
 
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   auto channels = channels_.Lock();
-  const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_,
-                                             channel_args_, channel_count_);
+  const auto [it, _] =
+      channels->try_emplace(endpoint, endpoint, credentials_, channel_args_,
+                            channel_count_, max_channel_count_);
   return {*this, it->first, it->second};
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ChannelCache& cache) {
+  const auto channels = cache.channels_.Lock();
+  for (const auto& [endpoint, counted_channel] : *channels) {
+    const auto active_count =
+        counted_channel.active_count.load(std::memory_order_relaxed);
+    writer["count"].ValueWithLabels(active_count, {"grpc_endpoint", endpoint});
+
+    for (std::size_t i = 0; i < active_count; ++i) {
+      writer["in-flight"].ValueWithLabels(
+          counted_channel.channels[i].in_flight.load(std::memory_order_relaxed),
+          {{"grpc_endpoint", endpoint}, {"grpc_channel", std::to_string(i)}});
+    }
+  }
+}
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
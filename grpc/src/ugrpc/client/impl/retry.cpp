@@ -0,0 +1,128 @@
+#include <userver/ugrpc/client/impl/retry.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/impl/call_params.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+namespace {
+
+// Checks the time left and the retry budget before one more attempt
+bool CanStartAttempt(const RetryParams& params,
+                     ugrpc::impl::MethodStatistics& statistics) {
+  if (std::chrono::system_clock::now() >= params.deadline) return false;
+  if (!params.client_data.GetRetryBudget().TryObtain()) {
+    statistics.AccountRetryBudgetExhausted();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+std::unique_ptr<grpc::ClientContext> RetryParams::MakeContext() const {
+  auto context = context_factory();
+  UINVARIANT(context, "ClientContextFactory has returned nullptr");
+  context->set_deadline(deadline);
+  return context;
+}
+
+std::unique_ptr<RetryParams> MakeRetryParams(
+    const ClientData& client_data, std::size_t method_id,
+    const grpc::ClientContext& context, ClientContextFactory&& context_factory,
+    const Qos& user_qos, const Qos& config_qos) {
+  if (!context_factory) return nullptr;
+  const auto attempts =
+      user_qos.attempts.value_or(config_qos.attempts.value_or(1));
+  if (attempts <= 1) return nullptr;
+
+  return std::unique_ptr<RetryParams>(new RetryParams{
+      attempts,
+      user_qos.hedging_delay ? user_qos.hedging_delay
+                             : config_qos.hedging_delay,
+      client_data,
+      method_id,
+      std::move(context_factory),
+      context.deadline(),
+      MakeCompressionConfig(user_qos, config_qos),
+  });
+}
+
+std::size_t RunAttempts(const RetryParams& params, std::string_view call_name,
+                        const AttemptStarter& start_attempt) {
+  auto& statistics = params.client_data.GetStatistics(params.method_id);
+  const auto& budget = params.client_data.GetRetryBudget();
+
+  std::vector<engine::TaskWithResult<void>> attempts;
+  std::vector<bool> is_hedge;
+  attempts.reserve(params.attempts);
+  is_hedge.reserve(params.attempts);
+  const auto start = [&](bool hedge) {
+    attempts.push_back(start_attempt(attempts.size()));
+    is_hedge.push_back(hedge);
+  };
+
+  start(false);
+  std::size_t running = 1;
+  bool is_hedging = params.hedging_delay.has_value();
+  const auto next_hedge_deadline = [&] {
+    return is_hedging ? engine::Deadline::FromDuration(*params.hedging_delay)
+                      : engine::Deadline{};
+  };
+  auto hedge_deadline = next_hedge_deadline();
+
+  while (true) {
+    const bool can_hedge = is_hedging && attempts.size() < params.attempts;
+    const auto index = engine::WaitAnyUntil(
+        can_hedge ? hedge_deadline : engine::Deadline{}, attempts);
+
+    if (!index) {
+      if (!can_hedge || engine::current_task::ShouldCancel()) {
+        throw RpcCancelledError(call_name, "Finish");
+      }
+      // No response within the hedging delay
+      if (CanStartAttempt(params, statistics)) {
+        start(true);
+        ++running;
+        statistics.AccountHedge();
+      } else {
+        is_hedging = false;
+      }
+      hedge_deadline = next_hedge_deadline();
+      continue;
+    }
+
+    try {
+      attempts[*index].Get();
+      if (is_hedge[*index]) statistics.AccountHedgeWin();
+      // The rest of the attempts are cancelled by the task destructors
+      return *index;
+    } catch (const ErrorWithStatus& ex) {
+      --running;
+      if (!budget.IsRetryable(ex.GetStatus().error_code())) throw;
+
+      if (attempts.size() < params.attempts &&
+          CanStartAttempt(params, statistics)) {
+        start(false);
+        ++running;
+        statistics.AccountRetry();
+        hedge_deadline = next_hedge_deadline();
+      } else if (running == 0) {
+        throw;
+      }
+    }
+  }
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
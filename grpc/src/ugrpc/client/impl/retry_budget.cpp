@@ -0,0 +1,23 @@
+#include <userver/ugrpc/client/impl/retry_budget.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+RetryBudget::RetryBudget(const RetryConfig& config)
+    : retryable_status_codes_(config.retryable_status_codes),
+      tokens_(config.budget, {1, config.budget_refill_interval}) {}
+
+bool RetryBudget::IsRetryable(grpc::StatusCode code) const noexcept {
+  return std::find(retryable_status_codes_.begin(),
+                   retryable_status_codes_.end(),
+                   code) != retryable_status_codes_.end();
+}
+
+bool RetryBudget::TryObtain() { return tokens_.Obtain(); }
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -4,20 +4,50 @@
 #include <fmt/format.h>
 #include <grpcpp/client_context.h>
 
+#include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/testsuite/grpc_control.hpp>
 
+#include <userver/ugrpc/impl/compression.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
-Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
-  auto ms =
-      value["timeout-ms"].As<std::optional<std::chrono::milliseconds::rep>>();
-  if (!ms) return Qos{};
+namespace {
 
-  return Qos{std::optional<std::chrono::milliseconds>{*ms}};
+std::optional<std::chrono::milliseconds> ParseMs(
+    const formats::json::Value& value) {
+  auto ms = value.As<std::optional<std::chrono::milliseconds::rep>>();
+  if (!ms) return std::nullopt;
+  return std::chrono::milliseconds{*ms};
+}
+
+std::optional<grpc_compression_algorithm> ParseCompression(
+    const formats::json::Value& value) {
+  const auto name = value.As<std::optional<std::string>>();
+  if (!name) return std::nullopt;
+  const auto algorithm = ugrpc::impl::FindCompressionAlgorithm(*name);
+  if (!algorithm) {
+    throw formats::json::ParseException(
+        fmt::format("Unknown gRPC compression algorithm '{}' at '{}'", *name,
+                    value.GetPath()));
+  }
+  return algorithm;
+}
+
+}  // namespace
+
+Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
+  Qos qos;
+  qos.timeout = ParseMs(value["timeout-ms"]);
+  qos.attempts = value["attempts"].As<std::optional<std::size_t>>();
+  qos.hedging_delay = ParseMs(value["hedging-delay-ms"]);
+  qos.compression = ParseCompression(value["compression"]);
+  qos.compression_min_size =
+      value["compression-min-size-bytes"].As<std::optional<std::size_t>>();
+  return qos;
 }
 
 void ApplyQos(grpc::ClientContext& context, const Qos& qos,
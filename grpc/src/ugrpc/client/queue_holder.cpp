@@ -1,21 +1,58 @@
 #include <userver/ugrpc/client/queue_holder.hpp>
 
+#include <string>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
 #include <userver/ugrpc/impl/queue_runner.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
-struct QueueHolder::Impl final {
+namespace {
+
+struct RunningQueue final {
+  utils::statistics::RateCounter events;
   grpc::CompletionQueue queue;
-  ugrpc::impl::QueueRunner queue_runner{queue};
+  ugrpc::impl::QueueRunner queue_runner{queue, events};
+};
+
+}  // namespace
+
+struct QueueHolder::Impl final {
+  explicit Impl(std::size_t queue_count) : queues(queue_count) {
+    UINVARIANT(queue_count > 0, "Queue count must be greater than zero");
+    queue_ptrs.reserve(queue_count);
+    for (auto& queue : queues) queue_ptrs.push_back(&queue.queue);
+  }
+
+  utils::FixedArray<RunningQueue> queues;
+  std::vector<grpc::CompletionQueue*> queue_ptrs;
 };
 
-QueueHolder::QueueHolder() = default;
+QueueHolder::QueueHolder(std::size_t queue_count) : impl_(queue_count) {}
 
 QueueHolder::~QueueHolder() = default;
 
-grpc::CompletionQueue& QueueHolder::GetQueue() { return impl_->queue; }
+grpc::CompletionQueue& QueueHolder::GetQueue() {
+  return impl_->queues.front().queue;
+}
+
+const std::vector<grpc::CompletionQueue*>& QueueHolder::GetQueues() {
+  return impl_->queue_ptrs;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const QueueHolder& holder) {
+  const auto& queues = holder.impl_->queues;
+  for (std::size_t i = 0; i < queues.size(); ++i) {
+    writer["events"].ValueWithLabels(queues[i].events.Load(),
+                                     {"grpc_queue", std::to_string(i)});
+  }
+}
 
 }  // namespace ugrpc::client
 
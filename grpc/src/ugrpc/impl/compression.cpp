@@ -0,0 +1,43 @@
+#include <userver/ugrpc/impl/compression.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace impl {
+
+std::optional<grpc_compression_algorithm> FindCompressionAlgorithm(
+    std::string_view name) noexcept {
+  if (name == "identity") return GRPC_COMPRESS_NONE;
+  if (name == "deflate") return GRPC_COMPRESS_DEFLATE;
+  if (name == "gzip") return GRPC_COMPRESS_GZIP;
+  return std::nullopt;
+}
+
+}  // namespace impl
+
+CompressionConfig Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<CompressionConfig>) {
+  CompressionConfig config;
+
+  const auto algorithm_name = value["algorithm"].As<std::string>("identity");
+  const auto algorithm = impl::FindCompressionAlgorithm(algorithm_name);
+  if (!algorithm) {
+    throw yaml_config::ParseException(
+        fmt::format("Unknown gRPC compression algorithm '{}' at '{}'",
+                    algorithm_name, value["algorithm"].GetPath()));
+  }
+  config.algorithm = *algorithm;
+  config.min_message_size =
+      value["min-message-size-bytes"].As<std::size_t>(config.min_message_size);
+
+  return config;
+}
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
@@ -14,6 +14,7 @@ namespace ugrpc::impl {
 namespace {
 
 void ProcessQueue(grpc::CompletionQueue& queue,
+                  utils::statistics::RateCounter& events,
                   engine::SingleUseEvent& completion) noexcept {
   utils::SetCurrentThreadName("grpc-queue");
 
@@ -24,6 +25,7 @@ void ProcessQueue(grpc::CompletionQueue& queue,
     auto* call = static_cast<EventBase*>(tag);
     UASSERT(call != nullptr);
     call->Notify(ok);
+    ++events;
   }
 
   completion.Send();
@@ -31,8 +33,10 @@ void ProcessQueue(grpc::CompletionQueue& queue,
 
 }  // namespace
 
-QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-  std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue,
+                         utils::statistics::RateCounter& events)
+    : queue_(queue), events_(events) {
+  std::thread([this] { ProcessQueue(queue_, events_, completion_); }).detach();
 }
 
 QueueRunner::~QueueRunner() {
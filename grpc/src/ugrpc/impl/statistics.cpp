@@ -60,6 +60,60 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept {
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountRetry() noexcept { ++retries_; }
+
+void MethodStatistics::AccountHedge() noexcept { ++hedges_; }
+
+void MethodStatistics::AccountHedgeWin() noexcept { ++hedge_wins_; }
+
+void MethodStatistics::AccountRetryBudgetExhausted() noexcept {
+  ++retry_budget_exhausted_;
+}
+
+void MethodStatistics::AccountMessageSent(std::size_t size,
+                                          bool is_compressed) noexcept {
+  if (is_compressed) {
+    ++compressed_messages_;
+    compressed_bytes_.Add(utils::statistics::Rate{size});
+  } else {
+    ++uncompressed_messages_;
+    uncompressed_bytes_.Add(utils::statistics::Rate{size});
+  }
+}
+
+bool MethodStatistics::TryStartHandling(std::size_t max_in_flight) noexcept {
+  if (handling_.fetch_add(1, std::memory_order_relaxed) < max_in_flight) {
+    return true;
+  }
+  handling_.fetch_sub(1, std::memory_order_relaxed);
+  return false;
+}
+
+void MethodStatistics::FinishHandling() noexcept {
+  handling_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds MethodStatistics::GetRecentTimingMedian() noexcept {
+  using Clock = std::chrono::steady_clock;
+  constexpr auto kUpdatePeriod = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::seconds{1});
+
+  const auto now = Clock::now().time_since_epoch().count();
+  auto last_update = timing_median_update_.load(std::memory_order_relaxed);
+  // The other callers use the previous value while one of them recomputes it
+  if (now - last_update >= kUpdatePeriod.count() &&
+      timing_median_update_.compare_exchange_strong(
+          last_update, now, std::memory_order_relaxed)) {
+    const auto timings = timings_.GetStatsForPeriod(
+        decltype(timings_)::Duration::min(), /*with_current_epoch=*/true);
+    timing_median_ms_.store(
+        static_cast<std::int64_t>(timings.GetPercentile(50)),
+        std::memory_order_relaxed);
+  }
+  return std::chrono::milliseconds{
+      timing_median_ms_.load(std::memory_order_relaxed)};
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const MethodStatistics& stats) {
   writer["timings"] = stats.timings_;
@@ -114,6 +168,32 @@ void DumpMetric(utils::statistics::Writer& writer,
       AsRateAndGauge{stats.deadline_updated_.Load()};
   writer["cancelled-by-deadline-propagation"] =
       AsRateAndGauge{deadline_cancelled_value};
+
+  // Each attempt is accounted above as a separate RPC, the retries are only
+  // written for the methods that use them
+  const auto retries_value = stats.retries_.Load();
+  const auto hedges_value = stats.hedges_.Load();
+  const auto budget_exhausted_value = stats.retry_budget_exhausted_.Load();
+  if (retries_value.value || hedges_value.value ||
+      budget_exhausted_value.value) {
+    auto attempts = writer["attempts"];
+    attempts["retries"] = retries_value;
+    attempts["hedges"] = hedges_value;
+    attempts["hedge-wins"] = stats.hedge_wins_.Load();
+    attempts["retry-budget-exhausted"] = budget_exhausted_value;
+  }
+
+  // gRPC does not report the sizes after the compression, the bytes are the
+  // serialized sizes of the messages sent with and without the compression
+  const auto compressed_messages_value = stats.compressed_messages_.Load();
+  const auto uncompressed_messages_value = stats.uncompressed_messages_.Load();
+  if (compressed_messages_value.value || uncompressed_messages_value.value) {
+    auto compression = writer["compression"];
+    compression["compressed-messages"] = compressed_messages_value;
+    compression["compressed-raw-bytes"] = stats.compressed_bytes_.Load();
+    compression["uncompressed-messages"] = uncompressed_messages_value;
+    compression["uncompressed-bytes"] = stats.uncompressed_bytes_.Load();
+  }
 }
 
 ServiceStatistics::~ServiceStatistics() = default;
@@ -35,6 +35,10 @@ void RpcStatisticsScope::CancelledByDeadlinePropagation() {
   finish_kind_ = std::max(finish_kind_, FinishKind::kDeadlinePropagation);
 }
 
+void RpcStatisticsScope::OnMessageSent(std::size_t size, bool is_compressed) {
+  statistics_.AccountMessageSent(size, is_compressed);
+}
+
 void RpcStatisticsScope::OnDeadlinePropagated() {
   statistics_.AccountDeadlinePropagated();
 }
@@ -11,7 +11,9 @@ USERVER_NAMESPACE_BEGIN
 namespace ugrpc::impl {
 
 StatisticsStorage::StatisticsStorage(
-    utils::statistics::Storage& statistics_storage, std::string_view domain) {
+    utils::statistics::Storage& statistics_storage, std::string_view domain,
+    ExtraWriter extra_writer)
+    : extra_writer_(std::move(extra_writer)) {
   statistics_holder_ = statistics_storage.RegisterWriter(
       fmt::format("grpc.{}", domain),
       [this](utils::statistics::Writer& writer) { ExtendStatistics(writer); });
@@ -50,6 +52,7 @@ void StatisticsStorage::ExtendStatistics(utils::statistics::Writer& writer) {
       by_destination = service_stats;
     }
   }
+  if (extra_writer_) extra_writer_(writer);
 }
 
 }  // namespace ugrpc::impl
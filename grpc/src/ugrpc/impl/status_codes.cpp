@@ -54,6 +54,17 @@ std::string_view ToString(grpc::StatusCode code) noexcept {
   }
 }
 
+std::optional<grpc::StatusCode> StatusCodeFromString(
+    std::string_view name) noexcept {
+  // StatusCode enum cases have consecutive underlying values, starting from 0
+  for (int value = 0;
+       value <= static_cast<int>(grpc::StatusCode::UNAUTHENTICATED); ++value) {
+    const auto code = static_cast<grpc::StatusCode>(value);
+    if (ToString(code) == name) return code;
+  }
+  return std::nullopt;
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
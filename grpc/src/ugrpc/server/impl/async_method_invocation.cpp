@@ -18,7 +18,8 @@ void RpcFinishedEvent::Notify(bool ok) noexcept {
   // From the documentation to grpcpp: Server-side AsyncNotifyWhenDone:
   // ok should always be true
   UASSERT(ok);
-  if (server_ctx_.IsCancelled()) {
+  // The token is empty for the tasks that serve many calls
+  if (server_ctx_.IsCancelled() && cancellation_token_.IsValid()) {
     cancellation_token_.RequestCancel();
   }
   event_.Send();
@@ -0,0 +1,57 @@
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+
+#include <boost/lockfree/stack.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+// Blocks above the limit are freed, so a burst of calls does not keep
+// the memory forever
+constexpr std::size_t kMaxPooledBlocks = 256;
+
+google::protobuf::ArenaOptions MakeArenaOptions(char* block,
+                                                std::size_t block_size) {
+  google::protobuf::ArenaOptions options;
+  options.initial_block = block;
+  options.initial_block_size = block_size;
+  return options;
+}
+
+}  // namespace
+
+struct ArenaBlockPool::Impl final {
+  boost::lockfree::stack<char*, boost::lockfree::capacity<kMaxPooledBlocks>>
+      blocks;
+};
+
+ArenaBlockPool::ArenaBlockPool(std::size_t block_size)
+    : block_size_(block_size), impl_(std::make_unique<Impl>()) {
+  UINVARIANT(block_size_ > 0, "Arena initial block size must be positive");
+}
+
+ArenaBlockPool::~ArenaBlockPool() {
+  impl_->blocks.consume_all([](char* block) { delete[] block; });
+}
+
+ArenaBlockPool::Block ArenaBlockPool::Acquire() {
+  char* block = nullptr;
+  if (!impl_->blocks.pop(block)) block = new char[block_size_];
+  return Block{block, BlockDeleter{*this}};
+}
+
+void ArenaBlockPool::Release(char* block) noexcept {
+  if (!impl_->blocks.bounded_push(block)) delete[] block;
+}
+
+CallArena::CallArena(ArenaBlockPool& pool)
+    : block_(pool.Acquire()),
+      arena_(MakeArenaOptions(block_.get(), pool.GetBlockSize())) {}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,162 @@
+#include <ugrpc/server/impl/generic_service_worker.hpp>
+
+#include <optional>
+#include <string_view>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/tracing/in_place_span.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/lazy_prvalue.hpp>
+
+#include <userver/ugrpc/impl/static_metadata.hpp>
+#include <userver/ugrpc/impl/statistics.hpp>
+#include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/impl/statistics_storage.hpp>
+#include <userver/ugrpc/server/impl/async_method_invocation.hpp>
+#include <userver/ugrpc/server/impl/call_params.hpp>
+#include <userver/ugrpc/server/impl/service_worker_impl.hpp>
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+namespace {
+
+constexpr std::string_view kGenericMethodFullNames[] = {"Generic/Generic"};
+
+constexpr ugrpc::impl::StaticServiceMetadata kGenericMetadata{
+    "Generic", kGenericMethodFullNames};
+
+}  // namespace
+
+struct GenericServiceData final {
+  GenericServiceData(GenericServiceBase& service, ServiceSettings&& settings)
+      : service(service),
+        settings(std::move(settings)),
+        statistics(this->settings.statistics_storage
+                       .GetServiceStatistics(kGenericMetadata)
+                       .GetMethodStatistics(0)) {}
+
+  ~GenericServiceData() { wait_tokens.WaitForAllTokens(); }
+
+  GenericServiceBase& service;
+  const ServiceSettings settings;
+  grpc::AsyncGenericService async_service;
+  utils::impl::WaitTokenStorage wait_tokens;
+  ugrpc::impl::MethodStatistics& statistics;
+};
+
+namespace {
+
+class GenericCallData final {
+ public:
+  GenericCallData(GenericServiceData& worker,
+                  grpc::ServerCompletionQueue& queue)
+      : wait_token_(worker.wait_tokens.GetToken()),
+        worker_(worker),
+        queue_(queue) {}
+
+  void operator()() && {
+    // See CallData, AsyncNotifyWhenDone must go first
+    RpcFinishedEvent notify_when_done(
+        engine::current_task::GetCancellationToken(), context_);
+    context_.AsyncNotifyWhenDone(notify_when_done.GetTag());
+
+    worker_.async_service.RequestCall(&context_, &raw_stream_, &queue_, &queue_,
+                                      prepare_.GetTag());
+
+    if (prepare_.Wait() != impl::AsyncMethodInvocation::WaitStatus::kOk) {
+      // the CompletionQueue is shutting down
+      return;
+    }
+
+    ListenAsync(worker_, queue_);
+
+    HandleRpc();
+
+    notify_when_done.Wait();
+  }
+
+  static void ListenAsync(GenericServiceData& worker,
+                          grpc::ServerCompletionQueue& queue) {
+    engine::CriticalAsyncNoSpan(
+        worker.settings.task_processor,
+        utils::LazyPrvalue([&] { return GenericCallData(worker, queue); }))
+        .Detach();
+  }
+
+ private:
+  void HandleRpc() {
+    std::string_view call_name = context_.method();
+    // grpcpp passes "/package.Service/Method"
+    if (!call_name.empty() && call_name.front() == '/') {
+      call_name.remove_prefix(1);
+    }
+    const auto slash_pos = call_name.find('/');
+    const auto service_name = call_name.substr(0, slash_pos);
+    const auto method_name = slash_pos == std::string_view::npos
+                                 ? std::string_view{}
+                                 : call_name.substr(slash_pos + 1);
+
+    SetupSpan(span_, context_, call_name);
+    utils::FastScopeGuard destroy_span([&]() noexcept { span_.reset(); });
+
+    ugrpc::impl::RpcStatisticsScope statistics_scope(worker_.statistics);
+
+    GenericServiceBase::Call responder(
+        CallParams{context_, call_name, statistics_scope,
+                   *worker_.settings.access_tskv_logger, span_->Get(),
+                   nullptr, FindCompression(worker_.settings, method_name)},
+        raw_stream_);
+    auto do_call = [&] { worker_.service.Handle(responder); };
+
+    try {
+      MiddlewareCallContext middleware_context(
+          worker_.settings.middlewares, responder, do_call, service_name,
+          method_name, worker_.settings.config_source.GetSnapshot(), nullptr);
+      middleware_context.Next();
+    } catch (const RpcInterruptedError& ex) {
+      ReportNetworkError(ex, call_name, span_->Get());
+      statistics_scope.OnNetworkError();
+    } catch (const std::exception& ex) {
+      ReportHandlerError(ex, call_name, span_->Get());
+    }
+  }
+
+  // Keeps the worker alive during server shutdown
+  const utils::impl::WaitTokenStorage::Token wait_token_;
+
+  GenericServiceData& worker_;
+  grpc::ServerCompletionQueue& queue_;
+
+  grpc::GenericServerContext context_{};
+  grpc::GenericServerAsyncReaderWriter raw_stream_{&context_};
+  ugrpc::impl::AsyncMethodInvocation prepare_;
+  std::optional<tracing::InPlaceSpan> span_{};
+};
+
+}  // namespace
+
+GenericServiceWorker::GenericServiceWorker(GenericServiceBase& service,
+                                           ServiceSettings&& settings)
+    : data_(std::make_unique<GenericServiceData>(service,
+                                                 std::move(settings))) {}
+
+GenericServiceWorker::~GenericServiceWorker() = default;
+
+grpc::AsyncGenericService& GenericServiceWorker::GetService() {
+  return data_->async_service;
+}
+
+void GenericServiceWorker::Start() {
+  for (auto* queue : data_->settings.queues) {
+    GenericCallData::ListenAsync(*data_, *queue);
+  }
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
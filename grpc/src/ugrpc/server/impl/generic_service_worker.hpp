@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+
+#include <grpcpp/generic/async_generic_service.h>
+
+#include <userver/ugrpc/server/generic_service_base.hpp>
+#include <userver/ugrpc/server/impl/service_worker.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+struct GenericServiceData;
+
+/// Listens to the requests of all the unknown methods, forwarding them to
+/// a GenericServiceBase. Must be destroyed after the server is shut down and
+/// before the completion queues.
+class GenericServiceWorker final {
+ public:
+  GenericServiceWorker(GenericServiceBase& service, ServiceSettings&& settings);
+
+  GenericServiceWorker(GenericServiceWorker&&) = delete;
+  GenericServiceWorker& operator=(GenericServiceWorker&&) = delete;
+  ~GenericServiceWorker();
+
+  /// Get the grpcpp service for registration in the `ServerBuilder`
+  grpc::AsyncGenericService& GetService();
+
+  /// Start serving requests. Should be called after the grpcpp server starts.
+  void Start();
+
+ private:
+  std::unique_ptr<GenericServiceData> data_;
+};
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
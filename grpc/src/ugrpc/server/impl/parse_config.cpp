@@ -1,9 +1,11 @@
 #include <ugrpc/server/impl/parse_config.hpp>
 
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/logging/level_serialization.hpp>
 #include <userver/logging/null_logger.hpp>
 
+#include <userver/ugrpc/compression.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -76,6 +78,12 @@ server::ServiceConfig ParseServiceConfig(
                  ParseTaskProcessor),
       MergeField(value[kMiddlewaresKey], defaults.middlewares, context,
                  ParseMiddlewares),
+      value["arena-initial-block-size"].As<std::size_t>(0),
+      value["inline-methods"].As<std::vector<std::string>>({}),
+      value["inline-tasks-per-queue"].As<std::size_t>(4),
+      value["compression"].As<CompressionConfig>({}),
+      value["method-compression"]
+          .As<std::unordered_map<std::string, CompressionConfig>>({}),
   };
 }
 
@@ -88,6 +96,9 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
   config.native_log_level =
       value["native-log-level"].As<logging::Level>(logging::Level::kError);
   config.enable_channelz = value["enable-channelz"].As<bool>(false);
+  config.completion_queue_count =
+      value["completion-queue-count"].As<std::size_t>(
+          config.completion_queue_count);
 
   const auto logger_name = value["access-tskv-logger"];
   if (!logger_name.IsMissing()) {
@@ -10,17 +10,19 @@ USERVER_NAMESPACE_BEGIN
 namespace ugrpc::server::impl {
 
 struct QueueHolder::Impl final {
-  explicit Impl(std::unique_ptr<grpc::ServerCompletionQueue>&& queue)
-      : queue(std::move(queue)) {
+  Impl(std::unique_ptr<grpc::ServerCompletionQueue>&& queue,
+       utils::statistics::RateCounter& events)
+      : queue(std::move(queue)), queue_runner(*this->queue, events) {
     UASSERT(this->queue);
   }
 
   std::unique_ptr<grpc::ServerCompletionQueue> queue;
-  ugrpc::impl::QueueRunner queue_runner{*queue};
+  ugrpc::impl::QueueRunner queue_runner;
 };
 
-QueueHolder::QueueHolder(std::unique_ptr<grpc::ServerCompletionQueue>&& queue)
-    : impl_(std::move(queue)) {}
+QueueHolder::QueueHolder(std::unique_ptr<grpc::ServerCompletionQueue>&& queue,
+                         utils::statistics::RateCounter& events)
+    : impl_(std::move(queue), events) {}
 
 QueueHolder::~QueueHolder() = default;
 
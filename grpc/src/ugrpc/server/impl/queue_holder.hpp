@@ -5,6 +5,7 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -16,7 +17,9 @@ namespace ugrpc::server::impl {
 /// instances are destroyed.
 class QueueHolder final {
  public:
-  explicit QueueHolder(std::unique_ptr<grpc::ServerCompletionQueue>&& queue);
+  // `events` must outlive the holder, see ugrpc::impl::QueueRunner
+  QueueHolder(std::unique_ptr<grpc::ServerCompletionQueue>&& queue,
+              utils::statistics::RateCounter& events);
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
@@ -26,7 +29,7 @@ class QueueHolder final {
 
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 32, 8> impl_;
+  utils::FastPimpl<Impl, 40, 8> impl_;
 };
 
 }  // namespace ugrpc::server::impl
@@ -1,6 +1,7 @@
 #include "server_configs.hpp"
 
 #include <userver/dynamic_config/value.hpp>
+#include <userver/formats/json/value.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,12 +12,28 @@ namespace {
 const std::string kGrpcServerCancelTaskByDeadline =
     "USERVER_GRPC_SERVER_CANCEL_TASK_BY_DEADLINE";
 
+const std::string kGrpcServerMethodLimits = "USERVER_GRPC_SERVER_METHOD_LIMITS";
+
 }  // namespace
 
 bool ParseCancelTaskByDeadline(const dynamic_config::DocsMap& docs_map) {
   return docs_map.Get(kGrpcServerCancelTaskByDeadline).As<bool>();
 }
 
+MethodLimits Parse(const formats::json::Value& value,
+                   formats::parse::To<MethodLimits>) {
+  MethodLimits limits;
+  limits.max_in_flight =
+      value["max-in-flight"].As<std::size_t>(limits.max_in_flight);
+  limits.shed_by_latency =
+      value["shed-by-latency"].As<bool>(limits.shed_by_latency);
+  return limits;
+}
+
+MethodLimitsConfig ParseMethodLimits(const dynamic_config::DocsMap& docs_map) {
+  return MethodLimitsConfig{kGrpcServerMethodLimits, docs_map};
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/value.hpp>
+#include <userver/formats/json_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,6 +15,24 @@ bool ParseCancelTaskByDeadline(const dynamic_config::DocsMap& docs_map);
 inline constexpr dynamic_config::Key<ParseCancelTaskByDeadline>
     kServerCancelTaskByDeadline;
 
+// Checked by the congestion control middleware before the handler runs
+struct MethodLimits final {
+  // 0 means no limit
+  std::size_t max_in_flight{0};
+  // Reject the calls with less time left than the recent median timing
+  bool shed_by_latency{false};
+};
+
+MethodLimits Parse(const formats::json::Value& value,
+                   formats::parse::To<MethodLimits>);
+
+// By the call name, e.g. 'sample.ugrpc.UnitTestService/SayHello'
+using MethodLimitsConfig = dynamic_config::ValueDict<MethodLimits>;
+
+MethodLimitsConfig ParseMethodLimits(const dynamic_config::DocsMap& docs_map);
+
+inline constexpr dynamic_config::Key<ParseMethodLimits> kServerMethodLimits;
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,13 @@
 #include <userver/ugrpc/server/impl/service_worker_impl.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <stdexcept>
 
+#include <fmt/format.h>
 #include <grpc/support/time.h>
 
+#include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/algo.hpp>
@@ -68,6 +72,41 @@ void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
                              ugrpc::impl::ToGrpcString(span.GetLink()));
 }
 
+void ResetTaskLocalVariables() noexcept {
+  engine::impl::task_local::Storage previous_call;
+  previous_call.InitializeFrom(
+      std::move(engine::impl::task_local::GetCurrentStorage()));
+}
+
+void CheckInlineMethods(const ServiceSettings& settings,
+                        const ugrpc::impl::StaticServiceMetadata& metadata) {
+  if (settings.inline_methods.empty()) return;
+
+  if (settings.inline_tasks_per_queue == 0) {
+    throw std::runtime_error(
+        fmt::format("No tasks to serve the inline methods of '{}'",
+                    metadata.service_full_name));
+  }
+  for (const auto& method_name : settings.inline_methods) {
+    const auto full_name =
+        utils::StrCat(metadata.service_full_name, "/", method_name);
+    if (std::find(metadata.method_full_names.begin(),
+                  metadata.method_full_names.end(),
+                  full_name) == metadata.method_full_names.end()) {
+      throw std::runtime_error(fmt::format(
+          "Unknown inline method '{}' of '{}'", method_name,
+          metadata.service_full_name));
+    }
+  }
+}
+
+const CompressionConfig& FindCompression(const ServiceSettings& settings,
+                                         std::string_view method_name) {
+  const auto* compression = utils::FindOrNullptr(settings.method_compression,
+                                                 std::string{method_name});
+  return compression ? *compression : settings.compression;
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#include <userver/ugrpc/server/impl/write_batcher.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::impl {
+
+void WriteBatcher::SetPolicy(const FlushPolicy& policy) noexcept {
+  policy_ = policy;
+}
+
+grpc::WriteOptions WriteBatcher::NextWrite(std::size_t message_size,
+                                           bool force_flush) {
+  grpc::WriteOptions options{};
+  if (policy_.max_messages == 1) return options;
+
+  const bool has_delay_limit = policy_.max_delay.count() > 0;
+  const auto now = has_delay_limit ? Clock::now() : Clock::time_point{};
+  if (batch_messages_ == 0) batch_start_ = now;
+
+  ++batch_messages_;
+  batch_bytes_ += message_size;
+
+  const bool should_flush =
+      force_flush ||
+      (policy_.max_messages != 0 && batch_messages_ >= policy_.max_messages) ||
+      (policy_.max_bytes != 0 && batch_bytes_ >= policy_.max_bytes) ||
+      (has_delay_limit && now - batch_start_ >= policy_.max_delay);
+
+  if (should_flush) {
+    batch_messages_ = 0;
+    batch_bytes_ = 0;
+  } else {
+    options.set_buffer_hint();
+  }
+  return options;
+}
+
+}  // namespace ugrpc::server::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,15 @@
 #include "middleware.hpp"
 
+#include <chrono>
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include <ugrpc/impl/internal_tag.hpp>
+#include <ugrpc/server/impl/server_configs.hpp>
+#include <userver/ugrpc/impl/statistics.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
@@ -21,6 +31,37 @@ bool CheckRatelimit(utils::TokenBucket& rate_limit,
   return false;
 }
 
+std::optional<std::chrono::milliseconds> GetTimeLeft(
+    const grpc::ServerContext& context) {
+  const auto deadline = context.deadline();
+  // In some versions of gRPC, absence of deadline represented as negative
+  // time_point
+  if (deadline.time_since_epoch().count() < 0) return std::nullopt;
+
+  const auto time_left = deadline - std::chrono::system_clock::now();
+  if (time_left >= std::chrono::hours{365 * 24}) return std::nullopt;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(time_left);
+}
+
+// The handler is unlikely to respond in time if there is less time left than
+// the method usually takes
+bool IsDeadlineTooShort(const grpc::ServerContext& context,
+                        ugrpc::impl::MethodStatistics& statistics,
+                        std::string_view call_name) {
+  const auto time_left = GetTimeLeft(context);
+  if (!time_left) return false;
+
+  const auto median = statistics.GetRecentTimingMedian();
+  if (*time_left >= median) return false;
+
+  LOG_LIMITED_WARNING() << "Request shed (congestion control, limit via "
+                           "USERVER_GRPC_SERVER_METHOD_LIMITS), time left="
+                        << time_left->count()
+                        << "ms, median timing=" << median.count() << "ms, "
+                        << "service/method=" << call_name;
+  return true;
+}
+
 }  // namespace
 
 void Middleware::SetLimit(std::optional<size_t> new_limit) {
@@ -41,14 +82,51 @@ void Middleware::SetLimit(std::optional<size_t> new_limit) {
 
 void Middleware::Handle(MiddlewareCallContext& context) const {
   auto& call = context.GetCall();
+  const auto call_name = call.GetCallName();
 
-  if (!CheckRatelimit(rate_limit_, context.GetCall().GetCallName())) {
+  if (!CheckRatelimit(rate_limit_, call_name)) {
     call.FinishWithError(
         grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED,
                      "Congestion control: rate limit exceeded"});
     return;
   }
 
+  const auto& limits =
+      context.GetInitialDynamicConfig()[ugrpc::server::impl::
+                                            kServerMethodLimits][call_name];
+  if (limits.max_in_flight == 0 && !limits.shed_by_latency) {
+    context.Next();
+    return;
+  }
+
+  auto& statistics =
+      call.Statistics(ugrpc::impl::InternalTag()).GetMethodStatistics();
+
+  if (limits.shed_by_latency &&
+      IsDeadlineTooShort(call.GetContext(), statistics, call_name)) {
+    call.FinishWithError(grpc::Status{
+        grpc::StatusCode::RESOURCE_EXHAUSTED,
+        "Congestion control: deadline is shorter than the usual timing"});
+    return;
+  }
+
+  if (limits.max_in_flight == 0) {
+    context.Next();
+    return;
+  }
+
+  if (!statistics.TryStartHandling(limits.max_in_flight)) {
+    LOG_LIMITED_ERROR() << "Request throttled (congestion control, limit via "
+                           "USERVER_GRPC_SERVER_METHOD_LIMITS), max-in-flight="
+                        << limits.max_in_flight
+                        << ", service/method=" << call_name;
+    call.FinishWithError(
+        grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED,
+                     "Congestion control: too many calls in flight"});
+    return;
+  }
+  utils::FastScopeGuard finish_handling(
+      [&statistics]() noexcept { statistics.FinishHandling(); });
   context.Next();
 }
 
@@ -30,6 +30,12 @@ ugrpc::impl::RpcStatisticsScope& CallAnyBase::Statistics(
   return params_.statistics;
 }
 
+void CallAnyBase::EnableStreamCompression() {
+  if (params_.compression.algorithm != GRPC_COMPRESS_NONE) {
+    params_.context.set_compression_algorithm(params_.compression.algorithm);
+  }
+}
+
 void CallAnyBase::LogFinish(grpc::Status status) const {
   constexpr auto kLevel = logging::Level::kInfo;
   if (!params_.access_tskv_logger.ShouldLog(kLevel)) {
@@ -6,6 +6,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <fmt/format.h>
@@ -15,9 +16,12 @@
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/impl/to_string.hpp>
+#include <ugrpc/server/impl/generic_service_worker.hpp>
 #include <ugrpc/server/impl/parse_config.hpp>
 #include <ugrpc/server/impl/queue_holder.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
@@ -75,12 +79,16 @@ class Server::Impl final {
 
   void AddService(ServiceBase& service, ServiceConfig&& config);
 
+  void AddService(GenericServiceBase& service, ServiceConfig&& config);
+
   std::vector<std::string_view> GetServiceNames() const;
 
   void WithServerBuilder(SetupHook&& setup);
 
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  std::vector<grpc::CompletionQueue*> GetCompletionQueues();
+
   void Start();
 
   int GetPort() const noexcept;
@@ -100,11 +108,19 @@ class Server::Impl final {
 
   void DoStart();
 
+  void WriteQueueStatistics(utils::statistics::Writer& writer) const;
+
+  impl::ServiceSettings MakeServiceSettings(ServiceConfig&& config);
+
+  // Outlive the queues, so that the metrics could be written any time
+  utils::FixedArray<utils::statistics::RateCounter> queue_events_;
+
   State state_{State::kConfiguration};
   std::optional<grpc::ServerBuilder> server_builder_;
   std::optional<int> port_;
   std::vector<std::unique_ptr<impl::ServiceWorker>> service_workers_;
-  std::optional<impl::QueueHolder> queue_;
+  std::unique_ptr<impl::GenericServiceWorker> generic_service_worker_;
+  std::optional<utils::FixedArray<impl::QueueHolder>> queues_;
   std::unique_ptr<grpc::Server> server_;
   mutable engine::Mutex configuration_mutex_;
 
@@ -116,7 +132,11 @@ class Server::Impl final {
 Server::Impl::Impl(ServerConfig&& config,
                    utils::statistics::Storage& statistics_storage,
                    dynamic_config::Source config_source)
-    : statistics_storage_(statistics_storage, "server"),
+    : queue_events_(config.completion_queue_count),
+      statistics_storage_(statistics_storage, "server",
+                          [this](utils::statistics::Writer& writer) {
+                            WriteQueueStatistics(writer);
+                          }),
       config_source_(config_source),
       access_tskv_logger_(std::move(config.access_tskv_logger)) {
   LOG_INFO() << "Configuring the gRPC server";
@@ -131,7 +151,13 @@ Server::Impl::Impl(ServerConfig&& config,
   }
   server_builder_.emplace();
   ApplyChannelArgs(*server_builder_, config);
-  queue_.emplace(server_builder_->AddCompletionQueue());
+  UINVARIANT(config.completion_queue_count > 0,
+             "completion-queue-count must be greater than zero");
+  queues_.emplace(utils::GenerateFixedArray(
+      config.completion_queue_count, [this](std::size_t index) {
+        return impl::QueueHolder(server_builder_->AddCompletionQueue(),
+                                 queue_events_[index]);
+      }));
   if (config.port) AddListeningPort(*config.port);
 }
 
@@ -162,14 +188,40 @@ void Server::Impl::AddService(ServiceBase& service, ServiceConfig&& config) {
   const std::lock_guard lock(configuration_mutex_);
   UASSERT(state_ == State::kConfiguration);
 
-  service_workers_.push_back(service.MakeWorker(impl::ServiceSettings{
-      queue_->GetQueue(),
+  service_workers_.push_back(
+      service.MakeWorker(MakeServiceSettings(std::move(config))));
+}
+
+void Server::Impl::AddService(GenericServiceBase& service,
+                              ServiceConfig&& config) {
+  const std::lock_guard lock(configuration_mutex_);
+  UASSERT(state_ == State::kConfiguration);
+
+  UINVARIANT(!generic_service_worker_,
+             "At most one generic service could be registered");
+  generic_service_worker_ = std::make_unique<impl::GenericServiceWorker>(
+      service, MakeServiceSettings(std::move(config)));
+}
+
+impl::ServiceSettings Server::Impl::MakeServiceSettings(
+    ServiceConfig&& config) {
+  std::vector<grpc::ServerCompletionQueue*> queues;
+  queues.reserve(queues_->size());
+  for (auto& queue : *queues_) queues.push_back(&queue.GetQueue());
+
+  return impl::ServiceSettings{
+      std::move(queues),
       config.task_processor,
       statistics_storage_,
       std::move(config.middlewares),
       access_tskv_logger_,
       config_source_,
-  }));
+      config.arena_initial_block_size,
+      std::move(config.inline_methods),
+      config.inline_tasks_per_queue,
+      config.compression,
+      std::move(config.method_compression),
+  };
 }
 
 std::vector<std::string_view> Server::Impl::GetServiceNames() const {
@@ -193,7 +245,15 @@ void Server::Impl::WithServerBuilder(SetupHook&& setup) {
 
 grpc::CompletionQueue& Server::Impl::GetCompletionQueue() noexcept {
   UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
-  return queue_->GetQueue();
+  return queues_->front().GetQueue();
+}
+
+std::vector<grpc::CompletionQueue*> Server::Impl::GetCompletionQueues() {
+  UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
+  std::vector<grpc::CompletionQueue*> queues;
+  queues.reserve(queues_->size());
+  for (auto& queue : *queues_) queues.push_back(&queue.GetQueue());
+  return queues;
 }
 
 void Server::Impl::Start() {
@@ -228,7 +288,8 @@ void Server::Impl::Stop() noexcept {
     server_->Shutdown();
   }
   service_workers_.clear();
-  queue_.reset();
+  generic_service_worker_.reset();
+  queues_.reset();
   server_.reset();
 
   state_ = State::kStopped;
@@ -238,6 +299,7 @@ void Server::Impl::StopDebug() noexcept {
   UINVARIANT(server_, "The gRPC server is not running");
   server_->Shutdown();
   service_workers_.clear();
+  generic_service_worker_.reset();
 }
 
 void Server::Impl::DoStart() {
@@ -249,6 +311,10 @@ void Server::Impl::DoStart() {
   for (auto& worker : service_workers_) {
     server_builder_->RegisterService(&worker->GetService());
   }
+  if (generic_service_worker_) {
+    server_builder_->RegisterAsyncGenericService(
+        &generic_service_worker_->GetService());
+  }
 
   server_ = server_builder_->BuildAndStart();
   UINVARIANT(server_, "See grpcpp logs for details");
@@ -257,6 +323,7 @@ void Server::Impl::DoStart() {
   for (auto& worker : service_workers_) {
     worker->Start();
   }
+  if (generic_service_worker_) generic_service_worker_->Start();
 
   if (port_) {
     LOG_INFO() << "gRPC server started on port " << *port_;
@@ -265,6 +332,15 @@ void Server::Impl::DoStart() {
   }
 }
 
+void Server::Impl::WriteQueueStatistics(
+    utils::statistics::Writer& writer) const {
+  auto queues = writer["queues"];
+  for (std::size_t i = 0; i < queue_events_.size(); ++i) {
+    queues["events"].ValueWithLabels(queue_events_[i].Load(),
+                                     {"grpc_queue", std::to_string(i)});
+  }
+}
+
 Server::Server(ServerConfig&& config,
                utils::statistics::Storage& statistics_storage,
                dynamic_config::Source config_source)
@@ -277,6 +353,10 @@ void Server::AddService(ServiceBase& service, ServiceConfig&& config) {
   impl_->AddService(service, std::move(config));
 }
 
+void Server::AddService(GenericServiceBase& service, ServiceConfig&& config) {
+  impl_->AddService(service, std::move(config));
+}
+
 std::vector<std::string_view> Server::GetServiceNames() const {
   return impl_->GetServiceNames();
 }
@@ -289,6 +369,10 @@ grpc::CompletionQueue& Server::GetCompletionQueue() noexcept {
   return impl_->GetCompletionQueue();
 }
 
+std::vector<grpc::CompletionQueue*> Server::GetCompletionQueues() {
+  return impl_->GetCompletionQueues();
+}
+
 void Server::Start() { return impl_->Start(); }
 
 int Server::GetPort() const noexcept { return impl_->GetPort(); }
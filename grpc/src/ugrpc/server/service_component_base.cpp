@@ -6,6 +6,7 @@
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <ugrpc/server/impl/parse_config.hpp>
+#include <userver/ugrpc/server/generic_service_base.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 #include <userver/ugrpc/server/server_component.hpp>
 
@@ -25,6 +26,11 @@ void ServiceComponentBase::RegisterService(ServiceBase& service) {
   server_.GetServer().AddService(service, std::move(config_));
 }
 
+void ServiceComponentBase::RegisterService(GenericServiceBase& service) {
+  UINVARIANT(!registered_.exchange(true), "Register must only be called once");
+  server_.GetServer().AddService(service, std::move(config_));
+}
+
 yaml_config::Schema ServiceComponentBase::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
 type: object
@@ -42,6 +48,62 @@ properties:
         items:
             type: string
             description: middleware component name
+    arena-initial-block-size:
+        type: integer
+        description: if not 0, parse requests into per-call protobuf arenas with reused initial blocks of this size
+        defaultDescription: 0
+        minimum: 0
+    inline-methods:
+        type: array
+        description: unary methods served by long-lived tasks instead of a task per call, for cheap non-blocking handlers
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: method name, e.g. SayHello
+    inline-tasks-per-queue:
+        type: integer
+        description: number of tasks per completion queue serving each of the inline-methods
+        defaultDescription: 4
+        minimum: 1
+    compression:
+        type: object
+        description: compression of the responses
+        additionalProperties: false
+        properties:
+            algorithm:
+                type: string
+                description: compression algorithm
+                defaultDescription: identity
+                enum:
+                  - identity
+                  - deflate
+                  - gzip
+            min-message-size-bytes:
+                type: integer
+                description: the smaller responses are sent uncompressed
+                defaultDescription: 0
+                minimum: 0
+    method-compression:
+        type: object
+        description: compression of the responses by method name, overrides the compression
+        additionalProperties:
+            type: object
+            description: compression of the responses of the method
+            additionalProperties: false
+            properties:
+                algorithm:
+                    type: string
+                    description: compression algorithm
+                    defaultDescription: identity
+                    enum:
+                      - identity
+                      - deflate
+                      - gzip
+                min-message-size-bytes:
+                    type: integer
+                    description: the smaller responses are sent uncompressed
+                    defaultDescription: 0
+                    minimum: 0
 )");
 }
 
@@ -0,0 +1,81 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <userver/engine/task/task.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/server/impl/call_arena.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestServiceArena final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    auto* arena = call.GetArena();
+    if (arena == nullptr || request.GetArena() != arena) {
+      call.FinishWithError({grpc::StatusCode::INTERNAL, "no arena"});
+      return;
+    }
+    auto* response = google::protobuf::Arena::CreateMessage<
+        sample::ugrpc::GreetingResponse>(arena);
+    response->set_name("Hello " + request.name());
+    call.Finish(*response);
+  }
+};
+
+class GrpcArena : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcArena() {
+    GetServer().AddService(
+        service_, ugrpc::server::ServiceConfig{
+                      engine::current_task::GetTaskProcessor(),
+                      {},
+                      /*arena_initial_block_size=*/1024,
+                  });
+    StartServer();
+  }
+
+  ~GrpcArena() override { StopServer(); }
+
+ private:
+  UnitTestServiceArena service_;
+};
+
+}  // namespace
+
+UTEST_F(GrpcArena, UnaryCall) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  for (int i = 0; i < 3; ++i) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(std::string(2000, 'x'));
+    auto response = client.SayHello(request).Finish();
+    EXPECT_EQ(response.name(), "Hello " + request.name());
+  }
+}
+
+TEST(GrpcArenaBlockPool, ReusesBlocks) {
+  ugrpc::server::impl::ArenaBlockPool pool{64};
+  const char* first_block = nullptr;
+  {
+    auto block = pool.Acquire();
+    first_block = block.get();
+  }
+  EXPECT_EQ(pool.Acquire().get(), first_block);
+
+  // The arena outgrows its initial block and still returns it to the pool
+  {
+    ugrpc::server::impl::CallArena arena{pool};
+    auto* message = google::protobuf::Arena::CreateMessage<
+        sample::ugrpc::GreetingRequest>(&arena.Get());
+    message->set_name(std::string(1000, 'x'));
+  }
+  EXPECT_EQ(pool.Acquire().get(), first_block);
+}
+
+USERVER_NAMESPACE_END
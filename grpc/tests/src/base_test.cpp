@@ -1,5 +1,7 @@
 #include <userver/utest/utest.hpp>
 
+#include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -297,6 +299,39 @@ UTEST_P_MT(GrpcClientMultichannelTest, MultiThreadedClientTest, 4) {
 INSTANTIATE_UTEST_SUITE_P(Basic, GrpcClientMultichannelTest,
                           testing::Values(std::size_t{1}, std::size_t{4}));
 
+using GrpcMultiqueueTest =
+    ugrpc::tests::ServiceFixtureMultiqueue<UnitTestService>;
+
+UTEST_P_MT(GrpcMultiqueueTest, MultiThreadedClientTest, 4) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  for (std::size_t i = 0; i < GetThreadCount(); ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      sample::ugrpc::GreetingRequest out;
+      out.set_name("userver");
+
+      for (int j = 0; j < 50; ++j) {
+        auto call = client.SayHello(out, PrepareClientContext());
+        auto in = call.Finish();
+        EXPECT_EQ("Hello " + out.name(), in.name());
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  std::uint64_t total_events = 0;
+  for (std::size_t i = 0; i < GetParam(); ++i) {
+    const auto stats = GetStatistics("grpc.server.queues",
+                                     {{"grpc_queue", std::to_string(i)}});
+    total_events += stats.SingleMetric("events").AsRate().value;
+  }
+  EXPECT_GT(total_events, 0);
+}
+
+INSTANTIATE_UTEST_SUITE_P(Basic, GrpcMultiqueueTest,
+                          testing::Values(std::size_t{1}, std::size_t{3}));
+
 namespace {
 
 class WriteAndFinishService final : public sample::ugrpc::UnitTestServiceBase {
@@ -1,5 +1,7 @@
 #include <userver/ugrpc/client/client_factory.hpp>
 
+#include <vector>
+
 #include <userver/engine/task/task.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/yaml/value.hpp>
@@ -46,4 +48,56 @@ UTEST(GrpcClient, ChannelsCount) {
   ASSERT_EQ(kChannelsCount, data.GetChannelToken().GetChannelCount());
 }
 
+UTEST(GrpcClient, ChannelPool) {
+  formats::yaml::ValueBuilder builder(formats::common::Type::kObject);
+  builder["channel-count"] = 2;
+  builder["max-channel-count"] = 3;
+  builder["max-streams-per-channel"] = 2;
+
+  const auto yaml_data = builder.ExtractValue();
+  yaml_config::YamlConfig yaml_config(yaml_data, formats::yaml::Value());
+
+  auto config = yaml_config.As<ugrpc::client::ClientFactoryConfig>();
+  ugrpc::client::QueueHolder client_queue;
+  utils::statistics::Storage statistics_storage;
+  dynamic_config::StorageMock config_storage;
+
+  testsuite::GrpcControl ts({}, false);
+  ugrpc::client::MiddlewareFactories mws;
+  ugrpc::client::ClientFactory client_factory(
+      std::move(config), engine::current_task::GetTaskProcessor(), mws,
+      client_queue.GetQueue(), statistics_storage, ts,
+      config_storage.GetSource());
+
+  const std::string endpoint{"[::]:50051"};
+  auto client = client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>(
+      "test", endpoint);
+
+  auto& data = ugrpc::client::impl::GetClientData(client);
+  const auto& token = data.GetChannelToken();
+  EXPECT_EQ(token.GetChannelCount(), 2);
+  EXPECT_EQ(token.GetMaxChannelCount(), 3);
+
+  // The least loaded channel is picked
+  std::vector<ugrpc::client::impl::ChannelCache::Lease> leases;
+  leases.push_back(data.LeaseChannel());
+  leases.push_back(data.LeaseChannel());
+  EXPECT_NE(leases[0].GetChannelIndex(), leases[1].GetChannelIndex());
+  leases.push_back(data.LeaseChannel());
+  leases.push_back(data.LeaseChannel());
+  EXPECT_EQ(token.GetChannelCount(), 2);
+
+  // All the channels are busy
+  leases.push_back(data.LeaseChannel());
+  EXPECT_EQ(leases.back().GetChannelIndex(), 2);
+  EXPECT_EQ(token.GetChannelCount(), 3);
+
+  // The pool does not grow beyond the max
+  for (int i = 0; i < 5; ++i) leases.push_back(data.LeaseChannel());
+  EXPECT_EQ(token.GetChannelCount(), 3);
+
+  leases.clear();
+  EXPECT_EQ(token.GetChannelCount(), 3);
+}
+
 USERVER_NAMESPACE_END
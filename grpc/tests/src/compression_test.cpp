@@ -0,0 +1,127 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/ugrpc/client/qos.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMinMessageSize = 100;
+constexpr std::size_t kLargeNameSize = kMinMessageSize * 10;
+
+class UnitTestServiceCompression final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(request.name());
+    call.Finish(response);
+  }
+
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    sample::ugrpc::StreamGreetingResponse response;
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      // Every other response is large enough to be compressed
+      response.set_name(i % 2 == 0 ? request.name() : std::string{});
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+class GrpcCompression : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcCompression() {
+    ugrpc::server::ServiceConfig config{
+        engine::current_task::GetTaskProcessor(), {}};
+    config.compression = {GRPC_COMPRESS_GZIP, kMinMessageSize};
+    config.method_compression["SayHello"] = {GRPC_COMPRESS_DEFLATE,
+                                             kMinMessageSize};
+    GetServer().AddService(service_, std::move(config));
+    StartServer();
+  }
+
+  ~GrpcCompression() override { StopServer(); }
+
+  std::int64_t GetCompressionMetric(std::string_view domain,
+                                    std::string_view method,
+                                    std::string_view metric) {
+    const auto stats = GetStatistics(
+        fmt::format("grpc.{}.by-destination", domain),
+        {{"grpc_destination",
+          fmt::format("sample.ugrpc.UnitTestService/{}", method)}});
+    return stats.SingleMetric(fmt::format("compression.{}", metric))
+        .AsRate()
+        .value;
+  }
+
+ private:
+  UnitTestServiceCompression service_;
+};
+
+ugrpc::client::Qos MakeCompressionQos() {
+  ugrpc::client::Qos qos;
+  qos.compression = GRPC_COMPRESS_GZIP;
+  qos.compression_min_size = kMinMessageSize;
+  return qos;
+}
+
+std::string MakeLargeName() { return std::string(kLargeNameSize, 'a'); }
+
+}  // namespace
+
+UTEST_F(GrpcCompression, Unary) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  for (const auto& name : {MakeLargeName(), std::string{"small"}}) {
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(name);
+    auto call = client.SayHello(
+        request, std::make_unique<grpc::ClientContext>(), MakeCompressionQos());
+    EXPECT_EQ(call.Finish().name(), name);
+  }
+
+  for (const auto& domain : {"client", "server"}) {
+    EXPECT_EQ(GetCompressionMetric(domain, "SayHello", "compressed-messages"),
+              1);
+    EXPECT_EQ(
+        GetCompressionMetric(domain, "SayHello", "uncompressed-messages"), 1);
+    EXPECT_GE(GetCompressionMetric(domain, "SayHello", "compressed-raw-bytes"),
+              static_cast<std::int64_t>(kLargeNameSize));
+  }
+}
+
+UTEST_F(GrpcCompression, OutputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  sample::ugrpc::StreamGreetingRequest request;
+  request.set_name(MakeLargeName());
+  request.set_number(4);
+  auto stream = client.ReadMany(request);
+
+  sample::ugrpc::StreamGreetingResponse response;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.number(), i);
+    EXPECT_EQ(response.name().size(), i % 2 == 0 ? kLargeNameSize : 0);
+  }
+  EXPECT_FALSE(stream.Read(response));
+
+  EXPECT_EQ(GetCompressionMetric("server", "ReadMany", "compressed-messages"),
+            2);
+  EXPECT_EQ(
+      GetCompressionMetric("server", "ReadMany", "uncompressed-messages"), 2);
+}
+
+USERVER_NAMESPACE_END
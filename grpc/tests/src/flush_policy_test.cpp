@@ -0,0 +1,135 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/ugrpc/server/impl/write_batcher.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::server::FlushPolicy;
+using ugrpc::server::impl::WriteBatcher;
+
+constexpr int kMessageCount = 100;
+
+bool IsFlush(const grpc::WriteOptions& options) {
+  return !options.get_buffer_hint();
+}
+
+class UnitTestServiceBatching final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    std::vector<sample::ugrpc::StreamGreetingResponse> responses(
+        request.number());
+    for (int i = 0; i < request.number(); ++i) {
+      responses[i].set_name(request.name());
+      responses[i].set_number(i);
+    }
+    call.SetFlushPolicy({/*max_messages=*/16, /*max_bytes=*/0, 0ms});
+    call.WriteMany(responses);
+    call.Finish();
+  }
+
+  void Chat(ChatCall& call) override {
+    call.SetFlushPolicy({/*max_messages=*/0, /*max_bytes=*/0, 0ms});
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_name(request.name());
+      response.set_number(request.number());
+      // Every write is buffered, the messages are sent by Finish
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+}  // namespace
+
+TEST(GrpcWriteBatcher, DefaultIsUnbuffered) {
+  WriteBatcher batcher;
+  for (int i = 0; i < 3; ++i) EXPECT_TRUE(IsFlush(batcher.NextWrite(0, false)));
+  EXPECT_FALSE(batcher.NeedsMessageSize());
+}
+
+TEST(GrpcWriteBatcher, MaxMessages) {
+  WriteBatcher batcher;
+  batcher.SetPolicy({/*max_messages=*/3, /*max_bytes=*/0, 0ms});
+  for (int batch = 0; batch < 2; ++batch) {
+    EXPECT_FALSE(IsFlush(batcher.NextWrite(0, false)));
+    EXPECT_FALSE(IsFlush(batcher.NextWrite(0, false)));
+    EXPECT_TRUE(IsFlush(batcher.NextWrite(0, false)));
+  }
+
+  EXPECT_FALSE(IsFlush(batcher.NextWrite(0, false)));
+  EXPECT_TRUE(IsFlush(batcher.NextWrite(0, /*force_flush=*/true)));
+  // The counters are reset after the forced flush
+  EXPECT_FALSE(IsFlush(batcher.NextWrite(0, false)));
+}
+
+TEST(GrpcWriteBatcher, MaxBytes) {
+  WriteBatcher batcher;
+  batcher.SetPolicy({/*max_messages=*/0, /*max_bytes=*/100, 0ms});
+  EXPECT_TRUE(batcher.NeedsMessageSize());
+  EXPECT_FALSE(IsFlush(batcher.NextWrite(60, false)));
+  EXPECT_TRUE(IsFlush(batcher.NextWrite(60, false)));
+  EXPECT_TRUE(IsFlush(batcher.NextWrite(100, false)));
+}
+
+UTEST(GrpcWriteBatcher, MaxDelay) {
+  WriteBatcher batcher;
+  batcher.SetPolicy({/*max_messages=*/0, /*max_bytes=*/0, 10ms});
+  EXPECT_FALSE(IsFlush(batcher.NextWrite(0, false)));
+  engine::SleepFor(20ms);
+  EXPECT_TRUE(IsFlush(batcher.NextWrite(0, false)));
+}
+
+using GrpcFlushPolicy = ugrpc::tests::ServiceFixture<UnitTestServiceBatching>;
+
+UTEST_F(GrpcFlushPolicy, WriteMany) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest request;
+  request.set_name("batch");
+  request.set_number(kMessageCount);
+  auto stream = client.ReadMany(request);
+
+  sample::ugrpc::StreamGreetingResponse response;
+  for (int i = 0; i < kMessageCount; ++i) {
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.number(), i);
+  }
+  EXPECT_FALSE(stream.Read(response));
+}
+
+UTEST_F(GrpcFlushPolicy, BufferedUntilFinish) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto stream = client.Chat();
+
+  sample::ugrpc::StreamGreetingRequest request;
+  request.set_name("batch");
+  for (int i = 0; i < kMessageCount; ++i) {
+    request.set_number(i);
+    ASSERT_TRUE(stream.Write(request));
+  }
+  ASSERT_TRUE(stream.WritesDone());
+
+  sample::ugrpc::StreamGreetingResponse response;
+  for (int i = 0; i < kMessageCount; ++i) {
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.number(), i);
+  }
+  EXPECT_FALSE(stream.Read(response));
+}
+
+USERVER_NAMESPACE_END
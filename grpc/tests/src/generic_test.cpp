@@ -0,0 +1,119 @@
+#include <userver/utest/utest.hpp>
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/ugrpc/client/generic.hpp>
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kSayHelloCallName =
+    "sample.ugrpc.UnitTestService/SayHello";
+
+grpc::ByteBuffer Serialize(const google::protobuf::Message& message) {
+  grpc::ByteBuffer buffer;
+  bool own_buffer = false;
+  const auto status =
+      grpc::SerializationTraits<google::protobuf::Message>::Serialize(
+          message, &buffer, &own_buffer);
+  EXPECT_TRUE(status.ok());
+  return buffer;
+}
+
+template <typename Message>
+Message Deserialize(grpc::ByteBuffer& buffer) {
+  Message message;
+  const auto status =
+      grpc::SerializationTraits<Message>::Deserialize(&buffer, &message);
+  EXPECT_TRUE(status.ok());
+  return message;
+}
+
+// Handles SayHello without generated code
+class GenericService final : public ugrpc::server::GenericServiceBase {
+ public:
+  void Handle(Call& call) override {
+    if (call.GetCallName() != kSayHelloCallName) {
+      call.FinishWithError({grpc::StatusCode::UNIMPLEMENTED, "unknown"});
+      return;
+    }
+
+    grpc::ByteBuffer request_bytes;
+    if (!call.Read(request_bytes)) {
+      call.FinishWithError({grpc::StatusCode::INVALID_ARGUMENT, "no request"});
+      return;
+    }
+    const auto request =
+        Deserialize<sample::ugrpc::GreetingRequest>(request_bytes);
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.WriteAndFinish(Serialize(response));
+  }
+};
+
+class GrpcGeneric : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcGeneric() {
+    GetServer().AddService(service_,
+                           ugrpc::server::ServiceConfig{
+                               engine::current_task::GetTaskProcessor(), {}});
+    StartServer();
+  }
+
+  ~GrpcGeneric() override { StopServer(); }
+
+ private:
+  GenericService service_;
+};
+
+sample::ugrpc::GreetingRequest MakeRequest() {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("generic");
+  return request;
+}
+
+}  // namespace
+
+UTEST_F(GrpcGeneric, GeneratedClient) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  const auto response = client.SayHello(MakeRequest()).Finish();
+  EXPECT_EQ(response.name(), "Hello generic");
+}
+
+UTEST_F(GrpcGeneric, UnaryCall) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+  auto response_bytes =
+      client.CallUnary(kSayHelloCallName, Serialize(MakeRequest())).Finish();
+  const auto response =
+      Deserialize<sample::ugrpc::GreetingResponse>(response_bytes);
+  EXPECT_EQ(response.name(), "Hello generic");
+}
+
+UTEST_F(GrpcGeneric, BidirectionalStream) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+  auto call = client.CallBidirectional(kSayHelloCallName);
+  EXPECT_TRUE(call.Write(Serialize(MakeRequest())));
+  EXPECT_TRUE(call.WritesDone());
+
+  grpc::ByteBuffer response_bytes;
+  ASSERT_TRUE(call.Read(response_bytes));
+  EXPECT_EQ(Deserialize<sample::ugrpc::GreetingResponse>(response_bytes).name(),
+            "Hello generic");
+  EXPECT_FALSE(call.Read(response_bytes));
+}
+
+UTEST_F(GrpcGeneric, UnknownMethod) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+  auto call = client.CallUnary("sample.ugrpc.UnitTestService/Unknown",
+                               Serialize(MakeRequest()));
+  UEXPECT_THROW(call.Finish(), ugrpc::client::UnimplementedError);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/local_variable.hpp>
+#include <userver/engine/task/task.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kInlineTasks = 2;
+
+engine::TaskLocalVariable<int> calls_in_task;
+
+class UnitTestServiceInline final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    const auto running = ++running_;
+    max_running_ = std::max(max_running_.load(), running);
+    if (request.name() == "slow") engine::SleepFor(10ms);
+    --running_;
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(std::to_string(++*calls_in_task));
+    call.Finish(response);
+  }
+
+  int GetMaxRunning() const { return max_running_.load(); }
+
+ private:
+  std::atomic<int> running_{0};
+  std::atomic<int> max_running_{0};
+};
+
+class GrpcInlineMethods : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcInlineMethods() {
+    GetServer().AddService(service_,
+                           ugrpc::server::ServiceConfig{
+                               engine::current_task::GetTaskProcessor(),
+                               {},
+                               /*arena_initial_block_size=*/0,
+                               /*inline_methods=*/{"SayHello"},
+                               /*inline_tasks_per_queue=*/kInlineTasks,
+                           });
+    StartServer();
+  }
+
+  ~GrpcInlineMethods() override { StopServer(); }
+
+  UnitTestServiceInline& GetService() { return service_; }
+
+ private:
+  UnitTestServiceInline service_;
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(const char* name) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(name);
+  return request;
+}
+
+}  // namespace
+
+UTEST_F(GrpcInlineMethods, TaskLocalVariablesAreReset) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(client.SayHello(MakeRequest("userver")).Finish().name(), "1");
+  }
+}
+
+UTEST_F_MT(GrpcInlineMethods, ConcurrentCalls, 4) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  for (int i = 0; i < 10; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&client] {
+      return client.SayHello(MakeRequest("slow")).Finish().name();
+    }));
+  }
+  for (auto& task : tasks) EXPECT_EQ(task.Get(), "1");
+
+  EXPECT_LE(GetService().GetMaxRunning(), kInlineTasks);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,147 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <memory>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_use_event.hpp>
+#include <userver/engine/sleep.hpp>
+
+#include <ugrpc/server/impl/server_configs.hpp>
+#include <ugrpc/server/middlewares/congestion_control/middleware.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kSayHello = "sample.ugrpc.UnitTestService/SayHello";
+
+class UnitTestServiceLimited final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    if (request.name() == "blocking") {
+      entered_.Send();
+      released_.WaitNonCancellable();
+    } else if (request.name() == "slow") {
+      engine::SleepFor(50ms);
+    }
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  engine::SingleUseEvent& GetEntered() { return entered_; }
+
+  engine::SingleUseEvent& GetReleased() { return released_; }
+
+ private:
+  engine::SingleUseEvent entered_;
+  engine::SingleUseEvent released_;
+};
+
+class GrpcMethodLimits : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  explicit GrpcMethodLimits(ugrpc::server::impl::MethodLimits limits) {
+    ExtendDynamicConfig({{ugrpc::server::impl::kServerMethodLimits,
+                          ugrpc::server::impl::MethodLimitsConfig{
+                              {"__default__", {}},
+                              {kSayHello, limits},
+                          }}});
+    AddServerMiddleware(std::make_shared<
+                        ugrpc::server::middlewares::congestion_control::
+                            Middleware>());
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~GrpcMethodLimits() override { StopServer(); }
+
+  UnitTestServiceLimited& GetService() { return service_; }
+
+ private:
+  UnitTestServiceLimited service_;
+};
+
+class GrpcMaxInFlight : public GrpcMethodLimits {
+ protected:
+  GrpcMaxInFlight()
+      : GrpcMethodLimits({/*max_in_flight=*/1, /*shed_by_latency=*/false}) {}
+};
+
+class GrpcShedByLatency : public GrpcMethodLimits {
+ protected:
+  GrpcShedByLatency()
+      : GrpcMethodLimits({/*max_in_flight=*/0, /*shed_by_latency=*/true}) {}
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(const char* name) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(name);
+  return request;
+}
+
+std::unique_ptr<grpc::ClientContext> MakeContext(
+    std::chrono::milliseconds timeout) {
+  auto context = std::make_unique<grpc::ClientContext>();
+  context->set_deadline(std::chrono::system_clock::now() + timeout);
+  return context;
+}
+
+}  // namespace
+
+UTEST_F(GrpcMaxInFlight, RejectsOverTheLimit) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto blocking = engine::AsyncNoSpan([&client] {
+    return client.SayHello(MakeRequest("blocking")).Finish().name();
+  });
+  GetService().GetEntered().WaitNonCancellable();
+
+  UEXPECT_THROW(client.SayHello(MakeRequest("fast")).Finish(),
+                ugrpc::client::ResourceExhaustedError);
+
+  GetService().GetReleased().Send();
+  EXPECT_EQ(blocking.Get(), "Hello blocking");
+  EXPECT_EQ(client.SayHello(MakeRequest("fast")).Finish().name(),
+            "Hello fast");
+}
+
+UTEST_F(GrpcShedByLatency, RejectsShortDeadlines) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  // There are no timings yet, nothing is shed
+  EXPECT_EQ(client.SayHello(MakeRequest("fast"), MakeContext(20ms))
+                .Finish()
+                .name(),
+            "Hello fast");
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(client.SayHello(MakeRequest("slow")).Finish().name(),
+              "Hello slow");
+  }
+
+  // The median is recomputed once a second
+  engine::SleepFor(1100ms);
+
+  UEXPECT_THROW(
+      client.SayHello(MakeRequest("fast"), MakeContext(20ms)).Finish(),
+      ugrpc::client::ResourceExhaustedError);
+  EXPECT_EQ(client.SayHello(MakeRequest("fast"), MakeContext(10s))
+                .Finish()
+                .name(),
+            "Hello fast");
+  EXPECT_EQ(client.SayHello(MakeRequest("fast")).Finish().name(),
+            "Hello fast");
+}
+
+USERVER_NAMESPACE_END
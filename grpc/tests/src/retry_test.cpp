@@ -0,0 +1,183 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Fails the first `failures` calls with `code`. The first call with the "slow"
+// name waits for ReleaseSlow()
+class UnitTestServiceFlaky final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    const auto index = calls_++;
+    const auto& metadata = call.GetContext().client_metadata();
+    if (metadata.find("x-attempt-key") != metadata.end()) ++calls_with_key_;
+    if (request.name() == "slow" && index == 0) {
+      [[maybe_unused]] const bool released =
+          release_slow_.WaitForEventFor(utest::kMaxTestWaitTime);
+    }
+    if (index < failures_) {
+      call.FinishWithError({code_, "flaky"});
+      return;
+    }
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  void SetFailures(int failures, grpc::StatusCode code) {
+    failures_ = failures;
+    code_ = code;
+  }
+
+  int GetCalls() const { return calls_.load(); }
+
+  int GetCallsWithKey() const { return calls_with_key_.load(); }
+
+  void ReleaseSlow() { release_slow_.Send(); }
+
+ private:
+  engine::SingleConsumerEvent release_slow_;
+  std::atomic<int> calls_{0};
+  std::atomic<int> calls_with_key_{0};
+  int failures_{0};
+  grpc::StatusCode code_{grpc::StatusCode::UNAVAILABLE};
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(const char* name) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(name);
+  return request;
+}
+
+// Every attempt gets the metadata of the user
+std::unique_ptr<grpc::ClientContext> MakeContext() {
+  auto context = std::make_unique<grpc::ClientContext>();
+  context->AddMetadata("x-attempt-key", "value");
+  return context;
+}
+
+ugrpc::client::Qos MakeQos(std::size_t attempts) {
+  ugrpc::client::Qos qos;
+  qos.attempts = attempts;
+  return qos;
+}
+
+}  // namespace
+
+using GrpcRetries = ugrpc::tests::ServiceFixture<UnitTestServiceFlaky>;
+
+UTEST_F(GrpcRetries, RetriesUntilSuccess) {
+  GetService().SetFailures(2, grpc::StatusCode::UNAVAILABLE);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call = client.SayHello(MakeRequest("userver"), &MakeContext, MakeQos(3));
+  EXPECT_EQ(call.Finish().name(), "Hello userver");
+  EXPECT_EQ(GetService().GetCalls(), 3);
+  EXPECT_EQ(GetService().GetCallsWithKey(), 3);
+}
+
+UTEST_F(GrpcRetries, RunsOutOfAttempts) {
+  GetService().SetFailures(5, grpc::StatusCode::UNAVAILABLE);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call = client.SayHello(MakeRequest("userver"), &MakeContext, MakeQos(2));
+  UEXPECT_THROW(call.Finish(), ugrpc::client::UnavailableError);
+  EXPECT_EQ(GetService().GetCalls(), 2);
+}
+
+UTEST_F(GrpcRetries, NotRetryableStatus) {
+  GetService().SetFailures(1, grpc::StatusCode::INTERNAL);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call = client.SayHello(MakeRequest("userver"), &MakeContext, MakeQos(3));
+  UEXPECT_THROW(call.Finish(), ugrpc::client::InternalError);
+  EXPECT_EQ(GetService().GetCalls(), 1);
+}
+
+UTEST_F(GrpcRetries, SingleAttemptByDefault) {
+  GetService().SetFailures(1, grpc::StatusCode::UNAVAILABLE);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call = client.SayHello(MakeRequest("userver"));
+  UEXPECT_THROW(call.Finish(), ugrpc::client::UnavailableError);
+  EXPECT_EQ(GetService().GetCalls(), 1);
+}
+
+UTEST_F(GrpcRetries, SingleAttemptWithoutContextFactory) {
+  GetService().SetFailures(1, grpc::StatusCode::UNAVAILABLE);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call =
+      client.SayHello(MakeRequest("userver"), MakeContext(), MakeQos(3));
+  UEXPECT_THROW(call.Finish(), ugrpc::client::UnavailableError);
+  EXPECT_EQ(GetService().GetCalls(), 1);
+}
+
+UTEST_F(GrpcRetries, HedgedAttemptWins) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto qos = MakeQos(2);
+  qos.hedging_delay = 10ms;
+  auto call = client.SayHello(MakeRequest("slow"), &MakeContext, qos);
+  EXPECT_EQ(call.Finish().name(), "Hello slow");
+  EXPECT_EQ(GetService().GetCalls(), 2);
+  GetService().ReleaseSlow();
+
+  const auto stats = GetStatistics(
+      "grpc.client.by-destination",
+      {{"grpc_destination", "sample.ugrpc.UnitTestService/SayHello"}});
+  EXPECT_EQ(stats.SingleMetric("attempts.hedges").AsRate().value, 1);
+  EXPECT_EQ(stats.SingleMetric("attempts.hedge-wins").AsRate().value, 1);
+}
+
+class GrpcRetryBudget : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcRetryBudget() {
+    RegisterService(service_);
+    ugrpc::client::ClientFactoryConfig config;
+    config.retry.budget = 1;
+    config.retry.budget_refill_interval = utest::kMaxTestWaitTime;
+    StartServer(std::move(config));
+  }
+
+  ~GrpcRetryBudget() override { StopServer(); }
+
+  UnitTestServiceFlaky& GetService() { return service_; }
+
+ private:
+  UnitTestServiceFlaky service_;
+};
+
+UTEST_F(GrpcRetryBudget, Exhausted) {
+  GetService().SetFailures(5, grpc::StatusCode::UNAVAILABLE);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call = client.SayHello(MakeRequest("userver"), &MakeContext, MakeQos(5));
+  UEXPECT_THROW(call.Finish(), ugrpc::client::UnavailableError);
+  // The first attempt and a single retry
+  EXPECT_EQ(GetService().GetCalls(), 2);
+
+  const auto stats = GetStatistics(
+      "grpc.client.by-destination",
+      {{"grpc_destination", "sample.ugrpc.UnitTestService/SayHello"}});
+  EXPECT_EQ(stats.SingleMetric("attempts.retries").AsRate().value, 1);
+  EXPECT_EQ(
+      stats.SingleMetric("attempts.retry-budget-exhausted").AsRate().value, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -23,11 +24,13 @@ namespace ugrpc::tests {
 /// Sets up a mini gRPC server using the provided service implementations
 class ServiceFixtureBase : public ::testing::Test {
  protected:
-  explicit ServiceFixtureBase(dynamic_config::StorageMock&& dynconf);
+  explicit ServiceFixtureBase(dynamic_config::StorageMock&& dynconf,
+                              std::size_t completion_queue_count = 1);
 
 #if defined(DEFAULT_DYNAMIC_CONFIG_FILENAME) || defined(DOXYGEN)
-  ServiceFixtureBase()
-      : ServiceFixtureBase(dynamic_config::MakeDefaultStorage({})) {}
+  explicit ServiceFixtureBase(std::size_t completion_queue_count = 1)
+      : ServiceFixtureBase(dynamic_config::MakeDefaultStorage({}),
+                           completion_queue_count) {}
 #endif
 
   ~ServiceFixtureBase() override;
@@ -116,6 +119,26 @@ class ServiceFixtureMultichannel
   Service service_{};
 };
 
+// Sets up a mini gRPC server using a single default-constructed service
+// implementation. The server and the client use the number of completion
+// queues given as the test parameter.
+template <typename Service>
+// NOLINTNEXTLINE(fuchsia-multiple-inheritance)
+class ServiceFixtureMultiqueue
+    : public ServiceFixtureBase,
+      public testing::WithParamInterface<std::size_t> {
+ protected:
+  ServiceFixtureMultiqueue() : ServiceFixtureBase(GetParam()) {
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~ServiceFixtureMultiqueue() override { StopServer(); }
+
+ private:
+  Service service_{};
+};
+
 }  // namespace ugrpc::tests
 
 USERVER_NAMESPACE_END
@@ -16,9 +16,10 @@ namespace ugrpc::tests {
 
 namespace {
 
-server::ServerConfig MakeServerConfig() {
+server::ServerConfig MakeServerConfig(std::size_t completion_queue_count) {
   server::ServerConfig config;
   config.port = 0;
+  config.completion_queue_count = completion_queue_count;
   return config;
 }
 
@@ -38,9 +39,10 @@ using ServerDpMiddleware =
 
 }  // namespace
 
-ServiceFixtureBase::ServiceFixtureBase(dynamic_config::StorageMock&& dynconf)
+ServiceFixtureBase::ServiceFixtureBase(dynamic_config::StorageMock&& dynconf,
+                                       std::size_t completion_queue_count)
     : config_storage_(std::move(dynconf)),
-      server_(MakeServerConfig(), statistics_storage_,
+      server_(MakeServerConfig(completion_queue_count), statistics_storage_,
               config_storage_.GetSource()),
       server_middlewares_(
           {std::make_shared<ServerLogMiddleware>(ServerLogMiddlewareSettings{}),
@@ -67,7 +69,7 @@ void ServiceFixtureBase::StartServer(
   endpoint_ = fmt::format("[::1]:{}", server_.GetPort());
   client_factory_.emplace(std::move(client_factory_config),
                           engine::current_task::GetTaskProcessor(),
-                          middleware_factories_, server_.GetCompletionQueue(),
+                          middleware_factories_, server_.GetCompletionQueues(),
                           statistics_storage_, testsuite_,
                           config_storage_.GetSource());
 }
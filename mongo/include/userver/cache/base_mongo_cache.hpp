@@ -4,6 +4,7 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <optional>
 
 #include <fmt/format.h>
 
@@ -11,10 +12,16 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/formats/bson/binary.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/value_reader.hpp>
 #include <userver/formats/bson/value_builder.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
@@ -30,10 +37,14 @@ inline const std::string kFetchAndParseStage = "fetch_and_parse";
 inline constexpr std::chrono::milliseconds kCpuRelaxThreshold{10};
 inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 
+inline constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{10};
+
 namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+bool IsMongoCacheChangeStreamEnabled(const ComponentConfig&);
+
 }
 
 // clang-format off
@@ -49,6 +60,18 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// change-stream-updates | use a change stream of the collection for incremental updates instead of polling | false
+///
+/// ## Change stream updates
+/// With `change-stream-updates: true` incremental updates read inserted,
+/// replaced and updated documents from a change stream of the collection
+/// opened at the preceding full update, so each update only costs a
+/// `getMore` on an already open cursor and `update-interval` may be set low.
+/// kMongoUpdateFieldName and GetFindOperation are only used for full updates
+/// then. Resume token is stored in cache dumps (bump `dump.format-version`
+/// when enabling), an update falls back to a full one if the stream cannot
+/// be resumed. Deleted documents are not removed from the cache until the
+/// next full update, same as with polling. Requires a replica set.
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -86,6 +109,12 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   static ObjectType DeserializeObject(const formats::bson::Document& doc) {
 ///     return doc["value"].As<ObjectType>();
 ///   }
+///   // or, to decode documents straight from the received batch without
+///   // building formats::bson::Document for them
+///   static ObjectType DeserializeObject(
+///       const formats::bson::ValueReader& reader) {
+///     return reader["value"].As<ObjectType>();
+///   }
 ///   // (default implementation calls doc.As<ObjectType>())
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultDeserializeObject = true;
@@ -131,11 +160,40 @@ class MongoCache
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  using DataType = typename MongoCacheTraits::DataType;
+
+  // Resume token of the change stream that is valid for the data
+  struct ResumePoint {
+    const DataType* data{nullptr};
+    std::optional<formats::bson::Document> token;
+  };
+
   void Update(cache::UpdateType type,
               const std::chrono::system_clock::time_point& last_update,
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  // Returns false if the change stream cannot be resumed
+  bool UpdateFromChangeStream(cache::UpdateStatisticsScope& stats_scope);
+
+  storages::mongo::ChangeStream OpenChangeStream(
+      const std::optional<formats::bson::Document>& resume_token) const;
+
+  // Closes the stream and makes the next incremental update a full one
+  void ResetChangeStream();
+
+  template <typename Deserialize, typename GetId>
+  void ProcessDocument(cache::UpdateType type, DataType& cache,
+                       cache::UpdateStatisticsScope& stats_scope,
+                       const Deserialize& deserialize,
+                       const GetId& get_id) const;
+
+  void WriteContents(dump::Writer& writer,
+                     const DataType& contents) const override;
+
+  std::unique_ptr<const DataType> ReadContents(
+      dump::Reader& reader) const override;
+
   typename MongoCacheTraits::ObjectType DeserializeObject(
       const formats::bson::Document& doc) const;
 
@@ -151,7 +209,10 @@ class MongoCache
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const bool is_change_stream_enabled_;
   std::size_t cpu_relax_iterations_{0};
+  std::optional<storages::mongo::ChangeStream> change_stream_;
+  mutable concurrent::Variable<ResumePoint> resume_point_;
 };
 
 template <class MongoCacheTraits>
@@ -169,13 +230,22 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      is_change_stream_enabled_(impl::IsMongoCacheChangeStreamEnabled(config)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
-  if (CachingComponentBase<
-          typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
-          cache::AllowedUpdateTypes::kFullAndIncremental &&
+  const auto allowed_update_types = CachingComponentBase<
+      typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes();
+  if (is_change_stream_enabled_ &&
+      allowed_update_types != cache::AllowedUpdateTypes::kFullAndIncremental) {
+    throw std::logic_error(
+        "Change stream updates are requested in config but incremental "
+        "updates are disabled for '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
+  if (allowed_update_types == cache::AllowedUpdateTypes::kFullAndIncremental &&
+      !is_change_stream_enabled_ &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
       !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
     throw std::logic_error(
@@ -206,6 +276,19 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  std::optional<sm::ChangeStream> change_stream;
+  if (is_change_stream_enabled_) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (UpdateFromChangeStream(stats_scope)) return;
+      LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                    << " cannot be resumed, running a full update";
+      type = cache::UpdateType::kFull;
+    }
+    // Changes made while the collection is read are applied by the next
+    // incremental update, applying them twice is harmless
+    change_stream.emplace(OpenChangeStream(std::nullopt));
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -225,32 +308,31 @@ void MongoCache<MongoCacheTraits>::Update(
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
   std::size_t doc_count = 0;
 
-  for (const auto& doc : cursor) {
+  const auto process_document = [&](const auto& deserialize,
+                                    const auto& get_id) {
     ++doc_count;
 
     relax.Relax();
 
-    stats_scope.IncreaseDocumentsReadCount(1);
+    ProcessDocument(type, *new_cache, stats_scope, deserialize, get_id);
+  };
 
-    try {
-      auto object = DeserializeObject(doc);
-      auto key = (object.*MongoCacheTraits::kKeyField);
-
-      if (type == cache::UpdateType::kIncremental ||
-          new_cache->count(key) == 0) {
-        (*new_cache)[key] = std::move(object);
-      } else {
-        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
-                            << MongoCacheTraits::kName << ", key=" << key;
-      }
-    } catch (const std::exception& e) {
-      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
-                          << MongoCacheTraits::kName << ", _id="
-                          << doc["_id"].template ConvertTo<std::string>()
-                          << ", what(): " << e;
-      stats_scope.IncreaseDocumentsParseFailures(1);
-
-      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+  if constexpr (mongo_cache::impl::kHasReaderDeserializeObject<
+                    MongoCacheTraits>) {
+    cursor.ForEachReader([&](const formats::bson::ValueReader& reader) {
+      process_document(
+          [&] { return MongoCacheTraits::DeserializeObject(reader); },
+          [&] {
+            return reader.As<formats::bson::Document>()["_id"]
+                .template ConvertTo<std::string>();
+          });
+    });
+  } else {
+    for (const auto& doc : cursor) {
+      process_document([&] { return DeserializeObject(doc); },
+                       [&] {
+                         return doc["_id"].template ConvertTo<std::string>();
+                       });
     }
   }
 
@@ -267,10 +349,185 @@ void MongoCache<MongoCacheTraits>::Update(
   scope.Reset();
 
   const auto size = new_cache->size();
+  const auto* data = new_cache.get();
   this->Set(std::move(new_cache));
+  if (change_stream) {
+    auto token = change_stream->GetResumeToken();
+    change_stream_ = std::move(change_stream);
+    auto resume_point = resume_point_.Lock();
+    *resume_point = {data, std::move(token)};
+  }
   stats_scope.Finish(size);
 }
 
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::UpdateFromChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  namespace sm = storages::mongo;
+
+  std::unique_ptr<DataType> new_cache;
+  try {
+    if (!change_stream_) {
+      std::optional<formats::bson::Document> token;
+      {
+        const auto resume_point = resume_point_.Lock();
+        token = resume_point->token;
+      }
+      if (!token) return false;
+      change_stream_.emplace(OpenChangeStream(token));
+    }
+
+    auto scope = tracing::Span::CurrentSpan().CreateScopeTime(
+        kFetchAndParseStage);
+    while (auto event = change_stream_->Next()) {
+      const auto operation_type =
+          (*event)["operationType"].As<std::string>({});
+      if (operation_type == "invalidate" || operation_type == "drop" ||
+          operation_type == "rename" || operation_type == "dropDatabase") {
+        LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                      << " is invalidated by '" << operation_type << "'";
+        ResetChangeStream();
+        return false;
+      }
+
+      // Deleted documents are only removed by full updates,
+      // updated ones may be already deleted
+      const auto full_document = (*event)["fullDocument"];
+      if (full_document.IsMissing() || full_document.IsNull()) continue;
+
+      const auto doc = full_document.As<formats::bson::Document>();
+      if (!new_cache) new_cache = GetData(cache::UpdateType::kIncremental);
+      ProcessDocument(
+          cache::UpdateType::kIncremental, *new_cache, stats_scope,
+          [&] {
+            if constexpr (mongo_cache::impl::kHasReaderDeserializeObject<
+                              MongoCacheTraits>) {
+              return MongoCacheTraits::DeserializeObject(
+                  formats::bson::ValueReader(doc));
+            } else {
+              return DeserializeObject(doc);
+            }
+          },
+          [&] { return doc["_id"].template ConvertTo<std::string>(); });
+    }
+  } catch (const sm::ServerException& ex) {
+    // e.g. the resume token is no longer in the oplog
+    LOG_WARNING() << "Failed to read change stream of cache "
+                  << MongoCacheTraits::kName << ": " << ex;
+    ResetChangeStream();
+    return false;
+  } catch (const std::exception&) {
+    // Events read so far are lost, the next update reopens the stream
+    // from the resume token of the current data
+    change_stream_.reset();
+    throw;
+  }
+
+  auto token = change_stream_->GetResumeToken();
+  if (!new_cache) {
+    // Data is the same, the newer token is valid for it
+    if (token) {
+      auto resume_point = resume_point_.Lock();
+      resume_point->token = std::move(token);
+    }
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  const auto size = new_cache->size();
+  const auto* data = new_cache.get();
+  this->Set(std::move(new_cache));
+  {
+    auto resume_point = resume_point_.Lock();
+    *resume_point = {data, std::move(token)};
+  }
+  stats_scope.Finish(size);
+  return true;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ResetChangeStream() {
+  change_stream_.reset();
+  auto resume_point = resume_point_.Lock();
+  resume_point->token.reset();
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream MongoCache<MongoCacheTraits>::OpenChangeStream(
+    const std::optional<formats::bson::Document>& resume_token) const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op;
+  watch_op.SetOption(sm::options::FullDocumentLookup{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+  if (resume_token) watch_op.SetOption(sm::options::ResumeAfter{*resume_token});
+  return mongo_collection_->Execute(watch_op);
+}
+
+template <class MongoCacheTraits>
+template <typename Deserialize, typename GetId>
+void MongoCache<MongoCacheTraits>::ProcessDocument(
+    cache::UpdateType type, DataType& cache,
+    cache::UpdateStatisticsScope& stats_scope, const Deserialize& deserialize,
+    const GetId& get_id) const {
+  stats_scope.IncreaseDocumentsReadCount(1);
+
+  try {
+    auto object = deserialize();
+    auto key = (object.*MongoCacheTraits::kKeyField);
+
+    if (type == cache::UpdateType::kIncremental || cache.count(key) == 0) {
+      cache[key] = std::move(object);
+    } else {
+      LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                          << MongoCacheTraits::kName << ", key=" << key;
+    }
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                        << MongoCacheTraits::kName << ", _id=" << get_id()
+                        << ", what(): " << e;
+    stats_scope.IncreaseDocumentsParseFailures(1);
+
+    if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+  }
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::WriteContents(
+    dump::Writer& writer, const DataType& contents) const {
+  CachingComponentBase<DataType>::WriteContents(writer, contents);
+  if (!is_change_stream_enabled_) return;
+
+  // The token is not written for older data, the dump is then followed
+  // by a full update
+  std::optional<std::string> token;
+  {
+    const auto resume_point = resume_point_.Lock();
+    if (resume_point->data == &contents && resume_point->token) {
+      token.emplace(
+          formats::bson::ToBinaryString(*resume_point->token).GetView());
+    }
+  }
+  writer.Write(token.has_value());
+  if (token) writer.Write(*token);
+}
+
+template <class MongoCacheTraits>
+std::unique_ptr<const typename MongoCacheTraits::DataType>
+MongoCache<MongoCacheTraits>::ReadContents(dump::Reader& reader) const {
+  auto contents = CachingComponentBase<DataType>::ReadContents(reader);
+  if (!is_change_stream_enabled_) return contents;
+
+  std::optional<formats::bson::Document> token;
+  if (reader.Read<bool>()) {
+    token = formats::bson::FromBinaryString(reader.Read<std::string>());
+  }
+  auto resume_point = resume_point_.Lock();
+  *resume_point = {contents.get(), std::move(token)};
+  return contents;
+}
+
 template <class MongoCacheTraits>
 typename MongoCacheTraits::ObjectType
 MongoCache<MongoCacheTraits>::DeserializeObject(
@@ -11,7 +11,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::bson {
 class Document;
-}
+class ValueReader;
+}  // namespace formats::bson
 
 namespace storages::mongo::operations {
 class Find;
@@ -63,6 +64,15 @@ template <typename T>
 inline constexpr bool kHasCorrectDeserializeObject =
     meta::kIsDetected<HasCorrectDeserializeObject, T>;
 
+template <typename T>
+using HasReaderDeserializeObject =
+    meta::ExpectSame<typename T::ObjectType,
+                     decltype(std::declval<const T&>().DeserializeObject(
+                         std::declval<const formats::bson::ValueReader&>()))>;
+template <typename T>
+inline constexpr bool kHasReaderDeserializeObject =
+    meta::kIsDetected<HasReaderDeserializeObject, T>;
+
 template <typename T>
 using HasDefaultDeserializeObject = decltype(T::kUseDefaultDeserializeObject);
 template <typename T>
@@ -173,11 +183,14 @@ struct CheckTraits {
                 "Mongo cache traits must specify deserialize object");
   static_assert(
       !kHasDeserializeObject<MongoCacheTraits> ||
-          kHasCorrectDeserializeObject<MongoCacheTraits>,
+          kHasCorrectDeserializeObject<MongoCacheTraits> ||
+          kHasReaderDeserializeObject<MongoCacheTraits>,
       "Mongo cache traits must specify deserialize object with correct "
       "signature and return value type: "
       "static ObjectType DeserializeObject(const formats::bson::Document& "
-      "doc)");
+      "doc) or "
+      "static ObjectType DeserializeObject(const formats::bson::ValueReader& "
+      "reader)");
 };
 
 }  // namespace mongo_cache::impl
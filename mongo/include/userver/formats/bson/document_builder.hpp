@@ -0,0 +1,110 @@
+#pragma once
+
+/// @file userver/formats/bson/document_builder.hpp
+/// @brief @copybrief formats::bson::DocumentBuilder
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/bson/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+/// @brief SAX like append-only builder of a BSON document. Use only in
+/// performance critical parts of your code, e.g. in hot insert paths.
+///
+/// Unlike formats::bson::ValueBuilder no tree of values is built: the fields
+/// are written right into the native BSON buffer. The buffer is reused by the
+/// following builders of the same thread, so that a document of a usual size
+/// costs a single allocation of the exact size on Extract().
+///
+/// The result is a plain formats::bson::Document that is passed to
+/// storages::mongo::Collection::InsertOne(), storages::mongo::Bulk and others
+/// without any conversion.
+///
+/// @code
+/// formats::bson::DocumentBuilder builder;
+/// builder.Key("_id");
+/// builder.WriteOid(formats::bson::Oid{});
+/// {
+///   builder.Key("tags");
+///   formats::bson::DocumentBuilder::ArrayGuard guard(builder);
+///   builder.WriteString("hot");
+///   builder.WriteString("new");
+/// }
+/// collection.InsertOne(builder.Extract());
+/// @endcode
+class DocumentBuilder final {
+ public:
+  DocumentBuilder();
+  ~DocumentBuilder();
+
+  DocumentBuilder(const DocumentBuilder&) = delete;
+  DocumentBuilder& operator=(const DocumentBuilder&) = delete;
+
+  /// Construct this guard after a Key() or in an array to start a
+  /// subdocument, its destructor ends the subdocument
+  class ObjectGuard final {
+   public:
+    explicit ObjectGuard(DocumentBuilder& builder);
+    ~ObjectGuard();
+
+   private:
+    DocumentBuilder& builder_;
+  };
+
+  /// Construct this guard after a Key() or in an array to start an array,
+  /// its destructor ends the array
+  class ArrayGuard final {
+   public:
+    explicit ArrayGuard(DocumentBuilder& builder);
+    ~ArrayGuard();
+
+   private:
+    DocumentBuilder& builder_;
+  };
+
+  /// ONLY for documents and subdocuments: sets the key of the next value.
+  /// The elements of the arrays get their indices as keys.
+  void Key(std::string_view key);
+
+  void WriteNull();
+  void WriteBool(bool value);
+  void WriteInt32(std::int32_t value);
+  void WriteInt64(std::int64_t value);
+  void WriteDouble(double value);
+  /// @throws BsonException if the string is not a valid UTF-8
+  void WriteString(std::string_view value);
+  void WriteTimePoint(std::chrono::system_clock::time_point value);
+  void WriteOid(const Oid& value);
+  void WriteBinary(const Binary& value);
+  void WriteValue(const Value& value);
+
+  /// @brief Returns the written document, the builder may be used for the next
+  /// document afterwards
+  /// @throws BsonException if a subdocument or an array is not ended
+  Document Extract();
+
+ private:
+  struct Buffer;
+
+  // The buffer kept for the next builder of the current thread
+  static std::unique_ptr<Buffer>& GetCachedBuffer() noexcept;
+
+  bson_t* GetParent();
+  std::string_view GetKey();
+  void StartSubdocument(bool is_array);
+  void EndSubdocument() noexcept;
+
+  std::unique_ptr<Buffer> buffer_;
+};
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
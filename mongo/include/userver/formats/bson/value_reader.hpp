@@ -0,0 +1,246 @@
+#pragma once
+
+/// @file userver/formats/bson/value_reader.hpp
+/// @brief @copybrief formats::bson::ValueReader
+
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <bson/bson.h>
+
+#include <userver/formats/bson/exception.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/parse/common.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+class Document;
+
+// clang-format off
+
+/// @brief Streaming read-only view of a BSON document.
+///
+/// Unlike formats::bson::Value, does not build a parsed tree of the
+/// document: fields are decoded straight from the document storage while
+/// iterating over it, member access by name is a linear scan. Use it for
+/// parsing large amounts of documents once, e.g. in caches.
+///
+/// `As<T>()` uses `Parse(const ValueReader&, formats::parse::To<T>)`, so the
+/// `Parse` functions templated on the value type work with both Value and
+/// ValueReader.
+///
+/// ## Example usage:
+///
+/// @snippet formats/bson/value_reader_test.cpp  Sample formats::bson::ValueReader usage
+///
+/// @warning The reader does not own the data, the document must outlive it.
+/// The readers of the fields and elements may outlive the reader they were
+/// obtained from, e.g. `auto x = reader["a"]["b"];` is fine.
+
+// clang-format on
+
+class ValueReader {
+ public:
+  struct DefaultConstructed {};
+
+  class Iterator;
+  using const_iterator = Iterator;
+  using Exception = formats::bson::BsonException;
+  using ParseException = formats::bson::ConversionException;
+
+  /// Creates a reader of the document
+  explicit ValueReader(const Document& document);
+
+  /// @cond
+  /// Creates a reader of the native document, internal use only
+  explicit ValueReader(const bson_t* native);
+  /// @endcond
+
+  /// @brief Retrieves document field by name
+  /// @throws TypeMismatchException if value is not a missing value, a document,
+  /// or `null`
+  ValueReader operator[](std::string_view name) const;
+
+  /// @brief Returns an iterator to the first array element/document field
+  /// @throws TypeMismatchException if value is not a document, array or `null`
+  Iterator begin() const;
+
+  /// Returns an iterator following the last array element/document field
+  Iterator end() const;
+
+  /// Returns value path in a document
+  std::string GetPath() const;
+
+  /// @brief Checks whether the selected element exists
+  /// @note MemberMissingException is thrown on nonexisting element access
+  bool IsMissing() const;
+
+  /// @name Type checking
+  /// @{
+  bool IsArray() const;
+  bool IsDocument() const;
+  bool IsNull() const;
+  bool IsBool() const;
+  bool IsInt32() const;
+  bool IsInt64() const;
+  bool IsDouble() const;
+  bool IsString() const;
+  bool IsDateTime() const;
+  bool IsOid() const;
+  bool IsBinary() const;
+  bool IsDecimal128() const;
+  bool IsTimestamp() const;
+
+  bool IsObject() const { return IsDocument(); }
+  /// @}
+
+  /// Extracts the specified type with strict type checks
+  template <typename T>
+  T As() const {
+    static_assert(
+        formats::common::impl::kHasParse<ValueReader, T>,
+        "There is no `Parse(const ValueReader&, formats::parse::To<T>)` in "
+        "namespace of `T` or `formats::parse`. "
+        "Probably you have not provided a `Parse` function overload.");
+
+    return Parse(*this, formats::parse::To<T>{});
+  }
+
+  /// Extracts the specified type with strict type checks, or constructs the
+  /// default value when the field is not present
+  template <typename T, typename First, typename... Rest>
+  T As(First&& default_arg, Rest&&... more_default_args) const {
+    if (IsMissing() || IsNull()) {
+      // intended raw ctor call, sometimes casts
+      // NOLINTNEXTLINE(google-readability-casting)
+      return T(std::forward<First>(default_arg),
+               std::forward<Rest>(more_default_args)...);
+    }
+    return As<T>();
+  }
+
+  /// @brief Returns value of *this converted to T or T() if this->IsMissing().
+  /// @note Use as `value.As<T>({})`
+  template <typename T>
+  T As(DefaultConstructed) const {
+    return (IsMissing() || IsNull()) ? T() : As<T>();
+  }
+
+  /// Throws a MemberMissingException if the selected element does not exist
+  void CheckNotMissing() const;
+
+  /// @brief Throws a TypeMismatchException if the selected element
+  /// is not an array or null
+  void CheckArrayOrNull() const;
+
+  /// @brief Throws a TypeMismatchException if the selected element
+  /// is not a document or null
+  void CheckDocumentOrNull() const;
+
+  /// @cond
+  /// Same, for parsing capabilities
+  void CheckObjectOrNull() const { CheckDocumentOrNull(); }
+  /// @endcond
+
+ private:
+  ValueReader(const ValueReader& parent, const bson_iter_t& iter);
+  ValueReader(const ValueReader& parent, std::string_view missing_key);
+
+  bson_type_t GetType() const;
+  const bson_iter_t& GetIter() const;
+  bool InitChildIter(bson_iter_t& child) const;
+  std::string MakeChildPath(std::string_view key) const;
+
+  // Document storage for the root reader, nullptr for elements
+  const bson_t* root_{nullptr};
+  bson_iter_t iter_{};
+  bool is_missing_{false};
+  // Empty for the root reader, so that the paths of its fields have no prefix
+  std::string path_;
+};
+
+/// Input iterator over a ValueReader of a document or an array
+class ValueReader::Iterator final {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = ptrdiff_t;
+  using value_type = ValueReader;
+  using reference = ValueReader;
+  using pointer = void;
+
+  ValueReader operator*() const;
+  Iterator& operator++();
+
+  bool operator==(const Iterator&) const;
+  bool operator!=(const Iterator&) const;
+
+  /// @brief Returns name of currently selected document field
+  /// @throws TypeMismatchException if iterated value is not a document
+  std::string_view GetName() const;
+
+  /// @brief Returns index of currently selected array element
+  /// @throws TypeMismatchException if iterated value is not an array
+  uint32_t GetIndex() const;
+
+ private:
+  friend class ValueReader;
+
+  Iterator() = default;
+  explicit Iterator(const ValueReader& iterable);
+
+  const ValueReader* iterable_{nullptr};
+  bson_iter_t iter_{};
+  uint32_t index_{0};
+};
+
+/// @cond
+template <>
+bool ValueReader::As<bool>() const;
+
+template <>
+int64_t ValueReader::As<int64_t>() const;
+
+template <>
+uint64_t ValueReader::As<uint64_t>() const;
+
+template <>
+double ValueReader::As<double>() const;
+
+template <>
+std::string ValueReader::As<std::string>() const;
+
+/// Points into the document storage
+template <>
+std::string_view ValueReader::As<std::string_view>() const;
+
+template <>
+std::chrono::system_clock::time_point
+ValueReader::As<std::chrono::system_clock::time_point>() const;
+
+template <>
+Oid ValueReader::As<Oid>() const;
+
+template <>
+Binary ValueReader::As<Binary>() const;
+
+template <>
+Decimal128 ValueReader::As<Decimal128>() const;
+
+template <>
+Timestamp ValueReader::As<Timestamp>() const;
+
+/// Copies a subdocument, parse it as Value for random member access
+template <>
+Document ValueReader::As<Document>() const;
+/// @endcond
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,7 @@ class Bulk {
   void SetOption(options::WriteConcern::Level);
   void SetOption(const options::WriteConcern&);
   void SetOption(options::SuppressServerExceptions);
+  void SetOption(const options::BulkParallelism&);
 
   /// Inserts a single document
   template <typename... Options>
@@ -76,7 +77,7 @@ class Bulk {
   friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
 
   class Impl;
-  static constexpr size_t kSize = 56;
+  static constexpr size_t kSize = 96;
   static constexpr size_t kAlignment = 8;
   // MAC_COMPAT: std::string size differs
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Interface for MongoDB change streams
+///
+/// Change stream keeps a connection from the pool while it exists.
+/// @see https://docs.mongodb.com/manual/changeStreams/
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Returns the next change event, waits for it for no more than
+  /// options::MaxAwaitTime
+  /// @returns std::nullopt if there are no new events
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume a stream after the last returned
+  /// event, or after the last empty batch if there were no events
+  /// @see options::ResumeAfter
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -52,12 +53,27 @@ class Collection {
   template <typename... Options>
   Cursor Find(formats::bson::Document filter, Options&&... options) const;
 
+  /// @brief Performs a query on the collection split into up to `parts`
+  /// queries over disjoint `_id` ranges
+  ///
+  /// Each of the returned cursors uses its own connection from the pool and
+  /// may be consumed in a separate task. Ranges are computed from the
+  /// minimal and maximal `_id` matching the filter, splitting is only done
+  /// for ObjectId and numeric ids, otherwise a single cursor is returned.
+  /// @note Options like options::Skip, options::Limit and options::Sort
+  /// are applied to each of the parts separately.
+  template <typename... Options>
+  std::vector<Cursor> FindParallel(size_t parts,
+                                   formats::bson::Document filter,
+                                   Options&&... options) const;
+
   /// Retrieves a single document from the collection
   template <typename... Options>
   std::optional<formats::bson::Document> FindOne(formats::bson::Document filter,
                                                  Options&&... options) const;
 
-  /// Inserts a single document into the collection
+  /// @brief Inserts a single document into the collection
+  /// @see formats::bson::DocumentBuilder to build documents on hot paths
   template <typename... Options>
   WriteResult InsertOne(formats::bson::Document document, Options&&... options);
 
@@ -124,11 +140,22 @@ class Collection {
   template <typename... Options>
   Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+  /// @brief Opens a change stream of the collection
+  /// @param pipeline an array of aggregation operations to filter and
+  /// transform change events, may be empty
+  /// @see options::ResumeAfter
+  /// @see options::FullDocumentLookup
+  template <typename... Options>
+  ChangeStream Watch(formats::bson::Value pipeline,
+                     Options&&... options) const;
+
   /// @name Prepared operation executors
   /// @{
   size_t Execute(const operations::Count&) const;
   size_t Execute(const operations::CountApprox&) const;
   Cursor Execute(const operations::Find&) const;
+  std::vector<Cursor> ExecuteParallel(const operations::Find&,
+                                      size_t parts) const;
   WriteResult Execute(const operations::InsertOne&);
   WriteResult Execute(const operations::InsertMany&);
   WriteResult Execute(const operations::ReplaceOne&);
@@ -138,6 +165,7 @@ class Collection {
   WriteResult Execute(const operations::FindAndRemove&);
   WriteResult Execute(operations::Bulk&&);
   Cursor Execute(const operations::Aggregate&);
+  ChangeStream Execute(const operations::Watch&) const;
   void Execute(const operations::Drop&);
   /// @}
  private:
@@ -178,6 +206,15 @@ Cursor Collection::Find(formats::bson::Document filter,
   return Execute(find_op);
 }
 
+template <typename... Options>
+std::vector<Cursor> Collection::FindParallel(size_t parts,
+                                             formats::bson::Document filter,
+                                             Options&&... options) const {
+  operations::Find find_op(std::move(filter));
+  (find_op.SetOption(std::forward<Options>(options)), ...);
+  return ExecuteParallel(find_op, parts);
+}
+
 template <typename... Options>
 std::optional<formats::bson::Document> Collection::FindOne(
     formats::bson::Document filter, Options&&... options) const {
@@ -300,6 +337,14 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline,
   return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(formats::bson::Value pipeline,
+                               Options&&... options) const {
+  operations::Watch watch_op(std::move(pipeline));
+  (watch_op.SetOption(std::forward<Options>(options)), ...);
+  return Execute(watch_op);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value_reader.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -61,10 +62,27 @@ class Cursor {
   Iterator begin();
   Iterator end();
 
+  /// @brief Calls `func(const formats::bson::ValueReader&)` for each of the
+  /// remaining documents.
+  ///
+  /// Documents are read straight from the received batch without building a
+  /// formats::bson::Document, which is faster for large result sets. Reader
+  /// is only valid during the call of `func`.
+  template <typename Func>
+  void ForEachReader(Func&& func);
+
  private:
+  formats::bson::ValueReader GetCurrentReader() const;
+  void Advance();
+
   std::unique_ptr<impl::CursorImpl> impl_;
 };
 
+template <typename Func>
+void Cursor::ForEachReader(Func&& func) {
+  for (; HasMore(); Advance()) func(GetCurrentReader());
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
@@ -97,6 +97,7 @@ class Find {
   void SetOption(options::Tailable);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
+  void SetOption(options::Prefetch);
 
  private:
   friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
@@ -334,6 +335,34 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// Opens a change stream of the collection
+class Watch {
+ public:
+  /// @param pipeline an array of aggregation operations to filter and
+  /// transform change events, may be empty
+  explicit Watch(formats::bson::Value pipeline = formats::bson::Value{});
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(options::ReadConcern);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocumentLookup);
+  void SetOption(const options::MaxAwaitTime&);
+  void SetOption(const options::Comment&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 64;
+  static constexpr size_t kAlignment = 8;
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
@@ -123,6 +123,30 @@ class Unordered {};
 /// Enables insertion of a new document when update selector matches nothing
 class Upsert {};
 
+/// @brief Splits an unordered bulk into chunks that are executed concurrently
+/// over different connections of the pool
+///
+/// A chunk holds at most `max_chunk_size` sub-operations and at most
+/// `kMaxChunkBytes` of documents. Results of the chunks are merged into a
+/// single WriteResult, operation indexes in it are indexes in the whole bulk.
+class BulkParallelism {
+ public:
+  /// Server default of maxWriteBatchSize
+  static constexpr size_t kDefaultMaxChunkSize = 100'000;
+  /// Server default of maxMessageSizeBytes
+  static constexpr size_t kMaxChunkBytes = 48'000'000;
+
+  explicit BulkParallelism(size_t max_in_flight_chunks,
+                           size_t max_chunk_size = kDefaultMaxChunkSize);
+
+  size_t MaxInFlightChunks() const { return max_in_flight_chunks_; }
+  size_t MaxChunkSize() const { return max_chunk_size_; }
+
+ private:
+  size_t max_in_flight_chunks_;
+  size_t max_chunk_size_;
+};
+
 /// Enables automatic one-time retry of duplicate key errors
 class RetryDuplicateKey {};
 
@@ -151,6 +175,22 @@ class Limit {
   size_t value_;
 };
 
+/// @brief Reads the query results ahead in a background task
+///
+/// Up to the specified number of documents are fetched from the server
+/// and buffered while the current ones are processed, so that `getMore`
+/// round trips overlap with the processing of previous batches.
+/// @note The value of `0` disables prefetching.
+class Prefetch {
+ public:
+  explicit Prefetch(size_t documents) : documents_(documents) {}
+
+  size_t Value() const { return documents_; }
+
+ private:
+  size_t documents_;
+};
+
 /// @brief Selects fields to be returned
 /// @note `_id` field is always included by default, order might be significant
 /// @see
@@ -283,6 +323,37 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Resumes a change stream after the event with the specified
+/// resume token
+/// @see ChangeStream::GetResumeToken
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Makes change events of updates contain the current version of
+/// the document in `fullDocument` field
+class FullDocumentLookup {};
+
+/// @brief Specifies the maximum time for the server to wait for new change
+/// events before returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
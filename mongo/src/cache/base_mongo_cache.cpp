@@ -12,6 +12,10 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+bool IsMongoCacheChangeStreamEnabled(const ComponentConfig& config) {
+  return config["change-stream-updates"].As<bool>(false);
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +26,10 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    change-stream-updates:
+        type: boolean
+        description: use a change stream of the collection for incremental updates instead of polling
+        defaultDescription: false
 )";
 }
 
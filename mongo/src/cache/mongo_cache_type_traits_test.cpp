@@ -2,6 +2,7 @@
 
 #include <userver/cache/update_type.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value_reader.hpp>
 #include <userver/storages/mongo/operations.hpp>
 
 #include <gtest/gtest.h>
@@ -14,6 +15,12 @@ struct CorrectDeserializeObject {
   static ObjectType DeserializeObject(const formats::bson::Document&);
 };
 
+struct ReaderDeserializeObject {
+  using ObjectType = int;
+
+  static ObjectType DeserializeObject(const formats::bson::ValueReader&);
+};
+
 struct IncorrectReturnTypeOfDeserializeObject {
   static void DeserializeObject(const formats::bson::Document&);
 };
@@ -60,6 +67,13 @@ TEST(CheckTraits, DeserializeObject) {
                IncorrectReturnTypeOfDeserializeObject>);
   EXPECT_FALSE(mongo_cache::impl::kHasCorrectDeserializeObject<
                IncorrectSignatureOfFindOperation>);
+  EXPECT_FALSE(mongo_cache::impl::kHasCorrectDeserializeObject<
+               ReaderDeserializeObject>);
+
+  EXPECT_TRUE(mongo_cache::impl::kHasReaderDeserializeObject<
+              ReaderDeserializeObject>);
+  EXPECT_FALSE(mongo_cache::impl::kHasReaderDeserializeObject<
+               CorrectDeserializeObject>);
 }
 
 TEST(CheckTraits, FindOperation) {
@@ -0,0 +1,232 @@
+#include <userver/formats/bson/document_builder.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+
+#include <bson/bson.h>
+
+#include <formats/bson/wrappers.hpp>
+#include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+namespace {
+
+// Buffers grown by the occasional huge documents are not kept
+constexpr std::size_t kMaxCachedBufferSize = 64 * 1024;
+
+}  // namespace
+
+struct DocumentBuilder::Buffer {
+  struct Frame {
+    bson_t bson;
+    bool is_array{false};
+    impl::ArrayIndexer indexer;
+  };
+
+  Buffer() { bson_init(&bson); }
+  ~Buffer() { bson_destroy(&bson); }
+
+  Buffer(const Buffer&) = delete;
+  Buffer& operator=(const Buffer&) = delete;
+
+  bson_t bson;
+  // deque keeps the frames in place, libbson children point to their parents
+  std::deque<Frame> frames;
+  std::string key;
+  bool has_key{false};
+  std::size_t max_size{0};
+};
+
+DocumentBuilder::DocumentBuilder()
+    : buffer_(std::move(GetCachedBuffer())) {
+  if (!buffer_) buffer_ = std::make_unique<Buffer>();
+}
+
+DocumentBuilder::~DocumentBuilder() {
+  // a builder abandoned in the middle of a subdocument is not reused
+  if (!buffer_->frames.empty() || buffer_->max_size > kMaxCachedBufferSize) {
+    return;
+  }
+
+  auto& cached_buffer = GetCachedBuffer();
+  if (!cached_buffer) {
+    bson_reinit(&buffer_->bson);
+    buffer_->has_key = false;
+    cached_buffer = std::move(buffer_);
+  }
+}
+
+DocumentBuilder::ObjectGuard::ObjectGuard(DocumentBuilder& builder)
+    : builder_(builder) {
+  builder_.StartSubdocument(/*is_array=*/false);
+}
+
+DocumentBuilder::ObjectGuard::~ObjectGuard() { builder_.EndSubdocument(); }
+
+DocumentBuilder::ArrayGuard::ArrayGuard(DocumentBuilder& builder)
+    : builder_(builder) {
+  builder_.StartSubdocument(/*is_array=*/true);
+}
+
+DocumentBuilder::ArrayGuard::~ArrayGuard() { builder_.EndSubdocument(); }
+
+void DocumentBuilder::Key(std::string_view key) {
+  auto& buffer = *buffer_;
+  if (!buffer.frames.empty() && buffer.frames.back().is_array) {
+    throw BsonException("Keys are not allowed in arrays");
+  }
+  if (buffer.has_key) {
+    throw BsonException("A value is expected after the key '" + buffer.key +
+                        '\'');
+  }
+  buffer.key.assign(key);
+  buffer.has_key = true;
+}
+
+void DocumentBuilder::WriteNull() {
+  const auto key = GetKey();
+  bson_append_null(GetParent(), key.data(), key.size());
+}
+
+void DocumentBuilder::WriteBool(bool value) {
+  const auto key = GetKey();
+  bson_append_bool(GetParent(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteInt32(std::int32_t value) {
+  const auto key = GetKey();
+  bson_append_int32(GetParent(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteInt64(std::int64_t value) {
+  const auto key = GetKey();
+  bson_append_int64(GetParent(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteDouble(double value) {
+  const auto key = GetKey();
+  bson_append_double(GetParent(), key.data(), key.size(), value);
+}
+
+void DocumentBuilder::WriteString(std::string_view value) {
+  if (!utils::text::utf8::IsValid(
+          reinterpret_cast<const unsigned char*>(value.data()), value.size())) {
+    throw BsonException("BSON strings must be valid UTF-8");
+  }
+  const auto key = GetKey();
+  bson_append_utf8(GetParent(), key.data(), key.size(), value.data(),
+                   value.size());
+}
+
+void DocumentBuilder::WriteTimePoint(
+    std::chrono::system_clock::time_point value) {
+  const auto key = GetKey();
+  const int64_t ms_since_epoch =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          value.time_since_epoch())
+          .count();
+  bson_append_date_time(GetParent(), key.data(), key.size(), ms_since_epoch);
+}
+
+void DocumentBuilder::WriteOid(const Oid& value) {
+  const auto key = GetKey();
+  bson_append_oid(GetParent(), key.data(), key.size(), value.GetNative());
+}
+
+void DocumentBuilder::WriteBinary(const Binary& value) {
+  const auto key = GetKey();
+  bson_append_binary(GetParent(), key.data(), key.size(), BSON_SUBTYPE_BINARY,
+                     value.Data(), value.Size());
+}
+
+void DocumentBuilder::WriteValue(const Value& value) {
+  const auto key = GetKey();
+  impl::BsonBuilder builder;
+  builder.Append(key, value);
+  bson_concat(GetParent(), builder.Get());
+}
+
+Document DocumentBuilder::Extract() {
+  auto& buffer = *buffer_;
+  if (!buffer.frames.empty()) {
+    throw BsonException("Attempt to extract a document with an unended " +
+                        std::string{buffer.frames.back().is_array
+                                        ? "array"
+                                        : "subdocument"});
+  }
+  if (buffer.has_key) {
+    throw BsonException("A value is expected after the key '" + buffer.key +
+                        '\'');
+  }
+
+  buffer.max_size = std::max<std::size_t>(buffer.max_size, buffer.bson.len);
+  impl::MutableBson document(bson_get_data(&buffer.bson), buffer.bson.len);
+  bson_reinit(&buffer.bson);
+  return Document(document.Extract());
+}
+
+std::unique_ptr<DocumentBuilder::Buffer>&
+DocumentBuilder::GetCachedBuffer() noexcept {
+  thread_local std::unique_ptr<Buffer> cached_buffer;
+  return cached_buffer;
+}
+
+bson_t* DocumentBuilder::GetParent() {
+  auto& buffer = *buffer_;
+  return buffer.frames.empty() ? &buffer.bson : &buffer.frames.back().bson;
+}
+
+std::string_view DocumentBuilder::GetKey() {
+  auto& buffer = *buffer_;
+  if (!buffer.frames.empty() && buffer.frames.back().is_array) {
+    auto& indexer = buffer.frames.back().indexer;
+    const auto key = indexer.GetKey();
+    indexer.Advance();
+    return key;
+  }
+
+  if (!buffer.has_key) {
+    throw BsonException("A key is expected before the value of a field");
+  }
+  buffer.has_key = false;
+  return buffer.key;
+}
+
+void DocumentBuilder::StartSubdocument(bool is_array) {
+  const auto key = GetKey();
+  auto* parent = GetParent();
+
+  auto& frame = buffer_->frames.emplace_back();
+  frame.is_array = is_array;
+  if (is_array) {
+    bson_append_array_begin(parent, key.data(), key.size(), &frame.bson);
+  } else {
+    bson_append_document_begin(parent, key.data(), key.size(), &frame.bson);
+  }
+}
+
+void DocumentBuilder::EndSubdocument() noexcept {
+  auto& frames = buffer_->frames;
+  UASSERT(!frames.empty());
+  auto& frame = frames.back();
+  auto* parent = frames.size() > 1 ? &frames[frames.size() - 2].bson
+                                   : &buffer_->bson;
+  if (frame.is_array) {
+    bson_append_array_end(parent, &frame.bson);
+  } else {
+    bson_append_document_end(parent, &frame.bson);
+  }
+  bson_destroy(&frame.bson);
+  frames.pop_back();
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/document_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kTagsCount = 8;
+
+}  // namespace
+
+void BsonBuildValueBuilder(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    formats::bson::ValueBuilder builder;
+    builder["_id"] = formats::bson::Oid{};
+    builder["name"] = "some name";
+    builder["count"] = 42;
+    builder["price"] = 9.99;
+    for (int i = 0; i < kTagsCount; ++i) builder["tags"].PushBack(i);
+    const formats::bson::Document doc = builder.ExtractValue();
+    benchmark::DoNotOptimize(doc.GetBson());
+  }
+}
+BENCHMARK(BsonBuildValueBuilder);
+
+void BsonBuildMakeDoc(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto doc = formats::bson::MakeDoc(
+        "_id", formats::bson::Oid{}, "name", "some name", "count", 42, "price",
+        9.99, "tags", formats::bson::MakeArray(0, 1, 2, 3, 4, 5, 6, 7));
+    benchmark::DoNotOptimize(doc.GetBson());
+  }
+}
+BENCHMARK(BsonBuildMakeDoc);
+
+void BsonBuildDocumentBuilder(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    formats::bson::DocumentBuilder builder;
+    builder.Key("_id");
+    builder.WriteOid(formats::bson::Oid{});
+    builder.Key("name");
+    builder.WriteString("some name");
+    builder.Key("count");
+    builder.WriteInt32(42);
+    builder.Key("price");
+    builder.WriteDouble(9.99);
+    {
+      builder.Key("tags");
+      formats::bson::DocumentBuilder::ArrayGuard guard(builder);
+      for (int i = 0; i < kTagsCount; ++i) builder.WriteInt32(i);
+    }
+    benchmark::DoNotOptimize(builder.Extract().GetBson());
+  }
+}
+BENCHMARK(BsonBuildDocumentBuilder);
+
+USERVER_NAMESPACE_END
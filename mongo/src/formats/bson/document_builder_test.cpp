@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/document_builder.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fb = formats::bson;
+
+TEST(BsonDocumentBuilder, Empty) {
+  fb::DocumentBuilder builder;
+  const auto doc = builder.Extract();
+  EXPECT_TRUE(doc.IsDocument());
+  EXPECT_TRUE(doc.IsEmpty());
+}
+
+TEST(BsonDocumentBuilder, SameAsMakeDoc) {
+  const fb::Oid oid;
+
+  fb::DocumentBuilder builder;
+  builder.Key("_id");
+  builder.WriteOid(oid);
+  builder.Key("null");
+  builder.WriteNull();
+  builder.Key("int");
+  builder.WriteInt32(42);
+  builder.Key("str");
+  builder.WriteString("hot");
+  {
+    builder.Key("sub");
+    fb::DocumentBuilder::ObjectGuard guard(builder);
+    builder.Key("flag");
+    builder.WriteBool(true);
+  }
+  {
+    builder.Key("arr");
+    fb::DocumentBuilder::ArrayGuard guard(builder);
+    builder.WriteInt64(1);
+    builder.WriteDouble(2.5);
+    fb::DocumentBuilder::ObjectGuard element_guard(builder);
+    builder.Key("value");
+    builder.WriteValue(fb::MakeDoc("inner", 3));
+  }
+
+  EXPECT_EQ(builder.Extract(),
+            fb::MakeDoc("_id", oid, "null", nullptr, "int", 42, "str", "hot",
+                        "sub", fb::MakeDoc("flag", true), "arr",
+                        fb::MakeArray(int64_t{1}, 2.5,
+                                      fb::MakeDoc("value", fb::MakeDoc(
+                                                               "inner", 3)))));
+}
+
+TEST(BsonDocumentBuilder, Reuse) {
+  fb::DocumentBuilder builder;
+  builder.Key("first");
+  builder.WriteInt32(1);
+  const auto first = builder.Extract();
+
+  builder.Key("second");
+  builder.WriteInt32(2);
+  const auto second = builder.Extract();
+
+  EXPECT_EQ(first, fb::MakeDoc("first", 1));
+  EXPECT_EQ(second, fb::MakeDoc("second", 2));
+
+  // the buffer is taken over by the next builder of the thread
+  fb::DocumentBuilder next_builder;
+  next_builder.Key("third");
+  next_builder.WriteInt32(3);
+  EXPECT_EQ(next_builder.Extract(), fb::MakeDoc("third", 3));
+}
+
+TEST(BsonDocumentBuilder, Errors) {
+  fb::DocumentBuilder builder;
+  UEXPECT_THROW(builder.WriteInt32(1), fb::BsonException);
+
+  builder.Key("key");
+  UEXPECT_THROW(builder.Key("other"), fb::BsonException);
+  UEXPECT_THROW(builder.Extract(), fb::BsonException);
+  UEXPECT_THROW(builder.WriteString("\xff"), fb::BsonException);
+
+  {
+    fb::DocumentBuilder::ArrayGuard guard(builder);
+    UEXPECT_THROW(builder.Key("key"), fb::BsonException);
+    UEXPECT_THROW(builder.Extract(), fb::BsonException);
+  }
+  EXPECT_EQ(builder.Extract(), fb::MakeDoc("key", fb::MakeArray()));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,338 @@
+#include <userver/formats/bson/value_reader.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <fmt/format.h>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/common/path.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+namespace {
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1}
+                                     << std::numeric_limits<double>::digits};
+
+void InitIterFromData(bson_iter_t& iter, const uint8_t* data, uint32_t length,
+                      const ValueReader& reader) {
+  if (!bson_iter_init_from_data(&iter, data, length)) {
+    throw ParseException(fmt::format("malformed BSON at {}", reader.GetPath()));
+  }
+}
+
+std::string_view GetKey(const bson_iter_t& iter) {
+  return {bson_iter_key(&iter), bson_iter_key_len(&iter)};
+}
+
+}  // namespace
+
+ValueReader::ValueReader(const Document& document)
+    : ValueReader(document.GetBson().get()) {}
+
+ValueReader::ValueReader(const bson_t* native) : root_(native) {}
+
+ValueReader::ValueReader(const ValueReader& parent, const bson_iter_t& iter)
+    : iter_(iter), path_(parent.MakeChildPath(GetKey(iter))) {}
+
+ValueReader::ValueReader(const ValueReader& parent,
+                         std::string_view missing_key)
+    : is_missing_(true), path_(parent.MakeChildPath(missing_key)) {}
+
+ValueReader ValueReader::operator[](std::string_view name) const {
+  if (IsMissing() || IsNull()) return ValueReader(*this, name);
+  CheckDocumentOrNull();
+
+  bson_iter_t child;
+  InitChildIter(child);
+  while (bson_iter_next(&child)) {
+    if (GetKey(child) == name) return ValueReader(*this, child);
+  }
+  return ValueReader(*this, name);
+}
+
+ValueReader::Iterator ValueReader::begin() const {
+  CheckNotMissing();
+  if (IsNull()) return end();
+  if (!IsDocument() && !IsArray()) {
+    throw TypeMismatchException(GetType(), BSON_TYPE_DOCUMENT, GetPath());
+  }
+  return Iterator(*this);
+}
+
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+ValueReader::Iterator ValueReader::end() const { return Iterator(); }
+
+std::string ValueReader::GetPath() const {
+  if (root_) return formats::common::kPathRoot;
+  return path_;
+}
+
+bool ValueReader::IsMissing() const { return is_missing_; }
+
+bool ValueReader::IsArray() const { return GetType() == BSON_TYPE_ARRAY; }
+bool ValueReader::IsDocument() const {
+  return GetType() == BSON_TYPE_DOCUMENT;
+}
+bool ValueReader::IsNull() const { return GetType() == BSON_TYPE_NULL; }
+bool ValueReader::IsBool() const { return GetType() == BSON_TYPE_BOOL; }
+bool ValueReader::IsInt32() const { return GetType() == BSON_TYPE_INT32; }
+bool ValueReader::IsInt64() const { return GetType() == BSON_TYPE_INT64; }
+bool ValueReader::IsDouble() const { return GetType() == BSON_TYPE_DOUBLE; }
+bool ValueReader::IsString() const { return GetType() == BSON_TYPE_UTF8; }
+bool ValueReader::IsDateTime() const {
+  return GetType() == BSON_TYPE_DATE_TIME;
+}
+bool ValueReader::IsOid() const { return GetType() == BSON_TYPE_OID; }
+bool ValueReader::IsBinary() const { return GetType() == BSON_TYPE_BINARY; }
+bool ValueReader::IsDecimal128() const {
+  return GetType() == BSON_TYPE_DECIMAL128;
+}
+bool ValueReader::IsTimestamp() const {
+  return GetType() == BSON_TYPE_TIMESTAMP;
+}
+
+void ValueReader::CheckNotMissing() const {
+  if (IsMissing()) throw MemberMissingException(GetPath());
+}
+
+void ValueReader::CheckArrayOrNull() const {
+  CheckNotMissing();
+  if (!IsArray() && !IsNull()) {
+    throw TypeMismatchException(GetType(), BSON_TYPE_ARRAY, GetPath());
+  }
+}
+
+void ValueReader::CheckDocumentOrNull() const {
+  CheckNotMissing();
+  if (!IsDocument() && !IsNull()) {
+    throw TypeMismatchException(GetType(), BSON_TYPE_DOCUMENT, GetPath());
+  }
+}
+
+bson_type_t ValueReader::GetType() const {
+  if (is_missing_) return BSON_TYPE_EOD;
+  if (root_) return BSON_TYPE_DOCUMENT;
+  return bson_iter_type(&iter_);
+}
+
+const bson_iter_t& ValueReader::GetIter() const {
+  CheckNotMissing();
+  return iter_;
+}
+
+bool ValueReader::InitChildIter(bson_iter_t& child) const {
+  if (root_) {
+    InitIterFromData(child, bson_get_data(root_), root_->len, *this);
+    return true;
+  }
+  if (!IsDocument() && !IsArray()) return false;
+
+  const uint8_t* data = nullptr;
+  uint32_t length = 0;
+  if (IsDocument()) {
+    bson_iter_document(&iter_, &length, &data);
+  } else {
+    bson_iter_array(&iter_, &length, &data);
+  }
+  InitIterFromData(child, data, length, *this);
+  return true;
+}
+
+std::string ValueReader::MakeChildPath(std::string_view key) const {
+  std::string path = path_;
+  if (IsArray()) {
+    path += '[';
+    path += key;
+    path += ']';
+  } else {
+    formats::common::AppendPath(path, key);
+  }
+  return path;
+}
+
+ValueReader::Iterator::Iterator(const ValueReader& iterable)
+    : iterable_(&iterable) {
+  iterable_->InitChildIter(iter_);
+  if (!bson_iter_next(&iter_)) iterable_ = nullptr;
+}
+
+ValueReader ValueReader::Iterator::operator*() const {
+  return ValueReader(*iterable_, iter_);
+}
+
+ValueReader::Iterator& ValueReader::Iterator::operator++() {
+  ++index_;
+  if (!bson_iter_next(&iter_)) iterable_ = nullptr;
+  return *this;
+}
+
+bool ValueReader::Iterator::operator==(const Iterator& rhs) const {
+  if (!iterable_ || !rhs.iterable_) return iterable_ == rhs.iterable_;
+  return bson_iter_key(&iter_) == bson_iter_key(&rhs.iter_);
+}
+
+bool ValueReader::Iterator::operator!=(const Iterator& rhs) const {
+  return !(*this == rhs);
+}
+
+std::string_view ValueReader::Iterator::GetName() const {
+  if (!iterable_->IsDocument()) {
+    throw TypeMismatchException(iterable_->GetType(), BSON_TYPE_DOCUMENT,
+                                iterable_->GetPath());
+  }
+  return GetKey(iter_);
+}
+
+uint32_t ValueReader::Iterator::GetIndex() const {
+  if (!iterable_->IsArray()) {
+    throw TypeMismatchException(iterable_->GetType(), BSON_TYPE_ARRAY,
+                                iterable_->GetPath());
+  }
+  return index_;
+}
+
+template <>
+bool ValueReader::As<bool>() const {
+  if (IsBool()) return bson_iter_bool(&GetIter());
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_BOOL, GetPath());
+}
+
+template <>
+int64_t ValueReader::As<int64_t>() const {
+  if (IsInt32()) return bson_iter_int32(&GetIter());
+  if (IsInt64()) return bson_iter_int64(&GetIter());
+  if (IsDouble()) {
+    auto as_double = bson_iter_double(&GetIter());
+    double int_part = 0.0;
+    auto frac_part = std::modf(as_double, &int_part);
+    if (frac_part || std::abs(as_double) >= kMaxIntDouble) {
+      throw ConversionException("Conversion of ")
+          << GetPath() << '=' << as_double
+          << " to integer causes precision change";
+    }
+    return static_cast<int64_t>(as_double);
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_INT64, GetPath());
+}
+
+template <>
+uint64_t ValueReader::As<uint64_t>() const {
+  const auto as_int = As<int64_t>();
+  if (as_int < 0) {
+    throw ConversionException("Cannot convert to unsigned value from negative ")
+        << GetPath() << '=' << as_int;
+  }
+  return static_cast<uint64_t>(as_int);
+}
+
+template <>
+double ValueReader::As<double>() const {
+  if (IsInt32()) return bson_iter_int32(&GetIter());
+  if (IsInt64()) {
+    auto as_int = bson_iter_int64(&GetIter());
+    if (as_int == std::numeric_limits<int64_t>::min() ||
+        std::abs(as_int) > kMaxIntDouble) {
+      throw ConversionException("Conversion of ")
+          << GetPath() << '=' << as_int << " to double causes precision loss";
+    }
+    return static_cast<double>(as_int);
+  }
+  if (IsDouble()) return bson_iter_double(&GetIter());
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_DOUBLE, GetPath());
+}
+
+template <>
+std::string_view ValueReader::As<std::string_view>() const {
+  if (IsString()) {
+    uint32_t length = 0;
+    const char* str = bson_iter_utf8(&GetIter(), &length);
+    return {str, length};
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_UTF8, GetPath());
+}
+
+template <>
+std::string ValueReader::As<std::string>() const {
+  return std::string{As<std::string_view>()};
+}
+
+template <>
+std::chrono::system_clock::time_point
+ValueReader::As<std::chrono::system_clock::time_point>() const {
+  if (IsDateTime()) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::milliseconds(bson_iter_date_time(&GetIter())));
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_DATE_TIME, GetPath());
+}
+
+template <>
+Oid ValueReader::As<Oid>() const {
+  if (IsOid()) return *bson_iter_oid(&GetIter());
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_OID, GetPath());
+}
+
+template <>
+Binary ValueReader::As<Binary>() const {
+  if (IsBinary()) {
+    uint32_t length = 0;
+    const uint8_t* data = nullptr;
+    bson_iter_binary(&GetIter(), nullptr, &length, &data);
+    return Binary(std::string(reinterpret_cast<const char*>(data), length));
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_BINARY, GetPath());
+}
+
+template <>
+Decimal128 ValueReader::As<Decimal128>() const {
+  if (IsDecimal128()) {
+    bson_decimal128_t value;
+    bson_iter_decimal128(&GetIter(), &value);
+    return value;
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_DECIMAL128, GetPath());
+}
+
+template <>
+Timestamp ValueReader::As<Timestamp>() const {
+  if (IsTimestamp()) {
+    uint32_t timestamp = 0;
+    uint32_t increment = 0;
+    bson_iter_timestamp(&GetIter(), &timestamp, &increment);
+    return {timestamp, increment};
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_TIMESTAMP, GetPath());
+}
+
+template <>
+Document ValueReader::As<Document>() const {
+  if (root_) {
+    return Document(impl::MutableBson::CopyNative(root_).Extract());
+  }
+  if (IsDocument()) {
+    const uint8_t* data = nullptr;
+    uint32_t length = 0;
+    bson_iter_document(&GetIter(), &length, &data);
+    return Document(impl::MutableBson(data, length).Extract());
+  }
+  CheckNotMissing();
+  throw TypeMismatchException(GetType(), BSON_TYPE_DOCUMENT, GetPath());
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/value_reader.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using formats::parse::To;
+
+constexpr std::size_t kBatchSize = 1000;
+
+// A typical document of a cache collection
+formats::bson::Document MakeCacheDocument(std::size_t i) {
+  const auto id = std::to_string(i);
+  const auto zones = formats::bson::MakeArray(
+      formats::bson::MakeDoc("zone", "moscow", "weight", 1),
+      formats::bson::MakeDoc("zone", "spb", "weight", 2));
+  const auto value = formats::bson::MakeDoc(
+      "name", "Name of the item " + id, "description", "Some description text",
+      "price", 1234.56, "tags", formats::bson::MakeArray("a", "b", "c"),
+      "limits", formats::bson::MakeArray(1, 10, 100, 1000), "zones", zones);
+  return formats::bson::MakeDoc(
+      "_id", formats::bson::Oid(), "key", "key_" + id, "updated",
+      std::chrono::system_clock::now(), "revision", static_cast<int64_t>(i),
+      "enabled", i % 2 == 0, "value", value);
+}
+
+const std::vector<formats::bson::Document> kBatch = [] {
+  std::vector<formats::bson::Document> batch;
+  batch.reserve(kBatchSize);
+  for (std::size_t i = 0; i < kBatchSize; ++i) {
+    batch.push_back(MakeCacheDocument(i));
+  }
+  return batch;
+}();
+
+struct Zone {
+  std::string zone;
+  int weight{0};
+};
+
+struct Item {
+  std::string name;
+  std::string description;
+  double price{0};
+  std::vector<std::string> tags;
+  std::vector<int> limits;
+  std::vector<Zone> zones;
+};
+
+struct CachedObject {
+  std::string key;
+  int64_t revision{0};
+  bool enabled{false};
+  Item value;
+};
+
+template <typename Value>
+Zone Parse(const Value& value, To<Zone>) {
+  return {
+      value["zone"].template As<std::string>(),
+      value["weight"].template As<int>(),
+  };
+}
+
+template <typename Value>
+Item Parse(const Value& value, To<Item>) {
+  return {
+      value["name"].template As<std::string>(),
+      value["description"].template As<std::string>({}),
+      value["price"].template As<double>(),
+      value["tags"].template As<std::vector<std::string>>(),
+      value["limits"].template As<std::vector<int>>(),
+      value["zones"].template As<std::vector<Zone>>(),
+  };
+}
+
+template <typename Value>
+CachedObject Parse(const Value& value, To<CachedObject>) {
+  return {
+      value["key"].template As<std::string>(),
+      value["revision"].template As<int64_t>(),
+      value["enabled"].template As<bool>(false),
+      value["value"].template As<Item>(),
+  };
+}
+
+}  // namespace
+
+// Parsing as in MongoCache: a copy of the received document is parsed
+// as formats::bson::Value
+void bson_cache_parse_value(benchmark::State& state) {
+  for (auto _ : state) {
+    for (const auto& doc : kBatch) {
+      const auto copy = formats::bson::Document(
+          formats::bson::impl::MutableBson::CopyNative(doc.GetBson().get())
+              .Extract());
+      auto res = copy.As<CachedObject>();
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(bson_cache_parse_value);
+
+// Parsing straight from the received document
+void bson_cache_parse_reader(benchmark::State& state) {
+  for (auto _ : state) {
+    for (const auto& doc : kBatch) {
+      auto res = formats::bson::ValueReader(doc).As<CachedObject>();
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(bson_cache_parse_reader);
+
+USERVER_NAMESPACE_END
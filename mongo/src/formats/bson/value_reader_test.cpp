@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/value_reader.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fb = formats::bson;
+
+namespace {
+
+const auto kDoc =
+    fb::MakeDoc("arr", fb::MakeArray(1, 2, 3),                              //
+                "doc", fb::MakeDoc("b", true, "i", 0, "d", -1.25, "s", "str"),
+                "docs", fb::MakeArray(fb::MakeDoc("x", 1), fb::MakeDoc("x", 2)),
+                "null", nullptr,                                            //
+                "i64", int64_t{1} << 40,                                    //
+                "double", 2.0);
+
+}  // namespace
+
+/// [Sample formats::bson::ValueReader usage]
+namespace sample {
+
+struct Item {
+  std::string name;
+  std::vector<int> values;
+  std::optional<double> weight;
+};
+
+// Works for both formats::bson::Value and formats::bson::ValueReader
+template <typename Value>
+Item Parse(const Value& value, formats::parse::To<Item>) {
+  return {
+      value["name"].template As<std::string>(),
+      value["values"].template As<std::vector<int>>(),
+      value["weight"].template As<std::optional<double>>(),
+  };
+}
+
+}  // namespace sample
+
+TEST(BsonValueReader, Sample) {
+  const auto doc = fb::MakeDoc("name", "item", "values", fb::MakeArray(1, 2));
+  const fb::ValueReader reader(doc);
+
+  const auto item = reader.As<sample::Item>();
+  EXPECT_EQ("item", item.name);
+  EXPECT_EQ((std::vector<int>{1, 2}), item.values);
+  EXPECT_FALSE(item.weight);
+}
+/// [Sample formats::bson::ValueReader usage]
+
+TEST(BsonValueReader, Types) {
+  const fb::ValueReader reader(kDoc);
+
+  EXPECT_TRUE(reader.IsDocument());
+  EXPECT_TRUE(reader["arr"].IsArray());
+  EXPECT_TRUE(reader["doc"].IsDocument());
+  EXPECT_TRUE(reader["null"].IsNull());
+  EXPECT_TRUE(reader["i64"].IsInt64());
+  EXPECT_TRUE(reader["double"].IsDouble());
+  EXPECT_TRUE(reader["doc"]["b"].IsBool());
+  EXPECT_TRUE(reader["doc"]["i"].IsInt32());
+  EXPECT_TRUE(reader["doc"]["s"].IsString());
+  EXPECT_TRUE(reader["missing"].IsMissing());
+  EXPECT_TRUE(reader["doc"]["missing"].IsMissing());
+  EXPECT_TRUE(reader["missing"]["missing"].IsMissing());
+}
+
+TEST(BsonValueReader, Scalars) {
+  const fb::ValueReader reader(kDoc);
+  const auto doc = reader["doc"];
+
+  EXPECT_TRUE(doc["b"].As<bool>());
+  EXPECT_EQ(0, doc["i"].As<int>());
+  EXPECT_DOUBLE_EQ(-1.25, doc["d"].As<double>());
+  EXPECT_EQ("str", doc["s"].As<std::string>());
+  EXPECT_EQ("str", doc["s"].As<std::string_view>());
+  EXPECT_EQ(int64_t{1} << 40, reader["i64"].As<int64_t>());
+  EXPECT_EQ(2, reader["double"].As<int>());
+  EXPECT_EQ(42, reader["missing"].As<int>(42));
+  EXPECT_EQ(42, reader["null"].As<int>(42));
+
+  UEXPECT_THROW(doc["d"].As<int>(), fb::ConversionException);
+  UEXPECT_THROW(reader["i64"].As<int32_t>(), fb::ConversionException);
+  UEXPECT_THROW(doc["s"].As<int>(), fb::TypeMismatchException);
+  UEXPECT_THROW(reader["missing"].As<int>(), fb::MemberMissingException);
+  UEXPECT_THROW(reader["arr"]["x"], fb::TypeMismatchException);
+}
+
+TEST(BsonValueReader, Containers) {
+  const fb::ValueReader reader(kDoc);
+
+  EXPECT_EQ((std::vector<int>{1, 2, 3}), reader["arr"].As<std::vector<int>>());
+  EXPECT_TRUE(reader["null"].As<std::vector<int>>().empty());
+  EXPECT_FALSE(reader["missing"].As<std::optional<int>>());
+
+  const auto map_doc = fb::MakeDoc("a", 1, "b", nullptr);
+  const auto map = fb::ValueReader(map_doc)
+                       .As<std::map<std::string, std::optional<int>>>();
+  EXPECT_EQ((std::map<std::string, std::optional<int>>{{"a", 1},
+                                                         {"b", std::nullopt}}),
+            map);
+
+  std::vector<int> xs;
+  for (const auto& item : reader["docs"]) xs.push_back(item["x"].As<int>());
+  EXPECT_EQ((std::vector<int>{1, 2}), xs);
+
+  int i = 0;
+  const auto arr = reader["arr"];
+  for (auto it = arr.begin(); it != arr.end(); ++it, ++i) {
+    EXPECT_EQ(i, static_cast<int>(it.GetIndex()));
+    UEXPECT_THROW(it.GetName(), fb::TypeMismatchException);
+  }
+  EXPECT_EQ(3, i);
+
+  UEXPECT_THROW(reader["missing"].begin(), fb::MemberMissingException);
+  UEXPECT_THROW(reader["i64"].begin(), fb::TypeMismatchException);
+}
+
+TEST(BsonValueReader, Path) {
+  const fb::ValueReader reader(kDoc);
+
+  EXPECT_EQ("/", reader.GetPath());
+  EXPECT_EQ("doc.s", reader["doc"]["s"].GetPath());
+  EXPECT_EQ("doc.missing", reader["doc"]["missing"].GetPath());
+
+  std::vector<std::string> paths;
+  const auto docs = reader["docs"];
+  for (const auto& item : docs) paths.push_back(item["x"].GetPath());
+  EXPECT_EQ((std::vector<std::string>{"docs[0].x", "docs[1].x"}), paths);
+}
+
+TEST(BsonValueReader, StoredChainedReader) {
+  const fb::ValueReader reader(kDoc);
+
+  // The intermediate readers are gone by the time the paths are built
+  const auto str = reader["doc"]["s"];
+  const auto missing = reader["doc"]["missing"]["deeper"];
+  const auto element = *reader["docs"].begin();
+
+  EXPECT_EQ("doc.s", str.GetPath());
+  UEXPECT_THROW_MSG(str.As<int>(), fb::TypeMismatchException, "doc.s");
+  UEXPECT_THROW_MSG(missing.As<int>(), fb::MemberMissingException,
+                    "doc.missing.deeper");
+  UEXPECT_THROW_MSG(element["x"].As<std::string>(),
+                    fb::TypeMismatchException, "docs[0].x");
+}
+
+TEST(BsonValueReader, Document) {
+  const fb::ValueReader reader(kDoc);
+
+  EXPECT_EQ(kDoc, reader.As<fb::Document>());
+  EXPECT_EQ(kDoc["doc"], reader["doc"].As<fb::Document>());
+  UEXPECT_THROW(reader["arr"].As<fb::Document>(), fb::TypeMismatchException);
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <mongoc/mongoc.h>
 
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/mongo_error.hpp>
 
 #include <storages/mongo/bulk_ops_impl.hpp>
@@ -13,15 +14,37 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::mongo::operations {
 namespace {
 
-auto EnsureBulk(impl::cdriver::BulkOperationPtr& bulk_ptr, Bulk::Mode mode) {
-  if (!bulk_ptr) {
+size_t GetBsonSize(const formats::bson::Document& document) {
+  return document.GetBson()->len;
+}
+
+}  // namespace
+
+mongoc_bulk_operation_t* Bulk::Impl::EnsureBulk(size_t bytes) {
+  if (bulk && max_chunk_size &&
+      (bulk_size >= max_chunk_size ||
+       (bulk_size && bulk_bytes + bytes >
+                         options::BulkParallelism::kMaxChunkBytes))) {
+    full_chunks.push_back({std::move(bulk), bulk_offset});
+    bulk_offset += bulk_size;
+    bulk_size = 0;
+    bulk_bytes = 0;
+  }
+
+  if (!bulk) {
     const bool is_ordered = (mode == Bulk::Mode::kOrdered);
-    bulk_ptr.reset(mongoc_bulk_operation_new(is_ordered));
+    bulk.reset(mongoc_bulk_operation_new(is_ordered));
+    if (write_concern) {
+      mongoc_bulk_operation_set_write_concern(bulk.get(), write_concern.get());
+    }
   }
-  return bulk_ptr.get();
+  return bulk.get();
 }
 
-}  // namespace
+void Bulk::Impl::AccountAppended(size_t bytes) {
+  ++bulk_size;
+  bulk_bytes += bytes;
+}
 
 Bulk::Bulk(Mode mode) : impl_(mode) {}
 Bulk::~Bulk() = default;
@@ -32,89 +55,122 @@ Bulk& Bulk::operator=(Bulk&&) noexcept = default;
 bool Bulk::IsEmpty() const { return !impl_->bulk; }
 
 void Bulk::SetOption(options::WriteConcern::Level level) {
-  mongoc_bulk_operation_set_write_concern(
-      EnsureBulk(impl_->bulk, impl_->mode),
-      impl::MakeCDriverWriteConcern(level).get());
+  impl_->write_concern = impl::MakeCDriverWriteConcern(level);
+  for (auto& chunk : impl_->full_chunks) {
+    mongoc_bulk_operation_set_write_concern(chunk.bulk.get(),
+                                            impl_->write_concern.get());
+  }
+  mongoc_bulk_operation_set_write_concern(impl_->EnsureBulk(),
+                                          impl_->write_concern.get());
 }
 
 void Bulk::SetOption(const options::WriteConcern& write_concern) {
-  mongoc_bulk_operation_set_write_concern(
-      EnsureBulk(impl_->bulk, impl_->mode),
-      impl::MakeCDriverWriteConcern(write_concern).get());
+  impl_->write_concern = impl::MakeCDriverWriteConcern(write_concern);
+  for (auto& chunk : impl_->full_chunks) {
+    mongoc_bulk_operation_set_write_concern(chunk.bulk.get(),
+                                            impl_->write_concern.get());
+  }
+  mongoc_bulk_operation_set_write_concern(impl_->EnsureBulk(),
+                                          impl_->write_concern.get());
 }
 
 void Bulk::SetOption(options::SuppressServerExceptions) {
   impl_->should_throw = false;
 }
 
+void Bulk::SetOption(const options::BulkParallelism& parallelism) {
+  if (impl_->mode != Mode::kUnordered) {
+    throw InvalidQueryArgumentException(
+        "Bulk parallelism is only allowed for unordered bulks");
+  }
+  if (impl_->bulk_size || !impl_->full_chunks.empty()) {
+    throw InvalidQueryArgumentException(
+        "Bulk parallelism must be set before appending sub-operations");
+  }
+  impl_->max_in_flight_chunks = parallelism.MaxInFlightChunks();
+  impl_->max_chunk_size = parallelism.MaxChunkSize();
+}
+
 void Bulk::Append(const bulk_ops::InsertOne& insert_subop) {
   MongoError error;
+  const auto bytes = GetBsonSize(insert_subop.impl_->document);
   const bson_t* native_bson_ptr = insert_subop.impl_->document.GetBson().get();
-  if (!mongoc_bulk_operation_insert_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_bson_ptr, nullptr,
-          error.GetNative())) {
+  if (!mongoc_bulk_operation_insert_with_opts(impl_->EnsureBulk(bytes),
+                                              native_bson_ptr, nullptr,
+                                              error.GetNative())) {
     error.Throw("Error appending insert to bulk");
   }
+  impl_->AccountAppended(bytes);
 }
 
 void Bulk::Append(const bulk_ops::ReplaceOne& replace_subop) {
   MongoError error;
+  const auto bytes = GetBsonSize(replace_subop.impl_->selector) +
+                     GetBsonSize(replace_subop.impl_->replacement);
   const bson_t* native_selector_bson_ptr =
       replace_subop.impl_->selector.GetBson().get();
   const bson_t* native_replacement_bson_ptr =
       replace_subop.impl_->replacement.GetBson().get();
   if (!mongoc_bulk_operation_replace_one_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
+          impl_->EnsureBulk(bytes), native_selector_bson_ptr,
           native_replacement_bson_ptr,
           impl::GetNative(replace_subop.impl_->options), error.GetNative())) {
     error.Throw("Error appending replace to bulk");
   }
+  impl_->AccountAppended(bytes);
 }
 
 void Bulk::Append(const bulk_ops::Update& update_subop) {
   MongoError error;
+  const auto bytes = GetBsonSize(update_subop.impl_->selector) +
+                     GetBsonSize(update_subop.impl_->update);
   const bson_t* native_selector_bson_ptr =
       update_subop.impl_->selector.GetBson().get();
   const bson_t* native_update_bson_ptr =
       update_subop.impl_->update.GetBson().get();
+  auto* native_bulk = impl_->EnsureBulk(bytes);
   bool has_succeeded = false;
   switch (update_subop.impl_->mode) {
     case bulk_ops::Update::Mode::kSingle:
       has_succeeded = mongoc_bulk_operation_update_one_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
+          native_bulk, native_selector_bson_ptr,
           native_update_bson_ptr, impl::GetNative(update_subop.impl_->options),
           error.GetNative());
       break;
 
     case bulk_ops::Update::Mode::kMulti:
       has_succeeded = mongoc_bulk_operation_update_many_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
+          native_bulk, native_selector_bson_ptr,
           native_update_bson_ptr, impl::GetNative(update_subop.impl_->options),
           error.GetNative());
       break;
   }
   if (!has_succeeded) error.Throw("Error appending update to bulk");
+  impl_->AccountAppended(bytes);
 }
 
 void Bulk::Append(const bulk_ops::Delete& delete_subop) {
   MongoError error;
+  const auto bytes = GetBsonSize(delete_subop.impl_->selector);
   const bson_t* native_selector_bson_ptr =
       delete_subop.impl_->selector.GetBson().get();
+  auto* native_bulk = impl_->EnsureBulk(bytes);
   bool has_succeeded = false;
   switch (delete_subop.impl_->mode) {
     case bulk_ops::Delete::Mode::kSingle:
       has_succeeded = mongoc_bulk_operation_remove_one_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
+          native_bulk, native_selector_bson_ptr,
           nullptr, error.GetNative());
       break;
 
     case bulk_ops::Delete::Mode::kMulti:
       has_succeeded = mongoc_bulk_operation_remove_many_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
+          native_bulk, native_selector_bson_ptr,
           nullptr, error.GetNative());
       break;
   }
   if (!has_succeeded) error.Throw("Error appending delete to bulk");
+  impl_->AccountAppended(bytes);
 }
 
 }  // namespace storages::mongo::operations
@@ -277,4 +277,39 @@ UTEST_F(Bulk, Mixed) {
   EXPECT_TRUE(upserted_ids[5].IsOid());
 }
 
+UTEST_F(Bulk, Parallel) {
+  auto coll = GetDefaultPool().GetCollection("parallel");
+
+  UEXPECT_THROW(coll.MakeOrderedBulk(mongo::options::BulkParallelism{4}),
+                mongo::InvalidQueryArgumentException);
+  UEXPECT_THROW(mongo::options::BulkParallelism{0},
+                mongo::InvalidQueryArgumentException);
+
+  auto bulk =
+      coll.MakeUnorderedBulk(mongo::options::BulkParallelism{4, 10},
+                             mongo::options::SuppressServerExceptions{});
+  for (int i = 0; i < 95; ++i) {
+    bulk.InsertOne(bson::MakeDoc("_id", i % 90));
+  }
+  bulk.UpdateOne(bson::MakeDoc("_id", 100),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 1)),
+                 mongo::options::Upsert{});
+  auto result = coll.Execute(std::move(bulk));
+
+  EXPECT_EQ(90, result.InsertedCount());
+  EXPECT_EQ(1, result.UpsertedCount());
+  EXPECT_TRUE(result.WriteConcernErrors().empty());
+
+  auto upserted_ids = result.UpsertedIds();
+  ASSERT_EQ(1, upserted_ids.size());
+  EXPECT_EQ(100, upserted_ids[95].As<int>());
+
+  auto errors = result.ServerErrors();
+  ASSERT_EQ(5, errors.size());
+  for (int i = 90; i < 95; ++i) {
+    EXPECT_EQ(11000, errors[i].Code());
+  }
+  EXPECT_EQ(91, coll.Count({}));
+}
+
 USERVER_NAMESPACE_END
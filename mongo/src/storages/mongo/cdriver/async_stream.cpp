@@ -43,6 +43,9 @@ namespace {
 // chosen empirically as the best performance for size (16K-32K)
 constexpr size_t kBufferSize = 32 * 1024;
 
+// mongoc reads a message header and a body, one scatter read is enough
+constexpr size_t kMaxScatterIovs = 8;
+
 constexpr int kCompatibleMajorVersion = 1;
 constexpr int kMaxCompatibleMinorVersion = 21;  // Tested on Fedora, works
 
@@ -72,17 +75,23 @@ class AsyncStream : public mongoc_stream_t {
  public:
   static constexpr int kStreamType = 0x53755459;
 
-  static cdriver::StreamPtr Create(engine::io::Socket);
+  static cdriver::StreamPtr Create(engine::io::Socket,
+                                   stats::PoolConnectStatistics* stats);
 
   void SetCreated() { is_created_ = true; }
 
  private:
-  AsyncStream(engine::io::Socket) noexcept;
+  AsyncStream(engine::io::Socket, stats::PoolConnectStatistics*) noexcept;
 
   // mongoc_stream_buffered resizes itself indiscriminately
-  // NOTE: returns number of bytes stored to data, not buffered!
-  size_t BufferedRecv(void* data, size_t size, size_t min_bytes,
-                      engine::Deadline deadline);
+  // Receives directly into iov with the buffer as a tail for the excess data,
+  // advances iov past the received data.
+  // NOTE: returns number of bytes stored to iov, not buffered!
+  size_t ScatterRecv(mongoc_iovec_t* iov, size_t iovcnt, size_t min_bytes,
+                     engine::Deadline deadline);
+
+  // Copies pending buffered data to iov, returns number of bytes copied
+  size_t DrainBuffer(mongoc_iovec_t* iov, size_t iovcnt);
 
   // mongoc_stream_t interface
   static void Destroy(mongoc_stream_t*) noexcept;
@@ -102,6 +111,7 @@ class AsyncStream : public mongoc_stream_t {
 
   const uint64_t epoch_;
   engine::io::Socket socket_;
+  stats::PoolConnectStatistics* const stats_;
   AsyncStreamPoller::WatcherPtr read_watcher_;
   AsyncStreamPoller::WatcherPtr write_watcher_;
   bool is_timed_out_{false};
@@ -316,7 +326,7 @@ mongoc_stream_t* MakeAsyncStream(const mongoc_uri_t* uri,
       Connect(host, connect_timeout_ms, error, init_data->dns_resolver);
   if (!socket) return nullptr;
 
-  auto stream = AsyncStream::Create(std::move(socket));
+  auto stream = AsyncStream::Create(std::move(socket), init_data->stats);
 
   // from mongoc_client_default_stream_initiator
   // enable TLS if needed
@@ -349,8 +359,9 @@ mongoc_stream_t* MakeAsyncStream(const mongoc_uri_t* uri,
 }
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
-AsyncStream::AsyncStream(engine::io::Socket socket) noexcept
-    : epoch_(GetNextStreamEpoch()), socket_(std::move(socket)) {
+AsyncStream::AsyncStream(engine::io::Socket socket,
+                         stats::PoolConnectStatistics* stats) noexcept
+    : epoch_(GetNextStreamEpoch()), socket_(std::move(socket)), stats_(stats) {
   type = kStreamType;
   destroy = &Destroy;
   close = &Close;
@@ -366,49 +377,62 @@ AsyncStream::AsyncStream(engine::io::Socket socket) noexcept
   should_retry = &ShouldRetry;
 }
 
-size_t AsyncStream::BufferedRecv(void* data, size_t size, size_t min_bytes,
-                                 engine::Deadline deadline) {
-  size_t bytes_stored = 0;
-  size_t bytes_left = size;
-  char* pos = static_cast<char*>(data);
+size_t AsyncStream::DrainBuffer(mongoc_iovec_t* iov, size_t iovcnt) {
+  size_t bytes_copied = 0;
+  for (size_t i = 0; i < iovcnt && recv_buffer_bytes_used_; ++i) {
+    UASSERT(recv_buffer_pos_ < recv_buffer_bytes_used_);
+    const auto batch_size =
+        std::min(iov[i].iov_len, recv_buffer_bytes_used_ - recv_buffer_pos_);
+
+    std::memcpy(iov[i].iov_base, recv_buffer_.data() + recv_buffer_pos_,
+                batch_size);
+    iov[i].iov_base = static_cast<char*>(iov[i].iov_base) + batch_size;
+    iov[i].iov_len -= batch_size;
+    bytes_copied += batch_size;
+    recv_buffer_pos_ += batch_size;
+
+    if (recv_buffer_pos_ == recv_buffer_bytes_used_) {
+      recv_buffer_pos_ = 0;
+      recv_buffer_bytes_used_ = 0;
+    }
+  }
+  return bytes_copied;
+}
+
+size_t AsyncStream::ScatterRecv(mongoc_iovec_t* iov, size_t iovcnt,
+                                size_t min_bytes, engine::Deadline deadline) {
+  size_t bytes_stored = DrainBuffer(iov, iovcnt);
+  std::array<struct iovec, kMaxScatterIovs + 1> recv_list{};
   try {
-    while ((bytes_stored < min_bytes || !bytes_stored) && bytes_left) {
-      size_t iter_bytes_stored = 0;
-      const size_t old_recv_buffer_bytes_used = recv_buffer_bytes_used_;
-      if (recv_buffer_bytes_used_) {
-        // has pending data
-        UASSERT(recv_buffer_pos_ <= recv_buffer_bytes_used_);
-        const auto batch_size =
-            std::min(bytes_left, recv_buffer_bytes_used_ - recv_buffer_pos_);
-
-        std::memcpy(pos, recv_buffer_.data() + recv_buffer_pos_, batch_size);
-        iter_bytes_stored = batch_size;
-        recv_buffer_pos_ += batch_size;
-
-        UASSERT(recv_buffer_pos_ <= recv_buffer_bytes_used_);
-        if (recv_buffer_pos_ == recv_buffer_bytes_used_) {
-          recv_buffer_pos_ = 0;
-          recv_buffer_bytes_used_ = 0;
-        }
-      } else {
-        UASSERT(!recv_buffer_pos_);
-        if (bytes_left < recv_buffer_.size()) {
-          // no pending data, can be buffered
-          recv_buffer_bytes_used_ += socket_.RecvSome(
-              recv_buffer_.data(), recv_buffer_.size(), deadline);
-          UASSERT(recv_buffer_bytes_used_ <= recv_buffer_.size());
-          if (!recv_buffer_bytes_used_) break;  // EOF
-        } else {
-          // no pending data, will overflow the buffer, stream directly
-          const auto batch_size = bytes_left - bytes_left % recv_buffer_.size();
-          iter_bytes_stored = socket_.RecvSome(pos, batch_size, deadline);
-        }
+    while (bytes_stored < min_bytes || !bytes_stored) {
+      size_t list_size = 0;
+      size_t iov_end = 0;
+      for (; iov_end < iovcnt && list_size < kMaxScatterIovs; ++iov_end) {
+        if (iov[iov_end].iov_len) recv_list[list_size++] = iov[iov_end];
       }
-      UASSERT(iter_bytes_stored ||
-              (recv_buffer_bytes_used_ > old_recv_buffer_bytes_used));
-      bytes_left -= iter_bytes_stored;
-      bytes_stored += iter_bytes_stored;
-      pos += iter_bytes_stored;
+      if (!list_size) break;  // nothing left to fill
+      UASSERT(!recv_buffer_bytes_used_ && !recv_buffer_pos_);
+      recv_list[list_size++] = {recv_buffer_.data(), recv_buffer_.size()};
+
+      if (stats_) ++stats_->stream_recvs;
+      size_t bytes_left =
+          socket_.RecvSome(recv_list.data(), list_size, deadline);
+      if (!bytes_left) break;  // EOF
+
+      // data has been received in iov order, skip the filled parts
+      for (size_t i = 0; i < iov_end && bytes_left; ++i) {
+        const auto batch_size = std::min(iov[i].iov_len, bytes_left);
+        iov[i].iov_base = static_cast<char*>(iov[i].iov_base) + batch_size;
+        iov[i].iov_len -= batch_size;
+        bytes_left -= batch_size;
+        bytes_stored += batch_size;
+      }
+      // the excess is in the buffer
+      recv_buffer_bytes_used_ = bytes_left;
+      UASSERT(recv_buffer_bytes_used_ <= recv_buffer_.size());
+      // the iovecs past the first kMaxScatterIovs were not in the list,
+      // the buffer is only left non-empty if all of them are filled
+      bytes_stored += DrainBuffer(iov + iov_end, iovcnt - iov_end);
     }
   } catch (const engine::io::IoTimeout& timeout_ex) {
     // adjust the counter
@@ -417,8 +441,9 @@ size_t AsyncStream::BufferedRecv(void* data, size_t size, size_t min_bytes,
   return bytes_stored;
 }
 
-cdriver::StreamPtr AsyncStream::Create(engine::io::Socket socket) {
-  return cdriver::StreamPtr(new AsyncStream(std::move(socket)));
+cdriver::StreamPtr AsyncStream::Create(engine::io::Socket socket,
+                                       stats::PoolConnectStatistics* stats) {
+  return cdriver::StreamPtr(new AsyncStream(std::move(socket), stats));
 }
 
 void AsyncStream::Destroy(mongoc_stream_t* stream) noexcept {
@@ -462,6 +487,7 @@ ssize_t AsyncStream::Writev(mongoc_stream_t* stream, mongoc_iovec_t* iov,
   auto* self = static_cast<AsyncStream*>(stream);
   LOG_TRACE() << "Writing to async stream " << self;
   self->is_timed_out_ = false;
+  if (self->stats_) ++self->stats_->stream_writes;
   int error = 0;
 
   const auto deadline = DeadlineFromTimeoutMs(timeout_ms);
@@ -514,6 +540,7 @@ ssize_t AsyncStream::Readv(mongoc_stream_t* stream, mongoc_iovec_t* iov,
   auto* self = static_cast<AsyncStream*>(stream);
   LOG_TRACE() << "Reading from async stream " << self;
   self->is_timed_out_ = false;
+  if (self->stats_) ++self->stats_->stream_reads;
   int error = 0;
 
   const auto deadline = DeadlineFromTimeoutMs(timeout_ms);
@@ -521,20 +548,7 @@ ssize_t AsyncStream::Readv(mongoc_stream_t* stream, mongoc_iovec_t* iov,
   size_t recvd_total = 0;
   try {
     engine::TaskCancellationBlocker block_cancel;
-    size_t curr_iov = 0;
-    while (curr_iov < iovcnt && (min_bytes < recvd_total || !recvd_total)) {
-      const auto recvd_now =
-          self->BufferedRecv(iov[curr_iov].iov_base, iov[curr_iov].iov_len,
-                             min_bytes - recvd_total, deadline);
-      if (!recvd_now) break;  // EOF
-      recvd_total += recvd_now;
-
-      iov[curr_iov].iov_base =
-          reinterpret_cast<char*>(iov[curr_iov].iov_base) + recvd_now;
-      iov[curr_iov].iov_len -= recvd_now;
-
-      if (!iov[curr_iov].iov_len) ++curr_iov;
-    }
+    recvd_total = self->ScatterRecv(iov, iovcnt, min_bytes, deadline);
   } catch (const engine::io::IoCancelled&) {
     UASSERT_MSG(false,
                 "Cancellation is not supported in cdriver implementation");
@@ -4,6 +4,8 @@
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 
+#include <storages/mongo/stats.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mongo::impl::cdriver {
@@ -15,6 +17,9 @@ struct AsyncStreamInitiatorData {
   clients::dns::Resolver* dns_resolver;
 
   mongoc_ssl_opt_t ssl_opt;
+
+  // If not nullptr, accounts streams I/O, must outlive streams
+  stats::PoolConnectStatistics* stats{nullptr};
 };
 
 mongoc_stream_t* MakeAsyncStream(const mongoc_uri_t*, const mongoc_host_list_t*,
@@ -3,23 +3,33 @@
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <vector>
+
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/value_builder.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
 #include <storages/mongo/operations_common.hpp>
 #include <storages/mongo/operations_impl.hpp>
+#include <storages/mongo/prefetching_cursor_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -42,6 +52,51 @@ class WriteResultHelper {
   formats::bson::impl::UninitializedBson bson_;
 };
 
+// Merges the results of bulk chunks into the result of the whole bulk,
+// `index` fields are shifted to the positions of sub-operations in the bulk
+WriteResult MergeBulkChunkResults(
+    const std::vector<size_t>& chunk_offsets,
+    const std::vector<formats::bson::Document>& chunk_results) {
+  static const std::string kCounters[] = {"nInserted", "nMatched", "nModified",
+                                          "nRemoved", "nUpserted"};
+  static const std::string kIndexed[] = {"upserted", "writeErrors"};
+  static const std::string kWriteConcernErrors = "writeConcernErrors";
+
+  formats::bson::ValueBuilder merged;
+  for (const auto& counter : kCounters) {
+    int64_t sum = 0;
+    for (const auto& result : chunk_results) {
+      sum += result[counter].As<int64_t>(0);
+    }
+    merged[counter] = sum;
+  }
+
+  for (const auto& array : kIndexed) {
+    formats::bson::ValueBuilder items(formats::common::Type::kArray);
+    for (size_t i = 0; i < chunk_results.size(); ++i) {
+      if (!chunk_results[i].HasMember(array)) continue;
+      for (const auto& item : chunk_results[i][array]) {
+        formats::bson::ValueBuilder shifted(item);
+        shifted["index"] =
+            static_cast<int64_t>(item["index"].As<size_t>() + chunk_offsets[i]);
+        items.PushBack(std::move(shifted));
+      }
+    }
+    if (!items.IsEmpty()) merged[array] = std::move(items);
+  }
+
+  formats::bson::ValueBuilder wc_errors(formats::common::Type::kArray);
+  for (const auto& result : chunk_results) {
+    if (!result.HasMember(kWriteConcernErrors)) continue;
+    for (const auto& item : result[kWriteConcernErrors]) {
+      wc_errors.PushBack(item);
+    }
+  }
+  if (!wc_errors.IsEmpty()) merged[kWriteConcernErrors] = std::move(wc_errors);
+
+  return WriteResult(merged.ExtractValue().As<formats::bson::Document>());
+}
+
 std::optional<std::string> GetCurrentSpanLink() {
   auto* span = tracing::Span::CurrentSpanUnchecked();
   if (span) return span->GetLink();
@@ -176,6 +231,65 @@ void SetMaxServerTime(mongoc_find_and_modify_opts_t& options,
   }
 }
 
+double NumericIdToDouble(const formats::bson::Value& id) {
+  if (id.IsDouble()) return id.As<double>();
+  return static_cast<double>(id.As<int64_t>());
+}
+
+template <typename Bound>
+std::vector<formats::bson::Document> MakeIdRangeFilters(
+    const formats::bson::Document& filter, const std::vector<Bound>& bounds) {
+  std::vector<formats::bson::Document> filters;
+  filters.reserve(bounds.size() + 1);
+  // First and last ranges are open to cover ids out of [min, max]
+  // that were inserted after the bounds were read
+  for (size_t i = 0; i <= bounds.size(); ++i) {
+    formats::bson::ValueBuilder range;
+    if (i > 0) range["$gte"] = bounds[i - 1];
+    if (i < bounds.size()) range["$lt"] = bounds[i];
+    auto id_filter = formats::bson::MakeDoc("_id", range.ExtractValue());
+    if (filter.IsEmpty()) {
+      filters.push_back(std::move(id_filter));
+    } else {
+      filters.push_back(formats::bson::MakeDoc(
+          "$and", formats::bson::MakeArray(filter, id_filter)));
+    }
+  }
+  return filters;
+}
+
+// Splits [min_id, max_id] into `parts` filters of disjoint `_id` ranges.
+// Returns an empty vector if the ids cannot be split.
+std::vector<formats::bson::Document> SplitByIdRanges(
+    const formats::bson::Document& filter, const formats::bson::Value& min_id,
+    const formats::bson::Value& max_id, size_t parts) {
+  // Sort order of BSON types guarantees that all ids are of the same kind
+  // when both the minimal and the maximal one are
+  if (min_id.IsOid() && max_id.IsOid()) {
+    const auto min_time = min_id.As<formats::bson::Oid>().GetTimePoint();
+    const auto max_time = max_id.As<formats::bson::Oid>().GetTimePoint();
+    const auto step = (max_time - min_time) / static_cast<int64_t>(parts);
+    std::vector<formats::bson::Oid> bounds;
+    for (size_t i = 1; i < parts; ++i) {
+      bounds.push_back(formats::bson::Oid::MakeMinimalFor(
+          min_time + step * static_cast<int64_t>(i)));
+    }
+    return MakeIdRangeFilters(filter, bounds);
+  }
+
+  const auto is_numeric = [](const formats::bson::Value& id) {
+    return id.IsInt32() || id.IsInt64() || id.IsDouble();
+  };
+  if (is_numeric(min_id) && is_numeric(max_id)) {
+    const auto min = NumericIdToDouble(min_id);
+    const auto step = (NumericIdToDouble(max_id) - min) / parts;
+    std::vector<double> bounds;
+    for (size_t i = 1; i < parts; ++i) bounds.push_back(min + step * i);
+    return MakeIdRangeFilters(filter, bounds);
+  }
+  return {};
+}
+
 }  // namespace
 
 CDriverCollectionImpl::CDriverCollectionImpl(PoolImplPtr pool_impl,
@@ -266,9 +380,57 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& operation) const {
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_find_with_opts(
       context.collection.get(), native_filter_bson_ptr,
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
-  return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
+  auto cursor_impl = std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
-      std::move(context.stats)));
+      std::move(context.stats));
+  if (operation.impl_->prefetch_documents) {
+    return Cursor(std::make_unique<impl::PrefetchingCursorImpl>(
+        std::move(cursor_impl), operation.impl_->prefetch_documents));
+  }
+  return Cursor(std::move(cursor_impl));
+}
+
+std::vector<Cursor> CDriverCollectionImpl::ExecuteParallel(
+    const operations::Find& operation, size_t parts) const {
+  if (!parts) {
+    throw InvalidQueryArgumentException(
+        "Parallel query must have at least one part");
+  }
+  const auto& filter = operation.impl_->filter;
+
+  const auto get_bound_id = [&](options::Sort::Direction direction)
+      -> std::optional<formats::bson::Value> {
+    operations::Find bound_op(filter);
+    bound_op.impl_->read_prefs = operation.impl_->read_prefs;
+    bound_op.SetOption(options::Projection{"_id"});
+    bound_op.SetOption(options::Sort{{"_id", direction}});
+    bound_op.SetOption(options::Limit{1});
+    auto cursor = Execute(bound_op);
+    if (!cursor) return std::nullopt;
+    return (*cursor.begin())["_id"];
+  };
+
+  std::vector<formats::bson::Document> part_filters;
+  if (parts > 1) {
+    const auto min_id = get_bound_id(options::Sort::kAscending);
+    const auto max_id = get_bound_id(options::Sort::kDescending);
+    if (min_id && max_id) {
+      part_filters = SplitByIdRanges(filter, *min_id, *max_id, parts);
+    }
+  }
+
+  std::vector<Cursor> cursors;
+  if (part_filters.empty()) {
+    cursors.push_back(Execute(operation));
+    return cursors;
+  }
+  cursors.reserve(part_filters.size());
+  for (auto& part_filter : part_filters) {
+    auto part_op = operation;
+    part_op.impl_->filter = std::move(part_filter);
+    cursors.push_back(Execute(part_op));
+  }
+  return cursors;
 }
 
 WriteResult CDriverCollectionImpl::Execute(
@@ -492,31 +654,84 @@ WriteResult CDriverCollectionImpl::Execute(
 WriteResult CDriverCollectionImpl::Execute(operations::Bulk&& operation) {
   if (operation.IsEmpty()) return {};
 
-  auto context = MakeRequestContext("mongo_bulk", operation);
+  auto& bulk_impl = *operation.impl_;
+  UASSERT(bulk_impl.bulk);
+  if (bulk_impl.full_chunks.empty()) {
+    return WriteResult(ExecuteBulkChunk(
+        bulk_impl.bulk.get(), bulk_impl.op_key, bulk_impl.should_throw));
+  }
+
+  const auto bulk_size = bulk_impl.bulk_offset + bulk_impl.bulk_size;
+  bulk_impl.full_chunks.push_back(
+      {std::move(bulk_impl.bulk), bulk_impl.bulk_offset});
+  const auto& chunks = bulk_impl.full_chunks;
+  std::vector<formats::bson::Document> chunk_results(chunks.size());
+  std::vector<std::exception_ptr> chunk_errors(chunks.size());
+  std::atomic<size_t> next_chunk{0};
+
+  auto& pool_stats = *pool_impl_->GetStatistics().pool;
+  const auto get_chunk_size = [&](size_t idx) {
+    const auto end =
+        idx + 1 < chunks.size() ? chunks[idx + 1].offset : bulk_size;
+    return end - chunks[idx].offset;
+  };
+
+  const auto workers_count =
+      std::min(bulk_impl.max_in_flight_chunks, chunks.size());
+  std::vector<engine::TaskWithResult<void>> workers;
+  workers.reserve(workers_count);
+  for (size_t i = 0; i < workers_count; ++i) {
+    workers.push_back(utils::Async("mongo_bulk_chunk", [&] {
+      for (auto idx = next_chunk++; idx < chunks.size(); idx = next_chunk++) {
+        ++pool_stats.bulk_chunks_in_flight;
+        try {
+          chunk_results[idx] =
+              ExecuteBulkChunk(chunks[idx].bulk.get(), bulk_impl.op_key,
+                               bulk_impl.should_throw);
+          ++pool_stats.bulk_chunks;
+          pool_stats.bulk_chunk_operations += stats::Rate{get_chunk_size(idx)};
+        } catch (const std::exception&) {
+          ++pool_stats.bulk_chunk_errors;
+          chunk_errors[idx] = std::current_exception();
+        }
+        --pool_stats.bulk_chunks_in_flight;
+      }
+    }));
+  }
+  for (auto& worker : workers) worker.Get();
+
+  for (const auto& error : chunk_errors) {
+    if (error) std::rethrow_exception(error);
+  }
+  std::vector<size_t> chunk_offsets;
+  chunk_offsets.reserve(chunks.size());
+  for (const auto& chunk : chunks) chunk_offsets.push_back(chunk.offset);
+  return MergeBulkChunkResults(chunk_offsets, chunk_results);
+}
+
+formats::bson::Document CDriverCollectionImpl::ExecuteBulkChunk(
+    mongoc_bulk_operation_t* bulk, const stats::OperationKey& stats_key,
+    bool should_throw) {
+  auto context = MakeRequestContext("mongo_bulk", stats_key);
 
-  UASSERT(operation.impl_->bulk);
-  mongoc_bulk_operation_set_database(operation.impl_->bulk.get(),
-                                     GetDatabaseName().c_str());
-  mongoc_bulk_operation_set_collection(operation.impl_->bulk.get(),
-                                       GetCollectionName().c_str());
+  mongoc_bulk_operation_set_database(bulk, GetDatabaseName().c_str());
+  mongoc_bulk_operation_set_collection(bulk, GetCollectionName().c_str());
 
-  mongoc_bulk_operation_set_client(operation.impl_->bulk.get(),
-                                   context.client.get());
+  mongoc_bulk_operation_set_client(bulk, context.client.get());
 
   MongoError error;
-  WriteResultHelper write_result;
+  formats::bson::impl::UninitializedBson write_result;
   stats::OperationStopwatch stopwatch(std::move(context.stats));
-  if (mongoc_bulk_operation_execute(operation.impl_->bulk.get(),
-                                    write_result.GetNative(),
+  if (mongoc_bulk_operation_execute(bulk, write_result.Get(),
                                     error.GetNative())) {
     stopwatch.AccountSuccess();
   } else {
     stopwatch.AccountError(error.GetKind());
-    if (operation.impl_->should_throw || !error.IsServerError()) {
+    if (should_throw || !error.IsServerError()) {
       error.Throw("Error running bulk operation");
     }
   }
-  return write_result.Extract();
+  return formats::bson::Document(write_result.Extract());
 }
 
 Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
@@ -538,6 +753,25 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
       std::move(context.stats)));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  auto options = operation.impl_->options;
+  bool has_comment_option = operation.impl_->has_comment_option;
+  if (!has_comment_option)
+    SetLinkComment(impl::EnsureBuilder(options), has_comment_option);
+
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  const bson_t* native_pipeline_bson_ptr = pipeline_doc.GetBson().get();
+  impl::cdriver::ChangeStreamPtr cdriver_stream(mongoc_collection_watch(
+      context.collection.get(), native_pipeline_bson_ptr,
+      impl::GetNative(options)));
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(cdriver_stream),
+      std::move(context.stats)));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   auto context = MakeRequestContext("mongo_drop", operation);
 
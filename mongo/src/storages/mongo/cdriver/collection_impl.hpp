@@ -3,6 +3,11 @@
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <vector>
+
+#include <mongoc/mongoc.h>
+
+#include <userver/formats/bson/document.hpp>
 
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/collection_impl.hpp>
@@ -31,6 +36,8 @@ class CDriverCollectionImpl : public CollectionImpl {
   size_t Execute(const operations::Count&) const override;
   size_t Execute(const operations::CountApprox&) const override;
   Cursor Execute(const operations::Find&) const override;
+  std::vector<Cursor> ExecuteParallel(const operations::Find&,
+                                      size_t parts) const override;
   WriteResult Execute(const operations::InsertOne&) override;
   WriteResult Execute(const operations::InsertMany&) override;
   WriteResult Execute(const operations::ReplaceOne&) override;
@@ -40,6 +47,7 @@ class CDriverCollectionImpl : public CollectionImpl {
   WriteResult Execute(const operations::FindAndRemove&) override;
   WriteResult Execute(operations::Bulk&&) override;
   Cursor Execute(const operations::Aggregate&) override;
+  ChangeStream Execute(const operations::Watch&) const override;
   void Execute(const operations::Drop&) override;
 
  private:
@@ -49,6 +57,10 @@ class CDriverCollectionImpl : public CollectionImpl {
   RequestContext MakeRequestContext(std::string&& span_name,
                                     const stats::OperationKey& stats_key) const;
 
+  formats::bson::Document ExecuteBulkChunk(mongoc_bulk_operation_t* bulk,
+                                           const stats::OperationKey& stats_key,
+                                           bool should_throw);
+
   template <typename Operation>
   RequestContext MakeRequestContext(std::string&& span_name,
                                     const Operation& operation) const;
@@ -44,7 +44,9 @@ CDriverCursorImpl::CDriverCursorImpl(
   Next();
 }
 
-bool CDriverCursorImpl::IsValid() const { return cursor_ || current_; }
+bool CDriverCursorImpl::IsValid() const {
+  return cursor_ || current_native_;
+}
 
 bool CDriverCursorImpl::HasMore() const {
   return cursor_ && mongoc_cursor_more(cursor_.get());
@@ -52,12 +54,23 @@ bool CDriverCursorImpl::HasMore() const {
 
 const formats::bson::Document& CDriverCursorImpl::Current() const {
   if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  if (!current_ && current_native_) {
+    current_ = formats::bson::Document(
+        formats::bson::impl::MutableBson::CopyNative(current_native_)
+            .Extract());
+  }
   return *current_;
 }
 
+const bson_t* CDriverCursorImpl::CurrentNative() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return current_native_;
+}
+
 void CDriverCursorImpl::Next() {
   if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
 
+  current_native_ = nullptr;
   current_ = std::nullopt;
   if (!HasMore()) {
     UASSERT(!cursor_ && !client_);
@@ -68,14 +81,9 @@ void CDriverCursorImpl::Next() {
   const auto batch_num_before = mongoc_cursor_get_batch_num(cursor_.get());
   stats::OperationStopwatch cursor_next_sw(find_stats_, "find");
 
-  const bson_t* current_bson = nullptr;
   MongoError error;
   while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
-    if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
-      current_ = formats::bson::Document(
-          formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
-      break;
-    }
+    if (mongoc_cursor_next(cursor_.get(), &current_native_)) break;
   }
   if (batch_num_before == mongoc_cursor_get_batch_num(cursor_.get())) {
     cursor_next_sw.Discard();
@@ -85,6 +93,8 @@ void CDriverCursorImpl::Next() {
     cursor_next_sw.AccountError(error.GetKind());
   }
   if (!HasMore()) {
+    // The last document is owned by the cursor
+    if (current_native_) current_native_ = Current().GetBson().get();
     cursor_.reset();
     client_.reset();
   }
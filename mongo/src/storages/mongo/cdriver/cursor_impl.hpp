@@ -25,10 +25,14 @@ class CDriverCursorImpl final : public CursorImpl {
   bool HasMore() const override;
 
   const formats::bson::Document& Current() const override;
+  const bson_t* CurrentNative() const override;
   void Next() override;
 
  private:
-  std::optional<formats::bson::Document> current_;
+  // Points either to the cursor batch or to current_
+  const bson_t* current_native_{nullptr};
+  // Copy of the current document, made on first access
+  mutable std::optional<formats::bson::Document> current_;
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
   cdriver::CursorPtr cursor_;
   const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
@@ -16,6 +16,7 @@
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/traceful_exception.hpp>
 
+#include <formats/bson/wrappers.hpp>
 #include <storages/mongo/cdriver/async_stream.hpp>
 #include <storages/mongo/stats.hpp>
 #include <userver/storages/mongo/exception.hpp>
@@ -33,6 +34,12 @@ utils::impl::UserverExperiment kServerSelectionTimeoutExperiment{
 const std::string kMaintenanceTaskName = "mongo_maintenance";
 constexpr size_t kIdleConnectionDropRate = 1;
 
+// Server side load is sampled rarely to not load the server even more
+const std::string kServerLoadTaskName = "mongo_server_load";
+constexpr std::chrono::seconds kServerLoadInterval{10};
+// Too few operations for the waiting percent to be meaningful
+constexpr std::int64_t kServerLoadMinOperations = 10;
+
 int32_t CheckedDurationMs(const std::chrono::milliseconds& timeout,
                           const char* name) {
   auto timeout_ms = timeout.count();
@@ -165,7 +172,7 @@ CDriverPoolImpl::CDriverPoolImpl(std::string id, const std::string& uri_string,
                                  dynamic_config::Source config_source)
     : PoolImpl(std::move(id), config, config_source),
       app_name_(config.app_name),
-      init_data_{dns_resolver, {}},
+      init_data_{dns_resolver, {}, nullptr},
       max_size_(config.max_size),
       idle_limit_(config.idle_limit),
       queue_timeout_(config.queue_timeout),
@@ -188,6 +195,7 @@ CDriverPoolImpl::CDriverPoolImpl(std::string id, const std::string& uri_string,
   default_database_ = uri_database;
 
   init_data_.ssl_opt = MakeSslOpt(uri_.get());
+  init_data_.stats = &*GetStatistics().pool;
 
   try {
     tracing::Span span("mongo_prepopulate");
@@ -206,10 +214,13 @@ CDriverPoolImpl::CDriverPoolImpl(std::string id, const std::string& uri_string,
                            {utils::PeriodicTask::Flags::kStrong,
                             utils::PeriodicTask::Flags::kCritical}},
                           [this] { DoMaintenance(); });
+  server_load_task_.Start(kServerLoadTaskName, {kServerLoadInterval},
+                          [this] { SampleServerLoad(); });
 }
 
 CDriverPoolImpl::~CDriverPoolImpl() {
   tracing::Span span("mongo_destroy");
+  server_load_task_.Stop();
   maintenance_task_.Stop();
 
   const ClientDeleter deleter;
@@ -385,6 +396,51 @@ void CDriverPoolImpl::DoMaintenance() {
   LOG_DEBUG() << "Finished mongo pool '" << Id() << "' maintenance";
 }
 
+void CDriverPoolImpl::SampleServerLoad() {
+  static const char* kAdminDatabase = "admin";
+  static const auto kServerStatusCommand = formats::bson::MakeDoc(
+      "serverStatus", 1, "repl", 0, "metrics", 0, "locks", 0, "wiredTiger", 0);
+  static const ReadPrefsPtr kPrimaryReadPrefs(MONGOC_READ_PRIMARY);
+
+  // Only used by the congestion control
+  if (!GetConfig()[kCongestionControlEnabled]) {
+    SetServerWaitPercent(std::nullopt);
+    return;
+  }
+
+  try {
+    // Waits in the queue like the queries do, so that the sample is taken
+    // under the load as well
+    auto client = Acquire();
+
+    MongoError error;
+    formats::bson::impl::UninitializedBson reply;
+    const bson_t* native_cmd_bson_ptr = kServerStatusCommand.GetBson().get();
+    if (!mongoc_client_command_simple(
+            client.get(), kAdminDatabase, native_cmd_bson_ptr,
+            kPrimaryReadPrefs.Get(), reply.Get(), error.GetNative())) {
+      error.Throw("serverStatus failed");
+    }
+
+    const formats::bson::Document status(reply.Extract());
+    const auto global_lock = status["globalLock"];
+    const auto queued =
+        global_lock["currentQueue"]["total"].As<std::int64_t>(0);
+    const auto active =
+        global_lock["activeClients"]["total"].As<std::int64_t>(0);
+    const auto operations = queued + active;
+    LOG_DEBUG() << "Mongo pool '" << Id() << "' server has " << queued
+                << " queued and " << active << " active operations";
+    SetServerWaitPercent(operations < kServerLoadMinOperations
+                             ? 0.0
+                             : 100.0 * queued / operations);
+  } catch (const std::exception& ex) {
+    SetServerWaitPercent(std::nullopt);
+    LOG_LIMITED_WARNING() << "Failed to sample the server load of mongo pool '"
+                          << Id() << "': " << ex;
+  }
+}
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
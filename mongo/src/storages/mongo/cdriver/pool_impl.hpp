@@ -63,6 +63,7 @@ class CDriverPoolImpl final : public PoolImpl {
   mongoc_client_t* Create();
 
   void DoMaintenance();
+  void SampleServerLoad();
 
   const std::string app_name_;
   std::string default_database_;
@@ -77,6 +78,7 @@ class CDriverPoolImpl final : public PoolImpl {
   engine::Semaphore connecting_semaphore_;
   boost::lockfree::queue<mongoc_client_t*> queue_;
   utils::PeriodicTask maintenance_task_;
+  utils::PeriodicTask server_load_task_;
 };
 
 }  // namespace storages::mongo::impl::cdriver
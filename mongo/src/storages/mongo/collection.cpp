@@ -21,6 +21,11 @@ Cursor Collection::Execute(const operations::Find& find_op) const {
   return impl_->Execute(find_op);
 }
 
+std::vector<Cursor> Collection::ExecuteParallel(
+    const operations::Find& find_op, size_t parts) const {
+  return impl_->ExecuteParallel(find_op, parts);
+}
+
 WriteResult Collection::Execute(const operations::InsertOne& insert_op) {
   return impl_->Execute(insert_op);
 }
@@ -57,6 +62,11 @@ Cursor Collection::Execute(const operations::Aggregate& aggregate_op) {
   return impl_->Execute(aggregate_op);
 }
 
+ChangeStream Collection::Execute(
+    const operations::Watch& watch_op) const {
+  return impl_->Execute(watch_op);
+}
+
 void Collection::Execute(const operations::Drop& drop_op) {
   return impl_->Execute(drop_op);
 }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <storages/mongo/stats.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -23,6 +25,8 @@ class CollectionImpl {
   virtual size_t Execute(const operations::Count&) const = 0;
   virtual size_t Execute(const operations::CountApprox&) const = 0;
   virtual Cursor Execute(const operations::Find&) const = 0;
+  virtual std::vector<Cursor> ExecuteParallel(const operations::Find&,
+                                              size_t parts) const = 0;
   virtual WriteResult Execute(const operations::InsertOne&) = 0;
   virtual WriteResult Execute(const operations::InsertMany&) = 0;
   virtual WriteResult Execute(const operations::ReplaceOne&) = 0;
@@ -32,6 +36,7 @@ class CollectionImpl {
   virtual WriteResult Execute(const operations::FindAndRemove&) = 0;
   virtual WriteResult Execute(operations::Bulk&&) = 0;
   virtual Cursor Execute(const operations::Aggregate&) = 0;
+  virtual ChangeStream Execute(const operations::Watch&) const = 0;
   virtual void Execute(const operations::Drop&) = 0;
 
  protected:
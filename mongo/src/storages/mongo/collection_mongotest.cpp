@@ -1,5 +1,8 @@
 #include "collection_mongotest.hpp"
 
+#include <optional>
+#include <set>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace bson = formats::bson;
@@ -100,6 +103,18 @@ UTEST_F(Collection, Read) {
       ADD_FAILURE() << "read from exhausted cursor succeeded";
     }
   }
+  {
+    int64_t sum = 0;
+    size_t count = 0;
+    auto cursor = coll.Find({});
+    cursor.ForEachReader([&](const bson::ValueReader& reader) {
+      ++count;
+      sum += reader["x"].As<int64_t>();
+    });
+    EXPECT_EQ(4, count);
+    EXPECT_EQ(7, sum);
+    EXPECT_FALSE(cursor);
+  }
 
   EXPECT_EQ(4, coll.CountApprox());
   EXPECT_EQ(0, other_coll.CountApprox());
@@ -567,4 +582,118 @@ UTEST_F(Collection, ExecuteOps) {
   EXPECT_EQ(GetWinners(mongo_coll), "some_name_3 <anonymous> some_name_1 ");
 }
 
+UTEST_F(Collection, Prefetch) {
+  auto coll = GetDefaultPool().GetCollection("prefetch");
+
+  std::vector<bson::Document> docs;
+  for (int i = 0; i < 1000; ++i) docs.push_back(bson::MakeDoc("x", i));
+  coll.InsertMany(std::move(docs));
+
+  {
+    int64_t sum = 0;
+    for (const auto& doc : coll.Find({}, mongo::options::Prefetch{10})) {
+      sum += doc["x"].As<int64_t>();
+    }
+    EXPECT_EQ(999 * 1000 / 2, sum);
+  }
+  {
+    size_t count = 0;
+    auto cursor = coll.Find({}, mongo::options::Prefetch{10});
+    cursor.ForEachReader([&](const bson::ValueReader&) { ++count; });
+    EXPECT_EQ(1000, count);
+    EXPECT_FALSE(cursor);
+  }
+  {
+    // Abandoned cursor stops the prefetching
+    auto cursor = coll.Find({}, mongo::options::Prefetch{1});
+    EXPECT_TRUE(cursor);
+  }
+  {
+    auto cursor =
+        coll.Find(bson::MakeDoc("x", -1), mongo::options::Prefetch{1});
+    EXPECT_FALSE(cursor);
+  }
+}
+
+UTEST_F(Collection, FindParallel) {
+  auto coll = GetDefaultPool().GetCollection("find_parallel");
+
+  EXPECT_EQ(1, coll.FindParallel(4, {}).size());
+
+  std::vector<bson::Document> docs;
+  for (int i = 0; i < 100; ++i) docs.push_back(bson::MakeDoc("_id", i));
+  coll.InsertMany(std::move(docs));
+
+  const auto count_ids = [](std::vector<mongo::Cursor> cursors) {
+    std::set<int> ids;
+    for (auto& cursor : cursors) {
+      for (const auto& doc : cursor) {
+        EXPECT_TRUE(ids.insert(doc["_id"].As<int>()).second);
+      }
+    }
+    return ids.size();
+  };
+
+  EXPECT_EQ(4, coll.FindParallel(4, {}).size());
+  EXPECT_EQ(100, count_ids(coll.FindParallel(4, {})));
+  EXPECT_EQ(100, count_ids(coll.FindParallel(1, {})));
+  EXPECT_EQ(40, count_ids(coll.FindParallel(
+                    3, bson::MakeDoc("_id", bson::MakeDoc("$gte", 60)))));
+  UEXPECT_THROW(coll.FindParallel(0, {}),
+                mongo::InvalidQueryArgumentException);
+
+  coll.InsertOne(bson::MakeDoc("_id", "string"));
+  EXPECT_EQ(1, coll.FindParallel(4, {}).size());
+  EXPECT_EQ(101, count_ids(coll.FindParallel(4, {})));
+}
+
+UTEST_F(Collection, Watch) {
+  const mongo::options::MaxAwaitTime kMaxAwaitTime{
+      std::chrono::milliseconds{10}};
+  auto coll = GetDefaultPool().GetCollection("watch");
+  coll.InsertOne(bson::MakeDoc("_id", 0));
+
+  std::optional<mongo::ChangeStream> stream;
+  try {
+    stream.emplace(coll.Watch({}, mongo::options::FullDocumentLookup{},
+                              kMaxAwaitTime));
+  } catch (const mongo::ServerException& ex) {
+    // Change streams are only supported by replica sets
+    if (ex.Code() == 40573) GTEST_SKIP() << ex.what();
+    throw;
+  }
+  EXPECT_FALSE(stream->Next());
+
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  coll.UpdateOne(bson::MakeDoc("_id", 1),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 1)));
+  coll.DeleteOne(bson::MakeDoc("_id", 0));
+
+  auto event = stream->Next();
+  ASSERT_TRUE(event);
+  EXPECT_EQ("insert", (*event)["operationType"].As<std::string>());
+  const auto resume_token = stream->GetResumeToken();
+  ASSERT_TRUE(resume_token);
+
+  event = stream->Next();
+  ASSERT_TRUE(event);
+  EXPECT_EQ("update", (*event)["operationType"].As<std::string>());
+  EXPECT_EQ(1, (*event)["fullDocument"]["x"].As<int>());
+
+  event = stream->Next();
+  ASSERT_TRUE(event);
+  EXPECT_EQ("delete", (*event)["operationType"].As<std::string>());
+  EXPECT_FALSE(stream->Next());
+
+  auto resumed = coll.Watch(
+      {}, mongo::options::ResumeAfter{*resume_token}, kMaxAwaitTime);
+  event = resumed.Next();
+  ASSERT_TRUE(event);
+  EXPECT_EQ("update", (*event)["operationType"].As<std::string>());
+  EXPECT_TRUE((*event)["fullDocument"].IsMissing());
+
+  UEXPECT_THROW(coll.Watch(bson::MakeDoc("x", 1)),
+                mongo::InvalidQueryArgumentException);
+}
+
 USERVER_NAMESPACE_END
@@ -52,7 +52,9 @@ Sensor::Data Sensor::GetCurrent() {
   LOG_TRACE() << "timeout rate = " << timeout_rate;
 
   const auto current_load = pool_.SizeApprox();
-  return {total, diff.timeouts, timings_sum_rate, current_load};
+  Data data{total, diff.timeouts, timings_sum_rate, current_load};
+  data.server_wait_percent = pool_.GetServerWaitPercent();
+  return data;
 }
 
 }  // namespace storages::mongo::cc
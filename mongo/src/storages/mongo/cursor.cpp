@@ -17,6 +17,12 @@ bool Cursor::HasMore() const { return impl_->IsValid(); }
 
 Cursor::Iterator Cursor::begin() { return Iterator(this); }
 
+formats::bson::ValueReader Cursor::GetCurrentReader() const {
+  return formats::bson::ValueReader(impl_->CurrentNative());
+}
+
+void Cursor::Advance() { impl_->Next(); }
+
 // no, part of the iterator interface
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 Cursor::Iterator Cursor::end() { return Iterator(nullptr); }
@@ -14,6 +14,8 @@ class CursorImpl {
   virtual bool HasMore() const = 0;
 
   virtual const formats::bson::Document& Current() const = 0;
+  /// Valid until the next call to Next()
+  virtual const bson_t* CurrentNative() const = 0;
   virtual void Next() = 0;
 };
 
@@ -294,6 +294,10 @@ void Find::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+void Find::SetOption(options::Prefetch prefetch) {
+  impl_->prefetch_documents = prefetch.Value();
+}
+
 InsertOne::InsertOne(formats::bson::Document document)
     : impl_(std::move(document)) {}
 
@@ -603,6 +607,50 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (impl_->pipeline.IsNull()) {
+    impl_->pipeline =
+        formats::bson::ValueBuilder(formats::bson::ValueBuilder::Type::kArray)
+            .ExtractValue();
+  } else if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(options::ReadConcern level) {
+  AppendReadConcern(impl::EnsureBuilder(impl_->options), level);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  static const std::string kOptionName = "resumeAfter";
+  impl::EnsureBuilder(impl_->options)
+      .Append(kOptionName, resume_after.Value().GetBson().get());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+  static const std::string kOptionName = "fullDocument";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, "updateLookup");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  static const std::string kOptionName = "maxAwaitTimeMS";
+  AppendUint64Option(impl::EnsureBuilder(impl_->options), kOptionName,
+                     max_await_time.Value().count());
+}
+
+void Watch::SetOption(const options::Comment& comment) {
+  AppendComment(impl::EnsureBuilder(impl_->options), impl_->has_comment_option,
+                comment);
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
@@ -54,6 +54,7 @@ class Find::Impl {
   std::optional<formats::bson::impl::BsonBuilder> options;
   bool has_comment_option{false};
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
+  size_t prefetch_documents{0};
 };
 
 class InsertOne::Impl {
@@ -145,12 +146,35 @@ class FindAndRemove::Impl {
 
 class Bulk::Impl {
  public:
+  struct Chunk {
+    impl::cdriver::BulkOperationPtr bulk;
+    /// Index of the first sub-operation of the chunk in the whole bulk
+    size_t offset{0};
+  };
+
   explicit Impl(Mode mode_) : mode(mode_) {}
 
+  /// Returns the bulk to append a sub-operation of `bytes` size to
+  mongoc_bulk_operation_t* EnsureBulk(size_t bytes = 0);
+
+  /// Accounts a sub-operation appended to the last chunk
+  void AccountAppended(size_t bytes);
+
   impl::cdriver::BulkOperationPtr bulk;
   stats::OperationKey op_key{stats::OpType::kBulk};
   Mode mode;
   bool should_throw{true};
+
+  /// @name Chunks for options::BulkParallelism, `bulk` is the last one
+  /// @{
+  std::vector<Chunk> full_chunks;
+  size_t bulk_offset{0};
+  size_t bulk_size{0};
+  size_t bulk_bytes{0};
+  size_t max_in_flight_chunks{1};
+  size_t max_chunk_size{0};
+  impl::cdriver::WriteConcernPtr write_concern;
+  /// @}
 };
 
 class Aggregate::Impl {
@@ -166,6 +190,17 @@ class Aggregate::Impl {
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+class Watch::Impl {
+ public:
+  explicit Impl(formats::bson::Value pipeline_)
+      : pipeline(std::move(pipeline_)) {}
+
+  formats::bson::Value pipeline;
+  stats::OperationKey op_key{stats::OpType::kWatch};
+  std::optional<formats::bson::impl::BsonBuilder> options;
+  bool has_comment_option{false};
+};
+
 class Drop::Impl {
  public:
   Impl() = default;
@@ -86,6 +86,22 @@ WriteConcern& WriteConcern::SetJournal(bool value) {
   return *this;
 }
 
+BulkParallelism::BulkParallelism(size_t max_in_flight_chunks,
+                                 size_t max_chunk_size)
+    : max_in_flight_chunks_(max_in_flight_chunks),
+      max_chunk_size_(max_chunk_size) {
+  if (!max_in_flight_chunks_) {
+    throw InvalidQueryArgumentException(
+        "Bulk parallelism must be a positive number");
+  }
+  if (!max_chunk_size_ ||
+      max_chunk_size_ > BulkParallelism::kDefaultMaxChunkSize) {
+    throw InvalidQueryArgumentException("Invalid bulk chunk size ")
+        << max_chunk_size_ << ", must be between 1 and "
+        << BulkParallelism::kDefaultMaxChunkSize;
+  }
+}
+
 Projection::Projection(
     std::initializer_list<std::string_view> fields_to_include) {
   for (const auto& field : fields_to_include) Include(field);
@@ -48,6 +48,16 @@ dynamic_config::Snapshot PoolImpl::GetConfig() const {
 
 StatsVerbosity PoolImpl::GetStatsVerbosity() const { return stats_verbosity_; }
 
+std::optional<double> PoolImpl::GetServerWaitPercent() const {
+  const auto percent = server_wait_percent_.load();
+  if (percent < 0) return std::nullopt;
+  return percent;
+}
+
+void PoolImpl::SetServerWaitPercent(std::optional<double> percent) {
+  server_wait_percent_ = percent.value_or(-1.0);
+}
+
 }  // namespace storages::mongo::impl
 
 USERVER_NAMESPACE_END
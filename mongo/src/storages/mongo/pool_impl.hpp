@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/dynamic_config/source.hpp>
@@ -37,10 +39,16 @@ class PoolImpl {
   virtual size_t MaxSize() const = 0;
   virtual void SetMaxSize(size_t max_size) = 0;
 
+  /// Percent of the server operations waiting in the global lock queue,
+  /// sampled from serverStatus; std::nullopt if unknown
+  std::optional<double> GetServerWaitPercent() const;
+
  protected:
   PoolImpl(std::string&& id, const PoolConfig& static_config,
            dynamic_config::Source config_source);
 
+  void SetServerWaitPercent(std::optional<double> percent);
+
  private:
   void OnConfigUpdate(const dynamic_config::Snapshot& config);
 
@@ -48,6 +56,8 @@ class PoolImpl {
   const StatsVerbosity stats_verbosity_;
   dynamic_config::Source config_source_;
   stats::PoolStatistics statistics_;
+  // Negative if unknown
+  std::atomic<double> server_wait_percent_{-1.0};
 
   // congestion control stuff
   cc::Sensor cc_sensor_;
@@ -0,0 +1,70 @@
+#include <storages/mongo/prefetching_cursor_impl.hpp>
+
+#include <stdexcept>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl {
+
+PrefetchingCursorImpl::PrefetchingCursorImpl(
+    std::unique_ptr<CursorImpl> cursor, size_t prefetch_documents)
+    : queue_(Queue::Create(prefetch_documents)),
+      consumer_(queue_->GetConsumer()) {
+  UASSERT(cursor);
+  UASSERT(prefetch_documents > 0);
+  // getMore requests are issued by the producer while the consumer processes
+  // the documents that are already in the queue
+  producer_task_ = utils::Async(
+      "mongo_cursor_prefetch",
+      [cursor = std::move(cursor), producer = queue_->GetProducer()] {
+        for (; cursor->IsValid(); cursor->Next()) {
+          // Document copy shares the storage with the cursor
+          auto doc = cursor->Current();
+          if (!producer.Push(std::move(doc))) return;
+        }
+      });
+
+  // Prime the cursor
+  Next();
+}
+
+PrefetchingCursorImpl::~PrefetchingCursorImpl() {
+  if (producer_task_.IsValid()) producer_task_.SyncCancel();
+}
+
+bool PrefetchingCursorImpl::IsValid() const { return current_.has_value(); }
+
+bool PrefetchingCursorImpl::HasMore() const { return !is_producer_finished_; }
+
+const formats::bson::Document& PrefetchingCursorImpl::Current() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return *current_;
+}
+
+const bson_t* PrefetchingCursorImpl::CurrentNative() const {
+  return Current().GetBson().get();
+}
+
+void PrefetchingCursorImpl::Next() {
+  if (is_producer_finished_) {
+    throw std::logic_error("Advancing cursor past the end");
+  }
+
+  formats::bson::Document doc;
+  if (consumer_.Pop(doc)) {
+    current_ = std::move(doc);
+    return;
+  }
+
+  current_ = std::nullopt;
+  is_producer_finished_ = true;
+  // Rethrows the iteration error, if any
+  producer_task_.Get();
+}
+
+}  // namespace storages::mongo::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+
+#include <storages/mongo/cursor_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl {
+
+/// Reads the underlying cursor ahead in a background task
+class PrefetchingCursorImpl final : public CursorImpl {
+ public:
+  PrefetchingCursorImpl(std::unique_ptr<CursorImpl> cursor,
+                        size_t prefetch_documents);
+  ~PrefetchingCursorImpl() override;
+
+  bool IsValid() const override;
+  bool HasMore() const override;
+
+  const formats::bson::Document& Current() const override;
+  const bson_t* CurrentNative() const override;
+  void Next() override;
+
+ private:
+  using Queue = concurrent::SpscQueue<formats::bson::Document>;
+
+  std::optional<formats::bson::Document> current_;
+  bool is_producer_finished_{false};
+  std::shared_ptr<Queue> queue_;
+  Queue::Consumer consumer_;
+  engine::TaskWithResult<void> producer_task_;
+};
+
+}  // namespace storages::mongo::impl
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -74,6 +75,7 @@ enum class OpType {
   kCountApprox,
   kFind,
   kAggregate,
+  kWatch,
 
   kWriteMin,
   kInsertOne = kWriteMin,
@@ -110,6 +112,18 @@ struct PoolConnectStatistics {
   Counter closed;
   Counter overload;
 
+  // connection streams I/O: driver requests and socket calls serving them
+  Counter stream_writes;
+  Counter stream_reads;
+  Counter stream_recvs;
+
+  // chunks of the parallel bulks: executed, failed and being executed, and
+  // the sub-operations of the executed chunks
+  Counter bulk_chunks;
+  Counter bulk_chunk_errors;
+  Counter bulk_chunk_operations;
+  std::atomic<std::int64_t> bulk_chunks_in_flight{0};
+
   utils::SharedRef<OperationStatisticsItem> ping;
 
   AggregatedTimingsPercentile request_timings_agg;
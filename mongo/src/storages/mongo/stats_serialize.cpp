@@ -148,6 +148,19 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["conn-closed"] = conn_stats.closed;
   writer["overloads"] = conn_stats.overload;
 
+  if (auto stream_writer = writer["stream"]) {
+    stream_writer["writes"] = conn_stats.stream_writes;
+    stream_writer["reads"] = conn_stats.stream_reads;
+    stream_writer["recvs"] = conn_stats.stream_recvs;
+  }
+
+  if (auto bulk_writer = writer["bulk"]) {
+    bulk_writer["chunks"] = conn_stats.bulk_chunks;
+    bulk_writer["chunk-errors"] = conn_stats.bulk_chunk_errors;
+    bulk_writer["chunk-operations"] = conn_stats.bulk_chunk_operations;
+    bulk_writer["chunks-in-flight"] = conn_stats.bulk_chunks_in_flight.load();
+  }
+
   writer["conn-init"] = *conn_stats.ping;
 
   writer["conn-request-timings-1min"] = conn_stats.request_timings_agg;
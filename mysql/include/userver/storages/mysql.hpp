@@ -40,8 +40,9 @@
 /// - Connection pooling;
 /// - Binary protocol (prepared statements);
 /// - Transactions;
-/// - Read-only cursors;
+/// - Read-only cursors, optionally prefetching the next batch;
 /// - Batch Inserts/Upserts (requires MariaDB 10.2.6+);
+/// - Chunked multi-row inserts and `LOAD DATA LOCAL INFILE` streaming;
 /// - Variadic template statements parameters passing;
 /// - Statement result extraction into C++ types;
 /// - Mapping C++ types to native MySQL types;
@@ -3,6 +3,7 @@
 /// @file userver/storages/mysql/cluster.hpp
 /// @copybrief @copybrief storages::mysql::Cluster
 
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -15,7 +16,10 @@
 #include <userver/storages/mysql/cluster_host_type.hpp>
 #include <userver/storages/mysql/command_result_set.hpp>
 #include <userver/storages/mysql/cursor_result_set.hpp>
+#include <userver/storages/mysql/execution_result.hpp>
 #include <userver/storages/mysql/impl/bind_helper.hpp>
+#include <userver/storages/mysql/impl/multi_row_insert.hpp>
+#include <userver/storages/mysql/load_data.hpp>
 #include <userver/storages/mysql/options.hpp>
 #include <userver/storages/mysql/query.hpp>
 #include <userver/storages/mysql/statement_result_set.hpp>
@@ -188,6 +192,53 @@ class Cluster final {
                                        const Query& query,
                                        const Container& params) const;
 
+  /// @brief Inserts rows on the primary host with default deadline, using
+  /// multi-row `INSERT ... VALUES(...),(...)` prepared statements.
+  /// `insert_prefix` is the statement up to and including `VALUES`,
+  /// e.g. "INSERT INTO table(a, b) VALUES".
+  /// Container is expected to be a std::Container, Container::value_type is
+  /// expected to be an aggregate of supported types.
+  ///
+  /// Unlike ExecuteBulk works with any MySQL server. Rows are split into
+  /// chunks fitting `max_allowed_packet` and the prepared statement
+  /// placeholders limit, each chunk is a separate statement, so use
+  /// a transaction if the insert should be atomic.
+  ///
+  /// Returns the sum of affected rows and the first generated id.
+  template <typename Container>
+  ExecutionResult InsertMany(const Query& insert_prefix,
+                             const Container& rows) const;
+
+  /// @brief Inserts rows on the primary host with provided CommandControl,
+  /// using multi-row `INSERT ... VALUES(...),(...)` prepared statements.
+  ///
+  /// CommandControl applies to each of the statements.
+  /// @see InsertMany
+  template <typename Container>
+  ExecutionResult InsertMany(OptionalCommandControl command_control,
+                             const Query& insert_prefix,
+                             const Container& rows) const;
+
+  /// @brief Executes `LOAD DATA LOCAL INFILE` statement on the primary host
+  /// with default deadline, streaming the file contents from `generator`.
+  ///
+  /// The file name in the statement is ignored, rows are sent as they are
+  /// generated, each followed by '\n'. Requires `allow_local_infile` in the
+  /// component config and `local_infile` enabled on the server.
+  ///
+  /// @warning The generator is called from within the driver I/O, it must
+  /// not block or suspend the current task.
+  ExecutionResult LoadDataLocal(const Query& query,
+                                LoadDataRowsGenerator generator) const;
+
+  /// @brief Executes `LOAD DATA LOCAL INFILE` statement on the primary host
+  /// with provided CommandControl, streaming the file contents from
+  /// `generator`.
+  /// @see LoadDataLocal
+  ExecutionResult LoadDataLocal(OptionalCommandControl command_control,
+                                const Query& query,
+                                LoadDataRowsGenerator generator) const;
+
   /// @brief Begin a transaction with default deadline.
   ///
   /// @note The deadline is transaction-wide, not just for Begin query itself.
@@ -349,6 +400,58 @@ StatementResultSet Cluster::ExecuteBulkMapped(
                    params_binder, std::nullopt);
 }
 
+template <typename Container>
+ExecutionResult Cluster::InsertMany(const Query& insert_prefix,
+                                    const Container& rows) const {
+  return InsertMany(std::nullopt, insert_prefix, rows);
+}
+
+template <typename Container>
+ExecutionResult Cluster::InsertMany(OptionalCommandControl command_control,
+                                    const Query& insert_prefix,
+                                    const Container& rows) const {
+  using Row = typename Container::value_type;
+  constexpr auto kColumnsCount = boost::pfr::tuple_size_v<Row>;
+  constexpr auto kMaxChunkRows =
+      impl::kMaxStatementPlaceholders / kColumnsCount;
+
+  ExecutionResult result{};
+  auto chunk_begin = rows.begin();
+  std::size_t rows_left = rows.size();
+  while (rows_left != 0) {
+    std::size_t fitting_rows = 0;
+    std::size_t chunk_data_size = 0;
+    for (auto it = chunk_begin;
+         fitting_rows < rows_left && fitting_rows < kMaxChunkRows; ++it) {
+      chunk_data_size += impl::EstimateRowSize(*it);
+      if (fitting_rows != 0 && chunk_data_size > impl::kMaxInsertPacketSize) {
+        break;
+      }
+      ++fitting_rows;
+    }
+    const auto chunk_rows = impl::GetMultiRowInsertChunkSize(fitting_rows);
+
+    auto params_binder =
+        impl::BindHelper::BindRowsAsParams(chunk_begin, chunk_rows);
+    const auto chunk_result =
+        DoExecute(command_control, ClusterHostType::kPrimary,
+                  impl::BuildMultiRowInsertStatement(
+                      insert_prefix.GetStatement(), kColumnsCount, chunk_rows),
+                  params_binder, std::nullopt)
+            .AsExecutionResult();
+
+    result.rows_affected += chunk_result.rows_affected;
+    if (result.last_insert_id == 0) {
+      result.last_insert_id = chunk_result.last_insert_id;
+    }
+
+    std::advance(chunk_begin, chunk_rows);
+    rows_left -= chunk_rows;
+  }
+
+  return result;
+}
+
 template <typename T, typename... Args>
 CursorResultSet<T> Cluster::GetCursor(ClusterHostType host_type,
                                       std::size_t batch_size,
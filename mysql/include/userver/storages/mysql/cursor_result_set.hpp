@@ -2,6 +2,12 @@
 
 /// @file userver/storages/mysql/cursor_result_set.hpp
 
+#include <utility>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
 #include <userver/storages/mysql/statement_result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,7 +36,25 @@ class CursorResultSet final {
   template <typename RowCallback>
   void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
 
+  /// @brief Same as ForEach, but fetches the next batch from the server in a
+  /// separate task, while row_callback processes the current one.
+  ///
+  /// Usable when processing of a batch takes time comparable to its
+  /// fetching. Keeps up to two batches in memory.
+  ///
+  /// @param deadline the deadline of the prefetching tasks, the fetch of a
+  /// batch that is not done by then is cancelled and ForEachPrefetched throws
+  template <typename RowCallback>
+  void ForEachPrefetched(RowCallback&& row_callback,
+                         engine::Deadline deadline) &&;
+
  private:
+  using IntermediateStorage = std::vector<T>;
+  using Extractor = impl::io::TypedExtractor<IntermediateStorage, T, RowTag>;
+
+  // Returns whether there are more rows and the fetched ones
+  std::pair<bool, IntermediateStorage> FetchBatch(Extractor& extractor);
+
   StatementResultSet result_set_;
 };
 
@@ -68,6 +92,43 @@ void CursorResultSet<T>::ForEach(
   }
 }
 
+template <typename T>
+template <typename RowCallback>
+void CursorResultSet<T>::ForEachPrefetched(RowCallback&& row_callback,
+                                           engine::Deadline deadline) && {
+  Extractor extractor{};
+
+  auto batch = FetchBatch(extractor);
+  while (true) {
+    // The connection and the extractor are only used by the prefetching task
+    // until it is awaited
+    engine::TaskWithResult<std::pair<bool, IntermediateStorage>> prefetch;
+    if (batch.first) {
+      prefetch = utils::Async(
+          impl::tracing::kPrefetchSpan, deadline,
+          [this, &extractor] { return FetchBatch(extractor); });
+    }
+
+    {
+      const tracing::ScopeTime for_each{impl::tracing::kForEachScope};
+      for (auto&& row : batch.second) {
+        row_callback(std::move(row));
+      }
+    }
+
+    if (!prefetch.IsValid()) break;
+    batch = prefetch.Get();
+  }
+}
+
+template <typename T>
+std::pair<bool, typename CursorResultSet<T>::IntermediateStorage>
+CursorResultSet<T>::FetchBatch(Extractor& extractor) {
+  const tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+  const bool keep_going = result_set_.FetchResult(extractor);
+  return {keep_going, IntermediateStorage{extractor.ExtractData()}};
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
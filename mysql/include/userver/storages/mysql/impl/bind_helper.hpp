@@ -30,6 +30,27 @@ class BindHelper final {
         boost::pfr::structure_tie(row));
   }
 
+  // Binds `rows_count` rows starting at `first` as params of a single
+  // multi-row statement
+  template <typename Iterator>
+  static io::ParamsBinder BindRowsAsParams(Iterator first,
+                                           std::size_t rows_count) {
+    using Row = std::decay_t<decltype(*first)>;
+    constexpr auto kColumnsCount = boost::pfr::tuple_size_v<Row>;
+    static_assert(kColumnsCount != 0, "Rows to insert have zero columns");
+
+    io::ParamsBinder binder{kColumnsCount * rows_count};
+    for (std::size_t row = 0; row < rows_count; ++row, ++first) {
+      boost::pfr::for_each_field(
+          *first, [&binder, offset = row * kColumnsCount](const auto& field,
+                                                          std::size_t i) {
+            binder.Bind(offset + i, field);
+          });
+    }
+
+    return binder;
+  }
+
   template <typename Container>
   static io::InsertBinder<Container> BindContainerAsParams(
       const Container& rows) {
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/formats/json_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+// MySQL limits the number of placeholders in a prepared statement
+inline constexpr std::size_t kMaxStatementPlaceholders = 65535;
+
+// Fits into default max_allowed_packet of every supported server
+inline constexpr std::size_t kMaxInsertPacketSize = 4 * 1024 * 1024;
+
+// Wire size upper bound of a bound date, time or decimal
+inline constexpr std::size_t kMaxFixedFieldSize = 32;
+
+// Type and null-bitmap overhead of a bound param
+inline constexpr std::size_t kParamOverheadSize = 2;
+
+// Appends `rows_count` groups of `columns_count` placeholders to the prefix:
+// "INSERT INTO t(a, b) VALUES" -> "INSERT INTO t(a, b) VALUES(?,?),(?,?)"
+std::string BuildMultiRowInsertStatement(std::string_view insert_prefix,
+                                         std::size_t columns_count,
+                                         std::size_t rows_count);
+
+// Rounds the chunk size down to a power of two, so that only a few distinct
+// statements end up in the statements cache
+std::size_t GetMultiRowInsertChunkSize(std::size_t fitting_rows_count);
+
+std::size_t EstimateJsonSize(const formats::json::Value& value);
+
+template <typename T>
+std::size_t EstimateFieldSize(const T& field) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return sizeof(T);
+  } else if constexpr (std::is_same_v<T, std::string> ||
+                       std::is_same_v<T, std::string_view>) {
+    // 9 is the max length of the length-encoded size
+    return field.size() + 9;
+  } else if constexpr (std::is_same_v<T, formats::json::Value>) {
+    return EstimateJsonSize(field);
+  } else {
+    return kMaxFixedFieldSize;
+  }
+}
+
+template <typename T>
+std::size_t EstimateFieldSize(const std::optional<T>& field) {
+  return field.has_value() ? EstimateFieldSize(*field) : 0;
+}
+
+// Approximate size of the row in the statement execution packet
+template <typename Row>
+std::size_t EstimateRowSize(const Row& row) {
+  std::size_t size = 0;
+  boost::pfr::for_each_field(row, [&size](const auto& field) {
+    size += kParamOverheadSize + EstimateFieldSize(field);
+  });
+  return size;
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@ namespace storages::mysql::impl::tracing {
 inline const std::string kExecuteSpan{"mysql_execute"};
 inline const std::string kTransactionSpan{"mysql_transaction"};
 inline const std::string kQuerySpan{"mysql_query"};
+inline const std::string kPrefetchSpan{"mysql_prefetch"};
 
 inline const std::string kFetchScope{"mysql_fetch"};
 inline const std::string kForEachScope{"mysql_foreach"};
@@ -0,0 +1,20 @@
+#pragma once
+
+/// @file userver/storages/mysql/load_data.hpp
+
+#include <functional>
+#include <optional>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql {
+
+/// @brief Rows source of Cluster::LoadDataLocal: returns the next row
+/// formatted as the `LOAD DATA` statement expects it (without the line
+/// terminator), or std::nullopt after the last row
+using LoadDataRowsGenerator = std::function<std::optional<std::string>()>;
+
+}  // namespace storages::mysql
+
+USERVER_NAMESPACE_END
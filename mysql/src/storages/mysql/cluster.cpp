@@ -90,6 +90,25 @@ CommandResultSet Cluster::ExecuteCommand(OptionalCommandControl command_control,
       connection->ExecuteQuery(command.GetStatement(), deadline)};
 }
 
+ExecutionResult Cluster::LoadDataLocal(const Query& query,
+                                       LoadDataRowsGenerator generator) const {
+  return LoadDataLocal(std::nullopt, query, std::move(generator));
+}
+
+ExecutionResult Cluster::LoadDataLocal(OptionalCommandControl command_control,
+                                       const Query& query,
+                                       LoadDataRowsGenerator generator) const {
+  const auto deadline =
+      GetDeadline(command_control, GetDefaultCommandControl());
+
+  tracing::Span load_data_span{impl::tracing::kQuerySpan};
+
+  auto connection =
+      topology_->SelectPool(ClusterHostType::kPrimary).Acquire(deadline);
+
+  return connection->LoadDataLocal(query.GetStatement(), generator, deadline);
+}
+
 void Cluster::WriteStatistics(utils::statistics::Writer& writer) const {
   topology_->WriteStatistics(writer);
 }
@@ -63,6 +63,12 @@ properties:
         type: integer
         description: maximum number of created connections
         defaultDescription: 10
+    allow_local_infile:
+        type: boolean
+        description: |
+            allow LOAD DATA LOCAL INFILE statements, the data is fed
+            by the client code only and never read from the filesystem
+        defaultDescription: false
 )");
 }
 
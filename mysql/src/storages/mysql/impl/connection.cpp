@@ -10,6 +10,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/scope_time.hpp>
 
+#include <storages/mysql/impl/local_infile_feeder.hpp>
 #include <storages/mysql/impl/metadata/native_client_info.hpp>
 #include <storages/mysql/impl/metadata/server_info.hpp>
 #include <storages/mysql/impl/native_interface.hpp>
@@ -98,6 +99,11 @@ void SetNativeOptions(MYSQL* mysql,
   if (connection_settings.use_compression) {
     mysql_optionsv(mysql, MYSQL_OPT_COMPRESS, nullptr);
   }
+
+  // LOAD DATA LOCAL is fed by LocalInfileFeeder, never from the filesystem
+  unsigned int local_infile = connection_settings.allow_local_infile ? 1 : 0;
+  mysql_optionsv(mysql, MYSQL_OPT_LOCAL_INFILE, &local_infile);
+  LocalInfileFeeder::InstallRejecting(*mysql);
 }
 
 }  // namespace
@@ -150,6 +156,27 @@ StatementFetcher Connection::ExecuteStatement(
   });
 }
 
+ExecutionResult Connection::LoadDataLocal(const std::string& query,
+                                          LoadDataRowsGenerator& generator,
+                                          engine::Deadline deadline) {
+  auto guard = GetBrokenGuard();
+
+  return guard.Execute([&] {
+    LocalInfileFeeder feeder{mysql_, generator};
+
+    PlainQuery mysql_query{*this, query};
+    try {
+      mysql_query.Execute(deadline);
+    } catch (const MySQLException&) {
+      feeder.RethrowIfFailed();
+      throw;
+    }
+
+    return ExecutionResult{mysql_affected_rows(&mysql_),
+                           mysql_insert_id(&mysql_)};
+  });
+}
+
 void Connection::Ping(engine::Deadline deadline) {
   auto guard = GetBrokenGuard();
 
@@ -6,6 +6,8 @@
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/storages/mysql/execution_result.hpp>
+#include <userver/storages/mysql/load_data.hpp>
 
 #include <storages/mysql/impl/mariadb_include.hpp>
 
@@ -48,6 +50,10 @@ class Connection final {
                                     engine::Deadline deadline,
                                     std::optional<std::size_t> batch_size);
 
+  ExecutionResult LoadDataLocal(const std::string& query,
+                                LoadDataRowsGenerator& generator,
+                                engine::Deadline deadline);
+
   void Ping(engine::Deadline deadline);
 
   void Commit(engine::Deadline deadline);
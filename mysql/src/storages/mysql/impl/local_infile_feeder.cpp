@@ -0,0 +1,100 @@
+#include <storages/mysql/impl/local_infile_feeder.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+namespace {
+
+constexpr std::string_view kGeneratorFailedMessage{
+    "LOAD DATA rows generator failed"};
+constexpr std::string_view kRejectedMessage{
+    "LOAD DATA LOCAL is only allowed via Cluster::LoadDataLocal"};
+
+}  // namespace
+
+LocalInfileFeeder::LocalInfileFeeder(MYSQL& mysql,
+                                     LoadDataRowsGenerator& generator)
+    : mysql_{mysql}, generator_{generator} {
+  UASSERT(generator_);
+  mysql_set_local_infile_handler(&mysql_, &Init, &Read, &End, &Error, this);
+}
+
+LocalInfileFeeder::~LocalInfileFeeder() { InstallRejecting(mysql_); }
+
+void LocalInfileFeeder::InstallRejecting(MYSQL& mysql) {
+  mysql_set_local_infile_handler(&mysql, &Init, &Read, &End, &Error, nullptr);
+}
+
+void LocalInfileFeeder::RethrowIfFailed() {
+  if (exception_) std::rethrow_exception(exception_);
+}
+
+int LocalInfileFeeder::Init(void** ptr, const char*, void* userdata) {
+  // file name requested by the server is ignored, there is only one source
+  *ptr = userdata;
+  return userdata ? 0 : 1;
+}
+
+int LocalInfileFeeder::Read(void* ptr, char* buf, unsigned int buf_len) {
+  auto* self = static_cast<LocalInfileFeeder*>(ptr);
+  UASSERT(self);
+
+  try {
+    return static_cast<int>(self->DoRead(buf, buf_len));
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << kGeneratorFailedMessage << ": " << ex;
+    self->exception_ = std::current_exception();
+    return -1;
+  }
+}
+
+void LocalInfileFeeder::End(void*) {}
+
+int LocalInfileFeeder::Error(void* ptr, char* error_msg,
+                             unsigned int error_msg_len) {
+  const auto message = ptr ? kGeneratorFailedMessage : kRejectedMessage;
+  if (error_msg_len != 0) {
+    const auto length =
+        std::min<std::size_t>(message.size(), error_msg_len - 1);
+    std::memcpy(error_msg, message.data(), length);
+    error_msg[length] = '\0';
+  }
+  return CR_UNKNOWN_ERROR;
+}
+
+std::size_t LocalInfileFeeder::DoRead(char* buf, std::size_t buf_len) {
+  std::size_t written = 0;
+  while (written < buf_len) {
+    if (row_offset_ == row_.size()) {
+      if (is_exhausted_) break;
+
+      auto row = generator_();
+      if (!row.has_value()) {
+        is_exhausted_ = true;
+        break;
+      }
+      row_ = std::move(*row);
+      row_.push_back('\n');
+      row_offset_ = 0;
+    }
+
+    const auto length = std::min(buf_len - written, row_.size() - row_offset_);
+    std::memcpy(buf + written, row_.data() + row_offset_, length);
+    written += length;
+    row_offset_ += length;
+  }
+
+  return written;
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
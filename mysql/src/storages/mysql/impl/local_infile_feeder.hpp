@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <string>
+
+#include <storages/mysql/impl/mariadb_include.hpp>
+
+#include <userver/storages/mysql/load_data.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+// Feeds `LOAD DATA LOCAL INFILE` statements of the connection from
+// the generator instead of a file, installed for the lifetime of the object.
+// Files are never read: outside of a feeder lifetime such requests of
+// the server are rejected.
+class LocalInfileFeeder final {
+ public:
+  // Installs the handler that rejects all the requests
+  static void InstallRejecting(MYSQL& mysql);
+
+  LocalInfileFeeder(MYSQL& mysql, LoadDataRowsGenerator& generator);
+  ~LocalInfileFeeder();
+
+  LocalInfileFeeder(const LocalInfileFeeder& other) = delete;
+
+  // Rethrows an exception of the generator, if any
+  void RethrowIfFailed();
+
+ private:
+  static int Init(void** ptr, const char* filename, void* userdata);
+  static int Read(void* ptr, char* buf, unsigned int buf_len);
+  static void End(void* ptr);
+  static int Error(void* ptr, char* error_msg, unsigned int error_msg_len);
+
+  std::size_t DoRead(char* buf, std::size_t buf_len);
+
+  MYSQL& mysql_;
+  LoadDataRowsGenerator& generator_;
+
+  std::string row_;
+  std::size_t row_offset_{0};
+  bool is_exhausted_{false};
+
+  std::exception_ptr exception_;
+};
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#include <userver/storages/mysql/impl/multi_row_insert.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+std::string BuildMultiRowInsertStatement(std::string_view insert_prefix,
+                                         std::size_t columns_count,
+                                         std::size_t rows_count) {
+  UASSERT(columns_count > 0 && rows_count > 0);
+
+  std::string group{"("};
+  for (std::size_t i = 0; i < columns_count; ++i) {
+    group.append(i == 0 ? "?" : ",?");
+  }
+  group.push_back(')');
+
+  std::string statement;
+  statement.reserve(insert_prefix.size() + rows_count * (group.size() + 1));
+  statement.append(insert_prefix);
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    if (i != 0) statement.push_back(',');
+    statement.append(group);
+  }
+
+  return statement;
+}
+
+std::size_t GetMultiRowInsertChunkSize(std::size_t fitting_rows_count) {
+  UASSERT(fitting_rows_count > 0);
+
+  std::size_t chunk_size = 1;
+  while (chunk_size <= fitting_rows_count / 2) {
+    chunk_size *= 2;
+  }
+  return chunk_size;
+}
+
+std::size_t EstimateJsonSize(const formats::json::Value& value) {
+  return formats::json::ToString(value).size() + 9;
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
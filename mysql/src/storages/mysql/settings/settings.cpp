@@ -57,6 +57,7 @@ ConnectionSettings Parse(const yaml_config::YamlConfig& doc,
   settings.use_secure_connection = false;
   // TODO
   settings.use_compression = false;
+  settings.allow_local_infile = doc["allow_local_infile"].As<bool>(false);
   // TODO
   settings.ip_mode = IpMode::kIpV4;
 
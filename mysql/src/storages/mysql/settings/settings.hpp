@@ -31,6 +31,8 @@ struct ConnectionSettings final {
   bool use_secure_connection;
   // TODO : implement compression somehow
   bool use_compression;
+  // allows LOAD DATA LOCAL INFILE, fed by the client code only
+  bool allow_local_infile;
 
   IpMode ip_mode;
 };
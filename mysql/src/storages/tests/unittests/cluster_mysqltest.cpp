@@ -455,6 +455,130 @@ UTEST(Cluster, GetCursor) {
 
 }  // namespace get_cursor_sample
 
+namespace insert_many_sample {
+
+/// [uMySQL usage sample - Cluster InsertMany]
+struct SampleRow final {
+  std::string title;
+  int amount;
+  std::chrono::system_clock::time_point created;
+};
+
+void PerformInsertMany(const Cluster& cluster,
+                       std::chrono::milliseconds timeout,
+                       const std::vector<SampleRow>& rows) {
+  const auto insertion_result = cluster.InsertMany(
+      CommandControl{timeout},
+      "INSERT INTO SampleTable(title, amount, created) VALUES", rows);
+
+  // As with a single multi-row insert, the id of the first row is returned
+  EXPECT_EQ(insertion_result.last_insert_id, 1);
+  EXPECT_EQ(insertion_result.rows_affected, rows.size());
+}
+/// [uMySQL usage sample - Cluster InsertMany]
+
+UTEST(Cluster, InsertManyMultiRow) {
+  const ClusterWrapper cluster{};
+
+  PrepareExampleTable(*cluster);
+
+  constexpr std::size_t kRowsCount = 7;
+  std::vector<SampleRow> rows;
+  rows.reserve(kRowsCount);
+  for (std::size_t i = 0; i < kRowsCount; ++i) {
+    rows.push_back(
+        SampleRow{std::to_string(i), 1, std::chrono::system_clock::now()});
+  }
+
+  PerformInsertMany(*cluster, std::chrono::milliseconds{1750}, rows);
+}
+
+}  // namespace insert_many_sample
+
+UTEST(Cluster, InsertManyChunked) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  // more than fits both the placeholders limit and the packet size limit
+  constexpr int kRowsCount = 40000;
+  const std::string long_string(200, 'a');
+
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(kRowsCount);
+  for (int i = 0; i < kRowsCount; ++i) {
+    rows_to_insert.push_back({i, fmt::format("{}: {}", i, long_string)});
+  }
+
+  const auto result = cluster->InsertMany(
+      table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES"),
+      rows_to_insert);
+  EXPECT_EQ(result.rows_affected, kRowsCount);
+
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {} ORDER BY Id")
+          .AsVector<Row>();
+  EXPECT_EQ(db_rows, rows_to_insert);
+}
+
+UTEST(Cluster, LoadDataLocal) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+  cluster->ExecuteCommand(ClusterHostType::kPrimary,
+                          "SET GLOBAL local_infile = 1");
+
+  constexpr int kRowsCount = 10000;
+  std::vector<Row> rows_to_load;
+  rows_to_load.reserve(kRowsCount);
+  for (int i = 0; i < kRowsCount; ++i) {
+    rows_to_load.push_back({i, utils::generators::GenerateUuid()});
+  }
+
+  std::size_t next_row = 0;
+  const auto result = cluster->LoadDataLocal(
+      table.FormatWithTableName(
+          "LOAD DATA LOCAL INFILE 'rows' INTO TABLE {} (Id, Value)"),
+      [&]() -> std::optional<std::string> {
+        if (next_row == rows_to_load.size()) return std::nullopt;
+        const auto& row = rows_to_load[next_row++];
+        return fmt::format("{}\t{}", row.id, row.value);
+      });
+  EXPECT_EQ(result.rows_affected, kRowsCount);
+
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {} ORDER BY Id")
+          .AsVector<Row>();
+  EXPECT_EQ(db_rows, rows_to_load);
+}
+
+UTEST(Cluster, LoadDataLocalGeneratorThrows) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+  cluster->ExecuteCommand(ClusterHostType::kPrimary,
+                          "SET GLOBAL local_infile = 1");
+
+  EXPECT_THROW(
+      cluster->LoadDataLocal(
+          table.FormatWithTableName(
+              "LOAD DATA LOCAL INFILE 'rows' INTO TABLE {} (Id, Value)"),
+          []() -> std::optional<std::string> {
+            throw std::runtime_error{"no more rows"};
+          }),
+      std::runtime_error);
+}
+
+UTEST(Cluster, LoadDataLocalRejectedOutsideOfLoadData) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+  cluster->ExecuteCommand(ClusterHostType::kPrimary,
+                          "SET GLOBAL local_infile = 1");
+
+  EXPECT_THROW(cluster->ExecuteCommand(
+                   ClusterHostType::kPrimary,
+                   table.FormatWithTableName(
+                       "LOAD DATA LOCAL INFILE '/etc/hostname' INTO TABLE {}")),
+               MySQLException);
+}
+
 }  // namespace storages::mysql::tests
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include <userver/utest/utest.hpp>
 #include "../utils_mysqltest.hpp"
 
+#include <userver/engine/sleep.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::tests {
@@ -47,6 +49,67 @@ UTEST(Cursor, Works) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, PrefetchedWorks) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 100;
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back(
+        {static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+  }
+  cluster->ExecuteBulk(
+      ClusterHostType::kPrimary,
+      table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+      rows_to_insert);
+
+  std::vector<Row> db_rows;
+  db_rows.reserve(rows_count);
+
+  cluster
+      ->GetCursor<Row>(
+          ClusterHostType::kPrimary, 7,
+          table.FormatWithTableName("SELECT Id, Value FROM {} ORDER BY Id"))
+      .ForEachPrefetched(
+          [&db_rows](Row&& row) {
+            // processing is slow enough for the next batch to arrive
+            engine::SleepFor(std::chrono::microseconds{100});
+            db_rows.push_back(std::move(row));
+          },
+          cluster.GetDeadline());
+  EXPECT_EQ(db_rows, rows_to_insert);
+
+  // the connection is usable after the cursor
+  EXPECT_EQ(table.DefaultExecute("SELECT COUNT(*) FROM {}")
+                .AsSingleField<std::int64_t>(),
+            rows_count);
+}
+
+UTEST(Cursor, PrefetchedCallbackThrows) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  std::vector<Row> rows_to_insert;
+  for (std::int32_t i = 0; i < 20; ++i) {
+    rows_to_insert.push_back({i, utils::generators::GenerateUuid()});
+  }
+  cluster->ExecuteBulk(
+      ClusterHostType::kPrimary,
+      table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+      rows_to_insert);
+
+  auto cursor = cluster->GetCursor<Row>(
+      ClusterHostType::kPrimary, 3,
+      table.FormatWithTableName("SELECT Id, Value FROM {}"));
+  EXPECT_THROW(
+      std::move(cursor).ForEachPrefetched(
+          [](Row&&) { throw std::runtime_error{"processing failed"}; },
+          cluster.GetDeadline()),
+      std::runtime_error);
+}
+
 // https://bugs.mysql.com/bug.php?id=109380
 UTEST(Cursor, StatementReuseWorks) {
   ClusterWrapper cluster{};
@@ -52,6 +52,7 @@ std::shared_ptr<Cluster> CreateCluster(clients::dns::Resolver& resolver) {
       yaml_config::YamlConfig{formats::yaml::FromString(R"(
     initial_pool_size: 1
     max_pool_size: 5
+    allow_local_infile: true
   )"),
                               {}}};
 
@@ -0,0 +1,104 @@
+#pragma once
+
+/// @file userver/otlp/span_exporter_component.hpp
+/// @brief @copybrief otlp::SpanExporterComponent
+
+#include <functional>
+#include <memory>
+#include <string_view>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace impl {
+class Exporter;
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that sends the finished tracing::Span to an OpenTelemetry
+/// collector over OTLP/gRPC instead of writing them to the logs
+///
+/// The finished spans are put into a bounded queue without blocking, the
+/// spans that do not fit into the queue are dropped and counted in the
+/// `otlp.spans.dropped` metric. A background task takes the spans from the
+/// queue and sends them in batches of up to `max-batch-size` spans, a batch
+/// waits for the spans for `max-batch-delay` at most.
+///
+/// The spans are not written to the default logger and to the opentracing
+/// logger while the component is alive. The gRPC calls made by the component
+/// itself are not traced.
+///
+/// ## Tail sampling
+///
+/// SetSampler() installs a predicate that is called by the background task for
+/// each finished span before it is sent. As the span is already finished, the
+/// decision may use its duration and its tags, e.g. to send all the slow or the
+/// failed requests and only a fraction of the others:
+///
+/// @code
+/// exporter.SetSampler([](const tracing::SpanData& span) {
+///   return span.duration > std::chrono::milliseconds{100} ||
+///          utils::RandRange(100) == 0;
+/// });
+/// @endcode
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | address of the OpenTelemetry collector, e.g. `localhost:4317` | -
+/// factory-component | name of the ugrpc::client::ClientFactoryComponent for the client | grpc-client-factory
+/// service-name | `service.name` resource attribute of the spans | service name of the tracing::Tracer
+/// max-queue-size | max number of the finished spans waiting to be sent | 65535
+/// max-batch-size | max number of spans in a single export request | 512
+/// max-batch-delay | max time to wait for the spans of a batch | 100ms
+/// export-timeout | timeout of a single export request | 10s
+///
+/// ## Static configuration example:
+///
+/// @code
+///   otlp-span-exporter:
+///       endpoint: localhost:4317
+///       max-batch-size: 1024
+/// @endcode
+
+// clang-format on
+
+class SpanExporterComponent final : public components::LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of otlp::SpanExporterComponent
+  static constexpr std::string_view kName = "otlp-span-exporter";
+
+  /// Returns false if the span should not be sent
+  using Sampler = std::function<bool(const tracing::SpanData&)>;
+
+  SpanExporterComponent(const components::ComponentConfig& config,
+                        const components::ComponentContext& context);
+
+  ~SpanExporterComponent() override;
+
+  /// Replaces the tail sampling predicate, `nullptr` sends all the spans
+  void SetSampler(Sampler sampler);
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<impl::Exporter> exporter_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace otlp
+
+template <>
+inline constexpr bool components::kHasValidate<otlp::SpanExporterComponent> =
+    true;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,132 @@
+#include <otlp/exporter.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tracer.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+
+#include <otlp/span_converter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::impl {
+
+namespace {
+
+const std::string kServiceNameAttribute = "service.name";
+const std::string kInstrumentationScope = "userver";
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExporterStatistics& stats) {
+  writer["exported"] = stats.exported;
+  writer["dropped"] = stats.dropped;
+  writer["sampled_out"] = stats.sampled_out;
+  writer["invalid"] = stats.invalid;
+  writer["failed"] = stats.failed;
+}
+
+Exporter::Exporter(TraceServiceClient&& client, const ExporterConfig& config)
+    : client_(std::move(client)),
+      config_(config),
+      queue_(Queue::Create(config.max_queue_size)),
+      producer_(queue_->GetMultiProducer()) {
+  task_ = engine::CriticalAsyncNoSpan(
+      [this, consumer = queue_->GetConsumer()]() mutable {
+        // The export requests must not produce spans to export
+        tracing::Span span("otlp_export");
+        span.SetLocalLogLevel(logging::Level::kNone);
+
+        std::vector<tracing::SpanData> batch;
+        batch.reserve(config_.max_batch_size);
+        tracing::SpanData data;
+        while (consumer.Pop(data)) {
+          batch.push_back(std::move(data));
+          const auto deadline =
+              engine::Deadline::FromDuration(config_.max_batch_delay);
+          while (batch.size() < config_.max_batch_size &&
+                 consumer.Pop(data, deadline)) {
+            batch.push_back(std::move(data));
+          }
+          SendBatch(batch);
+        }
+      });
+}
+
+Exporter::~Exporter() { Stop(); }
+
+void Exporter::Export(tracing::SpanData&& span) noexcept {
+  if (!producer_.PushNoblock(std::move(span))) ++stats_.dropped;
+}
+
+void Exporter::SetSampler(SpanExporterComponent::Sampler sampler) {
+  sampler_.Assign(std::move(sampler));
+}
+
+void Exporter::Stop() noexcept {
+  if (task_.IsValid()) task_.SyncCancel();
+}
+
+void Exporter::SendBatch(std::vector<tracing::SpanData>& batch) {
+  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest
+      request;
+  auto& resource_spans = *request.add_resource_spans();
+
+  auto& service_name = *resource_spans.mutable_resource()->add_attributes();
+  service_name.set_key(kServiceNameAttribute);
+  service_name.mutable_value()->set_string_value(
+      config_.service_name.empty() ? batch.front().service_name
+                                   : config_.service_name);
+
+  auto& scope_spans = *resource_spans.add_scope_spans();
+  scope_spans.mutable_scope()->set_name(kInstrumentationScope);
+  auto& spans = *scope_spans.mutable_spans();
+  spans.Reserve(batch.size());
+
+  {
+    const auto sampler = sampler_.Read();
+    for (auto& data : batch) {
+      if (*sampler) {
+        try {
+          if (!(*sampler)(data)) {
+            ++stats_.sampled_out;
+            continue;
+          }
+        } catch (const std::exception& ex) {
+          LOG_LIMITED_ERROR() << "Span sampler failed, sending the span: "
+                              << ex;
+        }
+      }
+
+      if (!ConvertSpan(std::move(data), *spans.Add())) {
+        spans.RemoveLast();
+        ++stats_.invalid;
+      }
+    }
+  }
+  batch.clear();
+
+  const auto count = spans.size();
+  if (count == 0) return;
+
+  ugrpc::client::Qos qos;
+  qos.timeout = config_.export_timeout;
+  try {
+    client_.Export(request, std::make_unique<grpc::ClientContext>(), qos)
+        .Finish();
+    stats_.exported += utils::statistics::Rate{
+        static_cast<utils::statistics::Rate::ValueType>(count)};
+  } catch (const ugrpc::client::RpcError& ex) {
+    stats_.failed += utils::statistics::Rate{
+        static_cast<utils::statistics::Rate::ValueType>(count)};
+    LOG_LIMITED_WARNING() << "Failed to export " << count
+                          << " spans to the OpenTelemetry collector: " << ex;
+  }
+}
+
+}  // namespace otlp::impl
+
+USERVER_NAMESPACE_END
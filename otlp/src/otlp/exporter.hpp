@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/otlp/span_exporter_component.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::impl {
+
+using TraceServiceClient =
+    opentelemetry::proto::collector::trace::v1::TraceServiceClient;
+
+struct ExporterConfig final {
+  std::string service_name;
+  std::size_t max_queue_size{65535};
+  std::size_t max_batch_size{512};
+  std::chrono::milliseconds max_batch_delay{100};
+  std::chrono::milliseconds export_timeout{10'000};
+};
+
+struct ExporterStatistics final {
+  utils::statistics::RateCounter exported;
+  // did not fit into the queue
+  utils::statistics::RateCounter dropped;
+  utils::statistics::RateCounter sampled_out;
+  // have ids that are not valid in OpenTelemetry
+  utils::statistics::RateCounter invalid;
+  // were in the failed export requests
+  utils::statistics::RateCounter failed;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExporterStatistics& stats);
+
+class Exporter final : public tracing::SpanExporter {
+ public:
+  Exporter(TraceServiceClient&& client, const ExporterConfig& config);
+  ~Exporter() override;
+
+  void Export(tracing::SpanData&& span) noexcept override;
+
+  void SetSampler(SpanExporterComponent::Sampler sampler);
+
+  // Stops the background task, the spans left in the queue are dropped
+  void Stop() noexcept;
+
+  const ExporterStatistics& GetStatistics() const noexcept { return stats_; }
+
+ private:
+  using Queue = concurrent::NonFifoMpscQueue<tracing::SpanData>;
+
+  void ProcessSpans();
+  void SendBatch(std::vector<tracing::SpanData>& batch);
+
+  TraceServiceClient client_;
+  const ExporterConfig config_;
+  rcu::Variable<SpanExporterComponent::Sampler> sampler_;
+  ExporterStatistics stats_;
+
+  std::shared_ptr<Queue> queue_;
+  Queue::MultiProducer producer_;
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace otlp::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <otlp/span_converter.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::impl {
+
+namespace {
+
+constexpr std::size_t kTraceIdSize = 16;
+constexpr std::size_t kSpanIdSize = 8;
+
+const std::string kTimerSuffix = "_time";
+
+using RealMilliseconds = std::chrono::duration<double, std::milli>;
+
+bool DecodeId(std::string_view hex, std::size_t size, std::string& out) {
+  if (hex.size() != size * 2) return false;
+  return utils::encoding::FromHex(hex, out) == hex.size();
+}
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+void SetValue(opentelemetry::proto::common::v1::AnyValue& any,
+              const logging::LogExtra::Value& value) {
+  std::visit(
+      [&any](const auto& alternative) {
+        using T = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+          any.set_string_value(alternative);
+        } else if constexpr (std::is_floating_point_v<T>) {
+          any.set_double_value(alternative);
+        } else {
+          any.set_int_value(static_cast<std::int64_t>(alternative));
+        }
+      },
+      value);
+}
+
+bool IsErrorFlag(const logging::LogExtra::Value& value) {
+  return std::visit(
+      [](const auto& alternative) {
+        using T = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+          return alternative == "true" || alternative == "1";
+        } else {
+          return alternative != 0;
+        }
+      },
+      value);
+}
+
+}  // namespace
+
+bool ConvertSpan(tracing::SpanData&& data,
+                 opentelemetry::proto::trace::v1::Span& span) {
+  if (!DecodeId(data.trace_id, kTraceIdSize, *span.mutable_trace_id()) ||
+      !DecodeId(data.span_id, kSpanIdSize, *span.mutable_span_id())) {
+    return false;
+  }
+  // the root spans have no parent, foreign parent ids are not exported
+  if (!DecodeId(data.parent_id, kSpanIdSize,
+                *span.mutable_parent_span_id())) {
+    span.clear_parent_span_id();
+  }
+
+  span.set_name(std::move(data.name));
+  span.set_kind(opentelemetry::proto::trace::v1::Span::SPAN_KIND_INTERNAL);
+  span.set_start_time_unix_nano(ToUnixNano(data.start_time));
+  span.set_end_time_unix_nano(ToUnixNano(
+      data.start_time +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          data.duration)));
+
+  auto& attributes = *span.mutable_attributes();
+  attributes.Reserve(data.tags.size() + data.timings.size());
+  for (auto& [key, value] : data.tags) {
+    if (key == tracing::kErrorFlag && IsErrorFlag(value)) {
+      span.mutable_status()->set_code(
+          opentelemetry::proto::trace::v1::Status::STATUS_CODE_ERROR);
+    }
+    auto& attribute = *attributes.Add();
+    SetValue(*attribute.mutable_value(), value);
+    attribute.set_key(std::move(key));
+  }
+
+  // same as the '<name>_time' tags of the span log records
+  for (auto& [key, duration] : data.timings) {
+    auto& attribute = *attributes.Add();
+    attribute.set_key(std::move(key) + kTimerSuffix);
+    attribute.mutable_value()->set_double_value(
+        std::chrono::duration_cast<RealMilliseconds>(duration).count());
+  }
+
+  return true;
+}
+
+}  // namespace otlp::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <userver/tracing/span_exporter.hpp>
+
+#include <opentelemetry/proto/trace/v1/trace.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::impl {
+
+// Fills the OTLP span from the finished tracing::Span. Returns false if the
+// ids of the span are not hex encoded 16 byte trace id and 8 byte span id,
+// e.g. if they came from a client with a foreign tracing system.
+bool ConvertSpan(tracing::SpanData&& data,
+                 opentelemetry::proto::trace::v1::Span& span);
+
+}  // namespace otlp::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <otlp/span_converter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+tracing::SpanData MakeSpanData() {
+  tracing::SpanData data;
+  data.name = "span_name";
+  data.trace_id = "0123456789abcdef0123456789abcdef";
+  data.span_id = "0123456789abcdef";
+  data.parent_id = "fedcba9876543210";
+  data.start_time = std::chrono::system_clock::time_point{
+      std::chrono::seconds{1'000'000'000}};
+  data.duration = std::chrono::milliseconds{15};
+  data.tags.emplace_back("http.method", "GET");
+  data.tags.emplace_back("meta_code", 200);
+  data.timings.emplace_back("xxx", std::chrono::microseconds{1500});
+  return data;
+}
+
+}  // namespace
+
+TEST(OtlpSpanConverter, Basic) {
+  opentelemetry::proto::trace::v1::Span span;
+  ASSERT_TRUE(otlp::impl::ConvertSpan(MakeSpanData(), span));
+
+  EXPECT_EQ(span.name(), "span_name");
+  EXPECT_EQ(utils::encoding::ToHex(span.trace_id()),
+            "0123456789abcdef0123456789abcdef");
+  EXPECT_EQ(utils::encoding::ToHex(span.span_id()), "0123456789abcdef");
+  EXPECT_EQ(utils::encoding::ToHex(span.parent_span_id()), "fedcba9876543210");
+  EXPECT_EQ(span.start_time_unix_nano(), 1'000'000'000'000'000'000);
+  EXPECT_EQ(span.end_time_unix_nano() - span.start_time_unix_nano(),
+            15'000'000);
+  EXPECT_EQ(span.status().code(),
+            opentelemetry::proto::trace::v1::Status::STATUS_CODE_UNSET);
+
+  ASSERT_EQ(span.attributes_size(), 3);
+  EXPECT_EQ(span.attributes(0).key(), "http.method");
+  EXPECT_EQ(span.attributes(0).value().string_value(), "GET");
+  EXPECT_EQ(span.attributes(1).key(), "meta_code");
+  EXPECT_EQ(span.attributes(1).value().int_value(), 200);
+  EXPECT_EQ(span.attributes(2).key(), "xxx_time");
+  EXPECT_DOUBLE_EQ(span.attributes(2).value().double_value(), 1.5);
+}
+
+TEST(OtlpSpanConverter, Error) {
+  auto data = MakeSpanData();
+  data.tags.emplace_back(tracing::kErrorFlag, 1);
+
+  opentelemetry::proto::trace::v1::Span span;
+  ASSERT_TRUE(otlp::impl::ConvertSpan(std::move(data), span));
+  EXPECT_EQ(span.status().code(),
+            opentelemetry::proto::trace::v1::Status::STATUS_CODE_ERROR);
+}
+
+TEST(OtlpSpanConverter, ForeignIds) {
+  auto data = MakeSpanData();
+  data.parent_id = "foreign-parent-id";
+
+  opentelemetry::proto::trace::v1::Span span;
+  ASSERT_TRUE(otlp::impl::ConvertSpan(std::move(data), span));
+  EXPECT_TRUE(span.parent_span_id().empty());
+
+  data = MakeSpanData();
+  data.trace_id = "foreign-trace-id";
+  EXPECT_FALSE(otlp::impl::ConvertSpan(std::move(data), span));
+}
+
+USERVER_NAMESPACE_END
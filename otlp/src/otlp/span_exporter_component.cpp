@@ -0,0 +1,113 @@
+#include <userver/otlp/span_exporter_component.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/ugrpc/client/client_factory_component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <otlp/exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+impl::ExporterConfig ParseExporterConfig(
+    const components::ComponentConfig& config) {
+  impl::ExporterConfig result;
+  result.service_name = config["service-name"].As<std::string>({});
+  result.max_queue_size =
+      config["max-queue-size"].As<std::size_t>(result.max_queue_size);
+  result.max_batch_size =
+      config["max-batch-size"].As<std::size_t>(result.max_batch_size);
+  result.max_batch_delay =
+      config["max-batch-delay"].As<std::chrono::milliseconds>(
+          result.max_batch_delay);
+  result.export_timeout =
+      config["export-timeout"].As<std::chrono::milliseconds>(
+          result.export_timeout);
+  return result;
+}
+
+}  // namespace
+
+SpanExporterComponent::SpanExporterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : LoggableComponentBase(config, context) {
+  auto& factory = context
+                      .FindComponent<ugrpc::client::ClientFactoryComponent>(
+                          config["factory-component"].As<std::string>(
+                              ugrpc::client::ClientFactoryComponent::kName))
+                      .GetFactory();
+
+  exporter_ = std::make_shared<impl::Exporter>(
+      factory.MakeClient<impl::TraceServiceClient>(
+          config.Name(), config["endpoint"].As<std::string>()),
+      ParseExporterConfig(config));
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("otlp.spans",
+                          [this](utils::statistics::Writer& writer) {
+                            writer = exporter_->GetStatistics();
+                          });
+
+  tracing::SetSpanExporter(exporter_);
+}
+
+SpanExporterComponent::~SpanExporterComponent() {
+  tracing::SetSpanExporter({});
+  statistics_holder_.Unregister();
+  exporter_->Stop();
+}
+
+void SpanExporterComponent::SetSampler(Sampler sampler) {
+  exporter_->SetSampler(std::move(sampler));
+}
+
+yaml_config::Schema SpanExporterComponent::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: Exports the finished spans to an OpenTelemetry collector
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: address of the OpenTelemetry collector
+    factory-component:
+        type: string
+        description: |
+            name of the ugrpc::client::ClientFactoryComponent for the client
+        defaultDescription: grpc-client-factory
+    service-name:
+        type: string
+        description: service.name resource attribute of the spans
+        defaultDescription: service name of the tracing::Tracer
+    max-queue-size:
+        type: integer
+        description: max number of the finished spans waiting to be sent
+        defaultDescription: 65535
+        minimum: 1
+    max-batch-size:
+        type: integer
+        description: max number of spans in a single export request
+        defaultDescription: 512
+        minimum: 1
+    max-batch-delay:
+        type: string
+        description: max time to wait for the spans of a batch
+        defaultDescription: 100ms
+    export-timeout:
+        type: string
+        description: timeout of a single export request
+        defaultDescription: 10s
+)");
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
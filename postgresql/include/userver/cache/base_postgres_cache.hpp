@@ -63,6 +63,7 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL, 0 to fetch all rows in one request | 1000
+/// chunk-prefetch | number of chunks to request ahead while the current one is parsed, 0 to request them one by one | 0
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -428,6 +429,7 @@ class PostgreCache final
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::size_t chunk_prefetch_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -447,7 +449,8 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      chunk_prefetch_{config["chunk-prefetch"].As<size_t>(0)} {
   if (this->GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !kIncrementalUpdates) {
@@ -576,6 +579,7 @@ void PostgreCache<PostgreCachePolicy>::Update(
           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
       auto portal =
           trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
+      portal.SetPrefetch(chunk_prefetch_);
       while (portal) {
         scope.Reset(std::string{pg_cache::detail::kFetchStage});
         auto res = portal.Fetch(chunk_size_);
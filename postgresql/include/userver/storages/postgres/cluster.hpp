@@ -4,6 +4,8 @@
 /// @brief @copybrief storages::postgres::Cluster
 
 #include <memory>
+#include <string_view>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
@@ -16,8 +18,11 @@
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/database.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -163,6 +168,11 @@ class Cluster {
   /// @brief Execute a statement at host of specified type.
   /// @note You must specify at least one role from ClusterHostType here
   ///
+  /// If the `shared_session_size` of the pool settings is set, the statements
+  /// with the arguments of built-in types are multiplexed over a few shared
+  /// connections in pipeline mode instead of taking a connection each. Every
+  /// statement still runs in its own implicit transaction.
+  ///
   /// @snippet storages/postgres/tests/landing_test.cpp Exec sample
   ///
   /// @warning Do NOT create a query string manually by embedding arguments!
@@ -193,8 +203,40 @@ class Cluster {
   ResultSet Execute(ClusterHostTypeFlags flags,
                     OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
+
+  /// @brief Execute independent statements at host of specified type in a
+  /// single network roundtrip.
+  /// @note You must specify at least one role from ClusterHostType here
+  ///
+  /// The statements are sent at once in PostgreSQL pipeline mode and results
+  /// are returned in the order of statements in the batch. The batch runs in
+  /// a single implicit transaction: if a statement fails, the following
+  /// statements are not executed and the error is thrown. The whole batch
+  /// shares a single execute timeout.
+  std::vector<ResultSet> ExecuteBatch(ClusterHostTypeFlags flags,
+                                      const QueryBatch& batch);
+
+  /// @brief Execute independent statements in a single network roundtrip with
+  /// specified host selection rules and command control settings.
+  std::vector<ResultSet> ExecuteBatch(ClusterHostTypeFlags flags,
+                                      OptionalCommandControl statement_cmd_ctl,
+                                      const QueryBatch& batch);
   /// @}
 
+  /// @brief Subscribe to the notifications of a channel, see
+  /// https://www.postgresql.org/docs/current/sql-listen.html
+  ///
+  /// All the subscriptions of the cluster share a single dedicated connection
+  /// to the master, as NOTIFY is not delivered to the standbys. The connection
+  /// is reestablished on errors and listens to the channels again, the
+  /// notifications sent in between are lost.
+  ///
+  /// The execute timeout of the command control limits the wait for the
+  /// connection to start listening to the channel.
+  /// @throws ConnectionTimeoutError if the channel is not listened in time
+  NotifyScope Listen(std::string_view channel,
+                     OptionalCommandControl cmd_ctl = {});
+
   /// Replaces globally updated command control with a static user-provided one
   void SetDefaultCommandControl(CommandControl);
 
@@ -224,6 +266,10 @@ class Cluster {
  private:
   detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  bool IsSharedSessionEnabled() const;
+  ResultSet ExecuteShared(ClusterHostTypeFlags, OptionalCommandControl,
+                          const Query& query, ParameterStore&& params);
+
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
       OptionalCommandControl cmd_ctl) const;
@@ -245,6 +291,16 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  // The shared connections know nothing about the user types
+  if constexpr (((io::IsTypeMappedToSystem<Args>() ||
+                  io::IsTypeMappedToSystemArray<Args>()) &&
+                 ...)) {
+    if (IsSharedSessionEnabled()) {
+      ParameterStore params;
+      (params.PushBack(args), ...);
+      return ExecuteShared(flags, statement_cmd_ctl, query, std::move(params));
+    }
+  }
   auto ntrx = Start(flags, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
@@ -44,6 +44,10 @@ enum class ClusterHostType {
 
   /// Chooses a host with the lowest RTT
   kNearest = 0x10,
+
+  /// Chooses a host by the observed query latency, the number of queries in
+  /// flight and the replication lag, preferring the hosts with the lowest RTT
+  kAdaptive = 0x20,
   /// @}
 };
 
@@ -54,7 +58,8 @@ constexpr ClusterHostTypeFlags kClusterHostRolesMask{
     ClusterHostType::kSlave};
 
 constexpr ClusterHostTypeFlags kClusterHostStrategyMask{
-    ClusterHostType::kRoundRobin, ClusterHostType::kNearest};
+    ClusterHostType::kRoundRobin, ClusterHostType::kNearest,
+    ClusterHostType::kAdaptive};
 
 std::string ToString(ClusterHostType);
 std::string ToString(ClusterHostTypeFlags);
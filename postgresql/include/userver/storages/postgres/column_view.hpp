@@ -0,0 +1,115 @@
+#pragma once
+
+/// @file userver/storages/postgres/column_view.hpp
+/// @brief @copybrief storages::postgres::ColumnView
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/storages/postgres/io/chrono.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool kHasColumnDecoder =
+    std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+    std::is_same_v<T, Bigint> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double> || std::is_same_v<T, TimePoint> ||
+    std::is_same_v<T, TimePointTz> || std::is_same_v<T, std::string_view>;
+
+}  // namespace detail
+
+/// @brief Columnar access to a result set.
+///
+/// Gives access to the binary buffers of the fields of a single column
+/// without copying them and decodes a whole column at once. Columns of
+/// Smallint, Integer, Bigint, float, double, TimePoint, TimePointTz and
+/// std::string_view are decoded in a tight loop over the buffers, other types
+/// are parsed field by field with the regular parsers.
+///
+/// The view shares the ownership of the result set data, so the buffers and
+/// the std::string_view values stay valid while the view or the result set
+/// is alive.
+///
+/// @code
+/// auto res = trx.Execute("SELECT id, name FROM foo");
+/// const auto ids = ColumnView{res, 0}.AsVector<Bigint>();
+/// const auto names = ColumnView{res, "name"}.AsVector<std::string_view>();
+/// @endcode
+class ColumnView {
+ public:
+  using size_type = std::size_t;
+
+  /// @throws FieldIndexOutOfBounds if the result set has no such column
+  ColumnView(const ResultSet& res, size_type column);
+  /// @throws FieldNameDoesntExist if the result set has no such column
+  ColumnView(const ResultSet& res, const std::string& name);
+
+  /// Number of rows
+  size_type Size() const;
+  bool IsEmpty() const { return Size() == 0; }
+
+  size_type ColumnIndex() const { return column_; }
+  std::string_view Name() const;
+  Oid GetTypeOid() const;
+
+  bool IsNull(size_type row) const;
+  /// Whether the column contains at least one NULL
+  bool HasNulls() const;
+
+  /// @brief Binary buffer of a field as received from the server, empty for
+  /// NULL
+  /// @throws RowIndexOutOfBounds if the row index is out of bounds
+  std::string_view GetRawBuffer(size_type row) const;
+
+  /// @brief Parses a single field with the regular parsers
+  template <typename T>
+  T As(size_type row) const {
+    return res_[row][column_].template As<T>();
+  }
+
+  /// @brief Parses the whole column
+  /// @throws FieldValueIsNull if a field is NULL and T is not nullable
+  template <typename T>
+  std::vector<T> AsVector() const;
+
+ private:
+  void Decode(std::vector<Smallint>& values) const;
+  void Decode(std::vector<Integer>& values) const;
+  void Decode(std::vector<Bigint>& values) const;
+  void Decode(std::vector<float>& values) const;
+  void Decode(std::vector<double>& values) const;
+  void Decode(std::vector<TimePoint>& values) const;
+  void Decode(std::vector<TimePointTz>& values) const;
+  void Decode(std::vector<std::string_view>& values) const;
+
+  ResultSet res_;
+  size_type column_;
+};
+
+template <typename T>
+std::vector<T> ColumnView::AsVector() const {
+  std::vector<T> values;
+  if constexpr (detail::kHasColumnDecoder<T>) {
+    Decode(values);
+  } else {
+    const auto size = Size();
+    values.reserve(size);
+    for (size_type row = 0; row < size; ++row) {
+      values.push_back(As<T>(row));
+    }
+  }
+  return values;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -129,6 +129,8 @@ namespace components {
 /// max_pool_size           | maximum number of created connections                     | 15
 /// max_queue_size          | maximum number of clients waiting for a connection        | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// idle_buffer_size        | number of idle connections to open ahead of the observed load (0 - grow on demand only) | 0
+/// shared_session_size     | number of connections that multiplex the single statements executed out of transactions (0 - disabled) | 0
 /// connlimit_mode          | max_connections setup mode (manual or auto)               | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings | --
 
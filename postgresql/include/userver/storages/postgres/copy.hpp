@@ -0,0 +1,178 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Binary COPY FROM STDIN / COPY TO STDOUT streaming
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+
+std::string MakeCopyStatement(const std::string& table,
+                              const std::vector<std::string>& columns,
+                              bool is_copy_in);
+
+}  // namespace detail
+
+/// @brief Writes rows into a table with `COPY ... FROM STDIN` in the binary
+/// format, see storages::postgres::Transaction::CopyIn().
+///
+/// Rows are serialized with the same formatters as the query parameters and
+/// are sent in chunks while being written, so millions of rows never reside
+/// in memory at once. The writer must not outlive the transaction and no
+/// other statements could be executed in the transaction until Finish() is
+/// called. An unfinished COPY is aborted on destruction.
+///
+/// @code
+/// auto writer = trx.CopyIn("foo", {"id", "name"});
+/// for (const auto& [id, name] : values) writer.WriteRow(id, name);
+/// const auto rows = writer.Finish();
+/// trx.Commit();
+/// @endcode
+class CopyInWriter {
+ public:
+  /// @cond
+  CopyInWriter(detail::Connection* conn, std::size_t column_count);
+  /// @endcond
+
+  CopyInWriter(CopyInWriter&&) noexcept;
+  CopyInWriter& operator=(CopyInWriter&&) = delete;
+  ~CopyInWriter();
+
+  /// @brief Writes a row of column values, the values are mapped to
+  /// PostgreSQL types just like query parameters
+  template <typename... Columns>
+  void WriteRow(const Columns&... columns);
+
+  /// @brief Writes a row from a row type object, see @ref pg_user_row_types
+  template <typename Row>
+  void WriteRowObject(const Row& row);
+
+  /// @brief Sends the rest of the data and waits for the COPY to complete
+  /// @returns the number of rows copied
+  std::size_t Finish();
+
+ private:
+  void CheckColumnCount(std::size_t count) const;
+  void WriteInt16(std::int16_t value);
+  void FlushIfNeeded();
+
+  detail::Connection* conn_;
+  const UserTypes* types_;
+  std::size_t column_count_;
+  std::size_t rows_count_{0};
+  std::string buffer_;
+};
+
+/// @brief Reads rows of a table with `COPY ... TO STDOUT` in the binary
+/// format, see storages::postgres::Transaction::CopyOut().
+///
+/// Each row is parsed while being received. The reader must not outlive the
+/// transaction and no other statements could be executed in the transaction
+/// until all the rows are read. Destroying the reader earlier drops the
+/// connection.
+///
+/// @code
+/// auto reader = trx.CopyOut("foo", {"id", "name"});
+/// int id = 0;
+/// std::string name;
+/// while (reader.ReadRow(id, name)) Process(id, name);
+/// @endcode
+class CopyOutReader {
+ public:
+  /// @cond
+  CopyOutReader(detail::Connection* conn, std::size_t column_count);
+  /// @endcond
+
+  CopyOutReader(CopyOutReader&&) noexcept;
+  CopyOutReader& operator=(CopyOutReader&&) = delete;
+  ~CopyOutReader();
+
+  /// @brief Reads the next row into the column values
+  /// @returns false once all the rows are read
+  template <typename... Columns>
+  bool ReadRow(Columns&... columns);
+
+  /// @brief Reads the next row into a row type object, see
+  /// @ref pg_user_row_types
+  /// @returns false once all the rows are read
+  template <typename Row>
+  bool ReadRowObject(Row& row);
+
+ private:
+  bool NextRow(std::size_t column_count);
+  io::FieldBuffer GetRowBuffer() const;
+  void Consume(const io::FieldBuffer& rest);
+
+  template <typename T>
+  void ReadField(io::FieldBuffer& buffer, T& value) const;
+
+  detail::Connection* conn_;
+  const UserTypes* types_;
+  std::size_t column_count_;
+  std::string buffer_;
+  std::size_t offset_{0};
+  bool is_header_read_{false};
+};
+
+template <typename... Columns>
+void CopyInWriter::WriteRow(const Columns&... columns) {
+  CheckColumnCount(sizeof...(Columns));
+  WriteInt16(sizeof...(Columns));
+  (io::WriteRawBinary(*types_, buffer_, columns), ...);
+  ++rows_count_;
+  FlushIfNeeded();
+}
+
+template <typename Row>
+void CopyInWriter::WriteRowObject(const Row& row) {
+  static_assert(io::traits::kIsRowType<Row>,
+                "Row type should be a tuple, an aggregate or a class with "
+                "Introspect method, see `uPg: Typed PostgreSQL results`");
+  std::apply([this](const auto&... columns) { WriteRow(columns...); },
+             io::RowType<Row>::GetTuple(row));
+}
+
+template <typename... Columns>
+bool CopyOutReader::ReadRow(Columns&... columns) {
+  if (!NextRow(sizeof...(Columns))) return false;
+  auto buffer = GetRowBuffer();
+  (ReadField(buffer, columns), ...);
+  Consume(buffer);
+  return true;
+}
+
+template <typename Row>
+bool CopyOutReader::ReadRowObject(Row& row) {
+  static_assert(io::traits::kIsRowType<Row>,
+                "Row type should be a tuple, an aggregate or a class with "
+                "Introspect method, see `uPg: Typed PostgreSQL results`");
+  return std::apply(
+      [this](auto&... columns) { return ReadRow(columns...); },
+      io::RowType<Row>::GetTuple(row));
+}
+
+template <typename T>
+void CopyOutReader::ReadField(io::FieldBuffer& buffer, T& value) const {
+  buffer.ReadRaw(value, types_->GetTypeBufferCategories(),
+                 io::traits::kTypeBufferCategory<T>);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
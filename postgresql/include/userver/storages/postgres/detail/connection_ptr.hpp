@@ -33,6 +33,7 @@ class ConnectionPtr {
 
   const StatementTimingsStorage* GetStatementTimingsStorage() const;
   std::optional<dynamic_config::Source> GetConfigSource() const;
+  void AccountCancelledByDeadline() const;
 
  private:
   void Reset(std::unique_ptr<Connection> conn,
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
@@ -64,6 +66,12 @@ class NonTransaction {
   /// Suspends coroutine for execution.
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const std::string& statement, const ParameterStore& store);
+
+  /// Execute independent statements in a single network roundtrip.
+  ///
+  /// Suspends coroutine for execution.
+  std::vector<ResultSet> ExecuteBatch(OptionalCommandControl statement_cmd_ctl,
+                                      const QueryBatch& batch);
   /// @}
  private:
   ResultSet DoExecute(const Query& query, const detail::QueryParameters& params,
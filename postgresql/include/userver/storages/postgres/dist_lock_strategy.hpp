@@ -3,6 +3,8 @@
 /// @file userver/storages/postgres/dist_lock_strategy.hpp
 /// @brief @copybrief storages::postgres::DistLockStrategy
 
+#include <memory>
+
 #include <userver/dist_lock/dist_lock_settings.hpp>
 #include <userver/dist_lock/dist_lock_strategy.hpp>
 #include <userver/engine/deadline.hpp>
@@ -13,7 +15,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
-/// Postgres distributed locking strategy
+namespace detail {
+class DistLockAcquireBatcher;
+}  // namespace detail
+
+/// @brief Postgres distributed locking strategy
+///
+/// The concurrent acquire and prolong queries of all the locks in the same
+/// table of the same cluster are sent in a single network roundtrip, so many
+/// locks held by a service do not multiply the number of roundtrips to the
+/// database.
 class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
  public:
   DistLockStrategy(ClusterPtr cluster, const std::string& table,
@@ -30,7 +41,7 @@ class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
  private:
   ClusterPtr cluster_;
   rcu::Variable<CommandControl> cc_;
-  const std::string acquire_query_;
+  const std::shared_ptr<detail::DistLockAcquireBatcher> acquire_batcher_;
   const std::string release_query_;
   const std::string lock_name_;
   const std::string owner_prefix_;
@@ -4,7 +4,9 @@
 /// @brief JSON I/O support
 /// @ingroup userver_postgres_parse_and_format
 
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/buffer_io_base.hpp>
@@ -15,6 +17,9 @@
 #include <userver/storages/postgres/io/user_types.hpp>
 
 #include <userver/formats/json.hpp>
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,11 +30,69 @@ using PlainJson = USERVER_NAMESPACE::utils::StrongTypedef<
     struct PlainJsonTag, formats::json::Value,
     USERVER_NAMESPACE::utils::StrongTypedefOps::kCompareTransparent>;
 
+/// @brief Wrapper to read a json or jsonb field right into a C++ type with a
+/// formats::json SAX parser. The text of the field is parsed in place without
+/// building a formats::json::Value.
+///
+/// `Parser` is a default constructible formats::json::parser::TypedParser
+/// derivative or a proxy parser, see formats::json::parser::TypedParser.
+///
+/// @code
+/// auto name = res[0][0].As<pg::TypedJson<fjp::StringParser>>().value;
+/// @endcode
+template <typename Parser>
+struct TypedJson {
+  using ValueType = typename Parser::ResultType;
+
+  ValueType value{};
+};
+
+namespace io::detail {
+
+template <typename Item, typename ItemParser, typename Array>
+class JsonArrayParser final {
+ public:
+  using ResultType = Array;
+
+  JsonArrayParser() : array_parser_(item_parser_) {}
+  JsonArrayParser(const JsonArrayParser&) = delete;
+  JsonArrayParser& operator=(const JsonArrayParser&) = delete;
+
+  void Reset() { array_parser_.Reset(); }
+
+  void Subscribe(formats::json::parser::Subscriber<Array>& subscriber) {
+    array_parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return array_parser_.GetParser(); }
+
+ private:
+  ItemParser item_parser_;
+  formats::json::parser::ArrayParser<Item, ItemParser, Array> array_parser_;
+};
+
+}  // namespace io::detail
+
+/// @brief Reads a json or jsonb array into a container item by item with
+/// `ItemParser`, see storages::postgres::TypedJson.
+///
+/// @code
+/// std::vector<int> ids =
+///     res[0][0].As<pg::TypedJsonArray<int, fjp::IntParser>>().value;
+/// @endcode
+template <typename Item, typename ItemParser,
+          typename Array = std::vector<Item>>
+using TypedJsonArray =
+    TypedJson<io::detail::JsonArrayParser<Item, ItemParser, Array>>;
+
 namespace io {
 namespace detail {
 
 inline constexpr char kJsonbVersion = 1;
 
+/// Returns the JSON text of a json or jsonb field
+std::string_view GetJsonText(const FieldBuffer& buffer);
+
 struct JsonParser : BufferParserBase<formats::json::Value> {
   using BaseType = BufferParserBase<formats::json::Value>;
   using BaseType::BaseType;
@@ -60,6 +123,25 @@ struct JsonFormatter : BufferFormatterBase<JsonValue> {
 
 }  // namespace detail
 
+template <typename Parser>
+struct BufferParser<TypedJson<Parser>>
+    : detail::BufferParserBase<TypedJson<Parser>> {
+  using BaseType = detail::BufferParserBase<TypedJson<Parser>>;
+  using BaseType::BaseType;
+  using ValueType = typename TypedJson<Parser>::ValueType;
+
+  void operator()(const FieldBuffer& buffer) {
+    Parser parser;
+    parser.Reset();
+    formats::json::parser::SubscriberSink<ValueType> sink{this->value.value};
+    parser.Subscribe(sink);
+
+    formats::json::parser::ParserState state;
+    state.PushParser(parser.GetParser());
+    state.ProcessInput(detail::GetJsonText(buffer));
+  }
+};
+
 namespace traits {
 
 template <>
@@ -90,6 +172,10 @@ struct CppToSystemPg<formats::json::Value>
 template <>
 struct CppToSystemPg<PlainJson> : PredefinedOid<PredefinedOids::kJson> {};
 
+template <typename Parser>
+struct CppToSystemPg<TypedJson<Parser>>
+    : PredefinedOid<PredefinedOids::kJsonb> {};
+
 }  // namespace io
 }  // namespace storages::postgres
 
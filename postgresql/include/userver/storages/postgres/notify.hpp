@@ -0,0 +1,73 @@
+#pragma once
+
+/// @file userver/storages/postgres/notify.hpp
+/// @brief Asynchronous notifications of LISTEN / NOTIFY
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+class NotifyListener;
+}  // namespace detail
+
+/// @brief A notification sent with `NOTIFY channel, 'payload'` or
+/// `pg_notify('channel', 'payload')`
+struct Notification {
+  std::string channel;
+  /// Empty if the notification has no payload
+  std::string payload;
+  /// Process ID of the server backend that has sent the notification
+  std::int32_t backend_pid{0};
+};
+
+/// @brief Subscription to the notifications of a channel, see
+/// storages::postgres::Cluster::Listen().
+///
+/// The notifications are queued until they are taken with WaitNotify(). The
+/// subscription is cancelled on destruction.
+///
+/// @code
+/// auto scope = cluster->Listen("foo_changes");
+/// while (auto notification = scope.WaitNotify(engine::Deadline{})) {
+///   Invalidate(notification->payload);
+/// }
+/// @endcode
+class NotifyScope final {
+ public:
+  using Queue = concurrent::SpscQueue<Notification>;
+
+  /// @cond
+  NotifyScope(std::shared_ptr<detail::NotifyListener> listener,
+              std::string channel, std::uint64_t id, Queue::Consumer consumer);
+  /// @endcond
+
+  NotifyScope(NotifyScope&&) noexcept;
+  NotifyScope& operator=(NotifyScope&&) = delete;
+  ~NotifyScope();
+
+  const std::string& GetChannel() const noexcept { return channel_; }
+
+  /// @brief Waits for the next notification of the channel
+  /// @returns std::nullopt on the deadline, on the task cancellation or if
+  /// the cluster is destroyed
+  std::optional<Notification> WaitNotify(engine::Deadline deadline);
+
+ private:
+  std::shared_ptr<detail::NotifyListener> listener_;
+  std::string channel_;
+  std::uint64_t id_;
+  Queue::Consumer consumer_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -184,10 +184,20 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Number of idle connections to open ahead of the observed load
+  /// (0 - pool grows on demand only)
+  size_t idle_buffer_size{0};
+
+  /// Number of connections that are shared by the single statements executed
+  /// out of transactions (0 - every statement takes a connection exclusively)
+  size_t shared_session_size{0};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           idle_buffer_size == rhs.idle_buffer_size &&
+           shared_session_size == rhs.shared_session_size;
   }
 };
 
@@ -41,13 +41,24 @@ class Portal {
 
   ResultSet Fetch(std::uint32_t n_rows);
 
+  /// @brief Requests up to `window` batches ahead of the one being fetched,
+  /// so that they are transferred while the current batch is processed.
+  ///
+  /// The batches are requested in pipeline mode with the `n_rows` of the
+  /// Fetch call that requested them, so all the Fetch calls of a prefetching
+  /// portal must use the same non-zero `n_rows`. The connection cannot be
+  /// used for other queries while there are batches requested ahead, they are
+  /// awaited and discarded on destruction. Has no effect if pipelining is not
+  /// supported by libpq. 0 disables prefetching, the default.
+  void SetPrefetch(std::size_t window);
+
   bool Done() const;
   std::size_t FetchedSoFar() const;
 
   explicit operator bool() const { return !Done(); }
 
  private:
-  static constexpr std::size_t kImplSize = 88;
+  static constexpr std::size_t kImplSize = 112;
   static constexpr std::size_t kImplAlign = 8;
 
   struct Impl;
@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/storages/postgres/query_batch.hpp
+/// @brief @copybrief storages::postgres::QueryBatch
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @ingroup userver_containers
+///
+/// @brief A list of independent statements with their parameters that are
+/// sent to the database at once, see storages::postgres::Cluster::ExecuteBatch
+/// and storages::postgres::Transaction::ExecuteBatch.
+///
+/// @code
+/// postgres::ParameterStore params;
+/// params.PushBack(user_id);
+///
+/// postgres::QueryBatch batch;
+/// batch.Add("SELECT name FROM users WHERE id = $1", std::move(params));
+/// batch.Add("SELECT count(*) FROM orders");
+/// auto results = cluster->ExecuteBatch(ClusterHostType::kSlave, batch);
+/// @endcode
+class QueryBatch {
+ public:
+  struct Entry {
+    Query query;
+    ParameterStore params;
+  };
+
+  QueryBatch() = default;
+  QueryBatch(QueryBatch&&) = default;
+  QueryBatch& operator=(QueryBatch&&) = default;
+
+  /// @brief Adds a statement to the end of the batch.
+  QueryBatch& Add(Query query, ParameterStore params = {}) {
+    entries_.push_back({std::move(query), std::move(params)});
+    return *this;
+  }
+
+  /// Returns whether the batch is empty.
+  bool IsEmpty() const { return entries_.empty(); }
+
+  /// Returns the number of statements in the batch.
+  std::size_t Size() const { return entries_.size(); }
+
+  /// @cond
+  const std::vector<Entry>& GetEntries() const { return entries_; }
+  /// @endcond
+
+ private:
+  std::vector<Entry> entries_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -221,6 +221,7 @@ class RowDescription {
 
 class Row;
 class ResultSet;
+class ColumnView;
 template <typename T, typename ExtractionTag>
 class TypedResultSet;
 
@@ -671,6 +672,7 @@ class ResultSet {
   template <typename T, typename Tag>
   friend class TypedResultSet;
   friend class ConnectionImpl;
+  friend class ColumnView;
 
   std::shared_ptr<detail::ResultWrapper> pimpl_;
 };
@@ -47,6 +47,8 @@ struct TransactionStatistics {
   /// to pretty uniqueness of names. Nevertheless we would like to see them to
   /// diagnose certain kinds of problems
   Counter duplicate_prepared_statements = 0;
+  /// Number of query batches executed
+  Counter batch_total = 0;
 
   // TODO pick reasonable resolution for transaction
   // execution times
@@ -63,6 +65,8 @@ struct TransactionStatistics {
   /// Return to pool percentile (difference between trx_end_time and time the
   /// connection has been returned to the pool)
   PercentileAccumulator return_to_pool_percentile;
+  /// Max number of queries sent in a single pipeline by a transaction
+  PercentileAccumulator pipeline_depth_percentile;
 };
 
 /// @brief Template connection statistics storage
@@ -86,6 +90,10 @@ struct ConnectionStatistics {
   Counter error_timeout = 0;
   /// Number of maximum allowed waiting requests
   Counter max_queue_size = 0;
+  /// Number of connections opened ahead of the observed load
+  Counter warmup_total = 0;
+  /// Pool size predicted by the pool sizing controller
+  Counter target_size = 0;
 
   /// Prepared statements count min-max-avg
   MmaAccumulator prepared_statements;
@@ -100,6 +108,17 @@ struct InstanceTopologyStatistics {
   MmaAccumulator replication_lag;
 };
 
+/// @brief Template host selection statistics storage
+template <typename Counter>
+struct HostSelectionStatistics {
+  /// Number of times the host was chosen by ClusterHostType::kAdaptive
+  Counter selected_total = 0;
+  /// Number of times the host was chosen while not being the nearest one
+  Counter remote_selected_total = 0;
+  /// Smoothed query latency in microseconds
+  Counter query_latency = 0;
+};
+
 /// @brief Template instance statistics storage
 template <typename Counter, typename PercentileAccumulator,
           typename MmaAccumulator>
@@ -110,14 +129,20 @@ struct InstanceStatisticsTemplate {
   TransactionStatistics<Counter, PercentileAccumulator> transaction;
   /// Topology statistics
   InstanceTopologyStatistics<MmaAccumulator> topology;
+  /// Host selection statistics
+  HostSelectionStatistics<Counter> host_selection;
   /// Error caused by pool exhaustion
   Counter pool_exhaust_errors = 0;
   /// Error caused by queue size overflow
   Counter queue_size_errors = 0;
+  /// Operations not started as the inherited deadline has expired
+  Counter deadline_cancelled = 0;
   /// Connect time percentile
   PercentileAccumulator connection_percentile;
   /// Acquire connection percentile
   PercentileAccumulator acquire_percentile;
+  /// Time spent waiting for a connection when there were no idle ones
+  PercentileAccumulator acquire_wait_percentile;
   /// Congestion control statistics
   std::conditional_t<std::is_same_v<Counter, uint32_t>, std::byte /* NOOP */,
                      congestion_control::v2::Stats>
@@ -161,6 +186,8 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     connection.prepared_statements =
         stats.connection.prepared_statements.GetStatsForPeriod();
     connection.max_queue_size = stats.connection.max_queue_size;
+    connection.warmup_total = stats.connection.warmup_total;
+    connection.target_size = stats.connection.target_size;
 
     transaction.total = stats.transaction.total;
     transaction.commit_total = stats.transaction.commit_total;
@@ -174,6 +201,7 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.execute_timeout = stats.transaction.execute_timeout;
     transaction.duplicate_prepared_statements =
         stats.transaction.duplicate_prepared_statements;
+    transaction.batch_total = stats.transaction.batch_total;
     transaction.total_percentile =
         stats.transaction.total_percentile.GetStatsForPeriod();
     transaction.busy_percentile =
@@ -184,15 +212,25 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         stats.transaction.wait_end_percentile.GetStatsForPeriod();
     transaction.return_to_pool_percentile =
         stats.transaction.return_to_pool_percentile.GetStatsForPeriod();
+    transaction.pipeline_depth_percentile =
+        stats.transaction.pipeline_depth_percentile.GetStatsForPeriod();
 
     topology.roundtrip_time = topology_stats.roundtrip_time.GetStatsForPeriod();
     topology.replication_lag =
         topology_stats.replication_lag.GetStatsForPeriod();
 
+    host_selection.selected_total = stats.host_selection.selected_total;
+    host_selection.remote_selected_total =
+        stats.host_selection.remote_selected_total;
+    host_selection.query_latency = stats.host_selection.query_latency;
+
     pool_exhaust_errors = stats.pool_exhaust_errors;
     queue_size_errors = stats.queue_size_errors;
+    deadline_cancelled = stats.deadline_cancelled;
     connection_percentile = stats.connection_percentile.GetStatsForPeriod();
     acquire_percentile = stats.acquire_percentile.GetStatsForPeriod();
+    acquire_wait_percentile =
+        stats.acquire_wait_percentile.GetStatsForPeriod();
 
     return *this;
   }
@@ -5,7 +5,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -14,6 +16,7 @@
 #include <userver/storages/postgres/portal.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -209,6 +212,27 @@ class Transaction {
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Execute independent statements sending them all at once and then waiting
+  /// for all the results in a single network roundtrip (PostgreSQL pipeline
+  /// mode). Results are returned in the order of statements in the batch.
+  ///
+  /// The whole batch shares a single execute timeout. If a statement fails,
+  /// the following statements are not executed and the error is thrown.
+  /// Without pipelining support in libpq the statements are executed one by
+  /// one.
+  ///
+  /// Suspends coroutine for execution.
+  std::vector<ResultSet> ExecuteBatch(const QueryBatch& batch) {
+    return ExecuteBatch(OptionalCommandControl{}, batch);
+  }
+
+  /// Execute independent statements in a single network roundtrip with
+  /// command control settings, see ExecuteBatch() above.
+  ///
+  /// Suspends coroutine for execution.
+  std::vector<ResultSet> ExecuteBatch(OptionalCommandControl statement_cmd_ctl,
+                                      const QueryBatch& batch);
+
   /// Execute statement that uses an array of arguments splitting that array in
   /// chunks and executing the statement with a chunk of arguments.
   ///
@@ -288,6 +312,25 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Start streaming rows into a table with `COPY ... FROM STDIN` in the
+  /// binary format. No other statements could be executed in the
+  /// transaction until CopyInWriter::Finish() is called.
+  ///
+  /// The table and column names are put into the statement as is, they
+  /// must be trusted and quoted if needed. Timeouts of the command control
+  /// apply to each network operation, the statement timeout applies to the
+  /// whole COPY.
+  CopyInWriter CopyIn(const std::string& table,
+                      const std::vector<std::string>& columns,
+                      OptionalCommandControl statement_cmd_ctl = {});
+
+  /// Start streaming rows of a table with `COPY ... TO STDOUT` in the binary
+  /// format, see CopyIn() above. No other statements could be executed in
+  /// the transaction until all the rows are read.
+  CopyOutReader CopyOut(const std::string& table,
+                        const std::vector<std::string>& columns,
+                        OptionalCommandControl statement_cmd_ctl = {});
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -28,6 +28,10 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    chunk-prefetch:
+        type: integer
+        description: number of chunks to request ahead while the current one is parsed, 0 to request them one by one
+        defaultDescription: 0
     pgcomponent:
         type: string
         description: PostgreSQL component name
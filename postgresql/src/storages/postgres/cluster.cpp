@@ -48,6 +48,11 @@ Transaction Cluster::Begin(const std::string& name, ClusterHostTypeFlags flags,
   return pimpl_->Begin(flags, options, GetHandlersCmdCtl(GetQueryCmdCtl(name)));
 }
 
+NotifyScope Cluster::Listen(std::string_view channel,
+                            OptionalCommandControl cmd_ctl) {
+  return pimpl_->Listen(channel, cmd_ctl);
+}
+
 void Cluster::SetDefaultCommandControl(CommandControl cmd_ctl) {
   pimpl_->SetDefaultCommandControl(cmd_ctl,
                                    detail::DefaultCommandControlSource::kUser);
@@ -90,6 +95,16 @@ detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
   return pimpl_->Start(flags, cmd_ctl);
 }
 
+bool Cluster::IsSharedSessionEnabled() const {
+  return pimpl_->IsSharedSessionEnabled();
+}
+
+ResultSet Cluster::ExecuteShared(ClusterHostTypeFlags flags,
+                                 OptionalCommandControl cmd_ctl,
+                                 const Query& query, ParameterStore&& params) {
+  return pimpl_->ExecuteShared(flags, cmd_ctl, query, std::move(params));
+}
+
 OptionalCommandControl Cluster::GetQueryCmdCtl(
     const std::string& query_name) const {
   return pimpl_->GetQueryCmdCtl(query_name);
@@ -116,6 +131,19 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+std::vector<ResultSet> Cluster::ExecuteBatch(ClusterHostTypeFlags flags,
+                                             const QueryBatch& batch) {
+  return ExecuteBatch(flags, OptionalCommandControl{}, batch);
+}
+
+std::vector<ResultSet> Cluster::ExecuteBatch(
+    ClusterHostTypeFlags flags, OptionalCommandControl statement_cmd_ctl,
+    const QueryBatch& batch) {
+  statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  auto ntrx = Start(flags, statement_cmd_ctl);
+  return ntrx.ExecuteBatch(statement_cmd_ctl, batch);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
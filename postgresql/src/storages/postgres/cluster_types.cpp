@@ -32,6 +32,8 @@ const char* ToStringRaw(ClusterHostType ht) {
       return "round-robin";
     case ClusterHostType::kNearest:
       return "nearest";
+    case ClusterHostType::kAdaptive:
+      return "adaptive";
   }
   const auto msg = fmt::format("invalid host type {} in ToStringRaw",
                                USERVER_NAMESPACE::utils::UnderlyingValue(ht));
@@ -48,7 +50,8 @@ std::string ToString(ClusterHostTypeFlags flags) {
 
   for (const auto role : {ClusterHostType::kMaster, ClusterHostType::kSyncSlave,
                           ClusterHostType::kSlave, ClusterHostType::kRoundRobin,
-                          ClusterHostType::kNearest}) {
+                          ClusterHostType::kNearest,
+                          ClusterHostType::kAdaptive}) {
     if (flags & role) {
       if (!result.empty()) result += '|';
       result += ToStringRaw(role);
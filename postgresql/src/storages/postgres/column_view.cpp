@@ -0,0 +1,166 @@
+#include <userver/storages/postgres/column_view.hpp>
+
+#include <cstring>
+#include <limits>
+
+#include <boost/endian/conversion.hpp>
+
+#include <storages/postgres/detail/result_wrapper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+template <typename T>
+T LoadBigEndian(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return boost::endian::big_to_native(value);
+}
+
+template <typename Float, typename Int>
+Float LoadFloat(const char* data) {
+  static_assert(sizeof(Float) == sizeof(Int));
+  const auto bits = LoadBigEndian<Int>(data);
+  Float value;
+  std::memcpy(&value, &bits, sizeof(Float));
+  return value;
+}
+
+TimePoint MakeTimePoint(Bigint usec) {
+  if (usec == std::numeric_limits<Bigint>::max()) {
+    return kTimestampPositiveInfinity;
+  } else if (usec == std::numeric_limits<Bigint>::min()) {
+    return kTimestampNegativeInfinity;
+  }
+  static const auto pg_epoch = PostgresEpochTimePoint();
+  return pg_epoch + std::chrono::duration_cast<TimePoint::duration>(
+                        std::chrono::microseconds{usec});
+}
+
+// Decodes fields of the expected size in a tight loop, falls back to the
+// regular parsers for the fields of other sizes (e.g. an int4 column read into
+// Bigint) and NULLs, so that the conversions and the errors match them.
+template <std::size_t Size, typename T, typename Load>
+void DecodeFixedSize(const ResultSet& res, const PGresult* handle,
+                     std::size_t column, std::vector<T>& values, Load load) {
+  const auto size = static_cast<int>(res.Size());
+  const auto col = static_cast<int>(column);
+  values.resize(size);
+  for (int row = 0; row < size; ++row) {
+    if (!PQgetisnull(handle, row, col) &&
+        PQgetlength(handle, row, col) == static_cast<int>(Size)) {
+      values[row] = load(PQgetvalue(handle, row, col));
+    } else {
+      values[row] = res[row][column].template As<T>();
+    }
+  }
+}
+
+}  // namespace
+
+ColumnView::ColumnView(const ResultSet& res, size_type column)
+    : res_{res}, column_{column} {
+  if (column_ >= res_.FieldCount()) throw FieldIndexOutOfBounds{column_};
+  if (PQfformat(res_.pimpl_->handle_.get(), column_) !=
+      io::kPgBinaryDataFormat) {
+    throw ResultSetError{
+        fmt::format("Column with index {} has text format", column_)};
+  }
+}
+
+ColumnView::ColumnView(const ResultSet& res, const std::string& name)
+    : ColumnView{res, [&] {
+                   const auto index = res.pimpl_->IndexOfName(name);
+                   if (index == ResultSet::npos) {
+                     throw FieldNameDoesntExist{name};
+                   }
+                   return index;
+                 }()} {}
+
+ColumnView::size_type ColumnView::Size() const { return res_.Size(); }
+
+std::string_view ColumnView::Name() const {
+  return res_.pimpl_->GetFieldName(column_);
+}
+
+Oid ColumnView::GetTypeOid() const {
+  return res_.pimpl_->GetFieldTypeOid(column_);
+}
+
+bool ColumnView::IsNull(size_type row) const {
+  if (row >= Size()) throw RowIndexOutOfBounds{row};
+  return res_.pimpl_->IsFieldNull(row, column_);
+}
+
+bool ColumnView::HasNulls() const {
+  const auto size = Size();
+  for (size_type row = 0; row < size; ++row) {
+    if (res_.pimpl_->IsFieldNull(row, column_)) return true;
+  }
+  return false;
+}
+
+std::string_view ColumnView::GetRawBuffer(size_type row) const {
+  if (row >= Size()) throw RowIndexOutOfBounds{row};
+  const auto* handle = res_.pimpl_->handle_.get();
+  if (PQgetisnull(handle, row, column_)) return {};
+  return {PQgetvalue(handle, row, column_),
+          static_cast<std::size_t>(PQgetlength(handle, row, column_))};
+}
+
+void ColumnView::Decode(std::vector<Smallint>& values) const {
+  DecodeFixedSize<sizeof(Smallint)>(res_, res_.pimpl_->handle_.get(), column_,
+                                    values, LoadBigEndian<Smallint>);
+}
+
+void ColumnView::Decode(std::vector<Integer>& values) const {
+  DecodeFixedSize<sizeof(Integer)>(res_, res_.pimpl_->handle_.get(), column_,
+                                   values, LoadBigEndian<Integer>);
+}
+
+void ColumnView::Decode(std::vector<Bigint>& values) const {
+  DecodeFixedSize<sizeof(Bigint)>(res_, res_.pimpl_->handle_.get(), column_,
+                                  values, LoadBigEndian<Bigint>);
+}
+
+void ColumnView::Decode(std::vector<float>& values) const {
+  DecodeFixedSize<sizeof(float)>(res_, res_.pimpl_->handle_.get(), column_,
+                                 values, LoadFloat<float, std::uint32_t>);
+}
+
+void ColumnView::Decode(std::vector<double>& values) const {
+  DecodeFixedSize<sizeof(double)>(res_, res_.pimpl_->handle_.get(), column_,
+                                  values, LoadFloat<double, std::uint64_t>);
+}
+
+void ColumnView::Decode(std::vector<TimePoint>& values) const {
+  DecodeFixedSize<sizeof(Bigint)>(
+      res_, res_.pimpl_->handle_.get(), column_, values, [](const char* data) {
+        return MakeTimePoint(LoadBigEndian<Bigint>(data));
+      });
+}
+
+void ColumnView::Decode(std::vector<TimePointTz>& values) const {
+  DecodeFixedSize<sizeof(Bigint)>(
+      res_, res_.pimpl_->handle_.get(), column_, values, [](const char* data) {
+        return TimePointTz{MakeTimePoint(LoadBigEndian<Bigint>(data))};
+      });
+}
+
+void ColumnView::Decode(std::vector<std::string_view>& values) const {
+  const auto size = Size();
+  values.resize(size);
+  for (size_type row = 0; row < size; ++row) {
+    if (res_.pimpl_->IsFieldNull(row, column_)) {
+      throw FieldValueIsNull{column_, Name(), std::string_view{}};
+    }
+    values[row] = GetRawBuffer(row);
+  }
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
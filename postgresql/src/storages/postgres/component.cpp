@@ -300,6 +300,14 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    idle_buffer_size:
+        type: integer
+        description: number of idle connections to open ahead of the observed load (0 - grow on demand only)
+        defaultDescription: 0
+    shared_session_size:
+        type: integer
+        description: number of connections that multiplex the single statements executed out of transactions (0 - disabled)
+        defaultDescription: 0
     connlimit_mode:
         type: string
         enum:
@@ -23,8 +23,12 @@ Sensor::Data Sensor::GetCurrent() {
   auto timeout_rate = static_cast<double>(diff_timeouts) / diff_total;
   LOG_DEBUG() << "timeout rate = " << timeout_rate;
 
-  auto current_limit = stats.connection.maximum;
-  return {diff_total, diff_timeouts, current_limit};
+  Data data;
+  data.total = diff_total;
+  data.timeouts = diff_timeouts;
+  data.current_load = stats.connection.active;
+  data.server_wait_percent = pool_.GetServerWaitPercent();
+  return data;
 }
 
 }  // namespace storages::postgres::cc
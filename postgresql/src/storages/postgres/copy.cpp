@@ -0,0 +1,192 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kCopySignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr Smallint kCopyTrailer = -1;
+constexpr std::size_t kCopyChunkSize = 64 * 1024;
+
+}  // namespace
+
+namespace detail {
+
+std::string MakeCopyStatement(const std::string& table,
+                              const std::vector<std::string>& columns,
+                              bool is_copy_in) {
+  std::string statement = "COPY " + table;
+  if (!columns.empty()) {
+    statement += fmt::format(" ({})", fmt::join(columns, ", "));
+  }
+  statement += is_copy_in ? " FROM STDIN" : " TO STDOUT";
+  statement += " (FORMAT binary)";
+  return statement;
+}
+
+}  // namespace detail
+
+CopyInWriter::CopyInWriter(detail::Connection* conn, std::size_t column_count)
+    : conn_{conn}, types_{&conn->GetUserTypes()}, column_count_{column_count} {
+  buffer_.reserve(kCopyChunkSize);
+  buffer_.append(kCopySignature);
+  // Flags field and header extension length
+  io::WriteBuffer(*types_, buffer_, Integer{0});
+  io::WriteBuffer(*types_, buffer_, Integer{0});
+}
+
+CopyInWriter::CopyInWriter(CopyInWriter&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      types_{other.types_},
+      column_count_{other.column_count_},
+      rows_count_{other.rows_count_},
+      buffer_{std::move(other.buffer_)} {}
+
+CopyInWriter::~CopyInWriter() {
+  if (!conn_) return;
+  try {
+    conn_->EndCopyIn("COPY was not finished");
+  } catch (const std::exception& e) {
+    LOG_DEBUG() << "Unfinished COPY was aborted: " << e;
+  }
+}
+
+std::size_t CopyInWriter::Finish() {
+  CheckColumnCount(column_count_);
+  WriteInt16(kCopyTrailer);
+  auto* conn = std::exchange(conn_, nullptr);
+  conn->PutCopyData(buffer_);
+  buffer_.clear();
+  const auto res = conn->EndCopyIn();
+  const auto rows = res.RowsAffected();
+  LOG_DEBUG() << "COPY of " << rows_count_ << " rows finished, " << rows
+              << " rows copied";
+  return rows;
+}
+
+void CopyInWriter::CheckColumnCount(std::size_t count) const {
+  if (!conn_) {
+    throw LogicError("COPY is already finished");
+  }
+  if (column_count_ != 0 && count != column_count_) {
+    throw LogicError(fmt::format(
+        "COPY row has {} columns while {} columns were requested", count,
+        column_count_));
+  }
+}
+
+void CopyInWriter::WriteInt16(std::int16_t value) {
+  io::WriteBuffer(*types_, buffer_, static_cast<Smallint>(value));
+}
+
+void CopyInWriter::FlushIfNeeded() {
+  if (buffer_.size() < kCopyChunkSize) return;
+  // The connection leaves the COPY state if sending fails
+  auto* conn = std::exchange(conn_, nullptr);
+  conn->PutCopyData(buffer_);
+  conn_ = conn;
+  buffer_.clear();
+}
+
+CopyOutReader::CopyOutReader(detail::Connection* conn,
+                             std::size_t column_count)
+    : conn_{conn}, types_{&conn->GetUserTypes()}, column_count_{column_count} {}
+
+CopyOutReader::CopyOutReader(CopyOutReader&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      types_{other.types_},
+      column_count_{other.column_count_},
+      buffer_{std::move(other.buffer_)},
+      offset_{other.offset_},
+      is_header_read_{other.is_header_read_} {}
+
+CopyOutReader::~CopyOutReader() {
+  if (!conn_) return;
+  // There is no way to stop the server from sending the rest of the data,
+  // so the connection is dropped instead of reading everything.
+  LOG_LIMITED_WARNING() << "COPY TO STDOUT was not read to the end, "
+                           "the connection will be closed";
+  conn_->MarkAsBroken();
+}
+
+bool CopyOutReader::NextRow(std::size_t column_count) {
+  if (!conn_) return false;
+  while (true) {
+    if (offset_ >= buffer_.size()) {
+      // The connection leaves the COPY state if receiving fails
+      auto* conn = std::exchange(conn_, nullptr);
+      offset_ = 0;
+      if (!conn->GetCopyData(buffer_)) return false;
+      conn_ = conn;
+    }
+
+    auto buffer = GetRowBuffer();
+    if (!is_header_read_) {
+      if (buffer.length < kCopySignature.size() ||
+          buffer.ToString().compare(0, kCopySignature.size(),
+                                    kCopySignature) != 0) {
+        throw InvalidBinaryBuffer("COPY signature not recognized");
+      }
+      buffer = buffer.GetSubBuffer(kCopySignature.size());
+      Integer flags{0};
+      Integer extension_length{0};
+      buffer.Read(flags, io::BufferCategory::kPlainBuffer);
+      buffer.Read(extension_length, io::BufferCategory::kPlainBuffer);
+      if (extension_length < 0) {
+        throw InvalidBinaryBuffer("Negative COPY header extension length");
+      }
+      buffer = buffer.GetSubBuffer(extension_length);
+      Consume(buffer);
+      is_header_read_ = true;
+      continue;
+    }
+
+    Smallint field_count{0};
+    buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+    if (field_count == kCopyTrailer) {
+      // Wait for the COPY to complete
+      auto* conn = std::exchange(conn_, nullptr);
+      std::string rest;
+      while (conn->GetCopyData(rest)) {
+      }
+      buffer_.clear();
+      offset_ = 0;
+      return false;
+    }
+    if (field_count < 0 ||
+        (column_count_ != 0 &&
+         static_cast<std::size_t>(field_count) != column_count_)) {
+      throw InvalidBinaryBuffer(
+          fmt::format("Unexpected COPY row with {} fields", field_count));
+    }
+    if (static_cast<std::size_t>(field_count) != column_count) {
+      throw InvalidTupleSizeRequested(field_count, column_count);
+    }
+    Consume(buffer);
+    return true;
+  }
+}
+
+io::FieldBuffer CopyOutReader::GetRowBuffer() const {
+  return io::FieldBuffer{
+      false, io::BufferCategory::kPlainBuffer, buffer_.size() - offset_,
+      reinterpret_cast<const std::uint8_t*>(buffer_.data()) + offset_};
+}
+
+void CopyOutReader::Consume(const io::FieldBuffer& rest) {
+  offset_ = rest.buffer - reinterpret_cast<const std::uint8_t*>(buffer_.data());
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
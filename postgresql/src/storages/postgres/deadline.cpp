@@ -1,5 +1,8 @@
 #include "deadline.hpp"
 
+#include <algorithm>
+
+#include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/experiments.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
@@ -9,17 +12,45 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
-void CheckDeadlineIsExpired(const dynamic_config::Snapshot& config) {
-  if (!kDeadlinePropagationExperiment.IsEnabled() ||
-      config[kDeadlinePropagationVersionConfig] !=
-          kDeadlinePropagationExperimentVersion) {
-    return;
+namespace {
+
+bool IsDeadlinePropagationEnabled(const dynamic_config::Snapshot& config) {
+  return kDeadlinePropagationExperiment.IsEnabled() &&
+         config[kDeadlinePropagationVersionConfig] ==
+             kDeadlinePropagationExperimentVersion;
+}
+
+}  // namespace
+
+bool IsDeadlineExpired(const dynamic_config::Snapshot& config) {
+  if (!IsDeadlinePropagationEnabled(config)) return false;
+
+  return server::request::GetTaskInheritedDeadline().IsReached();
+}
+
+OptionalCommandControl CheckDeadline(const detail::ConnectionPtr& conn,
+                                     OptionalCommandControl statement_cmd_ctl) {
+  const auto source = conn.GetConfigSource();
+  if (!source || !IsDeadlinePropagationEnabled(source->GetSnapshot())) {
+    return statement_cmd_ctl;
   }
 
   const auto inherited_deadline = server::request::GetTaskInheritedDeadline();
-  if (inherited_deadline.IsReached()) {
+  if (!inherited_deadline.IsReachable()) return statement_cmd_ctl;
+
+  const auto time_left = std::chrono::duration_cast<TimeoutDuration>(
+      inherited_deadline.TimeLeftApprox());
+  if (time_left <= TimeoutDuration::zero()) {
+    conn.AccountCancelledByDeadline();
     throw ConnectionInterrupted("Cancelled by deadline");
   }
+
+  auto cmd_ctl = statement_cmd_ctl
+                     ? *statement_cmd_ctl
+                     : conn->GetTransactionCommandControl().value_or(
+                           conn->GetDefaultCommandControl());
+  if (cmd_ctl.execute <= time_left) return statement_cmd_ctl;
+  return cmd_ctl.WithExecuteTimeout(time_left);
 }
 
 }  // namespace storages::postgres
@@ -1,13 +1,27 @@
 #pragma once
 
+#include <optional>
+
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/options.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+/// @returns true if the deadline propagation is enabled and the inherited
+/// deadline is expired.
+bool IsDeadlineExpired(const dynamic_config::Snapshot&);
+
+/// @brief Checks the inherited deadline before running a statement on `conn`,
+/// clips the execute timeout of the statement to the time left.
+///
+/// The statement timeout is left intact to avoid a SET per statement, the
+/// network timeout cancels the statement on the server anyway.
 /// @throws ConnectionInterrupted if deadline is expired.
-void CheckDeadlineIsExpired(const dynamic_config::Snapshot&);
+OptionalCommandControl CheckDeadline(const detail::ConnectionPtr& conn,
+                                     OptionalCommandControl statement_cmd_ctl);
 
 }  // namespace storages::postgres
 
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <mutex>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
@@ -7,6 +9,7 @@
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/postgres/detail/host_selector.hpp>
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
 #include <storages/postgres/postgres_config.hpp>
@@ -34,6 +37,7 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kAdaptive:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
@@ -57,7 +61,8 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
       idx_pos =
           rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
     }
-  } else if (strategy_flags != ClusterHostType::kNearest) {
+  } else if (strategy_flags != ClusterHostType::kNearest &&
+             strategy_flags != ClusterHostType::kAdaptive) {
     throw LogicError(
         fmt::format("Invalid strategy requested: {}, ensure only one is used",
                     ToString(strategy_flags)));
@@ -104,6 +109,9 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
 
   LOG_DEBUG() << "Starting pools initialization";
   host_pools_.reserve(dsn_list.size());
+  // Hosts of a cluster share the catalogs, so do the statement descriptions
+  auto description_cache = std::make_shared<StatementDescriptionCache>(
+      cluster_settings.conn_settings.max_prepared_cache_size);
   for (const auto& dsn : dsn_list) {
     host_pools_.push_back(ConnectionPool::Create(
         dsn, resolver, bg_task_processor_, cluster_settings.db_name,
@@ -111,7 +119,7 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
         cluster_settings.conn_settings,
         cluster_settings.statement_metrics_settings, default_cmd_ctls_,
         testsuite_pg_ctl, ei_settings, cluster_settings.cc_config,
-        config_source_));
+        config_source_, description_cache));
   }
   LOG_DEBUG() << "Pools initialized";
 
@@ -123,7 +131,13 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
   }
 }
 
-ClusterImpl::~ClusterImpl() { connlimit_watchdog_.Stop(); }
+ClusterImpl::~ClusterImpl() {
+  {
+    std::lock_guard lock{listener_mutex_};
+    if (listener_) listener_->Stop();
+  }
+  connlimit_watchdog_.Stop();
+}
 
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
   auto cluster_stats = std::make_unique<ClusterStatistics>();
@@ -214,6 +228,13 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
 
   size_t dsn_index = -1;
   const auto role_flags = flags & kClusterHostRolesMask;
+  const auto select_dsn_index = [this, flags](const auto& indices) {
+    if ((flags & kClusterHostStrategyMask) == ClusterHostType::kAdaptive &&
+        indices.size() > 1) {
+      return SelectAdaptiveDsnIndex(indices);
+    }
+    return SelectDsnIndex(indices, flags, rr_host_idx_);
+  };
 
   UASSERT_MSG(role_flags, "No roles specified");
   UASSERT_MSG(!(role_flags & ClusterHostType::kSyncSlave) ||
@@ -227,7 +248,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index = select_dsn_index(*alive_dsn_indices);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -249,13 +270,43 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = select_dsn_index(dsn_indices_it->second);
   }
 
   UASSERT(dsn_index < host_pools_.size());
   return host_pools_.at(dsn_index);
 }
 
+size_t ClusterImpl::SelectAdaptiveDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices) {
+  const auto host_metrics = topology_->GetHostMetrics();
+
+  std::vector<HostLoad> hosts;
+  hosts.reserve(indices.size());
+  for (const auto dsn_index : indices) {
+    UASSERT(dsn_index < host_pools_.size());
+    const auto& pool = *host_pools_[dsn_index];
+    auto& host = hosts.emplace_back();
+    // Metrics are not available until the first topology check completes
+    if (dsn_index < host_metrics->size()) {
+      host.roundtrip_time = (*host_metrics)[dsn_index].roundtrip_time;
+      host.replication_lag = (*host_metrics)[dsn_index].replication_lag;
+    }
+    host.query_latency = pool.GetQueryLatency();
+    host.in_flight = pool.GetInFlightCount();
+  }
+
+  const auto selection = SelectAdaptiveHost(
+      hosts, topology_->GetTopologySettings().max_replication_lag,
+      rr_host_idx_.fetch_add(1, std::memory_order_relaxed));
+  UASSERT(selection.pos < indices.size());
+  const auto dsn_index = indices[selection.pos];
+  host_pools_[dsn_index]->AccountHostSelection(selection.is_nearest);
+  LOG_TRACE() << "Adaptive strategy chose host #" << dsn_index
+              << (selection.is_nearest ? "" : " (remote)");
+  return dsn_index;
+}
+
 Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
                                const TransactionOptions& options,
                                OptionalCommandControl cmd_ctl) {
@@ -284,6 +335,43 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
   return FindPool(flags)->Start(cmd_ctl);
 }
 
+ResultSet ClusterImpl::ExecuteShared(ClusterHostTypeFlags flags,
+                                     OptionalCommandControl cmd_ctl,
+                                     const Query& query,
+                                     ParameterStore&& params) {
+  if (!(flags & kClusterHostRolesMask)) {
+    throw LogicError(
+        "Host role must be specified for execution of a single statement");
+  }
+  LOG_TRACE() << "Requested shared single statement on " << flags;
+  return FindPool(flags)->Execute(query, std::move(params), cmd_ctl);
+}
+
+bool ClusterImpl::IsSharedSessionEnabled() const {
+  const auto settings = cluster_settings_.Read();
+  return settings->pool_settings.shared_session_size > 0;
+}
+
+NotifyScope ClusterImpl::Listen(std::string_view channel,
+                                OptionalCommandControl cmd_ctl) {
+  const auto execute_timeout =
+      cmd_ctl.value_or(default_cmd_ctls_.GetDefaultCmdCtl()).execute;
+  const auto deadline = engine::Deadline::FromDuration(execute_timeout);
+
+  std::shared_ptr<NotifyListener> listener;
+  {
+    std::lock_guard lock{listener_mutex_};
+    if (!listener_) {
+      // NOTIFY is not delivered to the standbys, so only the master is listened
+      listener_ = std::make_shared<NotifyListener>([this] {
+        return FindPool(ClusterHostType::kMaster)->ConnectDedicated();
+      });
+    }
+    listener = listener_;
+  }
+  return listener->Listen(std::string{channel}, deadline);
+}
+
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
                                            DefaultCommandControlSource source) {
   default_cmd_ctls_.UpdateDefaultCmdCtl(cmd_ctl, source);
@@ -6,18 +6,21 @@
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/testsuite/tasks.hpp>
 
 #include <storages/postgres/connlimit_watchdog.hpp>
+#include <storages/postgres/detail/notify_listener.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
@@ -46,6 +49,13 @@ class ClusterImpl {
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  ResultSet ExecuteShared(ClusterHostTypeFlags, OptionalCommandControl,
+                          const Query& query, ParameterStore&& params);
+
+  bool IsSharedSessionEnabled() const;
+
+  NotifyScope Listen(std::string_view channel, OptionalCommandControl);
+
   void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
   CommandControl GetDefaultCommandControl() const;
 
@@ -75,6 +85,8 @@ class ClusterImpl {
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
   ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  size_t SelectAdaptiveDsnIndex(
+      const topology::TopologyBase::DsnIndices& indices);
 
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
@@ -84,6 +96,10 @@ class ClusterImpl {
   std::atomic<uint32_t> rr_host_idx_;
   dynamic_config::Source config_source_;
   ConnlimitWatchdog connlimit_watchdog_;
+
+  // Created on the first Listen() to not keep an idle connection
+  engine::Mutex listener_mutex_;
+  std::shared_ptr<NotifyListener> listener_;
 };
 
 }  // namespace storages::postgres::detail
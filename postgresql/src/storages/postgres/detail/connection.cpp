@@ -23,14 +23,16 @@ std::unique_ptr<Connection> Connection::Connect(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock) {
+    engine::SemaphoreLock&& size_lock,
+    std::shared_ptr<StatementDescriptionCache> description_cache) {
   std::unique_ptr<Connection> conn(new Connection());
 
   const auto deadline = engine::Deadline::FromDuration(std::max(
       kMinConnectTimeout, default_cmd_ctls.GetDefaultCmdCtl().execute));
   conn->pimpl_ = std::make_unique<ConnectionImpl>(
       bg_task_processor, bg_task_storage, id, settings, default_cmd_ctls,
-      testsuite_pg_ctl, ei_settings, std::move(size_lock));
+      testsuite_pg_ctl, ei_settings, std::move(size_lock),
+      std::move(description_cache));
   if (resolver) {
     try {
       conn->pimpl_->AsyncConnect(ResolveDsnHostaddrs(dsn, *resolver, deadline),
@@ -121,6 +123,43 @@ ResultSet Connection::Execute(CommandControl statement_cmd_ctl,
                  OptionalCommandControl{statement_cmd_ctl});
 }
 
+std::vector<ResultSet> Connection::ExecuteBatch(
+    const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecuteBatch(batch, std::move(statement_cmd_ctl));
+}
+
+std::vector<IsolatedResult> Connection::ExecuteIsolatedBatch(
+    const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecuteIsolatedBatch(batch, std::move(statement_cmd_ctl));
+}
+
+void Connection::StartCopy(const std::string& statement,
+                           OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->StartCopy(statement, std::move(statement_cmd_ctl));
+}
+
+void Connection::PutCopyData(std::string_view data) {
+  pimpl_->PutCopyData(data);
+}
+
+ResultSet Connection::EndCopyIn(const char* error_message) {
+  return pimpl_->EndCopyIn(error_message);
+}
+
+bool Connection::GetCopyData(std::string& data) {
+  return pimpl_->GetCopyData(data);
+}
+
+void Connection::Listen(std::string_view channel) { pimpl_->Listen(channel); }
+
+void Connection::Unlisten(std::string_view channel) {
+  pimpl_->Unlisten(channel);
+}
+
+std::optional<Notification> Connection::WaitNotify(engine::Deadline deadline) {
+  return pimpl_->WaitNotify(deadline);
+}
+
 Connection::StatementId Connection::PortalBind(
     const std::string& statement, const std::string& portal_name,
     const detail::QueryParameters& params,
@@ -137,6 +176,19 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+bool Connection::SendPortalExecute(StatementId statement_id,
+                                   const std::string& portal_name,
+                                   std::uint32_t n_rows,
+                                   OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->SendPortalExecute(statement_id, portal_name, n_rows,
+                                   std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::WaitPortalExecute(
+    StatementId statement_id, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->WaitPortalExecute(statement_id, std::move(statement_cmd_ctl));
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
@@ -2,7 +2,12 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -17,8 +22,10 @@
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -37,6 +44,15 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class StatementDescriptionCache;
+
+/// Result of a statement that is executed in its own implicit transaction
+/// within a pipeline, see Connection::ExecuteIsolatedBatch
+struct IsolatedResult {
+  ResultSet result{nullptr};
+  /// Set if the statement has failed
+  std::exception_ptr error;
+};
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -92,9 +108,13 @@ class Connection {
     /// Number of duplicate prepared statements errors,
     /// probably caused by timeout while preparing
     Counter duplicate_prepared_statements{0};
+    /// Number of query batches executed
+    Counter batch_total{0};
 
     /// Current number of prepared statements
     CurrentValue prepared_statements_current{0};
+    /// Max number of queries sent in a single pipeline
+    CurrentValue pipeline_depth_max{0};
 
     /// Transaction initiation time (includes wait in pool)
     SteadyClock::time_point trx_start_time;
@@ -139,7 +159,8 @@ class Connection {
       const DefaultCommandControls& default_cmd_ctls,
       const testsuite::PostgresControl& testsuite_pg_ctl,
       const error_injection::Settings& ei_settings,
-      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{});
+      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{},
+      std::shared_ptr<StatementDescriptionCache> description_cache = {});
 
   /// Close the connection
   /// TODO When called from another thread/coroutine will wait for current
@@ -224,12 +245,50 @@ class Connection {
   ResultSet Execute(CommandControl statement_cmd_ctl, const Query& query,
                     const ParameterStore& store);
 
+  /// Execute independent statements in a single pipeline, falls back to
+  /// executing them one by one if pipelining is not supported by libpq
+  std::vector<ResultSet> ExecuteBatch(const QueryBatch& batch,
+                                      OptionalCommandControl statement_cmd_ctl);
+
+  /// Execute independent statements in a single pipeline with a sync point
+  /// after each of them, so that every statement runs in its own implicit
+  /// transaction and fails on its own. Falls back to executing them one by one
+  /// if pipelining is not supported by libpq
+  std::vector<IsolatedResult> ExecuteIsolatedBatch(
+      const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl);
+
+  /// Start COPY FROM STDIN or COPY TO STDOUT, the execute timeout of the
+  /// command control limits each network operation of the COPY
+  void StartCopy(const std::string& statement,
+                 OptionalCommandControl statement_cmd_ctl);
+  /// Send the COPY FROM STDIN data
+  void PutCopyData(std::string_view data);
+  /// Finish COPY FROM STDIN, fail it with the error_message if it is not null
+  ResultSet EndCopyIn(const char* error_message = nullptr);
+  /// Receive the next data row of COPY TO STDOUT, returns false once the COPY
+  /// is done
+  bool GetCopyData(std::string& data);
+
+  /// Subscribe the connection to the notifications of the channel
+  void Listen(std::string_view channel);
+  /// Unsubscribe the connection from the notifications of the channel
+  void Unlisten(std::string_view channel);
+  /// Wait for a notification of the channels the connection listens to,
+  /// returns std::nullopt on the deadline or the task cancellation
+  std::optional<Notification> WaitNotify(engine::Deadline deadline);
+
   StatementId PortalBind(const std::string& statement,
                          const std::string& portal_name,
                          const detail::QueryParameters& params,
                          OptionalCommandControl);
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
+  /// Send a portal execute without waiting for its result, returns false if
+  /// it cannot be sent ahead and should be executed synchronously instead
+  bool SendPortalExecute(StatementId, const std::string& portal_name,
+                         std::uint32_t n_rows, OptionalCommandControl);
+  /// Wait for the result of the earliest portal execute sent ahead
+  ResultSet WaitPortalExecute(StatementId, OptionalCommandControl);
 
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
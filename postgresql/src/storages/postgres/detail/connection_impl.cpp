@@ -1,12 +1,16 @@
 #include <storages/postgres/detail/connection_impl.hpp>
 
+#include <type_traits>
+
 #include <boost/functional/hash.hpp>
+#include <fmt/format.h>
 
 #include <userver/error_injection/hook.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/uuid4.hpp>
 
 #include <storages/postgres/detail/tracing_tags.hpp>
@@ -79,6 +83,49 @@ class CountPortalBind {
   bool completed_{false};
 };
 
+class CountBatch {
+ public:
+  CountBatch(Connection::Statistics& stats, std::size_t size) : stats_(stats) {
+    stats_.execute_total += size;
+    stats_.pipeline_depth_max = std::max(
+        stats_.pipeline_depth_max,
+        static_cast<Connection::Statistics::CurrentValue>(size));
+    exec_begin_time = SteadyClock::now();
+  }
+
+  ~CountBatch() {
+    auto now = SteadyClock::now();
+    if (!completed_) {
+      ++stats_.error_execute_total;
+    }
+    stats_.sum_query_duration += now - exec_begin_time;
+    stats_.last_execute_finish = now;
+  }
+
+  void AccountResults(const std::vector<ResultSet>& results) {
+    for (const auto& result : results) {
+      if (result.FieldCount()) ++stats_.reply_total;
+    }
+    completed_ = true;
+  }
+
+  void AccountResults(const std::vector<IsolatedResult>& results) {
+    for (const auto& [result, error] : results) {
+      if (error) {
+        ++stats_.error_execute_total;
+      } else if (result.FieldCount()) {
+        ++stats_.reply_total;
+      }
+    }
+    completed_ = true;
+  }
+
+ private:
+  Connection::Statistics& stats_;
+  bool completed_{false};
+  SteadyClock::time_point exec_begin_time;
+};
+
 struct TrackTrxEnd {
   TrackTrxEnd(Connection::Statistics& stats) : stats_(stats) {}
   ~TrackTrxEnd() { stats_.trx_end_time = SteadyClock::now(); }
@@ -169,11 +216,13 @@ ConnectionImpl::ConnectionImpl(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock)
+    engine::SemaphoreLock&& size_lock,
+    std::shared_ptr<StatementDescriptionCache> description_cache)
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
       conn_wrapper_{bg_task_processor, bg_task_storage, id,
                     std::move(size_lock)},
       prepared_{settings.max_prepared_cache_size},
+      description_cache_{std::move(description_cache)},
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
@@ -357,6 +406,128 @@ ResultSet ConnectionImpl::ExecuteCommand(
   return ExecuteCommand(query, params, deadline);
 }
 
+std::vector<ResultSet> ConnectionImpl::ExecuteBatch(
+    const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  return ExecuteBatch(batch, deadline);
+}
+
+std::vector<IsolatedResult> ConnectionImpl::ExecuteIsolatedBatch(
+    const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  return ExecuteIsolatedBatch(batch, deadline);
+}
+
+void ConnectionImpl::StartCopy(const std::string& statement,
+                               OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+
+  CheckDeadlineReached(deadline);
+  auto span = MakeQuerySpan(statement);
+  auto scope = span.CreateScopeTime();
+  ++stats_.execute_total;
+  CopyState copy_state{statement, network_timeout, false};
+  HandleWaitErrors(statement, network_timeout, span, [&] {
+    if (IsPipelineActive()) {
+      // COPY is not allowed in pipeline mode, sync the commands sent so far
+      // and leave the pipeline until the COPY is done
+      conn_wrapper_.WaitResult(deadline, scope);
+      conn_wrapper_.ExitPipelineMode();
+      if (IsBroken()) throw ConnectionError{"Failed to exit pipeline mode"};
+      copy_state.is_pipeline_left = true;
+    }
+    try {
+      conn_wrapper_.StartCopy(statement, deadline, scope);
+    } catch (const std::exception&) {
+      FinishCopy(copy_state);
+      throw;
+    }
+  });
+  copy_state_ = std::move(copy_state);
+}
+
+void ConnectionImpl::PutCopyData(std::string_view data) {
+  UASSERT_MSG(copy_state_, "COPY is not started");
+  auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout);
+  try {
+    conn_wrapper_.PutCopyData(data, deadline);
+  } catch (const std::exception&) {
+    FinishCopy(*std::exchange(copy_state_, std::nullopt));
+    throw;
+  }
+}
+
+ResultSet ConnectionImpl::EndCopyIn(const char* error_message) {
+  UASSERT_MSG(copy_state_, "COPY is not started");
+  const auto copy_state = *std::exchange(copy_state_, std::nullopt);
+  auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(copy_state.network_timeout);
+  auto span = MakeQuerySpan(copy_state.statement);
+  auto scope = span.CreateScopeTime();
+  USERVER_NAMESPACE::utils::FastScopeGuard finish_guard(
+      [this, &copy_state]() noexcept { FinishCopy(copy_state); });
+  return HandleWaitErrors(
+      copy_state.statement, copy_state.network_timeout, span, [&] {
+        return conn_wrapper_.EndCopyIn(error_message, deadline, scope);
+      });
+}
+
+bool ConnectionImpl::GetCopyData(std::string& data) {
+  UASSERT_MSG(copy_state_, "COPY is not started");
+  auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(copy_state_->network_timeout);
+  try {
+    if (conn_wrapper_.GetCopyData(data, deadline)) return true;
+  } catch (const std::exception&) {
+    FinishCopy(*std::exchange(copy_state_, std::nullopt));
+    throw;
+  }
+
+  const auto copy_state = *std::exchange(copy_state_, std::nullopt);
+  auto span = MakeQuerySpan(copy_state.statement);
+  auto scope = span.CreateScopeTime();
+  USERVER_NAMESPACE::utils::FastScopeGuard finish_guard(
+      [this, &copy_state]() noexcept { FinishCopy(copy_state); });
+  HandleWaitErrors(copy_state.statement, copy_state.network_timeout, span,
+                   [&] { conn_wrapper_.WaitResult(deadline, scope); });
+  return false;
+}
+
+void ConnectionImpl::Listen(std::string_view channel) {
+  CheckBusy();
+  ExecuteCommandNoPrepare("LISTEN " + conn_wrapper_.EscapeIdentifier(channel),
+                          MakeCurrentDeadline());
+}
+
+void ConnectionImpl::Unlisten(std::string_view channel) {
+  CheckBusy();
+  ExecuteCommandNoPrepare(
+      "UNLISTEN " + conn_wrapper_.EscapeIdentifier(channel),
+      MakeCurrentDeadline());
+}
+
+std::optional<Notification> ConnectionImpl::WaitNotify(
+    engine::Deadline deadline) {
+  CheckBusy();
+  return conn_wrapper_.WaitNotify(deadline);
+}
+
 void ConnectionImpl::Begin(const TransactionOptions& options,
                            SteadyClock::time_point trx_start_time,
                            OptionalCommandControl trx_cmd_ctl) {
@@ -494,6 +665,80 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+bool ConnectionImpl::SendPortalExecute(
+    Connection::StatementId statement_id, const std::string& portal_name,
+    std::uint32_t n_rows, OptionalCommandControl statement_cmd_ctl) {
+#if LIBPQ_HAS_PIPELINING
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+
+  auto* prepared_info = prepared_.Get(statement_id);
+  UASSERT_MSG(prepared_info,
+              "Portal execute uses statement id that is absent in prepared "
+              "statements");
+
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span);
+  span.AddTag(tracing::kDatabaseStatement, prepared_info->statement);
+  CheckDeadlineReached(deadline);
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  // Statement timeout was set by the portal bind or the previous execute,
+  // changing it here would be queued after the execute
+  if (!IsPipelineActive()) {
+    conn_wrapper_.EnterPipelineMode();
+    is_portal_pipeline_ = true;
+  }
+  conn_wrapper_.SendPortalExecute(portal_name, n_rows, scope);
+  conn_wrapper_.SyncPipeline(deadline);
+  ++pending_portal_executes_;
+  return true;
+#else
+  return false;
+#endif
+}
+
+ResultSet ConnectionImpl::WaitPortalExecute(
+    Connection::StatementId statement_id,
+    OptionalCommandControl statement_cmd_ctl) {
+  UASSERT(pending_portal_executes_);
+  USERVER_NAMESPACE::utils::FastScopeGuard pending_guard([this]() noexcept {
+    if (--pending_portal_executes_ || !is_portal_pipeline_) return;
+    is_portal_pipeline_ = false;
+    // Marks the connection as broken if the results were not received
+    conn_wrapper_.ExitPipelineMode();
+  });
+
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+
+  auto* prepared_info = prepared_.Get(statement_id);
+  UASSERT_MSG(prepared_info,
+              "Portal execute uses statement id that is absent in prepared "
+              "statements");
+
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span);
+  span.AddTag(tracing::kDatabaseStatement, prepared_info->statement);
+  auto scope = span.CreateScopeTime(scopes::kExec);
+  CountExecute count_execute(stats_);
+
+  return HandleWaitErrors(prepared_info->statement, network_timeout, span, [&] {
+    auto res = conn_wrapper_.WaitPipelineSyncResult(deadline, scope);
+    if (!prepared_info->description.IsEmpty()) {
+      res.SetBufferCategoriesFrom(prepared_info->description);
+    } else if (!res.IsEmpty()) {
+      FillBufferCategories(res);
+    }
+    count_execute.AccountResult(res);
+    return res;
+  });
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -697,8 +942,15 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
       throw;
     }
 
-    conn_wrapper_.SendDescribePrepared(statement_name, scope);
     statement_info = prepared_.Get(query_id);
+    if (auto cached = GetCachedDescription(query_hash, statement)) {
+      LOG_TRACE() << "Query " << statement << " is already described";
+      statement_info->description = std::move(*cached);
+      ++stats_.parse_total;
+      return *statement_info;
+    }
+
+    conn_wrapper_.SendDescribePrepared(statement_name, scope);
     auto res = conn_wrapper_.WaitResult(deadline, scope);
     if (!res.pimpl_) {
       throw CommandError("WaitResult() returned nullptr");
@@ -707,6 +959,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
     statement_info->description = res;
     // Ensure we've got binary format established
     res.GetRowDescription().CheckBinaryFormat(db_types_);
+    if (description_cache_) description_cache_->Put(query_hash, statement, res);
     ++stats_.parse_total;
     return *statement_info;
   }
@@ -717,11 +970,29 @@ void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
   if (is_discard_prepared_pending_ && !IsInTransaction()) {
     LOG_DEBUG() << "Discarding prepared statements";
     prepared_.Clear();
+    // The descriptions might be outdated as well
+    if (description_cache_) description_cache_->Clear();
     ExecuteCommandNoPrepare("DEALLOCATE ALL", deadline);
     is_discard_prepared_pending_ = false;
   }
 }
 
+std::optional<ResultSet> ConnectionImpl::GetCachedDescription(
+    std::size_t query_hash, const std::string& statement) const {
+  if (!description_cache_) return std::nullopt;
+  auto description = description_cache_->Get(query_hash, statement);
+  if (!description) return std::nullopt;
+  try {
+    // The connection must know all the types used by the statement
+    description->GetRowDescription().CheckBinaryFormat(db_types_);
+  } catch (const std::exception& e) {
+    LOG_DEBUG() << "Cached description of `" << statement
+                << "` is not applicable: " << e;
+    return std::nullopt;
+  }
+  return description;
+}
+
 void ConnectionImpl::DiscardPreparedStatement(const PreparedStatementInfo& info,
                                               engine::Deadline deadline) {
   LOG_DEBUG() << "Discarding prepared statement " << info.statement_name;
@@ -766,6 +1037,149 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query,
                     scope, &prepared_info.description);
 }
 
+std::vector<ResultSet> ConnectionImpl::ExecuteBatch(const QueryBatch& batch,
+                                                   engine::Deadline deadline) {
+  ++stats_.batch_total;
+  if (!UsePipelineForBatch(batch)) {
+    std::vector<ResultSet> results;
+    results.reserve(batch.Size());
+    for (const auto& [query, params] : batch.GetEntries()) {
+      results.push_back(ExecuteCommand(
+          query, QueryParameters{params.GetInternalData()}, deadline));
+    }
+    return results;
+  }
+  return ExecutePipelinedBatch<ResultSet>(batch, deadline);
+}
+
+std::vector<IsolatedResult> ConnectionImpl::ExecuteIsolatedBatch(
+    const QueryBatch& batch, engine::Deadline deadline) {
+  ++stats_.batch_total;
+  if (!UsePipelineForBatch(batch)) {
+    std::vector<IsolatedResult> results(batch.Size());
+    const auto& entries = batch.GetEntries();
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+      try {
+        results[i].result = ExecuteCommand(
+            entries[i].query,
+            QueryParameters{entries[i].params.GetInternalData()}, deadline);
+      } catch (const std::exception&) {
+        results[i].error = std::current_exception();
+      }
+    }
+    return results;
+  }
+  return ExecutePipelinedBatch<IsolatedResult>(batch, deadline);
+}
+
+bool ConnectionImpl::UsePipelineForBatch(const QueryBatch& batch) const {
+#if LIBPQ_HAS_PIPELINING
+  return batch.Size() > 1;
+#else
+  static_cast<void>(batch);
+  return false;
+#endif
+}
+
+template <typename Result>
+std::vector<Result> ConnectionImpl::ExecutePipelinedBatch(
+    const QueryBatch& batch, engine::Deadline deadline) {
+  // Every statement of an isolated batch is followed by a sync point and runs
+  // in its own implicit transaction
+  constexpr bool kIsolated = std::is_same_v<Result, IsolatedResult>;
+
+  // Evicting a statement of the batch from the cache would deallocate it
+  // before the batch is sent
+  const bool use_prepared = settings_.prepared_statements !=
+                                ConnectionSettings::kNoPreparedStatements &&
+                            batch.Size() <= settings_.max_prepared_cache_size;
+  if (settings_.ignore_unused_query_params ==
+      ConnectionSettings::kCheckUnused) {
+    for (const auto& [query, params] : batch.GetEntries()) {
+      CheckQueryParameters(query.Statement(),
+                           QueryParameters{params.GetInternalData()});
+    }
+  }
+
+  DiscardOldPreparedStatements(deadline);
+  CheckDeadlineReached(deadline);
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span);
+  span.AddTag("pg_batch_size", batch.Size());
+  auto scope = span.CreateScopeTime();
+  TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  CountBatch count_batch(stats_, batch.Size());
+
+  // Statements are prepared beforehand, as waiting for the result of a
+  // prepare would consume the results of the queries already sent
+  std::vector<std::pair<std::string, ResultSet>> prepared;
+  if (use_prepared) {
+    prepared.reserve(batch.Size());
+    for (const auto& [query, params] : batch.GetEntries()) {
+      const auto& info = PrepareStatement(
+          query.Statement(), QueryParameters{params.GetInternalData()},
+          deadline, span, scope);
+      prepared.emplace_back(info.statement_name, info.description);
+    }
+  }
+
+  const bool is_temporary_pipeline = !IsPipelineActive();
+  if (is_temporary_pipeline) conn_wrapper_.EnterPipelineMode();
+  USERVER_NAMESPACE::utils::FastScopeGuard exit_pipeline_guard(
+      [this, is_temporary_pipeline]() noexcept {
+        if (is_temporary_pipeline) conn_wrapper_.ExitPipelineMode();
+      });
+
+  const auto statement = fmt::format("batch of {} queries", batch.Size());
+  return HandleWaitErrors(statement, network_timeout, span, [&] {
+    scope.Reset(scopes::kExec);
+    // The commands sent earlier must not share a transaction with the first
+    // statement
+    if (kIsolated && !is_temporary_pipeline) conn_wrapper_.PushPipelineSync();
+
+    const auto& entries = batch.GetEntries();
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+      const QueryParameters params{entries[i].params.GetInternalData()};
+      if (use_prepared) {
+        conn_wrapper_.SendPreparedQuery(prepared[i].first, params, scope);
+      } else {
+        conn_wrapper_.SendQuery(entries[i].query.Statement(), params, scope);
+      }
+      // The sync point of the last statement is added on flush
+      if (kIsolated && i + 1 < entries.size()) {
+        conn_wrapper_.PushPipelineSync();
+      }
+    }
+
+    std::vector<Result> results;
+    if constexpr (kIsolated) {
+      results =
+          conn_wrapper_.WaitIsolatedResults(deadline, batch.Size(), scope);
+    } else {
+      results = conn_wrapper_.WaitResults(deadline, batch.Size(), scope);
+    }
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      ResultSet* result = nullptr;
+      if constexpr (kIsolated) {
+        if (!results[i].error) result = &results[i].result;
+      } else {
+        result = &results[i];
+      }
+      if (!result) continue;
+
+      if (use_prepared && !prepared[i].second.IsEmpty()) {
+        result->SetBufferCategoriesFrom(prepared[i].second);
+      } else if (!result->IsEmpty()) {
+        FillBufferCategories(*result);
+      }
+    }
+    count_batch.AccountResults(results);
+    return results;
+  });
+}
+
 ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query,
                                                   engine::Deadline deadline) {
   static const QueryParameters kNoParams;
@@ -868,7 +1282,7 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
                                      Counter& counter, tracing::Span& span,
                                      tracing::ScopeTime& scope,
                                      const ResultSet* description_ptr) {
-  try {
+  return HandleWaitErrors(statement, network_timeout, span, [&] {
     auto res = conn_wrapper_.WaitResult(deadline, scope);
     if (description_ptr && !description_ptr->IsEmpty()) {
       res.SetBufferCategoriesFrom(*description_ptr);
@@ -877,6 +1291,16 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
     }
     counter.AccountResult(res);
     return res;
+  });
+}
+
+template <typename WaitFunc>
+auto ConnectionImpl::HandleWaitErrors(const std::string& statement,
+                                      TimeoutDuration network_timeout,
+                                      tracing::Span& span, WaitFunc&& wait)
+    -> decltype(wait()) {
+  try {
+    return wait();
   } catch (const InvalidSqlStatementName& e) {
     LOG_LIMITED_ERROR()
         << "Looks like your pg_bouncer is not in 'session' mode. "
@@ -917,6 +1341,26 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
   }
 }
 
+void ConnectionImpl::FinishCopy(const CopyState& copy_state) noexcept {
+  if (GetConnectionState() == ConnectionState::kTranActive) {
+    // The connection is stuck in the middle of COPY and can't be cleaned up
+    LOG_LIMITED_WARNING() << "Statement `" << copy_state.statement
+                          << "` was interrupted, dropping the connection";
+    ++stats_.error_execute_total;
+    MarkAsBroken();
+    return;
+  }
+  if (copy_state.is_pipeline_left && !IsBroken()) {
+    try {
+      conn_wrapper_.EnterPipelineMode();
+    } catch (const std::exception& e) {
+      LOG_LIMITED_WARNING() << "Failed to enter pipeline mode after COPY: "
+                            << e;
+      MarkAsBroken();
+    }
+  }
+}
+
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
 }  // namespace storages::postgres::detail
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/cache/lru_map.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -18,10 +20,12 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/statement_description_cache.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,7 +40,8 @@ class ConnectionImpl {
                  const DefaultCommandControls& default_cmd_ctls,
                  const testsuite::PostgresControl& testsuite_pg_ctl,
                  const error_injection::Settings& ei_settings,
-                 engine::SemaphoreLock&& size_lock);
+                 engine::SemaphoreLock&& size_lock,
+                 std::shared_ptr<StatementDescriptionCache> description_cache);
 
   void AsyncConnect(const Dsn& dsn, engine::Deadline deadline);
   void Close();
@@ -68,6 +73,21 @@ class ConnectionImpl {
                            const detail::QueryParameters& params,
                            OptionalCommandControl statement_cmd_ctl);
 
+  std::vector<ResultSet> ExecuteBatch(const QueryBatch& batch,
+                                      OptionalCommandControl statement_cmd_ctl);
+  std::vector<IsolatedResult> ExecuteIsolatedBatch(
+      const QueryBatch& batch, OptionalCommandControl statement_cmd_ctl);
+
+  void StartCopy(const std::string& statement,
+                 OptionalCommandControl statement_cmd_ctl);
+  void PutCopyData(std::string_view data);
+  ResultSet EndCopyIn(const char* error_message);
+  bool GetCopyData(std::string& data);
+
+  void Listen(std::string_view channel);
+  void Unlisten(std::string_view channel);
+  std::optional<Notification> WaitNotify(engine::Deadline deadline);
+
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
              OptionalCommandControl trx_cmd_ctl = {});
@@ -86,6 +106,13 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  bool SendPortalExecute(Connection::StatementId statement_id,
+                         const std::string& portal_name, std::uint32_t n_rows,
+                         OptionalCommandControl statement_cmd_ctl);
+
+  ResultSet WaitPortalExecute(Connection::StatementId statement_id,
+                              OptionalCommandControl statement_cmd_ctl);
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -114,6 +141,12 @@ class ConnectionImpl {
 
   struct ResetTransactionCommandControl;
 
+  struct CopyState {
+    std::string statement;
+    TimeoutDuration network_timeout;
+    bool is_pipeline_left;
+  };
+
   void CheckBusy() const;
   void CheckDeadlineReached(const engine::Deadline& deadline);
   tracing::Span MakeQuerySpan(const Query& query) const;
@@ -135,6 +168,8 @@ class ConnectionImpl {
       engine::Deadline deadline, tracing::Span& span,
       tracing::ScopeTime& scope);
   void DiscardOldPreparedStatements(engine::Deadline deadline);
+  std::optional<ResultSet> GetCachedDescription(
+      std::size_t query_hash, const std::string& statement) const;
   void DiscardPreparedStatement(const PreparedStatementInfo& info,
                                 engine::Deadline deadline);
 
@@ -144,6 +179,15 @@ class ConnectionImpl {
                            const detail::QueryParameters& params,
                            engine::Deadline deadline);
 
+  std::vector<ResultSet> ExecuteBatch(const QueryBatch& batch,
+                                      engine::Deadline deadline);
+  std::vector<IsolatedResult> ExecuteIsolatedBatch(const QueryBatch& batch,
+                                                   engine::Deadline deadline);
+  bool UsePipelineForBatch(const QueryBatch& batch) const;
+  template <typename Result>
+  std::vector<Result> ExecutePipelinedBatch(const QueryBatch& batch,
+                                            engine::Deadline deadline);
+
   ResultSet ExecuteCommandNoPrepare(const Query& query,
                                     engine::Deadline deadline);
 
@@ -169,16 +213,27 @@ class ConnectionImpl {
                        tracing::Span& span, tracing::ScopeTime& scope,
                        const ResultSet* description_ptr);
 
+  template <typename WaitFunc>
+  auto HandleWaitErrors(const std::string& statement,
+                        TimeoutDuration network_timeout, tracing::Span& span,
+                        WaitFunc&& wait) -> decltype(wait());
+
+  void FinishCopy(const CopyState& copy_state) noexcept;
+
   void Cancel();
 
   const std::string uuid_;
   Connection::Statistics stats_;
   PGConnectionWrapper conn_wrapper_;
   PreparedStatements prepared_;
+  std::shared_ptr<StatementDescriptionCache> description_cache_;
   UserTypes db_types_;
   bool is_in_recovery_ = true;
   bool is_read_only_ = true;
   bool is_discard_prepared_pending_ = false;
+  // Portal executes sent ahead and the pipeline mode entered for them
+  std::size_t pending_portal_executes_ = 0;
+  bool is_portal_pipeline_ = false;
   ConnectionSettings settings_;
 
   CommandControl default_cmd_ctl_{{}, {}};
@@ -186,6 +241,7 @@ class ConnectionImpl {
   testsuite::PostgresControl testsuite_pg_ctl_;
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
+  std::optional<CopyState> copy_state_;
   const error_injection::Settings ei_settings_;
 };
 
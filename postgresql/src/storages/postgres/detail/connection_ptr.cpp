@@ -50,6 +50,10 @@ std::optional<dynamic_config::Source> ConnectionPtr::GetConfigSource() const {
   return {pool_->GetConfigSource()};
 }
 
+void ConnectionPtr::AccountCancelledByDeadline() const {
+  if (pool_) pool_->AccountCancelledByDeadline();
+}
+
 void ConnectionPtr::Reset(std::unique_ptr<Connection> conn,
                           std::shared_ptr<ConnectionPool> pool) {
   Release();
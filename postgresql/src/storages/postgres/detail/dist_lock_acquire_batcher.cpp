@@ -0,0 +1,163 @@
+#include <storages/postgres/detail/dist_lock_acquire_batcher.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/cluster.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+struct DistLockAcquireBatcher::Request {
+  Request(std::string key, std::string owner, double timeout_seconds)
+      : key(std::move(key)),
+        owner(std::move(owner)),
+        timeout_seconds(timeout_seconds) {}
+
+  const std::string key;
+  const std::string owner;
+  const double timeout_seconds;
+
+  engine::SingleConsumerEvent event;
+
+  // Protected by the batcher mutex
+  bool is_leader{false};
+  bool is_done{false};
+  bool is_acquired{false};
+  std::exception_ptr error;
+};
+
+DistLockAcquireBatcher::DistLockAcquireBatcher(ClusterPtr cluster,
+                                               std::string acquire_query)
+    : cluster_(std::move(cluster)), acquire_query_(std::move(acquire_query)) {
+  UASSERT(cluster_);
+}
+
+std::shared_ptr<DistLockAcquireBatcher> DistLockAcquireBatcher::Get(
+    ClusterPtr cluster, const std::string& table, std::string acquire_query) {
+  using Key = std::pair<const Cluster*, std::string>;
+  using Batchers = std::map<Key, std::weak_ptr<DistLockAcquireBatcher>>;
+  // A batcher owns its cluster, so the cluster pointer is not reused while
+  // the batcher is alive
+  static concurrent::Variable<Batchers, std::mutex> batchers;
+
+  auto locked = batchers.Lock();
+  for (auto it = locked->begin(); it != locked->end();) {
+    if (it->second.expired()) {
+      it = locked->erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  auto& weak_batcher = (*locked)[Key{cluster.get(), table}];
+  auto batcher = weak_batcher.lock();
+  if (!batcher) {
+    batcher = std::make_shared<DistLockAcquireBatcher>(
+        std::move(cluster), std::move(acquire_query));
+    weak_batcher = batcher;
+  }
+  return batcher;
+}
+
+bool DistLockAcquireBatcher::Acquire(const CommandControl& cc, std::string key,
+                                     std::string owner,
+                                     double timeout_seconds) {
+  auto request = std::make_shared<Request>(std::move(key), std::move(owner),
+                                           timeout_seconds);
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    pending_.push_back(request);
+    request->is_leader = !std::exchange(is_running_, true);
+  }
+
+  // Other requests may be sent along with this one, so the batch is not
+  // interrupted. The wait is limited by the command control timeouts.
+  engine::TaskCancellationBlocker cancel_blocker;
+  for (;;) {
+    bool is_leader = false;
+    {
+      std::lock_guard<engine::Mutex> lock(mutex_);
+      if (request->is_done) break;
+      is_leader = request->is_leader;
+    }
+
+    if (is_leader) {
+      RunBatch(cc);
+    } else {
+      [[maybe_unused]] const bool ok = request->event.WaitForEvent();
+    }
+  }
+
+  if (request->error) std::rethrow_exception(request->error);
+  return request->is_acquired;
+}
+
+void DistLockAcquireBatcher::RunBatch(const CommandControl& cc) noexcept {
+  std::vector<std::shared_ptr<Request>> batch;
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    batch.swap(pending_);
+  }
+
+  // The statements of a batch run in a single transaction, rows are locked in
+  // the same order by all the hosts to avoid deadlocks between their batches
+  std::sort(batch.begin(), batch.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs->key < rhs->key;
+  });
+
+  std::vector<ResultSet> results;
+  std::exception_ptr error;
+  try {
+    QueryBatch queries;
+    for (const auto& request : batch) {
+      ParameterStore params;
+      params.PushBack(request->key)
+          .PushBack(request->owner)
+          .PushBack(request->timeout_seconds);
+      queries.Add(acquire_query_, std::move(params));
+    }
+    results = cluster_->ExecuteBatch(ClusterHostType::kMaster, cc, queries);
+    UINVARIANT(results.size() == batch.size(),
+               "Unexpected number of the batch results");
+  } catch (const std::exception&) {
+    error = std::current_exception();
+  }
+
+  std::shared_ptr<Request> next_leader;
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      auto& request = *batch[i];
+      request.is_done = true;
+      if (error) {
+        request.error = error;
+      } else {
+        request.is_acquired = !results[i].IsEmpty();
+      }
+    }
+
+    if (pending_.empty()) {
+      is_running_ = false;
+    } else {
+      next_leader = pending_.front();
+      next_leader->is_leader = true;
+    }
+  }
+
+  for (const auto& request : batch) request->event.Send();
+  if (next_leader) next_leader->event.Send();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
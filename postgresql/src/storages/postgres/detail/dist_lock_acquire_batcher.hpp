@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+// Sends the concurrent acquire and prolong queries of the distributed locks
+// stored in the same table in a single network roundtrip. While a batch is in
+// flight, new requests are queued, and the first of them sends the whole
+// queue as the next batch once the current one completes. No delay is added
+// to collect a batch.
+class DistLockAcquireBatcher final {
+ public:
+  // `acquire_query` takes the key, the owner and the timeout in seconds,
+  // returns a row if the lock is acquired
+  DistLockAcquireBatcher(ClusterPtr cluster, std::string acquire_query);
+
+  // Returns the batcher shared by all the locks of the `table` in the
+  // `cluster`
+  static std::shared_ptr<DistLockAcquireBatcher> Get(
+      ClusterPtr cluster, const std::string& table, std::string acquire_query);
+
+  // Returns whether the lock is acquired, the batch is run with the command
+  // control of the request that sends it
+  bool Acquire(const CommandControl& cc, std::string key, std::string owner,
+               double timeout_seconds);
+
+ private:
+  struct Request;
+
+  // Sends all the pending requests and passes the leadership to the first of
+  // the requests queued meanwhile
+  void RunBatch(const CommandControl& cc) noexcept;
+
+  const ClusterPtr cluster_;
+  const std::string acquire_query_;
+
+  engine::Mutex mutex_;
+  std::vector<std::shared_ptr<Request>> pending_;
+  bool is_running_{false};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
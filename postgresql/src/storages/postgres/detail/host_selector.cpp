@@ -0,0 +1,69 @@
+#include <storages/postgres/detail/host_selector.hpp>
+
+#include <algorithm>
+#include <optional>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Keeps the number of queries in flight meaningful for the hosts that have
+// not reported any latency yet
+constexpr std::chrono::microseconds kMinExpectedLatency{100};
+
+std::chrono::microseconds GetExpectedLatency(const HostLoad& host) {
+  auto latency = host.query_latency;
+  if (latency.count() <= 0) latency = host.roundtrip_time;
+  return std::max(latency, kMinExpectedLatency);
+}
+
+}  // namespace
+
+HostSelection SelectAdaptiveHost(const std::vector<HostLoad>& hosts,
+                                 std::chrono::milliseconds max_replication_lag,
+                                 std::size_t start_pos) {
+  UASSERT(!hosts.empty());
+
+  std::optional<std::chrono::microseconds> min_rtt;
+  for (const auto& host : hosts) {
+    if (host.roundtrip_time.count() < 0) continue;
+    if (!min_rtt || host.roundtrip_time < *min_rtt) {
+      min_rtt = host.roundtrip_time;
+    }
+  }
+
+  HostSelection best;
+  double best_cost = 0;
+  for (std::size_t i = 0; i < hosts.size(); ++i) {
+    const auto pos = (start_pos + i) % hosts.size();
+    const auto& host = hosts[pos];
+
+    // Without any RTT measurements all the hosts are considered near
+    const bool is_nearest =
+        !min_rtt || (host.roundtrip_time.count() >= 0 &&
+                     host.roundtrip_time <= *min_rtt + kNearestHostRttMargin);
+
+    double cost = static_cast<double>(GetExpectedLatency(host).count()) *
+                  static_cast<double>(host.in_flight + 1);
+    if (max_replication_lag.count() > 0) {
+      cost *= 1.0 + std::min(1.0, static_cast<double>(
+                                      host.replication_lag.count()) /
+                                      max_replication_lag.count());
+    }
+    if (!is_nearest) cost *= kRemoteHostCostFactor;
+
+    if (i == 0 || cost < best_cost) {
+      best = {pos, is_nearest};
+      best_cost = cost;
+    }
+  }
+  return best;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
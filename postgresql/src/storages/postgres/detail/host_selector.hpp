@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Load and health of a host as seen by the cluster
+struct HostLoad {
+  /// Roundtrip time of the topology check, negative if unknown
+  std::chrono::microseconds roundtrip_time{-1};
+  /// Smoothed query latency, zero if there were no queries yet
+  std::chrono::microseconds query_latency{0};
+  /// Number of connections in use and requests waiting for a connection
+  std::size_t in_flight{0};
+  /// Replication lag, zero for the master
+  std::chrono::milliseconds replication_lag{0};
+};
+
+struct HostSelection {
+  /// Position of the chosen host in the list of candidates
+  std::size_t pos{0};
+  /// Whether the host is among the nearest ones by RTT
+  bool is_nearest{true};
+};
+
+/// Chooses the host with the lowest cost, which is the expected latency
+/// multiplied by the number of queries in flight and increased in proportion
+/// to the replication lag relative to the maximum allowed one.
+///
+/// Hosts with RTT close to the lowest one are considered to be in the nearest
+/// datacenter; the cost of other hosts is multiplied by
+/// kRemoteHostCostFactor, so they are only chosen when the nearest ones are
+/// overloaded. Ties are broken starting from `start_pos`, so that the hosts of
+/// equal cost are used in a round-robin manner.
+HostSelection SelectAdaptiveHost(const std::vector<HostLoad>& hosts,
+                                 std::chrono::milliseconds max_replication_lag,
+                                 std::size_t start_pos);
+
+/// Hosts with RTT no more than this far from the lowest one are the nearest
+inline constexpr std::chrono::microseconds kNearestHostRttMargin{500};
+inline constexpr double kRemoteHostCostFactor = 4.0;
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
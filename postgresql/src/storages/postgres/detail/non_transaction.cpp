@@ -1,5 +1,6 @@
 #include <userver/storages/postgres/detail/non_transaction.hpp>
 
+#include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/statement_timer.hpp>
 
@@ -25,9 +26,16 @@ ResultSet NonTransaction::Execute(OptionalCommandControl statement_cmd_ctl,
                    statement_cmd_ctl);
 }
 
+std::vector<ResultSet> NonTransaction::ExecuteBatch(
+    OptionalCommandControl statement_cmd_ctl, const QueryBatch& batch) {
+  statement_cmd_ctl = CheckDeadline(conn_, std::move(statement_cmd_ctl));
+  return conn_->ExecuteBatch(batch, std::move(statement_cmd_ctl));
+}
+
 ResultSet NonTransaction::DoExecute(const Query& query,
                                     const detail::QueryParameters& params,
                                     OptionalCommandControl statement_cmd_ctl) {
+  statement_cmd_ctl = CheckDeadline(conn_, std::move(statement_cmd_ctl));
   StatementTimer timer{query, conn_};
   auto res = conn_->Execute(query, params, statement_cmd_ctl);
   timer.Account();
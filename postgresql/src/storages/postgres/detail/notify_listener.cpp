@@ -0,0 +1,209 @@
+#include <storages/postgres/detail/notify_listener.hpp>
+
+#include <chrono>
+#include <mutex>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+constexpr std::chrono::seconds kReconnectInterval{1};
+// An idle connection is pinged this often to detect a broken network
+constexpr std::chrono::seconds kPingInterval{10};
+// Notifications of a slow subscriber above the limit are dropped
+constexpr std::size_t kMaxQueuedNotifications = 10000;
+
+}  // namespace
+
+NotifyListener::NotifyListener(ConnectFunc connect)
+    : connect_(std::move(connect)),
+      task_(engine::CriticalAsyncNoSpan([this] { Run(); })) {}
+
+NotifyListener::~NotifyListener() { Stop(); }
+
+NotifyScope NotifyListener::Listen(std::string channel,
+                                   engine::Deadline deadline) {
+  auto queue = NotifyScope::Queue::Create(kMaxQueuedNotifications);
+  const auto id = ++last_id_;
+
+  {
+    std::unique_lock lock{mutex_};
+    if (is_stopped_) throw ClusterUnavailable("Cluster is being destroyed");
+
+    subscribers_[channel].push_back({id, queue->GetProducer()});
+    Wakeup();
+    const bool is_listened = listened_cv_.WaitUntil(
+        lock, deadline, [&] { return listened_.count(channel) > 0; });
+    if (!is_listened) {
+      lock.unlock();
+      Unlisten(channel, id);
+      throw ConnectionTimeoutError(
+          fmt::format("Timed out while subscribing to channel '{}'", channel));
+    }
+  }
+
+  return NotifyScope{shared_from_this(), std::move(channel), id,
+                     queue->GetConsumer()};
+}
+
+void NotifyListener::Unlisten(const std::string& channel,
+                              std::uint64_t id) noexcept {
+  std::lock_guard lock{mutex_};
+  const auto it = subscribers_.find(channel);
+  if (it == subscribers_.end()) return;
+
+  auto& subscribers = it->second;
+  for (auto sub_it = subscribers.begin(); sub_it != subscribers.end();
+       ++sub_it) {
+    if (sub_it->id == id) {
+      subscribers.erase(sub_it);
+      break;
+    }
+  }
+  if (subscribers.empty()) {
+    subscribers_.erase(it);
+    Wakeup();
+  }
+}
+
+void NotifyListener::Stop() noexcept {
+  if (task_.IsValid()) task_.SyncCancel();
+
+  std::lock_guard lock{mutex_};
+  is_stopped_ = true;
+  // the consumers get no more notifications
+  subscribers_.clear();
+}
+
+void NotifyListener::Run() {
+  std::unique_ptr<Connection> connection;
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      if (!connection) {
+        connection = connect_();
+        LOG_INFO() << "Connected to PostgreSQL to LISTEN";
+      }
+
+      engine::Future<void> wakeup;
+      {
+        std::lock_guard lock{mutex_};
+        wakeup_.emplace();
+        wakeup = wakeup_->get_future();
+      }
+
+      SyncChannels(*connection);
+      WaitNotifications(*connection, std::move(wakeup));
+    } catch (const std::exception& ex) {
+      if (engine::current_task::ShouldCancel()) break;
+
+      LOG_WARNING() << "Failed to LISTEN to PostgreSQL notifications, "
+                       "reconnecting: "
+                    << ex;
+      CloseConnection(connection);
+      engine::InterruptibleSleepFor(kReconnectInterval);
+    }
+  }
+
+  CloseConnection(connection);
+}
+
+void NotifyListener::SyncChannels(Connection& connection) {
+  std::vector<std::string> to_listen;
+  std::vector<std::string> to_unlisten;
+  {
+    std::lock_guard lock{mutex_};
+    for (const auto& [channel, subscribers] : subscribers_) {
+      if (!listened_.count(channel)) to_listen.push_back(channel);
+    }
+    for (const auto& channel : listened_) {
+      if (!subscribers_.count(channel)) to_unlisten.push_back(channel);
+    }
+  }
+
+  for (const auto& channel : to_unlisten) {
+    connection.Unlisten(channel);
+    std::lock_guard lock{mutex_};
+    listened_.erase(channel);
+  }
+  for (auto& channel : to_listen) {
+    connection.Listen(channel);
+    std::lock_guard lock{mutex_};
+    listened_.insert(std::move(channel));
+  }
+  if (!to_listen.empty()) listened_cv_.NotifyAll();
+}
+
+void NotifyListener::WaitNotifications(Connection& connection,
+                                       engine::Future<void> wakeup) {
+  const auto ping_deadline = engine::Deadline::FromDuration(kPingInterval);
+  auto wait_task = engine::AsyncNoSpan([&connection] {
+    return connection.WaitNotify(engine::Deadline{});
+  });
+  engine::WaitAnyUntil(ping_deadline, wait_task, wakeup);
+  if (!wait_task.IsFinished()) wait_task.SyncCancel();
+
+  std::optional<Notification> notification;
+  try {
+    notification = wait_task.Get();
+  } catch (const engine::TaskCancelledException&) {
+    // cancelled before it has started
+  }
+
+  if (!notification) {
+    if (ping_deadline.IsReached()) connection.Ping();
+    return;
+  }
+
+  Dispatch(*notification);
+  // the rest of the notifications that have been received at once
+  while (auto next = connection.WaitNotify(engine::Deadline::Passed())) {
+    Dispatch(*next);
+  }
+}
+
+void NotifyListener::Dispatch(const Notification& notification) {
+  std::lock_guard lock{mutex_};
+  const auto it = subscribers_.find(notification.channel);
+  if (it == subscribers_.end()) return;
+
+  for (const auto& subscriber : it->second) {
+    auto copy = notification;
+    if (!subscriber.producer.PushNoblock(std::move(copy))) {
+      LOG_LIMITED_WARNING() << "A notification of channel '"
+                            << notification.channel
+                            << "' is dropped, the subscriber is too slow";
+    }
+  }
+}
+
+void NotifyListener::CloseConnection(
+    std::unique_ptr<Connection>& connection) noexcept {
+  {
+    std::lock_guard lock{mutex_};
+    listened_.clear();
+  }
+  // the connection is closed in background on destruction
+  connection.reset();
+}
+
+void NotifyListener::Wakeup() {
+  if (!wakeup_) return;
+  wakeup_->set_value();
+  wakeup_.reset();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/postgres/notify.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Multiplexes the LISTEN subscriptions of a cluster over a dedicated
+/// connection. The connection is reestablished on errors and listens to all
+/// the subscribed channels again, the notifications sent in between are lost.
+class NotifyListener final
+    : public std::enable_shared_from_this<NotifyListener> {
+ public:
+  using ConnectFunc = std::function<std::unique_ptr<Connection>()>;
+
+  explicit NotifyListener(ConnectFunc connect);
+  ~NotifyListener();
+
+  /// Waits until the connection listens to the channel
+  /// @throws ConnectionTimeoutError if the deadline is reached first
+  NotifyScope Listen(std::string channel, engine::Deadline deadline);
+
+  void Unlisten(const std::string& channel, std::uint64_t id) noexcept;
+
+  /// Closes the connection, the subscriptions get no more notifications
+  void Stop() noexcept;
+
+ private:
+  struct Subscriber {
+    std::uint64_t id;
+    NotifyScope::Queue::Producer producer;
+  };
+
+  void Run();
+  void SyncChannels(Connection& connection);
+  void WaitNotifications(Connection& connection, engine::Future<void> wakeup);
+  void Dispatch(const Notification& notification);
+  void CloseConnection(std::unique_ptr<Connection>& connection) noexcept;
+
+  // Interrupts the wait for notifications to LISTEN or UNLISTEN the channels,
+  // expects the mutex_ to be locked
+  void Wakeup();
+
+  const ConnectFunc connect_;
+  std::atomic<std::uint64_t> last_id_{0};
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable listened_cv_;
+  std::unordered_map<std::string, std::vector<Subscriber>> subscribers_;
+  // The channels the current connection listens to
+  std::unordered_set<std::string> listened_;
+  std::optional<engine::Promise<void>> wakeup_;
+  bool is_stopped_{false};
+
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
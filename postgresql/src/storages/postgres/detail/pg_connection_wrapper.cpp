@@ -10,6 +10,8 @@ auto PQXisBusy(PGconn* conn) { return ::PQisBusy(conn); }
 auto PQXgetResult(PGconn* conn) { return ::PQgetResult(conn); }
 #endif
 
+#include <fmt/format.h>
+
 #include <crypto/openssl.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -407,6 +409,21 @@ void PGConnectionWrapper::EnterPipelineMode() {
 #endif
 }
 
+void PGConnectionWrapper::ExitPipelineMode() {
+#if LIBPQ_HAS_PIPELINING
+  if (!PQexitPipelineMode(conn_)) {
+    PGCW_LOG_LIMITED_WARNING()
+        << "libpq failed to exit pipeline connection mode: "
+        << PQerrorMessage(conn_);
+    MarkAsBroken();
+    return;
+  }
+  PGCW_LOG_DEBUG() << "Exited pipeline mode";
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+#endif
+}
+
 bool PGConnectionWrapper::IsSyncingPipeline() const {
   return pipeline_sync_counter_ > 0;
 }
@@ -419,6 +436,11 @@ bool PGConnectionWrapper::IsPipelineActive() const {
 #endif
 }
 
+void PGConnectionWrapper::SyncPipeline(Deadline deadline) {
+  UASSERT(IsPipelineActive());
+  Flush(deadline);
+}
+
 void PGConnectionWrapper::RefreshSocket(const Dsn& dsn) {
   const auto fd = PQsocket(conn_);
   if (fd < 0) {
@@ -492,6 +514,40 @@ bool PGConnectionWrapper::TryConsumeInput(Deadline deadline) {
   return true;
 }
 
+std::optional<Notification> PGConnectionWrapper::WaitNotify(
+    Deadline deadline) {
+  while (true) {
+    if (auto* notify = PQnotifies(conn_)) {
+      Notification notification{notify->relname,
+                                notify->extra ? notify->extra : "",
+                                notify->be_pid};
+      PQfreemem(notify);
+      UpdateLastUse();
+      return notification;
+    }
+
+    HandleSocketPostClose();
+    if (!socket_.IsValid()) {
+      throw CommandError("Connection is closed while waiting for a notify");
+    }
+    if (!WaitSocketReadable(deadline)) return std::nullopt;
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+  }
+}
+
+std::string PGConnectionWrapper::EscapeIdentifier(
+    std::string_view identifier) {
+  auto* escaped =
+      PQescapeIdentifier(conn_, identifier.data(), identifier.size());
+  if (!escaped) {
+    throw CommandError(fmt::format("Failed to escape identifier: {}",
+                                   PQerrorMessage(conn_)));
+  }
+  std::string result{escaped};
+  PQfreemem(escaped);
+  return result;
+}
+
 void PGConnectionWrapper::ConsumeInput(Deadline deadline) {
   if (!TryConsumeInput(deadline)) {
     if (engine::current_task::ShouldCancel()) {
@@ -539,6 +595,154 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
   return MakeResult(std::move(handle));
 }
 
+ResultSet PGConnectionWrapper::WaitPipelineSyncResult(
+    Deadline deadline, tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  UASSERT(IsSyncingPipeline());
+  const auto pending_syncs = pipeline_sync_counter_ - 1;
+  auto handle = MakeResultHandle(nullptr);
+  auto null_res_counter{0};
+  while (pipeline_sync_counter_ > pending_syncs &&
+         PQstatus(conn_) != CONNECTION_BAD) {
+    auto* pg_res = ReadResult(deadline);
+    if (!pg_res) {
+      // Same issue as with WaitResult
+      if (++null_res_counter > 2) {
+        MarkAsBroken();
+        if (!handle) throw RuntimeError{"Empty result"};
+        pipeline_sync_counter_ = 0;
+      }
+      continue;
+    }
+    null_res_counter = 0;
+    auto next_handle = MakeResultHandle(pg_res);
+#if LIBPQ_HAS_PIPELINING
+    const auto status = PQresultStatus(pg_res);
+    if (status == PGRES_PIPELINE_SYNC)
+      HandlePipelineSync();
+    else if (status != PGRES_PIPELINE_ABORTED)
+#endif
+      handle = std::move(next_handle);
+  }
+
+  return MakeResult(std::move(handle));
+}
+
+std::vector<ResultSet> PGConnectionWrapper::WaitResults(
+    Deadline deadline, std::size_t count, tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  std::vector<ResultHandle> handles;
+  auto null_res_counter{0};
+  do {
+    while (auto* pg_res = ReadResult(deadline)) {
+      null_res_counter = 0;
+      auto handle = MakeResultHandle(pg_res);
+#if LIBPQ_HAS_PIPELINING
+      if (PQresultStatus(pg_res) == PGRES_PIPELINE_SYNC) {
+        HandlePipelineSync();
+        continue;
+      }
+#endif
+      handles.push_back(std::move(handle));
+    }
+    // Same issue as with WaitResult
+    if (++null_res_counter > 2) {
+      MarkAsBroken();
+      if (handles.empty()) throw RuntimeError{"Empty result"};
+      pipeline_sync_counter_ = 0;
+    }
+  } while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD);
+
+  if (handles.size() < count) {
+    MarkAsBroken();
+    throw RuntimeError{fmt::format(
+        "Pipeline returned {} results for {} queries", handles.size(), count)};
+  }
+
+  // After an error the rest of the pipeline is aborted, so the first error
+  // is thrown no matter whether it belongs to the batch or not
+  std::vector<ResultSet> results;
+  results.reserve(count);
+  const auto batch_begin = handles.size() - count;
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+#if LIBPQ_HAS_PIPELINING
+    if (PQresultStatus(handles[i].get()) == PGRES_PIPELINE_ABORTED) {
+      if (i < batch_begin) continue;
+      throw RuntimeError{"Query was not executed in an aborted pipeline"};
+    }
+#endif
+    auto res = MakeResult(std::move(handles[i]));
+    if (i >= batch_begin) results.push_back(std::move(res));
+  }
+  return results;
+}
+
+void PGConnectionWrapper::PushPipelineSync() {
+  UASSERT(IsPipelineActive());
+#if LIBPQ_HAS_PIPELINING
+  HandleSocketPostClose();
+  CheckError<CommandError>("PQpipelineSync", PQpipelineSync(conn_));
+  ++pipeline_sync_counter_;
+#endif
+}
+
+std::vector<IsolatedResult> PGConnectionWrapper::WaitIsolatedResults(
+    Deadline deadline, std::size_t count, tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  // The last result of the commands before each of the sync points, null if
+  // the commands were aborted
+  std::vector<ResultHandle> handles;
+  auto handle = MakeResultHandle(nullptr);
+  auto null_res_counter{0};
+  do {
+    while (auto* pg_res = ReadResult(deadline)) {
+      null_res_counter = 0;
+      auto next_handle = MakeResultHandle(pg_res);
+#if LIBPQ_HAS_PIPELINING
+      const auto status = PQresultStatus(pg_res);
+      if (status == PGRES_PIPELINE_SYNC) {
+        HandlePipelineSync();
+        handles.push_back(std::move(handle));
+        handle = MakeResultHandle(nullptr);
+        continue;
+      }
+      if (status == PGRES_PIPELINE_ABORTED) continue;
+#endif
+      handle = std::move(next_handle);
+    }
+    // Same issue as with WaitResult
+    if (++null_res_counter > 2) {
+      MarkAsBroken();
+      pipeline_sync_counter_ = 0;
+    }
+  } while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD);
+
+  if (handles.size() < count) {
+    MarkAsBroken();
+    throw RuntimeError{fmt::format(
+        "Pipeline returned {} results for {} queries", handles.size(), count)};
+  }
+
+  std::vector<IsolatedResult> results(count);
+  const auto batch_begin = handles.size() - count;
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& result_handle = handles[batch_begin + i];
+    if (!result_handle) {
+      results[i].error = std::make_exception_ptr(
+          RuntimeError{"Query was not executed in an aborted pipeline"});
+      continue;
+    }
+    try {
+      results[i].result = MakeResult(std::move(result_handle));
+    } catch (const std::exception&) {
+      results[i].error = std::current_exception();
+    }
+  }
+  return results;
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
@@ -736,6 +940,85 @@ void PGConnectionWrapper::SendPreparedQuery(const std::string& name,
   UpdateLastUse();
 }
 
+void PGConnectionWrapper::StartCopy(const std::string& statement,
+                                    Deadline deadline,
+                                    tracing::ScopeTime& scope) {
+  SendQuery(statement, scope);
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(ReadResult(deadline));
+  if (!handle) throw RuntimeError{"Empty result"};
+  const auto status = PQresultStatus(handle.get());
+  if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT) return;
+
+  // The COPY failed, the error is reported after all the results are read
+  while (auto* pg_res = ReadResult(deadline)) {
+    MakeResultHandle(pg_res);
+  }
+  MakeResult(std::move(handle));
+  throw LogicError{"Statement `" + statement + "` is not a COPY"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  while (true) {
+    const int put_res =
+        PQputCopyData(conn_, data.data(), static_cast<int>(data.size()));
+    if (put_res > 0) break;
+    if (put_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(PQerrorMessage(conn_));
+    }
+    // Output buffers are full
+    Flush(deadline);
+  }
+  // Waiting for the data to be sent keeps the output buffer bounded
+  Flush(deadline);
+}
+
+ResultSet PGConnectionWrapper::EndCopyIn(const char* error_message,
+                                         Deadline deadline,
+                                         tracing::ScopeTime& scope) {
+  while (true) {
+    const int end_res = PQputCopyEnd(conn_, error_message);
+    if (end_res > 0) break;
+    if (end_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(PQerrorMessage(conn_));
+    }
+    // Output buffers are full
+    Flush(deadline);
+  }
+  return WaitResult(deadline, scope);
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& data, Deadline deadline) {
+  char* buffer = nullptr;
+  while (true) {
+    const int get_res = PQgetCopyData(conn_, &buffer, 1);
+    if (get_res > 0) {
+      data.assign(buffer, get_res);
+      PQfreemem(buffer);
+      UpdateLastUse();
+      return true;
+    }
+    if (get_res == -1) return false;
+    if (get_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(PQerrorMessage(conn_));
+    }
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while reading COPY data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while reading COPY data from PostgreSQL connection";
+      throw ConnectionTimeoutError("Timed out while reading COPY data");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+  }
+}
+
 #ifndef USERVER_NO_LIBPQ_PATCHES
 void PGConnectionWrapper::SendPortalBind(const std::string& statement_name,
                                          const std::string& portal_name,
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -16,6 +19,7 @@
 #include <storages/postgres/detail/result_wrapper.hpp>
 #include <userver/engine/semaphore.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -57,6 +61,12 @@ class PGConnectionWrapper {
   /// Requires libpq >= 14.
   void EnterPipelineMode();
 
+  /// @brief Exit pipeline mode, the connection is marked as broken if some
+  /// results are still pending
+  ///
+  /// Requires libpq >= 14.
+  void ExitPipelineMode();
+
   /// @brief Returns true if command send queue is empty.
   ///
   /// Normally command queue is flushed after any Send* call, but in pipeline
@@ -66,6 +76,10 @@ class PGConnectionWrapper {
   /// Check if pipeline mode is currently enabled
   bool IsPipelineActive() const;
 
+  /// @brief Sends the commands queued in pipeline mode followed by a sync
+  /// point without waiting for their results
+  void SyncPipeline(Deadline deadline);
+
   /// @brief Close the connection on a background task processor.
   [[nodiscard]] engine::Task Close();
 
@@ -99,10 +113,60 @@ class PGConnectionWrapper {
   void SendPortalExecute(const std::string& portal_name, std::uint32_t n_rows,
                          tracing::ScopeTime&);
 
+  /// @brief Send a COPY statement and wait for the server to switch to
+  /// COPY IN or COPY OUT mode
+  void StartCopy(const std::string& statement, Deadline deadline,
+                 tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData, waits until the data is sent
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, waits for the result of COPY
+  /// The COPY fails with the error_message if it is not null
+  ResultSet EndCopyIn(const char* error_message, Deadline deadline,
+                      tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQgetCopyData, waits for the next data row
+  /// Returns false once all the data is received, the result of COPY should
+  /// be waited for then
+  bool GetCopyData(std::string& data, Deadline deadline);
+
   /// @brief Wait for query result
   /// Will return result or throw an exception
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&);
 
+  /// @brief Wait for the result of the commands sent before the oldest pending
+  /// pipeline sync point
+  /// The results of the commands sent after it are left pending
+  ResultSet WaitPipelineSyncResult(Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Wait for results of the last `count` queries sent in pipeline mode
+  /// Will return results in the order the queries were sent or throw the
+  /// first error, results of the queries sent earlier are discarded
+  std::vector<ResultSet> WaitResults(Deadline deadline, std::size_t count,
+                                     tracing::ScopeTime&);
+
+  /// @brief Add a pipeline sync point without flushing the connection
+  /// The commands sent after it run in a separate implicit transaction and are
+  /// not aborted by the errors of the commands sent before it
+  void PushPipelineSync();
+
+  /// @brief Wait for results of the last `count` queries sent in pipeline mode
+  /// with a sync point after each of them
+  /// Will return a result or an error of every query in the order the queries
+  /// were sent, results of the queries sent earlier are discarded
+  std::vector<IsolatedResult> WaitIsolatedResults(Deadline deadline,
+                                                  std::size_t count,
+                                                  tracing::ScopeTime&);
+
+  /// @brief Wait for an asynchronous notification of LISTEN
+  /// Returns the notifications received with the results of the previous
+  /// commands first, std::nullopt on the deadline or the task cancellation
+  std::optional<Notification> WaitNotify(Deadline deadline);
+
+  /// Wrapper for PQescapeIdentifier
+  std::string EscapeIdentifier(std::string_view identifier);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline);
   /// Consume all input discarding all result sets
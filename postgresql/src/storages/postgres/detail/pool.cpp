@@ -35,6 +35,26 @@ constexpr std::chrono::seconds kMaintainInterval{30};
 constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
+constexpr std::chrono::seconds kSizingInterval{1};
+constexpr std::chrono::seconds kAcquireWaitPeriod{5};
+constexpr const char* kSizingTaskName = "pg_pool_sizing";
+
+// Server side load is sampled rarely to not load the server even more
+constexpr std::chrono::seconds kServerLoadInterval{10};
+constexpr const char* kServerLoadTaskName = "pg_server_load";
+constexpr CommandControl kServerLoadCommandControl{std::chrono::seconds{2},
+                                                   std::chrono::seconds{2}};
+// The sampling backend itself is active as well
+constexpr const char* kServerLoadQuery =
+    "SELECT count(*) FILTER (WHERE wait_event_type IN ('Lock', 'LWLock')), "
+    "count(*) - 1 FROM pg_stat_activity "
+    "WHERE state = 'active' AND backend_type = 'client backend'";
+// Too few active backends for the waiting percent to be meaningful
+constexpr std::int64_t kServerLoadMinActive = 10;
+
+// Smoothing factor of the query latency used for host selection
+constexpr double kQueryLatencyAlpha = 0.1;
+
 constexpr std::chrono::seconds kConnectingTimeout{2};
 constexpr auto kPendingConnectsMax{1};
 
@@ -76,7 +96,8 @@ ConnectionPool::ConnectionPool(
     const testsuite::PostgresControl& testsuite_pg_ctl,
     error_injection::Settings ei_settings,
     const congestion_control::v2::LinearController::StaticConfig& cc_config,
-    dynamic_config::Source config_source)
+    dynamic_config::Source config_source,
+    std::shared_ptr<StatementDescriptionCache> description_cache)
     : dsn_{std::move(dsn)},
       resolver_{resolver},
       db_name_{db_name},
@@ -95,6 +116,10 @@ ConnectionPool::ConnectionPool(
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio),
                     {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      description_cache_{description_cache
+                             ? std::move(description_cache)
+                             : std::make_shared<StatementDescriptionCache>(
+                                   conn_settings.max_prepared_cache_size)},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -102,13 +127,15 @@ ConnectionPool::ConnectionPool(
                      stats_.congestion_control, cc_config, config_source,
                      [](const dynamic_config::Snapshot& config) {
                        return config.Get<CcConfig>().config;
-                     }) {
+                     }),
+      shared_session_(*this, settings.max_queue_size) {
   if (kCcExperiment.IsEnabled()) {
     cc_controller_.Start();
   }
 }
 
 ConnectionPool::~ConnectionPool() {
+  shared_session_.SetSize(0);
   StopMaintainTask();
   StopConnectTasks();
   Clear();
@@ -124,14 +151,15 @@ std::shared_ptr<ConnectionPool> ConnectionPool::Create(
     const testsuite::PostgresControl& testsuite_pg_ctl,
     error_injection::Settings ei_settings,
     const congestion_control::v2::LinearController::StaticConfig& cc_config,
-    dynamic_config::Source config_source) {
+    dynamic_config::Source config_source,
+    std::shared_ptr<StatementDescriptionCache> description_cache) {
   // FP?: pointer magic in boost.lockfree
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
   auto impl = std::make_shared<ConnectionPool>(
       EmplaceEnabler{}, std::move(dsn), resolver, bg_task_processor, db_name,
       pool_settings, conn_settings, statement_metrics_settings,
       default_cmd_ctls, testsuite_pg_ctl, std::move(ei_settings), cc_config,
-      config_source);
+      config_source, std::move(description_cache));
   // Init() uses shared_from_this for connections and cannot be called from
   // ctor
   impl->Init(init_mode);
@@ -150,6 +178,9 @@ void ConnectionPool::Init(InitMode mode) {
         "PostgreSQL pool max size is less than requested initial size");
   }
 
+  shared_session_.SetSize(
+      std::min(settings->shared_session_size, settings->max_size));
+
   LOG_INFO() << (mode == InitMode::kAsync ? "Asynchronously" : "Synchronously")
              << " initializing PostgreSQL connection pool, creating up to "
              << settings->min_size << " connections to "
@@ -229,6 +260,22 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.execute_timeout += conn_stats.execute_timeout;
   stats_.transaction.duplicate_prepared_statements +=
       conn_stats.duplicate_prepared_statements;
+  stats_.transaction.batch_total += conn_stats.batch_total;
+
+  if (conn_stats.execute_total) {
+    const auto latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            conn_stats.sum_query_duration)
+            .count() /
+        conn_stats.execute_total;
+    // Concurrent updates may lose a sample, that is fine for an estimate
+    const auto prev = query_latency_us_.load(std::memory_order_relaxed);
+    const auto next =
+        prev ? static_cast<std::int64_t>(prev + kQueryLatencyAlpha *
+                                                    (latency - prev))
+             : static_cast<std::int64_t>(latency);
+    query_latency_us_.store(next, std::memory_order_relaxed);
+  }
 
   stats_.transaction.total_percentile.GetCurrentCounter().Account(
       std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -250,6 +297,10 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
       std::chrono::duration_cast<std::chrono::milliseconds>(
           now - conn_stats.trx_end_time)
           .count());
+  if (conn_stats.pipeline_depth_max) {
+    stats_.transaction.pipeline_depth_percentile.GetCurrentCounter().Account(
+        conn_stats.pipeline_depth_max);
+  }
 }
 
 void ConnectionPool::Release(Connection* connection) {
@@ -285,9 +336,38 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
   stats_.connection.waiting = wait_count_.load(std::memory_order_relaxed);
   stats_.connection.maximum = settings->max_size;
   stats_.connection.max_queue_size = settings->max_queue_size;
+  stats_.host_selection.query_latency =
+      query_latency_us_.load(std::memory_order_relaxed);
   return stats_;
 }
 
+std::chrono::microseconds ConnectionPool::GetQueryLatency() const {
+  return std::chrono::microseconds{
+      query_latency_us_.load(std::memory_order_relaxed)};
+}
+
+std::size_t ConnectionPool::GetInFlightCount() const {
+  return stats_.connection.used.Load() +
+         wait_count_.load(std::memory_order_relaxed);
+}
+
+void ConnectionPool::AccountCancelledByDeadline() {
+  ++stats_.deadline_cancelled;
+}
+
+void ConnectionPool::CheckDeadlineIsExpired(
+    const dynamic_config::Snapshot& config) {
+  if (IsDeadlineExpired(config)) {
+    AccountCancelledByDeadline();
+    throw ConnectionInterrupted("Cancelled by deadline");
+  }
+}
+
+void ConnectionPool::AccountHostSelection(bool is_nearest) {
+  ++stats_.host_selection.selected_total;
+  if (!is_nearest) ++stats_.host_selection.remote_selected_total;
+}
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl) {
   const auto trx_start_time = detail::SteadyClock::now();
@@ -307,6 +387,24 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
   return NonTransaction{std::move(conn), start_time};
 }
 
+ResultSet ConnectionPool::Execute(const Query& query, ParameterStore&& params,
+                                  OptionalCommandControl cmd_ctl) {
+  if (!shared_session_.IsEnabled()) {
+    return Start(cmd_ctl).Execute(cmd_ctl, query.Statement(), params);
+  }
+
+  CheckDeadlineIsExpired(GetConfigSource().GetSnapshot());
+  const auto statement_cmd_ctl = cmd_ctl.value_or(GetDefaultCommandControl());
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(statement_cmd_ctl.execute);
+  return shared_session_.Execute(query, std::move(params), statement_cmd_ctl,
+                                 deadline);
+}
+
+bool ConnectionPool::IsSharedSessionEnabled() const {
+  return shared_session_.IsEnabled();
+}
+
 TimeoutDuration ConnectionPool::GetExecuteTimeout(
     OptionalCommandControl cmd_ctl) const {
   if (cmd_ctl) return cmd_ctl->execute;
@@ -334,10 +432,22 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
                                           ? settings.connecting_limit
                                           : kUnlimitedConnecting);
 
+  const bool is_shared_session_changed =
+      reader->shared_session_size != settings.shared_session_size ||
+      reader->max_size != max_connections;
+  if (reader->max_queue_size != settings.max_queue_size) {
+    shared_session_.SetMaxQueueSize(settings.max_queue_size);
+  }
+
   auto writer = settings_.StartWrite();
   *writer = settings;
   writer->max_size = max_connections;
   writer.Commit();
+
+  if (is_shared_session_changed) {
+    shared_session_.SetSize(
+        std::min(settings.shared_session_size, max_connections));
+  }
 }
 
 void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
@@ -349,6 +459,10 @@ void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
     if (old_settings.RequiresConnectionReset(settings)) {
       writer->version = old_version + 1;
     }
+    if (old_settings.max_prepared_cache_size !=
+        settings.max_prepared_cache_size) {
+      description_cache_->SetMaxSize(settings.max_prepared_cache_size);
+    }
     writer.Commit();
   }
 }
@@ -362,6 +476,12 @@ void ConnectionPool::SetMaxConnectionsCc(std::size_t max_connections) {
   cc_max_connections_ = max_connections;
 }
 
+std::optional<double> ConnectionPool::GetServerWaitPercent() const {
+  const auto percent = cc_server_wait_percent_.load();
+  if (percent < 0) return std::nullopt;
+  return percent;
+}
+
 dynamic_config::Source ConnectionPool::GetConfigSource() const {
   return config_source_;
 }
@@ -394,7 +514,7 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
     connection = Connection::Connect(
         dsn_, resolver_, bg_task_processor_, close_task_storage_, conn_id,
         *conn_settings, default_cmd_ctls_, testsuite_pg_ctl_, ei_settings_,
-        std::move(size_lock));
+        std::move(size_lock), description_cache_);
   } catch (const ConnectionTimeoutError&) {
     // No problem if it's connection error
     ++stats_.connection.error_timeout;
@@ -423,6 +543,21 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
   return true;
 }
 
+std::unique_ptr<Connection> ConnectionPool::ConnectDedicated() {
+  const uint32_t conn_id = ++stats_.connection.open_total;
+  auto conn_settings = conn_settings_.Read();
+  try {
+    return Connection::Connect(dsn_, resolver_, bg_task_processor_,
+                               close_task_storage_, conn_id, *conn_settings,
+                               default_cmd_ctls_, testsuite_pg_ctl_,
+                               ei_settings_);
+  } catch (const Error&) {
+    ++stats_.connection.error_total;
+    ++stats_.connection.drop_total;
+    throw;
+  }
+}
+
 void ConnectionPool::TryCreateConnectionAsync() {
   auto conn_settings = conn_settings_.Read();
   // Checking errors is more expensive than incrementing an atomic, so we
@@ -509,6 +644,7 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   // No connections found - create a new one if pool is not exhausted
   LOG_DEBUG() << "No idle connections, waiting for one for "
               << deadline.TimeLeft();
+  Stopwatch wait_st{stats_.acquire_wait_percentile};
 
   TryCreateConnectionAsync();
 
@@ -628,7 +764,9 @@ void ConnectionPool::MaintainConnections() {
         break;
       }
       stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-      if (count > settings->min_size && drop_left > 0) {
+      // Keep the connections opened ahead of the load by AdjustPoolSize()
+      const auto keep_size = std::max(settings->min_size, target_size_.load());
+      if (count > keep_size && drop_left > 0) {
         --drop_left;
         --stats_.connection.used;
         LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_)
@@ -656,14 +794,99 @@ void ConnectionPool::MaintainConnections() {
   CheckMinPoolSizeUnderflow();
 }
 
+void ConnectionPool::AdjustPoolSize() {
+  auto settings = settings_.Read();
+  if (settings->idle_buffer_size == 0) {
+    sizer_.Reset();
+    target_size_ = 0;
+    stats_.connection.target_size = 0;
+    return;
+  }
+
+  PoolSizer::Sample sample;
+  sample.used = stats_.connection.used.Load();
+  sample.waiting = wait_count_.load(std::memory_order_relaxed);
+  sample.had_acquire_waits =
+      stats_.acquire_wait_percentile.GetStatsForPeriod(kAcquireWaitPeriod, true)
+          .Count() > 0;
+  // max_size is already limited by the connlimit watchdog and the congestion
+  // control, see SetSettings()
+  const auto target = sizer_.Update(
+      sample,
+      {settings->min_size, settings->max_size, settings->idle_buffer_size});
+  target_size_ = target;
+  stats_.connection.target_size = target;
+
+  // Connecting connections are accounted by the size semaphore as well
+  const auto size = size_semaphore_.UsedApprox();
+  if (size >= target) return;
+
+  auto conn_settings = conn_settings_.Read();
+  if (recent_conn_errors_.GetStatsForPeriod(kRecentErrorPeriod, true) >=
+      conn_settings->recent_errors_threshold) {
+    LOG_DEBUG() << "Too many connection errors in recent period, "
+                   "not opening connections ahead of the load";
+    return;
+  }
+
+  auto to_open = target - size;
+  if (settings->connecting_limit) {
+    to_open = std::min(to_open, settings->connecting_limit);
+  }
+  LOG_DEBUG() << "Opening " << to_open << " connections ahead of the load to "
+              << DsnCutPassword(dsn_) << ", target pool size is " << target;
+  for (; to_open > 0; --to_open) {
+    engine::SemaphoreLock size_lock{size_semaphore_, std::try_to_lock};
+    if (!size_lock) break;
+    ++stats_.connection.warmup_total;
+    connect_task_storage_.Detach(Connect(std::move(size_lock)));
+  }
+}
+
+void ConnectionPool::SampleServerLoad() {
+  try {
+    // Waits in the queue like the queries do, so that the sample is taken
+    // under the load as well. Cannot use ConnectionPtr here, see
+    // MaintainConnections().
+    const auto releaser = [this](Connection* c) { Release(c); };
+    std::unique_ptr<Connection, decltype(releaser)> conn(
+        Pop(engine::Deadline::FromDuration(kServerLoadCommandControl.execute)),
+        releaser);
+    ++stats_.connection.used;
+
+    const auto [waiting, active] =
+        conn->Execute(kServerLoadQuery, {}, kServerLoadCommandControl)
+            .AsSingleRow<std::tuple<std::int64_t, std::int64_t>>(kRowTag);
+    const auto percent =
+        active < kServerLoadMinActive ? 0.0 : 100.0 * waiting / active;
+    LOG_DEBUG() << "Server `" << DsnCutPassword(dsn_) << "` has " << waiting
+                << " of " << active << " active backends waiting for locks";
+    cc_server_wait_percent_ = percent;
+  } catch (const Error& e) {
+    cc_server_wait_percent_ = -1.0;
+    LOG_LIMITED_WARNING() << "Failed to sample the load of `"
+                          << DsnCutPassword(dsn_) << "`: " << e;
+  }
+}
+
 void ConnectionPool::StartMaintainTask() {
   using Flags = USERVER_NAMESPACE::utils::PeriodicTask::Flags;
 
   ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong},
                    [this] { MaintainConnections(); });
+  sizing_task_.Start(kSizingTaskName, {kSizingInterval, Flags::kStrong},
+                     [this] { AdjustPoolSize(); });
+  if (kCcExperiment.IsEnabled()) {
+    server_load_task_.Start(kServerLoadTaskName, {kServerLoadInterval},
+                            [this] { SampleServerLoad(); });
+  }
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+  server_load_task_.Stop();
+  sizing_task_.Stop();
+  ping_task_.Stop();
+}
 
 void ConnectionPool::StopConnectTasks() {
   const auto task_count = connect_task_storage_.ActiveTasksApprox();
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <boost/lockfree/queue.hpp>
@@ -32,6 +35,9 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/pool_sizer.hpp>
+#include <storages/postgres/detail/shared_session.hpp>
+#include <storages/postgres/detail/statement_description_cache.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -51,7 +57,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
       const testsuite::PostgresControl& testsuite_pg_ctl,
       error_injection::Settings ei_settings,
       const congestion_control::v2::LinearController::StaticConfig& cc_config,
-      dynamic_config::Source config_source);
+      dynamic_config::Source config_source,
+      std::shared_ptr<StatementDescriptionCache> description_cache);
 
   ~ConnectionPool();
 
@@ -65,17 +72,29 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
       const testsuite::PostgresControl& testsuite_pg_ctl,
       error_injection::Settings ei_settings,
       const congestion_control::v2::LinearController::StaticConfig& cc_config,
-      dynamic_config::Source config_source);
+      dynamic_config::Source config_source,
+      std::shared_ptr<StatementDescriptionCache> description_cache = {});
 
   [[nodiscard]] ConnectionPtr Acquire(engine::Deadline);
   void Release(Connection* connection);
 
+  /// Connects to the host of the pool with a connection that is not counted
+  /// in the pool size and must be closed by the caller, e.g. for LISTEN
+  std::unique_ptr<Connection> ConnectDedicated();
+
   const InstanceStatistics& GetStatistics() const;
   [[nodiscard]] Transaction Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl = {});
 
   [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+  /// Executes a single statement in the shared session if it is enabled,
+  /// otherwise on a connection acquired for the statement
+  ResultSet Execute(const Query& query, ParameterStore&& params,
+                    OptionalCommandControl cmd_ctl);
+
+  bool IsSharedSessionEnabled() const;
+
   CommandControl GetDefaultCommandControl() const;
 
   void SetSettings(const PoolSettings& settings);
@@ -88,8 +107,25 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
     return sts_;
   }
 
+  /// Smoothed latency of a query, zero if there were no queries yet
+  std::chrono::microseconds GetQueryLatency() const;
+
+  /// Connections in use plus requests waiting for a connection
+  std::size_t GetInFlightCount() const;
+
+  /// Accounts that the host was chosen by the adaptive selection strategy
+  void AccountHostSelection(bool is_nearest);
+
+  /// Accounts an operation that was not started as the inherited deadline
+  /// has expired
+  void AccountCancelledByDeadline();
+
   void SetMaxConnectionsCc(std::size_t max_connections);
 
+  /// Percent of the active client backends of the server that wait for locks,
+  /// sampled from pg_stat_activity; std::nullopt if unknown
+  std::optional<double> GetServerWaitPercent() const;
+
   dynamic_config::Source GetConfigSource() const;
 
  private:
@@ -99,6 +135,9 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   TimeoutDuration GetExecuteTimeout(OptionalCommandControl) const;
 
+  /// @throws ConnectionInterrupted if deadline is expired.
+  void CheckDeadlineIsExpired(const dynamic_config::Snapshot& config);
+
   [[nodiscard]] engine::TaskWithResult<bool> Connect(engine::SemaphoreLock);
   bool DoConnect(engine::SemaphoreLock);
 
@@ -119,6 +158,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   Connection* AcquireImmediate();
   void MaintainConnections();
+  void AdjustPoolSize();
+  void SampleServerLoad();
   void StartMaintainTask();
   void StopMaintainTask();
   void StopConnectTasks();
@@ -136,18 +177,24 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   concurrent::BackgroundTaskStorageCore connect_task_storage_;
   concurrent::BackgroundTaskStorageCore close_task_storage_;
   USERVER_NAMESPACE::utils::PeriodicTask ping_task_;
+  USERVER_NAMESPACE::utils::PeriodicTask sizing_task_;
+  USERVER_NAMESPACE::utils::PeriodicTask server_load_task_;
+  PoolSizer sizer_;
+  std::atomic<std::size_t> target_size_{0};
   engine::Mutex wait_mutex_;
   engine::ConditionVariable conn_available_;
   boost::lockfree::queue<Connection*> queue_;
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
+  std::atomic<std::int64_t> query_latency_us_{0};
   DefaultCommandControls default_cmd_ctls_;
   testsuite::PostgresControl testsuite_pg_ctl_;
   const error_injection::Settings ei_settings_;
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementTimingsStorage sts_;
+  std::shared_ptr<StatementDescriptionCache> description_cache_;
   dynamic_config::Source config_source_;
 
   // Congestion control stuff
@@ -155,6 +202,10 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   cc::Limiter cc_limiter_;
   congestion_control::v2::LinearController cc_controller_;
   std::atomic<std::size_t> cc_max_connections_;
+  // Negative if unknown
+  std::atomic<double> cc_server_wait_percent_{-1.0};
+
+  SharedSession shared_session_;
 };
 
 }  // namespace storages::postgres::detail
@@ -0,0 +1,44 @@
+#include <storages/postgres/detail/pool_sizer.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Smoothing factor of the demand growth trend
+constexpr double kTrendAlpha = 0.5;
+
+}  // namespace
+
+std::size_t PoolSizer::Update(const Sample& sample, const Limits& limits) {
+  const auto demand = sample.used + sample.waiting;
+
+  demand_window_[window_pos_] = demand;
+  window_pos_ = (window_pos_ + 1) % kWindowSize;
+  const auto peak =
+      *std::max_element(demand_window_.begin(), demand_window_.end());
+
+  const auto delta =
+      static_cast<double>(demand) - static_cast<double>(prev_demand_);
+  trend_ = kTrendAlpha * delta + (1 - kTrendAlpha) * trend_;
+  prev_demand_ = demand;
+
+  const auto growth = static_cast<std::size_t>(
+      std::ceil(std::max(trend_, 0.0) * kLookaheadSteps));
+  const auto buffer =
+      sample.had_acquire_waits ? limits.idle_buffer * 2 : limits.idle_buffer;
+
+  const auto target = peak + growth + buffer;
+  return std::clamp(target, limits.min_size,
+                    std::max(limits.min_size, limits.max_size));
+}
+
+void PoolSizer::Reset() { *this = PoolSizer{}; }
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Predicts the number of connections a pool is going to need in the near
+/// future, so the connections could be established before the load reaches
+/// the pool rather than while requests are waiting for them.
+///
+/// The prediction is the peak demand over a recent window plus the growth
+/// trend extrapolated a few steps ahead, plus an idle buffer. The buffer is
+/// doubled while the requests have to wait for connections.
+///
+/// Not thread-safe, is expected to be updated from a single periodic task.
+class PoolSizer final {
+ public:
+  struct Sample {
+    /// Connections in use
+    std::size_t used{0};
+    /// Requests waiting for a connection
+    std::size_t waiting{0};
+    /// Whether the requests had to wait for a connection recently
+    bool had_acquire_waits{false};
+  };
+
+  struct Limits {
+    std::size_t min_size{0};
+    std::size_t max_size{0};
+    std::size_t idle_buffer{0};
+  };
+
+  /// Accounts a new sample and returns the target pool size
+  std::size_t Update(const Sample& sample, const Limits& limits);
+
+  /// Forgets the accumulated history
+  void Reset();
+
+  static constexpr std::size_t kWindowSize = 10;
+  static constexpr std::size_t kLookaheadSteps = 3;
+
+ private:
+  std::array<std::size_t, kWindowSize> demand_window_{};
+  std::size_t window_pos_{0};
+  std::size_t prev_demand_{0};
+  double trend_{0.0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,11 @@
 #include <storages/postgres/detail/result_wrapper.hpp>
 
+#include <pg_config.h>
+
+#include <iterator>
+#include <string_view>
+#include <vector>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 #include <boost/container/small_vector.hpp>
@@ -7,6 +13,7 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
+#include <userver/utils/algo.hpp>
 
 #include <storages/postgres/detail/pg_message_severity.hpp>
 #include <userver/storages/postgres/io/traits.hpp>
@@ -34,20 +41,39 @@ constexpr std::pair<const char*, int> kExtraErrorFields[]{
     {"pg_datatype", PG_DIAG_DATATYPE_NAME},
     {"pg_constraint", PG_DIAG_CONSTRAINT_NAME}};
 
-struct CurrentContext {
-  CurrentContext(std::vector<std::string>& context, std::string&& ctx)
-      : context_{context} {
-    context_.emplace_back(std::move(ctx));
+// Where a type is met in the result set, formatted only for the error message
+struct TypeContext final {
+  const TypeContext* parent{nullptr};
+  std::string_view kind;
+  std::string_view schema{};
+  std::string_view name{};
+};
+
+std::string FormatContext(const TypeContext& context) {
+  std::vector<const TypeContext*> chain;
+  for (const auto* ctx = &context; ctx; ctx = ctx->parent) {
+    chain.push_back(ctx);
   }
-  ~CurrentContext() { context_.pop_back(); }
 
- private:
-  std::vector<std::string>& context_;
-};
+  fmt::memory_buffer result;
+  for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+    const auto& ctx = **it;
+    if (result.size() != 0) result.push_back(' ');
+    fmt::format_to(std::back_inserter(result), FMT_COMPILE("{}"), ctx.kind);
+    if (!ctx.schema.empty()) {
+      fmt::format_to(std::back_inserter(result), FMT_COMPILE(" `{}.{}`"),
+                     ctx.schema, ctx.name);
+    } else if (!ctx.name.empty()) {
+      fmt::format_to(std::back_inserter(result), FMT_COMPILE(" `{}`"),
+                     ctx.name);
+    }
+  }
+  return fmt::to_string(result);
+}
 
 void AddTypeBufferCategories(Oid data_type, const UserTypes& types,
                              io::TypeBufferCategory& cats,
-                             std::vector<std::string>& context) {
+                             const TypeContext& context) {
   if (cats.count(data_type)) {
     return;
   }
@@ -55,16 +81,15 @@ void AddTypeBufferCategories(Oid data_type, const UserTypes& types,
   if (cat == io::BufferCategory::kNoParser) {
     cat = types.GetBufferCategory(data_type);
     if (cat == io::BufferCategory::kNoParser) {
-      throw UnknownBufferCategory(fmt::to_string(fmt::join(context, " ")),
-                                  data_type);
+      throw UnknownBufferCategory(FormatContext(context), data_type);
     }
   }
   cats.insert(std::make_pair(data_type, cat));
   if (cat == io::BufferCategory::kArrayBuffer) {
     // Recursively add buffer category for array element
     auto elem_oid = types.FindElementOid(data_type);
-    CurrentContext ctx{context, "array element"};
-    AddTypeBufferCategories(elem_oid, types, cats, context);
+    const TypeContext elem_context{&context, "array element"};
+    AddTypeBufferCategories(elem_oid, types, cats, elem_context);
   } else if (cat == io::BufferCategory::kCompositeBuffer) {
     if (data_type == static_cast<Oid>(io::PredefinedOids::kRecord)) {
       // record is opaque and doesn't have a description
@@ -76,51 +101,69 @@ void AddTypeBufferCategories(Oid data_type, const UserTypes& types,
 
     // Recursively add buffer categories for data members
     const auto& type_desc = types.GetCompositeDescription(data_type);
-    auto type_name = types.FindName(data_type);
-    CurrentContext ctx{
-        context, fmt::format(FMT_COMPILE("type `{}`"), type_name.ToString())};
+    const auto type_name = types.FindName(data_type);
+    const TypeContext type_context{&context, "type", type_name.schema,
+                                   type_name.name};
     auto n_fields = type_desc.Size();
     for (std::size_t f_no = 0; f_no < n_fields; ++f_no) {
-      CurrentContext ctx{context, fmt::format(FMT_COMPILE("field `{}`"),
-                                              type_desc[f_no].name)};
-      AddTypeBufferCategories(type_desc[f_no].type, types, cats, context);
+      const TypeContext field_context{&type_context, "field", {},
+                                      type_desc[f_no].name};
+      AddTypeBufferCategories(type_desc[f_no].type, types, cats,
+                              field_context);
     }
   }
 }
 
 }  // namespace
 
-struct ResultWrapper::CachedFieldBufferCategories final {
-  boost::container::small_vector<io::BufferCategory, 16> data;
+struct ResultWrapper::BufferCategories final {
+  // All the types met in the result set, including the nested ones
+  io::TypeBufferCategory types;
+  // Categories of the columns, read for each field without lookups
+  boost::container::small_vector<io::BufferCategory, 16> columns;
 };
 
 ResultWrapper::ResultWrapper(ResultHandle&& res) : handle_{std::move(res)} {
   UASSERT(handle_);
+#if PG_VERSION_NUM >= 120000
+  // The result is already received, so the limits are not checked here, the
+  // next charges of the account fail instead
+  memory_charge_ = USERVER_NAMESPACE::utils::ForceChargeCurrentMemoryAccount(
+      PQresultMemorySize(handle_.get()));
+#endif
 }
 
 ResultWrapper::~ResultWrapper() = default;
 
 void ResultWrapper::FillBufferCategories(const UserTypes& types) {
-  buffer_categories_.clear();
+  auto categories = std::make_shared<BufferCategories>();
   auto n_fields = FieldCount();
   for (std::size_t f_no = 0; f_no < n_fields; ++f_no) {
     auto data_type = GetFieldTypeOid(f_no);
-
-    std::vector<std::string> context{
-        fmt::format("result set field `{}`", GetFieldName(f_no))};
-
-    AddTypeBufferCategories(data_type, types, buffer_categories_, context);
+    const TypeContext context{nullptr, "result set field", {},
+                              GetFieldName(f_no)};
+    AddTypeBufferCategories(data_type, types, categories->types, context);
   }
 
-  cached_buffer_categories_->data.resize(n_fields);
+  categories->columns.resize(n_fields);
   for (std::size_t f_no = 0; f_no < n_fields; ++f_no) {
-    const auto data_type = GetFieldTypeOid(f_no);
-    const auto f = buffer_categories_.find(data_type);
-
-    cached_buffer_categories_->data[f_no] =
-        (f == buffer_categories_.end() ? io::BufferCategory::kNoParser
-                                       : f->second);
+    categories->columns[f_no] =
+        USERVER_NAMESPACE::utils::FindOrDefault(categories->types,
+                                                GetFieldTypeOid(f_no),
+                                                io::BufferCategory::kNoParser);
   }
+  buffer_categories_ = std::move(categories);
+}
+
+const io::TypeBufferCategory& ResultWrapper::GetTypeBufferCategories() const {
+  static const io::TypeBufferCategory kEmpty;
+  return buffer_categories_ ? buffer_categories_->types : kEmpty;
+}
+
+void ResultWrapper::SetBufferCategoriesFrom(const ResultWrapper& description) {
+  UASSERT(!description.buffer_categories_ ||
+          description.buffer_categories_->columns.size() == FieldCount());
+  buffer_categories_ = description.buffer_categories_;
 }
 
 ExecStatusType ResultWrapper::GetStatus() const {
@@ -190,7 +233,8 @@ Oid ResultWrapper::GetFieldTypeOid(std::size_t col) const {
 
 io::BufferCategory ResultWrapper::GetFieldBufferCategory(
     std::size_t col) const {
-  return cached_buffer_categories_->data[col];
+  return buffer_categories_ ? buffer_categories_->columns[col]
+                            : io::BufferCategory::kNoParser;
 }
 
 std::size_t ResultWrapper::GetFieldLength(std::size_t row,
@@ -10,7 +10,7 @@
 #include <userver/storages/postgres/message.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 #include <userver/storages/postgres/sql_state.hpp>
-#include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/memory_account.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -32,12 +32,9 @@ class ResultWrapper {
   /** @name Data result */
   std::size_t RowCount() const;
   std::size_t FieldCount() const;
-  const io::TypeBufferCategory& GetTypeBufferCategories() const {
-    return buffer_categories_;
-  }
-  void SetTypeBufferCategories(const io::TypeBufferCategory& cats) {
-    buffer_categories_ = cats;
-  }
+  const io::TypeBufferCategory& GetTypeBufferCategories() const;
+  /// Shares the buffer categories resolved for the statement description
+  void SetBufferCategoriesFrom(const ResultWrapper& description);
   std::string CommandStatus() const;
   std::size_t RowsAffected() const;
 
@@ -75,11 +72,13 @@ class ResultWrapper {
   //@}
 
   ResultHandle handle_;
-  io::TypeBufferCategory buffer_categories_;
+  // Holds the result size in the memory account of the task that got it
+  USERVER_NAMESPACE::utils::MemoryCharge memory_charge_;
 
-  struct CachedFieldBufferCategories;
-  USERVER_NAMESPACE::utils::FastPimpl<CachedFieldBufferCategories, 88, 8>
-      cached_buffer_categories_;
+  // Resolved once per result set or prepared statement and immutable after
+  // that, so that the rows are decoded without type lookups
+  struct BufferCategories;
+  std::shared_ptr<const BufferCategories> buffer_categories_;
 };
 
 inline ResultWrapper::ResultHandle MakeResultHandle(PGresult* pg_res) {
@@ -0,0 +1,152 @@
+#include <storages/postgres/detail/shared_session.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/future_status.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <storages/postgres/detail/pool.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Larger batches delay the first statements of the batch too much
+constexpr std::size_t kMaxBatchSize = 64;
+
+}  // namespace
+
+SharedSession::SharedSession(ConnectionPool& pool, std::size_t max_queue_size)
+    : pool_(pool),
+      queue_(Queue::Create(max_queue_size)),
+      producer_(queue_->GetMultiProducer()) {}
+
+SharedSession::~SharedSession() { SetSize(0); }
+
+void SharedSession::SetSize(std::size_t size) {
+  std::lock_guard lock{workers_mutex_};
+  if (size == workers_.size()) return;
+
+  size_ = size;
+  while (workers_.size() < size) {
+    workers_.push_back(engine::CriticalAsyncNoSpan(
+        [this, consumer = queue_->GetMultiConsumer()]() mutable {
+          RunWorker(std::move(consumer));
+        }));
+  }
+  while (workers_.size() > size) {
+    workers_.back().SyncCancel();
+    workers_.pop_back();
+  }
+  if (size == 0) FailQueued();
+}
+
+void SharedSession::SetMaxQueueSize(std::size_t max_queue_size) {
+  queue_->SetSoftMaxSize(max_queue_size);
+}
+
+bool SharedSession::IsEnabled() const { return size_ > 0; }
+
+ResultSet SharedSession::Execute(const Query& query, ParameterStore&& params,
+                                 const CommandControl& cmd_ctl,
+                                 engine::Deadline deadline) {
+  auto request = std::make_unique<Request>(
+      Request{query, std::move(params), cmd_ctl, deadline, {}});
+  auto future = request->promise.get_future();
+  if (!producer_.PushNoblock(std::move(request))) {
+    throw PoolError("Shared session queue size exceeded");
+  }
+
+  switch (future.wait_until(deadline)) {
+    case engine::FutureStatus::kReady:
+      return future.get();
+    case engine::FutureStatus::kTimeout:
+      throw ConnectionTimeoutError(
+          "Timed out while waiting for a statement in the shared session");
+    case engine::FutureStatus::kCancelled:
+      throw ConnectionInterrupted(
+          "Task cancelled while waiting for a statement in the shared session");
+  }
+  UINVARIANT(false, "Unexpected future status");
+}
+
+void SharedSession::RunWorker(Queue::MultiConsumer consumer) {
+  std::vector<RequestPtr> batch;
+  RequestPtr request;
+  while (consumer.Pop(request)) {
+    batch.push_back(std::move(request));
+    while (batch.size() < kMaxBatchSize && consumer.PopNoblock(request)) {
+      batch.push_back(std::move(request));
+    }
+    RunBatch(batch);
+    batch.clear();
+  }
+}
+
+void SharedSession::RunBatch(std::vector<RequestPtr>& batch) {
+  QueryBatch query_batch;
+  std::vector<Request*> sent;
+  sent.reserve(batch.size());
+  // The batch waits for its slowest statement, so it gets the largest of the
+  // timeouts of the statements
+  CommandControl batch_cmd_ctl{TimeoutDuration::zero(),
+                               TimeoutDuration::zero()};
+  for (auto& request : batch) {
+    if (request->deadline.IsReached()) {
+      // nobody waits for the result anymore
+      request->promise.set_exception(std::make_exception_ptr(
+          ConnectionTimeoutError{"Deadline reached before the statement was "
+                                 "sent in the shared session"}));
+      continue;
+    }
+    batch_cmd_ctl.execute = std::max(
+        batch_cmd_ctl.execute, std::chrono::duration_cast<TimeoutDuration>(
+                                   request->deadline.TimeLeft()));
+    batch_cmd_ctl.statement =
+        std::max(batch_cmd_ctl.statement, request->cmd_ctl.statement);
+    query_batch.Add(std::move(request->query), std::move(request->params));
+    sent.push_back(request.get());
+  }
+  if (sent.empty()) return;
+
+  try {
+    auto connection = pool_.Acquire(
+        engine::Deadline::FromDuration(batch_cmd_ctl.execute));
+    auto results = connection->ExecuteIsolatedBatch(query_batch, batch_cmd_ctl);
+    UASSERT(results.size() == sent.size());
+    for (std::size_t i = 0; i < sent.size(); ++i) {
+      if (results[i].error) {
+        sent[i]->promise.set_exception(results[i].error);
+      } else {
+        sent[i]->promise.set_value(std::move(results[i].result));
+      }
+    }
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_WARNING() << "Failed to execute a batch of " << sent.size()
+                          << " statements in the shared session: " << ex;
+    for (auto* request : sent) {
+      request->promise.set_exception(std::current_exception());
+    }
+  }
+}
+
+void SharedSession::FailQueued() noexcept {
+  auto consumer = queue_->GetMultiConsumer();
+  RequestPtr request;
+  while (consumer.PopNoblock(request)) {
+    request->promise.set_exception(
+        std::make_exception_ptr(PoolError{"Shared session is disabled"}));
+  }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
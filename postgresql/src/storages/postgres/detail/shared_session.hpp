@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class ConnectionPool;
+
+// Multiplexes the single statements of many coroutines over a few connections
+// of the pool. Each worker takes the statements queued so far and sends them
+// at once in pipeline mode on a connection acquired for the batch. A pipeline
+// sync point follows every statement, so the statements keep their own
+// implicit transactions and errors, as if they were executed one by one.
+class SharedSession final {
+ public:
+  SharedSession(ConnectionPool& pool, std::size_t max_queue_size);
+  ~SharedSession();
+
+  // Sets the number of the workers and thus the number of the connections
+  // used at once, 0 disables the shared session
+  void SetSize(std::size_t size);
+
+  void SetMaxQueueSize(std::size_t max_queue_size);
+
+  bool IsEnabled() const;
+
+  // Waits for the result of the statement, the statement is not sent if the
+  // deadline is reached while it is queued
+  ResultSet Execute(const Query& query, ParameterStore&& params,
+                    const CommandControl& cmd_ctl, engine::Deadline deadline);
+
+ private:
+  struct Request {
+    Query query;
+    ParameterStore params;
+    CommandControl cmd_ctl;
+    engine::Deadline deadline;
+    engine::Promise<ResultSet> promise;
+  };
+  using RequestPtr = std::unique_ptr<Request>;
+  using Queue = concurrent::NonFifoMpmcQueue<RequestPtr>;
+
+  void RunWorker(Queue::MultiConsumer consumer);
+  void RunBatch(std::vector<RequestPtr>& batch);
+  void FailQueued() noexcept;
+
+  ConnectionPool& pool_;
+  std::shared_ptr<Queue> queue_;
+  Queue::MultiProducer producer_;
+
+  engine::Mutex workers_mutex_;
+  std::vector<engine::TaskWithResult<void>> workers_;
+  std::atomic<std::size_t> size_{0};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
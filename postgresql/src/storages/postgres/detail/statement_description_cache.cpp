@@ -0,0 +1,43 @@
+#include <storages/postgres/detail/statement_description_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+StatementDescriptionCache::StatementDescriptionCache(std::size_t max_size)
+    : storage_{max_size} {}
+
+std::optional<ResultSet> StatementDescriptionCache::Get(
+    std::size_t query_hash, const std::string& statement) {
+  auto storage = storage_.Lock();
+  const auto* entry = storage->Get(query_hash);
+  // Hashes of different statements might collide
+  if (!entry || entry->statement != statement) return std::nullopt;
+  return entry->description;
+}
+
+void StatementDescriptionCache::Put(std::size_t query_hash,
+                                    const std::string& statement,
+                                    const ResultSet& description) {
+  auto storage = storage_.Lock();
+  storage->Put(query_hash, {statement, description});
+}
+
+void StatementDescriptionCache::SetMaxSize(std::size_t max_size) {
+  auto storage = storage_.Lock();
+  storage->SetMaxSize(max_size);
+}
+
+void StatementDescriptionCache::Clear() {
+  auto storage = storage_.Lock();
+  storage->Clear();
+}
+
+std::size_t StatementDescriptionCache::GetSize() const {
+  auto storage = storage_.Lock();
+  return storage->GetSize();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
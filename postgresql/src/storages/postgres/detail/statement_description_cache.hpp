@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Descriptions of prepared statements shared by the connections of a
+/// cluster. A connection that prepares a statement described by another
+/// connection skips the Describe roundtrip and takes the field descriptions
+/// and buffer categories from the cache.
+///
+/// Replicas of a cluster share the system catalogs, so the type oids of a
+/// description are valid for every host. A connection still checks that it
+/// knows all the types of a cached description before using it.
+class StatementDescriptionCache final {
+ public:
+  explicit StatementDescriptionCache(std::size_t max_size);
+
+  /// Returns the description of the statement with the given query hash
+  std::optional<ResultSet> Get(std::size_t query_hash,
+                               const std::string& statement);
+
+  void Put(std::size_t query_hash, const std::string& statement,
+           const ResultSet& description);
+
+  void SetMaxSize(std::size_t max_size);
+
+  /// Drops all descriptions, e.g. after a schema change
+  void Clear();
+
+  std::size_t GetSize() const;
+
+ private:
+  struct Entry {
+    std::string statement;
+    ResultSet description;
+  };
+
+  using Storage = cache::LruMap<std::size_t, Entry>;
+
+  mutable concurrent::Variable<Storage, engine::Mutex> storage_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -27,6 +28,14 @@ class TopologyBase {
   using DsnIndicesByType =
       std::unordered_map<ClusterHostType, DsnIndices, ClusterHostTypeHash>;
 
+  /// Results of the last check of a host
+  struct HostMetrics {
+    /// Negative if unknown
+    std::chrono::microseconds roundtrip_time{-1};
+    std::chrono::milliseconds replication_lag{0};
+  };
+  using HostMetricsList = std::vector<HostMetrics>;
+
   TopologyBase(engine::TaskProcessor& bg_task_processor, DsnList dsns,
                clients::dns::Resolver* resolver,
                const TopologySettings& topology_settings,
@@ -47,6 +56,9 @@ class TopologyBase {
   /// Currently accessible hosts
   virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+  /// Last check results for each DSN in DsnList
+  virtual rcu::ReadablePtr<HostMetricsList> GetHostMetrics() const = 0;
+
   // Returns statistics for each DSN in DsnList
   virtual const std::vector<decltype(InstanceStatistics::topology)>&
   GetDsnStatistics() const = 0;
@@ -162,6 +162,11 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::HostMetricsList> HotStandby::GetHostMetrics()
+    const {
+  return host_metrics_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -177,12 +182,14 @@ void HotStandby::RunDiscovery() {
 
   // Report states and find the master
   HostState* master = nullptr;
+  HostMetricsList host_metrics(host_states_.size());
   std::chrono::system_clock::time_point max_slave_xact_timestamp;
   for (DsnIndex i = 0; i < host_states_.size(); ++i) {
     auto& state = host_states_[i];
     LOG_DEBUG() << state.app_name << " is " << state.role << ": rtt "
                 << state.roundtrip_time.count() << "us, LSN " << state.wal_lsn
                 << ", last xact time " << state.current_xact_timestamp;
+    host_metrics[i].roundtrip_time = state.roundtrip_time;
     if (state.roundtrip_time != kUnknownRtt) {
       dsn_stats_[i].roundtrip_time.GetCurrentCounter().Account(
           std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -225,6 +232,7 @@ void HotStandby::RunDiscovery() {
     dsn_stats_[i].replication_lag.GetCurrentCounter().Account(
         std::chrono::duration_cast<std::chrono::milliseconds>(slave_lag)
             .count());
+    host_metrics[i].replication_lag = slave_lag;
 
     if (slave_lag > GetTopologySettings().max_replication_lag) {
       // Demote lagged slave
@@ -280,6 +288,7 @@ void HotStandby::RunDiscovery() {
   }
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+  host_metrics_.Assign(std::move(host_metrics));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
@@ -6,6 +6,8 @@
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 
+#include <storages/postgres/detail/dist_lock_acquire_batcher.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
@@ -50,7 +52,8 @@ DistLockStrategy::DistLockStrategy(ClusterPtr cluster, const std::string& table,
                                    const dist_lock::DistLockSettings& settings)
     : cluster_(std::move(cluster)),
       cc_(settings.forced_stop_margin, settings.forced_stop_margin),
-      acquire_query_(MakeAcquireQuery(table)),
+      acquire_batcher_(detail::DistLockAcquireBatcher::Get(
+          cluster_, table, MakeAcquireQuery(table))),
       release_query_(MakeReleaseQuery(table)),
       lock_name_(lock_name),
       owner_prefix_(hostinfo::blocking::GetRealHostName()) {}
@@ -65,11 +68,12 @@ void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
                                const std::string& locker_id) {
   double timeout_seconds = lock_ttl.count() / 1000.0;
   auto cc_ptr = cc_.Read();
-  auto result = cluster_->Execute(
-      ClusterHostType::kMaster, *cc_ptr, acquire_query_, lock_name_,
-      MakeOwnerId(owner_prefix_, locker_id), timeout_seconds);
+  const bool is_acquired =
+      acquire_batcher_->Acquire(*cc_ptr, lock_name_,
+                                MakeOwnerId(owner_prefix_, locker_id),
+                                timeout_seconds);
 
-  if (result.IsEmpty()) throw dist_lock::LockIsAcquiredByAnotherHostException();
+  if (!is_acquired) throw dist_lock::LockIsAcquiredByAnotherHostException();
 }
 
 void DistLockStrategy::Release(const std::string& locker_id) {
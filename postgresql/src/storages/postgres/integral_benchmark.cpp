@@ -1,8 +1,10 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <vector>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/column_view.hpp>
 
 #include <storages/postgres/util_benchmark.hpp>
 
@@ -53,6 +55,34 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
   });
 }
 
+constexpr int kColumnRowsCount = 100'000;
+
+BENCHMARK_F(PgConnection, Int64ColumnRowByRow)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(
+        "select generate_series(1, $1)::bigint", kColumnRowsCount);
+    for (auto _ : state) {
+      std::vector<std::int64_t> values;
+      values.reserve(res.Size());
+      for (const auto& row : res) values.push_back(row.As<std::int64_t>());
+      benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+BENCHMARK_F(PgConnection, Int64ColumnView)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(
+        "select generate_series(1, $1)::bigint", kColumnRowsCount);
+    for (auto _ : state) {
+      auto values = pg::ColumnView{res, 0}.AsVector<std::int64_t>();
+      benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -23,19 +23,21 @@ const bool kReference = detail::ForceReference(
 
 namespace detail {
 
-void JsonParser::operator()(const FieldBuffer& buffer) {
+std::string_view GetJsonText(const FieldBuffer& buffer) {
   if (buffer.length == 0) {
     throw InvalidInputBufferSize{0, "for a json type"};
   }
   const char* start = reinterpret_cast<const char*>(buffer.buffer);
   auto length = buffer.length;
-  if (*start == 1) {  // this is jsonb
+  if (*start == kJsonbVersion) {  // this is jsonb
     ++start;
     --length;
   }
+  return {start, length};
+}
 
-  std::string_view json_string(start, length);
-  value = formats::json::FromString(json_string);
+void JsonParser::operator()(const FieldBuffer& buffer) {
+  value = formats::json::FromString(GetJsonText(buffer));
 }
 
 void JsonValueToBuffer(const formats::json::Value& value,
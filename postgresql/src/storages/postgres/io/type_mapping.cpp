@@ -121,11 +121,13 @@ const std::string& ToString(BufferCategory val) {
 
 BufferCategory GetTypeBufferCategory(const TypeBufferCategory& categories,
                                      Oid type_oid) {
-  auto cat = io::GetBufferCategory(static_cast<io::PredefinedOids>(type_oid));
-  return cat != BufferCategory::kNoParser
-             ? cat
-             : USERVER_NAMESPACE::utils::FindOrDefault(
-                   categories, type_oid, BufferCategory::kNoParser);
+  // The categories of a result set already contain all of its types, so the
+  // nested fields are resolved with a single lookup
+  if (const auto* cat = USERVER_NAMESPACE::utils::FindOrNullptr(categories,
+                                                                type_oid)) {
+    return *cat;
+  }
+  return io::GetBufferCategory(static_cast<io::PredefinedOids>(type_oid));
 }
 
 namespace detail {
@@ -0,0 +1,35 @@
+#include <userver/storages/postgres/notify.hpp>
+
+#include <storages/postgres/detail/notify_listener.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+NotifyScope::NotifyScope(std::shared_ptr<detail::NotifyListener> listener,
+                         std::string channel, std::uint64_t id,
+                         Queue::Consumer consumer)
+    : listener_(std::move(listener)),
+      channel_(std::move(channel)),
+      id_(id),
+      consumer_(std::move(consumer)) {}
+
+NotifyScope::NotifyScope(NotifyScope&& other) noexcept
+    : listener_(std::move(other.listener_)),
+      channel_(std::move(other.channel_)),
+      id_(other.id_),
+      consumer_(std::move(other.consumer_)) {}
+
+NotifyScope::~NotifyScope() {
+  if (listener_) listener_->Unlisten(channel_, id_);
+}
+
+std::optional<Notification> NotifyScope::WaitNotify(engine::Deadline deadline) {
+  Notification notification;
+  if (!consumer_.Pop(notification, deadline)) return std::nullopt;
+  return notification;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
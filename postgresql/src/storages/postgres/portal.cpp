@@ -1,6 +1,9 @@
 #include <userver/storages/postgres/portal.hpp>
 
+#include <fmt/format.h>
+
 #include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 
@@ -14,6 +17,10 @@ struct Portal::Impl {
   detail::Connection::StatementId statement_id_;
   PortalName name_;
   std::size_t fetched_so_far_{0};
+  std::size_t prefetch_window_{0};
+  // Executes sent ahead and the number of rows they requested
+  std::size_t pending_{0};
+  std::uint32_t pending_rows_{0};
   bool done_{false};
 
   Impl(detail::Connection* conn, const PortalName& name, const Query& query,
@@ -27,12 +34,32 @@ struct Portal::Impl {
     }
   }
 
-  Impl(Impl&& rhs) noexcept = default;
+  Impl(Impl&& rhs) noexcept
+      : conn_{rhs.conn_},
+        cmd_ctl_{std::move(rhs.cmd_ctl_)},
+        statement_id_{rhs.statement_id_},
+        name_{std::move(rhs.name_)},
+        fetched_so_far_{rhs.fetched_so_far_},
+        prefetch_window_{rhs.prefetch_window_},
+        pending_{std::exchange(rhs.pending_, 0)},
+        pending_rows_{rhs.pending_rows_},
+        done_{rhs.done_} {}
+
   Impl& operator=(Impl&& rhs) noexcept {
     Impl{std::move(rhs)}.Swap(*this);
     return *this;
   }
 
+  ~Impl() {
+    if (!pending_) return;
+    try {
+      DiscardPending();
+    } catch (const std::exception& e) {
+      LOG_LIMITED_WARNING() << "Failed to discard prefetched portal rows: "
+                            << e;
+    }
+  }
+
   void Swap(Impl& rhs) noexcept {
     using std::swap;
     swap(conn_, rhs.conn_);
@@ -40,6 +67,9 @@ struct Portal::Impl {
     swap(statement_id_, rhs.statement_id_);
     swap(name_, rhs.name_);
     swap(fetched_so_far_, rhs.fetched_so_far_);
+    swap(prefetch_window_, rhs.prefetch_window_);
+    swap(pending_, rhs.pending_);
+    swap(pending_rows_, rhs.pending_rows_);
     swap(done_, rhs.done_);
   }
 
@@ -52,12 +82,25 @@ struct Portal::Impl {
   ResultSet Fetch(std::uint32_t n_rows) {
     if (!done_) {
       UASSERT(conn_);
-      auto res = conn_->PortalExecute(statement_id_, name_.GetUnderlying(),
-                                      n_rows, cmd_ctl_);
+      if (pending_ && n_rows != pending_rows_) {
+        throw LogicError{fmt::format(
+            "Portal rows were prefetched in batches of {}, {} requested",
+            pending_rows_, n_rows)};
+      }
+      if (prefetch_window_ && n_rows && !pending_) SendExecute(n_rows);
+      auto res = pending_ ? WaitExecute()
+                          : conn_->PortalExecute(statement_id_,
+                                                 name_.GetUnderlying(), n_rows,
+                                                 cmd_ctl_);
       auto fetched = res.Size();
       // TODO: check command completion in result TAXICOMMON-4505
       if (!n_rows || fetched != n_rows) {
         done_ = true;
+        // Executes past the end of the portal return no rows
+        DiscardPending();
+      } else {
+        while (pending_ < prefetch_window_ && SendExecute(n_rows)) {
+        }
       }
       fetched_so_far_ += fetched;
       return res;
@@ -66,6 +109,28 @@ struct Portal::Impl {
       throw RuntimeError{"Portal is done, no more data to fetch"};
     }
   }
+
+  bool SendExecute(std::uint32_t n_rows) {
+    if (!conn_->SendPortalExecute(statement_id_, name_.GetUnderlying(), n_rows,
+                                  cmd_ctl_)) {
+      // Pipelining is not supported
+      prefetch_window_ = 0;
+      return false;
+    }
+    ++pending_;
+    pending_rows_ = n_rows;
+    return true;
+  }
+
+  ResultSet WaitExecute() {
+    UASSERT(pending_);
+    --pending_;
+    return conn_->WaitPortalExecute(statement_id_, cmd_ctl_);
+  }
+
+  void DiscardPending() {
+    while (pending_) WaitExecute();
+  }
 };
 
 Portal::Portal(detail::Connection* conn, const Query& query,
@@ -85,6 +150,10 @@ Portal& Portal::operator=(Portal&&) noexcept = default;
 
 ResultSet Portal::Fetch(std::uint32_t n_rows) { return pimpl_->Fetch(n_rows); }
 
+void Portal::SetPrefetch(std::size_t window) {
+  pimpl_->prefetch_window_ = window;
+}
+
 bool Portal::Done() const { return pimpl_->done_; }
 std::size_t Portal::FetchedSoFar() const { return pimpl_->fetched_so_far_; }
 
@@ -92,6 +92,11 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.idle_buffer_size =
+      config["idle_buffer_size"].template As<size_t>(result.idle_buffer_size);
+  result.shared_session_size =
+      config["shared_session_size"].template As<size_t>(
+          result.shared_session_size);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <tuple>
+
+#include <storages/postgres/detail/connection.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+constexpr int kRowsCount = 10'000;
+
+// Columns of different buffer categories, decoded row by row
+constexpr const char* kMixedColumnsQuery =
+    "select i::bigint, i::text, i::float8, (i, i::text)::record "
+    "from generate_series(1, $1) i";
+
+using MixedRow =
+    std::tuple<std::int64_t, std::string, double, std::tuple<int, std::string>>;
+
+BENCHMARK_F(PgConnection, MixedColumnsRowByRow)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(kMixedColumnsQuery, kRowsCount);
+    for (auto _ : state) {
+      for (const auto& row : res) {
+        auto values = row.As<MixedRow>(pg::kRowTag);
+        benchmark::DoNotOptimize(values);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+// Small result sets of a prepared statement reuse its buffer categories
+BENCHMARK_F(PgConnection, MixedColumnsPreparedRoundtrip)
+(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    for (auto _ : state) {
+      const auto res = GetConnection().Execute(kMixedColumnsQuery, 1);
+      auto values = res.Front().As<MixedRow>(pg::kRowTag);
+      benchmark::DoNotOptimize(values);
+    }
+  });
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
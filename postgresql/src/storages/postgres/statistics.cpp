@@ -14,6 +14,8 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     conn["max"] = stats.connection.maximum;
     conn["waiting"] = stats.connection.waiting;
     conn["max-queue-size"] = stats.connection.max_queue_size;
+    conn["warmed-up"] = stats.connection.warmup_total;
+    conn["target"] = stats.connection.target_size;
   }
   if (auto trx = writer["transactions"]) {
     trx["total"] = stats.transaction.total;
@@ -29,12 +31,15 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     timing["return-to-pool"] = stats.transaction.return_to_pool_percentile;
     timing["connect"] = stats.connection_percentile;
     timing["acquire-connection"] = stats.acquire_percentile;
+    timing["acquire-wait"] = stats.acquire_wait_percentile;
   }
   if (auto query = writer["queries"]) {
     query["parsed"] = stats.transaction.parse_total;
     query["portals-bound"] = stats.transaction.portal_bind_total;
     query["executed"] = stats.transaction.execute_total;
     query["replies"] = stats.transaction.reply_total;
+    query["batches"] = stats.transaction.batch_total;
+    query["pipeline-depth"] = stats.transaction.pipeline_depth_percentile;
   }
 
   if (auto errors = writer["errors"]) {
@@ -51,12 +56,19 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                            {kPostgresqlError, "pool"});
     errors.ValueWithLabels(stats.queue_size_errors,
                            {kPostgresqlError, "queue"});
+    errors.ValueWithLabels(stats.deadline_cancelled,
+                           {kPostgresqlError, "cancelled-by-deadline"});
     errors.ValueWithLabels(stats.connection.error_timeout,
                            {kPostgresqlError, "connection-timeout"});
   }
   writer["prepared-per-connection"] = stats.connection.prepared_statements;
   writer["roundtrip-time"] = stats.topology.roundtrip_time;
   writer["replication-lag"] = stats.topology.replication_lag;
+  if (auto selection = writer["host-selection"]) {
+    selection["selected"] = stats.host_selection.selected_total;
+    selection["remote"] = stats.host_selection.remote_selected_total;
+    selection["query-latency-us"] = stats.host_selection.query_latency;
+  }
   if (!stats.statement_timings.empty()) {
     auto timings = writer["statement_timings"];
     for (const auto& [name, percentile] : stats.statement_timings) {
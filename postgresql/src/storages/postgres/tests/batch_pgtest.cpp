@@ -0,0 +1,113 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <libpq-fe.h>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+pg::QueryBatch MakeSelectBatch(int size) {
+  pg::QueryBatch batch;
+  for (int i = 0; i < size; ++i) {
+    pg::ParameterStore params;
+    params.PushBack(i);
+    batch.Add("SELECT $1::integer", std::move(params));
+  }
+  return batch;
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, BatchResultsOrder) {
+  CheckConnection(GetConn());
+  const auto batch = MakeSelectBatch(5);
+
+  std::vector<pg::ResultSet> results;
+  UEXPECT_NO_THROW(results = GetConn()->ExecuteBatch(batch, {}));
+  ASSERT_EQ(5, results.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(i, results[i].AsSingleRow<int>());
+  }
+  EXPECT_FALSE(GetConn()->IsInTransaction());
+  UEXPECT_NO_THROW(GetConn()->Execute("SELECT 1"));
+}
+
+UTEST_P(PostgreConnection, BatchEmptyAndSingle) {
+  CheckConnection(GetConn());
+
+  std::vector<pg::ResultSet> results;
+  UEXPECT_NO_THROW(results = GetConn()->ExecuteBatch(pg::QueryBatch{}, {}));
+  EXPECT_TRUE(results.empty());
+
+  UEXPECT_NO_THROW(results = GetConn()->ExecuteBatch(MakeSelectBatch(1), {}));
+  ASSERT_EQ(1, results.size());
+  EXPECT_EQ(0, results[0].AsSingleRow<int>());
+}
+
+UTEST_P(PostgreConnection, BatchError) {
+  CheckConnection(GetConn());
+  pg::QueryBatch batch;
+  batch.Add("SELECT 1");
+  batch.Add("SELECT 1 / 0");
+  batch.Add("SELECT 3");
+
+  UEXPECT_THROW(GetConn()->ExecuteBatch(batch, {}), pg::DataException);
+  // The connection is still usable
+  EXPECT_FALSE(GetConn()->IsBroken());
+  UEXPECT_NO_THROW(GetConn()->ExecuteBatch(MakeSelectBatch(3), {}));
+}
+
+UTEST_P(PostgreConnection, BatchInTransaction) {
+  CheckConnection(GetConn());
+  UEXPECT_NO_THROW(
+      GetConn()->Execute("CREATE TEMPORARY TABLE batch_test (v integer)"));
+  pg::Transaction trx{std::move(GetConn())};
+
+  pg::QueryBatch batch;
+  batch.Add("INSERT INTO batch_test VALUES (1)");
+  batch.Add("INSERT INTO batch_test VALUES (2)");
+  batch.Add("SELECT count(*)::integer FROM batch_test");
+
+  std::vector<pg::ResultSet> results;
+  UEXPECT_NO_THROW(results = trx.ExecuteBatch(batch));
+  ASSERT_EQ(3, results.size());
+  EXPECT_EQ(1, results[0].RowsAffected());
+  EXPECT_EQ(2, results[2].AsSingleRow<int>());
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, BatchTimeout) {
+  CheckConnection(GetConn());
+  pg::QueryBatch batch;
+  batch.Add("SELECT 1");
+  batch.Add("SELECT pg_sleep(1)");
+
+  pg::CommandControl cc{std::chrono::milliseconds{50},
+                        std::chrono::milliseconds{300}};
+  UEXPECT_THROW(GetConn()->ExecuteBatch(batch, cc), pg::ConnectionTimeoutError);
+}
+
+UTEST_P(PostgreConnection, BatchStats) {
+  CheckConnection(GetConn());
+  [[maybe_unused]] const auto old_stats = GetConn()->GetStatsAndReset();
+
+  UEXPECT_NO_THROW(GetConn()->ExecuteBatch(MakeSelectBatch(4), {}));
+  UEXPECT_NO_THROW(GetConn()->ExecuteBatch(MakeSelectBatch(2), {}));
+
+  const auto stats = GetConn()->GetStatsAndReset();
+  EXPECT_EQ(2, stats.batch_total);
+  EXPECT_LE(6, stats.execute_total);
+  EXPECT_LE(6, stats.reply_total);
+  EXPECT_EQ(0, stats.error_execute_total);
+#if LIBPQ_HAS_PIPELINING
+  EXPECT_EQ(4, stats.pipeline_depth_max);
+#endif
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -159,6 +160,10 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
       cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
                      pg::ClusterHostType::kNearest},
                     pg::Transaction::RW));
+  CheckRwTransaction(
+      cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
+                     pg::ClusterHostType::kAdaptive},
+                    {}));
 
   UEXPECT_THROW(
       cluster.Begin(
@@ -172,6 +177,12 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
            pg::ClusterHostType::kRoundRobin, pg::ClusterHostType::kNearest},
           pg::Transaction::RW),
       pg::LogicError);
+  UEXPECT_THROW(
+      cluster.Begin(
+          {pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
+           pg::ClusterHostType::kNearest, pg::ClusterHostType::kAdaptive},
+          {}),
+      pg::LogicError);
 }
 
 UTEST_F(PostgreCluster, ClusterSlaveRO) {
@@ -399,4 +410,67 @@ UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStoreMove) {
   }
 }
 
+UTEST_F(PostgreCluster, Listen) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  auto foo = cluster.Listen("test_listen_foo");
+  auto foo_other = cluster.Listen("test_listen_foo");
+  {
+    auto bar = cluster.Listen("test_listen_bar");
+    cluster.Execute(pg::ClusterHostType::kMaster, "SELECT pg_notify($1, $2)",
+                    "test_listen_bar", "bar");
+    auto notification = bar.WaitNotify(deadline);
+    ASSERT_TRUE(notification);
+    EXPECT_EQ("test_listen_bar", notification->channel);
+    EXPECT_EQ("bar", notification->payload);
+    EXPECT_NE(0, notification->backend_pid);
+  }
+
+  cluster.Execute(pg::ClusterHostType::kMaster, "NOTIFY test_listen_foo");
+  for (auto* scope : {&foo, &foo_other}) {
+    auto notification = scope->WaitNotify(deadline);
+    ASSERT_TRUE(notification);
+    EXPECT_EQ("test_listen_foo", notification->channel);
+    EXPECT_EQ("", notification->payload);
+  }
+  EXPECT_FALSE(foo.WaitNotify(engine::Deadline::Passed()));
+}
+
+UTEST_F(PostgreCluster, SharedSession) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  pg::PoolSettings pool_settings{0, 2, 100};
+  pool_settings.shared_session_size = 1;
+  pg::Cluster cluster(GetDsnListFromEnv(), nullptr, GetTaskProcessor(),
+                      {{},
+                       {utest::kMaxTestWaitTime},
+                       pool_settings,
+                       kCachePreparedStatements,
+                       storages::postgres::InitMode::kAsync,
+                       "",
+                       {},
+                       {}},
+                      {kTestCmdCtl, {}, {}}, {}, {}, testsuite_tasks,
+                      dynamic_config::GetDefaultSource(), 0);
+
+  constexpr int kStatements = 20;
+  std::vector<engine::TaskWithResult<int>> tasks;
+  for (int i = 0; i < kStatements; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&cluster, i] {
+      return cluster.Execute(pg::ClusterHostType::kMaster, "SELECT $1", i)
+          .AsSingleRow<int>();
+    }));
+  }
+  auto failed = engine::AsyncNoSpan([&cluster] {
+    cluster.Execute(pg::ClusterHostType::kMaster, "SELECT 1 / $1", 0);
+  });
+
+  UEXPECT_THROW(failed.Get(), pg::DataException);
+  for (int i = 0; i < kStatements; ++i) {
+    EXPECT_EQ(i, tasks[i].Get());
+  }
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,126 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+
+#include <userver/storages/postgres/column_view.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr int kRowsCount = 1000;
+
+}  // namespace
+
+UTEST_P(PostgreConnection, ColumnViewFixedSize) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UASSERT_NO_THROW(
+      res = GetConn()->Execute(
+          "select i::smallint as s, i as i, i::bigint as b, "
+          "i::real as f, i::double precision as d, "
+          "'2000-01-01'::timestamp + i * interval '1 second' as ts "
+          "from generate_series(1, $1) i",
+          kRowsCount));
+  ASSERT_EQ(kRowsCount, res.Size());
+
+  const auto smallints = pg::ColumnView{res, "s"}.AsVector<pg::Smallint>();
+  const auto integers = pg::ColumnView{res, "i"}.AsVector<pg::Integer>();
+  const auto bigints = pg::ColumnView{res, "b"}.AsVector<pg::Bigint>();
+  const auto floats = pg::ColumnView{res, "f"}.AsVector<float>();
+  const auto doubles = pg::ColumnView{res, "d"}.AsVector<double>();
+  const auto timestamps = pg::ColumnView{res, "ts"}.AsVector<pg::TimePoint>();
+  ASSERT_EQ(kRowsCount, timestamps.size());
+
+  for (std::size_t row = 0; row < res.Size(); ++row) {
+    const auto value = static_cast<int>(row) + 1;
+    EXPECT_EQ(value, smallints[row]);
+    EXPECT_EQ(value, integers[row]);
+    EXPECT_EQ(value, bigints[row]);
+    EXPECT_EQ(value, floats[row]);
+    EXPECT_EQ(value, doubles[row]);
+    EXPECT_EQ(res[row]["ts"].As<pg::TimePoint>(), timestamps[row]);
+  }
+}
+
+UTEST_P(PostgreConnection, ColumnViewIntegralWidening) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UASSERT_NO_THROW(res = GetConn()->Execute(
+                       "select generate_series(1, $1)::integer", kRowsCount));
+
+  const auto values = pg::ColumnView{res, 0}.AsVector<pg::Bigint>();
+  ASSERT_EQ(kRowsCount, values.size());
+  EXPECT_EQ(1, values.front());
+  EXPECT_EQ(kRowsCount, values.back());
+}
+
+UTEST_P(PostgreConnection, ColumnViewNulls) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UASSERT_NO_THROW(res = GetConn()->Execute(
+                       "select nullif(i, 2), nullif(i::text, '2') "
+                       "from generate_series(1, 3) i"));
+
+  const pg::ColumnView ints{res, 0};
+  EXPECT_TRUE(ints.HasNulls());
+  EXPECT_FALSE(ints.IsNull(0));
+  EXPECT_TRUE(ints.IsNull(1));
+  EXPECT_TRUE(ints.GetRawBuffer(1).empty());
+  UEXPECT_THROW(ints.AsVector<pg::Integer>(), pg::FieldValueIsNull);
+  UEXPECT_THROW(pg::ColumnView(res, 1).AsVector<std::string_view>(),
+                pg::FieldValueIsNull);
+
+  const auto optionals = ints.AsVector<std::optional<pg::Integer>>();
+  ASSERT_EQ(3, optionals.size());
+  EXPECT_EQ(1, optionals[0]);
+  EXPECT_FALSE(optionals[1]);
+  EXPECT_EQ(3, optionals[2]);
+}
+
+UTEST_P(PostgreConnection, ColumnViewStrings) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UASSERT_NO_THROW(res = GetConn()->Execute(
+                       "select 'value ' || i as name "
+                       "from generate_series(1, $1) i",
+                       kRowsCount));
+
+  const pg::ColumnView column{res, "name"};
+  EXPECT_EQ("name", column.Name());
+  EXPECT_EQ(0, column.ColumnIndex());
+  EXPECT_FALSE(column.HasNulls());
+
+  const auto names = column.AsVector<std::string_view>();
+  ASSERT_EQ(kRowsCount, names.size());
+  for (std::size_t row = 0; row < names.size(); ++row) {
+    EXPECT_EQ("value " + std::to_string(row + 1), names[row]);
+    // The values point into the result set data
+    EXPECT_EQ(column.GetRawBuffer(row).data(), names[row].data());
+  }
+  EXPECT_EQ(column.AsVector<std::string>().back(), names.back());
+}
+
+UTEST_P(PostgreConnection, ColumnViewOobAccess) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UASSERT_NO_THROW(res = GetConn()->Execute("select 1 as a"));
+
+  UEXPECT_THROW(pg::ColumnView(res, 1), pg::FieldIndexOutOfBounds);
+  UEXPECT_THROW(pg::ColumnView(res, "b"), pg::FieldNameDoesntExist);
+
+  const pg::ColumnView column{res, "a"};
+  EXPECT_EQ(1, column.Size());
+  UEXPECT_THROW(column.IsNull(1), pg::RowIndexOutOfBounds);
+  UEXPECT_THROW(column.GetRawBuffer(1), pg::RowIndexOutOfBounds);
+}
+
+USERVER_NAMESPACE_END
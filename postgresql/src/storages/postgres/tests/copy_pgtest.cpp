@@ -0,0 +1,115 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr int kRowsCount = 10000;
+
+void CreateTable(pg::detail::ConnectionPtr& conn) {
+  UEXPECT_NO_THROW(
+      conn->Execute("CREATE TEMPORARY TABLE copy_test "
+                    "(id integer, name text, value bigint)"));
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyStatement) {
+  EXPECT_EQ("COPY foo (a, b) FROM STDIN (FORMAT binary)",
+            pg::detail::MakeCopyStatement("foo", {"a", "b"}, true));
+  EXPECT_EQ("COPY foo TO STDOUT (FORMAT binary)",
+            pg::detail::MakeCopyStatement("foo", {}, false));
+}
+
+UTEST_P(PostgreConnection, CopyInOut) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+  pg::Transaction trx{std::move(GetConn())};
+
+  auto writer = trx.CopyIn("copy_test", {"id", "name", "value"});
+  for (int i = 0; i < kRowsCount; ++i) {
+    std::optional<std::int64_t> value;
+    if (i % 2) value = i * 10;
+    UEXPECT_NO_THROW(writer.WriteRow(i, std::to_string(i), value));
+  }
+  EXPECT_EQ(kRowsCount, writer.Finish());
+  EXPECT_EQ(kRowsCount,
+            trx.Execute("SELECT count(*)::integer FROM copy_test")
+                .AsSingleRow<int>());
+
+  auto reader = trx.CopyOut("copy_test", {"id", "name", "value"});
+  int id = 0;
+  std::string name;
+  std::optional<std::int64_t> value;
+  int count = 0;
+  while (reader.ReadRow(id, name, value)) {
+    EXPECT_EQ(std::to_string(id), name);
+    if (id % 2) {
+      EXPECT_EQ(id * 10, value);
+    } else {
+      EXPECT_FALSE(value);
+    }
+    ++count;
+  }
+  EXPECT_EQ(kRowsCount, count);
+  EXPECT_FALSE(reader.ReadRow(id, name, value));
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyRowObjects) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+  pg::Transaction trx{std::move(GetConn())};
+
+  using Row = std::tuple<int, std::string, std::int64_t>;
+  auto writer = trx.CopyIn("copy_test", {"id", "name", "value"});
+  UEXPECT_NO_THROW(writer.WriteRowObject(Row{1, "one", 10}));
+  UEXPECT_NO_THROW(writer.WriteRowObject(Row{2, "two", 20}));
+  UEXPECT_THROW(writer.WriteRow(3, "three"), pg::LogicError);
+  EXPECT_EQ(2, writer.Finish());
+  UEXPECT_THROW(writer.WriteRow(3, "three", 30), pg::LogicError);
+
+  auto reader = trx.CopyOut("copy_test", {});
+  Row row;
+  ASSERT_TRUE(reader.ReadRowObject(row));
+  EXPECT_EQ(Row(1, "one", 10), row);
+  ASSERT_TRUE(reader.ReadRowObject(row));
+  EXPECT_EQ(Row(2, "two", 20), row);
+  EXPECT_FALSE(reader.ReadRowObject(row));
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyInAbort) {
+  CheckConnection(GetConn());
+  CreateTable(GetConn());
+  {
+    pg::Transaction trx{std::move(GetConn())};
+    {
+      auto writer = trx.CopyIn("copy_test", {"id"});
+      UEXPECT_NO_THROW(writer.WriteRow(1));
+    }
+    // The aborted COPY fails the transaction
+    UEXPECT_THROW(trx.Execute("SELECT 1"), pg::Error);
+    UEXPECT_NO_THROW(trx.Rollback());
+  }
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+  CheckConnection(GetConn());
+  pg::Transaction trx{std::move(GetConn())};
+  UEXPECT_THROW(trx.CopyIn("copy_unknown_table", {"id"}),
+                pg::AccessRuleViolation);
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#include <storages/postgres/detail/host_selector.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::postgres::detail::HostLoad;
+using storages::postgres::detail::SelectAdaptiveHost;
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+constexpr milliseconds kMaxLag{1000};
+
+}  // namespace
+
+TEST(PostgreHostSelector, RoundRobinOnTies) {
+  const std::vector<HostLoad> hosts(3);
+  for (std::size_t start = 0; start < 6; ++start) {
+    const auto selection = SelectAdaptiveHost(hosts, kMaxLag, start);
+    EXPECT_EQ(start % hosts.size(), selection.pos);
+    EXPECT_TRUE(selection.is_nearest);
+  }
+}
+
+TEST(PostgreHostSelector, Latency) {
+  std::vector<HostLoad> hosts(2);
+  hosts[0].query_latency = microseconds{2000};
+  hosts[1].query_latency = microseconds{1000};
+  EXPECT_EQ(1, SelectAdaptiveHost(hosts, kMaxLag, 0).pos);
+
+  // RTT is used until there are queries
+  hosts[0].roundtrip_time = microseconds{2800};
+  hosts[1].query_latency = microseconds{0};
+  hosts[1].roundtrip_time = microseconds{3000};
+  EXPECT_EQ(0, SelectAdaptiveHost(hosts, kMaxLag, 0).pos);
+}
+
+TEST(PostgreHostSelector, InFlight) {
+  std::vector<HostLoad> hosts(2);
+  hosts[0].query_latency = microseconds{1000};
+  hosts[0].in_flight = 3;
+  hosts[1].query_latency = microseconds{1500};
+  hosts[1].in_flight = 1;
+  EXPECT_EQ(1, SelectAdaptiveHost(hosts, kMaxLag, 0).pos);
+}
+
+TEST(PostgreHostSelector, ReplicationLag) {
+  std::vector<HostLoad> hosts(2);
+  hosts[0].query_latency = microseconds{1000};
+  hosts[0].replication_lag = milliseconds{900};
+  hosts[1].query_latency = microseconds{1500};
+  EXPECT_EQ(1, SelectAdaptiveHost(hosts, kMaxLag, 0).pos);
+  // Lag is ignored when it is not limited
+  EXPECT_EQ(0, SelectAdaptiveHost(hosts, milliseconds{0}, 0).pos);
+}
+
+TEST(PostgreHostSelector, NearestPreferred) {
+  std::vector<HostLoad> hosts(3);
+  hosts[0].roundtrip_time = microseconds{2000};
+  hosts[0].query_latency = microseconds{2500};
+  hosts[1].roundtrip_time = microseconds{300};
+  hosts[1].query_latency = microseconds{1000};
+  hosts[1].in_flight = 2;
+  hosts[2].roundtrip_time = microseconds{500};
+  hosts[2].query_latency = microseconds{1200};
+  hosts[2].in_flight = 2;
+
+  auto selection = SelectAdaptiveHost(hosts, kMaxLag, 0);
+  EXPECT_EQ(1, selection.pos);
+  EXPECT_TRUE(selection.is_nearest);
+
+  // Remote host is chosen when the nearest ones are overloaded
+  hosts[1].in_flight = 20;
+  hosts[2].in_flight = 20;
+  selection = SelectAdaptiveHost(hosts, kMaxLag, 0);
+  EXPECT_EQ(0, selection.pos);
+  EXPECT_FALSE(selection.is_nearest);
+}
+
+USERVER_NAMESPACE_END
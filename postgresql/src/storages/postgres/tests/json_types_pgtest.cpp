@@ -1,10 +1,12 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
+#include <userver/formats/json/parser/parser.hpp>
 #include <userver/storages/postgres/io/json_types.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace pg = storages::postgres;
+namespace fjp = formats::json::parser;
 
 namespace {
 
@@ -93,6 +95,35 @@ UTEST_P(PostgreConnection, JsonStored) {
   EXPECT_EQ(expected, json);
 }
 
+UTEST_P(PostgreConnection, TypedJsonSelect) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  using IntArray = pg::TypedJsonArray<int, fjp::IntParser>;
+  using NestedArray =
+      pg::TypedJsonArray<std::vector<int>,
+                         pg::io::detail::JsonArrayParser<int, fjp::IntParser,
+                                                         std::vector<int>>>;
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute("select '[1, 2, 3]'::jsonb"));
+  EXPECT_EQ((std::vector<int>{1, 2, 3}), res[0][0].As<IntArray>().value);
+
+  UEXPECT_NO_THROW(
+      res = GetConn()->Execute("select '[[1], [], [2, 3]]'::json"));
+  EXPECT_EQ((std::vector<std::vector<int>>{{1}, {}, {2, 3}}),
+            res[0][0].As<NestedArray>().value);
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute(R"~(select '"foo"'::jsonb)~"));
+  EXPECT_EQ("foo", res[0][0].As<pg::TypedJson<fjp::StringParser>>().value);
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute("select $1",
+                                            formats::json::FromString("[1]")));
+  EXPECT_EQ(std::vector<int>{1}, res[0][0].As<IntArray>().value);
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute(R"~(select '["foo"]'::jsonb)~"));
+  UEXPECT_THROW(res[0][0].As<IntArray>(), fjp::ParseError);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
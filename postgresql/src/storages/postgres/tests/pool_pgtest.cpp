@@ -234,6 +234,51 @@ UTEST_P(PostgrePool, MinPool) {
   EXPECT_EQ(0, stats.connection.error_total);
 }
 
+UTEST_P(PostgrePool, IdleBufferWarmup) {
+  pg::PoolSettings settings{1, 10, 10};
+  settings.idle_buffer_size = 3;
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), settings,
+      kCachePreparedStatements, {}, GetTestCmdCtls(),
+      testsuite::PostgresControl{}, error_injection::Settings{}, {},
+      dynamic_config::GetDefaultSource());
+
+  auto conn = pool->Acquire(MakeDeadline());
+  // The busy connection and the idle buffer are opened ahead of demand
+  while (pool->GetStatistics().connection.active < 4) {
+    engine::SleepFor(std::chrono::milliseconds{50});
+  }
+  const auto& stats = pool->GetStatistics();
+  EXPECT_LE(4, stats.connection.target_size);
+  EXPECT_LE(3, stats.connection.warmup_total);
+  EXPECT_GE(settings.max_size, stats.connection.active);
+}
+
+UTEST_P(PostgrePool, SharedStatementDescriptions) {
+  auto description_cache =
+      std::make_shared<pg::detail::StatementDescriptionCache>(10);
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {2, 2, 10},
+      kCachePreparedStatements, {}, GetTestCmdCtls(),
+      testsuite::PostgresControl{}, error_injection::Settings{}, {},
+      dynamic_config::GetDefaultSource(), description_cache);
+
+  auto conn1 = pool->Acquire(MakeDeadline());
+  auto conn2 = pool->Acquire(MakeDeadline());
+  ASSERT_NE(conn1.get(), conn2.get());
+
+  const pg::Query query{"SELECT $1::integer, $2::text"};
+  EXPECT_EQ(0, description_cache->GetSize());
+  auto res = conn1->Execute(query, 1, std::string{"one"});
+  EXPECT_EQ(1, description_cache->GetSize());
+
+  // The second connection prepares the statement using the cached description
+  res = conn2->Execute(query, 2, std::string{"two"});
+  EXPECT_EQ(1, description_cache->GetSize());
+  EXPECT_EQ(2, res.Front()[0].As<int>());
+  EXPECT_EQ("two", res.Front()[1].As<std::string>());
+}
+
 UTEST_P(PostgrePool, ConnectionCleanup) {
   auto pool = pg::detail::ConnectionPool::Create(
       GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 1, 10},
@@ -0,0 +1,63 @@
+#include <storages/postgres/detail/pool_sizer.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::postgres::detail::PoolSizer;
+
+constexpr PoolSizer::Limits kLimits{2, 50, 4};
+
+}  // namespace
+
+TEST(PostgrePoolSizer, IdleBuffer) {
+  PoolSizer sizer;
+  EXPECT_EQ(4, sizer.Update({0, 0, false}, kLimits));
+  EXPECT_EQ(2, sizer.Update({0, 0, false}, {2, 50, 0}));
+}
+
+TEST(PostgrePoolSizer, Limits) {
+  PoolSizer sizer;
+  EXPECT_EQ(50, sizer.Update({45, 10, true}, kLimits));
+  sizer.Reset();
+  EXPECT_EQ(5, sizer.Update({0, 0, false}, {5, 50, 1}));
+  // max_size lowered below min_size by connlimit
+  EXPECT_EQ(5, sizer.Update({10, 0, false}, {5, 3, 1}));
+}
+
+TEST(PostgrePoolSizer, AcquireWaitsDoubleBuffer) {
+  PoolSizer sizer;
+  // 10 in use + trend of 5 extrapolated for 3 steps + buffer
+  EXPECT_EQ(10 + 15 + 4, sizer.Update({10, 0, false}, kLimits));
+  sizer.Reset();
+  EXPECT_EQ(10 + 15 + 8, sizer.Update({10, 0, true}, kLimits));
+}
+
+TEST(PostgrePoolSizer, GrowthTrend) {
+  PoolSizer sizer;
+  std::size_t prev_target = 0;
+  for (std::size_t used = 0; used <= 20; used += 4) {
+    const auto target = sizer.Update({used, 0, false}, kLimits);
+    // Pre-opens more than the current demand plus buffer when growing
+    if (used > 0) EXPECT_GT(target, used + kLimits.idle_buffer);
+    EXPECT_GE(target, prev_target);
+    prev_target = target;
+  }
+}
+
+TEST(PostgrePoolSizer, KeepsPeakForWindow) {
+  PoolSizer sizer;
+  for (std::size_t i = 0; i < PoolSizer::kWindowSize; ++i) {
+    sizer.Update({20, 0, false}, kLimits);
+  }
+  // Load drops, but the recent peak is kept for the window
+  EXPECT_LE(24, sizer.Update({2, 0, false}, kLimits));
+  for (std::size_t i = 0; i < 2 * PoolSizer::kWindowSize; ++i) {
+    sizer.Update({2, 0, false}, kLimits);
+  }
+  EXPECT_EQ(6, sizer.Update({2, 0, false}, kLimits));
+}
+
+USERVER_NAMESPACE_END
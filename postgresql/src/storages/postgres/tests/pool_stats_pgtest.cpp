@@ -8,6 +8,7 @@
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 
@@ -215,6 +216,27 @@ UTEST_F(PostgrePoolStats, ConnUsed) {
   EXPECT_EQ(stats.connection.used, 1);
 }
 
+UTEST_F(PostgrePoolStats, CancelledByDeadline) {
+  auto config_storage = dynamic_config::MakeDefaultStorage(
+      {{pg::kDeadlinePropagationVersionConfig, 1}});
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kAsync, {1, 10, 10},
+      kCachePreparedStatements, {}, GetTestCmdCtls(), {}, {}, {},
+      config_storage.GetSource());
+
+  const auto expired_deadline =
+      engine::Deadline::FromDuration(std::chrono::seconds{-1});
+  server::request::kTaskInheritedData.Set(server::request::TaskInheritedData{
+      {}, "dummy-method", {}, expired_deadline});
+
+  UEXPECT_THROW(pool->Acquire(MakeDeadline()), pg::ConnectionInterrupted);
+
+  const auto& stats = pool->GetStatistics();
+  EXPECT_EQ(stats.deadline_cancelled, 1);
+  EXPECT_EQ(stats.connection.used, 0);
+}
+
 UTEST_F(PostgrePoolStats, Portal) {
   auto pool = pg::detail::ConnectionPool::Create(
       GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
@@ -289,6 +289,53 @@ UTEST_P(PostgreConnection, PortalParallel) {
   EXPECT_EQ(second.FetchedSoFar(), kIterations);
 }
 
+UTEST_P(PostgreConnection, PortalPrefetch) {
+  constexpr int kRows = 1000;
+  constexpr std::uint32_t kChunkSize = 64;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  for (const std::size_t window : {1, 3}) {
+    auto portal = trx.MakePortal("SELECT generate_series(1, $1)", kRows);
+    portal.SetPrefetch(window);
+
+    int expected = 0;
+    while (portal) {
+      auto result = portal.Fetch(kChunkSize);
+      for (const auto& row : result) {
+        EXPECT_EQ(++expected, row[0].As<int>());
+      }
+    }
+    EXPECT_EQ(kRows, expected);
+    EXPECT_EQ(kRows, portal.FetchedSoFar());
+    EXPECT_ANY_THROW(portal.Fetch(kChunkSize));
+  }
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, PortalPrefetchPending) {
+  constexpr int kRows = 100;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  {
+    auto portal = trx.MakePortal("SELECT generate_series(1, $1)", kRows);
+    portal.SetPrefetch(2);
+    auto result = portal.Fetch(10);
+    ASSERT_EQ(10, result.Size());
+
+    // Batches requested ahead are of the same size
+    UEXPECT_THROW(portal.Fetch(20), pg::LogicError);
+    // The connection is busy with the prefetched batches
+    UEXPECT_THROW(trx.Execute("SELECT 1"), pg::ConnectionBusy);
+  }
+  // Prefetched batches are discarded with the portal
+  UEXPECT_NO_THROW(trx.Execute("SELECT 1"));
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
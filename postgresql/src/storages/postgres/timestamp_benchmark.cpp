@@ -1,12 +1,14 @@
 #include <benchmark/benchmark.h>
 
 #include <chrono>
+#include <vector>
 
 #include <cctz/civil_time.h>
 #include <cctz/time_zone.h>
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/tests/test_buffers.hpp>
+#include <userver/storages/postgres/column_view.hpp>
 #include <userver/storages/postgres/io/chrono.hpp>
 #include <userver/storages/postgres/io/user_types.hpp>
 
@@ -81,6 +83,36 @@ BENCHMARK_F(PgConnection, TimestampBinaryRoundtrip)(benchmark::State& state) {
   });
 }
 
+constexpr int kColumnRowsCount = 100'000;
+constexpr auto kTimestampSeriesQuery =
+    "select now()::timestamp + generate_series(1, $1) * interval '1 second'";
+
+BENCHMARK_F(PgConnection, TimestampColumnRowByRow)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res =
+        GetConnection().Execute(kTimestampSeriesQuery, kColumnRowsCount);
+    for (auto _ : state) {
+      std::vector<pg::TimePoint> values;
+      values.reserve(res.Size());
+      for (const auto& row : res) values.push_back(row.As<pg::TimePoint>());
+      benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+BENCHMARK_F(PgConnection, TimestampColumnView)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res =
+        GetConnection().Execute(kTimestampSeriesQuery, kColumnRowsCount);
+    for (auto _ : state) {
+      auto values = pg::ColumnView{res, 0}.AsVector<pg::TimePoint>();
+      benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
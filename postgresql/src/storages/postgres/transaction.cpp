@@ -46,6 +46,48 @@ ResultSet Transaction::Execute(OptionalCommandControl statement_cmd_ctl,
                    statement_cmd_ctl);
 }
 
+std::vector<ResultSet> Transaction::ExecuteBatch(
+    OptionalCommandControl statement_cmd_ctl, const QueryBatch& batch) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "ExecuteBatch called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  statement_cmd_ctl = CheckDeadline(conn_, std::move(statement_cmd_ctl));
+
+  return conn_->ExecuteBatch(batch, std::move(statement_cmd_ctl));
+}
+
+CopyInWriter Transaction::CopyIn(const std::string& table,
+                                 const std::vector<std::string>& columns,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyIn called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  statement_cmd_ctl = CheckDeadline(conn_, std::move(statement_cmd_ctl));
+
+  conn_->StartCopy(detail::MakeCopyStatement(table, columns, true),
+                   std::move(statement_cmd_ctl));
+  return CopyInWriter{conn_.get(), columns.size()};
+}
+
+CopyOutReader Transaction::CopyOut(const std::string& table,
+                                   const std::vector<std::string>& columns,
+                                   OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyOut called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  statement_cmd_ctl = CheckDeadline(conn_, std::move(statement_cmd_ctl));
+
+  conn_->StartCopy(detail::MakeCopyStatement(table, columns, false),
+                   std::move(statement_cmd_ctl));
+  return CopyOutReader{conn_.get(), columns.size()};
+}
+
 Portal Transaction::MakePortal(OptionalCommandControl statement_cmd_ctl,
                                const Query& query,
                                const ParameterStore& store) {
@@ -65,8 +107,7 @@ ResultSet Transaction::DoExecute(const Query& query,
   if (!statement_cmd_ctl) {
     statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
   }
-  auto source = conn_.GetConfigSource();
-  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+  statement_cmd_ctl = CheckDeadline(conn_, std::move(statement_cmd_ctl));
 
   detail::StatementTimer timer{query, conn_};
   auto res = conn_->Execute(query, params, std::move(statement_cmd_ctl));
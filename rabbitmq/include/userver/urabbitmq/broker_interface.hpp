@@ -4,6 +4,7 @@
 /// @brief A bunch of interface classes
 
 #include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/flags.hpp>
@@ -103,6 +104,30 @@ class IChannelInterface {
                        const std::string& message,
                        engine::Deadline deadline) = 0;
 
+  /// @brief Publish multiple messages to an exchange with the same routing key
+  ///
+  /// Same as calling `Publish` for every message in order, but the frames
+  /// of all the messages are sent to the broker in as few socket writes
+  /// as possible.
+  ///
+  /// @param exchange the exchange to publish to
+  /// @param routing_key the routing key
+  /// @param messages the messages to send
+  /// @param deadline execution deadline
+  ///
+  /// @note This method is `fire and forget` (no delivery guarantees),
+  /// use `PublishReliableBatch` for delivery guarantees.
+  virtual void PublishBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type, engine::Deadline deadline) = 0;
+
+  /// @brief overload of PublishBatch
+  virtual void PublishBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            engine::Deadline deadline) = 0;
+
  protected:
   ~IChannelInterface();
 };
@@ -134,6 +159,31 @@ class IReliableChannelInterface {
                                const std::string& message,
                                engine::Deadline deadline) = 0;
 
+  /// @brief Publish multiple messages to an exchange with the same routing key
+  /// and await confirmation from the broker for all of them
+  ///
+  /// Unlike calling `PublishReliable` in a loop, this doesn't wait for
+  /// a confirmation before sending the next message: publishes are pipelined
+  /// up to the `max_in_flight_requests` limit of the connection.
+  /// Messages are sent in order, if any of them fails no more messages are
+  /// sent and an exception is thrown once the outstanding ones are resolved.
+  ///
+  /// @param exchange the exchange to publish to
+  /// @param routing_key the routing key
+  /// @param messages the messages to send
+  /// @param deadline execution deadline
+  virtual void PublishReliableBatch(const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const std::vector<std::string>& messages,
+                                    MessageType type,
+                                    engine::Deadline deadline) = 0;
+
+  /// @brief overload of PublishReliableBatch
+  virtual void PublishReliableBatch(const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const std::vector<std::string>& messages,
+                                    engine::Deadline deadline) = 0;
+
  protected:
   ~IReliableChannelInterface();
 };
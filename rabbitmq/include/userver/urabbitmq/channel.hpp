@@ -41,6 +41,17 @@ class Channel final : IChannelInterface {
     Publish(exchange, routing_key, message, MessageType::kTransient, deadline);
   };
 
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages, MessageType type,
+                    engine::Deadline deadline) override;
+
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages,
+                    engine::Deadline deadline) override {
+    PublishBatch(exchange, routing_key, messages, MessageType::kTransient,
+                 deadline);
+  }
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
@@ -74,6 +85,20 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type,
+                            engine::Deadline deadline) override;
+
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            engine::Deadline deadline) override {
+    PublishReliableBatch(exchange, routing_key, messages,
+                         MessageType::kTransient, deadline);
+  }
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
@@ -25,6 +25,14 @@ class ClientImpl;
 /// @brief Interface for communicating with a RabbitMQ cluster.
 ///
 /// Usually retrieved from components::RabbitMQ component.
+///
+/// If ClientSettings::publish_shards is set, the Publish* methods of the
+/// client spread the messages across that many dedicated connections by the
+/// hash of the routing key. The messages with the same routing key then reach
+/// the broker in the order of the calls, even if they are published from
+/// different tasks. A publish into a connection blocked by the broker (e.g.
+/// on a memory alarm) throws right away instead of waiting for the deadline.
+/// The channels from GetChannel() and GetReliableChannel() are not sharded.
 class Client : public std::enable_shared_from_this<Client>,
                public IAdminInterface,
                public IChannelInterface,
@@ -82,6 +90,17 @@ class Client : public std::enable_shared_from_this<Client>,
     Publish(exchange, routing_key, message, MessageType::kTransient, deadline);
   };
 
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages, MessageType type,
+                    engine::Deadline deadline) override;
+
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages,
+                    engine::Deadline deadline) override {
+    PublishBatch(exchange, routing_key, messages, MessageType::kTransient,
+                 deadline);
+  }
+
   /// @brief Get a publisher interface for the broker.
   ///
   /// @param deadline deadline for connection acquisition from the pool
@@ -98,6 +117,20 @@ class Client : public std::enable_shared_from_this<Client>,
                     deadline);
   }
 
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type,
+                            engine::Deadline deadline) override;
+
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            engine::Deadline deadline) override {
+    PublishReliableBatch(exchange, routing_key, messages,
+                         MessageType::kTransient, deadline);
+  }
+
   /// @brief Get a reliable publisher interface for the broker
   /// (publisher-confirms)
   ///
@@ -112,7 +145,7 @@ class Client : public std::enable_shared_from_this<Client>,
 
  private:
   friend class ConsumerBase;
-  utils::FastPimpl<ClientImpl, 232, 8> impl_;
+  utils::FastPimpl<ClientImpl, 264, 8> impl_;
 };
 
 }  // namespace urabbitmq
@@ -70,6 +70,14 @@ struct ClientSettings final {
   /// Whether to use TLS for connections
   bool use_secure_connection = true;
 
+  /// Number of dedicated connections the publishes of urabbitmq::Client are
+  /// spread across by the hash of the routing key, 0 to publish through
+  /// the pool. The publishes of a routing key go through the same connection
+  /// one at a time, so they reach the broker in the order of the calls.
+  /// Note: these connections are taken from the pool and don't come back,
+  /// just as the connections of the consumers
+  size_t publish_shards = 0;
+
   ClientSettings(const components::ComponentConfig& config,
                  const RabbitEndpoints& rabbit_endpoints);
 
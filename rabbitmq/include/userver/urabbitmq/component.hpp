@@ -51,6 +51,7 @@ namespace components {
 /// max_pool_size           | maximum connections pool size (per host, consumers excluded)         | 10
 /// max_in_flight_requests  | per-connection limit for requests awaiting response from the broker  | 5
 /// use_secure_connection   | whether to use TLS for connections                                   | true
+/// publish_shards          | dedicated publish connections, see urabbitmq::ClientSettings         | 0
 ///
 // clang-format on
 
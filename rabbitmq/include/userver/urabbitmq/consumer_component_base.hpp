@@ -34,10 +34,15 @@ namespace urabbitmq {
 /// @snippet samples/rabbitmq_service/static_config.yaml  RabbitMQ consumer sample - static config
 ///
 /// ## Static options:
-/// Name             | Description
-/// rabbit_name      | Name of the RabbitMQ component to use for consumption
-/// queue            | Name of the queue to consume from
-/// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// Name                   | Description | Default value
+/// ---------------------- | ----------- | -------------
+/// rabbit_name            | Name of the RabbitMQ component to use for consumption | --
+/// queue                  | Name of the queue to consume from | --
+/// prefetch_count         | prefetch_count for the consumer, limits the amount of in-flight messages | --
+/// ack_batch_size         | number of processed messages to acknowledge with a single multiple-ack, 1 disables batching | 1
+/// ack_batch_interval     | max time a processed message stays unacknowledged if batching is enabled | 100ms
+/// min_prefetch_count     | if non-zero, prefetch adapts at runtime within [min_prefetch_count, prefetch_count] | 0
+/// prefetch_tune_interval | how often the adaptive prefetch is reconsidered | 1s
 ///
 // clang-format on
 class ConsumerComponentBase : public components::LoggableComponentBase {
@@ -3,7 +3,9 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -24,6 +26,24 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// Number of processed messages to acknowledge with a single multiple-ack.
+  /// Only a contiguous range of processed delivery tags can be acknowledged
+  /// this way, the rest are acknowledged one by one after
+  /// `ack_batch_interval`. Setting this value to 1 disables batching.
+  std::uint16_t ack_batch_size{1};
+
+  /// Max time a processed message stays unacknowledged if batching is enabled
+  std::chrono::milliseconds ack_batch_interval{100};
+
+  /// If non-zero, prefetch is adjusted at runtime within
+  /// [min_prefetch_count, prefetch_count], growing while the consumer is
+  /// saturated and processing latency stays stable, and shrinking when
+  /// latency degrades
+  std::uint16_t min_prefetch_count{0};
+
+  /// How often the adaptive prefetch is reconsidered
+  std::chrono::milliseconds prefetch_tune_interval{1000};
 };
 
 }  // namespace urabbitmq
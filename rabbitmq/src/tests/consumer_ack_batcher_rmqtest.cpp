@@ -0,0 +1,66 @@
+#include <userver/utest/utest.hpp>
+
+#include <urabbitmq/consumer_ack_batcher.hpp>
+#include <urabbitmq/statistics/connection_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using AckBatcher = urabbitmq::AckBatcher;
+
+}  // namespace
+
+TEST(AckBatcher, AcksContiguousPrefix) {
+  urabbitmq::statistics::ConnectionStatistics stats;
+  AckBatcher batcher{3, stats};
+  for (uint64_t tag = 1; tag <= 5; ++tag) batcher.OnDelivered(tag);
+
+  EXPECT_FALSE(batcher.OnProcessed(2).multiple_up_to.has_value());
+  EXPECT_FALSE(batcher.OnProcessed(1).multiple_up_to.has_value());
+
+  const auto acks = batcher.OnProcessed(4);
+  ASSERT_TRUE(acks.multiple_up_to.has_value());
+  EXPECT_EQ(*acks.multiple_up_to, 2);
+  EXPECT_TRUE(acks.single.empty());
+  EXPECT_EQ(stats.Get().messages_acked, 2);
+}
+
+TEST(AckBatcher, SlowMessageHoldsBackUntilFlush) {
+  urabbitmq::statistics::ConnectionStatistics stats;
+  AckBatcher batcher{2, stats};
+  for (uint64_t tag = 1; tag <= 4; ++tag) batcher.OnDelivered(tag);
+
+  EXPECT_FALSE(batcher.OnProcessed(2).multiple_up_to.has_value());
+  EXPECT_FALSE(batcher.OnProcessed(3).multiple_up_to.has_value());
+
+  const auto acks = batcher.Flush();
+  EXPECT_FALSE(acks.multiple_up_to.has_value());
+  EXPECT_EQ(acks.single, (std::vector<uint64_t>{2, 3}));
+
+  batcher.OnProcessed(1);
+  const auto rest = batcher.Flush();
+  ASSERT_TRUE(rest.multiple_up_to.has_value());
+  EXPECT_EQ(*rest.multiple_up_to, 1);
+  EXPECT_TRUE(rest.single.empty());
+  EXPECT_EQ(stats.Get().messages_acked, 3);
+}
+
+TEST(AckBatcher, RejectedAreSkipped) {
+  urabbitmq::statistics::ConnectionStatistics stats;
+  AckBatcher batcher{2, stats};
+  for (uint64_t tag = 1; tag <= 3; ++tag) batcher.OnDelivered(tag);
+
+  batcher.OnRejected(1);
+  EXPECT_FALSE(batcher.OnProcessed(2).multiple_up_to.has_value());
+
+  const auto acks = batcher.OnProcessed(3);
+  ASSERT_TRUE(acks.multiple_up_to.has_value());
+  EXPECT_EQ(*acks.multiple_up_to, 3);
+
+  const auto empty = batcher.Flush();
+  EXPECT_FALSE(empty.multiple_up_to.has_value());
+  EXPECT_TRUE(empty.single.empty());
+}
+
+USERVER_NAMESPACE_END
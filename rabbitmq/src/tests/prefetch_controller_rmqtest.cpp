@@ -0,0 +1,63 @@
+#include <userver/utest/utest.hpp>
+
+#include <urabbitmq/prefetch_controller.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using PrefetchController = urabbitmq::PrefetchController;
+
+constexpr std::chrono::microseconds kLatency{1000};
+
+void Saturate(PrefetchController& controller,
+              std::chrono::microseconds latency) {
+  controller.AccountDelivered(controller.GetPrefetch());
+  controller.AccountProcessed(latency);
+}
+
+}  // namespace
+
+TEST(PrefetchController, StartsFromMin) {
+  const PrefetchController controller{2, 10};
+  EXPECT_EQ(controller.GetPrefetch(), 2);
+}
+
+TEST(PrefetchController, GrowsWhileSaturated) {
+  PrefetchController controller{1, 10};
+
+  for (int i = 0; i < 100; ++i) {
+    Saturate(controller, kLatency);
+    controller.Tune();
+  }
+  EXPECT_EQ(controller.GetPrefetch(), 10);
+}
+
+TEST(PrefetchController, KeepsPrefetchIfNotSaturated) {
+  PrefetchController controller{4, 10};
+
+  controller.AccountDelivered(1);
+  controller.AccountProcessed(kLatency);
+  EXPECT_FALSE(controller.Tune().has_value());
+
+  // no processed messages, nothing to judge by
+  controller.AccountDelivered(4);
+  EXPECT_FALSE(controller.Tune().has_value());
+  EXPECT_EQ(controller.GetPrefetch(), 4);
+}
+
+TEST(PrefetchController, ShrinksOnLatencyDegradation) {
+  PrefetchController controller{1, 100};
+  for (int i = 0; i < 100; ++i) {
+    Saturate(controller, kLatency);
+    controller.Tune();
+  }
+  ASSERT_EQ(controller.GetPrefetch(), 100);
+
+  Saturate(controller, kLatency * 10);
+  const auto prefetch = controller.Tune();
+  ASSERT_TRUE(prefetch.has_value());
+  EXPECT_EQ(*prefetch, 75);
+}
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/uuid4.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -133,6 +136,80 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, ConsumesReliableBatch) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  // more messages than the in-flight requests limit, so the window slides
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < 1000; ++i) {
+    messages.emplace_back(std::to_string(i));
+  }
+  client->PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               messages, urabbitmq::MessageType::kTransient,
+                               client.GetDeadline());
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages.size());
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  std::sort(consumed.begin(), consumed.end());
+  std::sort(messages.begin(), messages.end());
+  EXPECT_EQ(consumed, messages);
+}
+
+UTEST(Consumer, ConsumesBatch) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  const std::vector<std::string> messages{"first", "second", "third"};
+  {
+    auto channel = client->GetChannel(client.GetDeadline());
+    channel.PublishBatch(client.GetExchange(), client.GetRoutingKey(),
+                         messages, client.GetDeadline());
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages.size());
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  std::sort(consumed.begin(), consumed.end());
+  EXPECT_EQ(consumed, messages);
+}
+
+UTEST(Consumer, BatchedAcksWork) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  urabbitmq::ConsumerSettings settings{client.GetQueue(), 50};
+  settings.ack_batch_size = 16;
+  settings.ack_batch_interval = std::chrono::milliseconds{10};
+  settings.min_prefetch_count = 1;
+  settings.prefetch_tune_interval = std::chrono::milliseconds{10};
+
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < 1000; ++i) {
+    messages.emplace_back(std::to_string(i));
+  }
+  client->PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               messages, client.GetDeadline());
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages.size());
+  consumer.Start();
+  EXPECT_EQ(consumer.Wait().size(), messages.size());
+  consumer.Stop();
+
+  // everything is acked, so nothing is left for the next consumer
+  Consumer next_consumer{client.Get(), settings};
+  next_consumer.Start();
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+  EXPECT_TRUE(next_consumer.Get().empty());
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
@@ -217,4 +294,35 @@ UTEST(Consumer, ForDifferentQueuesWork) {
       .RemoveQueue(second_queue, client.GetDeadline());
 }
 
+UTEST_MT(Consumer, ConsumesFromPublishShards, 4) {
+  ClientWrapper client{3};
+  client.SetupRmqEntities();
+
+  // the exchange is fanout, so the routing keys only select the shards
+  const size_t keys_count = 8;
+  const size_t messages_per_key = 30;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (size_t key = 0; key < keys_count; ++key) {
+    tasks.push_back(utils::Async("publisher", [&client, key] {
+      const auto routing_key = std::to_string(key);
+      for (size_t i = 0; i < messages_per_key; i += 3) {
+        const auto message = routing_key + "_" + std::to_string(i);
+        client->Publish(client.GetExchange(), routing_key, message + "_0",
+                        client.GetDeadline());
+        client->PublishReliable(client.GetExchange(), routing_key,
+                                message + "_1", client.GetDeadline());
+        client->PublishBatch(client.GetExchange(), routing_key,
+                             {message + "_2"}, client.GetDeadline());
+      }
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+
+  Consumer consumer{client.Get(), {client.GetQueue(), 10}};
+  consumer.ExpectConsume(keys_count * messages_per_key);
+  consumer.Start();
+
+  EXPECT_EQ(consumer.Wait().size(), keys_count * messages_per_key);
+}
+
 USERVER_NAMESPACE_END
@@ -16,9 +16,9 @@ clients::dns::Resolver CreateResolver() {
 }
 
 std::shared_ptr<urabbitmq::Client> CreateClient(
-    clients::dns::Resolver& resolver) {
-  return urabbitmq::Client::Create(resolver,
-                                   urabbitmq::TestsHelper::CreateSettings());
+    clients::dns::Resolver& resolver, size_t publish_shards) {
+  return urabbitmq::Client::Create(
+      resolver, urabbitmq::TestsHelper::CreateSettings(publish_shards));
 }
 
 }  // namespace
@@ -30,9 +30,9 @@ uint16_t GetRabbitMqPort() {
                            : kDefaultRabbitMqPort;
 }
 
-ClientWrapper::ClientWrapper()
+ClientWrapper::ClientWrapper(size_t publish_shards)
     : resolver_{CreateResolver()},
-      client_{CreateClient(resolver_)},
+      client_{CreateClient(resolver_, publish_shards)},
       exchange_{utils::generators::GenerateUuid()},
       queue_{utils::generators::GenerateUuid()},
       routing_key_{utils::generators::GenerateUuid()},
@@ -79,7 +79,7 @@ void ClientWrapper::SetupRmqEntities() const {
 
 namespace urabbitmq {
 
-ClientSettings TestsHelper::CreateSettings() {
+ClientSettings TestsHelper::CreateSettings(size_t publish_shards) {
   urabbitmq::AuthSettings auth{};
 
   urabbitmq::EndpointInfo endpoint{};
@@ -97,6 +97,7 @@ ClientSettings TestsHelper::CreateSettings() {
   settings.pool_settings = pool_settings;
   settings.endpoints = std::move(endpoints);
   settings.use_secure_connection = false;
+  settings.publish_shards = publish_shards;
 
   return settings;
 }
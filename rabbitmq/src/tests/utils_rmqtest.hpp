@@ -11,7 +11,7 @@ uint16_t GetRabbitMqPort();
 
 class ClientWrapper final {
  public:
-  ClientWrapper();
+  explicit ClientWrapper(size_t publish_shards = 0);
   ~ClientWrapper();
 
   urabbitmq::Client& operator*() const;
@@ -46,7 +46,7 @@ namespace urabbitmq {
 
 class TestsHelper final {
  public:
-  static ClientSettings CreateSettings();
+  static ClientSettings CreateSettings(size_t publish_shards = 0);
 };
 
 }  // namespace urabbitmq
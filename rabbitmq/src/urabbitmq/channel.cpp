@@ -20,6 +20,14 @@ void Channel::Publish(const Exchange& exchange, const std::string& routing_key,
                             deadline);
 }
 
+void Channel::PublishBatch(const Exchange& exchange,
+                           const std::string& routing_key,
+                           const std::vector<std::string>& messages,
+                           MessageType type, engine::Deadline deadline) {
+  ConnectionHelper::PublishBatch(*impl_, exchange, routing_key, messages, type,
+                                 deadline);
+}
+
 ReliableChannel::ReliableChannel(ConnectionPtr&& channel)
     : impl_{std::move(channel)} {}
 
@@ -37,6 +45,14 @@ void ReliableChannel::PublishReliable(const Exchange& exchange,
       .Wait(deadline);
 }
 
+void ReliableChannel::PublishReliableBatch(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::vector<std::string>& messages, MessageType type,
+    engine::Deadline deadline) {
+  ConnectionHelper::PublishReliableBatch(*impl_, exchange, routing_key,
+                                         messages, type, deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
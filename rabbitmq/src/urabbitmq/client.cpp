@@ -63,6 +63,18 @@ void Client::RemoveQueue(const Queue& queue, engine::Deadline deadline) {
 void Client::Publish(const Exchange& exchange, const std::string& routing_key,
                      const std::string& message, MessageType type,
                      engine::Deadline deadline) {
+  if (impl_->HasPublishShards()) {
+    impl_->PublishToShard(
+        routing_key, deadline,
+        [&](const ConnectionPtr& connection)
+            -> std::optional<impl::ResponseAwaiter> {
+          ConnectionHelper::Publish(connection, exchange, routing_key, message,
+                                    type, deadline);
+          return std::nullopt;
+        });
+    return;
+  }
+
   ConnectionHelper::Publish(impl_->GetConnection(deadline), exchange,
                             routing_key, message, type, deadline);
 }
@@ -71,12 +83,66 @@ void Client::PublishReliable(const Exchange& exchange,
                              const std::string& routing_key,
                              const std::string& message, MessageType type,
                              engine::Deadline deadline) {
+  if (impl_->HasPublishShards()) {
+    impl_->PublishToShard(
+        routing_key, deadline,
+        [&](const ConnectionPtr& connection)
+            -> std::optional<impl::ResponseAwaiter> {
+          return ConnectionHelper::PublishReliable(
+              connection, exchange, routing_key, message, type, deadline);
+        });
+    return;
+  }
+
   auto awaiter = ConnectionHelper::PublishReliable(
       impl_->GetConnection(deadline), exchange, routing_key, message, type,
       deadline);
   awaiter.Wait(deadline);
 }
 
+void Client::PublishBatch(const Exchange& exchange,
+                          const std::string& routing_key,
+                          const std::vector<std::string>& messages,
+                          MessageType type, engine::Deadline deadline) {
+  if (impl_->HasPublishShards()) {
+    impl_->PublishToShard(
+        routing_key, deadline,
+        [&](const ConnectionPtr& connection)
+            -> std::optional<impl::ResponseAwaiter> {
+          ConnectionHelper::PublishBatch(connection, exchange, routing_key,
+                                         messages, type, deadline);
+          return std::nullopt;
+        });
+    return;
+  }
+
+  ConnectionHelper::PublishBatch(impl_->GetConnection(deadline), exchange,
+                                 routing_key, messages, type, deadline);
+}
+
+void Client::PublishReliableBatch(const Exchange& exchange,
+                                  const std::string& routing_key,
+                                  const std::vector<std::string>& messages,
+                                  MessageType type, engine::Deadline deadline) {
+  if (impl_->HasPublishShards()) {
+    // the confirms are awaited with the shard locked, as the messages of the
+    // next batch of the shard may be published only after these ones
+    impl_->PublishToShard(
+        routing_key, deadline,
+        [&](const ConnectionPtr& connection)
+            -> std::optional<impl::ResponseAwaiter> {
+          ConnectionHelper::PublishReliableBatch(
+              connection, exchange, routing_key, messages, type, deadline);
+          return std::nullopt;
+        });
+    return;
+  }
+
+  ConnectionHelper::PublishReliableBatch(impl_->GetConnection(deadline),
+                                         exchange, routing_key, messages, type,
+                                         deadline);
+}
+
 AdminChannel Client::GetAdminChannel(engine::Deadline deadline) {
   return {impl_->GetConnection(deadline)};
 }
@@ -1,10 +1,16 @@
 #include "client_impl.hpp"
 
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
 #include <userver/engine/async.hpp>
 #include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <userver/urabbitmq/client_settings.hpp>
 
+#include <urabbitmq/connection.hpp>
 #include <urabbitmq/connection_pool.hpp>
 #include <urabbitmq/connection_ptr.hpp>
 
@@ -29,12 +35,70 @@ ClientImpl::ClientImpl(clients::dns::Resolver& resolver,
     }));
   }
   engine::WaitAllChecked(init_tasks);
+
+  // the connections of the shards are established on the first publishes
+  publish_shards_.reserve(settings_.publish_shards);
+  for (size_t i = 0; i < settings_.publish_shards; ++i) {
+    publish_shards_.push_back(std::make_unique<PublishShard>());
+  }
 }
 
+ClientImpl::~ClientImpl() = default;
+
 void ClientImpl::WriteStatistics(utils::statistics::Writer& writer) const {
   for (size_t i = 0; i < settings_.endpoints.endpoints.size(); ++i) {
     writer[settings_.endpoints.endpoints[i].host] = pools_[i].stats.Get();
   }
+  for (size_t i = 0; i < publish_shards_.size(); ++i) {
+    writer["publish_shards"].ValueWithLabels(
+        publish_shards_[i]->stats.Get(),
+        {"rabbitmq_publish_shard", std::to_string(i)});
+  }
+}
+
+bool ClientImpl::HasPublishShards() const { return !publish_shards_.empty(); }
+
+void ClientImpl::PublishToShard(const std::string& routing_key,
+                                engine::Deadline deadline,
+                                const ShardPublishFunc& publish) {
+  UASSERT(HasPublishShards());
+  auto& shard = *publish_shards_[std::hash<std::string>{}(routing_key) %
+                                 publish_shards_.size()];
+
+  // outlives the awaiter of the confirms
+  std::shared_ptr<ConnectionPtr> connection;
+  try {
+    if (!shard.mutex.try_lock_until(deadline)) {
+      throw std::runtime_error{"Timed out waiting for the publish shard"};
+    }
+    std::unique_lock lock{shard.mutex, std::adopt_lock};
+
+    if (!shard.connection || !shard.connection->IsUsable()) {
+      if (shard.connection) shard.stats.AccountReconnect();
+      shard.connection.reset();
+
+      auto new_connection = GetConnection(deadline);
+      new_connection.Adopt();
+      shard.connection =
+          std::make_shared<ConnectionPtr>(std::move(new_connection));
+    }
+    connection = shard.connection;
+
+    if ((*connection)->IsBlocked()) {
+      // the publish would wait for the deadline in the socket write anyway
+      shard.stats.AccountPublishBlocked();
+      throw std::runtime_error{"Connection is blocked by the broker"};
+    }
+
+    const auto awaiter = publish(*connection);
+    lock.unlock();
+
+    if (awaiter) awaiter->Wait(deadline);
+  } catch (const std::exception&) {
+    shard.stats.AccountPublishFailed();
+    throw;
+  }
+  shard.stats.AccountPublished();
 }
 
 ConnectionPtr ClientImpl::GetConnection(engine::Deadline deadline) {
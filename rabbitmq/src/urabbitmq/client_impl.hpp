@@ -1,15 +1,21 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <userver/urabbitmq/client_settings.hpp>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
 
+#include <urabbitmq/impl/response_awaiter.hpp>
 #include <urabbitmq/statistics/connection_statistics.hpp>
+#include <urabbitmq/statistics/publish_shard_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,11 +28,33 @@ class ClientImpl final {
  public:
   ClientImpl(clients::dns::Resolver& resolver, const ClientSettings& settings);
 
+  ~ClientImpl();
+
   ConnectionPtr GetConnection(engine::Deadline deadline);
 
+  bool HasPublishShards() const;
+
+  // Returns the awaiter of the confirms for the reliable publishes
+  using ShardPublishFunc = std::function<std::optional<impl::ResponseAwaiter>(
+      const ConnectionPtr& connection)>;
+
+  // Runs `publish` on the connection of the shard of the routing key while
+  // no other publish of the shard is sent. The returned awaiter is waited
+  // for with the shard unlocked.
+  void PublishToShard(const std::string& routing_key, engine::Deadline deadline,
+                      const ShardPublishFunc& publish);
+
   void WriteStatistics(utils::statistics::Writer& writer) const;
 
  private:
+  struct PublishShard final {
+    engine::Mutex mutex;
+    // shared with the publishes awaiting confirms, so that a reconnect doesn't
+    // destroy the connection under them
+    std::shared_ptr<ConnectionPtr> connection;
+    statistics::PublishShardStatistics stats;
+  };
+
   const ClientSettings settings_;
 
   struct PoolHolder final {
@@ -35,6 +63,9 @@ class ClientImpl final {
   };
   std::vector<PoolHolder> pools_;
   std::atomic<size_t> pool_idx_{0};
+
+  // the connections of the shards account their statistics into pools_
+  std::vector<std::unique_ptr<PublishShard>> publish_shards_;
 };
 
 }  // namespace urabbitmq
@@ -84,7 +84,8 @@ ClientSettings::ClientSettings(const components::ComponentConfig& config,
                                const RabbitEndpoints& rabbit_endpoints)
     : pool_settings{config.As<PoolSettings>()},
       endpoints{rabbit_endpoints},
-      use_secure_connection{config["use_secure_connection"].As<bool>(true)} {}
+      use_secure_connection{config["use_secure_connection"].As<bool>(true)},
+      publish_shards{config["publish_shards"].As<size_t>(0)} {}
 
 RabbitEndpointsMulti::RabbitEndpointsMulti(const formats::json::Value& doc) {
   const auto rabbitmq_settings = doc["rabbitmq_settings"];
@@ -76,6 +76,11 @@ properties:
         type: boolean
         description: whether to use TLS for connections
         defaultDescription: true
+    publish_shards:
+        type: integer
+        description: |
+          dedicated publish connections, selected by the routing key hash
+        defaultDescription: 0
 )");
 }
 
@@ -25,6 +25,8 @@ impl::AmqpReliableChannel& Connection::GetReliableChannel() {
 
 bool Connection::IsBroken() const { return handler_.IsBroken(); }
 
+bool Connection::IsBlocked() const { return handler_.IsBlocked(); }
+
 void Connection::EnsureUsable() const {
   if (IsBroken()) {
     throw std::runtime_error{"Connection is broken"};
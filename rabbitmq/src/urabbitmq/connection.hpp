@@ -35,6 +35,8 @@ class Connection final {
 
   bool IsBroken() const;
 
+  bool IsBlocked() const;
+
   void EnsureUsable() const;
 
  private:
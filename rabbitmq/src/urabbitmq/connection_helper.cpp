@@ -71,6 +71,26 @@ impl::ResponseAwaiter ConnectionHelper::PublishReliable(
   });
 }
 
+void ConnectionHelper::PublishBatch(const ConnectionPtr& connection,
+                                    const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const std::vector<std::string>& messages,
+                                    MessageType type,
+                                    engine::Deadline deadline) {
+  tracing::Span span{"publish_batch"};
+  connection->GetChannel().PublishBatch(exchange, routing_key, messages, type,
+                                        deadline);
+}
+
+void ConnectionHelper::PublishReliableBatch(
+    const ConnectionPtr& connection, const Exchange& exchange,
+    const std::string& routing_key, const std::vector<std::string>& messages,
+    MessageType type, engine::Deadline deadline) {
+  tracing::Span span{"reliable_publish_batch"};
+  connection->GetReliableChannel().PublishBatch(exchange, routing_key,
+                                                messages, type, deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 #include <userver/utils/flags.hpp>
@@ -52,6 +55,19 @@ class ConnectionHelper final {
       const std::string& routing_key, const std::string& message,
       MessageType type, engine::Deadline deadline);
 
+  static void PublishBatch(const ConnectionPtr& connection,
+                           const Exchange& exchange,
+                           const std::string& routing_key,
+                           const std::vector<std::string>& messages,
+                           MessageType type, engine::Deadline deadline);
+
+  // Unlike PublishReliable this waits for all the confirms
+  static void PublishReliableBatch(const ConnectionPtr& connection,
+                                   const Exchange& exchange,
+                                   const std::string& routing_key,
+                                   const std::vector<std::string>& messages,
+                                   MessageType type, engine::Deadline deadline);
+
  private:
   template <typename Func>
   static impl::ResponseAwaiter WithSpan(const char* name, Func&& fn) {
@@ -0,0 +1,79 @@
+#include "consumer_ack_batcher.hpp"
+
+#include <userver/utils/assert.hpp>
+
+#include <urabbitmq/statistics/connection_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+AckBatcher::AckBatcher(std::size_t batch_size,
+                       statistics::ConnectionStatistics& stats)
+    : batch_size_{batch_size}, stats_{stats} {
+  UASSERT(batch_size_ > 0);
+}
+
+void AckBatcher::OnDelivered(uint64_t delivery_tag) {
+  UASSERT(deliveries_.empty() || deliveries_.rbegin()->first < delivery_tag);
+  deliveries_.emplace_hint(deliveries_.end(), delivery_tag,
+                           Delivery{Clock::now()});
+}
+
+AckBatcher::Acks AckBatcher::OnProcessed(uint64_t delivery_tag) {
+  const auto it = deliveries_.find(delivery_tag);
+  UASSERT(it != deliveries_.end() && !it->second.processed);
+  if (it == deliveries_.end() || it->second.processed) return {};
+
+  it->second.processed = true;
+  if (++processed_count_ < batch_size_) return {};
+
+  return {PopProcessedPrefix(), {}};
+}
+
+void AckBatcher::OnRejected(uint64_t delivery_tag) {
+  deliveries_.erase(delivery_tag);
+}
+
+AckBatcher::Acks AckBatcher::Flush() {
+  Acks acks{PopProcessedPrefix(), {}};
+
+  const auto now = Clock::now();
+  for (auto it = deliveries_.begin(); it != deliveries_.end();) {
+    if (it->second.processed) {
+      AccountAcked(it->second, now);
+      acks.single.push_back(it->first);
+      it = deliveries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  processed_count_ = 0;
+
+  return acks;
+}
+
+std::optional<uint64_t> AckBatcher::PopProcessedPrefix() {
+  std::optional<uint64_t> last_processed;
+
+  const auto now = Clock::now();
+  while (!deliveries_.empty() && deliveries_.begin()->second.processed) {
+    const auto it = deliveries_.begin();
+    AccountAcked(it->second, now);
+    last_processed.emplace(it->first);
+    deliveries_.erase(it);
+    --processed_count_;
+  }
+
+  return last_processed;
+}
+
+void AckBatcher::AccountAcked(const Delivery& delivery, Clock::time_point now) {
+  stats_.AccountMessageAcked(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          now - delivery.delivered_at));
+}
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
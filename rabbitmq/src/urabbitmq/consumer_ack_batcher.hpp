@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+namespace statistics {
+class ConnectionStatistics;
+}
+
+// Tracks delivery tags of a consumer so that processed messages can be
+// acknowledged with multiple-acks. Not thread-safe.
+//
+// A multiple-ack acknowledges every outstanding delivery up to the tag, so
+// only a contiguous range of processed deliveries can be acknowledged this
+// way: a message that takes long to process holds back the acks of the
+// messages delivered after it until the next Flush.
+class AckBatcher final {
+ public:
+  struct Acks final {
+    // Acknowledge everything up to and including this tag with a single ack
+    std::optional<uint64_t> multiple_up_to;
+    // Acknowledge these one by one
+    std::vector<uint64_t> single;
+  };
+
+  AckBatcher(std::size_t batch_size, statistics::ConnectionStatistics& stats);
+
+  // Must be called in delivery order
+  void OnDelivered(uint64_t delivery_tag);
+
+  // Returns acks to send if the batch is full
+  Acks OnProcessed(uint64_t delivery_tag);
+
+  // Rejected message must be rejected before any acks are sent,
+  // otherwise it could be acknowledged by a multiple-ack
+  void OnRejected(uint64_t delivery_tag);
+
+  // Returns acks for everything processed so far
+  Acks Flush();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Delivery final {
+    Clock::time_point delivered_at;
+    bool processed{false};
+  };
+
+  std::optional<uint64_t> PopProcessedPrefix();
+  void AccountAcked(const Delivery& delivery, Clock::time_point now);
+
+  const std::size_t batch_size_;
+  statistics::ConnectionStatistics& stats_;
+
+  std::map<uint64_t, Delivery> deliveries_;
+  std::size_t processed_count_{0};
+};
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
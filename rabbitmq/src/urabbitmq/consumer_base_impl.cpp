@@ -1,5 +1,6 @@
 #include "consumer_base_impl.hpp"
 
+#include <mutex>
 #include <string>
 
 #include <fmt/format.h>
@@ -8,11 +9,13 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/impl/amqp_channel.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
+#include <urabbitmq/statistics/connection_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -28,12 +31,23 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
                                    const ConsumerSettings& settings)
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
+      ack_batch_interval_{settings.ack_batch_interval},
+      prefetch_tune_interval_{settings.prefetch_tune_interval},
       prefetch_count_{settings.prefetch_count},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
   // We take ownership of the connection, because if it remains pooled
   // things get messy with lifetimes and callbacks
   connection_ptr_.Adopt();
+
+  if (settings.ack_batch_size > 1) {
+    ack_batcher_.emplace(settings.ack_batch_size, channel_.GetStatistics());
+  }
+  if (settings.min_prefetch_count != 0) {
+    prefetch_controller_.emplace(settings.min_prefetch_count,
+                                 settings.prefetch_count);
+    prefetch_count_ = prefetch_controller_->GetPrefetch();
+  }
 }
 
 ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
@@ -46,6 +60,22 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
 
   LOG_INFO() << "Starting a consumer for '" << queue_name_ << "' queue";
 
+  SetupConsumer(start_deadline);
+
+  if (ack_batcher_.has_value()) {
+    ack_flusher_.Start(fmt::format("{}_consumer_ack_flusher", queue_name_),
+                       {ack_batch_interval_}, [this] { FlushAcks(); });
+  }
+  if (prefetch_controller_.has_value()) {
+    prefetch_tuner_.Start(
+        fmt::format("{}_consumer_prefetch_tuner", queue_name_),
+        {prefetch_tune_interval_}, [this] { TunePrefetch(); });
+  }
+
+  LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
+}
+
+void ConsumerBaseImpl::SetupConsumer(engine::Deadline deadline) {
   channel_.SetupConsumer(
       queue_name_,
       // error callback
@@ -57,20 +87,21 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
         }
       },
       // message callback
-      [this](const AMQP::Message& message, uint64_t delivery_tag, bool) {
+      [this](const AMQP::Message& message, uint64_t delivery_tag,
+             bool redelivered) {
         // We received a message but won't ack it, so it will be requeued
         // at some point
         if (!stopped_) {
-          OnMessage(message, delivery_tag);
+          OnMessage(message, delivery_tag, redelivered);
         }
       },
-      start_deadline);
-
-  LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
+      deadline);
 }
 
 void ConsumerBaseImpl::Stop() {
   stopped_ = true;
+  prefetch_tuner_.Stop();
+  ack_flusher_.Stop();
   try {
     channel_.CancelConsumer(consumer_tag_);
   } catch (const std::exception&) {
@@ -80,6 +111,11 @@ void ConsumerBaseImpl::Stop() {
   // Cancel all the active dispatched tasks
   bts_->CancelAndWait();
 
+  // Best effort, whatever is left unacked would be redelivered
+  if (ack_batcher_.has_value()) {
+    FlushAcks();
+  }
+
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
   // didn't receive onSuccess callback yet.
@@ -93,18 +129,31 @@ bool ConsumerBaseImpl::IsBroken() const {
 }
 
 void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
-                                 uint64_t delivery_tag) {
+                                 uint64_t delivery_tag, bool redelivered) {
   std::string span_name{fmt::format("consume_{}_{}", queue_name_,
                                     consumer_tag_.value_or("ctag:unknown"))};
   std::string trace_id = message.headers().get("u-trace-id");
   std::string message_data{message.body(), message.bodySize()};
 
+  const auto delivered_at = Clock::now();
+  channel_.GetStatistics().AccountMessageDelivered(redelivered);
+  const auto in_flight = ++in_flight_;
+  if (prefetch_controller_.has_value()) {
+    prefetch_controller_->AccountDelivered(in_flight);
+  }
+  if (ack_batcher_.has_value()) {
+    std::lock_guard lock{batcher_mutex_};
+    ack_batcher_->OnDelivered(delivery_tag);
+  }
+
   bts_->Detach(engine::AsyncNoSpan(
-      dispatcher_, [this, message = std::move(message_data),
-                    span_name = std::move(span_name),
-                    trace_id = std::move(trace_id), delivery_tag]() mutable {
+      dispatcher_,
+      [this, message = std::move(message_data),
+       span_name = std::move(span_name), trace_id = std::move(trace_id),
+       delivery_tag, delivered_at]() mutable {
         auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id, {});
 
+        const auto processing_start = Clock::now();
         bool success = false;
         try {
           dispatch_callback_(std::move(message));
@@ -114,12 +163,20 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
                       << "; would requeue";
         }
 
+        --in_flight_;
+        channel_.GetStatistics().AccountMessageProcessed();
+        if (prefetch_controller_.has_value()) {
+          prefetch_controller_->AccountProcessed(
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  Clock::now() - processing_start));
+        }
+
         try {
           if (success) {
-            channel_.Ack(delivery_tag, {});
+            Ack(delivery_tag, delivered_at);
             channel_.AccountMessageConsumed();
           } else {
-            channel_.Reject(delivery_tag, true, {});
+            Reject(delivery_tag);
           }
         } catch (const std::exception& ex) {
           LOG_WARNING()
@@ -129,6 +186,88 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::Ack(uint64_t delivery_tag,
+                           Clock::time_point delivered_at) {
+  if (!ack_batcher_.has_value()) {
+    channel_.Ack(delivery_tag, {});
+    channel_.GetStatistics().AccountMessageAcked(
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() -
+                                                              delivered_at));
+    return;
+  }
+
+  std::lock_guard send_lock{acks_send_mutex_};
+  const auto acks = [this, delivery_tag] {
+    std::lock_guard lock{batcher_mutex_};
+    return ack_batcher_->OnProcessed(delivery_tag);
+  }();
+  SendAcks(acks);
+}
+
+void ConsumerBaseImpl::Reject(uint64_t delivery_tag) {
+  if (!ack_batcher_.has_value()) {
+    channel_.Reject(delivery_tag, true, {});
+    return;
+  }
+
+  // The reject has to reach the broker before any multiple-ack covering it
+  std::lock_guard send_lock{acks_send_mutex_};
+  {
+    std::lock_guard lock{batcher_mutex_};
+    ack_batcher_->OnRejected(delivery_tag);
+  }
+  channel_.Reject(delivery_tag, true, {});
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  UASSERT(ack_batcher_.has_value());
+
+  std::lock_guard send_lock{acks_send_mutex_};
+  const auto acks = [this] {
+    std::lock_guard lock{batcher_mutex_};
+    return ack_batcher_->Flush();
+  }();
+
+  try {
+    SendAcks(acks);
+  } catch (const std::exception&) {
+    LOG_WARNING() << "Failed to ack the processed messages, they will be "
+                     "requeued by RabbitMQ at some point";
+  }
+}
+
+void ConsumerBaseImpl::SendAcks(const AckBatcher::Acks& acks) {
+  if (acks.multiple_up_to.has_value()) {
+    channel_.AckMultiple(*acks.multiple_up_to, {});
+  }
+  for (const auto delivery_tag : acks.single) {
+    channel_.Ack(delivery_tag, {});
+  }
+}
+
+void ConsumerBaseImpl::TunePrefetch() {
+  UASSERT(prefetch_controller_.has_value());
+
+  const auto prefetch = prefetch_controller_->Tune();
+  if (!prefetch.has_value() || stopped_) return;
+
+  LOG_INFO() << "Changing prefetch of the consumer for '" << queue_name_
+             << "' queue from " << prefetch_count_ << " to " << *prefetch;
+  try {
+    const auto deadline = engine::Deadline::FromDuration(kStartTimeout);
+    channel_.SetQos(*prefetch, deadline);
+    // Per-consumer prefetch only applies to the consumers created after
+    // basic.qos, so we resubscribe. Unacked deliveries stay with the channel
+    // and delivery tags keep growing, so the acks are unaffected.
+    channel_.CancelConsumer(consumer_tag_);
+    SetupConsumer(deadline);
+    prefetch_count_ = *prefetch;
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to change prefetch of the consumer: " << ex;
+    broken_.store(true, std::memory_order_relaxed);
+  }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,11 +1,17 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <optional>
 
 #include <userver/concurrent/background_task_storage_fwd.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
+#include <urabbitmq/consumer_ack_batcher.hpp>
+#include <urabbitmq/prefetch_controller.hpp>
 
 #include <userver/urabbitmq/consumer_settings.hpp>
 
@@ -32,11 +38,24 @@ class ConsumerBaseImpl final {
   bool IsBroken() const;
 
  private:
-  void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  using Clock = std::chrono::steady_clock;
+
+  void SetupConsumer(engine::Deadline deadline);
+  void OnMessage(const AMQP::Message& message, uint64_t delivery_tag,
+                 bool redelivered);
   void Stop();
 
+  void Ack(uint64_t delivery_tag, Clock::time_point delivered_at);
+  void Reject(uint64_t delivery_tag);
+  void FlushAcks();
+  void SendAcks(const AckBatcher::Acks& acks);
+
+  void TunePrefetch();
+
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
+  const std::chrono::milliseconds ack_batch_interval_;
+  const std::chrono::milliseconds prefetch_tune_interval_;
   uint16_t prefetch_count_;
 
   ConnectionPtr connection_ptr_;
@@ -52,6 +71,20 @@ class ConsumerBaseImpl final {
   // (consumer_base polls this and destructs+constructs us if we broke)
   std::atomic<bool> broken_{false};
 
+  std::atomic<std::size_t> in_flight_{0};
+
+  // Acks decisions are made and sent under acks_send_mutex_, so that they
+  // reach the broker in order. batcher_mutex_ is never held while waiting
+  // for the connection, because the deliveries are tracked from within
+  // the connection reader.
+  engine::Mutex acks_send_mutex_;
+  engine::Mutex batcher_mutex_;
+  std::optional<AckBatcher> ack_batcher_;
+  utils::PeriodicTask ack_flusher_;
+
+  std::optional<PrefetchController> prefetch_controller_;
+  utils::PeriodicTask prefetch_tuner_;
+
   // This should be the last member
   concurrent::BackgroundTaskStorageFastPimpl bts_;
 };
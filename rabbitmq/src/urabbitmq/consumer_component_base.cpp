@@ -17,7 +17,21 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config,
   settings.queue = Queue{config["queue"].As<std::string>()};
   settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
 
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<uint16_t>(settings.ack_batch_size);
+  settings.ack_batch_interval =
+      config["ack_batch_interval"].As<std::chrono::milliseconds>(
+          settings.ack_batch_interval);
+  settings.min_prefetch_count =
+      config["min_prefetch_count"].As<uint16_t>(settings.min_prefetch_count);
+  settings.prefetch_tune_interval =
+      config["prefetch_tune_interval"].As<std::chrono::milliseconds>(
+          settings.prefetch_tune_interval);
+
   UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+  UINVARIANT(settings.ack_batch_size > 0, "ack_batch_size is set to zero");
+  UINVARIANT(settings.min_prefetch_count <= settings.prefetch_count,
+             "min_prefetch_count is greater than prefetch_count");
 
   return settings;
 }
@@ -76,6 +90,22 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    ack_batch_size:
+        type: integer
+        description: number of processed messages to ack with a single multiple-ack
+        defaultDescription: 1
+    ack_batch_interval:
+        type: string
+        description: max time a processed message stays unacked if batching is enabled
+        defaultDescription: 100ms
+    min_prefetch_count:
+        type: integer
+        description: if non-zero, prefetch adapts within [min_prefetch_count, prefetch_count]
+        defaultDescription: 0
+    prefetch_tune_interval:
+        type: string
+        description: how often the adaptive prefetch is reconsidered
+        defaultDescription: 1s
 )");
 }
 
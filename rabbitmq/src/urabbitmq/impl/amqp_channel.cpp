@@ -1,9 +1,12 @@
 #include "amqp_channel.hpp"
 
+#include <deque>
+#include <exception>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 #include <urabbitmq/impl/amqp_connection.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
@@ -70,6 +73,15 @@ AMQP::Table CreateHeaders() {
   return headers;
 }
 
+AMQP::Envelope CreateEnvelope(const std::string& message, MessageType type,
+                              const AMQP::Table& headers) {
+  AMQP::Envelope envelope{message.data(), message.size()};
+  envelope.setPersistent(type == MessageType::kPersistent);
+  envelope.setHeaders(headers);
+
+  return envelope;
+}
+
 }  // namespace
 
 AmqpChannel::AmqpChannel(AmqpConnection& conn) : conn_{conn} {}
@@ -148,9 +160,7 @@ void AmqpChannel::Publish(const Exchange& exchange,
                           const std::string& routing_key,
                           const std::string& message, MessageType type,
                           engine::Deadline deadline) {
-  AMQP::Envelope envelope{message.data(), message.size()};
-  envelope.setPersistent(type == MessageType::kPersistent);
-  envelope.setHeaders(CreateHeaders());
+  const auto envelope = CreateEnvelope(message, type, CreateHeaders());
 
   {
     auto channel = conn_.GetChannel(deadline);
@@ -164,12 +174,36 @@ void AmqpChannel::Publish(const Exchange& exchange,
   // We don't account publish here, because there's no way to ensure success
 }
 
+void AmqpChannel::PublishBatch(const Exchange& exchange,
+                               const std::string& routing_key,
+                               const std::vector<std::string>& messages,
+                               MessageType type, engine::Deadline deadline) {
+  const auto headers = CreateHeaders();
+
+  auto channel = conn_.GetChannel(deadline);
+  conn_.StartWriteBatch();
+  const utils::ScopeGuard write_guard{[this] { conn_.FinishWriteBatch(); }};
+
+  for (const auto& message : messages) {
+    // Same as in Publish, synchronous failures are ignored
+    channel->publish(exchange.GetUnderlying(), routing_key,
+                     CreateEnvelope(message, type, headers));
+  }
+}
+
 void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
   // No way to acknowledge success, no way to handle synchronous errors
   auto channel = conn_.GetChannel(deadline);
   channel->ack(delivery_tag);
 }
 
+void AmqpChannel::AckMultiple(uint64_t delivery_tag,
+                              engine::Deadline deadline) {
+  // No way to acknowledge success, no way to handle synchronous errors
+  auto channel = conn_.GetChannel(deadline);
+  channel->ack(delivery_tag, AMQP::multiple);
+}
+
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
                          engine::Deadline deadline) {
   // No way to acknowledge success, no way to handle synchronous errors
@@ -213,6 +247,10 @@ void AmqpChannel::AccountMessageConsumed() {
   conn_.GetStatistics().AccountMessageConsumed();
 }
 
+statistics::ConnectionStatistics& AmqpChannel::GetStatistics() {
+  return conn_.GetStatistics();
+}
+
 AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn) : conn_{conn} {}
 
 AmqpReliableChannel::~AmqpReliableChannel() = default;
@@ -222,28 +260,106 @@ ResponseAwaiter AmqpReliableChannel::Publish(const Exchange& exchange,
                                              const std::string& message,
                                              MessageType type,
                                              engine::Deadline deadline) {
-  AMQP::Envelope envelope{message.data(), message.size()};
-  envelope.setPersistent(type == MessageType::kPersistent);
-  envelope.setHeaders(CreateHeaders());
+  const auto envelope = CreateEnvelope(message, type, CreateHeaders());
 
   auto awaiter = conn_.GetAwaiter(deadline);
 
   {
     auto reliable = conn_.GetReliableChannel(deadline);
-
-    reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
-        .onAck([this, deferred = awaiter.GetWrapper()] {
-          AccountMessagePublished();
-          deferred->Ok();
-        })
-        .onError([deferred = awaiter.GetWrapper()](const char* error) {
-          deferred->Fail(error);
-        });
+    DoPublish(*reliable, exchange, routing_key, envelope, awaiter);
   }
 
   return awaiter;
 }
 
+void AmqpReliableChannel::PublishBatch(const Exchange& exchange,
+                                       const std::string& routing_key,
+                                       const std::vector<std::string>& messages,
+                                       MessageType type,
+                                       engine::Deadline deadline) {
+  const auto headers = CreateHeaders();
+
+  // The window of unconfirmed publishes is bounded by the in-flight requests
+  // limit of the connection: we grab as many slots as there are available,
+  // send the whole window in one write and only wait for the oldest confirm
+  // when there are no slots left. The broker may confirm several messages
+  // with a single multiple-ack, AMQP::Reliable resolves all of them at once.
+  std::deque<ResponseAwaiter> unconfirmed;
+  std::exception_ptr error;
+
+  const auto wait_oldest = [&unconfirmed, &error, deadline] {
+    try {
+      unconfirmed.front().Wait(deadline);
+    } catch (const std::exception&) {
+      if (!error) error = std::current_exception();
+    }
+    unconfirmed.pop_front();
+  };
+
+  std::size_t published = 0;
+  while (published < messages.size() && !error) {
+    std::vector<ResponseAwaiter> window;
+    while (published + window.size() < messages.size()) {
+      auto awaiter = conn_.TryGetAwaiter();
+      if (!awaiter.has_value()) break;
+      window.push_back(std::move(*awaiter));
+    }
+
+    if (window.empty()) {
+      if (!unconfirmed.empty()) {
+        wait_oldest();
+        continue;
+      }
+      window.push_back(conn_.GetAwaiter(deadline));
+    }
+
+    std::size_t window_published = 0;
+    try {
+      auto reliable = conn_.GetReliableChannel(deadline);
+      conn_.StartWriteBatch();
+      const utils::ScopeGuard write_guard{[this] { conn_.FinishWriteBatch(); }};
+
+      for (; window_published < window.size(); ++window_published) {
+        const auto envelope =
+            CreateEnvelope(messages[published++], type, headers);
+        DoPublish(*reliable, exchange, routing_key, envelope,
+                  window[window_published]);
+      }
+    } catch (const std::exception& ex) {
+      error = std::current_exception();
+      // these were never sent, so no confirms are coming for them
+      for (auto i = window_published; i < window.size(); ++i) {
+        window[i].GetWrapper()->Fail(ex.what());
+      }
+    }
+
+    for (auto& awaiter : window) {
+      unconfirmed.push_back(std::move(awaiter));
+    }
+  }
+
+  while (!unconfirmed.empty()) {
+    wait_oldest();
+  }
+
+  if (error) std::rethrow_exception(error);
+}
+
+void AmqpReliableChannel::DoPublish(AMQP::Reliable<AMQP::Tagger>& reliable,
+                                    const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const AMQP::Envelope& envelope,
+                                    const ResponseAwaiter& awaiter) {
+  reliable.publish(exchange.GetUnderlying(), routing_key, envelope)
+      .onAck([this, deferred = awaiter.GetWrapper()] {
+        AccountMessagePublished();
+        deferred->Ok();
+      })
+      .onError([deferred = awaiter.GetWrapper()](const char* error) {
+        deferred->Fail(error);
+      });
+}
+
 void AmqpReliableChannel::AccountMessagePublished() {
   conn_.GetStatistics().AccountMessagePublished();
 }
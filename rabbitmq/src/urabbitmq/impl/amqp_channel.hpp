@@ -2,6 +2,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -54,8 +56,15 @@ class AmqpChannel final {
                const std::string& message, MessageType type,
                engine::Deadline deadline);
 
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages, MessageType type,
+                    engine::Deadline deadline);
+
   void Ack(uint64_t delivery_tag, engine::Deadline deadline);
 
+  // Acknowledges all the outstanding deliveries up to the delivery_tag
+  void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
   void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
@@ -71,6 +80,7 @@ class AmqpChannel final {
 
  private:
   void AccountMessageConsumed();
+  statistics::ConnectionStatistics& GetStatistics();
 
   friend class urabbitmq::ConsumerBaseImpl;
 
@@ -87,7 +97,17 @@ class AmqpReliableChannel final {
                           const std::string& message, MessageType type,
                           engine::Deadline deadline);
 
+  // Pipelines the publishes and waits for all of them to be confirmed
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages, MessageType type,
+                    engine::Deadline deadline);
+
  private:
+  void DoPublish(AMQP::Reliable<AMQP::Tagger>& reliable,
+                 const Exchange& exchange, const std::string& routing_key,
+                 const AMQP::Envelope& envelope,
+                 const ResponseAwaiter& awaiter);
+
   void AccountMessagePublished();
 
   AmqpConnection& conn_;
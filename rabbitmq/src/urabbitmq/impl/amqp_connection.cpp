@@ -94,6 +94,19 @@ ResponseAwaiter AmqpConnection::GetAwaiter(engine::Deadline deadline) {
   return ResponseAwaiter{std::move(lock)};
 }
 
+std::optional<ResponseAwaiter> AmqpConnection::TryGetAwaiter() {
+  engine::SemaphoreLock lock{waiters_sema_, std::try_to_lock};
+  if (!lock.OwnsLock()) {
+    return std::nullopt;
+  }
+
+  return ResponseAwaiter{std::move(lock)};
+}
+
+void AmqpConnection::StartWriteBatch() { handler_.StartWriteBatch(); }
+
+void AmqpConnection::FinishWriteBatch() { handler_.FinishWriteBatch(&conn_); }
+
 ConnectionLock AmqpConnection::Lock(engine::Deadline deadline) {
   return {mutex_, deadline};
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/semaphore.hpp>
@@ -41,6 +43,7 @@ class LockedChannelProxy final {
   LockedChannelProxy(LockedChannelProxy&& other) = delete;
 
   Channel* operator->() { return &channel_; }
+  Channel& operator*() { return channel_; }
 
  private:
   Channel& channel_;
@@ -67,6 +70,14 @@ class AmqpConnection final {
 
   ResponseAwaiter GetAwaiter(engine::Deadline deadline);
 
+  // Returns std::nullopt if the in-flight requests limit is already reached
+  std::optional<ResponseAwaiter> TryGetAwaiter();
+
+  // Frames sent between these calls are written to the socket in one go,
+  // both must be called with a channel acquired
+  void StartWriteBatch();
+  void FinishWriteBatch();
+
  private:
   friend class AmqpConnectionLocker;
   [[nodiscard]] ConnectionLock Lock(engine::Deadline deadline);
@@ -19,6 +19,8 @@ namespace urabbitmq::impl {
 
 namespace {
 
+constexpr size_t kMaxWriteBatchSize = 1024 * 1024;
+
 engine::io::Socket CreateSocket(engine::io::Sockaddr& addr,
                                 engine::Deadline deadline) {
   engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kTcp};
@@ -92,25 +94,16 @@ void AmqpConnectionHandler::onData(AMQP::Connection* connection,
     return;
   }
 
-  try {
-    const auto sent = socket_->WriteAll(buffer, size, operation_deadline_);
-    if (sent != size) {
-      throw std::runtime_error{"Connection reset by peer"};
+  if (is_write_batching_) {
+    write_buffer_.append(buffer, size);
+    if (write_buffer_.size() >= kMaxWriteBatchSize) {
+      DoWrite(connection, write_buffer_.data(), write_buffer_.size());
+      write_buffer_.clear();
     }
-
-    AccountWrite(size);
-  } catch (const std::exception& ex) {
-    LOG_ERROR() << "Failed to send data to socket: " << ex;
-    Invalidate();
-
-    // We do fail all the outstanding operations with this,
-    // but it should be ok since we limit them by AmqpConnection::GetAwaiter().
-    // There's no easy way to fail only the current operation,
-    // so it's a compromise between allowing more throughput
-    // (connection is returned to pool without waiting for response)
-    // and error-rate. This behavior is documented in client_settings
-    connection->fail("Underlying connection broke.");
+    return;
   }
+
+  DoWrite(connection, buffer, size);
 }
 
 void AmqpConnectionHandler::onError(AMQP::Connection*, const char* message) {
@@ -134,6 +127,18 @@ void AmqpConnectionHandler::onReady(AMQP::Connection*) {
   connection_ready_event_.Send();
 }
 
+void AmqpConnectionHandler::onBlocked(AMQP::Connection*, const char* reason) {
+  LOG_WARNING() << "Connection to " << address_.hostname()
+                << " is blocked by the broker: " << reason;
+  blocked_ = true;
+}
+
+void AmqpConnectionHandler::onUnblocked(AMQP::Connection*) {
+  LOG_INFO() << "Connection to " << address_.hostname()
+             << " is unblocked by the broker";
+  blocked_ = false;
+}
+
 void AmqpConnectionHandler::OnConnectionCreated(AmqpConnection* connection,
                                                 engine::Deadline deadline) {
   reader_.Start(connection);
@@ -156,6 +161,8 @@ void AmqpConnectionHandler::Invalidate() { broken_ = true; }
 
 bool AmqpConnectionHandler::IsBroken() const { return broken_.load(); }
 
+bool AmqpConnectionHandler::IsBlocked() const { return blocked_.load(); }
+
 void AmqpConnectionHandler::AccountRead(size_t size) {
   stats_.AccountRead(size);
 }
@@ -176,6 +183,44 @@ const AMQP::Address& AmqpConnectionHandler::GetAddress() const {
   return address_;
 }
 
+void AmqpConnectionHandler::StartWriteBatch() {
+  UASSERT(!is_write_batching_);
+  is_write_batching_ = true;
+}
+
+void AmqpConnectionHandler::FinishWriteBatch(AMQP::Connection* connection) {
+  UASSERT(is_write_batching_);
+  is_write_batching_ = false;
+
+  if (!write_buffer_.empty() && !IsBroken()) {
+    DoWrite(connection, write_buffer_.data(), write_buffer_.size());
+  }
+  write_buffer_.clear();
+}
+
+void AmqpConnectionHandler::DoWrite(AMQP::Connection* connection,
+                                    const char* buffer, size_t size) {
+  try {
+    const auto sent = socket_->WriteAll(buffer, size, operation_deadline_);
+    if (sent != size) {
+      throw std::runtime_error{"Connection reset by peer"};
+    }
+
+    AccountWrite(size);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to send data to socket: " << ex;
+    Invalidate();
+
+    // We do fail all the outstanding operations with this,
+    // but it should be ok since we limit them by AmqpConnection::GetAwaiter().
+    // There's no easy way to fail only the current operation,
+    // so it's a compromise between allowing more throughput
+    // (connection is returned to pool without waiting for response)
+    // and error-rate. This behavior is documented in client_settings
+    connection->fail("Underlying connection broke.");
+  }
+}
+
 }  // namespace urabbitmq::impl
 
 USERVER_NAMESPACE_END
@@ -60,6 +60,10 @@ class AmqpConnectionHandler final : public AMQP::ConnectionHandler {
 
   void onReady(AMQP::Connection* connection) override;
 
+  void onBlocked(AMQP::Connection* connection, const char* reason) override;
+
+  void onUnblocked(AMQP::Connection* connection) override;
+
   void OnConnectionCreated(AmqpConnection* connection,
                            engine::Deadline deadline);
   void OnConnectionDestruction();
@@ -67,8 +71,17 @@ class AmqpConnectionHandler final : public AMQP::ConnectionHandler {
   void Invalidate();
   bool IsBroken() const;
 
+  // The broker stops reading from the connection while it is blocked, e.g.
+  // because of a memory or disk alarm
+  bool IsBlocked() const;
+
   void SetOperationDeadline(engine::Deadline deadline);
 
+  // Frames sent between these calls are coalesced into as few socket writes
+  // as possible
+  void StartWriteBatch();
+  void FinishWriteBatch(AMQP::Connection* connection);
+
   void AccountRead(size_t size);
   void AccountWrite(size_t size);
 
@@ -77,17 +90,23 @@ class AmqpConnectionHandler final : public AMQP::ConnectionHandler {
   const AMQP::Address& GetAddress() const;
 
  private:
+  void DoWrite(AMQP::Connection* connection, const char* buffer, size_t size);
+
   AMQP::Address address_;
   std::unique_ptr<engine::io::RwBase> socket_;
   io::SocketReader reader_;
 
   engine::SingleConsumerEvent connection_ready_event_;
   std::atomic<bool> broken_{false};
+  std::atomic<bool> blocked_{false};
 
   statistics::ConnectionStatistics& stats_;
 
   engine::Deadline operation_deadline_ = engine::Deadline::Passed();
 
+  bool is_write_batching_{false};
+  std::string write_buffer_;
+
   std::atomic<bool> is_ready_{false};
   std::optional<std::string> error_;
 };
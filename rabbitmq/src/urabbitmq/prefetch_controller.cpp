@@ -0,0 +1,72 @@
+#include "prefetch_controller.hpp"
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+namespace {
+
+// Latency this much worse than the best one means overload
+constexpr double kLatencyDegradationFactor = 2.0;
+// The best latency is slowly forgotten, so that changes in workload are
+// picked up
+constexpr double kBestLatencyDecay = 1.05;
+
+}  // namespace
+
+PrefetchController::PrefetchController(uint16_t min_prefetch,
+                                       uint16_t max_prefetch)
+    : min_prefetch_{min_prefetch},
+      max_prefetch_{max_prefetch},
+      prefetch_{min_prefetch} {
+  UASSERT(min_prefetch_ > 0 && min_prefetch_ <= max_prefetch_);
+}
+
+uint16_t PrefetchController::GetPrefetch() const { return prefetch_; }
+
+void PrefetchController::AccountDelivered(std::size_t in_flight) {
+  auto current = max_in_flight_.load(std::memory_order_relaxed);
+  while (current < in_flight &&
+         !max_in_flight_.compare_exchange_weak(current, in_flight,
+                                               std::memory_order_relaxed)) {
+  }
+}
+
+void PrefetchController::AccountProcessed(std::chrono::microseconds latency) {
+  latency_us_sum_.fetch_add(latency.count(), std::memory_order_relaxed);
+  processed_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::optional<uint16_t> PrefetchController::Tune() {
+  const auto processed = processed_.exchange(0);
+  const auto latency_us_sum = latency_us_sum_.exchange(0);
+  const auto max_in_flight = max_in_flight_.exchange(0);
+  // nothing to judge by
+  if (processed == 0) return std::nullopt;
+
+  const auto latency_us = static_cast<double>(latency_us_sum) / processed;
+  best_latency_us_ =
+      best_latency_us_.has_value()
+          ? std::min(*best_latency_us_ * kBestLatencyDecay, latency_us)
+          : latency_us;
+
+  std::size_t target = prefetch_;
+  if (latency_us > *best_latency_us_ * kLatencyDegradationFactor) {
+    target = std::max<std::size_t>(min_prefetch_, target * 3 / 4);
+  } else if (max_in_flight >= prefetch_) {
+    const auto step = std::max<std::size_t>(1, target / 4);
+    target = std::min<std::size_t>(max_prefetch_, target + step);
+  }
+
+  if (target == prefetch_) return std::nullopt;
+  prefetch_ = static_cast<uint16_t>(target);
+  return prefetch_;
+}
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq {
+
+// Adjusts the prefetch of a consumer within [min_prefetch, max_prefetch]:
+// prefetch grows while all of it is taken by in-flight messages and
+// the processing latency stays close to the best one seen, and
+// shrinks once the latency degrades (the consumer takes more than it can
+// handle).
+//
+// Account* methods are thread-safe, Tune is expected to be called
+// periodically from a single task.
+class PrefetchController final {
+ public:
+  PrefetchController(uint16_t min_prefetch, uint16_t max_prefetch);
+
+  uint16_t GetPrefetch() const;
+
+  void AccountDelivered(std::size_t in_flight);
+  void AccountProcessed(std::chrono::microseconds latency);
+
+  // Returns the new prefetch if it should be changed
+  std::optional<uint16_t> Tune();
+
+ private:
+  const uint16_t min_prefetch_;
+  const uint16_t max_prefetch_;
+  uint16_t prefetch_;
+
+  std::optional<double> best_latency_us_;
+
+  std::atomic<std::size_t> max_in_flight_{0};
+  std::atomic<std::size_t> processed_{0};
+  std::atomic<int64_t> latency_us_sum_{0};
+};
+
+}  // namespace urabbitmq
+
+USERVER_NAMESPACE_END
@@ -26,6 +26,19 @@ void ConnectionStatistics::AccountMessagePublished() { ++messages_published_; }
 
 void ConnectionStatistics::AccountMessageConsumed() { ++messages_consumed_; }
 
+void ConnectionStatistics::AccountMessageDelivered(bool redelivered) {
+  ++messages_in_flight_;
+  if (redelivered) ++messages_redelivered_;
+}
+
+void ConnectionStatistics::AccountMessageProcessed() { --messages_in_flight_; }
+
+void ConnectionStatistics::AccountMessageAcked(
+    std::chrono::milliseconds ack_latency) {
+  ++messages_acked_;
+  ack_latency_ms_sum_ += ack_latency.count();
+}
+
 ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
   Frozen result{};
   result.connections_created = connections_created_.Load();
@@ -34,6 +47,10 @@ ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
   result.bytes_read = bytes_read_.Load();
   result.messages_published = messages_published_.Load();
   result.messages_consumed = messages_consumed_.Load();
+  result.messages_redelivered = messages_redelivered_.Load();
+  result.messages_in_flight = messages_in_flight_.Load();
+  result.messages_acked = messages_acked_.Load();
+  result.ack_latency_ms_sum = ack_latency_ms_sum_.Load();
 
   return result;
 }
@@ -46,6 +63,10 @@ ConnectionStatistics::Frozen& ConnectionStatistics::Frozen::operator+=(
   bytes_read += other.bytes_read;
   messages_published += other.messages_published;
   messages_consumed += other.messages_consumed;
+  messages_redelivered += other.messages_redelivered;
+  messages_in_flight += other.messages_in_flight;
+  messages_acked += other.messages_acked;
+  ack_latency_ms_sum += other.ack_latency_ms_sum;
 
   return *this;
 }
@@ -58,6 +79,11 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["bytes_read"] = value.bytes_read;
   writer["messages_published"] = value.messages_published;
   writer["messages_consumed"] = value.messages_consumed;
+  writer["messages_redelivered"] = value.messages_redelivered;
+  writer["messages_in_flight"] = value.messages_in_flight;
+  writer["messages_acked"] = value.messages_acked;
+  // divide by messages_acked for the average time to ack since delivery
+  writer["ack_latency_ms_sum"] = value.ack_latency_ms_sum;
 }
 
 }  // namespace urabbitmq::statistics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 
 #include <userver/utils/statistics/relaxed_counter.hpp>
@@ -20,6 +21,10 @@ class ConnectionStatistics final {
   void AccountMessagePublished();
   void AccountMessageConsumed();
 
+  void AccountMessageDelivered(bool redelivered);
+  void AccountMessageProcessed();
+  void AccountMessageAcked(std::chrono::milliseconds ack_latency);
+
   struct Frozen final {
     Frozen& operator+=(const Frozen& other);
 
@@ -31,6 +36,11 @@ class ConnectionStatistics final {
 
     size_t messages_published{0};
     size_t messages_consumed{0};
+
+    size_t messages_redelivered{0};
+    size_t messages_in_flight{0};
+    size_t messages_acked{0};
+    size_t ack_latency_ms_sum{0};
   };
   Frozen Get() const;
 
@@ -43,6 +53,11 @@ class ConnectionStatistics final {
 
   utils::statistics::RelaxedCounter<size_t> messages_published_{0};
   utils::statistics::RelaxedCounter<size_t> messages_consumed_{0};
+
+  utils::statistics::RelaxedCounter<size_t> messages_redelivered_{0};
+  utils::statistics::RelaxedCounter<size_t> messages_in_flight_{0};
+  utils::statistics::RelaxedCounter<size_t> messages_acked_{0};
+  utils::statistics::RelaxedCounter<size_t> ack_latency_ms_sum_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -0,0 +1,36 @@
+#include "publish_shard_statistics.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+void PublishShardStatistics::AccountPublished() { ++published_; }
+
+void PublishShardStatistics::AccountPublishFailed() { ++failed_; }
+
+void PublishShardStatistics::AccountPublishBlocked() { ++blocked_; }
+
+void PublishShardStatistics::AccountReconnect() { ++reconnects_; }
+
+PublishShardStatistics::Frozen PublishShardStatistics::Get() const {
+  Frozen result{};
+  result.published = published_.Load();
+  result.failed = failed_.Load();
+  result.blocked = blocked_.Load();
+  result.reconnects = reconnects_.Load();
+
+  return result;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const PublishShardStatistics::Frozen& value) {
+  writer["published"] = value.published;
+  // the blocked publishes are accounted as failed too
+  writer["failed"] = value.failed;
+  writer["blocked"] = value.blocked;
+  writer["reconnects"] = value.reconnects;
+}
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
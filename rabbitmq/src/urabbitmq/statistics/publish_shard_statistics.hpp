@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+class PublishShardStatistics final {
+ public:
+  void AccountPublished();
+  void AccountPublishFailed();
+  void AccountPublishBlocked();
+  void AccountReconnect();
+
+  struct Frozen final {
+    size_t published{0};
+    size_t failed{0};
+    size_t blocked{0};
+    size_t reconnects{0};
+  };
+  Frozen Get() const;
+
+ private:
+  utils::statistics::RelaxedCounter<size_t> published_{0};
+  utils::statistics::RelaxedCounter<size_t> failed_{0};
+  utils::statistics::RelaxedCounter<size_t> blocked_{0};
+  utils::statistics::RelaxedCounter<size_t> reconnects_{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const PublishShardStatistics::Frozen& value);
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/resp_parser.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Size of a socket read in the redis connection
+constexpr size_t kChunkSize = 16 * 1024;
+
+// An array of `state.range(0)` bulk strings of `state.range(1)` bytes, as in
+// MGET and HGETALL replies
+std::string MakeArrayReply(const benchmark::State& state) {
+  const auto count = state.range(0);
+  const std::string value(state.range(1), 'x');
+
+  std::string data = '*' + std::to_string(count) + "\r\n";
+  for (int64_t i = 0; i < count; ++i) {
+    data += '$' + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+  }
+  return data;
+}
+
+template <typename Consumer>
+void FeedByChunks(std::string_view data, Consumer consumer) {
+  for (size_t pos = 0; pos < data.size(); pos += kChunkSize) {
+    consumer(data.substr(pos, kChunkSize));
+  }
+}
+
+}  // namespace
+
+void RespHiredisReader(benchmark::State& state) {
+  const auto data = MakeArrayReply(state);
+  std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader(
+      redisReaderCreate(), &redisReaderFree);
+
+  for (auto _ : state) {
+    FeedByChunks(data, [&reader](std::string_view chunk) {
+      redisReaderFeed(reader.get(), chunk.data(), chunk.size());
+    });
+    void* reply = nullptr;
+    redisReaderGetReply(reader.get(), &reply);
+    redis::ReplyData reply_data{static_cast<redisReply*>(reply)};
+    freeReplyObject(reply);
+    benchmark::DoNotOptimize(reply_data);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(RespHiredisReader)
+    ->Args({16, 16})
+    ->Args({1024, 16})
+    ->Args({1024, 1024})
+    ->Args({16, 64 * 1024});
+
+void RespNativeParser(benchmark::State& state) {
+  const auto data = MakeArrayReply(state);
+  redis::RespParser parser;
+
+  for (auto _ : state) {
+    FeedByChunks(data,
+                 [&parser](std::string_view chunk) { parser.Feed(chunk); });
+    auto reply_data = parser.GetReply();
+    benchmark::DoNotOptimize(reply_data);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(RespNativeParser)
+    ->Args({16, 16})
+    ->Args({1024, 16})
+    ->Args({1024, 1024})
+    ->Args({16, 64 * 1024});
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,86 @@
+#pragma once
+
+/// @file userver/storages/redis/cache_invalidation_channel.hpp
+/// @brief @copybrief storages::redis::CacheInvalidationChannel
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/cache/invalidation_channel.hpp>
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+class Client;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief cache::InvalidationChannel over the Redis PUBLISH/SUBSCRIBE
+///
+/// Each instance of the service subscribes to the channel, an event published
+/// by any of them is received by all of them.
+///
+/// @note Redis Pub/Sub delivers messages at most once: the messages sent
+/// while the subscription is being reconnected are lost.
+///
+/// ## Static options:
+/// Name                | Description | Default value
+/// ------------------- | ----------- | -------------
+/// redis_component     | name of the components::Redis to use | redis
+/// db                  | name of the redis database to publish the events to | -
+/// subscribe_db        | name of the redis database to subscribe for the events in | -
+/// channel             | name of the Redis Pub/Sub channel | userver-cache-invalidation
+///
+/// ## Example config:
+/// @code
+/// redis-cache-invalidation-channel:
+///     db: redis-cache
+///     subscribe_db: redis-cache-subscribe
+///
+/// my-lru-cache:
+///     size: 10000
+///     ways: 16
+///     lifetime: 1h
+///     invalidation-channel: redis-cache-invalidation-channel
+/// @endcode
+
+// clang-format on
+// NOLINTNEXTLINE(fuchsia-multiple-inheritance)
+class CacheInvalidationChannel final : public components::LoggableComponentBase,
+                                       public cache::InvalidationChannel {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of storages::redis::CacheInvalidationChannel
+  static constexpr std::string_view kName = "redis-cache-invalidation-channel";
+
+  CacheInvalidationChannel(const components::ComponentConfig& config,
+                           const components::ComponentContext& context);
+  ~CacheInvalidationChannel() override;
+
+  void Publish(const cache::InvalidationEvent& event) override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::string channel_;
+  std::shared_ptr<Client> client_;
+  SubscriptionToken subscription_;
+};
+
+}  // namespace storages::redis
+
+namespace components {
+
+template <>
+inline constexpr bool
+    kHasValidate<storages::redis::CacheInvalidationChannel> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
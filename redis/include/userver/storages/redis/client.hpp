@@ -14,7 +14,9 @@
 #include <userver/storages/redis/command_options.hpp>
 #include <userver/storages/redis/request.hpp>
 #include <userver/storages/redis/request_eval.hpp>
+#include <userver/storages/redis/request_eval_script.hpp>
 #include <userver/storages/redis/request_evalsha.hpp>
+#include <userver/storages/redis/script.hpp>
 #include <userver/storages/redis/transaction.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,6 +38,12 @@ inline constexpr RetryNilFromMaster kRetryNilFromMaster{};
 ///
 /// Usually retrieved from components::Redis component.
 ///
+/// The keys of Mget(), Mset(), Del() and Unlink() may belong to distinct
+/// shards: the command is split by the shards of the keys, the parts are
+/// executed in parallel and the reply keeps the order of the keys. In cluster
+/// mode the keys of a shard still must share a hash slot.
+/// @warning A split Mset() is not atomic, see Mset().
+///
 /// ## Example usage:
 ///
 /// @snippet storages/redis/client_redistest.cpp  Sample Redis Client usage
@@ -96,6 +104,26 @@ class Client {
       std::string script, size_t shard,
       const CommandControl& command_control) = 0;
 
+  /// @brief Registers the Lua script to be loaded onto every instance,
+  /// including the ones connected later
+  virtual Script RegisterScript(std::string script) = 0;
+
+  /// @brief Executes the registered script with EVALSHA, the whole script is
+  /// sent only if the instance has not loaded it yet
+  template <typename ScriptResult, typename ReplyType = ScriptResult>
+  RequestEvalScript<ScriptResult, ReplyType> EvalScript(
+      const Script& script, std::vector<std::string> keys,
+      std::vector<std::string> args, const CommandControl& command_control) {
+    auto fallback = [this, body = script.GetBody(), keys, args,
+                     command_control]() mutable {
+      return Eval<ScriptResult, ReplyType>(std::move(body), std::move(keys),
+                                           std::move(args), command_control);
+    };
+    return {EvalSha<ScriptResult, ReplyType>(script.GetSha(), std::move(keys),
+                                             std::move(args), command_control),
+            std::move(fallback)};
+  }
+
   template <typename ScriptInfo, typename ReplyType = std::decay_t<ScriptInfo>>
   RequestEval<std::decay_t<ScriptInfo>, ReplyType> Eval(
       const ScriptInfo& script_info, std::vector<std::string> keys,
@@ -244,6 +272,11 @@ class Client {
   virtual RequestMget Mget(std::vector<std::string> keys,
                            const CommandControl& command_control) = 0;
 
+  /// @brief Sets the values of the keys
+  /// @warning The keys of distinct shards are set by a separate MSET per
+  /// shard. The MSETs are not atomic together: if one of them fails, the keys
+  /// of the other shards stay written and the error of the failed part is
+  /// reported. Keep the keys that must be set atomically on one shard.
   virtual RequestMset Mset(
       std::vector<std::pair<std::string, std::string>> key_values,
       const CommandControl& command_control) = 0;
@@ -252,6 +285,15 @@ class Client {
 
   virtual TransactionPtr Multi(Transaction::CheckShards check_shards) = 0;
 
+  /// Creates a batch of commands that is sent without MULTI/EXEC: the
+  /// commands may deal with any shards, they are grouped by shard and every
+  /// group is sent to its shard at once, which is cheaper than sending the
+  /// commands one by one. Unlike `Multi()`, there is no isolation between the
+  /// commands of the batch and the commands of other clients.
+  /// The results are available after calling `Get()` on the object returned
+  /// by `Exec()`.
+  virtual TransactionPtr Pipeline() = 0;
+
   virtual RequestPersist Persist(std::string key,
                                  const CommandControl& command_control) = 0;
 
@@ -357,6 +399,39 @@ class Client {
   virtual RequestType Type(std::string key,
                            const CommandControl& command_control) = 0;
 
+  virtual RequestXack Xack(std::string key, std::string group,
+                           std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  /// Appends an entry with an auto-generated id to the stream, returns the id
+  virtual RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) = 0;
+
+  /// Transfers the entries that are pending for longer than `min_idle_time`
+  /// in the consumer group to `consumer`, starting from the `start` id
+  virtual RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start, size_t count,
+      const CommandControl& command_control) = 0;
+
+  /// Creates the consumer group and the stream if it does not exist.
+  /// `id` is the last delivered entry id, "$" to deliver only new entries
+  virtual RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) = 0;
+
+  /// Reads the entries of the stream as `consumer` of the consumer group:
+  /// new entries for ">" `id`, entries pending for the consumer otherwise.
+  /// @warning A blocking read holds the connection to the instance for up
+  /// to `options.block`, so the other commands of the client wait too. Use a
+  /// separate client for blocking reads.
+  virtual RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer,
+      std::string id, XreadgroupOptions options,
+      const CommandControl& command_control) = 0;
+
   virtual RequestZadd Zadd(std::string key, double score, std::string member,
                            const CommandControl& command_control) = 0;
 
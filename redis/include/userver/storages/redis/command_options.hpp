@@ -23,6 +23,7 @@ using GeoaddArg = USERVER_NAMESPACE::redis::GeoaddArg;
 using GeoradiusOptions = USERVER_NAMESPACE::redis::GeoradiusOptions;
 using GeosearchOptions = USERVER_NAMESPACE::redis::GeosearchOptions;
 using ZaddOptions = USERVER_NAMESPACE::redis::ZaddOptions;
+using XreadgroupOptions = USERVER_NAMESPACE::redis::XreadgroupOptions;
 
 class ScanOptionsBase {
  public:
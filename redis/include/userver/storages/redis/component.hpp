@@ -62,6 +62,17 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache.enabled | enables the in-process cache of GET and HGET replies invalidated by RESP3 CLIENT TRACKING | false
+/// groups.[].client_side_cache.max_size | maximum number of cached keys | 10000
+/// groups.[].client_side_cache.ways | number of independently locked parts of the cache | 16
+/// groups.[].client_side_cache.ttl | upper bound of staleness if an invalidation is lost | 10s
+/// groups.[].client_side_cache.broadcast_prefixes | use broadcast tracking and cache only the keys with these prefixes | -
+/// groups.[].hot_keys.enabled | enables the detection of the most frequent command keys of every shard | false
+/// groups.[].hot_keys.top_size | number of the most frequent keys tracked per shard | 32
+/// groups.[].hot_keys.sample_rate | one of this many keyed commands is sampled | 16
+/// groups.[].hot_keys.hot_share | share of the sampled commands of a shard that makes a key hot | 0.05
+/// groups.[].hot_keys.decay_period | the counters are halved with this period | 10s
+/// groups.[].hot_keys.cache_ttl | GET and HGET of the hot keys are served from an in-process cache for this long, 0 disables the cache | 0s
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -178,6 +178,10 @@ struct CommandControl {
 
     /// Send requests to 'best_dc_count' Redis instances with the min ping
     kNearestServerPing,
+
+    /// Send requests to the less loaded of two random instances, the load is
+    /// the number of running commands multiplied by the smoothed reply time
+    kAdaptive,
   };
 
   /// Timeout for a single attempt to execute command
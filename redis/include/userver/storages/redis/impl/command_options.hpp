@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <vector>
@@ -92,6 +93,15 @@ struct RangeScoreOptions {
   RangeOptions range_options;
 };
 
+struct XreadgroupOptions {
+  /// Max number of entries to read, 0 for no limit
+  size_t count = 0;
+  /// Time to wait for new entries, 0 to return immediately
+  std::chrono::milliseconds block{0};
+  /// Do not add the read entries to the pending entries list
+  bool noack = false;
+};
+
 void PutArg(CmdArgs::CmdArgsArray& args_, GeoaddArg arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, std::vector<GeoaddArg> arg);
@@ -112,6 +122,8 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeOptions& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg);
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
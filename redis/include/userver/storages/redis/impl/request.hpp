@@ -35,10 +35,20 @@ class Request {
   Request(Sentinel& sentinel, CmdArgs&& args, size_t shard, bool master,
           const CommandControl& command_control, size_t replies_to_skip);
 
+  struct CollectRepliesTag {};
+
+  // Replies to all the commands from `args` are collected into a single
+  // array reply, unless one of them fails with a non-OK status
+  Request(Sentinel& sentinel, CmdArgs&& args, size_t shard, bool master,
+          const CommandControl& command_control, CollectRepliesTag);
+
   CommandPtr PrepareRequest(CmdArgs&& args,
                             const CommandControl& command_control,
                             size_t replies_to_skip);
 
+  CommandPtr PrepareCollectingRequest(CmdArgs&& args,
+                                      const CommandControl& command_control);
+
   engine::Future<ReplyPtr> future_;
   engine::Deadline deadline_;
 };
@@ -122,6 +122,18 @@ std::unordered_map<std::string, std::string> Parse(
 ReplyData Parse(ReplyData&& reply_data, const std::string& request_description,
                 To<ReplyData>);
 
+std::vector<StreamEntry> Parse(ReplyData&& reply_data,
+                               const std::string& request_description,
+                               To<std::vector<StreamEntry>>);
+
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>);
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>);
+
 template <typename Result, typename ReplyType = Result>
 std::enable_if_t<impl::HasParseFunctionFromRedisReply<Result, ReplyType>::value,
                  ReplyType>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -109,6 +110,25 @@ enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
 
+/// Entry of a Redis Stream
+struct StreamEntry final {
+  std::string id;
+  /// Empty for the pending entries that were deleted from the stream
+  std::vector<std::pair<std::string, std::string>> field_values;
+};
+
+struct XautoclaimReply final {
+  /// Id to start the next XAUTOCLAIM from, "0-0" if the whole pending entries
+  /// list was scanned
+  std::string next_start_id;
+  std::vector<StreamEntry> entries;
+  /// Ids of the pending entries that were deleted from the stream and were
+  /// removed from the pending entries list. Redis 7.0+ only.
+  std::vector<std::string> deleted_ids;
+};
+
+enum class XgroupCreateReply { kCreated, kAlreadyExists };
+
 using TtlReply = USERVER_NAMESPACE::redis::TtlReply;
 
 }  // namespace storages::redis
@@ -35,6 +35,16 @@ class [[nodiscard]] Request final {
     return impl_->Get(request_description);
   }
 
+  /// @brief Same as Get(), but returns the status of a failed request, e.g. of
+  /// a timed out one, instead of throwing RequestFailedException. Use it where
+  /// the failures are frequent, e.g. to fail fast on partial outages without
+  /// the cost of the exceptions.
+  ///
+  /// Invalid replies are still reported with the exceptions.
+  TryGetReply<ReplyType> TryGet(const std::string& request_description = {}) {
+    return impl_->TryGet(request_description);
+  }
+
   template <typename T1, typename T2>
   friend class RequestEval;
 
@@ -210,6 +220,11 @@ using RequestStrlen = Request<size_t>;
 using RequestTime = Request<std::chrono::system_clock::time_point>;
 using RequestTtl = Request<TtlReply>;
 using RequestType = Request<KeyType>;
+using RequestXack = Request<size_t>;
+using RequestXadd = Request<std::string>;
+using RequestXautoclaim = Request<XautoclaimReply>;
+using RequestXgroupCreate = Request<XgroupCreateReply>;
+using RequestXreadgroup = Request<std::vector<StreamEntry>>;
 using RequestZadd = Request<size_t>;
 using RequestZaddIncr = Request<double>;
 using RequestZaddIncrExisting = Request<std::optional<double>>;
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <string>
+#include <type_traits>
+#include <variant>
 
+#include <userver/storages/redis/impl/exception.hpp>
+#include <userver/storages/redis/impl/reply_status.hpp>
 #include <userver/storages/redis/reply_fwd.hpp>
 #include <userver/storages/redis/reply_types.hpp>
 #include <userver/storages/redis/scan_tag.hpp>
+#include <userver/utils/expected.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,6 +22,13 @@ namespace storages::redis {
 // RequestDataBase <- RequestDataImpl
 // RequestDataBase <- MockRequestDataBase <- UserMockRequestData
 
+/// Reply or the status of a failed request, std::monostate stands for the
+/// replies of the void requests
+template <typename ReplyType>
+using TryGetReply = utils::expected<
+    std::conditional_t<std::is_void_v<ReplyType>, std::monostate, ReplyType>,
+    USERVER_NAMESPACE::redis::ReplyStatus>;
+
 template <typename ReplyType>
 class RequestDataBase {
  public:
@@ -26,6 +38,22 @@ class RequestDataBase {
 
   virtual ReplyType Get(const std::string& request_description) = 0;
 
+  // Implementations should override it to report the failures without
+  // throwing
+  virtual TryGetReply<ReplyType> TryGet(
+      const std::string& request_description) {
+    try {
+      if constexpr (std::is_void_v<ReplyType>) {
+        Get(request_description);
+        return std::monostate{};
+      } else {
+        return Get(request_description);
+      }
+    } catch (const USERVER_NAMESPACE::redis::RequestFailedException& ex) {
+      return utils::unexpected(ex.GetStatus());
+    }
+  }
+
   virtual ReplyPtr GetRaw() = 0;
 };
 
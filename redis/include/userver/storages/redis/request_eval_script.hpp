@@ -0,0 +1,43 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+
+#include <userver/storages/redis/request_eval.hpp>
+#include <userver/storages/redis/request_evalsha.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// EVALSHA of a registered script that is retried with EVAL of the whole
+/// script if the instance has not loaded it yet
+template <typename ScriptResult, typename ReplyType = ScriptResult>
+class [[nodiscard]] RequestEvalScript final {
+ public:
+  using EvalFallback = std::function<RequestEval<ScriptResult, ReplyType>()>;
+
+  RequestEvalScript(RequestEvalSha<ScriptResult, ReplyType>&& request,
+                    EvalFallback fallback)
+      : request_(std::move(request)), fallback_(std::move(fallback)) {}
+
+  void Wait() { request_.Wait(); }
+
+  /// The script is not retried if the result is ignored
+  void IgnoreResult() const { request_.IgnoreResult(); }
+
+  ReplyType Get(const std::string& request_description = {}) {
+    auto result = request_.Get(request_description);
+    if (!result.IsNoScriptError()) return result.Extract();
+    return fallback_().Get(request_description);
+  }
+
+ private:
+  RequestEvalSha<ScriptResult, ReplyType> request_;
+  EvalFallback fallback_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,34 @@
+#pragma once
+
+/// @file userver/storages/redis/script.hpp
+/// @brief @copybrief storages::redis::Script
+
+#include <string>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief Lua script registered with storages::redis::Client::RegisterScript()
+///
+/// The script is loaded onto every instance of the cluster, so that
+/// storages::redis::Client::EvalScript() sends only its SHA1 digest.
+class Script final {
+ public:
+  /// @cond
+  Script(std::string body, std::string sha)
+      : body_(std::move(body)), sha_(std::move(sha)) {}
+  /// @endcond
+
+  const std::string& GetBody() const { return body_; }
+  const std::string& GetSha() const { return sha_; }
+
+ private:
+  std::string body_;
+  std::string sha_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,99 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer_component_base.hpp
+/// @brief @copybrief storages::redis::StreamConsumerComponentBase
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+class StreamConsumer;
+
+// clang-format off
+
+/// @ingroup userver_base_classes
+///
+/// @brief Base component for Redis Streams consumers.
+///
+/// Reads the stream as a consumer of a consumer group with XREADGROUP, calls
+/// `Process` for the read entries in parallel and acknowledges the processed
+/// entries with batched XACKs. Entries that stay pending in the group for
+/// too long (for example, because their consumer died) are claimed with
+/// XAUTOCLAIM and processed again. The consumer group and the stream are
+/// created if they do not exist.
+///
+/// You should derive from it and override `Process` method. The consumer
+/// starts after all components are loaded and stops before all components
+/// are beginning to stop.
+///
+/// @note Library guarantees `at least once` delivery: an entry is processed
+/// again if `Process` throws, if XACK did not reach Redis or if the
+/// processing takes longer than `claim_min_idle_time`.
+///
+/// @warning Blocking XREADGROUP holds the connection to the Redis instance,
+/// other requests to the same database wait for it. Set `read_db` to a
+/// separate group of components::Redis with the same `config_name` to give
+/// the reads their own connections. Otherwise `block_timeout` is capped by
+/// 100ms, so that XACK and XAUTOCLAIM do not time out waiting for the read.
+///
+/// ## Static options:
+/// Name                | Description | Default value
+/// ------------------- | ----------- | -------------
+/// redis_component     | name of the components::Redis to use | redis
+/// db                  | name of the redis database with the stream | -
+/// read_db             | name of the redis database for the blocking XREADGROUP | db
+/// stream              | key of the stream | -
+/// group               | name of the consumer group | -
+/// consumer            | name of the consumer in the group | host name
+/// batch_size          | max number of entries to read or to claim at once | 100
+/// block_timeout       | time to wait for new entries in XREADGROUP, at most 100ms if `read_db` is `db` | 1s
+/// max_in_flight       | max number of entries processed at once | 16
+/// ack_batch_size      | number of processed entries acknowledged by one XACK | 100
+/// claim_min_idle_time | time after which pending entries are claimed | 60s
+/// claim_interval      | period of claiming pending entries | 10s
+
+// clang-format on
+
+class StreamConsumerComponentBase : public components::LoggableComponentBase {
+ public:
+  StreamConsumerComponentBase(const components::ComponentConfig& config,
+                              const components::ComponentContext& context);
+  ~StreamConsumerComponentBase() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  void OnAllComponentsLoaded() final;
+
+  void OnAllComponentsAreStopping() final;
+
+  /// @brief Override this method in derived class and implement
+  /// entry handling logic.
+  ///
+  /// If this method returns successfully the entry is acknowledged, if this
+  /// method throws the entry stays pending and is claimed again after
+  /// `claim_min_idle_time`.
+  virtual void Process(StreamEntry entry) = 0;
+
+ private:
+  std::unique_ptr<StreamConsumer> consumer_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace storages::redis
+
+namespace components {
+
+template <>
+inline constexpr bool
+    kHasValidate<storages::redis::StreamConsumerComponentBase> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
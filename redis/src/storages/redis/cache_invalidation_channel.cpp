@@ -0,0 +1,67 @@
+#include <userver/storages/redis/cache_invalidation_channel.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+CacheInvalidationChannel::CacheInvalidationChannel(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : components::LoggableComponentBase(config, context),
+      cache::InvalidationChannel(config.Name()),
+      channel_(
+          config["channel"].As<std::string>("userver-cache-invalidation")) {
+  auto& redis = context.FindComponent<components::Redis>(
+      config["redis_component"].As<std::string>("redis"));
+  client_ = redis.GetClient(config["db"].As<std::string>());
+
+  subscription_ =
+      redis.GetSubscribeClient(config["subscribe_db"].As<std::string>())
+          ->Subscribe(channel_, [this](const std::string& /*channel*/,
+                                       const std::string& message) {
+            OnMessage(message);
+          });
+}
+
+CacheInvalidationChannel::~CacheInvalidationChannel() {
+  subscription_.Unsubscribe();
+}
+
+void CacheInvalidationChannel::Publish(const cache::InvalidationEvent& event) {
+  client_->Publish(channel_, SerializeEvent(event), {}, PubShard::kZeroShard);
+}
+
+yaml_config::Schema CacheInvalidationChannel::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: cache invalidation channel over the Redis Pub/Sub
+additionalProperties: false
+properties:
+    redis_component:
+        type: string
+        description: name of the components::Redis to use
+        defaultDescription: redis
+    db:
+        type: string
+        description: name of the redis database to publish the events to
+    subscribe_db:
+        type: string
+        description: name of the redis database to subscribe for the events in
+    channel:
+        type: string
+        description: name of the Redis Pub/Sub channel
+        defaultDescription: userver-cache-invalidation
+)");
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
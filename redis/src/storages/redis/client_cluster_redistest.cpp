@@ -124,6 +124,43 @@ UTEST_F(RedisClusterClientTest, MgetCrossSlot) {
   }
 }
 
+UTEST_F(RedisClusterClientTest, MultiKeyDistinctShards) {
+  auto client = GetClient();
+
+  const int add = 100;
+
+  size_t idx[2] = {0, 1};
+  auto shard = client->ShardByKey(MakeKey(idx[0]));
+  while (client->ShardByKey(MakeKey(idx[1])) == shard) ++idx[1];
+
+  {
+    auto req = client->Mset({{MakeKey(idx[0]), std::to_string(add + idx[0])},
+                             {MakeKey(idx[1]), std::to_string(add + idx[1])}},
+                            kDefaultCc);
+    UASSERT_NO_THROW(req.Get());
+  }
+
+  {
+    // the keys are reassembled in the order of the request
+    auto req = client->Mget(
+        {MakeKey(idx[1]), MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
+    auto reply = req.Get();
+    ASSERT_EQ(reply.size(), 3);
+
+    ASSERT_TRUE(reply[0]);
+    EXPECT_EQ(*reply[0], std::to_string(add + idx[1]));
+    ASSERT_TRUE(reply[1]);
+    EXPECT_EQ(*reply[1], std::to_string(add + idx[0]));
+    ASSERT_TRUE(reply[2]);
+    EXPECT_EQ(*reply[2], std::to_string(add + idx[1]));
+  }
+
+  {
+    auto req = client->Del({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
+    EXPECT_EQ(req.Get(), 2);
+  }
+}
+
 UTEST_F(RedisClusterClientTest, Transaction) {
   auto client = GetClient();
   auto transaction = client->Multi();
@@ -187,6 +224,68 @@ UTEST_F(RedisClusterClientTest, TransactionDistinctShards) {
                 redis::ParseReplyException);
 }
 
+UTEST_F(RedisClusterClientTest, Pipeline) {
+  auto client = GetClient();
+  auto pipeline = client->Pipeline();
+
+  const size_t kNumKeys = 30;
+  const int add = 100;
+
+  std::vector<storages::redis::RequestGet> gets;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    auto set = pipeline->Set(MakeKey(i), std::to_string(add + i));
+    gets.push_back(pipeline->Get(MakeKey(i)));
+  }
+  auto missing = pipeline->Get(MakeKey(kNumKeys));
+
+  UASSERT_NO_THROW(pipeline->Exec(kDefaultCc).Get());
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    auto reply = gets[i].Get();
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(*reply, std::to_string(add + i));
+  }
+  EXPECT_FALSE(missing.Get());
+
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    auto req = client->Del(MakeKey(i), kDefaultCc);
+    EXPECT_EQ(req.Get(), 1);
+  }
+}
+
+UTEST_F(RedisClusterClientTest, PipelineCommandError) {
+  auto client = GetClient();
+  auto pipeline = client->Pipeline();
+
+  auto set = pipeline->Set(MakeKey(0), "value");
+  auto hget = pipeline->Hget(MakeKey(0), "field");
+  auto get = pipeline->Get(MakeKey(1));
+
+  UASSERT_NO_THROW(pipeline->Exec(kDefaultCc).Get());
+  UEXPECT_NO_THROW(set.Get());
+  // WRONGTYPE error affects the command only
+  UEXPECT_THROW(hget.Get(), redis::ParseReplyException);
+  EXPECT_FALSE(get.Get());
+
+  auto req = client->Del(MakeKey(0), kDefaultCc);
+  EXPECT_EQ(req.Get(), 1);
+}
+
+UTEST_F(RedisClusterClientTest, PipelineCrossSlotCommand) {
+  auto client = GetClient();
+  auto pipeline = client->Pipeline();
+
+  size_t idx[2] = {0, 1};
+  auto shard = client->ShardByKey(MakeKey(idx[0]));
+  while (client->ShardByKey(MakeKey(idx[1])) == shard) ++idx[1];
+
+  UEXPECT_THROW(pipeline->Del({MakeKey(idx[0]), MakeKey(idx[1])}),
+                redis::InvalidArgumentException);
+  // The pipeline is still usable
+  auto del = pipeline->Del(MakeKey(idx[1]));
+  UASSERT_NO_THROW(pipeline->Exec(kDefaultCc).Get());
+  EXPECT_EQ(del.Get(), 0);
+}
+
 UTEST_F(RedisClusterClientTest, Subscribe) {
   auto client = GetClient();
   auto subscribe_client = GetSubscribeClient();
@@ -297,4 +396,48 @@ UTEST_F(RedisClusterClientTest, ClusterSlotsCalled) {
   ASSERT_GT(redis::ClusterSentinelImpl::GetClusterSlotsCalledCounter(), 2);
 }
 
+UTEST_F(RedisClusterClientTest, ClusterStatistics) {
+  auto client = GetClient();
+  const auto stats_before = GetSentinel()->GetStatistics({});
+  ASSERT_TRUE(stats_before.cluster);
+
+  const size_t kNumKeys = 10;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    client->Set(std::to_string(i), "value", {}).Get();
+  }
+
+  const auto stats = GetSentinel()->GetStatistics({});
+  ASSERT_TRUE(stats.cluster);
+  // Slots do not move in a stable cluster
+  EXPECT_EQ(stats.cluster->moved_redirects,
+            stats_before.cluster->moved_redirects);
+  EXPECT_EQ(stats.cluster->ask_redirects, stats_before.cluster->ask_redirects);
+  EXPECT_EQ(stats.cluster->slot_updates, stats_before.cluster->slot_updates);
+  EXPECT_GE(stats.cluster->topology_updates, 1);
+}
+
+UTEST_F(RedisClusterClientTest, MovedRedirect) {
+  const std::string kKey = "moved_key";
+  auto sentinel = GetSentinel();
+  ASSERT_GT(sentinel->ShardsCount(), 1);
+  const auto key_shard = sentinel->ShardByKey(kKey);
+  const auto other_shard = (key_shard + 1) % sentinel->ShardsCount();
+
+  const auto stats_before = sentinel->GetStatistics({});
+  ASSERT_TRUE(stats_before.cluster);
+
+  // The master of another shard replies with MOVED to the master of the slot
+  const auto reply =
+      sentinel->MakeRequest({"set", kKey, "value"}, other_shard, true).Get();
+  ASSERT_TRUE(reply->IsOk());
+  EXPECT_EQ(GetClient()->Get(kKey, {}).Get(), "value");
+
+  const auto stats = sentinel->GetStatistics({});
+  ASSERT_TRUE(stats.cluster);
+  EXPECT_EQ(stats.cluster->moved_redirects,
+            stats_before.cluster->moved_redirects + 1);
+  // The slot already belongs to the master from MOVED in the topology
+  EXPECT_EQ(stats.cluster->slot_updates, stats_before.cluster->slot_updates);
+}
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
+#include <storages/redis/impl/hot_keys.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "request_impl.hpp"
@@ -32,6 +34,14 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         ')');
 }
 
+const std::string& GetKey(const std::string& key) { return key; }
+
+USERVER_NAMESPACE::redis::ReplyData MakeCachedReplyData(
+    USERVER_NAMESPACE::redis::ClientSideCache::Value value) {
+  if (!value) return USERVER_NAMESPACE::redis::ReplyData::CreateNil();
+  return USERVER_NAMESPACE::redis::ReplyData{std::move(*value)};
+}
+
 }  // namespace
 
 ClientImpl::ClientImpl(
@@ -112,10 +122,19 @@ RequestDel ClientImpl::Del(std::vector<std::string> keys,
                            const CommandControl& command_control) {
   if (keys.empty())
     return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
-  auto shard = ShardByKey(keys.at(0), command_control);
-  return CreateRequest<RequestDel>(
-      MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true,
-                  GetCommandControl(command_control)));
+  const auto keys_count = keys.size();
+  auto parts = SplitByShards(std::move(keys), GetKey, command_control);
+  auto make_request = [this, cc = GetCommandControl(command_control)](
+                          size_t shard, std::vector<std::string> keys) {
+    return MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true, cc);
+  };
+  if (parts.size() == 1) {
+    auto& part = parts.front();
+    return CreateRequest<RequestDel>(
+        make_request(part.shard, std::move(part.args)));
+  }
+  return CreateShardedRequest<RequestDel>(
+      MakeShardRequests(std::move(parts), 0, make_request), keys_count);
 }
 
 RequestUnlink ClientImpl::Unlink(std::string key,
@@ -131,10 +150,19 @@ RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestUnlink>(
         std::make_shared<Reply>("unlink", 0));
-  auto shard = ShardByKey(keys.at(0), command_control);
-  return CreateRequest<RequestUnlink>(
-      MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true,
-                  GetCommandControl(command_control)));
+  const auto keys_count = keys.size();
+  auto parts = SplitByShards(std::move(keys), GetKey, command_control);
+  auto make_request = [this, cc = GetCommandControl(command_control)](
+                          size_t shard, std::vector<std::string> keys) {
+    return MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true, cc);
+  };
+  if (parts.size() == 1) {
+    auto& part = parts.front();
+    return CreateRequest<RequestUnlink>(
+        make_request(part.shard, std::move(part.args)));
+  }
+  return CreateShardedRequest<RequestUnlink>(
+      MakeShardRequests(std::move(parts), 0, make_request), keys_count);
 }
 
 RequestEvalCommon ClientImpl::EvalCommon(
@@ -168,6 +196,11 @@ RequestScriptLoad ClientImpl::ScriptLoad(
                   GetCommandControl(command_control)));
 }
 
+Script ClientImpl::RegisterScript(std::string script) {
+  auto sha = redis_client_->RegisterScript(script);
+  return Script{std::move(script), std::move(sha)};
+}
+
 RequestExists ClientImpl::Exists(std::string key,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -271,7 +304,29 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
+  if (auto cache = redis_client_->GetClientSideCache();
+      cache && cache->IsCacheable(key)) {
+    if (auto value = cache->Get(key)) {
+      return CreateDummyRequest<RequestGet>(std::make_shared<Reply>(
+          "get", MakeCachedReplyData(std::move(*value))));
+    }
+  }
   auto shard = ShardByKey(key, command_control);
+  if (auto hot_keys = redis_client_->GetHotKeys();
+      hot_keys && hot_keys->GetCache() && hot_keys->IsHot(shard, key)) {
+    auto* cache = hot_keys->GetCache();
+    if (auto value = cache->Get(key)) {
+      return CreateDummyRequest<RequestGet>(std::make_shared<Reply>(
+          "get", MakeCachedReplyData(std::move(*value))));
+    }
+    return CreateRequestWithCallback<RequestGet>(
+        MakeRequest(CmdArgs{"get", key}, shard, false,
+                    GetCommandControl(command_control)),
+        [hot_keys = std::move(hot_keys),
+         key](const std::optional<std::string>& value) {
+          hot_keys->GetCache()->Put(key, value);
+        });
+  }
   return CreateRequest<RequestGet>(
       MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
                   GetCommandControl(command_control)));
@@ -313,7 +368,29 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field,
 
 RequestHget ClientImpl::Hget(std::string key, std::string field,
                              const CommandControl& command_control) {
+  if (auto cache = redis_client_->GetClientSideCache();
+      cache && cache->IsCacheable(key)) {
+    if (auto value = cache->Hget(key, field)) {
+      return CreateDummyRequest<RequestHget>(std::make_shared<Reply>(
+          "hget", MakeCachedReplyData(std::move(*value))));
+    }
+  }
   auto shard = ShardByKey(key, command_control);
+  if (auto hot_keys = redis_client_->GetHotKeys();
+      hot_keys && hot_keys->GetCache() && hot_keys->IsHot(shard, key)) {
+    auto* cache = hot_keys->GetCache();
+    if (auto value = cache->Hget(key, field)) {
+      return CreateDummyRequest<RequestHget>(std::make_shared<Reply>(
+          "hget", MakeCachedReplyData(std::move(*value))));
+    }
+    return CreateRequestWithCallback<RequestHget>(
+        MakeRequest(CmdArgs{"hget", key, field}, shard, false,
+                    GetCommandControl(command_control)),
+        [hot_keys = std::move(hot_keys), key,
+         field](const std::optional<std::string>& value) {
+          hot_keys->GetCache()->Hput(key, field, value);
+        });
+  }
   return CreateRequest<RequestHget>(
       MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
                   false, GetCommandControl(command_control)));
@@ -513,19 +590,28 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestMget>(
         std::make_shared<Reply>("mget", ReplyData::Array{}));
-  const auto shard = ShardByKey(keys.at(0), command_control);
-  const auto max_chunk_size =
-      command_control.chunk_size ? command_control.chunk_size : keys.size();
-  auto make_request = [this, shard,
-                       cc = GetCommandControl(command_control)](auto keys) {
+  const auto keys_count = keys.size();
+  const auto max_chunk_size = command_control.chunk_size;
+  auto parts = SplitByShards(std::move(keys), GetKey, command_control);
+  auto make_request = [this, cc = GetCommandControl(command_control)](
+                          size_t shard, std::vector<std::string> keys) {
     return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
   };
-  if (max_chunk_size >= keys.size()) {
-    return CreateRequest<RequestMget>(make_request(std::move(keys)));
+  if (parts.size() == 1) {
+    auto& part = parts.front();
+    if (!max_chunk_size || max_chunk_size >= part.args.size()) {
+      return CreateRequest<RequestMget>(
+          make_request(part.shard, std::move(part.args)));
+    }
+    return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
+        max_chunk_size, std::move(part.args),
+        [&make_request, shard = part.shard](auto keys) {
+          return make_request(shard, std::move(keys));
+        }));
   }
-  return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
-      max_chunk_size, std::move(keys),
-      [&make_request](auto keys) { return make_request(std::move(keys)); }));
+  return CreateShardedRequest<RequestMget>(
+      MakeShardRequests(std::move(parts), max_chunk_size, make_request),
+      keys_count);
 }
 
 RequestMset ClientImpl::Mset(
@@ -535,10 +621,26 @@ RequestMset ClientImpl::Mset(
     return CreateDummyRequest<RequestMset>(
         std::make_shared<USERVER_NAMESPACE::redis::Reply>(
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")));
-  auto shard = ShardByKey(key_values.at(0).first, command_control);
-  return CreateRequest<RequestMset>(
-      MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
-                  GetCommandControl(command_control)));
+  const auto keys_count = key_values.size();
+  auto parts = SplitByShards(
+      std::move(key_values),
+      [](const std::pair<std::string, std::string>& key_value)
+          -> const std::string& { return key_value.first; },
+      command_control);
+  auto make_request =
+      [this, cc = GetCommandControl(command_control)](
+          size_t shard,
+          std::vector<std::pair<std::string, std::string>> key_values) {
+        return MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
+                           cc);
+      };
+  if (parts.size() == 1) {
+    auto& part = parts.front();
+    return CreateRequest<RequestMset>(
+        make_request(part.shard, std::move(part.args)));
+  }
+  return CreateShardedRequest<RequestMset>(
+      MakeShardRequests(std::move(parts), 0, make_request), keys_count);
 }
 
 TransactionPtr ClientImpl::Multi() {
@@ -549,6 +651,11 @@ TransactionPtr ClientImpl::Multi(Transaction::CheckShards check_shards) {
   return std::make_unique<TransactionImpl>(shared_from_this(), check_shards);
 }
 
+TransactionPtr ClientImpl::Pipeline() {
+  return std::make_unique<TransactionImpl>(shared_from_this(),
+                                           TransactionImpl::Mode::kPipeline);
+}
+
 RequestPersist ClientImpl::Persist(std::string key,
                                    const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -828,6 +935,68 @@ RequestType ClientImpl::Type(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestXack ClientImpl::Xack(std::string key, std::string group,
+                             std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  if (ids.empty())
+    return CreateDummyRequest<RequestXack>(
+        std::make_shared<USERVER_NAMESPACE::redis::Reply>("xack", 0));
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXack>(MakeRequest(
+      CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)}, shard,
+      true, GetCommandControl(command_control)));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key,
+    std::vector<std::pair<std::string, std::string>> field_values,
+    const CommandControl& command_control) {
+  if (field_values.empty())
+    throw USERVER_NAMESPACE::redis::InvalidArgumentException(
+        "field_values for xadd must not be empty");
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXadd>(
+      MakeRequest(CmdArgs{"xadd", std::move(key), "*", std::move(field_values)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key, std::string group, std::string consumer,
+    std::chrono::milliseconds min_idle_time, std::string start, size_t count,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXautoclaim>(MakeRequest(
+      CmdArgs{"xautoclaim", std::move(key), std::move(group),
+              std::move(consumer), min_idle_time.count(), std::move(start),
+              "COUNT", count},
+      shard, true, GetCommandControl(command_control)));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key, std::string group, std::string id,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXgroupCreate>(
+      MakeRequest(CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group),
+                          std::move(id), "MKSTREAM"},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key, std::string group, std::string consumer, std::string id,
+    XreadgroupOptions options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  auto cc = GetCommandControl(command_control);
+  // The reply to a blocking read is expected after the block timeout
+  cc.timeout_single += options.block;
+  cc.timeout_all += options.block;
+  return CreateRequest<RequestXreadgroup>(
+      MakeRequest(CmdArgs{"xreadgroup", "GROUP", std::move(group),
+                          std::move(consumer), options, "STREAMS",
+                          std::move(key), std::move(id)},
+                  shard, true, cc));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -1068,6 +1237,13 @@ USERVER_NAMESPACE::redis::Request ClientImpl::MakeRequest(
                                     command_control, replies_to_skip);
 }
 
+USERVER_NAMESPACE::redis::Request ClientImpl::MakePipelineRequest(
+    CmdArgs&& args, size_t shard, bool master,
+    const CommandControl& command_control) {
+  return redis_client_->MakePipelineRequest(std::move(args), shard, master,
+                                            command_control);
+}
+
 CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
   return redis_client_->GetCommandControl(cc);
 }
@@ -1086,16 +1262,25 @@ size_t ClientImpl::GetPublishShard(PubShard policy) {
 
 size_t ClientImpl::ShardByKey(const std::string& key,
                               const CommandControl& cc) const {
+  size_t shard = 0;
   if (force_shard_idx_) {
     if (cc.force_shard_idx && *cc.force_shard_idx != *force_shard_idx_)
       throw USERVER_NAMESPACE::redis::InvalidArgumentException(
           "forced shard idx from CommandControl != forced shard for client (" +
           std::to_string(*cc.force_shard_idx) +
           " != " + std::to_string(*force_shard_idx_) + ')');
-    return *force_shard_idx_;
+    shard = *force_shard_idx_;
+  } else if (cc.force_shard_idx) {
+    shard = *cc.force_shard_idx;
+  } else {
+    shard = ShardByKey(key);
+  }
+
+  // All the keyed commands pass here
+  if (auto hot_keys = redis_client_->GetHotKeys()) {
+    hot_keys->Sample(shard, key);
   }
-  if (cc.force_shard_idx) return *cc.force_shard_idx;
-  return ShardByKey(key);
+  return shard;
 }
 
 void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
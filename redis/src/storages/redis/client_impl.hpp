@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -25,6 +27,14 @@ namespace storages::redis {
 
 class TransactionImpl;
 
+// A part of a multi-key command sent to a single shard, `positions` are the
+// indices of the keys of the part in the original command
+struct ShardRequest {
+  USERVER_NAMESPACE::redis::Request request;
+  size_t shard{0};
+  std::vector<size_t> positions;
+};
+
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class ClientImpl final : public Client,
                          public std::enable_shared_from_this<ClientImpl> {
@@ -84,6 +94,8 @@ class ClientImpl final : public Client,
       std::string script_hash, std::vector<std::string> keys,
       std::vector<std::string> args,
       const CommandControl& command_control) override;
+  Script RegisterScript(std::string script) override;
+
   RequestScriptLoad ScriptLoad(std::string script, size_t shard,
                                const CommandControl& command_control) override;
 
@@ -224,6 +236,8 @@ class ClientImpl final : public Client,
 
   TransactionPtr Multi(Transaction::CheckShards check_shards) override;
 
+  TransactionPtr Pipeline() override;
+
   RequestPersist Persist(std::string key,
                          const CommandControl& command_control) override;
 
@@ -333,6 +347,30 @@ class ClientImpl final : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(std::string key, std::string group,
+                               std::string consumer,
+                               std::chrono::milliseconds min_idle_time,
+                               std::string start, size_t count,
+                               const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(std::string key, std::string group,
+                               std::string consumer, std::string id,
+                               XreadgroupOptions options,
+                               const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -438,6 +476,10 @@ class ClientImpl final : public Client,
       CmdArgs&& args, size_t shard, bool master,
       const CommandControl& command_control, size_t replies_to_skip = 0);
 
+  USERVER_NAMESPACE::redis::Request MakePipelineRequest(
+      CmdArgs&& args, size_t shard, bool master,
+      const CommandControl& command_control);
+
   template <typename T, typename Func>
   auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args,
                          Func&& func) {
@@ -456,6 +498,63 @@ class ClientImpl final : public Client,
     return requests;
   }
 
+  template <typename T>
+  struct ShardArgs {
+    size_t shard{0};
+    std::vector<T> args;
+    std::vector<size_t> positions;
+  };
+
+  // Groups the arguments of a multi-key command by the shards of their keys,
+  // the parts are ordered by their first keys
+  template <typename T, typename GetKey>
+  std::vector<ShardArgs<T>> SplitByShards(std::vector<T>&& args,
+                                          GetKey&& get_key,
+                                          const CommandControl& cc) const {
+    static constexpr auto kNoPart = static_cast<size_t>(-1);
+    std::vector<ShardArgs<T>> parts;
+    std::vector<size_t> part_by_shard(ShardsCount(), kNoPart);
+
+    for (size_t i = 0; i < args.size(); ++i) {
+      const auto shard = ShardByKey(get_key(args[i]), cc);
+      if (shard >= part_by_shard.size()) {
+        part_by_shard.resize(shard + 1, kNoPart);
+      }
+      auto& part_idx = part_by_shard[shard];
+      if (part_idx == kNoPart) {
+        part_idx = parts.size();
+        parts.emplace_back().shard = shard;
+      }
+      auto& part = parts[part_idx];
+      part.args.push_back(std::move(args[i]));
+      part.positions.push_back(i);
+    }
+    return parts;
+  }
+
+  // Sends the parts at once, so that the shards execute them in parallel
+  template <typename T, typename Func>
+  std::vector<ShardRequest> MakeShardRequests(std::vector<ShardArgs<T>>&& parts,
+                                              size_t max_chunk_size,
+                                              Func&& func) {
+    std::vector<ShardRequest> requests;
+    for (auto& part : parts) {
+      const auto size = part.args.size();
+      const auto chunk_size = max_chunk_size ? max_chunk_size : size;
+      for (size_t begin = 0; begin < size; begin += chunk_size) {
+        const auto end = std::min(begin + chunk_size, size);
+        std::vector<T> args_chunk;
+        args_chunk.reserve(end - begin);
+        std::move(part.args.begin() + begin, part.args.begin() + end,
+                  std::back_inserter(args_chunk));
+        requests.push_back(
+            {func(part.shard, std::move(args_chunk)), part.shard,
+             {part.positions.begin() + begin, part.positions.begin() + end}});
+      }
+    }
+    return requests;
+  }
+
   CommandControl GetCommandControl(const CommandControl& cc) const;
 
   size_t GetPublishShard(PubShard policy);
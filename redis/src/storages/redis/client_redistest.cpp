@@ -6,6 +6,7 @@
 #include <tuple>
 #include <vector>
 
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/task/task.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -212,6 +213,33 @@ UTEST_F(RedisClientTest, EvalSha) {
   EXPECT_EQ(result_array[0], "key1");
 }
 
+UTEST_F(RedisClientTest, EvalScript) {
+  auto client = GetClient();
+
+  const auto script =
+      client->RegisterScript("return { KEYS[1], ARGV[1], 'registered' }");
+  EXPECT_EQ(script.GetSha(),
+            client->ScriptLoad(script.GetBody(), 0, {}).Get());
+  auto result = client
+                    ->EvalScript<std::vector<std::string>>(script, {"key1"},
+                                                           {"arg1"}, {})
+                    .Get();
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[0], "key1");
+  EXPECT_EQ(result[1], "arg1");
+
+  // The script is sent in full if the instance has not loaded it
+  const std::string body = "return { KEYS[1], ARGV[1], 'not loaded' }";
+  const storages::redis::Script not_loaded{body, crypto::hash::Sha1(body)};
+  result = client
+               ->EvalScript<std::vector<std::string>>(not_loaded, {"key1"},
+                                                      {"arg2"}, {})
+               .Get();
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(result[1], "arg2");
+  EXPECT_EQ(result[2], "not loaded");
+}
+
 UTEST_F(RedisClientTest, Exists) {
   auto client = GetClient();
   client->Set("key1", "Hello", {}).Get();
@@ -683,6 +711,60 @@ UTEST_F(RedisClientTest, Type) {
   EXPECT_EQ(client->Type("key2", {}).Get(), storages::redis::KeyType::kList);
 }
 
+UTEST_F(RedisClientTest, Streams) {
+  auto client = GetClient();
+
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "0", {}).Get(),
+            storages::redis::XgroupCreateReply::kCreated);
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "0", {}).Get(),
+            storages::redis::XgroupCreateReply::kAlreadyExists);
+
+  const auto id1 = client->Xadd("stream", {{"field", "value1"}}, {}).Get();
+  const auto id2 = client->Xadd("stream", {{"field", "value2"}}, {}).Get();
+
+  storages::redis::XreadgroupOptions options;
+  options.count = 1;
+  auto entries =
+      client->Xreadgroup("stream", "group", "consumer1", ">", options, {})
+          .Get();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].id, id1);
+  ASSERT_EQ(entries[0].field_values.size(), 1);
+  EXPECT_EQ(entries[0].field_values[0].second, "value1");
+
+  options.count = 0;
+  entries = client->Xreadgroup("stream", "group", "consumer1", ">", options, {})
+                .Get();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].id, id2);
+
+  // Nothing new in the stream
+  options.block = std::chrono::milliseconds{10};
+  EXPECT_TRUE(
+      client->Xreadgroup("stream", "group", "consumer1", ">", options, {})
+          .Get()
+          .empty());
+
+  EXPECT_EQ(client->Xack("stream", "group", {id1}, {}).Get(), 1);
+  EXPECT_EQ(client->Xack("stream", "group", {}, {}).Get(), 0);
+
+  // Only the second entry is left pending
+  const auto claimed =
+      client
+          ->Xautoclaim("stream", "group", "consumer2",
+                       std::chrono::milliseconds{0}, "0-0", 10, {})
+          .Get();
+  EXPECT_EQ(claimed.next_start_id, "0-0");
+  ASSERT_EQ(claimed.entries.size(), 1);
+  EXPECT_EQ(claimed.entries[0].id, id2);
+
+  options.block = std::chrono::milliseconds{0};
+  entries = client->Xreadgroup("stream", "group", "consumer2", "0", options, {})
+                .Get();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].id, id2);
+}
+
 UTEST_F(RedisClientTest, Zadd) {
   auto client = GetClient();
 
@@ -1,5 +1,6 @@
 #include <userver/storages/redis/component.hpp>
 
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -23,6 +24,8 @@
 #include <userver/storages/redis/redis_config.hpp>
 #include <userver/storages/redis/subscribe_client.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
+#include <storages/redis/impl/hot_keys.hpp>
 #include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
@@ -69,8 +72,39 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  std::optional<redis::ClientSideCacheSettings> client_side_cache;
+  std::optional<redis::HotKeysSettings> hot_keys;
 };
 
+std::optional<redis::ClientSideCacheSettings> ParseClientSideCacheSettings(
+    const yaml_config::YamlConfig& value) {
+  if (!value["enabled"].As<bool>(false)) return std::nullopt;
+
+  redis::ClientSideCacheSettings settings;
+  settings.max_size = value["max_size"].As<size_t>(settings.max_size);
+  settings.ways = value["ways"].As<size_t>(settings.ways);
+  settings.ttl = value["ttl"].As<std::chrono::milliseconds>(settings.ttl);
+  settings.broadcast_prefixes =
+      value["broadcast_prefixes"].As<std::vector<std::string>>({});
+  return settings;
+}
+
+std::optional<redis::HotKeysSettings> ParseHotKeysSettings(
+    const yaml_config::YamlConfig& value) {
+  if (!value["enabled"].As<bool>(false)) return std::nullopt;
+
+  redis::HotKeysSettings settings;
+  settings.top_size = value["top_size"].As<size_t>(settings.top_size);
+  settings.sample_rate = value["sample_rate"].As<size_t>(settings.sample_rate);
+  settings.hot_share = value["hot_share"].As<double>(settings.hot_share);
+  settings.decay_period =
+      value["decay_period"].As<std::chrono::milliseconds>(
+          settings.decay_period);
+  settings.cache_ttl =
+      value["cache_ttl"].As<std::chrono::milliseconds>(settings.cache_ttl);
+  return settings;
+}
+
 RedisGroup Parse(const yaml_config::YamlConfig& value,
                  formats::parse::To<RedisGroup>) {
   RedisGroup config;
@@ -79,6 +113,9 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.client_side_cache =
+      ParseClientSideCacheSettings(value["client_side_cache"]);
+  config.hot_keys = ParseHotKeysSettings(value["hot_keys"]);
   return config;
 }
 
@@ -193,6 +230,14 @@ void Redis::Connect(const ComponentConfig& config,
         redis_group.db, redis::KeyShardFactory{redis_group.sharding_strategy},
         cc, testsuite_redis_control, dns_resolver);
     if (sentinel) {
+      if (redis_group.client_side_cache) {
+        sentinel->SetClientSideCache(std::make_shared<redis::ClientSideCache>(
+            *redis_group.client_side_cache));
+      }
+      if (redis_group.hot_keys) {
+        sentinel->SetHotKeys(std::make_shared<redis::HotKeys>(
+            *redis_group.hot_keys, sentinel->ShardsCount()));
+      }
       sentinels_.emplace(redis_group.db, sentinel);
       const auto& client =
           std::make_shared<storages::redis::ClientImpl>(sentinel);
@@ -251,6 +296,14 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
   for (const auto& [name, redis] : sentinels_) {
     writer.ValueWithLabels(redis->GetStatistics(*settings),
                            {"redis_database", name});
+    if (auto cache = redis->GetClientSideCache()) {
+      writer["client-side-cache"].ValueWithLabels(cache->GetStatistics(),
+                                                  {"redis_database", name});
+    }
+    if (auto hot_keys = redis->GetHotKeys()) {
+      writer["hot-keys"].ValueWithLabels(hot_keys->GetStatistics(),
+                                         {"redis_database", name});
+    }
   }
   auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
   DumpThreadPoolMetric(threads_writer, *thread_pools_->GetRedisThreadPool());
@@ -352,6 +405,62 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache:
+                    type: object
+                    description: in-process cache of GET and HGET replies invalidated by RESP3 CLIENT TRACKING
+                    additionalProperties: false
+                    properties:
+                        enabled:
+                            type: boolean
+                            description: enables the cache
+                            defaultDescription: false
+                        max_size:
+                            type: integer
+                            description: maximum number of cached keys
+                            defaultDescription: 10000
+                        ways:
+                            type: integer
+                            description: number of independently locked parts of the cache
+                            defaultDescription: 16
+                        ttl:
+                            type: string
+                            description: upper bound of staleness if an invalidation is lost
+                            defaultDescription: 10s
+                        broadcast_prefixes:
+                            type: array
+                            description: use broadcast tracking and cache only the keys with these prefixes
+                            items:
+                                type: string
+                                description: key prefix
+                hot_keys:
+                    type: object
+                    description: detection of the most frequent command keys of every shard
+                    additionalProperties: false
+                    properties:
+                        enabled:
+                            type: boolean
+                            description: enables the detection
+                            defaultDescription: false
+                        top_size:
+                            type: integer
+                            description: number of the most frequent keys tracked per shard
+                            defaultDescription: 32
+                        sample_rate:
+                            type: integer
+                            description: one of this many keyed commands is sampled
+                            defaultDescription: 16
+                        hot_share:
+                            type: number
+                            description: share of the sampled commands of a shard that makes a key hot
+                            defaultDescription: 0.05
+                        decay_period:
+                            type: string
+                            description: the counters are halved with this period
+                            defaultDescription: 10s
+                        cache_ttl:
+                            type: string
+                            description: GET and HGET of the hot keys are served from an in-process cache for this long, 0 disables the cache
+                            defaultDescription: 0s
     subscribe_groups:
         type: array
         description: array of redis clusters to work with in subscribe mode
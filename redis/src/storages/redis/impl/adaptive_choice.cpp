@@ -0,0 +1,26 @@
+#include "adaptive_choice.hpp"
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+// Keeps the number of running commands meaningful for the instances that
+// reply faster than they can be measured or have not replied yet
+constexpr std::chrono::microseconds kMinReplyTime{100};
+
+}  // namespace
+
+double GetAdaptiveCost(size_t running_commands,
+                       std::chrono::microseconds reply_time_ewma) {
+  const auto reply_time = std::max(reply_time_ewma, kMinReplyTime);
+  return static_cast<double>(running_commands + 1) *
+         static_cast<double>(reply_time.count());
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
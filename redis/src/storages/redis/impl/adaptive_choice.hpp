@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// Cost of sending a command to an instance with
+/// CommandControl::Strategy::kAdaptive: the expected time to get the reply if
+/// the running commands are processed one by one.
+double GetAdaptiveCost(size_t running_commands,
+                       std::chrono::microseconds reply_time_ewma);
+
+/// Chooses the cheaper of two random candidates ("power of two choices"),
+/// which spreads the load like choosing the cheapest candidate does, but
+/// without sending all the requests to the same instance until its cost is
+/// updated. `cost(i)` returns the cost of the i-th candidate or std::nullopt
+/// if the candidate can not be used.
+template <typename CostFunc>
+std::optional<size_t> ChooseOfTwoRandom(size_t candidates_count,
+                                        CostFunc cost) {
+  if (candidates_count == 0) return std::nullopt;
+
+  // First candidate is the first usable one starting from a random position
+  const auto start = utils::RandRange(candidates_count);
+  std::optional<size_t> first;
+  std::optional<double> first_cost;
+  for (size_t i = 0; i < candidates_count && !first; ++i) {
+    const auto idx = (start + i) % candidates_count;
+    first_cost = cost(idx);
+    if (first_cost) first = idx;
+  }
+  if (!first) return std::nullopt;
+
+  // Second candidate is the first usable one among the others, starting from
+  // a random position
+  const auto others_count = candidates_count - 1;
+  const auto others_start = others_count ? utils::RandRange(others_count) : 0;
+  for (size_t i = 0; i < others_count; ++i) {
+    const auto idx =
+        (*first + 1 + (others_start + i) % others_count) % candidates_count;
+    const auto second_cost = cost(idx);
+    if (!second_cost) continue;
+    return *second_cost < *first_cost ? idx : *first;
+  }
+  return first;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
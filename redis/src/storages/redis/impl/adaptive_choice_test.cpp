@@ -0,0 +1,73 @@
+#include "adaptive_choice.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using redis::ChooseOfTwoRandom;
+
+namespace {
+
+constexpr size_t kTrials = 1000;
+
+auto MakeCostFunc(const std::vector<std::optional<double>>& costs) {
+  return [&costs](size_t idx) { return costs.at(idx); };
+}
+
+}  // namespace
+
+TEST(AdaptiveChoice, NoUsableCandidates) {
+  const std::vector<std::optional<double>> empty;
+  EXPECT_FALSE(ChooseOfTwoRandom(empty.size(), MakeCostFunc(empty)));
+
+  const std::vector<std::optional<double>> unusable(3);
+  EXPECT_FALSE(ChooseOfTwoRandom(unusable.size(), MakeCostFunc(unusable)));
+}
+
+TEST(AdaptiveChoice, SingleUsableCandidate) {
+  const std::vector<std::optional<double>> costs{std::nullopt, 10.0,
+                                                 std::nullopt};
+  for (size_t i = 0; i < kTrials; ++i) {
+    EXPECT_EQ(1, ChooseOfTwoRandom(costs.size(), MakeCostFunc(costs)));
+  }
+}
+
+TEST(AdaptiveChoice, CheaperOfTwo) {
+  const std::vector<std::optional<double>> costs{20.0, 10.0};
+  for (size_t i = 0; i < kTrials; ++i) {
+    EXPECT_EQ(1, ChooseOfTwoRandom(costs.size(), MakeCostFunc(costs)));
+  }
+}
+
+TEST(AdaptiveChoice, CostliestIsNeverChosen) {
+  const std::vector<std::optional<double>> costs{10.0, 30.0, std::nullopt,
+                                                 20.0};
+  std::vector<size_t> chosen(costs.size(), 0);
+  for (size_t i = 0; i < kTrials; ++i) {
+    const auto idx = ChooseOfTwoRandom(costs.size(), MakeCostFunc(costs));
+    ASSERT_TRUE(idx);
+    ++chosen[*idx];
+  }
+
+  EXPECT_EQ(0, chosen[1]);
+  EXPECT_EQ(0, chosen[2]);
+  EXPECT_GT(chosen[0], chosen[3]);
+  EXPECT_GT(chosen[3], 0);
+}
+
+TEST(AdaptiveChoice, Cost) {
+  using std::chrono::microseconds;
+  using redis::GetAdaptiveCost;
+
+  EXPECT_LT(GetAdaptiveCost(0, microseconds{1000}),
+            GetAdaptiveCost(1, microseconds{1000}));
+  EXPECT_LT(GetAdaptiveCost(1, microseconds{1000}),
+            GetAdaptiveCost(1, microseconds{2000}));
+  // Instances without replies yet are not preferred over the fast ones
+  EXPECT_EQ(GetAdaptiveCost(0, microseconds{0}),
+            GetAdaptiveCost(0, microseconds{10}));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include "client_side_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+ClientSideCache::ClientSideCache(ClientSideCacheSettings settings)
+    : settings_(std::move(settings)) {
+  if (settings_.ways == 0 || settings_.max_size == 0) {
+    throw std::logic_error(
+        "Client-side cache must have positive max size and number of ways");
+  }
+  const auto way_size =
+      std::max<size_t>(1, (settings_.max_size + settings_.ways - 1) /
+                              settings_.ways);
+  ways_.reserve(settings_.ways);
+  for (size_t i = 0; i < settings_.ways; ++i) {
+    ways_.push_back(std::make_unique<Way>(way_size));
+  }
+}
+
+bool ClientSideCache::IsCacheable(const std::string& key) const {
+  const auto& prefixes = settings_.broadcast_prefixes;
+  if (prefixes.empty()) return true;
+  return std::any_of(prefixes.begin(), prefixes.end(),
+                     [&key](const std::string& prefix) {
+                       return key.compare(0, prefix.size(), prefix) == 0;
+                     });
+}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Get(
+    const std::string& key) {
+  return DoGet(key, [](const Entry& entry) { return entry.value; });
+}
+
+std::optional<ClientSideCache::Value> ClientSideCache::Hget(
+    const std::string& key, const std::string& field) {
+  return DoGet(key, [&field](const Entry& entry) -> std::optional<Value> {
+    const auto it = entry.fields.find(field);
+    if (it == entry.fields.end()) return std::nullopt;
+    return it->second;
+  });
+}
+
+void ClientSideCache::Put(const std::string& key, Value value) {
+  auto& way = GetWay(key);
+  std::lock_guard lock(way.mutex);
+  GetEntry(way, key).value = std::move(value);
+}
+
+void ClientSideCache::Hput(const std::string& key, const std::string& field,
+                           Value value) {
+  auto& way = GetWay(key);
+  std::lock_guard lock(way.mutex);
+  GetEntry(way, key).fields[field] = std::move(value);
+}
+
+void ClientSideCache::Invalidate(const std::string& key) {
+  ++invalidations_;
+  auto& way = GetWay(key);
+  std::lock_guard lock(way.mutex);
+  way.entries.Erase(key);
+}
+
+void ClientSideCache::InvalidateAll() {
+  ++flushes_;
+  for (auto& way : ways_) {
+    std::lock_guard lock(way->mutex);
+    way->entries.Clear();
+  }
+}
+
+std::vector<std::string> ClientSideCache::GetTrackingArgs() const {
+  std::vector<std::string> args{"CLIENT", "TRACKING", "ON"};
+  if (!settings_.broadcast_prefixes.empty()) {
+    args.emplace_back("BCAST");
+    for (const auto& prefix : settings_.broadcast_prefixes) {
+      args.emplace_back("PREFIX");
+      args.push_back(prefix);
+    }
+  }
+  return args;
+}
+
+ClientSideCacheStatistics ClientSideCache::GetStatistics() const {
+  ClientSideCacheStatistics stats;
+  stats.hits = hits_.load();
+  stats.misses = misses_.load();
+  stats.invalidations = invalidations_.load();
+  stats.flushes = flushes_.load();
+  for (const auto& way : ways_) {
+    std::lock_guard lock(way->mutex);
+    stats.size += way->entries.GetSize();
+  }
+  return stats;
+}
+
+ClientSideCache::Way& ClientSideCache::GetWay(const std::string& key) {
+  return *ways_[std::hash<std::string>{}(key) % ways_.size()];
+}
+
+ClientSideCache::Entry& ClientSideCache::GetEntry(Way& way,
+                                                  const std::string& key) {
+  auto* entry = way.entries.Get(key);
+  if (!entry || entry->expires_at <= Clock::now()) {
+    // Fields of an expired entry must not outlive it
+    way.entries.Put(key, Entry{Clock::now() + settings_.ttl, {}, {}});
+    entry = way.entries.Get(key);
+  }
+  return *entry;
+}
+
+template <typename Getter>
+std::optional<ClientSideCache::Value> ClientSideCache::DoGet(
+    const std::string& key, Getter getter) {
+  std::optional<Value> result;
+  {
+    auto& way = GetWay(key);
+    std::lock_guard lock(way.mutex);
+    auto* entry = way.entries.Get(key);
+    if (entry) {
+      if (entry->expires_at > Clock::now()) {
+        result = getter(*entry);
+      } else {
+        way.entries.Erase(key);
+      }
+    }
+  }
+  ++(result ? hits_ : misses_);
+  return result;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ClientSideCacheStatistics& stats) {
+  writer["hits"] = stats.hits;
+  writer["misses"] = stats.misses;
+  writer["invalidations"] = stats.invalidations;
+  writer["flushes"] = stats.flushes;
+  writer["size"] = stats.size;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+struct ClientSideCacheSettings {
+  /// Maximum number of cached keys
+  size_t max_size{10000};
+  /// Number of independently locked parts of the cache
+  size_t ways{16};
+  /// Upper bound of staleness if an invalidation is lost
+  std::chrono::milliseconds ttl{std::chrono::seconds{10}};
+  /// Use broadcast tracking for the keys with these prefixes instead of
+  /// tracking the keys that were read. Other keys are not cached.
+  std::vector<std::string> broadcast_prefixes;
+};
+
+struct ClientSideCacheStatistics {
+  uint64_t hits{0};
+  uint64_t misses{0};
+  uint64_t invalidations{0};
+  uint64_t flushes{0};
+  size_t size{0};
+};
+
+/// In-process cache of GET and HGET replies kept coherent with the server by
+/// RESP3 CLIENT TRACKING invalidations.
+///
+/// The cache is filled on the event threads by the connections that have
+/// tracking enabled, in order with the invalidations they receive, and is
+/// flushed if any of these connections is lost.
+class ClientSideCache final {
+ public:
+  /// Cached value, std::nullopt for a missing key or field
+  using Value = std::optional<std::string>;
+
+  explicit ClientSideCache(ClientSideCacheSettings settings);
+
+  const ClientSideCacheSettings& GetSettings() const { return settings_; }
+
+  /// Whether the key may be cached with the current tracking mode
+  bool IsCacheable(const std::string& key) const;
+
+  std::optional<Value> Get(const std::string& key);
+  std::optional<Value> Hget(const std::string& key, const std::string& field);
+
+  void Put(const std::string& key, Value value);
+  void Hput(const std::string& key, const std::string& field, Value value);
+
+  void Invalidate(const std::string& key);
+  void InvalidateAll();
+
+  /// Arguments of the CLIENT TRACKING command for the settings
+  std::vector<std::string> GetTrackingArgs() const;
+
+  ClientSideCacheStatistics GetStatistics() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    Clock::time_point expires_at;
+    std::optional<Value> value;
+    std::unordered_map<std::string, Value> fields;
+  };
+
+  struct Way {
+    explicit Way(size_t max_size) : entries(max_size) {}
+
+    std::mutex mutex;
+    cache::LruMap<std::string, Entry> entries;
+  };
+
+  Way& GetWay(const std::string& key);
+  Entry& GetEntry(Way& way, const std::string& key);
+
+  template <typename Getter>
+  std::optional<Value> DoGet(const std::string& key, Getter getter);
+
+  const ClientSideCacheSettings settings_;
+  std::vector<std::unique_ptr<Way>> ways_;
+
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> invalidations_{0};
+  std::atomic<uint64_t> flushes_{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ClientSideCacheStatistics& stats);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#include "client_side_cache.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using redis::ClientSideCache;
+using redis::ClientSideCacheSettings;
+
+TEST(ClientSideCache, GetPut) {
+  ClientSideCache cache{ClientSideCacheSettings{}};
+
+  EXPECT_FALSE(cache.Get("key"));
+  cache.Put("key", "value");
+  cache.Put("missing", std::nullopt);
+
+  EXPECT_EQ(ClientSideCache::Value{"value"}, cache.Get("key"));
+  const auto missing = cache.Get("missing");
+  ASSERT_TRUE(missing);
+  EXPECT_FALSE(*missing);
+
+  const auto stats = cache.GetStatistics();
+  EXPECT_EQ(2, stats.hits);
+  EXPECT_EQ(1, stats.misses);
+  EXPECT_EQ(2, stats.size);
+}
+
+TEST(ClientSideCache, HashFields) {
+  ClientSideCache cache{ClientSideCacheSettings{}};
+
+  cache.Hput("hash", "a", "1");
+  cache.Hput("hash", "b", std::nullopt);
+
+  EXPECT_EQ(ClientSideCache::Value{"1"}, cache.Hget("hash", "a"));
+  const auto missing = cache.Hget("hash", "b");
+  ASSERT_TRUE(missing);
+  EXPECT_FALSE(*missing);
+  EXPECT_FALSE(cache.Hget("hash", "c"));
+  EXPECT_FALSE(cache.Get("hash"));
+}
+
+TEST(ClientSideCache, Invalidate) {
+  ClientSideCache cache{ClientSideCacheSettings{}};
+
+  cache.Put("a", "1");
+  cache.Hput("b", "field", "2");
+  cache.Invalidate("a");
+  EXPECT_FALSE(cache.Get("a"));
+  EXPECT_TRUE(cache.Hget("b", "field"));
+
+  cache.Put("a", "1");
+  cache.InvalidateAll();
+  EXPECT_FALSE(cache.Get("a"));
+  EXPECT_FALSE(cache.Hget("b", "field"));
+
+  const auto stats = cache.GetStatistics();
+  EXPECT_EQ(1, stats.invalidations);
+  EXPECT_EQ(1, stats.flushes);
+  EXPECT_EQ(0, stats.size);
+}
+
+TEST(ClientSideCache, Ttl) {
+  ClientSideCacheSettings settings;
+  settings.ttl = std::chrono::milliseconds{10};
+  ClientSideCache cache{settings};
+
+  cache.Put("key", "value");
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  EXPECT_FALSE(cache.Get("key"));
+}
+
+TEST(ClientSideCache, MaxSize) {
+  ClientSideCacheSettings settings;
+  settings.max_size = 4;
+  settings.ways = 2;
+  ClientSideCache cache{settings};
+
+  for (int i = 0; i < 100; ++i) cache.Put(std::to_string(i), "value");
+  EXPECT_LE(cache.GetStatistics().size, 4);
+}
+
+TEST(ClientSideCache, Broadcast) {
+  ClientSideCacheSettings settings;
+  settings.broadcast_prefixes = {"user:", "config:"};
+  ClientSideCache cache{settings};
+
+  EXPECT_TRUE(cache.IsCacheable("user:1"));
+  EXPECT_TRUE(cache.IsCacheable("config:"));
+  EXPECT_FALSE(cache.IsCacheable("session:1"));
+
+  const std::vector<std::string> expected{
+      "CLIENT", "TRACKING", "ON",     "BCAST",  "PREFIX",
+      "user:",  "PREFIX",   "config:"};
+  EXPECT_EQ(expected, cache.GetTrackingArgs());
+}
+
+TEST(ClientSideCache, Tracking) {
+  ClientSideCache cache{ClientSideCacheSettings{}};
+
+  EXPECT_TRUE(cache.IsCacheable("any"));
+  const std::vector<std::string> expected{"CLIENT", "TRACKING", "ON"};
+  EXPECT_EQ(expected, cache.GetTrackingArgs());
+}
+
+TEST(ClientSideCache, InvalidSettings) {
+  ClientSideCacheSettings settings;
+  settings.ways = 0;
+  EXPECT_THROW(ClientSideCache{settings}, std::logic_error);
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <fmt/format.h>
 #include <atomic>
+#include <charconv>
+#include <optional>
 #include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
@@ -60,6 +62,22 @@ std::string ParseMovedShard(const std::string& err_string) {
   return err_string.substr(pos, colon_pos - pos) + ":" + std::to_string(port);
 }
 
+std::optional<uint16_t> ParseMovedSlot(const std::string& err_string) {
+  const size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
+  if (pos == std::string::npos) return std::nullopt;
+  const size_t end = err_string.find(' ', pos + 1);
+  if (end == std::string::npos) return std::nullopt;
+
+  uint16_t slot = 0;
+  const auto* slot_end = err_string.data() + end;
+  const auto [ptr, ec] =
+      std::from_chars(err_string.data() + pos + 1, slot_end, slot);
+  if (ec != std::errc{} || ptr != slot_end || slot >= kClusterHashSlots) {
+    return std::nullopt;
+  }
+  return slot;
+}
+
 struct CommandSpecialPrinter {
   const CommandPtr& command;
 };
@@ -215,6 +233,30 @@ class ClusterTopologyHolder {
 
   void SendUpdateClusterTopology() { update_topology_watch_.Send(); }
 
+  /// Moves the slot to the shard of the master at `host_port` without a full
+  /// topology update. Returns false if there is no such master in the current
+  /// topology.
+  bool UpdateSlot(uint16_t slot, const std::string& host_port) {
+    {
+      const auto topology = topology_.Read();
+      const auto shard_index = topology->FindShardIndexByMaster(host_port);
+      if (!shard_index) return false;
+      // Other requests to the same slot may have already updated it
+      if (topology->GetShardIndexBySlot(slot) == *shard_index) return true;
+    }
+
+    auto topology = topology_.StartWrite();
+    const auto shard_index = topology->FindShardIndexByMaster(host_port);
+    if (!shard_index) return false;
+    topology->SetShardIndexForSlot(slot, *shard_index);
+    topology.Commit();
+    return true;
+  }
+
+  size_t GetTopologyUpdatesCount() const {
+    return current_topology_version_.load();
+  }
+
   std::shared_ptr<Redis> GetRedisInstance(const std::string& host_port) const {
     return std::const_pointer_cast<Redis>(nodes_.Get(host_port)->Get());
   }
@@ -246,6 +288,20 @@ class ClusterTopologyHolder {
     }
   }
 
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> client_side_cache) {
+    client_side_cache_.Set(client_side_cache);
+    for (const auto& node : nodes_) {
+      node.second->SetClientSideCache(client_side_cache);
+    }
+  }
+
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache) {
+    script_cache_.Set(script_cache);
+    for (const auto& node : nodes_) {
+      node.second->SetScriptCache(script_cache);
+    }
+  }
+
   static size_t GetClusterSlotsCalledCounter() {
     return cluster_slots_call_counter_.load(std::memory_order_relaxed);
   }
@@ -296,6 +352,8 @@ class ClusterTopologyHolder {
       commands_buffering_settings_;
   concurrent::Variable<ReplicationMonitoringSettings, std::mutex>
       monitoring_settings_;
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
+  utils::SwappingSmart<ScriptCache> script_cache_;
 
   static std::atomic<size_t> cluster_slots_call_counter_;
 };
@@ -453,7 +511,8 @@ ClusterTopologyHolder::CreateRedisInstance(const std::string& host_port) {
   return std::make_shared<RedisConnectionHolder>(
       ev_thread_, redis_thread_pool_, host, port, password_,
       buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
-      *replication_monitoring_settings_ptr);
+      *replication_monitoring_settings_ptr, client_side_cache_.Get(),
+      script_cache_.Get());
 }
 
 void ClusterTopologyHolder::UpdateClusterTopology() {
@@ -593,6 +652,7 @@ void ClusterSentinelImpl::Init() { topology_holder_->Init(); }
 void ClusterSentinelImpl::AsyncCommand(const SentinelCommand& scommand,
                                        size_t prev_instance_idx) {
   if (!AdjustDeadline(scommand, dynamic_config_source_)) {
+    statistics_internal_.deadline_cancelled++;
     auto reply = std::make_shared<Reply>("", ReplyData::CreateNil());
     reply->status = ReplyStatus::kTimeoutError;
     InvokeCommand(scommand.command, std::move(reply));
@@ -617,15 +677,25 @@ void ClusterSentinelImpl::AsyncCommand(const SentinelCommand& scommand,
         const bool error_ask = reply->data.IsErrorAsk();
         const bool error_moved = reply->data.IsErrorMoved();
         if (error_moved) {
-          auto topology = topology_holder_->GetTopology();
+          ++cluster_statistics_internal_.moved_redirects;
 
           const auto& args = ccommand->args.args;
+          const auto& moved_to = ParseMovedShard(reply->data.GetError());
           LOG_DEBUG() << "MOVED" << reply->status_string
                       << " c.instance_idx:" << ccommand->instance_idx
-                      << " shard: " << shard
-                      << " movedto:" << ParseMovedShard(reply->data.GetError())
+                      << " shard: " << shard << " movedto:" << moved_to
                       << " args:" << args;
-          this->topology_holder_->SendUpdateClusterTopology();
+          // Slot migration to a known master needs no full topology update,
+          // the other slots are updated by their MOVED replies or by the
+          // periodic topology update
+          const auto slot = ParseMovedSlot(reply->data.GetError());
+          if (slot && topology_holder_->UpdateSlot(*slot, moved_to)) {
+            ++cluster_statistics_internal_.slot_updates;
+          } else {
+            topology_holder_->SendUpdateClusterTopology();
+          }
+        } else if (error_ask) {
+          ++cluster_statistics_internal_.ask_redirects;
         }
         const bool retry_to_master =
             !master && reply->data.IsNil() &&
@@ -667,8 +737,17 @@ void ClusterSentinelImpl::AsyncCommand(const SentinelCommand& scommand,
             command_control.timeout_all = timeout_all;
             command_control.max_retries = retries_left;
 
+            auto callback = command->Callback();
+            if (moved_to_instance) {
+              // The reply goes directly to the callback
+              callback = [this, start, callback = std::move(callback)](
+                             const CommandPtr& cmd, ReplyPtr reply) {
+                cluster_statistics_internal_.AccountRedirectedReply(start);
+                callback(cmd, std::move(reply));
+              };
+            }
             auto new_command = PrepareCommand(
-                std::move(ccommand->args), command->Callback(), command_control,
+                std::move(ccommand->args), std::move(callback), command_control,
                 command->counter + 1, command->asking || error_ask, 0,
                 error_ask || error_moved);
             new_command->log_extra = std::move(command->log_extra);
@@ -761,6 +840,20 @@ void ClusterSentinelImpl::SetReplicationMonitoringSettings(
   }
 }
 
+void ClusterSentinelImpl::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  if (topology_holder_) {
+    topology_holder_->SetClientSideCache(std::move(client_side_cache));
+  }
+}
+
+void ClusterSentinelImpl::SetScriptCache(
+    std::shared_ptr<ScriptCache> script_cache) {
+  if (topology_holder_) {
+    topology_holder_->SetScriptCache(std::move(script_cache));
+  }
+}
+
 SentinelStatistics ClusterSentinelImpl::GetStatistics(
     const MetricsSettings& settings) const {
   if (!topology_holder_) {
@@ -769,6 +862,8 @@ SentinelStatistics ClusterSentinelImpl::GetStatistics(
 
   SentinelStatistics stats(settings, statistics_internal_);
   topology_holder_->GetStatistics(stats, settings);
+  stats.cluster.emplace(cluster_statistics_internal_,
+                        topology_holder_->GetTopologyUpdatesCount());
   return stats;
 }
 
@@ -71,6 +71,9 @@ class ClusterSentinelImpl : public SentinelImplBase {
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings)
       override;
+  void SetClientSideCache(
+      std::shared_ptr<ClientSideCache> client_side_cache) override;
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache) override;
 
   static size_t GetClusterSlotsCalledCounter();
 
@@ -100,6 +103,7 @@ class ClusterSentinelImpl : public SentinelImplBase {
   std::mutex command_mutex_;
 
   SentinelStatisticsInternal statistics_internal_;
+  ClusterStatisticsInternal cluster_statistics_internal_;
 
   dynamic_config::Source dynamic_config_source_;
 };
@@ -3,6 +3,8 @@
 #include <memory>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/adaptive_choice.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
@@ -60,7 +62,12 @@ bool ClusterShard::AsyncCommand(CommandPtr command) {
   RedisPtr instance;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
     const size_t skip_idx = (attempt == 0) ? command->instance_idx : -1;
-    instance = GetInstance(available_servers, skip_idx);
+    instance = nullptr;
+    if (attempt == 0 &&
+        command->control.strategy == CommandControl::Strategy::kAdaptive) {
+      instance = GetAdaptiveInstance(available_servers, skip_idx);
+    }
+    if (!instance) instance = GetInstance(available_servers, skip_idx);
     if (!instance) {
       continue;
     }
@@ -170,6 +177,7 @@ std::vector<std::shared_ptr<Redis>> ClusterShard::GetAvailableServers(
   switch (command_control.strategy) {
     case CommandControl::Strategy::kEveryDc:
     case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kAdaptive:
       break;
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing: {
@@ -199,6 +207,22 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
   return ret;
 }
 
+ClusterShard::RedisPtr ClusterShard::GetAdaptiveInstance(
+    const std::vector<RedisPtr>& instances, size_t skip_idx) {
+  const auto idx = ChooseOfTwoRandom(
+      instances.size(), [&](size_t i) -> std::optional<double> {
+        const auto& cur_inst = instances[i];
+        if (skip_idx == ToInstanceIdx(cur_inst) || !cur_inst ||
+            cur_inst->IsDestroying() ||
+            (cur_inst->GetState() != Redis::State::kConnected) ||
+            cur_inst->IsSyncing())
+          return std::nullopt;
+        return GetAdaptiveCost(cur_inst->GetRunningCommands(),
+                               cur_inst->GetReplyTimeEwma());
+      });
+  return idx ? instances[*idx] : nullptr;
+}
+
 bool ClusterShard::IsMasterReady() const {
   return master_ && master_->GetState() == Redis::State::kConnected;
 }
@@ -61,6 +61,8 @@ class ClusterShard {
       bool with_slaves, size_t current);
   static RedisPtr GetInstance(const std::vector<RedisPtr>& instances,
                               size_t skip_idx);
+  static RedisPtr GetAdaptiveInstance(const std::vector<RedisPtr>& instances,
+                                      size_t skip_idx);
   bool IsMasterReady() const;
   bool IsReplicaReady() const;
 
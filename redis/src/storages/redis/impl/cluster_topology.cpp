@@ -4,6 +4,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+namespace {
+
+std::string HostPortToString(const std::pair<std::string, int>& host_port) {
+  return host_port.first + ":" + std::to_string(host_port.second);
+}
+
+}  // namespace
+
 ClusterTopology::ClusterTopology(
     size_t version, std::chrono::steady_clock::time_point timestamp,
     ClusterShardHostInfos infos, Password password,
@@ -14,9 +22,6 @@ ClusterTopology::ClusterTopology(
       version_(version),
       timestamp_(timestamp) {
   {
-    auto HostPortToString = [](const std::pair<std::string, int> host_port) {
-      return host_port.first + ":" + std::to_string(host_port.second);
-    };
     cluster_shards_.reserve(infos_.size());
     size_t shard_index = 0;
     for (const auto& info : infos_) {
@@ -49,6 +54,14 @@ ClusterTopology::ClusterTopology(
 
 ClusterTopology::~ClusterTopology() = default;
 
+std::optional<size_t> ClusterTopology::FindShardIndexByMaster(
+    const std::string& host_port) const {
+  for (size_t i = 0; i < infos_.size(); ++i) {
+    if (HostPortToString(infos_[i].master.HostPort()) == host_port) return i;
+  }
+  return std::nullopt;
+}
+
 bool ClusterTopology::IsReady(WaitConnectedMode mode) const {
   return !cluster_shards_.empty() &&
          std::all_of(
@@ -3,6 +3,8 @@
 #include <array>
 #include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <userver/rcu/rcu_map.hpp>
@@ -48,6 +50,16 @@ class ClusterTopology {
     return cluster_shards_.at(index);
   }
 
+  /// Returns the index of the shard with the master at `host_port`
+  std::optional<size_t> FindShardIndexByMaster(
+      const std::string& host_port) const;
+
+  /// Moves the slot to another shard without rebuilding the topology, e.g.
+  /// on a MOVED reply during resharding
+  void SetShardIndexForSlot(uint16_t slot, size_t shard_index) {
+    slot_to_shard_.at(slot) = shard_index;
+  }
+
   bool IsReady(WaitConnectedMode mode) const;
 
   bool HasSameInfos(const ClusterShardHostInfos& infos) const;
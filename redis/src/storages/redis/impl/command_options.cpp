@@ -146,6 +146,18 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg) {
   PutArg(args_, arg.range_options);
 }
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg) {
+  if (arg.count) {
+    args_.emplace_back("COUNT");
+    args_.emplace_back(std::to_string(arg.count));
+  }
+  if (arg.block.count() > 0) {
+    args_.emplace_back("BLOCK");
+    args_.emplace_back(std::to_string(arg.block.count()));
+  }
+  if (arg.noack) args_.emplace_back("NOACK");
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
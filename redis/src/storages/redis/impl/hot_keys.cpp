@@ -0,0 +1,173 @@
+#include "hot_keys.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <userver/utils/swappingsmart.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+// Too few samples tell nothing about the distribution of the keys
+constexpr uint64_t kMinSamples = 100;
+// The set of the hot keys of a shard is rebuilt every this many samples
+constexpr uint64_t kUpdateHotKeysInterval = 64;
+
+}  // namespace
+
+struct HotKeys::ShardSketch {
+  struct Counter {
+    uint64_t count{0};
+    // Possible overestimation of the count, inherited from the evicted key
+    uint64_t error{0};
+  };
+
+  std::atomic<uint64_t> commands{0};
+
+  mutable std::mutex mutex;
+  std::unordered_map<std::string, Counter> counters;
+  uint64_t sampled{0};
+  Clock::time_point next_decay;
+
+  utils::SwappingSmart<std::unordered_set<std::string>> hot_keys;
+};
+
+HotKeys::HotKeys(HotKeysSettings settings, size_t shards_count)
+    : settings_(std::move(settings)) {
+  if (settings_.top_size == 0 || settings_.sample_rate == 0) {
+    throw std::logic_error(
+        "Hot keys detection must have positive top size and sample rate");
+  }
+
+  shards_.reserve(shards_count);
+  for (size_t i = 0; i < shards_count; ++i) {
+    auto sketch = std::make_unique<ShardSketch>();
+    sketch->counters.reserve(settings_.top_size);
+    sketch->next_decay = Clock::now() + settings_.decay_period;
+    sketch->hot_keys.Set(std::make_shared<std::unordered_set<std::string>>());
+    shards_.push_back(std::move(sketch));
+  }
+
+  if (settings_.cache_ttl.count() > 0) {
+    ClientSideCacheSettings cache_settings;
+    cache_settings.max_size =
+        std::max<size_t>(1, settings_.top_size * shards_count);
+    cache_settings.ttl = settings_.cache_ttl;
+    cache_.emplace(std::move(cache_settings));
+  }
+}
+
+HotKeys::~HotKeys() = default;
+
+void HotKeys::Sample(size_t shard, const std::string& key) {
+  if (shard >= shards_.size()) return;
+  auto& sketch = *shards_[shard];
+  if (sketch.commands.fetch_add(1, std::memory_order_relaxed) %
+          settings_.sample_rate !=
+      0) {
+    return;
+  }
+
+  std::lock_guard lock(sketch.mutex);
+  if (Clock::now() >= sketch.next_decay) Decay(sketch);
+  Update(sketch, key);
+  if (sketch.sampled % kUpdateHotKeysInterval == 0) UpdateHotKeys(sketch);
+}
+
+bool HotKeys::IsHot(size_t shard, const std::string& key) const {
+  if (shard >= shards_.size()) return false;
+  return shards_[shard]->hot_keys.Get()->count(key) > 0;
+}
+
+HotKeysStatistics HotKeys::GetStatistics() const {
+  HotKeysStatistics stats;
+  for (size_t shard = 0; shard < shards_.size(); ++shard) {
+    const auto& sketch = *shards_[shard];
+    std::lock_guard lock(sketch.mutex);
+    for (const auto& [key, counter] : sketch.counters) {
+      const auto guaranteed = counter.count - counter.error;
+      if (!IsHotCounter(sketch, guaranteed)) continue;
+      stats.hot_keys.push_back(
+          {shard, key, 100.0 * guaranteed / sketch.sampled});
+    }
+  }
+  if (cache_) stats.cache = cache_->GetStatistics();
+  return stats;
+}
+
+// Space-saving: a new key replaces the least frequent one, so the count of
+// a frequent key is never underestimated
+void HotKeys::Update(ShardSketch& sketch, const std::string& key) {
+  ++sketch.sampled;
+  auto& counters = sketch.counters;
+  if (const auto it = counters.find(key); it != counters.end()) {
+    ++it->second.count;
+    return;
+  }
+  if (counters.size() < settings_.top_size) {
+    counters.emplace(key, ShardSketch::Counter{1, 0});
+    return;
+  }
+
+  const auto min_it = std::min_element(
+      counters.begin(), counters.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.count < rhs.second.count;
+      });
+  const auto min_count = min_it->second.count;
+  counters.erase(min_it);
+  counters.emplace(key, ShardSketch::Counter{min_count + 1, min_count});
+}
+
+void HotKeys::Decay(ShardSketch& sketch) {
+  sketch.next_decay = Clock::now() + settings_.decay_period;
+  sketch.sampled /= 2;
+  for (auto it = sketch.counters.begin(); it != sketch.counters.end();) {
+    it->second.count /= 2;
+    it->second.error /= 2;
+    if (it->second.count == 0) {
+      it = sketch.counters.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  UpdateHotKeys(sketch);
+}
+
+void HotKeys::UpdateHotKeys(ShardSketch& sketch) {
+  auto hot_keys = std::make_shared<std::unordered_set<std::string>>();
+  for (const auto& [key, counter] : sketch.counters) {
+    if (IsHotCounter(sketch, counter.count - counter.error)) {
+      hot_keys->insert(key);
+    }
+  }
+  sketch.hot_keys.Set(std::move(hot_keys));
+}
+
+bool HotKeys::IsHotCounter(const ShardSketch& sketch,
+                           uint64_t guaranteed) const {
+  return sketch.sampled >= kMinSamples &&
+         guaranteed >= settings_.hot_share * sketch.sampled;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HotKeysStatistics& stats) {
+  for (const auto& hot_key : stats.hot_keys) {
+    writer["share_percent"].ValueWithLabels(
+        hot_key.share_percent,
+        {{"redis_shard", std::to_string(hot_key.shard)},
+         {"redis_key", hot_key.key}});
+  }
+  writer["count"] = stats.hot_keys.size();
+  if (stats.cache) writer["cache"] = *stats.cache;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/utils/statistics/writer.hpp>
+
+#include <storages/redis/impl/client_side_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+struct HotKeysSettings {
+  /// Number of the most frequent keys tracked per shard
+  size_t top_size{32};
+  /// One of this many keyed commands is sampled
+  size_t sample_rate{16};
+  /// A key is hot if it gets at least this share of the sampled commands of
+  /// its shard
+  double hot_share{0.05};
+  /// The counters are halved with this period to follow the changes of the
+  /// traffic
+  std::chrono::milliseconds decay_period{std::chrono::seconds{10}};
+  /// GET and HGET of the hot keys are served from an in-process cache for
+  /// this long, 0 disables the cache
+  std::chrono::milliseconds cache_ttl{0};
+};
+
+struct HotKeysStatistics {
+  struct HotKey {
+    size_t shard{0};
+    std::string key;
+    /// Estimated share of the commands of the shard, in percent
+    double share_percent{0};
+  };
+
+  std::vector<HotKey> hot_keys;
+  std::optional<ClientSideCacheStatistics> cache;
+};
+
+/// Detects the hot keys of every shard with a space-saving top-K sketch over
+/// the sampled command keys.
+///
+/// Unlike ClientSideCache, the cache of the hot keys does not need any
+/// support of the server, but the writes are not tracked: a cached value may
+/// be stale for up to the cache TTL.
+class HotKeys final {
+ public:
+  HotKeys(HotKeysSettings settings, size_t shards_count);
+  ~HotKeys();
+
+  const HotKeysSettings& GetSettings() const { return settings_; }
+
+  void Sample(size_t shard, const std::string& key);
+
+  bool IsHot(size_t shard, const std::string& key) const;
+
+  /// Returns nullptr if the cache is disabled
+  ClientSideCache* GetCache() { return cache_ ? &*cache_ : nullptr; }
+
+  HotKeysStatistics GetStatistics() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  struct ShardSketch;
+
+  void Update(ShardSketch& sketch, const std::string& key);
+  void Decay(ShardSketch& sketch);
+  void UpdateHotKeys(ShardSketch& sketch);
+  bool IsHotCounter(const ShardSketch& sketch, uint64_t guaranteed) const;
+
+  const HotKeysSettings settings_;
+  std::vector<std::unique_ptr<ShardSketch>> shards_;
+  std::optional<ClientSideCache> cache_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HotKeysStatistics& stats);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#include "hot_keys.hpp"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using redis::HotKeys;
+using redis::HotKeysSettings;
+
+namespace {
+
+HotKeysSettings MakeSettings() {
+  HotKeysSettings settings;
+  settings.top_size = 4;
+  settings.sample_rate = 1;
+  settings.hot_share = 0.2;
+  settings.decay_period = std::chrono::hours{1};
+  return settings;
+}
+
+}  // namespace
+
+TEST(HotKeys, DetectsFrequentKeys) {
+  HotKeys hot_keys{MakeSettings(), 2};
+
+  for (int i = 0; i < 1000; ++i) {
+    hot_keys.Sample(0, "hot");
+    hot_keys.Sample(0, "cold" + std::to_string(i));
+    hot_keys.Sample(1, "other" + std::to_string(i));
+  }
+
+  EXPECT_TRUE(hot_keys.IsHot(0, "hot"));
+  EXPECT_FALSE(hot_keys.IsHot(0, "cold999"));
+  EXPECT_FALSE(hot_keys.IsHot(1, "hot"));
+  EXPECT_FALSE(hot_keys.IsHot(2, "hot"));
+
+  const auto stats = hot_keys.GetStatistics();
+  ASSERT_EQ(1, stats.hot_keys.size());
+  EXPECT_EQ(0, stats.hot_keys[0].shard);
+  EXPECT_EQ("hot", stats.hot_keys[0].key);
+  EXPECT_GE(stats.hot_keys[0].share_percent, 20);
+  EXPECT_LE(stats.hot_keys[0].share_percent, 50);
+  EXPECT_FALSE(stats.cache);
+}
+
+TEST(HotKeys, Sampling) {
+  auto settings = MakeSettings();
+  settings.sample_rate = 10;
+  HotKeys hot_keys{settings, 1};
+
+  // 100 samples are needed for a key to be considered hot
+  for (int i = 0; i < 990; ++i) hot_keys.Sample(0, "hot");
+  EXPECT_FALSE(hot_keys.IsHot(0, "hot"));
+
+  for (int i = 0; i < 1000; ++i) hot_keys.Sample(0, "hot");
+  EXPECT_TRUE(hot_keys.IsHot(0, "hot"));
+}
+
+TEST(HotKeys, Cache) {
+  auto settings = MakeSettings();
+  EXPECT_EQ(nullptr, HotKeys(settings, 1).GetCache());
+
+  settings.cache_ttl = std::chrono::seconds{10};
+  HotKeys hot_keys{settings, 1};
+  auto* cache = hot_keys.GetCache();
+  ASSERT_NE(nullptr, cache);
+
+  cache->Put("hot", "value");
+  EXPECT_EQ(redis::ClientSideCache::Value{"value"}, cache->Get("hot"));
+  EXPECT_TRUE(hot_keys.GetStatistics().cache);
+}
+
+TEST(HotKeys, InvalidSettings) {
+  auto settings = MakeSettings();
+  settings.sample_rate = 0;
+  EXPECT_THROW(HotKeys(settings, 1), std::logic_error);
+}
+
+USERVER_NAMESPACE_END
@@ -31,9 +31,7 @@ void HandlerHotFound(const std::string& command,
 }  // namespace
 
 MockRedisServerBase::MockRedisServerBase(int port)
-    : acceptor_(io_service_),
-      socket_(io_service_),
-      reader_(redisReaderCreate(), &redisReaderFree) {
+    : acceptor_(io_service_), socket_(io_service_) {
   acceptor_.open(io::ip::tcp::v4());
   boost::asio::ip::tcp::acceptor::reuse_address option(true);
   acceptor_.set_option(option);
@@ -127,21 +125,12 @@ void MockRedisServerBase::OnRead(boost::system::error_code ec, size_t count) {
     return;
   }
 
-  auto ret = redisReaderFeed(reader_.get(), data_.data(), count);
-  if (ret != REDIS_OK)
-    throw std::runtime_error("redisReaderFeed() returned error: " +
-                             std::string(reader_->errstr));
-
-  void* hiredis_reply = nullptr;
-  while (redisReaderGetReply(reader_.get(), &hiredis_reply) == REDIS_OK &&
-         hiredis_reply) {
-    auto reply = std::make_shared<redis::Reply>(
-        "", static_cast<redisReply*>(hiredis_reply), redis::ReplyStatus::kOk);
+  parser_.Feed(std::string_view{data_.data(), count});
+  while (auto reply_data = parser_.GetReply()) {
+    auto reply = std::make_shared<redis::Reply>("", std::move(*reply_data));
     LOG_DEBUG() << "command: " << reply->data.ToDebugString();
 
     OnCommand(reply);
-    freeReplyObject(hiredis_reply);
-    hiredis_reply = nullptr;
   }
 
   DoRead();
@@ -13,6 +13,7 @@
 #include <userver/logging/log.hpp>
 
 #include <storages/redis/impl/redis.hpp>
+#include <storages/redis/impl/resp_parser.hpp>
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -59,7 +60,7 @@ class MockRedisServerBase {
 
   io::ip::tcp::socket socket_;
   std::array<char, 1024> data_{};
-  std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader_;
+  redis::RespParser parser_;
 };
 
 class MockRedisServer : public MockRedisServerBase {
@@ -21,10 +21,12 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/script_cache.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -35,6 +37,7 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+const auto kReplyTimeExp = 0.9;
 const size_t kMissedPingStreakThresholdDefault = 3;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
@@ -156,10 +159,16 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::chrono::milliseconds GetPingLatency() const {
     return std::chrono::milliseconds(ping_latency_ms_);
   }
+  std::chrono::microseconds GetReplyTimeEwma() const {
+    return std::chrono::microseconds(
+        static_cast<int64_t>(reply_time_ewma_us_.load()));
+  }
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings);
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> client_side_cache);
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache);
 
   void ResetRedisObj() { redis_obj_ = nullptr; }
 
@@ -170,6 +179,10 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
     ev_timer timer{};
     std::shared_ptr<RedisImpl> redis_impl;
     bool invoke_disabled = false;
+    // Key and field of a GET or HGET to put the reply into the
+    // client-side cache
+    std::optional<std::string> cache_key;
+    std::optional<std::string> cache_field;
   };
 
   void DoDisconnect();
@@ -182,6 +195,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                                  int revents) noexcept;
   static void OnRedisReply(redisAsyncContext* c, void* r,
                            void* privdata) noexcept;
+  static void OnRedisPush(redisAsyncContext* c, void* r) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
   static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
   static void OnTimerPing(struct ev_loop* loop, ev_timer* w,
@@ -205,7 +219,9 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void CommandLoopImpl();
   void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status,
                         const char* errstr);
+  void OnRedisPushImpl(const redisReply* redis_reply);
   void AccountPingLatency(std::chrono::milliseconds latency);
+  void AccountReplyTime(const CommandPtr& command, const Reply& reply);
   void AccountRtt();
   void OnTimerPingImpl();
   void OnTimerInfoImpl();
@@ -220,6 +236,13 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void Authenticate();
   void SendReadOnly();
+  void FinishConnecting();
+  void LoadScripts();
+  void LoadScript(std::string script);
+  void EnableClientTracking();
+  void MarkCacheable(const CmdArgs::CmdArgsArray& args,
+                     SingleCommand& entry) const;
+  void PutToClientSideCache(const SingleCommand& command, const Reply& reply);
   void FreeCommands();
 
   static void LogSocketErrorReply(const CommandPtr& command,
@@ -278,10 +301,19 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
   const bool send_readonly_;
   const ConnectionSecurity connection_security_;
+  // Accessed from the event thread only
+  std::shared_ptr<ClientSideCache> client_side_cache_;
+  bool client_tracking_requested_ = false;
+  bool client_tracking_enabled_ = false;
+  // Accessed from the event thread only
+  std::shared_ptr<ScriptCache> script_cache_;
+  boost::signals2::scoped_connection script_added_connection_;
   std::chrono::milliseconds ping_interval_{2000};
   std::chrono::milliseconds ping_timeout_{4000};
   std::chrono::milliseconds info_replication_interval_{2000};
   std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+  // Written on the ev thread only
+  std::atomic<double> reply_time_ewma_us_{0};
   logging::LogExtra log_extra_;
   bool watch_command_timer_started_ = false;
   Statistics statistics_;
@@ -356,6 +388,10 @@ std::chrono::milliseconds Redis::GetPingLatency() const {
   return impl_->GetPingLatency();
 }
 
+std::chrono::microseconds Redis::GetReplyTimeEwma() const {
+  return impl_->GetReplyTimeEwma();
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -374,6 +410,15 @@ void Redis::SetReplicationMonitoringSettings(
   impl_->SetReplicationMonitoringSettings(replication_monitoring_settings);
 }
 
+void Redis::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  impl_->SetClientSideCache(std::move(client_side_cache));
+}
+
+void Redis::SetScriptCache(std::shared_ptr<ScriptCache> script_cache) {
+  impl_->SetScriptCache(std::move(script_cache));
+}
+
 Redis::RedisImpl::RedisImpl(
     const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
     const engine::ev::ThreadControl& thread_control, Redis& redis_obj,
@@ -525,6 +570,7 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command,
   UASSERT(reply);
   if (command->control.account_in_statistics)
     statistics_.AccountReplyReceived(reply, command);
+  AccountReplyTime(command, *reply);
   reply->server = server_;
   if (reply->status == ReplyStatus::kTimeoutError) {
     auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -645,6 +691,23 @@ void Redis::RedisImpl::OnCommandTimeoutImpl(ev_timer* w) {
   }
 }
 
+void Redis::RedisImpl::AccountReplyTime(const CommandPtr& command,
+                                        const Reply& reply) {
+  // Local errors say nothing about the server
+  if (reply.status != ReplyStatus::kOk &&
+      reply.status != ReplyStatus::kTimeoutError) {
+    return;
+  }
+  const auto reply_time_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - command->GetStartHandlingTime())
+          .count();
+  const auto ewma = reply_time_ewma_us_.load();
+  reply_time_ewma_us_ =
+      ewma == 0 ? reply_time_us
+                : ewma * kReplyTimeExp + reply_time_us * (1 - kReplyTimeExp);
+}
+
 void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
   statistics_.AccountPing(latency);
   ping_latency_ms_ = (ping_latency_ms_.load() * kPingLatencyExp +
@@ -831,6 +894,12 @@ void Redis::RedisImpl::SetState(State state) {
   state_ = state;
   statistics_.AccountStateChanged(state);
 
+  if (client_tracking_enabled_ && state != State::kConnected) {
+    // Invalidations for the keys read by this connection are lost
+    client_tracking_enabled_ = false;
+    client_side_cache_->InvalidateAll();
+  }
+
   auto self = shared_from_this();  // prevents deleting this in Disconnect()
   if (state == State::kConnected) {
     ev_thread_control_.RunInEvLoopBlocking([this] {
@@ -1028,7 +1097,7 @@ void Redis::RedisImpl::Authenticate() {
     if (send_readonly_)
       SendReadOnly();
     else
-      SetState(State::kConnected);
+      FinishConnecting();
   } else {
     ProcessCommand(PrepareCommand(
         CmdArgs{"AUTH", password_.GetUnderlying()},
@@ -1037,7 +1106,7 @@ void Redis::RedisImpl::Authenticate() {
             if (send_readonly_)
               SendReadOnly();
             else
-              SetState(State::kConnected);
+              FinishConnecting();
           } else {
             if (*reply) {
               if (reply->IsUnknownCommandError()) {
@@ -1069,7 +1138,7 @@ void Redis::RedisImpl::SendReadOnly() {
   ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&,
                                                             ReplyPtr reply) {
     if (*reply && reply->data.IsStatus()) {
-      SetState(State::kConnected);
+      FinishConnecting();
     } else {
       if (*reply) {
         LOG_LIMITED_ERROR()
@@ -1086,6 +1155,140 @@ void Redis::RedisImpl::SendReadOnly() {
   }));
 }
 
+void Redis::RedisImpl::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  ev_thread_control_.RunInEvLoopAsync(
+      [weak_self = weak_from_this(),
+       client_side_cache = std::move(client_side_cache)]() mutable {
+        auto self = weak_self.lock();
+        if (!self || self->client_side_cache_) return;
+        self->client_side_cache_ = std::move(client_side_cache);
+        // Otherwise tracking is enabled while connecting
+        if (self->state_ == State::kConnected) self->EnableClientTracking();
+      });
+}
+
+void Redis::RedisImpl::SetScriptCache(
+    std::shared_ptr<ScriptCache> script_cache) {
+  ev_thread_control_.RunInEvLoopAsync([weak_self = weak_from_this(),
+                                       script_cache =
+                                           std::move(script_cache)]() mutable {
+    auto self = weak_self.lock();
+    if (!self || self->script_cache_) return;
+    self->script_added_connection_ = script_cache->signal_script_added.connect(
+        [weak_self, thread_control = self->ev_thread_control_](
+            const std::string& script) mutable {
+          thread_control.RunInEvLoopAsync([weak_self, script] {
+            auto self = weak_self.lock();
+            if (self && self->state_ == State::kConnected) {
+              self->LoadScript(script);
+            }
+          });
+        });
+    self->script_cache_ = std::move(script_cache);
+    // Otherwise the scripts are loaded while connecting
+    if (self->state_ == State::kConnected) self->LoadScripts();
+  });
+}
+
+// The commands are executed in order, so the commands sent after the
+// connection is reported as connected find the scripts already loaded
+void Redis::RedisImpl::FinishConnecting() {
+  LoadScripts();
+  EnableClientTracking();
+}
+
+void Redis::RedisImpl::LoadScripts() {
+  if (!script_cache_ || subscriber_) return;
+  for (auto& script : script_cache_->GetScripts()) {
+    LoadScript(std::move(script));
+  }
+}
+
+// Failures are not fatal, EVALSHA of a missing script falls back to EVAL
+void Redis::RedisImpl::LoadScript(std::string script) {
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"SCRIPT", "LOAD", std::move(script)},
+      [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsString()) return;
+        LOG_LIMITED_WARNING()
+            << log_extra_ << "SCRIPT LOAD failed: status=" << reply->status
+            << " msg=" << reply->data.ToDebugString();
+      }));
+}
+
+// Switches the connection to RESP3, so that the invalidations are received
+// in-band, and enables tracking. Failures only disable the caching for the
+// connection.
+void Redis::RedisImpl::EnableClientTracking() {
+  if (!client_side_cache_ || client_tracking_requested_ || subscriber_) {
+    SetState(State::kConnected);
+    return;
+  }
+  client_tracking_requested_ = true;
+
+#ifdef REDIS_REPLY_PUSH
+  redisAsyncSetPushCallback(context_, OnRedisPush);
+  auto on_error = [this](const std::string& command, const Reply& reply) {
+    LOG_LIMITED_WARNING()
+        << log_extra_ << command
+        << " failed, client-side caching is disabled for the connection: "
+           "status="
+        << reply.status << " msg=" << reply.data.ToDebugString();
+  };
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"HELLO", 3}, [this, on_error](const CommandPtr&, ReplyPtr reply) {
+        if (!*reply || reply->data.IsError()) {
+          on_error("HELLO", *reply);
+          return;
+        }
+        ProcessCommand(PrepareCommand(
+            CmdArgs{client_side_cache_->GetTrackingArgs()},
+            [this, on_error](const CommandPtr&, ReplyPtr reply) {
+              if (!*reply || !reply->data.IsStatus()) {
+                on_error("CLIENT TRACKING", *reply);
+                return;
+              }
+              if (state_ != State::kConnected) return;
+              LOG_INFO() << log_extra_ << "Client tracking enabled";
+              client_tracking_enabled_ = true;
+            }));
+      }));
+#else
+  LOG_WARNING() << log_extra_
+                << "Client-side caching requires hiredis with RESP3 support";
+#endif
+  if (state_ != State::kConnected) SetState(State::kConnected);
+}
+
+void Redis::RedisImpl::MarkCacheable(const CmdArgs::CmdArgsArray& args,
+                                     SingleCommand& entry) const {
+  if (!client_tracking_enabled_) return;
+  const bool is_get = args.size() == 2 && boost::iequals(args[0], "get");
+  const bool is_hget = args.size() == 3 && boost::iequals(args[0], "hget");
+  if ((!is_get && !is_hget) || !client_side_cache_->IsCacheable(args[1])) {
+    return;
+  }
+  entry.cache_key = args[1];
+  if (is_hget) entry.cache_field = args[2];
+}
+
+void Redis::RedisImpl::PutToClientSideCache(const SingleCommand& command,
+                                            const Reply& reply) {
+  // The tracking could be lost while the command was in flight
+  if (!client_tracking_enabled_ || !reply.IsOk()) return;
+  if (!reply.data.IsString() && !reply.data.IsNil()) return;
+
+  ClientSideCache::Value value;
+  if (reply.data.IsString()) value = reply.data.GetString();
+  if (command.cache_field) {
+    client_side_cache_->Hput(*command.cache_key, *command.cache_field,
+                             std::move(value));
+  } else {
+    client_side_cache_->Put(*command.cache_key, std::move(value));
+  }
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
                                     void* privdata) noexcept {
   auto* impl = static_cast<Redis::RedisImpl*>(c->data);
@@ -1104,6 +1307,35 @@ void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
   }
 }
 
+void Redis::RedisImpl::OnRedisPush(redisAsyncContext* c, void* r) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  try {
+    impl->OnRedisPushImpl(static_cast<const redisReply*>(r));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "OnRedisPushImpl() failed: " << ex;
+  }
+}
+
+void Redis::RedisImpl::OnRedisPushImpl(const redisReply* redis_reply) {
+  if (!client_side_cache_ || !redis_reply) return;
+
+  // Invalidation message is ["invalidate", [key, ...]], the keys are null if
+  // the server could not keep track of the keys
+  const ReplyData data{redis_reply};
+  if (!data.IsArray() || data.GetArray().size() != 2) return;
+  const auto& message = data.GetArray();
+  if (!message[0].IsString() || message[0].GetString() != "invalidate") return;
+
+  if (message[1].IsArray()) {
+    for (const auto& key : message[1].GetArray()) {
+      if (key.IsString()) client_side_cache_->Invalidate(key.GetString());
+    }
+  } else {
+    client_side_cache_->InvalidateAll();
+  }
+}
+
 void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
                                         int status, const char* errstr) {
   auto data = reply_privdata_.find(reinterpret_cast<size_t>(privdata));
@@ -1145,6 +1377,8 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
 
     reply_privdata_.erase(data);
   }
+  if (pcommand->cache_key) PutToClientSideCache(*pcommand, *reply);
+
   if (!pcommand->invoke_disabled) {
     // prevents double unsubscribe handling
     if (subscriber_ &&
@@ -1225,6 +1459,7 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
       entry->meta = command;
       entry->timer.data = this;
       entry->redis_impl = shared_from_this();
+      MarkCacheable(args, *entry);
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
       ev_timer_init(&entry->timer, OnCommandTimeout,
                     ToEvDuration(command->control.timeout_single), 0.0);
@@ -21,6 +21,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class ClientSideCache;
+class ScriptCache;
 class Statistics;
 
 class Redis {
@@ -40,6 +42,8 @@ class Redis {
   bool AsyncCommand(const CommandPtr& command);
   size_t GetRunningCommands() const;
   std::chrono::milliseconds GetPingLatency() const;
+  /// Exponentially smoothed time from sending a command to its reply
+  std::chrono::microseconds GetReplyTimeEwma() const;
   bool IsDestroying() const;
   std::string GetServerHost() const;
   uint16_t GetServerPort() const;
@@ -53,6 +57,8 @@ class Redis {
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings);
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> client_side_cache);
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache);
 
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   boost::signals2::signal<void(State)> signal_state_change;
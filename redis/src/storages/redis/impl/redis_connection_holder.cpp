@@ -9,10 +9,14 @@ RedisConnectionHolder::RedisConnectionHolder(
     const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool,
     const std::string& host, uint16_t port, Password password,
     CommandsBufferingSettings buffering_settings,
-    ReplicationMonitoringSettings replication_monitoring_settings)
+    ReplicationMonitoringSettings replication_monitoring_settings,
+    std::shared_ptr<ClientSideCache> client_side_cache,
+    std::shared_ptr<ScriptCache> script_cache)
     : commands_buffering_settings_(std::move(buffering_settings)),
       replication_monitoring_settings_(
           std::move(replication_monitoring_settings)),
+      client_side_cache_(std::move(client_side_cache)),
+      script_cache_(std::move(script_cache)),
       ev_thread_(sentinel_thread_control),
       redis_thread_pool_(redis_thread_pool),
       host_(host),
@@ -58,6 +62,12 @@ void RedisConnectionHolder::CreateConnection() {
     auto settings_ptr = replication_monitoring_settings_.Lock();
     instance->SetReplicationMonitoringSettings(*settings_ptr);
   }
+  if (auto client_side_cache = client_side_cache_.Get()) {
+    instance->SetClientSideCache(std::move(client_side_cache));
+  }
+  if (auto script_cache = script_cache_.Get()) {
+    instance->SetScriptCache(std::move(script_cache));
+  }
 
   instance->Connect({host_}, port_, password_);
   redis_.Assign(std::move(instance));
@@ -77,6 +87,18 @@ void RedisConnectionHolder::SetCommandsBufferingSettings(
   redis_.ReadCopy()->SetCommandsBufferingSettings(std::move(settings));
 }
 
+void RedisConnectionHolder::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  client_side_cache_.Set(client_side_cache);
+  redis_.ReadCopy()->SetClientSideCache(std::move(client_side_cache));
+}
+
+void RedisConnectionHolder::SetScriptCache(
+    std::shared_ptr<ScriptCache> script_cache) {
+  script_cache_.Set(script_cache);
+  redis_.ReadCopy()->SetScriptCache(std::move(script_cache));
+}
+
 Redis::State RedisConnectionHolder::GetState() const {
   auto ptr = redis_.Read();
   return ptr->get()->GetState();
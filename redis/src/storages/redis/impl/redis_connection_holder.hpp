@@ -21,7 +21,9 @@ class RedisConnectionHolder {
       const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool,
       const std::string& host, uint16_t port, Password password,
       CommandsBufferingSettings buffering_settings,
-      ReplicationMonitoringSettings replication_monitoring_settings);
+      ReplicationMonitoringSettings replication_monitoring_settings,
+      std::shared_ptr<ClientSideCache> client_side_cache = {},
+      std::shared_ptr<ScriptCache> script_cache = {});
   ~RedisConnectionHolder();
   RedisConnectionHolder(const RedisConnectionHolder&) = delete;
   RedisConnectionHolder& operator=(const RedisConnectionHolder&) = delete;
@@ -30,6 +32,8 @@ class RedisConnectionHolder {
 
   void SetReplicationMonitoringSettings(ReplicationMonitoringSettings settings);
   void SetCommandsBufferingSettings(CommandsBufferingSettings settings);
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> client_side_cache);
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache);
 
   Redis::State GetState() const;
 
@@ -42,6 +46,8 @@ class RedisConnectionHolder {
       commands_buffering_settings_;
   concurrent::Variable<ReplicationMonitoringSettings, std::mutex>
       replication_monitoring_settings_;
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
+  utils::SwappingSmart<ScriptCache> script_cache_;
   engine::ev::ThreadControl ev_thread_;
   std::shared_ptr<engine::ev::ThreadPool> redis_thread_pool_;
   const std::string host_;
@@ -89,6 +89,11 @@ const std::string_view kCommandTypes[] = {
     "type",
     "unlink",
     "unsubscribe",
+    "xack",
+    "xadd",
+    "xautoclaim",
+    "xgroup",
+    "xreadgroup",
     "zadd",
     "zcard",
     "zrange",
@@ -150,6 +155,14 @@ void Statistics::AccountReplyReceived(const ReplyPtr& reply,
   AccountError(reply->status);
 }
 
+void ClusterStatisticsInternal::AccountRedirectedReply(
+    std::chrono::steady_clock::time_point start) {
+  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+  redirect_timings_percentile.GetCurrentCounter().Account(ms);
+}
+
 void Statistics::AccountError(ReplyStatus code) {
   error_count[static_cast<int>(code)]++;
 }
@@ -228,11 +241,24 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ClusterStatistics& stats) {
+  writer["redirects"].ValueWithLabels(stats.moved_redirects,
+                                      {"redis_redirect", "moved"});
+  writer["redirects"].ValueWithLabels(stats.ask_redirects,
+                                      {"redis_redirect", "ask"});
+  writer["slot_updates"] = stats.slot_updates;
+  writer["topology_updates"] = stats.topology_updates;
+  writer["redirect_timings"] = stats.redirect_timings_percentile;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const SentinelStatistics& stats) {
   DumpMetric(writer, stats.shard_group_total, false);
   writer["errors"].ValueWithLabels(stats.internal.redis_not_ready.load(),
                                    {"redis_error", "redis_not_ready"});
+  writer["errors"].ValueWithLabels(stats.internal.deadline_cancelled.load(),
+                                   {"redis_error", "deadline_cancelled"});
   for (const auto& [shard_name, shard_stats] : stats.masters) {
     writer.ValueWithLabels(shard_stats, {{"redis_instance_type", "masters"},
                                          {"redis_shard", shard_name}});
@@ -245,6 +271,9 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer.ValueWithLabels(*stats.sentinel,
                            {"redis_instance_type", "sentinels"});
   }
+  if (stats.cluster) {
+    writer["cluster"] = *stats.cluster;
+  }
 }
 
 }  // namespace redis
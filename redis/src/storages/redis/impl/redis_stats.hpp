@@ -4,6 +4,7 @@
 #include <atomic>
 #include <chrono>
 #include <map>
+#include <optional>
 #include <string_view>
 #include <unordered_map>
 
@@ -123,10 +124,41 @@ struct ShardStatistics {
 struct SentinelStatisticsInternal {
   SentinelStatisticsInternal() = default;
   SentinelStatisticsInternal(const SentinelStatisticsInternal& other)
-      : redis_not_ready(other.redis_not_ready.load(std::memory_order_relaxed)) {
-  }
+      : redis_not_ready(other.redis_not_ready.load(std::memory_order_relaxed)),
+        deadline_cancelled(
+            other.deadline_cancelled.load(std::memory_order_relaxed)) {}
 
   std::atomic_llong redis_not_ready{0};
+  /// Commands not sent as the inherited deadline has expired
+  std::atomic_llong deadline_cancelled{0};
+};
+
+/// Redirects and slot map changes of a redis cluster
+struct ClusterStatisticsInternal {
+  void AccountRedirectedReply(std::chrono::steady_clock::time_point start);
+
+  std::atomic_llong moved_redirects{0};
+  std::atomic_llong ask_redirects{0};
+  std::atomic_llong slot_updates{0};
+  /// Time from the start of the requests that were redirected to their reply
+  Statistics::RecentPeriod redirect_timings_percentile;
+};
+
+struct ClusterStatistics {
+  ClusterStatistics(const ClusterStatisticsInternal& other,
+                    long long topology_updates)
+      : moved_redirects(other.moved_redirects.load(std::memory_order_relaxed)),
+        ask_redirects(other.ask_redirects.load(std::memory_order_relaxed)),
+        slot_updates(other.slot_updates.load(std::memory_order_relaxed)),
+        topology_updates(topology_updates),
+        redirect_timings_percentile(
+            other.redirect_timings_percentile.GetStatsForPeriod()) {}
+
+  long long moved_redirects;
+  long long ask_redirects;
+  long long slot_updates;
+  long long topology_updates;
+  Statistics::Percentile redirect_timings_percentile;
 };
 
 struct SentinelStatistics {
@@ -141,6 +173,8 @@ struct SentinelStatistics {
   std::map<std::string, ShardStatistics> slaves;
   InstanceStatistics shard_group_total;
   SentinelStatisticsInternal internal;
+  /// Only in the cluster mode with auto topology
+  std::optional<ClusterStatistics> cluster;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -149,6 +183,9 @@ void DumpMetric(utils::statistics::Writer& writer,
 void DumpMetric(utils::statistics::Writer& writer,
                 const ShardStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ClusterStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const SentinelStatistics& stats);
 
@@ -14,6 +14,30 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+namespace {
+
+#ifdef REDIS_REPLY_PUSH
+bool IsMemberScorePair(const redisReply* reply) {
+  return reply && reply->type == REDIS_REPLY_ARRAY && reply->elements == 2 &&
+         reply->element[0]->type == REDIS_REPLY_STRING &&
+         reply->element[1]->type == REDIS_REPLY_DOUBLE;
+}
+
+// RESP3 replies to ZRANGE WITHSCORES, ZPOPMIN with count and the like are the
+// arrays of [member, score] pairs, while RESP2 replies are flat arrays of
+// members and scores. Scores are doubles only in RESP3, so no RESP2 reply
+// has this shape.
+bool IsMemberScorePairs(const redisReply* reply) {
+  if (reply->type != REDIS_REPLY_ARRAY || reply->elements == 0) return false;
+  for (size_t i = 0; i < reply->elements; i++) {
+    if (!IsMemberScorePair(reply->element[i])) return false;
+  }
+  return true;
+}
+#endif
+
+}  // namespace
+
 ReplyData::ReplyData(const redisReply* reply) {
   if (!reply) return;
 
@@ -23,15 +47,45 @@ ReplyData::ReplyData(const redisReply* reply) {
       string_ = std::string(reply->str, reply->len);
       break;
     case REDIS_REPLY_ARRAY:
+#ifdef REDIS_REPLY_PUSH
+    // RESP3 aggregates are represented as in RESP2, so that the replies are
+    // parsed the same way regardless of the protocol of the connection. Maps
+    // are flattened into key-value pairs by hiredis.
+    case REDIS_REPLY_MAP:
+    case REDIS_REPLY_SET:
+    case REDIS_REPLY_PUSH:
+#endif
       type_ = Type::kArray;
+#ifdef REDIS_REPLY_PUSH
+      if (IsMemberScorePairs(reply)) {
+        array_.reserve(reply->elements * 2);
+        for (size_t i = 0; i < reply->elements; i++) {
+          array_.emplace_back(reply->element[i]->element[0]);
+          array_.emplace_back(reply->element[i]->element[1]);
+        }
+        break;
+      }
+#endif
       array_.reserve(reply->elements);
       for (size_t i = 0; i < reply->elements; i++)
         array_.emplace_back(reply->element[i]);
       break;
     case REDIS_REPLY_INTEGER:
+#ifdef REDIS_REPLY_PUSH
+    case REDIS_REPLY_BOOL:
+#endif
       type_ = Type::kInteger;
       integer_ = reply->integer;
       break;
+#ifdef REDIS_REPLY_PUSH
+    // RESP2 returns these as bulk strings
+    case REDIS_REPLY_DOUBLE:
+    case REDIS_REPLY_BIGNUM:
+    case REDIS_REPLY_VERB:
+      type_ = Type::kString;
+      string_ = std::string(reply->str, reply->len);
+      break;
+#endif
     case REDIS_REPLY_NIL:
       type_ = Type::kNil;
       break;
@@ -75,6 +129,13 @@ ReplyData ReplyData::CreateNil() {
   return data;
 }
 
+ReplyData ReplyData::CreateInteger(int64_t value) {
+  ReplyData data;
+  data.type_ = Type::kInteger;
+  data.integer_ = value;
+  return data;
+}
+
 std::string ReplyData::GetTypeString() const { return TypeToString(GetType()); }
 
 std::string ReplyData::ToDebugString() const {
@@ -1,6 +1,10 @@
 #include <userver/storages/redis/impl/reply.hpp>
 
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,4 +26,71 @@ TEST(Reply, IsUnusableInstanceErrorERR) {
   EXPECT_FALSE(data.IsUnusableInstanceError());
 }
 
+#ifdef REDIS_REPLY_PUSH
+namespace {
+
+redisReply MakeStringReply(int type, std::string& str) {
+  redisReply reply{};
+  reply.type = type;
+  reply.str = str.data();
+  reply.len = str.size();
+  return reply;
+}
+
+redisReply MakeArrayReply(std::vector<redisReply*>& elements) {
+  redisReply reply{};
+  reply.type = REDIS_REPLY_ARRAY;
+  reply.element = elements.data();
+  reply.elements = elements.size();
+  return reply;
+}
+
+}  // namespace
+
+TEST(Reply, Resp3MemberScorePairsAreFlattened) {
+  std::string member1 = "one";
+  std::string score1 = "1";
+  std::string member2 = "two";
+  std::string score2 = "2.5";
+  auto member1_reply = MakeStringReply(REDIS_REPLY_STRING, member1);
+  auto score1_reply = MakeStringReply(REDIS_REPLY_DOUBLE, score1);
+  auto member2_reply = MakeStringReply(REDIS_REPLY_STRING, member2);
+  auto score2_reply = MakeStringReply(REDIS_REPLY_DOUBLE, score2);
+  std::vector<redisReply*> pair1{&member1_reply, &score1_reply};
+  std::vector<redisReply*> pair2{&member2_reply, &score2_reply};
+  auto pair1_reply = MakeArrayReply(pair1);
+  auto pair2_reply = MakeArrayReply(pair2);
+  std::vector<redisReply*> pairs{&pair1_reply, &pair2_reply};
+  const auto reply = MakeArrayReply(pairs);
+
+  // The same as the RESP2 reply to ZRANGE WITHSCORES
+  const redis::ReplyData data{&reply};
+  ASSERT_TRUE(data.IsArray());
+  const auto& array = data.GetArray();
+  ASSERT_EQ(array.size(), 4);
+  EXPECT_EQ(array[0].GetString(), "one");
+  EXPECT_EQ(array[1].GetString(), "1");
+  EXPECT_EQ(array[2].GetString(), "two");
+  EXPECT_EQ(array[3].GetString(), "2.5");
+}
+
+TEST(Reply, Resp3NestedArraysAreKept) {
+  // GEOPOS reply: the pairs of coordinates are not member-score pairs
+  std::string longitude = "13.36";
+  std::string latitude = "38.11";
+  auto longitude_reply = MakeStringReply(REDIS_REPLY_DOUBLE, longitude);
+  auto latitude_reply = MakeStringReply(REDIS_REPLY_DOUBLE, latitude);
+  std::vector<redisReply*> position{&longitude_reply, &latitude_reply};
+  auto position_reply = MakeArrayReply(position);
+  std::vector<redisReply*> positions{&position_reply};
+  const auto reply = MakeArrayReply(positions);
+
+  const redis::ReplyData data{&reply};
+  ASSERT_TRUE(data.IsArray());
+  ASSERT_EQ(data.GetArray().size(), 1);
+  ASSERT_TRUE(data.GetArray()[0].IsArray());
+  EXPECT_EQ(data.GetArray()[0].GetArray().size(), 2);
+}
+#endif
+
 USERVER_NAMESPACE_END
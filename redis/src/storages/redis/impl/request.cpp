@@ -31,11 +31,13 @@ class ReplyState {
   size_t GetRepliesToSkip() const { return replies_to_skip_; }
   void SetRepliesToSkip(size_t value) { replies_to_skip_ = value; }
   void SetExecuted() { executed_ = true; }
+  std::vector<ReplyData>& CollectedReplies() { return collected_replies_; }
 
  private:
   engine::Promise<ReplyPtr> promise_;
   tracing::InPlaceSpan span_;
   size_t replies_to_skip_{0};
+  std::vector<ReplyData> collected_replies_;
   bool executed_{false};
 };
 
@@ -69,6 +71,13 @@ Request::Request(Sentinel& sentinel, CmdArgs&& args, size_t shard, bool master,
   sentinel.AsyncCommand(std::move(command_ptr), master, shard);
 }
 
+Request::Request(Sentinel& sentinel, CmdArgs&& args, size_t shard, bool master,
+                 const CommandControl& command_control, CollectRepliesTag) {
+  CommandPtr command_ptr =
+      PrepareCollectingRequest(std::forward<CmdArgs>(args), command_control);
+  sentinel.AsyncCommand(std::move(command_ptr), master, shard);
+}
+
 CommandPtr Request::PrepareRequest(CmdArgs&& args,
                                    const CommandControl& command_control,
                                    size_t replies_to_skip) {
@@ -107,6 +116,43 @@ CommandPtr Request::PrepareRequest(CmdArgs&& args,
   return command;
 }
 
+CommandPtr Request::PrepareCollectingRequest(
+    CmdArgs&& args, const CommandControl& command_control) {
+  deadline_ = engine::Deadline::FromDuration(command_control.timeout_all);
+
+  const auto replies_count = args.args.size();
+  auto state_ptr = std::make_shared<ReplyState>("redis_pipeline");
+  state_ptr->CollectedReplies().reserve(replies_count);
+  future_ = state_ptr->Promise().get_future();
+
+  auto command = PrepareCommand(
+      std::move(args),
+      [state_ptr = std::move(state_ptr), replies_count](
+          const CommandPtr&, ReplyPtr reply) mutable {
+        if (!state_ptr) return;
+
+        state_ptr->SetExecuted();
+
+        // Error replies to the commands are a part of the result, while
+        // a failure of the request as a whole is reported at once
+        if (reply->IsOk()) {
+          auto& replies = state_ptr->CollectedReplies();
+          replies.push_back(std::move(reply->data));
+          if (replies.size() < replies_count) return;
+          reply->data = ReplyData{std::move(replies)};
+        }
+
+        reply->FillSpanTags(state_ptr->Span());
+        LOG_TRACE() << "Got pipeline reply from redis"
+                    << tracing::impl::LogSpanAsLastNonCoro{state_ptr->Span()};
+
+        state_ptr->Promise().set_value(std::move(reply));
+        state_ptr.reset();
+      },
+      command_control);
+  return command;
+}
+
 ReplyPtr Request::Get() {
   switch (future_.wait_until(deadline_)) {
     case engine::FutureStatus::kReady:
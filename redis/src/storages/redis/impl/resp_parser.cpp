@@ -0,0 +1,199 @@
+#include "resp_parser.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+
+#include <userver/storages/redis/impl/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+constexpr std::string_view kCrlf = "\r\n";
+
+// Same limits as in hiredis
+constexpr int64_t kMaxBulkLength = 512LL * 1024 * 1024;
+constexpr int64_t kMaxAggregateSize = (1LL << 32) - 1;
+
+// The shortest RESP value is "_\r\n"
+constexpr size_t kMinValueSize = 3;
+
+int64_t ParseInteger(std::string_view str) {
+  int64_t value = 0;
+  const auto* end = str.data() + str.size();
+  const auto [ptr, ec] = std::from_chars(str.data(), end, value);
+  if (ec != std::errc{} || ptr != end) {
+    throw ParseReplyException("Invalid integer in RESP reply: '" +
+                              std::string{str} + '\'');
+  }
+  return value;
+}
+
+}  // namespace
+
+void RespParser::Feed(std::string_view data) {
+  if (pos_ == buffer_.size()) {
+    buffer_.clear();
+    pos_ = 0;
+  } else if (pos_ > buffer_.size() / 2) {
+    buffer_.erase(0, pos_);
+    pos_ = 0;
+  }
+  buffer_.append(data);
+}
+
+std::optional<ReplyData> RespParser::GetReply() {
+  std::optional<ReplyData> value;
+  while (true) {
+    const auto result = ParseValue(value);
+    if (result == ParseResult::kNeedMoreData) return std::nullopt;
+    if (result == ParseResult::kNoValue) continue;
+
+    // Put the value into the enclosing aggregates, closing the complete ones
+    while (value) {
+      if (stack_.empty()) return value;
+
+      auto& frame = stack_.back();
+      frame.elements.push_back(std::move(*value));
+      value.reset();
+      if (frame.elements.size() < frame.expected_size) break;
+
+      if (!frame.is_attribute) value.emplace(std::move(frame.elements));
+      stack_.pop_back();
+    }
+  }
+}
+
+RespParser::ParseResult RespParser::ParseValue(
+    std::optional<ReplyData>& value) {
+  const auto start = pos_;
+  const auto line = ReadLine();
+  if (!line) return ParseResult::kNeedMoreData;
+  if (line->empty()) throw ParseReplyException("Empty line in RESP reply");
+
+  const char type = line->front();
+  const auto payload = line->substr(1);
+  switch (type) {
+    case '+':
+      value.emplace(ReplyData::CreateStatus(std::string{payload}));
+      return ParseResult::kValue;
+    case '-':
+      value.emplace(ReplyData::CreateError(std::string{payload}));
+      return ParseResult::kValue;
+    case ':':
+      value.emplace(ReplyData::CreateInteger(ParseInteger(payload)));
+      return ParseResult::kValue;
+    case '_':
+      value.emplace(ReplyData::CreateNil());
+      return ParseResult::kValue;
+    case '#':
+      if (payload != "t" && payload != "f") {
+        throw ParseReplyException("Invalid boolean in RESP reply: '" +
+                                  std::string{payload} + '\'');
+      }
+      value.emplace(ReplyData::CreateInteger(payload == "t" ? 1 : 0));
+      return ParseResult::kValue;
+    case ',':
+    case '(':
+      // RESP2 returns doubles and big numbers as bulk strings
+      value.emplace(std::string{payload});
+      return ParseResult::kValue;
+    case '$':
+    case '!':
+    case '=':
+      return ParseBlob(type, payload, start, value);
+    case '*':
+    case '~':
+    case '>':
+      return StartAggregate(payload, 1, false, value);
+    case '%':
+      return StartAggregate(payload, 2, false, value);
+    case '|':
+      return StartAggregate(payload, 2, true, value);
+    default:
+      throw ParseReplyException(
+          std::string{"Unknown type in RESP reply: '"} + type + '\'');
+  }
+}
+
+RespParser::ParseResult RespParser::ParseBlob(
+    char type, std::string_view header, size_t start,
+    std::optional<ReplyData>& value) {
+  const auto length = ParseInteger(header);
+  if (length == -1 && type == '$') {
+    value.emplace(ReplyData::CreateNil());
+    return ParseResult::kValue;
+  }
+  if (length < 0 || length > kMaxBulkLength) {
+    throw ParseReplyException("Invalid bulk length in RESP reply: " +
+                              std::to_string(length));
+  }
+
+  const auto size = static_cast<size_t>(length);
+  if (buffer_.size() - pos_ < size + kCrlf.size()) {
+    // Header is parsed again when the whole blob is received
+    pos_ = start;
+    return ParseResult::kNeedMoreData;
+  }
+  if (std::string_view{buffer_}.substr(pos_ + size, kCrlf.size()) != kCrlf) {
+    throw ParseReplyException("Bulk string is not terminated in RESP reply");
+  }
+  auto blob = std::string_view{buffer_}.substr(pos_, size);
+  pos_ += size + kCrlf.size();
+
+  if (type == '!') {
+    value.emplace(ReplyData::CreateError(std::string{blob}));
+  } else if (type == '=') {
+    // Verbatim string is prefixed with its format, e.g. "txt:"
+    if (blob.size() < 4 || blob[3] != ':') {
+      throw ParseReplyException("Invalid verbatim string in RESP reply");
+    }
+    value.emplace(std::string{blob.substr(4)});
+  } else {
+    value.emplace(std::string{blob});
+  }
+  return ParseResult::kValue;
+}
+
+RespParser::ParseResult RespParser::StartAggregate(
+    std::string_view header, size_t multiplier, bool is_attribute,
+    std::optional<ReplyData>& value) {
+  const auto size = ParseInteger(header);
+  if (size == -1 && !is_attribute) {
+    value.emplace(ReplyData::CreateNil());
+    return ParseResult::kValue;
+  }
+  if (size < 0 || size > kMaxAggregateSize) {
+    throw ParseReplyException("Invalid aggregate size in RESP reply: " +
+                              std::to_string(size));
+  }
+
+  const auto expected_size = static_cast<size_t>(size) * multiplier;
+  if (expected_size == 0) {
+    if (is_attribute) return ParseResult::kNoValue;
+    value.emplace(ReplyData::Array{});
+    return ParseResult::kValue;
+  }
+
+  auto& frame = stack_.emplace_back(Frame{expected_size, is_attribute, {}});
+  // Do not trust the size until the elements are received
+  frame.elements.reserve(
+      std::min(expected_size, GetBufferedSize() / kMinValueSize + 1));
+  return ParseResult::kNoValue;
+}
+
+std::optional<std::string_view> RespParser::ReadLine() {
+  const auto end = buffer_.find(kCrlf, pos_);
+  if (end == std::string::npos) return std::nullopt;
+
+  auto line = std::string_view{buffer_}.substr(pos_, end - pos_);
+  pos_ = end + kCrlf.size();
+  return line;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// Streaming parser of RESP2 and RESP3 replies that builds ReplyData directly
+/// from the read buffer, without intermediate hiredis reply trees.
+///
+/// RESP3 types are represented as in RESP2, the same way as ReplyData does
+/// for hiredis replies: maps, sets and pushes become arrays of elements (maps
+/// are flattened into key-value pairs), booleans become integers and doubles,
+/// big numbers and verbatim strings become strings. Attributes are skipped.
+///
+/// Data may be fed in chunks of any size; the parsing of a partially received
+/// aggregate resumes from the first incomplete element.
+class RespParser final {
+ public:
+  /// Appends the data read from the socket
+  void Feed(std::string_view data);
+
+  /// Returns the next complete reply or std::nullopt if more data is needed.
+  /// @throws ParseReplyException on a protocol error, the parser must not be
+  /// used after that
+  std::optional<ReplyData> GetReply();
+
+  /// Size of the data that was fed but not parsed yet
+  size_t GetBufferedSize() const { return buffer_.size() - pos_; }
+
+ private:
+  struct Frame {
+    size_t expected_size;
+    bool is_attribute;
+    ReplyData::Array elements;
+  };
+
+  enum class ParseResult {
+    kValue,
+    /// An aggregate was started or an empty attribute was skipped
+    kNoValue,
+    kNeedMoreData,
+  };
+
+  ParseResult ParseValue(std::optional<ReplyData>& value);
+  ParseResult ParseBlob(char type, std::string_view header, size_t start,
+                        std::optional<ReplyData>& value);
+  ParseResult StartAggregate(std::string_view header, size_t multiplier,
+                             bool is_attribute,
+                             std::optional<ReplyData>& value);
+  std::optional<std::string_view> ReadLine();
+
+  std::string buffer_;
+  size_t pos_{0};
+  std::vector<Frame> stack_;
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,112 @@
+#include "resp_parser.hpp"
+
+#include <gtest/gtest.h>
+
+#include <userver/storages/redis/impl/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using redis::ReplyData;
+using redis::RespParser;
+
+namespace {
+
+ReplyData ParseSingle(std::string_view data) {
+  RespParser parser;
+  parser.Feed(data);
+  auto reply = parser.GetReply();
+  EXPECT_TRUE(reply);
+  EXPECT_FALSE(parser.GetReply());
+  EXPECT_EQ(0, parser.GetBufferedSize());
+  return reply ? std::move(*reply) : ReplyData::CreateNil();
+}
+
+}  // namespace
+
+TEST(RespParser, SimpleTypes) {
+  EXPECT_EQ("OK", ParseSingle("+OK\r\n").GetStatus());
+  EXPECT_EQ("ERR oops", ParseSingle("-ERR oops\r\n").GetError());
+  EXPECT_EQ(-42, ParseSingle(":-42\r\n").GetInt());
+  EXPECT_EQ("value", ParseSingle("$5\r\nvalue\r\n").GetString());
+  EXPECT_EQ("", ParseSingle("$0\r\n\r\n").GetString());
+  EXPECT_EQ(std::string("a\r\nb", 4),
+            ParseSingle("$4\r\na\r\nb\r\n").GetString());
+  EXPECT_TRUE(ParseSingle("$-1\r\n").IsNil());
+  EXPECT_TRUE(ParseSingle("*-1\r\n").IsNil());
+}
+
+TEST(RespParser, Arrays) {
+  const auto reply = ParseSingle("*3\r\n$1\r\na\r\n*2\r\n:1\r\n$-1\r\n*0\r\n");
+  ASSERT_TRUE(reply.IsArray());
+  ASSERT_EQ(3, reply.GetArray().size());
+  EXPECT_EQ("a", reply[0].GetString());
+  ASSERT_EQ(2, reply[1].GetArray().size());
+  EXPECT_EQ(1, reply[1][0].GetInt());
+  EXPECT_TRUE(reply[1][1].IsNil());
+  EXPECT_TRUE(reply[2].IsArray());
+  EXPECT_EQ(0, reply[2].GetArray().size());
+}
+
+TEST(RespParser, Resp3Types) {
+  EXPECT_TRUE(ParseSingle("_\r\n").IsNil());
+  EXPECT_EQ(1, ParseSingle("#t\r\n").GetInt());
+  EXPECT_EQ(0, ParseSingle("#f\r\n").GetInt());
+  EXPECT_EQ("3.14", ParseSingle(",3.14\r\n").GetString());
+  EXPECT_EQ("12345678901234567890",
+            ParseSingle("(12345678901234567890\r\n").GetString());
+  EXPECT_EQ("text", ParseSingle("=8\r\ntxt:text\r\n").GetString());
+  EXPECT_EQ("ERR blob", ParseSingle("!8\r\nERR blob\r\n").GetError());
+
+  const auto map = ParseSingle("%2\r\n+a\r\n:1\r\n+b\r\n:2\r\n");
+  ASSERT_TRUE(map.IsArray());
+  ASSERT_EQ(4, map.GetArray().size());
+  EXPECT_EQ("b", map[2].GetStatus());
+  EXPECT_EQ(2, map[3].GetInt());
+
+  EXPECT_EQ(2, ParseSingle("~2\r\n:1\r\n:2\r\n").GetArray().size());
+
+  const auto push =
+      ParseSingle(">2\r\n$10\r\ninvalidate\r\n*1\r\n$3\r\nkey\r\n");
+  ASSERT_EQ(2, push.GetArray().size());
+  EXPECT_EQ("invalidate", push[0].GetString());
+  EXPECT_EQ("key", push[1][0].GetString());
+}
+
+TEST(RespParser, AttributesAreSkipped) {
+  const auto reply =
+      ParseSingle("*2\r\n|1\r\n+ttl\r\n:3\r\n:1\r\n|0\r\n:2\r\n");
+  ASSERT_EQ(2, reply.GetArray().size());
+  EXPECT_EQ(1, reply[0].GetInt());
+  EXPECT_EQ(2, reply[1].GetInt());
+}
+
+TEST(RespParser, Chunks) {
+  const std::string data =
+      "*2\r\n$5\r\nfirst\r\n*1\r\n$6\r\nsecond\r\n+OK\r\n:7\r\n";
+
+  RespParser parser;
+  std::vector<ReplyData> replies;
+  for (const char c : data) {
+    parser.Feed(std::string_view{&c, 1});
+    while (auto reply = parser.GetReply()) replies.push_back(std::move(*reply));
+  }
+
+  ASSERT_EQ(3, replies.size());
+  EXPECT_EQ("first", replies[0][0].GetString());
+  EXPECT_EQ("second", replies[0][1][0].GetString());
+  EXPECT_EQ("OK", replies[1].GetStatus());
+  EXPECT_EQ(7, replies[2].GetInt());
+  EXPECT_EQ(0, parser.GetBufferedSize());
+}
+
+TEST(RespParser, Errors) {
+  for (const std::string_view data :
+       {"?\r\n", ":abc\r\n", "$-2\r\n", "$3\r\nabcd\r\n", "#x\r\n", "\r\n",
+        "=3\r\nabc\r\n", "*-5\r\n"}) {
+    RespParser parser;
+    parser.Feed(data);
+    EXPECT_THROW(parser.GetReply(), redis::ParseReplyException) << data;
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,28 @@
+#include "script_cache.hpp"
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+std::string ScriptCache::Add(std::string script) {
+  auto sha = crypto::hash::Sha1(script);
+  {
+    std::lock_guard lock(mutex_);
+    if (!digests_.insert(sha).second) return sha;
+    scripts_.push_back(script);
+  }
+
+  signal_script_added(script);
+  return sha;
+}
+
+std::vector<std::string> ScriptCache::GetScripts() const {
+  std::lock_guard lock(mutex_);
+  return scripts_;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/signals2/signal.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// Lua scripts registered with Sentinel::RegisterScript().
+///
+/// Every connection loads all the scripts with SCRIPT LOAD before it is
+/// reported as connected, and the scripts registered later as they are
+/// added. The scripts are never removed.
+class ScriptCache final {
+ public:
+  /// Returns the SHA1 digest of the script to be used with EVALSHA
+  std::string Add(std::string script);
+
+  std::vector<std::string> GetScripts() const;
+
+  /// Invoked with every new script, may be invoked on any thread
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  boost::signals2::signal<void(const std::string& script)> signal_script_added;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_set<std::string> digests_;
+  std::vector<std::string> scripts_;
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,7 @@
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/redis.hpp>
+#include <storages/redis/impl/script_cache.hpp>
 #include <storages/redis/impl/sentinel_impl.hpp>
 #include <storages/redis/impl/sentinel_impl_switcher.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
@@ -66,7 +67,8 @@ Sentinel::Sentinel(
     dynamic_config::Source dynamic_config_source,
     std::unique_ptr<KeyShard>&& key_shard, CommandControl command_control,
     const testsuite::RedisControl& testsuite_redis_control, ConnectionMode mode)
-    : thread_pools_(thread_pools),
+    : script_cache_(std::make_shared<ScriptCache>()),
+      thread_pools_(thread_pools),
       secdist_default_command_control_(command_control),
       testsuite_redis_control_(testsuite_redis_control) {
   config_default_command_control_.Set(
@@ -102,6 +104,8 @@ Sentinel::Sentinel(
           dynamic_config_source, mode);
     }
   });
+
+  if (mode == ConnectionMode::kCommands) impl_->SetScriptCache(script_cache_);
 }
 
 Sentinel::~Sentinel() {
@@ -321,6 +325,28 @@ void Sentinel::SetReplicationMonitoringSettings(
   impl_->SetReplicationMonitoringSettings(replication_monitoring_settings);
 }
 
+void Sentinel::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  client_side_cache_.Set(client_side_cache);
+  impl_->SetClientSideCache(std::move(client_side_cache));
+}
+
+std::shared_ptr<ClientSideCache> Sentinel::GetClientSideCache() const {
+  return client_side_cache_.Get();
+}
+
+void Sentinel::SetHotKeys(std::shared_ptr<HotKeys> hot_keys) {
+  hot_keys_.Set(std::move(hot_keys));
+}
+
+std::shared_ptr<HotKeys> Sentinel::GetHotKeys() const {
+  return hot_keys_.Get();
+}
+
+std::string Sentinel::RegisterScript(std::string script) {
+  return script_cache_->Add(std::move(script));
+}
+
 void Sentinel::SetClusterAutoTopology(bool auto_topology) {
   impl_->SetClusterAutoTopology(auto_topology);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -42,6 +43,9 @@ const auto kCheckRedisConnectedInterval = std::chrono::seconds(3);
 class SentinelImplBase;
 class SentinelImpl;
 class Shard;
+class ClientSideCache;
+class HotKeys;
+class ScriptCache;
 
 class Sentinel {
  public:
@@ -129,6 +133,20 @@ class Sentinel {
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetClusterAutoTopology(bool auto_topology);
 
+  /// Enables client-side caching of the GET and HGET replies
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> client_side_cache);
+  /// Returns nullptr if client-side caching is disabled
+  std::shared_ptr<ClientSideCache> GetClientSideCache() const;
+
+  /// Enables the detection of the hot keys among the command keys
+  void SetHotKeys(std::shared_ptr<HotKeys> hot_keys);
+  /// Returns nullptr if the detection of the hot keys is disabled
+  std::shared_ptr<HotKeys> GetHotKeys() const;
+
+  /// Loads the Lua script onto every instance, including the ones connected
+  /// later, and returns its SHA1 digest to be used with EVALSHA
+  std::string RegisterScript(std::string script);
+
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   boost::signals2::signal<void(size_t shard)> signal_instances_changed;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
@@ -154,6 +172,15 @@ class Sentinel {
             command_control, replies_to_skip};
   }
 
+  // Sends all the commands from `args` to the shard at once, the reply is an
+  // array of the replies to every command in order
+  Request MakePipelineRequest(CmdArgs&& args, size_t shard, bool master,
+                              const CommandControl& command_control) {
+    return {*this,           std::forward<CmdArgs>(args),
+            shard,           master,
+            command_control, Request::CollectRepliesTag{}};
+  }
+
   std::vector<Request> MakeRequests(CmdArgs&& args, bool master = true,
                                     const CommandControl& command_control = {},
                                     size_t replies_to_skip = 0);
@@ -163,11 +190,14 @@ class Sentinel {
   virtual void SetConfigDefaultCommandControl(
       const std::shared_ptr<CommandControl>& cc);
 
-  using UserMessageCallback = std::function<void(const std::string& channel,
-                                                 const std::string& message)>;
+  // The payload of a message is shared by all the local subscribers of the
+  // channel instead of being copied for each of them
+  using SharedMessage = std::shared_ptr<const std::string>;
+  using UserMessageCallback = std::function<void(
+      const std::string& channel, const SharedMessage& message)>;
   using UserPmessageCallback =
       std::function<void(const std::string& pattern, const std::string& channel,
-                         const std::string& message)>;
+                         const SharedMessage& message)>;
 
   using MessageCallback =
       std::function<void(ServerId server_id, const std::string& channel,
@@ -200,6 +230,10 @@ class Sentinel {
  private:
   size_t GetPublishShard(PubShard policy);
 
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
+  utils::SwappingSmart<HotKeys> hot_keys_;
+  const std::shared_ptr<ScriptCache> script_cache_;
+
   void CheckRenameParams(const std::string& key,
                          const std::string& newkey) const;
 
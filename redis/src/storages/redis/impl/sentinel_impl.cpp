@@ -275,6 +275,7 @@ bool SentinelImplBase::AdjustDeadline(
 void SentinelImpl::AsyncCommand(const SentinelCommand& scommand,
                                 size_t prev_instance_idx) {
   if (!AdjustDeadline(scommand, dynamic_config_source_)) {
+    statistics_internal_.deadline_cancelled++;
     auto reply = std::make_shared<Reply>("", ReplyData::CreateNil());
     reply->status = ReplyStatus::kTimeoutError;
     InvokeCommand(scommand.command, std::move(reply));
@@ -552,6 +553,16 @@ void SentinelImpl::SetReplicationMonitoringSettings(
     shard->SetReplicationMonitoringSettings(replication_monitoring_settings);
 }
 
+void SentinelImpl::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  for (auto& shard : master_shards_)
+    shard->SetClientSideCache(client_side_cache);
+}
+
+void SentinelImpl::SetScriptCache(std::shared_ptr<ScriptCache> script_cache) {
+  for (auto& shard : master_shards_) shard->SetScriptCache(script_cache);
+}
+
 void SentinelImpl::RequestUpdateClusterSlots(size_t shard) {
   current_slots_shard_ = shard;
   ev_thread_.Send(watch_cluster_slots_);
@@ -87,6 +87,9 @@ class SentinelImplBase {
       CommandsBufferingSettings commands_buffering_settings) = 0;
   virtual void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings) = 0;
+  virtual void SetClientSideCache(
+      std::shared_ptr<ClientSideCache> client_side_cache) = 0;
+  virtual void SetScriptCache(std::shared_ptr<ScriptCache> script_cache) = 0;
   virtual void SetClusterAutoTopology(bool /*auto_topology*/) {}
 
   static bool AdjustDeadline(
@@ -142,6 +145,9 @@ class SentinelImpl : public SentinelImplBase {
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings)
       override;
+  void SetClientSideCache(
+      std::shared_ptr<ClientSideCache> client_side_cache) override;
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache) override;
 
  private:
   static constexpr const std::chrono::milliseconds cluster_slots_timeout_ =
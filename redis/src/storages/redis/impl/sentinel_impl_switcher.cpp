@@ -153,6 +153,22 @@ void ClusterSentinelImplSwitcher::SetReplicationMonitoringSettings(
   impl->SetReplicationMonitoringSettings(replication_monitoring_settings);
 }
 
+void ClusterSentinelImplSwitcher::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> client_side_cache) {
+  client_side_cache_.Set(client_side_cache);
+  auto impl = impl_.Get();
+  UASSERT(impl);
+  impl->SetClientSideCache(std::move(client_side_cache));
+}
+
+void ClusterSentinelImplSwitcher::SetScriptCache(
+    std::shared_ptr<ScriptCache> script_cache) {
+  script_cache_.Set(script_cache);
+  auto impl = impl_.Get();
+  UASSERT(impl);
+  impl->SetScriptCache(std::move(script_cache));
+}
+
 void ClusterSentinelImplSwitcher::SetClusterAutoTopology(bool auto_topology) {
   enabled_by_config_ = auto_topology;
   UpdateImpl(true, true);
@@ -171,6 +187,12 @@ void ClusterSentinelImplSwitcher::UpdateImpl(bool async, bool wait) {
         params_.connection_security, params_.ready_callback,
         std::unique_ptr<KeyShard>(), params_.dynamic_config_source,
         params_.mode);
+    if (auto client_side_cache = client_side_cache_.Get()) {
+      sentinel->SetClientSideCache(std::move(client_side_cache));
+    }
+    if (auto script_cache = script_cache_.Get()) {
+      sentinel->SetScriptCache(std::move(script_cache));
+    }
     /// Wait using same settings that were requested by client
     if (wait) {
       params_.sentinel_thread_control.RunInEvLoopBlocking(
@@ -191,6 +213,12 @@ void ClusterSentinelImplSwitcher::UpdateImpl(bool async, bool wait) {
         params_.connection_security, params_.ready_callback,
         std::unique_ptr<KeyShard>(), params_.dynamic_config_source,
         params_.mode);
+    if (auto client_side_cache = client_side_cache_.Get()) {
+      sentinel->SetClientSideCache(std::move(client_side_cache));
+    }
+    if (auto script_cache = script_cache_.Get()) {
+      sentinel->SetScriptCache(std::move(script_cache));
+    }
     /// Wait using same settings that were requested by client
     if (wait) {
       params_.sentinel_thread_control.RunInEvLoopBlocking(
@@ -65,6 +65,9 @@ class ClusterSentinelImplSwitcher : public SentinelImplBase {
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings)
       override;
+  void SetClientSideCache(
+      std::shared_ptr<ClientSideCache> client_side_cache) override;
+  void SetScriptCache(std::shared_ptr<ScriptCache> script_cache) override;
   void SetClusterAutoTopology(bool auto_topology) override;
   ///@}
 
@@ -95,6 +98,8 @@ class ClusterSentinelImplSwitcher : public SentinelImplBase {
 
   USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected_;
   utils::SwappingSmart<SentinelImplBase> impl_;
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
+  utils::SwappingSmart<ScriptCache> script_cache_;
 
   engine::Task create_task_;
   std::atomic<bool> enabled_by_config_ = false;
@@ -7,6 +7,7 @@
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/adaptive_choice.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <userver/storages/redis/impl/base.hpp>
 
@@ -123,7 +124,8 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 
   switch (command_control.strategy) {
     case CommandControl::Strategy::kEveryDc:
-    case CommandControl::Strategy::kDefault: {
+    case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kAdaptive: {
       std::vector<unsigned char> result(instances_.size(), 0);
       for (size_t i = 0; i < instances_.size(); i++) {
         result[i] =
@@ -207,6 +209,30 @@ std::shared_ptr<Redis> Shard::GetInstance(
   return instance;
 }
 
+std::shared_ptr<Redis> Shard::GetAdaptiveInstance(
+    const std::vector<unsigned char>& available_servers, size_t skip_idx,
+    bool read_only, size_t* pinstance_idx) const {
+  const auto instance_idx = ChooseOfTwoRandom(
+      instances_.size(), [&](size_t idx) -> std::optional<double> {
+        if ((idx == skip_idx) ||
+            (!read_only && instances_[idx].info.IsReadOnly()) ||
+            !available_servers[idx])
+          return std::nullopt;
+
+        const auto& cur_inst = instances_[idx].instance;
+        if (!cur_inst || cur_inst->IsDestroying() ||
+            (cur_inst->GetState() != Redis::State::kConnected) ||
+            cur_inst->IsSyncing())
+          return std::nullopt;
+        return GetAdaptiveCost(cur_inst->GetRunningCommands(),
+                               cur_inst->GetReplyTimeEwma());
+      });
+  if (!instance_idx) return nullptr;
+
+  if (pinstance_idx) *pinstance_idx = *instance_idx;
+  return instances_[*instance_idx].instance;
+}
+
 std::vector<ServerId> Shard::GetAllInstancesServerId() const {
   std::vector<ServerId> ids;
   std::shared_lock lock(mutex_);  // protects instances_
@@ -244,8 +270,17 @@ bool Shard::AsyncCommand(CommandPtr command) {
     bool may_fallback_to_any =
         attempt != 0 && command->control.force_server_id.IsAny();
 
-    instance = GetInstance(available_servers, may_fallback_to_any, skip_idx,
-                           command->read_only, &idx);
+    instance = nullptr;
+    if (attempt == 0 &&
+        command->control.strategy == CommandControl::Strategy::kAdaptive &&
+        command->control.force_server_id.IsAny()) {
+      instance = GetAdaptiveInstance(available_servers, skip_idx,
+                                     command->read_only, &idx);
+    }
+    if (!instance) {
+      instance = GetInstance(available_servers, may_fallback_to_any, skip_idx,
+                             command->read_only, &idx);
+    }
     command->instance_idx = idx;
 
     if (instance) {
@@ -304,6 +339,10 @@ bool Shard::ProcessCreation(
     if (auto commands_buffering_settings = commands_buffering_settings_.Get())
       entry.instance->SetCommandsBufferingSettings(
           *commands_buffering_settings);
+    if (auto client_side_cache = client_side_cache_.Get())
+      entry.instance->SetClientSideCache(std::move(client_side_cache));
+    if (auto script_cache = script_cache_.Get())
+      entry.instance->SetScriptCache(std::move(script_cache));
     auto server_id = entry.instance->GetServerId();
     entry.instance->signal_state_change.connect(
         [this, server_id](Redis::State state) {
@@ -464,6 +503,33 @@ void Shard::SetReplicationMonitoringSettings(
   }
 }
 
+void Shard::SetClientSideCache(
+    const std::shared_ptr<ClientSideCache>& client_side_cache) {
+  std::shared_lock lock(mutex_);
+
+  for (const auto& instance : instances_) {
+    instance.instance->SetClientSideCache(client_side_cache);
+  }
+  for (const auto& instance : clean_wait_) {
+    instance.instance->SetClientSideCache(client_side_cache);
+  }
+
+  client_side_cache_.Set(client_side_cache);
+}
+
+void Shard::SetScriptCache(const std::shared_ptr<ScriptCache>& script_cache) {
+  std::shared_lock lock(mutex_);
+
+  for (const auto& instance : instances_) {
+    instance.instance->SetScriptCache(script_cache);
+  }
+  for (const auto& instance : clean_wait_) {
+    instance.instance->SetScriptCache(script_cache);
+  }
+
+  script_cache_.Set(script_cache);
+}
+
 std::vector<ConnectionInfoInt> Shard::GetConnectionInfosToCreate() const {
   std::shared_lock lock(mutex_);
 
@@ -80,6 +80,9 @@ class Shard {
       const std::vector<unsigned char>& available_servers,
       bool may_fallback_to_any, size_t skip_idx, bool read_only,
       size_t* pinstance_idx);
+  std::shared_ptr<Redis> GetAdaptiveInstance(
+      const std::vector<unsigned char>& available_servers, size_t skip_idx,
+      bool read_only, size_t* pinstance_idx) const;
   void Clean();
   bool ProcessCreation(
       const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool);
@@ -99,6 +102,9 @@ class Shard {
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings);
+  void SetClientSideCache(
+      const std::shared_ptr<ClientSideCache>& client_side_cache);
+  void SetScriptCache(const std::shared_ptr<ScriptCache>& script_cache);
 
  private:
   std::vector<unsigned char> GetAvailableServers(
@@ -132,6 +138,8 @@ class Shard {
   boost::signals2::signal<void(ServerId, bool)> signal_instance_ready_;
 
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
+  utils::SwappingSmart<ScriptCache> script_cache_;
 
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <optional>
 #include <string>
@@ -18,6 +19,8 @@ struct PubsubChannelStatistics {
   size_t messages_count{0};
   size_t messages_size{0};
   size_t messages_alien_count{0};
+  // The local subscriptions sharing the server subscription
+  size_t subscribers_count{0};
 
   std::optional<ServerId> server_id;
 
@@ -33,6 +36,8 @@ struct PubsubChannelStatistics {
     messages_count += other.messages_count;
     messages_size += other.messages_size;
     messages_alien_count += other.messages_alien_count;
+    // every shard serves the same local subscribers
+    subscribers_count = std::max(subscribers_count, other.subscribers_count);
     return *this;
   }
 };
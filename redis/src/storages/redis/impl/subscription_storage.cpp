@@ -380,14 +380,22 @@ PubsubShardStatistics SubscriptionStorage::GetShardStatistics(
       const auto& info = channel_info.info[shard_idx];
 
       const auto& name = channel_item.first;
-      if (info.fsm) shard_stats.by_channel.emplace(name, info.GetStatistics());
+      if (info.fsm) {
+        auto stats = info.GetStatistics();
+        stats.subscribers_count = channel_info.callbacks.size();
+        shard_stats.by_channel.emplace(name, std::move(stats));
+      }
     }
     for (const auto& pattern_item : pattern_callback_map_) {
       const auto& pattern_info = pattern_item.second;
       const auto& info = pattern_info.info[shard_idx];
 
       const auto& name = pattern_item.first;
-      if (info.fsm) shard_stats.by_channel.emplace(name, info.GetStatistics());
+      if (info.fsm) {
+        auto stats = info.GetStatistics();
+        stats.subscribers_count = pattern_info.callbacks.size();
+        shard_stats.by_channel.emplace(name, std::move(stats));
+      }
     }
   }
   return shard_stats;
@@ -608,9 +616,10 @@ void SubscriptionStorage::OnMessage(ServerId server_id,
   try {
     std::lock_guard<std::mutex> lock(mutex_);
     auto& m = callback_map_.at(channel);
+    const auto shared_message = std::make_shared<const std::string>(message);
     for (const auto& it : m.callbacks) {
       try {
-        it.second(channel, message);
+        it.second(channel, shared_message);
       } catch (const std::exception& e) {
         LOG_ERROR() << "Unhandled exception in subscriber: " << e.what();
       }
@@ -631,9 +640,10 @@ void SubscriptionStorage::OnPmessage(ServerId server_id,
   try {
     std::lock_guard<std::mutex> lock(mutex_);
     auto& m = pattern_callback_map_.at(pattern);
+    const auto shared_message = std::make_shared<const std::string>(message);
     for (const auto& it : m.callbacks) {
       try {
-        it.second(pattern, channel, message);
+        it.second(pattern, channel, shared_message);
       } catch (const std::exception& e) {
         LOG_ERROR() << "Unhandled exception in subscriber: " << e.what();
       }
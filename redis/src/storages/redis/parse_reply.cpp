@@ -2,6 +2,7 @@
 
 #include <userver/storages/redis/reply.hpp>
 #include <userver/utils/from_string.hpp>
+#include <userver/utils/text.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -10,6 +11,7 @@ namespace {
 
 const std::string kOk{"OK"};
 const std::string kPong{"PONG"};
+const std::string kBusyGroupPrefix{"BUSYGROUP"};
 
 std::string ExtractStringElem(ReplyData& array_data, size_t elem_idx,
                               const std::string& request_description) {
@@ -65,6 +67,40 @@ Point ParsePointArray(const redis::ReplyData& elem,
   }
 }
 
+std::vector<StreamEntry> ParseStreamEntries(
+    ReplyData& entries_data, const std::string& request_description) {
+  entries_data.ExpectArray(request_description);
+
+  auto& array = entries_data.GetArray();
+  std::vector<StreamEntry> result;
+  result.reserve(array.size());
+
+  for (auto& entry_data : array) {
+    entry_data.ExpectArray(request_description);
+    auto& entry = entry_data.GetArray();
+    if (entry.size() != 2) {
+      throw USERVER_NAMESPACE::redis::ParseReplyException(
+          "Unexpected reply to '" + request_description +
+          "'. Expected 2 elements in stream entry, got " +
+          entry_data.ToDebugString());
+    }
+
+    StreamEntry stream_entry;
+    stream_entry.id = ExtractStringElem(entry_data, 0, request_description);
+    if (!entry[1].IsNil()) {
+      entry[1].ExpectArray(request_description);
+      auto key_values = GetKeyValues(entry[1], request_description);
+      stream_entry.field_values.reserve(key_values.size());
+      for (auto elem : key_values) {
+        stream_entry.field_values.emplace_back(std::move(elem.Key()),
+                                               std::move(elem.Value()));
+      }
+    }
+    result.push_back(std::move(stream_entry));
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace impl {
@@ -383,6 +419,73 @@ ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) {
   return std::move(reply_data);
 }
 
+std::vector<StreamEntry> Parse(ReplyData&& reply_data,
+                               const std::string& request_description,
+                               To<std::vector<StreamEntry>>) {
+  // Nil if no entries were read before the block timeout
+  if (reply_data.IsNil()) return {};
+  reply_data.ExpectArray(request_description);
+
+  // RESP2 returns an array of [stream, entries] pairs, RESP3 returns a map
+  // that is flattened into [stream, entries, ...]
+  auto* streams = &reply_data;
+  if (!reply_data.GetArray().empty() && reply_data[0].IsArray()) {
+    if (reply_data.GetArray().size() != 1) {
+      throw USERVER_NAMESPACE::redis::ParseReplyException(
+          "Unexpected reply to '" + request_description +
+          "'. Expected entries of a single stream, got " +
+          reply_data.ToDebugString());
+    }
+    streams = &reply_data[0];
+  }
+
+  streams->ExpectArray(request_description);
+  if (streams->GetArray().empty()) return {};
+  if (streams->GetArray().size() != 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected [stream, entries] pair, got " +
+        reply_data.ToDebugString());
+  }
+  return ParseStreamEntries((*streams)[1], request_description);
+}
+
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>) {
+  reply_data.ExpectArray(request_description);
+  const auto size = reply_data.GetArray().size();
+  if (size != 2 && size != 3) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected 2 or 3 elements in array, got " +
+        reply_data.ToDebugString());
+  }
+
+  XautoclaimReply result;
+  result.next_start_id =
+      ExtractStringElem(reply_data, 0, request_description);
+  result.entries = ParseStreamEntries(reply_data[1], request_description);
+  if (size == 3) {
+    reply_data[2].ExpectArray(request_description);
+    result.deleted_ids = ParseReplyDataArray(
+        std::move(reply_data[2]), request_description,
+        To<std::vector<std::string>>{});
+  }
+  return result;
+}
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>) {
+  if (reply_data.IsError() &&
+      utils::text::StartsWith(reply_data.GetError(), kBusyGroupPrefix)) {
+    return XgroupCreateReply::kAlreadyExists;
+  }
+  reply_data.ExpectStatusEqualTo(kOk, request_description);
+  return XgroupCreateReply::kCreated;
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -86,6 +86,52 @@ UTEST_P_MT(RedisPubsubTestBasic, SimplePsubscribe, 2) {
   token.Unsubscribe();
 }
 
+UTEST_P_MT(RedisPubsubTestBasic, SharedSubscribe, 2) {
+  const std::string test_data = "something_shared";
+  const std::string test_channel = "shared_interior";
+
+  engine::SingleConsumerEvent first_success;
+  engine::SingleConsumerEvent second_success;
+
+  auto make_callback = [&](engine::SingleConsumerEvent& success) {
+    return [&test_channel, &test_data, &success](const std::string& channel,
+                                                 const std::string& data) {
+      if (channel == test_channel && data == test_data) {
+        success.Send();
+      }
+    };
+  };
+
+  auto sender = utils::CriticalAsync("sender", [&]() {
+    while (!engine::current_task::ShouldCancel()) {
+      GetClient()->Publish(test_channel, test_data, {});
+      engine::InterruptibleSleepFor(std::chrono::seconds{1});
+    }
+  });
+
+  // Both subscriptions share the single server subscription to the channel
+  redis::CommandControl cc{GetParam()};
+  auto first_token = GetSubscribeClient()->Subscribe(
+      test_channel, make_callback(first_success), cc);
+  auto second_token = GetSubscribeClient()->Subscribe(
+      test_channel, make_callback(second_success), cc);
+
+  std::chrono::seconds deadwait{15};
+  EXPECT_TRUE(first_success.WaitForEventFor(deadwait))
+      << "Couldn't receive message for " << deadwait.count() << " seconds";
+  EXPECT_TRUE(second_success.WaitForEventFor(deadwait))
+      << "Couldn't receive message for " << deadwait.count() << " seconds";
+
+  // The rest of the subscriptions keep the server subscription
+  first_token.Unsubscribe();
+  second_success.Reset();
+  EXPECT_TRUE(second_success.WaitForEventFor(deadwait))
+      << "Couldn't receive message for " << deadwait.count() << " seconds";
+
+  sender.RequestCancel();
+  second_token.Unsubscribe();
+}
+
 namespace {
 
 std::vector<redis::CommandControl> BuildTestData() {
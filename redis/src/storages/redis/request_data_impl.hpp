@@ -1,9 +1,13 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
+#include <userver/storages/redis/impl/exception.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -39,6 +43,19 @@ inline Request<ScanReply> MakeScanRequest<ScanTag::kScan>(
                                      command_control);
 }
 
+template <typename Result, typename ReplyType>
+TryGetReply<ReplyType> TryParseReply(ReplyPtr&& reply,
+                                     const std::string& request_description) {
+  if (!reply->IsOk()) return utils::unexpected(reply->status);
+
+  if constexpr (std::is_void_v<ReplyType>) {
+    ParseReply<Result, ReplyType>(std::move(reply), request_description);
+    return std::monostate{};
+  } else {
+    return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+  }
+}
+
 }  // namespace impl
 
 class RequestDataImplBase {
@@ -70,7 +87,49 @@ class RequestDataImpl final : public RequestDataImplBase,
     return ParseReply<Result, ReplyType>(std::move(reply), request_description);
   }
 
+  TryGetReply<ReplyType> TryGet(
+      const std::string& request_description) override {
+    return impl::TryParseReply<Result, ReplyType>(GetReply(),
+                                                  request_description);
+  }
+
+  ReplyPtr GetRaw() override { return GetReply(); }
+};
+
+// Passes the parsed reply to the callback before returning it, e.g. to cache
+// the reply
+template <typename Result, typename ReplyType>
+class CallbackRequestDataImpl final : public RequestDataImplBase,
+                                      public RequestDataBase<ReplyType> {
+ public:
+  using Callback = std::function<void(const ReplyType&)>;
+
+  CallbackRequestDataImpl(USERVER_NAMESPACE::redis::Request&& request,
+                          Callback callback)
+      : RequestDataImplBase(std::move(request)),
+        callback_(std::move(callback)) {}
+
+  void Wait() override { impl::Wait(GetRequest()); }
+
+  ReplyType Get(const std::string& request_description) override {
+    auto result =
+        ParseReply<Result, ReplyType>(GetReply(), request_description);
+    callback_(result);
+    return result;
+  }
+
+  TryGetReply<ReplyType> TryGet(
+      const std::string& request_description) override {
+    auto result = impl::TryParseReply<Result, ReplyType>(GetReply(),
+                                                         request_description);
+    if (result.has_value()) callback_(result.value());
+    return result;
+  }
+
   ReplyPtr GetRaw() override { return GetReply(); }
+
+ private:
+  Callback callback_;
 };
 
 template <typename Result, typename ReplyType>
@@ -105,6 +164,81 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   std::vector<RequestDataPtr> requests_;
 };
 
+// Waits for the parts of a multi-key command split by the shards of the keys.
+// The array replies are reassembled in the original key order, the counters
+// are summed up. A failure of a part is reported with the shard of the part.
+template <typename Result, typename ReplyType>
+class ShardedRequestDataImpl final : public RequestDataBase<ReplyType> {
+ public:
+  ShardedRequestDataImpl(std::vector<ShardRequest>&& requests,
+                         size_t keys_count)
+      : keys_count_(keys_count) {
+    parts_.reserve(requests.size());
+    for (auto& request : requests) {
+      parts_.push_back(
+          {std::make_unique<RequestDataImpl<Result, ReplyType>>(
+               std::move(request.request)),
+           request.shard, std::move(request.positions)});
+    }
+  }
+
+  void Wait() override {
+    for (auto& part : parts_) {
+      part.data->Wait();
+    }
+  }
+
+  ReplyType Get(const std::string& request_description) override {
+    if constexpr (std::is_void_v<ReplyType>) {
+      for (auto& part : parts_) {
+        part.data->Get(GetPartDescription(request_description, part));
+      }
+    } else if constexpr (std::is_arithmetic_v<ReplyType>) {
+      ReplyType result{0};
+      for (auto& part : parts_) {
+        result += part.data->Get(GetPartDescription(request_description, part));
+      }
+      return result;
+    } else {
+      ReplyType result(keys_count_);
+      for (auto& part : parts_) {
+        const auto description = GetPartDescription(request_description, part);
+        auto data = part.data->Get(description);
+        if (data.size() != part.positions.size()) {
+          throw USERVER_NAMESPACE::redis::ParseReplyException(
+              "Unexpected number of elements in reply to '" + description +
+              "': " + std::to_string(data.size()) +
+              " != " + std::to_string(part.positions.size()));
+        }
+        for (size_t i = 0; i < data.size(); ++i) {
+          result[part.positions[i]] = std::move(data[i]);
+        }
+      }
+      return result;
+    }
+  }
+
+  ReplyPtr GetRaw() override {
+    UASSERT_MSG(false, "Unsupported");
+    return {};
+  }
+
+ private:
+  struct Part {
+    std::unique_ptr<RequestDataBase<ReplyType>> data;
+    size_t shard;
+    std::vector<size_t> positions;
+  };
+
+  static std::string GetPartDescription(const std::string& request_description,
+                                        const Part& part) {
+    return request_description + " (shard " + std::to_string(part.shard) + ')';
+  }
+
+  const size_t keys_count_;
+  std::vector<Part> parts_;
+};
+
 template <typename Result, typename ReplyType>
 class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
  public:
@@ -117,6 +251,12 @@ class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
                                          request_description);
   }
 
+  TryGetReply<ReplyType> TryGet(
+      const std::string& request_description) override {
+    return impl::TryParseReply<Result, ReplyType>(std::move(reply_),
+                                                  request_description);
+  }
+
   ReplyPtr GetRaw() override { return std::move(reply_); }
 
  private:
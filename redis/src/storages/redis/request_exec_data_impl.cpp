@@ -1,5 +1,7 @@
 #include "request_exec_data_impl.hpp"
 
+#include <exception>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
@@ -30,6 +32,34 @@ void RequestExecDataImpl::Get(const std::string& request_description) {
   }
 }
 
+RequestPipelineExecDataImpl::RequestPipelineExecDataImpl(
+    std::vector<std::unique_ptr<RequestExecDataImpl>>&& requests)
+    : requests_(std::move(requests)) {}
+
+void RequestPipelineExecDataImpl::Wait() {
+  for (auto& request : requests_) {
+    request->Wait();
+  }
+}
+
+void RequestPipelineExecDataImpl::Get(const std::string& request_description) {
+  // Results of the other shards are set even if one of them has failed
+  std::exception_ptr error;
+  for (auto& request : requests_) {
+    try {
+      request->Get(request_description);
+    } catch (const std::exception&) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+ReplyPtr RequestPipelineExecDataImpl::GetRaw() {
+  UASSERT_MSG(false, "Unsupported");
+  return {};
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
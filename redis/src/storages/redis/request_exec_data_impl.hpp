@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "request_data_impl.hpp"
 #include "transaction_impl.hpp"
 
@@ -24,6 +27,22 @@ class RequestExecDataImpl final : public RequestDataImplBase,
   std::vector<TransactionImpl::ResultPromise> result_promises_;
 };
 
+/// Requests of a pipeline, one per shard
+class RequestPipelineExecDataImpl final : public RequestDataBase<void> {
+ public:
+  explicit RequestPipelineExecDataImpl(
+      std::vector<std::unique_ptr<RequestExecDataImpl>>&& requests);
+
+  void Wait() override;
+
+  void Get(const std::string& request_description) override;
+
+  ReplyPtr GetRaw() override;
+
+ private:
+  std::vector<std::unique_ptr<RequestExecDataImpl>> requests_;
+};
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
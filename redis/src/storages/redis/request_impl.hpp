@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <userver/storages/redis/request.hpp>
 
@@ -19,6 +21,16 @@ Request<Result, ReplyType> CreateRequest(
       std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateRequestWithCallback(
+    USERVER_NAMESPACE::redis::Request&& request,
+    typename CallbackRequestDataImpl<Result, ReplyType>::Callback callback,
+    Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<CallbackRequestDataImpl<Result, ReplyType>>(
+          std::move(request), std::move(callback)));
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
@@ -34,6 +46,15 @@ Request<Result, ReplyType> CreateAggregateRequest(
           std::move(req_data)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateShardedRequest(
+    std::vector<ShardRequest>&& requests, size_t keys_count,
+    Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<ShardedRequestDataImpl<Result, ReplyType>>(
+          std::move(requests), keys_count));
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateDummyRequest(
     ReplyPtr&& reply, Request<Result, ReplyType>* /* for ADL */) {
@@ -50,6 +71,14 @@ Request CreateRequest(USERVER_NAMESPACE::redis::Request&& request) {
   return impl::CreateRequest(std::move(request), tmp);
 }
 
+template <typename Request, typename Callback>
+Request CreateRequestWithCallback(USERVER_NAMESPACE::redis::Request&& request,
+                                  Callback&& callback) {
+  Request* tmp = nullptr;
+  return impl::CreateRequestWithCallback(
+      std::move(request), std::forward<Callback>(callback), tmp);
+}
+
 template <typename Request>
 Request CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests) {
@@ -57,6 +86,13 @@ Request CreateAggregateRequest(
   return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+template <typename Request>
+Request CreateShardedRequest(std::vector<ShardRequest>&& requests,
+                             size_t keys_count) {
+  Request* tmp = nullptr;
+  return impl::CreateShardedRequest(std::move(requests), keys_count, tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
   Request* tmp = nullptr;
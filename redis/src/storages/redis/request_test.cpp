@@ -15,4 +15,24 @@ TEST(ScanRequest, PostfixIncrementCorrect) {
   EXPECT_EQ(it, scan_request.end());
 }
 
+TEST(Request, TryGet) {
+  auto request =
+      storages::redis::CreateMockRequest<storages::redis::RequestGet>("value");
+  const auto reply = request.TryGet();
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_EQ(reply.value(), "value");
+
+  auto void_request =
+      storages::redis::CreateMockRequest<storages::redis::RequestSet>();
+  EXPECT_TRUE(void_request.TryGet().has_value());
+}
+
+TEST(Request, TryGetTimeout) {
+  auto request = storages::redis::CreateMockRequestTimeout<
+      storages::redis::RequestGet>();
+  const auto reply = request.TryGet();
+  ASSERT_FALSE(reply.has_value());
+  EXPECT_EQ(reply.error(), redis::ReplyStatus::kTimeoutError);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,251 @@
+#include <storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+
+#include <userver/storages/redis/client.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::chrono::milliseconds kReadRetryDelay{100};
+
+StreamConsumerSettings CapBlockTimeout(StreamConsumerSettings&& settings,
+                                       bool is_shared_client) {
+  if (is_shared_client &&
+      settings.block_timeout > StreamConsumer::kSharedClientMaxBlockTimeout) {
+    LOG_WARNING() << "block_timeout of '" << settings.stream
+                  << "' stream consumer is capped by "
+                  << StreamConsumer::kSharedClientMaxBlockTimeout.count()
+                  << "ms, because XREADGROUP shares the connections "
+                     "with XACK; use a separate read_db for longer blocks";
+    settings.block_timeout = StreamConsumer::kSharedClientMaxBlockTimeout;
+  }
+  return std::move(settings);
+}
+
+// Stream entry ids are "<milliseconds since epoch>-<sequence number>"
+std::optional<std::chrono::milliseconds> GetEntryAge(const std::string& id) {
+  int64_t ms = 0;
+  const auto* end = id.data() + id.size();
+  const auto [ptr, ec] = std::from_chars(id.data(), end, ms);
+  if (ec != std::errc{} || ptr == end || *ptr != '-') return std::nullopt;
+
+  const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::now().time_since_epoch());
+  return std::max(now - std::chrono::milliseconds{ms},
+                  std::chrono::milliseconds{0});
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const StreamConsumerStatistics& stats) {
+  writer["entries"]["read"] = stats.read;
+  writer["entries"]["claimed"] = stats.claimed;
+  writer["entries"]["processed"] = stats.processed;
+  writer["entries"]["failed"] = stats.failed;
+  writer["entries"]["acked"] = stats.acked;
+  writer["errors"] = stats.errors;
+  writer["in_flight"] = stats.in_flight.load();
+  writer["lag_ms"] = stats.lag_ms.load();
+}
+
+StreamConsumer::StreamConsumer(ClientPtr client, ClientPtr read_client,
+                               StreamConsumerSettings settings,
+                               ProcessFunc process)
+    : client_(std::move(client)),
+      read_client_(std::move(read_client)),
+      settings_(CapBlockTimeout(std::move(settings), client_ == read_client_)),
+      process_(std::move(process)),
+      dispatcher_(engine::current_task::GetTaskProcessor()),
+      in_flight_(settings_.max_in_flight) {}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Start() {
+  try {
+    const auto reply =
+        client_->XgroupCreate(settings_.stream, settings_.group, "$", {}).Get();
+    if (reply == XgroupCreateReply::kCreated) {
+      LOG_INFO() << "Created consumer group '" << settings_.group << "' for '"
+                 << settings_.stream << "' stream";
+    }
+  } catch (const std::exception& ex) {
+    // The group may be created by another consumer later, reads are retried
+    LOG_ERROR() << "Failed to create consumer group '" << settings_.group
+                << "' for '" << settings_.stream << "' stream: " << ex.what();
+  }
+
+  LOG_INFO() << "Starting a consumer '" << settings_.consumer << "' for '"
+             << settings_.stream << "' stream";
+  read_task_ = engine::AsyncNoSpan(dispatcher_, [this] { ReadLoop(); });
+  claim_task_.Start("redis_stream_claim_" + settings_.stream,
+                    settings_.claim_interval, [this] { Claim(); });
+}
+
+void StreamConsumer::Stop() {
+  if (read_task_.IsValid()) read_task_.SyncCancel();
+  claim_task_.Stop();
+  bts_.CancelAndWait();
+  FlushAcks();
+}
+
+void StreamConsumer::WriteStatistics(utils::statistics::Writer& writer) const {
+  writer.ValueWithLabels(stats_, {{"redis_stream", settings_.stream},
+                                  {"redis_consumer_group", settings_.group}});
+}
+
+void StreamConsumer::ReadLoop() {
+  // The entries that were read but not acknowledged before the restart
+  // are read first, they are pending for the same consumer name
+  std::optional<std::string> pending_start_id{"0"};
+
+  while (!engine::current_task::ShouldCancel()) {
+    FlushAcks();
+
+    XreadgroupOptions options;
+    options.count = settings_.batch_size;
+    if (!pending_start_id) options.block = settings_.block_timeout;
+
+    std::vector<StreamEntry> entries;
+    try {
+      entries = read_client_
+                    ->Xreadgroup(settings_.stream, settings_.group,
+                                 settings_.consumer,
+                                 pending_start_id.value_or(">"), options, {})
+                    .Get();
+    } catch (const std::exception& ex) {
+      if (engine::current_task::ShouldCancel()) break;
+      ++stats_.errors;
+      LOG_LIMITED_WARNING() << "Failed to read '" << settings_.stream
+                            << "' stream: " << ex.what();
+      engine::InterruptibleSleepFor(kReadRetryDelay);
+      continue;
+    }
+
+    if (pending_start_id) {
+      if (entries.empty()) {
+        pending_start_id.reset();
+      } else {
+        pending_start_id = entries.back().id;
+      }
+    }
+    stats_.read += utils::statistics::Rate{entries.size()};
+    Dispatch(std::move(entries));
+  }
+}
+
+void StreamConsumer::Claim() {
+  std::string start_id = "0-0";
+  do {
+    XautoclaimReply reply;
+    try {
+      reply = client_
+                  ->Xautoclaim(settings_.stream, settings_.group,
+                               settings_.consumer,
+                               settings_.claim_min_idle_time, start_id,
+                               settings_.batch_size, {})
+                  .Get();
+    } catch (const std::exception& ex) {
+      ++stats_.errors;
+      LOG_WARNING() << "Failed to claim pending entries of '"
+                    << settings_.stream << "' stream: " << ex.what();
+      return;
+    }
+    stats_.claimed += utils::statistics::Rate{reply.entries.size()};
+    Dispatch(std::move(reply.entries));
+    start_id = std::move(reply.next_start_id);
+  } while (start_id != "0-0" && !engine::current_task::ShouldCancel());
+}
+
+void StreamConsumer::Dispatch(std::vector<StreamEntry> entries) {
+  for (auto& entry : entries) {
+    if (const auto age = GetEntryAge(entry.id)) {
+      stats_.lag_ms = age->count();
+    }
+
+    // A pending entry that was deleted from the stream has nothing to
+    // process, it is only removed from the pending entries list
+    if (entry.field_values.empty()) {
+      AddAck(std::move(entry.id));
+      continue;
+    }
+
+    std::shared_lock lock(in_flight_);
+    ++stats_.in_flight;
+    bts_.Detach(engine::AsyncNoSpan(
+        dispatcher_,
+        [this, entry = std::move(entry), lock = std::move(lock)]() mutable {
+          ProcessEntry(std::move(entry));
+          --stats_.in_flight;
+        }));
+  }
+}
+
+void StreamConsumer::ProcessEntry(StreamEntry&& entry) {
+  tracing::Span span{"redis_stream_consume_" + settings_.stream};
+  auto id = entry.id;
+  try {
+    process_(std::move(entry));
+  } catch (const std::exception& ex) {
+    ++stats_.failed;
+    LOG_ERROR() << "Failed to process the entry " << id << " of '"
+                << settings_.stream << "' stream, " << ex.what()
+                << "; it would be claimed again";
+    return;
+  }
+  ++stats_.processed;
+  AddAck(std::move(id));
+}
+
+void StreamConsumer::AddAck(std::string id) {
+  std::vector<std::string> ids;
+  {
+    std::lock_guard lock(acks_mutex_);
+    acks_.push_back(std::move(id));
+    if (acks_.size() < settings_.ack_batch_size) return;
+    ids.swap(acks_);
+  }
+  SendAcks(std::move(ids));
+}
+
+void StreamConsumer::FlushAcks() {
+  std::vector<std::string> ids;
+  {
+    std::lock_guard lock(acks_mutex_);
+    ids.swap(acks_);
+  }
+  SendAcks(std::move(ids));
+}
+
+void StreamConsumer::SendAcks(std::vector<std::string>&& ids) {
+  if (ids.empty()) return;
+
+  const auto count = ids.size();
+  try {
+    client_->Xack(settings_.stream, settings_.group, std::move(ids), {}).Get();
+    stats_.acked += utils::statistics::Rate{count};
+  } catch (const std::exception& ex) {
+    ++stats_.errors;
+    LOG_WARNING() << "Failed to ack " << count << " entries of '"
+                  << settings_.stream << "' stream, they would be claimed "
+                  << "again: " << ex.what();
+  }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct StreamConsumerSettings {
+  std::string stream;
+  std::string group;
+  std::string consumer;
+  size_t batch_size{100};
+  std::chrono::milliseconds block_timeout{1000};
+  size_t max_in_flight{16};
+  size_t ack_batch_size{100};
+  std::chrono::milliseconds claim_min_idle_time{60000};
+  std::chrono::milliseconds claim_interval{10000};
+};
+
+StreamConsumerSettings Parse(const yaml_config::YamlConfig& config,
+                             formats::parse::To<StreamConsumerSettings>);
+
+struct StreamConsumerStatistics {
+  utils::statistics::RateCounter read;
+  utils::statistics::RateCounter claimed;
+  utils::statistics::RateCounter processed;
+  utils::statistics::RateCounter failed;
+  utils::statistics::RateCounter acked;
+  utils::statistics::RateCounter errors;
+  std::atomic<int64_t> in_flight{0};
+  std::atomic<int64_t> lag_ms{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const StreamConsumerStatistics& stats);
+
+// Reads the stream with XREADGROUP through `read_client`, processes the
+// entries in parallel and acknowledges or claims them through `client`.
+//
+// The blocking XREADGROUP holds the connection for up to `block_timeout`.
+// If `read_client` is the same as `client`, the block timeout is capped by
+// kSharedClientMaxBlockTimeout, so that XACK and XAUTOCLAIM sent to the
+// same connection do not time out waiting for it.
+class StreamConsumer final {
+ public:
+  using ProcessFunc = std::function<void(StreamEntry&&)>;
+
+  static constexpr std::chrono::milliseconds kSharedClientMaxBlockTimeout{100};
+
+  StreamConsumer(ClientPtr client, ClientPtr read_client,
+                 StreamConsumerSettings settings, ProcessFunc process);
+  ~StreamConsumer();
+
+  void Start();
+
+  // Waits for the entries being processed and sends the pending acks
+  void Stop();
+
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
+ private:
+  void ReadLoop();
+  void Claim();
+  void Dispatch(std::vector<StreamEntry> entries);
+  void ProcessEntry(StreamEntry&& entry);
+  void AddAck(std::string id);
+  void FlushAcks();
+  void SendAcks(std::vector<std::string>&& ids);
+
+  const ClientPtr client_;
+  const ClientPtr read_client_;
+  const StreamConsumerSettings settings_;
+  const ProcessFunc process_;
+  engine::TaskProcessor& dispatcher_;
+
+  engine::Semaphore in_flight_;
+  engine::Mutex acks_mutex_;
+  std::vector<std::string> acks_;
+  StreamConsumerStatistics stats_;
+
+  concurrent::BackgroundTaskStorageCore bts_;
+  engine::TaskWithResult<void> read_task_;
+  utils::PeriodicTask claim_task_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
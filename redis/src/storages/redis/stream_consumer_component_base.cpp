@@ -0,0 +1,147 @@
+#include <userver/storages/redis/stream_consumer_component_base.hpp>
+
+#include <string>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/hostinfo/blocking/get_hostname.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/storages/redis/component.hpp>
+
+#include <storages/redis/stream_consumer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+const std::string kStatisticsName = "redis-stream-consumer";
+
+}  // namespace
+
+StreamConsumerSettings Parse(const yaml_config::YamlConfig& config,
+                             formats::parse::To<StreamConsumerSettings>) {
+  StreamConsumerSettings settings;
+  settings.stream = config["stream"].As<std::string>();
+  settings.group = config["group"].As<std::string>();
+  settings.consumer = config["consumer"].As<std::string>(
+      hostinfo::blocking::GetRealHostName());
+  settings.batch_size = config["batch_size"].As<size_t>(settings.batch_size);
+  settings.block_timeout =
+      config["block_timeout"].As<std::chrono::milliseconds>(
+          settings.block_timeout);
+  settings.max_in_flight =
+      config["max_in_flight"].As<size_t>(settings.max_in_flight);
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<size_t>(settings.ack_batch_size);
+  settings.claim_min_idle_time =
+      config["claim_min_idle_time"].As<std::chrono::milliseconds>(
+          settings.claim_min_idle_time);
+  settings.claim_interval =
+      config["claim_interval"].As<std::chrono::milliseconds>(
+          settings.claim_interval);
+
+  UINVARIANT(settings.batch_size > 0, "batch_size is set to zero");
+  UINVARIANT(settings.max_in_flight > 0, "max_in_flight is set to zero");
+  UINVARIANT(settings.ack_batch_size > 0, "ack_batch_size is set to zero");
+  return settings;
+}
+
+StreamConsumerComponentBase::StreamConsumerComponentBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : components::LoggableComponentBase{config, context} {
+  auto& redis = context.FindComponent<components::Redis>(
+      config["redis_component"].As<std::string>("redis"));
+  const auto db = config["db"].As<std::string>();
+  const auto read_db = config["read_db"].As<std::string>(db);
+  auto client = redis.GetClient(db);
+  auto read_client = read_db == db ? client : redis.GetClient(read_db);
+
+  consumer_ = std::make_unique<StreamConsumer>(
+      std::move(client), std::move(read_client),
+      config.As<StreamConsumerSettings>(),
+      [this](StreamEntry&& entry) { Process(std::move(entry)); });
+
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = statistics_storage.RegisterWriter(
+      kStatisticsName, [this](utils::statistics::Writer& writer) {
+        consumer_->WriteStatistics(writer);
+      });
+}
+
+StreamConsumerComponentBase::~StreamConsumerComponentBase() = default;
+
+void StreamConsumerComponentBase::OnAllComponentsLoaded() {
+  consumer_->Start();
+}
+
+void StreamConsumerComponentBase::OnAllComponentsAreStopping() {
+  consumer_->Stop();
+}
+
+yaml_config::Schema StreamConsumerComponentBase::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: Redis Streams consumer component
+additionalProperties: false
+properties:
+    redis_component:
+        type: string
+        description: name of the components::Redis to use
+        defaultDescription: redis
+    db:
+        type: string
+        description: name of the redis database with the stream
+    read_db:
+        type: string
+        description: name of the redis database for the blocking XREADGROUP
+        defaultDescription: db
+    stream:
+        type: string
+        description: key of the stream
+    group:
+        type: string
+        description: name of the consumer group
+    consumer:
+        type: string
+        description: name of the consumer in the group
+        defaultDescription: host name
+    batch_size:
+        type: integer
+        description: max number of entries to read or to claim at once
+        defaultDescription: 100
+        minimum: 1
+    block_timeout:
+        type: string
+        description: time to wait for new entries in XREADGROUP
+        defaultDescription: 1s
+    max_in_flight:
+        type: integer
+        description: max number of entries processed at once
+        defaultDescription: 16
+        minimum: 1
+    ack_batch_size:
+        type: integer
+        description: number of processed entries acknowledged by one XACK
+        defaultDescription: 100
+        minimum: 1
+    claim_min_idle_time:
+        type: string
+        description: time after which pending entries are claimed
+        defaultDescription: 60s
+    claim_interval:
+        type: string
+        description: period of claiming pending entries
+        defaultDescription: 10s
+)");
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#include <storages/redis/stream_consumer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <storages/redis/client_redistest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class ProcessedEntries final {
+ public:
+  void Add(storages::redis::StreamEntry&& entry) {
+    {
+      std::lock_guard lock(mutex_);
+      ids_.push_back(std::move(entry.id));
+    }
+    cv_.NotifyAll();
+  }
+
+  bool WaitFor(std::size_t count) {
+    std::unique_lock lock(mutex_);
+    return cv_.WaitFor(lock, utest::kMaxTestWaitTime,
+                       [&] { return ids_.size() >= count; });
+  }
+
+  std::vector<std::string> GetIds() {
+    std::lock_guard lock(mutex_);
+    return ids_;
+  }
+
+ private:
+  engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  std::vector<std::string> ids_;
+};
+
+storages::redis::StreamConsumerSettings MakeSettings() {
+  storages::redis::StreamConsumerSettings settings;
+  settings.stream = "stream";
+  settings.group = "group";
+  settings.consumer = "consumer";
+  settings.block_timeout = std::chrono::milliseconds{10};
+  settings.ack_batch_size = 1;
+  return settings;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, StreamConsumerAcksProcessedEntries) {
+  auto client = GetClient();
+  ProcessedEntries processed;
+
+  std::string id1;
+  std::string id2;
+  {
+    storages::redis::StreamConsumer consumer{
+        client, client, MakeSettings(),
+        [&processed](auto&& entry) { processed.Add(std::move(entry)); }};
+    consumer.Start();
+
+    id1 = client->Xadd("stream", {{"field", "value1"}}, {}).Get();
+    id2 = client->Xadd("stream", {{"field", "value2"}}, {}).Get();
+    ASSERT_TRUE(processed.WaitFor(2));
+    consumer.Stop();
+  }
+  EXPECT_EQ(processed.GetIds(), (std::vector<std::string>{id1, id2}));
+
+  // Nothing is left pending after the acks
+  EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", "0", {}, {})
+                  .Get()
+                  .empty());
+  EXPECT_TRUE(client
+                  ->Xautoclaim("stream", "group", "other",
+                               std::chrono::milliseconds{0}, "0-0", 10, {})
+                  .Get()
+                  .entries.empty());
+
+  // The restarted consumer reads only the new entry
+  {
+    storages::redis::StreamConsumer consumer{
+        client, client, MakeSettings(),
+        [&processed](auto&& entry) { processed.Add(std::move(entry)); }};
+    consumer.Start();
+
+    const auto id3 = client->Xadd("stream", {{"field", "value3"}}, {}).Get();
+    ASSERT_TRUE(processed.WaitFor(3));
+    consumer.Stop();
+    EXPECT_EQ(processed.GetIds(), (std::vector<std::string>{id1, id2, id3}));
+  }
+}
+
+UTEST_F(RedisClientTest, StreamConsumerClaimsFailedEntries) {
+  auto client = GetClient();
+  ProcessedEntries processed;
+  std::atomic<bool> failed{false};
+
+  auto settings = MakeSettings();
+  settings.claim_min_idle_time = std::chrono::milliseconds{100};
+  settings.claim_interval = std::chrono::milliseconds{20};
+  storages::redis::StreamConsumer consumer{
+      client, client, std::move(settings), [&](auto&& entry) {
+        if (!failed.exchange(true)) {
+          throw std::runtime_error("processing failure");
+        }
+        processed.Add(std::move(entry));
+      }};
+  consumer.Start();
+
+  const auto id = client->Xadd("stream", {{"field", "value"}}, {}).Get();
+  ASSERT_TRUE(processed.WaitFor(1));
+  consumer.Stop();
+  EXPECT_EQ(processed.GetIds(), std::vector<std::string>{id});
+
+  EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", "0", {}, {})
+                  .Get()
+                  .empty());
+}
+
+USERVER_NAMESPACE_END
@@ -48,12 +48,13 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return subscribe_sentinel.Subscribe(
       channel,
-      [this](const std::string& channel, const std::string& message) {
+      [this](const std::string& channel,
+             const USERVER_NAMESPACE::redis::Sentinel::SharedMessage& message) {
         if (!producer_.PushNoblock(Item(message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
-              << "failed to push message '" << message << "' from channel '"
+              << "failed to push message '" << *message << "' from channel '"
               << channel
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
@@ -73,12 +74,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
   return subscribe_sentinel.Psubscribe(
       pattern,
       [this](const std::string& pattern, const std::string& channel,
-             const std::string& message) {
+             const USERVER_NAMESPACE::redis::Sentinel::SharedMessage& message) {
         if (!producer_.PushNoblock(Item(channel, message))) {
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
           LOG_ERROR()
-              << "failed to push pmessage '" << message << "' from channel '"
+              << "failed to push pmessage '" << *message << "' from channel '"
               << channel << "' from pattern '" << pattern
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
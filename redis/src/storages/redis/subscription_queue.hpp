@@ -10,20 +10,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+// The message payload is shared by the queues of all the subscriptions to the
+// channel, so a message is stored once however many subscribers there are
 struct ChannelSubscriptionQueueItem {
-  std::string message;
+  USERVER_NAMESPACE::redis::Sentinel::SharedMessage message;
 
   ChannelSubscriptionQueueItem() = default;
-  explicit ChannelSubscriptionQueueItem(std::string message)
+  explicit ChannelSubscriptionQueueItem(
+      USERVER_NAMESPACE::redis::Sentinel::SharedMessage message)
       : message(std::move(message)) {}
 };
 
 struct PatternSubscriptionQueueItem {
   std::string channel;
-  std::string message;
+  USERVER_NAMESPACE::redis::Sentinel::SharedMessage message;
 
   PatternSubscriptionQueueItem() = default;
-  PatternSubscriptionQueueItem(std::string channel, std::string message)
+  PatternSubscriptionQueueItem(
+      std::string channel,
+      USERVER_NAMESPACE::redis::Sentinel::SharedMessage message)
       : channel(std::move(channel)), message(std::move(message)) {}
 };
 
@@ -42,7 +42,7 @@ void SubscriptionTokenImpl::ProcessMessages() {
   ChannelSubscriptionQueueItem msg;
   while (queue_.PopMessage(msg)) {
     tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_message_cb_) on_message_cb_(channel_, msg.message);
+    if (on_message_cb_) on_message_cb_(channel_, *msg.message);
   }
 }
 
@@ -72,7 +72,7 @@ void PsubscriptionTokenImpl::ProcessMessages() {
   PatternSubscriptionQueueItem msg;
   while (queue_.PopMessage(msg)) {
     tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
+    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, *msg.message);
   }
 }
 
@@ -1,5 +1,6 @@
 #include <storages/redis/transaction_impl.hpp>
 
+#include <iterator>
 #include <sstream>
 
 #include <userver/storages/redis/impl/transaction_subrequest_data.hpp>
@@ -27,22 +28,21 @@ TransactionImpl::TransactionImpl(std::shared_ptr<ClientImpl> client,
       check_shards_(check_shards),
       cmd_args_({"MULTI"}) {}
 
+TransactionImpl::TransactionImpl(std::shared_ptr<ClientImpl> client, Mode mode)
+    : client_(std::move(client)),
+      check_shards_(CheckShards::kNo),
+      mode_(mode),
+      cmd_args_({"MULTI"}) {}
+
 RequestExec TransactionImpl::Exec(const CommandControl& command_control) {
+  if (mode_ == Mode::kPipeline) return ExecPipeline(command_control);
+
   if (!shard_) {
     throw EmptyTransactionException(
         "Can't determine shard. Empty transaction?");
   }
-  auto client_force_shard_idx = client_->GetForcedShardIdx();
-  if (client_force_shard_idx) {
-    if (command_control.force_shard_idx &&
-        *command_control.force_shard_idx != *client_force_shard_idx)
-      throw USERVER_NAMESPACE::redis::InvalidArgumentException(
-          "forced shard idx from CommandControl != forced shard for client (" +
-          std::to_string(*command_control.force_shard_idx) +
-          " != " + std::to_string(*client_force_shard_idx) + ')');
-    shard_ = *client_force_shard_idx;
-  } else if (command_control.force_shard_idx) {
-    shard_ = *command_control.force_shard_idx;
+  if (auto forced_shard_idx = GetForcedShardIdx(command_control)) {
+    shard_ = *forced_shard_idx;
   }
   client_->CheckShardIdx(*shard_);
   cmd_args_.Then("EXEC");
@@ -56,6 +56,55 @@ RequestExec TransactionImpl::Exec(const CommandControl& command_control) {
       std::move(result_promises_));
 }
 
+std::optional<size_t> TransactionImpl::GetForcedShardIdx(
+    const CommandControl& command_control) const {
+  auto client_force_shard_idx = client_->GetForcedShardIdx();
+  if (client_force_shard_idx) {
+    if (command_control.force_shard_idx &&
+        *command_control.force_shard_idx != *client_force_shard_idx)
+      throw USERVER_NAMESPACE::redis::InvalidArgumentException(
+          "forced shard idx from CommandControl != forced shard for client (" +
+          std::to_string(*command_control.force_shard_idx) +
+          " != " + std::to_string(*client_force_shard_idx) + ')');
+    return client_force_shard_idx;
+  }
+  return command_control.force_shard_idx;
+}
+
+RequestExec TransactionImpl::ExecPipeline(
+    const CommandControl& command_control) {
+  if (pipeline_.empty()) {
+    throw EmptyTransactionException("Empty pipeline");
+  }
+  if (auto forced_shard_idx = GetForcedShardIdx(command_control)) {
+    ShardCommands merged;
+    for (auto& [shard, commands] : pipeline_) {
+      std::move(commands.cmd_args.args.begin(), commands.cmd_args.args.end(),
+                std::back_inserter(merged.cmd_args.args));
+      std::move(commands.result_promises.begin(),
+                commands.result_promises.end(),
+                std::back_inserter(merged.result_promises));
+      merged.master |= commands.master;
+    }
+    pipeline_.clear();
+    pipeline_.emplace(*forced_shard_idx, std::move(merged));
+  }
+
+  const auto cc = client_->GetCommandControl(command_control);
+  std::vector<std::unique_ptr<RequestExecDataImpl>> requests;
+  requests.reserve(pipeline_.size());
+  for (auto& [shard, commands] : pipeline_) {
+    client_->CheckShardIdx(shard);
+    requests.push_back(std::make_unique<RequestExecDataImpl>(
+        client_->MakePipelineRequest(std::move(commands.cmd_args), shard,
+                                     commands.master, cc),
+        std::move(commands.result_promises)));
+  }
+  pipeline_.clear();
+  return RequestExec(
+      std::make_unique<RequestPipelineExecDataImpl>(std::move(requests)));
+}
+
 // redis commands:
 
 RequestAppend TransactionImpl::Append(std::string key, std::string value) {
@@ -707,6 +756,20 @@ void TransactionImpl::UpdateShard(
 }
 
 void TransactionImpl::UpdateShard(size_t shard) {
+  if (mode_ == Mode::kPipeline) {
+    if (command_shard_ && *command_shard_ != shard) {
+      std::ostringstream os;
+      os << "Storages::redis::Pipeline command must deal with the same shard "
+            "across all its keys. Shard="
+         << *command_shard_ << " was detected by the first key, but one of "
+         << "the keys used shard=" << shard;
+      command_shard_.reset();
+      throw USERVER_NAMESPACE::redis::InvalidArgumentException(os.str());
+    }
+    command_shard_ = shard;
+    return;
+  }
+
   if (shard_) {
     if (check_shards_ == CheckShards::kSame && *shard_ != shard) {
       std::ostringstream os;
@@ -725,20 +788,30 @@ void TransactionImpl::UpdateShard(size_t shard) {
 
 template <typename Result, typename ReplyType>
 Request<Result, ReplyType> TransactionImpl::DoAddCmd(
-    To<Request<Result, ReplyType>> to) {
+    To<Request<Result, ReplyType>> to, std::vector<ResultPromise>& promises) {
   engine::Promise<ReplyType> promise;
   Request<Result, ReplyType> request(
       std::make_unique<impl::TransactionSubrequestDataImpl<ReplyType>>(
           promise.get_future()));
-  result_promises_.emplace_back(std::move(promise), to);
+  promises.emplace_back(std::move(promise), to);
   return request;
 }
 
 template <typename Request, typename... Args>
 Request TransactionImpl::AddCmd(std::string command, bool master,
                                 Args&&... args) {
+  if (mode_ == Mode::kPipeline) {
+    UASSERT(command_shard_);
+    auto& commands = pipeline_[*command_shard_];
+    command_shard_.reset();
+    commands.master |= master;
+    auto request = DoAddCmd(To<Request>{}, commands.result_promises);
+    commands.cmd_args.Then(std::move(command), std::forward<Args>(args)...);
+    return request;
+  }
+
   master_ |= master;
-  auto request = DoAddCmd(To<Request>{});
+  auto request = DoAddCmd(To<Request>{}, result_promises_);
   cmd_args_.Then(std::move(command), std::forward<Args>(args)...);
   return request;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -19,9 +21,17 @@ class ClientImpl;
 
 class TransactionImpl final : public Transaction {
  public:
+  enum class Mode {
+    kTransaction,
+    /// Commands are sent to their shards without MULTI/EXEC
+    kPipeline,
+  };
+
   explicit TransactionImpl(std::shared_ptr<ClientImpl> client,
                            CheckShards check_shards = CheckShards::kSame);
 
+  TransactionImpl(std::shared_ptr<ClientImpl> client, Mode mode);
+
   RequestExec Exec(const CommandControl& command_control) override;
 
   class ResultPromise {
@@ -324,6 +334,17 @@ class TransactionImpl final : public Transaction {
   // end of redis commands
 
  private:
+  struct ShardCommands {
+    USERVER_NAMESPACE::redis::CmdArgs cmd_args;
+    std::vector<ResultPromise> result_promises;
+    bool master{false};
+  };
+
+  std::optional<size_t> GetForcedShardIdx(
+      const CommandControl& command_control) const;
+
+  RequestExec ExecPipeline(const CommandControl& command_control);
+
   void UpdateShard(const std::string& key);
   void UpdateShard(const std::vector<std::string>& keys);
   void UpdateShard(
@@ -331,19 +352,26 @@ class TransactionImpl final : public Transaction {
   void UpdateShard(size_t shard);
 
   template <typename Result, typename ReplyType>
-  Request<Result, ReplyType> DoAddCmd(To<Request<Result, ReplyType>>);
+  Request<Result, ReplyType> DoAddCmd(To<Request<Result, ReplyType>>,
+                                      std::vector<ResultPromise>& promises);
 
   template <typename Request, typename... Args>
   Request AddCmd(std::string command, bool master, Args&&... args);
 
   std::shared_ptr<ClientImpl> client_;
   const CheckShards check_shards_;
+  const Mode mode_{Mode::kTransaction};
 
   std::optional<size_t> shard_;
 
   bool master_{};
   USERVER_NAMESPACE::redis::CmdArgs cmd_args_;
   std::vector<ResultPromise> result_promises_;
+
+  // Mode::kPipeline only: shard of the command being added and the commands
+  // grouped by shard
+  std::optional<size_t> command_shard_;
+  std::map<size_t, ShardCommands> pipeline_;
 };
 
 }  // namespace storages::redis
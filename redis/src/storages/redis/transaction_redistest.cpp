@@ -851,4 +851,55 @@ UTEST_F(RedisClientTransactionTest, ReadOnlyGetGet) {
   EXPECT_EQ(slave_command_count, 4);
 }
 
+UTEST_F(RedisClientTransactionTest, PipelineSetGet) {
+  auto client = GetClient();
+  auto sentinel = GetSentinel();
+
+  auto before = sentinel->GetStatistics({});
+
+  auto pipeline = client->Pipeline();
+  auto set = pipeline->Set("key", "value");
+  auto get = pipeline->Get("key");
+  auto incr = pipeline->Incr("key");
+  pipeline->Exec(kDefaultCc).Get();
+
+  UEXPECT_NO_THROW(set.Get());
+  EXPECT_EQ(get.Get(), "value");
+  UEXPECT_THROW(incr.Get(), redis::ParseReplyException);
+
+  auto after = sentinel->GetStatistics({});
+  std::uint64_t master_command_count =
+      GetCommandCount(after.masters) - GetCommandCount(before.masters);
+
+  // No MULTI and EXEC
+  EXPECT_EQ(master_command_count, 3);
+}
+
+UTEST_F(RedisClientTransactionTest, PipelineReadOnly) {
+  auto client = GetClient();
+  auto sentinel = GetSentinel();
+
+  auto before = sentinel->GetStatistics({});
+
+  auto pipeline = client->Pipeline();
+  auto get0 = pipeline->Get("key");
+  auto get1 = pipeline->Get("key");
+  pipeline->Exec(kDefaultCc).Get();
+
+  auto after = sentinel->GetStatistics({});
+  std::uint64_t master_command_count =
+      GetCommandCount(after.masters) - GetCommandCount(before.masters);
+  std::uint64_t slave_command_count =
+      GetCommandCount(after.slaves) - GetCommandCount(before.slaves);
+
+  EXPECT_EQ(master_command_count, 0);
+  EXPECT_EQ(slave_command_count, 2);
+}
+
+UTEST_F(RedisClientTransactionTest, PipelineEmpty) {
+  auto pipeline = GetClient()->Pipeline();
+  UEXPECT_THROW(pipeline->Exec(kDefaultCc),
+                storages::redis::EmptyTransactionException);
+}
+
 USERVER_NAMESPACE_END
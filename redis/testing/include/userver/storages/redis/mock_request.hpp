@@ -68,6 +68,12 @@ class MockRequestDataTimeout final : public RequestDataBase<ReplyType> {
         USERVER_NAMESPACE::redis::ReplyStatus::kTimeoutError);
   }
 
+  TryGetReply<ReplyType> TryGet(
+      const std::string& /*request_description*/) override {
+    return utils::unexpected(
+        USERVER_NAMESPACE::redis::ReplyStatus::kTimeoutError);
+  }
+
   ReplyPtr GetRaw() override {
     UASSERT_MSG(false, "not supported in mocked request");
     return nullptr;
@@ -107,6 +107,11 @@ RequestScriptLoad MockClientBase::ScriptLoad(
   return RequestScriptLoad{nullptr};
 }
 
+Script MockClientBase::RegisterScript(std::string /*script*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return Script{{}, {}};
+}
+
 RequestExists MockClientBase::Exists(
     std::string /*key*/, const CommandControl& /*command_control*/) {
   UASSERT_MSG(false, "redis method not mocked");
@@ -590,6 +595,44 @@ RequestType MockClientBase::Type(std::string /*key*/,
   return RequestType{nullptr};
 }
 
+RequestXack MockClientBase::Xack(std::string /*key*/, std::string /*group*/,
+                                 std::vector<std::string> /*ids*/,
+                                 const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXack{nullptr};
+}
+
+RequestXadd MockClientBase::Xadd(
+    std::string /*key*/,
+    std::vector<std::pair<std::string, std::string>> /*field_values*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXadd{nullptr};
+}
+
+RequestXautoclaim MockClientBase::Xautoclaim(
+    std::string /*key*/, std::string /*group*/, std::string /*consumer*/,
+    std::chrono::milliseconds /*min_idle_time*/, std::string /*start*/,
+    size_t /*count*/, const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXautoclaim{nullptr};
+}
+
+RequestXgroupCreate MockClientBase::XgroupCreate(
+    std::string /*key*/, std::string /*group*/, std::string /*id*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXgroupCreate{nullptr};
+}
+
+RequestXreadgroup MockClientBase::Xreadgroup(
+    std::string /*key*/, std::string /*group*/, std::string /*consumer*/,
+    std::string /*id*/, XreadgroupOptions /*options*/,
+    const CommandControl& /*command_control*/) {
+  UASSERT_MSG(false, "redis method not mocked");
+  return RequestXreadgroup{nullptr};
+}
+
 RequestZadd MockClientBase::Zadd(std::string /*key*/, double /*score*/,
                                  std::string /*member*/,
                                  const CommandControl& /*command_control*/) {
@@ -779,6 +822,10 @@ TransactionPtr MockClientBase::Multi(Transaction::CheckShards check_shards) {
       shared_from_this(), (*mock_transaction_impl_creator_)(), check_shards);
 }
 
+TransactionPtr MockClientBase::Pipeline() {
+  return Multi(Transaction::CheckShards::kNo);
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
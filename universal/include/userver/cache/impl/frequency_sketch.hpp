@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Count-min sketch of 4-bit counters that approximates the access frequency
+/// of keys. Counters are halved every `10 * capacity` records, so the
+/// history of accesses fades away.
+template <typename T, typename Hash = std::hash<T>>
+class FrequencySketch final {
+ public:
+  explicit FrequencySketch(std::size_t capacity, const Hash& hash = Hash())
+      : hash_(hash) {
+    SetCapacity(capacity);
+  }
+
+  void SetCapacity(std::size_t capacity) {
+    std::size_t counters = kMinCounters;
+    while (counters < capacity * kCountersPerEntry) counters *= 2;
+
+    table_.assign(counters / kCountersPerWord, 0);
+    mask_ = counters - 1;
+    sample_size_ = (capacity ? capacity : 1) * kSampleSizeFactor;
+    records_ = 0;
+  }
+
+  void Record(const T& key) {
+    const auto hashes = GetHashes(key);
+    const auto frequency = GetFrequency(hashes);
+    if (frequency == kMaxCounter) return;
+
+    // conservative update: only the smallest counters are incremented, which
+    // reduces the overestimation caused by collisions
+    for (std::size_t i = 0; i < kDepth; ++i) {
+      const auto index = GetIndex(hashes, i);
+      if (GetCounter(index) == frequency) Increment(index);
+    }
+
+    if (++records_ == sample_size_) Age();
+  }
+
+  std::uint8_t GetFrequency(const T& key) const {
+    return GetFrequency(GetHashes(key));
+  }
+
+  void Clear() noexcept {
+    for (auto& word : table_) word = 0;
+    records_ = 0;
+  }
+
+ private:
+  static constexpr std::size_t kDepth = 4;
+  static constexpr std::size_t kCountersPerEntry = 16;
+  static constexpr std::size_t kCounterBits = 4;
+  static constexpr std::size_t kCountersPerWord = 64 / kCounterBits;
+  static constexpr std::size_t kMinCounters = 64;
+  static constexpr std::size_t kSampleSizeFactor = 10;
+  static constexpr std::uint8_t kMaxCounter = 15;
+  static constexpr std::uint64_t kHalfMask = 0x7777777777777777ULL;
+
+  struct Hashes {
+    std::uint64_t h1;
+    std::uint64_t h2;
+  };
+
+  Hashes GetHashes(const T& key) const {
+    // splitmix64 finalizer, std::hash of integers is often an identity
+    auto h = static_cast<std::uint64_t>(hash_(key));
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return {h, (h >> 32) | 1};
+  }
+
+  std::uint8_t GetFrequency(const Hashes& hashes) const {
+    auto frequency = kMaxCounter;
+    for (std::size_t i = 0; i < kDepth; ++i) {
+      const auto counter = GetCounter(GetIndex(hashes, i));
+      if (counter < frequency) frequency = counter;
+    }
+    return frequency;
+  }
+
+  std::uint64_t GetIndex(const Hashes& hashes, std::size_t i) const {
+    return (hashes.h1 + i * hashes.h2) & mask_;
+  }
+
+  std::uint8_t GetCounter(std::uint64_t index) const {
+    const auto shift = (index % kCountersPerWord) * kCounterBits;
+    return (table_[index / kCountersPerWord] >> shift) & kMaxCounter;
+  }
+
+  void Increment(std::uint64_t index) {
+    const auto shift = (index % kCountersPerWord) * kCounterBits;
+    table_[index / kCountersPerWord] += std::uint64_t{1} << shift;
+  }
+
+  void Age() noexcept {
+    for (auto& word : table_) word = (word >> 1) & kHalfMask;
+    records_ /= 2;
+  }
+
+  Hash hash_;
+  std::vector<std::uint64_t> table_;
+  std::uint64_t mask_{0};
+  std::size_t sample_size_{0};
+  std::size_t records_{0};
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
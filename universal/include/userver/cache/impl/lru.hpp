@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <boost/intrusive/link_mode.hpp>
@@ -9,6 +10,7 @@
 #include <boost/intrusive/unordered_set.hpp>
 #include <boost/intrusive/unordered_set_hook.hpp>
 
+#include <userver/cache/impl/weight.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/intrusive_link_mode.hpp>
 
@@ -28,23 +30,42 @@ class LruNode final : public LruListHook, public LruHashSetHook {
  public:
   template <typename... Args>
   explicit LruNode(Key&& key, Args&&... args)
-      : key_(std::move(key)), value_(std::forward<Args>(args)...) {}
+      : key_(std::move(key)),
+        value_(std::forward<Args>(args)...),
+        weight_(CountWeight()) {}
 
   explicit LruNode(Key&& key, Value&& value)
-      : key_(std::move(key)), value_(std::move(value)) {}
+      : key_(std::move(key)),
+        value_(std::move(value)),
+        weight_(CountWeight()) {}
 
-  void SetKey(Key key) { key_ = std::move(key); }
+  void SetKey(Key key) {
+    key_ = std::move(key);
+    weight_ = CountWeight();
+  }
 
-  void SetValue(Value&& value) { value_ = std::move(value); }
+  void SetValue(Value&& value) {
+    value_ = std::move(value);
+    weight_ = CountWeight();
+  }
 
   const Key& GetKey() const noexcept { return key_; }
 
   const Value& GetValue() const noexcept { return value_; }
   Value& GetValue() noexcept { return value_; }
 
+  // Counted on SetKey() and SetValue() only, the changes of the value made
+  // through GetValue() are not accounted
+  std::size_t GetWeight() const noexcept { return weight_; }
+
  private:
+  std::size_t CountWeight() const {
+    return impl::GetWeight(key_) + impl::GetWeight(value_);
+  }
+
   Key key_;
   Value value_;
+  std::size_t weight_;
 };
 
 template <class Key>
@@ -66,6 +87,8 @@ class LruNode<Key, EmptyPlaceholder> final : public LruListHook,
     return kValue;
   }
 
+  std::size_t GetWeight() const { return impl::GetWeight(key_); }
+
  private:
   Key key_;
 };
@@ -92,7 +115,9 @@ class LruBase final {
   LruBase(LruBase&& other) noexcept
       : buckets_(std::move(other.buckets_)),
         map_(std::move(other.map_)),
-        list_(std::move(other.list_)) {
+        list_(std::move(other.list_)),
+        weight_(std::exchange(other.weight_, 0)),
+        max_weight_(other.max_weight_) {
     other.buckets_.clear();
     other.map_.clear();
     other.list_.clear();
@@ -104,6 +129,8 @@ class LruBase final {
     swap(other.buckets_, buckets_);
     swap(other.map_, map_);
     swap(other.list_, list_);
+    std::swap(other.weight_, weight_);
+    std::swap(other.max_weight_, max_weight_);
 
     return *this;
   }
@@ -128,6 +155,9 @@ class LruBase final {
 
   void SetMaxSize(size_t new_max_size);
 
+  // 0 means that the total weight is not limited
+  void SetMaxWeight(std::size_t new_max_weight);
+
   void Clear() noexcept;
 
   template <typename Function>
@@ -143,6 +173,10 @@ class LruBase final {
 
   std::size_t GetCapacity() const;
 
+  std::size_t GetWeight() const noexcept { return weight_; }
+
+  std::size_t GetMaxWeight() const noexcept { return max_weight_; }
+
  private:
   using Node = LruNode<T, U>;
   using List =
@@ -177,10 +211,14 @@ class LruBase final {
   U& Add(const T& key, U value);
   void MarkRecentlyUsed(Node& node) noexcept;
   std::unique_ptr<Node> ExtractNode(typename List::iterator it) noexcept;
+  // Evicts the least recently used entries, but never the most recent one
+  void EvictOverweight() noexcept;
 
   std::vector<BucketType> buckets_;
   Map map_;
   List list_;
+  std::size_t weight_{0};
+  std::size_t max_weight_{0};
 };
 
 template <typename T, typename U, typename Hash, typename Equal>
@@ -195,8 +233,11 @@ template <typename T, typename U, typename Hash, typename Eq>
 bool LruBase<T, U, Hash, Eq>::Put(const T& key, U value) {
   auto it = map_.find(key, map_.hash_function(), map_.key_eq());
   if (it != map_.end()) {
+    weight_ -= it->GetWeight();
     it->SetValue(std::move(value));
+    weight_ += it->GetWeight();
     MarkRecentlyUsed(*it);
+    EvictOverweight();
     return false;
   }
 
@@ -217,7 +258,9 @@ U* LruBase<T, U, Hash, Eq>::Emplace(const T& key, Args&&... args) {
     if (map_.size() >= buckets_.size()) {
       ExtractNode(list_.begin());
     }
-    return &InsertNode(std::move(node));
+    auto& value = InsertNode(std::move(node));
+    EvictOverweight();
+    return &value;
   }
 }
 
@@ -273,6 +316,12 @@ void LruBase<T, U, Hash, Eq>::SetMaxSize(size_t new_max_size) {
   buckets_.swap(new_buckets);
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+void LruBase<T, U, Hash, Eq>::SetMaxWeight(std::size_t new_max_weight) {
+  max_weight_ = new_max_weight;
+  EvictOverweight();
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 void LruBase<T, U, Hash, Eq>::Clear() noexcept {
   while (!list_.empty()) {
@@ -310,13 +359,17 @@ template <typename T, typename U, typename Hash, typename Eq>
 U& LruBase<T, U, Hash, Eq>::Add(const T& key, U value) {
   if (map_.size() < buckets_.size()) {
     auto node = std::make_unique<Node>(T{key}, std::move(value));
-    return InsertNode(std::move(node));
+    auto& result = InsertNode(std::move(node));
+    EvictOverweight();
+    return result;
   }
 
   auto node = ExtractNode(list_.begin());
   node->SetKey(key);
   node->SetValue(std::move(value));
-  return InsertNode(std::move(node));
+  auto& result = InsertNode(std::move(node));
+  EvictOverweight();
+  return result;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -332,9 +385,18 @@ std::unique_ptr<LruNode<T, U>> LruBase<T, U, Hash, Eq>::ExtractNode(
   std::unique_ptr<Node> ret(&*it);
   map_.erase(map_.iterator_to(*it));
   list_.erase(it);
+  weight_ -= ret->GetWeight();
   return ret;
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+void LruBase<T, U, Hash, Eq>::EvictOverweight() noexcept {
+  if (!max_weight_) return;
+  while (weight_ > max_weight_ && map_.size() > 1) {
+    ExtractNode(list_.begin());
+  }
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 U& LruBase<T, U, Hash, Eq>::InsertNode(
     LruBase<T, U, Hash, Eq>::NodeType&& node) noexcept {
@@ -343,6 +405,7 @@ U& LruBase<T, U, Hash, Eq>::InsertNode(
   auto [it, ok] = map_.insert(*node);  // noexcept
   UASSERT(ok);
   list_.insert(list_.end(), *node);  // noexcept
+  weight_ += node->GetWeight();
 
   return node.release()->GetValue();
 }
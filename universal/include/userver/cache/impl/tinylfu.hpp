@@ -0,0 +1,279 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include <userver/cache/impl/frequency_sketch.hpp>
+#include <userver/cache/impl/lru.hpp>
+
+/*
+
+W-TinyLFU: new keys get into a small LRU window first. A key evicted from the
+window is admitted into the main LRU only if it is used more frequently than
+the key it would evict from there, so a scan of cold keys can't wash out the
+hot ones.
+
+See "TinyLFU: A Highly Efficient Cache Admission Policy" by G. Einziger,
+R. Friedman and B. Manes.
+
+Hit rate on the scan workload of cache/lru_benchmark.cpp:
+
+Cache size        Lru       Slru    TinyLfu
+       256   0.104523   0.134479   0.121892
+      1024   0.207027   0.235636   0.238195
+      4096   0.396638   0.420061   0.455577
+
+*/
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class TinyLfuBase final {
+ public:
+  using NodeType = std::unique_ptr<LruNode<T, U>>;
+
+  explicit TinyLfuBase(std::size_t max_size, const Hash& hash = Hash(),
+                       const Equal& equal = Equal());
+  ~TinyLfuBase() = default;
+
+  TinyLfuBase(TinyLfuBase&& other) noexcept = default;
+
+  TinyLfuBase& operator=(TinyLfuBase&& other) noexcept = default;
+
+  TinyLfuBase(const TinyLfuBase&) = delete;
+  TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+  bool Put(const T& key, U value);
+
+  template <typename... Args>
+  U* Emplace(const T& key, Args&&... args);
+
+  void Erase(const T& key);
+
+  U* Get(const T& key);
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  // 0 means that the total weight is not limited
+  void SetMaxWeight(std::size_t new_max_weight);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  std::size_t GetSize() const;
+
+  std::size_t GetCapacity() const;
+
+  std::size_t GetWeight() const noexcept;
+
+  std::size_t GetMaxWeight() const noexcept { return max_weight_; }
+
+ private:
+  static constexpr std::size_t kWindowPercent = 1;
+
+  static std::size_t GetWindowSize(std::size_t max_size) noexcept;
+  static std::size_t GetMainSize(std::size_t max_size) noexcept;
+
+  // Makes room in the window for a new key
+  void EvictFromWindow();
+
+  // The segments don't limit their weights themselves, so that the entries
+  // evicted from the window could get into the main LRU
+  void EvictOverweightFromWindow();
+  void EvictOverweightFromMain() noexcept;
+  bool IsMainOverweight(std::size_t extra_weight) const noexcept;
+
+  void Admit(NodeType&& candidate);
+
+  std::size_t max_size_;
+  std::size_t max_weight_{0};
+  FrequencySketch<T, Hash> sketch_;
+  LruBase<T, U, Hash, Equal> window_;
+  LruBase<T, U, Hash, Equal> main_;
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(std::size_t max_size,
+                                            const Hash& hash,
+                                            const Equal& equal)
+    : max_size_(max_size),
+      sketch_(max_size, hash),
+      window_(GetWindowSize(max_size), hash, equal),
+      main_(GetMainSize(max_size), hash, equal) {}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  sketch_.Record(key);
+
+  // Put() recounts the weight of the new value
+  if (main_.Get(key)) {
+    main_.Put(key, std::move(value));
+    EvictOverweightFromMain();
+    return false;
+  }
+  const bool is_new = !window_.Get(key);
+  if (is_new) EvictFromWindow();
+
+  window_.Put(key, std::move(value));
+  EvictOverweightFromWindow();
+  return is_new;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* TinyLfuBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+  sketch_.Record(key);
+
+  auto* value_ptr = main_.Get(key);
+  if (!value_ptr) value_ptr = window_.Get(key);
+  if (value_ptr) return value_ptr;
+
+  EvictFromWindow();
+  value_ptr = window_.Emplace(key, std::forward<Args>(args)...);
+  EvictOverweightFromWindow();
+  return value_ptr;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+  window_.Erase(key);
+  main_.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Get(const T& key) {
+  sketch_.Record(key);
+
+  auto* value_ptr = main_.Get(key);
+  if (value_ptr) return value_ptr;
+  return window_.Get(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  if (new_max_size == max_size_) return;
+
+  max_size_ = new_max_size;
+  sketch_.SetCapacity(new_max_size);
+  window_.SetMaxSize(GetWindowSize(new_max_size));
+  main_.SetMaxSize(GetMainSize(new_max_size));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxWeight(std::size_t new_max_weight) {
+  max_weight_ = new_max_weight;
+  EvictOverweightFromWindow();
+  EvictOverweightFromMain();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+  window_.Clear();
+  main_.Clear();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  window_.VisitAll(func);
+  main_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  window_.VisitAll(func);
+  main_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetSize() const {
+  return window_.GetSize() + main_.GetSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetCapacity() const {
+  return window_.GetCapacity() + main_.GetCapacity();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetWeight() const noexcept {
+  return window_.GetWeight() + main_.GetWeight();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetWindowSize(
+    std::size_t max_size) noexcept {
+  const auto window_size = max_size * kWindowPercent / 100;
+  return window_size ? window_size : 1;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t TinyLfuBase<T, U, Hash, Equal>::GetMainSize(
+    std::size_t max_size) noexcept {
+  const auto window_size = GetWindowSize(max_size);
+  return max_size > window_size ? max_size - window_size : 1;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::EvictFromWindow() {
+  if (window_.GetSize() < window_.GetCapacity()) return;
+  Admit(window_.ExtractLeastUsedNode());
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::EvictOverweightFromWindow() {
+  if (!max_weight_) return;
+
+  const auto max_window_weight = GetWindowSize(max_weight_);
+  while (window_.GetWeight() > max_window_weight && window_.GetSize() > 1) {
+    Admit(window_.ExtractLeastUsedNode());
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::EvictOverweightFromMain() noexcept {
+  while (IsMainOverweight(0) && main_.GetSize() > 1) {
+    main_.ExtractLeastUsedNode();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::IsMainOverweight(
+    std::size_t extra_weight) const noexcept {
+  return max_weight_ &&
+         main_.GetWeight() + extra_weight > GetMainSize(max_weight_);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Admit(NodeType&& candidate) {
+  UASSERT(candidate);
+
+  // The candidate may have to evict several lighter victims, it is admitted
+  // only if it is used more frequently than each of them
+  const auto weight = candidate->GetWeight();
+  while (main_.GetSize() &&
+         (main_.GetSize() >= main_.GetCapacity() || IsMainOverweight(weight))) {
+    const auto* victim = main_.GetLeastUsedKey();
+    UASSERT(victim);
+    if (sketch_.GetFrequency(candidate->GetKey()) <=
+        sketch_.GetFrequency(*victim)) {
+      return;
+    }
+    main_.ExtractLeastUsedNode();
+  }
+
+  main_.InsertNode(std::move(candidate));
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+template <typename T>
+using HasUserWeight = decltype(Weight(std::declval<const T&>()));
+
+template <typename T>
+using HasCapacity = decltype(std::declval<const T&>().capacity(),
+                             std::declval<typename T::value_type>());
+
+// Pointers to incomplete types (e.g. of the C libraries) weigh as much as
+// the pointer itself
+template <typename T>
+using HasCompleteType = decltype(sizeof(T));
+
+template <typename T>
+std::size_t GetWeight(const T& value);
+
+// The estimate counts the heap storage of the containers, but not of their
+// elements, O(1) for any value
+template <typename T>
+std::size_t GetDefaultWeight(const T& value) {
+  if constexpr (meta::kIsOptional<T>) {
+    return value ? sizeof(T) - sizeof(*value) + impl::GetWeight(*value)
+                 : sizeof(T);
+  } else if constexpr (meta::kIsInstantiationOf<std::shared_ptr, T> ||
+                       meta::kIsInstantiationOf<std::unique_ptr, T>) {
+    if constexpr (meta::kIsDetected<HasCompleteType,
+                                    typename T::element_type>) {
+      return value ? sizeof(T) + impl::GetWeight(*value) : sizeof(T);
+    } else {
+      return sizeof(T);
+    }
+  } else if constexpr (meta::kIsDetected<HasCapacity, T>) {
+    return sizeof(T) + value.capacity() * sizeof(typename T::value_type);
+  } else {
+    return sizeof(T);
+  }
+}
+
+// Uses the `std::size_t Weight(const T&)` found by ADL if there is one
+template <typename T>
+std::size_t GetWeight(const T& value) {
+  if constexpr (meta::kIsDetected<HasUserWeight, T>) {
+    return static_cast<std::size_t>(Weight(value));
+  } else {
+    return impl::GetDefaultWeight(value);
+  }
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -14,6 +14,14 @@ namespace cache {
 ///
 /// LRU key value storage (LRU cache), thread safety matches Standard Library
 /// thread safety
+///
+/// Besides the max number of entries, the total weight of the entries may be
+/// limited with SetMaxWeight(). The weight of an entry is the weight of its
+/// key plus the weight of its value, by default it is `sizeof` plus the
+/// `capacity()` of the containers, `std::optional` and smart pointers count
+/// the weight of the held values. Define
+/// `std::size_t Weight(const U&)` in the namespace of `U` to provide a better
+/// estimate, e.g. for the containers of strings.
 template <typename T, typename U, typename Hash = std::hash<T>,
           typename Equal = std::equal_to<T>>
 class LruMap final {
@@ -65,6 +73,14 @@ class LruMap final {
     return impl_.SetMaxSize(new_max_size);
   }
 
+  /// Sets the max total weight of the entries, evicts the least recently used
+  /// entries if it is exceeded. 0 means no limit, that is the default.
+  /// The most recently used entry is kept even if it is heavier than the
+  /// limit.
+  void SetMaxWeight(std::size_t new_max_weight) {
+    impl_.SetMaxWeight(new_max_weight);
+  }
+
   /// Removes all the elements
   void Clear() { return impl_.Clear(); }
 
@@ -84,6 +100,12 @@ class LruMap final {
 
   std::size_t GetCapacity() const { return impl_.GetCapacity(); }
 
+  /// Returns the total weight of the entries. The changes of the values made
+  /// through the pointers returned by Get() and Emplace() are not accounted.
+  std::size_t GetWeight() const { return impl_.GetWeight(); }
+
+  std::size_t GetMaxWeight() const { return impl_.GetMaxWeight(); }
+
  private:
   impl::LruBase<T, U, Hash, Equal> impl_;
 };
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/crypto/caching_verifier.hpp
+/// @brief @copybrief crypto::CachingVerifier
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+
+#include <userver/crypto/verifiers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto {
+
+/// @brief Verifier that remembers the successfully verified signatures.
+///
+/// Asymmetric signature verification is expensive, while the same token is
+/// usually verified many times during its lifetime. CachingVerifier keeps a
+/// bounded LRU of SHA-256 hashes of the (data, signature) pairs that passed
+/// the verification by the wrapped verifier and does not verify them again
+/// until the entry expires. Failed verifications are never cached.
+///
+/// Thread-safe if the wrapped verifier is thread-safe.
+///
+/// @code
+/// const crypto::CachingVerifier verifier{
+///     std::make_shared<crypto::VerifierRs256>(public_key), {}};
+/// verifier.Verify({header_and_payload}, signature, token_expires_at);
+/// @endcode
+class CachingVerifier final : public Verifier {
+ public:
+  struct Settings {
+    /// Max count of the remembered signatures
+    std::size_t max_size{10000};
+
+    /// Max time to trust a remembered signature
+    std::chrono::seconds ttl{std::chrono::minutes{10}};
+  };
+
+  CachingVerifier(std::shared_ptr<const Verifier> verifier, Settings settings);
+  ~CachingVerifier() override;
+
+  /// Verifies a signature against the message, the success is remembered for
+  /// Settings::ttl
+  void Verify(std::initializer_list<std::string_view> data,
+              std::string_view raw_signature) const override;
+
+  /// Verifies a signature against the message, the success is remembered for
+  /// Settings::ttl but not after `expires_at`. Use it for tokens with a known
+  /// expiration time, e.g. the `exp` claim of a JWT.
+  void Verify(std::initializer_list<std::string_view> data,
+              std::string_view raw_signature,
+              std::chrono::system_clock::time_point expires_at) const;
+
+  /// Forgets all the remembered signatures, e.g. on the key rotation
+  void Clear() const;
+
+ private:
+  struct Impl;
+
+  std::shared_ptr<const Verifier> verifier_;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace crypto
+
+USERVER_NAMESPACE_END
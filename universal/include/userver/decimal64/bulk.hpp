@@ -0,0 +1,241 @@
+#pragma once
+
+/// @file userver/decimal64/bulk.hpp
+/// @brief Operations on arrays of decimal64::Decimal, e.g. on the columns
+/// of a table
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/decimal64/decimal64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace decimal64 {
+
+namespace impl {
+
+template <typename Range>
+using RangeValue = std::remove_cv_t<
+    std::remove_reference_t<decltype(*std::data(std::declval<Range&>()))>>;
+
+// Sign, 18 digits, decimal point and a separator
+inline constexpr std::size_t kMaxBulkFormattedSize = kMaxDecimalDigits + 3;
+
+// Parses the plain "[+-]?\d+(\.\d+)?" notation of at most Prec fractional
+// digits, that surely fits into int64_t. Returns false for the rest of the
+// inputs, they are parsed by the generic Parse() then
+template <int Prec>
+bool TryParseFast(std::string_view input, int64_t& result) noexcept {
+  const char* it = input.data();
+  const char* const end = it + input.size();
+
+  bool is_negative = false;
+  if (it != end && (*it == '-' || *it == '+')) {
+    is_negative = *it == '-';
+    ++it;
+  }
+
+  uint64_t value = 0;
+  const char* const before_begin = it;
+  while (it != end && static_cast<unsigned char>(*it - '0') < 10) {
+    value = value * 10 + static_cast<unsigned char>(*it - '0');
+    ++it;
+  }
+  const auto before_digits = it - before_begin;
+  if (before_digits == 0 || before_digits + Prec > kMaxDecimalDigits) {
+    return false;
+  }
+
+  int after_digits = 0;
+  if (it != end) {
+    if (*it != '.') return false;
+    ++it;
+    const char* const after_begin = it;
+    while (it != end && static_cast<unsigned char>(*it - '0') < 10) {
+      value = value * 10 + static_cast<unsigned char>(*it - '0');
+      ++it;
+    }
+    after_digits = static_cast<int>(it - after_begin);
+    if (it != end || after_digits == 0 || after_digits > Prec) return false;
+  }
+
+  value *= static_cast<uint64_t>(Pow10(Prec - after_digits));
+  result = is_negative ? -static_cast<int64_t>(value)
+                       : static_cast<int64_t>(value);
+  return true;
+}
+
+// Writes the value with exactly Prec fractional digits, as the "{:f}"
+// formatting does
+template <int Prec>
+char* FormatFixed(int64_t unbiased, char* out) noexcept {
+  uint64_t abs = static_cast<uint64_t>(unbiased);
+  if (unbiased < 0) {
+    *out++ = '-';
+    abs = 0 - abs;
+  }
+
+  constexpr auto kFactor = static_cast<uint64_t>(kPow10<Prec>);
+  out = std::to_chars(out, out + kMaxDecimalDigits + 1, abs / kFactor).ptr;
+  if constexpr (Prec > 0) {
+    *out = '.';
+    uint64_t after = abs % kFactor;
+    for (int i = Prec; i > 0; --i) {
+      out[i] = static_cast<char>('0' + after % 10);
+      after /= 10;
+    }
+    out += Prec + 1;
+  }
+  return out;
+}
+
+}  // namespace impl
+
+/// @brief Parses the strings into `out`, as the Decimal(std::string_view)
+/// constructor does. The `out` is cleared before, so that its capacity is
+/// reused by the sequential calls.
+///
+/// The plain notation of the numbers that surely fit is parsed without the
+/// generic digit loops, e.g. the "-1234.56" ones.
+///
+/// @throw decimal64::ParseError on invalid input, the position of the input
+/// is in the message
+template <typename Dec, typename StringRange>
+void ParseBulk(const StringRange& inputs, std::vector<Dec>& out) {
+  static_assert(impl::IsDecimal<Dec>::value);
+  constexpr int kPrec = Dec::kDecimalPoints;
+
+  out.clear();
+  out.reserve(std::size(inputs));
+  for (const auto& input : inputs) {
+    const std::string_view input_view{input};
+    int64_t unbiased = 0;
+    if (impl::TryParseFast<kPrec>(input_view, unbiased)) {
+      out.push_back(Dec::FromUnbiased(unbiased));
+      continue;
+    }
+
+    const auto result = impl::Parse<kPrec, typename Dec::RoundPolicy>(
+        impl::StringCharSequence(input_view), impl::ParseOptions::kNone);
+    if (result.error) {
+      throw ParseError(impl::GetErrorMessage(
+          input_view, '[' + std::to_string(out.size()) + ']',
+          result.error_position, *result.error));
+    }
+    out.push_back(result.decimal);
+  }
+}
+
+/// @brief Returns the sum of a contiguous range of decimals, e.g. of a
+/// std::vector<Decimal>
+///
+/// Unlike the sequential `+=` the intermediate sums may go out of the
+/// bounds, only the sum itself is checked.
+///
+/// @throw decimal64::OutOfBoundsError if the sum does not fit
+template <typename Range>
+auto SumBulk(const Range& values) {
+  using Dec = impl::RangeValue<Range>;
+  static_assert(impl::IsDecimal<Dec>::value);
+
+  const Dec* data = std::data(values);
+  std::size_t size = std::size(values);
+
+#if __x86_64__ || __ppc64__ || __aarch64__
+  // The halves of the mantissas are summed up separately in the chunks small
+  // enough for the sums of the halves not to overflow
+  constexpr std::size_t kMaxChunkSize = std::size_t{1} << 31;
+  __int128_t sum = 0;
+  while (size > 0) {
+    const auto chunk_size = std::min(size, kMaxChunkSize);
+    int64_t high_sum = 0;
+    uint64_t low_sum = 0;
+    for (std::size_t i = 0; i < chunk_size; ++i) {
+      const int64_t value = data[i].AsUnbiased();
+      high_sum += value >> 32;
+      low_sum += static_cast<uint32_t>(value);
+    }
+    sum += static_cast<__int128_t>(high_sum) * (int64_t{1} << 32) + low_sum;
+    data += chunk_size;
+    size -= chunk_size;
+  }
+
+  if (sum > impl::kMaxInt64 || sum < impl::kMinInt64) {
+    throw OutOfBoundsError();
+  }
+  return Dec::FromUnbiased(static_cast<int64_t>(sum));
+#else
+  Dec sum;
+  for (std::size_t i = 0; i < size; ++i) sum += data[i];
+  return sum;
+#endif
+}
+
+/// @brief Multiplies each of the contiguous range of decimals by `factor`,
+/// rounding as per `RoundPolicy`
+///
+/// Multiplication by an integer factor, e.g. by Decimal<2>{"3"}, skips the
+/// rounding and the per-value checks.
+///
+/// @throw decimal64::OutOfBoundsError if any of the products does not fit,
+/// the values are left partially multiplied then
+template <typename Range, int Prec2, typename RoundPolicy>
+void ScaleBulk(Range& values, Decimal<Prec2, RoundPolicy> factor) {
+  using Dec = impl::RangeValue<Range>;
+  static_assert(impl::IsDecimal<Dec>::value);
+  static_assert(std::is_same_v<typename Dec::RoundPolicy, RoundPolicy>);
+
+  Dec* const data = std::data(values);
+  const std::size_t size = std::size(values);
+
+  const int64_t factor_unbiased = factor.AsUnbiased();
+  if (factor_unbiased % kPow10<Prec2> != 0) {
+    for (std::size_t i = 0; i < size; ++i) data[i] *= factor;
+    return;
+  }
+
+  const int64_t multiplier = factor_unbiased / kPow10<Prec2>;
+  bool is_overflow = false;
+  for (std::size_t i = 0; i < size; ++i) {
+    int64_t result{};
+    is_overflow |=
+        __builtin_mul_overflow(data[i].AsUnbiased(), multiplier, &result);
+    data[i] = Dec::FromUnbiased(result);
+  }
+  if (is_overflow) throw OutOfBoundsError();
+}
+
+/// @brief Appends the decimals to the `buffer`, each with exactly `Prec`
+/// fractional digits and followed by the `separator`, as
+/// decimal64::ToStringTrailingZeros() does.
+///
+/// The `buffer` is grown once for all the values, so that a reused buffer
+/// costs no allocations.
+template <typename Range>
+void FormatBulk(const Range& values, std::string& buffer,
+                char separator = '\n') {
+  using Dec = impl::RangeValue<Range>;
+  static_assert(impl::IsDecimal<Dec>::value);
+
+  const auto old_size = buffer.size();
+  buffer.resize(old_size + std::size(values) * impl::kMaxBulkFormattedSize);
+
+  char* out = buffer.data() + old_size;
+  for (const auto& value : values) {
+    out = impl::FormatFixed<Dec::kDecimalPoints>(value.AsUnbiased(), out);
+    *out++ = separator;
+  }
+  buffer.resize(out - buffer.data());
+}
+
+}  // namespace decimal64
+
+USERVER_NAMESPACE_END
@@ -26,10 +26,11 @@ class Value;
 
 namespace impl {
 // rapidjson integration
+class Allocator;
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator,
-                                              ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, Allocator>;
+using Document =
+    ::rapidjson::GenericDocument<UTF8, Allocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
  public:
@@ -49,6 +50,7 @@ class VersionedValuePtr final {
 
   explicit operator bool() const;
   bool IsUnique() const;
+  bool IsArenaAllocated() const;
 
   const impl::Value* Get() const;
   impl::Value* Get();
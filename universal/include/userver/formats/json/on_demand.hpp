@@ -0,0 +1,324 @@
+#pragma once
+
+/// @file userver/formats/json/on_demand.hpp
+/// @brief @copybrief formats::json::OnDemandDocument
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/parse/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+class Value;
+
+namespace impl {
+
+enum class TapeType : std::uint8_t {
+  kNull,
+  kFalse,
+  kTrue,
+  kInt64,
+  kUint64,
+  kDouble,
+  kString,
+  kKey,
+  kArray,
+  kObject,
+};
+
+struct TapeEntry final {
+  TapeType type{TapeType::kNull};
+
+  // string length for kString and kKey, elements count for the containers
+  std::uint32_t size{0};
+
+  // index of the entry that follows the whole value
+  std::uint32_t next{0};
+
+  union {
+    std::int64_t int64;
+    std::uint64_t uint64;
+    double real;
+    std::size_t offset;  // position of the string in Tape::strings
+  };
+};
+
+// Values of the document in the document order: each container is followed by
+// its elements, object members are stored as a kKey followed by the value.
+struct Tape final {
+  std::vector<TapeEntry> entries;
+  std::string strings;
+};
+
+}  // namespace impl
+
+class ValueView;
+
+/// @ingroup userver_formats
+///
+/// @brief Validated JSON document that is parsed on demand.
+///
+/// formats::json::FromString builds a rapidjson DOM with a node and an
+/// allocation per value, even if only a few fields are read afterwards.
+/// OnDemandDocument validates the text in a single SAX pass and stores it as
+/// a flat tape of ~24 byte entries with all the strings in a single buffer.
+/// Values are accessed via the lightweight non-owning
+/// formats::json::ValueView that only converts the values that are touched.
+///
+/// Member lookup is a linear scan over the members of the object that skips
+/// the nested containers in O(1), so prefer formats::json::Value for the
+/// documents that are queried many times.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/on_demand_test.cpp  Sample OnDemandDocument usage
+class OnDemandDocument final {
+ public:
+  /// @throws formats::json::ParseException if the text is not a valid JSON
+  /// or an object has duplicate keys
+  explicit OnDemandDocument(std::string_view doc);
+
+  OnDemandDocument(OnDemandDocument&&) noexcept;
+  OnDemandDocument& operator=(OnDemandDocument&&) noexcept;
+  ~OnDemandDocument();
+
+  /// @brief Returns the view of the root value. Views stay valid while the
+  /// document is alive, including the moves of the document.
+  ValueView GetRoot() const;
+
+ private:
+  std::unique_ptr<const impl::Tape> tape_;
+};
+
+/// @brief Non-owning view of a value of formats::json::OnDemandDocument.
+///
+/// Has the read-only interface of formats::json::Value, so the generic
+/// `template <class Value> T Parse(const Value&, formats::parse::To<T>)`
+/// parsers (including the ones for standard containers) work with it.
+class ValueView final {
+ public:
+  using Exception = formats::json::Exception;
+  using ParseException = formats::json::ParseException;
+  struct DefaultConstructed {};
+
+  class const_iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = ValueView;
+    using reference = ValueView;
+    using pointer = void;
+
+    const_iterator() noexcept = default;
+
+    ValueView operator*() const;
+
+    const_iterator& operator++() noexcept;
+    const_iterator operator++(int) noexcept;
+
+    bool operator==(const const_iterator& other) const noexcept {
+      return entry_ == other.entry_;
+    }
+    bool operator!=(const const_iterator& other) const noexcept {
+      return entry_ != other.entry_;
+    }
+
+    /// @brief Returns the name of the member
+    /// @throws TypeMismatchException if the container is not an object
+    std::string GetName() const;
+
+    /// @brief Returns the index of the element
+    /// @throws TypeMismatchException if the container is not an array
+    std::size_t GetIndex() const;
+
+   private:
+    friend class ValueView;
+
+    const_iterator(const ValueView& container, std::uint32_t entry,
+                   std::size_t position) noexcept;
+
+    const impl::Tape* tape_{nullptr};
+    std::uint32_t container_{0};
+    std::uint32_t entry_{0};
+    std::size_t position_{0};
+  };
+
+  /// @brief Constructs a view that holds a null.
+  ValueView() noexcept = default;
+
+  /// @brief Access member by key for read.
+  /// @throw TypeMismatchException if value is not an object or null.
+  ValueView operator[](std::string_view key) const;
+
+  /// @brief Access array member by index for read.
+  /// @throw TypeMismatchException if value is not an array or null.
+  /// @throw OutOfBoundsException if index is greater or equal than size.
+  ValueView operator[](std::size_t index) const;
+
+  /// @brief Returns an iterator to the beginning of the held array or map.
+  /// @throw TypeMismatchException if the value is not an array, object or null
+  const_iterator begin() const;
+
+  /// @brief Returns an iterator to the end of the held array or map.
+  /// @throw TypeMismatchException if the value is not an array, object or null
+  const_iterator end() const;
+
+  /// @brief Returns whether the array or object is empty.
+  /// @throw TypeMismatchException if the value is not an array, object or null
+  bool IsEmpty() const;
+
+  /// @brief Returns array size or object members count.
+  /// @throw TypeMismatchException if the value is not an array, object or null
+  std::size_t GetSize() const;
+
+  /// @brief Returns true if *this holds nothing. When `IsMissing()` returns
+  /// `true` any attempt to get the actual value or iterate over *this will
+  /// throw MemberMissingException.
+  bool IsMissing() const noexcept;
+
+  bool IsNull() const noexcept;
+  bool IsBool() const noexcept;
+  bool IsInt() const noexcept;
+  bool IsInt64() const noexcept;
+  bool IsUInt64() const noexcept;
+  bool IsDouble() const noexcept;
+  bool IsString() const noexcept;
+  bool IsArray() const noexcept;
+  bool IsObject() const noexcept;
+
+  /// @brief Returns value of *this converted to T.
+  /// @throw Anything derived from std::exception.
+  template <typename T>
+  T As() const;
+
+  /// @brief Returns value of *this converted to T or T(args) if
+  /// this->IsMissing().
+  /// @throw Anything derived from std::exception.
+  template <typename T, typename First, typename... Rest>
+  T As(First&& default_arg, Rest&&... more_default_args) const;
+
+  /// @brief Returns value of *this converted to T or T() if
+  /// this->IsMissing().
+  /// @throw Anything derived from std::exception.
+  /// @note Use as `value.As<T>({})`
+  template <typename T>
+  T As(DefaultConstructed) const;
+
+  /// @brief Returns the string without a copy, the result is valid while
+  /// the document is alive.
+  /// @throw TypeMismatchException if the value is not a string
+  std::string_view GetStringView() const;
+
+  /// @brief Returns true if *this holds a `key`.
+  /// @throw TypeMismatchException if `*this` is not a map or null.
+  bool HasMember(std::string_view key) const;
+
+  /// @brief Returns full path to this value. The path is computed by a scan
+  /// of the document, so it is only intended for the error messages.
+  std::string GetPath() const;
+
+  /// @brief Materializes the value and all its children into a
+  /// formats::json::Value.
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  Value Clone() const;
+
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  void CheckNotMissing() const;
+
+  /// @throw TypeMismatchException if `*this` is not an array or null.
+  void CheckArrayOrNull() const;
+
+  /// @throw TypeMismatchException if `*this` is not a map or null.
+  void CheckObjectOrNull() const;
+
+  /// @throw TypeMismatchException if `*this` is not a map.
+  void CheckObject() const;
+
+  /// @throw TypeMismatchException if `*this` is not a map, array or null.
+  void CheckObjectOrArrayOrNull() const;
+
+  /// @throw TypeMismatchException if `*this` is not a map, array or null;
+  /// `OutOfBoundsException` if `index >= this->GetSize()`.
+  void CheckInBounds(std::size_t index) const;
+
+ private:
+  friend class OnDemandDocument;
+
+  static constexpr std::uint32_t kMissing = -1;
+
+  ValueView(const impl::Tape* tape, std::uint32_t index) noexcept
+      : tape_(tape), index_(index) {}
+  ValueView(const impl::Tape* tape, std::string&& missing_path) noexcept
+      : tape_(tape), index_(kMissing), missing_path_(std::move(missing_path)) {}
+
+  const impl::TapeEntry& GetEntry() const noexcept;
+  impl::TapeType GetType() const noexcept;
+  int GetExtendedType() const;
+
+  const impl::Tape* tape_{nullptr};
+  std::uint32_t index_{0};
+  std::string missing_path_;
+};
+
+template <typename T>
+T ValueView::As() const {
+  static_assert(formats::common::impl::kHasParse<ValueView, T>,
+                "There is no `Parse(const Value&, formats::parse::To<T>)` "
+                "in namespace of `T` or `formats::parse`. "
+                "Probably you forgot to include the "
+                "<userver/formats/parse/common_containers.hpp> or you "
+                "have not provided a generic `Parse` function overload.");
+
+  return Parse(*this, formats::parse::To<T>{});
+}
+
+template <>
+bool ValueView::As<bool>() const;
+
+template <>
+std::int64_t ValueView::As<std::int64_t>() const;
+
+template <>
+std::uint64_t ValueView::As<std::uint64_t>() const;
+
+template <>
+double ValueView::As<double>() const;
+
+template <>
+std::string ValueView::As<std::string>() const;
+
+template <typename T, typename First, typename... Rest>
+T ValueView::As(First&& default_arg, Rest&&... more_default_args) const {
+  if (IsMissing() || IsNull()) {
+    // intended raw ctor call, sometimes casts
+    // NOLINTNEXTLINE(google-readability-casting)
+    return T(std::forward<First>(default_arg),
+             std::forward<Rest>(more_default_args)...);
+  }
+  return As<T>();
+}
+
+template <typename T>
+T ValueView::As(ValueView::DefaultConstructed) const {
+  return (IsMissing() || IsNull()) ? T() : As<T>();
+}
+
+inline ValueView Parse(const ValueView& value, parse::To<ValueView>) {
+  return value;
+}
+
+/// Materializes the view into a DOM value, see ValueView::Clone()
+Value Parse(const ValueView& value, parse::To<Value>);
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
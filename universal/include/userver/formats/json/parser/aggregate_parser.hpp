@@ -0,0 +1,383 @@
+#pragma once
+
+/// @file userver/formats/json/parser/aggregate_parser.hpp
+/// @brief @copybrief formats::json::parser::AggregateParser
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/map_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/serialize_aggregate.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+template <typename T>
+class AggregateParser;
+
+namespace impl {
+
+template <typename T, typename = void>
+struct ParserForImpl {
+  static_assert(!sizeof(T),
+                "There is no SAX parser for the field type. Supported types "
+                "are bool, std::int32_t, std::int64_t, float, double, "
+                "std::string, ranges and maps of them and aggregates with "
+                "formats::json::AggregateFieldNames");
+};
+
+template <typename Array>
+class OwningArrayParser;
+
+template <typename Map>
+class OwningMapParser;
+
+template <>
+struct ParserForImpl<bool> {
+  using Type = BoolParser;
+};
+
+template <>
+struct ParserForImpl<std::int32_t> {
+  using Type = Int32Parser;
+};
+
+template <>
+struct ParserForImpl<std::int64_t> {
+  using Type = Int64Parser;
+};
+
+template <>
+struct ParserForImpl<float> {
+  using Type = FloatParser;
+};
+
+template <>
+struct ParserForImpl<double> {
+  using Type = DoubleParser;
+};
+
+template <>
+struct ParserForImpl<std::string> {
+  using Type = StringParser;
+};
+
+template <typename T>
+struct ParserForImpl<T,
+                     std::enable_if_t<meta::kIsRange<T> && !meta::kIsMap<T>>> {
+  using Type = OwningArrayParser<T>;
+};
+
+template <typename T>
+struct ParserForImpl<T, std::enable_if_t<meta::kIsMap<T>>> {
+  using Type = OwningMapParser<T>;
+};
+
+template <typename T>
+struct ParserForImpl<T, std::enable_if_t<kIsNamedAggregate<T>>> {
+  using Type = AggregateParser<T>;
+};
+
+}  // namespace impl
+
+/// Parser type that is used by AggregateParser for the fields of type T
+template <typename T>
+using ParserFor = typename impl::ParserForImpl<T>::Type;
+
+namespace impl {
+
+// Proxy parser that owns the parser of the items
+template <typename Array>
+class OwningArrayParser final {
+ public:
+  using Item = meta::RangeValueType<Array>;
+  using ResultType = Array;
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(Subscriber<Array>& subscriber) {
+    parser_.Subscribe(subscriber);
+  }
+
+  TypedParser<Array>& GetParser() { return parser_; }
+
+ private:
+  ParserFor<Item> item_parser_;
+  ArrayParser<Item, ParserFor<Item>, Array> parser_{item_parser_};
+};
+
+// Proxy parser that owns the parser of the values
+template <typename Map>
+class OwningMapParser final {
+ public:
+  using Value = typename Map::mapped_type;
+  using ResultType = Map;
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(Subscriber<Map>& subscriber) { parser_.Subscribe(subscriber); }
+
+  TypedParser<Map>& GetParser() { return parser_; }
+
+ private:
+  ParserFor<Value> value_parser_;
+  MapParser<Map, ParserFor<Value>> parser_{value_parser_};
+};
+
+// Parser that drops a value of any type, used for unknown fields
+class SkipParser final : public BaseParser {
+ public:
+  void Reset() { level_ = 0; }
+
+  using BaseParser::EndArray;
+  using BaseParser::EndObject;
+
+  void Null() override { MaybePopSelf(); }
+  void Bool(bool) override { MaybePopSelf(); }
+  void Int64(int64_t) override { MaybePopSelf(); }
+  void Uint64(uint64_t) override { MaybePopSelf(); }
+  void Double(double) override { MaybePopSelf(); }
+  void String(std::string_view) override { MaybePopSelf(); }
+  void StartObject() override { ++level_; }
+  void Key(std::string_view) override {}
+  void EndObject(std::size_t) override {
+    --level_;
+    MaybePopSelf();
+  }
+  void StartArray() override { ++level_; }
+  void EndArray(std::size_t) override {
+    --level_;
+    MaybePopSelf();
+  }
+
+  std::string GetPathItem() const override { return {}; }
+
+  std::string Expected() const override { return "value"; }
+
+ private:
+  void MaybePopSelf() {
+    if (level_ == 0) parser_state_->PopMe(*this);
+  }
+
+  std::size_t level_{0};
+};
+
+template <typename Field>
+struct ParsedTypeImpl {
+  using Type = Field;
+  using Sink = SubscriberSink<Field>;
+};
+
+template <typename T>
+struct ParsedTypeImpl<std::optional<T>> {
+  using Type = T;
+  using Sink = SubscriberSinkOptional<T>;
+};
+
+// Parser of a field of the aggregate that writes the result into the field
+template <typename Field>
+struct FieldParser final {
+  explicit FieldParser(Field& field) : sink(field) { parser.Subscribe(sink); }
+
+  ParserFor<typename ParsedTypeImpl<Field>::Type> parser;
+  typename ParsedTypeImpl<Field>::Sink sink;
+};
+
+template <typename T, typename Indices>
+struct FieldParsersImpl;
+
+template <typename T, std::size_t... Indices>
+struct FieldParsersImpl<T, std::index_sequence<Indices...>> {
+  using Type =
+      std::tuple<FieldParser<boost::pfr::tuple_element_t<Indices, T>>...>;
+
+  static constexpr std::array<bool, sizeof...(Indices)> kIsOptional{
+      meta::kIsOptional<boost::pfr::tuple_element_t<Indices, T>>...};
+};
+
+}  // namespace impl
+
+/// @brief SAX parser for aggregates with the field names from
+/// formats::json::AggregateFieldNames.
+///
+/// Builds the aggregate right from the JSON tokens, no formats::json::Value
+/// is created. The field parsers are chosen by formats::json::parser::ParserFor
+/// and are created once with the AggregateParser, so reuse the parser for
+/// parsing many documents. Unknown fields are skipped, missing fields of the
+/// std::optional type are left empty and missing required fields are reported
+/// as a parse error.
+///
+/// @code
+/// const auto request = formats::json::parser::ParseToType<
+///     MyRequest, formats::json::parser::AggregateParser<MyRequest>>(body);
+/// @endcode
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  AggregateParser()
+      : AggregateParser(std::make_index_sequence<kFieldsCount>{}) {}
+
+  void Reset() override {
+    state_ = State::kStart;
+    current_ = kNoField;
+    seen_ = {};
+    result_ = T{};
+  }
+
+ protected:
+  void StartObject() override {
+    if (state_ == State::kStart) {
+      state_ = State::kInside;
+      return;
+    }
+    PushField("object").StartObject();
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kInside) {
+      this->Throw("field '" + std::string(key) + "'");
+    }
+
+    current_ = FindField(key);
+    if (current_ == kNoField) {
+      skip_parser_.Reset();
+      this->parser_state_->PushParser(skip_parser_);
+      return;
+    }
+    state_ = State::kValue;
+  }
+
+  void EndObject() override {
+    if (state_ != State::kInside) this->Throw("'}'");
+
+    current_ = kNoField;
+    for (std::size_t i = 0; i < kFieldsCount; ++i) {
+      if (!seen_[i] && !kIsOptional[i]) {
+        throw InternalParseError(
+            fmt::format("Missing required field '{}'", kNames[i]));
+      }
+    }
+    this->SetResult(std::move(result_));
+  }
+
+  void Null() override {
+    if (state_ == State::kValue && kIsOptional[current_]) {
+      // result_ was reset, so the optional field is already empty
+      seen_[current_] = true;
+      state_ = State::kInside;
+      return;
+    }
+    PushField("null").Null();
+  }
+
+  void Bool(bool value) override { PushField("bool").Bool(value); }
+
+  void Int64(int64_t value) override { PushField("integer").Int64(value); }
+
+  void Uint64(uint64_t value) override { PushField("integer").Uint64(value); }
+
+  void Double(double value) override { PushField("double").Double(value); }
+
+  void String(std::string_view value) override {
+    PushField("string").String(value);
+  }
+
+  void StartArray() override { PushField("array").StartArray(); }
+
+  std::string Expected() const override {
+    switch (state_) {
+      case State::kStart:
+        return "object";
+      case State::kInside:
+        return "field or '}'";
+      case State::kValue:
+        return "value";
+    }
+
+    UINVARIANT(false, "Unexpected parser state");
+  }
+
+  std::string GetPathItem() const override {
+    if (current_ == kNoField) return {};
+    return std::string{kNames[current_]};
+  }
+
+ private:
+  static constexpr std::size_t kFieldsCount = boost::pfr::tuple_size_v<T>;
+  static constexpr std::size_t kNoField = -1;
+  static constexpr const auto& kNames = AggregateFieldNames<T>::kNames;
+
+  using FieldParsers =
+      impl::FieldParsersImpl<T, std::make_index_sequence<kFieldsCount>>;
+  static constexpr const auto& kIsOptional = FieldParsers::kIsOptional;
+
+  template <std::size_t... Indices>
+  explicit AggregateParser(std::index_sequence<Indices...>)
+      : fields_(boost::pfr::get<Indices>(result_)...) {}
+
+  static std::size_t FindField(std::string_view key) noexcept {
+    for (std::size_t i = 0; i < kFieldsCount; ++i) {
+      if (kNames[i] == key) return i;
+    }
+    return kNoField;
+  }
+
+  BaseParser& PushField(std::string_view what) {
+    if (state_ != State::kValue) {
+      // Error path must not include the field, we're not inside it yet
+      current_ = kNoField;
+      this->Throw(std::string(what));
+    }
+
+    state_ = State::kInside;
+    seen_[current_] = true;
+    return PushField(std::make_index_sequence<kFieldsCount>{});
+  }
+
+  template <std::size_t... Indices>
+  BaseParser& PushField(std::index_sequence<Indices...>) {
+    BaseParser* parser = nullptr;
+    ((Indices == current_ ? (parser = &PushField<Indices>(), true) : false) ||
+     ...);
+    UASSERT(parser);
+    return *parser;
+  }
+
+  template <std::size_t Index>
+  BaseParser& PushField() {
+    auto& field_parser = std::get<Index>(fields_).parser;
+    field_parser.Reset();
+    auto& parser = field_parser.GetParser();
+    this->parser_state_->PushParser(parser);
+    return parser;
+  }
+
+  enum class State {
+    kStart,
+    kInside,
+    kValue,
+  };
+
+  State state_{State::kStart};
+  std::size_t current_{kNoField};
+  std::array<bool, kFieldsCount> seen_{};
+  T result_{};
+  typename FieldParsers::Type fields_;
+  impl::SkipParser skip_parser_;
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <string>
+#include <string_view>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -24,6 +26,14 @@ class ParserState final {
 
   void ProcessInput(std::string_view sw);
 
+  /// Replaces `chunk` with the next part of the input, returns false at the
+  /// end of the input
+  using ChunkReader = std::function<bool(std::string& chunk)>;
+
+  /// @brief Parses the input that is read part by part, e.g. a streamed HTTP
+  /// response body. Only the current part of the input is kept in memory.
+  void ProcessChunkedInput(const ChunkReader& read_chunk);
+
   void PopMe(BaseParser& parser);
 
   [[noreturn]] void ThrowError(const std::string& err_msg);
@@ -25,6 +25,15 @@ namespace formats::json {
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// @brief Parse JSON from string into a tree allocated in an arena
+///
+/// The whole tree is allocated in a few large chunks owned by the root, so
+/// parsing is faster and destruction does not walk the tree. The memory is
+/// released only with the last formats::json::Value referencing the tree, even
+/// if it is a small subvalue of a large document. formats::json::ValueBuilder
+/// always copies such values to the heap.
+formats::json::Value FromStringWithArena(std::string_view doc);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
@@ -0,0 +1,111 @@
+#pragma once
+
+/// @file userver/formats/json/serialize_aggregate.hpp
+/// @brief SAX serialization and parsing of aggregates with named fields
+///
+/// @ingroup userver_formats_serialize_sax
+
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @brief Specialize to enable JSON serialization and parsing of an
+/// aggregate without hand-written WriteToStream and Parse functions.
+///
+/// `kNames` lists the JSON names of the aggregate fields in the order of
+/// declaration. Fields of std::optional type are not written if empty and
+/// may be missing in the input, other fields are required.
+///
+/// @code
+/// struct MyRequest {
+///   std::string name;
+///   std::optional<int> limit;
+/// };
+///
+/// template <>
+/// struct formats::json::AggregateFieldNames<MyRequest> {
+///   static constexpr std::string_view kNames[] = {"name", "limit"};
+/// };
+/// @endcode
+///
+/// The aggregate is then written to formats::json::StringBuilder via
+/// WriteToStream, parsed from formats::json::Value and
+/// formats::json::ValueView via As<T>() and parsed from the text without any
+/// DOM via formats::json::parser::AggregateParser.
+template <typename T>
+struct AggregateFieldNames {};
+
+namespace impl {
+
+template <typename T>
+using HasAggregateFieldNames = decltype(AggregateFieldNames<T>::kNames);
+
+template <typename T>
+constexpr bool IsNamedAggregate() {
+  if constexpr (meta::kIsDetected<HasAggregateFieldNames, T>) {
+    static_assert(std::is_aggregate_v<T>,
+                  "formats::json::AggregateFieldNames is specialized for a "
+                  "type that is not an aggregate");
+    static_assert(std::size(AggregateFieldNames<T>::kNames) ==
+                      boost::pfr::tuple_size_v<T>,
+                  "formats::json::AggregateFieldNames::kNames must have a "
+                  "name for each field of the aggregate");
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename Value, typename T, std::size_t... Indices>
+T ParseAggregate(const Value& value, std::index_sequence<Indices...>) {
+  constexpr const auto& kNames = AggregateFieldNames<T>::kNames;
+  // Fields are parsed left-to-right in brace-init
+  return T{value[kNames[Indices]]
+               .template As<boost::pfr::tuple_element_t<Indices, T>>()...};
+}
+
+}  // namespace impl
+
+template <typename T>
+inline constexpr bool kIsNamedAggregate = impl::IsNamedAggregate<T>();
+
+/// Writes the aggregate as a JSON object without building a DOM
+template <typename T>
+std::enable_if_t<kIsNamedAggregate<T>> WriteToStream(const T& value,
+                                                     StringBuilder& sw) {
+  StringBuilder::ObjectGuard guard{sw};
+  boost::pfr::for_each_field(value, [&sw](const auto& field, auto index) {
+    if constexpr (meta::kIsOptional<std::decay_t<decltype(field)>>) {
+      if (!field) return;
+    }
+    sw.Key(AggregateFieldNames<T>::kNames[index]);
+    WriteToStream(field, sw);
+  });
+}
+
+/// Parses the aggregate from formats::json::Value or
+/// formats::json::ValueView
+template <typename Value, typename T>
+std::enable_if_t<common::kIsFormatValue<Value> && kIsNamedAggregate<T>, T>
+Parse(const Value& value, parse::To<T>) {
+  value.CheckObject();
+  return impl::ParseAggregate<Value, T>(
+      value, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
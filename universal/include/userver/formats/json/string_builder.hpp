@@ -3,6 +3,8 @@
 /// @file userver/formats/json/string_builder.hpp
 /// @brief @copybrief formats::json::StringBuilder
 
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <string_view>
 
@@ -38,7 +40,18 @@ class StringBuilder final : public serialize::SaxStream {
   // Required by the WriteToStream fallback to Serialize
   using Value = formats::json::Value;
 
+  /// Receives the parts of the written JSON
+  using ChunkConsumer = std::function<void(std::string&&)>;
+
   StringBuilder();
+
+  /// @brief Constructs the builder that passes the written JSON to `consumer`
+  /// in parts as soon as at least `flush_threshold` bytes are buffered, so the
+  /// whole JSON is never kept in memory.
+  ///
+  /// Call Flush() after the JSON is written to pass the remaining part.
+  StringBuilder(ChunkConsumer consumer, std::size_t flush_threshold);
+
   ~StringBuilder();
 
   /// Construct this guard on new object start and its destructor will end the
@@ -67,6 +80,16 @@ class StringBuilder final : public serialize::SaxStream {
   std::string GetString() const;
   std::string_view GetStringView() const;
 
+  /// @brief Returns the JSON written so far and clears the buffer, the
+  /// following writes continue the same JSON document.
+  ///
+  /// Useful to send a huge JSON in parts without keeping it in memory.
+  std::string ExtractWrittenPart();
+
+  /// Passes the buffered part of the JSON to the ChunkConsumer, if there is
+  /// one and the buffer is not empty
+  void Flush();
+
   void WriteNull();
   void WriteString(std::string_view value);
   void WriteBool(bool value);
@@ -84,7 +107,7 @@ class StringBuilder final : public serialize::SaxStream {
 
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 112, 8> impl_;
+  utils::FastPimpl<Impl, 152, 8> impl_;
 };
 
 void WriteToStream(bool value, StringBuilder& sw);
@@ -34,6 +34,7 @@ impl::Value MakeJsonStringViewValue(std::string_view view);
 }  // namespace impl
 
 class ValueBuilder;
+class ValueView;
 
 namespace parser {
 class JsonValueParser;
@@ -266,6 +267,7 @@ class Value final {
   template <typename, common::IteratorDirection>
   friend class Iterator;
   friend class ValueBuilder;
+  friend class ValueView;
   friend class StringBuilder;
   friend class impl::InlineObjectBuilder;
   friend class impl::InlineArrayBuilder;
@@ -274,6 +276,7 @@ class Value final {
   friend class impl::StringBuffer;
 
   friend formats::json::Value FromString(std::string_view);
+  friend formats::json::Value FromStringWithArena(std::string_view);
   friend formats::json::Value FromStream(std::istream&);
   friend void Serialize(const formats::json::Value&, std::ostream&);
   friend std::string ToString(const formats::json::Value&);
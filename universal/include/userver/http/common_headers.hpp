@@ -144,6 +144,12 @@ inline constexpr PredefinedHeader kXYandexUid{"X-Yandex-UID"};
 inline constexpr PredefinedHeader kXRemoteIp{"X-Remote-IP"};
 /// @}
 
+/// @name Proxy headers
+/// @{
+inline constexpr PredefinedHeader kXForwardedFor{"X-Forwarded-For"};
+inline constexpr PredefinedHeader kXRealIp{"X-Real-IP"};
+/// @}
+
 /// @name Generic Yandex/MLU headers
 /// @{
 inline constexpr PredefinedHeader kXYaTaxiAllowAuthRequest{
@@ -169,6 +175,8 @@ inline constexpr std::string_view kMaxPendingResponses{
     "too-many-pending-responses"};
 inline constexpr std::string_view kGlobal{"global-ratelimit"};
 inline constexpr std::string_view kInFlight{"max-requests-in-flight"};
+inline constexpr std::string_view kQueueTime{"max-queue-time-exceeded"};
+inline constexpr std::string_view kMemory{"memory-limit-exceeded"};
 }  // namespace ratelimit_reason
 /// @}
 
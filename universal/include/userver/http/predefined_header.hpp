@@ -112,7 +112,18 @@ inline constexpr utils::TrivialBiMap kKnownHeadersLowercaseMap =
           .Case("x-yataxi-server-hostname", 29)
           .Case("x-yataxi-client-timeoutms", 30)
           .Case("x-yataxi-ratelimited-by", 31)
-          .Case("x-yataxi-ratelimit-reason", 32);
+          .Case("x-yataxi-ratelimit-reason", 32)
+          .Case("vary", 33)
+          .Case("etag", 34)
+          .Case("if-none-match", 35)
+          .Case("range", 36)
+          .Case("if-range", 37)
+          .Case("content-range", 38)
+          .Case("accept-ranges", 39)
+          .Case("cache-control", 40)
+          .Case("referer", 41)
+          .Case("x-forwarded-for", 42)
+          .Case("x-real-ip", 43);
     };
 
 // We use different values for "no index" at compile and run time to simplify
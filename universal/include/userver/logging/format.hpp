@@ -10,7 +10,14 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 /// Log formats
-enum class Format { kTskv, kLtsv, kRaw };
+enum class Format {
+  kTskv,
+  kLtsv,
+  kRaw,
+  /// Tags are captured as length-prefixed fields without escaping, the logger
+  /// consumer task renders them into TSKV or writes them as binary records
+  kBinary,
+};
 
 /// Parse Format enum from string
 Format FormatFromString(std::string_view format_str);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <optional>
 
 #include <userver/logging/format.hpp>
 #include <userver/logging/level.hpp>
@@ -36,6 +38,11 @@ class LoggerBase {
   Level GetLevel() const noexcept;
   virtual bool ShouldLog(Level level) const noexcept;
 
+  /// A key of the current trace for the log sampling, so that either all or
+  /// none of the messages of a trace are sampled out; std::nullopt outside
+  /// of traces
+  virtual std::optional<std::uint64_t> GetSamplingKey() const noexcept;
+
   void SetFlushOn(Level level);
   bool ShouldFlush(Level level) const;
 
@@ -135,9 +135,9 @@ class StaticLogEntry final {
 
  private:
   static constexpr std::size_t kContentSize =
-      compiler::SelectSize().For64Bit(40).For32Bit(24);
+      compiler::SelectSize().For64Bit(56).For32Bit(40);
 
-  alignas(void*) std::byte content_[kContentSize];
+  alignas(std::uint64_t) std::byte content_[kContentSize];
 };
 
 template <class NameHolder, int Line>
@@ -45,6 +45,11 @@ constexpr size_t FromHexUpperBound(size_t size) noexcept {
 /// @param out string to write data. out will be cleared
 void ToHex(std::string_view input, std::string& out) noexcept;
 
+/// @brief Converts input to hex without allocating
+/// @param input bytes to convert
+/// @param out buffer of at least `LengthInHexForm(input)` chars to write data
+void ToHexChars(std::string_view input, char* out) noexcept;
+
 /// @brief Allocates std::string, converts input and writes into said string
 /// @param input range of input bytes
 inline std::string ToHex(std::string_view data) noexcept {
@@ -170,7 +170,7 @@ E& expected<S, E>::error() {
 
 template <class S, class E>
 const E& expected<S, E>::error() const {
-  const unexpected<E>* result = std::get_if<unexpected<E>>(data_);
+  const unexpected<E>* result = std::get_if<unexpected<E>>(&data_);
   if (result == nullptr) {
     throw bad_expected_access(
         "Trying to get undefined error value from utils::expected");
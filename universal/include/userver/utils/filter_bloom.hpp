@@ -5,6 +5,7 @@
 
 #include <array>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -49,6 +50,7 @@ class FilterBloom final {
   }
 
   /// @brief Increments the smallest item counters
+  /// @note The counters saturate at the maximum value of Counter
   void Increment(const T& item);
 
   /// @brief Returns the value of the smallest item counter
@@ -117,7 +119,9 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Increment(const T& item) {
     auto& current_count =
         counters_[GetHash(hash_value_1, hash_value_2, Coefficient(step)) %
                   counters_.size()];
-    if (current_count == min_frequency) {
+    // a wrapped around counter would make the filter forget the items
+    if (current_count == min_frequency &&
+        current_count != std::numeric_limits<Counter>::max()) {
       current_count++;
     }
   }
@@ -6,6 +6,7 @@
 #include <cctype>
 #include <cerrno>
 #include <charconv>
+#include <cmath>
 #include <cstdlib>
 #include <limits>
 #include <string>
@@ -26,14 +27,27 @@ namespace impl {
                                            std::string_view input,
                                            std::type_index resultType);
 
+// Parses the plain decimal numbers that make up most of the inputs, leaving
+// everything else to the strtod-based parser with its hexadecimal numbers,
+// leading plus, ERANGE for subnormals and detailed error messages.
 template <typename T>
-std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
-  static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
-  static_assert(!std::is_reference_v<T>);
-
-  if (str == nullptr) {
-    impl::ThrowFromStringException("nullptr string", "<null>", typeid(T));
+bool TryFromCharsFloatingPoint(std::string_view str, T& result) noexcept {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+    const char* const end = str.data() + str.size();
+    const auto [ptr, error_code] = std::from_chars(str.data(), end, result);
+    return error_code == std::errc{} && ptr == end &&
+           std::fpclassify(result) != FP_SUBNORMAL;
   }
+#endif
+  static_cast<void>(str);
+  static_cast<void>(result);
+  return false;
+}
+
+template <typename T>
+std::enable_if_t<std::is_floating_point_v<T>, T> FromStringSlow(
+    const char* str) {
   if (str[0] == '\0') {
     impl::ThrowFromStringException("empty string", str, typeid(T));
   }
@@ -75,26 +89,51 @@ std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
   return result;
 }
 
+template <typename T>
+std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
+  static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
+  static_assert(!std::is_reference_v<T>);
+
+  if (str == nullptr) {
+    impl::ThrowFromStringException("nullptr string", "<null>", typeid(T));
+  }
+
+  T result{};
+  if (TryFromCharsFloatingPoint(std::string_view{str}, result)) return result;
+  return FromStringSlow<T>(str);
+}
+
 template <typename T>
 std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
     const std::string& str) {
-  return FromString<T>(str.data());
+  static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
+  static_assert(!std::is_reference_v<T>);
+
+  T result{};
+  if (TryFromCharsFloatingPoint(std::string_view{str}, result)) return result;
+  return FromStringSlow<T>(str.c_str());
 }
 
 template <typename T>
 std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
     std::string_view str) {
+  static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
+  static_assert(!std::is_reference_v<T>);
+
+  T result{};
+  if (TryFromCharsFloatingPoint(str, result)) return result;
+
   static constexpr std::size_t kSmallBufferSize = 32;
 
   if (str.size() >= kSmallBufferSize) {
-    return FromString<T>(std::string{str});
+    return FromStringSlow<T>(std::string{str}.c_str());
   }
 
   char buffer[kSmallBufferSize];
   std::copy(str.data(), str.data() + str.size(), buffer);
   buffer[str.size()] = '\0';
 
-  return FromString<T>(buffer);
+  return FromStringSlow<T>(buffer);
 }
 
 template <typename T>
@@ -157,7 +196,8 @@ std::enable_if_t<meta::kIsInteger<T>, T> FromString(std::string_view str) {
 /// - Integer types. Leading plus or minus is allowed. The number is always
 ///   base-10.
 /// - Floating-point types. The accepted number format is identical to
-///   `std::strtod`.
+///   `std::strtod`. Plain decimal numbers are parsed by `std::from_chars`
+///   where available, that is much faster and gives the same results.
 ///
 /// @tparam T The type of the number to be parsed
 /// @param str The string that contains the number
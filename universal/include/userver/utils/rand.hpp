@@ -27,6 +27,8 @@ class RandomBase {
 };
 
 /// @brief Returns a thread-local UniformRandomBitGenerator
+///
+/// The generator is xoshiro256** seeded from std::random_device.
 /// @note The provided `Random` instance is not cryptographically secure
 /// @warning Don't pass the returned `Random` across thread boundaries
 RandomBase& DefaultRandom();
@@ -69,6 +71,12 @@ T RandRange(T to_exclusive) {
 /// @warning Don't use `Rand() % N`, use `RandRange` instead
 uint32_t Rand();
 
+/// @brief Generate a random number in the whole `uint64_t` range, faster than
+/// a distribution over DefaultRandom()
+/// @note The used random generator is not cryptographically secure
+/// @warning Don't use `Rand64() % N`, use `RandRange` instead
+uint64_t Rand64();
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -3,7 +3,10 @@
 /// @file userver/utils/regex.hpp
 /// @brief @copybrief utils::regex
 
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -14,6 +17,12 @@ namespace utils {
 /// @ingroup userver_containers
 ///
 /// @brief Small alias for boost::regex / std::regex without huge includes
+///
+/// With the USERVER_FEATURE_RE2 build option the expressions are matched by
+/// RE2 in linear time of the input length, but the backreferences and the
+/// lookaround assertions are not supported.
+///
+/// @throws std::runtime_error (or a derived exception) on an invalid pattern
 class regex final {
  public:
   regex();
@@ -43,6 +52,41 @@ bool regex_match(std::string_view str, const regex& pattern);
 /// target character sequence
 bool regex_search(std::string_view str, const regex& pattern);
 
+/// @ingroup userver_containers
+///
+/// @brief A set of regular expressions that are searched for in a single pass
+/// over the input
+///
+/// With the USERVER_FEATURE_RE2 build option the set is matched by RE2::Set,
+/// the cost of a match barely depends on the number of patterns. Otherwise
+/// the patterns are searched for one by one.
+///
+/// @throws std::runtime_error (or a derived exception) on an invalid pattern
+class RegexSet final {
+ public:
+  RegexSet();
+  explicit RegexSet(const std::vector<std::string>& patterns);
+
+  ~RegexSet();
+
+  RegexSet(RegexSet&&) noexcept;
+  RegexSet& operator=(RegexSet&&) noexcept;
+
+  /// @returns the number of patterns in the set
+  std::size_t size() const noexcept;
+
+  /// @returns whether any of the patterns matches anywhere in `str`
+  bool SearchAny(std::string_view str) const;
+
+  /// @returns indexes of the patterns that match anywhere in `str`, in the
+  /// ascending order
+  std::vector<std::size_t> Search(std::string_view str) const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,33 @@
+#pragma once
+
+/// @file userver/utils/small_vector.hpp
+/// @brief @copybrief utils::SmallVector
+
+#include <cstddef>
+
+#include <boost/container/small_vector.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_containers
+///
+/// @brief std::vector-like container that keeps up to N elements inline,
+/// without a dynamic allocation.
+///
+/// Use it instead of std::vector on the hot paths where the sizes are known to
+/// be small most of the time: a few headers, addresses or log tags. The
+/// elements are moved to the memory from `Allocator` only if the size grows
+/// over N, after that the container grows just like std::vector.
+///
+/// Unlike std::vector, the move of a SmallVector with the inline elements is
+/// O(size): the elements are moved one by one.
+///
+/// @snippet universal/src/utils/small_vector_test.cpp  Sample SmallVector
+template <typename T, std::size_t N, typename Allocator = void>
+using SmallVector = boost::container::small_vector<T, N, Allocator>;
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -65,6 +65,28 @@ class StrIcaseHash {
   HashSeed seed_;
 };
 
+/// @brief Fast case insensitive ASCII hashing functor for trusted keys
+///
+/// About twice as fast as utils::StrIcaseHash on short strings, like HTTP
+/// header names, but unlike it is not resistant to HashDOS attacks even with a
+/// random seed. Use only for containers with the keys that are not controlled
+/// by the remote side, e.g. on trusted internal listeners.
+class StrIcaseFastHash {
+ public:
+  using is_transparent [[maybe_unused]] = void;
+
+  /// Generates a new random hash seed for each hasher instance
+  StrIcaseFastHash();
+
+  /// Uses the provided seed
+  explicit StrIcaseFastHash(HashSeed seed) noexcept;
+
+  std::size_t operator()(std::string_view s) const& noexcept;
+
+ private:
+  HashSeed seed_;
+};
+
 /// Case insensitive ASCII 3-way comparison functor
 class StrIcaseCompareThreeWay {
  public:
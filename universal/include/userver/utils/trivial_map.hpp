@@ -3,7 +3,10 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -326,22 +329,30 @@ class SwitchBySecond final {
   SearchState<Second, First> state_;
 };
 
-template <typename First, typename Second>
+// Each Case() returns a new type, so that the count of Case's is known at
+// compile time from the type returned by the builder function
+template <typename First, typename Second, std::size_t CasesCount = 1>
 class SwitchTypesDetected final {
  public:
   using first_type = First;
   using second_type = Second;
+  static constexpr std::size_t kCasesCount = CasesCount;
 
-  constexpr SwitchTypesDetected& Case(First, Second) noexcept { return *this; }
+  constexpr auto Case(First, Second) noexcept {
+    return SwitchTypesDetected<First, Second, CasesCount + 1>{};
+  }
 };
 
-template <typename First>
-class SwitchTypesDetected<First, void> final {
+template <typename First, std::size_t CasesCount>
+class SwitchTypesDetected<First, void, CasesCount> final {
  public:
   using first_type = First;
   using second_type = void;
+  static constexpr std::size_t kCasesCount = CasesCount;
 
-  constexpr SwitchTypesDetected& Case(First) noexcept { return *this; }
+  constexpr auto Case(First) noexcept {
+    return SwitchTypesDetected<First, void, CasesCount + 1>{};
+  }
 };
 
 class SwitchTypesDetector final {
@@ -368,6 +379,393 @@ class SwitchTypesDetector final {
   }
 };
 
+// Maps with more Case's than this get a CasesIndex for their string keys
+inline constexpr std::size_t kMinIndexedCasesCount = 64;
+
+// Lowercases the 'A' - 'Z' bytes of v, other bytes are left intact
+constexpr std::uint64_t LowercaseAsciiBytes(std::uint64_t v) noexcept {
+  constexpr std::uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr std::uint64_t kHighBits = kOnes * 0x80;
+
+  // No carry between the bytes: 0x7f + (0x80 - 'A') < 0x100
+  const std::uint64_t heptets = v & (kOnes * 0x7f);
+  const std::uint64_t ge_a = heptets + kOnes * (0x80 - 'A');
+  const std::uint64_t gt_z = heptets + kOnes * (0x80 - 'Z' - 1);
+  const std::uint64_t is_upper = (ge_a ^ gt_z) & ~v & kHighBits;
+  return v | (is_upper >> 2);
+}
+
+// Written as a single expression, so that the compiler merges it into a load
+template <std::size_t... Indices>
+constexpr std::uint64_t LoadLittleEndian(
+    const char* data, std::index_sequence<Indices...>) noexcept {
+  return ((std::uint64_t{static_cast<unsigned char>(data[Indices])}
+           << (8 * Indices)) |
+          ...);
+}
+
+template <std::size_t N>
+constexpr std::uint64_t LoadLittleEndian(const char* data) noexcept {
+  return LoadLittleEndian(data, std::make_index_sequence<N>{});
+}
+
+// ASCII case insensitive hash, not HashDOS resistant. Used only for the
+// tables over the keys known at compile time.
+//
+// The loads are of a constant size, so that the compiler turns them into
+// plain loads. Keys up to 16 bytes are hashed completely. For the longer keys
+// only the first and the last 8 bytes are hashed, unless `kFull` is set.
+template <bool kFull>
+constexpr std::uint64_t HashICase(std::string_view value) noexcept {
+  constexpr std::uint64_t kMul = 0x9ddfea08eb382d69ULL;
+
+  const char* data = value.data();
+  const auto size = value.size();
+
+  std::uint64_t hash = size * kMul;
+  const auto mix = [&hash](std::uint64_t chunk) {
+    hash = (hash ^ LowercaseAsciiBytes(chunk)) * kMul;
+    hash ^= hash >> 47;
+  };
+
+  if (size >= 8) {
+    if constexpr (kFull) {
+      for (std::size_t pos = 0; pos + 8 < size; pos += 8) {
+        mix(LoadLittleEndian<8>(data + pos));
+      }
+    } else {
+      mix(LoadLittleEndian<8>(data));
+    }
+    mix(LoadLittleEndian<8>(data + size - 8));
+  } else if (size >= 4) {
+    mix(LoadLittleEndian<4>(data) |
+        (LoadLittleEndian<4>(data + size - 4) << 32));
+  } else if (size > 0) {
+    mix(LoadLittleEndian<1>(data) |
+        (LoadLittleEndian<1>(data + size / 2) << 8) |
+        (LoadLittleEndian<1>(data + size - 1) << 16));
+  }
+
+  hash *= kMul;
+  return hash ^ (hash >> 32);
+}
+
+constexpr std::size_t RoundUpToPowerOf2(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) result *= 2;
+  return result;
+}
+
+constexpr std::size_t Log2(std::size_t power_of_2) noexcept {
+  std::size_t result = 0;
+  while (power_of_2 > 1) {
+    power_of_2 /= 2;
+    ++result;
+  }
+  return result;
+}
+
+// Perfect hash over N string keys built with the "hash and displace"
+// approach: keys are split into buckets by hash, each bucket gets the
+// displacement that puts all of its keys into distinct free slots. A lookup
+// is a hash, two array reads and a single key comparison.
+//
+// The keys are not stored, they are passed to the lookup functions.
+// The cheap partial hash is tried first, the full one is used if the keys
+// differ only in the middle. Construction fails if ASCII case insensitive
+// equal keys differ in case or if no displacement was found, the map then
+// falls back to linear search.
+template <std::size_t N>
+class StringIndex final {
+ public:
+  constexpr StringIndex(const std::array<std::string_view, N>& keys,
+                        bool enabled) noexcept {
+    if (!enabled) return;
+
+    valid_ = Build<false>(keys);
+    if (!valid_) {
+      *this = StringIndex{};
+      is_full_hash_ = true;
+      valid_ = Build<true>(keys);
+    }
+  }
+
+  constexpr bool IsValid() const noexcept { return valid_; }
+
+  constexpr std::size_t Find(const std::array<std::string_view, N>& keys,
+                             std::string_view key) const noexcept {
+    UASSERT(valid_);
+    const auto index = slots_[GetSlot(Hash(key))];
+    return keys[index] == key ? index : kInvalidSize;
+  }
+
+  constexpr std::size_t FindICase(const std::array<std::string_view, N>& keys,
+                                  std::string_view key) const noexcept {
+    UASSERT(valid_);
+    const auto index = slots_[GetSlot(Hash(key))];
+    const auto candidate = keys[index];
+    UASSERT_MSG(!impl::HasUppercaseAscii(candidate),
+                fmt::format("String literal '{}' in utils::Switch*::Case() "
+                            "should be in lower case",
+                            candidate));
+    return candidate.size() == key.size() &&
+                   impl::ICaseEqualLowercase(candidate, key)
+               ? index
+               : kInvalidSize;
+  }
+
+ private:
+  static_assert(N > 1 && N <= std::numeric_limits<std::uint16_t>::max());
+
+  static constexpr std::size_t kSlotsCount = RoundUpToPowerOf2(2 * N);
+  static constexpr std::size_t kBucketsCount = RoundUpToPowerOf2(N / 2);
+  static constexpr std::size_t kMaxBucketSize = 32;
+
+  static constexpr std::size_t GetSlot(std::uint64_t hash,
+                                       std::uint64_t displacement) noexcept {
+    constexpr std::uint64_t kMul = 0xc6a4a7935bd1e995ULL;
+    const auto mixed = (hash ^ (displacement * kMul)) * kMul;
+    return mixed >> (64 - Log2(kSlotsCount));
+  }
+
+  constexpr StringIndex() noexcept = default;
+
+  constexpr std::uint64_t Hash(std::string_view key) const noexcept {
+    return is_full_hash_ ? HashICase<true>(key) : HashICase<false>(key);
+  }
+
+  constexpr std::size_t GetSlot(std::uint64_t hash) const noexcept {
+    return GetSlot(hash, displacements_[hash & (kBucketsCount - 1)]);
+  }
+
+  template <bool kFullHash>
+  constexpr bool Build(const std::array<std::string_view, N>& keys) noexcept {
+    std::array<std::uint64_t, N> hashes{};
+    for (std::size_t i = 0; i < N; ++i) {
+      hashes[i] = HashICase<kFullHash>(keys[i]);
+    }
+
+    // The first of the equal keys wins, just like in the linear search
+    std::array<bool, N> is_duplicate{};
+    for (std::size_t i = 0; i < N; ++i) {
+      for (std::size_t j = i + 1; j < N && !is_duplicate[i]; ++j) {
+        if (hashes[i] != hashes[j] || is_duplicate[j]) continue;
+        if (keys[i] != keys[j]) return false;
+        is_duplicate[j] = true;
+      }
+    }
+
+    std::array<std::size_t, kBucketsCount> bucket_sizes{};
+    std::size_t max_bucket_size = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      if (is_duplicate[i]) continue;
+      auto& size = bucket_sizes[hashes[i] & (kBucketsCount - 1)];
+      ++size;
+      if (size > max_bucket_size) max_bucket_size = size;
+    }
+    if (max_bucket_size > kMaxBucketSize) return false;
+
+    // Largest buckets are the hardest to place, so they go first
+    std::array<bool, kSlotsCount> is_used{};
+    for (auto size = max_bucket_size; size > 0; --size) {
+      for (std::size_t bucket = 0; bucket < kBucketsCount; ++bucket) {
+        if (bucket_sizes[bucket] != size) continue;
+
+        std::array<std::size_t, kMaxBucketSize> members{};
+        std::size_t members_count = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+          if (!is_duplicate[i] && (hashes[i] & (kBucketsCount - 1)) == bucket) {
+            members[members_count++] = i;
+          }
+        }
+
+        if (!PlaceBucket(bucket, members, members_count, hashes, is_used)) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  constexpr bool PlaceBucket(
+      std::size_t bucket,
+      const std::array<std::size_t, kMaxBucketSize>& members,
+      std::size_t members_count, const std::array<std::uint64_t, N>& hashes,
+      std::array<bool, kSlotsCount>& is_used) noexcept {
+    for (std::uint64_t displacement = 0;
+         displacement <= std::numeric_limits<std::uint16_t>::max();
+         ++displacement) {
+      std::array<std::size_t, kMaxBucketSize> slots{};
+      bool fits = true;
+      for (std::size_t i = 0; i < members_count && fits; ++i) {
+        slots[i] = GetSlot(hashes[members[i]], displacement);
+        fits = !is_used[slots[i]];
+        for (std::size_t j = 0; j < i && fits; ++j) fits = slots[i] != slots[j];
+      }
+      if (!fits) continue;
+
+      displacements_[bucket] = static_cast<std::uint16_t>(displacement);
+      for (std::size_t i = 0; i < members_count; ++i) {
+        is_used[slots[i]] = true;
+        slots_[slots[i]] = static_cast<std::uint16_t>(members[i]);
+      }
+      return true;
+    }
+
+    return false;
+  }
+
+  std::array<std::uint16_t, kBucketsCount> displacements_{};
+  // Free slots point to the key 0, a lookup compares the key anyway
+  std::array<std::uint16_t, kSlotsCount> slots_{};
+  bool is_full_hash_{false};
+  bool valid_{false};
+};
+
+// Gathers the Case's of a builder function into arrays
+template <typename First, typename Second, std::size_t N>
+class CaseCollector final {
+ public:
+  constexpr CaseCollector& Case(First first, Second second) noexcept {
+    if (size_ < N) {
+      firsts_[size_] = first;
+      seconds_[size_] = second;
+    }
+    ++size_;
+    return *this;
+  }
+
+  constexpr bool IsComplete() const noexcept { return size_ == N; }
+
+  constexpr const std::array<First, N>& GetFirsts() const noexcept {
+    return firsts_;
+  }
+
+  constexpr const std::array<Second, N>& GetSeconds() const noexcept {
+    return seconds_;
+  }
+
+ private:
+  std::array<First, N> firsts_{};
+  std::array<Second, N> seconds_{};
+  std::size_t size_{0};
+};
+
+template <typename First, std::size_t N>
+class CaseCollector<First, void, N> final {
+ public:
+  constexpr CaseCollector& Case(First first) noexcept {
+    if (size_ < N) firsts_[size_] = first;
+    ++size_;
+    return *this;
+  }
+
+  constexpr bool IsComplete() const noexcept { return size_ == N; }
+
+  constexpr const std::array<First, N>& GetFirsts() const noexcept {
+    return firsts_;
+  }
+
+ private:
+  std::array<First, N> firsts_{};
+  std::size_t size_{0};
+};
+
+class NoStringIndex final {
+ public:
+  template <typename Keys>
+  constexpr NoStringIndex(const Keys&, bool) noexcept {}
+
+  constexpr bool IsValid() const noexcept { return false; }
+};
+
+template <typename Key, std::size_t N>
+using StringIndexFor = std::conditional_t<std::is_same_v<Key, std::string_view>,
+                                          StringIndex<N>, NoStringIndex>;
+
+// Index over the string sides of a large TrivialBiMap or TrivialSet
+template <typename First, typename Second, std::size_t N>
+class CasesIndex final {
+ public:
+  template <typename BuilderFunc>
+  constexpr explicit CasesIndex(const BuilderFunc& func) noexcept
+      : CasesIndex(func([]() { return CaseCollector<First, Second, N>{}; })) {}
+
+  constexpr bool IsFirstIndexed() const noexcept {
+    return first_index_.IsValid();
+  }
+
+  constexpr bool IsSecondIndexed() const noexcept {
+    return second_index_.IsValid();
+  }
+
+  constexpr std::size_t FindFirst(std::string_view value) const noexcept {
+    return first_index_.Find(cases_.GetFirsts(), value);
+  }
+
+  constexpr std::size_t FindFirstICase(std::string_view value) const noexcept {
+    return first_index_.FindICase(cases_.GetFirsts(), value);
+  }
+
+  constexpr std::size_t FindSecond(std::string_view value) const noexcept {
+    return second_index_.Find(cases_.GetSeconds(), value);
+  }
+
+  constexpr std::size_t FindSecondICase(std::string_view value) const noexcept {
+    return second_index_.FindICase(cases_.GetSeconds(), value);
+  }
+
+  constexpr First GetFirst(std::size_t index) const noexcept {
+    return cases_.GetFirsts()[index];
+  }
+
+  constexpr Second GetSecond(std::size_t index) const noexcept {
+    return cases_.GetSeconds()[index];
+  }
+
+ private:
+  template <typename Cases>
+  constexpr static const auto& GetSecondsOrFirsts(const Cases& cases) noexcept {
+    if constexpr (std::is_void_v<Second>) {
+      return cases.GetFirsts();
+    } else {
+      return cases.GetSeconds();
+    }
+  }
+
+  constexpr explicit CasesIndex(
+      const CaseCollector<First, Second, N>& cases) noexcept
+      : cases_(cases),
+        first_index_(cases_.GetFirsts(), cases_.IsComplete()),
+        second_index_(GetSecondsOrFirsts(cases_),
+                      cases_.IsComplete() && !std::is_void_v<Second>) {}
+
+  using SecondKey = std::conditional_t<std::is_void_v<Second>, void*, Second>;
+
+  const CaseCollector<First, Second, N> cases_;
+  const StringIndexFor<First, N> first_index_;
+  const StringIndexFor<SecondKey, N> second_index_;
+};
+
+class NoCasesIndex final {
+ public:
+  template <typename BuilderFunc>
+  constexpr explicit NoCasesIndex(const BuilderFunc&) noexcept {}
+};
+
+template <typename T>
+inline constexpr bool kIsIndexableCase =
+    std::is_void_v<T> || std::is_default_constructible_v<T>;
+
+template <typename First, typename Second, std::size_t N>
+using CasesIndexFor = std::conditional_t<
+    (N > kMinIndexedCasesCount) &&
+        (std::is_same_v<First, std::string_view> ||
+         std::is_same_v<Second, std::string_view>) &&
+        kIsIndexableCase<First> && kIsIndexableCase<Second>,
+    CasesIndex<First, Second, N>, NoCasesIndex>;
+
 class CaseCounter final {
  public:
   template <typename First, typename Second>
@@ -480,6 +878,11 @@ class CaseSecondDescriber final {
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// Maps with more than 64 Case's get a perfect hash table for their string
+/// sides that is built along with the map, so lookups by string stay O(1) even
+/// if the keys have the same length. Declare such maps as `static constexpr`
+/// or at namespace scope, so that the table is built at compile time once.
+///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// For a single value Case statements see @ref utils::TrivialSet.
@@ -498,7 +901,8 @@ class TrivialBiMap final {
   using MappedTypeFor =
       std::conditional_t<std::is_convertible_v<T, First>, Second, First>;
 
-  constexpr TrivialBiMap(BuilderFunc&& func) noexcept : func_(std::move(func)) {
+  constexpr TrivialBiMap(BuilderFunc&& func) noexcept
+      : func_(std::move(func)), index_(func_) {
     static_assert(std::is_empty_v<BuilderFunc>,
                   "Mapping function should not capture variables");
     static_assert(std::is_trivially_copyable_v<First>,
@@ -511,12 +915,28 @@ class TrivialBiMap final {
   }
 
   constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
+    if constexpr (kIsFirstIndexable) {
+      if (index_.IsFirstIndexed()) {
+        const auto index = index_.FindFirst(value);
+        if (index == impl::kInvalidSize) return std::nullopt;
+        return index_.GetSecond(index);
+      }
+    }
+
     return func_(
                [value]() { return impl::SwitchByFirst<First, Second>{value}; })
         .Extract();
   }
 
   constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
+    if constexpr (kIsSecondIndexable) {
+      if (index_.IsSecondIndexed()) {
+        const auto index = index_.FindSecond(value);
+        if (index == impl::kInvalidSize) return std::nullopt;
+        return index_.GetFirst(index);
+      }
+    }
+
     return func_(
                [value]() { return impl::SwitchBySecond<First, Second>{value}; })
         .Extract();
@@ -541,6 +961,14 @@ class TrivialBiMap final {
   /// string literal.
   constexpr std::optional<Second> TryFindICaseByFirst(
       std::string_view value) const noexcept {
+    if constexpr (kIsFirstIndexable) {
+      if (index_.IsFirstIndexed()) {
+        const auto index = index_.FindFirstICase(value);
+        if (index == impl::kInvalidSize) return std::nullopt;
+        return index_.GetSecond(index);
+      }
+    }
+
     return func_([value]() { return impl::SwitchByFirstICase<Second>{value}; })
         .Extract();
   }
@@ -551,6 +979,14 @@ class TrivialBiMap final {
   /// string literal.
   constexpr std::optional<First> TryFindICaseBySecond(
       std::string_view value) const noexcept {
+    if constexpr (kIsSecondIndexable) {
+      if (index_.IsSecondIndexed()) {
+        const auto index = index_.FindSecondICase(value);
+        if (index == impl::kInvalidSize) return std::nullopt;
+        return index_.GetFirst(index);
+      }
+    }
+
     return func_([value]() { return impl::SwitchBySecondICase<First>{value}; })
         .Extract();
   }
@@ -606,7 +1042,16 @@ class TrivialBiMap final {
   }
 
  private:
+  using Index = impl::CasesIndexFor<First, Second, TypesPair::kCasesCount>;
+  static constexpr bool kIsFirstIndexable =
+      !std::is_same_v<Index, impl::NoCasesIndex> &&
+      std::is_same_v<First, std::string_view>;
+  static constexpr bool kIsSecondIndexable =
+      !std::is_same_v<Index, impl::NoCasesIndex> &&
+      std::is_same_v<Second, std::string_view>;
+
   const BuilderFunc func_;
+  const Index index_;
 };
 
 template <typename BuilderFunc>
@@ -627,7 +1072,8 @@ class TrivialSet final {
   using First = typename TypesPair::first_type;
   using Second = typename TypesPair::second_type;
 
-  constexpr TrivialSet(BuilderFunc&& func) noexcept : func_(std::move(func)) {
+  constexpr TrivialSet(BuilderFunc&& func) noexcept
+      : func_(std::move(func)), index_(func_) {
     static_assert(std::is_empty_v<BuilderFunc>,
                   "Mapping function should not capture variables");
     static_assert(std::is_trivially_copyable_v<First>,
@@ -637,6 +1083,12 @@ class TrivialSet final {
   }
 
   constexpr bool Contains(First value) const noexcept {
+    if constexpr (kIsFirstIndexable) {
+      if (index_.IsFirstIndexed()) {
+        return index_.FindFirst(value) != impl::kInvalidSize;
+      }
+    }
+
     return func_(
                [value]() { return impl::SwitchByFirst<First, Second>{value}; })
         .Extract();
@@ -646,6 +1098,12 @@ class TrivialSet final {
     static_assert(std::is_convertible_v<First, std::string_view>,
                   "ContainsICase works only with std::string_view");
 
+    if constexpr (kIsFirstIndexable) {
+      if (index_.IsFirstIndexed()) {
+        return index_.FindFirstICase(value) != impl::kInvalidSize;
+      }
+    }
+
     return func_([value]() { return impl::SwitchByFirstICase<void>{value}; })
         .Extract();
   }
@@ -664,7 +1122,13 @@ class TrivialSet final {
   }
 
  private:
+  using Index = impl::CasesIndexFor<First, Second, TypesPair::kCasesCount>;
+  static constexpr bool kIsFirstIndexable =
+      !std::is_same_v<Index, impl::NoCasesIndex> &&
+      std::is_same_v<First, std::string_view>;
+
   const BuilderFunc func_;
+  const Index index_;
 };
 
 template <typename BuilderFunc>
@@ -676,7 +1140,8 @@ TrivialSet(BuilderFunc) -> TrivialSet<BuilderFunc>;
 /// string, or if `value` is not contained in `map`.
 /// @see @ref scripts/docs/en/userver/formats.md
 template <typename ExceptionType = void, typename Value, typename BuilderFunc>
-auto ParseFromValueString(const Value& value, TrivialBiMap<BuilderFunc> map) {
+auto ParseFromValueString(const Value& value,
+                          const TrivialBiMap<BuilderFunc>& map) {
   if constexpr (!std::is_void_v<ExceptionType>) {
     if (!value.IsString()) {
       throw ExceptionType(fmt::format(
@@ -703,7 +1168,8 @@ namespace impl {
 // contained in `map`, then crashes the service in Debug builds, or throws
 // utils::InvariantError in Release builds.
 template <typename Enum, typename BuilderFunc>
-std::string_view EnumToStringView(Enum value, TrivialBiMap<BuilderFunc> map) {
+std::string_view EnumToStringView(Enum value,
+                                  const TrivialBiMap<BuilderFunc>& map) {
   static_assert(std::is_enum_v<Enum>);
   if (const auto string = map.TryFind(value)) return *string;
 
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+inline constexpr unsigned kHotKeysCount = 10000;
+inline constexpr std::size_t kAccessesCount = 1'000'000;
+
+// Skewed accesses to the hot keys, every 4th access is a part of a scan over
+// the keys that are never used again
+inline std::vector<unsigned> MakeScanWorkload() {
+  std::minstd_rand rng{42};
+  std::uniform_real_distribution<double> distribution{0.0, 1.0};
+
+  std::vector<unsigned> keys;
+  keys.reserve(kAccessesCount);
+  unsigned scan_key = kHotKeysCount;
+  for (std::size_t i = 0; i < kAccessesCount; ++i) {
+    if (i % 4 == 0) {
+      keys.push_back(scan_key++);
+    } else {
+      const auto x = distribution(rng);
+      keys.push_back(static_cast<unsigned>(x * x * x * kHotKeysCount));
+    }
+  }
+  return keys;
+}
+
+// Runs the workload over the cache of `state.range(0)` size created by
+// `factory(size)`, putting the missing keys into the cache
+template <typename Factory>
+void HitRatio(benchmark::State& state, Factory factory) {
+  const auto keys = MakeScanWorkload();
+  std::size_t hits = 0;
+  std::size_t accesses = 0;
+  for (auto _ : state) {
+    auto cache = factory(static_cast<std::size_t>(state.range(0)));
+    for (const auto key : keys) {
+      if (cache.Get(key)) {
+        ++hits;
+      } else {
+        cache.Put(key, key);
+      }
+    }
+    accesses += keys.size();
+  }
+  state.counters["hit_ratio"] = static_cast<double>(hits) / accesses;
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
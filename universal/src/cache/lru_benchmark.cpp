@@ -1,5 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <cache/hit_ratio_benchmark.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/lru_map.hpp>
 #include <userver/cache/lru_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -51,4 +54,18 @@ void LruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(LruPutOverflow);
 
+void LruHitRatio(benchmark::State& state) {
+  cache::impl::HitRatio(state, [](std::size_t size) {
+    return cache::LruMap<unsigned, unsigned>(size);
+  });
+}
+BENCHMARK(LruHitRatio)->RangeMultiplier(4)->Range(256, 4096);
+
+void TinyLfuHitRatio(benchmark::State& state) {
+  cache::impl::HitRatio(state, [](std::size_t size) {
+    return cache::impl::TinyLfuBase<unsigned, unsigned>(size);
+  });
+}
+BENCHMARK(TinyLfuHitRatio)->RangeMultiplier(4)->Range(256, 4096);
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
 #include <type_traits>
 
 #include <userver/cache/lru_map.hpp>
@@ -28,6 +30,21 @@ struct NotMovable {
 
   int value;
 };
+
+struct Blob {
+  std::size_t size;
+};
+
+std::size_t Weight(const Blob& blob) { return blob.size; }
+
+// the weight of an int key is its sizeof
+constexpr std::size_t kBlobEntryWeight = 100 + sizeof(int);
+
+struct Incomplete;
+
+struct IncompleteDeleter {
+  void operator()(Incomplete*) const noexcept {}
+};
 }  // namespace
 
 using Lru = cache::LruMap<int, int>;
@@ -213,4 +230,63 @@ TEST(Lru, NotMovable) {
   EXPECT_EQ(cache.GetLeastUsed()->value, 4);
 }
 
+TEST(Lru, MaxWeight) {
+  cache::LruMap<int, Blob> cache{100};
+  cache.SetMaxWeight(3 * kBlobEntryWeight);
+
+  for (int key = 1; key <= 3; ++key) cache.Put(key, Blob{100});
+  EXPECT_EQ(cache.GetWeight(), 3 * kBlobEntryWeight);
+
+  cache.Get(1);
+  cache.Put(4, Blob{100});
+  EXPECT_EQ(cache.GetSize(), 3);
+  EXPECT_EQ(cache.Get(2), nullptr);
+
+  // a heavier value evicts several lighter ones
+  cache.Put(5, Blob{200});
+  EXPECT_EQ(cache.GetSize(), 2);
+  EXPECT_LE(cache.GetWeight(), 3 * kBlobEntryWeight);
+  EXPECT_NE(cache.Get(5), nullptr);
+
+  cache.Erase(5);
+  EXPECT_EQ(cache.GetWeight(), kBlobEntryWeight);
+  cache.Clear();
+  EXPECT_EQ(cache.GetWeight(), 0);
+}
+
+TEST(Lru, MaxWeightUpdate) {
+  cache::LruMap<int, Blob> cache{100};
+  cache.Put(1, Blob{100});
+  cache.Put(2, Blob{100});
+
+  cache.Put(1, Blob{300});
+  EXPECT_EQ(cache.GetWeight(), 400 + 2 * sizeof(int));
+
+  cache.SetMaxWeight(350);
+  EXPECT_EQ(cache.GetSize(), 1);
+  EXPECT_EQ(cache.Get(2), nullptr);
+
+  // the most recently used entry is kept even if it is too heavy
+  cache.Put(3, Blob{1000});
+  EXPECT_EQ(cache.GetSize(), 1);
+  EXPECT_EQ(cache.Get(3)->size, 1000);
+}
+
+TEST(Lru, DefaultWeight) {
+  cache::LruMap<int, std::string> cache{10};
+  cache.Put(1, std::string(1000, 'a'));
+  EXPECT_GE(cache.GetWeight(), 1000 + sizeof(std::string));
+
+  cache.Erase(1);
+  cache.Put(2, std::string{});
+  EXPECT_LT(cache.GetWeight(), 1000);
+}
+
+TEST(Lru, DefaultWeightOfIncompleteType) {
+  using Handle = std::unique_ptr<Incomplete, IncompleteDeleter>;
+  cache::LruMap<int, Handle> cache{10};
+  cache.Put(1, Handle{});
+  EXPECT_EQ(cache.GetWeight(), sizeof(int) + sizeof(Handle));
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <cache/hit_ratio_benchmark.hpp>
 #include <userver/cache/impl/slru.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -81,4 +82,12 @@ void SlruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(SlruPutOverflow);
 
+void SlruHitRatio(benchmark::State& state) {
+  cache::impl::HitRatio(state, [](std::size_t size) {
+    const auto protected_size = size * kProtectedPart / kElementsCount;
+    return Slru(size - protected_size, protected_size);
+  });
+}
+BENCHMARK(SlruHitRatio)->RangeMultiplier(4)->Range(256, 4096);
+
 USERVER_NAMESPACE_END
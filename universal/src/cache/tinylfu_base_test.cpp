@@ -0,0 +1,127 @@
+#include <userver/cache/impl/tinylfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/impl/frequency_sketch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(FrequencySketch, Sample) {
+  cache::impl::FrequencySketch<std::string> sketch(100);
+  EXPECT_EQ(sketch.GetFrequency("a"), 0);
+
+  for (int i = 0; i < 5; ++i) sketch.Record("a");
+  sketch.Record("b");
+
+  EXPECT_GE(sketch.GetFrequency("a"), 5);
+  EXPECT_LT(sketch.GetFrequency("b"), sketch.GetFrequency("a"));
+
+  sketch.Clear();
+  EXPECT_EQ(sketch.GetFrequency("a"), 0);
+}
+
+TEST(FrequencySketch, Saturates) {
+  cache::impl::FrequencySketch<int> sketch(100);
+  for (int i = 0; i < 100; ++i) sketch.Record(42);
+  EXPECT_EQ(sketch.GetFrequency(42), 15);
+}
+
+TEST(FrequencySketch, Ages) {
+  constexpr std::size_t kCapacity = 10;
+  cache::impl::FrequencySketch<int> sketch(kCapacity);
+  for (int i = 0; i < 8; ++i) sketch.Record(-1);
+  const auto frequency = sketch.GetFrequency(-1);
+
+  // the sample size is 10 * capacity
+  for (int key = 0; key < 100; ++key) sketch.Record(key);
+  EXPECT_LT(sketch.GetFrequency(-1), frequency);
+}
+
+TEST(TinyLfuBase, Sample) {
+  cache::impl::TinyLfuBase<std::string, int> cache(100);
+
+  for (int i = 0; i < 4; ++i) {
+    for (std::string str = "a"; str.size() < 50; str.push_back('a')) {
+      cache.Put(str, str.size());
+    }
+  }
+
+  // a scan of keys that are used once doesn't evict the frequent ones
+  for (std::string str = "b"; str.size() < 1000; str.push_back('b')) {
+    cache.Put(str, str.size());
+  }
+
+  for (std::string str = "a"; str.size() < 50; str.push_back('a')) {
+    ASSERT_TRUE(cache.Get(str)) << str;
+    EXPECT_EQ(str.size(), *cache.Get(str));
+  }
+  EXPECT_EQ(cache.GetSize(), 100);
+  EXPECT_EQ(cache.GetCapacity(), 100);
+}
+
+TEST(TinyLfuBase, PutGetErase) {
+  cache::impl::TinyLfuBase<int, int> cache(10);
+
+  EXPECT_TRUE(cache.Put(1, 1));
+  EXPECT_FALSE(cache.Put(1, 2));
+  EXPECT_EQ(*cache.Get(1), 2);
+
+  EXPECT_EQ(*cache.Emplace(2, 3), 3);
+  EXPECT_EQ(*cache.Emplace(2, 4), 3);
+  EXPECT_EQ(cache.GetSize(), 2);
+
+  cache.Erase(1);
+  EXPECT_FALSE(cache.Get(1));
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+TEST(TinyLfuBase, FillsUp) {
+  cache::impl::TinyLfuBase<int, int> cache(10);
+  for (int key = 0; key < 10; ++key) cache.Put(key, key);
+
+  EXPECT_EQ(cache.GetSize(), 10);
+  for (int key = 0; key < 10; ++key) EXPECT_EQ(*cache.Get(key), key);
+}
+
+TEST(TinyLfuBase, SetMaxSize) {
+  cache::impl::TinyLfuBase<int, int> cache(100);
+  for (int key = 0; key < 100; ++key) cache.Put(key, key);
+
+  cache.SetMaxSize(10);
+  EXPECT_EQ(cache.GetCapacity(), 10);
+  EXPECT_LE(cache.GetSize(), 10);
+
+  cache.SetMaxSize(200);
+  for (int key = 0; key < 200; ++key) cache.Put(key, key);
+  EXPECT_EQ(cache.GetSize(), 200);
+}
+
+TEST(TinyLfuBase, MaxWeight) {
+  // the weight of a value is its sizeof plus the capacity of the string
+  cache::impl::TinyLfuBase<int, std::string> cache(1000);
+  cache.SetMaxWeight(100000);
+
+  for (int key = 0; key < 1000; ++key) cache.Put(key, std::string(1000, 'a'));
+  EXPECT_LE(cache.GetWeight(), 100000 + 2000);
+  EXPECT_LT(cache.GetSize(), 100);
+  EXPECT_GT(cache.GetSize(), 0);
+}
+
+TEST(TinyLfuBase, VisitAll) {
+  cache::impl::TinyLfuBase<int, int> cache(10);
+  for (int key = 0; key < 5; ++key) cache.Put(key, key);
+
+  int sum = 0;
+  cache.VisitAll([&sum](const int& key, int& value) {
+    EXPECT_EQ(key, value);
+    sum += value;
+  });
+  EXPECT_EQ(sum, 0 + 1 + 2 + 3 + 4);
+}
+
+USERVER_NAMESPACE_END
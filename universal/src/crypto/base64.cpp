@@ -1,11 +1,13 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
+#include <string>
 
-#include <userver/crypto/exception.hpp>
-
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,53 +16,326 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-  std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
-  }
-  return response;
+constexpr std::uint8_t kInvalid = 0xff;
+
+struct Alphabet {
+  char char62;
+  char char63;
+  std::array<char, 64> encode;
+  std::array<std::uint8_t, 256> decode;
+};
+
+constexpr Alphabet MakeAlphabet(char char62, char char63) {
+  Alphabet alphabet{char62, char63, {}, {}};
+  for (auto& value : alphabet.decode) value = kInvalid;
+
+  std::size_t i = 0;
+  for (char c = 'A'; c <= 'Z'; ++c) alphabet.encode[i++] = c;
+  for (char c = 'a'; c <= 'z'; ++c) alphabet.encode[i++] = c;
+  for (char c = '0'; c <= '9'; ++c) alphabet.encode[i++] = c;
+  alphabet.encode[i++] = char62;
+  alphabet.encode[i++] = char63;
+
+  for (i = 0; i < alphabet.encode.size(); ++i) {
+    alphabet.decode[static_cast<std::uint8_t>(alphabet.encode[i])] =
+        static_cast<std::uint8_t>(i);
+  }
+  return alphabet;
 }
 
-template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
-  std::string response;
-  try {
-    Base64Decoder decoder(new CryptoPP::StringSink(response));
-    decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
-  }
-  return response;
+constexpr Alphabet kStandard = MakeAlphabet('+', '/');
+constexpr Alphabet kUrl = MakeAlphabet('-', '_');
+
+// SIMD stores write up to 8 bytes past the decoded data
+constexpr std::size_t kDecodeSlack = 8;
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+// Vectorized codecs from "Faster Base64 Encoding and Decoding using AVX2
+// Instructions" by W. Mula and D. Lemire, with the decoding lookup done by
+// range comparisons to support both alphabets.
+
+// Converts 12 bytes in the lanes of `in` to 16 6-bit indexes
+template <typename Vector, typename Ops>
+Vector SplitToIndexes(Vector in) {
+  in = Ops::Shuffle(in, Ops::SetLanes(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10,
+                                      9, 11, 10));
+  const auto t0 = Ops::And(in, Ops::Set32(0x0fc0fc00));
+  const auto t1 = Ops::MulHi16(t0, Ops::Set32(0x04000040));
+  const auto t2 = Ops::And(in, Ops::Set32(0x003f03f0));
+  const auto t3 = Ops::MulLo16(t2, Ops::Set32(0x01000010));
+  return Ops::Or(t1, t3);
+}
+
+template <typename Vector, typename Ops>
+Vector IndexesToAscii(Vector indexes, const Alphabet& alphabet) {
+  auto reduced = Ops::SubsU8(indexes, Ops::Set8(51));
+  const auto less = Ops::CmpGt8(Ops::Set8(26), indexes);
+  reduced = Ops::Or(reduced, Ops::And(less, Ops::Set8(13)));
+  const auto shift = Ops::SetLanes(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, alphabet.char62 - 62,
+      alphabet.char63 - 63, 'A', 0, 0);
+  return Ops::Add8(Ops::Shuffle(shift, reduced), indexes);
+}
+
+// Converts ASCII to 6-bit values, returns false if there are invalid chars
+template <typename Vector, typename Ops>
+bool AsciiToValues(Vector& in, const Alphabet& alphabet) {
+  const auto in_range = [&in](char first, char last) {
+    return Ops::And(Ops::CmpGt8(in, Ops::Set8(first - 1)),
+                    Ops::CmpGt8(Ops::Set8(last + 1), in));
+  };
+  const auto upper = in_range('A', 'Z');
+  const auto lower = in_range('a', 'z');
+  const auto digit = in_range('0', '9');
+  const auto is62 = Ops::CmpEq8(in, Ops::Set8(alphabet.char62));
+  const auto is63 = Ops::CmpEq8(in, Ops::Set8(alphabet.char63));
+
+  const auto valid = Ops::Or(Ops::Or(upper, lower), Ops::Or(digit, is62));
+  if (!Ops::AllSet(Ops::Or(valid, is63))) return false;
+
+  auto shift = Ops::And(upper, Ops::Set8(-'A'));
+  shift = Ops::Or(shift, Ops::And(lower, Ops::Set8(26 - 'a')));
+  shift = Ops::Or(shift, Ops::And(digit, Ops::Set8(52 - '0')));
+  shift = Ops::Or(shift, Ops::And(is62, Ops::Set8(62 - alphabet.char62)));
+  shift = Ops::Or(shift, Ops::And(is63, Ops::Set8(63 - alphabet.char63)));
+  in = Ops::Add8(in, shift);
+  return true;
+}
+
+// Packs 16 6-bit values of each lane into 12 bytes at the lane start
+template <typename Vector, typename Ops>
+Vector PackValues(Vector values) {
+  const auto merged_pairs = Ops::MaddUbs(values, Ops::Set32(0x01400140));
+  const auto merged = Ops::Madd16(merged_pairs, Ops::Set32(0x00011000));
+  return Ops::Shuffle(merged, Ops::SetLanes(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13,
+                                            12, -1, -1, -1, -1));
+}
+
+struct Sse {
+  using Vector = __m128i;
+
+  static Vector SetLanes(char c0, char c1, char c2, char c3, char c4, char c5,
+                         char c6, char c7, char c8, char c9, char c10,
+                         char c11, char c12, char c13, char c14, char c15) {
+    return _mm_setr_epi8(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12,
+                         c13, c14, c15);
+  }
+  static Vector Set8(char c) { return _mm_set1_epi8(c); }
+  static Vector Set32(int i) { return _mm_set1_epi32(i); }
+  static Vector Shuffle(Vector a, Vector b) { return _mm_shuffle_epi8(a, b); }
+  static Vector And(Vector a, Vector b) { return _mm_and_si128(a, b); }
+  static Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+  static Vector Add8(Vector a, Vector b) { return _mm_add_epi8(a, b); }
+  static Vector SubsU8(Vector a, Vector b) { return _mm_subs_epu8(a, b); }
+  static Vector CmpGt8(Vector a, Vector b) { return _mm_cmpgt_epi8(a, b); }
+  static Vector CmpEq8(Vector a, Vector b) { return _mm_cmpeq_epi8(a, b); }
+  static Vector MulHi16(Vector a, Vector b) { return _mm_mulhi_epu16(a, b); }
+  static Vector MulLo16(Vector a, Vector b) { return _mm_mullo_epi16(a, b); }
+  static Vector MaddUbs(Vector a, Vector b) { return _mm_maddubs_epi16(a, b); }
+  static Vector Madd16(Vector a, Vector b) { return _mm_madd_epi16(a, b); }
+  static bool AllSet(Vector a) { return _mm_movemask_epi8(a) == 0xffff; }
+
+  // 12 bytes are encoded, 16 have to be readable
+  static constexpr std::size_t kEncodeInputReadable = 16;
+  static constexpr std::size_t kEncodeInput = 12;
+  static constexpr std::size_t kDecodeInput = 16;
+
+  static Vector LoadEncodeInput(const char* in) {
+    return _mm_loadu_si128(reinterpret_cast<const Vector*>(in));
+  }
+  static Vector Load(const char* in) {
+    return _mm_loadu_si128(reinterpret_cast<const Vector*>(in));
+  }
+  static void Store(char* out, Vector v) {
+    _mm_storeu_si128(reinterpret_cast<Vector*>(out), v);
+  }
+  // 12 bytes are decoded, 16 are written
+  static void StoreDecoded(char* out, Vector v) { Store(out, v); }
+};
+
+#ifdef __AVX2__
+struct Avx2 {
+  using Vector = __m256i;
+
+  static Vector SetLanes(char c0, char c1, char c2, char c3, char c4, char c5,
+                         char c6, char c7, char c8, char c9, char c10,
+                         char c11, char c12, char c13, char c14, char c15) {
+    return _mm256_setr_epi8(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11,
+                            c12, c13, c14, c15, c0, c1, c2, c3, c4, c5, c6, c7,
+                            c8, c9, c10, c11, c12, c13, c14, c15);
+  }
+  static Vector Set8(char c) { return _mm256_set1_epi8(c); }
+  static Vector Set32(int i) { return _mm256_set1_epi32(i); }
+  static Vector Shuffle(Vector a, Vector b) {
+    return _mm256_shuffle_epi8(a, b);
+  }
+  static Vector And(Vector a, Vector b) { return _mm256_and_si256(a, b); }
+  static Vector Or(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+  static Vector Add8(Vector a, Vector b) { return _mm256_add_epi8(a, b); }
+  static Vector SubsU8(Vector a, Vector b) { return _mm256_subs_epu8(a, b); }
+  static Vector CmpGt8(Vector a, Vector b) { return _mm256_cmpgt_epi8(a, b); }
+  static Vector CmpEq8(Vector a, Vector b) { return _mm256_cmpeq_epi8(a, b); }
+  static Vector MulHi16(Vector a, Vector b) { return _mm256_mulhi_epu16(a, b); }
+  static Vector MulLo16(Vector a, Vector b) {
+    return _mm256_mullo_epi16(a, b);
+  }
+  static Vector MaddUbs(Vector a, Vector b) {
+    return _mm256_maddubs_epi16(a, b);
+  }
+  static Vector Madd16(Vector a, Vector b) { return _mm256_madd_epi16(a, b); }
+  static bool AllSet(Vector a) { return _mm256_movemask_epi8(a) == -1; }
+
+  // 24 bytes are encoded, 28 have to be readable
+  static constexpr std::size_t kEncodeInputReadable = 28;
+  static constexpr std::size_t kEncodeInput = 24;
+  static constexpr std::size_t kDecodeInput = 32;
+
+  static Vector LoadEncodeInput(const char* in) {
+    const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const auto high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 12));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+  }
+  static Vector Load(const char* in) {
+    return _mm256_loadu_si256(reinterpret_cast<const Vector*>(in));
+  }
+  static void Store(char* out, Vector v) {
+    _mm256_storeu_si256(reinterpret_cast<Vector*>(out), v);
+  }
+  // 24 bytes are decoded, 32 are written
+  static void StoreDecoded(char* out, Vector v) {
+    Store(out, _mm256_permutevar8x32_epi32(
+                   v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+  }
+};
+
+using Simd = Avx2;
+#else
+using Simd = Sse;
+#endif
+
+std::size_t EncodeSimd(const char*& in, std::size_t size, char*& out,
+                       const Alphabet& alphabet) {
+  using Vector = Simd::Vector;
+  std::size_t encoded = 0;
+  while (size - encoded >= Simd::kEncodeInputReadable) {
+    const auto indexes =
+        SplitToIndexes<Vector, Simd>(Simd::LoadEncodeInput(in));
+    Simd::Store(out, IndexesToAscii<Vector, Simd>(indexes, alphabet));
+    in += Simd::kEncodeInput;
+    out += Simd::kEncodeInput / 3 * 4;
+    encoded += Simd::kEncodeInput;
+  }
+  return encoded;
+}
+
+void DecodeSimd(const char*& in, const char* end, char*& out,
+                const Alphabet& alphabet) {
+  using Vector = Simd::Vector;
+  while (end - in >= static_cast<std::ptrdiff_t>(Simd::kDecodeInput)) {
+    auto values = Simd::Load(in);
+    // leave the block with padding or invalid chars to the scalar decoder
+    if (!AsciiToValues<Vector, Simd>(values, alphabet)) return;
+    Simd::StoreDecoded(out, PackValues<Vector, Simd>(values));
+    in += Simd::kDecodeInput;
+    out += Simd::kDecodeInput / 4 * 3;
+  }
+}
+#endif
+
+std::string Encode(std::string_view data, Pad pad, const Alphabet& alphabet) {
+  std::string result((data.size() + 2) / 3 * 4, '\0');
+  const char* in = data.data();
+  char* out = result.data();
+  std::size_t size = data.size();
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+  size -= EncodeSimd(in, size, out, alphabet);
+#endif
+
+  const auto at = [&in](std::size_t i) -> std::uint32_t {
+    return static_cast<std::uint8_t>(in[i]);
+  };
+  for (; size >= 3; size -= 3, in += 3) {
+    const auto triple = (at(0) << 16) | (at(1) << 8) | at(2);
+    *out++ = alphabet.encode[(triple >> 18) & 0x3f];
+    *out++ = alphabet.encode[(triple >> 12) & 0x3f];
+    *out++ = alphabet.encode[(triple >> 6) & 0x3f];
+    *out++ = alphabet.encode[triple & 0x3f];
+  }
+
+  if (size != 0) {
+    const auto triple = (at(0) << 16) | (size == 2 ? at(1) << 8 : 0);
+    *out++ = alphabet.encode[(triple >> 18) & 0x3f];
+    *out++ = alphabet.encode[(triple >> 12) & 0x3f];
+    if (size == 2) {
+      *out++ = alphabet.encode[(triple >> 6) & 0x3f];
+    } else if (pad == Pad::kWith) {
+      *out++ = '=';
+    }
+    if (pad == Pad::kWith) *out++ = '=';
+  }
+
+  result.resize(out - result.data());
+  return result;
+}
+
+// Chars outside of the alphabet, including the padding, are skipped and the
+// incomplete trailing bytes are dropped
+std::string Decode(std::string_view data, const Alphabet& alphabet) {
+  std::string result(data.size() / 4 * 3 + 3 + kDecodeSlack, '\0');
+  const char* in = data.data();
+  const char* const end = in + data.size();
+  char* out = result.data();
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+  DecodeSimd(in, end, out, alphabet);
+#endif
+
+  std::uint32_t accumulator = 0;
+  std::size_t accumulated = 0;
+  for (; in != end; ++in) {
+    const auto value = alphabet.decode[static_cast<std::uint8_t>(*in)];
+    if (value == kInvalid) continue;
+
+    accumulator = (accumulator << 6) | value;
+    if (++accumulated == 4) {
+      *out++ = static_cast<char>(accumulator >> 16);
+      *out++ = static_cast<char>(accumulator >> 8);
+      *out++ = static_cast<char>(accumulator);
+      accumulator = 0;
+      accumulated = 0;
+    }
+  }
+
+  if (accumulated >= 2) {
+    accumulator <<= 6 * (4 - accumulated);
+    *out++ = static_cast<char>(accumulator >> 16);
+    if (accumulated == 3) *out++ = static_cast<char>(accumulator >> 8);
+  }
+
+  result.resize(out - result.data());
+  return result;
 }
 
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  return Encode(data, pad, kStandard);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  return Decode(data, kStandard);
 }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  return Encode(data, pad, kUrl);
 }
 
 std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
+  return Decode(data, kUrl);
 }
 #endif
 
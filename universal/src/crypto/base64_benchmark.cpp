@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/base64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GenerateSource(std::size_t size) {
+  std::string source(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    source[i] = static_cast<char>(i * 7);
+  }
+  return source;
+}
+
+}  // namespace
+
+void Base64Encode(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Encode(source));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base64Encode)->RangeMultiplier(8)->Range(8, 1 << 20);
+
+void Base64Decode(benchmark::State& state) {
+  const auto encoded =
+      crypto::base64::Base64Encode(GenerateSource(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Decode(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base64Decode)->RangeMultiplier(8)->Range(8, 1 << 20);
+
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+void Base64UrlEncode(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64UrlEncode(source));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base64UrlEncode)->RangeMultiplier(8)->Range(8, 1 << 20);
+
+void Base64UrlDecode(benchmark::State& state) {
+  const auto encoded =
+      crypto::base64::Base64UrlEncode(GenerateSource(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64UrlDecode(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Base64UrlDecode)->RangeMultiplier(8)->Range(8, 1 << 20);
+#endif
+
+USERVER_NAMESPACE_END
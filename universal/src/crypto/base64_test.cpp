@@ -1,9 +1,23 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <userver/crypto/base64.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+std::string MakeBinaryData(std::size_t size) {
+  std::string data(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<char>(i * 7 + i / 256);
+  }
+  return data;
+}
+
+}  // namespace
+
 TEST(Crypto, Base64) {
   EXPECT_EQ("", crypto::base64::Base64Encode(""));
   EXPECT_EQ("", crypto::base64::Base64Decode(""));
@@ -17,6 +31,35 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64Long) {
+  std::string data;
+  std::string expected;
+  for (int i = 0; i < 100; ++i) {
+    data += "Man";
+    expected += "TWFu";
+  }
+  EXPECT_EQ(crypto::base64::Base64Encode(data), expected);
+  EXPECT_EQ(crypto::base64::Base64Decode(expected), data);
+
+  // Chars outside of the alphabet are skipped anywhere in the input
+  auto with_junk = expected;
+  with_junk.insert(37, "\n\xff=$");
+  with_junk.insert(5, " ");
+  EXPECT_EQ(crypto::base64::Base64Decode(with_junk), data);
+
+  for (std::size_t size = 0; size < 200; ++size) {
+    const auto binary = MakeBinaryData(size);
+    const auto encoded = crypto::base64::Base64Encode(binary);
+    EXPECT_EQ(encoded.size(), (size + 2) / 3 * 4);
+    EXPECT_EQ(crypto::base64::Base64Decode(encoded), binary);
+
+    const auto unpadded =
+        crypto::base64::Base64Encode(binary, crypto::base64::Pad::kWithout);
+    EXPECT_EQ(unpadded, encoded.substr(0, encoded.find('=')));
+    EXPECT_EQ(crypto::base64::Base64Decode(unpadded), binary);
+  }
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
@@ -24,6 +67,19 @@ TEST(Crypto, Base64Url) {
                        "S\xff", crypto::base64::Pad::kWithout));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+  EXPECT_EQ("S", crypto::base64::Base64UrlDecode("U/8"));
+
+  for (std::size_t size = 0; size < 200; ++size) {
+    const auto binary = MakeBinaryData(size);
+    auto expected = crypto::base64::Base64Encode(binary);
+    for (auto& c : expected) {
+      if (c == '+') c = '-';
+      if (c == '/') c = '_';
+    }
+    const auto encoded = crypto::base64::Base64UrlEncode(binary);
+    EXPECT_EQ(encoded, expected);
+    EXPECT_EQ(crypto::base64::Base64UrlDecode(encoded), binary);
+  }
 }
 #endif
 
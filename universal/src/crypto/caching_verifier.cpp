@@ -0,0 +1,122 @@
+#include <userver/crypto/caching_verifier.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <openssl/evp.h>
+
+#include <crypto/helpers.hpp>
+#include <crypto/openssl.hpp>
+#include <userver/cache/lru_map.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto {
+namespace {
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+// Parts are length-prefixed, so that {"ab", "c"} and {"a", "bc"} differ
+std::string MakeKey(std::initializer_list<std::string_view> data,
+                    std::string_view raw_signature) {
+  EvpMdCtx ctx;
+  if (1 != EVP_DigestInit_ex(ctx.Get(), EVP_sha256(), nullptr)) {
+    throw VerificationError(
+        FormatSslError("Failed to verify: EVP_DigestInit_ex"));
+  }
+
+  const auto update = [&ctx](std::string_view part) {
+    const std::uint64_t size = part.size();
+    if (1 != EVP_DigestUpdate(ctx.Get(), &size, sizeof(size)) ||
+        1 != EVP_DigestUpdate(ctx.Get(), part.data(), part.size())) {
+      throw VerificationError(
+          FormatSslError("Failed to verify: EVP_DigestUpdate"));
+    }
+  };
+  for (const auto& part : data) update(part);
+  update(raw_signature);
+
+  std::array<unsigned char, EVP_MAX_MD_SIZE> digest{};
+  unsigned int digest_size = 0;
+  if (1 != EVP_DigestFinal_ex(ctx.Get(), digest.data(), &digest_size)) {
+    throw VerificationError(
+        FormatSslError("Failed to verify: EVP_DigestFinal_ex"));
+  }
+  return std::string(reinterpret_cast<const char*>(digest.data()),
+                     digest_size);
+}
+
+}  // namespace
+
+struct CachingVerifier::Impl {
+  explicit Impl(Settings settings)
+      : ttl(settings.ttl), verified(settings.max_size) {}
+
+  bool IsVerified(const std::string& key, TimePoint now) {
+    const std::lock_guard lock{mutex};
+    const auto* expires_at = verified.Get(key);
+    if (!expires_at) return false;
+    if (*expires_at <= now) {
+      verified.Erase(key);
+      return false;
+    }
+    return true;
+  }
+
+  void SetVerified(const std::string& key, TimePoint expires_at) {
+    const std::lock_guard lock{mutex};
+    verified.Put(key, expires_at);
+  }
+
+  const std::chrono::seconds ttl;
+  std::mutex mutex;
+  cache::LruMap<std::string, TimePoint> verified;
+};
+
+CachingVerifier::CachingVerifier(std::shared_ptr<const Verifier> verifier,
+                                 Settings settings)
+    : Verifier(verifier ? verifier->Name() : std::string{}),
+      verifier_(std::move(verifier)),
+      impl_(std::make_unique<Impl>(settings)) {
+  UINVARIANT(verifier_, "CachingVerifier requires a verifier");
+  UINVARIANT(settings.max_size > 0, "CachingVerifier requires max_size > 0");
+  impl::Openssl::Init();
+}
+
+CachingVerifier::~CachingVerifier() = default;
+
+void CachingVerifier::Verify(std::initializer_list<std::string_view> data,
+                             std::string_view raw_signature) const {
+  Verify(data, raw_signature, TimePoint::max());
+}
+
+void CachingVerifier::Verify(std::initializer_list<std::string_view> data,
+                             std::string_view raw_signature,
+                             TimePoint expires_at) const {
+  const auto now = utils::datetime::Now();
+  if (expires_at <= now) {
+    // Nothing to remember, the result is about to become stale
+    verifier_->Verify(data, raw_signature);
+    return;
+  }
+
+  const auto key = MakeKey(data, raw_signature);
+  if (impl_->IsVerified(key, now)) return;
+
+  verifier_->Verify(data, raw_signature);
+  impl_->SetVerified(key, std::min(expires_at, now + impl_->ttl));
+}
+
+void CachingVerifier::Clear() const {
+  const std::lock_guard lock{impl_->mutex};
+  impl_->verified.Clear();
+}
+
+}  // namespace crypto
+
+USERVER_NAMESPACE_END
@@ -3,11 +3,14 @@
 #include <string_view>
 
 #include <userver/crypto/base64.hpp>
+#include <userver/crypto/caching_verifier.hpp>
 #include <userver/crypto/hash.hpp>
 #include <userver/crypto/signers.hpp>
 #include <userver/crypto/verifiers.hpp>
 #include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/datetime.hpp>
 #include <userver/utils/flags.hpp>
+#include <userver/utils/mock_now.hpp>
 
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
@@ -230,6 +233,23 @@ void TestDsaSignature(DsaSigner signer, DsaVerifier verifier,
   }
 }
 
+class CountingVerifier final : public crypto::Verifier {
+ public:
+  explicit CountingVerifier(std::string secret)
+      : Verifier("HS256"), verifier_(std::move(secret)) {}
+
+  void Verify(std::initializer_list<std::string_view> data,
+              std::string_view raw_signature) const override {
+    ++calls;
+    verifier_.Verify(data, raw_signature);
+  }
+
+  mutable std::size_t calls{0};
+
+ private:
+  crypto::VerifierHs256 verifier_;
+};
+
 }  // namespace
 
 TEST(Crypto, SignatureNone) {
@@ -378,4 +398,46 @@ TEST(Crypto, SignaturePs512) {
                    {}, TestFlags::kSkipDigestOps);
 }
 
+TEST(Crypto, CachingVerifier) {
+  using std::chrono::seconds;
+  utils::datetime::MockNowSet(std::chrono::system_clock::time_point{});
+
+  const auto counting = std::make_shared<CountingVerifier>("secret");
+  const crypto::CachingVerifier verifier{counting, {2, seconds{10}}};
+  EXPECT_EQ(verifier.Name(), "HS256");
+
+  const crypto::SignerHs256 signer("secret");
+  const auto sig = signer.Sign({"test"});
+  const auto bad_sig = signer.Sign({"bad test"});
+
+  EXPECT_NO_THROW(verifier.Verify({"test"}, sig));
+  EXPECT_NO_THROW(verifier.Verify({"test"}, sig));
+  EXPECT_EQ(counting->calls, 1);
+
+  EXPECT_THROW(verifier.Verify({"test"}, bad_sig), crypto::VerificationError);
+  EXPECT_THROW(verifier.Verify({"test"}, bad_sig), crypto::VerificationError);
+  EXPECT_NO_THROW(verifier.Verify({"te", "st"}, sig));
+  EXPECT_EQ(counting->calls, 4);
+
+  utils::datetime::MockSleep(seconds{11});
+  EXPECT_NO_THROW(verifier.Verify({"test"}, sig));
+  EXPECT_EQ(counting->calls, 5);
+
+  const auto multi_sig = signer.Sign({"te", "st", "!"});
+  const auto expires_at = utils::datetime::Now() + seconds{3};
+  EXPECT_NO_THROW(verifier.Verify({"te", "st", "!"}, multi_sig, expires_at));
+  EXPECT_NO_THROW(verifier.Verify({"te", "st", "!"}, multi_sig, expires_at));
+  EXPECT_EQ(counting->calls, 6);
+
+  utils::datetime::MockSleep(seconds{3});
+  EXPECT_NO_THROW(verifier.Verify({"te", "st", "!"}, multi_sig));
+  EXPECT_EQ(counting->calls, 7);
+
+  verifier.Clear();
+  EXPECT_NO_THROW(verifier.Verify({"te", "st", "!"}, multi_sig));
+  EXPECT_EQ(counting->calls, 8);
+
+  utils::datetime::MockNowUnset();
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,143 @@
+#include <userver/decimal64/bulk.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4>;
+
+constexpr std::size_t kSize = 1'000'000;
+
+std::vector<Money> MakeValues() {
+  std::mt19937_64 rng{42};
+  std::uniform_int_distribution<int64_t> distribution{-1'000'000'000,
+                                                      1'000'000'000};
+  std::vector<Money> values;
+  values.reserve(kSize);
+  for (std::size_t i = 0; i < kSize; ++i) {
+    values.push_back(Money::FromUnbiased(distribution(rng)));
+  }
+  return values;
+}
+
+std::vector<std::string> MakeStrings() {
+  std::vector<std::string> strings;
+  strings.reserve(kSize);
+  for (const auto& value : MakeValues()) {
+    strings.push_back(decimal64::ToString(value));
+  }
+  return strings;
+}
+
+}  // namespace
+
+void decimal64_parse_one_by_one(benchmark::State& state) {
+  const auto strings = MakeStrings();
+  std::vector<Money> out;
+  for (auto _ : state) {
+    out.clear();
+    for (const auto& string : strings) out.emplace_back(string);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_parse_one_by_one);
+
+void decimal64_parse_bulk(benchmark::State& state) {
+  const auto strings = MakeStrings();
+  std::vector<Money> out;
+  for (auto _ : state) {
+    decimal64::ParseBulk(strings, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_parse_bulk);
+
+void decimal64_sum_one_by_one(benchmark::State& state) {
+  const auto values = MakeValues();
+  for (auto _ : state) {
+    Money sum;
+    for (const auto& value : values) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_sum_one_by_one);
+
+void decimal64_sum_bulk(benchmark::State& state) {
+  const auto values = MakeValues();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::SumBulk(values));
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_sum_bulk);
+
+void decimal64_scale_one_by_one(benchmark::State& state) {
+  const auto values = MakeValues();
+  auto copy = values;
+  const decimal64::Decimal<2> factor{"3"};
+  for (auto _ : state) {
+    for (auto& value : copy) value *= factor;
+    benchmark::DoNotOptimize(copy.data());
+
+    state.PauseTiming();
+    copy = values;
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_scale_one_by_one);
+
+void decimal64_scale_bulk(benchmark::State& state) {
+  const auto values = MakeValues();
+  auto copy = values;
+  const decimal64::Decimal<2> factor{"3"};
+  for (auto _ : state) {
+    decimal64::ScaleBulk(copy, factor);
+    benchmark::DoNotOptimize(copy.data());
+
+    state.PauseTiming();
+    copy = values;
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_scale_bulk);
+
+void decimal64_format_one_by_one(benchmark::State& state) {
+  const auto values = MakeValues();
+  std::string buffer;
+  for (auto _ : state) {
+    buffer.clear();
+    for (const auto& value : values) {
+      buffer += decimal64::ToStringTrailingZeros(value);
+      buffer += '\n';
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_format_one_by_one);
+
+void decimal64_format_bulk(benchmark::State& state) {
+  const auto values = MakeValues();
+  std::string buffer;
+  for (auto _ : state) {
+    buffer.clear();
+    decimal64::FormatBulk(values, buffer);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(decimal64_format_bulk);
+
+USERVER_NAMESPACE_END
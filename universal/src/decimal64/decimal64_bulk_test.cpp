@@ -0,0 +1,106 @@
+#include <userver/decimal64/bulk.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using Dec4 = decimal64::Decimal<4>;
+
+TEST(Decimal64Bulk, Parse) {
+  std::vector<Dec4> out;
+  const std::vector<std::string> inputs{
+      "0",         "1.5",
+      "-1.5",      "+12.3456",
+      "-0.0001",   "00012.3",
+      "123456.78", "92233720368547.5807",
+      "-92233720368547.5807", "922337203685476"};
+  decimal64::ParseBulk(inputs, out);
+  ASSERT_EQ(out.size(), inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(out[i], Dec4{inputs[i]}) << inputs[i];
+  }
+}
+
+TEST(Decimal64Bulk, ParseErrors) {
+  std::vector<Dec4> out;
+  for (const std::string_view input :
+       {"", "-", "1.", ".1", "1.23456", "1,5", " 1", "1 ", "--1",
+        "92233720368547758.07"}) {
+    const std::vector<std::string_view> inputs{"1", input};
+    try {
+      decimal64::ParseBulk(inputs, out);
+      ADD_FAILURE() << "'" << input << "' is parsed";
+    } catch (const decimal64::ParseError& ex) {
+      EXPECT_NE(std::string_view{ex.what()}.find("[1]"), std::string::npos)
+          << ex.what();
+    }
+  }
+}
+
+TEST(Decimal64Bulk, Sum) {
+  EXPECT_EQ(decimal64::SumBulk(std::vector<Dec4>{}), Dec4{0});
+
+  std::vector<Dec4> values;
+  Dec4 expected;
+  for (int i = -1000; i < 3000; ++i) {
+    values.push_back(Dec4::FromUnbiased(i * 123457));
+    expected += values.back();
+  }
+  EXPECT_EQ(decimal64::SumBulk(values), expected);
+
+  const auto max = Dec4::FromUnbiased(decimal64::impl::kMaxInt64);
+  const auto min = Dec4::FromUnbiased(decimal64::impl::kMinInt64);
+  // the intermediate sums are out of bounds
+  EXPECT_EQ(decimal64::SumBulk(std::vector<Dec4>{max, max, min, min}),
+            Dec4{0} - Dec4::FromUnbiased(2));
+  EXPECT_THROW(decimal64::SumBulk(std::vector<Dec4>{max, Dec4{"0.0001"}}),
+                decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::SumBulk(std::vector<Dec4>{min, Dec4{"-0.0001"}}),
+                decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64Bulk, Scale) {
+  std::vector<Dec4> values{Dec4{"1.5"}, Dec4{"-2.0003"}, Dec4{"0"}};
+
+  decimal64::ScaleBulk(values, decimal64::Decimal<2>{"3"});
+  EXPECT_EQ(values,
+            (std::vector<Dec4>{Dec4{"4.5"}, Dec4{"-6.0009"}, Dec4{"0"}}));
+
+  decimal64::ScaleBulk(values, decimal64::Decimal<1>{"0.5"});
+  EXPECT_EQ(values,
+            (std::vector<Dec4>{Dec4{"2.25"}, Dec4{"-3.0005"}, Dec4{"0"}}));
+
+  std::vector<Dec4> big{Dec4{"1"}, Dec4{"900000000000000"}};
+  EXPECT_THROW(decimal64::ScaleBulk(big, Dec4{"100"}),
+                decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64Bulk, Format) {
+  const std::vector<Dec4> values{
+      Dec4{"0"},
+      Dec4{"1.5"},
+      Dec4{"-0.0001"},
+      Dec4{"-1234.5678"},
+      Dec4::FromUnbiased(decimal64::impl::kMaxInt64),
+      Dec4::FromUnbiased(decimal64::impl::kMinInt64)};
+
+  std::string buffer = "values:";
+  decimal64::FormatBulk(values, buffer, ';');
+
+  std::string expected = "values:";
+  for (const auto& value : values) {
+    expected += decimal64::ToStringTrailingZeros(value) + ';';
+  }
+  EXPECT_EQ(buffer, expected);
+
+  std::string integers;
+  decimal64::FormatBulk(
+      std::vector<decimal64::Decimal<0>>{decimal64::Decimal<0>{-7}}, integers);
+  EXPECT_EQ(integers, "-7\n");
+}
+
+USERVER_NAMESPACE_END
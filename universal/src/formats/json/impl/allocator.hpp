@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+
+#include <rapidjson/allocators.h>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+using Arena = ::rapidjson::MemoryPoolAllocator<::rapidjson::CrtAllocator>;
+
+// rapidjson Allocator for the formats::json::Value trees.
+//
+// Default constructed allocator uses the heap, just like CrtAllocator. An
+// allocator constructed from an Arena allocates from its chunks. rapidjson
+// frees the values via static Allocator::Free, so the values allocated from
+// an Arena must never be destroyed one by one: such trees are read-only and
+// are dropped all at once together with their Arena, see
+// VersionedValuePtr::Data.
+class Allocator final {
+ public:
+  static constexpr bool kNeedFree = true;
+
+  Allocator() noexcept = default;
+  explicit Allocator(Arena& arena) noexcept : arena_(&arena) {}
+
+  void* Malloc(std::size_t size) {
+    if (arena_) return arena_->Malloc(size);
+    return ::rapidjson::CrtAllocator{}.Malloc(size);
+  }
+
+  void* Realloc(void* original_ptr, std::size_t original_size,
+                std::size_t new_size) {
+    if (arena_) return arena_->Realloc(original_ptr, original_size, new_size);
+    return ::rapidjson::CrtAllocator{}.Realloc(original_ptr, original_size,
+                                               new_size);
+  }
+
+  static void Free(void* ptr) noexcept { ::rapidjson::CrtAllocator::Free(ptr); }
+
+  bool operator==(const Allocator& other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  bool operator!=(const Allocator& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  Arena* arena_{nullptr};
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
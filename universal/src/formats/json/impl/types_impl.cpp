@@ -1,5 +1,6 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <new>
 #include <utility>
 
 #include <userver/utils/assert.hpp>
@@ -99,6 +100,12 @@ void DestroyMembersIteratively(Value&& native) noexcept {
 }  // namespace
 
 VersionedValuePtr::Data::~Data() {
+  if (arena) {
+    // Arena memory can not be freed per value, the whole tree is dropped
+    // together with the Arena chunks without walking it
+    new (&native) Value{};
+    return;
+  }
   DestroyMembersIteratively(std::move(native));
 }
 
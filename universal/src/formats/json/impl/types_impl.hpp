@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,8 +20,14 @@ struct VersionedValuePtr::Data {
   // https://github.com/Tencent/rapidjson/issues/387
   explicit Data(Document&&);
 
+  // empty value, that should be filled with the values allocated from arena
+  explicit Data(std::unique_ptr<Arena>&& arena) noexcept;
+
   ~Data();
 
+  // owner of the native value memory, if the tree is Arena allocated
+  std::unique_ptr<Arena> arena;
+
   // native rapidjson value
   Value native;
 
@@ -0,0 +1,630 @@
+#include <userver/formats/json/on_demand.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/container/small_vector.hpp>
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <rapidjson/encodedstream.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <formats/json/impl/types_impl.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+using impl::TapeType;
+
+impl::Allocator g_allocator;
+::rapidjson::CrtAllocator g_stack_allocator;
+
+constexpr std::size_t kInitialStackDepth = 32;
+
+template <typename Int>
+bool IsNonOverflowingIntegral(const double val) {
+  constexpr auto kMaxIntDouble = static_cast<double>(
+      std::int64_t{1} << std::numeric_limits<double>::digits);
+  double integral_part = NAN;
+  if (std::modf(val, &integral_part) != 0.0) return false;
+
+  if constexpr (sizeof(Int) >= sizeof(double)) {
+    return val > -kMaxIntDouble && val < kMaxIntDouble;
+  } else {
+    return val >= std::numeric_limits<Int>::min() &&
+           val <= std::numeric_limits<Int>::max();
+  }
+}
+
+std::string_view GetString(const impl::Tape& tape,
+                           const impl::TapeEntry& entry) {
+  return {tape.strings.data() + entry.offset, entry.size};
+}
+
+class TapeBuilder final
+    : public ::rapidjson::BaseReaderHandler<impl::UTF8, TapeBuilder> {
+ public:
+  explicit TapeBuilder(impl::Tape& tape) : tape_(tape) {}
+
+  bool Null() { return Push(TapeType::kNull); }
+
+  bool Bool(bool value) {
+    return Push(value ? TapeType::kTrue : TapeType::kFalse);
+  }
+
+  bool Int(int value) { return Int64(value); }
+
+  bool Uint(unsigned value) { return Int64(value); }
+
+  bool Int64(std::int64_t value) {
+    Push(TapeType::kInt64);
+    tape_.entries.back().int64 = value;
+    return true;
+  }
+
+  bool Uint64(std::uint64_t value) {
+    if (value <= std::numeric_limits<std::int64_t>::max()) {
+      return Int64(static_cast<std::int64_t>(value));
+    }
+    Push(TapeType::kUint64);
+    tape_.entries.back().uint64 = value;
+    return true;
+  }
+
+  bool Double(double value) {
+    Push(TapeType::kDouble);
+    tape_.entries.back().real = value;
+    return true;
+  }
+
+  bool String(const char* str, ::rapidjson::SizeType length, bool) {
+    return PushString(TapeType::kString, str, length);
+  }
+
+  bool Key(const char* str, ::rapidjson::SizeType length, bool) {
+    return PushString(TapeType::kKey, str, length);
+  }
+
+  bool StartObject() { return PushContainer(TapeType::kObject); }
+
+  bool EndObject(::rapidjson::SizeType members_count) {
+    const auto index = PopContainer(members_count);
+    return CheckKeyUniqueness(index);
+  }
+
+  bool StartArray() { return PushContainer(TapeType::kArray); }
+
+  bool EndArray(::rapidjson::SizeType elements_count) {
+    PopContainer(elements_count);
+    return true;
+  }
+
+  const std::string& GetError() const { return error_; }
+
+ private:
+  bool Push(TapeType type) {
+    auto& entry = tape_.entries.emplace_back();
+    entry.type = type;
+    entry.next = tape_.entries.size();
+    return true;
+  }
+
+  bool PushString(TapeType type, const char* str,
+                  ::rapidjson::SizeType length) {
+    Push(type);
+    auto& entry = tape_.entries.back();
+    entry.size = length;
+    entry.offset = tape_.strings.size();
+    tape_.strings.append(str, length);
+    return true;
+  }
+
+  bool PushContainer(TapeType type) {
+    open_.push_back(tape_.entries.size());
+    return Push(type);
+  }
+
+  std::uint32_t PopContainer(::rapidjson::SizeType size) {
+    UASSERT(!open_.empty());
+    const auto index = open_.back();
+    open_.pop_back();
+
+    auto& entry = tape_.entries[index];
+    entry.size = size;
+    entry.next = tape_.entries.size();
+    return index;
+  }
+
+  bool CheckKeyUniqueness(std::uint32_t index) {
+    const auto& entries = tape_.entries;
+    const auto count = entries[index].size;
+    if (count < 2) return true;
+
+    keys_.clear();
+    for (auto key = index + 1; keys_.size() < count;
+         key = entries[key + 1].next) {
+      keys_.push_back(GetString(tape_, entries[key]));
+    }
+    std::sort(keys_.begin(), keys_.end());
+    const auto duplicate = std::adjacent_find(keys_.begin(), keys_.end());
+    if (duplicate == keys_.end()) return true;
+
+    error_ = fmt::format("Duplicate key: {}", *duplicate);
+    return false;
+  }
+
+  impl::Tape& tape_;
+  boost::container::small_vector<std::uint32_t, kInitialStackDepth> open_;
+  std::vector<std::string_view> keys_;
+  std::string error_;
+};
+
+// Feeds the value to rapidjson SAX handler. The tape is in the document
+// order, so this is a linear scan that closes the containers once their end
+// is reached.
+template <typename Handler>
+void Accept(const impl::Tape& tape, std::uint32_t index, Handler& handler) {
+  const auto& entries = tape.entries;
+  boost::container::small_vector<std::uint32_t, kInitialStackDepth> open;
+
+  const auto close = [&] {
+    const auto& container = entries[open.back()];
+    if (container.type == TapeType::kObject) {
+      handler.EndObject(container.size);
+    } else {
+      handler.EndArray(container.size);
+    }
+    open.pop_back();
+  };
+
+  for (auto i = index; i < entries[index].next; ++i) {
+    while (!open.empty() && entries[open.back()].next == i) close();
+
+    const auto& entry = entries[i];
+    switch (entry.type) {
+      case TapeType::kNull:
+        handler.Null();
+        break;
+      case TapeType::kFalse:
+        handler.Bool(false);
+        break;
+      case TapeType::kTrue:
+        handler.Bool(true);
+        break;
+      case TapeType::kInt64:
+        handler.Int64(entry.int64);
+        break;
+      case TapeType::kUint64:
+        handler.Uint64(entry.uint64);
+        break;
+      case TapeType::kDouble:
+        handler.Double(entry.real);
+        break;
+      case TapeType::kString:
+        handler.String(tape.strings.data() + entry.offset, entry.size, true);
+        break;
+      case TapeType::kKey:
+        handler.Key(tape.strings.data() + entry.offset, entry.size, true);
+        break;
+      case TapeType::kArray:
+        handler.StartArray();
+        open.push_back(i);
+        break;
+      case TapeType::kObject:
+        handler.StartObject();
+        open.push_back(i);
+        break;
+    }
+  }
+
+  while (!open.empty()) close();
+}
+
+}  // namespace
+
+OnDemandDocument::OnDemandDocument(std::string_view doc) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
+  }
+
+  auto tape = std::make_unique<impl::Tape>();
+  // Strings never get longer after unescaping, so the buffer is allocated
+  // once. Entries count is a rough guess for a typical document.
+  tape->entries.reserve(doc.size() / 8 + 1);
+  tape->strings.reserve(doc.size());
+
+  TapeBuilder builder{*tape};
+  ::rapidjson::MemoryStream memory_stream(doc.data(), doc.size());
+  ::rapidjson::EncodedInputStream<impl::UTF8, ::rapidjson::MemoryStream> stream(
+      memory_stream);
+  ::rapidjson::GenericReader<impl::UTF8, impl::UTF8, ::rapidjson::CrtAllocator>
+      reader{&g_stack_allocator};
+  const ::rapidjson::ParseResult ok =
+      reader.Parse<::rapidjson::kParseDefaultFlags |
+                   ::rapidjson::kParseIterativeFlag |
+                   ::rapidjson::kParseFullPrecisionFlag>(stream, builder);
+  if (!ok) {
+    const auto offset = ok.Offset();
+    const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
+    const auto from_pos = doc.substr(0, offset).find_last_of('\n');
+    const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+
+    throw ParseException(fmt::format(
+        "JSON parse error at line {} column {}: {}", line, column,
+        builder.GetError().empty() ? ::rapidjson::GetParseError_En(ok.Code())
+                                   : builder.GetError()));
+  }
+
+  tape_ = std::move(tape);
+}
+
+OnDemandDocument::OnDemandDocument(OnDemandDocument&&) noexcept = default;
+
+OnDemandDocument& OnDemandDocument::operator=(OnDemandDocument&&) noexcept =
+    default;
+
+OnDemandDocument::~OnDemandDocument() = default;
+
+ValueView OnDemandDocument::GetRoot() const {
+  UASSERT_MSG(tape_, "Using a moved out OnDemandDocument");
+  return ValueView{tape_.get(), 0};
+}
+
+ValueView::const_iterator::const_iterator(const ValueView& container,
+                                          std::uint32_t entry,
+                                          std::size_t position) noexcept
+    : tape_(container.tape_),
+      container_(container.index_),
+      entry_(entry),
+      position_(position) {}
+
+ValueView ValueView::const_iterator::operator*() const {
+  UASSERT(tape_);
+  const auto& entry = tape_->entries[entry_];
+  return {tape_, entry.type == TapeType::kKey ? entry_ + 1 : entry_};
+}
+
+ValueView::const_iterator& ValueView::const_iterator::operator++() noexcept {
+  UASSERT(tape_);
+  const auto& entries = tape_->entries;
+  entry_ = entries[entry_].type == TapeType::kKey ? entries[entry_ + 1].next
+                                                  : entries[entry_].next;
+  ++position_;
+  return *this;
+}
+
+ValueView::const_iterator ValueView::const_iterator::operator++(
+    int) noexcept {
+  auto result = *this;
+  ++*this;
+  return result;
+}
+
+std::string ValueView::const_iterator::GetName() const {
+  const ValueView container{tape_, container_};
+  if (!container.IsObject()) {
+    throw TypeMismatchException(container.GetExtendedType(),
+                                impl::objectValue, container.GetPath());
+  }
+  return std::string{GetString(*tape_, tape_->entries[entry_])};
+}
+
+std::size_t ValueView::const_iterator::GetIndex() const {
+  const ValueView container{tape_, container_};
+  if (!container.IsArray()) {
+    throw TypeMismatchException(container.GetExtendedType(), impl::arrayValue,
+                                container.GetPath());
+  }
+  return position_;
+}
+
+ValueView ValueView::operator[](std::string_view key) const {
+  if (!IsMissing()) {
+    CheckObjectOrNull();
+    if (IsObject()) {
+      const auto& entries = tape_->entries;
+      const auto end = entries[index_].next;
+      for (auto i = index_ + 1; i < end; i = entries[i + 1].next) {
+        if (GetString(*tape_, entries[i]) == key) return {tape_, i + 1};
+      }
+    }
+  }
+  return {tape_, formats::common::MakeChildPath(GetPath(), key)};
+}
+
+ValueView ValueView::operator[](std::size_t index) const {
+  CheckInBounds(index);
+  const auto& entries = tape_->entries;
+  auto i = index_ + 1;
+  for (; index > 0; --index) i = entries[i].next;
+  return {tape_, i};
+}
+
+ValueView::const_iterator ValueView::begin() const {
+  CheckObjectOrArrayOrNull();
+  if (IsNull()) return {};
+  return {*this, index_ + 1, 0};
+}
+
+ValueView::const_iterator ValueView::end() const {
+  CheckObjectOrArrayOrNull();
+  if (IsNull()) return {};
+  return {*this, GetEntry().next, GetEntry().size};
+}
+
+bool ValueView::IsEmpty() const { return GetSize() == 0; }
+
+std::size_t ValueView::GetSize() const {
+  CheckObjectOrArrayOrNull();
+  return IsNull() ? 0 : GetEntry().size;
+}
+
+bool ValueView::IsMissing() const noexcept { return index_ == kMissing; }
+
+bool ValueView::IsNull() const noexcept {
+  return !IsMissing() && GetType() == TapeType::kNull;
+}
+
+bool ValueView::IsBool() const noexcept {
+  if (IsMissing()) return false;
+  const auto type = GetType();
+  return type == TapeType::kTrue || type == TapeType::kFalse;
+}
+
+bool ValueView::IsInt() const noexcept {
+  if (IsMissing()) return false;
+  switch (GetType()) {
+    case TapeType::kInt64:
+      return GetEntry().int64 >= std::numeric_limits<int>::min() &&
+             GetEntry().int64 <= std::numeric_limits<int>::max();
+    case TapeType::kDouble:
+      return IsNonOverflowingIntegral<int>(GetEntry().real);
+    default:
+      return false;
+  }
+}
+
+bool ValueView::IsInt64() const noexcept {
+  if (IsMissing()) return false;
+  switch (GetType()) {
+    case TapeType::kInt64:
+      return true;
+    case TapeType::kDouble:
+      return IsNonOverflowingIntegral<std::int64_t>(GetEntry().real);
+    default:
+      return false;
+  }
+}
+
+bool ValueView::IsUInt64() const noexcept {
+  if (IsMissing()) return false;
+  switch (GetType()) {
+    case TapeType::kInt64:
+      return GetEntry().int64 >= 0;
+    case TapeType::kUint64:
+      return true;
+    case TapeType::kDouble:
+      return IsNonOverflowingIntegral<std::uint64_t>(GetEntry().real);
+    default:
+      return false;
+  }
+}
+
+bool ValueView::IsDouble() const noexcept {
+  if (IsMissing()) return false;
+  const auto type = GetType();
+  return type == TapeType::kInt64 || type == TapeType::kUint64 ||
+         type == TapeType::kDouble;
+}
+
+bool ValueView::IsString() const noexcept {
+  return !IsMissing() && GetType() == TapeType::kString;
+}
+
+bool ValueView::IsArray() const noexcept {
+  return !IsMissing() && GetType() == TapeType::kArray;
+}
+
+bool ValueView::IsObject() const noexcept {
+  return !IsMissing() && GetType() == TapeType::kObject;
+}
+
+template <>
+bool ValueView::As<bool>() const {
+  CheckNotMissing();
+  if (GetType() == TapeType::kTrue) return true;
+  if (GetType() == TapeType::kFalse) return false;
+  throw TypeMismatchException(GetExtendedType(), impl::booleanValue, GetPath());
+}
+
+template <>
+std::int64_t ValueView::As<std::int64_t>() const {
+  CheckNotMissing();
+  if (GetType() == TapeType::kInt64) return GetEntry().int64;
+  if (GetType() == TapeType::kDouble) {
+    const double val = GetEntry().real;
+    if (IsNonOverflowingIntegral<std::int64_t>(val)) {
+      return static_cast<std::int64_t>(val);
+    }
+  }
+  throw TypeMismatchException(GetExtendedType(), impl::intValue, GetPath());
+}
+
+template <>
+std::uint64_t ValueView::As<std::uint64_t>() const {
+  CheckNotMissing();
+  const auto& entry = GetEntry();
+  if (entry.type == TapeType::kUint64) return entry.uint64;
+  if (entry.type == TapeType::kInt64 && entry.int64 >= 0) {
+    return static_cast<std::uint64_t>(entry.int64);
+  }
+  if (entry.type == TapeType::kDouble &&
+      IsNonOverflowingIntegral<std::uint64_t>(entry.real)) {
+    return static_cast<std::uint64_t>(entry.real);
+  }
+  throw TypeMismatchException(GetExtendedType(), impl::uintValue, GetPath());
+}
+
+template <>
+double ValueView::As<double>() const {
+  CheckNotMissing();
+  const auto& entry = GetEntry();
+  switch (entry.type) {
+    case TapeType::kDouble:
+      return entry.real;
+    case TapeType::kInt64:
+      return static_cast<double>(entry.int64);
+    case TapeType::kUint64:
+      return static_cast<double>(entry.uint64);
+    default:
+      throw TypeMismatchException(GetExtendedType(), impl::realValue,
+                                  GetPath());
+  }
+}
+
+template <>
+std::string ValueView::As<std::string>() const {
+  return std::string{GetStringView()};
+}
+
+std::string_view ValueView::GetStringView() const {
+  CheckNotMissing();
+  if (IsString()) return GetString(*tape_, GetEntry());
+  throw TypeMismatchException(GetExtendedType(), impl::stringValue, GetPath());
+}
+
+bool ValueView::HasMember(std::string_view key) const {
+  if (IsMissing()) return false;
+  CheckObjectOrNull();
+  return IsObject() && !(*this)[key].IsMissing();
+}
+
+std::string ValueView::GetPath() const {
+  if (IsMissing()) return missing_path_;
+  if (!tape_) return formats::common::kPathRoot;
+
+  // Descend from the root into the containers that hold the value
+  const auto& entries = tape_->entries;
+  std::string path;
+  for (std::uint32_t current = 0; current != index_;) {
+    const auto& container = entries[current];
+    UASSERT(container.next > index_);
+    std::uint32_t child = current + 1;
+    if (container.type == TapeType::kObject) {
+      while (entries[child + 1].next <= index_) child = entries[child + 1].next;
+      formats::common::AppendPath(path, GetString(*tape_, entries[child]));
+      current = child + 1;
+    } else {
+      std::size_t position = 0;
+      for (; entries[child].next <= index_; ++position) {
+        child = entries[child].next;
+      }
+      formats::common::AppendPath(path, position);
+      current = child;
+    }
+  }
+  return path.empty() ? formats::common::kPathRoot : path;
+}
+
+Value ValueView::Clone() const {
+  CheckNotMissing();
+  if (!tape_) return {};
+
+  impl::Document document{&g_allocator};
+  const auto generator = [this](auto& handler) {
+    Accept(*tape_, index_, handler);
+    return true;
+  };
+  document.Populate(generator);
+  return Value{impl::VersionedValuePtr::Create(std::move(document))};
+}
+
+void ValueView::CheckNotMissing() const {
+  if (IsMissing()) {
+    throw MemberMissingException(GetPath());
+  }
+}
+
+void ValueView::CheckArrayOrNull() const {
+  if (!IsNull() && !IsArray()) {
+    throw TypeMismatchException(GetExtendedType(), impl::arrayValue, GetPath());
+  }
+}
+
+void ValueView::CheckObjectOrNull() const {
+  if (!IsNull() && !IsObject()) {
+    throw TypeMismatchException(GetExtendedType(), impl::objectValue,
+                                GetPath());
+  }
+}
+
+void ValueView::CheckObject() const {
+  if (!IsObject()) {
+    throw TypeMismatchException(GetExtendedType(), impl::objectValue,
+                                GetPath());
+  }
+}
+
+void ValueView::CheckObjectOrArrayOrNull() const {
+  if (!IsNull() && !IsObject() && !IsArray()) {
+    throw TypeMismatchException(GetExtendedType(), impl::objectValue,
+                                GetPath());
+  }
+}
+
+void ValueView::CheckInBounds(std::size_t index) const {
+  CheckArrayOrNull();
+  if (index >= GetSize()) {
+    throw OutOfBoundsException(index, GetSize(), GetPath());
+  }
+}
+
+const impl::TapeEntry& ValueView::GetEntry() const noexcept {
+  static const impl::TapeEntry kNullEntry{};
+
+  UASSERT(!IsMissing());
+  return tape_ ? tape_->entries[index_] : kNullEntry;
+}
+
+TapeType ValueView::GetType() const noexcept { return GetEntry().type; }
+
+int ValueView::GetExtendedType() const {
+  CheckNotMissing();
+  switch (GetType()) {
+    case TapeType::kNull:
+      return impl::nullValue;
+    case TapeType::kFalse:
+    case TapeType::kTrue:
+      return impl::booleanValue;
+    case TapeType::kInt64:
+      return impl::intValue;
+    case TapeType::kUint64:
+      return impl::uintValue;
+    case TapeType::kDouble:
+      return impl::realValue;
+    case TapeType::kString:
+    case TapeType::kKey:
+      return impl::stringValue;
+    case TapeType::kArray:
+      return impl::arrayValue;
+    case TapeType::kObject:
+      return impl::objectValue;
+  }
+  return impl::errorValue;
+}
+
+Value Parse(const ValueView& value, parse::To<Value>) { return value.Clone(); }
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
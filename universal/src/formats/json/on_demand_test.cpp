@@ -0,0 +1,151 @@
+#include <userver/formats/json/on_demand.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDoc = R"({
+  "key1": 1,
+  "key2": "val",
+  "key3": {"sub": -1, "big": 18446744073709551615, "real": 0.5},
+  "key4": [1, 2, 3],
+  "key5": [{"a": [true]}, null, false],
+  "key6": {}
+})";
+
+}  // namespace
+
+TEST(FormatsJsonOnDemand, Types) {
+  const formats::json::OnDemandDocument doc{kDoc};
+  const auto root = doc.GetRoot();
+
+  EXPECT_TRUE(root.IsObject());
+  EXPECT_EQ(root.GetSize(), 6);
+  EXPECT_TRUE(root["key1"].IsInt());
+  EXPECT_EQ(root["key1"].As<int>(), 1);
+  EXPECT_EQ(root["key2"].As<std::string>(), "val");
+  EXPECT_EQ(root["key2"].GetStringView(), "val");
+  EXPECT_EQ(root["key3"]["sub"].As<std::int64_t>(), -1);
+  EXPECT_FALSE(root["key3"]["sub"].IsUInt64());
+  EXPECT_FALSE(root["key3"]["big"].IsInt64());
+  EXPECT_EQ(root["key3"]["big"].As<std::uint64_t>(),
+            std::numeric_limits<std::uint64_t>::max());
+  EXPECT_DOUBLE_EQ(root["key3"]["real"].As<double>(), 0.5);
+  EXPECT_TRUE(root["key4"].IsArray());
+  EXPECT_EQ(root["key4"][2].As<int>(), 3);
+  EXPECT_TRUE(root["key5"][0]["a"][0].As<bool>());
+  EXPECT_TRUE(root["key5"][1].IsNull());
+  EXPECT_FALSE(root["key5"][2].As<bool>());
+  EXPECT_TRUE(root["key6"].IsEmpty());
+
+  EXPECT_TRUE(root["missing"].IsMissing());
+  EXPECT_TRUE(root["missing"]["nested"].IsMissing());
+  EXPECT_TRUE(root.HasMember("key6"));
+  EXPECT_FALSE(root.HasMember("key7"));
+  EXPECT_EQ(root["missing"].As<int>(42), 42);
+}
+
+TEST(FormatsJsonOnDemand, Iteration) {
+  const formats::json::OnDemandDocument doc{kDoc};
+  const auto root = doc.GetRoot();
+
+  std::vector<std::string> names;
+  for (auto it = root.begin(); it != root.end(); ++it) {
+    names.push_back(it.GetName());
+  }
+  EXPECT_EQ(names, (std::vector<std::string>{"key1", "key2", "key3", "key4",
+                                             "key5", "key6"}));
+
+  std::size_t count = 0;
+  for (const auto& element : root["key5"]) {
+    EXPECT_FALSE(element.IsMissing());
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(root["key6"].begin(), root["key6"].end());
+}
+
+TEST(FormatsJsonOnDemand, Parse) {
+  const formats::json::OnDemandDocument doc{kDoc};
+  const auto root = doc.GetRoot();
+
+  EXPECT_EQ(root["key4"].As<std::vector<int>>(), (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ((root["key3"].As<std::map<std::string, double>>()),
+            (std::map<std::string, double>{
+                {"sub", -1}, {"big", 18446744073709551615.0}, {"real", 0.5}}));
+  EXPECT_EQ(root["missing"].As<std::optional<int>>(), std::nullopt);
+  EXPECT_EQ(root["key1"].As<std::optional<int>>(), 1);
+
+  EXPECT_EQ(root.As<formats::json::Value>(), formats::json::FromString(kDoc));
+  EXPECT_EQ(root["key5"].Clone(),
+            formats::json::FromString(kDoc)["key5"]);
+}
+
+TEST(FormatsJsonOnDemand, Errors) {
+  EXPECT_THROW(formats::json::OnDemandDocument{""},
+               formats::json::ParseException);
+  EXPECT_THROW(formats::json::OnDemandDocument{"{\"a\":"},
+               formats::json::ParseException);
+  EXPECT_THROW(formats::json::OnDemandDocument{R"({"a": 1, "a": 2})"},
+               formats::json::ParseException);
+
+  const formats::json::OnDemandDocument doc{kDoc};
+  const auto root = doc.GetRoot();
+  EXPECT_THROW(root["key2"].As<int>(), formats::json::TypeMismatchException);
+  EXPECT_THROW(root["key4"][3], formats::json::OutOfBoundsException);
+  EXPECT_THROW(root["missing"].As<int>(),
+               formats::json::MemberMissingException);
+  EXPECT_THROW(root["key1"]["x"], formats::json::TypeMismatchException);
+
+  EXPECT_EQ(root.GetPath(), "/");
+  EXPECT_EQ(root["key5"][0]["a"][0].GetPath(), "key5[0].a[0]");
+  EXPECT_EQ(root["key3"]["real"].GetPath(), "key3.real");
+  EXPECT_EQ(root["key3"]["none"].GetPath(), "key3.none");
+}
+
+TEST(FormatsJsonOnDemand, Move) {
+  formats::json::OnDemandDocument doc{"[\"some long string value\"]"};
+  const auto value = doc.GetRoot()[0];
+  const auto moved = std::move(doc);
+  EXPECT_EQ(value.As<std::string>(), "some long string value");
+}
+
+/// [Sample OnDemandDocument usage]
+namespace my_namespace {
+
+struct Data {
+  std::string name;
+  std::vector<int> values;
+};
+
+// A generic Parse works both for formats::json::Value and ValueView
+template <class Value>
+Data Parse(const Value& value, formats::parse::To<Data>) {
+  return Data{value["name"].template As<std::string>(),
+              value["values"].template As<std::vector<int>>({})};
+}
+
+TEST(FormatsJsonOnDemand, ExampleUsage) {
+  const formats::json::OnDemandDocument doc{
+      R"({"name": "x", "values": [1, 2], "huge_unused_field": {}})"};
+
+  // Only the touched fields are converted
+  const auto data = doc.GetRoot().As<Data>();
+  EXPECT_EQ(data.name, "x");
+  EXPECT_EQ(data.values, (std::vector<int>{1, 2}));
+}
+
+}  // namespace my_namespace
+/// [Sample OnDemandDocument usage]
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <fmt/format.h>
 
+#include <userver/formats/json/on_demand.hpp>
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -67,6 +68,16 @@ void JsonParseArraySax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseArraySax)->RangeMultiplier(4)->Range(1, 1024);
 
+void JsonParseArrayOnDemand(benchmark::State& state) {
+  const auto input = BuildArray(state.range(0));
+  for (auto _ : state) {
+    const formats::json::OnDemandDocument json{input};
+    const auto res = json.GetRoot().As<std::vector<std::vector<int64_t>>>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseArrayOnDemand)->RangeMultiplier(4)->Range(1, 1024);
+
 std::string BuildObject(size_t level) {
   if (level == 0) {
     return R"({"k": 123, "v": 1.11, "s": "some string"})";
@@ -97,4 +108,33 @@ void JsonParseValueSax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
+void JsonParseValueOnDemand(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for (auto _ : state) {
+    const formats::json::OnDemandDocument res{input};
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseValueOnDemand)->RangeMultiplier(2)->Range(1, 16);
+
+void JsonParseFieldDom(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for (auto _ : state) {
+    const auto json = formats::json::FromString(input);
+    const auto res = json["three"].As<std::string>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseFieldDom)->RangeMultiplier(2)->Range(1, 16);
+
+void JsonParseFieldOnDemand(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for (auto _ : state) {
+    const formats::json::OnDemandDocument json{input};
+    const auto res = json.GetRoot()["three"].As<std::string>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseFieldOnDemand)->RangeMultiplier(2)->Range(1, 16);
+
 USERVER_NAMESPACE_END
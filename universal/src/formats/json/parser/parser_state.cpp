@@ -28,6 +28,66 @@ std::string ToLimited(std::string_view sw) {
     return std::string{sw};
 }
 
+// rapidjson input stream that reads the next chunk once the current one is
+// consumed, '\0' is returned at the end of the input
+class ChunkedStream final {
+ public:
+  using Ch = char;
+
+  explicit ChunkedStream(const ParserState::ChunkReader& read_chunk)
+      : read_chunk_(read_chunk) {}
+
+  Ch Peek() { return HasData() ? chunk_[pos_] : '\0'; }
+
+  Ch Take() {
+    if (!HasData()) return '\0';
+    ++consumed_;
+    return chunk_[pos_++];
+  }
+
+  std::size_t Tell() const { return consumed_; }
+
+  // Input starting at `from`, the previous chunks are already dropped
+  std::string_view InputSince(std::size_t from) const {
+    const auto chunk_begin = consumed_ - pos_;
+    if (from < chunk_begin) return {};
+    return std::string_view{chunk_}.substr(from - chunk_begin,
+                                           consumed_ - from);
+  }
+
+  // Required by rapidjson::Reader, never called for the input streams
+  Ch* PutBegin() {
+    UASSERT(false);
+    return nullptr;
+  }
+  void Put(Ch) { UASSERT(false); }
+  void Flush() { UASSERT(false); }
+  std::size_t PutEnd(Ch*) {
+    UASSERT(false);
+    return 0;
+  }
+
+ private:
+  bool HasData() {
+    while (pos_ == chunk_.size()) {
+      if (is_finished_) return false;
+      pos_ = 0;
+      if (!read_chunk_(chunk_)) {
+        is_finished_ = true;
+        chunk_.clear();
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const ParserState::ChunkReader& read_chunk_;
+  std::string chunk_;
+  std::size_t pos_{0};
+  std::size_t consumed_{0};
+  bool is_finished_{false};
+};
+
 }  // namespace
 
 struct ParserState::Impl {
@@ -40,6 +100,9 @@ struct ParserState::Impl {
 
   void PushParser(BaseParser& parser, ParserState& parser_state);
 
+  template <typename Stream, typename InputSince>
+  void ProcessInput(Stream& is, InputSince input_since);
+
   [[nodiscard]] std::string GetPath() const;
 };
 
@@ -73,13 +136,11 @@ void ParserState::PushParser(BaseParser& parser) {
   impl_->PushParser(parser, *this);
 }
 
-void ParserState::ProcessInput(std::string_view sw) {
+template <typename Stream, typename InputSince>
+void ParserState::Impl::ProcessInput(Stream& is, InputSince input_since) {
   rapidjson::Reader reader;
-  rapidjson::MemoryStream is(sw.data(), sw.size());
   reader.IterativeParseInit();
 
-  auto& stack = impl_->stack;
-
   size_t pos = 0;
   try {
     while (!reader.IterativeParseComplete()) {
@@ -96,7 +157,7 @@ void ParserState::ProcessInput(std::string_view sw) {
       if (reader.HasParseError()) {
         throw ParseError{
             reader.GetErrorOffset(),
-            impl_->GetPath(),
+            GetPath(),
             rapidjson::GetParseError_En(reader.GetParseErrorCode()),
         };
       }
@@ -108,10 +169,10 @@ void ParserState::ProcessInput(std::string_view sw) {
     auto msg = (cur_pos == pos)
                    ? ""
                    : fmt::format(", the latest token was {}",
-                                 ToLimited(sw.substr(pos, cur_pos - pos)));
+                                 ToLimited(input_since(pos)));
     throw ParseError{
         cur_pos,
-        impl_->GetPath(),
+        GetPath(),
         e.what() + msg,
     };
   }
@@ -121,6 +182,19 @@ void ParserState::ProcessInput(std::string_view sw) {
   }
 }
 
+void ParserState::ProcessInput(std::string_view sw) {
+  rapidjson::MemoryStream is(sw.data(), sw.size());
+  impl_->ProcessInput(is, [&is, sw](std::size_t from) {
+    return sw.substr(from, is.Tell() - from);
+  });
+}
+
+void ParserState::ProcessChunkedInput(const ChunkReader& read_chunk) {
+  ChunkedStream is{read_chunk};
+  impl_->ProcessInput(
+      is, [&is](std::size_t from) { return is.InputSince(from); });
+}
+
 BaseParser& ParserState::GetTopParser() const {
   UASSERT(!impl_->stack.empty());
   return *impl_->stack.back().parser;
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <unordered_map>
+#include <utility>
 
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
@@ -359,6 +360,50 @@ TEST(JsonStringParser, JsonValueBad) {
   }
 }
 
+TEST(JsonStringParser, ChunkedInput) {
+  const std::vector<std::string> chunks{"[[1", "],[", "]",
+                                       ",[22,", "3,4", "]]"};
+  std::vector<std::vector<int64_t>> result{};
+
+  fjp::Int64Parser int_parser;
+  using Subparser = fjp::ArrayParser<int64_t, fjp::Int64Parser>;
+  Subparser subparser(int_parser);
+  fjp::ArrayParser<std::vector<int64_t>, Subparser> parser(subparser);
+  fjp::SubscriberSink<decltype(result)> sink(result);
+  parser.Reset();
+  parser.Subscribe(sink);
+
+  std::size_t next_chunk = 0;
+  fjp::ParserState state;
+  state.PushParser(parser);
+  state.ProcessChunkedInput([&](std::string& chunk) {
+    if (next_chunk == chunks.size()) return false;
+    chunk = chunks[next_chunk++];
+    return true;
+  });
+  EXPECT_EQ(result, (std::vector<std::vector<int64_t>>{{1}, {}, {22, 3, 4}}));
+}
+
+TEST(JsonStringParser, ChunkedInputTruncated) {
+  std::vector<int64_t> result{};
+
+  fjp::Int64Parser int_parser;
+  fjp::ArrayParser<int64_t, fjp::Int64Parser> parser(int_parser);
+  fjp::SubscriberSink<decltype(result)> sink(result);
+  parser.Reset();
+  parser.Subscribe(sink);
+
+  bool is_sent = false;
+  fjp::ParserState state;
+  state.PushParser(parser);
+  EXPECT_THROW(state.ProcessChunkedInput([&](std::string& chunk) {
+    if (std::exchange(is_sent, true)) return false;
+    chunk = "[1,2";
+    return true;
+  }),
+               fjp::ParseError);
+}
+
 TEST(JsonStringParser, BomSymbol) {
   std::string input =
       "{\r\n\"track_id\": \"0000436301831\",\r\n\"service\": "
@@ -5,6 +5,7 @@
 
 #include <userver/formats/json/value_builder.hpp>
 
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 // These tests ensure that array/object members are internally stored in plain
@@ -14,7 +15,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace {
-::rapidjson::CrtAllocator g_allocator;
+formats::json::impl::Allocator g_allocator;
 }  // namespace
 
 // Ensure contiguous allocation in rapidjson arrays
@@ -4,14 +4,18 @@
 #include <array>
 #include <fstream>
 #include <memory>
+#include <new>
 #include <string_view>
 #include <vector>
 
 #include <fmt/format.h>
 #include <rapidjson/document.h>
+#include <rapidjson/encodedstream.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/istreamwrapper.h>
+#include <rapidjson/memorystream.h>
 #include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
@@ -28,7 +32,8 @@ namespace formats::json {
 
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
+rapidjson::CrtAllocator g_stack_allocator;
 
 std::string_view AsStringView(const impl::Value& jval) {
   return {jval.GetString(), jval.GetStringLength()};
@@ -85,6 +90,128 @@ impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
   return impl::VersionedValuePtr::Create(std::move(json));
 }
 
+[[noreturn]] void ThrowParseError(std::string_view doc,
+                                  rapidjson::ParseResult ok) {
+  const auto offset = ok.Offset();
+  const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
+  // Some versions of libstdc++ have runtime isues in
+  // string_view::find_last_of("\n", 0, offset) implementation.
+  const auto from_pos = doc.substr(0, offset).find_last_of('\n');
+  const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+
+  throw ParseException(
+      fmt::format("JSON parse error at line {} column {}: {}", line, column,
+                  rapidjson::GetParseError_En(ok.Code())));
+}
+
+constexpr std::size_t kMinArenaChunkCapacity = 1024;
+constexpr std::size_t kMaxArenaChunkCapacity = 64 * 1024;
+
+// The tree is usually larger than the text, as each value takes 16 bytes
+std::size_t GetArenaChunkCapacity(std::string_view doc) {
+  return std::clamp(doc.size() * 2, kMinArenaChunkCapacity,
+                    kMaxArenaChunkCapacity);
+}
+
+// SAX handler that builds the tree the same way rapidjson::GenericDocument
+// does. Arena allocated values must never be destroyed, so unlike
+// GenericDocument the builder drops them without destruction on errors.
+class ArenaTreeBuilder final {
+ public:
+  explicit ArenaTreeBuilder(impl::Allocator allocator) : allocator_(allocator) {
+    stack_.reserve(impl::kInitialStackDepth);
+  }
+
+  ArenaTreeBuilder(const ArenaTreeBuilder&) = delete;
+  ArenaTreeBuilder& operator=(const ArenaTreeBuilder&) = delete;
+
+  ~ArenaTreeBuilder() {
+    for (auto& value : stack_) new (&value) impl::Value{};
+  }
+
+  impl::Value ExtractRoot() {
+    UASSERT(stack_.size() == 1);
+    impl::Value root{std::move(stack_.back())};
+    stack_.pop_back();
+    return root;
+  }
+
+  bool Null() {
+    stack_.emplace_back();
+    return true;
+  }
+  bool Bool(bool b) {
+    stack_.emplace_back(b);
+    return true;
+  }
+  bool Int(int i) {
+    stack_.emplace_back(i);
+    return true;
+  }
+  bool Uint(unsigned i) {
+    stack_.emplace_back(i);
+    return true;
+  }
+  bool Int64(int64_t i) {
+    stack_.emplace_back(i);
+    return true;
+  }
+  bool Uint64(uint64_t i) {
+    stack_.emplace_back(i);
+    return true;
+  }
+  bool Double(double d) {
+    stack_.emplace_back(d);
+    return true;
+  }
+  bool RawNumber(const char*, rapidjson::SizeType, bool) {
+    UASSERT_MSG(false, "kParseNumbersAsStringsFlag is not used");
+    return false;
+  }
+  bool String(const char* str, rapidjson::SizeType length, bool) {
+    stack_.emplace_back(str, length, allocator_);
+    return true;
+  }
+  bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+    return String(str, length, copy);
+  }
+
+  bool StartObject() { return true; }
+  bool EndObject(rapidjson::SizeType member_count) {
+    impl::Value object{rapidjson::kObjectType};
+    if (member_count != 0) {
+      // Members are moved into the reserved storage, nothing is freed
+      object.MemberReserve(member_count, allocator_);
+      const auto first = stack_.size() - member_count * 2;
+      for (auto i = first; i < stack_.size(); i += 2) {
+        object.AddMember(stack_[i], stack_[i + 1], allocator_);
+      }
+      stack_.resize(first);
+    }
+    stack_.push_back(std::move(object));
+    return true;
+  }
+
+  bool StartArray() { return true; }
+  bool EndArray(rapidjson::SizeType element_count) {
+    impl::Value array{rapidjson::kArrayType};
+    if (element_count != 0) {
+      array.Reserve(element_count, allocator_);
+      const auto first = stack_.size() - element_count;
+      for (auto i = first; i < stack_.size(); ++i) {
+        array.PushBack(stack_[i], allocator_);
+      }
+      stack_.resize(first);
+    }
+    stack_.push_back(std::move(array));
+    return true;
+  }
+
+ private:
+  impl::Allocator allocator_;
+  std::vector<impl::Value> stack_;
+};
+
 }  // namespace
 
 Value FromString(std::string_view doc) {
@@ -97,20 +224,35 @@ Value FromString(std::string_view doc) {
       json.Parse<rapidjson::kParseDefaultFlags |
                  rapidjson::kParseIterativeFlag |
                  rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
-  if (!ok) {
-    const auto offset = ok.Offset();
-    const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
-    // Some versions of libstdc++ have runtime isues in
-    // string_view::find_last_of("\n", 0, offset) implementation.
-    const auto from_pos = doc.substr(0, offset).find_last_of('\n');
-    const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+  if (!ok) ThrowParseError(doc, ok);
 
-    throw ParseException(
-        fmt::format("JSON parse error at line {} column {}: {}", line, column,
-                    rapidjson::GetParseError_En(ok.Code())));
+  return Value{EnsureValid(std::move(json))};
+}
+
+Value FromStringWithArena(std::string_view doc) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
   }
 
-  return Value{EnsureValid(std::move(json))};
+  auto arena = std::make_unique<impl::Arena>(GetArenaChunkCapacity(doc));
+  ArenaTreeBuilder builder{impl::Allocator{*arena}};
+  // The root owns the arena from now on and never destroys the values
+  auto root = impl::VersionedValuePtr::Create(std::move(arena));
+
+  rapidjson::MemoryStream memory_stream(doc.data(), doc.size());
+  rapidjson::EncodedInputStream<impl::UTF8, rapidjson::MemoryStream> stream(
+      memory_stream);
+  rapidjson::GenericReader<impl::UTF8, impl::UTF8, rapidjson::CrtAllocator>
+      reader{&g_stack_allocator};
+  rapidjson::ParseResult ok =
+      reader.Parse<rapidjson::kParseDefaultFlags |
+                   rapidjson::kParseIterativeFlag |
+                   rapidjson::kParseFullPrecisionFlag>(stream, builder);
+  if (!ok) ThrowParseError(doc, ok);
+
+  *root = builder.ExtractRoot();
+  CheckKeyUniqueness(root.Get());
+  return Value{std::move(root)};
 }
 
 Value FromStream(std::istream& is) {
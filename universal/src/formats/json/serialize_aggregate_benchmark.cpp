@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/serialize_aggregate.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item {
+  std::string name;
+  std::int64_t count{0};
+  std::optional<double> price;
+};
+
+struct Response {
+  std::vector<Item> items;
+  std::string cursor;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Item> {
+  static constexpr std::string_view kNames[] = {"name", "count", "price"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Response> {
+  static constexpr std::string_view kNames[] = {"items", "cursor"};
+};
+
+namespace {
+
+Response MakeResponse(std::size_t size) {
+  Response response;
+  for (std::size_t i = 0; i < size; ++i) {
+    response.items.push_back(
+        {"item-" + std::to_string(i), static_cast<std::int64_t>(i), 1.5});
+  }
+  response.cursor = "next-page";
+  return response;
+}
+
+formats::json::Value Serialize(const Item& item,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder;
+  builder["name"] = item.name;
+  builder["count"] = item.count;
+  if (item.price) builder["price"] = *item.price;
+  return builder.ExtractValue();
+}
+
+formats::json::Value Serialize(const Response& response,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder;
+  builder["items"] = response.items;
+  builder["cursor"] = response.cursor;
+  return builder.ExtractValue();
+}
+
+std::string ToStringSax(const Response& response) {
+  formats::json::StringBuilder sb;
+  WriteToStream(response, sb);
+  return sb.GetString();
+}
+
+}  // namespace
+
+void JsonAggregateSerializeDom(benchmark::State& state) {
+  const auto response = MakeResponse(state.range(0));
+  for (auto _ : state) {
+    const auto res =
+        formats::json::ToString(formats::json::ValueBuilder{response}
+                                    .ExtractValue());
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonAggregateSerializeDom)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonAggregateSerializeSax(benchmark::State& state) {
+  const auto response = MakeResponse(state.range(0));
+  for (auto _ : state) {
+    const auto res = ToStringSax(response);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonAggregateSerializeSax)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonAggregateParseDom(benchmark::State& state) {
+  const auto input = ToStringSax(MakeResponse(state.range(0)));
+  for (auto _ : state) {
+    const auto res = formats::json::FromString(input).As<Response>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonAggregateParseDom)->RangeMultiplier(4)->Range(1, 1024);
+
+void JsonAggregateParseSax(benchmark::State& state) {
+  const auto input = ToStringSax(MakeResponse(state.range(0)));
+  formats::json::parser::AggregateParser<Response> parser;
+  for (auto _ : state) {
+    Response res;
+    formats::json::parser::SubscriberSink<Response> sink{res};
+    parser.Reset();
+    parser.Subscribe(sink);
+
+    formats::json::parser::ParserState parser_state;
+    parser_state.PushParser(parser);
+    parser_state.ProcessInput(input);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonAggregateParseSax)->RangeMultiplier(4)->Range(1, 1024);
+
+USERVER_NAMESPACE_END
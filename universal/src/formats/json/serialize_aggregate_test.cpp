@@ -0,0 +1,145 @@
+#include <userver/formats/json/serialize_aggregate.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <userver/formats/json/on_demand.hpp>
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item {
+  std::string name;
+  std::optional<std::int64_t> count;
+};
+
+struct Request {
+  std::int32_t id{0};
+  bool flag{false};
+  double ratio{0};
+  std::vector<Item> items;
+  std::map<std::string, std::string> tags;
+  std::optional<Item> extra;
+};
+
+bool operator==(const Item& lhs, const Item& rhs) {
+  return lhs.name == rhs.name && lhs.count == rhs.count;
+}
+
+bool operator==(const Request& lhs, const Request& rhs) {
+  return lhs.id == rhs.id && lhs.flag == rhs.flag && lhs.ratio == rhs.ratio &&
+         lhs.items == rhs.items && lhs.tags == rhs.tags &&
+         lhs.extra == rhs.extra;
+}
+
+}  // namespace
+
+template <>
+struct formats::json::AggregateFieldNames<Item> {
+  static constexpr std::string_view kNames[] = {"name", "count"};
+};
+
+template <>
+struct formats::json::AggregateFieldNames<Request> {
+  static constexpr std::string_view kNames[] = {"id",    "flag", "ratio",
+                                                "items", "tags", "extra"};
+};
+
+namespace {
+
+constexpr std::string_view kJson =
+    R"({"id":42,"flag":true,"ratio":0.5,"items":[{"name":"a","count":1},)"
+    R"({"name":"b"}],"tags":{"k":"v"}})";
+
+const Request kRequest{42, true, 0.5, {{"a", 1}, {"b", std::nullopt}},
+                       {{"k", "v"}}, std::nullopt};
+
+Request ParseSax(std::string_view input) {
+  return formats::json::parser::ParseToType<
+      Request, formats::json::parser::AggregateParser<Request>>(input);
+}
+
+std::string GetSaxError(std::string_view input) {
+  try {
+    ParseSax(input);
+  } catch (const formats::json::parser::ParseError& e) {
+    return e.what();
+  }
+  return {};
+}
+
+}  // namespace
+
+TEST(JsonAggregate, WriteToStream) {
+  formats::json::StringBuilder sb;
+  WriteToStream(kRequest, sb);
+  EXPECT_EQ(sb.GetString(), kJson);
+}
+
+TEST(JsonAggregate, Parse) {
+  EXPECT_EQ(formats::json::FromString(kJson).As<Request>(), kRequest);
+
+  const formats::json::OnDemandDocument doc{kJson};
+  EXPECT_EQ(doc.GetRoot().As<Request>(), kRequest);
+
+  EXPECT_THROW(formats::json::FromString("{}").As<Request>(),
+               formats::json::MemberMissingException);
+}
+
+TEST(JsonAggregate, ParseSax) {
+  EXPECT_EQ(ParseSax(kJson), kRequest);
+
+  auto expected = kRequest;
+  expected.extra = Item{"c", 3};
+  expected.items.clear();
+  EXPECT_EQ(ParseSax(R"({"id":42,"flag":true,"ratio":0.5,"items":[],)"
+                     R"("unknown":[{"x":[1,{}]},null],"tags":{"k":"v"},)"
+                     R"("extra":{"count":3,"name":"c"}})"),
+            expected);
+
+  expected.extra.reset();
+  EXPECT_EQ(ParseSax(R"({"id":42,"flag":true,"ratio":0.5,"items":[],)"
+                     R"("tags":{"k":"v"},"extra":null})"),
+            expected);
+}
+
+TEST(JsonAggregate, ParseSaxErrors) {
+  EXPECT_EQ(GetSaxError(R"({"id":1})"),
+            "Parse error at pos 7, path '': "
+            "Missing required field 'flag'");
+  EXPECT_EQ(GetSaxError(R"({"id":"1"})"),
+            "Parse error at pos 9, path 'id': integer was expected, but "
+            "string found, the latest token was :\"1\"");
+  EXPECT_EQ(GetSaxError(R"({"id":1,"flag":true,"ratio":1,"items":[{}],)"
+                        R"("tags":{}})"),
+            "Parse error at pos 40, path 'items.[0]': "
+            "Missing required field 'name'");
+  EXPECT_EQ(GetSaxError("[]"),
+            "Parse error at pos 0, path '': object was expected, but array "
+            "found");
+}
+
+TEST(JsonAggregate, ParserReuse) {
+  formats::json::parser::AggregateParser<Item> parser;
+  for (const auto* input : {R"({"name":"a","count":1})", R"({"name":"b"})"}) {
+    Item result;
+    formats::json::parser::SubscriberSink<Item> sink{result};
+    parser.Reset();
+    parser.Subscribe(sink);
+
+    formats::json::parser::ParserState state;
+    state.PushParser(parser);
+    state.ProcessInput(input);
+    EXPECT_EQ(result, formats::json::FromString(input).As<Item>());
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -1,3 +1,4 @@
+#include <string>
 #include <string_view>
 
 #include <benchmark/benchmark.h>
@@ -159,6 +160,21 @@ constexpr std::string_view str_width_json =
 
 constexpr std::size_t kDepth = 500;
 
+std::string MakeStringOfWideArray(std::size_t size) {
+  std::string str = "[";
+  for (std::size_t i = 0; i < size; ++i) {
+    if (i != 0) str += ',';
+    str += R"({"id":)" + std::to_string(i) +
+           R"(,"name":"some item name that is long enough","tags":["a","b"]})";
+  }
+  str += "]";
+  return str;
+}
+
+constexpr std::size_t kWideArraySize = 10000;
+
+const std::string str_wide_array_json = MakeStringOfWideArray(kWideArraySize);
+
 const std::string str_deep_json = MakeStringOfDeepObject(kDepth);
 
 // json was generated by json random generator from
@@ -1169,6 +1185,33 @@ void DeepWidthJson(benchmark::State& state) {
   }
 }
 
+// json consists of 10000 objects with 3 fields and a nested array each
+void WideArrayJson(benchmark::State& state) {
+  for (auto _ : state) {
+    auto json = formats::json::FromString(str_wide_array_json);
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+void WideArrayJsonArena(benchmark::State& state) {
+  for (auto _ : state) {
+    auto json = formats::json::FromStringWithArena(str_wide_array_json);
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+template <formats::json::Value (*Parse)(std::string_view)>
+void WideArrayJsonDestroy(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto json = Parse(str_wide_array_json);
+    benchmark::DoNotOptimize(json);
+    state.ResumeTiming();
+
+    json = formats::json::Value{};
+  }
+}
+
 BENCHMARK(SmallJson);
 
 BENCHMARK(MiddleJson);
@@ -1179,6 +1222,18 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+BENCHMARK(WideArrayJson);
+
+BENCHMARK(WideArrayJsonArena);
+
+// Parsing is not measured and takes most of the time, so the iterations count
+// is limited
+BENCHMARK_TEMPLATE(WideArrayJsonDestroy, formats::json::FromString)
+    ->Iterations(200);
+
+BENCHMARK_TEMPLATE(WideArrayJsonDestroy, formats::json::FromStringWithArena)
+    ->Iterations(200);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -63,6 +63,50 @@ TEST(FormatsJson, ParseErrorLineColumnValidation) {
                        "line 2 column 12");
 }
 
+TEST(FormatsJson, FromStringWithArena) {
+  constexpr std::string_view kJson =
+      R"({"a":[1,-2,3.5,"long string that is not inlined"],"b":{"c":null,)"
+      R"("d":true,"e":{}},"f":[],"g":"short"})";
+
+  const auto heap = formats::json::FromString(kJson);
+  auto arena = formats::json::FromStringWithArena(kJson);
+  EXPECT_EQ(arena, heap);
+  EXPECT_EQ(formats::json::ToString(arena), kJson);
+  EXPECT_EQ(arena["a"][3].As<std::string>(), "long string that is not inlined");
+  EXPECT_EQ(arena["b"]["d"].GetPath(), "b.d");
+
+  auto subvalue = arena["a"];
+  arena = {};
+  EXPECT_EQ(subvalue, heap["a"]);
+
+  formats::json::ValueBuilder builder{std::move(subvalue)};
+  builder.PushBack("new element");
+  builder[0] = formats::json::ValueBuilder{formats::json::Type::kObject};
+  EXPECT_EQ(formats::json::ToString(builder.ExtractValue()),
+            R"([{},-2,3.5,"long string that is not inlined","new element"])");
+
+  EXPECT_EQ(formats::json::FromStringWithArena(kJson).Clone(), heap);
+}
+
+TEST(FormatsJson, FromStringWithArenaErrors) {
+  using ParseException = formats::json::ParseException;
+
+  EXPECT_THROW(formats::json::FromStringWithArena(""), ParseException);
+  EXPECT_THROW(formats::json::FromStringWithArena(R"({"a":[1,{"b":"c"},)"),
+               ParseException);
+  EXPECT_THROW(formats::json::FromStringWithArena(R"({"a":{"b":1,"b":2}})"),
+               ParseException);
+
+  try {
+    formats::json::FromStringWithArena("{\n\"foo\":\"bar\":\"buz\"\n}");
+    FAIL() << "Exception was not thrown";
+  } catch (const ParseException& e) {
+    EXPECT_NE(std::string_view{e.what()}.find("line 2 column 12"),
+              std::string_view::npos)
+        << e.what();
+  }
+}
+
 TEST(FormatsJson, ParseFromBadFile) {
   using formats::json::blocking::FromFile;
   using ParseException = formats::json::Value::ParseException;
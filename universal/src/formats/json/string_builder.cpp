@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <utility>
 
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
@@ -21,12 +22,34 @@ namespace formats::json {
 struct StringBuilder::Impl {
   rapidjson::StringBuffer buffer;
   rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+  ChunkConsumer consumer;
+  std::size_t flush_threshold{0};
 
   Impl() = default;
+
+  Impl(ChunkConsumer&& chunk_consumer, std::size_t threshold)
+      : consumer(std::move(chunk_consumer)), flush_threshold(threshold) {}
+
+  void Flush() {
+    if (!consumer || buffer.GetSize() == 0) return;
+
+    std::string chunk{buffer.GetString(), buffer.GetSize()};
+    buffer.Clear();
+    consumer(std::move(chunk));
+  }
+
+  // Called after each written token, so a chunk never ends inside a token
+  void MaybeFlush() {
+    if (consumer && buffer.GetSize() >= flush_threshold) Flush();
+  }
 };
 
 StringBuilder::StringBuilder() = default;
 
+StringBuilder::StringBuilder(ChunkConsumer consumer,
+                             std::size_t flush_threshold)
+    : impl_(std::move(consumer), flush_threshold) {}
+
 StringBuilder::~StringBuilder() = default;
 
 std::string_view StringBuilder::GetStringView() const {
@@ -38,33 +61,58 @@ std::string StringBuilder::GetString() const {
   return std::string{GetStringView()};
 }
 
-void StringBuilder::WriteNull() { impl_->writer.Null(); }
+std::string StringBuilder::ExtractWrittenPart() {
+  auto result = GetString();
+  impl_->buffer.Clear();
+  return result;
+}
+
+void StringBuilder::Flush() { impl_->Flush(); }
+
+void StringBuilder::WriteNull() {
+  impl_->writer.Null();
+  impl_->MaybeFlush();
+}
 
 void StringBuilder::WriteString(std::string_view value) {
   impl_->writer.String(value.data(), value.size());
+  impl_->MaybeFlush();
 }
 
-void StringBuilder::WriteBool(bool value) { impl_->writer.Bool(value); }
+void StringBuilder::WriteBool(bool value) {
+  impl_->writer.Bool(value);
+  impl_->MaybeFlush();
+}
 
-void StringBuilder::WriteInt64(int64_t value) { impl_->writer.Int64(value); }
+void StringBuilder::WriteInt64(int64_t value) {
+  impl_->writer.Int64(value);
+  impl_->MaybeFlush();
+}
 
-void StringBuilder::WriteUInt64(uint64_t value) { impl_->writer.Uint64(value); }
+void StringBuilder::WriteUInt64(uint64_t value) {
+  impl_->writer.Uint64(value);
+  impl_->MaybeFlush();
+}
 
 void StringBuilder::WriteDouble(double value) {
   formats::common::ValidateFloat<std::runtime_error>(value);
   impl_->writer.Double(value);
+  impl_->MaybeFlush();
 }
 
 void StringBuilder::Key(std::string_view sw) {
   impl_->writer.Key(sw.data(), sw.size());
+  impl_->MaybeFlush();
 }
 
 void StringBuilder::WriteRawString(std::string_view value) {
   impl_->writer.RawValue(value.data(), value.size(), {});
+  impl_->MaybeFlush();
 }
 
 void StringBuilder::WriteValue(const formats::json::Value& value) {
   formats::json::AcceptNoRecursion(value.GetNative(), impl_->writer);
+  impl_->MaybeFlush();
 }
 
 void WriteToStream(bool value, StringBuilder& sw) { sw.WriteBool(value); }
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/serialize_duration.hpp>
@@ -218,6 +220,45 @@ TEST(JsonStringBuilder, FilledOptional) {
   EXPECT_EQ(sw.GetString(), "42");
 }
 
+TEST(JsonStringBuilder, ExtractWrittenPart) {
+  StringBuilder sw;
+  std::string result;
+  {
+    StringBuilder::ArrayGuard guard{sw};
+    WriteToStream(1, sw);
+    result += sw.ExtractWrittenPart();
+    EXPECT_EQ(result, "[1");
+    WriteToStream(2, sw);
+  }
+  result += sw.ExtractWrittenPart();
+  EXPECT_EQ(result, "[1,2]");
+  EXPECT_EQ(sw.GetString(), "");
+}
+
+TEST(JsonStringBuilder, ChunkConsumer) {
+  std::vector<std::string> chunks;
+  StringBuilder sw{[&chunks](std::string&& chunk) {
+                     chunks.push_back(std::move(chunk));
+                   },
+                   8};
+  {
+    StringBuilder::ArrayGuard guard{sw};
+    for (int i = 0; i < 5; ++i) {
+      StringBuilder::ObjectGuard object_guard{sw};
+      sw.Key("key");
+      WriteToStream(i, sw);
+    }
+  }
+  sw.Flush();
+  sw.Flush();
+
+  EXPECT_EQ(chunks,
+            (std::vector<std::string>{R"([{"key":0)", R"(},{"key")",
+                                      R"(:1},{"key")", R"(:2},{"key")",
+                                      R"(:3},{"key")", ":4}]"}));
+  EXPECT_EQ(sw.GetString(), "");
+}
+
 template <typename T>
 class JsonStringBuilderIntegralTypes : public ::testing::Test {};
 
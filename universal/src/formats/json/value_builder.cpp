@@ -34,7 +34,7 @@ rapidjson::Type ToNativeType(Type type) {
   }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 }  // namespace
 
@@ -113,8 +113,9 @@ ValueBuilder::ValueBuilder(const formats::json::Value& other) {
 
 ValueBuilder::ValueBuilder(formats::json::Value&& other) {
   // As we have new native object created,
-  // we fill it with the other's native object.
-  if (other.IsUniqueReference())
+  // we fill it with the other's native object. Arena allocated values can not
+  // be modified, so they are always copied.
+  if (other.IsUniqueReference() && !other.root_.IsArenaAllocated())
     value_->GetNative() = std::move(other.GetNative());
   else
     // rapidjson uses move semantics in assignment
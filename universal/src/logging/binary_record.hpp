@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <userver/logging/level.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+// Messages of the loggers with Format::kBinary are sequences of fields:
+//
+//   [uint16 key size][key][uint32 value size][value]
+//
+// Sizes are in the native byte order, keys and values are not escaped. The
+// escaping and the formatting into TSKV is done by the logger consumer, see
+// RenderBinaryAsTskv.
+using BinaryKeySize = std::uint16_t;
+using BinaryValueSize = std::uint32_t;
+
+// Appends the key and reserves the size of the value, returns the offset of
+// the value size to be filled in by FinishBinaryValue
+template <typename Container>
+std::size_t AppendBinaryKey(Container& container, std::string_view key) {
+  const auto key_size = static_cast<BinaryKeySize>(
+      std::min<std::size_t>(key.size(), UINT16_MAX));
+  const auto old_size = container.size();
+  container.resize(old_size + sizeof(key_size) + key_size +
+                   sizeof(BinaryValueSize));
+
+  auto* position = container.data() + old_size;
+  std::memcpy(position, &key_size, sizeof(key_size));
+  position += sizeof(key_size);
+  std::memcpy(position, key.data(), key_size);
+  return old_size + sizeof(key_size) + key_size;
+}
+
+template <typename Container>
+void FinishBinaryValue(Container& container,
+                       std::size_t value_size_offset) noexcept {
+  const auto value_size = container.size() - value_size_offset -
+                          sizeof(BinaryValueSize);
+  const auto size = static_cast<BinaryValueSize>(value_size);
+  std::memcpy(container.data() + value_size_offset, &size, sizeof(size));
+}
+
+// Calls `func(key, value)` for each field, returns false if the message is
+// malformed
+template <typename Func>
+bool ForEachBinaryField(std::string_view message, Func&& func) {
+  while (!message.empty()) {
+    BinaryKeySize key_size{};
+    if (message.size() < sizeof(key_size)) return false;
+    std::memcpy(&key_size, message.data(), sizeof(key_size));
+    message.remove_prefix(sizeof(key_size));
+
+    if (message.size() < key_size + sizeof(BinaryValueSize)) return false;
+    const auto key = message.substr(0, key_size);
+    message.remove_prefix(key_size);
+
+    BinaryValueSize value_size{};
+    std::memcpy(&value_size, message.data(), sizeof(value_size));
+    message.remove_prefix(sizeof(value_size));
+
+    if (message.size() < value_size) return false;
+    func(key, message.substr(0, value_size));
+    message.remove_prefix(value_size);
+  }
+  return true;
+}
+
+// Appends the fields as TSKV pairs, each one prefixed with a tab. Malformed
+// messages, e.g. from logging::LogRaw, are appended as is.
+template <typename Container>
+void RenderBinaryAsTskv(std::string_view message, Container& container) {
+  const auto old_size = container.size();
+  const bool is_valid = ForEachBinaryField(
+      message, [&container](std::string_view key, std::string_view value) {
+        container.push_back(utils::encoding::kTskvPairsSeparator);
+        if (utils::encoding::ShouldKeyBeEscaped(key)) {
+          utils::encoding::EncodeTskv(
+              container, key,
+              utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+        } else {
+          container.append(key.data(), key.data() + key.size());
+        }
+        container.push_back(utils::encoding::kTskvKeyValueSeparator);
+        utils::encoding::EncodeTskv(container, value,
+                                    utils::encoding::EncodeTskvMode::kValue);
+      });
+
+  if (!is_valid) {
+    container.resize(old_size);
+    container.append(message.data(), message.data() + message.size());
+  }
+}
+
+// Records written by the loggers with `binary_records: true` for the offline
+// decoding:
+//
+//   [uint32 size of the rest of the record][uint8 level]
+//   [int64 microseconds since the epoch][message fields]
+template <typename Container>
+void AppendBinaryRecord(Container& container, Level level,
+                        std::chrono::system_clock::time_point time,
+                        std::string_view message) {
+  const auto level_value = static_cast<std::uint8_t>(level);
+  const auto timestamp = static_cast<std::int64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          time.time_since_epoch())
+          .count());
+  const auto record_size = static_cast<std::uint32_t>(
+      sizeof(level_value) + sizeof(timestamp) + message.size());
+
+  const auto old_size = container.size();
+  container.resize(old_size + sizeof(record_size) + record_size);
+
+  auto* position = container.data() + old_size;
+  std::memcpy(position, &record_size, sizeof(record_size));
+  position += sizeof(record_size);
+  std::memcpy(position, &level_value, sizeof(level_value));
+  position += sizeof(level_value);
+  std::memcpy(position, &timestamp, sizeof(timestamp));
+  position += sizeof(timestamp);
+  std::memcpy(position, message.data(), message.size());
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
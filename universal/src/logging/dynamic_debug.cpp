@@ -42,6 +42,14 @@ bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
 
 void AddDynamicDebugLog(const std::string& location_relative, int line,
                         EntryState state) {
+  ForEachLogLocation(location_relative, line,
+                     [state](LogEntryContent& location) {
+                       location.state = state;
+                     });
+}
+
+void ForEachLogLocation(const std::string& location_relative, int line,
+                        const std::function<void(LogEntryContent&)>& func) {
   utils::impl::AssertStaticRegistrationFinished();
 
   auto& all_locations = GetAllLocations();
@@ -58,14 +66,14 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
       ThrowUnknownDynamicLogLocation(location_relative, line);
     }
 
-    it_lower->state = state;
+    func(*it_lower);
     return;
   } else {
     for (; it_lower != all_locations.end(); ++it_lower) {
       if (std::strncmp(it_lower->path, location_relative.c_str(),
                        location_relative.size()) != 0)
         break;
-      it_lower->state = state;
+      func(*it_lower);
     }
   }
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <functional>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
@@ -33,6 +35,9 @@ struct LogEntryContent {
   const int line;
   const char* const path;
   LogEntryContentHook hook;
+  // kLevelSamplingRatio or the ratio of messages to keep, see log_sampling.hpp
+  std::atomic<double> sampling_ratio{-1.0};
+  mutable std::atomic<std::uint64_t> sampled_out{0};
 };
 
 bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept;
@@ -55,6 +60,11 @@ void RemoveDynamicDebugLog(const std::string& location_relative, int line);
 
 const LogEntryContentSet& GetDynamicDebugLocations();
 
+/// Calls `func` for the locations with the `location_relative` path prefix
+/// and the `line`, or any line for kAnyLine. Throws if there are none.
+void ForEachLogLocation(const std::string& location_relative, int line,
+                        const std::function<void(LogEntryContent&)>& func);
+
 void RegisterLogLocation(LogEntryContent& location);
 
 }  // namespace logging
@@ -24,6 +24,10 @@ bool LoggerBase::ShouldLog(Level level) const noexcept {
   return ShouldLogNoSpan(*this, level);
 }
 
+std::optional<std::uint64_t> LoggerBase::GetSamplingKey() const noexcept {
+  return std::nullopt;
+}
+
 void LoggerBase::SetFlushOn(Level level) { flush_level_ = level; }
 
 bool LoggerBase::ShouldFlush(Level level) const {
@@ -3,6 +3,7 @@
 #include <utility>
 
 #include <logging/dynamic_debug.hpp>
+#include <logging/log_sampling.hpp>
 #include <logging/rate_limit.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/null_logger.hpp>
@@ -151,7 +152,9 @@ bool StaticLogEntry::ShouldNotLog(logging::LoggerRef logger,
   const bool force_disabled =
       level < Level::kWarning && state == EntryState::kForceDisabled;
   const bool force_enabled = state == EntryState::kForceEnabled;
-  return (!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled;
+  if (force_enabled) return false;
+  return !LoggerShouldLog(logger, level) || force_disabled ||
+         IsSampledOut(content, logger, level);
 }
 
 bool StaticLogEntry::ShouldNotLog(const logging::LoggerPtr& logger,
@@ -4,6 +4,8 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
+#include <logging/binary_record.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging {
@@ -14,6 +16,7 @@ char GetSeparatorFromLogger(LoggerRef logger) {
   switch (logger.GetFormat()) {
     case Format::kTskv:
     case Format::kRaw:
+    case Format::kBinary:
       return '=';
     case Format::kLtsv:
       return ':';
@@ -39,7 +42,8 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(level),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(*logger_)),
+      is_binary_(logger_->GetFormat() == Format::kBinary) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
                 "8KB memory in allocator.");
@@ -49,7 +53,7 @@ LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
 }
 
 void LogHelper::Impl::PutKey(std::string_view key) {
-  if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+  if (is_binary_ || !utils::encoding::ShouldKeyBeEscaped(key)) {
     PutRawKey(key);
   } else {
     UASSERT(!std::exchange(is_within_value_, true));
@@ -64,6 +68,11 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 void LogHelper::Impl::PutRawKey(std::string_view key) {
   UASSERT(!std::exchange(is_within_value_, true));
   CheckRepeatedKeys(key);
+  if (is_binary_) {
+    binary_value_size_offset_ = impl::AppendBinaryKey(msg_, key);
+    return;
+  }
+
   const auto old_size = msg_.size();
   msg_.resize(old_size + 1 + key.size() + 1);
 
@@ -76,12 +85,20 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    msg_.append(value);
+    return;
+  }
   utils::encoding::EncodeTskv(msg_, value,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    msg_.push_back(text_part);
+    return;
+  }
   utils::encoding::EncodeTskv(fmt::appender(msg_), text_part,
                               utils::encoding::EncodeTskvMode::kValue);
 }
@@ -93,6 +110,7 @@ LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
 
 void LogHelper::Impl::MarkValueEnd() noexcept {
   UASSERT(std::exchange(is_within_value_, false));
+  if (is_binary_) impl::FinishBinaryValue(msg_, binary_value_size_offset_);
 }
 
 void LogHelper::Impl::StartText() {
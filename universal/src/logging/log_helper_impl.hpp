@@ -80,6 +80,10 @@ class LogHelper::Impl final {
   impl::LoggerBase* logger_;
   const Level level_;
   const char key_value_separator_;
+  // Tags are not escaped for Format::kBinary, see logging/binary_record.hpp
+  const bool is_binary_;
+  // Offset of the size of the current value for Format::kBinary
+  std::size_t binary_value_size_offset_{0};
   LogBuffer msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
@@ -0,0 +1,106 @@
+#include <logging/log_sampling.hpp>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+namespace {
+
+constexpr auto kLevelsCount = static_cast<std::size_t>(Level::kNone) + 1;
+
+struct LevelRatio final {
+  std::atomic<double> ratio{1.0};
+};
+
+auto& GetLevelRatios() noexcept {
+  static std::array<LevelRatio, kLevelsCount> ratios{};
+  return ratios;
+}
+
+// Counts the levels and locations with a ratio below 1, so that the
+// sampling costs a single load while it is not used
+std::atomic<std::size_t> sampled_entries_count{0};
+
+void ValidateRatio(double ratio) {
+  if (!(ratio >= 0.0 && ratio <= 1.0)) {
+    throw std::runtime_error(
+        fmt::format("Log sampling ratio should be in [0, 1], got {}", ratio));
+  }
+}
+
+bool IsSampled(double ratio) noexcept {
+  return ratio >= 0.0 && ratio < 1.0;
+}
+
+void StoreRatio(std::atomic<double>& stored_ratio, double ratio) noexcept {
+  const auto old_ratio = stored_ratio.exchange(ratio);
+  if (IsSampled(old_ratio) && !IsSampled(ratio)) {
+    sampled_entries_count.fetch_sub(1);
+  } else if (!IsSampled(old_ratio) && IsSampled(ratio)) {
+    sampled_entries_count.fetch_add(1);
+  }
+}
+
+// [0, 1) from the whole range of the key
+double ToUnitInterval(std::uint64_t key) noexcept {
+  constexpr double kScale = 1.0 / static_cast<double>(std::uint64_t{1} << 53);
+  return static_cast<double>(key >> 11) * kScale;
+}
+
+}  // namespace
+
+void SetLevelSamplingRatio(Level level, double ratio) {
+  ValidateRatio(ratio);
+  StoreRatio(GetLevelRatios()[static_cast<std::size_t>(level)].ratio, ratio);
+}
+
+void SetLocationSamplingRatio(const std::string& location_relative, int line,
+                              double ratio) {
+  ValidateRatio(ratio);
+  ForEachLogLocation(location_relative, line,
+                     [ratio](LogEntryContent& location) {
+                       StoreRatio(location.sampling_ratio, ratio);
+                     });
+}
+
+void ResetLogSampling() {
+  for (auto& level_ratio : GetLevelRatios()) {
+    StoreRatio(level_ratio.ratio, 1.0);
+  }
+  ForEachLogLocation("", kAnyLine, [](LogEntryContent& location) {
+    StoreRatio(location.sampling_ratio, kLevelSamplingRatio);
+  });
+}
+
+bool IsSampledOut(const LogEntryContent& location,
+                  const impl::LoggerBase& logger, Level level) noexcept {
+  if (sampled_entries_count.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  auto ratio = location.sampling_ratio.load(std::memory_order_relaxed);
+  if (ratio < 0.0) {
+    ratio = GetLevelRatios()[static_cast<std::size_t>(level)].ratio.load(
+        std::memory_order_relaxed);
+  }
+  if (ratio >= 1.0) return false;
+
+  const auto key = logger.GetSamplingKey();
+  const auto value = key ? ToUnitInterval(*key) : utils::RandRange(1.0);
+  if (value < ratio) return false;
+
+  location.sampled_out.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
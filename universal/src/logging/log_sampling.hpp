@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+
+#include <logging/dynamic_debug.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+// The sampling ratio of a location that follows the ratio of the level
+inline constexpr double kLevelSamplingRatio = -1.0;
+
+// Messages of the level are kept with the probability of `ratio`, 1 keeps all
+void SetLevelSamplingRatio(Level level, double ratio);
+
+// Overrides the level ratio for the locations, see ForEachLogLocation
+void SetLocationSamplingRatio(const std::string& location_relative, int line,
+                              double ratio);
+
+// Keeps all the messages of all levels and locations
+void ResetLogSampling();
+
+// The decision is made before the message is formatted. Inside of a trace
+// it depends only on impl::LoggerBase::GetSamplingKey(), so all the messages
+// of a request with the same ratio are either kept or dropped together.
+bool IsSampledOut(const LogEntryContent& location,
+                  const impl::LoggerBase& logger, Level level) noexcept;
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
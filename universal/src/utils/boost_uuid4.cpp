@@ -1,8 +1,9 @@
 #include <userver/utils/boost_uuid4.hpp>
 
 #include <array>
+#include <cstdint>
+#include <cstring>
 
-#include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
@@ -105,9 +106,26 @@ boost::uuids::uuid FromChars(const char* begin, const char* end) {
 namespace generators {
 
 boost::uuids::uuid GenerateBoostUuid() {
-  thread_local boost::uuids::basic_random_generator<RandomBase> generator(
-      DefaultRandom());
-  return generator();
+  const std::array<std::uint64_t, 2> random{Rand64(), Rand64()};
+
+  boost::uuids::uuid uuid;
+  static_assert(sizeof(uuid.data) == sizeof(random));
+  std::memcpy(uuid.data, random.data(), sizeof(random));
+
+  // Variant and version bits, set the same way boost::uuids::random_generator
+  // sets them
+  uuid.data[8] = (uuid.data[8] & 0xbf) | 0x80;
+  uuid.data[6] = (uuid.data[6] & 0x4f) | 0x40;
+  return uuid;
+}
+
+std::vector<boost::uuids::uuid> GenerateBoostUuids(std::size_t count) {
+  std::vector<boost::uuids::uuid> uuids;
+  uuids.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    uuids.push_back(GenerateBoostUuid());
+  }
+  return uuids;
 }
 
 }  // namespace generators
@@ -1,5 +1,6 @@
 #include <userver/utils/boost_uuid4.hpp>
 
+#include <set>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -57,4 +58,17 @@ TEST(UUID, ParseFail) {
   }
 }
 
+TEST(UUID, BoostVersionAndVariant) {
+  for (const auto& id : utils::generators::GenerateBoostUuids(100)) {
+    EXPECT_EQ(id.version(), boost::uuids::uuid::version_random_number_based);
+    EXPECT_EQ(id.variant(), boost::uuids::uuid::variant_rfc_4122);
+  }
+}
+
+TEST(UUID, BoostBulk) {
+  const auto ids = utils::generators::GenerateBoostUuids(100);
+  ASSERT_EQ(ids.size(), 100u);
+  EXPECT_EQ(std::set(ids.begin(), ids.end()).size(), ids.size());
+}
+
 USERVER_NAMESPACE_END
@@ -2,7 +2,9 @@
 
 #include <array>
 #include <ctime>
+#include <cstdint>
 #include <optional>
+#include <string_view>
 
 #include <sys/param.h>
 
@@ -44,9 +46,133 @@ const cctz::time_zone& GetLocalTimezone() {
   return kLocalTz;
 }
 
+constexpr std::string_view kZuluFractionalFormat = "%Y-%m-%dT%H:%M:%E*SZ";
+
+// Formats with the fixed "YYYY-MM-DDTHH:MM:SS" layout and the explicit UTC
+// offset, the timezone does not matter for them.
+struct FixedLayout final {
+  // %E*S instead of %S
+  bool has_fraction{false};
+  enum class Offset {
+    kZulu,     // 'Z' literal
+    kNumeric,  // %z, 'Z' or +hhmm
+    kRfc3339,  // %Ez, 'Z', +hhmm or +hh:mm
+  } offset{Offset::kZulu};
+};
+
+std::optional<FixedLayout> GetFixedLayout(std::string_view format) noexcept {
+  using Offset = FixedLayout::Offset;
+  if (format == kRfc3339Format) return FixedLayout{true, Offset::kRfc3339};
+  if (format == kDefaultFormat) return FixedLayout{true, Offset::kNumeric};
+  if (format == kIsoFormat) return FixedLayout{false, Offset::kZulu};
+  if (format == kZuluFractionalFormat) return FixedLayout{true, Offset::kZulu};
+  return {};
+}
+
+bool ParseDigits(std::string_view str, std::size_t pos, std::size_t count,
+                 int& result) noexcept {
+  if (str.size() < pos + count) return false;
+
+  result = 0;
+  for (std::size_t i = pos; i < pos + count; ++i) {
+    const auto digit = static_cast<unsigned char>(str[i] - '0');
+    if (digit > 9) return false;
+    result = result * 10 + digit;
+  }
+  return true;
+}
+
+// +hhmm or +hh:mm, cctz also accepts +hh and seconds in the offsets
+std::optional<int> ParseOffsetMinutes(std::string_view offset,
+                                      bool allow_colon) noexcept {
+  const bool has_colon = allow_colon && offset.size() == 6 && offset[3] == ':';
+  int hours = 0;
+  int minutes = 0;
+  if (offset.size() != (has_colon ? 6 : 5) ||
+      (offset[0] != '+' && offset[0] != '-') ||
+      !ParseDigits(offset, 1, 2, hours) ||
+      !ParseDigits(offset, has_colon ? 4 : 3, 2, minutes) || hours > 23 ||
+      minutes > 59) {
+    return {};
+  }
+
+  const int result = hours * 60 + minutes;
+  return offset[0] == '-' ? -result : result;
+}
+
+// Parses the strings that cctz::parse would parse into the same time point.
+// Returns std::nullopt for anything else (leap seconds, whitespaces, unusual
+// years, invalid dates...), cctz::parse decides on them.
+std::optional<std::chrono::system_clock::time_point> TryParseFixedLayout(
+    std::string_view str, FixedLayout layout) noexcept {
+  int year = 0;
+  int month = 0;
+  int day = 0;
+  int hour = 0;
+  int minute = 0;
+  int second = 0;
+  if (str.size() < 20 || !ParseDigits(str, 0, 4, year) || str[4] != '-' ||
+      !ParseDigits(str, 5, 2, month) || str[7] != '-' ||
+      !ParseDigits(str, 8, 2, day) || str[10] != 'T' ||
+      !ParseDigits(str, 11, 2, hour) || str[13] != ':' ||
+      !ParseDigits(str, 14, 2, minute) || str[16] != ':' ||
+      !ParseDigits(str, 17, 2, second)) {
+    return {};
+  }
+
+  // cctz silently overflows the nanoseconds time point outside of ~1678-2262
+  if (year < 1900 || year > 2200 || month < 1 || month > 12 || day < 1 ||
+      day > 31 || hour > 23 || minute > 59 || second > 59) {
+    return {};
+  }
+
+  std::size_t pos = 19;
+  std::chrono::nanoseconds fraction{0};
+  if (layout.has_fraction && str[pos] == '.') {
+    const auto fraction_begin = ++pos;
+    std::int64_t nanoseconds = 0;
+    while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9') {
+      // cctz truncates the digits after the precision of the time point
+      if (pos - fraction_begin < 9) {
+        nanoseconds = nanoseconds * 10 + (str[pos] - '0');
+      }
+      ++pos;
+    }
+    if (pos == fraction_begin) return {};
+    for (auto i = pos - fraction_begin; i < 9; ++i) nanoseconds *= 10;
+    fraction = std::chrono::nanoseconds{nanoseconds};
+  }
+
+  using Offset = FixedLayout::Offset;
+  const auto offset = str.substr(pos);
+  std::optional<int> offset_minutes;
+  if (offset == "Z" || (offset == "z" && layout.offset != Offset::kZulu)) {
+    offset_minutes = 0;
+  } else if (layout.offset != Offset::kZulu) {
+    offset_minutes =
+        ParseOffsetMinutes(offset, layout.offset == Offset::kRfc3339);
+  }
+  if (!offset_minutes) return {};
+
+  const cctz::civil_second civil{year, month, day, hour, minute, second};
+  // "Sep 31" is normalized by cctz into "Oct 1", cctz::parse rejects it
+  if (civil.day() != day) return {};
+
+  using Duration = std::chrono::system_clock::duration;
+  const auto seconds = std::chrono::seconds{civil - cctz::civil_second{}} -
+                       std::chrono::minutes{*offset_minutes};
+  return std::chrono::system_clock::time_point{
+             std::chrono::duration_cast<Duration>(seconds)} +
+         std::chrono::duration_cast<Duration>(fraction);
+}
+
 std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
     const std::string& timestring, const cctz::time_zone& timezone,
     const std::string& format) {
+  if (const auto layout = GetFixedLayout(format)) {
+    if (const auto tp = TryParseFixedLayout(timestring, *layout)) return tp;
+  }
+
   std::chrono::system_clock::time_point tp;
   if (cctz::parse(format, timestring, timezone, &tp)) {
     return tp;
@@ -56,9 +182,9 @@ std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
 
 std::chrono::system_clock::time_point DoGuessStringtime(
     const std::string& timestring, const cctz::time_zone& timezone) {
-  static const std::array<std::string, 3> formats{{"%Y-%m-%dT%H:%M:%E*S%Ez",
-                                                   "%Y-%m-%dT%H:%M:%E*S%z",
-                                                   "%Y-%m-%dT%H:%M:%E*SZ"}};
+  static const std::array<std::string, 3> formats{
+      {"%Y-%m-%dT%H:%M:%E*S%Ez", "%Y-%m-%dT%H:%M:%E*S%z",
+       std::string{kZuluFractionalFormat}}};
   for (const auto& format : formats) {
     const auto optional_tp = OptionalStringtime(timestring, timezone, format);
     if (optional_tp) {
@@ -0,0 +1,53 @@
+#include <userver/utils/datetime.hpp>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void StringtimeImpl(benchmark::State& state, const std::string& timestring,
+                    const std::string& format) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        utils::datetime::Stringtime(timestring, "UTC", format));
+  }
+}
+
+}  // namespace
+
+void StringtimeRfc3339(benchmark::State& state) {
+  StringtimeImpl(state, "2023-11-15T01:13:20.123456+03:00",
+                 utils::datetime::kRfc3339Format);
+}
+BENCHMARK(StringtimeRfc3339);
+
+void StringtimeDefault(benchmark::State& state) {
+  StringtimeImpl(state, "2023-11-14T22:13:20.5Z",
+                 utils::datetime::kDefaultFormat);
+}
+BENCHMARK(StringtimeDefault);
+
+void StringtimeIso(benchmark::State& state) {
+  StringtimeImpl(state, "2023-11-14T22:13:20Z", utils::datetime::kIsoFormat);
+}
+BENCHMARK(StringtimeIso);
+
+// Goes through cctz::parse
+void StringtimeCustomFormat(benchmark::State& state) {
+  StringtimeImpl(state, "14.11.2023 22:13:20", "%d.%m.%Y %H:%M:%S");
+}
+BENCHMARK(StringtimeCustomFormat);
+
+void GuessStringtime(benchmark::State& state) {
+  const std::string timestring = "2023-11-14T22:13:20.5Z";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        utils::datetime::GuessStringtime(timestring, "UTC"));
+  }
+}
+BENCHMARK(GuessStringtime);
+
+USERVER_NAMESPACE_END
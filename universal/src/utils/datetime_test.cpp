@@ -0,0 +1,91 @@
+#include <userver/utils/datetime.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using utils::datetime::Stringtime;
+
+const auto kTimePoint = std::chrono::system_clock::from_time_t(1700000000);
+
+}  // namespace
+
+TEST(Datetime, StringtimeRfc3339) {
+  using utils::datetime::kRfc3339Format;
+
+  EXPECT_EQ(Stringtime("2023-11-14T22:13:20Z", "UTC", kRfc3339Format),
+            kTimePoint);
+  EXPECT_EQ(Stringtime("2023-11-15T01:13:20+03:00", "UTC", kRfc3339Format),
+            kTimePoint);
+  EXPECT_EQ(Stringtime("2023-11-14T20:43:20.5-0130", "UTC", kRfc3339Format),
+            kTimePoint + 500ms);
+  EXPECT_EQ(Stringtime("2023-11-14T22:13:20.123456789123Z", "UTC",
+                       kRfc3339Format),
+            kTimePoint + 123456789ns);
+
+  // Not the fixed layout, parsed by cctz
+  EXPECT_EQ(Stringtime("2023-11-15T01:13:20+03", "UTC", kRfc3339Format),
+            kTimePoint);
+  EXPECT_EQ(Stringtime("  2023-11-14T22:13:20Z", "UTC", kRfc3339Format),
+            kTimePoint);
+  EXPECT_EQ(Stringtime("2016-12-31T23:59:60Z", "UTC", kRfc3339Format),
+            std::chrono::system_clock::from_time_t(1483228800));
+}
+
+TEST(Datetime, StringtimeDefaultAndIso) {
+  using utils::datetime::kIsoFormat;
+
+  EXPECT_EQ(Stringtime("2023-11-15T01:13:20.25+0300"), kTimePoint + 250ms);
+  EXPECT_EQ(Stringtime("2023-11-14T22:13:20z"), kTimePoint);
+  EXPECT_EQ(Stringtime("2023-11-14T22:13:20Z", "UTC", kIsoFormat), kTimePoint);
+  EXPECT_EQ(Stringtime("1969-12-31T23:59:59.75Z"),
+            std::chrono::system_clock::from_time_t(0) - 250ms);
+
+  // The timezone is not used for the formats with the UTC offset, but it is
+  // still checked
+  EXPECT_EQ(Stringtime("2023-11-14T22:13:20Z", "Europe/Moscow"), kTimePoint);
+  EXPECT_THROW(Stringtime("2023-11-14T22:13:20Z", "Not/A_Timezone"),
+               utils::datetime::TimezoneLookupError);
+}
+
+TEST(Datetime, StringtimeInvalid) {
+  using utils::datetime::kIsoFormat;
+  using utils::datetime::kRfc3339Format;
+
+  for (const auto* timestring : {
+           "2023-02-29T00:00:00Z",
+           "2023-13-01T00:00:00Z",
+           "2023-01-01T24:00:00Z",
+           "2023-01-01T00:00:00",
+           "2023-01-01T00:00:00.Z",
+           "2023-01-01T00:00:00+03:00junk",
+           "2023-01-01 00:00:00Z",
+       }) {
+    EXPECT_THROW(Stringtime(timestring, "UTC", kRfc3339Format),
+                 utils::datetime::DateParseError)
+        << timestring;
+  }
+
+  EXPECT_THROW(Stringtime("2023-01-01T00:00:00+03:00"),
+               utils::datetime::DateParseError);
+  EXPECT_THROW(Stringtime("2023-01-01T00:00:00.5Z", "UTC", kIsoFormat),
+               utils::datetime::DateParseError);
+  EXPECT_THROW(Stringtime("2023-01-01T00:00:00+0000", "UTC", kIsoFormat),
+               utils::datetime::DateParseError);
+}
+
+TEST(Datetime, GuessStringtime) {
+  using utils::datetime::GuessStringtime;
+
+  EXPECT_EQ(GuessStringtime("2023-11-15T01:13:20+03:00", "UTC"), kTimePoint);
+  EXPECT_EQ(GuessStringtime("2023-11-14T22:13:20.5Z", "UTC"),
+            kTimePoint + 500ms);
+  EXPECT_THROW(GuessStringtime("2023-11-14", "UTC"),
+               utils::datetime::DateParseError);
+}
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,9 @@
 #include <stdexcept>
 #include <string_view>
 
-#ifdef __SSSE3__
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
 #include <tmmintrin.h>
 #endif
 
@@ -109,6 +111,36 @@ bool IsXDigit(unsigned char x_digit) noexcept {
 const auto kLow4BitsMask = _mm_set1_epi8(0xf);
 const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+/// Converts 16 hex digits into 8 bytes, returns false if some of the chars
+/// are not hex digits
+bool FromHex16(const char* in, char* out) noexcept {
+  const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  const auto in_range = [](__m128i value, char first, char last) {
+    return _mm_and_si128(_mm_cmpgt_epi8(value, _mm_set1_epi8(first - 1)),
+                         _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), value));
+  };
+
+  const auto is_digit = in_range(chars, '0', '9');
+  // 'A'-'F' are converted to 'a'-'f'
+  const auto lowered = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+  const auto is_letter = in_range(lowered, 'a', 'f');
+  if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) {
+    return false;
+  }
+
+  const auto digits =
+      _mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0')));
+  const auto letters =
+      _mm_and_si128(is_letter, _mm_sub_epi8(lowered, _mm_set1_epi8('a' - 10)));
+
+  // each pair of nibbles (high, low) becomes high * 16 + low
+  const auto words = _mm_maddubs_epi16(_mm_or_si128(digits, letters),
+                                       _mm_set1_epi16(0x0110));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(out),
+                   _mm_packus_epi16(words, words));
+  return true;
+}
 #endif
 
 }  // namespace detail
@@ -134,9 +166,33 @@ std::string_view GetHexPart(std::string_view encoded) noexcept {
 void ToHex(std::string_view input, std::string& out) noexcept {
   out.clear();
   out.resize(input.size() * 2);
+  ToHexChars(input, out.data());
+}
+
+void ToHexChars(std::string_view input, char* out) noexcept {
   const auto* first = input.data();
   const auto* last = input.data() + input.size();
-  auto* dst = out.data();
+  auto* dst = out;
+
+#ifdef __AVX2__
+  const auto digits_mask = _mm256_broadcastsi128_si256(detail::kDigitsMask);
+  while (last - first >= 16) {
+    // same as the SSSE3 loop below, but the interleaved nibbles of 16 bytes
+    // are looked up at once
+    const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    const auto high =
+        _mm_and_si128(_mm_srli_epi64(data, 4), detail::kLow4BitsMask);
+    const auto low = _mm_and_si128(data, detail::kLow4BitsMask);
+    const auto interleaving_hi_lo = _mm256_set_m128i(
+        _mm_unpackhi_epi8(high, low), _mm_unpacklo_epi8(high, low));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),
+                        _mm256_shuffle_epi8(digits_mask, interleaving_hi_lo));
+
+    first += 16;
+    dst += 32;
+  }
+#endif
 
 #ifdef __SSSE3__
   while (last - first >= 8) {
@@ -190,6 +246,20 @@ size_t FromHex(std::string_view encoded, std::string& out) noexcept {
   const char* first = encoded.data();
   const char* pair_ptr = first;
   const char* last = first + encoded.size();
+
+  const auto old_size = out.size();
+  out.resize(old_size + FromHexUpperBound(encoded.size()));
+  auto* dst = out.data() + old_size;
+
+#ifdef __SSSE3__
+  while (last - pair_ptr >= 16) {
+    // the scalar loop below finds the exact end of hex data
+    if (!detail::FromHex16(pair_ptr, dst)) break;
+    pair_ptr += 16;
+    dst += 8;
+  }
+#endif
+
   for (; pair_ptr != last; pair_ptr += 2) {
     if (!detail::IsXDigit(pair_ptr[0])) {
       break;
@@ -203,10 +273,11 @@ size_t FromHex(std::string_view encoded, std::string& out) noexcept {
       break;
     }
 
-    out.push_back((detail::GetXDigitValue(pair_ptr[0]) << 4) |
-                  (detail::GetXDigitValue(pair_ptr[1])));
+    *(dst++) = (detail::GetXDigitValue(pair_ptr[0]) << 4) |
+               (detail::GetXDigitValue(pair_ptr[1]));
   }
 
+  out.resize(dst - out.data());
   return static_cast<size_t>(std::distance(first, pair_ptr));
 }
 
@@ -2,6 +2,7 @@
 
 #include <userver/utils/encoding/hex.hpp>
 
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -42,4 +43,29 @@ void to_hex_benchmark_no_alloc(benchmark::State& state) {
 }
 BENCHMARK(to_hex_benchmark_no_alloc)->RangeMultiplier(2)->Range(8, 512);
 
+void to_hex_benchmark_large(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+  std::string out;
+
+  for (auto _ : state) {
+    utils::encoding::ToHex(source, out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(to_hex_benchmark_large)->RangeMultiplier(16)->Range(4096, 1 << 20);
+
+void from_hex_benchmark(benchmark::State& state) {
+  const auto hex = utils::encoding::ToHex(GenerateSource(state.range(0)));
+  std::string out;
+  out.reserve(state.range(0));
+
+  for (auto _ : state) {
+    out.clear();
+    benchmark::DoNotOptimize(utils::encoding::FromHex(hex, out));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(from_hex_benchmark)->RangeMultiplier(16)->Range(8, 1 << 20);
+
 USERVER_NAMESPACE_END
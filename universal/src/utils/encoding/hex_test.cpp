@@ -39,6 +39,17 @@ TEST(Hex, ToHexLong) {
   EXPECT_EQ(reference, result);
 }
 
+TEST(Hex, ToHexChars) {
+  constexpr std::string_view data{"21e30c92afe54396_+=156"};
+  constexpr std::string_view reference{
+      "32316533306339326166653534333936"
+      "5f2b3d313536"};
+  std::string result(reference.size() + 1, '!');
+  ToHexChars(data, result.data());
+  EXPECT_EQ(std::string_view(result).substr(0, reference.size()), reference);
+  EXPECT_EQ(result.back(), '!');
+}
+
 TEST(Hex, FromHex) {
   // Test simple case - everything is correct
   {
@@ -138,6 +149,34 @@ TEST(Hex, GetHexPart) {
   }
 }
 
+TEST(Hex, RoundtripLong) {
+  std::string data;
+  for (int i = 0; i < 300; ++i) {
+    data.push_back(static_cast<char>(i * 13));
+    const auto hex = ToHex(data);
+    ASSERT_EQ(hex.size(), data.size() * 2);
+
+    std::string result;
+    EXPECT_EQ(FromHex(hex, result), hex.size());
+    EXPECT_EQ(result, data);
+  }
+}
+
+TEST(Hex, FromHexLongMixedCase) {
+  const std::string data{"0123456789abcdefABCDEF0123456789aBcDeF0123456789"};
+  std::string result;
+  EXPECT_EQ(FromHex(data, result), data.size());
+  EXPECT_EQ(ToHex(result), "0123456789abcdefabcdef0123456789abcdef0123456789");
+
+  for (std::size_t pos = 0; pos < data.size(); ++pos) {
+    auto broken = data;
+    broken[pos] = 'g';
+    result.clear();
+    EXPECT_EQ(FromHex(broken, result), pos / 2 * 2);
+    EXPECT_EQ(ToHex(result), ToHex(FromHex(data.substr(0, pos / 2 * 2))));
+  }
+}
+
 }  // namespace utils::encoding
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/filter_bloom.hpp>
 
+#include <limits>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -71,6 +72,13 @@ TEST(FilterBloom, SmallCounterSize) {
   }
 }
 
+TEST(FilterBloom, CounterSaturation) {
+  utils::FilterBloom<int, uint8_t> filter(64);
+  for (std::size_t i = 0; i < 300; ++i) filter.Increment(1);
+  EXPECT_EQ(filter.Estimate(1), std::numeric_limits<uint8_t>::max());
+  EXPECT_TRUE(filter.Has(1));
+}
+
 TEST(FilterBloom, HasValue) {
   utils::FilterBloom<float, uint8_t> filter(32);
   for (std::size_t i = 0; i < 5; ++i) {
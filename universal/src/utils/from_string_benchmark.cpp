@@ -28,4 +28,20 @@ BENCHMARK_TEMPLATE(ConstFromString, std::uint32_t)->DenseRange(1, 10, 1);
 BENCHMARK_TEMPLATE(ConstFromString, std::uint16_t)->DenseRange(1, 5, 1);
 BENCHMARK_TEMPLATE(ConstFromString, double)->DenseRange(1, 10, 1);
 
+template <typename T>
+void TypicalFloatingPointFromString(benchmark::State& state) {
+  const std::string inputs[] = {"0.5",         "-12.25",   "3.14159265358979",
+                                "1e-7",        "6.02e23",  "100",
+                                "-0.00012345", "98765.4321"};
+
+  for (auto _ : state) {
+    for (const auto& input : inputs) {
+      benchmark::DoNotOptimize(utils::FromString<T>(input));
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(TypicalFloatingPointFromString, float);
+BENCHMARK_TEMPLATE(TypicalFloatingPointFromString, double);
+
 USERVER_NAMESPACE_END
@@ -156,6 +156,19 @@ TYPED_TEST(FromStringTest, NonDecimal) {
   }
 }
 
+TYPED_TEST(FromStringTest, Subnormal) {
+  using T = TypeParam;
+
+  if constexpr (std::is_floating_point_v<T>) {
+    // strtod reports ERANGE for subnormals, std::from_chars does not
+    const auto subnormal = std::numeric_limits<T>::denorm_min();
+    TestInvalid<T>(ToString(subnormal));
+    TestInvalid<T>(ToString(-subnormal));
+    TestInvalid<T>("1e-100000");
+    TestConverts("0.000", T{0});
+  }
+}
+
 TYPED_TEST(FromStringTest, ExtraSpaces) {
   using T = TypeParam;
 
@@ -318,6 +318,123 @@ std::uint64_t SipHash13(std::uint64_t k0, std::uint64_t k1,
   return v0 ^ v1 ^ v2 ^ v3;
 }
 
+// Lowercases the 'A' - 'Z' bytes of v, other bytes are left intact.
+constexpr std::uint64_t LowercaseSwar(std::uint64_t v) noexcept {
+  constexpr std::uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr std::uint64_t kHighBits = kOnes * 0x80;
+
+  // No carry between the bytes: 0x7f + (0x80 - 'A') < 0x100
+  const std::uint64_t heptets = v & (kOnes * 0x7f);
+  const std::uint64_t ge_a = heptets + kOnes * (0x80 - 'A');
+  const std::uint64_t gt_z = heptets + kOnes * (0x80 - 'Z' - 1);
+  const std::uint64_t is_upper = (ge_a ^ gt_z) & ~v & kHighBits;
+  return v | (is_upper >> 2);
+}
+
+static_assert(LowercaseSwar(0x5a41405b7a617f80ULL) == 0x7a61405b7a617f80ULL);
+
+constexpr std::uint64_t kWySecret0 = 0xa0761d6478bd642fULL;
+constexpr std::uint64_t kWySecret1 = 0xe7037ed1a0b428dbULL;
+constexpr std::uint64_t kWySecret2 = 0x8ebc6af09c88c6e3ULL;
+constexpr std::uint64_t kWySecret3 = 0x589965cc75374cc3ULL;
+
+inline void WyMum(std::uint64_t& a, std::uint64_t& b) noexcept {
+#ifdef __SIZEOF_INT128__
+  const auto r = static_cast<unsigned __int128>(a) * b;
+  a = static_cast<std::uint64_t>(r);
+  b = static_cast<std::uint64_t>(r >> 64);
+#else
+  const std::uint64_t ha = a >> 32;
+  const std::uint64_t hb = b >> 32;
+  const std::uint64_t la = static_cast<std::uint32_t>(a);
+  const std::uint64_t lb = static_cast<std::uint32_t>(b);
+  const std::uint64_t rh = ha * hb;
+  const std::uint64_t rm0 = ha * lb;
+  const std::uint64_t rm1 = hb * la;
+  const std::uint64_t rl = la * lb;
+  const std::uint64_t t = rl + (rm0 << 32);
+  std::uint64_t c = t < rl;
+  const std::uint64_t lo = t + (rm1 << 32);
+  c += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline std::uint64_t WyMix(std::uint64_t a, std::uint64_t b) noexcept {
+  WyMum(a, b);
+  return a ^ b;
+}
+
+inline std::uint64_t LoadLower8(const char* data) noexcept {
+  std::uint64_t result{};
+  std::memcpy(&result, data, 8);
+  return LowercaseSwar(result);
+}
+
+inline std::uint64_t LoadLower4(const char* data) noexcept {
+  std::uint32_t result{};
+  std::memcpy(&result, data, 4);
+  return LowercaseSwar(result);
+}
+
+inline std::uint64_t LoadLower3(const char* data, std::size_t n) noexcept {
+  const std::uint64_t result =
+      (static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[0])) << 16) |
+      (static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[n >> 1]))
+       << 8) |
+      static_cast<std::uint8_t>(data[n - 1]);
+  return LowercaseSwar(result);
+}
+
+// wyhash (final version) with all the loads lowercased
+std::uint64_t WyHashIcase(std::uint64_t seed, std::string_view data) noexcept {
+  const char* p = data.data();
+  const std::size_t len = data.size();
+
+  std::uint64_t a = 0;
+  std::uint64_t b = 0;
+  if (len <= 16) {
+    if (len >= 8) {
+      a = LoadLower8(p);
+      b = LoadLower8(p + len - 8);
+    } else if (len >= 4) {
+      a = LoadLower4(p);
+      b = LoadLower4(p + len - 4);
+    } else if (len > 0) {
+      a = LoadLower3(p, len);
+    }
+  } else {
+    std::size_t i = len;
+    if (i > 48) {
+      std::uint64_t see1 = seed;
+      std::uint64_t see2 = seed;
+      do {
+        seed = WyMix(LoadLower8(p) ^ kWySecret0, LoadLower8(p + 8) ^ seed);
+        see1 =
+            WyMix(LoadLower8(p + 16) ^ kWySecret2, LoadLower8(p + 24) ^ see1);
+        see2 =
+            WyMix(LoadLower8(p + 32) ^ kWySecret3, LoadLower8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = WyMix(LoadLower8(p) ^ kWySecret1, LoadLower8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = LoadLower8(p + i - 16);
+    b = LoadLower8(p + i - 8);
+  }
+
+  a ^= kWySecret1;
+  b ^= seed;
+  WyMum(a, b);
+  return WyMix(a ^ kWySecret0 ^ len, b ^ kWySecret1);
+}
+
 template <typename Fetcher, std::size_t SixteenOrEight>
 inline bool CompareAndAdvance(std::string_view& lhs,
                               std::string_view& rhs) noexcept {
@@ -421,6 +538,15 @@ std::uint64_t CaseInsensitiveSipHasherNoSse::operator()(
   return SipHash13<CaseInsensitiveFetcher>(k0_, k1_, data);
 }
 
+CaseInsensitiveWyHasher::CaseInsensitiveWyHasher(std::uint64_t k0,
+                                                 std::uint64_t k1) noexcept
+    : seed_{k0 ^ WyMix(k0 ^ kWySecret0, k1 ^ kWySecret1)} {}
+
+std::uint64_t CaseInsensitiveWyHasher::operator()(std::string_view data) const
+    noexcept {
+  return WyHashIcase(seed_, data);
+}
+
 bool CaseInsensitiveEqual::operator()(std::string_view lhs,
                                       std::string_view rhs) const noexcept {
 #ifdef __SSE2__
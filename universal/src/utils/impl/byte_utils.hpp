@@ -47,6 +47,22 @@ class CaseInsensitiveSipHasherNoSse final {
   const std::uint64_t k1_;
 };
 
+// wyhash-like hashing with uppercase ASCII symbols ('A' - 'Z') being treated
+// as their lowercase counterpart. Lowercasing is done 8 bytes at a time (SWAR)
+// and the whole thing is a few multiplications for typical HTTP header names,
+// which makes it about twice as fast as CaseInsensitiveSipHasher on short
+// keys. Unlike SipHash it is not a keyed PRF: don't use it for keys controlled
+// by an attacker even with a random seed.
+class CaseInsensitiveWyHasher final {
+ public:
+  CaseInsensitiveWyHasher(std::uint64_t k0, std::uint64_t k1) noexcept;
+
+  std::uint64_t operator()(std::string_view data) const noexcept;
+
+ private:
+  const std::uint64_t seed_;
+};
+
 class CaseInsensitiveEqual final {
  public:
   bool operator()(std::string_view lhs, std::string_view rhs) const noexcept;
@@ -1,6 +1,7 @@
 #include <userver/utils/rand.hpp>
 
 #include <array>
+#include <limits>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,34 +12,86 @@ namespace {
 // 256 bits of randomness is enough for everyone
 constexpr std::size_t kRandomSeedInts = 8;
 
-class RandomImpl final : public RandomBase {
- public:
-  // NOLINTNEXTLINE(cert-msc51-cpp)
-  RandomImpl() {
-    std::random_device device;
+std::uint64_t SplitMix64(std::uint64_t& state) noexcept {
+  std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
 
-    std::array<std::seed_seq::result_type, kRandomSeedInts> random_chunks{};
-    for (auto& random_chunk : random_chunks) {
-      random_chunk = device();
+// xoshiro256** by David Blackman and Sebastiano Vigna, a few times faster
+// than std::mt19937 and with a 32 byte state instead of 2.5 KB
+class Xoshiro256StarStar final {
+ public:
+  template <typename SeedInts>
+  explicit Xoshiro256StarStar(const SeedInts& seed) noexcept {
+    static_assert(std::tuple_size_v<SeedInts> == kRandomSeedInts);
+    for (std::size_t i = 0; i < state_.size(); ++i) {
+      // Mixing the seed ints guarantees a non-zero state
+      std::uint64_t mixed = std::uint64_t{seed[i * 2]} << 32 | seed[i * 2 + 1];
+      state_[i] = SplitMix64(mixed);
     }
+  }
+
+  std::uint64_t operator()() noexcept {
+    const auto result = RotateLeft(state_[1] * 5, 7) * 9;
+    const auto t = state_[1] << 17;
+
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = RotateLeft(state_[3], 45);
+
+    return result;
+  }
+
+ private:
+  static std::uint64_t RotateLeft(std::uint64_t x, int k) noexcept {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::array<std::uint64_t, 4> state_{};
+};
+
+std::array<std::random_device::result_type, kRandomSeedInts> MakeSeed() {
+  std::random_device device;
 
-    std::seed_seq seed(random_chunks.begin(), random_chunks.end());
-    gen_.seed(seed);
+  std::array<std::random_device::result_type, kRandomSeedInts> random_chunks{};
+  for (auto& random_chunk : random_chunks) {
+    random_chunk = device();
   }
+  return random_chunks;
+}
 
-  result_type operator()() override { return gen_(); }
+class RandomImpl final : public RandomBase {
+ public:
+  RandomImpl() : gen_(MakeSeed()) {}
+
+  // The high bits of xoshiro256** are the best ones
+  result_type operator()() override {
+    return static_cast<result_type>(gen_() >> 32);
+  }
+
+  std::uint64_t Next64() noexcept { return gen_(); }
 
  private:
-  std::mt19937 gen_;
+  Xoshiro256StarStar gen_;
 };
 
-}  // namespace
+static_assert(RandomImpl::min() == std::numeric_limits<std::uint32_t>::min());
+static_assert(RandomImpl::max() == std::numeric_limits<std::uint32_t>::max());
 
-RandomBase& DefaultRandom() {
+RandomImpl& GetDefaultRandomImpl() {
   thread_local RandomImpl random;
   return random;
 }
 
+}  // namespace
+
+RandomBase& DefaultRandom() { return GetDefaultRandomImpl(); }
+
 RandomBase& impl::DefaultRandomForHashSeed() {
   thread_local RandomImpl random;
   return random;
@@ -48,6 +101,8 @@ uint32_t Rand() {
   return std::uniform_int_distribution<uint32_t>{0}(DefaultRandom());
 }
 
+uint64_t Rand64() { return GetDefaultRandomImpl().Next64(); }
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/utils/rand.hpp>
 
 #include <random>
+#include <set>
 #include <type_traits>
 
 #include <gtest/gtest.h>
@@ -36,4 +37,12 @@ TEST(Random, RandRange) {
   }
 }
 
+TEST(Random, Rand64) {
+  std::set<uint64_t> values;
+  for (int iter = 0; iter < kIterations; ++iter) {
+    values.insert(utils::Rand64());
+  }
+  EXPECT_EQ(values.size(), static_cast<std::size_t>(kIterations));
+}
+
 USERVER_NAMESPACE_END
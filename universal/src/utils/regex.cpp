@@ -1,18 +1,74 @@
 #include <userver/utils/regex.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#ifdef USERVER_FEATURE_RE2
+#include <re2/re2.h>
+#include <re2/set.h>
+#else
 #include <boost/regex.hpp>
+#endif
+
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+#ifdef USERVER_FEATURE_RE2
+
+namespace {
+
+re2::StringPiece ToStringPiece(std::string_view str) {
+  return {str.data(), str.size()};
+}
+
+RE2::Options MakeRe2Options() {
+  RE2::Options options;
+  options.set_log_errors(false);
+  return options;
+}
+
+}  // namespace
+
+struct regex::Impl {
+  // RE2 is immutable after the construction and is safe to share
+  std::shared_ptr<const RE2> r;
+
+  Impl() = default;
+  explicit Impl(std::string_view pattern)
+      : r(std::make_shared<const RE2>(ToStringPiece(pattern),
+                                      MakeRe2Options())) {
+    if (!r->ok()) {
+      throw std::runtime_error(fmt::format("Invalid regex '{}': {}", pattern,
+                                           r->error()));
+    }
+  }
+
+  void swap(Impl& other) noexcept { r.swap(other.r); }
+
+  const RE2& Get() const {
+    UINVARIANT(r, "Matching with a default constructed utils::regex");
+    return *r;
+  }
+};
+
+#else
+
 struct regex::Impl {
   boost::regex r;
 
   Impl() = default;
   explicit Impl(std::string_view pattern) : r(pattern.begin(), pattern.end()) {}
+
+  void swap(Impl& other) noexcept { r.swap(other.r); }
 };
 
+#endif
+
 regex::regex() = default;
 
 regex::regex(std::string_view pattern) : impl_(regex::Impl(pattern)) {}
@@ -21,21 +77,122 @@ regex::~regex() = default;
 
 regex::regex(const regex&) = default;
 
-regex::regex(regex&& r) noexcept { impl_->r.swap(r.impl_->r); }
+regex::regex(regex&& r) noexcept { impl_->swap(*r.impl_); }
 
 regex& regex::operator=(const regex&) = default;
 
 regex& regex::operator=(regex&& r) noexcept {
-  impl_->r.swap(r.impl_->r);
+  impl_->swap(*r.impl_);
   return *this;
 }
 
 bool regex_match(std::string_view str, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2
+  return RE2::FullMatch(ToStringPiece(str), pattern.impl_->Get());
+#else
   return boost::regex_match(str.begin(), str.end(), pattern.impl_->r);
+#endif
 }
 
 bool regex_search(std::string_view str, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2
+  return RE2::PartialMatch(ToStringPiece(str), pattern.impl_->Get());
+#else
   return boost::regex_search(str.begin(), str.end(), pattern.impl_->r);
+#endif
+}
+
+#ifdef USERVER_FEATURE_RE2
+
+struct RegexSet::Impl {
+  RE2::Set set{MakeRe2Options(), RE2::UNANCHORED};
+  std::size_t size{0};
+
+  explicit Impl(const std::vector<std::string>& patterns) {
+    std::string error;
+    for (const auto& pattern : patterns) {
+      if (set.Add(ToStringPiece(pattern), &error) < 0) {
+        throw std::runtime_error(
+            fmt::format("Invalid regex '{}': {}", pattern, error));
+      }
+    }
+    // RE2::Set can not match an empty set
+    if (!patterns.empty() && !set.Compile()) {
+      throw std::runtime_error(
+          "Failed to compile the regex set: out of memory");
+    }
+    size = patterns.size();
+  }
+
+  bool SearchAny(std::string_view str) const {
+    return size != 0 && set.Match(ToStringPiece(str), nullptr);
+  }
+
+  std::vector<std::size_t> Search(std::string_view str) const {
+    std::vector<std::size_t> result;
+    if (size == 0) return result;
+
+    std::vector<int> matches;
+    if (!set.Match(ToStringPiece(str), &matches)) return result;
+
+    result.assign(matches.begin(), matches.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+};
+
+#else
+
+struct RegexSet::Impl {
+  std::vector<boost::regex> regexes;
+  std::size_t size{0};
+
+  explicit Impl(const std::vector<std::string>& patterns)
+      : size(patterns.size()) {
+    regexes.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+      regexes.emplace_back(pattern);
+    }
+  }
+
+  bool SearchAny(std::string_view str) const {
+    return std::any_of(regexes.begin(), regexes.end(), [str](const auto& r) {
+      return boost::regex_search(str.begin(), str.end(), r);
+    });
+  }
+
+  std::vector<std::size_t> Search(std::string_view str) const {
+    std::vector<std::size_t> result;
+    for (std::size_t i = 0; i < regexes.size(); ++i) {
+      if (boost::regex_search(str.begin(), str.end(), regexes[i])) {
+        result.push_back(i);
+      }
+    }
+    return result;
+  }
+};
+
+#endif
+
+RegexSet::RegexSet() : RegexSet(std::vector<std::string>{}) {}
+
+RegexSet::RegexSet(const std::vector<std::string>& patterns)
+    : impl_(std::make_unique<Impl>(patterns)) {}
+
+RegexSet::~RegexSet() = default;
+
+RegexSet::RegexSet(RegexSet&&) noexcept = default;
+
+RegexSet& RegexSet::operator=(RegexSet&&) noexcept = default;
+
+std::size_t RegexSet::size() const noexcept { return impl_->size; }
+
+bool RegexSet::SearchAny(std::string_view str) const {
+  return impl_->SearchAny(str);
+}
+
+std::vector<std::size_t> RegexSet::Search(std::string_view str) const {
+  return impl_->Search(str);
 }
 
 }  // namespace utils
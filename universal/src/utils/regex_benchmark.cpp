@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <boost/regex.hpp>
+#include <fmt/format.h>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kPattern = "^[a-z]+-[0-9a-f]{8}(-[0-9a-f]{4}){3}$";
+
+// Typical header values, only the last one matches kPattern
+const std::vector<std::string> kValues = {
+    "application/json",
+    "gzip, deflate, br",
+    "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko)",
+    "request-0123abcd-4567-89ab-cdef",
+};
+
+std::vector<std::string> GeneratePatterns(std::size_t count) {
+  std::vector<std::string> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(fmt::format("^/v{}/[a-z]+/[0-9]+/item{}$", i % 4, i));
+  }
+  return result;
+}
+
+std::string GenerateRoute(std::size_t pattern_count) {
+  return fmt::format("/v{}/users/42/item{}", (pattern_count - 1) % 4,
+                     pattern_count - 1);
+}
+
+}  // namespace
+
+void RegexSearchBoost(benchmark::State& state) {
+  const boost::regex r(kPattern.begin(), kPattern.end());
+  for (auto _ : state) {
+    for (const auto& value : kValues) {
+      benchmark::DoNotOptimize(
+          boost::regex_search(value.begin(), value.end(), r));
+    }
+  }
+}
+BENCHMARK(RegexSearchBoost);
+
+void RegexSearchUtils(benchmark::State& state) {
+  const utils::regex r(kPattern);
+  for (auto _ : state) {
+    for (const auto& value : kValues) {
+      benchmark::DoNotOptimize(utils::regex_search(value, r));
+    }
+  }
+}
+BENCHMARK(RegexSearchUtils);
+
+void RegexSearchEach(benchmark::State& state) {
+  const auto patterns = GeneratePatterns(state.range(0));
+  std::vector<utils::regex> regexes;
+  for (const auto& pattern : patterns) {
+    regexes.emplace_back(pattern);
+  }
+  const auto route = GenerateRoute(patterns.size());
+
+  for (auto _ : state) {
+    std::vector<std::size_t> matches;
+    for (std::size_t i = 0; i < regexes.size(); ++i) {
+      if (utils::regex_search(route, regexes[i])) matches.push_back(i);
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+}
+BENCHMARK(RegexSearchEach)->RangeMultiplier(4)->Range(4, 256);
+
+void RegexSetSearch(benchmark::State& state) {
+  const auto patterns = GeneratePatterns(state.range(0));
+  const utils::RegexSet set(patterns);
+  const auto route = GenerateRoute(patterns.size());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.Search(route));
+  }
+}
+BENCHMARK(RegexSetSearch)->RangeMultiplier(4)->Range(4, 256);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+
 #include <userver/utils/regex.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,4 +37,39 @@ TEST(Regex, Search) {
   EXPECT_TRUE(utils::regex_search("a123a", r));
 }
 
+TEST(Regex, InvalidPattern) {
+  EXPECT_THROW(utils::regex("(unbalanced"), std::runtime_error);
+}
+
+TEST(RegexSet, Empty) {
+  utils::RegexSet set;
+  EXPECT_EQ(set.size(), 0);
+  EXPECT_FALSE(set.SearchAny("text"));
+  EXPECT_TRUE(set.Search("text").empty());
+}
+
+TEST(RegexSet, Search) {
+  const utils::RegexSet set({"^/v1/", "[0-9]+$", "^/v1/users/[0-9]+$", "z"});
+  EXPECT_EQ(set.size(), 4);
+
+  using Indexes = std::vector<std::size_t>;
+  EXPECT_EQ(set.Search("/v1/users/42"), (Indexes{0, 1, 2}));
+  EXPECT_EQ(set.Search("/v1/users/me"), (Indexes{0}));
+  EXPECT_EQ(set.Search("/v2/zones/1"), (Indexes{1, 3}));
+  EXPECT_EQ(set.Search(""), Indexes{});
+
+  EXPECT_TRUE(set.SearchAny("/v1/"));
+  EXPECT_TRUE(set.SearchAny("42"));
+  EXPECT_FALSE(set.SearchAny("/v2/users/me"));
+
+  utils::RegexSet moved = utils::RegexSet({"a"});
+  moved = utils::RegexSet(std::vector<std::string>{"b"});
+  EXPECT_FALSE(moved.SearchAny("a"));
+  EXPECT_TRUE(moved.SearchAny("b"));
+}
+
+TEST(RegexSet, InvalidPattern) {
+  EXPECT_THROW(utils::RegexSet({"valid", "(unbalanced"}), std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <userver/utils/small_vector.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::size_t allocations_count = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    ++allocations_count;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+// Typical hot path: a few short items are collected and then consumed
+template <typename Container>
+void FillStrings(benchmark::State& state) {
+  const auto size = state.range(0);
+  allocations_count = 0;
+  for (auto _ : state) {
+    Container container;
+    for (std::int64_t i = 0; i < size; ++i) {
+      container.emplace_back("content-type");
+    }
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      allocations_count, benchmark::Counter::kAvgIterations);
+}
+
+template <typename Container>
+void FillInts(benchmark::State& state) {
+  const auto size = state.range(0);
+  allocations_count = 0;
+  for (auto _ : state) {
+    Container container;
+    for (std::int64_t i = 0; i < size; ++i) container.push_back(i);
+    benchmark::DoNotOptimize(container.data());
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      allocations_count, benchmark::Counter::kAvgIterations);
+}
+
+using StdVectorStrings =
+    std::vector<std::string, CountingAllocator<std::string>>;
+using SmallVectorStrings =
+    utils::SmallVector<std::string, 4, CountingAllocator<std::string>>;
+using StdVectorInts = std::vector<int, CountingAllocator<int>>;
+using SmallVectorInts = utils::SmallVector<int, 4, CountingAllocator<int>>;
+
+}  // namespace
+
+// Allocations of the std::string itself are not counted
+BENCHMARK_TEMPLATE(FillStrings, StdVectorStrings)->DenseRange(1, 5);
+BENCHMARK_TEMPLATE(FillStrings, SmallVectorStrings)->DenseRange(1, 5);
+BENCHMARK_TEMPLATE(FillInts, StdVectorInts)->DenseRange(1, 5);
+BENCHMARK_TEMPLATE(FillInts, SmallVectorInts)->DenseRange(1, 5);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <userver/utils/small_vector.hpp>
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::size_t allocations_count = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    ++allocations_count;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace
+
+TEST(SmallVector, Sample) {
+  /// [Sample SmallVector]
+  utils::SmallVector<std::string, 4> headers;
+  headers.push_back("Host");
+  headers.emplace_back("Accept");
+  ASSERT_EQ(headers.size(), 2);
+  ASSERT_EQ(headers.capacity(), 4);  // no dynamic allocations yet
+
+  headers.insert(headers.end(), {"Date", "Server", "Content-Type"});
+  ASSERT_EQ(headers.size(), 5);
+  ASSERT_EQ(headers.back(), "Content-Type");
+  /// [Sample SmallVector]
+}
+
+TEST(SmallVector, InlineStorage) {
+  allocations_count = 0;
+  utils::SmallVector<int, 4, CountingAllocator<int>> values;
+  for (int i = 0; i < 4; ++i) values.push_back(i);
+  EXPECT_EQ(allocations_count, 0);
+
+  values.push_back(4);
+  EXPECT_EQ(allocations_count, 1);
+  EXPECT_GE(values.capacity(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(values[i], i);
+}
+
+TEST(SmallVector, Move) {
+  allocations_count = 0;
+  utils::SmallVector<std::string, 2, CountingAllocator<std::string>> source{
+      "a", "b"};
+  auto inline_moved = std::move(source);
+  EXPECT_EQ(inline_moved.size(), 2);
+  EXPECT_EQ(inline_moved[1], "b");
+
+  inline_moved.push_back("c");
+  const auto* const data = inline_moved.data();
+  const auto heap_moved = std::move(inline_moved);
+  EXPECT_EQ(heap_moved.data(), data);  // buffer is stolen, not copied
+  EXPECT_EQ(heap_moved.size(), 3);
+  EXPECT_EQ(allocations_count, 1);
+}
+
+USERVER_NAMESPACE_END
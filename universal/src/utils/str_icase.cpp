@@ -32,6 +32,19 @@ std::size_t StrIcaseHash::operator()(std::string_view s) const& noexcept {
   return impl::CaseInsensitiveSipHasher{seed_.k0, seed_.k1}(s);
 }
 
+StrIcaseFastHash::StrIcaseFastHash()
+    : StrIcaseFastHash{HashSeed{
+          std::uniform_int_distribution<std::uint64_t>{}(
+              impl::DefaultRandomForHashSeed()),
+          std::uniform_int_distribution<std::uint64_t>{}(
+              impl::DefaultRandomForHashSeed())}} {}
+
+StrIcaseFastHash::StrIcaseFastHash(HashSeed seed) noexcept : seed_{seed} {}
+
+std::size_t StrIcaseFastHash::operator()(std::string_view s) const& noexcept {
+  return impl::CaseInsensitiveWyHasher{seed_.k0, seed_.k1}(s);
+}
+
 StrCaseHash::StrCaseHash()
     : StrCaseHash{HashSeed{std::uniform_int_distribution<std::uint64_t>{}(
                                impl::DefaultRandomForHashSeed()),
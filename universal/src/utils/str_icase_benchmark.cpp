@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <string_view>
 #include <vector>
 
 #include <userver/utils/rand.hpp>
@@ -28,6 +29,23 @@ std::string GenerateRandomLowercaseString(std::size_t len) {
   return result;
 }
 
+// Typical request header names, 4 to 27 bytes long
+constexpr std::string_view kHeaderNames[] = {
+    "Host",
+    "Accept",
+    "Cookie",
+    "Referer",
+    "User-Agent",
+    "Content-Type",
+    "X-Request-Id",
+    "Authorization",
+    "Content-Length",
+    "Accept-Encoding",
+    "X-Forwarded-For",
+    "X-YaRequestId",
+    "Access-Control-Allow-Origin",
+};
+
 }  // namespace
 
 template <typename Hasher>
@@ -49,6 +67,8 @@ BENCHMARK_TEMPLATE(HashLowercaseString, utils::StrCaseHash)
     ->DenseRange(8, 64, 2);
 BENCHMARK_TEMPLATE(HashLowercaseString, utils::StrIcaseHash)
     ->DenseRange(8, 40, 1);
+BENCHMARK_TEMPLATE(HashLowercaseString, utils::StrIcaseFastHash)
+    ->DenseRange(8, 40, 1);
 
 template <typename Hasher>
 void HashRandomCaseString(benchmark::State& state) {
@@ -79,6 +99,43 @@ void HashRandomCaseString(benchmark::State& state) {
 
 BENCHMARK_TEMPLATE(HashRandomCaseString, utils::StrIcaseHash)
     ->DenseRange(8, 65, 3);
+BENCHMARK_TEMPLATE(HashRandomCaseString, utils::StrIcaseFastHash)
+    ->DenseRange(8, 65, 3);
+
+template <typename Hasher>
+void HashHeaderNames(benchmark::State& state) {
+  const Hasher hasher{};
+
+  for (auto _ : state) {
+    for (const auto name : kHeaderNames) {
+      benchmark::DoNotOptimize(hasher(name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * std::size(kHeaderNames));
+}
+
+BENCHMARK_TEMPLATE(HashHeaderNames, utils::StrIcaseHash);
+BENCHMARK_TEMPLATE(HashHeaderNames, utils::StrIcaseFastHash);
+
+void CaseInsensitiveCompareHeaderNames(benchmark::State& state) {
+  std::vector<std::string> uppercase;
+  for (const auto name : kHeaderNames) {
+    uppercase.emplace_back(name);
+    for (auto& c : uppercase.back()) {
+      if ('a' <= c && c <= 'z') c -= 32;
+    }
+  }
+  const auto cmp = utils::StrIcaseEqual{};
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < uppercase.size(); ++i) {
+      benchmark::DoNotOptimize(cmp(kHeaderNames[i], uppercase[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * uppercase.size());
+}
+
+BENCHMARK(CaseInsensitiveCompareHeaderNames);
 
 void CaseInsensitiveCompareEqualStrings(benchmark::State& state) {
   const auto len = state.range(0);
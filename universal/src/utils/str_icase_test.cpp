@@ -32,6 +32,44 @@ TEST(StrIcases, Hash) {
             hash(std::string_view("warning")));
 }
 
+TEST(StrIcases, FastHash) {
+  const utils::StrIcaseFastHash hash{};
+  EXPECT_EQ(hash(kLowercaseChars), hash(kUppercaseChars));
+  EXPECT_EQ(hash(std::string_view("a\0BcDz0", 7)),
+            hash(std::string_view("A\0bCdZ0", 7)));
+  EXPECT_NE(hash(std::string_view("[")), hash(std::string_view("{")));
+  EXPECT_NE(hash(std::string_view("@")), hash(std::string_view("`")));
+
+  std::string lower;
+  std::string upper;
+  std::size_t prev_hash = hash(lower);
+  for (std::size_t i = 0; i < 130; ++i) {
+    lower += kLowercaseChars[i % kLowercaseChars.size()];
+    upper += kUppercaseChars[i % kUppercaseChars.size()];
+    EXPECT_EQ(hash(lower), hash(upper)) << lower;
+    EXPECT_NE(hash(lower), prev_hash) << lower;
+    prev_hash = hash(lower);
+
+    auto changed = upper;
+    changed.front() = '_';
+    EXPECT_NE(hash(changed), hash(upper)) << lower;
+    changed = upper;
+    changed.back() = '_';
+    EXPECT_NE(hash(changed), hash(upper)) << lower;
+  }
+}
+
+TEST(StrIcases, FastHashSeed) {
+  EXPECT_NE(utils::StrIcaseFastHash{}("foo"), utils::StrIcaseFastHash{}("foo"));
+
+  const utils::HashSeed seed{1, 2};
+  const utils::HashSeed other_seed{1, 3};
+  EXPECT_EQ(utils::StrIcaseFastHash{seed}("foo"),
+            utils::StrIcaseFastHash{seed}("FOO"));
+  EXPECT_NE(utils::StrIcaseFastHash{seed}("foo"),
+            utils::StrIcaseFastHash{other_seed}("foo"));
+}
+
 TEST(StrCases, Hash) {
   utils::StrCaseHash hash{};
 
@@ -2,7 +2,11 @@
 
 #include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include <benchmark/benchmark.h>
 
@@ -204,6 +208,280 @@ std::optional<Enum1> Enum1From2Switch(Enum2 value) {
   }
 }
 
+// Parsing of a protocol enum: many keys of the same length
+constexpr utils::TrivialBiMap kLargeTrivialBiMap = [](auto selector) {
+  return selector()
+      .Case("protocol_field_000", 0)
+      .Case("protocol_field_001", 1)
+      .Case("protocol_field_002", 2)
+      .Case("protocol_field_003", 3)
+      .Case("protocol_field_004", 4)
+      .Case("protocol_field_005", 5)
+      .Case("protocol_field_006", 6)
+      .Case("protocol_field_007", 7)
+      .Case("protocol_field_008", 8)
+      .Case("protocol_field_009", 9)
+      .Case("protocol_field_010", 10)
+      .Case("protocol_field_011", 11)
+      .Case("protocol_field_012", 12)
+      .Case("protocol_field_013", 13)
+      .Case("protocol_field_014", 14)
+      .Case("protocol_field_015", 15)
+      .Case("protocol_field_016", 16)
+      .Case("protocol_field_017", 17)
+      .Case("protocol_field_018", 18)
+      .Case("protocol_field_019", 19)
+      .Case("protocol_field_020", 20)
+      .Case("protocol_field_021", 21)
+      .Case("protocol_field_022", 22)
+      .Case("protocol_field_023", 23)
+      .Case("protocol_field_024", 24)
+      .Case("protocol_field_025", 25)
+      .Case("protocol_field_026", 26)
+      .Case("protocol_field_027", 27)
+      .Case("protocol_field_028", 28)
+      .Case("protocol_field_029", 29)
+      .Case("protocol_field_030", 30)
+      .Case("protocol_field_031", 31)
+      .Case("protocol_field_032", 32)
+      .Case("protocol_field_033", 33)
+      .Case("protocol_field_034", 34)
+      .Case("protocol_field_035", 35)
+      .Case("protocol_field_036", 36)
+      .Case("protocol_field_037", 37)
+      .Case("protocol_field_038", 38)
+      .Case("protocol_field_039", 39)
+      .Case("protocol_field_040", 40)
+      .Case("protocol_field_041", 41)
+      .Case("protocol_field_042", 42)
+      .Case("protocol_field_043", 43)
+      .Case("protocol_field_044", 44)
+      .Case("protocol_field_045", 45)
+      .Case("protocol_field_046", 46)
+      .Case("protocol_field_047", 47)
+      .Case("protocol_field_048", 48)
+      .Case("protocol_field_049", 49)
+      .Case("protocol_field_050", 50)
+      .Case("protocol_field_051", 51)
+      .Case("protocol_field_052", 52)
+      .Case("protocol_field_053", 53)
+      .Case("protocol_field_054", 54)
+      .Case("protocol_field_055", 55)
+      .Case("protocol_field_056", 56)
+      .Case("protocol_field_057", 57)
+      .Case("protocol_field_058", 58)
+      .Case("protocol_field_059", 59)
+      .Case("protocol_field_060", 60)
+      .Case("protocol_field_061", 61)
+      .Case("protocol_field_062", 62)
+      .Case("protocol_field_063", 63)
+      .Case("protocol_field_064", 64)
+      .Case("protocol_field_065", 65)
+      .Case("protocol_field_066", 66)
+      .Case("protocol_field_067", 67)
+      .Case("protocol_field_068", 68)
+      .Case("protocol_field_069", 69)
+      .Case("protocol_field_070", 70)
+      .Case("protocol_field_071", 71)
+      .Case("protocol_field_072", 72)
+      .Case("protocol_field_073", 73)
+      .Case("protocol_field_074", 74)
+      .Case("protocol_field_075", 75)
+      .Case("protocol_field_076", 76)
+      .Case("protocol_field_077", 77)
+      .Case("protocol_field_078", 78)
+      .Case("protocol_field_079", 79)
+      .Case("protocol_field_080", 80)
+      .Case("protocol_field_081", 81)
+      .Case("protocol_field_082", 82)
+      .Case("protocol_field_083", 83)
+      .Case("protocol_field_084", 84)
+      .Case("protocol_field_085", 85)
+      .Case("protocol_field_086", 86)
+      .Case("protocol_field_087", 87)
+      .Case("protocol_field_088", 88)
+      .Case("protocol_field_089", 89)
+      .Case("protocol_field_090", 90)
+      .Case("protocol_field_091", 91)
+      .Case("protocol_field_092", 92)
+      .Case("protocol_field_093", 93)
+      .Case("protocol_field_094", 94)
+      .Case("protocol_field_095", 95)
+      .Case("protocol_field_096", 96)
+      .Case("protocol_field_097", 97)
+      .Case("protocol_field_098", 98)
+      .Case("protocol_field_099", 99)
+      .Case("protocol_field_100", 100)
+      .Case("protocol_field_101", 101)
+      .Case("protocol_field_102", 102)
+      .Case("protocol_field_103", 103)
+      .Case("protocol_field_104", 104)
+      .Case("protocol_field_105", 105)
+      .Case("protocol_field_106", 106)
+      .Case("protocol_field_107", 107)
+      .Case("protocol_field_108", 108)
+      .Case("protocol_field_109", 109)
+      .Case("protocol_field_110", 110)
+      .Case("protocol_field_111", 111)
+      .Case("protocol_field_112", 112)
+      .Case("protocol_field_113", 113)
+      .Case("protocol_field_114", 114)
+      .Case("protocol_field_115", 115)
+      .Case("protocol_field_116", 116)
+      .Case("protocol_field_117", 117)
+      .Case("protocol_field_118", 118)
+      .Case("protocol_field_119", 119)
+      .Case("protocol_field_120", 120)
+      .Case("protocol_field_121", 121)
+      .Case("protocol_field_122", 122)
+      .Case("protocol_field_123", 123)
+      .Case("protocol_field_124", 124)
+      .Case("protocol_field_125", 125)
+      .Case("protocol_field_126", 126)
+      .Case("protocol_field_127", 127);
+};
+
+const auto kLargeUnorderedMapping =
+    std::unordered_map<std::string_view, int>{
+        {"protocol_field_000", 0},
+        {"protocol_field_001", 1},
+        {"protocol_field_002", 2},
+        {"protocol_field_003", 3},
+        {"protocol_field_004", 4},
+        {"protocol_field_005", 5},
+        {"protocol_field_006", 6},
+        {"protocol_field_007", 7},
+        {"protocol_field_008", 8},
+        {"protocol_field_009", 9},
+        {"protocol_field_010", 10},
+        {"protocol_field_011", 11},
+        {"protocol_field_012", 12},
+        {"protocol_field_013", 13},
+        {"protocol_field_014", 14},
+        {"protocol_field_015", 15},
+        {"protocol_field_016", 16},
+        {"protocol_field_017", 17},
+        {"protocol_field_018", 18},
+        {"protocol_field_019", 19},
+        {"protocol_field_020", 20},
+        {"protocol_field_021", 21},
+        {"protocol_field_022", 22},
+        {"protocol_field_023", 23},
+        {"protocol_field_024", 24},
+        {"protocol_field_025", 25},
+        {"protocol_field_026", 26},
+        {"protocol_field_027", 27},
+        {"protocol_field_028", 28},
+        {"protocol_field_029", 29},
+        {"protocol_field_030", 30},
+        {"protocol_field_031", 31},
+        {"protocol_field_032", 32},
+        {"protocol_field_033", 33},
+        {"protocol_field_034", 34},
+        {"protocol_field_035", 35},
+        {"protocol_field_036", 36},
+        {"protocol_field_037", 37},
+        {"protocol_field_038", 38},
+        {"protocol_field_039", 39},
+        {"protocol_field_040", 40},
+        {"protocol_field_041", 41},
+        {"protocol_field_042", 42},
+        {"protocol_field_043", 43},
+        {"protocol_field_044", 44},
+        {"protocol_field_045", 45},
+        {"protocol_field_046", 46},
+        {"protocol_field_047", 47},
+        {"protocol_field_048", 48},
+        {"protocol_field_049", 49},
+        {"protocol_field_050", 50},
+        {"protocol_field_051", 51},
+        {"protocol_field_052", 52},
+        {"protocol_field_053", 53},
+        {"protocol_field_054", 54},
+        {"protocol_field_055", 55},
+        {"protocol_field_056", 56},
+        {"protocol_field_057", 57},
+        {"protocol_field_058", 58},
+        {"protocol_field_059", 59},
+        {"protocol_field_060", 60},
+        {"protocol_field_061", 61},
+        {"protocol_field_062", 62},
+        {"protocol_field_063", 63},
+        {"protocol_field_064", 64},
+        {"protocol_field_065", 65},
+        {"protocol_field_066", 66},
+        {"protocol_field_067", 67},
+        {"protocol_field_068", 68},
+        {"protocol_field_069", 69},
+        {"protocol_field_070", 70},
+        {"protocol_field_071", 71},
+        {"protocol_field_072", 72},
+        {"protocol_field_073", 73},
+        {"protocol_field_074", 74},
+        {"protocol_field_075", 75},
+        {"protocol_field_076", 76},
+        {"protocol_field_077", 77},
+        {"protocol_field_078", 78},
+        {"protocol_field_079", 79},
+        {"protocol_field_080", 80},
+        {"protocol_field_081", 81},
+        {"protocol_field_082", 82},
+        {"protocol_field_083", 83},
+        {"protocol_field_084", 84},
+        {"protocol_field_085", 85},
+        {"protocol_field_086", 86},
+        {"protocol_field_087", 87},
+        {"protocol_field_088", 88},
+        {"protocol_field_089", 89},
+        {"protocol_field_090", 90},
+        {"protocol_field_091", 91},
+        {"protocol_field_092", 92},
+        {"protocol_field_093", 93},
+        {"protocol_field_094", 94},
+        {"protocol_field_095", 95},
+        {"protocol_field_096", 96},
+        {"protocol_field_097", 97},
+        {"protocol_field_098", 98},
+        {"protocol_field_099", 99},
+        {"protocol_field_100", 100},
+        {"protocol_field_101", 101},
+        {"protocol_field_102", 102},
+        {"protocol_field_103", 103},
+        {"protocol_field_104", 104},
+        {"protocol_field_105", 105},
+        {"protocol_field_106", 106},
+        {"protocol_field_107", 107},
+        {"protocol_field_108", 108},
+        {"protocol_field_109", 109},
+        {"protocol_field_110", 110},
+        {"protocol_field_111", 111},
+        {"protocol_field_112", 112},
+        {"protocol_field_113", 113},
+        {"protocol_field_114", 114},
+        {"protocol_field_115", 115},
+        {"protocol_field_116", 116},
+        {"protocol_field_117", 117},
+        {"protocol_field_118", 118},
+        {"protocol_field_119", 119},
+        {"protocol_field_120", 120},
+        {"protocol_field_121", 121},
+        {"protocol_field_122", 122},
+        {"protocol_field_123", 123},
+        {"protocol_field_124", 124},
+        {"protocol_field_125", 125},
+        {"protocol_field_126", 126},
+        {"protocol_field_127", 127},
+    };
+
+std::vector<std::string> MakeLargeMapKeys() {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 128; i += 7) {
+    keys.push_back(fmt::format("protocol_field_{:03}", i));
+  }
+  keys.push_back("protocol_field_999");
+  return keys;
+}
+
 }  // namespace
 
 void MappingSmallTrivialBiMap(benchmark::State& state) {
@@ -394,6 +672,47 @@ void MappingHugeUnorderedLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnorderedLast);
 
+void MappingLargeTrivialBiMap(benchmark::State& state) {
+  const auto keys = MakeLargeMapKeys();
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(MyLaunder(key)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(MappingLargeTrivialBiMap);
+
+void MappingLargeTrivialBiMapICase(benchmark::State& state) {
+  const auto keys = MakeLargeMapKeys();
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFindICase(MyLaunder(key)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(MappingLargeTrivialBiMapICase);
+
+void MappingLargeUnordered(benchmark::State& state) {
+  const auto keys = MakeLargeMapKeys();
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(kLargeUnorderedMapping.find(MyLaunder(key)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(MappingLargeUnordered);
+
+void MappingLargeTrivialBiMapToString(benchmark::State& state) {
+  const auto value = Launder(97);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(value));
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMapToString);
+
 void MappingEnumsTrivialBiMap(benchmark::State& state) {
   const auto enum2 = Launder(Enum2::C7);
 
@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cctype>
+#include <string>
+
+#include <fmt/format.h>
+
 USERVER_NAMESPACE_BEGIN
 
 /// [sample string bimap]
@@ -341,4 +346,432 @@ TEST(TrivialBiMap, StringICase) {
       "\xf0\xe1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"));
 }
 
+enum class Field {
+  kField00,
+  kField01,
+  kField02,
+  kField03,
+  kField04,
+  kField05,
+  kField06,
+  kField07,
+  kField08,
+  kField09,
+  kField10,
+  kField11,
+  kField12,
+  kField13,
+  kField14,
+  kField15,
+  kField16,
+  kField17,
+  kField18,
+  kField19,
+  kField20,
+  kField21,
+  kField22,
+  kField23,
+  kField24,
+  kField25,
+  kField26,
+  kField27,
+  kField28,
+  kField29,
+  kField30,
+  kField31,
+  kField32,
+  kField33,
+  kField34,
+  kField35,
+  kField36,
+  kField37,
+  kField38,
+  kField39,
+  kField40,
+  kField41,
+  kField42,
+  kField43,
+  kField44,
+  kField45,
+  kField46,
+  kField47,
+  kField48,
+  kField49,
+  kField50,
+  kField51,
+  kField52,
+  kField53,
+  kField54,
+  kField55,
+  kField56,
+  kField57,
+  kField58,
+  kField59,
+  kField60,
+  kField61,
+  kField62,
+  kField63,
+  kField64,
+  kField65,
+  kField66,
+  kField67,
+  kField68,
+  kField69,
+  kField70,
+  kField71,
+  kUnknown,
+};
+
+// More than 64 Case's with the keys of the same length, uses the string index
+constexpr utils::TrivialBiMap kLargeMap = [](auto selector) {
+  return selector()
+      .Case(Field::kField00, "field_00")
+      .Case(Field::kField01, "field_01")
+      .Case(Field::kField02, "field_02")
+      .Case(Field::kField03, "field_03")
+      .Case(Field::kField04, "field_04")
+      .Case(Field::kField05, "field_05")
+      .Case(Field::kField06, "field_06")
+      .Case(Field::kField07, "field_07")
+      .Case(Field::kField08, "field_08")
+      .Case(Field::kField09, "field_09")
+      .Case(Field::kField10, "field_10")
+      .Case(Field::kField11, "field_11")
+      .Case(Field::kField12, "field_12")
+      .Case(Field::kField13, "field_13")
+      .Case(Field::kField14, "field_14")
+      .Case(Field::kField15, "field_15")
+      .Case(Field::kField16, "field_16")
+      .Case(Field::kField17, "field_17")
+      .Case(Field::kField18, "field_18")
+      .Case(Field::kField19, "field_19")
+      .Case(Field::kField20, "field_20")
+      .Case(Field::kField21, "field_21")
+      .Case(Field::kField22, "field_22")
+      .Case(Field::kField23, "field_23")
+      .Case(Field::kField24, "field_24")
+      .Case(Field::kField25, "field_25")
+      .Case(Field::kField26, "field_26")
+      .Case(Field::kField27, "field_27")
+      .Case(Field::kField28, "field_28")
+      .Case(Field::kField29, "field_29")
+      .Case(Field::kField30, "field_30")
+      .Case(Field::kField31, "field_31")
+      .Case(Field::kField32, "field_32")
+      .Case(Field::kField33, "field_33")
+      .Case(Field::kField34, "field_34")
+      .Case(Field::kField35, "field_35")
+      .Case(Field::kField36, "field_36")
+      .Case(Field::kField37, "field_37")
+      .Case(Field::kField38, "field_38")
+      .Case(Field::kField39, "field_39")
+      .Case(Field::kField40, "field_40")
+      .Case(Field::kField41, "field_41")
+      .Case(Field::kField42, "field_42")
+      .Case(Field::kField43, "field_43")
+      .Case(Field::kField44, "field_44")
+      .Case(Field::kField45, "field_45")
+      .Case(Field::kField46, "field_46")
+      .Case(Field::kField47, "field_47")
+      .Case(Field::kField48, "field_48")
+      .Case(Field::kField49, "field_49")
+      .Case(Field::kField50, "field_50")
+      .Case(Field::kField51, "field_51")
+      .Case(Field::kField52, "field_52")
+      .Case(Field::kField53, "field_53")
+      .Case(Field::kField54, "field_54")
+      .Case(Field::kField55, "field_55")
+      .Case(Field::kField56, "field_56")
+      .Case(Field::kField57, "field_57")
+      .Case(Field::kField58, "field_58")
+      .Case(Field::kField59, "field_59")
+      .Case(Field::kField60, "field_60")
+      .Case(Field::kField61, "field_61")
+      .Case(Field::kField62, "field_62")
+      .Case(Field::kField63, "field_63")
+      .Case(Field::kField64, "field_64")
+      .Case(Field::kField65, "field_65")
+      .Case(Field::kField66, "field_66")
+      .Case(Field::kField67, "field_67")
+      .Case(Field::kField68, "field_68")
+      .Case(Field::kField69, "field_69")
+      .Case(Field::kField70, "field_70")
+      .Case(Field::kField71, "field_71");
+};
+
+constexpr utils::TrivialSet kLargeSet = [](auto selector) {
+  return selector()
+      .Case("header-00")
+      .Case("header-01")
+      .Case("header-02")
+      .Case("header-03")
+      .Case("header-04")
+      .Case("header-05")
+      .Case("header-06")
+      .Case("header-07")
+      .Case("header-08")
+      .Case("header-09")
+      .Case("header-10")
+      .Case("header-11")
+      .Case("header-12")
+      .Case("header-13")
+      .Case("header-14")
+      .Case("header-15")
+      .Case("header-16")
+      .Case("header-17")
+      .Case("header-18")
+      .Case("header-19")
+      .Case("header-20")
+      .Case("header-21")
+      .Case("header-22")
+      .Case("header-23")
+      .Case("header-24")
+      .Case("header-25")
+      .Case("header-26")
+      .Case("header-27")
+      .Case("header-28")
+      .Case("header-29")
+      .Case("header-30")
+      .Case("header-31")
+      .Case("header-32")
+      .Case("header-33")
+      .Case("header-34")
+      .Case("header-35")
+      .Case("header-36")
+      .Case("header-37")
+      .Case("header-38")
+      .Case("header-39")
+      .Case("header-40")
+      .Case("header-41")
+      .Case("header-42")
+      .Case("header-43")
+      .Case("header-44")
+      .Case("header-45")
+      .Case("header-46")
+      .Case("header-47")
+      .Case("header-48")
+      .Case("header-49")
+      .Case("header-50")
+      .Case("header-51")
+      .Case("header-52")
+      .Case("header-53")
+      .Case("header-54")
+      .Case("header-55")
+      .Case("header-56")
+      .Case("header-57")
+      .Case("header-58")
+      .Case("header-59")
+      .Case("header-60")
+      .Case("header-61")
+      .Case("header-62")
+      .Case("header-63")
+      .Case("header-64")
+      .Case("header-65")
+      .Case("header-66")
+      .Case("header-67")
+      .Case("header-68")
+      .Case("header-69")
+      .Case("header-70")
+      .Case("header-71");
+};
+
+TEST(TrivialBiMap, Large) {
+  static_assert(kLargeMap.size() == 72);
+  static_assert(kLargeMap.TryFind("field_07") == Field::kField07);
+  static_assert(kLargeMap.TryFind(Field::kField07) == "field_07");
+  static_assert(kLargeMap.TryFindICase("FIELD_71") == Field::kField71);
+  static_assert(!kLargeMap.TryFind("field_72"));
+  static_assert(kLargeSet.Contains("header-00"));
+  static_assert(!kLargeSet.Contains("header-72"));
+
+  for (int i = 0; i < 72; ++i) {
+    const auto field = static_cast<Field>(i);
+    const auto name = fmt::format("field_{:02}", i);
+    EXPECT_EQ(kLargeMap.TryFind(name), field);
+    EXPECT_EQ(kLargeMap.TryFind(field), name);
+
+    auto upper = name;
+    for (auto& c : upper) c = std::toupper(c);
+    EXPECT_EQ(kLargeMap.TryFindICase(upper), field);
+    EXPECT_FALSE(kLargeMap.TryFind(upper));
+
+    const auto header = fmt::format("header-{:02}", i);
+    EXPECT_TRUE(kLargeSet.Contains(header));
+    EXPECT_TRUE(kLargeSet.ContainsICase("HEADER" + header.substr(6)));
+  }
+
+  EXPECT_FALSE(kLargeMap.TryFind(Field::kUnknown));
+  for (const std::string_view missing :
+       {"", "field_", "field_72", "field_0", "field_000", "afield_01"}) {
+    EXPECT_FALSE(kLargeMap.TryFind(missing)) << missing;
+    EXPECT_FALSE(kLargeMap.TryFindICase(missing)) << missing;
+    EXPECT_FALSE(kLargeSet.Contains(missing)) << missing;
+  }
+}
+
+TEST(TrivialBiMap, LargeMixedCaseAndDuplicates) {
+  // "Key-00" and "key-00" can't be told apart by a case insensitive index,
+  // so the map falls back to the linear search
+  static constexpr utils::TrivialBiMap kMixedCase = [](auto selector) {
+    return selector()
+        .Case("Key-00", 0)
+        .Case("Key-01", 1)
+        .Case("Key-02", 2)
+        .Case("Key-03", 3)
+        .Case("Key-04", 4)
+        .Case("Key-05", 5)
+        .Case("Key-06", 6)
+        .Case("Key-07", 7)
+        .Case("Key-08", 8)
+        .Case("Key-09", 9)
+        .Case("Key-10", 10)
+        .Case("Key-11", 11)
+        .Case("Key-12", 12)
+        .Case("Key-13", 13)
+        .Case("Key-14", 14)
+        .Case("Key-15", 15)
+        .Case("Key-16", 16)
+        .Case("Key-17", 17)
+        .Case("Key-18", 18)
+        .Case("Key-19", 19)
+        .Case("Key-20", 20)
+        .Case("Key-21", 21)
+        .Case("Key-22", 22)
+        .Case("Key-23", 23)
+        .Case("Key-24", 24)
+        .Case("Key-25", 25)
+        .Case("Key-26", 26)
+        .Case("Key-27", 27)
+        .Case("Key-28", 28)
+        .Case("Key-29", 29)
+        .Case("Key-30", 30)
+        .Case("Key-31", 31)
+        .Case("Key-32", 32)
+        .Case("Key-33", 33)
+        .Case("Key-34", 34)
+        .Case("Key-35", 35)
+        .Case("Key-36", 36)
+        .Case("Key-37", 37)
+        .Case("Key-38", 38)
+        .Case("Key-39", 39)
+        .Case("Key-40", 40)
+        .Case("Key-41", 41)
+        .Case("Key-42", 42)
+        .Case("Key-43", 43)
+        .Case("Key-44", 44)
+        .Case("Key-45", 45)
+        .Case("Key-46", 46)
+        .Case("Key-47", 47)
+        .Case("Key-48", 48)
+        .Case("Key-49", 49)
+        .Case("Key-50", 50)
+        .Case("Key-51", 51)
+        .Case("Key-52", 52)
+        .Case("Key-53", 53)
+        .Case("Key-54", 54)
+        .Case("Key-55", 55)
+        .Case("Key-56", 56)
+        .Case("Key-57", 57)
+        .Case("Key-58", 58)
+        .Case("Key-59", 59)
+        .Case("Key-60", 60)
+        .Case("Key-61", 61)
+        .Case("Key-62", 62)
+        .Case("Key-63", 63)
+        .Case("Key-64", 64)
+        .Case("Key-65", 65)
+        .Case("Key-66", 66)
+        .Case("Key-67", 67)
+        .Case("Key-68", 68)
+        .Case("Key-69", 69)
+        .Case("key-00", 100)
+        .Case("Key-00", 200);
+  };
+  EXPECT_EQ(kMixedCase.TryFind("Key-00"), 0);
+  EXPECT_EQ(kMixedCase.TryFind("key-00"), 100);
+  EXPECT_EQ(kMixedCase.TryFind("Key-69"), 69);
+  EXPECT_EQ(kMixedCase.TryFind(200), "Key-00");
+
+  // The first of the duplicate keys wins, just like with the small maps
+  static constexpr utils::TrivialBiMap kDuplicates = [](auto selector) {
+    return selector()
+        .Case("key-00", 0)
+        .Case("key-01", 1)
+        .Case("key-02", 2)
+        .Case("key-03", 3)
+        .Case("key-04", 4)
+        .Case("key-05", 5)
+        .Case("key-06", 6)
+        .Case("key-07", 7)
+        .Case("key-08", 8)
+        .Case("key-09", 9)
+        .Case("key-10", 10)
+        .Case("key-11", 11)
+        .Case("key-12", 12)
+        .Case("key-13", 13)
+        .Case("key-14", 14)
+        .Case("key-15", 15)
+        .Case("key-16", 16)
+        .Case("key-17", 17)
+        .Case("key-18", 18)
+        .Case("key-19", 19)
+        .Case("key-20", 20)
+        .Case("key-21", 21)
+        .Case("key-22", 22)
+        .Case("key-23", 23)
+        .Case("key-24", 24)
+        .Case("key-25", 25)
+        .Case("key-26", 26)
+        .Case("key-27", 27)
+        .Case("key-28", 28)
+        .Case("key-29", 29)
+        .Case("key-30", 30)
+        .Case("key-31", 31)
+        .Case("key-32", 32)
+        .Case("key-33", 33)
+        .Case("key-34", 34)
+        .Case("key-35", 35)
+        .Case("key-36", 36)
+        .Case("key-37", 37)
+        .Case("key-38", 38)
+        .Case("key-39", 39)
+        .Case("key-40", 40)
+        .Case("key-41", 41)
+        .Case("key-42", 42)
+        .Case("key-43", 43)
+        .Case("key-44", 44)
+        .Case("key-45", 45)
+        .Case("key-46", 46)
+        .Case("key-47", 47)
+        .Case("key-48", 48)
+        .Case("key-49", 49)
+        .Case("key-50", 50)
+        .Case("key-51", 51)
+        .Case("key-52", 52)
+        .Case("key-53", 53)
+        .Case("key-54", 54)
+        .Case("key-55", 55)
+        .Case("key-56", 56)
+        .Case("key-57", 57)
+        .Case("key-58", 58)
+        .Case("key-59", 59)
+        .Case("key-60", 60)
+        .Case("key-61", 61)
+        .Case("key-62", 62)
+        .Case("key-63", 63)
+        .Case("key-64", 64)
+        .Case("key-65", 65)
+        .Case("key-66", 66)
+        .Case("key-67", 67)
+        .Case("key-68", 68)
+        .Case("key-69", 69)
+        .Case("key-00", 100)
+        .Case("key-69", 200);
+  };
+  EXPECT_EQ(kDuplicates.TryFind("key-00"), 0);
+  EXPECT_EQ(kDuplicates.TryFind("key-69"), 69);
+  EXPECT_EQ(kDuplicates.TryFindICase("KEY-69"), 69);
+  EXPECT_EQ(kDuplicates.TryFind(200), "key-69");
+}
+
 USERVER_NAMESPACE_END
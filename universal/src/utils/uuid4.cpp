@@ -12,6 +12,15 @@ std::string GenerateUuid() {
   return encoding::ToHex(val.begin(), val.size());
 }
 
+std::vector<std::string> GenerateUuids(std::size_t count) {
+  std::vector<std::string> result;
+  result.reserve(count);
+  for (const auto& val : GenerateBoostUuids(count)) {
+    result.push_back(encoding::ToHex(val.begin(), val.size()));
+  }
+  return result;
+}
+
 }  // namespace utils::generators
 
 USERVER_NAMESPACE_END
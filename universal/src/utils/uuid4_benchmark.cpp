@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include <userver/utils/boost_uuid4.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/uuid4.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+void rand_mt19937_uint64(benchmark::State& state) {
+  // The generator that was used by utils::DefaultRandom, for comparison
+  std::mt19937 gen{std::random_device{}()};
+  std::uniform_int_distribution<std::uint64_t> dist;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dist(gen));
+  }
+}
+BENCHMARK(rand_mt19937_uint64);
+
+void rand_default_random_uint64(benchmark::State& state) {
+  std::uniform_int_distribution<std::uint64_t> dist;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dist(utils::DefaultRandom()));
+  }
+}
+BENCHMARK(rand_default_random_uint64);
+
+void rand_rand64(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::Rand64());
+  }
+}
+BENCHMARK(rand_rand64);
+
+void uuid_generate_boost(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::generators::GenerateBoostUuid());
+  }
+}
+BENCHMARK(uuid_generate_boost);
+
+void uuid_generate_string(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::generators::GenerateUuid());
+  }
+}
+BENCHMARK(uuid_generate_string);
+
+void uuid_generate_strings_bulk(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::generators::GenerateUuids(state.range(0)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(uuid_generate_strings_bulk)->Arg(16)->Arg(256);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/utils/uuid4.hpp>
 
+#include <set>
+
 #include <gtest/gtest.h>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,4 +16,15 @@ TEST(UUID, String) {
             utils::generators::GenerateUuid());
 }
 
+TEST(UUID, StringBulk) {
+  const auto ids = utils::generators::GenerateUuids(100);
+  ASSERT_EQ(ids.size(), 100u);
+  for (const auto& id : ids) {
+    EXPECT_EQ(id.size(), 32u);
+    // version 4
+    EXPECT_EQ(id[12], '4');
+  }
+  EXPECT_EQ(std::set(ids.begin(), ids.end()).size(), ids.size());
+}
+
 USERVER_NAMESPACE_END